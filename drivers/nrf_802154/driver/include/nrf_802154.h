@@ -165,6 +165,20 @@ void nrf_802154_tx_power_set(int8_t power);
  */
 int8_t nrf_802154_tx_power_get(void);
 
+#if NRF_802154_TX_POWER_SPLIT_CACHE_ENABLED || defined(DOXYGEN)
+
+/**
+ * @brief Invalidates the cached transmit power splits.
+ *
+ * This function must be called after the FEM configuration changes, so that the transmit power
+ * split is computed again for the new configuration.
+ *
+ * @note This function is available if @ref NRF_802154_TX_POWER_SPLIT_CACHE_ENABLED is enabled.
+ */
+void nrf_802154_tx_power_split_cache_invalidate(void);
+
+#endif // NRF_802154_TX_POWER_SPLIT_CACHE_ENABLED
+
 /**
  * @brief Sets the antenna diversity rx mode.
  *
@@ -188,7 +202,9 @@ nrf_802154_sl_ant_div_mode_t nrf_802154_antenna_diversity_rx_mode_get(void);
  * @brief Sets the antenna diversity tx mode.
  *
  * @note This function should not be called while reception or transmission are currently ongoing.
- * @note NRF_802154_SL_ANT_DIV_MODE_AUTO is not supported for transmission.
+ * @note NRF_802154_SL_ANT_DIV_MODE_AUTO is supported for transmission only if
+ *       @ref NRF_802154_ANT_DIV_TX_LEARNING_ENABLED is set. In this mode, each frame is transmitted
+ *       through the antenna learned for its destination.
  *
  * @param[in] mode Antenna diversity tx mode to be set.
  *
@@ -456,6 +472,36 @@ bool nrf_802154_sleep(void);
  */
 nrf_802154_sleep_error_t nrf_802154_sleep_if_idle(void);
 
+#if NRF_802154_LIGHT_SLEEP_ENABLED || defined(DOXYGEN)
+
+/**
+ * @brief Selects if the sleep state is to be the light sleep.
+ *
+ * In light sleep, the radio releases the high-frequency clock and the timeslot as in the regular
+ * sleep state, but the RADIO peripheral is left configured. If no other driver reconfigured
+ * the RADIO in the meantime, the next transition to the receive state skips the reset and the
+ * reconfiguration of the RADIO, so the receiver is ramped up as soon as the timeslot is granted.
+ * Otherwise the RADIO is fully reconfigured, as after the regular sleep.
+ *
+ * The selection applies to the following transitions to the sleep state.
+ *
+ * @param[in]  enabled  If the sleep state is to be the light sleep.
+ */
+void nrf_802154_light_sleep_set(bool enabled);
+
+/**
+ * @brief Gets the latency of the last wake-up from the sleep state.
+ *
+ * The latency is measured from the receive request made in the sleep state, that is the call to
+ * @ref nrf_802154_receive or the start of a window scheduled by @ref nrf_802154_receive_at, to
+ * the moment the receiver ramp-up is triggered. It includes waiting for the timeslot.
+ *
+ * @returns  Latency of the last wake-up in microseconds, or 0 if the radio has not been woken up.
+ */
+uint32_t nrf_802154_wake_latency_get(void);
+
+#endif // NRF_802154_LIGHT_SLEEP_ENABLED || defined(DOXYGEN)
+
 /**
  * @brief Changes the radio state to @ref RADIO_STATE_RX.
  *
@@ -502,6 +548,77 @@ bool nrf_802154_receive_at(uint64_t rx_time,
                            uint8_t  channel,
                            uint32_t id);
 
+/**
+ * @brief Requests periodic reception windows starting at the specified time.
+ *
+ * This function works as a periodic version of @ref nrf_802154_receive_at. The driver schedules
+ * the consecutive windows internally, so there is no need to request each window separately.
+ * Frames received in any of the windows are reported as usual. Windows that end without
+ * a frame are not reported. @ref nrf_802154_receive_failed is called only once, when the last
+ * window ends, with the error that ended that window.
+ *
+ * A scheduled series of windows can be cancelled by a call to @ref nrf_802154_receive_at_cancel.
+ *
+ * @note The identifier @p id follows the same rules as in @ref nrf_802154_receive_at.
+ *
+ * @param[in]   rx_time  Absolute time of the first window used by the SL Timer, in microseconds (us).
+ * @param[in]   period   Time between the beginnings of consecutive windows, in microseconds (us).
+ * @param[in]   timeout  Length of each window, in microseconds (us).
+ * @param[in]   channel  Radio channel on which the frames are to be received.
+ * @param[in]   count    Number of windows. If 0, the windows are repeated until cancelled.
+ * @param[in]   id       Identifier of the scheduled reception windows.
+ *
+ * @retval  true   The reception procedure was scheduled.
+ * @retval  false  The driver could not schedule the reception procedure or the windows do not fit
+ *                 in @p period.
+ */
+bool nrf_802154_receive_at_periodic(uint64_t rx_time,
+                                    uint32_t period,
+                                    uint32_t timeout,
+                                    uint8_t  channel,
+                                    uint32_t count,
+                                    uint32_t id);
+
+/**
+ * @brief Requests duty-cycled reception windows starting at the specified time.
+ *
+ * This function works as @ref nrf_802154_receive_at_periodic, with the following differences
+ * that let the device listen periodically at a low average current:
+ * - The driver enters the sleep state after each window that ends without a frame being received
+ *   at the moment, so there is no need to call @ref nrf_802154_sleep between the windows.
+ * - The timeslot of each window, and therefore the high frequency clock, is requested only
+ *   @ref NRF_802154_DELAYED_TRX_RX_DUTY_CYCLE_PRESTART_US before the window.
+ * - A window in which a frame is received is kept open for @p extension after the end of that
+ *   frame, so that the frames that follow it, for example a response, are received as well. Each
+ *   next frame received in the extension extends the window again.
+ *
+ * A scheduled series of windows can be cancelled by a call to @ref nrf_802154_receive_at_cancel.
+ * If the series is cancelled during a window, the radio remains in the receive state.
+ *
+ * @note The identifier @p id follows the same rules as in @ref nrf_802154_receive_at.
+ *
+ * @param[in]   rx_time    Absolute time of the first window used by the SL Timer, in microseconds (us).
+ * @param[in]   period     Time between the beginnings of consecutive windows, in microseconds (us).
+ * @param[in]   window     Length of each window, in microseconds (us).
+ * @param[in]   extension  Time for which a window is kept open after the end of a frame received
+ *                         in it, in microseconds (us). If 0, windows are extended only until
+ *                         the end of the frame being received.
+ * @param[in]   channel    Radio channel on which the frames are to be received.
+ * @param[in]   count      Number of windows. If 0, the windows are repeated until cancelled.
+ * @param[in]   id         Identifier of the scheduled reception windows.
+ *
+ * @retval  true   The reception procedure was scheduled.
+ * @retval  false  The driver could not schedule the reception procedure or the windows together
+ *                 with the prestart time do not fit in @p period.
+ */
+bool nrf_802154_receive_at_duty_cycled(uint64_t rx_time,
+                                       uint32_t period,
+                                       uint32_t window,
+                                       uint32_t extension,
+                                       uint8_t  channel,
+                                       uint32_t count,
+                                       uint32_t id);
+
 /**
  * @brief Cancels a delayed reception scheduled by a call to @ref nrf_802154_receive_at.
  *
@@ -622,6 +739,63 @@ bool nrf_802154_transmit(const uint8_t                        * p_data,
 
 #endif // !NRF_802154_USE_RAW_API
 
+#if NRF_802154_TX_PREPARE_ENABLED || defined(DOXYGEN)
+
+/**
+ * @brief Prepares a frame to be transmitted by a later call to @ref nrf_802154_transmit_commit.
+ *
+ * @note This function is implemented in a zero-copy fashion. The buffer must not be modified
+ *       until the prepared frame is transmitted or replaced.
+ * @note This function is available if @ref NRF_802154_TX_PREPARE_ENABLED is enabled.
+ *
+ * This function performs all the processing that @ref nrf_802154_transmit_raw does before
+ * the radio is started: the header IEs are filled, the security frame counter is injected,
+ * the encryption of the frame is set up and the transmit power is resolved for the current
+ * channel. The radio state is not changed.
+ *
+ * Only one frame can be prepared at a time. Preparing another frame replaces the previous one.
+ * The preparation is invalidated when the channel, the transmit power, the security keys or
+ * the frame counter change, and when the driver uses its transmit path for another frame, for
+ * example to transmit an ACK or a frame requested with @ref nrf_802154_transmit_raw. An
+ * invalidated frame is still transmitted by @ref nrf_802154_transmit_commit, but it goes
+ * through the full processing again.
+ *
+ * @param[in]  p_data      Pointer to the array with data to transmit. The first byte must contain
+ *                         the frame length (including FCS). The following bytes contain data.
+ *                         The CRC is computed automatically by the radio hardware. Therefore,
+ *                         the FCS field can contain any bytes.
+ * @param[in]  p_metadata  Pointer to metadata structure. Contains detailed properties of data
+ *                         to transmit. If @c NULL following metadata are used:
+ *                         Field           | Value
+ *                         ----------------|-----------------------------------------------------
+ *                         @c frame_props  | @ref NRF_802154_TRANSMITTED_FRAME_PROPS_DEFAULT_INIT
+ *                         @c cca          | @c true
+ *
+ * @retval  true   The frame was prepared.
+ * @retval  false  The frame could not be prepared, either because its processing failed or
+ *                 because the driver is transmitting or receiving an ACK at the moment.
+ */
+bool nrf_802154_transmit_prepare(uint8_t                              * p_data,
+                                 const nrf_802154_transmit_metadata_t * p_metadata);
+
+/**
+ * @brief Starts the transmission of the frame prepared by @ref nrf_802154_transmit_prepare.
+ *
+ * @note This function is available if @ref NRF_802154_TX_PREPARE_ENABLED is enabled.
+ *
+ * This function behaves like @ref nrf_802154_transmit_raw called for the prepared frame, except
+ * that the frame processing has already been done. The prepared frame is consumed by this call,
+ * whatever its result. The transmission result is reported to the higher layer by calls to
+ * @ref nrf_802154_transmitted_raw or @ref nrf_802154_transmit_failed.
+ *
+ * @retval  true   The transmission procedure was scheduled.
+ * @retval  false  No frame was prepared or the driver could not schedule the transmission
+ *                 procedure.
+ */
+bool nrf_802154_transmit_commit(void);
+
+#endif // NRF_802154_TX_PREPARE_ENABLED
+
 /**
  * @brief Requests transmission at the specified time.
  *
@@ -643,6 +817,9 @@ bool nrf_802154_transmit(const uint8_t                        * p_data,
  * If the requested transmission time is in the past, the function returns @c false and does not
  * schedule transmission.
  *
+ * Up to @ref NRF_802154_DELAYED_TRX_TX_QUEUE_SIZE transmissions can be scheduled at the same time.
+ * They are performed in order of their transmission times.
+ *
  * A successfully scheduled transmission can be cancelled by a call
  * to @ref nrf_802154_transmit_at_cancel.
  *
@@ -667,12 +844,50 @@ bool nrf_802154_transmit_raw_at(uint8_t                                 * p_data
                                 uint64_t                                  tx_time,
                                 const nrf_802154_transmit_at_metadata_t * p_metadata);
 
+/**
+ * @brief Requests transmission of a burst of frames starting at the specified time.
+ *
+ * @note This function is implemented in a zero-copy fashion. It passes the given buffer pointers to
+ *       the RADIO peripheral.
+ *
+ * This function schedules the frames in @p pp_data as delayed transmissions, one after another.
+ * The first frame is transmitted at @p tx_time. Each following frame is transmitted as soon as
+ * the interframe space after the previous frame, and its ACK if requested, has passed. Start of
+ * each transmission is triggered by hardware at its scheduled time, so there is no software
+ * interframe space handling between the frames.
+ *
+ * Each frame is reported separately, as described for @ref nrf_802154_transmit_raw_at. A frame
+ * that cannot be transmitted in its timeslot does not stop the remaining frames of the burst.
+ *
+ * If the burst cannot be scheduled as a whole, the function returns @c false and cancels all
+ * scheduled delayed transmissions, as @ref nrf_802154_transmit_at_cancel does.
+ *
+ * A successfully scheduled burst can be cancelled by a call to @ref nrf_802154_transmit_at_cancel.
+ *
+ * @param[in]  pp_data     Array of pointers to the frames to transmit. Each frame follows the format
+ *                         described for @ref nrf_802154_transmit_raw_at.
+ * @param[in]  count       Number of frames in @p pp_data. It must not exceed
+ *                         @ref NRF_802154_DELAYED_TRX_TX_QUEUE_SIZE.
+ * @param[in]  tx_time     Absolute time of the first frame used by the SL Timer,
+ *                         in microseconds (us).
+ * @param[in]  p_metadata  Pointer to metadata structure used for all frames of the burst.
+ *                         If @c NULL, the defaults of @ref nrf_802154_transmit_raw_at are used.
+ *
+ * @retval  true   The transmission procedures were scheduled.
+ * @retval  false  The driver could not schedule the transmission procedures.
+ */
+bool nrf_802154_transmit_raw_burst_at(uint8_t * const                         * pp_data,
+                                      uint8_t                                   count,
+                                      uint64_t                                  tx_time,
+                                      const nrf_802154_transmit_at_metadata_t * p_metadata);
+
 /**
  * @brief Cancels a delayed transmission scheduled by a call to @ref nrf_802154_transmit_raw_at.
  *
  * If a delayed transmission has been scheduled but the transmission has not been started yet,
  * a call to this function prevents the transmission. If the transmission is ongoing,
- * it will not be aborted.
+ * it will not be aborted. If more than one delayed transmission has been scheduled, all of them
+ * are cancelled.
  *
  * If a delayed transmission has not been scheduled (or has already finished), this function does
  * not change state and returns false.
@@ -682,6 +897,21 @@ bool nrf_802154_transmit_raw_at(uint8_t                                 * p_data
  */
 bool nrf_802154_transmit_at_cancel(void);
 
+/**
+ * @brief Gets the setup time of a transmission scheduled by @ref nrf_802154_transmit_raw_at.
+ *
+ * The driver starts preparing a delayed transmission the returned time before its transmission
+ * time. The frame is loaded to the RADIO peripheral in advance and the transmitter is ramped up
+ * through (D)PPI exactly at the time needed to start the transmission at @c tx_time, without
+ * any CPU involvement at that moment. The setup time is constant for a given SoC family, so
+ * a transmission requested with shorter notice cannot start on time.
+ *
+ * @param[in]  cca  If the frame is to be transmitted with CCA.
+ *
+ * @return Setup time of a delayed transmission, in microseconds (us).
+ */
+uint32_t nrf_802154_transmit_at_setup_time_get(bool cca);
+
 /**
  * @brief Changes the radio state to energy detection.
  *
@@ -703,6 +933,28 @@ bool nrf_802154_transmit_at_cancel(void);
  */
 bool nrf_802154_energy_detection(uint32_t time_us);
 
+/**
+ * @brief Performs the energy detection procedure on multiple channels.
+ *
+ * The channels selected by @p channel_mask are scanned one by one in increasing order. The radio
+ * detects the maximum energy on each of them for @p dwell_time_us and then hops to the next one
+ * without the involvement of the higher layer. The results of all channels are reported at once
+ * by @ref nrf_802154_energy_scan_done. When the procedure ends, the radio returns to the channel
+ * configured by @ref nrf_802154_channel_set.
+ *
+ * @note @ref nrf_802154_energy_scan_done can be called before this function returns a result.
+ * @note If the procedure is aborted, @ref nrf_802154_energy_detection_failed is called instead.
+ *
+ * @param[in]  channel_mask   Mask of channels to be scanned. Bit @c n selects channel @c n.
+ *                            Only channels 11-26 can be selected.
+ * @param[in]  dwell_time_us  Duration of energy detection on each channel. The given value is
+ *                            rounded up to multiplication of 8 symbols (128 us).
+ *
+ * @retval  true   The energy scan procedure was scheduled.
+ * @retval  false  The driver could not schedule the energy scan procedure.
+ */
+bool nrf_802154_energy_scan(uint32_t channel_mask, uint32_t dwell_time_us);
+
 /**
  * @brief Changes the radio state to @ref RADIO_STATE_CCA.
  *
@@ -998,6 +1250,21 @@ extern void nrf_802154_energy_detected(uint8_t result);
  */
 extern void nrf_802154_energy_detection_failed(nrf_802154_ed_error_t error);
 
+/**
+ * @brief Notifies that the energy scan procedure finished.
+ *
+ * @note The results are expressed as in @ref nrf_802154_energy_detected.
+ * @note The @p p_results buffer is valid only during the execution of this function.
+ *
+ * @param[in]  channel_mask   Mask of scanned channels.
+ * @param[in]  p_results      Maximum energy detected on the scanned channels, in increasing
+ *                            channel order.
+ * @param[in]  results_count  Number of elements in @p p_results.
+ */
+extern void nrf_802154_energy_scan_done(uint32_t        channel_mask,
+                                        const uint8_t * p_results,
+                                        uint8_t         results_count);
+
 /**
  * @brief Notifies that the CCA procedure has finished.
  *
@@ -1142,6 +1409,64 @@ void nrf_802154_promiscuous_set(bool enabled);
  */
 bool nrf_802154_promiscuous_get(void);
 
+#if NRF_802154_CAPTURE_ENABLED || defined(DOXYGEN)
+
+/**
+ * @brief Starts the frame capture mode and changes the radio state to @ref RADIO_STATE_RX.
+ *
+ * In the frame capture mode, the driver writes every received frame, including frames with
+ * an incorrect FCS, to the ring buffer provided by the higher layer. Each frame is preceded by
+ * a header containing its metadata, see @ref NRF_802154_CAPTURE_RECORD_HEADER_SIZE. The frames are
+ * neither filtered nor acknowledged, and @ref nrf_802154_received_raw is not called for them.
+ * If there is not enough free space in the ring buffer, the frame is dropped.
+ *
+ * The higher layer drains the ring buffer in bulk using @ref nrf_802154_capture_status_get and
+ * @ref nrf_802154_capture_consume.
+ *
+ * @note This function is available if @ref NRF_802154_CAPTURE_ENABLED is enabled.
+ *
+ * @param[in]  p_ring     Pointer to the ring buffer. It must remain valid until
+ *                        @ref nrf_802154_capture_stop is called.
+ * @param[in]  ring_size  Size of the ring buffer. It must be a power of two not smaller than
+ *                        @ref NRF_802154_CAPTURE_RECORD_HEADER_SIZE + @ref MAX_PACKET_SIZE.
+ *
+ * @retval  true   The frame capture mode was started.
+ * @retval  false  The ring buffer is invalid or the driver could not enter the receive state.
+ */
+bool nrf_802154_capture_start(uint8_t * p_ring, uint32_t ring_size);
+
+/**
+ * @brief Stops the frame capture mode.
+ *
+ * The radio remains in the receive state and the received frames are handled normally.
+ *
+ * @note This function is available if @ref NRF_802154_CAPTURE_ENABLED is enabled.
+ */
+void nrf_802154_capture_stop(void);
+
+/**
+ * @brief Gets the state of the capture ring buffer.
+ *
+ * The bytes between @c read_pos and @c write_pos contain complete records ready to be consumed.
+ *
+ * @note This function is available if @ref NRF_802154_CAPTURE_ENABLED is enabled.
+ *
+ * @param[out]  p_status  Structure that will be filled with the state of the ring buffer.
+ */
+void nrf_802154_capture_status_get(nrf_802154_capture_status_t * p_status);
+
+/**
+ * @brief Releases bytes of the capture ring buffer consumed by the higher layer.
+ *
+ * @note This function is available if @ref NRF_802154_CAPTURE_ENABLED is enabled.
+ *
+ * @param[in]  length  Number of bytes consumed from the read position. It must not exceed
+ *                     the number of bytes between the read and the write positions.
+ */
+void nrf_802154_capture_consume(uint32_t length);
+
+#endif // NRF_802154_CAPTURE_ENABLED
+
 /**
  * @}
  * @defgroup nrf_802154_autoack Auto ACK management
@@ -1191,6 +1516,80 @@ void nrf_802154_pan_coord_set(bool enabled);
  */
 bool nrf_802154_pan_coord_get(void);
 
+#if NRF_802154_RX_PREFILTER_ENABLED || defined(__DOXYGEN__)
+
+/**
+ * @brief Sets the filter of received frames run before the next higher layer is notified.
+ *
+ * The filter is called in the RADIO interrupt context for each received frame that passed
+ * the address filtering, right before the driver would pass the frame to the next higher layer.
+ * For a frame that requested an ACK, the filter is called after the ACK is transmitted.
+ * If the filter rejects the frame, the driver drops it and reuses its buffer for the following
+ * reception. The next higher layer is not notified and does not need to free the buffer.
+ * That keeps receive buffers available when many unwanted frames are received, for example,
+ * beacons or retransmitted frames with duplicated sequence numbers.
+ *
+ * @note The filter delays enabling the receiver for the following frame. It must return quickly.
+ *
+ * @param[in]  prefilter  Pointer to the filter or NULL to pass all received frames.
+ */
+void nrf_802154_rx_prefilter_set(nrf_802154_rx_prefilter_t prefilter);
+
+#endif // NRF_802154_RX_PREFILTER_ENABLED || defined(__DOXYGEN__)
+
+#if (NRF_802154_IDENTITIES_NUM > 0) || defined(__DOXYGEN__)
+
+/**
+ * @brief Sets an additional receive identity of the device.
+ *
+ * Frames destined to the PAN ID and the short or the extended address of the identity pass
+ * the address filtering in addition to the frames destined to the addresses set with
+ * @ref nrf_802154_pan_id_set, @ref nrf_802154_short_address_set and
+ * @ref nrf_802154_extended_address_set. ACKs to the frames matched by the identity are sent
+ * according to its @c auto_ack field and have the pending bit set according to its
+ * @c src_addr_match field, using the addresses added with @ref nrf_802154_ack_data_set.
+ *
+ * This function makes a copy of the identity.
+ *
+ * @param[in]  index       Index of the identity, lower than @ref NRF_802154_IDENTITIES_NUM.
+ * @param[in]  p_identity  Pointer to the identity.
+ *
+ * @retval true   The identity has been set.
+ * @retval false  @p index or the source address matching method of @p p_identity is invalid.
+ */
+bool nrf_802154_identity_set(uint8_t index, const nrf_802154_identity_t * p_identity);
+
+/**
+ * @brief Removes an additional receive identity of the device.
+ *
+ * @param[in]  index  Index of the identity, lower than @ref NRF_802154_IDENTITIES_NUM.
+ *
+ * @retval true   The identity has been removed.
+ * @retval false  @p index is invalid.
+ */
+bool nrf_802154_identity_clear(uint8_t index);
+
+#endif // (NRF_802154_IDENTITIES_NUM > 0) || defined(__DOXYGEN__)
+
+#if (NRF_802154_LINK_QUALITY_PEERS_COUNT > 0) || defined(__DOXYGEN__)
+
+/**
+ * @brief Reads the link quality aggregated by the driver for recent peers.
+ *
+ * The driver updates the link quality of the source of each frame that passed the address
+ * filtering or was received in the promiscuous mode, if the frame has a source address other than
+ * the broadcast address.
+ *
+ * @param[out]  p_entries  Pointer to the array to be filled with the link quality of the peers.
+ * @param[in]   count      Number of entries in @p p_entries.
+ *
+ * @return Number of entries written, not greater than @p count and
+ *         @ref NRF_802154_LINK_QUALITY_PEERS_COUNT.
+ */
+uint8_t nrf_802154_link_quality_read(nrf_802154_link_quality_t * p_entries, uint8_t count);
+
+#endif // (NRF_802154_LINK_QUALITY_PEERS_COUNT > 0) || defined(__DOXYGEN__)
+
 /**
  * @brief Select the source matching algorithm.
  *
@@ -1287,6 +1686,56 @@ bool nrf_802154_ack_data_clear(const uint8_t       * p_addr,
                                bool                  extended,
                                nrf_802154_ack_data_t data_type);
 
+/**
+ * @brief Sets the ACK data for multiple addresses at once.
+ *
+ * This function is equivalent to calling @ref nrf_802154_ack_data_set for every address
+ * in @p p_addrs, but the addresses are merged into the list in chunks, each applied within
+ * a single critical section. If the same address appears more than once in @p p_addrs,
+ * its last occurrence is applied.
+ *
+ * @param[in]  p_addrs    Array of @p num_addrs addresses of nodes stored one after another
+ *                        (each little-endian).
+ * @param[in]  extended   If the given addresses are extended MAC addresses or short MAC addresses.
+ * @param[in]  num_addrs  Number of addresses in @p p_addrs.
+ * @param[in]  p_data     Pointer to the buffer containing the data to be set for the subsequent
+ *                        addresses, concatenated in the order of @p p_addrs. Ignored for
+ *                        @ref NRF_802154_ACK_DATA_PENDING_BIT.
+ * @param[in]  p_lengths  Array of @p num_addrs lengths of the data to be set for the subsequent
+ *                        addresses. Ignored for @ref NRF_802154_ACK_DATA_PENDING_BIT.
+ * @param[in]  data_type  Type of data to be set. Refer to the @ref nrf_802154_ack_data_t type.
+ *
+ * @retval True   All addresses successfully added to the list.
+ * @retval False  Not enough memory to store some of the addresses in the list.
+ */
+bool nrf_802154_ack_data_set_batch(const uint8_t       * p_addrs,
+                                   bool                  extended,
+                                   uint8_t               num_addrs,
+                                   const void          * p_data,
+                                   const uint8_t       * p_lengths,
+                                   nrf_802154_ack_data_t data_type);
+
+/**
+ * @brief Removes multiple addresses for which the ACK data is set from the list at once.
+ *
+ * This function is equivalent to calling @ref nrf_802154_ack_data_clear for every address
+ * in @p p_addrs, but the list is compacted in chunks, each applied within a single
+ * critical section.
+ *
+ * @param[in]  p_addrs    Array of @p num_addrs addresses of nodes stored one after another
+ *                        (each little-endian).
+ * @param[in]  extended   If the given addresses are extended MAC addresses or short MAC addresses.
+ * @param[in]  num_addrs  Number of addresses in @p p_addrs.
+ * @param[in]  data_type  Type of data to be removed. Refer to the @ref nrf_802154_ack_data_t type.
+ *
+ * @retval True   All addresses removed from the list.
+ * @retval False  Some of the addresses not found in the list.
+ */
+bool nrf_802154_ack_data_clear_batch(const uint8_t       * p_addrs,
+                                     bool                  extended,
+                                     uint8_t               num_addrs,
+                                     nrf_802154_ack_data_t data_type);
+
 /**
  * @brief Enables or disables setting a pending bit in automatically transmitted ACK frames.
  *
@@ -1409,6 +1858,11 @@ void nrf_802154_cca_cfg_get(nrf_802154_cca_cfg_t * p_cca_cfg);
  *       to time out waiting for the ACK frame. This timer can be started
  *       by @ref nrf_802154_tx_started. When the timer expires, the MAC layer is expected
  *       to call @ref nrf_802154_receive or @ref nrf_802154_sleep to stop waiting for the ACK frame.
+ * @note If @c max_frame_retries in @p p_metadata is not 0, the driver retransmits the frame when
+ *       it detects that no matching ACK frame was received, each time after a new CSMA-CA
+ *       procedure. The frame is retransmitted with the frame counter it was secured with.
+ *       Only the final outcome is notified, with the number of retransmissions in
+ *       the @c retries field of its metadata.
  * @note This function is available if @ref NRF_802154_CSMA_CA_ENABLED is enabled and
  *       @ref NRF_802154_USE_RAW_API is enabled.
  *
@@ -1524,6 +1978,218 @@ uint8_t nrf_802154_csma_ca_max_backoffs_get(void);
 
 #endif // NRF_802154_CSMA_CA_ENABLED
 
+/**
+ * @}
+ * @defgroup nrf_802154_indirect Indirect transmission
+ * @{
+ */
+#if (NRF_802154_INDIRECT_TX_ENABLED && NRF_802154_USE_RAW_API) || defined(DOXYGEN)
+
+/**
+ * @brief Queues a frame to be transmitted when a MAC Data Request is received from a device.
+ *
+ * When a MAC Data Request command is received from the device with the given address,
+ * the driver sets the pending bit in the ACK frame and starts the CSMA-CA procedure of
+ * the oldest frame queued for that device right after the ACK is transmitted. The end of
+ * the transmission is notified by @ref nrf_802154_transmitted_raw or
+ * @ref nrf_802154_transmit_failed, as for @ref nrf_802154_transmit_csma_ca_raw.
+ *
+ * @note The buffer pointed by @p p_data must remain valid until the end of the transmission is
+ *       notified or the frame is removed with @ref nrf_802154_indirect_frame_remove.
+ * @note The frame is not transmitted if another CSMA-CA procedure is ongoing when the MAC Data
+ *       Request is received. It stays queued until the next MAC Data Request from the device.
+ * @note This function is available if @ref NRF_802154_INDIRECT_TX_ENABLED is enabled and
+ *       @ref NRF_802154_USE_RAW_API is enabled.
+ *
+ * @param[in]  p_addr      Array of bytes containing the address of the device (little-endian).
+ * @param[in]  extended    If the given address is an extended MAC address or a short MAC address.
+ * @param[in]  p_data      Pointer to the frame to transmit. See also @ref nrf_802154_transmit_raw.
+ * @param[in]  p_metadata  Pointer to metadata structure. Contains detailed properties of data
+ *                         to transmit. If @c NULL, the same metadata as in
+ *                         @ref nrf_802154_transmit_csma_ca_raw are used.
+ *
+ * @retval  true   The frame is queued.
+ * @retval  false  The frame properties are invalid or the indirect queue is full.
+ */
+bool nrf_802154_indirect_frame_queue(const uint8_t                                * p_addr,
+                                     bool                                           extended,
+                                     uint8_t                                      * p_data,
+                                     const nrf_802154_transmit_csma_ca_metadata_t * p_metadata);
+
+/**
+ * @brief Removes a frame from the indirect queue.
+ *
+ * @note This function is available if @ref NRF_802154_INDIRECT_TX_ENABLED is enabled and
+ *       @ref NRF_802154_USE_RAW_API is enabled.
+ *
+ * @param[in]  p_data  Pointer to the frame passed to @ref nrf_802154_indirect_frame_queue.
+ *
+ * @retval  true   The frame is removed. The buffer can be reused.
+ * @retval  false  The frame is not queued. Its transmission may have already been started.
+ */
+bool nrf_802154_indirect_frame_remove(const uint8_t * p_data);
+
+#endif // NRF_802154_INDIRECT_TX_ENABLED && NRF_802154_USE_RAW_API
+
+/**
+ * @}
+ * @defgroup nrf_802154_tsch TSCH slotframe engine
+ * @{
+ */
+#if (NRF_802154_TSCH_ENABLED && NRF_802154_USE_RAW_API) || defined(DOXYGEN)
+
+/**
+ * @brief Sets the timing of the TSCH timeslots.
+ *
+ * The default timing is the one of the IEEE Std. 802.15.4 default timeslot template:
+ * 10000 us timeslots, 2120 us TX offset, 1020 us RX offset and 2200 us RX wait.
+ *
+ * @note This function is available if @ref NRF_802154_TSCH_ENABLED is enabled and
+ *       @ref NRF_802154_USE_RAW_API is enabled.
+ *
+ * @param[in]  p_timing  Pointer to the timeslot timing.
+ *
+ * @retval  true   The timing is set.
+ * @retval  false  The slotframes are being executed or the timing does not fit in a timeslot.
+ */
+bool nrf_802154_tsch_timing_set(const nrf_802154_tsch_timing_t * p_timing);
+
+/**
+ * @brief Sets the TSCH channel hopping sequence.
+ *
+ * The channel of a cell is selected from the sequence by the sum of the absolute slot number
+ * and the channel offset of the cell, modulo the length of the sequence.
+ *
+ * @note This function is available if @ref NRF_802154_TSCH_ENABLED is enabled and
+ *       @ref NRF_802154_USE_RAW_API is enabled.
+ *
+ * @param[in]  p_channels  Array of channels of the hopping sequence.
+ * @param[in]  length      Number of channels in @p p_channels, up to 16.
+ *
+ * @retval  true   The hopping sequence is set.
+ * @retval  false  The slotframes are being executed or the sequence is invalid.
+ */
+bool nrf_802154_tsch_hopping_sequence_set(const uint8_t * p_channels, uint8_t length);
+
+/**
+ * @brief Sets the cells of a TSCH slotframe.
+ *
+ * If several slotframes have a cell in the same timeslot, the cell of the slotframe with the
+ * lowest handle that has a frame to transmit or the RX option is executed. In a cell with both
+ * options, the receiver is turned on if there is no frame to transmit.
+ *
+ * @note This function is available if @ref NRF_802154_TSCH_ENABLED is enabled and
+ *       @ref NRF_802154_USE_RAW_API is enabled.
+ *
+ * @param[in]  handle       Handle of the slotframe, lower than @ref NRF_802154_TSCH_SLOTFRAMES_NUM.
+ * @param[in]  length       Number of timeslots of the slotframe. If 0, the slotframe is removed.
+ * @param[in]  p_cells      Array of cells of the slotframe. The cells are copied by the driver.
+ * @param[in]  cells_count  Number of cells in @p p_cells.
+ *
+ * @retval  true   The slotframe is set.
+ * @retval  false  The slotframes are being executed, the cells are invalid or
+ *                 @ref NRF_802154_TSCH_CELLS_NUM would be exceeded.
+ */
+bool nrf_802154_tsch_slotframe_set(uint8_t                        handle,
+                                   uint16_t                       length,
+                                   const nrf_802154_tsch_cell_t * p_cells,
+                                   uint16_t                       cells_count);
+
+/**
+ * @brief Starts the execution of the TSCH slotframes.
+ *
+ * From now on, the driver executes the cells autonomously with delayed transmissions and
+ * receptions. Receptions in RX cells that end without a frame are not notified. Received
+ * frames and the outcomes of the transmissions of queued frames are notified as usual.
+ *
+ * @note This function is available if @ref NRF_802154_TSCH_ENABLED is enabled and
+ *       @ref NRF_802154_USE_RAW_API is enabled.
+ *
+ * @param[in]  asn       Absolute slot number of the timeslot that begins at @p asn_time.
+ * @param[in]  asn_time  Beginning of the timeslot @p asn, as returned by
+ *                       @ref nrf_802154_time_get, in microseconds (us).
+ *
+ * @retval  true   The execution is started.
+ * @retval  false  The execution is already started or the hopping sequence is not set.
+ */
+bool nrf_802154_tsch_start(uint64_t asn, uint64_t asn_time);
+
+/**
+ * @brief Stops the execution of the TSCH slotframes.
+ *
+ * @note This function is available if @ref NRF_802154_TSCH_ENABLED is enabled and
+ *       @ref NRF_802154_USE_RAW_API is enabled.
+ */
+void nrf_802154_tsch_stop(void);
+
+/**
+ * @brief Corrects the beginning of the TSCH timeslots to follow the time source neighbor.
+ *
+ * @note This function is available if @ref NRF_802154_TSCH_ENABLED is enabled and
+ *       @ref NRF_802154_USE_RAW_API is enabled.
+ *
+ * @param[in]  correction  Time by which the timeslots are to begin later, in microseconds (us).
+ *                         Negative values make the timeslots begin earlier.
+ */
+void nrf_802154_tsch_time_correct(int32_t correction);
+
+/**
+ * @brief Gets the absolute slot number of the current TSCH timeslot.
+ *
+ * @note This function is available if @ref NRF_802154_TSCH_ENABLED is enabled and
+ *       @ref NRF_802154_USE_RAW_API is enabled.
+ *
+ * @param[out]  p_asn  Absolute slot number of the current timeslot.
+ *
+ * @retval  true   The slotframes are being executed and @p p_asn is set.
+ * @retval  false  The slotframes are not being executed.
+ */
+bool nrf_802154_tsch_asn_get(uint64_t * p_asn);
+
+/**
+ * @brief Queues a frame to be transmitted in the TSCH TX cells of a neighbor.
+ *
+ * The frame is transmitted in the nearest TX cell of the neighbor or of
+ * @ref NRF_802154_TSCH_NEIGHBOR_ANY. If no matching ACK is received, the frame is retransmitted
+ * in the next such cells up to @c max_frame_retries times. In shared cells, the transmission is
+ * preceded by CCA and the retransmissions are delayed by the TSCH CSMA-CA backoff. Only the
+ * final outcome is notified by @ref nrf_802154_transmitted_raw or
+ * @ref nrf_802154_transmit_failed.
+ *
+ * @note The buffer pointed by @p p_data must remain valid until the end of the transmission is
+ *       notified or the frame is removed with @ref nrf_802154_tsch_frame_remove.
+ * @note This function is available if @ref NRF_802154_TSCH_ENABLED is enabled and
+ *       @ref NRF_802154_USE_RAW_API is enabled.
+ *
+ * @param[in]  neighbor    Index of the neighbor queue, lower than
+ *                         @ref NRF_802154_TSCH_NEIGHBORS_NUM.
+ * @param[in]  p_data      Pointer to the frame to transmit. See also @ref nrf_802154_transmit_raw.
+ * @param[in]  p_metadata  Pointer to metadata structure. Contains detailed properties of data
+ *                         to transmit. If @c NULL, the same metadata as in
+ *                         @ref nrf_802154_transmit_csma_ca_raw are used.
+ *
+ * @retval  true   The frame is queued.
+ * @retval  false  The frame properties or the neighbor are invalid or the queue is full.
+ */
+bool nrf_802154_tsch_frame_queue(uint8_t                                        neighbor,
+                                 uint8_t                                      * p_data,
+                                 const nrf_802154_transmit_csma_ca_metadata_t * p_metadata);
+
+/**
+ * @brief Removes a frame from the TSCH queue.
+ *
+ * @note This function is available if @ref NRF_802154_TSCH_ENABLED is enabled and
+ *       @ref NRF_802154_USE_RAW_API is enabled.
+ *
+ * @param[in]  p_data  Pointer to the frame passed to @ref nrf_802154_tsch_frame_queue.
+ *
+ * @retval  true   The frame is removed. The buffer can be reused.
+ * @retval  false  The frame is not queued or is being transmitted.
+ */
+bool nrf_802154_tsch_frame_remove(const uint8_t * p_data);
+
+#endif // NRF_802154_TSCH_ENABLED && NRF_802154_USE_RAW_API
+
 /**
  * @}
  * @defgroup nrf_802154_timeout ACK timeout procedure
@@ -1671,6 +2337,40 @@ void nrf_802154_stat_timestamps_get(nrf_802154_stat_timestamps_t * p_stat_timest
  */
 void nrf_802154_stat_counters_reset(void);
 
+/**
+ * @brief Get low watermarks of driver resources.
+ *
+ * @note This returns part of information returned by @ref nrf_802154_stats_get
+ *
+ * @param[out] p_stat_watermarks Structure that will be filled with current low watermarks.
+ */
+void nrf_802154_stat_watermarks_get(nrf_802154_stat_watermarks_t * p_stat_watermarks);
+
+/**
+ * @brief Resets current low watermarks.
+ *
+ * After this call each watermark is equal to @c UINT32_MAX until the related resource is used.
+ */
+void nrf_802154_stat_watermarks_reset(void);
+
+/**
+ * @brief Get congestion statistics of channels.
+ *
+ * @note This returns part of information returned by @ref nrf_802154_stats_get
+ *
+ * The congestion rate of a channel follows the outcome of recent CCA attempts performed by
+ * the CSMA-CA procedure on that channel. If @ref NRF_802154_CCA_ED_CALIBRATION_ENABLED is 1,
+ * the CCA ED thresholds derived from the noise floor of the channels are provided as well.
+ *
+ * @param[out] p_stat_congestion Structure that will be filled with current congestion rates.
+ */
+void nrf_802154_stat_congestion_get(nrf_802154_stat_congestion_t * p_stat_congestion);
+
+/**
+ * @brief Resets congestion statistics of all channels to 0.
+ */
+void nrf_802154_stat_congestion_reset(void);
+
 /**
  * @brief Get total times spent in certain states.
  *
@@ -1679,6 +2379,47 @@ void nrf_802154_stat_counters_reset(void);
  */
 void nrf_802154_stat_totals_get(nrf_802154_stat_totals_t * p_stat_totals);
 
+#if NRF_802154_STAT_WINDOW_ENABLED || defined(DOXYGEN)
+
+/**
+ * @brief Gets statistics of the current statistics window and starts a new window.
+ *
+ * The statistics gathered since the previous call to this function, or since the initialization
+ * of the driver, are copied to @p p_window and the gathering continues in an empty window.
+ * Events that happen while this function is executed are accounted in one of the windows.
+ *
+ * @note This function is available if @ref NRF_802154_STAT_WINDOW_ENABLED is enabled.
+ * @note This function must not be called from a context of a higher priority than the priority
+ *       of the driver's interrupts.
+ *
+ * @param[out] p_window  Structure that will be filled with statistics of the ended window.
+ */
+void nrf_802154_stat_window_snapshot(nrf_802154_stat_window_t * p_window);
+
+#endif // NRF_802154_STAT_WINDOW_ENABLED
+
+#if NRF_802154_PROFILER_ENABLED || defined(DOXYGEN)
+
+/**
+ * @brief Get durations of a part of the driver measured by the profiler.
+ *
+ * @note This function is available if @ref NRF_802154_PROFILER_ENABLED is enabled.
+ *
+ * @param[in]  point      Part of the driver to get the durations of.
+ * @param[out] p_profile  Structure that will be filled with the measured durations.
+ */
+void nrf_802154_stat_profile_get(nrf_802154_profile_point_t  point,
+                                 nrf_802154_stat_profile_t * p_profile);
+
+/**
+ * @brief Resets durations measured by the profiler for all parts of the driver.
+ *
+ * @note This function is available if @ref NRF_802154_PROFILER_ENABLED is enabled.
+ */
+void nrf_802154_stat_profile_reset(void);
+
+#endif // NRF_802154_PROFILER_ENABLED
+
 /**
  * @}
  * @defgroup nrf_802154_ifs Inter-frame spacing feature
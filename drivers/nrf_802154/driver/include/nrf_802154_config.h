@@ -101,6 +101,21 @@ extern "C" {
 #define NRF_802154_CCA_CORR_LIMIT_DEFAULT 0x02
 #endif
 
+/**
+ * @def NRF_802154_RSSI_TEMP_CORR_TABLE_ENABLED
+ *
+ * If the temperature corrections of RSSI, LQI, ED and CCA ED threshold values are to be
+ * precomputed into a lookup table.
+ *
+ * When enabled, the corrections for all possible sample values are calculated during
+ * initialization and each time @ref nrf_802154_temperature_changed is called. Correcting a value
+ * is then a single table read. The table occupies 256 bytes of RAM.
+ *
+ */
+#ifndef NRF_802154_RSSI_TEMP_CORR_TABLE_ENABLED
+#define NRF_802154_RSSI_TEMP_CORR_TABLE_ENABLED 0
+#endif
+
 /**
  * @def NRF_802154_INTERNAL_RADIO_IRQ_HANDLING
  *
@@ -148,6 +163,51 @@ extern "C" {
 #define NRF_802154_SWI_PRIORITY 4
 #endif
 
+/**
+ * @def NRF_802154_CRITICAL_SECTION_BASEPRI_ENABLED
+ *
+ * If the critical section of the driver masks interrupts with the BASEPRI register instead of
+ * disabling the RADIO interrupt in the NVIC.
+ *
+ * Entering and exiting the critical section then requires a single register write. All interrupts
+ * with priority equal to or lower than @ref NRF_802154_CRITICAL_SECTION_BASEPRI_CEILING are
+ * masked, so the ceiling must not be higher than needed to cover the RADIO interrupt.
+ *
+ * @note This option is available only on Cortex-M3 and newer cores.
+ *
+ */
+#ifndef NRF_802154_CRITICAL_SECTION_BASEPRI_ENABLED
+#define NRF_802154_CRITICAL_SECTION_BASEPRI_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_CRITICAL_SECTION_BASEPRI_CEILING
+ *
+ * The highest interrupt priority masked by the critical section of the driver.
+ * See @ref NRF_802154_CRITICAL_SECTION_BASEPRI_ENABLED.
+ *
+ * @note The BASEPRI register cannot mask interrupts of priority 0, so the value must be
+ *       greater than 0.
+ *
+ */
+#ifndef NRF_802154_CRITICAL_SECTION_BASEPRI_CEILING
+#define NRF_802154_CRITICAL_SECTION_BASEPRI_CEILING NRF_802154_IRQ_PRIORITY
+#endif
+
+/**
+ * @def NRF_802154_NOTIFICATION_SWI_BUDGET
+ *
+ * Maximum number of notifications processed in one invocation of the SWI handler.
+ *
+ * If more notifications are pending when the budget is exhausted, the SWI is triggered again,
+ * so that requests and other interrupts of the same priority are handled in between.
+ * Set to 0 to process all pending notifications in one invocation.
+ *
+ */
+#ifndef NRF_802154_NOTIFICATION_SWI_BUDGET
+#define NRF_802154_NOTIFICATION_SWI_BUDGET 0
+#endif
+
 /**
  * @def NRF_802154_ECB_PRIORITY
  *
@@ -192,6 +252,64 @@ extern "C" {
 #define NRF_802154_PENDING_EXTENDED_ADDRESSES 10
 #endif
 
+/**
+ * @def NRF_802154_ACK_DATA_HASH_INDEX_ENABLED
+ *
+ * If the addresses for which ACK data (pending bit or IEs) is stored are to be indexed with
+ * an open-addressing hash table instead of being kept in sorted arrays.
+ *
+ * When this option is enabled, looking up an address during ACK preparation and adding or
+ * removing an address take constant time on average, at the cost of additional RAM for the hash
+ * slots. This is recommended for coordinators serving a large number of sleepy children,
+ * for which @ref NRF_802154_PENDING_SHORT_ADDRESSES and @ref NRF_802154_PENDING_EXTENDED_ADDRESSES
+ * are raised considerably.
+ *
+ */
+#ifndef NRF_802154_ACK_DATA_HASH_INDEX_ENABLED
+#define NRF_802154_ACK_DATA_HASH_INDEX_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_ACK_DATA_HASH_SLOTS_PER_ADDRESS
+ *
+ * The number of hash slots allocated per stored address when
+ * @ref NRF_802154_ACK_DATA_HASH_INDEX_ENABLED is set. Each slot takes 2 bytes of RAM.
+ *
+ * The value must be at least 2, which keeps the load factor of the hash table at or below 50%
+ * and bounds the expected probe length to a few slots.
+ *
+ */
+#ifndef NRF_802154_ACK_DATA_HASH_SLOTS_PER_ADDRESS
+#define NRF_802154_ACK_DATA_HASH_SLOTS_PER_ADDRESS 2
+#endif
+
+/**
+ * @def NRF_802154_ENH_ACK_TEMPLATES_ENABLED
+ *
+ * If the Enh-Ack generator is to keep ready-made ACK templates for recently acknowledged peers.
+ *
+ * When this option is enabled, the Enh-Ack is prepared once the auxiliary security header of
+ * the received frame is known. If the header matches a template, the template is copied and
+ * only the sequence number and the frame counter are patched, followed by the IE writer and
+ * the encryption preparation. Templates are invalidated when the IE data for ACKs or the keys
+ * change. Each template takes about 300 bytes of RAM.
+ *
+ */
+#ifndef NRF_802154_ENH_ACK_TEMPLATES_ENABLED
+#define NRF_802154_ENH_ACK_TEMPLATES_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_ENH_ACK_TEMPLATES_COUNT
+ *
+ * The number of Enh-Ack templates kept when @ref NRF_802154_ENH_ACK_TEMPLATES_ENABLED is set.
+ * Templates are replaced in round-robin order.
+ *
+ */
+#ifndef NRF_802154_ENH_ACK_TEMPLATES_COUNT
+#define NRF_802154_ENH_ACK_TEMPLATES_COUNT 4
+#endif
+
 /**
  * @def NRF_802154_RX_BUFFERS
  *
@@ -202,6 +320,44 @@ extern "C" {
 #define NRF_802154_RX_BUFFERS 16
 #endif
 
+/**
+ * @def NRF_802154_RX_BUFFER_SLAB_ENABLED
+ *
+ * Enables the pool of small buffers for received frames.
+ *
+ * When enabled, a received frame that fits in @ref NRF_802154_RX_SMALL_BUFFER_SIZE bytes is
+ * moved at the end of its reception from the full-size buffer it was received to into a small
+ * buffer, and the full-size buffer is available for the next reception at once. The full-size
+ * buffers, @ref NRF_802154_RX_BUFFERS of them, are then mostly used for receptions in progress
+ * and for long frames, so fewer of them are needed.
+ *
+ */
+#ifndef NRF_802154_RX_BUFFER_SLAB_ENABLED
+#define NRF_802154_RX_BUFFER_SLAB_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_RX_SMALL_BUFFERS
+ *
+ * The number of small buffers for received frames when @ref NRF_802154_RX_BUFFER_SLAB_ENABLED
+ * is set.
+ *
+ */
+#ifndef NRF_802154_RX_SMALL_BUFFERS
+#define NRF_802154_RX_SMALL_BUFFERS 16
+#endif
+
+/**
+ * @def NRF_802154_RX_SMALL_BUFFER_SIZE
+ *
+ * The size in bytes of a small buffer for received frames, including the PHR. The default value
+ * holds ACKs, MAC commands and short data frames of up to 31 bytes of PSDU.
+ *
+ */
+#ifndef NRF_802154_RX_SMALL_BUFFER_SIZE
+#define NRF_802154_RX_SMALL_BUFFER_SIZE 32
+#endif
+
 /**
  * @def NRF_802154_NOTIFY_CRCERROR
  *
@@ -241,6 +397,103 @@ extern "C" {
     (1 && NRF_802154_FRAME_TIMESTAMP_ENABLED)
 #endif
 
+/**
+ * @def NRF_802154_FRAME_TIMESTAMP_FRAMESTART_ENABLED
+ *
+ * If timestamps of received frames are to be captured on the RADIO FRAMESTART event.
+ *
+ * By default, the timer coordinator captures the CRCOK event of a received frame. When this
+ * option is enabled, it captures the FRAMESTART event instead, which is generated when the PHR
+ * is received, and the end of the frame is derived from it by adding the duration of the PSDU.
+ * The capture point is then fixed relative to the start of the frame, which is the reference
+ * used by time synchronization and CSL.
+ *
+ * This option can be enabled when @ref NRF_802154_FRAME_TIMESTAMP_ENABLED is 1 and
+ * @ref NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED is 0.
+ *
+ */
+#ifndef NRF_802154_FRAME_TIMESTAMP_FRAMESTART_ENABLED
+#define NRF_802154_FRAME_TIMESTAMP_FRAMESTART_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_STAT_WINDOW_ENABLED
+ *
+ * If windowed statistics are to be gathered.
+ *
+ * When enabled, the driver counts received and transmitted frames, ACK frames, failed CCA attempts
+ * and builds histograms of the RSSI of received frames and of the number of CSMA-CA backoffs in
+ * the current statistics window. The window is retrieved and restarted with
+ * @ref nrf_802154_stat_window_snapshot.
+ */
+#ifndef NRF_802154_STAT_WINDOW_ENABLED
+#define NRF_802154_STAT_WINDOW_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_NOISE_MONITOR_ENABLED
+ *
+ * If the noise floor of the channel is to be monitored in the background.
+ *
+ * When enabled, the driver periodically samples the RSSI of the channel while it is in the receive
+ * state and no frame is being received. The samples are accumulated in the noise histogram of
+ * the statistics window, so the receiver never has to be disabled for an energy detection.
+ *
+ * This option can be enabled when @ref NRF_802154_STAT_WINDOW_ENABLED is 1.
+ */
+#ifndef NRF_802154_NOISE_MONITOR_ENABLED
+#define NRF_802154_NOISE_MONITOR_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_NOISE_MONITOR_PERIOD_US
+ *
+ * Period in microseconds of the RSSI sampling of the noise monitor.
+ * See @ref NRF_802154_NOISE_MONITOR_ENABLED.
+ */
+#ifndef NRF_802154_NOISE_MONITOR_PERIOD_US
+#define NRF_802154_NOISE_MONITOR_PERIOD_US 10000
+#endif
+
+/**
+ * @def NRF_802154_CCA_ED_CALIBRATION_ENABLED
+ *
+ * If the CCA energy detection threshold is to be derived from the measured noise floor.
+ *
+ * When enabled, the noise monitor keeps a rolling estimate of the noise floor of each channel
+ * and the driver uses the estimate raised by @ref NRF_802154_CCA_ED_CALIBRATION_MARGIN_DB as
+ * the CCA ED threshold on that channel. The threshold set with @ref nrf_802154_cca_cfg_set is
+ * used on the channels that have not been sampled yet.
+ *
+ * This option can be enabled when @ref NRF_802154_NOISE_MONITOR_ENABLED is 1.
+ *
+ */
+#ifndef NRF_802154_CCA_ED_CALIBRATION_ENABLED
+#define NRF_802154_CCA_ED_CALIBRATION_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_CCA_ED_CALIBRATION_MARGIN_DB
+ *
+ * Margin in dB added to the noise floor estimate to get the CCA ED threshold.
+ * See @ref NRF_802154_CCA_ED_CALIBRATION_ENABLED.
+ *
+ */
+#ifndef NRF_802154_CCA_ED_CALIBRATION_MARGIN_DB
+#define NRF_802154_CCA_ED_CALIBRATION_MARGIN_DB 10
+#endif
+
+/**
+ * @def NRF_802154_CCA_ED_CALIBRATION_WEIGHT_SHIFT
+ *
+ * Weight of a single RSSI sample in the noise floor estimate, as a power of 2 divisor.
+ * See @ref NRF_802154_CCA_ED_CALIBRATION_ENABLED.
+ *
+ */
+#ifndef NRF_802154_CCA_ED_CALIBRATION_WEIGHT_SHIFT
+#define NRF_802154_CCA_ED_CALIBRATION_WEIGHT_SHIFT 4
+#endif
+
 /**
  * @def NRF_802154_DELAYED_TRX_ENABLED
  *
@@ -251,6 +504,337 @@ extern "C" {
 #define NRF_802154_DELAYED_TRX_ENABLED 1
 #endif
 
+/**
+ * @def NRF_802154_RX_PREFILTER_ENABLED
+ *
+ * If the RX pre-filter feature is available. See @ref nrf_802154_rx_prefilter_set.
+ *
+ */
+#ifndef NRF_802154_RX_PREFILTER_ENABLED
+#define NRF_802154_RX_PREFILTER_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_IDENTITIES_NUM
+ *
+ * Number of additional receive identities. See @ref nrf_802154_identity_set.
+ *
+ * An identity is a PAN ID with a short and an extended address that the frame filter accepts
+ * in addition to the addresses set in the PIB. Each identity has its own auto ACK and pending bit
+ * settings, so a single radio can serve several networks without the promiscuous mode.
+ * The value of 0 disables the feature. The maximum value is 8.
+ *
+ */
+#ifndef NRF_802154_IDENTITIES_NUM
+#define NRF_802154_IDENTITIES_NUM 0
+#endif
+
+/**
+ * @def NRF_802154_LINK_QUALITY_PEERS_COUNT
+ *
+ * Number of peers for which the driver aggregates the link quality of received frames.
+ * See @ref nrf_802154_link_quality_read.
+ *
+ * For each tracked peer the driver keeps a moving average of the RSSI and the LQI of the frames
+ * received from it and the number of these frames, so that the higher layer does not need to
+ * process every reception to maintain its neighbor table. When the table is full, the least
+ * recently added peer is replaced. The value of 0 disables the feature.
+ *
+ */
+#ifndef NRF_802154_LINK_QUALITY_PEERS_COUNT
+#define NRF_802154_LINK_QUALITY_PEERS_COUNT 0
+#endif
+
+/**
+ * @def NRF_802154_LINK_QUALITY_IE_AVERAGED_ENABLED
+ *
+ * If the Link Metrics IE of Enhanced ACKs reports the averaged link quality of the peer instead of
+ * the link quality of the acknowledged frame. Applicable only if
+ * @ref NRF_802154_LINK_QUALITY_PEERS_COUNT is greater than 0.
+ *
+ * @note Thread specifies the metrics of the acknowledged frame for Enhanced-ACK based probing.
+ *
+ */
+#ifndef NRF_802154_LINK_QUALITY_IE_AVERAGED_ENABLED
+#define NRF_802154_LINK_QUALITY_IE_AVERAGED_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_TX_POWER_CONTROL_PEERS_COUNT
+ *
+ * Number of peers for which the driver adapts the transmit power.
+ *
+ * For each tracked destination the driver keeps a reduction of the transmit power stored in PIB,
+ * adapted from the RSSI of the ACKs received from the destination towards the target link margin
+ * @ref NRF_802154_TX_POWER_CONTROL_TARGET_MARGIN_DB. Nearby peers are thus reached with lower
+ * power, which reduces the current consumption and the interference. The reduction is dropped
+ * when an ACK is not received. Frames with the power specified in their metadata are transmitted
+ * with that power. When the table is full, the least recently added peer is replaced. The value
+ * of 0 disables the feature.
+ *
+ * @note The RSSI of an ACK reflects the transmit power of the peer. The adaptation assumes that
+ *       the peers transmit with similar power.
+ *
+ */
+#ifndef NRF_802154_TX_POWER_CONTROL_PEERS_COUNT
+#define NRF_802154_TX_POWER_CONTROL_PEERS_COUNT 0
+#endif
+
+/**
+ * @def NRF_802154_TX_POWER_CONTROL_TARGET_MARGIN_DB
+ *
+ * Link margin in dB above the energy detection threshold that the transmit power control aims for.
+ * Applicable only if @ref NRF_802154_TX_POWER_CONTROL_PEERS_COUNT is greater than 0.
+ *
+ */
+#ifndef NRF_802154_TX_POWER_CONTROL_TARGET_MARGIN_DB
+#define NRF_802154_TX_POWER_CONTROL_TARGET_MARGIN_DB 20
+#endif
+
+/**
+ * @def NRF_802154_TX_POWER_CONTROL_HYSTERESIS_DB
+ *
+ * Excess of the link margin over @ref NRF_802154_TX_POWER_CONTROL_TARGET_MARGIN_DB in dB, above
+ * which the transmit power is lowered. The power is raised as soon as the margin drops below
+ * the target. Applicable only if @ref NRF_802154_TX_POWER_CONTROL_PEERS_COUNT is greater than 0.
+ *
+ */
+#ifndef NRF_802154_TX_POWER_CONTROL_HYSTERESIS_DB
+#define NRF_802154_TX_POWER_CONTROL_HYSTERESIS_DB 6
+#endif
+
+/**
+ * @def NRF_802154_TX_POWER_CONTROL_STEP_DB
+ *
+ * Step in dB by which the transmit power is lowered after each ACK received with an excess margin.
+ * Applicable only if @ref NRF_802154_TX_POWER_CONTROL_PEERS_COUNT is greater than 0.
+ *
+ */
+#ifndef NRF_802154_TX_POWER_CONTROL_STEP_DB
+#define NRF_802154_TX_POWER_CONTROL_STEP_DB 2
+#endif
+
+/**
+ * @def NRF_802154_TX_POWER_CONTROL_MIN_POWER_DBM
+ *
+ * Lower bound in dBm of the transmit power adapted to a peer. The upper bound is the power stored
+ * in PIB. Applicable only if @ref NRF_802154_TX_POWER_CONTROL_PEERS_COUNT is greater than 0.
+ *
+ */
+#ifndef NRF_802154_TX_POWER_CONTROL_MIN_POWER_DBM
+#define NRF_802154_TX_POWER_CONTROL_MIN_POWER_DBM (-20)
+#endif
+
+/**
+ * @def NRF_802154_RX_EARLY_ADDR_FILTER_ENABLED
+ *
+ * If the driver delays the first check of a received frame until the destination PAN ID and
+ * the short destination address are received.
+ *
+ * By default, the FCF field and the destination addressing fields are checked in separate
+ * RADIO interrupts. When this option is enabled, both checks are performed in a single interrupt
+ * for frames with short destination addressing, which halves the number of interrupts spent on
+ * frames addressed to other nodes. Frames shorter than 8 octets, including the PHY header,
+ * are filtered when their reception ends.
+ *
+ */
+#ifndef NRF_802154_RX_EARLY_ADDR_FILTER_ENABLED
+#define NRF_802154_RX_EARLY_ADDR_FILTER_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_RX_DUPLICATE_FILTER_ENABLED
+ *
+ * If the driver drops retransmitted frames. When enabled, a received frame with the
+ * Acknowledgement Request bit set that has the same source address and DSN as the last frame
+ * received from that source is still acknowledged, but the next higher layer is not notified
+ * about it and its buffer is reused for the following reception.
+ *
+ * Duplicated frames are not dropped in the promiscuous mode.
+ *
+ */
+#ifndef NRF_802154_RX_DUPLICATE_FILTER_ENABLED
+#define NRF_802154_RX_DUPLICATE_FILTER_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_RX_DUPLICATE_FILTER_CACHE_SIZE
+ *
+ * The number of sources tracked by the duplicated frame detection.
+ * See @ref NRF_802154_RX_DUPLICATE_FILTER_ENABLED.
+ *
+ */
+#ifndef NRF_802154_RX_DUPLICATE_FILTER_CACHE_SIZE
+#define NRF_802154_RX_DUPLICATE_FILTER_CACHE_SIZE 8
+#endif
+
+/**
+ * @def NRF_802154_INDIRECT_TX_ENABLED
+ *
+ * If the driver transmits frames queued for sleepy devices on their MAC Data Requests.
+ * When enabled, frames queued with @ref nrf_802154_indirect_frame_queue set the pending bit in
+ * the ACK frame sent in response to a MAC Data Request command from their destination device,
+ * and the oldest of them is transmitted with the CSMA-CA procedure right after the ACK.
+ *
+ * This option requires @ref NRF_802154_CSMA_CA_ENABLED.
+ *
+ */
+#ifndef NRF_802154_INDIRECT_TX_ENABLED
+#define NRF_802154_INDIRECT_TX_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_INDIRECT_TX_QUEUE_SIZE
+ *
+ * The number of frames that can be queued for indirect transmission at the same time.
+ * See @ref NRF_802154_INDIRECT_TX_ENABLED.
+ *
+ */
+#ifndef NRF_802154_INDIRECT_TX_QUEUE_SIZE
+#define NRF_802154_INDIRECT_TX_QUEUE_SIZE 8
+#endif
+
+/**
+ * @def NRF_802154_TSCH_ENABLED
+ *
+ * If the driver executes TSCH slotframes autonomously.
+ * When enabled, the slotframes and cells set with @ref nrf_802154_tsch_slotframe_set are
+ * executed by the driver with channel hopping. Frames queued with
+ * @ref nrf_802154_tsch_frame_queue are transmitted in the TX cells of their neighbors and
+ * the receiver is turned on in the RX cells. Only the outcomes of the transmissions and the
+ * received frames are notified to the higher layer.
+ *
+ * This option requires @ref NRF_802154_DELAYED_TRX_ENABLED and
+ * @ref NRF_802154_ACK_TIMEOUT_ENABLED.
+ *
+ */
+#ifndef NRF_802154_TSCH_ENABLED
+#define NRF_802154_TSCH_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_TSCH_SLOTFRAMES_NUM
+ *
+ * The number of TSCH slotframes that can be executed at the same time.
+ * See @ref NRF_802154_TSCH_ENABLED.
+ *
+ */
+#ifndef NRF_802154_TSCH_SLOTFRAMES_NUM
+#define NRF_802154_TSCH_SLOTFRAMES_NUM 2
+#endif
+
+/**
+ * @def NRF_802154_TSCH_CELLS_NUM
+ *
+ * The total number of cells of all TSCH slotframes.
+ * See @ref NRF_802154_TSCH_ENABLED.
+ *
+ */
+#ifndef NRF_802154_TSCH_CELLS_NUM
+#define NRF_802154_TSCH_CELLS_NUM 32
+#endif
+
+/**
+ * @def NRF_802154_TSCH_NEIGHBORS_NUM
+ *
+ * The number of TSCH neighbor queues.
+ * See @ref NRF_802154_TSCH_ENABLED.
+ *
+ */
+#ifndef NRF_802154_TSCH_NEIGHBORS_NUM
+#define NRF_802154_TSCH_NEIGHBORS_NUM 8
+#endif
+
+/**
+ * @def NRF_802154_TSCH_QUEUE_SIZE
+ *
+ * The number of frames that can be queued for transmission in TSCH cells at the same time,
+ * shared by all neighbor queues.
+ * See @ref NRF_802154_TSCH_ENABLED.
+ *
+ */
+#ifndef NRF_802154_TSCH_QUEUE_SIZE
+#define NRF_802154_TSCH_QUEUE_SIZE 16
+#endif
+
+/**
+ * @def NRF_802154_TSCH_SLOT_LEAD_TIME_US
+ *
+ * Time in microseconds before the beginning of an active timeslot at which its delayed
+ * transmission or reception is requested.
+ *
+ * The time must cover the latency of the timer interrupt and of the request processing.
+ * See @ref NRF_802154_TSCH_ENABLED.
+ *
+ */
+#ifndef NRF_802154_TSCH_SLOT_LEAD_TIME_US
+#define NRF_802154_TSCH_SLOT_LEAD_TIME_US 500
+#endif
+
+/**
+ * @def NRF_802154_TSCH_RX_WINDOW_ID
+ *
+ * Identifier of the delayed reception windows of TSCH RX cells.
+ *
+ * The application must not use this identifier for its own delayed receptions. Reception
+ * windows with this identifier that end without a frame are not notified.
+ * See @ref NRF_802154_TSCH_ENABLED.
+ *
+ */
+#ifndef NRF_802154_TSCH_RX_WINDOW_ID
+#define NRF_802154_TSCH_RX_WINDOW_ID (UINT32_MAX - 4)
+#endif
+
+/**
+ * @def NRF_802154_DELAYED_TRX_TX_QUEUE_SIZE
+ *
+ * Number of delayed transmissions that can be scheduled at the same time.
+ *
+ * Scheduled transmissions are kept ordered by their transmission time and only the earliest one
+ * holds a delayed timeslot of the Radio Scheduler. The next one is scheduled as soon as the
+ * timeslot of the previous one starts.
+ *
+ * This option can be set when @ref NRF_802154_DELAYED_TRX_ENABLED is 1.
+ */
+#ifndef NRF_802154_DELAYED_TRX_TX_QUEUE_SIZE
+#define NRF_802154_DELAYED_TRX_TX_QUEUE_SIZE 1
+#endif
+
+/**
+ * @def NRF_802154_DELAYED_TRX_COEX_LEAD_TIME_US
+ *
+ * Time in microseconds by which the delayed timeslots of delayed transmissions and receptions
+ * start ahead of the radio ramp-up.
+ *
+ * The Radio Scheduler requests preconditions of a delayed timeslot just in time for its start,
+ * which does not leave margin for a slow grant of the Wi-Fi coexistence arbiter. With this
+ * option set, the timeslot and thus the coex request start earlier, while the radio is still
+ * triggered at the scheduled time. The radio is reserved for the operation for the additional
+ * time. Mean grant latency measured in @ref nrf_802154_stat_totals_t helps choose the value.
+ *
+ * This option can be set when @ref NRF_802154_DELAYED_TRX_ENABLED is 1.
+ */
+#ifndef NRF_802154_DELAYED_TRX_COEX_LEAD_TIME_US
+#define NRF_802154_DELAYED_TRX_COEX_LEAD_TIME_US 0
+#endif
+
+/**
+ * @def NRF_802154_DELAYED_TRX_RX_DUTY_CYCLE_PRESTART_US
+ *
+ * Time in microseconds before the delayed timeslot of a duty-cycled reception window at which
+ * the timeslot is requested.
+ *
+ * Requesting a delayed timeslot starts the high frequency clock, which then runs until
+ * the timeslot ends. The value must cover the startup time of the high frequency crystal
+ * oscillator with some margin. A larger value wastes current between the windows of
+ * @ref nrf_802154_receive_at_duty_cycled, while a too small one makes the windows start late.
+ *
+ * This option can be set when @ref NRF_802154_DELAYED_TRX_ENABLED is 1.
+ */
+#ifndef NRF_802154_DELAYED_TRX_RX_DUTY_CYCLE_PRESTART_US
+#define NRF_802154_DELAYED_TRX_RX_DUTY_CYCLE_PRESTART_US 1000
+#endif
+
 /**
  * @def NRF_802154_TEST_MODES_ENABLED
  *
@@ -264,6 +848,102 @@ extern "C" {
 #define NRF_802154_TEST_MODES_ENABLED 0
 #endif
 
+/**
+ * @def NRF_802154_FAST_RX_REARM_ENABLED
+ *
+ * If the receiver is to be ramped up by hardware as soon as an ACK frame is transmitted.
+ *
+ * When enabled, the RADIO DISABLED event ending the ACK transmission triggers the receiver ramp-up
+ * through (D)PPI, so the radio returns to listening without waiting for the software to handle
+ * the end of the ACK transmission. This shortens the time during which closely spaced frames are
+ * missed. The fast path is not used when a FEM handles the ACK transmission.
+ * The number of fast transitions is reported in @ref nrf_802154_stat_counters_t.
+ */
+#ifndef NRF_802154_FAST_RX_REARM_ENABLED
+#define NRF_802154_FAST_RX_REARM_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_FEM_CONFIG_CACHE_ENABLED
+ *
+ * If the FEM configuration results are to be cached between radio operations.
+ *
+ * When enabled, the driver remembers the last FEM PA gain passed to the FEM and skips setting
+ * the same gain again, which saves a call on every ACK and back-to-back transmission performed
+ * with the same power. The driver also remembers that the FEM reported its PA or LNA disabled
+ * and then skips the PA or LNA configuration on the following operations, so that the timing
+ * of the operations without a FEM does not include the FEM calls. The cache is dropped each time
+ * the radio is enabled, so a FEM configuration changed while the radio is disabled is applied.
+ */
+#ifndef NRF_802154_FEM_CONFIG_CACHE_ENABLED
+#define NRF_802154_FEM_CONFIG_CACHE_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_LIGHT_SLEEP_ENABLED
+ *
+ * If the light sleep mode is available, see @ref nrf_802154_light_sleep_set.
+ *
+ * In light sleep, the RADIO is disabled and the timeslot is given back as in the regular sleep,
+ * but the RADIO is not reset. When the next timeslot is granted and the RADIO still holds the
+ * 802.15.4 configuration, the reset and the reconfiguration of the RADIO are skipped, so that
+ * the receiver is ramped up sooner after @ref nrf_802154_receive.
+ * The latency of the last wake-up is reported by @ref nrf_802154_wake_latency_get.
+ */
+#ifndef NRF_802154_LIGHT_SLEEP_ENABLED
+#define NRF_802154_LIGHT_SLEEP_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_TX_POWER_SPLIT_CACHE_ENABLED
+ *
+ * Enables caching of the transmit power split into the components applied on each stage of
+ * the transmit path. When enabled, the split is computed by the FEM abstraction layer only once for
+ * each channel and requested power, and the transmit setup reads it from the cache afterwards.
+ * If the FEM configuration changes at runtime, the cache must be invalidated by a call to
+ * @ref nrf_802154_tx_power_split_cache_invalidate.
+ */
+#ifndef NRF_802154_TX_POWER_SPLIT_CACHE_ENABLED
+#define NRF_802154_TX_POWER_SPLIT_CACHE_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_ANT_DIV_TX_LEARNING_ENABLED
+ *
+ * Enables the selection of the transmit antenna learned per peer.
+ *
+ * When enabled, @ref NRF_802154_SL_ANT_DIV_MODE_AUTO can be set as the antenna diversity tx mode.
+ * In this mode the driver tracks the RSSI seen on each antenna for recent peers, based on the best
+ * antenna of received frames and the RSSI of received ACK frames, and penalizes the antenna used
+ * for a transmission that was not acknowledged. Each frame is transmitted through the antenna
+ * preferred for its destination.
+ */
+#ifndef NRF_802154_ANT_DIV_TX_LEARNING_ENABLED
+#define NRF_802154_ANT_DIV_TX_LEARNING_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_ANT_DIV_TX_PEERS_COUNT
+ *
+ * Number of peers for which the preferred transmit antenna is tracked.
+ * Applicable only if @ref NRF_802154_ANT_DIV_TX_LEARNING_ENABLED is set.
+ */
+#ifndef NRF_802154_ANT_DIV_TX_PEERS_COUNT
+#define NRF_802154_ANT_DIV_TX_PEERS_COUNT 8
+#endif
+
+/**
+ * @def NRF_802154_CAPTURE_ENABLED
+ *
+ * Enables the frame capture mode, in which all received frames are written together with their
+ * metadata to a ring buffer supplied by the higher layer. In this mode the frames are neither
+ * filtered nor acknowledged and the receive buffers are not passed to the higher layer.
+ * See @ref nrf_802154_capture_start.
+ */
+#ifndef NRF_802154_CAPTURE_ENABLED
+#define NRF_802154_CAPTURE_ENABLED 0
+#endif
+
 /**
  * @}
  * @defgroup nrf_802154_config_csma CSMA/CA procedure configuration
@@ -350,6 +1030,33 @@ extern "C" {
 #define NRF_802154_CSMA_CA_WAIT_FOR_TIMESLOT 1
 #endif
 
+/**
+ * @def NRF_802154_CSMA_CA_ADAPTIVE_BACKOFF_ENABLED
+ *
+ * Indicates whether the CSMA-CA algorithm adapts the initial backoff exponent to recent
+ * congestion.
+ *
+ * When this option is enabled, the initial backoff exponent is chosen between macMinBE and
+ * macMaxBE according to the recent rate of failed CCA attempts on the current channel and towards
+ * the destination of the frame, whichever is higher.
+ *
+ */
+#ifndef NRF_802154_CSMA_CA_ADAPTIVE_BACKOFF_ENABLED
+#define NRF_802154_CSMA_CA_ADAPTIVE_BACKOFF_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_CSMA_CA_ADAPTIVE_BACKOFF_DST_COUNT
+ *
+ * The number of destinations for which the recent rate of failed CCA attempts is tracked.
+ *
+ * This option can be set when @ref NRF_802154_CSMA_CA_ADAPTIVE_BACKOFF_ENABLED is 1.
+ *
+ */
+#ifndef NRF_802154_CSMA_CA_ADAPTIVE_BACKOFF_DST_COUNT
+#define NRF_802154_CSMA_CA_ADAPTIVE_BACKOFF_DST_COUNT 8
+#endif
+
 /**
  * @}
  * @defgroup nrf_802154_config_timeout ACK timeout feature configuration
@@ -386,6 +1093,23 @@ extern "C" {
 #define NRF_802154_PRECISE_ACK_TIMEOUT_DEFAULT_TIMEOUT 210
 #endif
 
+/**
+ * @def NRF_802154_ACK_TIMEOUT_HW_ENABLED
+ *
+ * Indicates whether the ACK waiting window is to be enforced by hardware.
+ *
+ * When enabled, a TIMER compare event disables the RADIO through (D)PPI if no ACK frame
+ * starts within the ACK timeout, so that the receiver is not kept on until the software timer
+ * expires. The software timer of the ACK timeout feature is still used as a backstop, e.g. when
+ * the TIMER is used by the front-end module.
+ *
+ * This option can be set when @ref NRF_802154_ACK_TIMEOUT_ENABLED is 1.
+ *
+ */
+#ifndef NRF_802154_ACK_TIMEOUT_HW_ENABLED
+#define NRF_802154_ACK_TIMEOUT_HW_ENABLED 0
+#endif
+
 /**
  * @def NRF_802154_MAX_ACK_IE_SIZE
  *
@@ -465,6 +1189,37 @@ extern "C" {
 #define NRF_802154_STATS_COUNT_RECEIVED_PREAMBLES 1
 #endif
 
+/**
+ * @def NRF_802154_PROFILER_ENABLED
+ *
+ * Enables measuring durations of time-critical parts of the driver with the DWT cycle counter.
+ * The measurements can be retrieved by a call to @ref nrf_802154_stat_profile_get.
+ * When this option is enabled, the driver enables the DWT cycle counter during initialization.
+ */
+#ifndef NRF_802154_PROFILER_ENABLED
+#define NRF_802154_PROFILER_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_PROFILER_BUCKET_WIDTH_US
+ *
+ * Width in microseconds of a bucket of the duration histograms gathered by the profiler.
+ * See @ref nrf_802154_stat_profile_t::histogram.
+ */
+#ifndef NRF_802154_PROFILER_BUCKET_WIDTH_US
+#define NRF_802154_PROFILER_BUCKET_WIDTH_US 16
+#endif
+
+/**
+ * @def NRF_802154_PROFILER_HOOKS_ENABLED
+ *
+ * Enables measuring durations of processing of each hook type of the driver core module.
+ * This option has effect only if @ref NRF_802154_PROFILER_ENABLED is enabled.
+ */
+#ifndef NRF_802154_PROFILER_HOOKS_ENABLED
+#define NRF_802154_PROFILER_HOOKS_ENABLED 0
+#endif
+
 /**
  * @}
  * @defgroup nrf_802154_config_security Security configuration
@@ -481,6 +1236,65 @@ extern "C" {
 #define NRF_802154_SECURITY_KEY_STORAGE_SIZE 3
 #endif
 
+/**
+ * @def NRF_802154_SECURITY_KEY_STORAGE_HASHED
+ *
+ * Selects the Key Storage implementation that indexes keys with a hash of their ID mode and
+ * ID. The lookup time of this implementation does not depend on the number of stored keys,
+ * which makes it suitable for large values of @ref NRF_802154_SECURITY_KEY_STORAGE_SIZE.
+ * When disabled, keys are searched linearly.
+ */
+#ifndef NRF_802154_SECURITY_KEY_STORAGE_HASHED
+#define NRF_802154_SECURITY_KEY_STORAGE_HASHED 0
+#endif
+
+/**
+ * @def NRF_802154_SECURITY_FC_PERSIST_ENABLED
+ *
+ * Enables the persistence of the MAC Global Frame Counter in flash.
+ *
+ * When enabled, the driver stores in flash a reservation of frame counters ahead of the Global
+ * Frame Counter and restores it during the initialization, so that frame counters are never
+ * repeated across resets. A new reservation is written only when half of the stored one has been
+ * used. The flash is written through the job engine of the NVMC driver, so the application must
+ * call @c nrfx_nvmc_job_process until it reports no pending jobs. Secured transmissions that would
+ * use a frame counter not covered by the stored reservation fail.
+ *
+ * To keep the guarantee, the higher layer should restore the frame counter with
+ * @ref nrf_802154_security_global_frame_counter_set_if_larger.
+ */
+#ifndef NRF_802154_SECURITY_FC_PERSIST_ENABLED
+#define NRF_802154_SECURITY_FC_PERSIST_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_SECURITY_FC_PERSIST_ADDRESS
+ *
+ * Address of the first flash page used to persist the MAC Global Frame Counter. It has no default
+ * value and must be defined if @ref NRF_802154_SECURITY_FC_PERSIST_ENABLED is set.
+ */
+
+/**
+ * @def NRF_802154_SECURITY_FC_PERSIST_PAGES
+ *
+ * Number of consecutive flash pages used to persist the MAC Global Frame Counter. At least two
+ * pages are required, so that the current reservation remains stored while a page is erased.
+ */
+#ifndef NRF_802154_SECURITY_FC_PERSIST_PAGES
+#define NRF_802154_SECURITY_FC_PERSIST_PAGES 2
+#endif
+
+/**
+ * @def NRF_802154_SECURITY_FC_PERSIST_RESERVATION
+ *
+ * Number of frame counters reserved ahead of the MAC Global Frame Counter with each flash write.
+ * Larger values reduce the flash wear at the cost of a larger jump of the frame counter after
+ * a reset.
+ */
+#ifndef NRF_802154_SECURITY_FC_PERSIST_RESERVATION
+#define NRF_802154_SECURITY_FC_PERSIST_RESERVATION 1000
+#endif
+
 /**
  * @def NRF_802154_SECURITY_WRITER_ENABLED
  *
@@ -510,6 +1324,55 @@ extern "C" {
 #define NRF_802154_ENCRYPTION_ACCELERATOR_ECB 1
 #endif
 
+/**
+ * @def NRF_802154_ECB_SHARED_ENABLED
+ *
+ * Enables sharing of the ECB peripheral with other users through the nrfx_ecb driver.
+ *
+ * By default, the driver takes exclusive ownership of the ECB peripheral. When this option is set,
+ * the AES-CCM* transformations are performed as jobs of the nrfx_ecb driver instead, so that the
+ * peripheral remains available to the application. The application is responsible for
+ * initializing the nrfx_ecb driver and for forwarding the ECB interrupt to it. The
+ * @ref NRF_802154_ECB_PRIORITY option has no effect then.
+ *
+ * @note This option requires @ref NRF_802154_ENCRYPTION_ACCELERATOR_ECB and is not supported
+ *       together with @ref NRF_802154_TX_IN_PLACE_ENABLED.
+ *
+ */
+#ifndef NRF_802154_ECB_SHARED_ENABLED
+#define NRF_802154_ECB_SHARED_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_ECB_SHARED_JOB_PRIORITY
+ *
+ * Priority of the nrfx_ecb driver jobs performing the AES-CCM* transformations. The default is
+ * the highest priority, so that a transformation is delayed by other users of the peripheral by
+ * at most one block.
+ *
+ */
+#ifndef NRF_802154_ECB_SHARED_JOB_PRIORITY
+#define NRF_802154_ECB_SHARED_JOB_PRIORITY 0
+#endif
+
+/**
+ * @def NRF_802154_TX_IN_PLACE_ENABLED
+ *
+ * Indicates whether frames to be transmitted are secured in place.
+ *
+ * By default, the driver secures a frame in an internal work buffer and copies the result back
+ * to the buffer provided by the higher layer when the transmission ends. When this option is set,
+ * the higher layer grants the driver write ownership of the buffer passed to the transmit
+ * functions until the transmission result is notified. The frame is then encrypted directly in
+ * that buffer and the internal work buffer is not allocated.
+ *
+ * @note The higher layer must not access the buffer while the transmission is in progress.
+ *
+ */
+#ifndef NRF_802154_TX_IN_PLACE_ENABLED
+#define NRF_802154_TX_IN_PLACE_ENABLED 0
+#endif
+
 /**
  * @}
  * @defgroup nrf_802154_ie Information Elements configuration
@@ -527,6 +1390,64 @@ extern "C" {
 #define NRF_802154_IE_WRITER_ENABLED 1
 #endif
 
+/**
+ * @def NRF_802154_IE_WRITER_CSL_PRECOMPUTE_ENABLED
+ *
+ * If the CSL phase is to be precomputed when the CSL IE write is prepared.
+ *
+ * When enabled, the CSL period is converted to microseconds when it is set and the time of
+ * the nearest CSL window midpoint is computed with 64-bit arithmetic when the frame containing
+ * the CSL IE is prepared for transmission. When the transmission starts, the phase is derived
+ * from that time with a single 32-bit subtraction, which keeps the IE write short even at high CSL
+ * rates. If more than one CSL period passes between the preparation and the start of
+ * the transmission, the phase is computed from the anchor time as when the option is disabled.
+ *
+ * This option is used only when the CSL anchor time is set with
+ * @ref nrf_802154_csl_writer_anchor_time_set.
+ */
+#ifndef NRF_802154_IE_WRITER_CSL_PRECOMPUTE_ENABLED
+#define NRF_802154_IE_WRITER_CSL_PRECOMPUTE_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_FRAME_PARSER_IE_INDEX_ENABLED
+ *
+ * If the frame parser is to build an index of the header Information Elements.
+ *
+ * When enabled, the offsets of the header IEs are recorded while the frame is parsed to
+ * @ref PARSE_LEVEL_FULL. The IE writer uses the index to reach the IEs it fills in the transmitted
+ * frames and the Enh-Acks, instead of walking the IE chain once more in the time-critical
+ * transmission and ACK paths. If a frame contains more header IEs than the index can hold,
+ * the IE chain is walked as when the option is disabled.
+ */
+#ifndef NRF_802154_FRAME_PARSER_IE_INDEX_ENABLED
+#define NRF_802154_FRAME_PARSER_IE_INDEX_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_FRAME_PARSER_IE_INDEX_SIZE
+ *
+ * The number of header IEs recorded by the frame parser when
+ * @ref NRF_802154_FRAME_PARSER_IE_INDEX_ENABLED is set. Each entry takes one byte of every frame
+ * parser data instance.
+ */
+#ifndef NRF_802154_FRAME_PARSER_IE_INDEX_SIZE
+#define NRF_802154_FRAME_PARSER_IE_INDEX_SIZE 4
+#endif
+
+/**
+ * @def NRF_802154_TX_PREPARE_ENABLED
+ *
+ * Enables the two-phase transmission API: @ref nrf_802154_transmit_prepare and
+ * @ref nrf_802154_transmit_commit.
+ *
+ * A prepared frame has its header IEs, security frame counter, encryption key and nonce and the
+ * transmit power resolved ahead of time, so that committing it only has to start the radio.
+ */
+#ifndef NRF_802154_TX_PREPARE_ENABLED
+#define NRF_802154_TX_PREPARE_ENABLED 0
+#endif
+
 /**
  * @def NRF_802154_CARRIER_FUNCTIONS_ENABLED
  *
@@ -537,6 +1458,53 @@ extern "C" {
 #define NRF_802154_CARRIER_FUNCTIONS_ENABLED 1
 #endif
 
+/**
+ * @def NRF_802154_RADIO_TRACE_ENABLED
+ *
+ * Enables the hardware tracing of RADIO events on GPIO pins.
+ *
+ * When enabled, the READY, ADDRESS, END, PHYEND, CCABUSY and DISABLED events of the RADIO
+ * peripheral toggle GPIO pins through GPIOTE tasks connected with PPI channels. The pins follow
+ * the hardware timing of the events without any CPU involvement, so the option can be used to
+ * measure the radio timing in release builds. The pins and the peripherals used are selected with
+ * the NRF_802154_RADIO_TRACE_* options in nrf_802154_peripherals_nrf52.h.
+ *
+ * @note This option is supported only on SoCs with PPI. It cannot be used together with
+ *       ENABLE_DEBUG_GPIO.
+ */
+#ifndef NRF_802154_RADIO_TRACE_ENABLED
+#define NRF_802154_RADIO_TRACE_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_HOT_FUNC
+ *
+ * Attribute of the functions on the time-critical path from the RADIO interrupt to the ACK
+ * transmission: the RADIO IRQ handlers, the core handlers of the reception events, the frame
+ * parser and filter, and the ACK generators.
+ *
+ * By default the attribute is empty and the functions are placed in flash. The functions can be
+ * executed from RAM, so that their timing does not depend on flash wait states, cache misses or
+ * ongoing NVMC operations, by defining this option as a section attribute, for example
+ * @code
+ * #define NRF_802154_HOT_FUNC __attribute__((section(".nrf_802154_hot")))
+ * @endcode
+ * and placing the section among initialized data in the linker script. For the GNU linker:
+ * @code
+ * .data :
+ * {
+ *     ...
+ *     *(.nrf_802154_hot*)
+ * } > RAM AT > FLASH
+ * @endcode
+ *
+ * @note Functions called from the hot ones that are not inlined remain in flash. The linker
+ *       inserts veneers for the calls between RAM and flash.
+ */
+#ifndef NRF_802154_HOT_FUNC
+#define NRF_802154_HOT_FUNC
+#endif
+
 /**
  *@}
  **/
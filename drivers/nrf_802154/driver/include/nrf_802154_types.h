@@ -183,6 +183,36 @@ typedef uint8_t nrf_802154_src_addr_match_t;
 #define NRF_802154_SRC_ADDR_MATCH_ZIGBEE   0x01 // !< Implementation for the Zigbee protocol.
 #define NRF_802154_SRC_ADDR_MATCH_ALWAYS_1 0x02 // !< Standard compliant implementation.
 
+/**
+ * @brief Additional receive identity of the device.
+ *
+ * See @ref nrf_802154_identity_set.
+ */
+typedef struct
+{
+    uint8_t                     pan_id[2];        ///< PAN ID (little-endian).
+    uint8_t                     short_addr[2];    ///< Short address (little-endian).
+    uint8_t                     extended_addr[8]; ///< Extended address (little-endian).
+    bool                        auto_ack;         ///< If ACKs are sent for frames destined to this identity.
+    nrf_802154_src_addr_match_t src_addr_match;   ///< Source address matching method used for the pending bit in these ACKs.
+} nrf_802154_identity_t;
+
+/**
+ * @brief Link quality of a peer aggregated by the driver.
+ *
+ * See @ref nrf_802154_link_quality_read.
+ */
+typedef struct
+{
+    uint8_t  addr[8];   ///< Short or extended address of the peer (little-endian).
+    uint8_t  pan_id[2]; ///< PAN ID of the peer (little-endian).
+    bool     extended;  ///< If @c addr is an extended address. Otherwise only its first two bytes are valid.
+    int8_t   rssi;      ///< Average RSSI of the frames received from the peer in dBm.
+    uint8_t  lqi;       ///< Average LQI of the frames received from the peer.
+    uint8_t  margin;    ///< Average link margin above the receiver sensitivity in dB.
+    uint32_t rx_count;  ///< Number of frames received from the peer.
+} nrf_802154_link_quality_t;
+
 /**
  * @brief RSSI measurement results.
  */
@@ -305,6 +335,20 @@ typedef struct
     uint32_t coex_denied_requests;
     /**@brief Number of coex grant activations that have been not requested. */
     uint32_t coex_unsolicited_grants;
+    /**@brief Number of times the receiver was ramped up by hardware after an ACK transmission. */
+    uint32_t rx_fast_rearms;
+    /**@brief Number of fast receiver ramp-ups that required reception to be started by software. */
+    uint32_t rx_fast_rearm_late_starts;
+    /**@brief Number of received frames dropped by the RX pre-filter. */
+    uint32_t rx_prefiltered_frames;
+    /**@brief Number of received frames dropped as retransmissions of already received frames. */
+    uint32_t rx_duplicated_frames;
+    /**@brief Number of delayed transmissions and receptions denied their timeslot. */
+    uint32_t delayed_timeslots_denied;
+    /**@brief Number of coex grants whose latency is accounted in
+     *        @ref nrf_802154_stat_totals_t::total_coex_grant_wait_time. Counted only when
+     *        @ref NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED is set. */
+    uint32_t coex_grant_waits;
 } nrf_802154_stat_counters_t;
 
 /**
@@ -339,8 +383,222 @@ typedef struct
     uint64_t total_receive_time;
     /**@brief Total time in microseconds spent on transmission. */
     uint64_t total_transmit_time;
+    /**@brief Total time in microseconds between requesting a priority that requires coex and
+     *        its approval. */
+    uint64_t total_coex_grant_wait_time;
 } nrf_802154_stat_totals_t;
 
+/**@brief Number of buckets of the RSSI histogram in @ref nrf_802154_stat_window_t. */
+#define NRF_802154_STAT_WINDOW_RSSI_BUCKETS          8U
+
+/**@brief Upper RSSI bound in dBm of the first bucket of the RSSI histogram. */
+#define NRF_802154_STAT_WINDOW_RSSI_BUCKET_MIN       (-90)
+
+/**@brief Width in dB of each bucket of the RSSI histogram, except for the first and the last one. */
+#define NRF_802154_STAT_WINDOW_RSSI_BUCKET_WIDTH     10
+
+/**@brief Number of buckets of the CSMA-CA backoff histogram in @ref nrf_802154_stat_window_t. */
+#define NRF_802154_STAT_WINDOW_CSMA_BACKOFF_BUCKETS  8U
+
+/**
+ * @brief Type of structure holding statistics gathered within a single statistics window.
+ *
+ * Rates of events can be obtained by dividing the counts by @c duration.
+ */
+typedef struct
+{
+    /**@brief Duration of the window in microseconds. */
+    uint64_t duration;
+    /**@brief Time in microseconds spent listening within the window. */
+    uint64_t listening_time;
+    /**@brief Time in microseconds spent receiving frames within the window. */
+    uint64_t receive_time;
+    /**@brief Time in microseconds spent transmitting within the window. */
+    uint64_t transmit_time;
+    /**@brief Number of received frames. */
+    uint32_t rx_frames;
+    /**@brief Number of transmitted frames. */
+    uint32_t tx_frames;
+    /**@brief Number of transmitted ACK frames. */
+    uint32_t acks_transmitted;
+    /**@brief Number of received ACK frames matching transmitted frames. */
+    uint32_t acks_received;
+    /**@brief Number of failed CCA attempts. */
+    uint32_t cca_failed_attempts;
+    /**@brief Histogram of the RSSI of received frames. Bucket 0 counts frames with RSSI below
+     *        @ref NRF_802154_STAT_WINDOW_RSSI_BUCKET_MIN, each following bucket is
+     *        @ref NRF_802154_STAT_WINDOW_RSSI_BUCKET_WIDTH wide and the last bucket has no upper
+     *        bound. */
+    uint32_t rssi_histogram[NRF_802154_STAT_WINDOW_RSSI_BUCKETS];
+    /**@brief Histogram of the number of backoffs of finished CSMA-CA procedures. The last bucket
+     *        counts procedures with at least as many backoffs as its index. */
+    uint32_t csma_backoff_histogram[NRF_802154_STAT_WINDOW_CSMA_BACKOFF_BUCKETS];
+    /**@brief Number of RSSI samples of the idle channel taken by the noise monitor. */
+    uint32_t noise_samples;
+    /**@brief Histogram of the RSSI samples of the idle channel taken by the noise monitor. The
+     *        buckets are the same as in @c rssi_histogram. */
+    uint32_t noise_histogram[NRF_802154_STAT_WINDOW_RSSI_BUCKETS];
+} nrf_802154_stat_window_t;
+
+/**@brief Size of the header of a frame record written to the capture ring buffer.
+ *
+ * Each record in the ring buffer consists of the header followed by the PSDU of the captured frame,
+ * including FCS. The header has the following layout, with multi-byte fields in little endian:
+ *  - bytes 0-7: timestamp of the end of the frame [us] or @ref NRF_802154_NO_TIMESTAMP,
+ *  - byte 8:    RSSI of the frame [dBm],
+ *  - byte 9:    LQI of the frame,
+ *  - byte 10:   flags, see @ref NRF_802154_CAPTURE_FLAG_CRC_OK,
+ *  - byte 11:   length of the PSDU that follows the header.
+ *
+ * A record can wrap around the end of the ring buffer.
+ */
+#define NRF_802154_CAPTURE_RECORD_HEADER_SIZE 12U
+
+/**@brief Flag of a capture record that indicates the frame was received with a correct FCS. */
+#define NRF_802154_CAPTURE_FLAG_CRC_OK        0x01U
+
+/**
+ * @brief Structure describing the state of the capture ring buffer.
+ *
+ * Positions are free-running counters of bytes. The offset in the ring buffer of a position is
+ * the position modulo the size of the ring buffer.
+ */
+typedef struct
+{
+    uint32_t write_pos;       ///< Position up to which the records were written.
+    uint32_t read_pos;        ///< Position up to which the records were consumed.
+    uint32_t captured_frames; ///< Number of frames written to the ring buffer.
+    uint32_t dropped_frames;  ///< Number of frames dropped due to lack of space in the ring buffer.
+} nrf_802154_capture_status_t;
+
+/**@brief Maximum number of channels scanned by @ref nrf_802154_energy_scan. */
+#define NRF_802154_ENERGY_SCAN_CHANNELS_MAX 16U
+
+/**@brief Mask of channels that can be scanned by @ref nrf_802154_energy_scan. */
+#define NRF_802154_ENERGY_SCAN_CHANNELS_MASK 0x07FFF800UL
+
+/**
+ * @brief Parts of the driver whose durations are measured by the profiler.
+ *
+ * Possible values:
+ * - @ref NRF_802154_PROFILE_POINT_RADIO_IRQ,
+ * - @ref NRF_802154_PROFILE_POINT_RX_TO_ACK,
+ * - @ref NRF_802154_PROFILE_POINT_ENCRYPT_SETUP,
+ * - @ref NRF_802154_PROFILE_POINT_SWI_IRQ,
+ * - @ref NRF_802154_PROFILE_POINT_HOOKS_TERMINATE,
+ * - @ref NRF_802154_PROFILE_POINT_HOOKS_PRE_TRANSMISSION,
+ * - @ref NRF_802154_PROFILE_POINT_HOOKS_TX_SETUP,
+ * - @ref NRF_802154_PROFILE_POINT_HOOKS_TRANSMITTED,
+ * - @ref NRF_802154_PROFILE_POINT_HOOKS_TX_FAILED,
+ * - @ref NRF_802154_PROFILE_POINT_HOOKS_TX_ACK_FAILED,
+ * - @ref NRF_802154_PROFILE_POINT_HOOKS_TX_STARTED,
+ * - @ref NRF_802154_PROFILE_POINT_HOOKS_RX_STARTED,
+ * - @ref NRF_802154_PROFILE_POINT_HOOKS_RX_ACK_STARTED,
+ * - @ref NRF_802154_PROFILE_POINT_HOOKS_TX_ACK_STARTED,
+ * - @ref NRF_802154_PROFILE_POINT_FILTER,
+ * - @ref NRF_802154_PROFILE_POINT_ACK_GENERATE,
+ * - @ref NRF_802154_PROFILE_POINT_ACK_DATA_LOOKUP,
+ * - @ref NRF_802154_PROFILE_POINT_CRITICAL_SECTION.
+ *
+ * The durations of the hooks are measured only if @ref NRF_802154_PROFILER_HOOKS_ENABLED
+ * is enabled.
+ */
+typedef uint8_t nrf_802154_profile_point_t;
+
+#define NRF_802154_PROFILE_POINT_RADIO_IRQ     0x00 // !< Handling of the RADIO interrupt.
+#define NRF_802154_PROFILE_POINT_RX_TO_ACK     0x01 // !< From the end of a received frame to the ACK transmission setup.
+#define NRF_802154_PROFILE_POINT_ENCRYPT_SETUP 0x02 // !< Setup of the encryption of a frame or an ACK.
+#define NRF_802154_PROFILE_POINT_SWI_IRQ       0x03 // !< Handling of the SWI interrupt.
+
+#define NRF_802154_PROFILE_POINT_HOOKS_TERMINATE        0x04 // !< Hooks of the termination request.
+#define NRF_802154_PROFILE_POINT_HOOKS_PRE_TRANSMISSION 0x05 // !< Hooks before the transmission request.
+#define NRF_802154_PROFILE_POINT_HOOKS_TX_SETUP         0x06 // !< Hooks of the transmission setup.
+#define NRF_802154_PROFILE_POINT_HOOKS_TRANSMITTED      0x07 // !< Hooks of the transmitted event.
+#define NRF_802154_PROFILE_POINT_HOOKS_TX_FAILED        0x08 // !< Hooks of the TX failed event.
+#define NRF_802154_PROFILE_POINT_HOOKS_TX_ACK_FAILED    0x09 // !< Hooks of the ACK TX failed event.
+#define NRF_802154_PROFILE_POINT_HOOKS_TX_STARTED       0x0A // !< Hooks of the TX started event.
+#define NRF_802154_PROFILE_POINT_HOOKS_RX_STARTED       0x0B // !< Hooks of the RX started event.
+#define NRF_802154_PROFILE_POINT_HOOKS_RX_ACK_STARTED   0x0C // !< Hooks of the RX ACK started event.
+#define NRF_802154_PROFILE_POINT_HOOKS_TX_ACK_STARTED   0x0D // !< Hooks of the TX ACK started event.
+
+#define NRF_802154_PROFILE_POINT_FILTER          0x0E // !< Filtering of a part of a received frame.
+#define NRF_802154_PROFILE_POINT_ACK_GENERATE    0x0F // !< Generation of an ACK, including the ACK data lookups.
+#define NRF_802154_PROFILE_POINT_ACK_DATA_LOOKUP 0x10 // !< Lookup of a source address in the ACK data tables.
+
+#define NRF_802154_PROFILE_POINT_CRITICAL_SECTION 0x11 // !< Time spent in the outermost critical section.
+
+/**@brief Number of parts of the driver whose durations are measured by the profiler. */
+#define NRF_802154_PROFILE_POINT_COUNT         18U
+
+/**@brief Number of buckets of a duration histogram gathered by the profiler. */
+#define NRF_802154_STAT_PROFILE_BUCKET_COUNT   16U
+
+/**
+ * @brief Type of structure holding durations of a part of the driver measured by the profiler.
+ */
+typedef struct
+{
+    /**@brief Number of measurements. */
+    uint32_t count;
+
+    /**@brief Shortest measured duration in microseconds, @c UINT32_MAX if there are none. */
+    uint32_t min_us;
+
+    /**@brief Longest measured duration in microseconds. */
+    uint32_t max_us;
+
+    /**@brief Histogram of measured durations.
+     *
+     * Bucket @c i counts durations from @c i * @ref NRF_802154_PROFILER_BUCKET_WIDTH_US
+     * up to, but not including, (@c i + 1) * @ref NRF_802154_PROFILER_BUCKET_WIDTH_US
+     * microseconds. The last bucket also counts all longer durations.
+     */
+    uint32_t histogram[NRF_802154_STAT_PROFILE_BUCKET_COUNT];
+} nrf_802154_stat_profile_t;
+
+/**
+ * @brief Type of structure holding low watermarks of driver resources.
+ *
+ * This structure holds fields of @c uint32_t type only. A field equal to @c UINT32_MAX
+ * means that no value was recorded since the last reset.
+ */
+typedef struct
+{
+    /**@brief Lowest number of free receive buffers observed. */
+    uint32_t rx_buffers_free_min;
+
+    /**@brief Lowest number of free entries observed in the queue of transmission, energy
+     *        detection and CCA result notifications. */
+    uint32_t ntf_high_queue_free_min;
+
+    /**@brief Lowest number of free entries observed in the queue of reception notifications. */
+    uint32_t ntf_low_queue_free_min;
+} nrf_802154_stat_watermarks_t;
+
+/**@brief Number of channels for which congestion statistics are gathered. */
+#define NRF_802154_STAT_CONGESTION_CHANNEL_COUNT 16U
+
+/**@brief Congestion rate meaning that all recent CCA attempts on a channel failed. */
+#define NRF_802154_STAT_CONGESTION_RATE_MAX      0xFFFFU
+
+/**
+ * @brief Type of structure holding congestion statistics of channels.
+ *
+ * This structure holds fields of @c uint32_t type only.
+ */
+typedef struct
+{
+    /**@brief Recent rate of failed CCA attempts of the CSMA-CA procedure, from 0 up to
+     *        @ref NRF_802154_STAT_CONGESTION_RATE_MAX. Element 0 refers to channel 11. */
+    uint32_t cca_busy_rate[NRF_802154_STAT_CONGESTION_CHANNEL_COUNT];
+
+    /**@brief CCA ED threshold derived from the noise floor, in the units of
+     *        @ref nrf_802154_cca_cfg_t::ed_threshold. Equal to 0 if the channel has not been
+     *        calibrated since the last reset. Element 0 refers to channel 11.
+     *        Recorded only when @ref NRF_802154_CCA_ED_CALIBRATION_ENABLED is 1. */
+    uint32_t cca_ed_threshold[NRF_802154_STAT_CONGESTION_CHANNEL_COUNT];
+} nrf_802154_stat_congestion_t;
+
 /**
  * @brief Type of structure holding statistics about the Radio Driver behavior.
  */
@@ -351,6 +609,12 @@ typedef struct
 
     /**@brief Time stamps of events */
     nrf_802154_stat_timestamps_t timestamps;
+
+    /**@brief Low watermarks of driver resources */
+    nrf_802154_stat_watermarks_t watermarks;
+
+    /**@brief Congestion of channels */
+    nrf_802154_stat_congestion_t congestion;
 } nrf_802154_stats_t;
 
 /**
@@ -453,8 +717,9 @@ typedef struct
  */
 typedef struct
 {
-    nrf_802154_transmitted_frame_props_t frame_props; // !< Properties of the frame to be transmitted.
-    nrf_802154_tx_power_metadata_t       tx_power;    // !< Information about the TX power to be used
+    nrf_802154_transmitted_frame_props_t frame_props;       // !< Properties of the frame to be transmitted.
+    nrf_802154_tx_power_metadata_t       tx_power;          // !< Information about the TX power to be used
+    uint8_t                              max_frame_retries; // !< Number of times the driver retransmits the frame, each time preceded by a new CSMA-CA procedure, if no matching ACK is received (macMaxFrameRetries).
 } nrf_802154_transmit_csma_ca_metadata_t;
 
 /**
@@ -463,6 +728,7 @@ typedef struct
 typedef struct
 {
     nrf_802154_transmitted_frame_props_t frame_props; // !< Properties of the returned frame.
+    uint8_t                              retries;     // !< Number of retransmissions of the frame performed by the driver before the reported outcome.
 
     union
     {
@@ -489,6 +755,60 @@ typedef void (* nrf_802154_transmit_failed_notification_t)(
     nrf_802154_tx_error_t                       error,
     const nrf_802154_transmit_done_metadata_t * p_meta);
 
+/**
+ * @brief Function pointer used for deciding if a received frame is to be passed to the next
+ *        higher layer.
+ *
+ * @param[in]  p_data  Pointer to a buffer that contains PHR and PSDU of the received frame.
+ * @param[in]  power   RSSI of the received frame.
+ * @param[in]  lqi     LQI of the received frame.
+ *
+ * @retval  true   The frame is to be passed to the next higher layer.
+ * @retval  false  The frame is to be dropped and its buffer reused by the driver.
+ */
+typedef bool (* nrf_802154_rx_prefilter_t)(const uint8_t * p_data, int8_t power, uint8_t lqi);
+
+/**
+ * @brief Options of a TSCH cell.
+ *
+ * Possible values are combinations of:
+ * - @ref NRF_802154_TSCH_CELL_OPTION_TX,
+ * - @ref NRF_802154_TSCH_CELL_OPTION_RX,
+ * - @ref NRF_802154_TSCH_CELL_OPTION_SHARED.
+ */
+typedef uint8_t nrf_802154_tsch_cell_options_t;
+
+#define NRF_802154_TSCH_CELL_OPTION_TX     0x01 // !< Frames queued for the neighbor of the cell are transmitted in the cell.
+#define NRF_802154_TSCH_CELL_OPTION_RX     0x02 // !< The receiver is turned on in the cell if there is nothing to transmit.
+#define NRF_802154_TSCH_CELL_OPTION_SHARED 0x04 // !< The cell is shared. Retransmissions in it are delayed by the TSCH CSMA-CA backoff.
+
+/**
+ * @brief Neighbor index of a TSCH cell that serves the frames queued for any neighbor.
+ */
+#define NRF_802154_TSCH_NEIGHBOR_ANY 0xFF
+
+/**
+ * @brief Structure that describes a cell of a TSCH slotframe.
+ */
+typedef struct
+{
+    uint16_t                       timeslot;       // !< Timeslot of the cell in the slotframe.
+    uint16_t                       channel_offset; // !< Channel offset of the cell.
+    nrf_802154_tsch_cell_options_t options;        // !< Options of the cell.
+    uint8_t                        neighbor;       // !< Index of the neighbor queue served by a TX cell or @ref NRF_802154_TSCH_NEIGHBOR_ANY.
+} nrf_802154_tsch_cell_t;
+
+/**
+ * @brief Structure that holds the TSCH timeslot timing.
+ */
+typedef struct
+{
+    uint32_t slot_length; // !< Length of a timeslot, in microseconds (macTsTimeslotLength).
+    uint32_t tx_offset;   // !< Time from the beginning of a timeslot to the transmission start, in microseconds (macTsTxOffset).
+    uint32_t rx_offset;   // !< Time from the beginning of a timeslot to the receiver start, in microseconds (macTsRxOffset).
+    uint32_t rx_wait;     // !< Time for which the receiver waits for a frame, in microseconds (macTsRxWait).
+} nrf_802154_tsch_timing_t;
+
 /**
  *@}
  **/
@@ -44,14 +44,45 @@
 #include <assert.h>
 #include <string.h>
 
+#include "mac_features/nrf_802154_filter.h"
 #include "mac_features/nrf_802154_frame_parser.h"
+#include "mac_features/nrf_802154_indirect_tx.h"
 #include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
+#include "nrf_802154_profiler.h"
+#include "nrf_802154_utils.h"
 
 /// Maximum number of Short Addresses of nodes for which there is ACK data to set.
 #define NUM_SHORT_ADDRESSES    NRF_802154_PENDING_SHORT_ADDRESSES
 /// Maximum number of Extended Addresses of nodes for which there is ACK data to set.
 #define NUM_EXTENDED_ADDRESSES NRF_802154_PENDING_EXTENDED_ADDRESSES
+/// Maximum number of addresses of a batch that are sorted and applied in one critical section.
+#define BATCH_CHUNK_SIZE       32U
+
+#if NRF_802154_ACK_DATA_HASH_INDEX_ENABLED
+
+#if NRF_802154_ACK_DATA_HASH_SLOTS_PER_ADDRESS < 2
+#error NRF_802154_ACK_DATA_HASH_SLOTS_PER_ADDRESS must be at least 2
+#endif
+
+#if (NUM_SHORT_ADDRESSES >= 0xFFFF) || (NUM_EXTENDED_ADDRESSES >= 0xFFFF)
+#error Number of pending addresses exceeds the bit width of a hash slot
+#endif
+
+/// Number of hash slots indexing Short Addresses.
+#define NUM_SHORT_HASH_SLOTS    (NUM_SHORT_ADDRESSES * NRF_802154_ACK_DATA_HASH_SLOTS_PER_ADDRESS)
+/// Number of hash slots indexing Extended Addresses.
+#define NUM_EXTENDED_HASH_SLOTS (NUM_EXTENDED_ADDRESSES * NRF_802154_ACK_DATA_HASH_SLOTS_PER_ADDRESS)
+
+/// Value of a hash slot that does not point to any entry.
+#define HASH_SLOT_EMPTY         0U
+/// Multiplier of the Fibonacci hashing scheme (2^32 divided by the golden ratio).
+#define HASH_MULTIPLIER         0x9E3779B1UL
+
+/** @brief Type of a hash slot. Non-empty slot holds the index of the entry incremented by one. */
+typedef uint16_t hash_slot_t;
+
+#endif // NRF_802154_ACK_DATA_HASH_INDEX_ENABLED
 
 /// Structure representing pending bit setting variables.
 typedef struct
@@ -61,6 +92,10 @@ typedef struct
     uint8_t  extended_addr[NUM_EXTENDED_ADDRESSES][EXTENDED_ADDRESS_SIZE]; /// Array of extended addresses of nodes for which there is pending data in the buffer.
     uint32_t num_of_short_addr;                                            /// Current number of short addresses of nodes for which there is pending data in the buffer.
     uint32_t num_of_ext_addr;                                              /// Current number of extended addresses of nodes for which there is pending data in the buffer.
+#if NRF_802154_ACK_DATA_HASH_INDEX_ENABLED
+    hash_slot_t short_hash[NUM_SHORT_HASH_SLOTS];  /// Hash index of @p short_addr.
+    hash_slot_t ext_hash[NUM_EXTENDED_HASH_SLOTS]; /// Hash index of @p extended_addr.
+#endif
 } pending_bit_arrays_t;
 
 // Structure representing a single IE record.
@@ -91,12 +126,17 @@ typedef struct
     ack_ext_ie_data_t   ext_data[NUM_EXTENDED_ADDRESSES]; /// Array of extended addresses and IE records sent to these addresses.
     uint32_t            num_of_short_data;                /// Current number of short addresses stored in @p short_data.
     uint32_t            num_of_ext_data;                  /// Current number of extended addresses stored in @p ext_data.
+#if NRF_802154_ACK_DATA_HASH_INDEX_ENABLED
+    hash_slot_t short_hash[NUM_SHORT_HASH_SLOTS];     /// Hash index of @p short_data.
+    hash_slot_t ext_hash[NUM_EXTENDED_HASH_SLOTS];    /// Hash index of @p ext_data.
+#endif
 } ie_arrays_t;
 
 // TODO: Combine below arrays to perform binary search only once per Ack generation.
 static pending_bit_arrays_t        m_pending_bit;
 static ie_arrays_t                 m_ie;
 static nrf_802154_src_addr_match_t m_src_matching_method;
+static volatile uint32_t           m_ie_generation; ///< Incremented on every change of IE data.
 
 /***************************************************************************************************
  * @section Array handling helper functions
@@ -190,6 +230,93 @@ static int8_t addr_compare(const uint8_t * p_first_addr,
     }
 }
 
+/// Structure describing an address list.
+typedef struct
+{
+    uint8_t     * p_addr_array;       /// Pointer to the list of addresses.
+    uint32_t    * p_addr_array_len;   /// Pointer to the current number of addresses in the list.
+    uint32_t      max_addr_array_len; /// Maximum number of addresses in the list.
+    uint8_t       entry_size;         /// Size of a single entry of the list.
+#if NRF_802154_ACK_DATA_HASH_INDEX_ENABLED
+    hash_slot_t * p_slots;            /// Pointer to the hash slots indexing the list.
+    uint32_t      num_slots;          /// Number of hash slots pointed by @p p_slots.
+#endif
+} addr_table_t;
+
+/**
+ * @brief Get the address list for a given kind of ACK data.
+ *
+ * @param[in]  data_type        Type of ACK data.
+ * @param[in]  extended         Indication if extended or short addresses are requested.
+ * @param[out] p_table          Description of the requested address list.
+ *
+ * @retval true   The table has been found.
+ * @retval false  @p data_type is invalid.
+ */
+static bool addr_table_get(nrf_802154_ack_data_t data_type, bool extended, addr_table_t * p_table)
+{
+    switch (data_type)
+    {
+        case NRF_802154_ACK_DATA_PENDING_BIT:
+            if (extended)
+            {
+                p_table->p_addr_array       = (uint8_t *)m_pending_bit.extended_addr;
+                p_table->p_addr_array_len   = &m_pending_bit.num_of_ext_addr;
+                p_table->max_addr_array_len = NUM_EXTENDED_ADDRESSES;
+                p_table->entry_size         = EXTENDED_ADDRESS_SIZE;
+#if NRF_802154_ACK_DATA_HASH_INDEX_ENABLED
+                p_table->p_slots            = m_pending_bit.ext_hash;
+                p_table->num_slots          = NUM_EXTENDED_HASH_SLOTS;
+#endif
+            }
+            else
+            {
+                p_table->p_addr_array       = (uint8_t *)m_pending_bit.short_addr;
+                p_table->p_addr_array_len   = &m_pending_bit.num_of_short_addr;
+                p_table->max_addr_array_len = NUM_SHORT_ADDRESSES;
+                p_table->entry_size         = SHORT_ADDRESS_SIZE;
+#if NRF_802154_ACK_DATA_HASH_INDEX_ENABLED
+                p_table->p_slots            = m_pending_bit.short_hash;
+                p_table->num_slots          = NUM_SHORT_HASH_SLOTS;
+#endif
+            }
+            break;
+
+        case NRF_802154_ACK_DATA_IE:
+            if (extended)
+            {
+                p_table->p_addr_array       = (uint8_t *)m_ie.ext_data;
+                p_table->p_addr_array_len   = &m_ie.num_of_ext_data;
+                p_table->max_addr_array_len = NUM_EXTENDED_ADDRESSES;
+                p_table->entry_size         = sizeof(ack_ext_ie_data_t);
+#if NRF_802154_ACK_DATA_HASH_INDEX_ENABLED
+                p_table->p_slots            = m_ie.ext_hash;
+                p_table->num_slots          = NUM_EXTENDED_HASH_SLOTS;
+#endif
+            }
+            else
+            {
+                p_table->p_addr_array       = (uint8_t *)m_ie.short_data;
+                p_table->p_addr_array_len   = &m_ie.num_of_short_data;
+                p_table->max_addr_array_len = NUM_SHORT_ADDRESSES;
+                p_table->entry_size         = sizeof(ack_short_ie_data_t);
+#if NRF_802154_ACK_DATA_HASH_INDEX_ENABLED
+                p_table->p_slots            = m_ie.short_hash;
+                p_table->num_slots          = NUM_SHORT_HASH_SLOTS;
+#endif
+            }
+            break;
+
+        default:
+            assert(false);
+            return false;
+    }
+
+    return true;
+}
+
+#if !NRF_802154_ACK_DATA_HASH_INDEX_ENABLED
+
 /**
  * @brief Perform a binary search for an address in a list of addresses.
  *
@@ -280,6 +407,267 @@ static bool addr_binary_search(const uint8_t       * p_addr,
     return false;
 }
 
+#else // !NRF_802154_ACK_DATA_HASH_INDEX_ENABLED
+
+/**
+ * @brief Calculate the home slot of an address in a hash index.
+ *
+ * The 32-bit hash is mapped onto the range of slots with a multiply-high operation, so that
+ * no division is needed regardless of the number of slots.
+ *
+ * @param[in]  p_addr           Pointer to the address.
+ * @param[in]  extended         Indication if @p p_addr is an extended or a short address.
+ * @param[in]  num_slots        Number of slots in the hash index.
+ *
+ * @returns  Index of the first slot to be probed for @p p_addr.
+ */
+static uint32_t addr_hash_home_slot(const uint8_t * p_addr, bool extended, uint32_t num_slots)
+{
+    uint32_t hash;
+
+    if (extended)
+    {
+        uint32_t low_word;
+        uint32_t high_word;
+
+        // Copy the address to prevent unaligned access error.
+        memcpy(&low_word, p_addr, sizeof(low_word));
+        memcpy(&high_word, p_addr + sizeof(low_word), sizeof(high_word));
+
+        hash = (low_word * HASH_MULTIPLIER) ^ high_word;
+    }
+    else
+    {
+        uint16_t short_addr;
+
+        memcpy(&short_addr, p_addr, sizeof(short_addr));
+
+        hash = short_addr;
+    }
+
+    hash *= HASH_MULTIPLIER;
+
+    return (uint32_t)(((uint64_t)hash * num_slots) >> 32);
+}
+
+/**
+ * @brief Get the index of the slot following a given one in a hash index.
+ *
+ * @param[in]  slot             Index of the current slot.
+ * @param[in]  num_slots        Number of slots in the hash index.
+ *
+ * @returns  Index of the next slot, wrapping around at the end of the hash index.
+ */
+static inline uint32_t hash_slot_next(uint32_t slot, uint32_t num_slots)
+{
+    return (slot + 1 == num_slots) ? 0 : slot + 1;
+}
+
+/**
+ * @brief Search for an address in a hash index.
+ *
+ * The hash index uses linear probing. Its load factor never exceeds 50%, so there is always
+ * an empty slot terminating the probe sequence.
+ *
+ * @param[in]  p_table          Pointer to the searched table.
+ * @param[in]  p_addr           Pointer to an address that is searched for.
+ * @param[in]  extended         Indication if @p p_addr is an extended or a short address.
+ * @param[out] p_slot           If the address @p p_addr appears in the table, this is the slot
+ *                              pointing to it. Otherwise, it is the empty slot which would
+ *                              point to @p p_addr if it was added.
+ *
+ * @retval true   Address @p p_addr is in the table.
+ * @retval false  Address @p p_addr is not in the table.
+ */
+static bool hash_slot_find(const addr_table_t * p_table,
+                           const uint8_t      * p_addr,
+                           bool                 extended,
+                           uint32_t           * p_slot)
+{
+    uint32_t slot = addr_hash_home_slot(p_addr, extended, p_table->num_slots);
+
+    for (uint32_t i = 0; i < p_table->num_slots; i++)
+    {
+        hash_slot_t value = p_table->p_slots[slot];
+
+        if (value == HASH_SLOT_EMPTY)
+        {
+            break;
+        }
+
+        if (addr_compare(p_addr,
+                         p_table->p_addr_array + p_table->entry_size * (value - 1),
+                         extended) == 0)
+        {
+            *p_slot = slot;
+            return true;
+        }
+
+        slot = hash_slot_next(slot, p_table->num_slots);
+    }
+
+    *p_slot = slot;
+    return false;
+}
+
+/**
+ * @brief Free a slot of a hash index keeping all probe sequences unbroken.
+ *
+ * Entries following the freed slot are shifted back into it when their probe sequence passes
+ * through the freed slot, so that no tombstones are needed.
+ *
+ * @param[in]  p_table          Pointer to the table.
+ * @param[in]  slot             Index of the slot to be freed.
+ * @param[in]  extended         Indication if the table holds extended or short addresses.
+ */
+static void hash_slot_free(const addr_table_t * p_table, uint32_t slot, bool extended)
+{
+    uint32_t hole = slot;
+    uint32_t next = hash_slot_next(slot, p_table->num_slots);
+
+    while (p_table->p_slots[next] != HASH_SLOT_EMPTY)
+    {
+        const uint8_t * p_addr = p_table->p_addr_array +
+                                 p_table->entry_size * (p_table->p_slots[next] - 1);
+        uint32_t        home   = addr_hash_home_slot(p_addr, extended, p_table->num_slots);
+        bool            stays;
+
+        // The entry stays in place if its home slot lies cyclically within (hole, next].
+        if (hole < next)
+        {
+            stays = (home > hole) && (home <= next);
+        }
+        else
+        {
+            stays = (home > hole) || (home <= next);
+        }
+
+        if (!stays)
+        {
+            p_table->p_slots[hole] = p_table->p_slots[next];
+            hole                   = next;
+        }
+
+        next = hash_slot_next(next, p_table->num_slots);
+    }
+
+    p_table->p_slots[hole] = HASH_SLOT_EMPTY;
+}
+
+/**
+ * @brief Find an address in a list of addresses using its hash index.
+ *
+ * @param[in]  p_addr           Pointer to an address that is searched for.
+ * @param[out] p_location       If the address @p p_addr appears in the list, this is its index in the address list.
+ *                              Otherwise, it is the index which @p p_addr would have if it was placed in the list
+ *                              (end of the list).
+ * @param[in]  data_type        Type of ACK data.
+ * @param[in]  extended         Indication if @p p_addr is an extended or a short addresses.
+ *
+ * @retval true   Address @p p_addr is in the list.
+ * @retval false  Address @p p_addr is not in the list.
+ */
+static bool addr_hash_search(const uint8_t       * p_addr,
+                             uint32_t            * p_location,
+                             nrf_802154_ack_data_t data_type,
+                             bool                  extended)
+{
+    addr_table_t table;
+    uint32_t     slot;
+
+    if (!addr_table_get(data_type, extended, &table))
+    {
+        return false;
+    }
+
+    if (hash_slot_find(&table, p_addr, extended, &slot))
+    {
+        *p_location = table.p_slots[slot] - 1;
+        return true;
+    }
+
+    *p_location = *table.p_addr_array_len;
+    return false;
+}
+
+/**
+ * @brief Add an address appended to the end of a list to the hash index of the list.
+ *
+ * @param[in]  p_addr           Pointer to the added address.
+ * @param[in]  location         Index of @p p_addr in the address list.
+ * @param[in]  data_type        Type of ACK data.
+ * @param[in]  extended         Indication if @p p_addr is an extended or a short addresses.
+ */
+static void addr_hash_add(const uint8_t       * p_addr,
+                          uint32_t              location,
+                          nrf_802154_ack_data_t data_type,
+                          bool                  extended)
+{
+    addr_table_t table;
+    uint32_t     slot;
+    bool         found;
+
+    if (!addr_table_get(data_type, extended, &table))
+    {
+        return;
+    }
+
+    found = hash_slot_find(&table, p_addr, extended, &slot);
+    assert(!found);
+    (void)found;
+
+    table.p_slots[slot] = (hash_slot_t)(location + 1);
+}
+
+/**
+ * @brief Remove an address from a list of addresses and its hash index.
+ *
+ * The last entry of the list is moved to the freed location, so the list stays dense.
+ *
+ * @param[in]  location         Index of the element to be removed from the list.
+ * @param[in]  data_type        Type of ACK data.
+ * @param[in]  extended         Indication if address to remove is an extended or a short address.
+ */
+static void addr_hash_remove(uint32_t location, nrf_802154_ack_data_t data_type, bool extended)
+{
+    addr_table_t table;
+    uint32_t     slot;
+    uint32_t     last;
+    bool         found;
+
+    if (!addr_table_get(data_type, extended, &table))
+    {
+        return;
+    }
+
+    last  = *table.p_addr_array_len - 1;
+    found = hash_slot_find(&table,
+                           table.p_addr_array + table.entry_size * location,
+                           extended,
+                           &slot);
+    assert(found);
+    hash_slot_free(&table, slot, extended);
+
+    if (location != last)
+    {
+        memcpy(table.p_addr_array + table.entry_size * location,
+               table.p_addr_array + table.entry_size * last,
+               table.entry_size);
+
+        found = hash_slot_find(&table,
+                               table.p_addr_array + table.entry_size * location,
+                               extended,
+                               &slot);
+        assert(found);
+
+        table.p_slots[slot] = (hash_slot_t)(location + 1);
+    }
+
+    (void)found;
+}
+
+#endif // !NRF_802154_ACK_DATA_HASH_INDEX_ENABLED
+
 /**
  * @brief Find an address in a list of addresses.
  *
@@ -322,7 +710,13 @@ static bool addr_index_find(const uint8_t       * p_addr,
         return false;
     }
 
+#if NRF_802154_ACK_DATA_HASH_INDEX_ENABLED
+    (void)p_addr_array;
+
+    return addr_hash_search(p_addr, p_location, data_type, extended);
+#else
     return addr_binary_search(p_addr, p_addr_array, p_location, data_type, extended);
+#endif
 }
 
 /**
@@ -491,6 +885,11 @@ static bool addr_add(const uint8_t       * p_addr,
 
     (*p_addr_array_len)++;
 
+#if NRF_802154_ACK_DATA_HASH_INDEX_ENABLED
+    // The list is not sorted in this case, so the address is always appended.
+    addr_hash_add(p_addr, location, data_type, extended);
+#endif
+
     return true;
 }
 
@@ -553,9 +952,16 @@ static bool addr_remove(uint32_t location, nrf_802154_ack_data_t data_type, bool
         return false;
     }
 
+#if NRF_802154_ACK_DATA_HASH_INDEX_ENABLED
+    (void)p_addr_array;
+    (void)entry_size;
+
+    addr_hash_remove(location, data_type, extended);
+#else
     memmove(p_addr_array + entry_size * location,
             p_addr_array + entry_size * (location + 1),
             (*p_addr_array_len - location - 1) * entry_size);
+#endif
 
     (*p_addr_array_len)--;
 
@@ -576,6 +982,379 @@ static void ie_data_add(uint32_t location, bool extended, const uint8_t * p_data
     }
 }
 
+/***************************************************************************************************
+ * @section Batch handling helper functions
+ **************************************************************************************************/
+
+/// Status of a single address of a batch chunk.
+typedef enum
+{
+    BATCH_ENTRY_SKIPPED,  /// Address is not to be added to the list.
+    BATCH_ENTRY_EXISTING, /// Address is already in the list.
+    BATCH_ENTRY_NEW,      /// Address is to be added to the list.
+} batch_entry_status_t;
+
+/// Structure representing a chunk of a batch sorted by address.
+typedef struct
+{
+    const uint8_t * p_addrs;                       /// Pointer to the addresses of the batch.
+    const uint8_t * p_data;                        /// Pointer to the concatenated IE data of the batch.
+    const uint8_t * p_lengths;                     /// Pointer to the lengths of the IE data of the batch.
+    uint16_t        data_offset[BATCH_CHUNK_SIZE]; /// Offsets of the IE data of the chunk entries in @p p_data.
+    uint8_t         order[BATCH_CHUNK_SIZE];       /// Indices of the chunk entries in ascending address order.
+    uint8_t         count;                         /// Number of entries in the chunk.
+    uint8_t         addr_size;                     /// Size of a single address.
+    bool            extended;                      /// Indication if the chunk holds extended addresses.
+} batch_chunk_t;
+
+/**
+ * @brief Get the address of the n-th entry of a chunk in ascending address order.
+ *
+ * @param[in]  p_chunk  Pointer to the chunk.
+ * @param[in]  n        Position of the entry in ascending address order.
+ *
+ * @returns  Pointer to the address.
+ */
+static inline const uint8_t * batch_chunk_addr_get(const batch_chunk_t * p_chunk, uint32_t n)
+{
+    return p_chunk->p_addrs + p_chunk->addr_size * p_chunk->order[n];
+}
+
+/**
+ * @brief Prepare a chunk of a batch and sort its entries by address.
+ *
+ * Insertion sort is used, as chunks are short and the sort must be stable. It is performed
+ * outside of the critical section.
+ *
+ * @param[out] p_chunk      Pointer to the chunk to be prepared.
+ * @param[in]  p_addrs      Pointer to the addresses of the chunk.
+ * @param[in]  extended     Indication if @p p_addrs are extended or short addresses.
+ * @param[in]  count        Number of addresses in the chunk.
+ * @param[in]  p_data       Pointer to the concatenated IE data of the chunk or NULL.
+ * @param[in]  p_lengths    Pointer to the lengths of the IE data of the chunk or NULL.
+ */
+static void batch_chunk_prepare(batch_chunk_t * p_chunk,
+                                const uint8_t * p_addrs,
+                                bool            extended,
+                                uint8_t         count,
+                                const uint8_t * p_data,
+                                const uint8_t * p_lengths)
+{
+    uint16_t offset = 0;
+
+    assert(count <= BATCH_CHUNK_SIZE);
+
+    p_chunk->p_addrs   = p_addrs;
+    p_chunk->p_data    = p_data;
+    p_chunk->p_lengths = p_lengths;
+    p_chunk->count     = count;
+    p_chunk->addr_size = extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
+    p_chunk->extended  = extended;
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        p_chunk->data_offset[i] = offset;
+        offset                 += (p_lengths != NULL) ? p_lengths[i] : 0U;
+
+        uint8_t j = i;
+
+        while ((j > 0) &&
+               (addr_compare(p_addrs + p_chunk->addr_size * i,
+                             p_addrs + p_chunk->addr_size * p_chunk->order[j - 1],
+                             extended) < 0))
+        {
+            p_chunk->order[j] = p_chunk->order[j - 1];
+            j--;
+        }
+
+        p_chunk->order[j] = i;
+    }
+}
+
+/**
+ * @brief Store the IE data of a chunk entry at a given location of the IE list.
+ *
+ * @param[in]  p_chunk      Pointer to the chunk.
+ * @param[in]  n            Position of the entry in ascending address order.
+ * @param[in]  location     Index of the entry in the IE list.
+ */
+static void batch_chunk_ie_data_add(const batch_chunk_t * p_chunk, uint32_t n, uint32_t location)
+{
+    uint8_t idx = p_chunk->order[n];
+
+    ie_data_add(location,
+                p_chunk->extended,
+                p_chunk->p_data + p_chunk->data_offset[idx],
+                p_chunk->p_lengths[idx]);
+}
+
+#if !NRF_802154_ACK_DATA_HASH_INDEX_ENABLED
+
+/**
+ * @brief Merge a sorted chunk into a sorted address list.
+ *
+ * Addresses already present in the list have their IE data updated in place. New addresses
+ * are merged from the end of the list, so that every entry of the list is moved at most once.
+ *
+ * @param[in]  p_chunk      Pointer to the chunk.
+ * @param[in]  data_type    Type of ACK data.
+ *
+ * @retval true   All addresses of the chunk are in the list.
+ * @retval false  Some of the addresses could not be added to the list (list is full).
+ */
+static bool batch_chunk_merge(const batch_chunk_t * p_chunk, nrf_802154_ack_data_t data_type)
+{
+    batch_entry_status_t status[BATCH_CHUNK_SIZE];
+    addr_table_t         table;
+    uint32_t             num_new = 0;
+    uint32_t             len;
+    uint32_t             i;
+    bool                 result  = true;
+
+    if (!addr_table_get(data_type, p_chunk->extended, &table))
+    {
+        return false;
+    }
+
+    len = *table.p_addr_array_len;
+    i   = 0;
+
+    // Classify the entries in a single forward pass through the list.
+    for (uint32_t n = 0; n < p_chunk->count; n++)
+    {
+        const uint8_t * p_addr = batch_chunk_addr_get(p_chunk, n);
+
+        // Only the last of equal addresses is applied.
+        if ((n + 1 < p_chunk->count) &&
+            (addr_compare(p_addr, batch_chunk_addr_get(p_chunk, n + 1), p_chunk->extended) == 0))
+        {
+            status[n] = BATCH_ENTRY_SKIPPED;
+            continue;
+        }
+
+        while ((i < len) &&
+               (addr_compare(table.p_addr_array + table.entry_size * i,
+                             p_addr,
+                             p_chunk->extended) < 0))
+        {
+            i++;
+        }
+
+        if ((i < len) &&
+            (addr_compare(table.p_addr_array + table.entry_size * i,
+                          p_addr,
+                          p_chunk->extended) == 0))
+        {
+            status[n] = BATCH_ENTRY_EXISTING;
+
+            if (data_type == NRF_802154_ACK_DATA_IE)
+            {
+                batch_chunk_ie_data_add(p_chunk, n, i);
+            }
+        }
+        else if (len + num_new < table.max_addr_array_len)
+        {
+            status[n] = BATCH_ENTRY_NEW;
+            num_new++;
+        }
+        else
+        {
+            status[n] = BATCH_ENTRY_SKIPPED;
+            result    = false;
+        }
+    }
+
+    // Merge the new entries starting from the end of the list.
+    uint32_t write = len + num_new;
+    uint32_t read  = len;
+
+    for (uint32_t n = p_chunk->count; (n > 0) && (write > read); n--)
+    {
+        const uint8_t * p_addr = batch_chunk_addr_get(p_chunk, n - 1);
+
+        if (status[n - 1] != BATCH_ENTRY_NEW)
+        {
+            continue;
+        }
+
+        while ((read > 0) &&
+               (addr_compare(table.p_addr_array + table.entry_size * (read - 1),
+                             p_addr,
+                             p_chunk->extended) > 0))
+        {
+            read--;
+            write--;
+            memcpy(table.p_addr_array + table.entry_size * write,
+                   table.p_addr_array + table.entry_size * read,
+                   table.entry_size);
+        }
+
+        write--;
+        memcpy(table.p_addr_array + table.entry_size * write, p_addr, p_chunk->addr_size);
+
+        if (data_type == NRF_802154_ACK_DATA_IE)
+        {
+            batch_chunk_ie_data_add(p_chunk, n - 1, write);
+        }
+    }
+
+    *table.p_addr_array_len = len + num_new;
+
+    return result;
+}
+
+/**
+ * @brief Remove the addresses of a sorted chunk from a sorted address list.
+ *
+ * The list is compacted in a single pass.
+ *
+ * @param[in]  p_chunk      Pointer to the chunk.
+ * @param[in]  data_type    Type of ACK data.
+ *
+ * @retval true   All addresses of the chunk have been removed from the list.
+ * @retval false  Some of the addresses were missing from the list.
+ */
+static bool batch_chunk_remove(const batch_chunk_t * p_chunk, nrf_802154_ack_data_t data_type)
+{
+    addr_table_t table;
+    uint32_t     len;
+    uint32_t     read   = 0;
+    uint32_t     write  = 0;
+    bool         result = true;
+
+    if (!addr_table_get(data_type, p_chunk->extended, &table))
+    {
+        return false;
+    }
+
+    len = *table.p_addr_array_len;
+
+    for (uint32_t n = 0; n < p_chunk->count; n++)
+    {
+        const uint8_t * p_addr = batch_chunk_addr_get(p_chunk, n);
+
+        // Equal addresses are removed once.
+        if ((n > 0) &&
+            (addr_compare(p_addr, batch_chunk_addr_get(p_chunk, n - 1), p_chunk->extended) == 0))
+        {
+            continue;
+        }
+
+        while ((read < len) &&
+               (addr_compare(table.p_addr_array + table.entry_size * read,
+                             p_addr,
+                             p_chunk->extended) < 0))
+        {
+            if (read != write)
+            {
+                memcpy(table.p_addr_array + table.entry_size * write,
+                       table.p_addr_array + table.entry_size * read,
+                       table.entry_size);
+            }
+
+            read++;
+            write++;
+        }
+
+        if ((read < len) &&
+            (addr_compare(table.p_addr_array + table.entry_size * read,
+                          p_addr,
+                          p_chunk->extended) == 0))
+        {
+            read++;
+        }
+        else
+        {
+            result = false;
+        }
+    }
+
+    if (read != write)
+    {
+        memmove(table.p_addr_array + table.entry_size * write,
+                table.p_addr_array + table.entry_size * read,
+                (len - read) * table.entry_size);
+    }
+
+    *table.p_addr_array_len = len - (read - write);
+
+    return result;
+}
+
+#else // !NRF_802154_ACK_DATA_HASH_INDEX_ENABLED
+
+/**
+ * @brief Add the addresses of a chunk to a hashed address list.
+ *
+ * @param[in]  p_chunk      Pointer to the chunk.
+ * @param[in]  data_type    Type of ACK data.
+ *
+ * @retval true   All addresses of the chunk are in the list.
+ * @retval false  Some of the addresses could not be added to the list (list is full).
+ */
+static bool batch_chunk_merge(const batch_chunk_t * p_chunk, nrf_802154_ack_data_t data_type)
+{
+    bool result = true;
+
+    for (uint32_t n = 0; n < p_chunk->count; n++)
+    {
+        const uint8_t * p_addr   = batch_chunk_addr_get(p_chunk, n);
+        uint32_t        location = 0;
+
+        if (addr_index_find(p_addr, &location, data_type, p_chunk->extended) ||
+            addr_add(p_addr, location, data_type, p_chunk->extended))
+        {
+            if (data_type == NRF_802154_ACK_DATA_IE)
+            {
+                batch_chunk_ie_data_add(p_chunk, n, location);
+            }
+        }
+        else
+        {
+            result = false;
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief Remove the addresses of a chunk from a hashed address list.
+ *
+ * @param[in]  p_chunk      Pointer to the chunk.
+ * @param[in]  data_type    Type of ACK data.
+ *
+ * @retval true   All addresses of the chunk have been removed from the list.
+ * @retval false  Some of the addresses were missing from the list.
+ */
+static bool batch_chunk_remove(const batch_chunk_t * p_chunk, nrf_802154_ack_data_t data_type)
+{
+    bool result = true;
+
+    for (uint32_t n = 0; n < p_chunk->count; n++)
+    {
+        const uint8_t * p_addr   = batch_chunk_addr_get(p_chunk, n);
+        uint32_t        location = 0;
+
+        // Equal addresses are removed once.
+        if ((n > 0) &&
+            (addr_compare(p_addr, batch_chunk_addr_get(p_chunk, n - 1), p_chunk->extended) == 0))
+        {
+            continue;
+        }
+
+        if (!addr_index_find(p_addr, &location, data_type, p_chunk->extended) ||
+            !addr_remove(location, data_type, p_chunk->extended))
+        {
+            result = false;
+        }
+    }
+
+    return result;
+}
+
+#endif // !NRF_802154_ACK_DATA_HASH_INDEX_ENABLED
+
 /***************************************************************************************************
  * @section Public API
  **************************************************************************************************/
@@ -585,6 +1364,8 @@ void nrf_802154_ack_data_init(void)
     memset(&m_pending_bit, 0, sizeof(m_pending_bit));
     memset(&m_ie, 0, sizeof(m_ie));
 
+    m_ie_generation++;
+
     m_pending_bit.enabled = true;
     m_src_matching_method = NRF_802154_SRC_ADDR_MATCH_THREAD;
 }
@@ -608,6 +1389,7 @@ bool nrf_802154_ack_data_for_addr_set(const uint8_t       * p_addr,
         if (data_type == NRF_802154_ACK_DATA_IE)
         {
             ie_data_add(location, extended, p_data, data_len);
+            m_ie_generation++;
         }
 
         return true;
@@ -626,6 +1408,11 @@ bool nrf_802154_ack_data_for_addr_clear(const uint8_t       * p_addr,
 
     if (addr_index_find(p_addr, &location, data_type, extended))
     {
+        if (data_type == NRF_802154_ACK_DATA_IE)
+        {
+            m_ie_generation++;
+        }
+
         return addr_remove(location, data_type, extended);
     }
     else
@@ -634,6 +1421,89 @@ bool nrf_802154_ack_data_for_addr_clear(const uint8_t       * p_addr,
     }
 }
 
+bool nrf_802154_ack_data_for_addrs_set_batch(const uint8_t       * p_addrs,
+                                             bool                  extended,
+                                             uint8_t               num_addrs,
+                                             nrf_802154_ack_data_t data_type,
+                                             const void          * p_data,
+                                             const uint8_t       * p_lengths)
+{
+    batch_chunk_t                   chunk;
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    const uint8_t                 * p_chunk_data = (const uint8_t *)p_data;
+    uint8_t                         addr_size    = extended ? EXTENDED_ADDRESS_SIZE :
+                                                   SHORT_ADDRESS_SIZE;
+    bool                            result       = true;
+
+    if ((data_type == NRF_802154_ACK_DATA_IE) && ((p_data == NULL) || (p_lengths == NULL)))
+    {
+        return false;
+    }
+
+    while (num_addrs > 0)
+    {
+        uint8_t count = (num_addrs > BATCH_CHUNK_SIZE) ? BATCH_CHUNK_SIZE : num_addrs;
+
+        batch_chunk_prepare(&chunk,
+                            p_addrs,
+                            extended,
+                            count,
+                            (data_type == NRF_802154_ACK_DATA_IE) ? p_chunk_data : NULL,
+                            (data_type == NRF_802154_ACK_DATA_IE) ? p_lengths : NULL);
+
+        nrf_802154_mcu_critical_enter(mcu_cs);
+        result &= batch_chunk_merge(&chunk, data_type);
+        if (data_type == NRF_802154_ACK_DATA_IE)
+        {
+            m_ie_generation++;
+        }
+        nrf_802154_mcu_critical_exit(mcu_cs);
+
+        if (data_type == NRF_802154_ACK_DATA_IE)
+        {
+            p_chunk_data += chunk.data_offset[count - 1] + p_lengths[count - 1];
+            p_lengths    += count;
+        }
+
+        p_addrs   += addr_size * count;
+        num_addrs -= count;
+    }
+
+    return result;
+}
+
+bool nrf_802154_ack_data_for_addrs_clear_batch(const uint8_t       * p_addrs,
+                                               bool                  extended,
+                                               uint8_t               num_addrs,
+                                               nrf_802154_ack_data_t data_type)
+{
+    batch_chunk_t                   chunk;
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    uint8_t                         addr_size = extended ? EXTENDED_ADDRESS_SIZE :
+                                                SHORT_ADDRESS_SIZE;
+    bool                            result    = true;
+
+    while (num_addrs > 0)
+    {
+        uint8_t count = (num_addrs > BATCH_CHUNK_SIZE) ? BATCH_CHUNK_SIZE : num_addrs;
+
+        batch_chunk_prepare(&chunk, p_addrs, extended, count, NULL, NULL);
+
+        nrf_802154_mcu_critical_enter(mcu_cs);
+        result &= batch_chunk_remove(&chunk, data_type);
+        if (data_type == NRF_802154_ACK_DATA_IE)
+        {
+            m_ie_generation++;
+        }
+        nrf_802154_mcu_critical_exit(mcu_cs);
+
+        p_addrs   += addr_size * count;
+        num_addrs -= count;
+    }
+
+    return result;
+}
+
 void nrf_802154_ack_data_reset(bool extended, nrf_802154_ack_data_t data_type)
 {
     switch (data_type)
@@ -642,21 +1512,35 @@ void nrf_802154_ack_data_reset(bool extended, nrf_802154_ack_data_t data_type)
             if (extended)
             {
                 m_pending_bit.num_of_ext_addr = 0;
+#if NRF_802154_ACK_DATA_HASH_INDEX_ENABLED
+                memset(m_pending_bit.ext_hash, 0, sizeof(m_pending_bit.ext_hash));
+#endif
             }
             else
             {
                 m_pending_bit.num_of_short_addr = 0;
+#if NRF_802154_ACK_DATA_HASH_INDEX_ENABLED
+                memset(m_pending_bit.short_hash, 0, sizeof(m_pending_bit.short_hash));
+#endif
             }
             break;
 
         case NRF_802154_ACK_DATA_IE:
+            m_ie_generation++;
+
             if (extended)
             {
                 m_ie.num_of_ext_data = 0;
+#if NRF_802154_ACK_DATA_HASH_INDEX_ENABLED
+                memset(m_ie.ext_hash, 0, sizeof(m_ie.ext_hash));
+#endif
             }
             else
             {
                 m_ie.num_of_short_data = 0;
+#if NRF_802154_ACK_DATA_HASH_INDEX_ENABLED
+                memset(m_ie.short_hash, 0, sizeof(m_ie.short_hash));
+#endif
             }
             break;
 
@@ -681,12 +1565,70 @@ void nrf_802154_ack_data_src_addr_matching_method_set(nrf_802154_src_addr_match_
 
 }
 
-bool nrf_802154_ack_data_pending_bit_should_be_set(
+/**
+ * @brief Gets the source address matching method used for the frame being received.
+ *
+ * @return Method of the receive identity matched by the frame or the configured method.
+ */
+static nrf_802154_src_addr_match_t rx_src_addr_matching_method_get(void)
+{
+    nrf_802154_src_addr_match_t match_method = m_src_matching_method;
+
+#if NRF_802154_IDENTITIES_NUM > 0
+    const nrf_802154_identity_t * p_identity = nrf_802154_filter_identity_get();
+
+    if (p_identity != NULL)
+    {
+        match_method = p_identity->src_addr_match;
+    }
+#endif
+
+    return match_method;
+}
+
+bool nrf_802154_ack_data_pending_bit_is_resolvable(
     const nrf_802154_frame_parser_data_t * p_frame_data)
 {
-    bool ret;
+    nrf_802154_frame_parser_level_t level = nrf_802154_frame_parser_parse_level_get(p_frame_data);
+    bool                            ret;
 
-    switch (m_src_matching_method)
+    switch (rx_src_addr_matching_method_get())
+    {
+        case NRF_802154_SRC_ADDR_MATCH_THREAD:
+            ret = (level >= PARSE_LEVEL_ADDRESSING_END);
+            break;
+
+        case NRF_802154_SRC_ADDR_MATCH_ZIGBEE:
+            // The pending bit depends on the MAC Command ID that follows the MAC header.
+            ret = (level >= PARSE_LEVEL_FULL) ||
+                  ((level >= PARSE_LEVEL_ADDRESSING_END) &&
+                   (nrf_802154_frame_parser_frame_type_get(p_frame_data) != FRAME_TYPE_COMMAND));
+            break;
+
+        default:
+            ret = true;
+            break;
+    }
+
+#if NRF_802154_INDIRECT_TX_ENABLED
+    // A MAC Data Request may have a frame queued in the indirect queue.
+    if ((level < PARSE_LEVEL_FULL) &&
+        (nrf_802154_frame_parser_frame_type_get(p_frame_data) == FRAME_TYPE_COMMAND))
+    {
+        ret = false;
+    }
+#endif
+
+    return ret;
+}
+
+NRF_802154_HOT_FUNC bool nrf_802154_ack_data_pending_bit_should_be_set(
+    const nrf_802154_frame_parser_data_t * p_frame_data)
+{
+    uint32_t profile_start = nrf_802154_profiler_begin();
+    bool     ret;
+
+    switch (rx_src_addr_matching_method_get())
     {
         case NRF_802154_SRC_ADDR_MATCH_THREAD:
             ret = addr_match_thread(p_frame_data);
@@ -705,6 +1647,12 @@ bool nrf_802154_ack_data_pending_bit_should_be_set(
             assert(false);
     }
 
+#if NRF_802154_INDIRECT_TX_ENABLED
+    ret = ret || nrf_802154_indirect_tx_frame_pending(p_frame_data);
+#endif
+
+    nrf_802154_profiler_end(NRF_802154_PROFILE_POINT_ACK_DATA_LOOKUP, profile_start);
+
     return ret;
 }
 
@@ -712,7 +1660,9 @@ const uint8_t * nrf_802154_ack_data_ie_get(const uint8_t * p_src_addr,
                                            bool            src_addr_extended,
                                            uint8_t       * p_ie_length)
 {
-    uint32_t location;
+    uint32_t        profile_start = nrf_802154_profiler_begin();
+    const uint8_t * p_ie_data     = NULL;
+    uint32_t        location;
 
     if (NULL == p_src_addr)
     {
@@ -724,17 +1674,25 @@ const uint8_t * nrf_802154_ack_data_ie_get(const uint8_t * p_src_addr,
         if (src_addr_extended)
         {
             *p_ie_length = m_ie.ext_data[location].ie_data.len;
-            return m_ie.ext_data[location].ie_data.p_data;
+            p_ie_data    = m_ie.ext_data[location].ie_data.p_data;
         }
         else
         {
             *p_ie_length = m_ie.short_data[location].ie_data.len;
-            return m_ie.short_data[location].ie_data.p_data;
+            p_ie_data    = m_ie.short_data[location].ie_data.p_data;
         }
     }
     else
     {
         *p_ie_length = 0;
-        return NULL;
     }
+
+    nrf_802154_profiler_end(NRF_802154_PROFILE_POINT_ACK_DATA_LOOKUP, profile_start);
+
+    return p_ie_data;
+}
+
+uint32_t nrf_802154_ack_data_ie_generation_get(void)
+{
+    return m_ie_generation;
 }
@@ -99,6 +99,51 @@ bool nrf_802154_ack_data_for_addr_clear(const uint8_t       * p_addr,
                                         bool                  extended,
                                         nrf_802154_ack_data_t data_type);
 
+/**
+ * @brief Adds multiple addresses to the ACK data list.
+ *
+ * The addresses are sorted and merged into the list in chunks. Every chunk is applied within
+ * a single critical section, so the list is traversed once per chunk instead of once per address.
+ * If the same address appears more than once in @p p_addrs, its last occurrence is applied.
+ *
+ * @param[in]  p_addrs    Pointer to @p num_addrs addresses stored one after another.
+ * @param[in]  extended   Indication if @p p_addrs are extended addresses or short addresses.
+ * @param[in]  num_addrs  Number of addresses pointed by @p p_addrs.
+ * @param[in]  data_type  Type of data to be set. Refer to the @ref nrf_802154_ack_data_t type.
+ * @param[in]  p_data     Pointer to the data to be set for the subsequent addresses, concatenated
+ *                        in the order of @p p_addrs. Ignored for @ref NRF_802154_ACK_DATA_PENDING_BIT.
+ * @param[in]  p_lengths  Pointer to @p num_addrs lengths of the data to be set for the subsequent
+ *                        addresses. Ignored for @ref NRF_802154_ACK_DATA_PENDING_BIT.
+ *
+ * @retval true   All addresses successfully added to the list.
+ * @retval false  Some of the addresses not added to the list (list is full).
+ */
+bool nrf_802154_ack_data_for_addrs_set_batch(const uint8_t       * p_addrs,
+                                             bool                  extended,
+                                             uint8_t               num_addrs,
+                                             nrf_802154_ack_data_t data_type,
+                                             const void          * p_data,
+                                             const uint8_t       * p_lengths);
+
+/**
+ * @brief Removes multiple addresses from the ACK data list.
+ *
+ * The addresses are sorted and removed from the list in chunks. Every chunk is applied within
+ * a single critical section, so the list is compacted once per chunk instead of once per address.
+ *
+ * @param[in]  p_addrs    Pointer to @p num_addrs addresses stored one after another.
+ * @param[in]  extended   Indication if @p p_addrs are extended addresses or short addresses.
+ * @param[in]  num_addrs  Number of addresses pointed by @p p_addrs.
+ * @param[in]  data_type  Type of data that is to be cleared for @p p_addrs.
+ *
+ * @retval true   All addresses successfully removed from the list.
+ * @retval false  Some of the addresses not removed from the list (addresses are missing from the list).
+ */
+bool nrf_802154_ack_data_for_addrs_clear_batch(const uint8_t       * p_addrs,
+                                               bool                  extended,
+                                               uint8_t               num_addrs,
+                                               nrf_802154_ack_data_t data_type);
+
 /**
  * @brief Removes all addresses of a given length from the ACK data list.
  *
@@ -121,6 +166,20 @@ void nrf_802154_ack_data_reset(bool extended, nrf_802154_ack_data_t data_type);
  */
 void nrf_802154_ack_data_src_addr_matching_method_set(nrf_802154_src_addr_match_t match_method);
 
+/**
+ * @brief Checks if the received part of a frame is sufficient to determine the pending bit.
+ *
+ * The pending bit of an ACK can be determined before the whole frame is received, once
+ * the fields used by the source address matching method are available.
+ *
+ * @param[in]  p_frame_data  Pointer to the frame parser data for which the ACK frame is being prepared.
+ *
+ * @retval true   @ref nrf_802154_ack_data_pending_bit_should_be_set can be called for the frame.
+ * @retval false  More of the frame must be received first.
+ */
+bool nrf_802154_ack_data_pending_bit_is_resolvable(
+    const nrf_802154_frame_parser_data_t * p_frame_data);
+
 /**
  * @brief Checks if a pending bit is to be set in the ACK frame sent in response to a given frame.
  *
@@ -145,4 +204,14 @@ const uint8_t * nrf_802154_ack_data_ie_get(const uint8_t * p_src_addr,
                                            bool            src_addr_ext,
                                            uint8_t       * p_ie_length);
 
+/**
+ * @brief Gets the generation of the IE data stored in the list.
+ *
+ * The generation changes every time IE data is added, modified or removed. It allows other
+ * modules to detect that the IE data they cached may be outdated.
+ *
+ * @returns  Current generation of the IE data.
+ */
+uint32_t nrf_802154_ack_data_ie_generation_get(void);
+
 #endif // NRF_802154_ACK_DATA_H
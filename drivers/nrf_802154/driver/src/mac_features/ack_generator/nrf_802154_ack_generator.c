@@ -42,9 +42,11 @@
 
 #include <assert.h>
 
+#include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
 #include "nrf_802154_enh_ack_generator.h"
 #include "nrf_802154_imm_ack_generator.h"
+#include "nrf_802154_profiler.h"
 
 typedef enum
 {
@@ -84,20 +86,31 @@ void nrf_802154_ack_generator_reset(void)
     nrf_802154_enh_ack_generator_reset();
 }
 
-uint8_t * nrf_802154_ack_generator_create(const nrf_802154_frame_parser_data_t * p_frame_data)
+NRF_802154_HOT_FUNC uint8_t * nrf_802154_ack_generator_create(
+    const nrf_802154_frame_parser_data_t * p_frame_data)
 {
+    uint32_t  profile_start = nrf_802154_profiler_begin();
+    uint8_t * p_ack;
+
     // This function should not be called if ACK is not requested.
     assert(nrf_802154_frame_parser_ar_bit_is_set(p_frame_data));
 
     switch (frame_version_is_2015_or_above(p_frame_data))
     {
         case FRAME_VERSION_BELOW_2015:
-            return nrf_802154_imm_ack_generator_create(p_frame_data);
+            p_ack = nrf_802154_imm_ack_generator_create(p_frame_data);
+            break;
 
         case FRAME_VERSION_2015_OR_ABOVE:
-            return nrf_802154_enh_ack_generator_create(p_frame_data);
+            p_ack = nrf_802154_enh_ack_generator_create(p_frame_data);
+            break;
 
         default:
-            return NULL;
+            p_ack = NULL;
+            break;
     }
+
+    nrf_802154_profiler_end(NRF_802154_PROFILE_POINT_ACK_GENERATE, profile_start);
+
+    return p_ack;
 }
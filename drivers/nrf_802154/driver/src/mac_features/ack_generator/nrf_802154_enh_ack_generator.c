@@ -48,12 +48,39 @@
 #include "mac_features/nrf_802154_security_pib.h"
 #include "nrf_802154_ack_data.h"
 #include "nrf_802154_encrypt.h"
+#include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
 #include "nrf_802154_pib.h"
 #include "nrf_802154_utils_byteorder.h"
 
 #define ENH_ACK_MAX_SIZE MAX_PACKET_SIZE
 
+#if NRF_802154_ENH_ACK_TEMPLATES_ENABLED
+
+/** Maximum size of the header of a received frame that can be matched against a template.
+ *  It covers the Frame Control, the Sequence Number, the largest addressing fields
+ *  and the largest auxiliary security header.
+ */
+#define ENH_ACK_TEMPLATE_KEY_MAX_SIZE \
+    (FCF_SIZE + DSN_SIZE + 2 * PAN_ID_SIZE + 2 * EXTENDED_ADDRESS_SIZE + \
+     SECURITY_CONTROL_SIZE + FRAME_COUNTER_SIZE + KEY_ID_MODE_3_SIZE)
+
+/** Ready-made Enh-Ack responding to frames with a given header. */
+typedef struct
+{
+    bool                           valid;                              ///< If the template can be used.
+    uint32_t                       ie_generation;                      ///< Generation of the IE data the template was built with.
+    uint32_t                       key_generation;                     ///< Generation of the Key Storage the template was built with.
+    uint8_t                        key_len;                            ///< Length of @ref key.
+    uint8_t                        key[ENH_ACK_TEMPLATE_KEY_MAX_SIZE]; ///< Header of the frame, with its sequence number and frame counter cleared.
+    uint8_t                        pan_id[PAN_ID_SIZE];                ///< PAN ID the template was built with.
+    bool                           ie_present;                         ///< If the ACK contains IE data.
+    uint8_t                        ack[ENH_ACK_MAX_SIZE + PHR_SIZE];   ///< The ACK frame.
+    nrf_802154_frame_parser_data_t ack_data;                           ///< Parser data of the ACK frame.
+} enh_ack_template_t;
+
+#endif // NRF_802154_ENH_ACK_TEMPLATES_ENABLED
+
 typedef enum
 {
     ACK_STATE_RESET,
@@ -69,6 +96,11 @@ static nrf_802154_frame_parser_data_t m_ack_data;
 static const uint8_t                * mp_ie_data;
 static uint8_t                        m_ie_data_len;
 
+#if NRF_802154_ENH_ACK_TEMPLATES_ENABLED
+static enh_ack_template_t m_templates[NRF_802154_ENH_ACK_TEMPLATES_COUNT];
+static uint8_t            m_template_next; ///< Index of the template to be replaced next.
+#endif
+
 static void ack_state_set(ack_state_t state_to_set)
 {
     m_ack_state = state_to_set;
@@ -410,10 +442,6 @@ static void ie_header_set(const uint8_t                  * p_ie_data,
     assert(p_ack_ie != NULL);
 
     memcpy(p_ack_ie, p_ie_data, ie_data_len);
-
-#if NRF_802154_IE_WRITER_ENABLED
-    nrf_802154_ie_writer_prepare(p_ack_ie, p_ack_ie + ie_data_len);
-#endif
 }
 
 static uint8_t ie_header_terminate(const uint8_t                  * p_ie_data,
@@ -470,6 +498,148 @@ static bool encryption_prepare(const nrf_802154_frame_parser_data_t * p_ack_data
 #endif  // NRF_802154_ENCRYPTION_ENABLED
 }
 
+/***************************************************************************************************
+ * @section Enhanced ACK templates
+ **************************************************************************************************/
+
+#if NRF_802154_ENH_ACK_TEMPLATES_ENABLED
+
+/**
+ * @brief Gets the header of a received frame that identifies the ACK to be sent in response.
+ *
+ * The header spans from the Frame Control field to the end of the auxiliary security header.
+ * The sequence number and the frame counter are cleared, as these are patched in the template.
+ *
+ * @param[in]  p_frame_data  Pointer to the frame parser data of the received frame.
+ * @param[out] p_key         Buffer of @ref ENH_ACK_TEMPLATE_KEY_MAX_SIZE bytes to be filled with
+ *                           the header.
+ *
+ * @returns  Length of the header or 0 if templates cannot be used for the frame.
+ */
+static uint8_t template_key_get(const nrf_802154_frame_parser_data_t * p_frame_data,
+                                uint8_t                              * p_key)
+{
+    uint8_t         key_len         = p_frame_data->helper.aux_sec_hdr_end_offset - PHR_SIZE;
+    const uint8_t * p_dsn           = nrf_802154_frame_parser_dsn_get(p_frame_data);
+    const uint8_t * p_frame_counter = nrf_802154_frame_parser_frame_counter_get(p_frame_data);
+
+    if (key_len > ENH_ACK_TEMPLATE_KEY_MAX_SIZE)
+    {
+        return 0U;
+    }
+
+    if (nrf_802154_frame_parser_security_enabled_bit_is_set(p_frame_data) &&
+        (nrf_802154_frame_parser_sec_ctrl_sec_lvl_get(p_frame_data) == SECURITY_LEVEL_NONE))
+    {
+        // The ACK copies the whole auxiliary security header of such frame. Do not cache it.
+        return 0U;
+    }
+
+    memcpy(p_key, &p_frame_data->p_frame[PHR_SIZE], key_len);
+
+    if (p_dsn != NULL)
+    {
+        p_key[p_dsn - p_frame_data->p_frame - PHR_SIZE] = 0U;
+    }
+
+    if (p_frame_counter != NULL)
+    {
+        memset(&p_key[p_frame_counter - p_frame_data->p_frame - PHR_SIZE], 0U, FRAME_COUNTER_SIZE);
+    }
+
+    return key_len;
+}
+
+/**
+ * @brief Finds a valid template matching the given header of a received frame.
+ *
+ * @param[in]  p_key    Header of the frame returned by @ref template_key_get.
+ * @param[in]  key_len  Length of the header.
+ *
+ * @returns  Pointer to the template or NULL if there is none.
+ */
+static const enh_ack_template_t * template_find(const uint8_t * p_key, uint8_t key_len)
+{
+    uint32_t ie_generation  = nrf_802154_ack_data_ie_generation_get();
+    uint32_t key_generation = nrf_802154_security_pib_key_generation_get();
+
+    for (uint32_t i = 0U; i < NRF_802154_ENH_ACK_TEMPLATES_COUNT; i++)
+    {
+        const enh_ack_template_t * p_template = &m_templates[i];
+
+        if (p_template->valid &&
+            (p_template->key_len == key_len) &&
+            (p_template->ie_generation == ie_generation) &&
+            (p_template->key_generation == key_generation) &&
+            (memcmp(p_template->key, p_key, key_len) == 0) &&
+            (memcmp(p_template->pan_id, nrf_802154_pib_pan_id_get(), PAN_ID_SIZE) == 0))
+        {
+            return p_template;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Prepares the ACK from a template.
+ *
+ * @param[in]  p_template    Pointer to the template.
+ * @param[in]  p_frame_data  Pointer to the frame parser data of the received frame.
+ *
+ * @retval true   The ACK was prepared.
+ * @retval false  The ACK cannot be created.
+ */
+static bool template_apply(const enh_ack_template_t           * p_template,
+                           const nrf_802154_frame_parser_data_t * p_frame_data)
+{
+    uint8_t fc_bytes_written;
+
+    memcpy(m_ack, p_template->ack, p_template->ack[PHR_OFFSET] + PHR_SIZE);
+    m_ack_data = p_template->ack_data;
+
+    (void)sequence_number_set(p_frame_data);
+
+    if (!frame_counter_set(&m_ack_data, &fc_bytes_written))
+    {
+        return false;
+    }
+
+#if NRF_802154_IE_WRITER_ENABLED
+    if (p_template->ie_present)
+    {
+        nrf_802154_ie_writer_frame_prepare(&m_ack_data);
+    }
+#endif
+
+    return true;
+}
+
+/**
+ * @brief Stores the ACK prepared for a received frame as a template.
+ *
+ * @param[in]  p_key    Header of the frame returned by @ref template_key_get.
+ * @param[in]  key_len  Length of the header.
+ */
+static void template_store(const uint8_t * p_key, uint8_t key_len)
+{
+    enh_ack_template_t * p_template = &m_templates[m_template_next];
+
+    m_template_next = (m_template_next + 1U) % NRF_802154_ENH_ACK_TEMPLATES_COUNT;
+
+    memcpy(p_template->key, p_key, key_len);
+    memcpy(p_template->pan_id, nrf_802154_pib_pan_id_get(), PAN_ID_SIZE);
+    memcpy(p_template->ack, m_ack, m_ack[PHR_OFFSET] + PHR_SIZE);
+    p_template->key_len        = key_len;
+    p_template->ack_data       = m_ack_data;
+    p_template->ie_present     = (mp_ie_data != NULL);
+    p_template->ie_generation  = nrf_802154_ack_data_ie_generation_get();
+    p_template->key_generation = nrf_802154_security_pib_key_generation_get();
+    p_template->valid          = true;
+}
+
+#endif // NRF_802154_ENH_ACK_TEMPLATES_ENABLED
+
 /***************************************************************************************************
  * @section Enhanced ACK generation
  **************************************************************************************************/
@@ -552,6 +722,13 @@ static void ie_process(const nrf_802154_frame_parser_data_t * p_frame_data)
 
     assert(result);
     (void)result;
+
+#if NRF_802154_IE_WRITER_ENABLED
+    if (mp_ie_data != NULL)
+    {
+        nrf_802154_ie_writer_frame_prepare(&m_ack_data);
+    }
+#endif
 }
 
 static bool encryption_process(void)
@@ -570,6 +747,50 @@ static uint8_t * ack_process(
 
     *p_processing_done = false;
 
+#if NRF_802154_ENH_ACK_TEMPLATES_ENABLED
+    if ((frame_parse_level >= PARSE_LEVEL_AUX_SEC_HDR_END) &&
+        (ack_parse_level < PARSE_LEVEL_AUX_SEC_HDR_END))
+    {
+        uint8_t                    key[ENH_ACK_TEMPLATE_KEY_MAX_SIZE];
+        uint8_t                    key_len    = template_key_get(p_frame_data, key);
+        const enh_ack_template_t * p_template = (key_len != 0U) ? template_find(key, key_len) :
+                                                NULL;
+
+        if (p_template != NULL)
+        {
+            if (!template_apply(p_template, p_frame_data))
+            {
+                // Failure to set the frame counter, the ACK cannot be created. Exit immediately
+                *p_processing_done = true;
+                return NULL;
+            }
+        }
+        else
+        {
+            fcf_process(p_frame_data);
+            addr_end_process(p_frame_data);
+
+            if (!aux_sec_hdr_process(p_frame_data))
+            {
+                // Failure to set auxiliary security header, the ACK cannot be created. Exit immediately
+                *p_processing_done = true;
+                return NULL;
+            }
+
+            ie_process(p_frame_data);
+
+            if (key_len != 0U)
+            {
+                template_store(key, key_len);
+            }
+        }
+    }
+    else
+    {
+        // The ACK is prepared from a template or built at once when the auxiliary security header
+        // of the frame is known.
+    }
+#else // NRF_802154_ENH_ACK_TEMPLATES_ENABLED
     if ((frame_parse_level >= PARSE_LEVEL_FCF_OFFSETS) &&
         (ack_parse_level < PARSE_LEVEL_FCF_OFFSETS))
     {
@@ -594,6 +815,7 @@ static uint8_t * ack_process(
 
         ie_process(p_frame_data);
     }
+#endif // NRF_802154_ENH_ACK_TEMPLATES_ENABLED
 
     if (frame_parse_level == PARSE_LEVEL_FULL)
     {
@@ -624,7 +846,10 @@ static uint8_t * ack_process(
 
 void nrf_802154_enh_ack_generator_init(void)
 {
-    // Intentionally empty.
+#if NRF_802154_ENH_ACK_TEMPLATES_ENABLED
+    memset(m_templates, 0U, sizeof(m_templates));
+    m_template_next = 0U;
+#endif
 }
 
 void nrf_802154_enh_ack_generator_reset(void)
@@ -636,7 +861,7 @@ void nrf_802154_enh_ack_generator_reset(void)
     m_ack_state   = ACK_STATE_RESET;
 }
 
-uint8_t * nrf_802154_enh_ack_generator_create(
+NRF_802154_HOT_FUNC uint8_t * nrf_802154_enh_ack_generator_create(
     const nrf_802154_frame_parser_data_t * p_frame_data)
 {
     switch (ack_state_get())
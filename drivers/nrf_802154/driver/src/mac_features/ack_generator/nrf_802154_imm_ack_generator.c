@@ -44,11 +44,13 @@
 #include <string.h>
 
 #include "nrf_802154_ack_data.h"
+#include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
 
 #define IMM_ACK_INITIALIZER {IMM_ACK_LENGTH, ACK_HEADER_WITH_PENDING, 0x00, 0x00, 0x00, 0x00}
 
 static uint8_t m_ack_data[IMM_ACK_LENGTH + PHR_SIZE];
+static bool    m_pending_bit_resolved; ///< If the pending bit of the ACK is already set for the frame being received.
 
 void nrf_802154_imm_ack_generator_init(void)
 {
@@ -59,18 +61,12 @@ void nrf_802154_imm_ack_generator_init(void)
 
 void nrf_802154_imm_ack_generator_reset(void)
 {
-    // Intentionally empty
+    m_pending_bit_resolved = false;
 }
 
-uint8_t * nrf_802154_imm_ack_generator_create(
+NRF_802154_HOT_FUNC uint8_t * nrf_802154_imm_ack_generator_create(
     const nrf_802154_frame_parser_data_t * p_frame_data)
 {
-    if (nrf_802154_frame_parser_parse_level_get(p_frame_data) < PARSE_LEVEL_FULL)
-    {
-        // The entire frame being acknowledged is necessary to correctly generate Ack
-        return NULL;
-    }
-
     const uint8_t * frame_dsn = nrf_802154_frame_parser_dsn_get(p_frame_data);
 
     if (frame_dsn == NULL)
@@ -81,15 +77,29 @@ uint8_t * nrf_802154_imm_ack_generator_create(
     // Set valid sequence number in ACK frame.
     m_ack_data[DSN_OFFSET] = *frame_dsn;
 
-    // Set pending bit in ACK frame.
-    if (nrf_802154_ack_data_pending_bit_should_be_set(p_frame_data))
+    // Set pending bit in ACK frame as soon as the received part of the frame allows, so that
+    // the address lookup does not delay the ACK once the frame is complete.
+    if (!m_pending_bit_resolved && nrf_802154_ack_data_pending_bit_is_resolvable(p_frame_data))
     {
-        m_ack_data[FRAME_PENDING_OFFSET] = ACK_HEADER_WITH_PENDING;
+        if (nrf_802154_ack_data_pending_bit_should_be_set(p_frame_data))
+        {
+            m_ack_data[FRAME_PENDING_OFFSET] = ACK_HEADER_WITH_PENDING;
+        }
+        else
+        {
+            m_ack_data[FRAME_PENDING_OFFSET] = ACK_HEADER_WITHOUT_PENDING;
+        }
+
+        m_pending_bit_resolved = true;
     }
-    else
+
+    if (nrf_802154_frame_parser_parse_level_get(p_frame_data) < PARSE_LEVEL_FULL)
     {
-        m_ack_data[FRAME_PENDING_OFFSET] = ACK_HEADER_WITHOUT_PENDING;
+        // The entire frame being acknowledged is necessary to correctly generate Ack
+        return NULL;
     }
 
+    assert(m_pending_bit_resolved);
+
     return m_ack_data;
 }
@@ -66,6 +66,16 @@ void nrf_802154_ack_timeout_deinit(void);
  */
 void nrf_802154_ack_timeout_time_set(uint32_t time);
 
+/**
+ * @brief Gets the ACK waiting window to be enforced by hardware.
+ *
+ * The window is measured from the end of the transmitted frame, i.e. from the moment the receiver
+ * ramp-up for ACK is triggered.
+ *
+ * @return  Length of the ACK waiting window in microseconds.
+ */
+uint32_t nrf_802154_ack_timeout_hw_window_get(void);
+
 /**
  * @brief Aborts a started ACK timeout procedure.
  *
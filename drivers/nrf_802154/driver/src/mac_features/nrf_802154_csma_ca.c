@@ -51,6 +51,7 @@
 
 #include "nrf_802154_const.h"
 #include "nrf_802154_debug.h"
+#include "nrf_802154_frame_parser.h"
 #include "nrf_802154_notification.h"
 #include "nrf_802154_pib.h"
 #include "nrf_802154_request.h"
@@ -72,6 +73,27 @@ typedef enum
     CSMA_CA_STATE_ABORTED                                 ///< The CSMA-CA procedure is being aborted.
 } csma_ca_state_t;
 
+#define CONGESTION_RATE_WEIGHT_SHIFT 3U                   ///< Weight of a single CCA attempt in the congestion rate, as a power of 2 divisor.
+
+#if NRF_802154_CSMA_CA_ADAPTIVE_BACKOFF_ENABLED
+
+#define CONGESTION_DST_NONE          NRF_802154_FRAME_PARSER_DST_KEY_NONE ///< Destination key of frames without a unicast destination address.
+
+/**
+ * @brief Congestion rate towards a destination.
+ */
+typedef struct
+{
+    uint64_t key;  ///< Key identifying the destination, or @ref CONGESTION_DST_NONE if the entry is free.
+    uint32_t rate; ///< Recent rate of failed CCA attempts towards the destination.
+} congestion_dst_t;
+
+static congestion_dst_t m_congestion_dst[NRF_802154_CSMA_CA_ADAPTIVE_BACKOFF_DST_COUNT]; ///< Congestion rates of recent destinations.
+static uint8_t          m_congestion_dst_next;                                          ///< Index of the entry to be replaced by a new destination.
+static uint64_t         m_dst_key;                                                      ///< Key of the destination of the frame being transmitted.
+
+#endif // NRF_802154_CSMA_CA_ADAPTIVE_BACKOFF_ENABLED
+
 static uint8_t m_nb;                                      ///< The number of times the CSMA-CA algorithm was required to back off while attempting the current transmission.
 static uint8_t m_be;                                      ///< Backoff exponent, which is related to how many backoff periods a device shall wait before attempting to assess a channel.
 
@@ -79,6 +101,11 @@ static uint8_t                            * mp_data;      ///< Pointer to a buff
 static nrf_802154_transmitted_frame_props_t m_data_props; ///< Structure containing detailed properties of data in buffer.
 static nrf_802154_fal_tx_power_split_t      m_tx_power;   ///< Power to be used when transmitting the frame split into components.
 static csma_ca_state_t                      m_state;      ///< The current state of the CSMA-CA procedure.
+static uint8_t                              m_channel;    ///< Channel on which the frame is being transmitted.
+
+static uint8_t * mp_retx_data;        ///< Pointer to the transmitted frame that may still be retransmitted, NULL if there is none.
+static uint8_t   m_max_frame_retries; ///< Maximum number of retransmissions of the frame.
+static uint8_t   m_retries;           ///< Number of retransmissions of the frame performed so far.
 
 /**
  * @brief Perform appropriate actions for busy channel conditions.
@@ -143,6 +170,12 @@ static void notify_failed(nrf_802154_tx_error_t error)
     nrf_802154_transmit_done_metadata_t metadata = {};
 
     metadata.frame_props = m_data_props;
+    metadata.retries     = m_retries;
+
+    if (mp_retx_data == mp_data)
+    {
+        mp_retx_data = NULL;
+    }
 
     nrf_802154_notify_transmit_failed(mp_data, error, &metadata);
 }
@@ -214,6 +247,139 @@ static void frame_transmit(rsch_dly_ts_id_t dly_ts_id)
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
+/**
+ * @brief Updates a congestion rate with the outcome of a CCA attempt.
+ *
+ * @param[in]  rate  Congestion rate to be updated.
+ * @param[in]  busy  If the CCA attempt failed.
+ *
+ * @return Updated congestion rate.
+ */
+static uint32_t congestion_rate_update(uint32_t rate, bool busy)
+{
+    uint32_t sample = busy ? NRF_802154_STAT_CONGESTION_RATE_MAX : 0U;
+
+    return rate - (rate >> CONGESTION_RATE_WEIGHT_SHIFT) + (sample >> CONGESTION_RATE_WEIGHT_SHIFT);
+}
+
+#if NRF_802154_CSMA_CA_ADAPTIVE_BACKOFF_ENABLED
+
+/**
+ * @brief Gets the key identifying the destination of a frame.
+ *
+ * @param[in]  p_frame  Pointer to a buffer containing PHR and PSDU of the frame.
+ *
+ * @return Key of the destination or @ref CONGESTION_DST_NONE if the frame is not unicast.
+ */
+static uint64_t congestion_dst_key_get(const uint8_t * p_frame)
+{
+    nrf_802154_frame_parser_data_t frame_data;
+
+    bool result = nrf_802154_frame_parser_data_init(p_frame,
+                                                    p_frame[PHR_OFFSET] + PHR_SIZE,
+                                                    PARSE_LEVEL_ADDRESSING_END,
+                                                    &frame_data);
+
+    return result ? nrf_802154_frame_parser_dst_key_get(&frame_data) : CONGESTION_DST_NONE;
+}
+
+/**
+ * @brief Gets the congestion entry of a destination.
+ *
+ * @param[in]  key     Key of the destination.
+ * @param[in]  create  If an entry is to be created when the destination is not tracked yet.
+ *
+ * @return Pointer to the entry or NULL if there is no entry.
+ */
+static congestion_dst_t * congestion_dst_get(uint64_t key, bool create)
+{
+    if (key == CONGESTION_DST_NONE)
+    {
+        return NULL;
+    }
+
+    for (uint32_t i = 0; i < NRF_802154_CSMA_CA_ADAPTIVE_BACKOFF_DST_COUNT; i++)
+    {
+        if (m_congestion_dst[i].key == key)
+        {
+            return &m_congestion_dst[i];
+        }
+    }
+
+    if (!create)
+    {
+        return NULL;
+    }
+
+    congestion_dst_t * p_entry = &m_congestion_dst[m_congestion_dst_next];
+
+    m_congestion_dst_next = (m_congestion_dst_next + 1U) %
+                            NRF_802154_CSMA_CA_ADAPTIVE_BACKOFF_DST_COUNT;
+
+    p_entry->key  = key;
+    p_entry->rate = 0U;
+
+    return p_entry;
+}
+
+#endif // NRF_802154_CSMA_CA_ADAPTIVE_BACKOFF_ENABLED
+
+/**
+ * @brief Records the outcome of a CCA attempt of the frame being transmitted.
+ *
+ * @param[in]  busy  If the CCA attempt failed.
+ */
+static void congestion_record(bool busy)
+{
+    uint32_t rate;
+
+    nrf_802154_stat_congestion_rate_read(&rate, m_channel);
+    nrf_802154_stat_congestion_rate_write(m_channel, congestion_rate_update(rate, busy));
+
+#if NRF_802154_CSMA_CA_ADAPTIVE_BACKOFF_ENABLED
+    congestion_dst_t * p_entry = congestion_dst_get(m_dst_key, true);
+
+    if (p_entry != NULL)
+    {
+        p_entry->rate = congestion_rate_update(p_entry->rate, busy);
+    }
+#endif
+}
+
+/**
+ * @brief Gets the backoff exponent for the first backoff of the frame being transmitted.
+ *
+ * @return Initial backoff exponent.
+ */
+static uint8_t initial_be_get(void)
+{
+    uint8_t be = nrf_802154_pib_csmaca_min_be_get();
+
+#if NRF_802154_CSMA_CA_ADAPTIVE_BACKOFF_ENABLED
+    uint8_t            max_be  = nrf_802154_pib_csmaca_max_be_get();
+    congestion_dst_t * p_entry = congestion_dst_get(m_dst_key, false);
+    uint32_t           rate;
+
+    nrf_802154_stat_congestion_rate_read(&rate, m_channel);
+
+    if ((p_entry != NULL) && (p_entry->rate > rate))
+    {
+        rate = p_entry->rate;
+    }
+
+    if (max_be > be)
+    {
+        uint32_t be_range = max_be - be;
+
+        // Round to the nearest backoff exponent.
+        be += (uint8_t)(((be_range * rate) + (NRF_802154_STAT_CONGESTION_RATE_MAX / 2U)) /
+                        NRF_802154_STAT_CONGESTION_RATE_MAX);
+    }
+#endif
+
+    return be;
+}
+
 /**
  * @brief Calculates number of backoff periods as random value according to IEEE Std. 802.15.4.
  */
@@ -327,6 +493,8 @@ static bool channel_busy(void)
 
         if (m_nb > nrf_802154_pib_csmaca_max_backoffs_get())
         {
+            nrf_802154_stat_window_csma_ca_record(m_nb);
+
             mp_data = NULL;
             bool ret = csma_ca_state_set(CSMA_CA_STATE_BACKOFF, CSMA_CA_STATE_IDLE);
 
@@ -344,6 +512,49 @@ static bool channel_busy(void)
     return result;
 }
 
+/**
+ * @brief Starts a new CSMA-CA procedure for the frame pointed by @ref mp_data.
+ */
+static void procedure_start(void)
+{
+    m_nb = 0;
+    m_be = initial_be_get();
+
+    random_backoff_start();
+}
+
+/**
+ * @brief Retransmits the frame whose transmission attempt was not acknowledged.
+ *
+ * @param[in]  p_frame_props  Properties of the frame after the failed attempt.
+ *
+ * @retval true   The retransmission is started.
+ * @retval false  The frame cannot be retransmitted.
+ */
+static bool retransmission_start(const nrf_802154_transmitted_frame_props_t * p_frame_props)
+{
+    if (m_retries >= m_max_frame_retries)
+    {
+        return false;
+    }
+
+    if (!csma_ca_state_set(CSMA_CA_STATE_IDLE, CSMA_CA_STATE_BACKOFF))
+    {
+        return false;
+    }
+
+    m_retries++;
+
+    // The frame has been already secured and its frame counter has been set. The retransmission
+    // sends it as it is.
+    mp_data      = mp_retx_data;
+    m_data_props = *p_frame_props;
+
+    procedure_start();
+
+    return true;
+}
+
 bool nrf_802154_csma_ca_start(uint8_t                                      * p_data,
                               const nrf_802154_transmit_csma_ca_metadata_t * p_metadata)
 {
@@ -362,13 +573,19 @@ bool nrf_802154_csma_ca_start(uint8_t                                      * p_d
 
     mp_data      = p_data;
     m_data_props = p_metadata->frame_props;
-    m_nb         = 0;
-    m_be         = nrf_802154_pib_csmaca_min_be_get();
+    m_channel    = nrf_802154_pib_channel_get();
+#if NRF_802154_CSMA_CA_ADAPTIVE_BACKOFF_ENABLED
+    m_dst_key = congestion_dst_key_get(p_data);
+#endif
+    mp_retx_data        = p_data;
+    m_max_frame_retries = p_metadata->max_frame_retries;
+    m_retries           = 0;
     (void)nrf_802154_tx_power_convert_metadata_to_tx_power_split(nrf_802154_pib_channel_get(),
                                                                  p_metadata->tx_power,
+                                                                 p_data,
                                                                  &m_tx_power);
 
-    random_backoff_start();
+    procedure_start();
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 
@@ -445,6 +662,11 @@ bool nrf_802154_csma_ca_tx_failed_hook(uint8_t * p_frame, nrf_802154_tx_error_t
             }
             else if (p_frame == mp_data)
             {
+                if (error == NRF_802154_TX_ERROR_BUSY_CHANNEL)
+                {
+                    congestion_record(true);
+                }
+
                 // The procedure is active and transmission attempt failed. Try again
                 result = channel_busy();
             }
@@ -466,6 +688,9 @@ bool nrf_802154_csma_ca_tx_started_hook(uint8_t * p_frame)
 
     if (mp_data == p_frame)
     {
+        congestion_record(false);
+        nrf_802154_stat_window_csma_ca_record(m_nb);
+
         mp_data = NULL;
         nrf_802154_sl_atomic_store_u8(&m_state, CSMA_CA_STATE_IDLE);
     }
@@ -474,4 +699,33 @@ bool nrf_802154_csma_ca_tx_started_hook(uint8_t * p_frame)
     return true;
 }
 
+bool nrf_802154_csma_ca_tx_outcome_hook(uint8_t                             * p_frame,
+                                        nrf_802154_tx_error_t                 error,
+                                        nrf_802154_transmit_done_metadata_t * p_meta)
+{
+    bool result = true;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    if ((p_frame == mp_retx_data) && (p_frame != NULL))
+    {
+        bool not_acked = (error == NRF_802154_TX_ERROR_NO_ACK) ||
+                         (error == NRF_802154_TX_ERROR_INVALID_ACK);
+
+        if (not_acked && retransmission_start(&p_meta->frame_props))
+        {
+            result = false;
+        }
+        else
+        {
+            p_meta->retries = m_retries;
+            mp_retx_data    = NULL;
+        }
+    }
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+
+    return result;
+}
+
 #endif // NRF_802154_CSMA_CA_ENABLED
@@ -111,6 +111,27 @@ bool nrf_802154_csma_ca_tx_failed_hook(uint8_t * p_frame, nrf_802154_tx_error_t
  */
 bool nrf_802154_csma_ca_tx_started_hook(uint8_t * p_frame);
 
+/**
+ * @brief Handles the final outcome of a transmission attempt.
+ *
+ * If the frame was transmitted by the CSMA-CA procedure and the attempt was not acknowledged,
+ * the frame is retransmitted after a new CSMA-CA procedure, unless the maximum number of frame
+ * retries has been reached. Otherwise the number of performed retransmissions is written to
+ * @p p_meta.
+ *
+ * @param[in]     p_frame  Pointer to a buffer that contains PHR and PSDU of the frame.
+ * @param[in]     error    Cause of the failed transmission or @ref NRF_802154_TX_ERROR_NONE
+ *                         if the frame was transmitted successfully.
+ * @param[inout]  p_meta   Pointer to the metadata of the outcome to be notified.
+ *
+ * @retval  true   The outcome is to be propagated to the MAC layer.
+ * @retval  false  The outcome is not to be propagated to the MAC layer, because the frame is
+ *                 being retransmitted.
+ */
+bool nrf_802154_csma_ca_tx_outcome_hook(uint8_t                             * p_frame,
+                                        nrf_802154_tx_error_t                 error,
+                                        nrf_802154_transmit_done_metadata_t * p_meta);
+
 /**
  *@}
  **/
@@ -55,12 +55,15 @@
 #include "nrf_802154_procedures_duration.h"
 #include "nrf_802154_queue.h"
 #include "nrf_802154_request.h"
+#include "nrf_802154_stats.h"
 #include "nrf_802154_utils.h"
 #include "nrf_802154_tx_power.h"
 #include "rsch/nrf_802154_rsch.h"
 #include "nrf_802154_sl_timer.h"
 #include "nrf_802154_sl_utils.h"
 #include "nrf_802154_sl_atomics.h"
+#include "nrf_802154_tsch_engine.h"
+#include "../nrf_802154_core_hooks.h"
 
 #ifdef NRF_802154_USE_INTERNAL_INCLUDES
 #include "nrf_802154_delayed_trx_internal.h"
@@ -76,6 +79,16 @@
 #define RX_SETUP_TIME_MAX 290u ///< Maximum time needed to prepare RX procedure [us]. It does not include RX ramp-up time.
 #endif
 
+/** @brief Time between the start of a delayed TX timeslot and the radio trigger [us]. */
+#define TX_PPI_TRIGGER_DLY (TX_SETUP_TIME_MAX + NRF_802154_DELAYED_TRX_COEX_LEAD_TIME_US)
+/** @brief Time between the start of a delayed RX timeslot and the radio trigger [us]. */
+#define RX_PPI_TRIGGER_DLY (RX_SETUP_TIME_MAX + NRF_802154_DELAYED_TRX_COEX_LEAD_TIME_US)
+
+#define DRX_PERIODIC_INFINITE UINT32_MAX ///< Number of remaining windows of a periodic RX delayed operation repeated until cancelled.
+
+/** @brief Time between requesting the timeslot of a duty-cycled RX window and its start [us]. */
+#define DRX_DUTY_CYCLE_PRESTART_TIME NRF_802154_DELAYED_TRX_RX_DUTY_CYCLE_PRESTART_US
+
 /**
  * @brief States of delayed operations.
  */
@@ -105,6 +118,12 @@ typedef struct
     nrf_802154_sl_timer_t            timeout_timer;   ///< Timer for delayed RX timeout handling.
     uint32_t                         timeout_length;  ///< Requested length [us] of RX window plus RX_RAMP_UP_TIME.
     volatile delayed_rx_frame_data_t extension_frame; ///< Data of frame that caused extension of RX window.
+    uint64_t                         trigger_time;    ///< Time at which the delayed timeslot of the current RX window is triggered.
+    uint32_t                         period;          ///< Period [us] of RX windows or 0 if the delayed reception is not periodic.
+    uint32_t                         remaining;       ///< Number of RX windows left after the current one or @ref DRX_PERIODIC_INFINITE.
+    nrf_802154_sl_timer_t            prestart_timer;  ///< Timer requesting the delayed timeslot of the next window of a duty-cycled RX delayed operation.
+    uint32_t                         extension;       ///< Time [us] for which a window is kept open after the end of a frame received in it.
+    bool                             duty_cycled;     ///< Flag indicating if the radio sleeps between the windows of the RX delayed operation.
     uint8_t                          channel;         ///< Channel number on which reception should be performed.
 } dly_rx_data_t;
 
@@ -113,9 +132,10 @@ typedef struct
  */
 typedef struct
 {
-    uint8_t                    * p_data;  ///< Pointer to a buffer containing PHR and PSDU of the frame requested to be transmitted.
-    nrf_802154_transmit_params_t params;  ///< Transmission parameters.
-    uint8_t                      channel; ///< Channel number on which transmission should be performed.
+    uint8_t                    * p_data;       ///< Pointer to a buffer containing PHR and PSDU of the frame requested to be transmitted.
+    nrf_802154_transmit_params_t params;       ///< Transmission parameters.
+    uint64_t                     trigger_time; ///< Time at which the delayed timeslot of the transmission is to be triggered.
+    uint8_t                      channel;      ///< Channel number on which transmission should be performed.
 } dly_tx_data_t;
 
 /**
@@ -142,7 +162,25 @@ static dly_op_data_t m_dly_rx_data[NRF_802154_RSCH_DLY_TS_OP_DRX_SLOTS];
 /**
  * @brief Array of slots for TX delayed operations.
  */
-static dly_op_data_t m_dly_tx_data[NRF_802154_RSCH_DLY_TS_OP_DTX_SLOTS];
+static dly_op_data_t m_dly_tx_data[NRF_802154_DELAYED_TRX_TX_QUEUE_SIZE];
+
+/**
+ * @brief Min-heap of scheduled TX delayed operations ordered by trigger time.
+ *
+ * The heap holds the operations waiting for their turn to request the delayed timeslot. It does
+ * not contain @ref mp_dly_tx_armed.
+ */
+static dly_op_data_t * m_dly_tx_heap[NRF_802154_DELAYED_TRX_TX_QUEUE_SIZE];
+
+/**
+ * @brief Number of TX delayed operations stored in @ref m_dly_tx_heap.
+ */
+static uint32_t m_dly_tx_heap_len;
+
+/**
+ * @brief TX delayed operation that currently holds the delayed timeslot.
+ */
+static dly_op_data_t * volatile mp_dly_tx_armed;
 
 /**
  * @brief Queue of RX delayed operations IDs to be processed.
@@ -246,15 +284,107 @@ static bool dly_op_state_set(dly_op_data_t        * p_dly_op_data,
  */
 static dly_op_data_t * dly_tx_data_by_id_search(rsch_dly_ts_id_t id)
 {
-    // Note that this function only supports a single slot.
-    if (id == m_dly_tx_data[0].id)
+    // Only the armed TX delayed operation has an identifier assigned.
+    dly_op_data_t * p_dly_op_data = mp_dly_tx_armed;
+
+    if ((p_dly_op_data != NULL) && (id == p_dly_op_data->id))
     {
-        return &m_dly_tx_data[0];
+        return p_dly_op_data;
     }
 
     return NULL;
 }
 
+/**
+ * @brief Check if a TX delayed operation is to be triggered before another one.
+ *
+ * @param[in]  p_first   First TX delayed operation.
+ * @param[in]  p_second  Second TX delayed operation.
+ *
+ * @retval true   @p p_first is to be triggered before @p p_second.
+ * @retval false  @p p_first is to be triggered at the same time or after @p p_second.
+ */
+static bool dly_tx_is_before(const dly_op_data_t * p_first, const dly_op_data_t * p_second)
+{
+    return p_first->tx.trigger_time < p_second->tx.trigger_time;
+}
+
+/**
+ * @brief Push a TX delayed operation to the heap of scheduled TX delayed operations.
+ *
+ * This function must be called from a critical section.
+ *
+ * @param[in]  p_dly_op_data  TX delayed operation to push.
+ */
+static void dly_tx_heap_push(dly_op_data_t * p_dly_op_data)
+{
+    uint32_t idx = m_dly_tx_heap_len++;
+
+    assert(idx < NRF_802154_DELAYED_TRX_TX_QUEUE_SIZE);
+
+    while (idx > 0)
+    {
+        uint32_t parent = (idx - 1) / 2;
+
+        if (!dly_tx_is_before(p_dly_op_data, m_dly_tx_heap[parent]))
+        {
+            break;
+        }
+
+        m_dly_tx_heap[idx] = m_dly_tx_heap[parent];
+        idx                = parent;
+    }
+
+    m_dly_tx_heap[idx] = p_dly_op_data;
+}
+
+/**
+ * @brief Pop the earliest TX delayed operation from the heap of scheduled TX delayed operations.
+ *
+ * This function must be called from a critical section.
+ *
+ * @return Pointer to the earliest TX delayed operation or NULL if the heap is empty.
+ */
+static dly_op_data_t * dly_tx_heap_pop(void)
+{
+    if (m_dly_tx_heap_len == 0)
+    {
+        return NULL;
+    }
+
+    dly_op_data_t * p_result = m_dly_tx_heap[0];
+    dly_op_data_t * p_last   = m_dly_tx_heap[--m_dly_tx_heap_len];
+    uint32_t        idx      = 0;
+
+    while (true)
+    {
+        uint32_t child = 2 * idx + 1;
+
+        if (child >= m_dly_tx_heap_len)
+        {
+            break;
+        }
+
+        if ((child + 1 < m_dly_tx_heap_len) &&
+            dly_tx_is_before(m_dly_tx_heap[child + 1], m_dly_tx_heap[child]))
+        {
+            child++;
+        }
+
+        if (!dly_tx_is_before(m_dly_tx_heap[child], p_last))
+        {
+            break;
+        }
+
+        m_dly_tx_heap[idx] = m_dly_tx_heap[child];
+        idx                = child;
+    }
+
+    m_dly_tx_heap[idx] = p_last;
+
+    return p_result;
+}
+
 /**
  * @brief Retrieve an available slot from a pool.
  *
@@ -410,6 +540,193 @@ static bool dly_op_request(const rsch_dly_ts_param_t * p_dly_ts_param,
     return result;
 }
 
+static void rx_timeslot_started_callback(rsch_dly_ts_id_t dly_ts_id);
+
+/**
+ * Request the delayed timeslot for the current window of a RX delayed operation.
+ *
+ * @param[in]  p_dly_op_data  Data of the RX delayed operation.
+ *
+ * @retval true   The delayed timeslot was requested successfully.
+ * @retval false  The delayed timeslot could not be requested.
+ */
+static bool dly_rx_timeslot_request(const dly_op_data_t * p_dly_op_data)
+{
+    rsch_dly_ts_param_t dly_ts_param =
+    {
+        .trigger_time     = p_dly_op_data->rx.trigger_time,
+        .ppi_trigger_en   = true,
+        .ppi_trigger_dly  = RX_PPI_TRIGGER_DLY,
+        .prio             = RSCH_PRIO_IDLE_LISTENING,
+        .op               = RSCH_DLY_TS_OP_DRX,
+        .type             = RSCH_DLY_TS_TYPE_PRECISE,
+        .started_callback = rx_timeslot_started_callback,
+        .id               = p_dly_op_data->id,
+    };
+
+    return nrf_802154_rsch_delayed_timeslot_request(&dly_ts_param);
+}
+
+/**
+ * Schedule the next window of a periodic RX delayed operation whose current window has ended.
+ *
+ * Windows that have already passed are skipped.
+ *
+ * @param[inout]  p_dly_op_data  Data of the RX delayed operation.
+ *
+ * @retval true   The next window was scheduled.
+ * @retval false  The operation is not periodic, it has no windows left or the next window
+ *                could not be scheduled.
+ */
+static bool dly_rx_periodic_rearm(dly_op_data_t * p_dly_op_data)
+{
+    if (p_dly_op_data->rx.period == 0)
+    {
+        return false;
+    }
+
+    uint64_t now = nrf_802154_sl_timer_current_time_get();
+
+    do
+    {
+        if (p_dly_op_data->rx.remaining == 0)
+        {
+            return false;
+        }
+
+        if (p_dly_op_data->rx.remaining != DRX_PERIODIC_INFINITE)
+        {
+            p_dly_op_data->rx.remaining--;
+        }
+
+        p_dly_op_data->rx.trigger_time += p_dly_op_data->rx.period;
+    }
+    while (!nrf_802154_sl_time64_is_in_future(now, p_dly_op_data->rx.trigger_time));
+
+    bool result = dly_op_state_set(p_dly_op_data,
+                                   DELAYED_TRX_OP_STATE_ONGOING,
+                                   DELAYED_TRX_OP_STATE_PENDING);
+
+    assert(result);
+
+    if (p_dly_op_data->rx.duty_cycled)
+    {
+        // Requesting the timeslot starts the high frequency clock, so postpone the request until
+        // shortly before the window to let the radio sleep without the clock in the meantime.
+        uint64_t request_time = p_dly_op_data->rx.trigger_time - DRX_DUTY_CYCLE_PRESTART_TIME;
+
+        if (nrf_802154_sl_time64_is_in_future(now, request_time))
+        {
+            p_dly_op_data->rx.prestart_timer.trigger_time = request_time;
+
+            nrf_802154_sl_timer_ret_t ret;
+
+            ret = nrf_802154_sl_timer_add(&p_dly_op_data->rx.prestart_timer);
+            assert(ret == NRF_802154_SL_TIMER_RET_SUCCESS);
+            (void)ret;
+
+            return true;
+        }
+    }
+
+    result = dly_rx_timeslot_request(p_dly_op_data);
+
+    if (!result)
+    {
+        bool state_set = dly_op_state_set(p_dly_op_data,
+                                          DELAYED_TRX_OP_STATE_PENDING,
+                                          DELAYED_TRX_OP_STATE_ONGOING);
+
+        assert(state_set);
+        (void)state_set;
+    }
+
+    return result;
+}
+
+/**
+ * Notify MAC layer that a RX delayed operation ended without a frame.
+ *
+ * Windows of TSCH RX cells are not notified, as they are handled by the TSCH slotframe engine.
+ *
+ * @param[in]  error  Error to be notified.
+ * @param[in]  id     Identifier of the delayed reception window.
+ *
+ * @retval  true   The end of the window was notified or does not need to be notified.
+ * @retval  false  The notification could not be queued.
+ */
+static bool rx_window_end_notify(nrf_802154_rx_error_t error, uint32_t id)
+{
+#if NRF_802154_TSCH_ENABLED
+    if (nrf_802154_tsch_engine_rx_window_end_hook(id))
+    {
+        return true;
+    }
+#endif
+
+    return nrf_802154_notify_receive_failed(error, id, false);
+}
+
+/**
+ * End the current window of a RX delayed operation.
+ *
+ * Windows of a periodic RX delayed operation are not notified one by one. The MAC layer is
+ * notified only once the last window of the operation ends.
+ *
+ * @param[inout]  p_dly_op_data  Data of the RX delayed operation.
+ * @param[in]     error          Error to be notified if the operation ends with this window.
+ */
+static void dly_rx_window_end(dly_op_data_t * p_dly_op_data, nrf_802154_rx_error_t error)
+{
+    if (dly_rx_periodic_rearm(p_dly_op_data))
+    {
+        return;
+    }
+
+    bool notified = rx_window_end_notify(error, p_dly_op_data->id);
+
+    // It should always be possible to notify DRX result
+    assert(notified);
+    (void)notified;
+
+    p_dly_op_data->id = NRF_802154_RESERVED_INVALID_ID;
+
+    bool result = dly_op_state_set(p_dly_op_data,
+                                   DELAYED_TRX_OP_STATE_ONGOING,
+                                   DELAYED_TRX_OP_STATE_STOPPED);
+
+    assert(result);
+    (void)result;
+}
+
+/**
+ * Request the delayed timeslot of the next window of a duty-cycled RX delayed operation.
+ *
+ * @param[in]  p_timer  Prestart timer of the RX delayed operation.
+ */
+static void dly_rx_prestart(nrf_802154_sl_timer_t * p_timer)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    dly_op_data_t * p_dly_op_data = (dly_op_data_t *)(p_timer->user_data.p_pointer);
+
+    if ((p_dly_op_data->state == DELAYED_TRX_OP_STATE_PENDING) &&
+        !dly_rx_timeslot_request(p_dly_op_data))
+    {
+        bool result = dly_op_state_set(p_dly_op_data,
+                                       DELAYED_TRX_OP_STATE_PENDING,
+                                       DELAYED_TRX_OP_STATE_ONGOING);
+
+        if (result)
+        {
+            // The window cannot be entered, so skip it as if its timeslot was denied.
+            dly_rx_window_end(p_dly_op_data, NRF_802154_RX_ERROR_DELAYED_TIMESLOT_DENIED);
+        }
+    }
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+}
+
 /**
  * Notify MAC layer that no frame was received before timeout.
  *
@@ -430,6 +747,12 @@ static void notify_rx_timeout(nrf_802154_sl_timer_t * p_timer)
     bool     ack_requested = p_dly_op_data->rx.extension_frame.ack_requested;
     uint32_t frame_length  = nrf_802154_rx_duration_get(psdu_length, ack_requested);
 
+    if (psdu_length != 0)
+    {
+        // A frame was received in this window, so more traffic is likely to follow it.
+        frame_length += p_dly_op_data->rx.extension;
+    }
+
     if (nrf_802154_sl_time64_is_in_future(now, sof_timestamp + frame_length))
     {
         // @TODO protect against infinite extensions - allow only one timer extension
@@ -444,28 +767,44 @@ static void notify_rx_timeout(nrf_802154_sl_timer_t * p_timer)
     }
     else
     {
-        bool notified = nrf_802154_notify_receive_failed(
-            NRF_802154_RX_ERROR_DELAYED_TIMEOUT,
-            p_dly_op_data->id,
-            false);
+        bool duty_cycled = p_dly_op_data->rx.duty_cycled;
 
-        // It should always be possible to notify DRX result
-        assert(notified);
-        (void)notified;
+        dly_rx_window_end(p_dly_op_data, NRF_802154_RX_ERROR_DELAYED_TIMEOUT);
 
-        p_dly_op_data->id = NRF_802154_RESERVED_INVALID_ID;
-
-        bool result = dly_op_state_set(p_dly_op_data,
-                                       DELAYED_TRX_OP_STATE_ONGOING,
-                                       DELAYED_TRX_OP_STATE_STOPPED);
-
-        assert(result);
-        (void)result;
+        if (duty_cycled)
+        {
+            // The request fails if a frame is being received or another operation is ongoing.
+            (void)nrf_802154_request_sleep(NRF_802154_TERM_NONE);
+        }
     }
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
+static void tx_timeslot_started_callback(rsch_dly_ts_id_t dly_ts_id);
+
+/**
+ * Notify MAC layer that a delayed transmission could not be performed in the requested timeslot.
+ *
+ * @param[in]  p_dly_op_data  Data of the TX delayed operation.
+ */
+static void dly_tx_denied_notify(const dly_op_data_t * p_dly_op_data)
+{
+    nrf_802154_transmit_done_metadata_t metadata = {};
+
+    nrf_802154_stat_counter_increment(delayed_timeslots_denied);
+
+    metadata.frame_props = p_dly_op_data->tx.params.frame_props;
+    if (nrf_802154_core_hooks_tx_outcome(p_dly_op_data->tx.p_data,
+                                         NRF_802154_TX_ERROR_TIMESLOT_DENIED,
+                                         &metadata))
+    {
+        nrf_802154_notify_transmit_failed(p_dly_op_data->tx.p_data,
+                                          NRF_802154_TX_ERROR_TIMESLOT_DENIED,
+                                          &metadata);
+    }
+}
+
 /**
  * Transmit request result callback.
  *
@@ -475,7 +814,7 @@ static void dly_tx_result_notify(bool result)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
 
-    // Currently there's only a single delayed transmission possible at a time
+    // Only a single delayed transmission holds the delayed timeslot at a time
     dly_op_data_t * p_dly_op_data = dly_tx_data_by_id_search(NRF_802154_RESERVED_DTX_ID);
 
     assert(p_dly_op_data != NULL);
@@ -483,22 +822,102 @@ static void dly_tx_result_notify(bool result)
     if (!result)
     {
         // core rejected attempt, use my current frame_props
-        nrf_802154_transmit_done_metadata_t metadata = {};
-
-        metadata.frame_props = p_dly_op_data->tx.params.frame_props;
-        nrf_802154_notify_transmit_failed(p_dly_op_data->tx.p_data,
-                                          NRF_802154_TX_ERROR_TIMESLOT_DENIED,
-                                          &metadata);
+        dly_tx_denied_notify(p_dly_op_data);
     }
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
 }
 
+/**
+ * Request the delayed timeslot for a TX delayed operation.
+ *
+ * @param[inout]  p_dly_op_data  Data of the TX delayed operation.
+ *
+ * @retval true   The delayed timeslot was requested successfully.
+ * @retval false  The delayed timeslot could not be requested.
+ */
+static bool dly_tx_timeslot_request(dly_op_data_t * p_dly_op_data)
+{
+    rsch_dly_ts_param_t dly_ts_param =
+    {
+        .trigger_time     = p_dly_op_data->tx.trigger_time,
+        .ppi_trigger_en   = true,
+        .ppi_trigger_dly  = TX_PPI_TRIGGER_DLY,
+        .prio             = RSCH_PRIO_TX,
+        .op               = RSCH_DLY_TS_OP_DTX,
+        .type             = RSCH_DLY_TS_TYPE_PRECISE,
+        .started_callback = tx_timeslot_started_callback,
+        .id               = NRF_802154_RESERVED_DTX_ID,
+    };
+
+    p_dly_op_data->id = NRF_802154_RESERVED_DTX_ID;
+
+    bool result = nrf_802154_rsch_delayed_timeslot_request(&dly_ts_param);
+
+    if (!result)
+    {
+        p_dly_op_data->id = NRF_802154_RESERVED_INVALID_ID;
+    }
+
+    return result;
+}
+
+/**
+ * Release a TX delayed operation that has not been started.
+ *
+ * @param[inout]  p_dly_op_data  Data of the TX delayed operation.
+ */
+static void dly_tx_pending_release(dly_op_data_t * p_dly_op_data)
+{
+    p_dly_op_data->id = NRF_802154_RESERVED_INVALID_ID;
+
+    bool state_set = dly_op_state_set(p_dly_op_data,
+                                      DELAYED_TRX_OP_STATE_PENDING,
+                                      DELAYED_TRX_OP_STATE_STOPPED);
+
+    assert(state_set);
+    (void)state_set;
+}
+
+/**
+ * Arm the earliest scheduled TX delayed operation if no TX delayed operation is armed.
+ *
+ * Operations for which the delayed timeslot cannot be requested are notified as failed with
+ * @ref NRF_802154_TX_ERROR_TIMESLOT_DENIED.
+ */
+static void dly_tx_queue_arm(void)
+{
+    while (true)
+    {
+        nrf_802154_mcu_critical_state_t mcu_cs;
+        dly_op_data_t                 * p_dly_op_data = NULL;
+
+        nrf_802154_mcu_critical_enter(mcu_cs);
+
+        if (mp_dly_tx_armed == NULL)
+        {
+            p_dly_op_data   = dly_tx_heap_pop();
+            mp_dly_tx_armed = p_dly_op_data;
+        }
+
+        nrf_802154_mcu_critical_exit(mcu_cs);
+
+        if ((p_dly_op_data == NULL) || dly_tx_timeslot_request(p_dly_op_data))
+        {
+            break;
+        }
+
+        mp_dly_tx_armed = NULL;
+
+        dly_tx_denied_notify(p_dly_op_data);
+        dly_tx_pending_release(p_dly_op_data);
+    }
+}
+
 static void dly_rx_all_ongoing_abort(void)
 {
     nrf_802154_sl_timer_ret_t ret;
     dly_op_data_t           * p_dly_op_data;
-    bool                      result;
 
     for (int i = 0; i < sizeof(m_dly_rx_data) / sizeof(m_dly_rx_data[0]); i++)
     {
@@ -513,21 +932,7 @@ static void dly_rx_all_ongoing_abort(void)
             continue;
         }
 
-        bool notified = nrf_802154_notify_receive_failed(NRF_802154_RX_ERROR_DELAYED_ABORTED,
-                                                         p_dly_op_data->id,
-                                                         false);
-
-        // It should always be possible to notify DRX result
-        assert(notified);
-        (void)notified;
-
-        p_dly_op_data->id = NRF_802154_RESERVED_INVALID_ID;
-
-        result = dly_op_state_set(p_dly_op_data,
-                                  DELAYED_TRX_OP_STATE_ONGOING,
-                                  DELAYED_TRX_OP_STATE_STOPPED);
-        assert(result);
-        (void)result;
+        dly_rx_window_end(p_dly_op_data, NRF_802154_RX_ERROR_DELAYED_ABORTED);
     }
 }
 
@@ -572,17 +977,22 @@ static void dly_rx_result_notify(bool result)
         assert(ret == NRF_802154_SL_TIMER_RET_SUCCESS);
         (void)ret;
     }
-    else
+    else if (p_dly_op_data->rx.period == 0)
     {
-        bool notified = nrf_802154_notify_receive_failed(
-            NRF_802154_RX_ERROR_DELAYED_TIMESLOT_DENIED,
-            p_dly_op_data->id,
-            false);
+        nrf_802154_stat_counter_increment(delayed_timeslots_denied);
+
+        bool notified = rx_window_end_notify(NRF_802154_RX_ERROR_DELAYED_TIMESLOT_DENIED,
+                                             p_dly_op_data->id);
 
         // It should always be possible to notify DRX result
         assert(notified);
         (void)notified;
     }
+    else
+    {
+        // Denied windows of a periodic reception are handled by rx_timeslot_started_callback.
+        nrf_802154_stat_counter_increment(delayed_timeslots_denied);
+    }
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
 }
@@ -670,12 +1080,17 @@ static void tx_timeslot_started_callback(rsch_dly_ts_id_t dly_ts_id)
     result = dly_ts_slot_release(p_dly_op_data, true);
     assert(result);
 
+    // Disarm the operation before its slot is released so that it cannot be reused while armed.
+    mp_dly_tx_armed = NULL;
+
     result = dly_op_state_set(p_dly_op_data,
                               DELAYED_TRX_OP_STATE_ONGOING,
                               DELAYED_TRX_OP_STATE_STOPPED);
     assert(result);
     (void)result;
 
+    dly_tx_queue_arm();
+
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
 }
 
@@ -698,19 +1113,25 @@ static void rx_timeslot_started_callback(rsch_dly_ts_id_t dly_ts_id)
     }
 
     bool attempt_success = false;
-    bool result          = dly_op_state_set(p_dly_op_data,
+    bool started         = dly_op_state_set(p_dly_op_data,
                                             DELAYED_TRX_OP_STATE_PENDING,
                                             DELAYED_TRX_OP_STATE_ONGOING);
 
-    if (result)
+    if (started)
     {
         attempt_success = receive_attempt(p_dly_op_data);
     }
 
-    result = nrf_802154_rsch_delayed_timeslot_cancel(dly_ts_id, true);
+    bool result = nrf_802154_rsch_delayed_timeslot_cancel(dly_ts_id, true);
+
     assert(result);
 
-    if (!attempt_success)
+    if (!attempt_success && started && (p_dly_op_data->rx.period != 0))
+    {
+        // The timeslot of this window is released, so the next window can be requested.
+        dly_rx_window_end(p_dly_op_data, NRF_802154_RX_ERROR_DELAYED_TIMESLOT_DENIED);
+    }
+    else if (!attempt_success)
     {
         p_dly_op_data->id = NRF_802154_RESERVED_INVALID_ID;
 
@@ -729,6 +1150,9 @@ void nrf_802154_delayed_trx_module_reset(void)
 {
     memset(m_dly_rx_data, 0, sizeof(m_dly_rx_data));
     memset(m_dly_tx_data, 0, sizeof(m_dly_tx_data));
+    memset(m_dly_tx_heap, 0, sizeof(m_dly_tx_heap));
+    m_dly_tx_heap_len = 0;
+    mp_dly_tx_armed   = NULL;
     memset(&m_dly_rx_id_q, 0, sizeof(m_dly_rx_id_q));
     memset(m_dly_rx_id_q_mem, 0, sizeof(m_dly_rx_id_q_mem));
 }
@@ -747,6 +1171,7 @@ void nrf_802154_delayed_trx_init(void)
         m_dly_rx_data[i].state = DELAYED_TRX_OP_STATE_STOPPED;
         m_dly_rx_data[i].id    = NRF_802154_RESERVED_INVALID_ID;
         nrf_802154_sl_timer_init(&m_dly_rx_data[i].rx.timeout_timer);
+        nrf_802154_sl_timer_init(&m_dly_rx_data[i].rx.prestart_timer);
     }
 
     for (uint32_t i = 0; i < sizeof(m_dly_tx_data) / sizeof(m_dly_tx_data[0]); i++)
@@ -754,6 +1179,9 @@ void nrf_802154_delayed_trx_init(void)
         m_dly_tx_data[i].state = DELAYED_TRX_OP_STATE_STOPPED;
         m_dly_tx_data[i].id    = NRF_802154_RESERVED_INVALID_ID;
     }
+
+    m_dly_tx_heap_len = 0;
+    mp_dly_tx_armed   = NULL;
 }
 
 void nrf_802154_delayed_trx_deinit(void)
@@ -761,7 +1189,20 @@ void nrf_802154_delayed_trx_deinit(void)
     for (uint32_t i = 0; i < sizeof(m_dly_rx_data) / sizeof(m_dly_rx_data[0]); i++)
     {
         nrf_802154_sl_timer_deinit(&m_dly_rx_data[i].rx.timeout_timer);
+        nrf_802154_sl_timer_deinit(&m_dly_rx_data[i].rx.prestart_timer);
+    }
+}
+
+uint32_t nrf_802154_delayed_trx_tx_setup_time_get(bool cca)
+{
+    uint32_t setup_time = TX_PPI_TRIGGER_DLY + TX_RAMP_UP_TIME;
+
+    if (cca)
+    {
+        setup_time += nrf_802154_cca_before_tx_duration_get();
     }
+
+    return setup_time;
 }
 
 bool nrf_802154_delayed_trx_transmit(uint8_t                                 * p_data,
@@ -773,13 +1214,7 @@ bool nrf_802154_delayed_trx_transmit(uint8_t                                 * p
 
     if (p_dly_tx_data != NULL)
     {
-        tx_time -= TX_SETUP_TIME_MAX;
-        tx_time -= TX_RAMP_UP_TIME;
-
-        if (p_metadata->cca)
-        {
-            tx_time -= nrf_802154_cca_before_tx_duration_get();
-        }
+        tx_time -= nrf_802154_delayed_trx_tx_setup_time_get(p_metadata->cca);
 
         p_dly_tx_data->op = RSCH_DLY_TS_OP_DTX;
 
@@ -787,57 +1222,125 @@ bool nrf_802154_delayed_trx_transmit(uint8_t                                 * p
         p_dly_tx_data->tx.params.frame_props = p_metadata->frame_props;
         (void)nrf_802154_tx_power_convert_metadata_to_tx_power_split(p_metadata->channel,
                                                                      p_metadata->tx_power,
+                                                                     p_data,
                                                                      &p_dly_tx_data->tx.params.tx_power);
         p_dly_tx_data->tx.params.cca       = p_metadata->cca;
         p_dly_tx_data->tx.params.immediate = true;
         p_dly_tx_data->tx.channel          = p_metadata->channel;
-        p_dly_tx_data->id                  = NRF_802154_RESERVED_DTX_ID;
+        p_dly_tx_data->tx.trigger_time     = tx_time;
 
-        rsch_dly_ts_param_t dly_ts_param =
+        nrf_802154_mcu_critical_state_t mcu_cs;
+        dly_op_data_t                 * p_dly_tx_preempted = NULL;
+        bool                            arm_now            = false;
+
+        nrf_802154_mcu_critical_enter(mcu_cs);
+
+        dly_op_data_t * p_dly_tx_armed = mp_dly_tx_armed;
+
+        if (p_dly_tx_armed == NULL)
         {
-            .trigger_time     = tx_time,
-            .ppi_trigger_en   = true,
-            .ppi_trigger_dly  = TX_SETUP_TIME_MAX,
-            .prio             = RSCH_PRIO_TX,
-            .op               = RSCH_DLY_TS_OP_DTX,
-            .type             = RSCH_DLY_TS_TYPE_PRECISE,
-            .started_callback = tx_timeslot_started_callback,
-            .id               = NRF_802154_RESERVED_DTX_ID,
-        };
+            arm_now = true;
+        }
+        else if (dly_tx_is_before(p_dly_tx_data, p_dly_tx_armed) &&
+                 dly_ts_slot_release(p_dly_tx_armed, false))
+        {
+            // The new transmission is due earlier than the armed one. Take the delayed
+            // timeslot over and put the armed transmission back to the queue.
+            p_dly_tx_preempted = p_dly_tx_armed;
+            arm_now            = true;
+        }
+        else
+        {
+            dly_tx_heap_push(p_dly_tx_data);
+            result = true;
+        }
+
+        if (arm_now)
+        {
+            mp_dly_tx_armed = p_dly_tx_data;
+
+            if (p_dly_tx_preempted != NULL)
+            {
+                dly_tx_heap_push(p_dly_tx_preempted);
+            }
+        }
+
+        nrf_802154_mcu_critical_exit(mcu_cs);
+
+        if (arm_now)
+        {
+            result = dly_tx_timeslot_request(p_dly_tx_data);
 
-        result = dly_op_request(&dly_ts_param, p_dly_tx_data);
+            if (!result)
+            {
+                // Release the delayed operation slot immediately in case of failure and give
+                // the delayed timeslot to the next transmission in the queue.
+                mp_dly_tx_armed = NULL;
+                dly_tx_pending_release(p_dly_tx_data);
+                dly_tx_queue_arm();
+            }
+        }
     }
 
     return result;
 }
 
-bool nrf_802154_delayed_trx_receive(uint64_t rx_time,
-                                    uint32_t timeout,
-                                    uint8_t  channel,
-                                    uint32_t id)
+/**
+ * Schedule a RX delayed operation.
+ *
+ * @param[in]  rx_time      Absolute time of the first RX window [us].
+ * @param[in]  period       Period of RX windows [us] or 0 if the reception is not periodic.
+ * @param[in]  timeout      Length of each RX window [us].
+ * @param[in]  channel      Channel number on which reception should be performed.
+ * @param[in]  count        Number of RX windows following the first one or
+ *                          @ref DRX_PERIODIC_INFINITE.
+ * @param[in]  id           Identifier of the RX delayed operation.
+ * @param[in]  extension    Time [us] for which a window is kept open after a frame received in it.
+ * @param[in]  duty_cycled  If the radio is to sleep between the windows.
+ *
+ * @retval true   The RX delayed operation was scheduled.
+ * @retval false  The RX delayed operation could not be scheduled.
+ */
+static bool dly_rx_schedule(uint64_t rx_time,
+                            uint32_t period,
+                            uint32_t timeout,
+                            uint8_t  channel,
+                            uint32_t count,
+                            uint32_t id,
+                            uint32_t extension,
+                            bool     duty_cycled)
 {
     dly_op_data_t * p_dly_rx_data = available_dly_rx_slot_get();
     bool            result        = false;
 
     if (p_dly_rx_data != NULL)
     {
-        rx_time -= RX_SETUP_TIME_MAX;
+        rx_time -= RX_PPI_TRIGGER_DLY;
         rx_time -= RX_RAMP_UP_TIME;
 
         p_dly_rx_data->op = RSCH_DLY_TS_OP_DRX;
 
         p_dly_rx_data->rx.timeout_length = timeout + RX_RAMP_UP_TIME +
-                                           RX_SETUP_TIME_MAX;
+                                           RX_PPI_TRIGGER_DLY;
         p_dly_rx_data->rx.timeout_timer.action.callback.callback = notify_rx_timeout;
 
-        p_dly_rx_data->rx.channel = channel;
-        p_dly_rx_data->id         = id;
+        p_dly_rx_data->rx.trigger_time = rx_time;
+        p_dly_rx_data->rx.period       = period;
+        p_dly_rx_data->rx.remaining    = count;
+        p_dly_rx_data->rx.extension    = extension;
+        p_dly_rx_data->rx.duty_cycled  = duty_cycled;
+        p_dly_rx_data->rx.channel      = channel;
+
+        p_dly_rx_data->rx.prestart_timer.action_type = NRF_802154_SL_TIMER_ACTION_TYPE_CALLBACK;
+        p_dly_rx_data->rx.prestart_timer.action.callback.callback = dly_rx_prestart;
+        p_dly_rx_data->rx.prestart_timer.user_data.p_pointer      = p_dly_rx_data;
+        p_dly_rx_data->id              = id;
 
         rsch_dly_ts_param_t dly_ts_param =
         {
             .trigger_time     = rx_time,
             .ppi_trigger_en   = true,
-            .ppi_trigger_dly  = RX_SETUP_TIME_MAX,
+            .ppi_trigger_dly  = RX_PPI_TRIGGER_DLY,
             .prio             = RSCH_PRIO_IDLE_LISTENING,
             .op               = RSCH_DLY_TS_OP_DRX,
             .type             = RSCH_DLY_TS_TYPE_PRECISE,
@@ -851,24 +1354,65 @@ bool nrf_802154_delayed_trx_receive(uint64_t rx_time,
     return result;
 }
 
-bool nrf_802154_delayed_trx_transmit_cancel(void)
+bool nrf_802154_delayed_trx_receive(uint64_t rx_time,
+                                    uint32_t timeout,
+                                    uint8_t  channel,
+                                    uint32_t id)
 {
-    // This function does not provide any ID because it assumes that only a single delayed
-    // transmission can be scheduled at a time. Therefore use the first (and only) entry
-    // of m_dly_tx_data
-    dly_op_data_t * p_dly_op_data = &m_dly_tx_data[0];
-    bool            result        = false;
+    return dly_rx_schedule(rx_time, 0, timeout, channel, 0, id, 0, false);
+}
 
-    if (dly_ts_slot_release(p_dly_op_data, false))
+bool nrf_802154_delayed_trx_receive_periodic(uint64_t rx_time,
+                                             uint32_t period,
+                                             uint32_t timeout,
+                                             uint8_t  channel,
+                                             uint32_t count,
+                                             uint32_t id)
+{
+    if (count == 1)
     {
-        result = dly_op_state_set(p_dly_op_data,
-                                  DELAYED_TRX_OP_STATE_PENDING,
-                                  DELAYED_TRX_OP_STATE_STOPPED);
+        return nrf_802154_delayed_trx_receive(rx_time, timeout, channel, id);
+    }
 
-        assert(result);
+    // Each window must end before the timeslot of the next one begins.
+    if ((uint64_t)timeout + RX_RAMP_UP_TIME + RX_PPI_TRIGGER_DLY >= period)
+    {
+        return false;
     }
 
-    return result;
+    return dly_rx_schedule(rx_time,
+                           period,
+                           timeout,
+                           channel,
+                           (count == 0) ? DRX_PERIODIC_INFINITE : (count - 1),
+                           id,
+                           0,
+                           false);
+}
+
+bool nrf_802154_delayed_trx_receive_duty_cycled(uint64_t rx_time,
+                                                uint32_t period,
+                                                uint32_t window,
+                                                uint32_t extension,
+                                                uint8_t  channel,
+                                                uint32_t count,
+                                                uint32_t id)
+{
+    // Each window must end before the timeslot of the next one is requested.
+    if ((uint64_t)window + RX_RAMP_UP_TIME + RX_PPI_TRIGGER_DLY + DRX_DUTY_CYCLE_PRESTART_TIME >=
+        period)
+    {
+        return false;
+    }
+
+    return dly_rx_schedule(rx_time,
+                           (count == 1) ? 0 : period,
+                           window,
+                           channel,
+                           (count == 0) ? DRX_PERIODIC_INFINITE : (count - 1),
+                           id,
+                           extension,
+                           true);
 }
 
 bool nrf_802154_delayed_trx_receive_cancel(uint32_t id)
@@ -889,6 +1433,11 @@ bool nrf_802154_delayed_trx_receive_cancel(uint32_t id)
 
     was_running = (ret == NRF_802154_SL_TIMER_RET_SUCCESS);
 
+    // A duty-cycled operation waiting to request the timeslot of its next window.
+    ret = nrf_802154_sl_timer_remove(&p_dly_op_data->rx.prestart_timer);
+
+    was_running = was_running || (ret == NRF_802154_SL_TIMER_RET_SUCCESS);
+
     if (result || was_running)
     {
         p_dly_op_data->id = NRF_802154_RESERVED_INVALID_ID;
@@ -923,6 +1472,42 @@ bool nrf_802154_delayed_trx_abort(nrf_802154_term_t term_lvl, req_originator_t r
     return true;
 }
 
+uint64_t nrf_802154_delayed_trx_burst_next_tx_time_get(uint64_t        tx_time,
+                                                       const uint8_t * p_frame,
+                                                       bool            cca)
+{
+    nrf_802154_frame_parser_data_t frame_data;
+    uint8_t                        frame_length = p_frame[PHR_OFFSET];
+    uint64_t                       frame_end    = tx_time +
+                                                  nrf_802154_frame_duration_get(frame_length,
+                                                                                true,
+                                                                                true);
+
+    bool result = nrf_802154_frame_parser_data_init(p_frame,
+                                                    frame_length + PHR_SIZE,
+                                                    PARSE_LEVEL_FCF_OFFSETS,
+                                                    &frame_data);
+
+    if (result && nrf_802154_frame_parser_ar_bit_is_set(&frame_data))
+    {
+        frame_end += PHY_US_TIME_FROM_SYMBOLS(MAC_IMM_ACK_WAIT_SYMBOLS);
+    }
+
+#if NRF_802154_IFS_ENABLED
+    uint32_t ifs_period = (frame_length > MAX_SIFS_FRAME_SIZE) ?
+                          nrf_802154_pib_ifs_min_lifs_period_get() :
+                          nrf_802154_pib_ifs_min_sifs_period_get();
+#else
+    uint32_t ifs_period = (frame_length > MAX_SIFS_FRAME_SIZE) ?
+                          MIN_LIFS_PERIOD_US : MIN_SIFS_PERIOD_US;
+#endif
+
+    // The delayed timeslot of the next frame must not start before the previous frame ends.
+    uint32_t setup_period = MAX_RAMP_DOWN_TIME + nrf_802154_delayed_trx_tx_setup_time_get(cca);
+
+    return frame_end + ((ifs_period > setup_period) ? ifs_period : setup_period);
+}
+
 void nrf_802154_delayed_trx_rx_started_hook(const uint8_t * p_frame)
 {
     dly_op_data_t                * p_dly_op_data = ongoing_dly_rx_slot_get();
@@ -959,14 +1544,14 @@ bool nrf_802154_delayed_trx_nearest_drx_time_to_midpoint_get(uint32_t * p_drx_ti
 
         result = nrf_802154_rsch_delayed_timeslot_time_to_start_get(m_dly_rx_data[i].id,
                                                                     &drx_time_to_start);
-        drx_time_to_start += RX_SETUP_TIME_MAX + RX_RAMP_UP_TIME;
+        drx_time_to_start += RX_PPI_TRIGGER_DLY + RX_RAMP_UP_TIME;
 
         if (result)
         {
             min_time_to_start = drx_time_to_start < min_time_to_start ?
                                 (uint32_t)drx_time_to_start : min_time_to_start;
             drx_window_duration_time = m_dly_rx_data[i].rx.timeout_length -
-                                       (RX_SETUP_TIME_MAX + RX_RAMP_UP_TIME);
+                                       (RX_PPI_TRIGGER_DLY + RX_RAMP_UP_TIME);
             drx_time_to_midpoint = min_time_to_start + drx_window_duration_time / 2;
         }
     }
@@ -71,6 +71,9 @@ void nrf_802154_delayed_trx_deinit(void);
  * @ref nrf_802154_tx_started function is called. If the requested frame cannot be transmitted
  * at the given time, the @ref nrf_802154_transmit_failed function is called.
  *
+ * Up to @ref NRF_802154_DELAYED_TRX_TX_QUEUE_SIZE transmissions can be scheduled at the same time.
+ * They are performed in order of their transmission times.
+ *
  * @note The delayed transmission does not time out automatically when waiting for ACK.
  *       Waiting for ACK must be timed out by the next higher layer or the ACK timeout module.
  *       The ACK timeout timer must start when the @ref nrf_802154_tx_started function is called.
@@ -80,17 +83,50 @@ void nrf_802154_delayed_trx_deinit(void);
  * @param[in]  tx_time      Absolute time used by the SL Timer, in microseconds (us).
  * @param[in]  p_metadata   Pointer to metadata structure. Contains detailed properties of data
  *                          to transmit and additional parameters for the procedure.
+ *
+ * @retval  true   The transmission procedure was scheduled.
+ * @retval  false  The driver could not schedule the transmission procedure.
  */
 bool nrf_802154_delayed_trx_transmit(uint8_t                                 * p_data,
                                      uint64_t                                  tx_time,
                                      const nrf_802154_transmit_at_metadata_t * p_metadata);
 
 /**
- * @brief Cancels a transmission scheduled by a call to @ref nrf_802154_delayed_trx_transmit.
+ * @brief Gets the transmission time of a frame that follows another one in a transmit burst.
  *
- * This function does not cancel transmission if the transmission is already ongoing.
+ * The returned time leaves the interframe space required after @p p_frame and the time needed
+ * to prepare the next delayed transmission after @p p_frame and its ACK have been transmitted.
  *
- * @retval true     Successfully cancelled a scheduled transmission.
+ * @param[in]  tx_time  Transmission time of @p p_frame, in microseconds (us).
+ * @param[in]  p_frame  Pointer to a buffer containing PHR and PSDU of the preceding frame.
+ * @param[in]  cca      If the next frame is to be transmitted with CCA.
+ *
+ * @return Transmission time of the next frame, in microseconds (us).
+ */
+uint64_t nrf_802154_delayed_trx_burst_next_tx_time_get(uint64_t        tx_time,
+                                                       const uint8_t * p_frame,
+                                                       bool            cca);
+
+/**
+ * @brief Gets the setup time of a delayed transmission.
+ *
+ * The delayed timeslot of a transmission starts the returned time before its transmission time.
+ * From then on, the frame is prepared and the ramp-up of the transmitter is triggered by hardware
+ * at a fixed time, so the setup time does not depend on interrupt latency.
+ *
+ * @param[in]  cca  If the frame is to be transmitted with CCA.
+ *
+ * @return Setup time of a delayed transmission, in microseconds (us).
+ */
+uint32_t nrf_802154_delayed_trx_tx_setup_time_get(bool cca);
+
+/**
+ * @brief Cancels transmissions scheduled by calls to @ref nrf_802154_delayed_trx_transmit.
+ *
+ * All scheduled transmissions are cancelled. This function does not cancel transmission if
+ * the transmission is already ongoing.
+ *
+ * @retval true     Successfully cancelled at least one scheduled transmission.
  * @retval false    No delayed transmission was scheduled.
  */
 bool nrf_802154_delayed_trx_transmit_cancel(void);
@@ -127,6 +163,64 @@ bool nrf_802154_delayed_trx_receive(uint64_t rx_time,
                                     uint8_t  channel,
                                     uint32_t id);
 
+/**
+ * @brief Requests periodic reception windows starting at a given time.
+ *
+ * The windows are rescheduled internally, one @p period after another. Frames received in any
+ * of the windows are notified as usual. Windows that end without a frame are not notified,
+ * so the @ref nrf_802154_receive_failed function is called only once the last window ends.
+ *
+ * @p id follows the same rules as in @ref nrf_802154_delayed_trx_receive. All windows can be
+ * cancelled with a single call to @ref nrf_802154_delayed_trx_receive_cancel.
+ *
+ * @param[in]  rx_time  Absolute time of the first window used by the SL Timer, in microseconds (us).
+ * @param[in]  period   Time between the beginnings of consecutive windows, in microseconds.
+ * @param[in]  timeout  Length of each window, in microseconds.
+ * @param[in]  channel  Number of the channel on which the frames are to be received.
+ * @param[in]  count    Number of windows. If 0, the windows are repeated until cancelled.
+ * @param[in]  id       Identifier of the scheduled reception windows.
+ *
+ * @retval  true   The reception procedure was scheduled.
+ * @retval  false  The driver could not schedule the reception procedure or the windows do not fit
+ *                 in @p period.
+ */
+bool nrf_802154_delayed_trx_receive_periodic(uint64_t rx_time,
+                                             uint32_t period,
+                                             uint32_t timeout,
+                                             uint8_t  channel,
+                                             uint32_t count,
+                                             uint32_t id);
+
+/**
+ * @brief Requests duty-cycled reception windows starting at the specified time.
+ *
+ * This function works like @ref nrf_802154_delayed_trx_receive_periodic, but the radio is put
+ * to sleep after each window and the delayed timeslot of the next window is requested only
+ * @ref NRF_802154_DELAYED_TRX_RX_DUTY_CYCLE_PRESTART_US before it, so that the high frequency
+ * clock does not run between the windows. A window in which a frame is received is kept open
+ * for @p extension after the end of that frame.
+ *
+ * @param[in]  rx_time    Absolute time of the first window used by the SL Timer, in microseconds (us).
+ * @param[in]  period     Time between the beginnings of consecutive windows, in microseconds.
+ * @param[in]  window     Length of each window, in microseconds.
+ * @param[in]  extension  Time for which a window is kept open after a frame received in it,
+ *                        in microseconds.
+ * @param[in]  channel    Number of the channel on which the frames are to be received.
+ * @param[in]  count      Number of windows. If 0, the windows are repeated until cancelled.
+ * @param[in]  id         Identifier of the scheduled reception windows.
+ *
+ * @retval  true   The reception procedure was scheduled.
+ * @retval  false  The driver could not schedule the reception procedure or the windows and
+ *                 the prestart time do not fit in @p period.
+ */
+bool nrf_802154_delayed_trx_receive_duty_cycled(uint64_t rx_time,
+                                                uint32_t period,
+                                                uint32_t window,
+                                                uint32_t extension,
+                                                uint8_t  channel,
+                                                uint32_t count,
+                                                uint32_t id);
+
 /**
  * @brief Cancels a reception scheduled by a call to @ref nrf_802154_delayed_trx_receive.
  *
@@ -48,15 +48,21 @@
 #include <stdint.h>
 #include <string.h>
 
+#include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
 #include "nrf_802154_frame_parser.h"
 #include "nrf_802154_pib.h"
+#include "nrf_802154_profiler.h"
 
 #define FCF_CHECK_OFFSET           (PHR_SIZE + FCF_SIZE)
 #define PANID_CHECK_OFFSET         (DEST_ADDR_OFFSET)
 #define SHORT_ADDR_CHECK_OFFSET    (DEST_ADDR_OFFSET + SHORT_ADDRESS_SIZE)
 #define EXTENDED_ADDR_CHECK_OFFSET (DEST_ADDR_OFFSET + EXTENDED_ADDRESS_SIZE)
 
+#if NRF_802154_IDENTITIES_NUM > 0
+static const nrf_802154_identity_t * mp_matched_identity; ///< Identity matched by the last destination address check.
+#endif
+
 /**
  * @brief Check if given frame version is allowed for given frame type.
  *
@@ -377,7 +383,7 @@ static bool dst_extended_addr_check(const uint8_t * p_dst_addr)
 }
 
 /**
- * Verify if destination addressing of incoming frame allows processing by this node.
+ * Verify if destination addressing of incoming frame matches the addresses set in the PIB.
  * This function checks addressing according to IEEE 802.15.4-2015.
  *
  * @param[in]  p_frame_data Pointer to the frame parser data.
@@ -386,7 +392,8 @@ static bool dst_extended_addr_check(const uint8_t * p_dst_addr)
  * @retval NRF_802154_RX_ERROR_INVALID_FRAME      Received frame is invalid.
  * @retval NRF_802154_RX_ERROR_INVALID_DEST_ADDR  Destination address of incoming frame does not allow further processing.
  */
-static nrf_802154_rx_error_t dst_addr_check(const nrf_802154_frame_parser_data_t * p_frame_data)
+static nrf_802154_rx_error_t pib_dst_addr_check(
+    const nrf_802154_frame_parser_data_t * p_frame_data)
 {
     const uint8_t * p_dst_panid = nrf_802154_frame_parser_dst_panid_get(p_frame_data);
     const uint8_t * p_dst_addr  = nrf_802154_frame_parser_dst_addr_get(p_frame_data);
@@ -428,7 +435,120 @@ static nrf_802154_rx_error_t dst_addr_check(const nrf_802154_frame_parser_data_t
     return NRF_802154_RX_ERROR_INVALID_FRAME;
 }
 
-nrf_802154_rx_error_t nrf_802154_filter_frame_part(
+#if NRF_802154_IDENTITIES_NUM > 0
+/**
+ * Verify if destination addressing of incoming frame matches the given additional identity.
+ *
+ * @param[in]  p_identity     Pointer to the identity.
+ * @param[in]  p_dst_panid    Pointer to the destination PAN ID or NULL if it is not present.
+ * @param[in]  p_dst_addr     Pointer to the destination address.
+ * @param[in]  dst_addr_size  Size of the destination address or 0 if it is not present.
+ * @param[in]  frame_type     Type of the frame being filtered.
+ *
+ * @retval true   Incoming frame is destined to the identity.
+ * @retval false  Incoming frame is not destined to the identity.
+ */
+static bool identity_dst_addr_check(const nrf_802154_identity_t * p_identity,
+                                    const uint8_t               * p_dst_panid,
+                                    const uint8_t               * p_dst_addr,
+                                    uint8_t                       dst_addr_size,
+                                    uint8_t                       frame_type)
+{
+    if ((p_dst_panid != NULL) &&
+        (0 != memcmp(p_dst_panid, p_identity->pan_id, PAN_ID_SIZE)) &&
+        (0 != memcmp(p_dst_panid, BROADCAST_ADDRESS, PAN_ID_SIZE)))
+    {
+        return false;
+    }
+
+    switch (dst_addr_size)
+    {
+        case SHORT_ADDRESS_SIZE:
+            return (0 == memcmp(p_dst_addr, p_identity->short_addr, SHORT_ADDRESS_SIZE)) ||
+                   (0 == memcmp(p_dst_addr, BROADCAST_ADDRESS, SHORT_ADDRESS_SIZE));
+
+        case EXTENDED_ADDRESS_SIZE:
+            return 0 == memcmp(p_dst_addr, p_identity->extended_addr, EXTENDED_ADDRESS_SIZE);
+
+        default:
+            return frame_type == FRAME_TYPE_BEACON;
+    }
+}
+
+/**
+ * Find the additional identity the incoming frame is destined to.
+ *
+ * @param[in]  p_frame_data Pointer to the frame parser data.
+ *
+ * @return Pointer to the first matching identity or NULL if no identity matches.
+ */
+static const nrf_802154_identity_t * identity_find(
+    const nrf_802154_frame_parser_data_t * p_frame_data)
+{
+    const uint8_t * p_dst_panid   = nrf_802154_frame_parser_dst_panid_get(p_frame_data);
+    const uint8_t * p_dst_addr    = nrf_802154_frame_parser_dst_addr_get(p_frame_data);
+    uint8_t         frame_type    = nrf_802154_frame_parser_frame_type_get(p_frame_data);
+    uint8_t         dst_addr_size =
+        p_dst_addr ? nrf_802154_frame_parser_dst_addr_size_get(p_frame_data) : 0U;
+
+    for (uint8_t i = 0; i < NRF_802154_IDENTITIES_NUM; i++)
+    {
+        const nrf_802154_identity_t * p_identity = nrf_802154_pib_identity_get(i);
+
+        if ((p_identity != NULL) &&
+            identity_dst_addr_check(p_identity, p_dst_panid, p_dst_addr, dst_addr_size,
+                                    frame_type))
+        {
+            return p_identity;
+        }
+    }
+
+    return NULL;
+}
+
+#endif // NRF_802154_IDENTITIES_NUM > 0
+
+/**
+ * Verify if destination addressing of incoming frame allows processing by this node.
+ *
+ * The addresses set in the PIB are checked first, then the additional identities.
+ *
+ * @param[in]  p_frame_data Pointer to the frame parser data.
+ *
+ * @retval NRF_802154_RX_ERROR_NONE               Destination address of incoming frame allows further processing of the frame.
+ * @retval NRF_802154_RX_ERROR_INVALID_FRAME      Received frame is invalid.
+ * @retval NRF_802154_RX_ERROR_INVALID_DEST_ADDR  Destination address of incoming frame does not allow further processing.
+ */
+static nrf_802154_rx_error_t dst_addr_check(const nrf_802154_frame_parser_data_t * p_frame_data)
+{
+    nrf_802154_rx_error_t result = pib_dst_addr_check(p_frame_data);
+
+#if NRF_802154_IDENTITIES_NUM > 0
+    mp_matched_identity = NULL;
+
+    if (result == NRF_802154_RX_ERROR_INVALID_DEST_ADDR)
+    {
+        mp_matched_identity = identity_find(p_frame_data);
+
+        if (mp_matched_identity != NULL)
+        {
+            result = NRF_802154_RX_ERROR_NONE;
+        }
+    }
+#endif
+
+    return result;
+}
+
+/**
+ * @brief Filters the requested parts of a frame.
+ *
+ * @param[in]  p_frame_data  Pointer to the frame parser data of the frame to be filtered.
+ * @param[in]  filter_mode   Parts of the frame to be filtered.
+ *
+ * @return  Result of the filtering. See @ref nrf_802154_filter_frame_part.
+ */
+static nrf_802154_rx_error_t frame_part_filter(
     const nrf_802154_frame_parser_data_t * p_frame_data,
     nrf_802154_filter_mode_t               filter_mode)
 {
@@ -477,3 +597,23 @@ nrf_802154_rx_error_t nrf_802154_filter_frame_part(
 
     return result;
 }
+
+NRF_802154_HOT_FUNC nrf_802154_rx_error_t nrf_802154_filter_frame_part(
+    const nrf_802154_frame_parser_data_t * p_frame_data,
+    nrf_802154_filter_mode_t               filter_mode)
+{
+    uint32_t              profile_start = nrf_802154_profiler_begin();
+    nrf_802154_rx_error_t result        = frame_part_filter(p_frame_data, filter_mode);
+
+    nrf_802154_profiler_end(NRF_802154_PROFILE_POINT_FILTER, profile_start);
+
+    return result;
+}
+
+#if NRF_802154_IDENTITIES_NUM > 0
+const nrf_802154_identity_t * nrf_802154_filter_identity_get(void)
+{
+    return mp_matched_identity;
+}
+
+#endif
@@ -43,6 +43,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "nrf_802154_config.h"
 #include "nrf_802154_types.h"
 #include "mac_features/nrf_802154_frame_parser.h"
 
@@ -99,6 +100,18 @@ nrf_802154_rx_error_t nrf_802154_filter_frame_part(
     const nrf_802154_frame_parser_data_t * p_frame_data,
     nrf_802154_filter_mode_t               filter_mode);
 
+#if NRF_802154_IDENTITIES_NUM > 0
+/**
+ * @brief Gets the additional identity matched by the last destination address filtering.
+ *
+ * @return Pointer to the identity the frame last filtered with @c NRF_802154_FILTER_MODE_DST_ADDR
+ *         is destined to, or NULL if the frame is destined to the addresses set in the PIB or did
+ *         not pass the filtering.
+ */
+const nrf_802154_identity_t * nrf_802154_filter_identity_get(void);
+
+#endif
+
 /**
  *@}
  **/
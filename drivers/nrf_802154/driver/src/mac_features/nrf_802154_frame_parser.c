@@ -44,9 +44,15 @@
 
 #include "nrf_802154_frame_parser.h"
 
+#include <string.h>
+
+#include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
 #include "nrf_802154_utils_byteorder.h"
 
+static nrf_802154_frame_parser_data_t m_tx_data;       ///< Parser data of the frame being transmitted.
+static bool                           m_tx_data_valid; ///< Indicates if @ref m_tx_data is initialized.
+
 /***************************************************************************************************
  * @section Helper functions
  **************************************************************************************************/
@@ -346,6 +352,26 @@ static bool sec_ctrl_parse(nrf_802154_frame_parser_data_t * p_parser_data)
     return true;
 }
 
+#if NRF_802154_FRAME_PARSER_IE_INDEX_ENABLED
+static void ie_index_add(nrf_802154_frame_parser_data_t * p_parser_data,
+                         const uint8_t                  * p_iterator)
+{
+    uint8_t count = p_parser_data->ie_index.count;
+
+    if (count < NRF_802154_FRAME_PARSER_IE_INDEX_SIZE)
+    {
+        p_parser_data->ie_index.offset[count] = p_iterator - p_parser_data->p_frame;
+    }
+
+    // The count saturates one above the index size to mark that the index is incomplete.
+    if (count <= NRF_802154_FRAME_PARSER_IE_INDEX_SIZE)
+    {
+        p_parser_data->ie_index.count = count + 1;
+    }
+}
+
+#endif
+
 static bool full_parse(nrf_802154_frame_parser_data_t * p_parser_data)
 {
     uint8_t         offset      = p_parser_data->helper.aux_sec_hdr_end_offset;
@@ -360,6 +386,10 @@ static bool full_parse(nrf_802154_frame_parser_data_t * p_parser_data)
         return false;
     }
 
+#if NRF_802154_FRAME_PARSER_IE_INDEX_ENABLED
+    p_parser_data->ie_index.count = 0;
+#endif
+
     if (nrf_802154_frame_parser_ie_present_bit_is_set(p_parser_data))
     {
         p_parser_data->mhr.header_ie_offset = offset;
@@ -370,6 +400,10 @@ static bool full_parse(nrf_802154_frame_parser_data_t * p_parser_data)
 
         while (!nrf_802154_frame_parser_ie_iterator_end(p_iterator, p_end_addr))
         {
+#if NRF_802154_FRAME_PARSER_IE_INDEX_ENABLED
+            ie_index_add(p_parser_data, p_iterator);
+#endif
+
             p_iterator = nrf_802154_frame_parser_ie_iterator_next(p_iterator);
 
             if (p_iterator > p_end_addr)
@@ -515,9 +549,10 @@ bool nrf_802154_frame_parser_data_init(const uint8_t                  * p_frame,
     return parse_state_advance(p_parser_data, requested_parse_level);
 }
 
-bool nrf_802154_frame_parser_valid_data_extend(nrf_802154_frame_parser_data_t * p_parser_data,
-                                               uint8_t                          valid_data_len,
-                                               nrf_802154_frame_parser_level_t  requested_parse_level)
+NRF_802154_HOT_FUNC bool nrf_802154_frame_parser_valid_data_extend(
+    nrf_802154_frame_parser_data_t * p_parser_data,
+    uint8_t                          valid_data_len,
+    nrf_802154_frame_parser_level_t  requested_parse_level)
 {
     if (valid_data_len > p_parser_data->valid_data_len)
     {
@@ -526,3 +561,69 @@ bool nrf_802154_frame_parser_valid_data_extend(nrf_802154_frame_parser_data_t *
 
     return parse_state_advance(p_parser_data, requested_parse_level);
 }
+
+const nrf_802154_frame_parser_data_t * nrf_802154_frame_parser_tx_data_get(
+    const uint8_t                 * p_frame,
+    nrf_802154_frame_parser_level_t requested_parse_level)
+{
+    bool result;
+
+    if (p_frame == NULL)
+    {
+        return NULL;
+    }
+
+    if (m_tx_data_valid && (m_tx_data.p_frame == p_frame))
+    {
+        // Continue from the level reached by previous requests
+        result = parse_state_advance(&m_tx_data, requested_parse_level);
+    }
+    else
+    {
+        result = nrf_802154_frame_parser_data_init(p_frame,
+                                                   p_frame[PHR_OFFSET] + PHR_SIZE,
+                                                   requested_parse_level,
+                                                   &m_tx_data);
+        m_tx_data_valid = true;
+    }
+
+    return result ? &m_tx_data : NULL;
+}
+
+void nrf_802154_frame_parser_tx_data_invalidate(void)
+{
+    m_tx_data_valid = false;
+}
+
+uint64_t nrf_802154_frame_parser_dst_key_get(const nrf_802154_frame_parser_data_t * p_parser_data)
+{
+    const uint8_t * p_dst_addr = nrf_802154_frame_parser_dst_addr_get(p_parser_data);
+    uint64_t        key        = NRF_802154_FRAME_PARSER_DST_KEY_NONE;
+
+    if (p_dst_addr == NULL)
+    {
+        // Intentionally empty: no destination address.
+    }
+    else if (nrf_802154_frame_parser_dst_addr_is_extended(p_parser_data))
+    {
+        memcpy(&key, p_dst_addr, EXTENDED_ADDRESS_SIZE);
+    }
+    else if ((p_dst_addr[0] != 0xFFU) || (p_dst_addr[1] != 0xFFU))
+    {
+        const uint8_t * p_dst_panid = nrf_802154_frame_parser_dst_panid_get(p_parser_data);
+
+        // Mark the key so that it cannot be equal to NRF_802154_FRAME_PARSER_DST_KEY_NONE.
+        key = ((uint64_t)1U << 32) | ((uint32_t)p_dst_addr[0]) | ((uint32_t)p_dst_addr[1] << 8);
+
+        if (p_dst_panid != NULL)
+        {
+            key |= ((uint32_t)p_dst_panid[0] << 16) | ((uint32_t)p_dst_panid[1] << 24);
+        }
+    }
+    else
+    {
+        // Intentionally empty: broadcast frame.
+    }
+
+    return key;
+}
@@ -40,6 +40,7 @@
 #ifndef NRF_802154_FRAME_PARSER_H
 #define NRF_802154_FRAME_PARSER_H
 
+#include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
 #include "nrf_802154_utils_byteorder.h"
 #include <stdbool.h>
@@ -47,6 +48,7 @@
 #include <stddef.h>
 
 #define NRF_802154_FRAME_PARSER_INVALID_OFFSET 0xff
+#define NRF_802154_FRAME_PARSER_DST_KEY_NONE   0U ///< Destination key of frames without a unicast destination address.
 
 typedef enum
 {
@@ -171,6 +173,14 @@ typedef struct
         uint8_t key_src_size;              ///< Key Source size.
         uint8_t mic_size;                  ///< Message Integrity Code size.
     } helper;
+
+#if NRF_802154_FRAME_PARSER_IE_INDEX_ENABLED
+    struct
+    {
+        uint8_t count;                                        ///< Number of header IEs in the frame.
+        uint8_t offset[NRF_802154_FRAME_PARSER_IE_INDEX_SIZE]; ///< Offsets of the header IEs.
+    } ie_index;
+#endif
 } nrf_802154_frame_parser_data_t;
 
 /**
@@ -213,6 +223,48 @@ bool nrf_802154_frame_parser_valid_data_extend(nrf_802154_frame_parser_data_t *
                                                uint8_t                          valid_data_len,
                                                nrf_802154_frame_parser_level_t  requested_parse_level);
 
+/**
+ * @brief Gets parser data of the frame being transmitted.
+ *
+ * The parser data is kept between calls, so several modules that process the same frame
+ * share it and each of them only parses the fields not parsed yet. The frame is parsed
+ * further only if @p requested_parse_level has not been reached earlier.
+ *
+ * @note The parser data assumes that the structure of the frame does not change until
+ *       @ref nrf_802154_frame_parser_tx_data_invalidate is called.
+ *
+ * @param[in]    p_frame               Pointer to a frame being transmitted.
+ * @param[in]    requested_parse_level Requested parse level.
+ *
+ * @returns  Pointer to the parser data of the frame or NULL if the parsing failed or
+ *           requested parse level could not be achieved.
+ */
+const nrf_802154_frame_parser_data_t * nrf_802154_frame_parser_tx_data_get(
+    const uint8_t                 * p_frame,
+    nrf_802154_frame_parser_level_t requested_parse_level);
+
+/**
+ * @brief Discards parser data kept by @ref nrf_802154_frame_parser_tx_data_get.
+ *
+ * This function must be called before a new transmission is processed, as a buffer
+ * of a previously transmitted frame may be reused with different content.
+ */
+void nrf_802154_frame_parser_tx_data_invalidate(void);
+
+/**
+ * @brief Gets a key identifying the unicast destination of a frame.
+ *
+ * Extended addresses are used as keys directly. Short addresses are combined with the destination
+ * PAN ID, as they are only unique within a PAN.
+ *
+ * @param[in]   p_parser_data   Pointer to a frame parser data parsed at least to
+ *                              @ref PARSE_LEVEL_ADDRESSING_END.
+ *
+ * @returns  Key of the destination or @ref NRF_802154_FRAME_PARSER_DST_KEY_NONE if the frame
+ *           has no unicast destination address.
+ */
+uint64_t nrf_802154_frame_parser_dst_key_get(const nrf_802154_frame_parser_data_t * p_parser_data);
+
 /**
  * @brief Gets current parse level of the provided parser data.
  *
@@ -1228,6 +1280,60 @@ static inline bool nrf_802154_frame_parser_ie_iterator_end(const uint8_t * p_ie_
            || (p_ie_iterator >= p_end_addr);
 }
 
+#if NRF_802154_FRAME_PARSER_IE_INDEX_ENABLED
+
+/**
+ * @brief Checks if the header IE index of the frame is complete.
+ *
+ * The index is complete if the frame is parsed to @ref PARSE_LEVEL_FULL and all its header IEs
+ * fit in the index. Otherwise, the IE chain must be walked with the IE iterator.
+ *
+ * @param[in]   p_parser_data   Pointer to a frame parser data.
+ *
+ * @retval  true   The index holds all header IEs of the frame.
+ * @retval  false  The index is not available for the frame.
+ */
+static inline bool nrf_802154_frame_parser_header_ie_index_is_complete(
+    const nrf_802154_frame_parser_data_t * p_parser_data)
+{
+    return (p_parser_data->parse_level >= PARSE_LEVEL_FULL) &&
+           (p_parser_data->ie_index.count <= NRF_802154_FRAME_PARSER_IE_INDEX_SIZE);
+}
+
+/**
+ * @brief Gets the number of header IEs of the frame.
+ *
+ * @param[in]   p_parser_data   Pointer to a frame parser data.
+ *
+ * @returns  Number of header IEs, not including the termination IE.
+ *
+ * @note  The returned value is meaningful only if
+ *        @ref nrf_802154_frame_parser_header_ie_index_is_complete returns true.
+ */
+static inline uint8_t nrf_802154_frame_parser_header_ie_count_get(
+    const nrf_802154_frame_parser_data_t * p_parser_data)
+{
+    return p_parser_data->ie_index.count;
+}
+
+/**
+ * @brief Gets an information element iterator pointing to the header IE with the given index.
+ *
+ * @param[in]   p_parser_data   Pointer to a frame parser data.
+ * @param[in]   idx             Index of the header IE, lower than the value returned by
+ *                              @ref nrf_802154_frame_parser_header_ie_count_get.
+ *
+ * @returns  Information element iterator.
+ */
+static inline const uint8_t * nrf_802154_frame_parser_header_ie_get(
+    const nrf_802154_frame_parser_data_t * p_parser_data,
+    uint8_t                                idx)
+{
+    return &p_parser_data->p_frame[p_parser_data->ie_index.offset[idx]];
+}
+
+#endif // NRF_802154_FRAME_PARSER_IE_INDEX_ENABLED
+
 /**
  * @brief Gets vendor-specific OUI (organizationally unique identifier) of currently iterated IE.
  *
@@ -43,6 +43,7 @@
 #include "mac_features/nrf_802154_frame_parser.h"
 #include "mac_features/nrf_802154_delayed_trx.h"
 #include "nrf_802154_core.h"
+#include "nrf_802154_link_quality.h"
 #include "nrf_802154_nrfx_addons.h"
 #include "nrf_802154_tx_work_buffer.h"
 #include "nrf_802154_utils_byteorder.h"
@@ -69,31 +70,63 @@ static uint16_t  m_csl_period;          ///< CSL period value that will be injec
 static uint64_t  m_csl_anchor_time;     ///< The anchor time based on which CSL window times are calculated
 static bool      m_csl_anchor_time_set; ///< Information if CSL anchor time was set by the higher layer
 
+#if NRF_802154_IE_WRITER_CSL_PRECOMPUTE_ENABLED
+static uint32_t m_csl_period_us;           ///< CSL period in microseconds, computed when the period is set
+static uint64_t m_csl_next_midpoint;       ///< Time of the CSL window midpoint computed when the CSL IE write is prepared
+static bool     m_csl_next_midpoint_valid; ///< Information if @ref m_csl_next_midpoint is valid
+#endif
+
+/**
+ * @brief Gets the CSL period in microseconds.
+ */
+static uint32_t csl_period_us_get(void)
+{
+#if NRF_802154_IE_WRITER_CSL_PRECOMPUTE_ENABLED
+    return m_csl_period_us;
+#else
+    return m_csl_period * IE_CSL_SYMBOLS_PER_UNIT * PHY_US_PER_SYMBOL;
+#endif
+}
+
+/**
+ * @brief Calculates the time from @p now to the nearest CSL window midpoint given by the anchor time.
+ *
+ * @param[in]  now            Current time.
+ * @param[in]  csl_period_us  CSL period in microseconds. Must not be 0.
+ *
+ * @return Time to the nearest CSL window midpoint in microseconds.
+ */
+static uint32_t csl_anchor_time_to_midpoint_get(uint64_t now, uint32_t csl_period_us)
+{
+    // Modulo of a negative number possibly will not be positive, so the below if-else clause is needed
+    if (now >= m_csl_anchor_time)
+    {
+        uint32_t time_from_previous_window =
+            (uint32_t)((now - m_csl_anchor_time) % csl_period_us);
+
+        return csl_period_us - time_from_previous_window;
+    }
+    else
+    {
+        return (uint32_t)((m_csl_anchor_time - now) % csl_period_us);
+    }
+}
+
 static bool csl_time_to_nearest_window_midpoint_get(uint32_t * p_time_to_midpoint)
 {
     bool result = false;
 
     if (m_csl_anchor_time_set)
     {
-        result = (m_csl_period != 0);
+        uint32_t csl_period_us = csl_period_us_get();
+
+        result = (csl_period_us != 0);
 
         if (result)
         {
-            uint64_t now           = nrf_802154_sl_timer_current_time_get();
-            uint32_t csl_period_us = m_csl_period * IE_CSL_SYMBOLS_PER_UNIT * PHY_US_PER_SYMBOL;
-
-            // Modulo of a negative number possibly will not be positive, so the below if-else clause is needed
-            if (now >= m_csl_anchor_time)
-            {
-                uint32_t time_from_previous_window =
-                    (uint32_t)((now - m_csl_anchor_time) % csl_period_us);
-
-                *p_time_to_midpoint = csl_period_us - time_from_previous_window;
-            }
-            else
-            {
-                *p_time_to_midpoint = (uint32_t)((m_csl_anchor_time - now) % csl_period_us);
-            }
+            *p_time_to_midpoint =
+                csl_anchor_time_to_midpoint_get(nrf_802154_sl_timer_current_time_get(),
+                                                csl_period_us);
         }
     }
     else
@@ -104,6 +137,60 @@ static bool csl_time_to_nearest_window_midpoint_get(uint32_t * p_time_to_midpoin
     return result;
 }
 
+#if NRF_802154_IE_WRITER_CSL_PRECOMPUTE_ENABLED
+/**
+ * @brief Computes the time of the nearest CSL window midpoint ahead of the transmission.
+ */
+static void csl_next_midpoint_precompute(void)
+{
+    m_csl_next_midpoint_valid = m_csl_anchor_time_set && (m_csl_period_us != 0);
+
+    if (m_csl_next_midpoint_valid)
+    {
+        uint64_t now = nrf_802154_sl_timer_current_time_get();
+
+        m_csl_next_midpoint = now + csl_anchor_time_to_midpoint_get(now, m_csl_period_us);
+    }
+}
+
+/**
+ * @brief Gets the time to the nearest CSL window midpoint using the precomputed midpoint.
+ *
+ * The precomputed midpoint is corrected by one CSL period if it has already passed. Otherwise,
+ * the time is calculated from the anchor time.
+ *
+ * @param[out] p_time_to_midpoint  Time to the nearest CSL window midpoint in microseconds.
+ *
+ * @retval  true   The time has been calculated.
+ * @retval  false  The time could not be calculated.
+ */
+static bool csl_time_to_precomputed_midpoint_get(uint32_t * p_time_to_midpoint)
+{
+    if (!m_csl_next_midpoint_valid)
+    {
+        return csl_time_to_nearest_window_midpoint_get(p_time_to_midpoint);
+    }
+
+    uint64_t now = nrf_802154_sl_timer_current_time_get();
+
+    if (now < m_csl_next_midpoint)
+    {
+        *p_time_to_midpoint = (uint32_t)(m_csl_next_midpoint - now);
+    }
+    else if ((now - m_csl_next_midpoint) < m_csl_period_us)
+    {
+        *p_time_to_midpoint = m_csl_period_us - (uint32_t)(now - m_csl_next_midpoint);
+    }
+    else
+    {
+        return csl_time_to_nearest_window_midpoint_get(p_time_to_midpoint);
+    }
+
+    return true;
+}
+
+#endif // NRF_802154_IE_WRITER_CSL_PRECOMPUTE_ENABLED
+
 /**
  * @brief Writes CSL phase to previously set memory address.
  *
@@ -122,7 +209,13 @@ static void csl_ie_write_commit(bool * p_written)
         return;
     }
 
-    if (csl_time_to_nearest_window_midpoint_get(&time_remaining) == false)
+#if NRF_802154_IE_WRITER_CSL_PRECOMPUTE_ENABLED
+    bool result = csl_time_to_precomputed_midpoint_get(&time_remaining);
+#else
+    bool result = csl_time_to_nearest_window_midpoint_get(&time_remaining);
+#endif
+
+    if (result == false)
     {
         // No delayed DRX is pending. Do not write to the CSL IE.
         return;
@@ -171,6 +264,10 @@ static bool csl_ie_write_prepare(const uint8_t * p_iterator)
     mp_csl_phase_addr  = (uint8_t *)nrf_802154_frame_parser_ie_content_address_get(p_iterator);
     mp_csl_period_addr = mp_csl_phase_addr + sizeof(uint16_t);
 
+#if NRF_802154_IE_WRITER_CSL_PRECOMPUTE_ENABLED
+    csl_next_midpoint_precompute();
+#endif
+
     return true;
 }
 
@@ -269,9 +366,17 @@ static uint8_t margin_scale(int16_t margin)
  */
 static void link_metrics_ie_write_commit(bool * p_written)
 {
+    int8_t  rssi = (uint8_t)nrf_802154_core_last_frame_rssi_get();
+    uint8_t lqi  = (uint8_t)nrf_802154_core_last_frame_lqi_get();
+
+#if NRF_802154_LINK_QUALITY_IE_AVERAGED_ENABLED
+    // Report the averages of the peer if it is tracked. Its averages already include the frame
+    // being acknowledged.
+    (void)nrf_802154_link_quality_last_peer_get(&rssi, &lqi);
+#endif
+
     if ((mp_lm_rssi_addr != NULL) || (mp_lm_margin_addr != NULL))
     {
-        int8_t rssi = (uint8_t)nrf_802154_core_last_frame_rssi_get();
 
         if (mp_lm_rssi_addr != NULL)
         {
@@ -288,7 +393,7 @@ static void link_metrics_ie_write_commit(bool * p_written)
 
     if (mp_lm_lqi_addr != NULL)
     {
-        *mp_lm_lqi_addr = (uint8_t)nrf_802154_core_last_frame_lqi_get();
+        *mp_lm_lqi_addr = lqi;
         *p_written      = true;
     }
 }
@@ -375,6 +480,40 @@ static void ie_writer_reset(void)
     link_metrics_ie_write_reset();
 }
 
+/**
+ * @brief Prepares the write operation for a single information element.
+ *
+ * @param[in]  p_iterator  Information Element parser iterator.
+ *
+ * @retval  true   The IE is not recognized or its write preparation was successful.
+ * @retval  false  An improperly formatted IE was detected.
+ */
+static bool ie_write_prepare(const uint8_t * p_iterator)
+{
+    switch (nrf_802154_frame_parser_ie_id_get(p_iterator))
+    {
+        case IE_VENDOR_ID:
+            if (nrf_802154_frame_parser_ie_length_get(p_iterator) >= IE_VENDOR_SIZE_MIN &&
+                nrf_802154_frame_parser_ie_vendor_oui_get(p_iterator) == IE_VENDOR_THREAD_OUI)
+            {
+                if (nrf_802154_frame_parser_ie_length_get(p_iterator) >=
+                    IE_VENDOR_THREAD_SIZE_MIN &&
+                    nrf_802154_frame_parser_ie_vendor_thread_subtype_get(p_iterator) ==
+                    IE_VENDOR_THREAD_ACK_PROBING_ID)
+                {
+                    return link_metrics_ie_write_prepare(p_iterator);
+                }
+            }
+            return true;
+
+        case IE_CSL_ID:
+            return csl_ie_write_prepare(p_iterator);
+
+        default:
+            return true;
+    }
+}
+
 /**
  * @brief Performs IE write preparations.
  *
@@ -393,44 +532,47 @@ static void ie_writer_prepare(uint8_t * p_ie_header, const uint8_t * p_end_addr)
     m_writer_state = IE_WRITER_PREPARE;
 
     const uint8_t * p_iterator = nrf_802154_frame_parser_header_ie_iterator_begin(p_ie_header);
-    bool            result     = true;
 
     while (nrf_802154_frame_parser_ie_iterator_end(p_iterator, p_end_addr) == false)
     {
-        switch (nrf_802154_frame_parser_ie_id_get(p_iterator))
+        if (!ie_write_prepare(p_iterator))
         {
-            case IE_VENDOR_ID:
-                if (nrf_802154_frame_parser_ie_length_get(p_iterator) >= IE_VENDOR_SIZE_MIN &&
-                    nrf_802154_frame_parser_ie_vendor_oui_get(p_iterator) == IE_VENDOR_THREAD_OUI)
-                {
-                    if (nrf_802154_frame_parser_ie_length_get(p_iterator) >=
-                        IE_VENDOR_THREAD_SIZE_MIN &&
-                        nrf_802154_frame_parser_ie_vendor_thread_subtype_get(p_iterator) ==
-                        IE_VENDOR_THREAD_ACK_PROBING_ID)
-                    {
-                        result = link_metrics_ie_write_prepare(p_iterator);
-                    }
-                }
-                break;
+            ie_writer_reset();
+            return;
+        }
 
-            case IE_CSL_ID:
-                result = csl_ie_write_prepare(p_iterator);
-                break;
+        p_iterator = nrf_802154_frame_parser_ie_iterator_next(p_iterator);
+    }
+}
 
-            default:
-                break;
-        }
+#if NRF_802154_FRAME_PARSER_IE_INDEX_ENABLED
+/**
+ * @brief Performs IE write preparations using the header IE index of a parsed frame.
+ *
+ * This function is equivalent to @ref ie_writer_prepare, but visits the IEs recorded by
+ * the frame parser instead of walking the IE chain.
+ *
+ * @param[in]  p_frame_data  Pointer to the parser data of a frame with a complete IE index.
+ */
+static void ie_writer_indexed_prepare(const nrf_802154_frame_parser_data_t * p_frame_data)
+{
+    assert(m_writer_state == IE_WRITER_RESET);
+    m_writer_state = IE_WRITER_PREPARE;
 
-        if (result == false)
+    uint8_t count = nrf_802154_frame_parser_header_ie_count_get(p_frame_data);
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        if (!ie_write_prepare(nrf_802154_frame_parser_header_ie_get(p_frame_data, i)))
         {
             ie_writer_reset();
             return;
         }
-
-        p_iterator = nrf_802154_frame_parser_ie_iterator_next(p_iterator);
     }
 }
 
+#endif
+
 /**
  * @brief Commits data to recognized information elements.
  *
@@ -455,6 +597,34 @@ void nrf_802154_ie_writer_prepare(uint8_t * p_ie_header, const uint8_t * p_end_a
     ie_writer_prepare(p_ie_header, p_end_addr);
 }
 
+void nrf_802154_ie_writer_frame_prepare(const nrf_802154_frame_parser_data_t * p_frame_data)
+{
+    const uint8_t * p_ie_header = nrf_802154_frame_parser_ie_header_get(p_frame_data);
+    const uint8_t * p_end_addr;
+
+    assert(nrf_802154_frame_parser_parse_level_get(p_frame_data) >= PARSE_LEVEL_FULL);
+
+    ie_writer_reset();
+
+    if (p_ie_header == NULL)
+    {
+        return;
+    }
+
+#if NRF_802154_FRAME_PARSER_IE_INDEX_ENABLED
+    if (nrf_802154_frame_parser_header_ie_index_is_complete(p_frame_data))
+    {
+        ie_writer_indexed_prepare(p_frame_data);
+        return;
+    }
+#endif
+
+    p_end_addr = nrf_802154_frame_parser_mfr_get(p_frame_data) -
+                 nrf_802154_frame_parser_mic_size_get(p_frame_data);
+
+    ie_writer_prepare((uint8_t *)p_ie_header, p_end_addr);
+}
+
 bool nrf_802154_ie_writer_tx_setup(
     uint8_t                                 * p_frame,
     nrf_802154_transmit_params_t            * p_params,
@@ -468,28 +638,12 @@ bool nrf_802154_ie_writer_tx_setup(
         return true;
     }
 
-    const uint8_t * p_mfr_addr;
-    uint8_t       * p_ie_header;
-
-    nrf_802154_frame_parser_data_t frame_data;
-
-    bool result = nrf_802154_frame_parser_data_init(p_frame,
-                                                    p_frame[PHR_OFFSET] + PHR_SIZE,
-                                                    PARSE_LEVEL_FULL,
-                                                    &frame_data);
+    const nrf_802154_frame_parser_data_t * p_frame_data =
+        nrf_802154_frame_parser_tx_data_get(p_frame, PARSE_LEVEL_FULL);
 
-    assert(result);
-    (void)result;
+    assert(p_frame_data != NULL);
 
-    p_ie_header = (uint8_t *)nrf_802154_frame_parser_ie_header_get(&frame_data);
-    p_mfr_addr  = nrf_802154_frame_parser_mfr_get(&frame_data);
-
-    if (p_ie_header == NULL)
-    {
-        return true;
-    }
-
-    nrf_802154_ie_writer_prepare(p_ie_header, p_mfr_addr);
+    nrf_802154_ie_writer_frame_prepare(p_frame_data);
 
     return true;
 }
@@ -541,12 +695,21 @@ void nrf_802154_ie_writer_tx_ack_started_hook(uint8_t * p_ack)
 void nrf_802154_ie_writer_csl_period_set(uint16_t period)
 {
     m_csl_period = period;
+
+#if NRF_802154_IE_WRITER_CSL_PRECOMPUTE_ENABLED
+    m_csl_period_us           = period * IE_CSL_SYMBOLS_PER_UNIT * PHY_US_PER_SYMBOL;
+    m_csl_next_midpoint_valid = false;
+#endif
 }
 
 void nrf_802154_ie_writer_csl_anchor_time_set(uint64_t anchor_time)
 {
     m_csl_anchor_time     = anchor_time;
     m_csl_anchor_time_set = true;
+
+#if NRF_802154_IE_WRITER_CSL_PRECOMPUTE_ENABLED
+    m_csl_next_midpoint_valid = false;
+#endif
 }
 
 #endif // NRF_802154_DELAYED_TRX_ENABLED
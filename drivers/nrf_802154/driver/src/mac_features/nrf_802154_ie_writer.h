@@ -38,6 +38,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+#include "mac_features/nrf_802154_frame_parser.h"
 #include "nrf_802154_types_internal.h"
 
 /**
@@ -69,6 +70,18 @@
  */
 void nrf_802154_ie_writer_prepare(uint8_t * p_ie_header, const uint8_t * p_end_addr);
 
+/**
+ * @brief Prepares to write Information Element data to all elements recognized by the module
+ *        in a parsed frame.
+ *
+ * This function behaves like @ref nrf_802154_ie_writer_prepare for the header IEs of the frame.
+ * If the frame parser holds a complete header IE index of the frame, the recognized elements
+ * are found through the index instead of walking the IE chain.
+ *
+ * @param[in]  p_frame_data  Pointer to the parser data of a frame parsed to @ref PARSE_LEVEL_FULL.
+ */
+void nrf_802154_ie_writer_frame_prepare(const nrf_802154_frame_parser_data_t * p_frame_data);
+
 /**
  * @brief Transmission setup hook for the IE writer module.
  *
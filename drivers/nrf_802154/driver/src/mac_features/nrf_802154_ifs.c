@@ -140,19 +140,16 @@ static void callback_fired(nrf_802154_sl_timer_t * p_timer)
 /**@brief Checks if the IFS is needed by comparing the addresses of the actual and the last frames. */
 static bool is_ifs_needed_by_address(const uint8_t * p_frame)
 {
-    nrf_802154_frame_parser_data_t frame_data;
-    const uint8_t                * addr;
-    bool                           is_extended;
+    const uint8_t * addr;
+    bool            is_extended;
 
-    bool result = nrf_802154_frame_parser_data_init(p_frame,
-                                                    p_frame[PHR_OFFSET] + PHR_SIZE,
-                                                    PARSE_LEVEL_ADDRESSING_END,
-                                                    &frame_data);
+    const nrf_802154_frame_parser_data_t * p_frame_data =
+        nrf_802154_frame_parser_tx_data_get(p_frame, PARSE_LEVEL_ADDRESSING_END);
 
-    if (result)
+    if (p_frame_data != NULL)
     {
-        addr        = nrf_802154_frame_parser_dst_addr_get(&frame_data);
-        is_extended = nrf_802154_frame_parser_dst_addr_is_extended(&frame_data);
+        addr        = nrf_802154_frame_parser_dst_addr_get(p_frame_data);
+        is_extended = nrf_802154_frame_parser_dst_addr_is_extended(p_frame_data);
     }
     else
     {
@@ -300,18 +297,15 @@ void nrf_802154_ifs_transmitted_hook(const uint8_t * p_frame)
 
     m_last_frame_timestamp = nrf_802154_sl_timer_current_time_get();
 
-    nrf_802154_frame_parser_data_t frame_data;
-    const uint8_t                * addr;
+    const uint8_t * addr;
 
-    bool result = nrf_802154_frame_parser_data_init(p_frame,
-                                                    p_frame[PHR_OFFSET] + PHR_SIZE,
-                                                    PARSE_LEVEL_ADDRESSING_END,
-                                                    &frame_data);
+    const nrf_802154_frame_parser_data_t * p_frame_data =
+        nrf_802154_frame_parser_tx_data_get(p_frame, PARSE_LEVEL_ADDRESSING_END);
 
-    if (result)
+    if (p_frame_data != NULL)
     {
-        addr                       = nrf_802154_frame_parser_dst_addr_get(&frame_data);
-        m_is_last_address_extended = nrf_802154_frame_parser_dst_addr_is_extended(&frame_data);
+        addr                       = nrf_802154_frame_parser_dst_addr_get(p_frame_data);
+        m_is_last_address_extended = nrf_802154_frame_parser_dst_addr_is_extended(p_frame_data);
     }
     else
     {
@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @file
+ *   This file implements indirect transmission of frames to sleepy devices for the 802.15.4
+ *   driver.
+ *
+ */
+
+#include "nrf_802154_indirect_tx.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_request.h"
+#include "nrf_802154_sl_atomics.h"
+
+#if NRF_802154_INDIRECT_TX_ENABLED
+
+#if !NRF_802154_CSMA_CA_ENABLED
+#error "NRF_802154_INDIRECT_TX_ENABLED requires NRF_802154_CSMA_CA_ENABLED"
+#endif
+
+/** @brief States of an indirect queue entry. */
+typedef enum
+{
+    ENTRY_STATE_FREE,    ///< The entry is unused.
+    ENTRY_STATE_WRITING, ///< The entry is being filled in by @ref nrf_802154_indirect_tx_frame_add.
+    ENTRY_STATE_READY,   ///< The entry holds a frame waiting for a MAC Data Request.
+    ENTRY_STATE_SENDING, ///< The transmission of the frame from the entry is being started.
+} entry_state_t;
+
+/**
+ * @brief Entry of the indirect queue.
+ */
+typedef struct
+{
+    uint8_t                                addr[EXTENDED_ADDRESS_SIZE]; ///< Address of the destination device.
+    uint8_t                                addr_size;                   ///< Size of the address of the destination device.
+    uint8_t                                state;                       ///< State of the entry, see @ref entry_state_t.
+    uint32_t                               seq;                         ///< Sequence number determining the order of queued frames.
+    uint8_t                              * p_data;                      ///< Pointer to a buffer that contains PHR and PSDU of the frame.
+    nrf_802154_transmit_csma_ca_metadata_t metadata;                    ///< CSMA-CA metadata of the frame transmission.
+} indirect_entry_t;
+
+static indirect_entry_t m_queue[NRF_802154_INDIRECT_TX_QUEUE_SIZE]; ///< Indirect queue entries.
+static uint32_t         m_seq;                                      ///< Sequence number of the last queued frame.
+
+/**
+ * @brief Finds the oldest frame queued for the source of the given MAC Data Request command.
+ *
+ * @param[in]  p_frame_data  Pointer to the parser data of the received frame.
+ *
+ * @returns  Pointer to the entry of the oldest matching frame or NULL if there is none.
+ */
+static indirect_entry_t * entry_find(const nrf_802154_frame_parser_data_t * p_frame_data)
+{
+    const uint8_t    * p_cmd      = nrf_802154_frame_parser_mac_command_id_get(p_frame_data);
+    const uint8_t    * p_src_addr = nrf_802154_frame_parser_src_addr_get(p_frame_data);
+    indirect_entry_t * p_result   = NULL;
+    uint8_t            addr_size;
+
+    if ((p_cmd == NULL) || (*p_cmd != MAC_CMD_DATA_REQ) || (p_src_addr == NULL))
+    {
+        return NULL;
+    }
+
+    addr_size = nrf_802154_frame_parser_src_addr_is_extended(p_frame_data) ?
+                EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
+
+    for (uint32_t i = 0; i < NRF_802154_INDIRECT_TX_QUEUE_SIZE; i++)
+    {
+        indirect_entry_t * p_entry = &m_queue[i];
+
+        if ((nrf_802154_sl_atomic_load_u8(&p_entry->state) != ENTRY_STATE_READY) ||
+            (p_entry->addr_size != addr_size) ||
+            (memcmp(p_entry->addr, p_src_addr, addr_size) != 0))
+        {
+            continue;
+        }
+
+        if ((p_result == NULL) || ((int32_t)(p_entry->seq - p_result->seq) < 0))
+        {
+            p_result = p_entry;
+        }
+    }
+
+    return p_result;
+}
+
+void nrf_802154_indirect_tx_init(void)
+{
+    memset(m_queue, 0, sizeof(m_queue));
+    m_seq = 0;
+}
+
+bool nrf_802154_indirect_tx_frame_add(const uint8_t                                * p_addr,
+                                      bool                                           extended,
+                                      uint8_t                                      * p_data,
+                                      const nrf_802154_transmit_csma_ca_metadata_t * p_metadata)
+{
+    for (uint32_t i = 0; i < NRF_802154_INDIRECT_TX_QUEUE_SIZE; i++)
+    {
+        indirect_entry_t * p_entry  = &m_queue[i];
+        uint8_t            expected = ENTRY_STATE_FREE;
+
+        if (!nrf_802154_sl_atomic_cas_u8(&p_entry->state, &expected, ENTRY_STATE_WRITING))
+        {
+            continue;
+        }
+
+        p_entry->addr_size = extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
+        memcpy(p_entry->addr, p_addr, p_entry->addr_size);
+        p_entry->seq      = ++m_seq;
+        p_entry->p_data   = p_data;
+        p_entry->metadata = *p_metadata;
+
+        nrf_802154_sl_atomic_store_u8(&p_entry->state, ENTRY_STATE_READY);
+
+        return true;
+    }
+
+    return false;
+}
+
+bool nrf_802154_indirect_tx_frame_remove(const uint8_t * p_data)
+{
+    for (uint32_t i = 0; i < NRF_802154_INDIRECT_TX_QUEUE_SIZE; i++)
+    {
+        indirect_entry_t * p_entry  = &m_queue[i];
+        uint8_t            expected = ENTRY_STATE_READY;
+
+        if ((p_entry->p_data == p_data) &&
+            nrf_802154_sl_atomic_cas_u8(&p_entry->state, &expected, ENTRY_STATE_FREE))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool nrf_802154_indirect_tx_frame_pending(const nrf_802154_frame_parser_data_t * p_frame_data)
+{
+    return entry_find(p_frame_data) != NULL;
+}
+
+void nrf_802154_indirect_tx_ack_transmitted_hook(
+    const nrf_802154_frame_parser_data_t * p_frame_data,
+    const uint8_t                        * p_ack)
+{
+    indirect_entry_t * p_entry;
+    uint8_t            expected = ENTRY_STATE_READY;
+
+    if ((p_ack[FRAME_PENDING_OFFSET] & FRAME_PENDING_BIT) == 0)
+    {
+        return;
+    }
+
+    p_entry = entry_find(p_frame_data);
+
+    if ((p_entry == NULL) ||
+        !nrf_802154_sl_atomic_cas_u8(&p_entry->state, &expected, ENTRY_STATE_SENDING))
+    {
+        return;
+    }
+
+    if (nrf_802154_request_csma_ca_start(p_entry->p_data, &p_entry->metadata))
+    {
+        // From now on the frame is handled as any other CSMA-CA transmission.
+        nrf_802154_sl_atomic_store_u8(&p_entry->state, ENTRY_STATE_FREE);
+    }
+    else
+    {
+        // Another CSMA-CA procedure is ongoing. Keep the frame for the next MAC Data Request.
+        nrf_802154_sl_atomic_store_u8(&p_entry->state, ENTRY_STATE_READY);
+    }
+}
+
+#endif // NRF_802154_INDIRECT_TX_ENABLED
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @brief Module that transmits frames queued for sleepy devices on their MAC Data Requests.
+ *
+ */
+
+#ifndef NRF_802154_INDIRECT_TX_H_
+#define NRF_802154_INDIRECT_TX_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_types.h"
+#include "mac_features/nrf_802154_frame_parser.h"
+
+/**
+ * @defgroup nrf_802154_indirect_tx Indirect transmission
+ * @{
+ * @ingroup nrf_802154
+ * @brief Indirect transmission of frames to sleepy devices.
+ *
+ * Frames are queued together with the address of the device they are destined for. When a MAC
+ * Data Request command is received from that device, the driver sets the pending bit in the ACK
+ * frame and starts the CSMA-CA transmission of the oldest queued frame right after the ACK is
+ * transmitted, without waiting for the higher layer.
+ */
+
+/**
+ * @brief Initializes the indirect transmission module.
+ */
+void nrf_802154_indirect_tx_init(void);
+
+/**
+ * @brief Queues a frame to be transmitted on a MAC Data Request from the given device.
+ *
+ * @param[in]  p_addr      Array of bytes containing the address of the device (little-endian).
+ * @param[in]  extended    If the given address is an extended MAC address or a short MAC address.
+ * @param[in]  p_data      Pointer to a buffer that contains PHR and PSDU of the frame.
+ * @param[in]  p_metadata  Pointer to the CSMA-CA metadata of the frame transmission.
+ *
+ * @retval  true   The frame is queued.
+ * @retval  false  The queue is full.
+ */
+bool nrf_802154_indirect_tx_frame_add(const uint8_t                                * p_addr,
+                                      bool                                           extended,
+                                      uint8_t                                      * p_data,
+                                      const nrf_802154_transmit_csma_ca_metadata_t * p_metadata);
+
+/**
+ * @brief Removes a queued frame whose transmission has not been started yet.
+ *
+ * @param[in]  p_data  Pointer to a buffer that contains PHR and PSDU of the frame.
+ *
+ * @retval  true   The frame is removed from the queue.
+ * @retval  false  The frame is not in the queue.
+ */
+bool nrf_802154_indirect_tx_frame_remove(const uint8_t * p_data);
+
+/**
+ * @brief Checks if a frame is queued for the source of the received MAC Data Request command.
+ *
+ * @note This function must be called from the RADIO interrupt context.
+ *
+ * @param[in]  p_frame_data  Pointer to the parser data of the received frame.
+ *
+ * @retval  true   The received frame is a MAC Data Request and a frame is queued for its source.
+ * @retval  false  Otherwise.
+ */
+bool nrf_802154_indirect_tx_frame_pending(const nrf_802154_frame_parser_data_t * p_frame_data);
+
+/**
+ * @brief Starts the transmission of the frame queued for the source of the received frame.
+ *
+ * The transmission is started only if the received frame is a MAC Data Request command and
+ * the transmitted ACK frame has the pending bit set.
+ *
+ * @note This function must be called from the RADIO interrupt context, after the ACK frame is
+ *       transmitted.
+ *
+ * @param[in]  p_frame_data  Pointer to the parser data of the received frame.
+ * @param[in]  p_ack         Pointer to a buffer that contains PHR and PSDU of the transmitted ACK.
+ */
+void nrf_802154_indirect_tx_ack_transmitted_hook(
+    const nrf_802154_frame_parser_data_t * p_frame_data,
+    const uint8_t                        * p_ack);
+
+/**
+ *@}
+ **/
+
+#endif // NRF_802154_INDIRECT_TX_H_
@@ -46,7 +46,10 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "../nrf_802154_ant_div_tx.h"
+#include "../nrf_802154_core_hooks.h"
 #include "../nrf_802154_debug.h"
+#include "nrf_802154_csma_ca.h"
 #include "nrf_802154_notification.h"
 #include "nrf_802154_procedures_duration.h"
 #include "nrf_802154_request.h"
@@ -58,6 +61,12 @@
 #define RETRY_DELAY     500     ///< Procedure is delayed by this time if it cannot be performed at the moment [us].
 #define MAX_RETRY_DELAY 1000000 ///< Maximum allowed delay of procedure retry [us].
 
+#if NRF_802154_ACK_TIMEOUT_HW_ENABLED
+#define HW_BACKSTOP_DELAY 100 ///< Extension of the software timeout when the window is enforced by hardware [us].
+#else
+#define HW_BACKSTOP_DELAY 0
+#endif
+
 static void timeout_timer_retry(void);
 
 static uint32_t              m_timeout = NRF_802154_PRECISE_ACK_TIMEOUT_DEFAULT_TIMEOUT; ///< ACK timeout in us.
@@ -73,7 +82,16 @@ static void notify_tx_error(bool result)
         // If waiting for ack timeout occurred, the transmission must had already finished.
         nrf_802154_transmit_done_metadata_t metadata = {0};
 
+        nrf_802154_ant_div_tx_no_ack_record();
+
         nrf_802154_tx_work_buffer_original_frame_update(mp_frame, &metadata.frame_props);
+
+        if (!nrf_802154_core_hooks_tx_outcome(mp_frame, NRF_802154_TX_ERROR_NO_ACK, &metadata))
+        {
+            // The frame is being retransmitted.
+            return;
+        }
+
         nrf_802154_notify_transmit_failed(mp_frame, NRF_802154_TX_ERROR_NO_ACK, &metadata);
     }
 }
@@ -124,7 +142,8 @@ static void timeout_timer_start(void)
 
     m_dt = m_timeout +
            IMM_ACK_DURATION +
-           nrf_802154_frame_duration_get(mp_frame[0], false, true);
+           nrf_802154_frame_duration_get(mp_frame[0], false, true) +
+           HW_BACKSTOP_DELAY;
 
     m_timer.action_type              = NRF_802154_SL_TIMER_ACTION_TYPE_CALLBACK;
     m_timer.action.callback.callback = timeout_timer_fired;
@@ -176,6 +195,11 @@ bool nrf_802154_ack_timeout_tx_started_hook(uint8_t * p_frame)
     return true;
 }
 
+uint32_t nrf_802154_ack_timeout_hw_window_get(void)
+{
+    return m_timeout + IMM_ACK_DURATION;
+}
+
 bool nrf_802154_ack_timeout_abort(nrf_802154_term_t term_lvl, req_originator_t req_orig)
 {
     bool result;
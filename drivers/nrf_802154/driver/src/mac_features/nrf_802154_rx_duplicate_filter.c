@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements detection of retransmitted frames for the 802.15.4 driver.
+ *
+ */
+
+#include "nrf_802154_rx_duplicate_filter.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+
+#if NRF_802154_RX_DUPLICATE_FILTER_ENABLED
+
+/**
+ * @brief Entry of the duplicate frame detection cache.
+ */
+typedef struct
+{
+    uint8_t addr[EXTENDED_ADDRESS_SIZE]; ///< Source address of the last frame from the source.
+    uint8_t addr_size;                   ///< Size of the source address. 0 if the entry is unused.
+    uint8_t dsn;                         ///< DSN of the last frame from the source.
+} rx_duplicate_entry_t;
+
+/// Cache entries ordered from the most to the least recently seen source.
+static rx_duplicate_entry_t m_cache[NRF_802154_RX_DUPLICATE_FILTER_CACHE_SIZE];
+
+/**
+ * @brief Moves the entry with the given index to the front of the cache.
+ *
+ * @param[in]  index  Index of the entry to be moved.
+ *
+ * @returns  Pointer to the moved entry.
+ */
+static rx_duplicate_entry_t * entry_promote(uint32_t index)
+{
+    rx_duplicate_entry_t entry = m_cache[index];
+
+    memmove(&m_cache[1], &m_cache[0], index * sizeof(m_cache[0]));
+    m_cache[0] = entry;
+
+    return &m_cache[0];
+}
+
+void nrf_802154_rx_duplicate_filter_init(void)
+{
+    memset(m_cache, 0, sizeof(m_cache));
+}
+
+bool nrf_802154_rx_duplicate_filter_check(const nrf_802154_frame_parser_data_t * p_frame_data)
+{
+    if ((nrf_802154_frame_parser_parse_level_get(p_frame_data) < PARSE_LEVEL_ADDRESSING_END) ||
+        !nrf_802154_frame_parser_ar_bit_is_set(p_frame_data))
+    {
+        return false;
+    }
+
+    const uint8_t * p_dsn       = nrf_802154_frame_parser_dsn_get(p_frame_data);
+    const uint8_t * p_src_addr  = nrf_802154_frame_parser_src_addr_get(p_frame_data);
+    uint8_t         src_addr_sz = nrf_802154_frame_parser_src_addr_size_get(p_frame_data);
+
+    if ((p_dsn == NULL) || (p_src_addr == NULL) || (src_addr_sz == 0U))
+    {
+        return false;
+    }
+
+    // If the source is not cached, the least recently seen entry is reused.
+    uint32_t index        = NRF_802154_RX_DUPLICATE_FILTER_CACHE_SIZE - 1U;
+    bool     source_found = false;
+
+    for (uint32_t i = 0; i < NRF_802154_RX_DUPLICATE_FILTER_CACHE_SIZE; i++)
+    {
+        if ((m_cache[i].addr_size == src_addr_sz) &&
+            (memcmp(m_cache[i].addr, p_src_addr, src_addr_sz) == 0))
+        {
+            index        = i;
+            source_found = true;
+            break;
+        }
+    }
+
+    rx_duplicate_entry_t * p_entry = entry_promote(index);
+
+    if (source_found && (p_entry->dsn == *p_dsn))
+    {
+        return true;
+    }
+
+    memcpy(p_entry->addr, p_src_addr, src_addr_sz);
+    p_entry->addr_size = src_addr_sz;
+    p_entry->dsn       = *p_dsn;
+
+    return false;
+}
+
+#endif // NRF_802154_RX_DUPLICATE_FILTER_ENABLED
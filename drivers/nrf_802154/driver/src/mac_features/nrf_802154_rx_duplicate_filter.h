@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Module that detects retransmitted frames in the 802.15.4 driver receive path.
+ *
+ */
+
+#ifndef NRF_802154_RX_DUPLICATE_FILTER_H_
+#define NRF_802154_RX_DUPLICATE_FILTER_H_
+
+#include <stdbool.h>
+
+#include "mac_features/nrf_802154_frame_parser.h"
+
+/**
+ * @defgroup nrf_802154_rx_duplicate_filter Duplicate frame detection
+ * @{
+ * @ingroup nrf_802154
+ * @brief Detection of retransmitted frames in the receive path.
+ *
+ * The module keeps a small cache of the most recently seen sources together with the DSN of
+ * the last frame received from each of them. Only frames with the Acknowledgement Request bit
+ * set are considered, as only those are retransmitted by the MAC layer.
+ */
+
+/**
+ * @brief Initializes the duplicate frame detection module.
+ */
+void nrf_802154_rx_duplicate_filter_init(void);
+
+/**
+ * @brief Checks if the received frame is a retransmission of the last frame from its source.
+ *
+ * If the frame is not a duplicate, its source address and DSN are stored in the cache, replacing
+ * the least recently seen source if the cache is full.
+ *
+ * @note This function must be called from the RADIO interrupt context.
+ *
+ * @param[in]  p_frame_data  Pointer to the parser data of the received frame.
+ *
+ * @retval  true   The frame is a duplicate of the last frame received from its source.
+ * @retval  false  The frame is not a duplicate or cannot be checked.
+ */
+bool nrf_802154_rx_duplicate_filter_check(const nrf_802154_frame_parser_data_t * p_frame_data);
+
+/**
+ *@}
+ **/
+
+#endif // NRF_802154_RX_DUPLICATE_FILTER_H_
@@ -0,0 +1,282 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the persistence of the MAC Global Frame Counter in flash.
+ *
+ * The reservations are stored as consecutive words in a ring of
+ * @ref NRF_802154_SECURITY_FC_PERSIST_PAGES flash pages. The largest stored word is the current
+ * reservation. A page is erased before the first reservation is written to it, while the previous
+ * page still holds the current reservation.
+ *
+ */
+
+#include "nrf_802154_security_fc_persist.h"
+
+#if NRF_802154_SECURITY_FC_PERSIST_ENABLED
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_security_pib.h"
+#include "nrf_802154_utils.h"
+#include "nrfx_nvmc.h"
+
+#ifndef NRF_802154_SECURITY_FC_PERSIST_ADDRESS
+#error "NRF_802154_SECURITY_FC_PERSIST_ADDRESS must be defined to persist the frame counter"
+#endif
+
+#if NRF_802154_SECURITY_FC_PERSIST_PAGES < 2
+#error "NRF_802154_SECURITY_FC_PERSIST_PAGES must be at least 2"
+#endif
+
+#if NRF_802154_SECURITY_FC_PERSIST_RESERVATION < 2
+#error "NRF_802154_SECURITY_FC_PERSIST_RESERVATION must be at least 2"
+#endif
+
+#define RECORD_ERASED 0xFFFFFFFFUL ///< Value of an erased flash word.
+
+static volatile uint32_t m_limit;       ///< Stored reservation.
+static uint32_t          m_last_fc;     ///< Last value of the Global Frame Counter passed to the module.
+static uint32_t          m_record;      ///< Reservation being written.
+static uint32_t          m_record_addr; ///< Address at which the next reservation is written.
+static bool              m_busy;        ///< If a reservation is being written.
+static nrfx_nvmc_job_t   m_erase_job;   ///< Job erasing the page of the next reservation.
+static nrfx_nvmc_job_t   m_write_job;   ///< Job writing the next reservation.
+
+/**
+ * @brief Gets the size of the flash region holding the reservations.
+ *
+ * @return Size of the region in bytes.
+ */
+static uint32_t region_size_get(void)
+{
+    return nrfx_nvmc_flash_page_size_get() * NRF_802154_SECURITY_FC_PERSIST_PAGES;
+}
+
+/**
+ * @brief Gets the address following a given address in the ring of reservations.
+ *
+ * @param[in]  addr  Address of a reservation.
+ *
+ * @return Address of the next reservation.
+ */
+static uint32_t record_addr_next(uint32_t addr)
+{
+    addr += sizeof(uint32_t);
+
+    if (addr >= NRF_802154_SECURITY_FC_PERSIST_ADDRESS + region_size_get())
+    {
+        addr = NRF_802154_SECURITY_FC_PERSIST_ADDRESS;
+    }
+
+    return addr;
+}
+
+/**
+ * @brief Checks if a given address is the first word of a flash page.
+ *
+ * @param[in]  addr  Address to check.
+ *
+ * @retval  true   @p addr is aligned to the flash page size.
+ * @retval  false  @p addr is not aligned to the flash page size.
+ */
+static bool page_start_check(uint32_t addr)
+{
+    uint32_t offset = addr - NRF_802154_SECURITY_FC_PERSIST_ADDRESS;
+
+    return (offset % nrfx_nvmc_flash_page_size_get()) == 0U;
+}
+
+static void renewal_check(uint32_t frame_counter);
+
+/**
+ * @brief Handles the completion of a reservation write.
+ *
+ * @param[in]  p_job      Pointer to the completed job.
+ * @param[in]  p_context  Unused context.
+ */
+static void write_job_handler(nrfx_nvmc_job_t * p_job, void * p_context)
+{
+    (void)p_job;
+    (void)p_context;
+
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    m_limit       = m_record;
+    m_record_addr = record_addr_next(m_record_addr);
+    m_busy        = false;
+
+    // The frame counter may have advanced while the job was pending.
+    renewal_check(m_last_fc);
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+/**
+ * @brief Submits the write of a new reservation.
+ *
+ * Must be called with the MCU critical section held and no write pending.
+ *
+ * @param[in]  limit  Reservation to write.
+ */
+static void reservation_write(uint32_t limit)
+{
+    if (!page_start_check(m_record_addr) &&
+        !nrfx_nvmc_word_writable_check(m_record_addr, limit))
+    {
+        // The rest of the page was not erased. Move to the next page.
+        do
+        {
+            m_record_addr = record_addr_next(m_record_addr);
+        }
+        while (!page_start_check(m_record_addr));
+    }
+
+    m_busy   = true;
+    m_record = limit;
+
+    if (page_start_check(m_record_addr))
+    {
+        m_erase_job.type      = NRFX_NVMC_JOB_ERASE;
+        m_erase_job.address   = m_record_addr;
+        m_erase_job.count     = 1U;
+        m_erase_job.handler   = NULL;
+        m_erase_job.p_context = NULL;
+
+        nrfx_err_t err = nrfx_nvmc_job_submit(&m_erase_job);
+
+        assert(err == NRFX_SUCCESS);
+        (void)err;
+    }
+
+    m_write_job.type      = NRFX_NVMC_JOB_WRITE;
+    m_write_job.address   = m_record_addr;
+    m_write_job.p_src     = &m_record;
+    m_write_job.count     = 1U;
+    m_write_job.handler   = write_job_handler;
+    m_write_job.p_context = NULL;
+
+    nrfx_err_t err = nrfx_nvmc_job_submit(&m_write_job);
+
+    assert(err == NRFX_SUCCESS);
+    (void)err;
+}
+
+/**
+ * @brief Renews the reservation if less than half of it is left.
+ *
+ * Must be called with the MCU critical section held.
+ *
+ * @param[in]  frame_counter  Next value of the Global Frame Counter to be used.
+ */
+static void renewal_check(uint32_t frame_counter)
+{
+    uint32_t limit = m_limit;
+
+    if (m_busy || (limit == UINT32_MAX) ||
+        ((frame_counter < limit) &&
+         (limit - frame_counter > NRF_802154_SECURITY_FC_PERSIST_RESERVATION / 2U)))
+    {
+        return;
+    }
+
+    uint32_t new_limit = UINT32_MAX;
+
+    if (frame_counter < UINT32_MAX - NRF_802154_SECURITY_FC_PERSIST_RESERVATION)
+    {
+        new_limit = frame_counter + NRF_802154_SECURITY_FC_PERSIST_RESERVATION;
+    }
+
+    reservation_write(new_limit);
+}
+
+void nrf_802154_security_fc_persist_init(void)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    if (!m_busy)
+    {
+        uint32_t limit = 0U;
+        uint32_t addr  = NRF_802154_SECURITY_FC_PERSIST_ADDRESS;
+
+        m_record_addr = NRF_802154_SECURITY_FC_PERSIST_ADDRESS;
+
+        for (uint32_t i = 0U; i < region_size_get() / sizeof(uint32_t); i++)
+        {
+            uint32_t record = *(const volatile uint32_t *)addr;
+
+            if ((record != RECORD_ERASED) && (record >= limit))
+            {
+                limit         = record;
+                m_record_addr = record_addr_next(addr);
+            }
+
+            addr += sizeof(uint32_t);
+        }
+
+        m_limit = limit;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    // Frame counters below the stored reservation might have been used before the reset.
+    // The Key Storage passes the resulting frame counter to the module, which requests
+    // the renewal of the reservation.
+    nrf_802154_security_pib_global_frame_counter_set_if_larger(m_limit);
+}
+
+uint32_t nrf_802154_security_fc_persist_limit_get(void)
+{
+    return m_limit;
+}
+
+void nrf_802154_security_fc_persist_update(uint32_t frame_counter)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    m_last_fc = frame_counter;
+    renewal_check(frame_counter);
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+#endif // NRF_802154_SECURITY_FC_PERSIST_ENABLED
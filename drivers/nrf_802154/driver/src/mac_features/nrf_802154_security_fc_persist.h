@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Module that persists the MAC Global Frame Counter in flash.
+ *
+ * The module stores in flash a reservation, that is a value of the Global Frame Counter that has
+ * not been used yet. Frame counters below the stored reservation can be used by transmitted
+ * frames, so after a reset the Global Frame Counter resumes from the reservation and no frame
+ * counter is ever used twice. When half of the reservation has been used, it is renewed
+ * @ref NRF_802154_SECURITY_FC_PERSIST_RESERVATION ahead of the current frame counter, so that
+ * most transmissions do not cause any flash operation.
+ *
+ * Flash is written through the jobs of the NVMC driver. Secured transmissions that would use
+ * a frame counter not covered by the stored reservation fail until the renewal is written.
+ */
+
+#ifndef NRF_802154_SECURITY_FC_PERSIST_H__
+#define NRF_802154_SECURITY_FC_PERSIST_H__
+
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+
+#if NRF_802154_SECURITY_FC_PERSIST_ENABLED
+
+/**
+ * @brief Initializes the frame counter persistence module.
+ *
+ * Restores the stored reservation and sets the Global Frame Counter to it if it is larger than
+ * the current value. Must be called after the Key Storage is initialized.
+ */
+void nrf_802154_security_fc_persist_init(void);
+
+/**
+ * @brief Gets the limit of the Global Frame Counter.
+ *
+ * @return The lowest frame counter that is not covered by the stored reservation.
+ */
+uint32_t nrf_802154_security_fc_persist_limit_get(void);
+
+/**
+ * @brief Updates the reservation for a new value of the Global Frame Counter.
+ *
+ * Requests a renewal of the stored reservation if less than half of it is left.
+ *
+ * @param[in]  frame_counter  Next value of the Global Frame Counter to be used.
+ */
+void nrf_802154_security_fc_persist_update(uint32_t frame_counter);
+
+#else // NRF_802154_SECURITY_FC_PERSIST_ENABLED
+
+static inline void nrf_802154_security_fc_persist_init(void)
+{
+    // Intentionally empty
+}
+
+static inline uint32_t nrf_802154_security_fc_persist_limit_get(void)
+{
+    return UINT32_MAX;
+}
+
+static inline void nrf_802154_security_fc_persist_update(uint32_t frame_counter)
+{
+    (void)frame_counter;
+}
+
+#endif // NRF_802154_SECURITY_FC_PERSIST_ENABLED
+
+#endif // NRF_802154_SECURITY_FC_PERSIST_H__
@@ -96,6 +96,16 @@ nrf_802154_security_error_t nrf_802154_security_pib_key_remove(nrf_802154_key_id
 nrf_802154_security_error_t nrf_802154_security_pib_key_use(nrf_802154_key_id_t * p_id,
                                                             void                * destination);
 
+/**
+ * @brief Gets the generation of the Key Storage content.
+ *
+ * The generation changes every time a key is stored or removed. It can be used to validate
+ * copies of keys kept outside of the Key Storage.
+ *
+ * @return Current generation of the Key Storage.
+ */
+uint32_t nrf_802154_security_pib_key_generation_get(void);
+
 /**
  * @brief Sets nRF 802.15.4 Radio Driver MAC Global Frame Counter.
  *
@@ -119,7 +129,11 @@ void nrf_802154_security_pib_global_frame_counter_set_if_larger(uint32_t frame_c
  * @retval NRF_802154_SECURITY_ERROR_NONE                   The p_frame_counter field was
  *                                                          successfully populated.
  * @retval NRF_802154_SECURITY_ERROR_FRAME_COUNTER_OVERFLOW No more available frame counters,
- *                                                          they must be reset.
+ *                                                          they must be reset. If
+ *                                                          @ref NRF_802154_SECURITY_FC_PERSIST_ENABLED
+ *                                                          is set, also returned when the Global
+ *                                                          Frame Counter is not covered by
+ *                                                          the reservation stored in flash yet.
  * @retval NRF_802154_SECURITY_ERROR_KEY_NOT_FOUND          The associated key was not found.
  */
 nrf_802154_security_error_t nrf_802154_security_pib_frame_counter_get_next(
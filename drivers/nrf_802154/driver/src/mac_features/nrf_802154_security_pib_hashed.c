@@ -0,0 +1,425 @@
+/*
+ * Copyright (c) 2021 - 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "nrf_802154_security_pib.h"
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_security_fc_persist.h"
+#include "nrf_802154_sl_atomics.h"
+
+#include <string.h>
+#include <stdbool.h>
+#include <assert.h>
+
+#if NRF_802154_SECURITY_KEY_STORAGE_HASHED
+
+#define KEY_SLOTS_COUNT (2 * NRF_802154_SECURITY_KEY_STORAGE_SIZE) ///< Number of slots of the hash index. Keeps the load factor at or below 50%.
+#define SLOT_EMPTY      0x0000U                                    ///< Slot that never held a key. Terminates a lookup.
+#define SLOT_DELETED    0xFFFFU                                    ///< Slot that held a removed key. A lookup continues past it.
+
+#define FNV_OFFSET_BASIS 2166136261UL                              ///< 32-bit FNV-1a offset basis
+#define FNV_PRIME        16777619UL                                ///< 32-bit FNV-1a prime
+
+typedef struct
+{
+    uint8_t                  key[AES_CCM_KEY_SIZE];
+    uint8_t                  id[KEY_ID_MODE_3_SIZE];
+    nrf_802154_key_id_mode_t mode;
+    uint32_t                 frame_counter;
+    bool                     use_global_frame_counter;
+    bool                     taken;
+} table_entry_t;
+
+static table_entry_t     m_key_storage[NRF_802154_SECURITY_KEY_STORAGE_SIZE];
+
+/**@brief Hash index of @ref m_key_storage.
+ *
+ * Each slot holds @ref SLOT_EMPTY, @ref SLOT_DELETED or an index of a key in
+ * @ref m_key_storage incremented by one. Keys are placed with linear probing.
+ */
+static volatile uint16_t m_key_slots[KEY_SLOTS_COUNT];
+static uint32_t          m_global_frame_counter;
+static volatile uint32_t m_key_generation;
+
+static bool mode_is_valid(nrf_802154_key_id_mode_t mode)
+{
+    switch (mode)
+    {
+        case KEY_ID_MODE_0:
+        case KEY_ID_MODE_1:
+        case KEY_ID_MODE_2:
+        case KEY_ID_MODE_3:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+static int id_length_get(nrf_802154_key_id_mode_t mode)
+{
+    switch (mode)
+    {
+        case 1:
+            return KEY_ID_MODE_1_SIZE;
+
+        case 2:
+            return KEY_ID_MODE_2_SIZE;
+
+        case 3:
+            return KEY_ID_MODE_3_SIZE;
+
+        default:
+            return 0;
+    }
+}
+
+static bool key_matches(table_entry_t * p_key, nrf_802154_key_id_t * p_id)
+{
+    if (!p_key->taken)
+    {
+        return false;
+    }
+
+    if (p_key->mode != p_id->mode)
+    {
+        return false;
+    }
+
+    if (p_id->mode == KEY_ID_MODE_0)
+    {
+        return true;
+    }
+    else if ((p_id->p_key_id == NULL) ||
+             (memcmp(p_id->p_key_id, p_key->id, id_length_get(p_id->mode)) != 0))
+    {
+        return false;
+    }
+    else
+    {
+        return true;
+    }
+}
+
+/**
+ * @brief Calculates the first slot of the hash index to probe for a key.
+ *
+ * @param[in]  p_id  Pointer to the ID of the key. The ID mode must be valid.
+ *
+ * @return Index of a slot in @ref m_key_slots.
+ */
+static uint32_t key_slot_home_get(const nrf_802154_key_id_t * p_id)
+{
+    uint32_t hash = (FNV_OFFSET_BASIS ^ p_id->mode) * FNV_PRIME;
+    int      len  = (p_id->p_key_id == NULL) ? 0 : id_length_get(p_id->mode);
+
+    for (int i = 0; i < len; i++)
+    {
+        hash = (hash ^ p_id->p_key_id[i]) * FNV_PRIME;
+    }
+
+    return hash % KEY_SLOTS_COUNT;
+}
+
+/**
+ * @brief Finds the slot of the hash index that refers to a key.
+ *
+ * @param[in]  p_id  Pointer to the ID of the key.
+ *
+ * @return Index of the slot in @ref m_key_slots or @ref KEY_SLOTS_COUNT if the key is not stored.
+ */
+static uint32_t key_slot_find(nrf_802154_key_id_t * p_id)
+{
+    if (!mode_is_valid(p_id->mode))
+    {
+        return KEY_SLOTS_COUNT;
+    }
+
+    uint32_t slot = key_slot_home_get(p_id);
+
+    for (uint32_t i = 0; i < KEY_SLOTS_COUNT; i++)
+    {
+        uint16_t value = m_key_slots[slot];
+
+        if (value == SLOT_EMPTY)
+        {
+            break;
+        }
+
+        if ((value != SLOT_DELETED) && key_matches(&m_key_storage[value - 1U], p_id))
+        {
+            return slot;
+        }
+
+        slot = (slot + 1U) % KEY_SLOTS_COUNT;
+    }
+
+    return KEY_SLOTS_COUNT;
+}
+
+/**
+ * @brief Finds a stored key.
+ *
+ * @param[in]  p_id  Pointer to the ID of the key.
+ *
+ * @return Pointer to the key or NULL if the key is not stored.
+ */
+static table_entry_t * key_find(nrf_802154_key_id_t * p_id)
+{
+    uint32_t slot = key_slot_find(p_id);
+
+    return (slot == KEY_SLOTS_COUNT) ? NULL : &m_key_storage[m_key_slots[slot] - 1U];
+}
+
+nrf_802154_security_error_t nrf_802154_security_pib_init(void)
+{
+    // Slot values must be able to hold every key index
+    assert(NRF_802154_SECURITY_KEY_STORAGE_SIZE < SLOT_DELETED);
+
+    for (uint32_t i = 0; i < NRF_802154_SECURITY_KEY_STORAGE_SIZE; i++)
+    {
+        m_key_storage[i].taken = false;
+    }
+
+    for (uint32_t i = 0; i < KEY_SLOTS_COUNT; i++)
+    {
+        m_key_slots[i] = SLOT_EMPTY;
+    }
+
+    m_key_generation++;
+
+    return NRF_802154_SECURITY_ERROR_NONE;
+}
+
+nrf_802154_security_error_t nrf_802154_security_pib_deinit(void)
+{
+    return NRF_802154_SECURITY_ERROR_NONE;
+}
+
+nrf_802154_security_error_t nrf_802154_security_pib_key_store(nrf_802154_key_t * p_key)
+{
+    assert(p_key != NULL);
+
+    if (p_key->type != NRF_802154_KEY_CLEARTEXT)
+    {
+        return NRF_802154_SECURITY_ERROR_TYPE_NOT_SUPPORTED;
+    }
+
+    if (!mode_is_valid(p_key->id.mode))
+    {
+        return NRF_802154_SECURITY_ERROR_MODE_NOT_SUPPORTED;
+    }
+
+    if (key_find(&p_key->id) != NULL)
+    {
+        return NRF_802154_SECURITY_ERROR_ALREADY_PRESENT;
+    }
+
+    for (uint32_t i = 0; i < NRF_802154_SECURITY_KEY_STORAGE_SIZE; i++)
+    {
+        if (m_key_storage[i].taken == false)
+        {
+            memcpy(m_key_storage[i].key,
+                   p_key->value.p_cleartext_key,
+                   sizeof(m_key_storage[i].key));
+            m_key_storage[i].mode = p_key->id.mode;
+            memcpy(m_key_storage[i].id, p_key->id.p_key_id, id_length_get(p_key->id.mode));
+            m_key_storage[i].frame_counter            = p_key->frame_counter;
+            m_key_storage[i].use_global_frame_counter = p_key->use_global_frame_counter;
+            m_key_storage[i].taken                    = true;
+
+            // There are more slots than keys, so a free slot is always found
+            uint32_t slot = key_slot_home_get(&p_key->id);
+
+            while ((m_key_slots[slot] != SLOT_EMPTY) && (m_key_slots[slot] != SLOT_DELETED))
+            {
+                slot = (slot + 1U) % KEY_SLOTS_COUNT;
+            }
+
+            __DMB();
+
+            // Publish the key to lookups that may run in interrupt context
+            m_key_slots[slot] = (uint16_t)(i + 1U);
+            m_key_generation++;
+            return NRF_802154_SECURITY_ERROR_NONE;
+        }
+    }
+
+    return NRF_802154_SECURITY_ERROR_STORAGE_FULL;
+}
+
+nrf_802154_security_error_t nrf_802154_security_pib_key_remove(nrf_802154_key_id_t * p_id)
+{
+    assert(p_id != NULL);
+
+    uint32_t slot = key_slot_find(p_id);
+
+    if (slot == KEY_SLOTS_COUNT)
+    {
+        return NRF_802154_SECURITY_ERROR_KEY_NOT_FOUND;
+    }
+
+    uint16_t index = m_key_slots[slot] - 1U;
+
+    // A slot can be emptied only if no probe sequence continues past it. Otherwise it is
+    // marked as deleted, so that concurrent lookups keep probing.
+    if (m_key_slots[(slot + 1U) % KEY_SLOTS_COUNT] == SLOT_EMPTY)
+    {
+        m_key_slots[slot] = SLOT_EMPTY;
+
+        // Deleted slots preceding the emptied one no longer lead anywhere
+        slot = (slot + KEY_SLOTS_COUNT - 1U) % KEY_SLOTS_COUNT;
+
+        while (m_key_slots[slot] == SLOT_DELETED)
+        {
+            m_key_slots[slot] = SLOT_EMPTY;
+            slot              = (slot + KEY_SLOTS_COUNT - 1U) % KEY_SLOTS_COUNT;
+        }
+    }
+    else
+    {
+        m_key_slots[slot] = SLOT_DELETED;
+    }
+
+    __DMB();
+
+    m_key_storage[index].taken = false;
+    m_key_generation++;
+
+    return NRF_802154_SECURITY_ERROR_NONE;
+}
+
+nrf_802154_security_error_t nrf_802154_security_pib_key_use(nrf_802154_key_id_t * p_id,
+                                                            void                * destination)
+{
+    assert(destination != NULL);
+    assert(p_id != NULL);
+
+    table_entry_t * p_key = key_find(p_id);
+
+    if (p_key == NULL)
+    {
+        return NRF_802154_SECURITY_ERROR_KEY_NOT_FOUND;
+    }
+
+    memcpy((uint8_t *)destination, p_key->key, sizeof(p_key->key));
+
+    return NRF_802154_SECURITY_ERROR_NONE;
+}
+
+uint32_t nrf_802154_security_pib_key_generation_get(void)
+{
+    return m_key_generation;
+}
+
+void nrf_802154_security_pib_global_frame_counter_set(uint32_t frame_counter)
+{
+    m_global_frame_counter = frame_counter;
+
+    nrf_802154_security_fc_persist_update(frame_counter);
+}
+
+void nrf_802154_security_pib_global_frame_counter_set_if_larger(uint32_t frame_counter)
+{
+    uint32_t fc;
+
+    do
+    {
+        fc = m_global_frame_counter;
+
+        if (fc >= frame_counter)
+        {
+            break;
+        }
+
+    }
+    while (!nrf_802154_sl_atomic_cas_u32(&m_global_frame_counter, &fc, frame_counter));
+
+    nrf_802154_security_fc_persist_update(m_global_frame_counter);
+}
+
+nrf_802154_security_error_t nrf_802154_security_pib_frame_counter_get_next(
+    uint32_t            * p_frame_counter,
+    nrf_802154_key_id_t * p_id)
+{
+    assert(p_frame_counter != NULL);
+    assert(p_id != NULL);
+
+    uint32_t      * p_frame_counter_to_use;
+    uint32_t        fc;
+    table_entry_t * p_key = key_find(p_id);
+
+    if (p_key == NULL)
+    {
+        /* No proper key found. */
+        return NRF_802154_SECURITY_ERROR_KEY_NOT_FOUND;
+    }
+
+    if (p_key->use_global_frame_counter)
+    {
+        p_frame_counter_to_use = &m_global_frame_counter;
+    }
+    else
+    {
+        p_frame_counter_to_use = &p_key->frame_counter;
+    }
+
+    // Only the Global Frame Counter is limited by the reservation stored in flash.
+    uint32_t limit = (p_frame_counter_to_use == &m_global_frame_counter) ?
+                     nrf_802154_security_fc_persist_limit_get() : UINT32_MAX;
+
+    do
+    {
+        fc = __LDREXW(p_frame_counter_to_use);
+
+        if (fc >= limit)
+        {
+            __CLREX();
+            return NRF_802154_SECURITY_ERROR_FRAME_COUNTER_OVERFLOW;
+        }
+    }
+    while (__STREXW(fc + 1, p_frame_counter_to_use));
+
+    *p_frame_counter = *p_frame_counter_to_use - 1;
+
+    if (p_frame_counter_to_use == &m_global_frame_counter)
+    {
+        nrf_802154_security_fc_persist_update(fc + 1);
+    }
+
+    return NRF_802154_SECURITY_ERROR_NONE;
+}
+
+#endif // NRF_802154_SECURITY_KEY_STORAGE_HASHED
@@ -36,12 +36,15 @@
 
 #include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
+#include "nrf_802154_security_fc_persist.h"
 #include "nrf_802154_sl_atomics.h"
 
 #include <string.h>
 #include <stdbool.h>
 #include <assert.h>
 
+#if !NRF_802154_SECURITY_KEY_STORAGE_HASHED
+
 typedef struct
 {
     uint8_t                  key[AES_CCM_KEY_SIZE];
@@ -52,8 +55,9 @@ typedef struct
     bool                     taken;
 } table_entry_t;
 
-static table_entry_t m_key_storage[NRF_802154_SECURITY_KEY_STORAGE_SIZE];
-static uint32_t      m_global_frame_counter;
+static table_entry_t     m_key_storage[NRF_802154_SECURITY_KEY_STORAGE_SIZE];
+static uint32_t          m_global_frame_counter;
+static volatile uint32_t m_key_generation;
 
 static bool mode_is_valid(nrf_802154_key_id_mode_t mode)
 {
@@ -135,6 +139,8 @@ nrf_802154_security_error_t nrf_802154_security_pib_init(void)
         m_key_storage[i].taken = false;
     }
 
+    m_key_generation++;
+
     return NRF_802154_SECURITY_ERROR_NONE;
 }
 
@@ -177,6 +183,7 @@ nrf_802154_security_error_t nrf_802154_security_pib_key_store(nrf_802154_key_t *
             __DMB();
 
             m_key_storage[i].taken = true;
+            m_key_generation++;
             return NRF_802154_SECURITY_ERROR_NONE;
         }
     }
@@ -193,6 +200,7 @@ nrf_802154_security_error_t nrf_802154_security_pib_key_remove(nrf_802154_key_id
         if (key_matches(&m_key_storage[i], p_id))
         {
             m_key_storage[i].taken = false;
+            m_key_generation++;
             return NRF_802154_SECURITY_ERROR_NONE;
         }
     }
@@ -218,9 +226,16 @@ nrf_802154_security_error_t nrf_802154_security_pib_key_use(nrf_802154_key_id_t
     return NRF_802154_SECURITY_ERROR_KEY_NOT_FOUND;
 }
 
+uint32_t nrf_802154_security_pib_key_generation_get(void)
+{
+    return m_key_generation;
+}
+
 void nrf_802154_security_pib_global_frame_counter_set(uint32_t frame_counter)
 {
     m_global_frame_counter = frame_counter;
+
+    nrf_802154_security_fc_persist_update(frame_counter);
 }
 
 void nrf_802154_security_pib_global_frame_counter_set_if_larger(uint32_t frame_counter)
@@ -238,6 +253,8 @@ void nrf_802154_security_pib_global_frame_counter_set_if_larger(uint32_t frame_c
 
     }
     while (!nrf_802154_sl_atomic_cas_u32(&m_global_frame_counter, &fc, frame_counter));
+
+    nrf_802154_security_fc_persist_update(m_global_frame_counter);
 }
 
 nrf_802154_security_error_t nrf_802154_security_pib_frame_counter_get_next(
@@ -272,11 +289,15 @@ nrf_802154_security_error_t nrf_802154_security_pib_frame_counter_get_next(
         return NRF_802154_SECURITY_ERROR_KEY_NOT_FOUND;
     }
 
+    // Only the Global Frame Counter is limited by the reservation stored in flash.
+    uint32_t limit = (p_frame_counter_to_use == &m_global_frame_counter) ?
+                     nrf_802154_security_fc_persist_limit_get() : UINT32_MAX;
+
     do
     {
         fc = __LDREXW(p_frame_counter_to_use);
 
-        if (fc == UINT32_MAX)
+        if (fc >= limit)
         {
             __CLREX();
             return NRF_802154_SECURITY_ERROR_FRAME_COUNTER_OVERFLOW;
@@ -286,5 +307,12 @@ nrf_802154_security_error_t nrf_802154_security_pib_frame_counter_get_next(
 
     *p_frame_counter = *p_frame_counter_to_use - 1;
 
+    if (p_frame_counter_to_use == &m_global_frame_counter)
+    {
+        nrf_802154_security_fc_persist_update(fc + 1);
+    }
+
     return NRF_802154_SECURITY_ERROR_NONE;
 }
+
+#endif // !NRF_802154_SECURITY_KEY_STORAGE_HASHED
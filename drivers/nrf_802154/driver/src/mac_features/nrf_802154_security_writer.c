@@ -101,8 +101,8 @@ static void key_id_prepare(const nrf_802154_frame_parser_data_t * p_frame_data,
  *                                              the frame counter injection.
  */
 static nrf_802154_security_error_t frame_counter_inject(
-    nrf_802154_frame_parser_data_t * p_frame_data,
-    nrf_802154_key_id_t            * p_key_id)
+    const nrf_802154_frame_parser_data_t * p_frame_data,
+    nrf_802154_key_id_t                  * p_key_id)
 {
     uint32_t  frame_counter;
     uint8_t * p_frame_counter =
@@ -155,9 +155,9 @@ bool nrf_802154_security_writer_tx_setup(
     nrf_802154_transmit_params_t            * p_params,
     nrf_802154_transmit_failed_notification_t notify_function)
 {
-    nrf_802154_frame_parser_data_t frame_data;
-    nrf_802154_key_id_t            key_id;
-    bool                           result = false;
+    const nrf_802154_frame_parser_data_t * p_frame_data;
+    nrf_802154_key_id_t                    key_id;
+    bool                                   result = false;
 
     key_id.p_key_id          = NULL;
     m_frame_counter_injected = false;
@@ -168,16 +168,12 @@ bool nrf_802154_security_writer_tx_setup(
         return true;
     }
 
-    result = nrf_802154_frame_parser_data_init(p_frame,
-                                               p_frame[PHR_OFFSET] + PHR_SIZE,
-                                               PARSE_LEVEL_AUX_SEC_HDR_END,
-                                               &frame_data);
-    assert(result);
-    (void)result;
+    p_frame_data = nrf_802154_frame_parser_tx_data_get(p_frame, PARSE_LEVEL_AUX_SEC_HDR_END);
+    assert(p_frame_data != NULL);
 
     do
     {
-        if (!security_is_enabled(&frame_data))
+        if (!security_is_enabled(p_frame_data))
         {
             /* Security is not enabled. Pass. */
             result = true;
@@ -185,9 +181,9 @@ bool nrf_802154_security_writer_tx_setup(
         }
 
         /* Prepare key ID for key validation. */
-        key_id_prepare(&frame_data, &key_id);
+        key_id_prepare(p_frame_data, &key_id);
 
-        nrf_802154_security_error_t err = frame_counter_inject(&frame_data, &key_id);
+        nrf_802154_security_error_t err = frame_counter_inject(p_frame_data, &key_id);
 
         switch (err)
         {
@@ -0,0 +1,720 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @file
+ *   This file implements the TSCH slotframe engine for the 802.15.4 driver.
+ *
+ */
+
+#include "nrf_802154_tsch_engine.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_request.h"
+#include "nrf_802154_sl_atomics.h"
+#include "nrf_802154_sl_timer.h"
+#include "platform/nrf_802154_random.h"
+
+#if NRF_802154_TSCH_ENABLED
+
+#if !NRF_802154_DELAYED_TRX_ENABLED || !NRF_802154_ACK_TIMEOUT_ENABLED
+#error "NRF_802154_TSCH_ENABLED requires NRF_802154_DELAYED_TRX_ENABLED and NRF_802154_ACK_TIMEOUT_ENABLED"
+#endif
+
+#define HOPPING_SEQUENCE_MAX_LENGTH 16    ///< Maximum number of channels in the hopping sequence.
+#define CHANNEL_MIN                 11    ///< Lowest channel of the 2.4 GHz O-QPSK PHY.
+#define CHANNEL_MAX                 26    ///< Highest channel of the 2.4 GHz O-QPSK PHY.
+#define CSMA_MIN_BE                 1     ///< Minimum backoff exponent of the TSCH CSMA-CA (macMinBe).
+#define CSMA_MAX_BE                 7     ///< Maximum backoff exponent of the TSCH CSMA-CA (macMaxBe).
+
+#define TIMING_DEFAULT_SLOT_LENGTH  10000 ///< Default timeslot length [us].
+#define TIMING_DEFAULT_TX_OFFSET    2120  ///< Default time from the timeslot beginning to the transmission [us].
+#define TIMING_DEFAULT_RX_OFFSET    1020  ///< Default time from the timeslot beginning to the reception [us].
+#define TIMING_DEFAULT_RX_WAIT      2200  ///< Default reception window length [us].
+
+/**
+ * @brief States of a TSCH queue entry.
+ */
+typedef enum
+{
+    ENTRY_STATE_FREE,    ///< The entry is unused.
+    ENTRY_STATE_WRITING, ///< The entry is being filled in by @ref nrf_802154_tsch_engine_frame_add.
+    ENTRY_STATE_READY,   ///< The entry holds a frame waiting for a TX cell.
+    ENTRY_STATE_SENDING, ///< The frame from the entry is being transmitted.
+} entry_state_t;
+
+/**
+ * @brief Entry of the TSCH queue.
+ */
+typedef struct
+{
+    uint8_t                                state;    ///< State of the entry, see @ref entry_state_t.
+    uint8_t                                neighbor; ///< Index of the neighbor the frame is queued for.
+    uint8_t                                retries;  ///< Number of retransmissions performed so far.
+    uint32_t                               seq;      ///< Sequence number determining the order of queued frames.
+    uint8_t                              * p_data;   ///< Pointer to a buffer that contains PHR and PSDU of the frame.
+    nrf_802154_transmit_csma_ca_metadata_t metadata; ///< Metadata of the frame transmission.
+} tsch_entry_t;
+
+/**
+ * @brief TSCH CSMA-CA state of a neighbor.
+ */
+typedef struct
+{
+    uint8_t  be;      ///< Backoff exponent.
+    uint16_t backoff; ///< Number of shared cells to be skipped before the next attempt.
+} tsch_neighbor_t;
+
+/**
+ * @brief Slotframe descriptor.
+ */
+typedef struct
+{
+    uint16_t length; ///< Number of timeslots of the slotframe or 0 if the slotframe is not set.
+    uint16_t first;  ///< Index of the first cell of the slotframe in @ref m_cells.
+    uint16_t count;  ///< Number of cells of the slotframe.
+} tsch_slotframe_t;
+
+static tsch_entry_t             m_queue[NRF_802154_TSCH_QUEUE_SIZE];          ///< TSCH queue entries.
+static uint32_t                 m_seq;                                        ///< Sequence number of the last queued frame.
+static tsch_neighbor_t          m_neighbors[NRF_802154_TSCH_NEIGHBORS_NUM];   ///< TSCH CSMA-CA state of the neighbors.
+static tsch_slotframe_t         m_slotframes[NRF_802154_TSCH_SLOTFRAMES_NUM]; ///< Slotframe descriptors.
+static nrf_802154_tsch_cell_t   m_cells[NRF_802154_TSCH_CELLS_NUM];           ///< Cells of all slotframes, sorted by timeslot within each slotframe.
+static uint16_t                 m_cells_used;                                 ///< Number of used entries of @ref m_cells.
+static uint8_t                  m_hopping[HOPPING_SEQUENCE_MAX_LENGTH];       ///< Channel hopping sequence.
+static uint8_t                  m_hopping_length;                             ///< Number of channels in @ref m_hopping.
+static nrf_802154_tsch_timing_t m_timing;                                     ///< Timeslot timing.
+static nrf_802154_sl_timer_t    m_timer;                                      ///< Timer armed before the next active timeslot.
+static volatile bool            m_running;                                    ///< If the slotframes are being executed.
+static uint64_t                 m_base_asn;                                   ///< ASN of the reference timeslot.
+static uint64_t                 m_base_time;                                  ///< Beginning of the reference timeslot [us].
+static uint64_t                 m_asn;                                        ///< ASN of the timeslot the timer is armed for.
+static uint32_t                 m_correction;                                 ///< Time correction not applied yet [us], a signed value.
+static tsch_entry_t * volatile  mp_tx_entry;                                  ///< Entry of the frame being transmitted.
+static bool                     m_tx_shared;                                  ///< If the frame is being transmitted in a shared cell.
+
+/**
+ * @brief Gets the beginning of a timeslot.
+ *
+ * @param[in]  asn  Absolute slot number of the timeslot.
+ *
+ * @returns  Beginning of the timeslot [us].
+ */
+static uint64_t slot_time_get(uint64_t asn)
+{
+    return m_base_time + (asn - m_base_asn) * m_timing.slot_length;
+}
+
+/**
+ * @brief Moves the pending time correction to the reference timeslot.
+ */
+static void correction_apply(void)
+{
+    uint32_t correction = nrf_802154_sl_atomic_load_u32(&m_correction);
+
+    while (!nrf_802154_sl_atomic_cas_u32(&m_correction, &correction, 0U))
+    {
+        // Retry with the value updated by the failed exchange.
+    }
+
+    m_base_time += (int64_t)(int32_t)correction;
+}
+
+/**
+ * @brief Finds the nearest timeslot that has a cell in any of the slotframes.
+ *
+ * @param[in]   from   Absolute slot number of the first timeslot to be checked.
+ * @param[out]  p_asn  Absolute slot number of the found timeslot.
+ *
+ * @retval  true   The timeslot is found.
+ * @retval  false  There are no cells.
+ */
+static bool next_active_asn_get(uint64_t from, uint64_t * p_asn)
+{
+    bool found = false;
+
+    for (uint32_t i = 0; i < NRF_802154_TSCH_SLOTFRAMES_NUM; i++)
+    {
+        const tsch_slotframe_t * p_sf = &m_slotframes[i];
+
+        if ((p_sf->length == 0) || (p_sf->count == 0))
+        {
+            continue;
+        }
+
+        uint16_t timeslot = (uint16_t)(from % p_sf->length);
+        uint32_t distance = p_sf->length - timeslot + m_cells[p_sf->first].timeslot;
+
+        for (uint32_t j = p_sf->first; j < p_sf->first + p_sf->count; j++)
+        {
+            if (m_cells[j].timeslot >= timeslot)
+            {
+                distance = m_cells[j].timeslot - timeslot;
+                break;
+            }
+        }
+
+        if (!found || (from + distance < *p_asn))
+        {
+            *p_asn = from + distance;
+            found  = true;
+        }
+    }
+
+    return found;
+}
+
+/**
+ * @brief Finds the oldest frame to be transmitted in a TX cell.
+ *
+ * In shared cells, frames of the neighbors whose TSCH CSMA-CA backoff has not elapsed
+ * are skipped and the backoff of the neighbors served by the cell is decremented.
+ *
+ * @param[in]  p_cell  Pointer to the cell.
+ *
+ * @returns  Pointer to the entry of the oldest matching frame or NULL if there is none.
+ */
+static tsch_entry_t * entry_find(const nrf_802154_tsch_cell_t * p_cell)
+{
+    bool           shared   = (p_cell->options & NRF_802154_TSCH_CELL_OPTION_SHARED) != 0;
+    tsch_entry_t * p_result = NULL;
+
+    for (uint32_t i = 0; i < NRF_802154_TSCH_QUEUE_SIZE; i++)
+    {
+        tsch_entry_t * p_entry = &m_queue[i];
+
+        if ((nrf_802154_sl_atomic_load_u8(&p_entry->state) != ENTRY_STATE_READY) ||
+            ((p_cell->neighbor != NRF_802154_TSCH_NEIGHBOR_ANY) &&
+             (p_cell->neighbor != p_entry->neighbor)) ||
+            (shared && (m_neighbors[p_entry->neighbor].backoff > 0)))
+        {
+            continue;
+        }
+
+        if ((p_result == NULL) || ((int32_t)(p_entry->seq - p_result->seq) < 0))
+        {
+            p_result = p_entry;
+        }
+    }
+
+    if (shared)
+    {
+        for (uint32_t i = 0; i < NRF_802154_TSCH_NEIGHBORS_NUM; i++)
+        {
+            if (((p_cell->neighbor == NRF_802154_TSCH_NEIGHBOR_ANY) || (p_cell->neighbor == i)) &&
+                (m_neighbors[i].backoff > 0))
+            {
+                m_neighbors[i].backoff--;
+            }
+        }
+    }
+
+    return p_result;
+}
+
+/**
+ * @brief Gets the channel of a cell in a timeslot.
+ *
+ * @param[in]  asn     Absolute slot number of the timeslot.
+ * @param[in]  p_cell  Pointer to the cell.
+ *
+ * @returns  Channel selected by the hopping sequence.
+ */
+static uint8_t channel_get(uint64_t asn, const nrf_802154_tsch_cell_t * p_cell)
+{
+    return m_hopping[(asn + p_cell->channel_offset) % m_hopping_length];
+}
+
+/**
+ * @brief Requests the transmission of a queued frame in a TX cell.
+ *
+ * @param[in]  p_entry    Pointer to the entry of the frame.
+ * @param[in]  p_cell     Pointer to the cell.
+ * @param[in]  asn        Absolute slot number of the timeslot.
+ * @param[in]  slot_time  Beginning of the timeslot [us].
+ *
+ * @retval  true   The transmission is requested.
+ * @retval  false  Another transmission is ongoing or the request was rejected.
+ */
+static bool tx_start(tsch_entry_t                 * p_entry,
+                     const nrf_802154_tsch_cell_t * p_cell,
+                     uint64_t                       asn,
+                     uint64_t                       slot_time)
+{
+    uint8_t expected = ENTRY_STATE_READY;
+    bool    shared   = (p_cell->options & NRF_802154_TSCH_CELL_OPTION_SHARED) != 0;
+
+    if ((mp_tx_entry != NULL) ||
+        !nrf_802154_sl_atomic_cas_u8(&p_entry->state, &expected, ENTRY_STATE_SENDING))
+    {
+        return false;
+    }
+
+    nrf_802154_transmit_at_metadata_t metadata =
+    {
+        .frame_props = p_entry->metadata.frame_props,
+        .cca         = shared,
+        .channel     = channel_get(asn, p_cell),
+        .tx_power    = p_entry->metadata.tx_power,
+    };
+
+    m_tx_shared = shared;
+    mp_tx_entry = p_entry;
+
+    if (!nrf_802154_request_transmit_raw_at(p_entry->p_data,
+                                            slot_time + m_timing.tx_offset,
+                                            &metadata))
+    {
+        mp_tx_entry = NULL;
+        nrf_802154_sl_atomic_store_u8(&p_entry->state, ENTRY_STATE_READY);
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Executes the cell of a timeslot.
+ *
+ * @param[in]  asn  Absolute slot number of the timeslot.
+ */
+static void slot_process(uint64_t asn)
+{
+    uint64_t slot_time = slot_time_get(asn);
+
+    for (uint32_t i = 0; i < NRF_802154_TSCH_SLOTFRAMES_NUM; i++)
+    {
+        const tsch_slotframe_t * p_sf = &m_slotframes[i];
+
+        if (p_sf->length == 0)
+        {
+            continue;
+        }
+
+        uint16_t timeslot = (uint16_t)(asn % p_sf->length);
+
+        for (uint32_t j = p_sf->first; j < p_sf->first + p_sf->count; j++)
+        {
+            const nrf_802154_tsch_cell_t * p_cell = &m_cells[j];
+
+            if (p_cell->timeslot != timeslot)
+            {
+                continue;
+            }
+
+            if (p_cell->options & NRF_802154_TSCH_CELL_OPTION_TX)
+            {
+                tsch_entry_t * p_entry = entry_find(p_cell);
+
+                if ((p_entry != NULL) && tx_start(p_entry, p_cell, asn, slot_time))
+                {
+                    return;
+                }
+            }
+
+            if (p_cell->options & NRF_802154_TSCH_CELL_OPTION_RX)
+            {
+                (void)nrf_802154_request_receive_at(slot_time + m_timing.rx_offset,
+                                                    m_timing.rx_wait,
+                                                    channel_get(asn, p_cell),
+                                                    NRF_802154_TSCH_RX_WINDOW_ID);
+                return;
+            }
+        }
+    }
+}
+
+static void slot_timer_fired(nrf_802154_sl_timer_t * p_timer);
+
+/**
+ * @brief Arms the timer for the nearest timeslot that has a cell.
+ *
+ * @param[in]  from  Absolute slot number of the first timeslot to be considered.
+ */
+static void slot_timer_arm(uint64_t from)
+{
+    uint64_t asn;
+
+    if (!next_active_asn_get(from, &asn))
+    {
+        return;
+    }
+
+    m_asn = asn;
+
+    m_timer.action_type              = NRF_802154_SL_TIMER_ACTION_TYPE_CALLBACK;
+    m_timer.action.callback.callback = slot_timer_fired;
+    m_timer.trigger_time             = slot_time_get(asn) - NRF_802154_TSCH_SLOT_LEAD_TIME_US;
+
+    nrf_802154_sl_timer_ret_t ret;
+
+    ret = nrf_802154_sl_timer_add(&m_timer);
+    assert(ret == NRF_802154_SL_TIMER_RET_SUCCESS);
+    (void)ret;
+}
+
+static void slot_timer_fired(nrf_802154_sl_timer_t * p_timer)
+{
+    (void)p_timer;
+
+    if (!m_running)
+    {
+        return;
+    }
+
+    correction_apply();
+    slot_process(m_asn);
+    slot_timer_arm(m_asn + 1);
+}
+
+void nrf_802154_tsch_engine_init(void)
+{
+    memset(m_queue, 0, sizeof(m_queue));
+    memset(m_slotframes, 0, sizeof(m_slotframes));
+    m_seq            = 0;
+    m_cells_used     = 0;
+    m_hopping_length = 0;
+    m_running        = false;
+    m_correction     = 0;
+    mp_tx_entry      = NULL;
+
+    for (uint32_t i = 0; i < NRF_802154_TSCH_NEIGHBORS_NUM; i++)
+    {
+        m_neighbors[i].be      = CSMA_MIN_BE;
+        m_neighbors[i].backoff = 0;
+    }
+
+    m_timing.slot_length = TIMING_DEFAULT_SLOT_LENGTH;
+    m_timing.tx_offset   = TIMING_DEFAULT_TX_OFFSET;
+    m_timing.rx_offset   = TIMING_DEFAULT_RX_OFFSET;
+    m_timing.rx_wait     = TIMING_DEFAULT_RX_WAIT;
+
+    nrf_802154_sl_timer_init(&m_timer);
+}
+
+void nrf_802154_tsch_engine_deinit(void)
+{
+    m_running = false;
+    nrf_802154_sl_timer_deinit(&m_timer);
+}
+
+bool nrf_802154_tsch_engine_timing_set(const nrf_802154_tsch_timing_t * p_timing)
+{
+    if (m_running ||
+        (p_timing->slot_length <= NRF_802154_TSCH_SLOT_LEAD_TIME_US) ||
+        (p_timing->tx_offset >= p_timing->slot_length) ||
+        (p_timing->rx_offset + p_timing->rx_wait >= p_timing->slot_length))
+    {
+        return false;
+    }
+
+    m_timing = *p_timing;
+
+    return true;
+}
+
+bool nrf_802154_tsch_engine_hopping_sequence_set(const uint8_t * p_channels, uint8_t length)
+{
+    if (m_running || (length == 0) || (length > HOPPING_SEQUENCE_MAX_LENGTH))
+    {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < length; i++)
+    {
+        if ((p_channels[i] < CHANNEL_MIN) || (p_channels[i] > CHANNEL_MAX))
+        {
+            return false;
+        }
+    }
+
+    memcpy(m_hopping, p_channels, length);
+    m_hopping_length = length;
+
+    return true;
+}
+
+bool nrf_802154_tsch_engine_slotframe_set(uint8_t                        handle,
+                                          uint16_t                       length,
+                                          const nrf_802154_tsch_cell_t * p_cells,
+                                          uint16_t                       cells_count)
+{
+    if (m_running || (handle >= NRF_802154_TSCH_SLOTFRAMES_NUM))
+    {
+        return false;
+    }
+
+    tsch_slotframe_t * p_sf = &m_slotframes[handle];
+
+    if (length == 0)
+    {
+        cells_count = 0;
+    }
+
+    if (cells_count > NRF_802154_TSCH_CELLS_NUM - (m_cells_used - p_sf->count))
+    {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < cells_count; i++)
+    {
+        const nrf_802154_tsch_cell_t * p_cell = &p_cells[i];
+
+        if ((p_cell->timeslot >= length) ||
+            ((p_cell->options &
+              (NRF_802154_TSCH_CELL_OPTION_TX | NRF_802154_TSCH_CELL_OPTION_RX)) == 0) ||
+            ((p_cell->neighbor >= NRF_802154_TSCH_NEIGHBORS_NUM) &&
+             (p_cell->neighbor != NRF_802154_TSCH_NEIGHBOR_ANY)))
+        {
+            return false;
+        }
+    }
+
+    // Remove the previous cells of the slotframe, keeping the cells of the others contiguous.
+    memmove(&m_cells[p_sf->first],
+            &m_cells[p_sf->first + p_sf->count],
+            (m_cells_used - p_sf->first - p_sf->count) * sizeof(m_cells[0]));
+
+    for (uint32_t i = 0; i < NRF_802154_TSCH_SLOTFRAMES_NUM; i++)
+    {
+        if ((i != handle) && (m_slotframes[i].first > p_sf->first))
+        {
+            m_slotframes[i].first -= p_sf->count;
+        }
+    }
+    m_cells_used -= p_sf->count;
+
+    // Append the new cells sorted by timeslot. Cells with equal timeslots keep their order.
+    p_sf->length = length;
+    p_sf->first  = m_cells_used;
+    p_sf->count  = cells_count;
+
+    for (uint32_t i = 0; i < cells_count; i++)
+    {
+        uint32_t j = m_cells_used + i;
+
+        while ((j > p_sf->first) && (m_cells[j - 1].timeslot > p_cells[i].timeslot))
+        {
+            m_cells[j] = m_cells[j - 1];
+            j--;
+        }
+        m_cells[j] = p_cells[i];
+    }
+    m_cells_used += cells_count;
+
+    return true;
+}
+
+bool nrf_802154_tsch_engine_start(uint64_t asn, uint64_t asn_time)
+{
+    if (m_running || (m_hopping_length == 0))
+    {
+        return false;
+    }
+
+    uint64_t now  = nrf_802154_sl_timer_current_time_get();
+    uint64_t from = asn;
+
+    // Timeslots that begin too soon to be prepared are skipped.
+    if (now + NRF_802154_TSCH_SLOT_LEAD_TIME_US > asn_time)
+    {
+        from += (now + NRF_802154_TSCH_SLOT_LEAD_TIME_US - asn_time) / m_timing.slot_length + 1;
+    }
+
+    m_base_asn   = asn;
+    m_base_time  = asn_time;
+    m_correction = 0;
+    m_running    = true;
+
+    slot_timer_arm(from);
+
+    return true;
+}
+
+void nrf_802154_tsch_engine_stop(void)
+{
+    m_running = false;
+
+    // To make sure `slot_timer_fired()` detects that the execution is being stopped if it
+    // preempts this function.
+    __DMB();
+
+    (void)nrf_802154_sl_timer_remove(&m_timer);
+    (void)nrf_802154_request_receive_at_cancel(NRF_802154_TSCH_RX_WINDOW_ID);
+}
+
+void nrf_802154_tsch_engine_time_correct(int32_t correction)
+{
+    uint32_t expected = nrf_802154_sl_atomic_load_u32(&m_correction);
+
+    while (!nrf_802154_sl_atomic_cas_u32(&m_correction,
+                                         &expected,
+                                         (uint32_t)((int32_t)expected + correction)))
+    {
+        // Retry with the value updated by the failed exchange.
+    }
+}
+
+bool nrf_802154_tsch_engine_asn_get(uint64_t * p_asn)
+{
+    if (!m_running)
+    {
+        return false;
+    }
+
+    uint64_t now       = nrf_802154_sl_timer_current_time_get();
+    int32_t  pending   = (int32_t)nrf_802154_sl_atomic_load_u32(&m_correction);
+    uint64_t base_time = m_base_time + (int64_t)pending;
+
+    *p_asn = m_base_asn;
+    if (now > base_time)
+    {
+        *p_asn += (now - base_time) / m_timing.slot_length;
+    }
+
+    return true;
+}
+
+bool nrf_802154_tsch_engine_frame_add(uint8_t                                        neighbor,
+                                      uint8_t                                      * p_data,
+                                      const nrf_802154_transmit_csma_ca_metadata_t * p_metadata)
+{
+    if (neighbor >= NRF_802154_TSCH_NEIGHBORS_NUM)
+    {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < NRF_802154_TSCH_QUEUE_SIZE; i++)
+    {
+        tsch_entry_t * p_entry  = &m_queue[i];
+        uint8_t        expected = ENTRY_STATE_FREE;
+
+        if (!nrf_802154_sl_atomic_cas_u8(&p_entry->state, &expected, ENTRY_STATE_WRITING))
+        {
+            continue;
+        }
+
+        p_entry->neighbor = neighbor;
+        p_entry->retries  = 0;
+        p_entry->seq      = ++m_seq;
+        p_entry->p_data   = p_data;
+        p_entry->metadata = *p_metadata;
+
+        nrf_802154_sl_atomic_store_u8(&p_entry->state, ENTRY_STATE_READY);
+
+        return true;
+    }
+
+    return false;
+}
+
+bool nrf_802154_tsch_engine_frame_remove(const uint8_t * p_data)
+{
+    for (uint32_t i = 0; i < NRF_802154_TSCH_QUEUE_SIZE; i++)
+    {
+        tsch_entry_t * p_entry  = &m_queue[i];
+        uint8_t        expected = ENTRY_STATE_READY;
+
+        if ((p_entry->p_data == p_data) &&
+            nrf_802154_sl_atomic_cas_u8(&p_entry->state, &expected, ENTRY_STATE_FREE))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool nrf_802154_tsch_engine_tx_outcome_hook(uint8_t                             * p_frame,
+                                            nrf_802154_tx_error_t                 error,
+                                            nrf_802154_transmit_done_metadata_t * p_meta)
+{
+    tsch_entry_t * p_entry = mp_tx_entry;
+
+    if ((p_entry == NULL) || (p_entry->p_data != p_frame))
+    {
+        return true;
+    }
+
+    tsch_neighbor_t * p_neighbor = &m_neighbors[p_entry->neighbor];
+
+    mp_tx_entry = NULL;
+
+    if (error == NRF_802154_TX_ERROR_NONE)
+    {
+        p_neighbor->be      = CSMA_MIN_BE;
+        p_neighbor->backoff = 0;
+    }
+    else if ((error == NRF_802154_TX_ERROR_TIMESLOT_DENIED) ||
+             (error == NRF_802154_TX_ERROR_ABORTED))
+    {
+        // The frame was not transmitted on the air, so the attempt does not count.
+        nrf_802154_sl_atomic_store_u8(&p_entry->state, ENTRY_STATE_READY);
+        return false;
+    }
+    else
+    {
+        if (m_tx_shared)
+        {
+            p_neighbor->backoff = nrf_802154_random_get() % (1U << p_neighbor->be);
+            if (p_neighbor->be < CSMA_MAX_BE)
+            {
+                p_neighbor->be++;
+            }
+        }
+
+        if (p_entry->retries < p_entry->metadata.max_frame_retries)
+        {
+            p_entry->retries++;
+            nrf_802154_sl_atomic_store_u8(&p_entry->state, ENTRY_STATE_READY);
+            return false;
+        }
+    }
+
+    p_meta->retries = p_entry->retries;
+    nrf_802154_sl_atomic_store_u8(&p_entry->state, ENTRY_STATE_FREE);
+
+    return true;
+}
+
+bool nrf_802154_tsch_engine_rx_window_end_hook(uint32_t id)
+{
+    return id == NRF_802154_TSCH_RX_WINDOW_ID;
+}
+
+#endif // NRF_802154_TSCH_ENABLED
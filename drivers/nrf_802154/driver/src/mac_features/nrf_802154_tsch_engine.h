@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @brief Module that executes TSCH slotframes.
+ *
+ */
+
+#ifndef NRF_802154_TSCH_ENGINE_H_
+#define NRF_802154_TSCH_ENGINE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_types.h"
+
+/**
+ * @defgroup nrf_802154_tsch_engine TSCH slotframe engine
+ * @{
+ * @ingroup nrf_802154
+ * @brief Autonomous execution of TSCH slotframes.
+ *
+ * A single timer is armed before the beginning of the nearest timeslot that has a cell in any
+ * of the slotframes. When it fires, the cell of the lowest slotframe handle that has a frame to
+ * transmit or the RX option is executed with a delayed transmission or reception on the channel
+ * selected by the hopping sequence, and the timer is armed for the next such timeslot.
+ * Timeslots without cells do not wake up the CPU.
+ */
+
+/**
+ * @brief Initializes the TSCH slotframe engine.
+ */
+void nrf_802154_tsch_engine_init(void);
+
+/**
+ * @brief Deinitializes the TSCH slotframe engine.
+ */
+void nrf_802154_tsch_engine_deinit(void);
+
+/**
+ * @brief Sets the timing of the TSCH timeslots.
+ *
+ * @param[in]  p_timing  Pointer to the timeslot timing.
+ *
+ * @retval  true   The timing is set.
+ * @retval  false  The slotframes are being executed or the timing is invalid.
+ */
+bool nrf_802154_tsch_engine_timing_set(const nrf_802154_tsch_timing_t * p_timing);
+
+/**
+ * @brief Sets the channel hopping sequence.
+ *
+ * @param[in]  p_channels  Array of channels of the hopping sequence.
+ * @param[in]  length      Number of channels in @p p_channels.
+ *
+ * @retval  true   The hopping sequence is set.
+ * @retval  false  The slotframes are being executed or the sequence is invalid.
+ */
+bool nrf_802154_tsch_engine_hopping_sequence_set(const uint8_t * p_channels, uint8_t length);
+
+/**
+ * @brief Sets the cells of a slotframe.
+ *
+ * @param[in]  handle       Handle of the slotframe. Lower handles take precedence.
+ * @param[in]  length       Number of timeslots of the slotframe. If 0, the slotframe is removed.
+ * @param[in]  p_cells      Array of cells of the slotframe. It is copied by the engine.
+ * @param[in]  cells_count  Number of cells in @p p_cells.
+ *
+ * @retval  true   The slotframe is set.
+ * @retval  false  The slotframes are being executed, the cells are invalid or do not fit.
+ */
+bool nrf_802154_tsch_engine_slotframe_set(uint8_t                        handle,
+                                          uint16_t                       length,
+                                          const nrf_802154_tsch_cell_t * p_cells,
+                                          uint16_t                       cells_count);
+
+/**
+ * @brief Starts the execution of the slotframes.
+ *
+ * @param[in]  asn       Absolute slot number of the timeslot that begins at @p asn_time.
+ * @param[in]  asn_time  Beginning of the timeslot @p asn, in microseconds of the SL Timer.
+ *
+ * @retval  true   The execution is started.
+ * @retval  false  The execution is already started or the hopping sequence is not set.
+ */
+bool nrf_802154_tsch_engine_start(uint64_t asn, uint64_t asn_time);
+
+/**
+ * @brief Stops the execution of the slotframes.
+ *
+ * A transmission that has already been requested is completed, a requested reception is
+ * cancelled. Queued frames are kept.
+ */
+void nrf_802154_tsch_engine_stop(void);
+
+/**
+ * @brief Shifts the beginning of the timeslots to follow the time source neighbor.
+ *
+ * @param[in]  correction  Time by which the timeslots are to begin later, in microseconds.
+ */
+void nrf_802154_tsch_engine_time_correct(int32_t correction);
+
+/**
+ * @brief Gets the absolute slot number of the current timeslot.
+ *
+ * @param[out]  p_asn  Absolute slot number of the current timeslot.
+ *
+ * @retval  true   The slotframes are being executed and @p p_asn is set.
+ * @retval  false  The slotframes are not being executed.
+ */
+bool nrf_802154_tsch_engine_asn_get(uint64_t * p_asn);
+
+/**
+ * @brief Queues a frame to be transmitted in the TX cells of the given neighbor.
+ *
+ * @param[in]  neighbor    Index of the neighbor queue.
+ * @param[in]  p_data      Pointer to a buffer that contains PHR and PSDU of the frame.
+ * @param[in]  p_metadata  Pointer to the metadata of the frame transmission.
+ *
+ * @retval  true   The frame is queued.
+ * @retval  false  The neighbor index is invalid or the queue is full.
+ */
+bool nrf_802154_tsch_engine_frame_add(uint8_t                                        neighbor,
+                                      uint8_t                                      * p_data,
+                                      const nrf_802154_transmit_csma_ca_metadata_t * p_metadata);
+
+/**
+ * @brief Removes a queued frame whose transmission has not been started yet.
+ *
+ * @param[in]  p_data  Pointer to a buffer that contains PHR and PSDU of the frame.
+ *
+ * @retval  true   The frame is removed from the queue.
+ * @retval  false  The frame is not in the queue or is being transmitted.
+ */
+bool nrf_802154_tsch_engine_frame_remove(const uint8_t * p_data);
+
+/**
+ * @brief Processes the outcome of a transmission attempt.
+ *
+ * A failed attempt of a queued frame is repeated in the next suitable cell until the allowed
+ * number of retransmissions is exhausted.
+ *
+ * @param[in]     p_frame  Pointer to a buffer that contains PHR and PSDU of the frame.
+ * @param[in]     error    Cause of the failed transmission or @ref NRF_802154_TX_ERROR_NONE.
+ * @param[inout]  p_meta   Pointer to the metadata of the outcome to be notified.
+ *
+ * @retval  true   The outcome is to be propagated to the MAC layer.
+ * @retval  false  The frame stays queued for another attempt.
+ */
+bool nrf_802154_tsch_engine_tx_outcome_hook(uint8_t                             * p_frame,
+                                            nrf_802154_tx_error_t                 error,
+                                            nrf_802154_transmit_done_metadata_t * p_meta);
+
+/**
+ * @brief Checks if the end of a delayed reception window is to be notified.
+ *
+ * @param[in]  id  Identifier of the delayed reception window.
+ *
+ * @retval  true   The window belongs to a TSCH RX cell. The end is not to be notified.
+ * @retval  false  The window does not belong to a TSCH RX cell.
+ */
+bool nrf_802154_tsch_engine_rx_window_end_hook(uint32_t id);
+
+/**
+ *@}
+ **/
+
+#endif // NRF_802154_TSCH_ENGINE_H_
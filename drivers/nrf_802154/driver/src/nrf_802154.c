@@ -48,17 +48,25 @@
 #include <stdint.h>
 #include <string.h>
 
+#include "nrf_802154_ant_div_tx.h"
+#include "nrf_802154_capture.h"
 #include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
 #include "nrf_802154_core.h"
 #include "nrf_802154_critical_section.h"
 #include "nrf_802154_debug.h"
+#include "nrf_802154_link_quality.h"
+#include "nrf_802154_noise_monitor.h"
 #include "nrf_802154_notification.h"
 #include "nrf_802154_nrfx_addons.h"
 #include "nrf_802154_pib.h"
+#include "nrf_802154_profiler.h"
+#include "nrf_802154_radio_trace.h"
 #include "nrf_802154_request.h"
+#include "nrf_802154_rssi.h"
 #include "nrf_802154_rx_buffer.h"
 #include "nrf_802154_tx_power.h"
+#include "nrf_802154_tx_power_control.h"
 #include "nrf_802154_stats.h"
 #include "hal/nrf_radio.h"
 #include "platform/nrf_802154_clock.h"
@@ -72,7 +80,11 @@
 #include "mac_features/nrf_802154_delayed_trx.h"
 #include "mac_features/nrf_802154_ie_writer.h"
 #include "mac_features/nrf_802154_ifs.h"
+#include "mac_features/nrf_802154_indirect_tx.h"
+#include "mac_features/nrf_802154_rx_duplicate_filter.h"
+#include "mac_features/nrf_802154_security_fc_persist.h"
 #include "mac_features/nrf_802154_security_pib.h"
+#include "mac_features/nrf_802154_tsch_engine.h"
 #include "mac_features/ack_generator/nrf_802154_ack_data.h"
 
 #include "nrf_802154_sl_ant_div.h"
@@ -140,6 +152,9 @@ void nrf_802154_channel_set(uint8_t channel)
 
     if (changed)
     {
+#if NRF_802154_TX_PREPARE_ENABLED
+        nrf_802154_core_transmit_prepared_invalidate();
+#endif
         (void)nrf_802154_request_channel_update(REQ_ORIG_HIGHER_LAYER);
     }
 }
@@ -152,6 +167,9 @@ uint8_t nrf_802154_channel_get(void)
 void nrf_802154_tx_power_set(int8_t power)
 {
     nrf_802154_pib_tx_power_set(power);
+#if NRF_802154_TX_PREPARE_ENABLED
+    nrf_802154_core_transmit_prepared_invalidate();
+#endif
 }
 
 int8_t nrf_802154_tx_power_get(void)
@@ -183,6 +201,10 @@ nrf_802154_coex_tx_request_mode_t nrf_802154_coex_tx_request_mode_get(void)
 
 void nrf_802154_temperature_changed(void)
 {
+#if NRF_802154_RSSI_TEMP_CORR_TABLE_ENABLED
+    nrf_802154_rssi_temp_corr_table_update();
+#endif
+
     nrf_802154_request_cca_cfg_update();
 }
 
@@ -234,14 +256,19 @@ void nrf_802154_init(void)
     };
 
     nrf_802154_ack_data_init();
+    nrf_802154_ant_div_tx_init();
     nrf_802154_core_init();
     nrf_802154_clock_init();
     nrf_802154_critical_section_init();
     nrf_802154_sl_crit_sect_init(&crit_sect_int);
     nrf_802154_debug_init();
+    nrf_802154_link_quality_init();
     nrf_802154_notification_init();
     nrf_802154_pib_init();
+    nrf_802154_profiler_init();
+    nrf_802154_radio_trace_init();
     nrf_802154_security_pib_init();
+    nrf_802154_security_fc_persist_init();
     nrf_802154_sl_timer_module_init();
     nrf_802154_random_init();
     nrf_802154_request_init();
@@ -249,7 +276,12 @@ void nrf_802154_init(void)
     nrf_802154_rsch_init();
     nrf_802154_rx_buffer_init();
     nrf_802154_temperature_init();
+    nrf_802154_tx_power_control_init();
+#if NRF_802154_RSSI_TEMP_CORR_TABLE_ENABLED
+    nrf_802154_rssi_temp_corr_table_update();
+#endif
     nrf_802154_timer_coord_init();
+    nrf_802154_noise_monitor_init();
 #if NRF_802154_ACK_TIMEOUT_ENABLED
     nrf_802154_ack_timeout_init();
 #endif
@@ -259,6 +291,15 @@ void nrf_802154_init(void)
 #if NRF_802154_IFS_ENABLED
     nrf_802154_ifs_init();
 #endif
+#if NRF_802154_RX_DUPLICATE_FILTER_ENABLED
+    nrf_802154_rx_duplicate_filter_init();
+#endif
+#if NRF_802154_INDIRECT_TX_ENABLED
+    nrf_802154_indirect_tx_init();
+#endif
+#if NRF_802154_TSCH_ENABLED
+    nrf_802154_tsch_engine_init();
+#endif
 }
 
 void nrf_802154_deinit(void)
@@ -268,9 +309,11 @@ void nrf_802154_deinit(void)
     nrf_802154_rsch_uninit();
     nrf_802154_random_deinit();
     nrf_802154_security_pib_deinit();
+    nrf_802154_noise_monitor_deinit();
     nrf_802154_sl_timer_module_uninit();
     nrf_802154_clock_deinit();
     nrf_802154_core_deinit();
+    nrf_802154_radio_trace_deinit();
 #if NRF_802154_ACK_TIMEOUT_ENABLED
     nrf_802154_ack_timeout_deinit();
 #endif
@@ -280,6 +323,9 @@ void nrf_802154_deinit(void)
 #if NRF_802154_IFS_ENABLED
     nrf_802154_ifs_deinit();
 #endif
+#if NRF_802154_TSCH_ENABLED
+    nrf_802154_tsch_engine_deinit();
+#endif
 }
 
 bool nrf_802154_antenna_diversity_rx_mode_set(nrf_802154_sl_ant_div_mode_t mode)
@@ -308,7 +354,22 @@ bool nrf_802154_antenna_diversity_tx_mode_set(nrf_802154_sl_ant_div_mode_t mode)
     bool result = false;
 
 #if defined(RADIO_INTENSET_SYNC_Msk)
+#if NRF_802154_ANT_DIV_TX_LEARNING_ENABLED
+    // The automatic selection of the transmit antenna is performed by the driver, which drives
+    // the antenna through the manual mode of the antenna diversity module.
+    bool auto_mode = (mode == NRF_802154_SL_ANT_DIV_MODE_AUTO);
+
+    result = nrf_802154_sl_ant_div_cfg_mode_set(NRF_802154_SL_ANT_DIV_OP_TX,
+                                                auto_mode ? NRF_802154_SL_ANT_DIV_MODE_MANUAL :
+                                                mode);
+
+    if (result)
+    {
+        nrf_802154_ant_div_tx_auto_set(auto_mode);
+    }
+#else
     result = nrf_802154_sl_ant_div_cfg_mode_set(NRF_802154_SL_ANT_DIV_OP_TX, mode);
+#endif
 #endif
 
     if (result)
@@ -321,6 +382,11 @@ bool nrf_802154_antenna_diversity_tx_mode_set(nrf_802154_sl_ant_div_mode_t mode)
 
 nrf_802154_sl_ant_div_mode_t nrf_802154_antenna_diversity_tx_mode_get(void)
 {
+    if (nrf_802154_ant_div_tx_auto_is_enabled())
+    {
+        return NRF_802154_SL_ANT_DIV_MODE_AUTO;
+    }
+
     return nrf_802154_sl_ant_div_cfg_mode_get(NRF_802154_SL_ANT_DIV_OP_TX);
 }
 
@@ -458,6 +524,20 @@ nrf_802154_sleep_error_t nrf_802154_sleep_if_idle(void)
     return result;
 }
 
+#if NRF_802154_LIGHT_SLEEP_ENABLED
+
+void nrf_802154_light_sleep_set(bool enabled)
+{
+    nrf_802154_core_light_sleep_set(enabled);
+}
+
+uint32_t nrf_802154_wake_latency_get(void)
+{
+    return nrf_802154_core_wake_latency_get();
+}
+
+#endif // NRF_802154_LIGHT_SLEEP_ENABLED
+
 bool nrf_802154_receive(void)
 {
     bool result;
@@ -504,6 +584,7 @@ bool nrf_802154_transmit_raw(uint8_t                              * p_data,
 
     (void)nrf_802154_tx_power_convert_metadata_to_tx_power_split(nrf_802154_pib_channel_get(),
                                                                  p_metadata->tx_power,
+                                                                 p_data,
                                                                  &params.tx_power);
 
     result = are_frame_properties_valid(&params.frame_props);
@@ -550,14 +631,14 @@ bool nrf_802154_transmit(const uint8_t                        * p_data,
         .immediate   = false
     };
 
-    (void)nrf_802154_tx_power_convert_metadata_to_tx_power_split(nrf_802154_pib_channel_get(),
-                                                                 p_metadata->tx_power,
-                                                                 &params.tx_power);
-
     result = are_frame_properties_valid(&params.frame_props);
     if (result)
     {
         tx_buffer_fill(p_data, length);
+        (void)nrf_802154_tx_power_convert_metadata_to_tx_power_split(nrf_802154_pib_channel_get(),
+                                                                     p_metadata->tx_power,
+                                                                     m_tx_buffer,
+                                                                     &params.tx_power);
         result = nrf_802154_request_transmit(NRF_802154_TERM_NONE,
                                              REQ_ORIG_HIGHER_LAYER,
                                              m_tx_buffer,
@@ -571,6 +652,50 @@ bool nrf_802154_transmit(const uint8_t                        * p_data,
 
 #endif // NRF_802154_USE_RAW_API
 
+#if NRF_802154_TX_PREPARE_ENABLED
+bool nrf_802154_transmit_prepare(uint8_t                              * p_data,
+                                 const nrf_802154_transmit_metadata_t * p_metadata)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    if (p_metadata == NULL)
+    {
+        static const nrf_802154_transmit_metadata_t metadata_default =
+        {
+            .frame_props = NRF_802154_TRANSMITTED_FRAME_PROPS_DEFAULT_INIT,
+            .cca         = true,
+            .tx_power    = {.use_metadata_value = false}
+        };
+
+        p_metadata = &metadata_default;
+    }
+
+    result = are_frame_properties_valid(&p_metadata->frame_props);
+    if (result)
+    {
+        result = nrf_802154_request_transmit_prepare(p_data, p_metadata);
+    }
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+bool nrf_802154_transmit_commit(void)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_request_transmit_commit(NRF_802154_TERM_NONE, REQ_ORIG_HIGHER_LAYER);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+#endif // NRF_802154_TX_PREPARE_ENABLED
+
 #if NRF_802154_DELAYED_TRX_ENABLED
 bool nrf_802154_transmit_raw_at(uint8_t                                 * p_data,
                                 uint64_t                                  tx_time,
@@ -602,6 +727,49 @@ bool nrf_802154_transmit_raw_at(uint8_t                                 * p_data
     return result;
 }
 
+bool nrf_802154_transmit_raw_burst_at(uint8_t * const                         * pp_data,
+                                      uint8_t                                   count,
+                                      uint64_t                                  tx_time,
+                                      const nrf_802154_transmit_at_metadata_t * p_metadata)
+{
+    bool                              result;
+    nrf_802154_transmit_at_metadata_t metadata_default =
+    {
+        .frame_props = NRF_802154_TRANSMITTED_FRAME_PROPS_DEFAULT_INIT,
+        .cca         = true,
+        .tx_power    = {.use_metadata_value = false}
+    };
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    if (p_metadata == NULL)
+    {
+        metadata_default.channel = nrf_802154_channel_get();
+        p_metadata               = &metadata_default;
+    }
+
+    result = (count > 0) && (count <= NRF_802154_DELAYED_TRX_TX_QUEUE_SIZE) &&
+             are_frame_properties_valid(&p_metadata->frame_props);
+
+    for (uint8_t i = 0; result && (i < count); i++)
+    {
+        result = nrf_802154_request_transmit_raw_at(pp_data[i], tx_time, p_metadata);
+
+        if (!result && (i > 0))
+        {
+            // Do not leave a part of the burst scheduled.
+            (void)nrf_802154_request_transmit_at_cancel();
+        }
+
+        tx_time = nrf_802154_delayed_trx_burst_next_tx_time_get(tx_time,
+                                                                pp_data[i],
+                                                                p_metadata->cca);
+    }
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
 bool nrf_802154_transmit_at_cancel(void)
 {
     bool result;
@@ -614,6 +782,11 @@ bool nrf_802154_transmit_at_cancel(void)
     return result;
 }
 
+uint32_t nrf_802154_transmit_at_setup_time_get(bool cca)
+{
+    return nrf_802154_delayed_trx_tx_setup_time_get(cca);
+}
+
 bool nrf_802154_receive_at(uint64_t rx_time,
                            uint32_t timeout,
                            uint8_t  channel,
@@ -629,6 +802,47 @@ bool nrf_802154_receive_at(uint64_t rx_time,
     return result;
 }
 
+bool nrf_802154_receive_at_periodic(uint64_t rx_time,
+                                    uint32_t period,
+                                    uint32_t timeout,
+                                    uint8_t  channel,
+                                    uint32_t count,
+                                    uint32_t id)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_request_receive_at_periodic(rx_time, period, timeout, channel, count, id);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+bool nrf_802154_receive_at_duty_cycled(uint64_t rx_time,
+                                       uint32_t period,
+                                       uint32_t window,
+                                       uint32_t extension,
+                                       uint8_t  channel,
+                                       uint32_t count,
+                                       uint32_t id)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_request_receive_at_duty_cycled(rx_time,
+                                                       period,
+                                                       window,
+                                                       extension,
+                                                       channel,
+                                                       count,
+                                                       id);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
 bool nrf_802154_receive_at_cancel(uint32_t id)
 {
     bool result;
@@ -655,6 +869,21 @@ bool nrf_802154_energy_detection(uint32_t time_us)
     return result;
 }
 
+bool nrf_802154_energy_scan(uint32_t channel_mask, uint32_t dwell_time_us)
+{
+    bool result = false;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    if ((channel_mask != 0U) && ((channel_mask & ~NRF_802154_ENERGY_SCAN_CHANNELS_MASK) == 0U))
+    {
+        result = nrf_802154_request_energy_scan(NRF_802154_TERM_NONE, channel_mask, dwell_time_us);
+    }
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
 bool nrf_802154_cca(void)
 {
     bool result;
@@ -706,7 +935,7 @@ void nrf_802154_buffer_free_raw(uint8_t * p_data)
     bool          result;
     rx_buffer_t * p_buffer = (rx_buffer_t *)p_data;
 
-    assert(p_buffer->free == false);
+    assert(!nrf_802154_rx_buffer_is_free(p_buffer));
     (void)p_buffer;
 
     result = nrf_802154_request_buffer_free(p_data);
@@ -723,7 +952,7 @@ bool nrf_802154_buffer_free_immediately_raw(uint8_t * p_data)
     bool          result;
     rx_buffer_t * p_buffer = (rx_buffer_t *)p_data;
 
-    assert(p_buffer->free == false);
+    assert(!nrf_802154_rx_buffer_is_free(p_buffer));
     (void)p_buffer;
 
     result = nrf_802154_request_buffer_free(p_data);
@@ -741,7 +970,7 @@ void nrf_802154_buffer_free(uint8_t * p_data)
     bool          result;
     rx_buffer_t * p_buffer = (rx_buffer_t *)(p_data - RAW_PAYLOAD_OFFSET);
 
-    assert(p_buffer->free == false);
+    assert(!nrf_802154_rx_buffer_is_free(p_buffer));
     (void)p_buffer;
 
     result = nrf_802154_request_buffer_free(p_data - RAW_PAYLOAD_OFFSET);
@@ -758,7 +987,7 @@ bool nrf_802154_buffer_free_immediately(uint8_t * p_data)
     bool          result;
     rx_buffer_t * p_buffer = (rx_buffer_t *)(p_data - RAW_PAYLOAD_OFFSET);
 
-    assert(p_buffer->free == false);
+    assert(!nrf_802154_rx_buffer_is_free(p_buffer));
     (void)p_buffer;
 
     result = nrf_802154_request_buffer_free(p_data - RAW_PAYLOAD_OFFSET);
@@ -796,6 +1025,41 @@ void nrf_802154_promiscuous_set(bool enabled)
     nrf_802154_pib_promiscuous_set(enabled);
 }
 
+#if NRF_802154_CAPTURE_ENABLED
+
+bool nrf_802154_capture_start(uint8_t * p_ring, uint32_t ring_size)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_capture_ring_set(p_ring, ring_size);
+
+    if (result)
+    {
+        result = nrf_802154_request_receive(NRF_802154_TERM_802154,
+                                            REQ_ORIG_HIGHER_LAYER,
+                                            NULL,
+                                            true,
+                                            NRF_802154_RESERVED_IMM_RX_WINDOW_ID);
+
+        if (!result)
+        {
+            nrf_802154_capture_ring_clear();
+        }
+    }
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+void nrf_802154_capture_stop(void)
+{
+    nrf_802154_capture_ring_clear();
+}
+
+#endif // NRF_802154_CAPTURE_ENABLED
+
 void nrf_802154_auto_ack_set(bool enabled)
 {
     nrf_802154_pib_auto_ack_set(enabled);
@@ -806,6 +1070,36 @@ bool nrf_802154_auto_ack_get(void)
     return nrf_802154_pib_auto_ack_get();
 }
 
+#if NRF_802154_RX_PREFILTER_ENABLED
+void nrf_802154_rx_prefilter_set(nrf_802154_rx_prefilter_t prefilter)
+{
+    nrf_802154_pib_rx_prefilter_set(prefilter);
+}
+
+#endif // NRF_802154_RX_PREFILTER_ENABLED
+
+#if NRF_802154_IDENTITIES_NUM > 0
+bool nrf_802154_identity_set(uint8_t index, const nrf_802154_identity_t * p_identity)
+{
+    return nrf_802154_pib_identity_set(index, p_identity);
+}
+
+bool nrf_802154_identity_clear(uint8_t index)
+{
+    return nrf_802154_pib_identity_clear(index);
+}
+
+#endif // NRF_802154_IDENTITIES_NUM > 0
+
+#if NRF_802154_LINK_QUALITY_PEERS_COUNT > 0
+
+uint8_t nrf_802154_link_quality_read(nrf_802154_link_quality_t * p_entries, uint8_t count)
+{
+    return nrf_802154_link_quality_peers_read(p_entries, count);
+}
+
+#endif // NRF_802154_LINK_QUALITY_PEERS_COUNT > 0
+
 bool nrf_802154_pan_coord_get(void)
 {
     return nrf_802154_pib_pan_coord_get();
@@ -837,6 +1131,29 @@ bool nrf_802154_ack_data_clear(const uint8_t       * p_addr,
     return nrf_802154_ack_data_for_addr_clear(p_addr, extended, data_type);
 }
 
+bool nrf_802154_ack_data_set_batch(const uint8_t       * p_addrs,
+                                   bool                  extended,
+                                   uint8_t               num_addrs,
+                                   const void          * p_data,
+                                   const uint8_t       * p_lengths,
+                                   nrf_802154_ack_data_t data_type)
+{
+    return nrf_802154_ack_data_for_addrs_set_batch(p_addrs,
+                                                   extended,
+                                                   num_addrs,
+                                                   data_type,
+                                                   p_data,
+                                                   p_lengths);
+}
+
+bool nrf_802154_ack_data_clear_batch(const uint8_t       * p_addrs,
+                                     bool                  extended,
+                                     uint8_t               num_addrs,
+                                     nrf_802154_ack_data_t data_type)
+{
+    return nrf_802154_ack_data_for_addrs_clear_batch(p_addrs, extended, num_addrs, data_type);
+}
+
 void nrf_802154_auto_pending_bit_set(bool enabled)
 {
     nrf_802154_ack_data_enable(enabled);
@@ -970,6 +1287,126 @@ uint8_t nrf_802154_csma_ca_max_backoffs_get(void)
 
 #endif // NRF_802154_CSMA_CA_ENABLED
 
+#if NRF_802154_INDIRECT_TX_ENABLED && NRF_802154_USE_RAW_API
+
+bool nrf_802154_indirect_frame_queue(const uint8_t                                * p_addr,
+                                     bool                                           extended,
+                                     uint8_t                                      * p_data,
+                                     const nrf_802154_transmit_csma_ca_metadata_t * p_metadata)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    if (p_metadata == NULL)
+    {
+        static const nrf_802154_transmit_csma_ca_metadata_t metadata_default =
+        {
+            .frame_props = NRF_802154_TRANSMITTED_FRAME_PROPS_DEFAULT_INIT,
+            .tx_power    = {.use_metadata_value = false}
+        };
+
+        p_metadata = &metadata_default;
+    }
+
+    result = are_frame_properties_valid(&p_metadata->frame_props) &&
+             nrf_802154_indirect_tx_frame_add(p_addr, extended, p_data, p_metadata);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+bool nrf_802154_indirect_frame_remove(const uint8_t * p_data)
+{
+    return nrf_802154_indirect_tx_frame_remove(p_data);
+}
+
+#endif // NRF_802154_INDIRECT_TX_ENABLED && NRF_802154_USE_RAW_API
+
+#if NRF_802154_TSCH_ENABLED && NRF_802154_USE_RAW_API
+
+bool nrf_802154_tsch_timing_set(const nrf_802154_tsch_timing_t * p_timing)
+{
+    return nrf_802154_tsch_engine_timing_set(p_timing);
+}
+
+bool nrf_802154_tsch_hopping_sequence_set(const uint8_t * p_channels, uint8_t length)
+{
+    return nrf_802154_tsch_engine_hopping_sequence_set(p_channels, length);
+}
+
+bool nrf_802154_tsch_slotframe_set(uint8_t                        handle,
+                                   uint16_t                       length,
+                                   const nrf_802154_tsch_cell_t * p_cells,
+                                   uint16_t                       cells_count)
+{
+    return nrf_802154_tsch_engine_slotframe_set(handle, length, p_cells, cells_count);
+}
+
+bool nrf_802154_tsch_start(uint64_t asn, uint64_t asn_time)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_tsch_engine_start(asn, asn_time);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+void nrf_802154_tsch_stop(void)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    nrf_802154_tsch_engine_stop();
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+}
+
+void nrf_802154_tsch_time_correct(int32_t correction)
+{
+    nrf_802154_tsch_engine_time_correct(correction);
+}
+
+bool nrf_802154_tsch_asn_get(uint64_t * p_asn)
+{
+    return nrf_802154_tsch_engine_asn_get(p_asn);
+}
+
+bool nrf_802154_tsch_frame_queue(uint8_t                                        neighbor,
+                                 uint8_t                                      * p_data,
+                                 const nrf_802154_transmit_csma_ca_metadata_t * p_metadata)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    if (p_metadata == NULL)
+    {
+        static const nrf_802154_transmit_csma_ca_metadata_t metadata_default =
+        {
+            .frame_props = NRF_802154_TRANSMITTED_FRAME_PROPS_DEFAULT_INIT,
+            .tx_power    = {.use_metadata_value = false}
+        };
+
+        p_metadata = &metadata_default;
+    }
+
+    result = are_frame_properties_valid(&p_metadata->frame_props) &&
+             nrf_802154_tsch_engine_frame_add(neighbor, p_data, p_metadata);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+bool nrf_802154_tsch_frame_remove(const uint8_t * p_data)
+{
+    return nrf_802154_tsch_engine_frame_remove(p_data);
+}
+
+#endif // NRF_802154_TSCH_ENABLED && NRF_802154_USE_RAW_API
+
 #if NRF_802154_ACK_TIMEOUT_ENABLED
 
 void nrf_802154_ack_timeout_set(uint32_t time)
@@ -1064,20 +1501,32 @@ uint64_t nrf_802154_time_get(void)
 void nrf_802154_security_global_frame_counter_set(uint32_t frame_counter)
 {
     nrf_802154_security_pib_global_frame_counter_set(frame_counter);
+#if NRF_802154_TX_PREPARE_ENABLED
+    nrf_802154_core_transmit_prepared_invalidate();
+#endif
 }
 
 void nrf_802154_security_global_frame_counter_set_if_larger(uint32_t frame_counter)
 {
     nrf_802154_security_pib_global_frame_counter_set_if_larger(frame_counter);
+#if NRF_802154_TX_PREPARE_ENABLED
+    nrf_802154_core_transmit_prepared_invalidate();
+#endif
 }
 
 nrf_802154_security_error_t nrf_802154_security_key_store(nrf_802154_key_t * p_key)
 {
+#if NRF_802154_TX_PREPARE_ENABLED
+    nrf_802154_core_transmit_prepared_invalidate();
+#endif
     return nrf_802154_security_pib_key_store(p_key);
 }
 
 nrf_802154_security_error_t nrf_802154_security_key_remove(nrf_802154_key_id_t * p_id)
 {
+#if NRF_802154_TX_PREPARE_ENABLED
+    nrf_802154_core_transmit_prepared_invalidate();
+#endif
     return nrf_802154_security_pib_key_remove(p_id);
 }
 
@@ -1215,6 +1664,15 @@ __WEAK void nrf_802154_energy_detection_failed(nrf_802154_ed_error_t error)
     (void)error;
 }
 
+__WEAK void nrf_802154_energy_scan_done(uint32_t        channel_mask,
+                                        const uint8_t * p_results,
+                                        uint8_t         results_count)
+{
+    (void)channel_mask;
+    (void)p_results;
+    (void)results_count;
+}
+
 __WEAK void nrf_802154_cca_done(bool channel_free)
 {
     (void)channel_free;
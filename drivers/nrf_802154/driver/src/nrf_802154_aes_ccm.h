@@ -77,6 +77,19 @@ void nrf_802154_aes_ccm_transform_reset(void);
  */
 bool nrf_802154_aes_ccm_transform_prepare(const nrf_802154_aes_ccm_data_t * p_aes_ccm_data);
 
+/**
+ * @brief Gets the worst-case duration of the prepared AES-CCM* transformation.
+ *
+ * The encryption keystream is computed as soon as the transformation is prepared, so only
+ * the authentication remains once the transformation is started. The returned value assumes
+ * that @ref nrf_802154_aes_ccm_transform_start is called right after
+ * @ref nrf_802154_aes_ccm_transform_prepare and is therefore an upper bound.
+ *
+ * @return Time in microseconds from the start of the transformation until the secured frame
+ *         is complete, or 0 if no transformation is prepared.
+ */
+uint16_t nrf_802154_aes_ccm_transform_latency_get(void);
+
 /**
  * @brief Starts AES-CCM* transformation.
  *
@@ -45,7 +45,16 @@
 #include "nrf_802154_const.h"
 #include "nrf_802154_config.h"
 #include "nrf_802154_tx_work_buffer.h"
+
+#if NRF_802154_ECB_SHARED_ENABLED
+#include "nrfx_ecb.h"
+
+#if NRF_802154_TX_IN_PLACE_ENABLED
+#error "NRF_802154_ECB_SHARED_ENABLED is not supported together with NRF_802154_TX_IN_PLACE_ENABLED"
+#endif
+#else
 #include "platform/nrf_802154_irq.h"
+#endif
 
 #ifndef MIN
 #define MIN(a, b)                                 ((a) < (b) ? (a) : (b)) ///< Leaves the minimum of the two arguments
@@ -63,15 +72,27 @@
 #define NRF_802154_AES_CCM_AUTH_DATA_LENGTH_OCTET 0                       // AnnnexB4.1.1b) - Position of octet for length of auth data in AddAuthData
 #define NRF_802154_AES_CCM_AUTH_DATA_OCTET        2                       // AnnnexB4.1.1b) - Position of octet for data of auth data in AddAuthData
 
+#define NRF_802154_AES_CCM_ECB_BLOCK_TIME_US      15                      // Worst-case time of a single ECB block including interrupt handling
+
 /**
  * @brief Steps of AES-CCM* algorithm.
+ *
+ * The keystream does not depend on the frame header, so it is computed and applied to the
+ * plain text as soon as the transformation is prepared. Only the authentication, which covers
+ * the header updated when the transmission starts, is left for
+ * @ref nrf_802154_aes_ccm_transform_start.
+ *
+ * When @ref NRF_802154_TX_IN_PLACE_ENABLED is set, the cipher text replaces the plain text in
+ * the original frame. The plain text is then encrypted only after it has been authenticated.
  */
 typedef enum
 {
+    PLAIN_TEXT_ENCRYPT,
+    CALCULATE_ENCRYPTED_TAG,
+    KEYSTREAM_READY,
     ADD_AUTH_DATA_AUTH,
     PLAIN_TEXT_AUTH,
-    PLAIN_TEXT_ENCRYPT,
-    CALCULATE_ENCRYPTED_TAG
+    TRANSFORMATION_DONE
 } ccm_steps_t;
 
 /**
@@ -79,8 +100,9 @@ typedef enum
  */
 typedef struct
 {
-    ccm_steps_t transformation;                                                    // Actual step of transformation
-    uint8_t     iteration;                                                         // Iteration of actual step of transformation
+    volatile ccm_steps_t transformation;                                           // Actual step of transformation
+    uint8_t              iteration;                                                // Iteration of actual step of transformation
+    volatile bool        start_pending;                                            // Transformation was started before the keystream was ready
 } ccm_state_t;
 
 static nrf_802154_aes_ccm_data_t m_aes_ccm_data;                                   ///< AES CCM Frame
@@ -90,6 +112,7 @@ static uint8_t                   m_m[NRF_802154_AES_CCM_BLOCK_SIZE];
 static uint8_t                   m_a[NRF_802154_AES_CCM_BLOCK_SIZE];               ///< A[i] octet for Encryption Transformation - Annex B4.1.3 b)
 static ccm_state_t               m_state;                                          ///< State of AES-CCM* transformation
 static uint8_t                   m_auth_tag[MIC_128_SIZE];                         ///< Authorization Tag
+static uint8_t                   m_tag_keystream[MIC_128_SIZE];                    ///< Keystream block S0 used to encrypt the Authorization Tag
 static bool                      m_initialized;                                    ///< Flag that indicates whether the module has been initialized.
 static uint8_t                 * mp_ciphertext;                                    ///< Pointer to ciphertext destination buffer.
 static uint8_t                 * mp_work_buffer;                                   ///< Pointer to work buffer that stores the frame being transformed.
@@ -105,18 +128,113 @@ static uint8_t * mp_ecb_key;        ///< Key:        Starts at ecb_data
 static uint8_t * mp_ecb_cleartext;  ///< Cleartext:  Starts at ecb_data + 16 bytes.
 static uint8_t * mp_ecb_ciphertext; ///< Ciphertext: Starts at ecb_data + 32 bytes.
 
+static void ecb_block_finished(void);
+
+static void nrf_ecb_set_key(const uint8_t * p_key)
+{
+    memcpy(mp_ecb_key, p_key, 16);
+}
+
+#if NRF_802154_ECB_SHARED_ENABLED
+
+/*
+ * The ECB peripheral is shared through the nrfx_ecb driver. The data structure above is then
+ * only a local copy of the key and the blocks, which is passed to the peripheral by the driver.
+ */
+
+static nrfx_ecb_job_t m_ecb_job;            ///< Job of the nrfx_ecb driver performing the transformation.
+static volatile bool  m_ecb_block_handling; ///< Flag indicating that the encrypted block is being processed.
+static volatile bool  m_ecb_block_next;     ///< Flag indicating that the next block was scheduled while processing the block.
+
+/**
+ * @brief Block handler of the nrfx_ecb driver job performing the transformation.
+ */
+static bool ecb_job_block_handler(nrfx_ecb_job_t * p_job,
+                                  uint8_t const  * p_ciphertext,
+                                  uint8_t        * p_cleartext,
+                                  void           * p_context)
+{
+    (void)p_job;
+    (void)p_context;
+
+    if (p_ciphertext != NULL)
+    {
+        memcpy(mp_ecb_ciphertext, p_ciphertext, NRF_802154_AES_CCM_BLOCK_SIZE);
+
+        m_ecb_block_next     = false;
+        m_ecb_block_handling = true;
+        ecb_block_finished();
+        m_ecb_block_handling = false;
+
+        if (!m_ecb_block_next)
+        {
+            return false;
+        }
+    }
+
+    memcpy(p_cleartext, mp_ecb_cleartext, NRF_802154_AES_CCM_BLOCK_SIZE);
+
+    return true;
+}
+
 static void nrf_ecb_init(void)
 {
     mp_ecb_key        = m_ecb_data;
     mp_ecb_cleartext  = m_ecb_data + 16;
     mp_ecb_ciphertext = m_ecb_data + 32;
 
-    nrf_ecb_data_pointer_set(NRF_ECB, m_ecb_data);
+    m_ecb_job.p_key         = mp_ecb_key;
+    m_ecb_job.block_handler = ecb_job_block_handler;
+    m_ecb_job.priority      = NRF_802154_ECB_SHARED_JOB_PRIORITY;
 }
 
-static void nrf_ecb_set_key(const uint8_t * p_key)
+/**
+ * @brief Initializes the job of the nrfx_ecb driver.
+ */
+static void ecb_init(void)
 {
-    memcpy(mp_ecb_key, p_key, 16);
+    nrf_ecb_init();
+}
+
+/**
+ * @brief Starts encryption of the block stored in the ECB data structure.
+ */
+static void ecb_block_start(void)
+{
+    if (m_ecb_block_handling)
+    {
+        // The job continues with the next block when the block handler returns.
+        m_ecb_block_next = true;
+        return;
+    }
+
+    // The job may still be finishing, if it has just returned its last block. It is submitted
+    // again from scratch, as its cleartext is kept in the ECB data structure.
+    (void)nrfx_ecb_job_cancel(&m_ecb_job);
+
+    nrfx_err_t err = nrfx_ecb_job_submit(&m_ecb_job);
+
+    assert(err == NRFX_SUCCESS);
+    (void)err;
+}
+
+/**
+ * @brief Stops any ECB operation that is in progress.
+ */
+static void ecb_stop(void)
+{
+    (void)nrfx_ecb_job_cancel(&m_ecb_job);
+}
+
+#else // NRF_802154_ECB_SHARED_ENABLED
+
+static void nrf_ecb_init(void)
+{
+    mp_ecb_key        = m_ecb_data;
+    mp_ecb_cleartext  = m_ecb_data + 16;
+    mp_ecb_ciphertext = m_ecb_data + 32;
+
+    nrf_ecb_data_pointer_set(NRF_ECB, m_ecb_data);
 }
 
 static void ecb_irq_handler(void);
@@ -142,6 +260,33 @@ static void ecb_init(void)
     nrf_ecb_int_enable(NRF_ECB, NRF_ECB_INT_ERRORECB_MASK);
 }
 
+/**
+ * @brief Starts encryption of the block stored in the ECB data structure.
+ */
+static void ecb_block_start(void)
+{
+    nrf_ecb_event_clear(NRF_ECB, NRF_ECB_EVENT_ENDECB);
+    nrf_ecb_task_trigger(NRF_ECB, NRF_ECB_TASK_STARTECB);
+}
+
+/**
+ * @brief Stops any ECB operation that is in progress.
+ */
+static void ecb_stop(void)
+{
+    /*
+     * Temporarily disable ENDECB interrupt, trigger STOPECB task
+     * to stop encryption in case it is still running and clear
+     * the ENDECB event in case the encryption has completed.
+     */
+    nrf_ecb_int_disable(NRF_ECB, NRF_ECB_INT_ENDECB_MASK);
+    nrf_ecb_task_trigger(NRF_ECB, NRF_ECB_TASK_STOPECB);
+    nrf_ecb_event_clear(NRF_ECB, NRF_ECB_EVENT_ENDECB);
+    nrf_ecb_int_enable(NRF_ECB, NRF_ECB_INT_ENDECB_MASK);
+}
+
+#endif // NRF_802154_ECB_SHARED_ENABLED
+
 /******************************************************************************/
 /******************************************************************************/
 /******************************************************************************/
@@ -310,6 +455,18 @@ static bool plain_text_data_get(const nrf_802154_aes_ccm_data_t * p_frame,
     return true;
 }
 
+/**
+ * @brief Calculates number of 16-octet blocks needed to hold given number of octets.
+ *
+ * @param[in] len  Number of octets.
+ *
+ * @return Number of blocks.
+ */
+static inline uint32_t blocks_count(uint32_t len)
+{
+    return (len + NRF_802154_AES_CCM_BLOCK_SIZE - 1) / NRF_802154_AES_CCM_BLOCK_SIZE;
+}
+
 /**
  * @brief Block of Authorization Transformation iteration
  */
@@ -318,7 +475,7 @@ static inline void process_ecb_auth_iteration(void)
     m_state.iteration++;
     two_blocks_xor(mp_ecb_ciphertext, m_b, NRF_802154_AES_CCM_BLOCK_SIZE);
     memcpy(mp_ecb_cleartext, mp_ecb_ciphertext, NRF_802154_AES_CCM_BLOCK_SIZE);
-    nrf_ecb_task_trigger(NRF_ECB, NRF_ECB_TASK_STARTECB);
+    ecb_block_start();
 }
 
 /**
@@ -328,131 +485,221 @@ static inline void process_ecb_encrypt_iteration(void)
 {
     ai_format(&m_aes_ccm_data, m_state.iteration, m_a);
     memcpy(mp_ecb_cleartext, m_a, NRF_802154_AES_CCM_BLOCK_SIZE);
-    nrf_ecb_task_trigger(NRF_ECB, NRF_ECB_TASK_STARTECB);
+    ecb_block_start();
+}
+
+static void transformation_finished(void)
+{
+    m_state.transformation = TRANSFORMATION_DONE;
+    nrf_802154_tx_work_buffer_is_secured_set();
+    m_aes_ccm_data.raw_frame = NULL;
 }
 
 /**
- * @brief helper function for plain text encryption in ECB IRQ
+ * @brief Start encryption of the plain text into the cipher text destination.
+ *
+ * @retval  true   Encryption has been started.
+ * @retval  false  There is no plain text to be encrypted.
  */
-static void perform_plain_text_encryption(void)
+static bool start_ecb_plain_text_encryption(void)
 {
-    memcpy(m_auth_tag, mp_ecb_ciphertext, m_mic_size[m_aes_ccm_data.mic_level]);
+    if (!plain_text_data_get(&m_aes_ccm_data, 0, m_m))
+    {
+        return false;
+    }
 
-    m_state.iteration      = 0;
+    m_state.iteration      = 1;
     m_state.transformation = PLAIN_TEXT_ENCRYPT;
 
-    if (plain_text_data_get(&m_aes_ccm_data, m_state.iteration, m_m))
+    ai_format(&m_aes_ccm_data, m_state.iteration, m_a);
+    memcpy(mp_ecb_cleartext, m_a, NRF_802154_AES_CCM_BLOCK_SIZE);
+    ecb_block_start();
+
+    return true;
+}
+
+/**
+ * @brief Completes the transformation after the Authorization Tag has been calculated.
+ */
+static void auth_transformation_finished(void)
+{
+#if NRF_802154_TX_IN_PLACE_ENABLED
+    if (start_ecb_plain_text_encryption())
+    {
+        // From now on the original frame no longer holds the plain text. It is reported as
+        // secured, as the encryption is always completed, see nrf_802154_aes_ccm_transform_abort.
+        nrf_802154_tx_work_buffer_is_secured_set();
+        return;
+    }
+#endif
+
+    transformation_finished();
+}
+
+/**
+ * @brief Start AES-CCM* Authorization Transformation
+ */
+static void start_ecb_auth_transformation(void)
+{
+    uint8_t auth_flags = auth_flags_format(&m_aes_ccm_data);
+
+    if (m_mic_size[m_aes_ccm_data.mic_level] == 0)
     {
-        m_state.iteration++;
-        process_ecb_encrypt_iteration();
+        // No Authorization Tag, the encrypted frame is already complete
+        auth_transformation_finished();
+        return;
     }
-    else
+
+    // initial settings
+    memset(m_x, 0, NRF_802154_AES_CCM_BLOCK_SIZE);
+    b0_format(&m_aes_ccm_data, auth_flags, m_b);
+    two_blocks_xor(m_x, m_b, NRF_802154_AES_CCM_BLOCK_SIZE);
+
+    memcpy(mp_ecb_cleartext, m_x, NRF_802154_AES_CCM_BLOCK_SIZE);
+    m_state.iteration      = 0;
+    m_state.transformation = ADD_AUTH_DATA_AUTH;
+    ecb_block_start();
+}
+
+/**
+ * @brief Marks the keystream as ready and starts authorization if it was already requested.
+ */
+static void keystream_finished(void)
+{
+    // The state must be updated before the request is checked. A start request that
+    // preempts this function either sees the state or is seen here.
+    m_state.transformation = KEYSTREAM_READY;
+
+    if (m_state.start_pending)
     {
-        if (m_mic_size[m_aes_ccm_data.mic_level] != 0)
-        {
-            process_ecb_encrypt_iteration();
-            m_state.transformation = CALCULATE_ENCRYPTED_TAG;
-        }
+        m_state.start_pending = false;
+        start_ecb_auth_transformation();
     }
 }
 
 /**
- * @brief helper function for plain text auth in ECB IRQ
+ * @brief Start AES-CCM* Encryption Transformation
+ *
+ * Encrypts the plain text into the work buffer and calculates the keystream block
+ * for the Authorization Tag. In the in-place mode only the keystream block for the
+ * Authorization Tag is calculated.
  */
-static void perform_plain_text_authorization(void)
+static void start_ecb_encrypt_transformation(void)
 {
-    if (plain_text_data_get(&m_aes_ccm_data, m_state.iteration, m_b))
+    m_state.start_pending = false;
+
+#if !NRF_802154_TX_IN_PLACE_ENABLED
+    if (start_ecb_plain_text_encryption())
     {
-        process_ecb_auth_iteration();
+        return;
     }
-    else
+#endif
+
+    if (m_mic_size[m_aes_ccm_data.mic_level] == 0)
     {
-        perform_plain_text_encryption();
+        keystream_finished();
+        return;
     }
+
+    m_state.iteration      = 0;
+    m_state.transformation = CALCULATE_ENCRYPTED_TAG;
+
+    ai_format(&m_aes_ccm_data, m_state.iteration, m_a);
+    memcpy(mp_ecb_cleartext, m_a, NRF_802154_AES_CCM_BLOCK_SIZE);
+    ecb_block_start();
 }
 
-static void transformation_finished(void)
+/**
+ * @brief Processes the result of a single ECB block and schedules the next one.
+ */
+static void ecb_block_finished(void)
 {
-    nrf_802154_tx_work_buffer_is_secured_set();
-    m_aes_ccm_data.raw_frame = NULL;
+    uint8_t len      = 0;
+    uint8_t offset;
+    uint8_t mic_size = m_mic_size[m_aes_ccm_data.mic_level];
+
+    switch (m_state.transformation)
+    {
+        case PLAIN_TEXT_ENCRYPT:
+            two_blocks_xor(m_m, mp_ecb_ciphertext, NRF_802154_AES_CCM_BLOCK_SIZE);
+
+            offset = (m_state.iteration - 1) * NRF_802154_AES_CCM_BLOCK_SIZE;
+            len    = MIN(m_aes_ccm_data.plain_text_data_len - offset,
+                         NRF_802154_AES_CCM_BLOCK_SIZE);
+            memcpy(mp_ciphertext + offset, m_m, len);
+            if (plain_text_data_get(&m_aes_ccm_data, m_state.iteration, m_m))
+            {
+                m_state.iteration++;
+                process_ecb_encrypt_iteration();
+            }
+            else if (NRF_802154_TX_IN_PLACE_ENABLED)
+            {
+                // The plain text has already been authenticated
+                transformation_finished();
+            }
+            else if (mic_size != 0)
+            {
+                m_state.iteration      = 0;
+                m_state.transformation = CALCULATE_ENCRYPTED_TAG;
+                process_ecb_encrypt_iteration();
+            }
+            else
+            {
+                keystream_finished();
+            }
+            break;
+
+        case CALCULATE_ENCRYPTED_TAG:
+            memcpy(m_tag_keystream, mp_ecb_ciphertext, mic_size);
+            keystream_finished();
+            break;
+
+        case ADD_AUTH_DATA_AUTH:
+            if (add_auth_data_get(&m_aes_ccm_data, m_state.iteration, m_b))
+            {
+                process_ecb_auth_iteration();
+                break;
+            }
+
+            m_state.iteration      = 0;
+            m_state.transformation = PLAIN_TEXT_AUTH;
+        /* Fallthrough */
+
+        case PLAIN_TEXT_AUTH:
+            if (plain_text_data_get(&m_aes_ccm_data, m_state.iteration, m_b))
+            {
+                process_ecb_auth_iteration();
+                break;
+            }
+
+            memcpy(m_auth_tag, mp_ecb_ciphertext, mic_size);
+            two_blocks_xor(m_auth_tag, m_tag_keystream, mic_size);
+            memcpy(mp_work_buffer +
+                   (mp_work_buffer[PHR_OFFSET] - FCS_SIZE - mic_size + PHR_SIZE),
+                   m_auth_tag,
+                   mic_size);
+            auth_transformation_finished();
+            break;
+
+        default:
+            break;
+    }
 }
 
+#if !NRF_802154_ECB_SHARED_ENABLED
+
 /**
  * @brief Handler to ECB Interrupt Routine
  *  Performs AES-CCM* calculation in pipeline
  */
 static void ecb_irq_handler(void)
 {
-    uint8_t len = 0;
-    uint8_t offset;
-
     if (nrf_ecb_int_enable_check(NRF_ECB, NRF_ECB_INT_ENDECB_MASK) &&
         nrf_ecb_event_check(NRF_ECB, NRF_ECB_EVENT_ENDECB))
     {
         nrf_ecb_event_clear(NRF_ECB, NRF_ECB_EVENT_ENDECB);
 
-        switch (m_state.transformation)
-        {
-            case ADD_AUTH_DATA_AUTH:
-                if (add_auth_data_get(&m_aes_ccm_data, m_state.iteration, m_b))
-                {
-                    process_ecb_auth_iteration();
-                }
-                else
-                {
-                    m_state.iteration      = 0;
-                    m_state.transformation = PLAIN_TEXT_AUTH;
-                    perform_plain_text_authorization();
-                }
-                break;
-
-            case PLAIN_TEXT_AUTH:
-                perform_plain_text_authorization();
-                break;
-
-            case PLAIN_TEXT_ENCRYPT:
-                two_blocks_xor(m_m, mp_ecb_ciphertext, NRF_802154_AES_CCM_BLOCK_SIZE);
-
-                offset = (m_state.iteration - 1) * NRF_802154_AES_CCM_BLOCK_SIZE;
-                len    = MIN(m_aes_ccm_data.plain_text_data_len - offset,
-                             NRF_802154_AES_CCM_BLOCK_SIZE);
-                memcpy(mp_ciphertext + offset, m_m, len);
-                if (plain_text_data_get(&m_aes_ccm_data, m_state.iteration, m_m))
-                {
-                    m_state.iteration++;
-                    process_ecb_encrypt_iteration();
-                }
-                else
-                {
-                    if (m_mic_size[m_aes_ccm_data.mic_level] != 0)
-                    {
-                        m_state.iteration      = 0;
-                        m_state.transformation = CALCULATE_ENCRYPTED_TAG;
-                        process_ecb_encrypt_iteration();
-                    }
-                    else
-                    {
-                        transformation_finished();
-                    }
-                }
-                break;
-
-            case CALCULATE_ENCRYPTED_TAG:
-                two_blocks_xor(m_auth_tag,
-                               mp_ecb_ciphertext,
-                               m_mic_size[m_aes_ccm_data.mic_level]);
-                memcpy(mp_work_buffer +
-                       (mp_work_buffer[PHR_OFFSET] - FCS_SIZE -
-                        m_mic_size[m_aes_ccm_data.mic_level] +
-                        PHR_SIZE),
-                       m_auth_tag,
-                       m_mic_size[m_aes_ccm_data.mic_level]);
-                transformation_finished();
-                break;
-
-            default:
-                break;
-        }
+        ecb_block_finished();
     }
 
     if (nrf_ecb_int_enable_check(NRF_ECB, NRF_ECB_INT_ERRORECB_MASK) &&
@@ -473,20 +720,43 @@ static void ecb_irq_handler(void)
     }
 }
 
+#endif // !NRF_802154_ECB_SHARED_ENABLED
+
+#if NRF_802154_TX_IN_PLACE_ENABLED
 /**
- * @brief Start AES-CCM* Authorization Transformation
+ * @brief Completes the encryption of the plain text without waiting for ECB interrupts.
  */
-static void start_ecb_auth_transformation(void)
+static void ecb_encryption_complete(void)
 {
-    memcpy((uint8_t *)nrf_ecb_data_pointer_get(NRF_ECB) + 16, m_x, 16);
-    m_state.iteration      = 0;
-    m_state.transformation = ADD_AUTH_DATA_AUTH;
-    nrf_ecb_event_clear(NRF_ECB, NRF_ECB_EVENT_ENDECB);
-    nrf_ecb_task_trigger(NRF_ECB, NRF_ECB_TASK_STARTECB);
+    nrf_ecb_int_disable(NRF_ECB, NRF_ECB_INT_ENDECB_MASK | NRF_ECB_INT_ERRORECB_MASK);
+
+    while (m_state.transformation == PLAIN_TEXT_ENCRYPT)
+    {
+        if (nrf_ecb_event_check(NRF_ECB, NRF_ECB_EVENT_ERRORECB))
+        {
+            // The block was aborted by a peripheral sharing the AES core. Encrypt it again.
+            nrf_ecb_event_clear(NRF_ECB, NRF_ECB_EVENT_ERRORECB);
+            nrf_ecb_task_trigger(NRF_ECB, NRF_ECB_TASK_STARTECB);
+        }
+        else if (nrf_ecb_event_check(NRF_ECB, NRF_ECB_EVENT_ENDECB))
+        {
+            nrf_ecb_event_clear(NRF_ECB, NRF_ECB_EVENT_ENDECB);
+            ecb_block_finished();
+        }
+        else
+        {
+            // Intentionally empty
+        }
+    }
+
+    nrf_ecb_int_enable(NRF_ECB, NRF_ECB_INT_ENDECB_MASK | NRF_ECB_INT_ERRORECB_MASK);
 }
 
+#endif // NRF_802154_TX_IN_PLACE_ENABLED
+
 void nrf_802154_aes_ccm_transform_reset(void)
 {
+    m_state.start_pending    = false;
     m_aes_ccm_data.raw_frame = NULL;
 }
 
@@ -527,12 +797,46 @@ bool nrf_802154_aes_ccm_transform_prepare(const nrf_802154_aes_ccm_data_t * p_ae
     mp_work_buffer = nrf_802154_tx_work_buffer_enable_for(p_aes_ccm_data->raw_frame);
     mp_ciphertext  = mp_work_buffer + offset;
 
+#if !NRF_802154_TX_IN_PLACE_ENABLED
     memcpy(mp_work_buffer, p_aes_ccm_data->raw_frame, offset);
     memset(mp_ciphertext, 0, p_aes_ccm_data->raw_frame[PHR_OFFSET] + PHR_SIZE - offset);
+#endif
+
+    // Compute the keystream right away, it does not depend on the parts of the frame
+    // updated when the transmission starts
+    ecb_init();
+    ecb_stop();
+    memset(mp_ecb_key, 0, 48);
+    nrf_ecb_set_key(m_aes_ccm_data.key);
+    start_ecb_encrypt_transformation();
 
     return true;
 }
 
+uint16_t nrf_802154_aes_ccm_transform_latency_get(void)
+{
+    uint32_t blocks;
+
+    if (m_aes_ccm_data.raw_frame == NULL)
+    {
+        return 0;
+    }
+
+    // Keystream blocks, in case the transformation is started right after it is prepared
+    blocks = blocks_count(m_aes_ccm_data.plain_text_data_len);
+
+    if (m_mic_size[m_aes_ccm_data.mic_level] != 0)
+    {
+        // Block S0, block B0, authentication data with its length and the plain text
+        blocks += 2U;
+        blocks += (m_aes_ccm_data.auth_data_len == 0) ? 0U :
+                  blocks_count(m_aes_ccm_data.auth_data_len + sizeof(uint16_t));
+        blocks += blocks_count(m_aes_ccm_data.plain_text_data_len);
+    }
+
+    return (uint16_t)(blocks * NRF_802154_AES_CCM_ECB_BLOCK_TIME_US);
+}
+
 void nrf_802154_aes_ccm_transform_start(uint8_t * p_frame)
 {
     // Verify that the algorithm's inputs were prepared properly
@@ -541,23 +845,25 @@ void nrf_802154_aes_ccm_transform_start(uint8_t * p_frame)
         return;
     }
 
-    uint8_t   auth_flags = auth_flags_format(&m_aes_ccm_data);
-    uint8_t * p_x        = m_x;
-    uint8_t * p_b        = m_b;
-    ptrdiff_t offset     = mp_ciphertext - mp_work_buffer;
+#if !NRF_802154_TX_IN_PLACE_ENABLED
+    ptrdiff_t offset = mp_ciphertext - mp_work_buffer;
 
     // Copy updated part of the frame
     memcpy(mp_work_buffer, p_frame, offset);
+#endif
 
-    // initial settings
-    memset(p_x, 0, NRF_802154_AES_CCM_BLOCK_SIZE);
-    b0_format(&m_aes_ccm_data, auth_flags, p_b);
+    // The request must be made visible before the state is checked. If the keystream
+    // is still being computed, the ECB interrupt starts authorization when it is done.
+    m_state.start_pending = true;
 
-    two_blocks_xor(p_x, p_b, NRF_802154_AES_CCM_BLOCK_SIZE);
-    ecb_init();
-    memset(mp_ecb_key, 0, 48);
-    nrf_ecb_set_key(m_aes_ccm_data.key);
-    start_ecb_auth_transformation();
+    if (m_state.transformation == KEYSTREAM_READY)
+    {
+        if (m_state.start_pending)
+        {
+            m_state.start_pending = false;
+            start_ecb_auth_transformation();
+        }
+    }
 }
 
 void nrf_802154_aes_ccm_transform_abort(uint8_t * p_frame)
@@ -568,16 +874,19 @@ void nrf_802154_aes_ccm_transform_abort(uint8_t * p_frame)
         return;
     }
 
-    /*
-     * Temporarily disable ENDECB interrupt, trigger STOPECB task
-     * to stop encryption in case it is still running and clear
-     * the ENDECB event in case the encryption has completed.
-     */
-    nrf_ecb_int_disable(NRF_ECB, NRF_ECB_INT_ENDECB_MASK);
-    nrf_ecb_task_trigger(NRF_ECB, NRF_ECB_TASK_STOPECB);
-    nrf_ecb_event_clear(NRF_ECB, NRF_ECB_EVENT_ENDECB);
-    nrf_ecb_int_enable(NRF_ECB, NRF_ECB_INT_ENDECB_MASK);
+#if NRF_802154_TX_IN_PLACE_ENABLED
+    if (m_state.transformation == PLAIN_TEXT_ENCRYPT)
+    {
+        // The plain text is partially overwritten. Complete the encryption so that the frame
+        // is not left in an undefined state.
+        ecb_encryption_complete();
+    }
+#endif
+
+    ecb_stop();
 
+    m_state.start_pending    = false;
+    m_state.transformation   = TRANSFORMATION_DONE;
     m_aes_ccm_data.raw_frame = NULL;
 }
 
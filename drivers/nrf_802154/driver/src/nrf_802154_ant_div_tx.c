@@ -0,0 +1,370 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the selection of the transmit antenna learned per peer.
+ *
+ */
+
+#include "nrf_802154_ant_div_tx.h"
+
+#if NRF_802154_ANT_DIV_TX_LEARNING_ENABLED
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_802154_const.h"
+#include "nrf_802154_utils.h"
+
+#define ANTENNA_COUNT      2U        ///< Number of antennas between which the transmit antenna is selected.
+#define PEER_KEY_NONE      0U        ///< Key of an unused peer entry.
+#define RSSI_SCALE         8         ///< Scale of the RSSI averages, in fractions of dB.
+#define RSSI_UNKNOWN       INT16_MIN ///< RSSI average of an antenna without any sample.
+#define RSSI_AVG_WEIGHT    4         ///< Inverse of the weight of a new sample in the RSSI average.
+#define RSSI_HYSTERESIS_DB 2         ///< Margin in dB by which the other antenna must be better to be selected.
+#define NO_ACK_PENALTY_DB  6         ///< Decrease in dB of the RSSI average of the antenna of an unacknowledged transmission.
+#define NO_ACK_FLOOR_DBM   (-100)    ///< RSSI in dBm assumed for an antenna without samples after an unacknowledged transmission.
+
+/**@brief Entry describing a peer. */
+typedef struct
+{
+    uint64_t                        key;                 ///< Key identifying the peer or @ref PEER_KEY_NONE.
+    int16_t                         rssi[ANTENNA_COUNT]; ///< Scaled average RSSI observed on each antenna.
+    nrf_802154_sl_ant_div_antenna_t antenna;             ///< Antenna preferred for transmissions to the peer.
+} peer_t;
+
+static peer_t                          m_peers[NRF_802154_ANT_DIV_TX_PEERS_COUNT]; ///< Peers with learned antenna preference.
+static uint8_t                         m_peer_next;                                ///< Index of the entry to be replaced by a new peer.
+static volatile bool                   m_auto;                                     ///< If the transmit antenna is selected automatically.
+static uint64_t                        m_tx_key;                                   ///< Key of the destination of the current transmission.
+static nrf_802154_sl_ant_div_antenna_t m_tx_antenna;                               ///< Antenna selected for the current transmission.
+
+/**
+ * @brief Gets the antenna used for peers without learned preference.
+ *
+ * @return The configured transmit antenna or the first antenna if none is configured.
+ */
+static nrf_802154_sl_ant_div_antenna_t default_antenna_get(void)
+{
+    nrf_802154_sl_ant_div_antenna_t antenna = nrf_802154_sl_ant_div_cfg_antenna_get(
+        NRF_802154_SL_ANT_DIV_OP_TX);
+
+    return (antenna < ANTENNA_COUNT) ? antenna : NRF_802154_SL_ANT_DIV_ANTENNA_1;
+}
+
+/**
+ * @brief Gets the key identifying a peer by its address.
+ *
+ * @param[in]  p_addr    Pointer to the address of the peer or NULL if there is no address.
+ * @param[in]  extended  If @p p_addr points to an extended address.
+ * @param[in]  p_panid   Pointer to the PAN ID of a short address or NULL if unknown.
+ *
+ * @return Key of the peer or @ref PEER_KEY_NONE if the address does not identify a single peer.
+ */
+static uint64_t peer_key_get(const uint8_t * p_addr, bool extended, const uint8_t * p_panid)
+{
+    uint64_t key = PEER_KEY_NONE;
+
+    if (p_addr == NULL)
+    {
+        // Intentionally empty: no address.
+    }
+    else if (extended)
+    {
+        memcpy(&key, p_addr, EXTENDED_ADDRESS_SIZE);
+    }
+    else if ((p_addr[0] != 0xFFU) || (p_addr[1] != 0xFFU))
+    {
+        // Short addresses are only unique within a PAN. Mark the key so that it cannot be equal to
+        // PEER_KEY_NONE.
+        key = ((uint64_t)1U << 32) | ((uint32_t)p_addr[0]) | ((uint32_t)p_addr[1] << 8);
+
+        if (p_panid != NULL)
+        {
+            key |= ((uint32_t)p_panid[0] << 16) | ((uint32_t)p_panid[1] << 24);
+        }
+    }
+    else
+    {
+        // Intentionally empty: broadcast address.
+    }
+
+    return key;
+}
+
+/**
+ * @brief Gets the entry of a peer.
+ *
+ * @param[in]  key     Key of the peer.
+ * @param[in]  create  If an entry is to be created when the peer is not tracked yet.
+ *
+ * @return Pointer to the entry or NULL if there is no entry.
+ */
+static peer_t * peer_get(uint64_t key, bool create)
+{
+    if (key == PEER_KEY_NONE)
+    {
+        return NULL;
+    }
+
+    for (uint8_t i = 0; i < NRF_802154_ANT_DIV_TX_PEERS_COUNT; i++)
+    {
+        if (m_peers[i].key == key)
+        {
+            return &m_peers[i];
+        }
+    }
+
+    if (!create)
+    {
+        return NULL;
+    }
+
+    peer_t * p_peer = &m_peers[m_peer_next];
+
+    m_peer_next = (m_peer_next + 1U) % NRF_802154_ANT_DIV_TX_PEERS_COUNT;
+
+    p_peer->key     = key;
+    p_peer->antenna = default_antenna_get();
+
+    for (uint8_t i = 0; i < ANTENNA_COUNT; i++)
+    {
+        p_peer->rssi[i] = RSSI_UNKNOWN;
+    }
+
+    return p_peer;
+}
+
+/**
+ * @brief Updates the antenna preferred for transmissions to a peer.
+ *
+ * The preference changes only if the other antenna is better by at least
+ * @ref RSSI_HYSTERESIS_DB, so that it does not flap between antennas of similar quality.
+ *
+ * @param[inout]  p_peer  Pointer to the entry of the peer.
+ */
+static void peer_antenna_update(peer_t * p_peer)
+{
+    nrf_802154_sl_ant_div_antenna_t other      = p_peer->antenna ^ 1U;
+    int16_t                         rssi       = p_peer->rssi[p_peer->antenna];
+    int16_t                         rssi_other = p_peer->rssi[other];
+
+    if ((rssi_other != RSSI_UNKNOWN) &&
+        ((rssi == RSSI_UNKNOWN) || (rssi_other >= rssi + RSSI_HYSTERESIS_DB * RSSI_SCALE)))
+    {
+        p_peer->antenna = other;
+    }
+}
+
+/**
+ * @brief Adds an RSSI sample of an antenna to the average of a peer.
+ *
+ * @param[inout]  p_peer   Pointer to the entry of the peer.
+ * @param[in]     antenna  Antenna on which the sample was taken.
+ * @param[in]     rssi     RSSI in dBm.
+ */
+static void peer_rssi_record(peer_t * p_peer, nrf_802154_sl_ant_div_antenna_t antenna, int8_t rssi)
+{
+    int16_t sample = (int16_t)(rssi * RSSI_SCALE);
+
+    if (p_peer->rssi[antenna] == RSSI_UNKNOWN)
+    {
+        p_peer->rssi[antenna] = sample;
+    }
+    else
+    {
+        p_peer->rssi[antenna] += (sample - p_peer->rssi[antenna]) / RSSI_AVG_WEIGHT;
+    }
+
+    peer_antenna_update(p_peer);
+}
+
+void nrf_802154_ant_div_tx_init(void)
+{
+    memset(m_peers, 0, sizeof(m_peers));
+
+    m_peer_next  = 0U;
+    m_auto       = false;
+    m_tx_key     = PEER_KEY_NONE;
+    m_tx_antenna = NRF_802154_SL_ANT_DIV_ANTENNA_NONE;
+}
+
+void nrf_802154_ant_div_tx_auto_set(bool enabled)
+{
+    m_auto = enabled;
+}
+
+bool nrf_802154_ant_div_tx_auto_is_enabled(void)
+{
+    return m_auto;
+}
+
+void nrf_802154_ant_div_tx_frame_prepare(const uint8_t * p_frame)
+{
+    if (!m_auto)
+    {
+        return;
+    }
+
+    const nrf_802154_frame_parser_data_t * p_frame_data =
+        nrf_802154_frame_parser_tx_data_get(p_frame, PARSE_LEVEL_ADDRESSING_END);
+    uint64_t key = PEER_KEY_NONE;
+
+    if (p_frame_data != NULL)
+    {
+        key = peer_key_get(nrf_802154_frame_parser_dst_addr_get(p_frame_data),
+                           nrf_802154_frame_parser_dst_addr_is_extended(p_frame_data),
+                           nrf_802154_frame_parser_dst_panid_get(p_frame_data));
+    }
+
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    peer_t * p_peer = peer_get(key, true);
+
+    m_tx_key     = key;
+    m_tx_antenna = (p_peer != NULL) ? p_peer->antenna : default_antenna_get();
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+nrf_802154_sl_ant_div_antenna_t nrf_802154_ant_div_tx_antenna_get(void)
+{
+    if (!m_auto)
+    {
+        return nrf_802154_sl_ant_div_cfg_antenna_get(NRF_802154_SL_ANT_DIV_OP_TX);
+    }
+
+    // Operations other than frame transmission, like standalone CCA, use the antenna of the most
+    // recent transmission.
+    return (m_tx_antenna < ANTENNA_COUNT) ? m_tx_antenna : default_antenna_get();
+}
+
+void nrf_802154_ant_div_tx_rx_frame_record(const nrf_802154_frame_parser_data_t * p_frame_data,
+                                           int8_t                                 rssi)
+{
+    nrf_802154_sl_ant_div_antenna_t antenna = nrf_802154_sl_ant_div_last_rx_best_antenna_get();
+
+    if (!m_auto || (antenna >= ANTENNA_COUNT))
+    {
+        return;
+    }
+
+    const uint8_t * p_panid = nrf_802154_frame_parser_src_panid_get(p_frame_data);
+
+    if (p_panid == NULL)
+    {
+        // The source PAN ID is compressed and equal to the destination PAN ID.
+        p_panid = nrf_802154_frame_parser_dst_panid_get(p_frame_data);
+    }
+
+    uint64_t key = peer_key_get(nrf_802154_frame_parser_src_addr_get(p_frame_data),
+                                nrf_802154_frame_parser_src_addr_is_extended(p_frame_data),
+                                p_panid);
+
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    peer_t * p_peer = peer_get(key, true);
+
+    if (p_peer != NULL)
+    {
+        peer_rssi_record(p_peer, antenna, rssi);
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+void nrf_802154_ant_div_tx_ack_record(int8_t rssi)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    peer_t * p_peer = peer_get(m_tx_key, false);
+
+    if (m_auto && (p_peer != NULL) && (m_tx_antenna < ANTENNA_COUNT))
+    {
+        peer_rssi_record(p_peer, m_tx_antenna, rssi);
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+void nrf_802154_ant_div_tx_no_ack_record(void)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    peer_t * p_peer = peer_get(m_tx_key, false);
+
+    if (m_auto && (p_peer != NULL) && (m_tx_antenna < ANTENNA_COUNT))
+    {
+        int16_t * p_rssi = &p_peer->rssi[m_tx_antenna];
+
+        if (*p_rssi == RSSI_UNKNOWN)
+        {
+            *p_rssi = NO_ACK_FLOOR_DBM * RSSI_SCALE;
+        }
+        else if (*p_rssi > NO_ACK_FLOOR_DBM * RSSI_SCALE)
+        {
+            *p_rssi -= NO_ACK_PENALTY_DB * RSSI_SCALE;
+        }
+        else
+        {
+            // Intentionally empty: the antenna is already considered unusable.
+        }
+
+        // If the other antenna has no samples yet, try it for the next transmission, so that
+        // a peer does not stay on an antenna that stopped working.
+        if (p_peer->rssi[m_tx_antenna ^ 1U] == RSSI_UNKNOWN)
+        {
+            p_peer->antenna = m_tx_antenna ^ 1U;
+        }
+        else
+        {
+            peer_antenna_update(p_peer);
+        }
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+#endif // NRF_802154_ANT_DIV_TX_LEARNING_ENABLED
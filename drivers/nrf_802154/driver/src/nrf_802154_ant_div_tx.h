@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Module that selects the transmit antenna learned per peer.
+ *
+ * The module keeps, for recent peers, an average RSSI observed on each antenna. It is fed with
+ * the best antenna of received frames, the RSSI of received ACK frames and transmissions that
+ * were not acknowledged. When the automatic transmit antenna selection is enabled, each frame is
+ * transmitted through the antenna with the best average RSSI for its destination. Otherwise, and
+ * when @ref NRF_802154_ANT_DIV_TX_LEARNING_ENABLED is disabled, the configured antenna is used.
+ */
+
+#ifndef NRF_802154_ANT_DIV_TX_H__
+#define NRF_802154_ANT_DIV_TX_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_sl_ant_div.h"
+#include "mac_features/nrf_802154_frame_parser.h"
+
+#if NRF_802154_ANT_DIV_TX_LEARNING_ENABLED
+
+/**
+ * @brief Initializes the transmit antenna selection module.
+ */
+void nrf_802154_ant_div_tx_init(void);
+
+/**
+ * @brief Enables or disables the automatic transmit antenna selection.
+ *
+ * @param[in]  enabled  If the transmit antenna is to be selected automatically.
+ */
+void nrf_802154_ant_div_tx_auto_set(bool enabled);
+
+/**
+ * @brief Checks if the automatic transmit antenna selection is enabled.
+ *
+ * @retval  true   The transmit antenna is selected automatically.
+ * @retval  false  The configured transmit antenna is used.
+ */
+bool nrf_802154_ant_div_tx_auto_is_enabled(void);
+
+/**
+ * @brief Selects the antenna for the transmission of a frame.
+ *
+ * @param[in]  p_frame  Pointer to a buffer containing PHR and PSDU of the frame to transmit.
+ */
+void nrf_802154_ant_div_tx_frame_prepare(const uint8_t * p_frame);
+
+/**
+ * @brief Gets the antenna to be used for the current transmission.
+ *
+ * @return Antenna selected by @ref nrf_802154_ant_div_tx_frame_prepare if the automatic transmit
+ *         antenna selection is enabled, the configured transmit antenna otherwise.
+ */
+nrf_802154_sl_ant_div_antenna_t nrf_802154_ant_div_tx_antenna_get(void);
+
+/**
+ * @brief Records the RSSI of a received frame on the best antenna of the reception.
+ *
+ * @param[in]  p_frame_data  Pointer to the parser data of the received frame.
+ * @param[in]  rssi          RSSI of the received frame in dBm.
+ */
+void nrf_802154_ant_div_tx_rx_frame_record(const nrf_802154_frame_parser_data_t * p_frame_data,
+                                           int8_t                                 rssi);
+
+/**
+ * @brief Records the RSSI of an ACK received for the current transmission.
+ *
+ * @param[in]  rssi  RSSI of the received ACK frame in dBm.
+ */
+void nrf_802154_ant_div_tx_ack_record(int8_t rssi);
+
+/**
+ * @brief Records that the current transmission was not acknowledged.
+ */
+void nrf_802154_ant_div_tx_no_ack_record(void);
+
+#else // NRF_802154_ANT_DIV_TX_LEARNING_ENABLED
+
+static inline void nrf_802154_ant_div_tx_init(void)
+{
+    // Intentionally empty
+}
+
+static inline bool nrf_802154_ant_div_tx_auto_is_enabled(void)
+{
+    return false;
+}
+
+static inline void nrf_802154_ant_div_tx_frame_prepare(const uint8_t * p_frame)
+{
+    (void)p_frame;
+}
+
+static inline nrf_802154_sl_ant_div_antenna_t nrf_802154_ant_div_tx_antenna_get(void)
+{
+    return nrf_802154_sl_ant_div_cfg_antenna_get(NRF_802154_SL_ANT_DIV_OP_TX);
+}
+
+static inline void nrf_802154_ant_div_tx_rx_frame_record(
+    const nrf_802154_frame_parser_data_t * p_frame_data,
+    int8_t                                 rssi)
+{
+    (void)p_frame_data;
+    (void)rssi;
+}
+
+static inline void nrf_802154_ant_div_tx_ack_record(int8_t rssi)
+{
+    (void)rssi;
+}
+
+static inline void nrf_802154_ant_div_tx_no_ack_record(void)
+{
+    // Intentionally empty
+}
+
+#endif // NRF_802154_ANT_DIV_TX_LEARNING_ENABLED
+
+#endif // NRF_802154_ANT_DIV_TX_H__
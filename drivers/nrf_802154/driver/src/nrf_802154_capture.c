@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the frame capture mode of the 802.15.4 driver.
+ *
+ */
+
+#include "nrf_802154_capture.h"
+
+#if NRF_802154_CAPTURE_ENABLED
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "nrf_802154.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_utils.h"
+#include "nrf_802154_utils_byteorder.h"
+#include "nrf_802154_sl_atomics.h"
+
+/**@brief Size of the largest record written to the ring buffer. */
+#define CAPTURE_RECORD_SIZE_MAX (NRF_802154_CAPTURE_RECORD_HEADER_SIZE + MAX_PACKET_SIZE)
+
+static uint8_t * volatile mp_ring;       ///< Pointer to the ring buffer or NULL if the frame capture mode is not active.
+static uint32_t           m_ring_mask;   ///< Size of the ring buffer decremented by one.
+static uint32_t           m_write_pos;   ///< Position up to which the records were written.
+static uint32_t           m_read_pos;    ///< Position up to which the records were consumed.
+static uint32_t           m_captured;    ///< Number of frames written to the ring buffer.
+static uint32_t           m_dropped;     ///< Number of frames dropped due to lack of space.
+
+/**
+ * @brief Copies data to the ring buffer, wrapping around its end if needed.
+ *
+ * @param[in]  p_ring  Pointer to the ring buffer.
+ * @param[in]  pos     Position of the first byte to be written.
+ * @param[in]  p_src   Pointer to the data to be copied.
+ * @param[in]  length  Number of bytes to be copied.
+ */
+static void ring_write(uint8_t * p_ring, uint32_t pos, const uint8_t * p_src, uint32_t length)
+{
+    uint32_t offset = pos & m_ring_mask;
+    uint32_t chunk  = m_ring_mask + 1U - offset;
+
+    if (chunk > length)
+    {
+        chunk = length;
+    }
+
+    memcpy(&p_ring[offset], p_src, chunk);
+    memcpy(p_ring, &p_src[chunk], length - chunk);
+}
+
+bool nrf_802154_capture_ring_set(uint8_t * p_ring, uint32_t ring_size)
+{
+    if ((p_ring == NULL) ||
+        (ring_size < CAPTURE_RECORD_SIZE_MAX) ||
+        ((ring_size & (ring_size - 1U)) != 0U))
+    {
+        return false;
+    }
+
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    m_ring_mask = ring_size - 1U;
+    m_write_pos = 0U;
+    m_read_pos  = 0U;
+    m_captured  = 0U;
+    m_dropped   = 0U;
+    mp_ring     = p_ring;
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return true;
+}
+
+void nrf_802154_capture_ring_clear(void)
+{
+    mp_ring = NULL;
+}
+
+bool nrf_802154_capture_is_active(void)
+{
+    return mp_ring != NULL;
+}
+
+void nrf_802154_capture_frame_write(const uint8_t * p_data,
+                                    int8_t          rssi,
+                                    uint8_t         lqi,
+                                    bool            crc_ok,
+                                    uint64_t        timestamp)
+{
+    uint8_t * p_ring = mp_ring;
+
+    if (p_ring == NULL)
+    {
+        return;
+    }
+
+    uint8_t  psdu_len   = p_data[PHR_OFFSET] & PHR_LENGTH_MASK;
+    uint32_t record_len = NRF_802154_CAPTURE_RECORD_HEADER_SIZE + psdu_len;
+    uint32_t read_pos   = nrf_802154_sl_atomic_load_u32(&m_read_pos);
+
+    if ((m_ring_mask + 1U) - (m_write_pos - read_pos) < record_len)
+    {
+        m_dropped++;
+        return;
+    }
+
+    uint8_t header[NRF_802154_CAPTURE_RECORD_HEADER_SIZE];
+
+    host_64_to_little(timestamp, header);
+    header[8]  = (uint8_t)rssi;
+    header[9]  = lqi;
+    header[10] = crc_ok ? NRF_802154_CAPTURE_FLAG_CRC_OK : 0U;
+    header[11] = psdu_len;
+
+    ring_write(p_ring, m_write_pos, header, sizeof(header));
+    ring_write(p_ring, m_write_pos + sizeof(header), &p_data[PSDU_OFFSET], psdu_len);
+
+    m_captured++;
+
+    // Publish the record after its content is written.
+    nrf_802154_sl_atomic_store_u32(&m_write_pos, m_write_pos + record_len);
+}
+
+void nrf_802154_capture_status_get(nrf_802154_capture_status_t * p_status)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    p_status->write_pos       = m_write_pos;
+    p_status->read_pos        = m_read_pos;
+    p_status->captured_frames = m_captured;
+    p_status->dropped_frames  = m_dropped;
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+void nrf_802154_capture_consume(uint32_t length)
+{
+    uint32_t read_pos = m_read_pos;
+
+    assert(length <= nrf_802154_sl_atomic_load_u32(&m_write_pos) - read_pos);
+
+    nrf_802154_sl_atomic_store_u32(&m_read_pos, read_pos + length);
+}
+
+#endif // NRF_802154_CAPTURE_ENABLED
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Module that writes received frames to the capture ring buffer.
+ *
+ * The ring buffer is written from the radio interrupt handler and consumed by the higher layer.
+ * When @ref NRF_802154_CAPTURE_ENABLED is disabled, the frame capture mode is never active.
+ */
+
+#ifndef NRF_802154_CAPTURE_H__
+#define NRF_802154_CAPTURE_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_types.h"
+
+#if NRF_802154_CAPTURE_ENABLED
+
+/**
+ * @brief Sets the ring buffer and activates the frame capture mode.
+ *
+ * @param[in]  p_ring     Pointer to the ring buffer.
+ * @param[in]  ring_size  Size of the ring buffer. It must be a power of two not smaller than
+ *                        the size of the largest record.
+ *
+ * @retval  true   The frame capture mode is active.
+ * @retval  false  The ring buffer is invalid.
+ */
+bool nrf_802154_capture_ring_set(uint8_t * p_ring, uint32_t ring_size);
+
+/**
+ * @brief Deactivates the frame capture mode.
+ */
+void nrf_802154_capture_ring_clear(void);
+
+/**
+ * @brief Checks if the frame capture mode is active.
+ *
+ * @retval  true   The frame capture mode is active.
+ * @retval  false  The frame capture mode is not active.
+ */
+bool nrf_802154_capture_is_active(void);
+
+/**
+ * @brief Writes a received frame to the ring buffer.
+ *
+ * If there is not enough free space in the ring buffer, the frame is dropped.
+ *
+ * @param[in]  p_data     Pointer to a buffer containing PHR and PSDU of the received frame.
+ * @param[in]  rssi       RSSI of the received frame [dBm].
+ * @param[in]  lqi        LQI of the received frame.
+ * @param[in]  crc_ok     If the frame was received with a correct FCS.
+ * @param[in]  timestamp  Timestamp of the end of the frame [us].
+ */
+void nrf_802154_capture_frame_write(const uint8_t * p_data,
+                                    int8_t          rssi,
+                                    uint8_t         lqi,
+                                    bool            crc_ok,
+                                    uint64_t        timestamp);
+
+#else // NRF_802154_CAPTURE_ENABLED
+
+static inline bool nrf_802154_capture_is_active(void)
+{
+    return false;
+}
+
+static inline void nrf_802154_capture_frame_write(const uint8_t * p_data,
+                                                  int8_t          rssi,
+                                                  uint8_t         lqi,
+                                                  bool            crc_ok,
+                                                  uint64_t        timestamp)
+{
+    (void)p_data;
+    (void)rssi;
+    (void)lqi;
+    (void)crc_ok;
+    (void)timestamp;
+}
+
+#endif // NRF_802154_CAPTURE_ENABLED
+
+#endif // NRF_802154_CAPTURE_H__
@@ -48,10 +48,13 @@
 #include <string.h>
 
 #include "nrf_802154.h"
+#include "nrf_802154_ant_div_tx.h"
+#include "nrf_802154_capture.h"
 #include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
 #include "nrf_802154_critical_section.h"
 #include "nrf_802154_debug.h"
+#include "nrf_802154_link_quality.h"
 #include "nrf_802154_notification.h"
 #include "nrf_802154_pib.h"
 #include "nrf_802154_procedures_duration.h"
@@ -68,8 +71,11 @@
 #include "nrf_802154_utils.h"
 #include "drivers/nrfx_errors.h"
 #include "hal/nrf_radio.h"
+#include "mac_features/nrf_802154_ack_timeout.h"
 #include "mac_features/nrf_802154_filter.h"
 #include "mac_features/nrf_802154_frame_parser.h"
+#include "mac_features/nrf_802154_indirect_tx.h"
+#include "mac_features/nrf_802154_rx_duplicate_filter.h"
 #include "mac_features/ack_generator/nrf_802154_ack_generator.h"
 #include "rsch/nrf_802154_rsch.h"
 #include "rsch/nrf_802154_rsch_crit_sect.h"
@@ -81,8 +87,14 @@
 #include "nrf_802154_core_hooks.h"
 #include "nrf_802154_sl_ant_div.h"
 
+#if NRF_802154_RX_EARLY_ADDR_FILTER_ENABLED
+/// Delay before first check of received frame: 64 bits is PHY header, MAC Frame Control field,
+/// Sequence Number, destination PAN ID and short destination address.
+#define BCC_INIT                    (8 * 8)
+#else
 /// Delay before first check of received frame: 24 bits is PHY header and MAC Frame Control field.
 #define BCC_INIT                    (3 * 8)
+#endif
 
 /// Duration of single iteration of Energy Detection procedure
 #define ED_ITER_DURATION            128U
@@ -124,6 +136,34 @@ static int8_t                          m_last_rssi;            ///< RSSI of the
 
 static nrf_802154_frame_parser_data_t m_current_rx_frame_data; ///< RX frame parser data.
 
+#if NRF_802154_TX_PREPARE_ENABLED
+
+/// Frame staged by @ref nrf_802154_core_transmit_prepare.
+typedef struct
+{
+    uint8_t                      * p_data;      ///< Pointer to the prepared frame. NULL if none.
+    nrf_802154_transmit_params_t   params;      ///< Transmission parameters of the prepared frame.
+    nrf_802154_tx_power_metadata_t tx_power;    ///< Requested transmit power of the prepared frame.
+    volatile bool                  is_set_up;   ///< If the frame processing result is still valid.
+} tx_prepared_t;
+
+static tx_prepared_t m_tx_prepared;                             ///< Prepared frame.
+
+#endif
+
+/// State of the current multi-channel energy scan procedure.
+typedef struct
+{
+    uint32_t channel_mask;                                  ///< Mask of channels requested to be scanned.
+    uint32_t channels_left;                                 ///< Mask of channels still to be scanned.
+    uint32_t dwell_us;                                      ///< Time of energy detection on each channel [us].
+    uint8_t  channel;                                       ///< Channel being scanned.
+    uint8_t  results_count;                                 ///< Number of channels already scanned.
+    uint8_t  results[NRF_802154_ENERGY_SCAN_CHANNELS_MAX];  ///< Energy levels detected on scanned channels.
+} ed_scan_t;
+
+static ed_scan_t m_ed_scan;                                    ///< State of the current energy scan procedure.
+
 static volatile radio_state_t m_state;                         ///< State of the radio driver.
 
 typedef struct
@@ -133,6 +173,7 @@ typedef struct
     bool rx_timeslot_requested : 1;                           ///< If timeslot for the frame being received is already requested.
     bool tx_with_cca           : 1;                           ///< If currently transmitted frame is transmitted with cca.
     bool tx_diminished_prio    : 1;                           ///< If priority of the current transmission should be diminished.
+    bool ed_scan               : 1;                           ///< If current energy detection scans multiple channels.
 } nrf_802154_flags_t;
 
 static nrf_802154_flags_t m_flags;                            ///< Flags used to store the current driver state.
@@ -160,9 +201,35 @@ static uint32_t m_rx_window_id;
 #endif
 #endif // NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
 
+#if NRF_802154_FRAME_TIMESTAMP_FRAMESTART_ENABLED
+#if !NRF_802154_FRAME_TIMESTAMP_ENABLED
+#error NRF_802154_FRAME_TIMESTAMP_ENABLED == 0 when NRF_802154_FRAME_TIMESTAMP_FRAMESTART_ENABLED != 0
+#endif
+#if NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
+#error NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED != 0 when NRF_802154_FRAME_TIMESTAMP_FRAMESTART_ENABLED != 0
+#endif
+#endif // NRF_802154_FRAME_TIMESTAMP_FRAMESTART_ENABLED
+
+#if NRF_802154_ACK_TIMEOUT_HW_ENABLED
+#if !NRF_802154_ACK_TIMEOUT_ENABLED
+#error NRF_802154_ACK_TIMEOUT_ENABLED == 0 when NRF_802154_ACK_TIMEOUT_HW_ENABLED != 0
+#endif
+#endif // NRF_802154_ACK_TIMEOUT_HW_ENABLED
+
 #if NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
 static uint32_t m_listening_start_hp_timestamp;
 
+/** @brief Priority awaiting the coex grant or @ref RSCH_PRIO_IDLE if no grant is awaited. */
+static rsch_prio_t m_coex_grant_wait_prio = RSCH_PRIO_IDLE;
+/** @brief Time at which @ref m_coex_grant_wait_prio was requested. */
+static uint64_t    m_coex_grant_wait_start;
+
+#endif
+
+#if NRF_802154_LIGHT_SLEEP_ENABLED
+static bool     m_wake_pending; ///< If the receiver ramp-up ending the wake-up is awaited.
+static uint64_t m_wake_start;   ///< Time of the receive request waking the radio up [us].
+static uint32_t m_wake_latency; ///< Duration of the last wake-up [us].
 #endif
 
 static const nrf_802154_transmitted_frame_props_t m_default_frame_props =
@@ -174,9 +241,69 @@ static const nrf_802154_transmitted_frame_props_t m_default_frame_props =
 
 static rsch_prio_t min_required_rsch_prio(radio_state_t state);
 
+#if NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
+/** Start measuring the coex grant latency if the requested priority needs the grant.
+ *
+ * @param[in]  prio  Requested priority.
+ */
+static void coex_grant_wait_start(rsch_prio_t prio)
+{
+    if (!nrf_802154_wifi_coex_is_enabled())
+    {
+        return;
+    }
+
+    if ((prio == RSCH_PRIO_IDLE) || nrf_802154_rsch_prec_is_approved(RSCH_PREC_COEX, prio))
+    {
+        m_coex_grant_wait_prio = RSCH_PRIO_IDLE;
+    }
+    else if (m_coex_grant_wait_prio != prio)
+    {
+        m_coex_grant_wait_prio  = prio;
+        m_coex_grant_wait_start = nrf_802154_sl_timer_current_time_get();
+    }
+    else
+    {
+        // The grant for this priority is already awaited
+    }
+}
+
+/** Account the coex grant latency once the awaited priority gets approved.
+ *
+ * @param[in]  prio  Approved priority.
+ */
+static void coex_grant_wait_end(rsch_prio_t prio)
+{
+    if ((m_coex_grant_wait_prio != RSCH_PRIO_IDLE) && (prio >= m_coex_grant_wait_prio))
+    {
+        uint64_t now = nrf_802154_sl_timer_current_time_get();
+
+        m_coex_grant_wait_prio = RSCH_PRIO_IDLE;
+
+        nrf_802154_stat_counter_increment(coex_grant_waits);
+        nrf_802154_stat_totals_increment(total_coex_grant_wait_time,
+                                         now - m_coex_grant_wait_start);
+    }
+}
+
+#endif // NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
+
+/** Request RSCH priority.
+ *
+ * @param[in]  prio  Requested priority.
+ */
+static void rsch_prio_request(rsch_prio_t prio)
+{
+#if NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
+    coex_grant_wait_start(prio);
+#endif
+
+    nrf_802154_rsch_crit_sect_prio_request(prio);
+}
+
 static void request_preconditions_for_state(radio_state_t state)
 {
-    nrf_802154_rsch_crit_sect_prio_request(min_required_rsch_prio(state));
+    rsch_prio_request(min_required_rsch_prio(state));
 }
 
 /** Set driver state.
@@ -299,6 +426,47 @@ static uint64_t timer_coord_timestamp_get(void)
     return timestamp;
 }
 
+/** @brief Configure the timer coordinator to get a timestamp of the frame being received. */
+static void rx_timestamp_prepare(void)
+{
+#if (NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED)
+    // Get a timestamp of the END event which fires several cycles after CRCOK or CRCERROR events.
+    nrf_802154_timer_coord_timestamp_prepare(nrf_802154_trx_radio_end_event_handle_get());
+#elif (NRF_802154_FRAME_TIMESTAMP_FRAMESTART_ENABLED)
+    // Get a timestamp of the FRAMESTART event which fires when the PHR is received.
+    nrf_802154_timer_coord_timestamp_prepare(nrf_802154_trx_radio_framestart_event_handle_get());
+#else
+    // Get a timestamp of the CRCOK event.
+    nrf_802154_timer_coord_timestamp_prepare(nrf_802154_trx_radio_crcok_event_handle_get());
+#endif
+}
+
+/**
+ * @brief Get the timestamp of the end of the received frame.
+ *
+ * @param[in]  p_data  Pointer to the received frame, starting with the PHR.
+ *
+ * @returns Timestamp [us] of the end of the frame or @ref NRF_802154_NO_TIMESTAMP if
+ *          the timestamp is inaccurate.
+ */
+static uint64_t rx_end_timestamp_get(const uint8_t * p_data)
+{
+    uint64_t timestamp = timer_coord_timestamp_get();
+
+#if (NRF_802154_FRAME_TIMESTAMP_FRAMESTART_ENABLED)
+    if (timestamp != NRF_802154_NO_TIMESTAMP)
+    {
+        // The captured FRAMESTART event precedes the end of the frame by its PSDU.
+        timestamp += PHY_US_TIME_FROM_SYMBOLS(
+            PHY_SYMBOLS_FROM_OCTETS(p_data[PHR_OFFSET] & PHR_LENGTH_MASK));
+    }
+#else
+    (void)p_data;
+#endif
+
+    return timestamp;
+}
+
 #endif
 
 static void received_frame_notify(uint8_t * p_data)
@@ -378,6 +546,8 @@ static void transmitted_frame_notify(uint8_t * p_ack, int8_t power, uint8_t lqi)
 
     nrf_802154_core_hooks_transmitted(p_frame);
 
+    (void)nrf_802154_core_hooks_tx_outcome(p_frame, NRF_802154_TX_ERROR_NONE, &metadata);
+
     nrf_802154_notify_transmitted(p_frame, &metadata);
 
     nrf_802154_critical_section_nesting_deny();
@@ -388,9 +558,12 @@ static void transmit_failed_notify(uint8_t                                   * p
                                    nrf_802154_tx_error_t                       error,
                                    const nrf_802154_transmit_done_metadata_t * p_meta)
 {
-    if (nrf_802154_core_hooks_tx_failed(p_frame, error))
+    nrf_802154_transmit_done_metadata_t metadata = *p_meta;
+
+    if (nrf_802154_core_hooks_tx_failed(p_frame, error) &&
+        nrf_802154_core_hooks_tx_outcome(p_frame, error, &metadata))
     {
-        nrf_802154_notify_transmit_failed(p_frame, error, p_meta);
+        nrf_802154_notify_transmit_failed(p_frame, error, &metadata);
     }
 }
 
@@ -416,6 +589,36 @@ static void energy_detected_notify(uint8_t result)
     nrf_802154_critical_section_nesting_deny();
 }
 
+/**
+ * @brief Write the received frame to the capture ring buffer.
+ *
+ * @param[in]  rssi    RSSI of the received frame.
+ * @param[in]  lqi     LQI of the received frame.
+ * @param[in]  crc_ok  If the frame was received with a correct FCS.
+ */
+static void rx_frame_capture(int8_t rssi, uint8_t lqi, bool crc_ok)
+{
+    uint64_t timestamp = NRF_802154_NO_TIMESTAMP;
+
+#if (NRF_802154_FRAME_TIMESTAMP_ENABLED)
+    timestamp = rx_end_timestamp_get(mp_current_rx_buffer->data);
+#endif
+
+    nrf_802154_capture_frame_write(mp_current_rx_buffer->data, rssi, lqi, crc_ok, timestamp);
+}
+
+/** Notify MAC layer that energy scan procedure ended. */
+static void energy_scan_done_notify(void)
+{
+    nrf_802154_critical_section_nesting_allow();
+
+    nrf_802154_notify_energy_scan_done(m_ed_scan.channel_mask,
+                                       m_ed_scan.results,
+                                       m_ed_scan.results_count);
+
+    nrf_802154_critical_section_nesting_deny();
+}
+
 /** Notify MAC layer that CCA procedure ended. */
 static void cca_notify(bool result)
 {
@@ -466,7 +669,62 @@ static void rx_buffer_in_use_set(rx_buffer_t * p_rx_buffer)
  */
 static bool rx_buffer_is_available(void)
 {
-    return (mp_current_rx_buffer != NULL) && (mp_current_rx_buffer->free);
+    return (mp_current_rx_buffer != NULL) && nrf_802154_rx_buffer_is_free(mp_current_rx_buffer);
+}
+
+/** Check if ACK is to be sent automatically for the currently received frame.
+ *
+ * @retval true   Auto ACK is enabled for the identity the frame is destined to.
+ * @retval false  Auto ACK is disabled for the identity the frame is destined to.
+ */
+static bool rx_frame_auto_ack_is_enabled(void)
+{
+#if NRF_802154_IDENTITIES_NUM > 0
+    const nrf_802154_identity_t * p_identity = nrf_802154_filter_identity_get();
+
+    if (p_identity != NULL)
+    {
+        return p_identity->auto_ack;
+    }
+#endif
+
+    return nrf_802154_pib_auto_ack_get();
+}
+
+/** Check if the received frame is to be passed to the next higher layer.
+ *
+ * A retransmitted frame or a frame rejected by the RX pre-filter is dropped, so that its buffer
+ * can be reused for the following reception.
+ *
+ * @param[in]  p_data  Pointer to a buffer that contains PHR and PSDU of the received frame.
+ *
+ * @retval true   The frame is to be passed to the next higher layer.
+ * @retval false  The frame is to be dropped.
+ */
+static bool rx_frame_prefilter(const uint8_t * p_data)
+{
+#if NRF_802154_RX_DUPLICATE_FILTER_ENABLED
+    if (!nrf_802154_pib_promiscuous_get() &&
+        nrf_802154_rx_duplicate_filter_check(&m_current_rx_frame_data))
+    {
+        nrf_802154_stat_counter_increment(rx_duplicated_frames);
+        return false;
+    }
+#endif
+
+#if NRF_802154_RX_PREFILTER_ENABLED
+    nrf_802154_rx_prefilter_t prefilter = nrf_802154_pib_rx_prefilter_get();
+
+    if ((prefilter != NULL) && !prefilter(p_data, m_last_rssi, m_last_lqi))
+    {
+        nrf_802154_stat_counter_increment(rx_prefiltered_frames);
+        return false;
+    }
+#else
+    (void)p_data;
+#endif
+
+    return true;
 }
 
 /** Get pointer to available rx buffer.
@@ -491,14 +749,10 @@ static uint8_t * rx_buffer_get(void)
  */
 static bool ack_is_requested(const uint8_t * p_frame)
 {
-    nrf_802154_frame_parser_data_t frame_data;
+    const nrf_802154_frame_parser_data_t * p_frame_data =
+        nrf_802154_frame_parser_tx_data_get(p_frame, PARSE_LEVEL_FCF_OFFSETS);
 
-    bool result = nrf_802154_frame_parser_data_init(p_frame,
-                                                    p_frame[PHR_OFFSET] + PHR_SIZE,
-                                                    PARSE_LEVEL_FCF_OFFSETS,
-                                                    &frame_data);
-
-    return result && nrf_802154_frame_parser_ar_bit_is_set(&frame_data);
+    return (p_frame_data != NULL) && nrf_802154_frame_parser_ar_bit_is_set(p_frame_data);
 }
 
 /***************************************************************************************************
@@ -553,6 +807,54 @@ static bool ed_iter_setup(uint32_t * p_requested_ed_time_us, uint32_t * p_next_t
  * @section FSM transition request sub-procedures
  **************************************************************************************************/
 
+/** @brief Select the next channel of the energy scan procedure.
+ *
+ * @retval  true   The next channel was selected. It is stored in @ref m_ed_scan.
+ * @retval  false  All requested channels were scanned.
+ */
+static bool ed_scan_channel_next(void)
+{
+    if (m_ed_scan.channels_left == 0U)
+    {
+        return false;
+    }
+
+    uint8_t channel = 0U;
+
+    while ((m_ed_scan.channels_left & (1UL << channel)) == 0U)
+    {
+        channel++;
+    }
+
+    m_ed_scan.channels_left &= ~(1UL << channel);
+    m_ed_scan.channel        = channel;
+    m_ed_time_left           = m_ed_scan.dwell_us;
+    m_ed_result              = 0U;
+
+    return true;
+}
+
+/** @brief Store the result of energy detection on the current channel of the energy scan.
+ *
+ * @retval  true   The next channel is to be scanned.
+ * @retval  false  All requested channels were scanned.
+ */
+static bool ed_scan_channel_finish(void)
+{
+    assert(m_ed_scan.results_count < NRF_802154_ENERGY_SCAN_CHANNELS_MAX);
+
+    m_ed_scan.results[m_ed_scan.results_count++] = nrf_802154_rssi_ed_sample_convert(m_ed_result);
+
+    return ed_scan_channel_next();
+}
+
+/** Get the channel used by the current operation. */
+static uint8_t operation_channel_get(void)
+{
+    return ((m_state == RADIO_STATE_ED) && m_flags.ed_scan) ? m_ed_scan.channel :
+           nrf_802154_pib_channel_get();
+}
+
 static rsch_prio_t min_required_rsch_prio(radio_state_t state)
 {
     switch (state)
@@ -726,10 +1028,13 @@ static void operation_terminated_notify(radio_state_t state, bool receiving_psdu
             break;
 
         case RADIO_STATE_TX_ACK:
-            mp_current_rx_buffer->free = false;
+        {
+            uint8_t * p_received_data = nrf_802154_rx_buffer_frame_commit(mp_current_rx_buffer);
+
             nrf_802154_core_hooks_tx_ack_failed(mp_ack, NRF_802154_TX_ERROR_ABORTED);
-            received_frame_notify(mp_current_rx_buffer->data);
-            break;
+            received_frame_notify(p_received_data);
+        }
+        break;
 
         case RADIO_STATE_CCA_TX:
         case RADIO_STATE_TX:
@@ -894,6 +1199,12 @@ static bool current_operation_terminate(nrf_802154_term_t term_lvl,
             if (m_state == RADIO_STATE_ED)
             {
                 nrf_802154_sl_ant_div_energy_detection_aborted_notify();
+
+                if (m_flags.ed_scan && timeslot_is_granted())
+                {
+                    // Restore the channel changed by the energy scan.
+                    nrf_802154_trx_channel_set(nrf_802154_pib_channel_get());
+                }
             }
 
             if (notify)
@@ -907,9 +1218,37 @@ static bool current_operation_terminate(nrf_802154_term_t term_lvl,
     return result;
 }
 
+#if NRF_802154_LIGHT_SLEEP_ENABLED
+
+/** Start measuring the wake-up latency if the radio is woken up by the receive request. */
+static void wake_latency_measure_start(void)
+{
+    if ((m_state == RADIO_STATE_SLEEP) || (m_state == RADIO_STATE_FALLING_ASLEEP))
+    {
+        m_wake_start   = nrf_802154_sl_timer_current_time_get();
+        m_wake_pending = true;
+    }
+}
+
+/** Finish measuring the wake-up latency once the receiver ramp-up is triggered. */
+static void wake_latency_measure_end(void)
+{
+    if (m_wake_pending)
+    {
+        m_wake_pending = false;
+        m_wake_latency = (uint32_t)(nrf_802154_sl_timer_current_time_get() - m_wake_start);
+    }
+}
+
+#endif // NRF_802154_LIGHT_SLEEP_ENABLED
+
 /** Enter Sleep state. */
 static void sleep_init(void)
 {
+#if NRF_802154_LIGHT_SLEEP_ENABLED
+    m_wake_pending = false;
+#endif
+
     // This function is always executed from a critical section, so this check is safe.
     if (timeslot_is_granted())
     {
@@ -1051,6 +1390,10 @@ static void rx_init(nrf_802154_trx_ramp_up_trigger_mode_t ru_tr_mode, bool * p_a
                                  m_trx_receive_frame_notifications_mask,
                                  &split_power);
 
+#if NRF_802154_LIGHT_SLEEP_ENABLED
+    wake_latency_measure_end();
+#endif
+
     if (ru_tr_mode == TRX_RAMP_UP_HW_TRIGGER)
     {
         uint32_t ppi_ch = nrf_802154_trx_ramp_up_ppi_channel_get();
@@ -1075,14 +1418,7 @@ static void rx_init(nrf_802154_trx_ramp_up_trigger_mode_t ru_tr_mode, bool * p_a
 #endif
 
 #if (NRF_802154_FRAME_TIMESTAMP_ENABLED)
-#if (NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED)
-    // Configure the timer coordinator to get a timestamp of the END event which
-    // fires several cycles after CRCOK or CRCERROR events.
-    nrf_802154_timer_coord_timestamp_prepare(nrf_802154_trx_radio_end_event_handle_get());
-#else
-    // Configure the timer coordinator to get a timestamp of the CRCOK event.
-    nrf_802154_timer_coord_timestamp_prepare(nrf_802154_trx_radio_crcok_event_handle_get());
-#endif
+    rx_timestamp_prepare();
 #endif
 
     // Find RX buffer if none available
@@ -1130,6 +1466,7 @@ static bool tx_init(const uint8_t                       * p_data,
 #endif
 
     m_flags.tx_with_cca = cca;
+    nrf_802154_ant_div_tx_frame_prepare(p_data);
     nrf_802154_trx_transmit_frame(nrf_802154_tx_work_buffer_get(p_data),
                                   rampup_trigg_mode,
                                   cca,
@@ -1169,6 +1506,11 @@ static void ed_init(void)
 
     uint32_t trx_ed_count = 0U;
 
+    if (m_flags.ed_scan)
+    {
+        nrf_802154_trx_channel_set(m_ed_scan.channel);
+    }
+
     // Notify antenna diversity about energy detection request. Antenna diversity state
     // will be updated, and m_ed_time_left reduced accordingly.
     nrf_802154_sl_ant_div_energy_detection_requested_notify(&m_ed_time_left);
@@ -1286,11 +1628,15 @@ static void on_timeslot_ended(void)
                 break;
 
             case RADIO_STATE_TX_ACK:
+            {
+                uint8_t * p_received_data;
+
                 state_set(RADIO_STATE_RX);
-                mp_current_rx_buffer->free = false;
+                p_received_data = nrf_802154_rx_buffer_frame_commit(mp_current_rx_buffer);
                 nrf_802154_core_hooks_tx_ack_failed(mp_ack, NRF_802154_TX_ERROR_TIMESLOT_ENDED);
-                received_frame_notify_and_nesting_allow(mp_current_rx_buffer->data);
-                break;
+                received_frame_notify_and_nesting_allow(p_received_data);
+            }
+            break;
 
             case RADIO_STATE_CCA_TX:
             case RADIO_STATE_TX:
@@ -1476,6 +1822,10 @@ void nrf_802154_rsch_crit_sect_prio_changed(rsch_prio_t prio)
 
     m_rsch_priority = prio;
 
+#if NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED
+    coex_grant_wait_end(prio);
+#endif
+
     if ((old_prio == RSCH_PRIO_IDLE) && (prio != RSCH_PRIO_IDLE))
     {
         // We have just got a timeslot.
@@ -1642,7 +1992,7 @@ void nrf_802154_trx_receive_frame_prestarted(void)
         NRF_802154_COEX_RX_REQUEST_MODE_ENERGY_DETECTION)
     {
         // Request boosted preconditions for receive
-        nrf_802154_rsch_crit_sect_prio_request(RSCH_PRIO_RX);
+        rsch_prio_request(RSCH_PRIO_RX);
         // Boosted preconditions should be reverted if the framestart doesn't come.
         rx_timeout_should_be_started = true;
     }
@@ -1676,7 +2026,7 @@ void nrf_802154_trx_receive_frame_prestarted(void)
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
-void nrf_802154_trx_receive_frame_started(void)
+NRF_802154_HOT_FUNC void nrf_802154_trx_receive_frame_started(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
@@ -1696,7 +2046,7 @@ void nrf_802154_trx_receive_frame_started(void)
 
         case NRF_802154_COEX_RX_REQUEST_MODE_PREAMBLE:
             /* Request boosted preconditions */
-            nrf_802154_rsch_crit_sect_prio_request(RSCH_PRIO_RX);
+            rsch_prio_request(RSCH_PRIO_RX);
             break;
 
         default:
@@ -1715,7 +2065,7 @@ void nrf_802154_trx_receive_frame_started(void)
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
-uint8_t nrf_802154_trx_receive_frame_bcmatched(uint8_t bcc)
+NRF_802154_HOT_FUNC uint8_t nrf_802154_trx_receive_frame_bcmatched(uint8_t bcc)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
@@ -1730,6 +2080,13 @@ uint8_t nrf_802154_trx_receive_frame_bcmatched(uint8_t bcc)
 
     assert(m_state == RADIO_STATE_RX);
 
+    if (nrf_802154_capture_is_active())
+    {
+        // Frames are neither filtered nor acknowledged in the frame capture mode.
+        nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+        return 0;
+    }
+
     switch (prev_level)
     {
         case PARSE_LEVEL_NONE:
@@ -1762,6 +2119,26 @@ uint8_t nrf_802154_trx_receive_frame_bcmatched(uint8_t bcc)
                                                              bcc,
                                                              parse_level);
 
+#if NRF_802154_RX_EARLY_ADDR_FILTER_ENABLED
+    if (parse_result && (parse_level == PARSE_LEVEL_FCF_OFFSETS))
+    {
+        uint8_t dst_addressing_end =
+            nrf_802154_frame_parser_dst_addressing_end_offset_get(&m_current_rx_frame_data);
+
+        // If the destination addressing fields are already received, filter them right away
+        // instead of waiting for another BCMATCH event.
+        if ((dst_addressing_end != NRF_802154_FRAME_PARSER_INVALID_OFFSET) &&
+            ((PHR_SIZE + dst_addressing_end) <= bcc))
+        {
+            parse_level  = PARSE_LEVEL_DST_ADDRESSING_END;
+            filter_mode  = NRF_802154_FILTER_MODE_ALL;
+            parse_result = nrf_802154_frame_parser_valid_data_extend(&m_current_rx_frame_data,
+                                                                     bcc,
+                                                                     parse_level);
+        }
+    }
+#endif
+
     if (!parse_result)
     {
         should_filter = false;
@@ -1773,11 +2150,11 @@ uint8_t nrf_802154_trx_receive_frame_bcmatched(uint8_t bcc)
         filter_result = nrf_802154_filter_frame_part(&m_current_rx_frame_data, filter_mode);
 
         if ((filter_result == NRF_802154_RX_ERROR_NONE) &&
-            (filter_mode == NRF_802154_FILTER_MODE_DST_ADDR))
+            (filter_mode & NRF_802154_FILTER_MODE_DST_ADDR))
         {
             m_flags.frame_filtered = true;
 
-            nrf_802154_rsch_crit_sect_prio_request(RSCH_PRIO_RX);
+            rsch_prio_request(RSCH_PRIO_RX);
             nrf_802154_ack_generator_reset();
         }
 
@@ -1863,8 +2240,12 @@ uint8_t nrf_802154_trx_receive_frame_bcmatched(uint8_t bcc)
 
     if (m_flags.frame_filtered &&
         nrf_802154_frame_parser_ar_bit_is_set(&m_current_rx_frame_data) &&
-        nrf_802154_pib_auto_ack_get())
+        rx_frame_auto_ack_is_enabled())
     {
+#if NRF_802154_TX_PREPARE_ENABLED
+        // The ACK shares the transmit work buffer and the encryption state with the prepared frame
+        nrf_802154_core_transmit_prepared_invalidate();
+#endif
         mp_ack = nrf_802154_ack_generator_create(&m_current_rx_frame_data);
     }
 
@@ -1961,6 +2342,14 @@ void nrf_802154_trx_receive_frame_crcerror(void)
 #endif
 
     assert(m_state == RADIO_STATE_RX);
+
+    if (nrf_802154_capture_is_active())
+    {
+        rx_frame_capture(rssi_last_measurement_get(),
+                         lqi_get(mp_current_rx_buffer->data),
+                         false);
+    }
+
     rx_flags_clear();
     rx_data_clear();
 
@@ -2017,7 +2406,7 @@ void nrf_802154_trx_receive_ack_crcerror(void)
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
-void nrf_802154_trx_receive_frame_received(void)
+NRF_802154_HOT_FUNC void nrf_802154_trx_receive_frame_received(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
@@ -2037,6 +2426,21 @@ void nrf_802154_trx_receive_frame_received(void)
                                       mp_current_rx_buffer->data[PHR_OFFSET]);
 #endif
 
+    if (nrf_802154_capture_is_active())
+    {
+        nrf_802154_stat_counter_increment(received_frames);
+        nrf_802154_stat_window_rx_frame_record(m_last_rssi);
+
+        rx_frame_capture(m_last_rssi, m_last_lqi, true);
+
+        // Receive to the same buffer
+        request_preconditions_for_state(m_state);
+        rx_init(TRX_RAMP_UP_SW_TRIGGER, NULL);
+
+        nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+        return;
+    }
+
     bool parse_result = nrf_802154_frame_parser_valid_data_extend(
         &m_current_rx_frame_data,
         PHR_SIZE + nrf_802154_frame_parser_frame_length_get(&m_current_rx_frame_data),
@@ -2069,22 +2473,28 @@ void nrf_802154_trx_receive_frame_received(void)
     if (m_flags.frame_filtered || nrf_802154_pib_promiscuous_get())
     {
         nrf_802154_stat_counter_increment(received_frames);
+        nrf_802154_stat_window_rx_frame_record(m_last_rssi);
 
 #if (NRF_802154_FRAME_TIMESTAMP_ENABLED)
-        uint64_t ts = timer_coord_timestamp_get();
+        uint64_t ts = rx_end_timestamp_get(mp_current_rx_buffer->data);
 
         nrf_802154_stat_timestamp_write(last_rx_end_timestamp, ts);
 #endif
 
         nrf_802154_sl_ant_div_rx_frame_received_notify();
+        nrf_802154_ant_div_tx_rx_frame_record(&m_current_rx_frame_data, m_last_rssi);
+        nrf_802154_link_quality_rx_frame_record(&m_current_rx_frame_data, m_last_rssi, m_last_lqi);
 
         bool send_ack = false;
 
         if (m_flags.frame_filtered &&
             parse_result &&
             nrf_802154_frame_parser_ar_bit_is_set(&m_current_rx_frame_data) &&
-            nrf_802154_pib_auto_ack_get())
+            rx_frame_auto_ack_is_enabled())
         {
+#if NRF_802154_TX_PREPARE_ENABLED
+            nrf_802154_core_transmit_prepared_invalidate();
+#endif
             nrf_802154_tx_work_buffer_reset(&m_default_frame_props);
             mp_ack   = nrf_802154_ack_generator_create(&m_current_rx_frame_data);
             send_ack = (mp_ack != NULL);
@@ -2102,7 +2512,7 @@ void nrf_802154_trx_receive_frame_received(void)
                 }
                 else
                 {
-                    mp_current_rx_buffer->free = false;
+                    p_received_data = nrf_802154_rx_buffer_frame_commit(mp_current_rx_buffer);
 
                     state_set(RADIO_STATE_RX);
                     rx_init(TRX_RAMP_UP_SW_TRIGGER, NULL);
@@ -2118,7 +2528,7 @@ void nrf_802154_trx_receive_frame_received(void)
                     nrf_802154_stat_counter_increment(coex_denied_requests);
                 }
 
-                mp_current_rx_buffer->free = false;
+                p_received_data = nrf_802154_rx_buffer_frame_commit(mp_current_rx_buffer);
 
                 state_set(RADIO_STATE_RX);
                 rx_init(TRX_RAMP_UP_SW_TRIGGER, NULL);
@@ -2130,11 +2540,12 @@ void nrf_802154_trx_receive_frame_received(void)
         {
             request_preconditions_for_state(m_state);
             // Filter out received ACK frame if promiscuous mode is disabled.
-            if (((p_received_data[FRAME_TYPE_OFFSET] & FRAME_TYPE_MASK) != FRAME_TYPE_ACK) ||
-                nrf_802154_pib_promiscuous_get())
+            if ((((p_received_data[FRAME_TYPE_OFFSET] & FRAME_TYPE_MASK) != FRAME_TYPE_ACK) ||
+                 nrf_802154_pib_promiscuous_get()) &&
+                rx_frame_prefilter(p_received_data))
             {
                 // Current buffer will be passed to the application
-                mp_current_rx_buffer->free = false;
+                p_received_data = nrf_802154_rx_buffer_frame_commit(mp_current_rx_buffer);
 
                 // Find new buffer
                 rx_buffer_in_use_set(nrf_802154_rx_buffer_free_find());
@@ -2174,7 +2585,7 @@ void nrf_802154_trx_transmit_frame_started(void)
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
-void nrf_802154_trx_transmit_ack_started(void)
+NRF_802154_HOT_FUNC void nrf_802154_trx_transmit_ack_started(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
@@ -2184,7 +2595,7 @@ void nrf_802154_trx_transmit_ack_started(void)
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
-void nrf_802154_trx_transmit_ack_transmitted(void)
+NRF_802154_HOT_FUNC void nrf_802154_trx_transmit_ack_transmitted(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
@@ -2198,16 +2609,33 @@ void nrf_802154_trx_transmit_ack_transmitted(void)
     nrf_802154_stat_totals_increment(total_transmit_time, t_transmit);
 #endif
 
+    nrf_802154_stat_window_ack_tx_record();
+
     uint8_t * p_received_data = mp_current_rx_buffer->data;
+    bool      frame_accepted  = rx_frame_prefilter(p_received_data);
 
-    // Current buffer used for receive operation will be passed to the application
-    mp_current_rx_buffer->free = false;
+    if (frame_accepted)
+    {
+        // Current buffer used for receive operation will be passed to the application
+        p_received_data = nrf_802154_rx_buffer_frame_commit(mp_current_rx_buffer);
+    }
 
     state_set(RADIO_STATE_RX);
 
+#if NRF_802154_INDIRECT_TX_ENABLED
+    // The frame queued for the device that sent a MAC Data Request is scheduled right after
+    // the ACK, before the parser data of the received frame is cleared by the next reception.
+    nrf_802154_critical_section_nesting_allow();
+    nrf_802154_indirect_tx_ack_transmitted_hook(&m_current_rx_frame_data, mp_ack);
+    nrf_802154_critical_section_nesting_deny();
+#endif
+
     rx_init(TRX_RAMP_UP_SW_TRIGGER, NULL);
 
-    received_frame_notify_and_nesting_allow(p_received_data);
+    if (frame_accepted)
+    {
+        received_frame_notify_and_nesting_allow(p_received_data);
+    }
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
@@ -2261,6 +2689,8 @@ void nrf_802154_trx_transmit_frame_transmitted(void)
 #endif
 #endif
 
+    nrf_802154_stat_window_tx_frame_record();
+
     if (ack_is_requested(mp_tx_data))
     {
         state_set(RADIO_STATE_RX_ACK);
@@ -2270,14 +2700,11 @@ void nrf_802154_trx_transmit_frame_transmitted(void)
         nrf_802154_trx_receive_buffer_set(rx_buffer_get());
 
 #if (NRF_802154_FRAME_TIMESTAMP_ENABLED)
-#if (NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED)
-        // Configure the timer coordinator to get a timestamp of the END event which
-        // fires several cycles after CRCOK or CRCERROR events.
-        nrf_802154_timer_coord_timestamp_prepare(nrf_802154_trx_radio_end_event_handle_get());
-#else
-        // Configure the timer coordinator to get a timestamp of the CRCOK event.
-        nrf_802154_timer_coord_timestamp_prepare(nrf_802154_trx_radio_crcok_event_handle_get());
+        rx_timestamp_prepare();
 #endif
+
+#if NRF_802154_ACK_TIMEOUT_HW_ENABLED
+        nrf_802154_trx_receive_ack_timeout_set(nrf_802154_ack_timeout_hw_window_get());
 #endif
 
         nrf_802154_trx_receive_ack();
@@ -2337,15 +2764,12 @@ static bool ack_match_check_version_not_2(const uint8_t * p_tx_data, const uint8
 
 static bool ack_match_check_version_2(const uint8_t * p_tx_frame, const uint8_t * p_ack_frame)
 {
-    nrf_802154_frame_parser_data_t tx_data;
-    nrf_802154_frame_parser_data_t ack_data;
-    bool                           parse_result;
+    const nrf_802154_frame_parser_data_t * p_tx_data;
+    nrf_802154_frame_parser_data_t         ack_data;
+    bool                                   parse_result;
 
-    parse_result = nrf_802154_frame_parser_data_init(p_tx_frame,
-                                                     p_tx_frame[PHR_OFFSET] + PHR_SIZE,
-                                                     PARSE_LEVEL_ADDRESSING_END,
-                                                     &tx_data);
-    if (!parse_result)
+    p_tx_data = nrf_802154_frame_parser_tx_data_get(p_tx_frame, PARSE_LEVEL_ADDRESSING_END);
+    if (p_tx_data == NULL)
     {
         return false;
     }
@@ -2364,9 +2788,9 @@ static bool ack_match_check_version_2(const uint8_t * p_tx_frame, const uint8_t
     // For frame version 2 sequence number bit may be suppressed and its check fails.
     // Verify ACK frame using its destination address.
 
-    const uint8_t * p_tx_src_addr     = nrf_802154_frame_parser_src_addr_get(&tx_data);
+    const uint8_t * p_tx_src_addr     = nrf_802154_frame_parser_src_addr_get(p_tx_data);
     const uint8_t * p_ack_dst_addr    = nrf_802154_frame_parser_dst_addr_get(&ack_data);
-    uint8_t         tx_src_addr_size  = nrf_802154_frame_parser_src_addr_size_get(&tx_data);
+    uint8_t         tx_src_addr_size  = nrf_802154_frame_parser_src_addr_size_get(p_tx_data);
     uint8_t         ack_dst_addr_size = nrf_802154_frame_parser_dst_addr_size_get(&ack_data);
 
     if (!parse_result ||
@@ -2423,6 +2847,30 @@ static void on_bad_ack(void)
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
+#if NRF_802154_ACK_TIMEOUT_HW_ENABLED
+void nrf_802154_trx_receive_ack_timeout(void)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    assert(m_state == RADIO_STATE_RX_ACK);
+
+    // No ACK started within the waiting window and the receiver has already been disabled
+    nrf_802154_ant_div_tx_no_ack_record();
+
+    state_set(RADIO_STATE_RX);
+
+    rx_init(TRX_RAMP_UP_SW_TRIGGER, NULL);
+
+    nrf_802154_transmit_done_metadata_t metadata = {};
+
+    nrf_802154_tx_work_buffer_original_frame_update(mp_tx_data, &metadata.frame_props);
+    transmit_failed_notify_and_nesting_allow(NRF_802154_TX_ERROR_NO_ACK, &metadata);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+}
+
+#endif // NRF_802154_ACK_TIMEOUT_HW_ENABLED
+
 void nrf_802154_trx_receive_ack_received(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
@@ -2441,22 +2889,27 @@ void nrf_802154_trx_receive_ack_received(void)
 
     if (ack_match_check(mp_tx_data, p_ack_data))
     {
+        nrf_802154_stat_window_ack_rx_record();
+
 #if (NRF_802154_FRAME_TIMESTAMP_ENABLED)
-        uint64_t ts = timer_coord_timestamp_get();
+        uint64_t ts = rx_end_timestamp_get(mp_current_rx_buffer->data);
 
         nrf_802154_stat_timestamp_write(last_ack_end_timestamp, ts);
 #endif
 
-        rx_buffer_t * p_ack_buffer = mp_current_rx_buffer;
+        uint8_t * p_ack_data;
+        int8_t    ack_rssi = rssi_last_measurement_get();
+
+        nrf_802154_ant_div_tx_ack_record(ack_rssi);
 
-        mp_current_rx_buffer->free = false;
+        p_ack_data = nrf_802154_rx_buffer_frame_commit(mp_current_rx_buffer);
 
         state_set(RADIO_STATE_RX);
         rx_init(TRX_RAMP_UP_SW_TRIGGER, NULL);
 
-        transmitted_frame_notify(p_ack_buffer->data,           // phr + psdu
-                                 rssi_last_measurement_get(),  // rssi
-                                 lqi_get(p_ack_buffer->data)); // lqi;
+        transmitted_frame_notify(p_ack_data,           // phr + psdu
+                                 ack_rssi,             // rssi
+                                 lqi_get(p_ack_data)); // lqi;
     }
     else
     {
@@ -2504,7 +2957,7 @@ void nrf_802154_trx_transmit_frame_ccaidle(void)
 
     if (m_coex_tx_request_mode == NRF_802154_COEX_TX_REQUEST_MODE_CCA_DONE)
     {
-        nrf_802154_rsch_crit_sect_prio_request(RSCH_PRIO_TX);
+        rsch_prio_request(RSCH_PRIO_TX);
         m_flags.tx_diminished_prio = false;
     }
 
@@ -2516,6 +2969,7 @@ void nrf_802154_trx_transmit_frame_ccabusy(void)
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
     nrf_802154_stat_counter_increment(cca_failed_attempts);
+    nrf_802154_stat_window_cca_fail_record();
 
 #if (NRF_802154_TOTAL_TIMES_MEASUREMENT_ENABLED)
     uint32_t t_listening = RX_RAMP_UP_TIME + PHY_US_TIME_FROM_SYMBOLS(A_CCA_DURATION_SYMBOLS);
@@ -2562,6 +3016,10 @@ void nrf_802154_trx_energy_detection_finished(uint8_t ed_sample)
     {
         ed_init();
     }
+    else if (m_flags.ed_scan && ed_scan_channel_finish())
+    {
+        ed_init();
+    }
     else
     {
         nrf_802154_trx_channel_set(nrf_802154_pib_channel_get());
@@ -2569,13 +3027,108 @@ void nrf_802154_trx_energy_detection_finished(uint8_t ed_sample)
         state_set(RADIO_STATE_RX);
         rx_init(TRX_RAMP_UP_SW_TRIGGER, NULL);
 
-        energy_detected_notify(nrf_802154_rssi_ed_sample_convert(m_ed_result));
-
+        if (m_flags.ed_scan)
+        {
+            m_flags.ed_scan = false;
+            energy_scan_done_notify();
+        }
+        else
+        {
+            energy_detected_notify(nrf_802154_rssi_ed_sample_convert(m_ed_result));
+        }
     }
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
+/**
+ * @brief Starts the transmission of a frame within a critical section.
+ *
+ * @param[in]  term_lvl  Termination level of this request. Selects procedures to abort.
+ * @param[in]  req_orig  Module that originates this request.
+ * @param[in]  p_data    Pointer to a frame to transmit.
+ * @param[in]  p_params  Pointer to transmission parameters.
+ * @param[in]  set_up    If the frame has already been processed by the TX setup hooks.
+ *
+ * @retval  true   Entering the transmit state succeeded.
+ * @retval  false  Entering the transmit state failed.
+ */
+static bool transmit_begin(nrf_802154_term_t              term_lvl,
+                           req_originator_t               req_orig,
+                           uint8_t                      * p_data,
+                           nrf_802154_transmit_params_t * p_params,
+                           bool                           set_up)
+{
+    bool result = true;
+
+    if (!set_up)
+    {
+        // The buffer may hold a different frame than last time it was transmitted
+        nrf_802154_frame_parser_tx_data_invalidate();
+    }
+
+    if (nrf_802154_core_hooks_pre_transmission(p_data, p_params, &transmit_failed_notify))
+    {
+        result = current_operation_terminate(term_lvl, req_orig, true);
+
+        if (result && !set_up)
+        {
+            nrf_802154_tx_work_buffer_reset(&p_params->frame_props);
+            result = nrf_802154_core_hooks_tx_setup(p_data, p_params, &transmit_failed_notify);
+        }
+
+        if (result)
+        {
+            m_coex_tx_request_mode                  = nrf_802154_pib_coex_tx_request_mode_get();
+            m_trx_transmit_frame_notifications_mask =
+                make_trx_frame_transmit_notification_mask(p_params->cca);
+            m_flags.tx_diminished_prio =
+                m_coex_tx_request_mode == NRF_802154_COEX_TX_REQUEST_MODE_CCA_DONE;
+
+            state_set(p_params->cca ? RADIO_STATE_CCA_TX : RADIO_STATE_TX);
+            mp_tx_data = p_data;
+            m_tx_power = p_params->tx_power;
+
+            // coverity[check_return]
+            result = tx_init(p_data, ramp_up_mode_choose(req_orig), p_params->cca);
+
+            if (p_params->immediate)
+            {
+                if (!result)
+                {
+                    state_set(RADIO_STATE_RX);
+                    rx_init(TRX_RAMP_UP_SW_TRIGGER, NULL);
+                }
+            }
+            else
+            {
+                result = true;
+            }
+        }
+    }
+
+    return result;
+}
+
+#if NRF_802154_TX_PREPARE_ENABLED
+
+/**
+ * @brief Ignores a failure notification of the frame processing done by
+ *        @ref nrf_802154_core_transmit_prepare.
+ *
+ * The failure is reported to the caller of @ref nrf_802154_core_transmit_prepare instead.
+ */
+static void transmit_prepare_failed_notify(uint8_t                                   * p_frame,
+                                           nrf_802154_tx_error_t                       error,
+                                           const nrf_802154_transmit_done_metadata_t * p_meta)
+{
+    (void)p_frame;
+    (void)error;
+    (void)p_meta;
+}
+
+#endif // NRF_802154_TX_PREPARE_ENABLED
+
 /***************************************************************************************************
  * @section API functions
  **************************************************************************************************/
@@ -2586,6 +3139,11 @@ void nrf_802154_core_init(void)
     m_rsch_timeslot_is_granted = false;
     m_rx_prestarted_trig_count = 0;
 
+#if NRF_802154_TX_PREPARE_ENABLED
+    m_tx_prepared.p_data    = NULL;
+    m_tx_prepared.is_set_up = false;
+#endif
+
     nrf_802154_sl_timer_init(&m_rx_prestarted_timer);
 
     nrf_802154_trx_init();
@@ -2676,6 +3234,9 @@ bool nrf_802154_core_receive(nrf_802154_term_t              term_lvl,
                         make_trx_frame_receive_notification_mask();
 
                     m_rx_window_id = id;
+#if NRF_802154_LIGHT_SLEEP_ENABLED
+                    wake_latency_measure_start();
+#endif
                     state_set(RADIO_STATE_RX);
 
                     bool abort_shall_follow = false;
@@ -2730,59 +3291,131 @@ bool nrf_802154_core_transmit(nrf_802154_term_t              term_lvl,
 
     if (result)
     {
-        if (nrf_802154_core_hooks_pre_transmission(p_data, p_params, &transmit_failed_notify))
+#if NRF_802154_TX_PREPARE_ENABLED
+        nrf_802154_core_transmit_prepared_invalidate();
+#endif
+        result = transmit_begin(term_lvl, req_orig, p_data, p_params, false);
+
+        if (notify_function != NULL)
         {
-            result = current_operation_terminate(term_lvl, req_orig, true);
+            notify_function(result);
+        }
 
-            if (result)
-            {
-                nrf_802154_tx_work_buffer_reset(&p_params->frame_props);
-                result = nrf_802154_core_hooks_tx_setup(p_data, p_params, &transmit_failed_notify);
-            }
+        nrf_802154_critical_section_exit();
+    }
+    else
+    {
+        if (notify_function != NULL)
+        {
+            notify_function(false);
+        }
+    }
 
-            if (result)
-            {
-                m_coex_tx_request_mode                  = nrf_802154_pib_coex_tx_request_mode_get();
-                m_trx_transmit_frame_notifications_mask =
-                    make_trx_frame_transmit_notification_mask(p_params->cca);
-                m_flags.tx_diminished_prio =
-                    m_coex_tx_request_mode == NRF_802154_COEX_TX_REQUEST_MODE_CCA_DONE;
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 
-                state_set(p_params->cca ? RADIO_STATE_CCA_TX : RADIO_STATE_TX);
-                mp_tx_data = p_data;
-                m_tx_power = p_params->tx_power;
+    return result;
+}
 
-                // coverity[check_return]
-                result = tx_init(p_data, ramp_up_mode_choose(req_orig), p_params->cca);
+#if NRF_802154_TX_PREPARE_ENABLED
 
-                if (p_params->immediate)
-                {
-                    if (!result)
-                    {
-                        state_set(RADIO_STATE_RX);
-                        rx_init(TRX_RAMP_UP_SW_TRIGGER, NULL);
-                    }
-                }
-                else
-                {
-                    result = true;
-                }
-            }
+bool nrf_802154_core_transmit_prepare(uint8_t                              * p_data,
+                                      const nrf_802154_transmit_metadata_t * p_metadata)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    bool result = critical_section_enter_and_verify_timeslot_length();
+
+    if (result)
+    {
+        switch (m_state)
+        {
+            case RADIO_STATE_TX_ACK:
+            case RADIO_STATE_CCA_TX:
+            case RADIO_STATE_TX:
+            case RADIO_STATE_RX_ACK:
+                // The transmit work buffer is in use
+                result = false;
+                break;
+
+            default:
+                break;
         }
 
-        if (notify_function != NULL)
+        if (result)
         {
-            notify_function(result);
+            nrf_802154_transmit_params_t * p_params = &m_tx_prepared.params;
+
+            m_tx_prepared.p_data    = NULL;
+            m_tx_prepared.is_set_up = false;
+            m_tx_prepared.tx_power  = p_metadata->tx_power;
+
+            p_params->frame_props = p_metadata->frame_props;
+            p_params->cca         = p_metadata->cca;
+            p_params->immediate   = false;
+
+            (void)nrf_802154_tx_power_convert_metadata_to_tx_power_split(
+                nrf_802154_pib_channel_get(),
+                p_metadata->tx_power,
+                p_data,
+                &p_params->tx_power);
+
+            nrf_802154_frame_parser_tx_data_invalidate();
+            nrf_802154_tx_work_buffer_reset(&p_params->frame_props);
+            result = nrf_802154_core_hooks_tx_setup(p_data,
+                                                    p_params,
+                                                    &transmit_prepare_failed_notify);
+
+            if (result)
+            {
+                m_tx_prepared.p_data    = p_data;
+                m_tx_prepared.is_set_up = true;
+            }
         }
 
         nrf_802154_critical_section_exit();
     }
-    else
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+
+    return result;
+}
+
+bool nrf_802154_core_transmit_commit(nrf_802154_term_t term_lvl, req_originator_t req_orig)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    bool result = critical_section_enter_and_verify_timeslot_length();
+
+    if (result)
     {
-        if (notify_function != NULL)
+        uint8_t                    * p_data = m_tx_prepared.p_data;
+        nrf_802154_transmit_params_t params = m_tx_prepared.params;
+        bool                         set_up = m_tx_prepared.is_set_up;
+
+        // A prepared frame is committed only once
+        m_tx_prepared.p_data    = NULL;
+        m_tx_prepared.is_set_up = false;
+
+        if (p_data == NULL)
         {
-            notify_function(false);
+            result = false;
+        }
+        else
+        {
+            if (!set_up)
+            {
+                // The channel or the transmit power may have changed since the preparation
+                (void)nrf_802154_tx_power_convert_metadata_to_tx_power_split(
+                    nrf_802154_pib_channel_get(),
+                    m_tx_prepared.tx_power,
+                    p_data,
+                    &params.tx_power);
+            }
+
+            result = transmit_begin(term_lvl, req_orig, p_data, &params, set_up);
         }
+
+        nrf_802154_critical_section_exit();
     }
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
@@ -2790,6 +3423,13 @@ bool nrf_802154_core_transmit(nrf_802154_term_t              term_lvl,
     return result;
 }
 
+void nrf_802154_core_transmit_prepared_invalidate(void)
+{
+    m_tx_prepared.is_set_up = false;
+}
+
+#endif // NRF_802154_TX_PREPARE_ENABLED
+
 bool nrf_802154_core_energy_detection(nrf_802154_term_t term_lvl, uint32_t time_us)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
@@ -2807,8 +3447,45 @@ bool nrf_802154_core_energy_detection(nrf_802154_term_t term_lvl, uint32_t time_
                 time_us = ED_ITER_DURATION;
             }
 
-            m_ed_time_left = time_us;
-            m_ed_result    = 0;
+            m_ed_time_left  = time_us;
+            m_ed_result     = 0;
+            m_flags.ed_scan = false;
+
+            state_set(RADIO_STATE_ED);
+            ed_init();
+        }
+
+        nrf_802154_critical_section_exit();
+    }
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+
+    return result;
+}
+
+bool nrf_802154_core_energy_scan(nrf_802154_term_t term_lvl,
+                                 uint32_t          channel_mask,
+                                 uint32_t          dwell_us)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    assert((channel_mask != 0U) && ((channel_mask & ~NRF_802154_ENERGY_SCAN_CHANNELS_MASK) == 0U));
+
+    bool result = critical_section_enter_and_verify_timeslot_length();
+
+    if (result)
+    {
+        result = current_operation_terminate(term_lvl, REQ_ORIG_CORE, true);
+
+        if (result)
+        {
+            m_ed_scan.channel_mask  = channel_mask;
+            m_ed_scan.channels_left = channel_mask;
+            m_ed_scan.dwell_us      = (dwell_us < ED_ITER_DURATION) ? ED_ITER_DURATION : dwell_us;
+            m_ed_scan.results_count = 0U;
+            m_flags.ed_scan         = true;
+
+            (void)ed_scan_channel_next();
 
             state_set(RADIO_STATE_ED);
             ed_init();
@@ -2907,7 +3584,7 @@ bool nrf_802154_core_notify_buffer_free(uint8_t * p_data)
     rx_buffer_t * p_buffer     = (rx_buffer_t *)p_data;
     bool          in_crit_sect = critical_section_enter_and_verify_timeslot_length();
 
-    p_buffer->free = true;
+    nrf_802154_rx_buffer_mark_free(p_buffer);
 
     if (in_crit_sect)
     {
@@ -2915,8 +3592,17 @@ bool nrf_802154_core_notify_buffer_free(uint8_t * p_data)
         {
             if (nrf_802154_trx_receive_is_buffer_missing())
             {
-                rx_buffer_in_use_set(p_buffer);
-                nrf_802154_trx_receive_buffer_set(rx_buffer_get());
+#if NRF_802154_RX_BUFFER_SLAB_ENABLED
+                // A frame freed from a small buffer leaves no room to receive into,
+                // but a full-size buffer might have become free in the meantime.
+                p_buffer = nrf_802154_rx_buffer_free_find();
+
+                if (p_buffer != NULL)
+#endif
+                {
+                    rx_buffer_in_use_set(p_buffer);
+                    nrf_802154_trx_receive_buffer_set(rx_buffer_get());
+                }
             }
         }
 
@@ -2938,7 +3624,7 @@ bool nrf_802154_core_channel_update(req_originator_t req_orig)
     {
         if (timeslot_is_granted())
         {
-            nrf_802154_trx_channel_set(nrf_802154_pib_channel_get());
+            nrf_802154_trx_channel_set(operation_channel_get());
         }
 
         switch (m_state)
@@ -3063,6 +3749,31 @@ bool nrf_802154_core_last_rssi_measurement_get(int8_t * p_rssi)
     return result;
 }
 
+bool nrf_802154_core_idle_rssi_sample(int8_t * p_rssi)
+{
+    bool result = critical_section_enter_and_verify_timeslot_length();
+
+    if (result)
+    {
+        result = false;
+
+        // The RADIO state and the reception progress are stable only in a critical section
+        if (timeslot_is_granted() &&
+            (m_state == RADIO_STATE_RX) &&
+            !nrf_802154_trx_psdu_is_being_received() &&
+            nrf_802154_trx_rssi_measure())
+        {
+            rssi_measurement_wait();
+            *p_rssi = rssi_last_measurement_get();
+            result  = true;
+        }
+
+        nrf_802154_critical_section_exit();
+    }
+
+    return result;
+}
+
 int8_t  nrf_802154_core_last_frame_rssi_get(void)
 {
     return m_last_rssi;
@@ -3073,6 +3784,20 @@ uint8_t nrf_802154_core_last_frame_lqi_get(void)
     return m_last_lqi;
 }
 
+#if NRF_802154_LIGHT_SLEEP_ENABLED
+
+void nrf_802154_core_light_sleep_set(bool enabled)
+{
+    nrf_802154_trx_light_sleep_set(enabled);
+}
+
+uint32_t nrf_802154_core_wake_latency_get(void)
+{
+    return m_wake_latency;
+}
+
+#endif // NRF_802154_LIGHT_SLEEP_ENABLED
+
 bool nrf_802154_core_antenna_update(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
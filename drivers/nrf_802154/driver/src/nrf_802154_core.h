@@ -153,6 +153,47 @@ bool nrf_802154_core_transmit(nrf_802154_term_t              term_lvl,
                               nrf_802154_transmit_params_t * p_params,
                               nrf_802154_notification_func_t notify_function);
 
+#if NRF_802154_TX_PREPARE_ENABLED
+
+/**
+ * @brief Prepares a frame to be transmitted by @ref nrf_802154_core_transmit_commit.
+ *
+ * The frame goes through the same processing as in @ref nrf_802154_core_transmit, but the radio
+ * state is not changed. A previously prepared frame is replaced.
+ *
+ * @param[in]  p_data      Pointer to a frame to transmit.
+ * @param[in]  p_metadata  Pointer to metadata of the frame to transmit.
+ *
+ * @retval  true   The frame was prepared.
+ * @retval  false  The frame could not be prepared (the frame processing failed or the driver
+ *                 is transmitting or receiving an ACK).
+ */
+bool nrf_802154_core_transmit_prepare(uint8_t                              * p_data,
+                                      const nrf_802154_transmit_metadata_t * p_metadata);
+
+/**
+ * @brief Requests the transition to the @ref RADIO_STATE_TX state for the prepared frame.
+ *
+ * If the preparation has been invalidated in the meantime, the frame is processed again before
+ * the transmission. The prepared frame is consumed by this call.
+ *
+ * @param[in]  term_lvl  Termination level of this request. Selects procedures to abort.
+ * @param[in]  req_orig  Module that originates this request.
+ *
+ * @retval  true   Entering the transmit state succeeded.
+ * @retval  false  No frame was prepared or entering the transmit state failed.
+ */
+bool nrf_802154_core_transmit_commit(nrf_802154_term_t term_lvl, req_originator_t req_orig);
+
+/**
+ * @brief Invalidates the processing done for the prepared frame.
+ *
+ * The prepared frame is kept and processed again by @ref nrf_802154_core_transmit_commit.
+ */
+void nrf_802154_core_transmit_prepared_invalidate(void);
+
+#endif // NRF_802154_TX_PREPARE_ENABLED
+
 /**
  * @brief Requests the transition to the @ref RADIO_STATE_ED state.
  *
@@ -168,6 +209,25 @@ bool nrf_802154_core_transmit(nrf_802154_term_t              term_lvl,
  */
 bool nrf_802154_core_energy_detection(nrf_802154_term_t term_lvl, uint32_t time_us);
 
+/**
+ * @brief Requests the transition to the @ref RADIO_STATE_ED state to scan multiple channels.
+ *
+ * Energy detection is performed on each channel from @p channel_mask in turn, in order of
+ * increasing channel numbers. When the scan is finished, the driver transitions
+ * to the @ref RADIO_STATE_RX state.
+ *
+ * @param[in]  term_lvl      Termination level of this request. Selects procedures to abort.
+ * @param[in]  channel_mask  Mask of channels to scan. Bit @c n selects channel @c n.
+ * @param[in]  dwell_us      Minimal time of energy detection procedure on each channel.
+ *
+ * @retval  true   Entering the energy detection state succeeded.
+ * @retval  false  Entering the energy detection state failed
+ *                 (the driver is performing other procedure).
+ */
+bool nrf_802154_core_energy_scan(nrf_802154_term_t term_lvl,
+                                 uint32_t          channel_mask,
+                                 uint32_t          dwell_us);
+
 /**
  * @brief Requests the transition to the @ref RADIO_STATE_CCA state.
  *
@@ -253,6 +313,19 @@ bool nrf_802154_core_rssi_measure(void);
  */
 bool nrf_802154_core_last_rssi_measurement_get(int8_t * p_rssi);
 
+/**
+ * @brief Samples the RSSI of the channel while the receiver is idle.
+ *
+ * The sample is taken only if the core is in the receive state and no frame is being received,
+ * so the receiver is not disabled and no frame is lost because of the sampling.
+ *
+ * @param[out]  p_rssi  Sampled RSSI in dBm.
+ *
+ * @retval true   The RSSI has been sampled.
+ * @retval false  The driver is not idle in the receive state and no sample has been taken.
+ */
+bool nrf_802154_core_idle_rssi_sample(int8_t * p_rssi);
+
 /**
  * Get RSSI of the last received non-ACK frame.
  *
@@ -271,6 +344,24 @@ int8_t nrf_802154_core_last_frame_rssi_get(void);
  */
 uint8_t nrf_802154_core_last_frame_lqi_get(void);
 
+#if NRF_802154_LIGHT_SLEEP_ENABLED
+
+/**
+ * @brief Selects if the RADIO configuration is to be retained in the sleep state.
+ *
+ * @param[in]  enabled  If the sleep state is to be the light sleep.
+ */
+void nrf_802154_core_light_sleep_set(bool enabled);
+
+/**
+ * @brief Gets the duration of the last wake-up from the sleep state to the receive state.
+ *
+ * @returns  Time in microseconds from the receive request to the receiver ramp-up.
+ */
+uint32_t nrf_802154_core_wake_latency_get(void);
+
+#endif // NRF_802154_LIGHT_SLEEP_ENABLED
+
 /**
  * @brief Notifies the core module that the next higher layer requested the change of the antenna.
  */
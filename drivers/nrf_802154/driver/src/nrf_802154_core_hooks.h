@@ -38,9 +38,21 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
+#include "nrf_802154_profiler.h"
 #include "nrf_802154_types_internal.h"
 
+#include "mac_features/nrf_802154_ack_timeout.h"
+#include "mac_features/nrf_802154_csma_ca.h"
+#include "mac_features/nrf_802154_delayed_trx.h"
+#include "mac_features/nrf_802154_ie_writer.h"
+#include "mac_features/nrf_802154_security_writer.h"
+#include "mac_features/nrf_802154_ifs.h"
+#include "mac_features/nrf_802154_tsch_engine.h"
+#include "nrf_802154_encrypt.h"
+#include "nrf_802154_tx_power_control.h"
+
 /**
  * @defgroup nrf_802154_hooks Hooks for the 802.15.4 driver core
  * @{
@@ -49,8 +61,22 @@
  *
  * Hooks are used by the optional driver features to modify the way in which notifications
  * are propagated through the driver.
+ *
+ * The set of hooks is fixed at build time by the configuration of the driver features, so every
+ * hook type is processed by an inline function that calls the enabled features directly. Hooks of
+ * disabled features are removed by the preprocessor.
  */
 
+#if NRF_802154_PROFILER_HOOKS_ENABLED
+#define NRF_802154_CORE_HOOKS_PROFILE_BEGIN() \
+    uint32_t hooks_profile_start = nrf_802154_profiler_begin()
+#define NRF_802154_CORE_HOOKS_PROFILE_END(point) \
+    nrf_802154_profiler_end((point), hooks_profile_start)
+#else
+#define NRF_802154_CORE_HOOKS_PROFILE_BEGIN()
+#define NRF_802154_CORE_HOOKS_PROFILE_END(point)
+#endif
+
 /**
  * @brief Processes hooks for the termination request.
  *
@@ -60,7 +86,36 @@
  * @retval true   All procedures are aborted.
  * @retval false  There is an ongoing procedure that cannot be aborted due to a too low @p term_lvl.
  */
-bool nrf_802154_core_hooks_terminate(nrf_802154_term_t term_lvl, req_originator_t req_orig);
+static inline bool nrf_802154_core_hooks_terminate(nrf_802154_term_t term_lvl,
+                                                   req_originator_t  req_orig)
+{
+    (void)term_lvl;
+    (void)req_orig;
+
+    NRF_802154_CORE_HOOKS_PROFILE_BEGIN();
+
+    bool result = true;
+
+#if NRF_802154_CSMA_CA_ENABLED
+    result = result && nrf_802154_csma_ca_abort(term_lvl, req_orig);
+#endif
+
+#if NRF_802154_ACK_TIMEOUT_ENABLED
+    result = result && nrf_802154_ack_timeout_abort(term_lvl, req_orig);
+#endif
+
+#if NRF_802154_DELAYED_TRX_ENABLED
+    result = result && nrf_802154_delayed_trx_abort(term_lvl, req_orig);
+#endif
+
+#if NRF_802154_IFS_ENABLED
+    result = result && nrf_802154_ifs_abort(term_lvl, req_orig);
+#endif
+
+    NRF_802154_CORE_HOOKS_PROFILE_END(NRF_802154_PROFILE_POINT_HOOKS_TERMINATE);
+
+    return result;
+}
 
 /**
  * @brief Processes hooks which are to fire before the transmission request and before
@@ -74,10 +129,27 @@ bool nrf_802154_core_hooks_terminate(nrf_802154_term_t term_lvl, req_originator_
  * @retval true         Frame can be sent immediately.
  * @retval false        Hooks have handled the frame - upper layer should not worry about it anymore.
  */
-bool nrf_802154_core_hooks_pre_transmission(
+static inline bool nrf_802154_core_hooks_pre_transmission(
     uint8_t                                 * p_frame,
     nrf_802154_transmit_params_t            * p_params,
-    nrf_802154_transmit_failed_notification_t notify_function);
+    nrf_802154_transmit_failed_notification_t notify_function)
+{
+    (void)p_frame;
+    (void)p_params;
+    (void)notify_function;
+
+    NRF_802154_CORE_HOOKS_PROFILE_BEGIN();
+
+    bool result = true;
+
+#if NRF_802154_IFS_ENABLED
+    result = result && nrf_802154_ifs_pretransmission(p_frame, p_params, notify_function);
+#endif
+
+    NRF_802154_CORE_HOOKS_PROFILE_END(NRF_802154_PROFILE_POINT_HOOKS_PRE_TRANSMISSION);
+
+    return result;
+}
 
 /**
  * @brief Processes hooks which are to fire before the transmission but after previous operation
@@ -91,10 +163,35 @@ bool nrf_802154_core_hooks_pre_transmission(
  * @retval true         Frame can be sent immediately.
  * @retval false        Hooks have handled the frame - upper layer should not worry about it anymore.
  */
-bool nrf_802154_core_hooks_tx_setup(
+static inline bool nrf_802154_core_hooks_tx_setup(
     uint8_t                                 * p_frame,
     nrf_802154_transmit_params_t            * p_params,
-    nrf_802154_transmit_failed_notification_t notify_function);
+    nrf_802154_transmit_failed_notification_t notify_function)
+{
+    (void)p_frame;
+    (void)p_params;
+    (void)notify_function;
+
+    NRF_802154_CORE_HOOKS_PROFILE_BEGIN();
+
+    bool result = true;
+
+#if NRF_802154_IE_WRITER_ENABLED
+    result = result && nrf_802154_ie_writer_tx_setup(p_frame, p_params, notify_function);
+#endif
+
+#if NRF_802154_SECURITY_WRITER_ENABLED
+    result = result && nrf_802154_security_writer_tx_setup(p_frame, p_params, notify_function);
+#endif
+
+#if NRF_802154_ENCRYPTION_ENABLED
+    result = result && nrf_802154_encrypt_tx_setup(p_frame, p_params, notify_function);
+#endif
+
+    NRF_802154_CORE_HOOKS_PROFILE_END(NRF_802154_PROFILE_POINT_HOOKS_TX_SETUP);
+
+    return result;
+}
 
 /**
  * @brief Processes hooks for the transmitted event.
@@ -102,7 +199,22 @@ bool nrf_802154_core_hooks_tx_setup(
  * @param[in]  p_frame  Pointer to a buffer that contains PHR and PSDU of the frame
  *                      that was transmitted.
  */
-void nrf_802154_core_hooks_transmitted(const uint8_t * p_frame);
+static inline void nrf_802154_core_hooks_transmitted(const uint8_t * p_frame)
+{
+    (void)p_frame;
+
+    NRF_802154_CORE_HOOKS_PROFILE_BEGIN();
+
+#if NRF_802154_ACK_TIMEOUT_ENABLED
+    nrf_802154_ack_timeout_transmitted_hook(p_frame);
+#endif
+
+#if NRF_802154_IFS_ENABLED
+    nrf_802154_ifs_transmitted_hook(p_frame);
+#endif
+
+    NRF_802154_CORE_HOOKS_PROFILE_END(NRF_802154_PROFILE_POINT_HOOKS_TRANSMITTED);
+}
 
 /**
  * @brief Processes hooks for the TX failed event.
@@ -115,7 +227,69 @@ void nrf_802154_core_hooks_transmitted(const uint8_t * p_frame);
  * @retval  false  TX failed event is not to be propagated to the MAC layer. It is handled
  *                 internally.
  */
-bool nrf_802154_core_hooks_tx_failed(uint8_t * p_frame, nrf_802154_tx_error_t error);
+static inline bool nrf_802154_core_hooks_tx_failed(uint8_t * p_frame, nrf_802154_tx_error_t error)
+{
+    (void)p_frame;
+    (void)error;
+
+    NRF_802154_CORE_HOOKS_PROFILE_BEGIN();
+
+    bool result = true;
+
+#if NRF_802154_CSMA_CA_ENABLED
+    result = result && nrf_802154_csma_ca_tx_failed_hook(p_frame, error);
+#endif
+
+#if NRF_802154_ACK_TIMEOUT_ENABLED
+    result = result && nrf_802154_ack_timeout_tx_failed_hook(p_frame, error);
+#endif
+
+#if NRF_802154_ENCRYPTION_ENABLED
+    result = result && nrf_802154_encrypt_tx_failed_hook(p_frame, error);
+#endif
+
+    NRF_802154_CORE_HOOKS_PROFILE_END(NRF_802154_PROFILE_POINT_HOOKS_TX_FAILED);
+
+    return result;
+}
+
+/**
+ * @brief Processes hooks for the final outcome of a transmission attempt.
+ *
+ * @param[in]     p_frame  Pointer to a buffer that contains PHR and PSDU of the frame.
+ * @param[in]     error    Cause of the failed transmission or @ref NRF_802154_TX_ERROR_NONE
+ *                         if the frame was transmitted successfully.
+ * @param[inout]  p_meta   Pointer to the metadata of the outcome to be notified.
+ *
+ * @retval  true   The outcome is to be propagated to the MAC layer.
+ * @retval  false  The outcome is not to be propagated to the MAC layer. It is handled
+ *                 internally.
+ */
+static inline bool nrf_802154_core_hooks_tx_outcome(uint8_t                             * p_frame,
+                                                    nrf_802154_tx_error_t                 error,
+                                                    nrf_802154_transmit_done_metadata_t * p_meta)
+{
+    (void)p_frame;
+    (void)error;
+    (void)p_meta;
+
+    bool result = true;
+
+#if NRF_802154_TX_POWER_CONTROL_PEERS_COUNT > 0
+    // Every attempt tells about the link, including the ones retransmitted internally.
+    nrf_802154_tx_power_control_tx_outcome_hook(p_frame, error, p_meta);
+#endif
+
+#if NRF_802154_CSMA_CA_ENABLED
+    result = result && nrf_802154_csma_ca_tx_outcome_hook(p_frame, error, p_meta);
+#endif
+
+#if NRF_802154_TSCH_ENABLED
+    result = result && nrf_802154_tsch_engine_tx_outcome_hook(p_frame, error, p_meta);
+#endif
+
+    return result;
+}
 
 /**
  * @brief Processes hooks for the ACK TX failed event.
@@ -124,7 +298,20 @@ bool nrf_802154_core_hooks_tx_failed(uint8_t * p_frame, nrf_802154_tx_error_t er
  *                      that was not transmitted.
  * @param[in]  error    Cause of the failed transmission.
  */
-void nrf_802154_core_hooks_tx_ack_failed(uint8_t * p_ack, nrf_802154_tx_error_t error);
+static inline void nrf_802154_core_hooks_tx_ack_failed(uint8_t               * p_ack,
+                                                       nrf_802154_tx_error_t error)
+{
+    (void)p_ack;
+    (void)error;
+
+    NRF_802154_CORE_HOOKS_PROFILE_BEGIN();
+
+#if NRF_802154_ENCRYPTION_ENABLED
+    nrf_802154_encrypt_tx_ack_failed_hook(p_ack, error);
+#endif
+
+    NRF_802154_CORE_HOOKS_PROFILE_END(NRF_802154_PROFILE_POINT_HOOKS_TX_ACK_FAILED);
+}
 
 /**
  * @brief Processes hooks for the TX started event.
@@ -136,7 +323,38 @@ void nrf_802154_core_hooks_tx_ack_failed(uint8_t * p_ack, nrf_802154_tx_error_t
  * @retval  false  TX started event is not to be propagated to the MAC layer. It is handled
  *                 internally.
  */
-bool nrf_802154_core_hooks_tx_started(uint8_t * p_frame);
+static inline bool nrf_802154_core_hooks_tx_started(uint8_t * p_frame)
+{
+    (void)p_frame;
+
+    NRF_802154_CORE_HOOKS_PROFILE_BEGIN();
+
+    bool result = true;
+
+#if NRF_802154_CSMA_CA_ENABLED
+    result = result && nrf_802154_csma_ca_tx_started_hook(p_frame);
+#endif
+
+#if NRF_802154_ACK_TIMEOUT_ENABLED
+    result = result && nrf_802154_ack_timeout_tx_started_hook(p_frame);
+#endif
+
+#if NRF_802154_SECURITY_WRITER_ENABLED
+    result = result && nrf_802154_security_writer_tx_started_hook(p_frame);
+#endif
+
+#if NRF_802154_IE_WRITER_ENABLED
+    result = result && nrf_802154_ie_writer_tx_started_hook(p_frame);
+#endif
+
+#if NRF_802154_ENCRYPTION_ENABLED
+    result = result && nrf_802154_encrypt_tx_started_hook(p_frame);
+#endif
+
+    NRF_802154_CORE_HOOKS_PROFILE_END(NRF_802154_PROFILE_POINT_HOOKS_TX_STARTED);
+
+    return result;
+}
 
 /**
  * @brief Processes hooks for the RX started event.
@@ -144,12 +362,32 @@ bool nrf_802154_core_hooks_tx_started(uint8_t * p_frame);
  * @param[in]  p_frame  Pointer to a buffer that contains PHR and PSDU of the frame
  *                      that is being received.
  */
-void nrf_802154_core_hooks_rx_started(const uint8_t * p_frame);
+static inline void nrf_802154_core_hooks_rx_started(const uint8_t * p_frame)
+{
+    (void)p_frame;
+
+    NRF_802154_CORE_HOOKS_PROFILE_BEGIN();
+
+#if NRF_802154_DELAYED_TRX_ENABLED
+    nrf_802154_delayed_trx_rx_started_hook(p_frame);
+#endif
+
+    NRF_802154_CORE_HOOKS_PROFILE_END(NRF_802154_PROFILE_POINT_HOOKS_RX_STARTED);
+}
 
 /**
  * @brief Processes hooks for the RX ACK started event.
  */
-void nrf_802154_core_hooks_rx_ack_started(void);
+static inline void nrf_802154_core_hooks_rx_ack_started(void)
+{
+    NRF_802154_CORE_HOOKS_PROFILE_BEGIN();
+
+#if NRF_802154_ACK_TIMEOUT_ENABLED
+    nrf_802154_ack_timeout_rx_ack_started_hook();
+#endif
+
+    NRF_802154_CORE_HOOKS_PROFILE_END(NRF_802154_PROFILE_POINT_HOOKS_RX_ACK_STARTED);
+}
 
 /**
  * @brief Processes hooks for the TX ACK started event.
@@ -157,7 +395,22 @@ void nrf_802154_core_hooks_rx_ack_started(void);
  * @param[in]  p_ack  Pointer to a buffer that contains PHR and PSDU of the ACK frame
  *                    that is being transmitted.
  */
-void nrf_802154_core_hooks_tx_ack_started(uint8_t * p_ack);
+static inline void nrf_802154_core_hooks_tx_ack_started(uint8_t * p_ack)
+{
+    (void)p_ack;
+
+    NRF_802154_CORE_HOOKS_PROFILE_BEGIN();
+
+#if NRF_802154_IE_WRITER_ENABLED
+    nrf_802154_ie_writer_tx_ack_started_hook(p_ack);
+#endif
+
+#if NRF_802154_ENCRYPTION_ENABLED
+    nrf_802154_encrypt_tx_ack_started_hook(p_ack);
+#endif
+
+    NRF_802154_CORE_HOOKS_PROFILE_END(NRF_802154_PROFILE_POINT_HOOKS_TX_ACK_STARTED);
+}
 
 /**
  *@}
@@ -47,6 +47,7 @@
 
 #include "nrf_802154_config.h"
 #include "nrf_802154_debug.h"
+#include "nrf_802154_profiler.h"
 #include "nrf_802154_utils.h"
 #include "rsch/nrf_802154_rsch.h"
 #include "platform/nrf_802154_platform_sl_lptimer.h"
@@ -58,6 +59,25 @@
 
 #define NESTED_CRITICAL_SECTION_ALLOWED_PRIORITY_NONE (-1)
 
+#if NRF_802154_CRITICAL_SECTION_BASEPRI_ENABLED
+
+#if !defined(__CORTEX_M) || (__CORTEX_M < 3U)
+#error "NRF_802154_CRITICAL_SECTION_BASEPRI_ENABLED requires a core with the BASEPRI register."
+#endif
+
+#if (NRF_802154_CRITICAL_SECTION_BASEPRI_CEILING == 0) || \
+    (NRF_802154_CRITICAL_SECTION_BASEPRI_CEILING > NRF_802154_IRQ_PRIORITY)
+#error "NRF_802154_CRITICAL_SECTION_BASEPRI_CEILING must be greater than 0 and cover the RADIO IRQ."
+#endif
+
+/// Value of the BASEPRI register that masks the interrupts up to the configured ceiling.
+#define CRITICAL_SECTION_BASEPRI \
+    ((uint32_t)NRF_802154_CRITICAL_SECTION_BASEPRI_CEILING << (8U - __NVIC_PRIO_BITS))
+
+static uint32_t m_basepri; ///< Value of the BASEPRI register before the critical section was entered.
+
+#endif // NRF_802154_CRITICAL_SECTION_BASEPRI_ENABLED
+
 static volatile uint8_t m_nested_critical_section_counter;          ///< Counter of nested critical sections
 static volatile int8_t  m_nested_critical_section_allowed_priority; ///< Indicator if nested critical sections are currently allowed
 
@@ -72,10 +92,17 @@ static volatile int8_t  m_nested_critical_section_allowed_priority; ///< Indicat
  */
 static void radio_critical_section_enter(void)
 {
+#if NRF_802154_CRITICAL_SECTION_BASEPRI_ENABLED
+    // The BASEPRI register is not shared with the radio arbiter, so it is set regardless of
+    // the timeslot. Only raise the masking level in case it is already set by the application.
+    m_basepri = __get_BASEPRI();
+    __set_BASEPRI_MAX(CRITICAL_SECTION_BASEPRI);
+#else
     if (nrf_802154_rsch_prec_is_approved(RSCH_PREC_RAAL, RSCH_PRIO_MIN_APPROVED))
     {
         nrf_802154_irq_disable(nrfx_get_irq_number(NRF_RADIO));
     }
+#endif
 }
 
 /** @brief Exit critical section for RADIO peripheral
@@ -85,10 +112,14 @@ static void radio_critical_section_enter(void)
  */
 static void radio_critical_section_exit(void)
 {
+#if NRF_802154_CRITICAL_SECTION_BASEPRI_ENABLED
+    __set_BASEPRI(m_basepri);
+#else
     if (nrf_802154_rsch_prec_is_approved(RSCH_PREC_RAAL, RSCH_PRIO_MIN_APPROVED))
     {
         nrf_802154_irq_enable(nrfx_get_irq_number(NRF_RADIO));
     }
+#endif
 }
 
 /** @brief Convert active priority value to int8_t type.
@@ -132,6 +163,7 @@ static bool critical_section_enter(bool forced)
 
         if (cnt == 1U)
         {
+            nrf_802154_profiler_mark(NRF_802154_PROFILE_POINT_CRITICAL_SECTION);
             nrf_802154_platform_sl_lptimer_critical_section_enter();
             radio_critical_section_enter();
         }
@@ -173,6 +205,7 @@ static void critical_section_exit(void)
 
             radio_critical_section_exit();
             nrf_802154_platform_sl_lptimer_critical_section_exit();
+            nrf_802154_profiler_mark_end(NRF_802154_PROFILE_POINT_CRITICAL_SECTION);
         }
 
         m_nested_critical_section_counter = cnt;
@@ -40,10 +40,56 @@
 #include "nrf_802154_aes_ccm.h"
 #include "nrf_802154_const.h"
 #include "nrf_802154_pib.h"
+#include "nrf_802154_procedures_duration.h"
+#include "nrf_802154_profiler.h"
 #include "nrf_802154_types_internal.h"
 #include "mac_features/nrf_802154_frame_parser.h"
 #include "mac_features/nrf_802154_security_pib.h"
 
+/**
+ * @brief Copy of the most recently used key.
+ *
+ * Most secured frames, including Enhanced ACKs, are secured with the same key, so looking it
+ * up in the Key Storage again is skipped while the Key Storage is not modified. The cache is
+ * accessed only while preparing a transformation, which happens either in a critical section
+ * or in the radio interrupt, so accesses to it never overlap.
+ */
+typedef struct
+{
+    uint8_t                  key[AES_CCM_KEY_SIZE];  ///< Key value.
+    uint8_t                  id[KEY_ID_MODE_3_SIZE]; ///< Key Identifier field of the key.
+    nrf_802154_key_id_mode_t mode;                   ///< Key Identifier Mode of the key.
+    uint32_t                 generation;             ///< Key Storage generation the key was retrieved in.
+    bool                     valid;                  ///< Flag indicating if the cache holds a key.
+} key_cache_t;
+
+static key_cache_t m_key_cache; ///< Cache of the most recently used key.
+
+/**
+ * @brief Gets length of the Key Identifier field for a given Key Identifier Mode.
+ *
+ * @param[in]  mode  Key Identifier Mode.
+ *
+ * @return Length of the Key Identifier field in bytes.
+ */
+static uint8_t key_id_length_get(nrf_802154_key_id_mode_t mode)
+{
+    switch (mode)
+    {
+        case KEY_ID_MODE_1:
+            return KEY_ID_MODE_1_SIZE;
+
+        case KEY_ID_MODE_2:
+            return KEY_ID_MODE_2_SIZE;
+
+        case KEY_ID_MODE_3:
+            return KEY_ID_MODE_3_SIZE;
+
+        default:
+            return 0;
+    }
+}
+
 /**
  * @brief Copies memory in reversed byte order.
  *
@@ -84,6 +130,34 @@ static uint8_t mic_level_from_security_level_get(uint8_t security_level)
     return security_level & SECURITY_LEVEL_MIC_LEVEL_MASK;
 }
 
+/**
+ * @brief Checks if the prepared transformation completes before the radio reaches the MIC.
+ *
+ * @param[in]  p_frame_data  Pointer to the frame parser data of the frame being secured.
+ *
+ * @retval  true   The worst-case transformation latency fits in the available time.
+ * @retval  false  The MIC could be transmitted before it is calculated.
+ */
+static bool transform_latency_fits(const nrf_802154_frame_parser_data_t * p_frame_data)
+{
+    // The transformation starts together with the transmission of the PSDU
+    uint8_t octets_before_deadline = p_frame_data->p_frame[PHR_OFFSET] - FCS_SIZE -
+                                nrf_802154_frame_parser_mic_size_get(p_frame_data);
+
+#if NRF_802154_TX_IN_PLACE_ENABLED
+    // The plain text is transmitted from the original frame, so it must be encrypted
+    // before the radio reaches it
+    if (nrf_802154_frame_parser_sec_ctrl_sec_lvl_get(p_frame_data) > SECURITY_LEVEL_MIC_128)
+    {
+        octets_before_deadline = nrf_802154_frame_parser_mac_payload_offset_get(p_frame_data) -
+                            PHR_SIZE;
+    }
+#endif
+
+    return nrf_802154_aes_ccm_transform_latency_get() <
+           nrf_802154_frame_duration_get(octets_before_deadline, false, false);
+}
+
 static bool a_data_and_m_data_prepare(
     const nrf_802154_frame_parser_data_t * p_frame_data,
     nrf_802154_aes_ccm_data_t            * p_aes_ccm_data)
@@ -163,8 +237,35 @@ bool aes_ccm_data_key_prepare(const nrf_802154_frame_parser_data_t * p_frame_dat
         .p_key_id = (uint8_t *)nrf_802154_frame_parser_key_id_get(p_frame_data),
     };
 
-    return NRF_802154_SECURITY_ERROR_NONE ==
-           nrf_802154_security_pib_key_use(&key_id, p_aes_ccm_data->key);
+    uint32_t generation = nrf_802154_security_pib_key_generation_get();
+    uint8_t  id_length  = key_id_length_get(key_id.mode);
+
+    if (m_key_cache.valid &&
+        (m_key_cache.generation == generation) &&
+        (m_key_cache.mode == key_id.mode) &&
+        ((id_length == 0) ||
+         ((key_id.p_key_id != NULL) && (memcmp(m_key_cache.id, key_id.p_key_id, id_length) == 0))))
+    {
+        memcpy(p_aes_ccm_data->key, m_key_cache.key, sizeof(p_aes_ccm_data->key));
+        return true;
+    }
+
+    if (NRF_802154_SECURITY_ERROR_NONE !=
+        nrf_802154_security_pib_key_use(&key_id, p_aes_ccm_data->key))
+    {
+        return false;
+    }
+
+    if ((id_length == 0) || (key_id.p_key_id != NULL))
+    {
+        memcpy(m_key_cache.key, p_aes_ccm_data->key, sizeof(m_key_cache.key));
+        memcpy(m_key_cache.id, key_id.p_key_id, id_length);
+        m_key_cache.mode       = key_id.mode;
+        m_key_cache.generation = generation;
+        m_key_cache.valid      = true;
+    }
+
+    return true;
 }
 
 /**
@@ -299,7 +400,8 @@ static bool aes_ccm_data_content_prepare(const nrf_802154_frame_parser_data_t *
 bool nrf_802154_encrypt_ack_prepare(const nrf_802154_frame_parser_data_t * p_ack_data)
 {
     nrf_802154_aes_ccm_data_t aes_ccm_data;
-    bool                      success = false;
+    bool                      success       = false;
+    uint32_t                  profile_start = nrf_802154_profiler_begin();
 
     if (!nrf_802154_frame_parser_security_enabled_bit_is_set(p_ack_data) ||
         (nrf_802154_frame_parser_sec_ctrl_sec_lvl_get(p_ack_data) == SECURITY_LEVEL_NONE))
@@ -310,12 +412,19 @@ bool nrf_802154_encrypt_ack_prepare(const nrf_802154_frame_parser_data_t * p_ack
     {
         // Algorithm's inputs prepared. Schedule transformation
         success = nrf_802154_aes_ccm_transform_prepare(&aes_ccm_data);
+
+        bool latency_fits = !success || transform_latency_fits(p_ack_data);
+
+        assert(latency_fits);
+        (void)latency_fits;
     }
     else
     {
         // Intentionally empty
     }
 
+    nrf_802154_profiler_end(NRF_802154_PROFILE_POINT_ENCRYPT_SETUP, profile_start);
+
     return success;
 }
 
@@ -337,32 +446,36 @@ bool nrf_802154_encrypt_tx_setup(
         return true;
     }
 
-    nrf_802154_frame_parser_data_t frame_data;
-    nrf_802154_aes_ccm_data_t      aes_ccm_data;
-    bool                           success = false;
+    const nrf_802154_frame_parser_data_t * p_frame_data;
+    nrf_802154_aes_ccm_data_t              aes_ccm_data;
+    bool                                   success       = false;
+    uint32_t                               profile_start = nrf_802154_profiler_begin();
 
-    success = nrf_802154_frame_parser_data_init(p_frame,
-                                                p_frame[PHR_OFFSET] + PHR_SIZE,
-                                                PARSE_LEVEL_FULL,
-                                                &frame_data);
-    assert(success);
-    (void)success;
+    p_frame_data = nrf_802154_frame_parser_tx_data_get(p_frame, PARSE_LEVEL_FULL);
+    assert(p_frame_data != NULL);
 
-    if (!nrf_802154_frame_parser_security_enabled_bit_is_set(&frame_data) ||
-        (nrf_802154_frame_parser_sec_ctrl_sec_lvl_get(&frame_data) == SECURITY_LEVEL_NONE))
+    if (!nrf_802154_frame_parser_security_enabled_bit_is_set(p_frame_data) ||
+        (nrf_802154_frame_parser_sec_ctrl_sec_lvl_get(p_frame_data) == SECURITY_LEVEL_NONE))
     {
         success = true;
     }
-    else if (aes_ccm_data_content_prepare(&frame_data, &aes_ccm_data))
+    else if (aes_ccm_data_content_prepare(p_frame_data, &aes_ccm_data))
     {
         // Algorithm's inputs prepared. Schedule transformation
         success = nrf_802154_aes_ccm_transform_prepare(&aes_ccm_data);
+
+        bool latency_fits = !success || transform_latency_fits(p_frame_data);
+
+        assert(latency_fits);
+        (void)latency_fits;
     }
     else
     {
         success = false;
     }
 
+    nrf_802154_profiler_end(NRF_802154_PROFILE_POINT_ENCRYPT_SETUP, profile_start);
+
     if (!success)
     {
         nrf_802154_transmit_done_metadata_t metadata = {};
@@ -0,0 +1,312 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the aggregation of the link quality of received frames per peer.
+ *
+ */
+
+#include "nrf_802154_link_quality.h"
+
+#if NRF_802154_LINK_QUALITY_PEERS_COUNT > 0
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_802154_const.h"
+#include "nrf_802154_nrfx_addons.h"
+#include "nrf_802154_utils.h"
+
+#define PEER_KEY_NONE 0U ///< Key of an unused peer entry.
+#define AVG_SCALE     8  ///< Scale of the averages, in fractions of the unit of a sample.
+#define AVG_WEIGHT    8  ///< Inverse of the weight of a new sample in the averages.
+
+/**@brief Entry describing a peer. */
+typedef struct
+{
+    uint64_t key;                         ///< Key identifying the peer or @ref PEER_KEY_NONE.
+    uint8_t  addr[EXTENDED_ADDRESS_SIZE]; ///< Address of the peer (little-endian).
+    uint8_t  pan_id[PAN_ID_SIZE];         ///< PAN ID of the peer (little-endian).
+    bool     extended;                    ///< If @c addr is an extended address.
+    int16_t  rssi;                        ///< Scaled average RSSI.
+    uint16_t lqi;                         ///< Scaled average LQI.
+    uint32_t rx_count;                    ///< Number of frames received from the peer.
+} peer_t;
+
+static peer_t   m_peers[NRF_802154_LINK_QUALITY_PEERS_COUNT]; ///< Tracked peers.
+static uint8_t  m_peer_next;                                  ///< Index of the entry to be replaced by a new peer.
+static peer_t * mp_last_peer;                                 ///< Source of the last recorded frame or NULL.
+
+/**
+ * @brief Gets the key identifying a peer by its address.
+ *
+ * @param[in]  p_addr    Pointer to the address of the peer or NULL if there is no address.
+ * @param[in]  extended  If @p p_addr points to an extended address.
+ * @param[in]  p_panid   Pointer to the PAN ID of a short address or NULL if unknown.
+ *
+ * @return Key of the peer or @ref PEER_KEY_NONE if the address does not identify a single peer.
+ */
+static uint64_t peer_key_get(const uint8_t * p_addr, bool extended, const uint8_t * p_panid)
+{
+    uint64_t key = PEER_KEY_NONE;
+
+    if (p_addr == NULL)
+    {
+        // Intentionally empty: no address.
+    }
+    else if (extended)
+    {
+        memcpy(&key, p_addr, EXTENDED_ADDRESS_SIZE);
+    }
+    else if ((p_addr[0] != 0xFFU) || (p_addr[1] != 0xFFU))
+    {
+        // Short addresses are only unique within a PAN. Mark the key so that it cannot be equal to
+        // PEER_KEY_NONE.
+        key = ((uint64_t)1U << 32) | ((uint32_t)p_addr[0]) | ((uint32_t)p_addr[1] << 8);
+
+        if (p_panid != NULL)
+        {
+            key |= ((uint32_t)p_panid[0] << 16) | ((uint32_t)p_panid[1] << 24);
+        }
+    }
+    else
+    {
+        // Intentionally empty: broadcast address.
+    }
+
+    return key;
+}
+
+/**
+ * @brief Gets the entry of a peer, creating it if the peer is not tracked yet.
+ *
+ * @param[in]  key       Key of the peer.
+ * @param[in]  p_addr    Pointer to the address of the peer.
+ * @param[in]  extended  If @p p_addr points to an extended address.
+ * @param[in]  p_panid   Pointer to the PAN ID of the peer or NULL if unknown.
+ *
+ * @return Pointer to the entry or NULL if @p key is @ref PEER_KEY_NONE.
+ */
+static peer_t * peer_get(uint64_t        key,
+                         const uint8_t * p_addr,
+                         bool            extended,
+                         const uint8_t * p_panid)
+{
+    if (key == PEER_KEY_NONE)
+    {
+        return NULL;
+    }
+
+    for (uint8_t i = 0; i < NRF_802154_LINK_QUALITY_PEERS_COUNT; i++)
+    {
+        if (m_peers[i].key == key)
+        {
+            return &m_peers[i];
+        }
+    }
+
+    peer_t * p_peer = &m_peers[m_peer_next];
+
+    m_peer_next = (m_peer_next + 1U) % NRF_802154_LINK_QUALITY_PEERS_COUNT;
+
+    memset(p_peer, 0, sizeof(peer_t));
+
+    p_peer->key      = key;
+    p_peer->extended = extended;
+    memcpy(p_peer->addr, p_addr, extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE);
+
+    if (p_panid != NULL)
+    {
+        memcpy(p_peer->pan_id, p_panid, PAN_ID_SIZE);
+    }
+
+    return p_peer;
+}
+
+/**
+ * @brief Adds the link quality of a received frame to the averages of a peer.
+ *
+ * @param[inout]  p_peer  Pointer to the entry of the peer.
+ * @param[in]     rssi    RSSI in dBm.
+ * @param[in]     lqi     LQI.
+ */
+static void peer_record(peer_t * p_peer, int8_t rssi, uint8_t lqi)
+{
+    int16_t  rssi_sample = (int16_t)(rssi * AVG_SCALE);
+    uint16_t lqi_sample  = (uint16_t)(lqi * AVG_SCALE);
+
+    if (p_peer->rx_count == 0U)
+    {
+        p_peer->rssi = rssi_sample;
+        p_peer->lqi  = lqi_sample;
+    }
+    else
+    {
+        p_peer->rssi += (rssi_sample - p_peer->rssi) / AVG_WEIGHT;
+        p_peer->lqi  += ((int32_t)lqi_sample - (int32_t)p_peer->lqi) / AVG_WEIGHT;
+    }
+
+    if (p_peer->rx_count < UINT32_MAX)
+    {
+        p_peer->rx_count++;
+    }
+}
+
+/**
+ * @brief Gets the average RSSI of a peer rounded to dBm.
+ *
+ * @param[in]  p_peer  Pointer to the entry of the peer.
+ *
+ * @return Average RSSI in dBm.
+ */
+static int8_t peer_rssi_get(const peer_t * p_peer)
+{
+    int16_t rssi = p_peer->rssi;
+
+    return (int8_t)((rssi >= 0) ? ((rssi + AVG_SCALE / 2) / AVG_SCALE) :
+                    ((rssi - AVG_SCALE / 2) / AVG_SCALE));
+}
+
+/**
+ * @brief Gets the average LQI of a peer rounded to an integer.
+ *
+ * @param[in]  p_peer  Pointer to the entry of the peer.
+ *
+ * @return Average LQI.
+ */
+static uint8_t peer_lqi_get(const peer_t * p_peer)
+{
+    return (uint8_t)((p_peer->lqi + AVG_SCALE / 2) / AVG_SCALE);
+}
+
+void nrf_802154_link_quality_init(void)
+{
+    memset(m_peers, 0, sizeof(m_peers));
+
+    m_peer_next  = 0U;
+    mp_last_peer = NULL;
+}
+
+void nrf_802154_link_quality_rx_frame_record(const nrf_802154_frame_parser_data_t * p_frame_data,
+                                             int8_t                                 rssi,
+                                             uint8_t                                lqi)
+{
+    const uint8_t * p_addr   = nrf_802154_frame_parser_src_addr_get(p_frame_data);
+    bool            extended = nrf_802154_frame_parser_src_addr_is_extended(p_frame_data);
+    const uint8_t * p_panid  = nrf_802154_frame_parser_src_panid_get(p_frame_data);
+
+    if (p_panid == NULL)
+    {
+        // The source PAN ID is compressed and equal to the destination PAN ID.
+        p_panid = nrf_802154_frame_parser_dst_panid_get(p_frame_data);
+    }
+
+    uint64_t key = peer_key_get(p_addr, extended, p_panid);
+
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    peer_t * p_peer = peer_get(key, p_addr, extended, p_panid);
+
+    if (p_peer != NULL)
+    {
+        peer_record(p_peer, rssi, lqi);
+    }
+
+    mp_last_peer = p_peer;
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+bool nrf_802154_link_quality_last_peer_get(int8_t * p_rssi, uint8_t * p_lqi)
+{
+    assert(p_rssi != NULL);
+    assert(p_lqi != NULL);
+
+    bool                            result = false;
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    if (mp_last_peer != NULL)
+    {
+        *p_rssi = peer_rssi_get(mp_last_peer);
+        *p_lqi  = peer_lqi_get(mp_last_peer);
+        result  = true;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return result;
+}
+
+uint8_t nrf_802154_link_quality_peers_read(nrf_802154_link_quality_t * p_entries, uint8_t count)
+{
+    assert((p_entries != NULL) || (count == 0U));
+
+    uint8_t written = 0U;
+
+    for (uint8_t i = 0; (i < NRF_802154_LINK_QUALITY_PEERS_COUNT) && (written < count); i++)
+    {
+        nrf_802154_link_quality_t     * p_entry = &p_entries[written];
+        nrf_802154_mcu_critical_state_t mcu_cs;
+
+        nrf_802154_mcu_critical_enter(mcu_cs);
+
+        const peer_t * p_peer = &m_peers[i];
+
+        if (p_peer->key != PEER_KEY_NONE)
+        {
+            int16_t margin = (int16_t)peer_rssi_get(p_peer) - ED_RSSIOFFS;
+
+            memcpy(p_entry->addr, p_peer->addr, sizeof(p_entry->addr));
+            memcpy(p_entry->pan_id, p_peer->pan_id, sizeof(p_entry->pan_id));
+            p_entry->extended = p_peer->extended;
+            p_entry->rssi     = peer_rssi_get(p_peer);
+            p_entry->lqi      = peer_lqi_get(p_peer);
+            p_entry->margin   = (uint8_t)((margin > 0) ? margin : 0);
+            p_entry->rx_count = p_peer->rx_count;
+            written++;
+        }
+
+        nrf_802154_mcu_critical_exit(mcu_cs);
+    }
+
+    return written;
+}
+
+#endif // NRF_802154_LINK_QUALITY_PEERS_COUNT > 0
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Module that aggregates the link quality of received frames per peer.
+ *
+ * The module keeps, for recent peers, an exponentially weighted moving average of the RSSI and
+ * the LQI of the frames received from them, together with the number of these frames. The averages
+ * can be read in bulk with @ref nrf_802154_link_quality_read and, if
+ * @ref NRF_802154_LINK_QUALITY_IE_AVERAGED_ENABLED is set, are reported in the Link Metrics IE of
+ * Enhanced ACKs instead of the metrics of the acknowledged frame.
+ */
+
+#ifndef NRF_802154_LINK_QUALITY_H__
+#define NRF_802154_LINK_QUALITY_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_types.h"
+#include "mac_features/nrf_802154_frame_parser.h"
+
+#if NRF_802154_LINK_QUALITY_PEERS_COUNT > 0
+
+/**
+ * @brief Initializes the link quality module.
+ */
+void nrf_802154_link_quality_init(void);
+
+/**
+ * @brief Records the link quality of a received frame for its source.
+ *
+ * @param[in]  p_frame_data  Pointer to the parser data of the received frame.
+ * @param[in]  rssi          RSSI of the received frame in dBm.
+ * @param[in]  lqi           LQI of the received frame.
+ */
+void nrf_802154_link_quality_rx_frame_record(const nrf_802154_frame_parser_data_t * p_frame_data,
+                                             int8_t                                 rssi,
+                                             uint8_t                                lqi);
+
+/**
+ * @brief Gets the averaged link quality of the source of the last recorded frame.
+ *
+ * @param[out]  p_rssi  Pointer to the average RSSI in dBm.
+ * @param[out]  p_lqi   Pointer to the average LQI.
+ *
+ * @retval  true   The averages were written.
+ * @retval  false  The source of the last recorded frame is not tracked.
+ */
+bool nrf_802154_link_quality_last_peer_get(int8_t * p_rssi, uint8_t * p_lqi);
+
+/**
+ * @brief Reads the link quality of the tracked peers.
+ *
+ * @param[out]  p_entries  Pointer to the array to be filled with the link quality of the peers.
+ * @param[in]   count      Number of entries in @p p_entries.
+ *
+ * @return Number of entries written.
+ */
+uint8_t nrf_802154_link_quality_peers_read(nrf_802154_link_quality_t * p_entries, uint8_t count);
+
+#else // NRF_802154_LINK_QUALITY_PEERS_COUNT > 0
+
+static inline void nrf_802154_link_quality_init(void)
+{
+    // Intentionally empty
+}
+
+static inline void nrf_802154_link_quality_rx_frame_record(
+    const nrf_802154_frame_parser_data_t * p_frame_data,
+    int8_t                                 rssi,
+    uint8_t                                lqi)
+{
+    (void)p_frame_data;
+    (void)rssi;
+    (void)lqi;
+}
+
+static inline bool nrf_802154_link_quality_last_peer_get(int8_t * p_rssi, uint8_t * p_lqi)
+{
+    (void)p_rssi;
+    (void)p_lqi;
+
+    return false;
+}
+
+#endif // NRF_802154_LINK_QUALITY_PEERS_COUNT > 0
+
+#endif // NRF_802154_LINK_QUALITY_H__
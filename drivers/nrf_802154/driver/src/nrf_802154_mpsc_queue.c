@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Module implementing a lock-free multiple-producer single-consumer FIFO queue.
+ *
+ * The sequence number of a slot at position @c pos in the current lap of the queue is:
+ * - @c pos when the slot is free and can be reserved,
+ * - @c pos + 1 when the slot was published by a producer,
+ * - @c pos + 2 when the slot was consumed, but cannot be released yet, because an older slot
+ *   is still reserved by a preempted producer.
+ *
+ * Releasing the slot sets its sequence number to @c pos + capacity, which makes it free for
+ * the next lap of the queue.
+ */
+
+#include "nrf_802154_mpsc_queue.h"
+
+#include <assert.h>
+
+#include "nrf_802154_sl_atomics.h"
+
+#define SEQ_PUBLISHED_OFFSET 1U ///< Offset of the sequence number of a published slot.
+#define SEQ_CONSUMED_OFFSET  2U ///< Offset of the sequence number of a consumed slot.
+
+static inline uint32_t pos2idx(const nrf_802154_mpsc_queue_t * p_queue, uint32_t pos)
+{
+    return pos & (p_queue->capacity - 1U);
+}
+
+static inline void * pos2ptr(const nrf_802154_mpsc_queue_t * p_queue, uint32_t pos)
+{
+    return ((uint8_t *)(p_queue->p_memory)) + pos2idx(p_queue, pos) * p_queue->item_size;
+}
+
+void nrf_802154_mpsc_queue_init(nrf_802154_mpsc_queue_t * p_queue,
+                                void                    * p_memory,
+                                volatile uint32_t       * p_seq,
+                                size_t                    memory_size,
+                                size_t                    item_size)
+{
+    assert(p_queue != NULL);
+    assert(p_memory != NULL);
+    assert(p_seq != NULL);
+    assert(item_size != 0U);
+
+    /* Due uint8_t type of nrf_802154_mpsc_queue_t::item_size */
+    assert(item_size <= UINT8_MAX);
+
+    size_t capacity = memory_size / item_size;
+
+    /* Sequence numbers of free, published and consumed slots of consecutive laps must differ */
+    assert(capacity >= 4U);
+
+    /* Positions wrap around at UINT32_MAX, which must be a multiple of the capacity */
+    assert((capacity & (capacity - 1U)) == 0U);
+
+    /* Due uint8_t type of nrf_802154_mpsc_queue_t::capacity */
+    assert(capacity <= UINT8_MAX);
+
+    for (uint32_t i = 0U; i < capacity; i++)
+    {
+        p_seq[i] = i;
+    }
+
+    p_queue->p_memory  = p_memory;
+    p_queue->p_seq     = p_seq;
+    p_queue->capacity  = capacity;
+    p_queue->item_size = item_size;
+    p_queue->tail      = 0U;
+    p_queue->head      = 0U;
+}
+
+void * nrf_802154_mpsc_queue_push_try_begin(nrf_802154_mpsc_queue_t * p_queue, uint32_t * p_pos)
+{
+    uint32_t pos = nrf_802154_sl_atomic_load_u32((uint32_t *)&p_queue->tail);
+
+    while (true)
+    {
+        uint32_t seq = p_queue->p_seq[pos2idx(p_queue, pos)];
+        int32_t  dif = (int32_t)(seq - pos);
+
+        if (dif < 0)
+        {
+            /* The slot was not released in the previous lap yet */
+            return NULL;
+        }
+
+        if (dif > 0)
+        {
+            /* Another producer reserved the slot in the meantime */
+            pos = nrf_802154_sl_atomic_load_u32((uint32_t *)&p_queue->tail);
+        }
+        else if (nrf_802154_sl_atomic_cas_u32((uint32_t *)&p_queue->tail, &pos, pos + 1U))
+        {
+            *p_pos = pos;
+            return pos2ptr(p_queue, pos);
+        }
+        else
+        {
+            /* The CAS operation updated pos with the current tail. Try again */
+        }
+    }
+}
+
+void nrf_802154_mpsc_queue_push_commit(nrf_802154_mpsc_queue_t * p_queue, uint32_t pos)
+{
+    nrf_802154_sl_atomic_store_u32((uint32_t *)&p_queue->p_seq[pos2idx(p_queue, pos)],
+                                   pos + SEQ_PUBLISHED_OFFSET);
+}
+
+bool nrf_802154_mpsc_queue_is_consumed(const nrf_802154_mpsc_queue_t * p_queue, uint32_t pos)
+{
+    uint32_t seq = nrf_802154_sl_atomic_load_u32((uint32_t *)&p_queue->p_seq[pos2idx(p_queue,
+                                                                                      pos)]);
+
+    return seq != (pos + SEQ_PUBLISHED_OFFSET);
+}
+
+void * nrf_802154_mpsc_queue_pop_begin(const nrf_802154_mpsc_queue_t * p_queue, uint32_t * p_pos)
+{
+    uint32_t tail = nrf_802154_sl_atomic_load_u32((uint32_t *)&p_queue->tail);
+
+    for (uint32_t pos = p_queue->head; pos != tail; pos++)
+    {
+        if (p_queue->p_seq[pos2idx(p_queue, pos)] == (pos + SEQ_PUBLISHED_OFFSET))
+        {
+            *p_pos = pos;
+            return pos2ptr(p_queue, pos);
+        }
+    }
+
+    return NULL;
+}
+
+void nrf_802154_mpsc_queue_pop_commit(nrf_802154_mpsc_queue_t * p_queue, uint32_t pos)
+{
+    uint32_t head = p_queue->head;
+
+    assert(p_queue->p_seq[pos2idx(p_queue, pos)] == (pos + SEQ_PUBLISHED_OFFSET));
+
+    nrf_802154_sl_atomic_store_u32((uint32_t *)&p_queue->p_seq[pos2idx(p_queue, pos)],
+                                   pos + SEQ_CONSUMED_OFFSET);
+
+    /* Release the consumed slots in order of their reservation */
+    while (p_queue->p_seq[pos2idx(p_queue, head)] == (head + SEQ_CONSUMED_OFFSET))
+    {
+        nrf_802154_sl_atomic_store_u32((uint32_t *)&p_queue->p_seq[pos2idx(p_queue, head)],
+                                       head + p_queue->capacity);
+        head++;
+    }
+
+    p_queue->head = head;
+}
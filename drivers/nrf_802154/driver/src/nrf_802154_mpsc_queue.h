@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Module implementing a lock-free multiple-producer single-consumer FIFO queue.
+ *
+ * Producers reserve slots by atomically advancing the tail index of the queue, so that
+ * producers preempting each other never need a critical section. Every slot carries
+ * a sequence number telling whether the slot is free, reserved, published or consumed.
+ * This lets the consumer process published slots even if a slot reserved earlier by
+ * a preempted producer is not published yet. Slots are released in order of reservation.
+ */
+
+#ifndef NRF_802154_MPSC_QUEUE_H__
+#define NRF_802154_MPSC_QUEUE_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+/**@brief Type representing a multiple-producer single-consumer FIFO queue. */
+typedef struct
+{
+    /**@brief Pointer to items memory of the queue.
+     * @details Memory pointed by this pointer has size @c item_size * @c capacity. */
+    void             * p_memory;
+
+    /**@brief Pointer to sequence numbers of the items of the queue.
+     * @details Memory pointed by this pointer holds @c capacity sequence numbers. */
+    volatile uint32_t * p_seq;
+
+    /**@brief Size of an item in the queue. */
+    uint8_t            item_size;
+
+    /**@brief Maximum number of items that can be stored in the memory of the queue. */
+    uint8_t            capacity;
+
+    /**@brief Position of the next slot to be reserved by a producer. */
+    volatile uint32_t  tail;
+
+    /**@brief Position of the oldest slot that is not released yet. */
+    volatile uint32_t  head;
+} nrf_802154_mpsc_queue_t;
+
+/**@brief Initializes a multiple-producer single-consumer queue.
+ *
+ * @param[in] p_queue       Pointer to the queue instance to be initialized. Must not be NULL.
+ * @param[in] p_memory      Pointer to a memory that will be used to store items of the queue.
+ *                          Must not be NULL.
+ * @param[in] p_seq         Pointer to a memory that will be used to store sequence numbers
+ *                          of the items of the queue. It must hold as many @c uint32_t values
+ *                          as there are items fitting in @p p_memory. Must not be NULL.
+ * @param[in] memory_size   Size of the memory pointed by @p p_memory. The number of items
+ *                          fitting in the memory must be a power of two no less than 4.
+ * @param[in] item_size     Size of an item of the queue. Must not be 0.
+ */
+void nrf_802154_mpsc_queue_init(nrf_802154_mpsc_queue_t * p_queue,
+                                void                    * p_memory,
+                                volatile uint32_t       * p_seq,
+                                size_t                    memory_size,
+                                size_t                    item_size);
+
+/**@brief Reserves the next slot of the queue to be written by a producer.
+ *
+ * This function never blocks and can be called concurrently from contexts preempting each other.
+ *
+ * @param[in]  p_queue  Pointer to the queue instance.
+ * @param[out] p_pos    Position of the reserved slot, to be passed to
+ *                      @ref nrf_802154_mpsc_queue_push_commit.
+ *
+ * @return  Pointer to the reserved slot or NULL if the queue is full.
+ */
+void * nrf_802154_mpsc_queue_push_try_begin(nrf_802154_mpsc_queue_t * p_queue, uint32_t * p_pos);
+
+/**@brief Publishes a slot reserved with @ref nrf_802154_mpsc_queue_push_try_begin to the consumer.
+ *
+ * @param[in] p_queue  Pointer to the queue instance.
+ * @param[in] pos      Position of the slot returned by @ref nrf_802154_mpsc_queue_push_try_begin.
+ */
+void nrf_802154_mpsc_queue_push_commit(nrf_802154_mpsc_queue_t * p_queue, uint32_t pos);
+
+/**@brief Checks if a published slot was already processed by the consumer.
+ *
+ * @param[in] p_queue  Pointer to the queue instance.
+ * @param[in] pos      Position of a slot published with @ref nrf_802154_mpsc_queue_push_commit.
+ *
+ * @retval true   The consumer called @ref nrf_802154_mpsc_queue_pop_commit for the slot.
+ * @retval false  The slot is still waiting for the consumer.
+ */
+bool nrf_802154_mpsc_queue_is_consumed(const nrf_802154_mpsc_queue_t * p_queue, uint32_t pos);
+
+/**@brief Returns pointer to the oldest published slot that was not consumed yet.
+ *
+ * Slots reserved but not yet published by preempted producers are skipped.
+ * This function must be called from the consumer context only.
+ *
+ * @param[in]  p_queue  Pointer to the queue instance.
+ * @param[out] p_pos    Position of the returned slot, to be passed to
+ *                      @ref nrf_802154_mpsc_queue_pop_commit.
+ *
+ * @return  Pointer to the slot or NULL if there is no published slot waiting for the consumer.
+ */
+void * nrf_802154_mpsc_queue_pop_begin(const nrf_802154_mpsc_queue_t * p_queue, uint32_t * p_pos);
+
+/**@brief Marks a slot returned by @ref nrf_802154_mpsc_queue_pop_begin as consumed.
+ *
+ * This function must be called from the consumer context only.
+ *
+ * @param[in] p_queue  Pointer to the queue instance.
+ * @param[in] pos      Position of the slot returned by @ref nrf_802154_mpsc_queue_pop_begin.
+ */
+void nrf_802154_mpsc_queue_pop_commit(nrf_802154_mpsc_queue_t * p_queue, uint32_t pos);
+
+#endif /* NRF_802154_MPSC_QUEUE_H__ */
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the monitoring of the noise floor of the channel.
+ *
+ * The RSSI of the channel is sampled periodically while the driver is in the receive state and no
+ * frame is being received. The samples are accumulated in the statistics window and, if enabled,
+ * in a rolling noise floor estimate of each channel, from which the CCA ED threshold is derived.
+ *
+ */
+
+#include "nrf_802154_noise_monitor.h"
+
+#if NRF_802154_NOISE_MONITOR_ENABLED
+
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_802154_core.h"
+#include "nrf_802154_nrfx_addons.h"
+#include "nrf_802154_pib.h"
+#include "nrf_802154_stats.h"
+#include "nrf_802154_sl_timer.h"
+
+#if !NRF_802154_STAT_WINDOW_ENABLED
+#error "The noise monitor requires NRF_802154_STAT_WINDOW_ENABLED"
+#endif
+
+static nrf_802154_sl_timer_t m_sample_timer; ///< Timer triggering the RSSI samples.
+
+#if NRF_802154_CCA_ED_CALIBRATION_ENABLED
+
+#define NOISE_FLOOR_CHANNEL_COUNT  16U ///< Number of channels with a noise floor estimate.
+#define NOISE_FLOOR_FRACTION_SHIFT 4U  ///< Number of fractional bits of the noise floor estimate.
+
+static int32_t m_noise_floor[NOISE_FLOOR_CHANNEL_COUNT];       ///< Noise floor estimates, in 1/16 dBm.
+static bool    m_noise_floor_valid[NOISE_FLOOR_CHANNEL_COUNT]; ///< If the channel has been sampled.
+static uint8_t m_ed_threshold[NOISE_FLOOR_CHANNEL_COUNT];      ///< CCA ED thresholds derived from the estimates.
+static uint8_t m_applied_channel;                              ///< Channel of the last applied threshold.
+static uint8_t m_applied_ed_threshold;                         ///< Last applied threshold.
+
+/**
+ * @brief Updates the noise floor estimate of a channel and applies the derived CCA ED threshold.
+ *
+ * @param[in]  channel  Channel the sample was taken on.
+ * @param[in]  rssi     RSSI sample of the idle channel, in dBm.
+ */
+static void noise_floor_update(uint8_t channel, int8_t rssi)
+{
+    uint8_t idx    = channel - 11U;
+    int32_t sample = (int32_t)rssi * (1 << NOISE_FLOOR_FRACTION_SHIFT);
+
+    if (m_noise_floor_valid[idx])
+    {
+        m_noise_floor[idx] += (sample - m_noise_floor[idx]) /
+                              (1 << NRF_802154_CCA_ED_CALIBRATION_WEIGHT_SHIFT);
+    }
+    else
+    {
+        m_noise_floor[idx] = sample;
+    }
+
+    int32_t threshold = m_noise_floor[idx] / (1 << NOISE_FLOOR_FRACTION_SHIFT) +
+                        NRF_802154_CCA_ED_CALIBRATION_MARGIN_DB - ED_RSSIOFFS;
+
+    threshold = (threshold < 0) ? 0 : ((threshold > UINT8_MAX) ? UINT8_MAX : threshold);
+
+    m_ed_threshold[idx]      = (uint8_t)threshold;
+    m_noise_floor_valid[idx] = true;
+    nrf_802154_stat_congestion_ed_threshold_write(channel, (uint32_t)threshold);
+
+    // The threshold is also reapplied after a channel switch, as the RADIO still holds the one
+    // of the previous channel.
+    if ((channel != m_applied_channel) || (m_ed_threshold[idx] != m_applied_ed_threshold))
+    {
+        if (nrf_802154_core_cca_cfg_update())
+        {
+            m_applied_channel      = channel;
+            m_applied_ed_threshold = m_ed_threshold[idx];
+        }
+    }
+}
+
+bool nrf_802154_noise_monitor_cca_ed_threshold_get(uint8_t channel, uint8_t * p_ed_threshold)
+{
+    uint8_t idx = channel - 11U;
+
+    if ((idx >= NOISE_FLOOR_CHANNEL_COUNT) || !m_noise_floor_valid[idx])
+    {
+        return false;
+    }
+
+    *p_ed_threshold = m_ed_threshold[idx];
+    return true;
+}
+
+#endif // NRF_802154_CCA_ED_CALIBRATION_ENABLED
+
+/**
+ * @brief Schedules the next RSSI sample.
+ *
+ * @param[in]  now  Current time.
+ */
+static void sample_schedule(uint64_t now)
+{
+    nrf_802154_sl_timer_ret_t ret;
+
+    m_sample_timer.trigger_time = now + NRF_802154_NOISE_MONITOR_PERIOD_US;
+
+    ret = nrf_802154_sl_timer_add(&m_sample_timer);
+    assert(ret == NRF_802154_SL_TIMER_RET_SUCCESS);
+    (void)ret;
+}
+
+/**
+ * @brief Takes an RSSI sample of the idle channel and schedules the next one.
+ *
+ * @param[in]  p_timer  Not used.
+ */
+static void sample_timer_handle(nrf_802154_sl_timer_t * p_timer)
+{
+    (void)p_timer;
+
+    int8_t rssi;
+
+    if (nrf_802154_core_idle_rssi_sample(&rssi))
+    {
+        nrf_802154_stat_window_noise_record(rssi);
+#if NRF_802154_CCA_ED_CALIBRATION_ENABLED
+        noise_floor_update(nrf_802154_pib_channel_get(), rssi);
+#endif
+    }
+
+    sample_schedule(m_sample_timer.trigger_time);
+}
+
+void nrf_802154_noise_monitor_init(void)
+{
+#if NRF_802154_CCA_ED_CALIBRATION_ENABLED
+    memset(m_noise_floor_valid, 0, sizeof(m_noise_floor_valid));
+    m_applied_channel = 0U;
+#endif
+
+    nrf_802154_sl_timer_init(&m_sample_timer);
+
+    m_sample_timer.action_type              = NRF_802154_SL_TIMER_ACTION_TYPE_CALLBACK;
+    m_sample_timer.action.callback.callback = sample_timer_handle;
+
+    sample_schedule(nrf_802154_sl_timer_current_time_get());
+}
+
+void nrf_802154_noise_monitor_deinit(void)
+{
+    (void)nrf_802154_sl_timer_remove(&m_sample_timer);
+    nrf_802154_sl_timer_deinit(&m_sample_timer);
+}
+
+#endif // NRF_802154_NOISE_MONITOR_ENABLED
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Module that monitors the noise floor of the channel while the receiver is idle.
+ *
+ */
+
+#ifndef NRF_802154_NOISE_MONITOR_H__
+#define NRF_802154_NOISE_MONITOR_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+
+#if NRF_802154_CCA_ED_CALIBRATION_ENABLED && !NRF_802154_NOISE_MONITOR_ENABLED
+#error "The CCA ED calibration requires NRF_802154_NOISE_MONITOR_ENABLED"
+#endif
+
+#if NRF_802154_NOISE_MONITOR_ENABLED
+
+/**
+ * @brief Initializes the noise monitor and starts the periodic RSSI sampling.
+ */
+void nrf_802154_noise_monitor_init(void);
+
+/**
+ * @brief Deinitializes the noise monitor and stops the periodic RSSI sampling.
+ */
+void nrf_802154_noise_monitor_deinit(void);
+
+#if NRF_802154_CCA_ED_CALIBRATION_ENABLED
+
+/**
+ * @brief Gets the CCA ED threshold derived from the noise floor of a channel.
+ *
+ * @param[in]   channel         Channel number, from 11 to 26.
+ * @param[out]  p_ed_threshold  Threshold in the units of @ref nrf_802154_cca_cfg_t::ed_threshold.
+ *                              Not modified if the channel has not been sampled yet.
+ *
+ * @retval  true   The threshold of the channel is available.
+ * @retval  false  The channel has not been sampled yet.
+ */
+bool nrf_802154_noise_monitor_cca_ed_threshold_get(uint8_t channel, uint8_t * p_ed_threshold);
+
+#endif // NRF_802154_CCA_ED_CALIBRATION_ENABLED
+
+#else // NRF_802154_NOISE_MONITOR_ENABLED
+
+static inline void nrf_802154_noise_monitor_init(void)
+{
+    // Intentionally empty
+}
+
+static inline void nrf_802154_noise_monitor_deinit(void)
+{
+    // Intentionally empty
+}
+
+#endif // NRF_802154_NOISE_MONITOR_ENABLED
+
+#endif // NRF_802154_NOISE_MONITOR_H__
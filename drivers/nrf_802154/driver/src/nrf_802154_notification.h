@@ -126,6 +126,18 @@ void nrf_802154_notify_transmit_failed(uint8_t
  */
 void nrf_802154_notify_energy_detected(uint8_t result);
 
+/**
+ * @brief Notifies the next higher layer that the energy scan procedure ended.
+ *
+ * @param[in]  channel_mask   Mask of the scanned channels.
+ * @param[in]  p_results      Pointer to detected energy levels, one for each scanned channel
+ *                            in order of increasing channel numbers.
+ * @param[in]  results_count  Number of detected energy levels.
+ */
+void nrf_802154_notify_energy_scan_done(uint32_t        channel_mask,
+                                        const uint8_t * p_results,
+                                        uint8_t         results_count);
+
 /**
  * @brief Notifies the next higher layer that the energy detection procedure failed.
  *
@@ -134,6 +134,17 @@ void nrf_802154_notify_energy_detected(uint8_t result)
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
+void nrf_802154_notify_energy_scan_done(uint32_t        channel_mask,
+                                        const uint8_t * p_results,
+                                        uint8_t         results_count)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    nrf_802154_energy_scan_done(channel_mask, p_results, results_count);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+}
+
 void nrf_802154_notify_energy_detection_failed(nrf_802154_ed_error_t error)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
@@ -46,11 +46,13 @@
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "nrf_802154.h"
 #include "nrf_802154_config.h"
 #include "nrf_802154_debug.h"
 #include "nrf_802154_queue.h"
+#include "nrf_802154_stats.h"
 #include "nrf_802154_swi.h"
 #include "nrf_802154_tx_work_buffer.h"
 #include "nrf_802154_utils.h"
@@ -106,11 +108,18 @@
  */
 #define NTF_INVALID_SLOT_ID        UINT8_MAX
 
-/** @brief Size of notification queue.
+/** @brief Size of the queue of high priority notifications.
  *
+ * High priority notifications are allocated from the primary pool only.
  * One slot is lost due to simplified queue implementation.
  */
-#define NTF_QUEUE_SIZE             (NTF_PRIMARY_POOL_SIZE + NTF_SECONDARY_POOL_SIZE + 1)
+#define NTF_HIGH_QUEUE_SIZE        (NTF_PRIMARY_POOL_SIZE + 1)
+
+/** @brief Size of the queue of low priority notifications.
+ *
+ * One slot is lost due to simplified queue implementation.
+ */
+#define NTF_LOW_QUEUE_SIZE         (NTF_PRIMARY_POOL_SIZE + NTF_SECONDARY_POOL_SIZE + 1)
 
 #define NTF_INT                    NRF_EGU_INT_TRIGGERED0   ///< Label of notification interrupt.
 #define NTF_TASK                   NRF_EGU_TASK_TRIGGER0    ///< Label of notification task.
@@ -125,10 +134,18 @@ typedef enum
     NTF_TYPE_TRANSMIT_FAILED,         ///< Frame transmission failure
     NTF_TYPE_ENERGY_DETECTED,         ///< Energy detection procedure ended
     NTF_TYPE_ENERGY_DETECTION_FAILED, ///< Energy detection procedure failed
+    NTF_TYPE_ENERGY_SCAN_DONE,        ///< Energy scan procedure ended
     NTF_TYPE_CCA,                     ///< CCA procedure ended
     NTF_TYPE_CCA_FAILED,              ///< CCA procedure failed
 } nrf_802154_ntf_type_t;
 
+/// Priority lanes of the notification queue.
+typedef enum
+{
+    NTF_LANE_HIGH, ///< Results of transmissions, energy detections and CCA procedures.
+    NTF_LANE_LOW,  ///< Results of receptions.
+} nrf_802154_ntf_lane_t;
+
 /// Notification data in the notification queue.
 typedef struct
 {
@@ -173,6 +190,13 @@ typedef struct
             nrf_802154_ed_error_t error; ///< An error code that indicates reason of the failure.
         } energy_detection_failed;       ///< Energy detection failure details.
 
+        struct
+        {
+            uint32_t channel_mask;                                 ///< Mask of scanned channels.
+            uint8_t  results_count;                                ///< Number of valid results.
+            uint8_t  results[NRF_802154_ENERGY_SCAN_CHANNELS_MAX]; ///< Energy detected on the scanned channels.
+        } energy_scan_done;                                        ///< Energy scan details.
+
         struct
         {
             bool result; ///< CCA result.
@@ -194,8 +218,10 @@ typedef struct
 static nrf_802154_ntf_data_t m_primary_ntf_pool[NTF_PRIMARY_POOL_SIZE];
 static nrf_802154_ntf_data_t m_secondary_ntf_pool[NTF_SECONDARY_POOL_SIZE];
 
-static nrf_802154_queue_t       m_notifications_queue;
-static nrf_802154_queue_entry_t m_notifications_queue_memory[NTF_QUEUE_SIZE];
+static nrf_802154_queue_t       m_high_notifications_queue;
+static nrf_802154_queue_entry_t m_high_notifications_queue_memory[NTF_HIGH_QUEUE_SIZE];
+static nrf_802154_queue_t       m_low_notifications_queue;
+static nrf_802154_queue_entry_t m_low_notifications_queue_memory[NTF_LOW_QUEUE_SIZE];
 
 static volatile nrf_802154_mcu_critical_state_t m_mcu_cs;
 
@@ -249,21 +275,43 @@ static void ntf_slot_free(nrf_802154_ntf_data_t * p_slot)
     p_slot->taken = false;
 }
 
+/** @brief Update the low watermark of free entries in a notification queue.
+ *
+ * @param[in]  lane  Priority lane of the queue.
+ */
+static void ntf_queue_watermark_update(nrf_802154_ntf_lane_t lane)
+{
+    if (lane == NTF_LANE_HIGH)
+    {
+        nrf_802154_stat_watermark_low_update(
+            ntf_high_queue_free_min,
+            (NTF_HIGH_QUEUE_SIZE - 1U) - nrf_802154_queue_count(&m_high_notifications_queue));
+    }
+    else
+    {
+        nrf_802154_stat_watermark_low_update(
+            ntf_low_queue_free_min,
+            (NTF_LOW_QUEUE_SIZE - 1U) - nrf_802154_queue_count(&m_low_notifications_queue));
+    }
+}
+
 /**
  * Enter notify block.
  *
  * This is a helper function used in all notification functions to atomically
  * find an empty slot in the notification queue and allow atomic slot update.
  *
+ * @param[in]  p_queue  Pointer to the queue of the priority lane of the notification.
+ *
  * @return Pointer to an empty slot in the notification queue.
  */
-static nrf_802154_queue_entry_t * ntf_enter(void)
+static nrf_802154_queue_entry_t * ntf_enter(nrf_802154_queue_t * p_queue)
 {
     nrf_802154_mcu_critical_enter(m_mcu_cs);
 
-    assert(!nrf_802154_queue_is_full(&m_notifications_queue));
+    assert(!nrf_802154_queue_is_full(p_queue));
 
-    return nrf_802154_queue_push_begin(&m_notifications_queue);
+    return nrf_802154_queue_push_begin(p_queue);
 }
 
 /**
@@ -271,10 +319,15 @@ static nrf_802154_queue_entry_t * ntf_enter(void)
  *
  * This is a helper function used in all notification functions to end atomic slot update
  * and trigger SWI to process the notification from the slot.
+ *
+ * @param[in]  p_queue  Pointer to the queue of the priority lane of the notification.
+ * @param[in]  lane     Priority lane of the notification.
  */
-static void ntf_exit(void)
+static void ntf_exit(nrf_802154_queue_t * p_queue, nrf_802154_ntf_lane_t lane)
 {
-    nrf_802154_queue_push_commit(&m_notifications_queue);
+    nrf_802154_queue_push_commit(p_queue);
+
+    ntf_queue_watermark_update(lane);
 
     nrf_egu_task_trigger(NRF_802154_EGU_INSTANCE, NTF_TASK);
 
@@ -284,13 +337,17 @@ static void ntf_exit(void)
 /** @brief Push notification to the queue.
  *
  * @param[in]  slot_id  Identifier of the pool and a slot within.
+ * @param[in]  lane     Priority lane of the notification.
  */
-static void ntf_push(uint8_t slot_id)
+static void ntf_push(uint8_t slot_id, nrf_802154_ntf_lane_t lane)
 {
-    nrf_802154_queue_entry_t * p_entry = ntf_enter();
+    nrf_802154_queue_t * p_queue = (lane == NTF_LANE_HIGH) ?
+                                   &m_high_notifications_queue : &m_low_notifications_queue;
+
+    nrf_802154_queue_entry_t * p_entry = ntf_enter(p_queue);
 
     p_entry->id = slot_id;
-    ntf_exit();
+    ntf_exit(p_queue, lane);
 }
 
 /**
@@ -322,7 +379,7 @@ bool swi_notify_received(uint8_t * p_data, int8_t power, uint8_t lqi)
     p_slot->data.received.power  = power;
     p_slot->data.received.lqi    = lqi;
 
-    ntf_push(slot_id | NTF_PRIMARY_POOL_ID_MASK);
+    ntf_push(slot_id | NTF_PRIMARY_POOL_ID_MASK, NTF_LANE_LOW);
 
     return true;
 }
@@ -370,7 +427,7 @@ bool swi_notify_receive_failed(nrf_802154_rx_error_t error, uint32_t id, bool al
     p_slot->data.receive_failed.error = error;
     p_slot->data.receive_failed.id    = id;
 
-    ntf_push(slot_id | pool_id_bitmask);
+    ntf_push(slot_id | pool_id_bitmask, NTF_LANE_LOW);
 
     return true;
 }
@@ -403,7 +460,7 @@ bool swi_notify_transmitted(uint8_t                             * p_frame,
     p_slot->data.transmitted.p_frame  = p_frame;
     p_slot->data.transmitted.metadata = *p_metadata;
 
-    ntf_push(slot_id | NTF_PRIMARY_POOL_ID_MASK);
+    ntf_push(slot_id | NTF_PRIMARY_POOL_ID_MASK, NTF_LANE_HIGH);
 
     return true;
 }
@@ -439,7 +496,7 @@ bool swi_notify_transmit_failed(uint8_t                                   * p_fr
     p_slot->data.transmit_failed.error    = error;
     p_slot->data.transmit_failed.metadata = *p_metadata;
 
-    ntf_push(slot_id | NTF_PRIMARY_POOL_ID_MASK);
+    ntf_push(slot_id | NTF_PRIMARY_POOL_ID_MASK, NTF_LANE_HIGH);
 
     return true;
 }
@@ -468,7 +525,44 @@ bool swi_notify_energy_detected(uint8_t result)
     p_slot->type                        = NTF_TYPE_ENERGY_DETECTED;
     p_slot->data.energy_detected.result = result;
 
-    ntf_push(slot_id | NTF_PRIMARY_POOL_ID_MASK);
+    ntf_push(slot_id | NTF_PRIMARY_POOL_ID_MASK, NTF_LANE_HIGH);
+
+    return true;
+}
+
+/**
+ * @brief Notifies the next higher layer that the energy scan procedure ended from
+ * the SWI priority level.
+ *
+ * @param[in]  channel_mask   Mask of scanned channels.
+ * @param[in]  p_results      Energy levels detected on the scanned channels.
+ * @param[in]  results_count  Number of elements in @p p_results.
+ *
+ * @retval  true   Notification enqueued successfully.
+ * @retval  false  Notification could not be performed.
+ */
+bool swi_notify_energy_scan_done(uint32_t        channel_mask,
+                                 const uint8_t * p_results,
+                                 uint8_t         results_count)
+{
+    assert(results_count <= NRF_802154_ENERGY_SCAN_CHANNELS_MAX);
+
+    uint8_t slot_id = ntf_slot_alloc(m_primary_ntf_pool, NTF_PRIMARY_POOL_SIZE);
+
+    if (slot_id == NTF_INVALID_SLOT_ID)
+    {
+        // No slots are available.
+        return false;
+    }
+
+    nrf_802154_ntf_data_t * p_slot = &m_primary_ntf_pool[slot_id];
+
+    p_slot->type                                = NTF_TYPE_ENERGY_SCAN_DONE;
+    p_slot->data.energy_scan_done.channel_mask  = channel_mask;
+    p_slot->data.energy_scan_done.results_count = results_count;
+    memcpy(p_slot->data.energy_scan_done.results, p_results, results_count);
+
+    ntf_push(slot_id | NTF_PRIMARY_POOL_ID_MASK, NTF_LANE_HIGH);
 
     return true;
 }
@@ -497,7 +591,7 @@ bool swi_notify_energy_detection_failed(nrf_802154_ed_error_t error)
     p_slot->type                               = NTF_TYPE_ENERGY_DETECTION_FAILED;
     p_slot->data.energy_detection_failed.error = error;
 
-    ntf_push(slot_id | NTF_PRIMARY_POOL_ID_MASK);
+    ntf_push(slot_id | NTF_PRIMARY_POOL_ID_MASK, NTF_LANE_HIGH);
 
     return true;
 }
@@ -527,7 +621,7 @@ bool swi_notify_cca(bool channel_free)
     p_slot->type            = NTF_TYPE_CCA;
     p_slot->data.cca.result = channel_free;
 
-    ntf_push(slot_id | NTF_PRIMARY_POOL_ID_MASK);
+    ntf_push(slot_id | NTF_PRIMARY_POOL_ID_MASK, NTF_LANE_HIGH);
 
     return true;
 }
@@ -557,17 +651,24 @@ bool swi_notify_cca_failed(nrf_802154_cca_error_t error)
     p_slot->type                  = NTF_TYPE_CCA_FAILED;
     p_slot->data.cca_failed.error = error;
 
-    ntf_push(slot_id | NTF_PRIMARY_POOL_ID_MASK);
+    ntf_push(slot_id | NTF_PRIMARY_POOL_ID_MASK, NTF_LANE_HIGH);
 
     return true;
 }
 
 void nrf_802154_notification_init(void)
 {
-    nrf_802154_queue_init(&m_notifications_queue,
-                          m_notifications_queue_memory,
-                          sizeof(m_notifications_queue_memory),
-                          sizeof(m_notifications_queue_memory[0]));
+    nrf_802154_queue_init(&m_high_notifications_queue,
+                          m_high_notifications_queue_memory,
+                          sizeof(m_high_notifications_queue_memory),
+                          sizeof(m_high_notifications_queue_memory[0]));
+    nrf_802154_queue_init(&m_low_notifications_queue,
+                          m_low_notifications_queue_memory,
+                          sizeof(m_low_notifications_queue_memory),
+                          sizeof(m_low_notifications_queue_memory[0]));
+
+    nrf_802154_stat_watermark_write(ntf_high_queue_free_min, NTF_HIGH_QUEUE_SIZE - 1U);
+    nrf_802154_stat_watermark_write(ntf_low_queue_free_min, NTF_LOW_QUEUE_SIZE - 1U);
 
     nrf_egu_int_enable(NRF_802154_EGU_INSTANCE, NTF_INT);
 
@@ -644,6 +745,21 @@ void nrf_802154_notify_energy_detected(uint8_t result)
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
+void nrf_802154_notify_energy_scan_done(uint32_t        channel_mask,
+                                       const uint8_t * p_results,
+                                       uint8_t         results_count)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    bool notified = swi_notify_energy_scan_done(channel_mask, p_results, results_count);
+
+    // It should always be possible to notify energy scan result
+    assert(notified);
+    (void)notified;
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+}
+
 void nrf_802154_notify_energy_detection_failed(nrf_802154_ed_error_t error)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
@@ -683,15 +799,49 @@ void nrf_802154_notify_cca_failed(nrf_802154_cca_error_t error)
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
+/** @brief Select the queue from which the next notification is to be processed.
+ *
+ * Notifications of the high priority lane are processed before any pending notification
+ * of the low priority lane.
+ *
+ * @return  Pointer to the queue or NULL if no notification is pending.
+ */
+static nrf_802154_queue_t * ntf_queue_to_process_get(void)
+{
+    if (!nrf_802154_queue_is_empty(&m_high_notifications_queue))
+    {
+        return &m_high_notifications_queue;
+    }
+
+    if (!nrf_802154_queue_is_empty(&m_low_notifications_queue))
+    {
+        return &m_low_notifications_queue;
+    }
+
+    return NULL;
+}
+
 /**@brief Handles NTF_EVENT on NRF_802154_EGU_INSTANCE */
 static void irq_handler_ntf_event(void)
 {
+    nrf_802154_queue_t * p_queue;
+    uint32_t             processed = 0U;
+
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
-    while (!nrf_802154_queue_is_empty(&m_notifications_queue))
+    while ((p_queue = ntf_queue_to_process_get()) != NULL)
     {
+#if NRF_802154_NOTIFICATION_SWI_BUDGET
+        if (processed >= NRF_802154_NOTIFICATION_SWI_BUDGET)
+        {
+            // Let other handlers of this priority run before the remaining notifications
+            nrf_egu_task_trigger(NRF_802154_EGU_INSTANCE, NTF_TASK);
+            break;
+        }
+#endif
+
         nrf_802154_queue_entry_t * p_entry =
-            (nrf_802154_queue_entry_t *)nrf_802154_queue_pop_begin(&m_notifications_queue);
+            (nrf_802154_queue_entry_t *)nrf_802154_queue_pop_begin(p_queue);
 
         uint8_t slot_id = p_entry->id & (~NTF_POOL_ID_MASK);
 
@@ -759,6 +909,12 @@ static void irq_handler_ntf_event(void)
                     p_slot->data.energy_detection_failed.error);
                 break;
 
+            case NTF_TYPE_ENERGY_SCAN_DONE:
+                nrf_802154_energy_scan_done(p_slot->data.energy_scan_done.channel_mask,
+                                            p_slot->data.energy_scan_done.results,
+                                            p_slot->data.energy_scan_done.results_count);
+                break;
+
             case NTF_TYPE_CCA:
                 nrf_802154_cca_done(p_slot->data.cca.result);
                 break;
@@ -771,10 +927,13 @@ static void irq_handler_ntf_event(void)
                 assert(false);
         }
 
-        nrf_802154_queue_pop_commit(&m_notifications_queue);
+        nrf_802154_queue_pop_commit(p_queue);
         ntf_slot_free(p_slot);
+        processed++;
     }
 
+    (void)processed;
+
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
@@ -792,8 +951,10 @@ void nrf_802154_notification_swi_irq_handler(void)
 void nrf_802154_notification_swi_module_reset(void)
 {
     m_mcu_cs = 0UL;
-    memset(&m_notifications_queue_memory, 0U, sizeof(m_notifications_queue_memory));
-    memset(&m_notifications_queue, 0U, sizeof(m_notifications_queue));
+    memset(&m_high_notifications_queue_memory, 0U, sizeof(m_high_notifications_queue_memory));
+    memset(&m_high_notifications_queue, 0U, sizeof(m_high_notifications_queue));
+    memset(&m_low_notifications_queue_memory, 0U, sizeof(m_low_notifications_queue_memory));
+    memset(&m_low_notifications_queue, 0U, sizeof(m_low_notifications_queue));
 }
 
 #endif // defined(TEST)
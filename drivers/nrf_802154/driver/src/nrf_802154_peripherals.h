@@ -149,13 +149,103 @@ extern "C" {
 #define NRF_802154_RTC_USED_MASK (1 << NRF_802154_RTC_INSTANCE_NO)
 #endif
 
+#if NRF_802154_RADIO_TRACE_ENABLED
+
+/**
+ * @def NRF_802154_RADIO_TRACE_PIN_READY
+ *
+ * The GPIO pin toggled on the RADIO READY event when the radio trace is enabled.
+ *
+ */
+#ifndef NRF_802154_RADIO_TRACE_PIN_READY
+#define NRF_802154_RADIO_TRACE_PIN_READY 13
+#endif
+
+/**
+ * @def NRF_802154_RADIO_TRACE_PIN_ADDRESS
+ *
+ * The GPIO pin toggled on the RADIO ADDRESS event when the radio trace is enabled.
+ *
+ */
+#ifndef NRF_802154_RADIO_TRACE_PIN_ADDRESS
+#define NRF_802154_RADIO_TRACE_PIN_ADDRESS 14
+#endif
+
+/**
+ * @def NRF_802154_RADIO_TRACE_PIN_END
+ *
+ * The GPIO pin toggled on the RADIO END event when the radio trace is enabled.
+ *
+ */
+#ifndef NRF_802154_RADIO_TRACE_PIN_END
+#define NRF_802154_RADIO_TRACE_PIN_END 11
+#endif
+
+/**
+ * @def NRF_802154_RADIO_TRACE_PIN_PHYEND
+ *
+ * The GPIO pin toggled on the RADIO PHYEND event when the radio trace is enabled.
+ *
+ */
+#ifndef NRF_802154_RADIO_TRACE_PIN_PHYEND
+#define NRF_802154_RADIO_TRACE_PIN_PHYEND 24
+#endif
+
+/**
+ * @def NRF_802154_RADIO_TRACE_PIN_CCABUSY
+ *
+ * The GPIO pin toggled on the RADIO CCABUSY event when the radio trace is enabled.
+ *
+ */
+#ifndef NRF_802154_RADIO_TRACE_PIN_CCABUSY
+#define NRF_802154_RADIO_TRACE_PIN_CCABUSY 25
+#endif
+
+/**
+ * @def NRF_802154_RADIO_TRACE_PIN_DISABLED
+ *
+ * The GPIO pin toggled on the RADIO DISABLED event when the radio trace is enabled.
+ *
+ */
+#ifndef NRF_802154_RADIO_TRACE_PIN_DISABLED
+#define NRF_802154_RADIO_TRACE_PIN_DISABLED 12
+#endif
+
+/**
+ * @def NRF_802154_RADIO_TRACE_GPIOTE_CHANNEL_FIRST
+ *
+ * The first of the six consecutive GPIOTE channels that toggle the trace pins.
+ *
+ */
+#ifndef NRF_802154_RADIO_TRACE_GPIOTE_CHANNEL_FIRST
+#define NRF_802154_RADIO_TRACE_GPIOTE_CHANNEL_FIRST 0
+#endif
+
+#define NRF_802154_RADIO_TRACE_PINS_USED_MASK            ((1UL << NRF_802154_RADIO_TRACE_PIN_READY) |   \
+                                                          (1UL << NRF_802154_RADIO_TRACE_PIN_ADDRESS) | \
+                                                          (1UL << NRF_802154_RADIO_TRACE_PIN_END) |     \
+                                                          (1UL << NRF_802154_RADIO_TRACE_PIN_PHYEND) |  \
+                                                          (1UL << NRF_802154_RADIO_TRACE_PIN_CCABUSY) | \
+                                                          (1UL << NRF_802154_RADIO_TRACE_PIN_DISABLED))
+
+#define NRF_802154_RADIO_TRACE_GPIOTE_CHANNELS_USED_MASK \
+    (0x3FUL << NRF_802154_RADIO_TRACE_GPIOTE_CHANNEL_FIRST)
+
+#else // NRF_802154_RADIO_TRACE_ENABLED
+
+#define NRF_802154_RADIO_TRACE_PINS_USED_MASK            0
+#define NRF_802154_RADIO_TRACE_GPIOTE_CHANNELS_USED_MASK 0
+
+#endif // NRF_802154_RADIO_TRACE_ENABLED
+
 /**
  * @def NRF_802154_GPIO_PINS_USED_MASK
  *
  * Bit mask of GPIO pins used by the 802.15.4 driver.
  */
 #ifndef NRF_802154_GPIO_PINS_USED_MASK
-#define NRF_802154_GPIO_PINS_USED_MASK NRF_802154_DEBUG_PINS_USED_MASK
+#define NRF_802154_GPIO_PINS_USED_MASK (NRF_802154_DEBUG_PINS_USED_MASK | \
+                                        NRF_802154_RADIO_TRACE_PINS_USED_MASK)
 #endif // NRF_802154_GPIO_PINS_USED_MASK
 
 /**
@@ -164,7 +254,8 @@ extern "C" {
  * Bit mask of GPIOTE peripherals used by the 802.15.4 driver.
  */
 #ifndef NRF_802154_GPIOTE_CHANNELS_USED_MASK
-#define NRF_802154_GPIOTE_CHANNELS_USED_MASK NRF_802154_DEBUG_GPIOTE_CHANNELS_USED_MASK
+#define NRF_802154_GPIOTE_CHANNELS_USED_MASK (NRF_802154_DEBUG_GPIOTE_CHANNELS_USED_MASK | \
+                                              NRF_802154_RADIO_TRACE_GPIOTE_CHANNELS_USED_MASK)
 #endif // NRF_802154_GPIOTE_CHANNELS_USED_MASK
 
 #ifdef __cplusplus
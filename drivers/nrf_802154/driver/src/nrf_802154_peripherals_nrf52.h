@@ -171,8 +171,9 @@ extern "C" {
  * The PPI channel that connects RADIO_CRCERROR event to TIMER_CLEAR task.
  *
  * @note This option is used by the core module regardless of the driver configuration.
- *       The peripheral is shared with @ref NRF_802154_PPI_RADIO_CCAIDLE_TO_FEM_GPIOTE
- *       and @ref NRF_802154_PPI_TIMER_COMPARE_TO_RADIO_TXEN.
+ *       The peripheral is shared with @ref NRF_802154_PPI_RADIO_CCAIDLE_TO_FEM_GPIOTE,
+ *       @ref NRF_802154_PPI_TIMER_COMPARE_TO_RADIO_TXEN
+ *       and @ref NRF_802154_PPI_TIMER_COMPARE_TO_RADIO_DISABLE.
  *
  */
 #ifndef NRF_802154_PPI_RADIO_CRCERROR_TO_TIMER_CLEAR
@@ -185,8 +186,9 @@ extern "C" {
  * The PPI channel that connects RADIO_CCAIDLE event to the GPIOTE tasks used by the Frontend.
  *
  * @note This option is used by the core module regardless of the driver configuration.
- *       The peripheral is shared with @ref NRF_802154_PPI_RADIO_CRCERROR_TO_TIMER_CLEAR
- *       and @ref NRF_802154_PPI_TIMER_COMPARE_TO_RADIO_TXEN.
+ *       The peripheral is shared with @ref NRF_802154_PPI_RADIO_CRCERROR_TO_TIMER_CLEAR,
+ *       @ref NRF_802154_PPI_TIMER_COMPARE_TO_RADIO_TXEN
+ *       and @ref NRF_802154_PPI_TIMER_COMPARE_TO_RADIO_DISABLE.
  *
  */
 #ifndef NRF_802154_PPI_RADIO_CCAIDLE_TO_FEM_GPIOTE
@@ -199,14 +201,32 @@ extern "C" {
  * The PPI channel that connects TIMER_COMPARE event to RADIO_TXEN task.
  *
  * @note This option is used by the core module regardless of the driver configuration.
- *       The peripheral is shared with @ref NRF_802154_PPI_RADIO_CRCERROR_TO_TIMER_CLEAR
- *       and @ref NRF_802154_PPI_RADIO_CCAIDLE_TO_FEM_GPIOTE.
+ *       The peripheral is shared with @ref NRF_802154_PPI_RADIO_CRCERROR_TO_TIMER_CLEAR,
+ *       @ref NRF_802154_PPI_RADIO_CCAIDLE_TO_FEM_GPIOTE
+ *       and @ref NRF_802154_PPI_TIMER_COMPARE_TO_RADIO_DISABLE.
  *
  */
 #ifndef NRF_802154_PPI_TIMER_COMPARE_TO_RADIO_TXEN
 #define NRF_802154_PPI_TIMER_COMPARE_TO_RADIO_TXEN NRF_PPI_CHANNEL9
 #endif
 
+/**
+ * @def NRF_802154_PPI_TIMER_COMPARE_TO_RADIO_DISABLE
+ *
+ * The PPI channel that connects TIMER_COMPARE event to RADIO_DISABLE task and to the EGU task
+ * signalling the end of the ACK waiting window.
+ *
+ * @note This option is used only when the hardware ACK timeout is enabled
+ *       (see @ref NRF_802154_ACK_TIMEOUT_HW_ENABLED).
+ *       The peripheral is shared with @ref NRF_802154_PPI_RADIO_CRCERROR_TO_TIMER_CLEAR,
+ *       @ref NRF_802154_PPI_RADIO_CCAIDLE_TO_FEM_GPIOTE
+ *       and @ref NRF_802154_PPI_TIMER_COMPARE_TO_RADIO_TXEN.
+ *
+ */
+#ifndef NRF_802154_PPI_TIMER_COMPARE_TO_RADIO_DISABLE
+#define NRF_802154_PPI_TIMER_COMPARE_TO_RADIO_DISABLE NRF_PPI_CHANNEL9
+#endif
+
 /**
  * @def NRF_802154_PPI_RADIO_CRCOK_TO_PPI_GRP_DISABLE
  *
@@ -276,6 +296,61 @@ extern "C" {
 
 #endif // NRF_802154_FRAME_TIMESTAMP_ENABLED
 
+#if NRF_802154_RADIO_TRACE_ENABLED
+
+/**
+ * @def NRF_802154_RADIO_TRACE_PPI_CHANNELS_DYNAMIC
+ *
+ * If the PPI channels of the radio trace are allocated with @c nrfx_gppi_channel_alloc when
+ * the driver is initialized instead of being reserved at build time. The channels are freed when
+ * the driver is deinitialized. Events for which no channel is available are not traced.
+ *
+ * The channels used by the radio operations themselves, including the ACK path, are always
+ * reserved at build time, as their timing cannot depend on the availability of a channel.
+ *
+ * @note This option requires the nrfx PPI driver to be enabled.
+ *
+ */
+#ifndef NRF_802154_RADIO_TRACE_PPI_CHANNELS_DYNAMIC
+#define NRF_802154_RADIO_TRACE_PPI_CHANNELS_DYNAMIC 0
+#endif
+
+#if NRF_802154_RADIO_TRACE_PPI_CHANNELS_DYNAMIC
+
+#define NRF_802154_RADIO_TRACE_PPI_CHANNELS_USED_MASK 0
+
+#else // NRF_802154_RADIO_TRACE_PPI_CHANNELS_DYNAMIC
+
+/**
+ * @def NRF_802154_RADIO_TRACE_PPI_CHANNEL_FIRST
+ *
+ * The first of the six consecutive PPI channels that connect RADIO events to the GPIOTE tasks
+ * toggling the trace pins.
+ *
+ * @note This option is used only when the radio trace is enabled
+ *       (see @ref NRF_802154_RADIO_TRACE_ENABLED).
+ *
+ */
+#ifndef NRF_802154_RADIO_TRACE_PPI_CHANNEL_FIRST
+#define NRF_802154_RADIO_TRACE_PPI_CHANNEL_FIRST NRF_PPI_CHANNEL0
+#endif
+
+/**
+ * @def NRF_802154_RADIO_TRACE_PPI_CHANNELS_USED_MASK
+ *
+ * Helper bit mask of PPI channels used by the 802.15.4 driver for the radio trace.
+ */
+#define NRF_802154_RADIO_TRACE_PPI_CHANNELS_USED_MASK \
+    (0x3FUL << NRF_802154_RADIO_TRACE_PPI_CHANNEL_FIRST)
+
+#endif // NRF_802154_RADIO_TRACE_PPI_CHANNELS_DYNAMIC
+
+#else // NRF_802154_RADIO_TRACE_ENABLED
+
+#define NRF_802154_RADIO_TRACE_PPI_CHANNELS_USED_MASK 0
+
+#endif // NRF_802154_RADIO_TRACE_ENABLED
+
 /**
  * @def NRF_802154_PPI_CORE_GROUP
  *
@@ -323,6 +398,7 @@ extern "C" {
                                            (1 << NRF_802154_PPI_RADIO_CRCOK_TO_PPI_GRP_DISABLE) |   \
                                            NRF_802154_DISABLE_BCC_MATCHING_PPI_CHANNELS_USED_MASK | \
                                            NRF_802154_TIMESTAMP_PPI_CHANNELS_USED_MASK |            \
+                                           NRF_802154_RADIO_TRACE_PPI_CHANNELS_USED_MASK |          \
                                            NRF_802154_DEBUG_PPI_CHANNELS_USED_MASK)
 #endif // NRF_802154_PPI_CHANNELS_USED_MASK
 
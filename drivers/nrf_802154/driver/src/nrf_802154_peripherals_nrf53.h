@@ -270,6 +270,33 @@ extern "C" {
 #define NRF_802154_DPPI_RADIO_HW_TRIGGER 15U
 #endif
 
+#if NRF_802154_ACK_TIMEOUT_HW_ENABLED
+/**
+ * @def NRF_802154_DPPI_TIMER_COMPARE_TO_RADIO_DISABLE
+ *
+ * The DPPI channel that connects TIMER_COMPARE event to RADIO_DISABLE task and to the EGU task
+ * signalling the end of the ACK waiting window.
+ *
+ * @note This option is used only when the hardware ACK timeout is enabled
+ *       (see @ref NRF_802154_ACK_TIMEOUT_HW_ENABLED). It cannot be shared with
+ *       @ref NRF_802154_DPPI_EGU_TO_RADIO_RAMP_UP, which is in use while waiting for ACK.
+ *
+ */
+#ifndef NRF_802154_DPPI_TIMER_COMPARE_TO_RADIO_DISABLE
+#define NRF_802154_DPPI_TIMER_COMPARE_TO_RADIO_DISABLE 16U
+#endif
+
+/**
+ * @def NRF_802154_DPPI_ACK_TIMEOUT_HW_USED_MASK
+ *
+ * Helper bit mask of DPPI channels used by the 802.15.4 driver's hardware ACK timeout.
+ */
+#define NRF_802154_DPPI_ACK_TIMEOUT_HW_USED_MASK \
+    (1UL << NRF_802154_DPPI_TIMER_COMPARE_TO_RADIO_DISABLE)
+#else // NRF_802154_ACK_TIMEOUT_HW_ENABLED
+#define NRF_802154_DPPI_ACK_TIMEOUT_HW_USED_MASK 0U
+#endif  // NRF_802154_ACK_TIMEOUT_HW_ENABLED
+
 /**
  * @def NRF_802154_DPPI_TIMESTAMPS_USED_MASK
  *
@@ -301,6 +328,7 @@ extern "C" {
         (1UL << NRF_802154_DPPI_RADIO_CCAIDLE) |               \
         (1UL << NRF_802154_DPPI_RADIO_HW_TRIGGER) |            \
         NRF_802154_DPPI_RADIO_TEST_MODE_USED_MASK |            \
+        NRF_802154_DPPI_ACK_TIMEOUT_HW_USED_MASK |             \
         NRF_802154_DPPI_TIMESTAMPS_USED_MASK)
 #endif // NRF_802154_DPPI_CHANNELS_USED_MASK
 
@@ -48,8 +48,21 @@
 #include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
 #include "nrf_802154_utils.h"
+#include "nrf_802154_sl_atomics.h"
 
 #define CSMACA_BE_MAXIMUM 8 ///< The maximum allowed CSMA-CA backoff exponent (BE) that results from the implementation
+#define ADDR_BANK_COUNT   2 ///< Number of banks the addressing fields are stored in.
+
+#if NRF_802154_IDENTITIES_NUM > 8
+#error "NRF_802154_IDENTITIES_NUM must not be greater than 8"
+#endif
+
+typedef struct
+{
+    uint8_t pan_id[PAN_ID_SIZE];                  ///< Pan Id of this node.
+    uint8_t short_addr[SHORT_ADDRESS_SIZE];       ///< Short Address of this node.
+    uint8_t extended_addr[EXTENDED_ADDRESS_SIZE]; ///< Extended Address of this node.
+} nrf_802154_pib_addr_t;
 
 typedef struct
 {
@@ -88,9 +101,8 @@ typedef struct
 typedef struct
 {
     int8_t                  tx_power;                             ///< Transmit power.
-    uint8_t                 pan_id[PAN_ID_SIZE];                  ///< Pan Id of this node.
-    uint8_t                 short_addr[SHORT_ADDRESS_SIZE];       ///< Short Address of this node.
-    uint8_t                 extended_addr[EXTENDED_ADDRESS_SIZE]; ///< Extended Address of this node.
+    nrf_802154_pib_addr_t   addr[ADDR_BANK_COUNT];                ///< Banks of the addressing fields.
+    uint8_t                 addr_active;                          ///< Index of the bank the addressing fields are read from.
     nrf_802154_cca_cfg_t    cca;                                  ///< CCA mode and thresholds.
     bool                    promiscuous : 1;                      ///< Indicating if radio is in promiscuous mode.
     bool                    auto_ack    : 1;                      ///< Indicating if auto ACK procedure is enabled.
@@ -113,11 +125,57 @@ typedef struct
 
 #endif
 
+#if NRF_802154_RX_PREFILTER_ENABLED
+    nrf_802154_rx_prefilter_t rx_prefilter; ///< Filter of received frames run before notification.
+
+#endif
+
+#if NRF_802154_IDENTITIES_NUM > 0
+    nrf_802154_identity_t identities[NRF_802154_IDENTITIES_NUM]; ///< Additional receive identities.
+    uint8_t               identities_set;                        ///< Bitmask of the identities that are set.
+
+#endif
+
 } nrf_802154_pib_data_t;
 
 // Static variables.
 static nrf_802154_pib_data_t m_data; ///< Buffer containing PIB data.
 
+/**
+ * @brief Gets the bank the addressing fields are currently read from.
+ */
+static const nrf_802154_pib_addr_t * addr_active_get(void)
+{
+    return &m_data.addr[nrf_802154_sl_atomic_load_u8(&m_data.addr_active)];
+}
+
+/**
+ * @brief Prepares the inactive bank of the addressing fields for modification.
+ *
+ * The inactive bank is filled with the current addressing fields. After the requested field is
+ * modified, the bank must be published with @ref addr_bank_publish.
+ *
+ * @returns  Pointer to the inactive bank.
+ */
+static nrf_802154_pib_addr_t * addr_bank_prepare(void)
+{
+    uint8_t active = m_data.addr_active;
+
+    m_data.addr[(active + 1U) % ADDR_BANK_COUNT] = m_data.addr[active];
+
+    return &m_data.addr[(active + 1U) % ADDR_BANK_COUNT];
+}
+
+/**
+ * @brief Makes the bank prepared by @ref addr_bank_prepare the one the addressing fields are read
+ *        from.
+ */
+static void addr_bank_publish(void)
+{
+    nrf_802154_sl_atomic_store_u8(&m_data.addr_active,
+                                  (m_data.addr_active + 1U) % ADDR_BANK_COUNT);
+}
+
 /**
  * @brief Checks if provided Coex transmit request mode is supported.
  *
@@ -182,10 +240,11 @@ void nrf_802154_pib_init(void)
     m_data.pan_coord   = false;
     m_data.channel     = 11;
 
-    memset(m_data.pan_id, 0xff, sizeof(m_data.pan_id));
-    m_data.short_addr[0] = 0xfe;
-    m_data.short_addr[1] = 0xff;
-    memset(m_data.extended_addr, 0, sizeof(m_data.extended_addr));
+    m_data.addr_active = 0;
+    memset(m_data.addr[0].pan_id, 0xff, sizeof(m_data.addr[0].pan_id));
+    m_data.addr[0].short_addr[0] = 0xfe;
+    m_data.addr[0].short_addr[1] = 0xff;
+    memset(m_data.addr[0].extended_addr, 0, sizeof(m_data.addr[0].extended_addr));
 
     m_data.cca.mode           = NRF_802154_CCA_MODE_DEFAULT;
     m_data.cca.ed_threshold   = NRF_802154_CCA_ED_THRESHOLD_DEFAULT;
@@ -211,6 +270,14 @@ void nrf_802154_pib_init(void)
     m_data.test_modes.csmaca_backoff = NRF_802154_TEST_MODE_CSMACA_BACKOFF_RANDOM;
 #endif
 
+#if NRF_802154_RX_PREFILTER_ENABLED
+    m_data.rx_prefilter = NULL;
+#endif
+
+#if NRF_802154_IDENTITIES_NUM > 0
+    m_data.identities_set = 0U;
+#endif
+
 }
 
 bool nrf_802154_pib_promiscuous_get(void)
@@ -265,32 +332,35 @@ void nrf_802154_pib_tx_power_set(int8_t dbm)
 
 const uint8_t * nrf_802154_pib_pan_id_get(void)
 {
-    return m_data.pan_id;
+    return addr_active_get()->pan_id;
 }
 
 void nrf_802154_pib_pan_id_set(const uint8_t * p_pan_id)
 {
-    memcpy(m_data.pan_id, p_pan_id, PAN_ID_SIZE);
+    memcpy(addr_bank_prepare()->pan_id, p_pan_id, PAN_ID_SIZE);
+    addr_bank_publish();
 }
 
 const uint8_t * nrf_802154_pib_extended_address_get(void)
 {
-    return m_data.extended_addr;
+    return addr_active_get()->extended_addr;
 }
 
 void nrf_802154_pib_extended_address_set(const uint8_t * p_extended_address)
 {
-    memcpy(m_data.extended_addr, p_extended_address, EXTENDED_ADDRESS_SIZE);
+    memcpy(addr_bank_prepare()->extended_addr, p_extended_address, EXTENDED_ADDRESS_SIZE);
+    addr_bank_publish();
 }
 
 const uint8_t * nrf_802154_pib_short_address_get(void)
 {
-    return m_data.short_addr;
+    return addr_active_get()->short_addr;
 }
 
 void nrf_802154_pib_short_address_set(const uint8_t * p_short_address)
 {
-    memcpy(m_data.short_addr, p_short_address, SHORT_ADDRESS_SIZE);
+    memcpy(addr_bank_prepare()->short_addr, p_short_address, SHORT_ADDRESS_SIZE);
+    addr_bank_publish();
 }
 
 void nrf_802154_pib_cca_cfg_set(const nrf_802154_cca_cfg_t * p_cca_cfg)
@@ -461,3 +531,73 @@ void nrf_802154_pib_test_mode_csmaca_backoff_set(nrf_802154_test_mode_csmaca_bac
 }
 
 #endif // NRF_802154_TEST_MODES_ENABLED
+
+#if NRF_802154_RX_PREFILTER_ENABLED
+nrf_802154_rx_prefilter_t nrf_802154_pib_rx_prefilter_get(void)
+{
+    return m_data.rx_prefilter;
+}
+
+void nrf_802154_pib_rx_prefilter_set(nrf_802154_rx_prefilter_t prefilter)
+{
+    m_data.rx_prefilter = prefilter;
+}
+
+#endif // NRF_802154_RX_PREFILTER_ENABLED
+
+#if NRF_802154_IDENTITIES_NUM > 0
+bool nrf_802154_pib_identity_set(uint8_t index, const nrf_802154_identity_t * p_identity)
+{
+    if (index >= NRF_802154_IDENTITIES_NUM)
+    {
+        return false;
+    }
+
+    switch (p_identity->src_addr_match)
+    {
+        case NRF_802154_SRC_ADDR_MATCH_THREAD:
+        case NRF_802154_SRC_ADDR_MATCH_ZIGBEE:
+        case NRF_802154_SRC_ADDR_MATCH_ALWAYS_1:
+            break;
+
+        default:
+            return false;
+    }
+
+    // The identity is not matched while it is modified
+    nrf_802154_sl_atomic_store_u8(&m_data.identities_set,
+                                  m_data.identities_set & ~(1U << index));
+
+    m_data.identities[index] = *p_identity;
+
+    nrf_802154_sl_atomic_store_u8(&m_data.identities_set,
+                                  m_data.identities_set | (1U << index));
+
+    return true;
+}
+
+bool nrf_802154_pib_identity_clear(uint8_t index)
+{
+    if (index >= NRF_802154_IDENTITIES_NUM)
+    {
+        return false;
+    }
+
+    nrf_802154_sl_atomic_store_u8(&m_data.identities_set,
+                                  m_data.identities_set & ~(1U << index));
+
+    return true;
+}
+
+const nrf_802154_identity_t * nrf_802154_pib_identity_get(uint8_t index)
+{
+    if ((index >= NRF_802154_IDENTITIES_NUM) ||
+        ((nrf_802154_sl_atomic_load_u8(&m_data.identities_set) & (1U << index)) == 0U))
+    {
+        return NULL;
+    }
+
+    return &m_data.identities[index];
+}
+
+#endif // NRF_802154_IDENTITIES_NUM > 0
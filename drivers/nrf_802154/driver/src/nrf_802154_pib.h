@@ -131,6 +131,9 @@ void nrf_802154_pib_tx_power_set(int8_t dbm);
  * @brief Gets the PAN ID used by this device.
  *
  * @returns Pointer to the buffer containing the PAN ID value (2 bytes, little-endian).
+ *
+ * @note The PAN ID is updated as a whole, so it can be read in an interrupt that preempted
+ *       the setter without getting a partially updated value.
  */
 const uint8_t * nrf_802154_pib_pan_id_get(void);
 
@@ -147,6 +150,9 @@ void nrf_802154_pib_pan_id_set(const uint8_t * p_pan_id);
  * @brief Gets the extended address of this device.
  *
  * @returns Pointer to the buffer containing the extended address (8 bytes, little-endian).
+ *
+ * @note The extended address is updated as a whole, so it can be read in an interrupt that preempted
+ *       the setter without getting a partially updated value.
  */
 const uint8_t * nrf_802154_pib_extended_address_get(void);
 
@@ -163,6 +169,9 @@ void nrf_802154_pib_extended_address_set(const uint8_t * p_extended_address);
  * @brief Gets the short address of this device.
  *
  * @returns Pointer to the buffer containing the short address (2 bytes, little-endian).
+ *
+ * @note The short address is updated as a whole, so it can be read in an interrupt that preempted
+ *       the setter without getting a partially updated value.
  */
 const uint8_t * nrf_802154_pib_short_address_get(void);
 
@@ -342,6 +351,56 @@ void nrf_802154_pib_test_mode_csmaca_backoff_set(nrf_802154_test_mode_csmaca_bac
 
 #endif // NRF_802154_TEST_MODES_ENABLED
 
+#if NRF_802154_RX_PREFILTER_ENABLED
+/**
+ * @brief Gets the filter of received frames run before notification.
+ *
+ * @return Pointer to the filter or NULL if no filter is set.
+ */
+nrf_802154_rx_prefilter_t nrf_802154_pib_rx_prefilter_get(void);
+
+/**
+ * @brief Sets the filter of received frames run before notification.
+ *
+ * @param[in] prefilter  Pointer to the filter or NULL to disable filtering.
+ */
+void nrf_802154_pib_rx_prefilter_set(nrf_802154_rx_prefilter_t prefilter);
+
+#endif // NRF_802154_RX_PREFILTER_ENABLED
+
+#if NRF_802154_IDENTITIES_NUM > 0
+/**
+ * @brief Sets an additional receive identity.
+ *
+ * @param[in] index       Index of the identity.
+ * @param[in] p_identity  Pointer to the identity.
+ *
+ * @retval true   The identity has been set.
+ * @retval false  @p index or the source address matching method of @p p_identity is invalid.
+ */
+bool nrf_802154_pib_identity_set(uint8_t index, const nrf_802154_identity_t * p_identity);
+
+/**
+ * @brief Removes an additional receive identity.
+ *
+ * @param[in] index  Index of the identity.
+ *
+ * @retval true   The identity has been removed.
+ * @retval false  @p index is invalid.
+ */
+bool nrf_802154_pib_identity_clear(uint8_t index);
+
+/**
+ * @brief Gets an additional receive identity.
+ *
+ * @param[in] index  Index of the identity.
+ *
+ * @return Pointer to the identity or NULL if the identity is not set.
+ */
+const nrf_802154_identity_t * nrf_802154_pib_identity_get(uint8_t index);
+
+#endif // NRF_802154_IDENTITIES_NUM > 0
+
 #ifdef __cplusplus
 }
 #endif
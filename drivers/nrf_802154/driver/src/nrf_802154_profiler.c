@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the profiler of time-critical parts of the 802.15.4 driver.
+ *
+ */
+
+#include "nrf_802154_profiler.h"
+
+#if NRF_802154_PROFILER_ENABLED
+
+#include <assert.h>
+#include <stdbool.h>
+
+#include "nrf_802154.h"
+#include "nrf_802154_utils.h"
+
+/**@brief Durations measured for each part of the driver. */
+static volatile nrf_802154_stat_profile_t m_profiles[NRF_802154_PROFILE_POINT_COUNT];
+
+/**@brief Cycle counter values stored by @ref nrf_802154_profiler_mark. */
+static volatile uint32_t m_marks[NRF_802154_PROFILE_POINT_COUNT];
+
+/**@brief Bit mask of parts of the driver with a valid value in @ref m_marks. */
+static volatile uint32_t m_marked;
+
+/**@brief Resets durations of one part of the driver.
+ *
+ * @param[in]  point   Part of the driver.
+ */
+static void profile_reset(nrf_802154_profile_point_t point)
+{
+    volatile nrf_802154_stat_profile_t * p_profile = &m_profiles[point];
+
+    p_profile->count  = 0U;
+    p_profile->min_us = UINT32_MAX;
+    p_profile->max_us = 0U;
+
+    for (uint32_t i = 0U; i < NRF_802154_STAT_PROFILE_BUCKET_COUNT; i++)
+    {
+        p_profile->histogram[i] = 0U;
+    }
+}
+
+void nrf_802154_profiler_init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+
+    m_marked = 0U;
+    nrf_802154_stat_profile_reset();
+}
+
+void nrf_802154_profiler_record(nrf_802154_profile_point_t point, uint32_t start)
+{
+    assert(point < NRF_802154_PROFILE_POINT_COUNT);
+
+    uint32_t duration_us = (DWT->CYCCNT - start) / (SystemCoreClock / 1000000UL);
+    uint32_t bucket      = duration_us / NRF_802154_PROFILER_BUCKET_WIDTH_US;
+
+    nrf_802154_mcu_critical_state_t      mcu_cs;
+    volatile nrf_802154_stat_profile_t * p_profile = &m_profiles[point];
+
+    if (bucket >= NRF_802154_STAT_PROFILE_BUCKET_COUNT)
+    {
+        bucket = NRF_802154_STAT_PROFILE_BUCKET_COUNT - 1U;
+    }
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    p_profile->count++;
+    p_profile->histogram[bucket]++;
+
+    if (duration_us < p_profile->min_us)
+    {
+        p_profile->min_us = duration_us;
+    }
+
+    if (duration_us > p_profile->max_us)
+    {
+        p_profile->max_us = duration_us;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+void nrf_802154_profiler_mark(nrf_802154_profile_point_t point)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    assert(point < NRF_802154_PROFILE_POINT_COUNT);
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    m_marks[point] = DWT->CYCCNT;
+    m_marked      |= (1UL << point);
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+void nrf_802154_profiler_mark_end(nrf_802154_profile_point_t point)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    bool                            marked;
+    uint32_t                        start;
+
+    assert(point < NRF_802154_PROFILE_POINT_COUNT);
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    marked    = (m_marked & (1UL << point)) != 0U;
+    start     = m_marks[point];
+    m_marked &= ~(1UL << point);
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    if (marked)
+    {
+        nrf_802154_profiler_record(point, start);
+    }
+}
+
+void nrf_802154_stat_profile_get(nrf_802154_profile_point_t  point,
+                                 nrf_802154_stat_profile_t * p_profile)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    assert(point < NRF_802154_PROFILE_POINT_COUNT);
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+    *p_profile = m_profiles[point];
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+void nrf_802154_stat_profile_reset(void)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    for (nrf_802154_profile_point_t point = 0U; point < NRF_802154_PROFILE_POINT_COUNT; point++)
+    {
+        profile_reset(point);
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+#endif // NRF_802154_PROFILER_ENABLED
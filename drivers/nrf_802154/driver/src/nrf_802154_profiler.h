@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Module that measures durations of time-critical parts of the driver.
+ *
+ * The durations are measured with the DWT cycle counter. When @ref NRF_802154_PROFILER_ENABLED
+ * is disabled, all functions of this module are empty and get optimized out.
+ */
+
+#ifndef NRF_802154_PROFILER_H__
+#define NRF_802154_PROFILER_H__
+
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_types.h"
+
+#if NRF_802154_PROFILER_ENABLED
+
+#include <nrfx.h>
+
+/**@brief Initializes the profiler and enables the DWT cycle counter. */
+void nrf_802154_profiler_init(void);
+
+/**@brief Records duration of a part of the driver.
+ *
+ * @param[in]  point   Measured part of the driver.
+ * @param[in]  start   Value of the cycle counter when the part started.
+ */
+void nrf_802154_profiler_record(nrf_802154_profile_point_t point, uint32_t start);
+
+/**@brief Stores start of a part of the driver that ends in another function.
+ *
+ * @param[in]  point   Measured part of the driver.
+ */
+void nrf_802154_profiler_mark(nrf_802154_profile_point_t point);
+
+/**@brief Records duration since the last call to @ref nrf_802154_profiler_mark.
+ *
+ * Nothing is recorded if the part was not marked since it was recorded the last time.
+ *
+ * @param[in]  point   Measured part of the driver.
+ */
+void nrf_802154_profiler_mark_end(nrf_802154_profile_point_t point);
+
+/**@brief Gets the current value of the cycle counter to be passed to
+ *        @ref nrf_802154_profiler_end.
+ */
+static inline uint32_t nrf_802154_profiler_begin(void)
+{
+    return DWT->CYCCNT;
+}
+
+/**@brief Records duration of a part of the driver started with @ref nrf_802154_profiler_begin.
+ *
+ * @param[in]  point   Measured part of the driver.
+ * @param[in]  start   Value returned by @ref nrf_802154_profiler_begin.
+ */
+static inline void nrf_802154_profiler_end(nrf_802154_profile_point_t point, uint32_t start)
+{
+    nrf_802154_profiler_record(point, start);
+}
+
+#else // NRF_802154_PROFILER_ENABLED
+
+static inline void nrf_802154_profiler_init(void)
+{
+    // Intentionally empty
+}
+
+static inline uint32_t nrf_802154_profiler_begin(void)
+{
+    return 0U;
+}
+
+static inline void nrf_802154_profiler_end(nrf_802154_profile_point_t point, uint32_t start)
+{
+    (void)point;
+    (void)start;
+}
+
+static inline void nrf_802154_profiler_mark(nrf_802154_profile_point_t point)
+{
+    (void)point;
+}
+
+static inline void nrf_802154_profiler_mark_end(nrf_802154_profile_point_t point)
+{
+    (void)point;
+}
+
+#endif // NRF_802154_PROFILER_ENABLED
+
+#endif // NRF_802154_PROFILER_H__
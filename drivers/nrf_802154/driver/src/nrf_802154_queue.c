@@ -40,16 +40,28 @@
 
 #include "nrf_802154_queue.h"
 
-static inline uint8_t increment_modulo(uint8_t v, uint8_t wrap_at_value)
+static inline uint8_t index_advance(const nrf_802154_queue_t * p_queue, uint8_t v, size_t n)
 {
-    v++;
+    assert(n <= p_queue->capacity);
 
-    if (v >= wrap_at_value)
+    if (p_queue->mask != 0U)
     {
-        v = 0U;
+        return (uint8_t)((v + n) & p_queue->mask);
     }
 
-    return v;
+    size_t result = v + n;
+
+    if (result >= p_queue->capacity)
+    {
+        result -= p_queue->capacity;
+    }
+
+    return (uint8_t)result;
+}
+
+static inline size_t min_size(size_t a, size_t b)
+{
+    return (a < b) ? a : b;
 }
 
 static inline void * idx2ptr(const nrf_802154_queue_t * p_queue, size_t idx)
@@ -81,6 +93,7 @@ void nrf_802154_queue_init(nrf_802154_queue_t * p_queue,
     p_queue->p_memory  = p_memory;
     p_queue->capacity  = capacity;
     p_queue->item_size = item_size;
+    p_queue->mask      = ((capacity & (capacity - 1U)) == 0U) ? (capacity - 1U) : 0U;
     p_queue->wridx     = 0U;
     p_queue->rdidx     = 0U;
 }
@@ -92,7 +105,24 @@ void * nrf_802154_queue_push_begin(const nrf_802154_queue_t * p_queue)
 
 void nrf_802154_queue_push_commit(nrf_802154_queue_t * p_queue)
 {
-    p_queue->wridx = increment_modulo(p_queue->wridx, p_queue->capacity);
+    p_queue->wridx = index_advance(p_queue, p_queue->wridx, 1U);
+}
+
+void * nrf_802154_queue_push_n_begin(const nrf_802154_queue_t * p_queue, size_t * p_count)
+{
+    assert(p_count != NULL);
+
+    uint8_t wridx = p_queue->wridx;
+    size_t  free  = (p_queue->capacity - 1U) - nrf_802154_queue_count(p_queue);
+
+    *p_count = min_size(min_size(*p_count, free), p_queue->capacity - wridx);
+
+    return idx2ptr(p_queue, wridx);
+}
+
+void nrf_802154_queue_push_n_commit(nrf_802154_queue_t * p_queue, size_t count)
+{
+    p_queue->wridx = index_advance(p_queue, p_queue->wridx, count);
 }
 
 void * nrf_802154_queue_pop_begin(const nrf_802154_queue_t * p_queue)
@@ -102,14 +132,44 @@ void * nrf_802154_queue_pop_begin(const nrf_802154_queue_t * p_queue)
 
 void nrf_802154_queue_pop_commit(nrf_802154_queue_t * p_queue)
 {
-    p_queue->rdidx = increment_modulo(p_queue->rdidx, p_queue->capacity);
+    p_queue->rdidx = index_advance(p_queue, p_queue->rdidx, 1U);
+}
+
+void * nrf_802154_queue_pop_n_begin(const nrf_802154_queue_t * p_queue, size_t * p_count)
+{
+    assert(p_count != NULL);
+
+    uint8_t rdidx = p_queue->rdidx;
+
+    *p_count = min_size(min_size(*p_count, nrf_802154_queue_count(p_queue)),
+                        p_queue->capacity - rdidx);
+
+    return idx2ptr(p_queue, rdidx);
+}
+
+void nrf_802154_queue_pop_n_commit(nrf_802154_queue_t * p_queue, size_t count)
+{
+    p_queue->rdidx = index_advance(p_queue, p_queue->rdidx, count);
+}
+
+size_t nrf_802154_queue_count(const nrf_802154_queue_t * p_queue)
+{
+    uint8_t wridx = p_queue->wridx;
+    uint8_t rdidx = p_queue->rdidx;
+
+    if (p_queue->mask != 0U)
+    {
+        return (uint8_t)(wridx - rdidx) & p_queue->mask;
+    }
+
+    return (wridx >= rdidx) ? (wridx - rdidx) : (p_queue->capacity - rdidx + wridx);
 }
 
 bool nrf_802154_queue_is_full(const nrf_802154_queue_t * p_queue)
 {
     size_t wridx;
 
-    wridx = increment_modulo(p_queue->wridx, p_queue->capacity);
+    wridx = index_advance(p_queue, p_queue->wridx, 1U);
 
     return (p_queue->rdidx == wridx);
 }
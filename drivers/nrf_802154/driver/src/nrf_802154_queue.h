@@ -56,6 +56,9 @@ typedef struct
     /**@brief Maximum number of items that can be stored in the memory of the queue */
     uint8_t          capacity;
 
+    /**@brief Mask wrapping the indices if @c capacity is a power of two, 0 otherwise. */
+    uint8_t          mask;
+
     /**@brief Index in the items memory of the queue where next item is written. */
     volatile uint8_t wridx;
 
@@ -71,6 +74,9 @@ typedef struct
  * @param[in] memory_size   Size of the memory pointed by @p p_memory.
  *                          This parameter must be no less than 2 * @p item_size
  * @param[in] item_size     Size of an item of the queue. Must not be 0.
+ *
+ * @note If the resulting capacity is a power of two, the indices of the queue are wrapped with
+ *       a mask instead of a comparison.
  */
 void nrf_802154_queue_init(nrf_802154_queue_t * p_queue,
                            void               * p_memory,
@@ -107,6 +113,36 @@ void * nrf_802154_queue_push_begin(const nrf_802154_queue_t * p_queue);
  */
 void nrf_802154_queue_push_commit(nrf_802154_queue_t * p_queue);
 
+/**@brief Returns pointer to the next items to be written to the queue.
+ *
+ * This function is a batch variant of @ref nrf_802154_queue_push_begin. The items to be written
+ * are consecutive in the memory of the queue, so fewer items than requested can be available
+ * even if the queue has more free space. To write items to the queue perform following.
+ * @code
+ * size_t      count   = MY_BATCH_SIZE;
+ * my_item_t * p_items = (my_item_t *)nrf_802154_queue_push_n_begin(&queue, &count);
+ * ... fill p_items[0] .. p_items[count - 1]
+ * nrf_802154_queue_push_n_commit(&queue, count);
+ * @endcode
+ *
+ * To ensure thread-safety external locking is required.
+ *
+ * @param[in]    p_queue  Pointer to the queue instance.
+ * @param[inout] p_count  Pointer to the number of items requested. On return it holds the number
+ *                        of items available at the returned pointer, which can be 0.
+ *
+ * @return Pointer to the first item to be written.
+ */
+void * nrf_802154_queue_push_n_begin(const nrf_802154_queue_t * p_queue, size_t * p_count);
+
+/**@brief Advances write pointer of the queue by a number of items.
+ *
+ * @param[in] p_queue       Pointer to the queue instance.
+ * @param[in] count         Number of items written, not greater than the number of items returned
+ *                          by @ref nrf_802154_queue_push_n_begin.
+ */
+void nrf_802154_queue_push_n_commit(nrf_802154_queue_t * p_queue, size_t count);
+
 /**@brief Returns pointer to the next item to be read from the queue.
  *
  * This function is to be used when reading data from the queue directly (no copy).
@@ -136,6 +172,29 @@ void * nrf_802154_queue_pop_begin(const nrf_802154_queue_t * p_queue);
  */
 void nrf_802154_queue_pop_commit(nrf_802154_queue_t * p_queue);
 
+/**@brief Returns pointer to the next items to be read from the queue.
+ *
+ * This function is a batch variant of @ref nrf_802154_queue_pop_begin. The items to be read
+ * are consecutive in the memory of the queue, so fewer items than requested can be available
+ * even if the queue holds more items.
+ * To ensure thread-safety external locking is required.
+ *
+ * @param[in]    p_queue  Pointer to the queue instance.
+ * @param[inout] p_count  Pointer to the number of items requested. On return it holds the number
+ *                        of items available at the returned pointer, which can be 0.
+ *
+ * @return Pointer to the first item to be read.
+ */
+void * nrf_802154_queue_pop_n_begin(const nrf_802154_queue_t * p_queue, size_t * p_count);
+
+/**@brief Advances read pointer of the queue by a number of items.
+ *
+ * @param[in] p_queue       Pointer to the queue instance.
+ * @param[in] count         Number of items read, not greater than the number of items returned
+ *                          by @ref nrf_802154_queue_pop_n_begin.
+ */
+void nrf_802154_queue_pop_n_commit(nrf_802154_queue_t * p_queue, size_t count);
+
 /**@brief Checks if the queue is empty.
  *
  * @param[in] p_queue       Pointer to the queue instance.
@@ -148,6 +207,14 @@ static inline bool nrf_802154_queue_is_empty(const nrf_802154_queue_t * p_queue)
     return (p_queue->wridx == p_queue->rdidx);
 }
 
+/**@brief Returns the number of items stored in the queue.
+ *
+ * @param[in] p_queue   Pointer to the queue instance.
+ *
+ * @return  Number of items that were pushed to the queue and not popped yet.
+ */
+size_t nrf_802154_queue_count(const nrf_802154_queue_t * p_queue);
+
 /**@brief Checks if the queue is full.
  *
  * @param[in] p_queue       Pointer to the queue instance.
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the tracing of RADIO events on GPIO pins.
+ *
+ * Each traced event is connected through its own PPI channel to a GPIOTE task that toggles
+ * the pin of the event, so the pins change state at the hardware timing of the events without any
+ * CPU involvement.
+ *
+ */
+
+#include "nrf_802154_radio_trace.h"
+
+#if NRF_802154_RADIO_TRACE_ENABLED
+
+#include <stdint.h>
+
+#include "nrfx.h"
+#include "nrf_802154_peripherals.h"
+#include "hal/nrf_gpio.h"
+#include "hal/nrf_gpiote.h"
+#include "hal/nrf_ppi.h"
+#include "hal/nrf_radio.h"
+
+#if NRF_802154_RADIO_TRACE_PPI_CHANNELS_DYNAMIC
+#include "helpers/nrfx_gppi.h"
+#endif
+
+#if !defined(PPI_PRESENT)
+#error "The radio trace is supported only on SoCs with PPI"
+#endif
+
+#if ENABLE_DEBUG_GPIO
+#error "The radio trace cannot be used together with ENABLE_DEBUG_GPIO"
+#endif
+
+/**@brief Traced RADIO event. */
+typedef struct
+{
+    nrf_radio_event_t event; ///< RADIO event.
+    uint32_t          pin;   ///< GPIO pin toggled on the event.
+} trace_event_t;
+
+static const trace_event_t m_trace_events[] =
+{
+    { NRF_RADIO_EVENT_READY,    NRF_802154_RADIO_TRACE_PIN_READY    },
+    { NRF_RADIO_EVENT_ADDRESS,  NRF_802154_RADIO_TRACE_PIN_ADDRESS  },
+    { NRF_RADIO_EVENT_END,      NRF_802154_RADIO_TRACE_PIN_END      },
+    { NRF_RADIO_EVENT_PHYEND,   NRF_802154_RADIO_TRACE_PIN_PHYEND   },
+    { NRF_RADIO_EVENT_CCABUSY,  NRF_802154_RADIO_TRACE_PIN_CCABUSY  },
+    { NRF_RADIO_EVENT_DISABLED, NRF_802154_RADIO_TRACE_PIN_DISABLED },
+};
+
+#define TRACE_EVENTS_NUM (sizeof(m_trace_events) / sizeof(m_trace_events[0]))
+
+/**@brief PPI channels connecting the traced events to the GPIOTE tasks. */
+static uint8_t m_ppi_channels[TRACE_EVENTS_NUM];
+
+/**@brief Number of traced events, for which the PPI channels were obtained. */
+static uint32_t m_ppi_channels_num;
+
+/**@brief Mask of the PPI channels used by the radio trace. */
+static uint32_t m_ppi_channels_mask;
+
+/**
+ * @brief Obtains the PPI channel for a traced event.
+ *
+ * @param[in]  idx  Index of the event in @ref m_trace_events.
+ *
+ * @retval  true   The channel was obtained and stored in @ref m_ppi_channels.
+ * @retval  false  No channel is available.
+ */
+static bool ppi_channel_get(uint32_t idx)
+{
+#if NRF_802154_RADIO_TRACE_PPI_CHANNELS_DYNAMIC
+    return nrfx_gppi_channel_alloc(&m_ppi_channels[idx]) == NRFX_SUCCESS;
+#else
+    m_ppi_channels[idx] = (uint8_t)(NRF_802154_RADIO_TRACE_PPI_CHANNEL_FIRST + idx);
+
+    return true;
+#endif
+}
+
+/**
+ * @brief Releases the PPI channel of a traced event.
+ *
+ * @param[in]  idx  Index of the event in @ref m_trace_events.
+ */
+static void ppi_channel_release(uint32_t idx)
+{
+#if NRF_802154_RADIO_TRACE_PPI_CHANNELS_DYNAMIC
+    (void)nrfx_gppi_channel_free(m_ppi_channels[idx]);
+#else
+    (void)idx;
+#endif
+}
+
+void nrf_802154_radio_trace_init(void)
+{
+    m_ppi_channels_num  = 0;
+    m_ppi_channels_mask = 0;
+
+    for (uint32_t i = 0; i < TRACE_EVENTS_NUM; i++)
+    {
+        if (!ppi_channel_get(i))
+        {
+            break;
+        }
+
+        uint32_t          gpiote_ch = NRF_802154_RADIO_TRACE_GPIOTE_CHANNEL_FIRST + i;
+        nrf_ppi_channel_t ppi_ch    = (nrf_ppi_channel_t)m_ppi_channels[i];
+
+        nrf_gpio_cfg_output(m_trace_events[i].pin);
+
+        nrf_gpiote_task_configure(NRF_GPIOTE,
+                                  gpiote_ch,
+                                  m_trace_events[i].pin,
+                                  NRF_GPIOTE_POLARITY_TOGGLE,
+                                  NRF_GPIOTE_INITIAL_VALUE_LOW);
+        nrf_gpiote_task_enable(NRF_GPIOTE, gpiote_ch);
+
+        nrf_ppi_channel_endpoint_setup(
+            NRF_PPI,
+            ppi_ch,
+            nrf_radio_event_address_get(NRF_RADIO, m_trace_events[i].event),
+            nrf_gpiote_task_address_get(NRF_GPIOTE, nrf_gpiote_out_task_get(gpiote_ch)));
+
+        m_ppi_channels_mask |= (1UL << ppi_ch);
+        m_ppi_channels_num++;
+    }
+
+    nrf_ppi_channels_enable(NRF_PPI, m_ppi_channels_mask);
+}
+
+void nrf_802154_radio_trace_deinit(void)
+{
+    nrf_ppi_channels_disable(NRF_PPI, m_ppi_channels_mask);
+
+    for (uint32_t i = 0; i < m_ppi_channels_num; i++)
+    {
+        nrf_ppi_channel_endpoint_setup(NRF_PPI, (nrf_ppi_channel_t)m_ppi_channels[i], 0, 0);
+        ppi_channel_release(i);
+
+        nrf_gpiote_task_disable(NRF_GPIOTE, NRF_802154_RADIO_TRACE_GPIOTE_CHANNEL_FIRST + i);
+        nrf_gpio_cfg_default(m_trace_events[i].pin);
+    }
+
+    m_ppi_channels_num  = 0;
+    m_ppi_channels_mask = 0;
+}
+
+#endif // NRF_802154_RADIO_TRACE_ENABLED
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @brief Module that traces RADIO events on GPIO pins through GPIOTE and PPI.
+ *
+ */
+
+#ifndef NRF_802154_RADIO_TRACE_H__
+#define NRF_802154_RADIO_TRACE_H__
+
+#include "nrf_802154_config.h"
+
+#if NRF_802154_RADIO_TRACE_ENABLED
+
+/**
+ * @brief Initializes the radio trace.
+ *
+ * Configures the trace pins and connects the traced RADIO events to the tasks that toggle them.
+ */
+void nrf_802154_radio_trace_init(void);
+
+/**
+ * @brief Deinitializes the radio trace.
+ *
+ * Disconnects the traced RADIO events and releases the trace pins.
+ */
+void nrf_802154_radio_trace_deinit(void);
+
+#else // NRF_802154_RADIO_TRACE_ENABLED
+
+static inline void nrf_802154_radio_trace_init(void)
+{
+    // Intentionally empty
+}
+
+static inline void nrf_802154_radio_trace_deinit(void)
+{
+    // Intentionally empty
+}
+
+#endif // NRF_802154_RADIO_TRACE_ENABLED
+
+#endif // NRF_802154_RADIO_TRACE_H__
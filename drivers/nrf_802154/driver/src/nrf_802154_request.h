@@ -104,6 +104,35 @@ bool nrf_802154_request_transmit(nrf_802154_term_t              term_lvl,
                                  nrf_802154_transmit_params_t * p_params,
                                  nrf_802154_notification_func_t notify_function);
 
+#if NRF_802154_TX_PREPARE_ENABLED
+
+/**
+ * @brief Requests preparation of a frame to be transmitted by
+ *        @ref nrf_802154_request_transmit_commit.
+ *
+ * @param[in]  p_data      Pointer to the frame to transmit.
+ * @param[in]  p_metadata  Pointer to metadata of the frame to transmit.
+ *
+ * @retval  true   The frame was prepared.
+ * @retval  false  The frame could not be prepared.
+ */
+bool nrf_802154_request_transmit_prepare(uint8_t                              * p_data,
+                                         const nrf_802154_transmit_metadata_t * p_metadata);
+
+/**
+ * @brief Request entering the @ref RADIO_STATE_TX state for the prepared frame.
+ *
+ * @param[in]  term_lvl  Termination level of this request. Selects procedures to abort.
+ * @param[in]  req_orig  Module that originates this request.
+ *
+ * @retval  true   The driver will enter the transmit state.
+ * @retval  false  No frame was prepared or the driver cannot enter the transmit state due to
+ *                 an ongoing operation.
+ */
+bool nrf_802154_request_transmit_commit(nrf_802154_term_t term_lvl, req_originator_t req_orig);
+
+#endif // NRF_802154_TX_PREPARE_ENABLED
+
 /**
  * @brief Requests entering the @ref RADIO_STATE_ED state.
  *
@@ -115,6 +144,21 @@ bool nrf_802154_request_transmit(nrf_802154_term_t              term_lvl,
  */
 bool nrf_802154_request_energy_detection(nrf_802154_term_t term_lvl, uint32_t time_us);
 
+/**
+ * @brief Requests scanning energy on multiple channels.
+ *
+ * @param[in]  term_lvl      Termination level of this request. Selects procedures to abort.
+ * @param[in]  channel_mask  Mask of channels to scan. Bit @c n selects channel @c n.
+ * @param[in]  dwell_us      Minimal time of energy detection procedure on each channel.
+ *
+ * @retval  true   Entering the energy detection state succeeded.
+ * @retval  false  Entering the energy detection state failed
+ *                 (the driver is performing other procedure).
+ */
+bool nrf_802154_request_energy_scan(nrf_802154_term_t term_lvl,
+                                    uint32_t          channel_mask,
+                                    uint32_t          dwell_us);
+
 /**
  * @brief Requests entering the @ref RADIO_STATE_CCA state.
  *
@@ -235,6 +279,53 @@ bool nrf_802154_request_receive_at(uint64_t rx_time,
                                    uint8_t  channel,
                                    uint32_t id);
 
+/**
+ * @brief Requests a call to @ref nrf_802154_delayed_trx_receive_periodic.
+ *
+ * @param[in]   rx_time  Absolute time of the first window used by the SL Timer, in microseconds (us).
+ * @param[in]   period   Time between the beginnings of consecutive windows, in microseconds.
+ * @param[in]   timeout  Length of each window, in microseconds.
+ * @param[in]   channel  Radio channel on which the frames are to be received.
+ * @param[in]   count    Number of windows. If 0, the windows are repeated until cancelled.
+ * @param[in]   id       Identifier of the scheduled reception windows. If the reception has been
+ *                       scheduled successfully, the value of this parameter can be used in
+ *                       @ref nrf_802154_receive_at_cancel to cancel it.
+ *
+ * @retval  true   The reception procedure was scheduled.
+ * @retval  false  The driver could not schedule the reception procedure.
+ */
+bool nrf_802154_request_receive_at_periodic(uint64_t rx_time,
+                                            uint32_t period,
+                                            uint32_t timeout,
+                                            uint8_t  channel,
+                                            uint32_t count,
+                                            uint32_t id);
+
+/**
+ * @brief Requests a call to @ref nrf_802154_delayed_trx_receive_duty_cycled.
+ *
+ * @param[in]   rx_time    Absolute time of the first window used by the SL Timer, in microseconds (us).
+ * @param[in]   period     Time between the beginnings of consecutive windows, in microseconds.
+ * @param[in]   window     Length of each window, in microseconds.
+ * @param[in]   extension  Time for which a window is kept open after a frame received in it,
+ *                         in microseconds.
+ * @param[in]   channel    Radio channel on which the frames are to be received.
+ * @param[in]   count      Number of windows. If 0, the windows are repeated until cancelled.
+ * @param[in]   id         Identifier of the scheduled reception windows. If the reception has been
+ *                         scheduled successfully, the value of this parameter can be used in
+ *                         @ref nrf_802154_receive_at_cancel to cancel it.
+ *
+ * @retval  true   The reception procedure was scheduled.
+ * @retval  false  The driver could not schedule the reception procedure.
+ */
+bool nrf_802154_request_receive_at_duty_cycled(uint64_t rx_time,
+                                               uint32_t period,
+                                               uint32_t window,
+                                               uint32_t extension,
+                                               uint8_t  channel,
+                                               uint32_t count,
+                                               uint32_t id);
+
 /**
  * @brief Requests a call to @ref nrf_802154_delayed_trx_receive_cancel.
  *
@@ -100,11 +100,32 @@ bool nrf_802154_request_transmit(nrf_802154_term_t              term_lvl,
                            notify_function)
 }
 
+#if NRF_802154_TX_PREPARE_ENABLED
+bool nrf_802154_request_transmit_prepare(uint8_t                              * p_data,
+                                         const nrf_802154_transmit_metadata_t * p_metadata)
+{
+    REQUEST_FUNCTION_PARMS(nrf_802154_core_transmit_prepare, p_data, p_metadata)
+}
+
+bool nrf_802154_request_transmit_commit(nrf_802154_term_t term_lvl, req_originator_t req_orig)
+{
+    REQUEST_FUNCTION_PARMS(nrf_802154_core_transmit_commit, term_lvl, req_orig)
+}
+
+#endif // NRF_802154_TX_PREPARE_ENABLED
+
 bool nrf_802154_request_energy_detection(nrf_802154_term_t term_lvl, uint32_t time_us)
 {
     REQUEST_FUNCTION_PARMS(nrf_802154_core_energy_detection, term_lvl, time_us)
 }
 
+bool nrf_802154_request_energy_scan(nrf_802154_term_t term_lvl,
+                                    uint32_t          channel_mask,
+                                    uint32_t          dwell_us)
+{
+    REQUEST_FUNCTION_PARMS(nrf_802154_core_energy_scan, term_lvl, channel_mask, dwell_us)
+}
+
 bool nrf_802154_request_cca(nrf_802154_term_t term_lvl)
 {
     REQUEST_FUNCTION_PARMS(nrf_802154_core_cca, term_lvl)
@@ -181,6 +202,40 @@ bool nrf_802154_request_receive_at(uint64_t rx_time,
     REQUEST_FUNCTION_PARMS(nrf_802154_delayed_trx_receive, rx_time, timeout, channel, id);
 }
 
+bool nrf_802154_request_receive_at_periodic(uint64_t rx_time,
+                                            uint32_t period,
+                                            uint32_t timeout,
+                                            uint8_t  channel,
+                                            uint32_t count,
+                                            uint32_t id)
+{
+    REQUEST_FUNCTION_PARMS(nrf_802154_delayed_trx_receive_periodic,
+                           rx_time,
+                           period,
+                           timeout,
+                           channel,
+                           count,
+                           id);
+}
+
+bool nrf_802154_request_receive_at_duty_cycled(uint64_t rx_time,
+                                               uint32_t period,
+                                               uint32_t window,
+                                               uint32_t extension,
+                                               uint8_t  channel,
+                                               uint32_t count,
+                                               uint32_t id)
+{
+    REQUEST_FUNCTION_PARMS(nrf_802154_delayed_trx_receive_duty_cycled,
+                           rx_time,
+                           period,
+                           window,
+                           extension,
+                           channel,
+                           count,
+                           id);
+}
+
 bool nrf_802154_request_receive_at_cancel(uint32_t id)
 {
     REQUEST_FUNCTION_PARMS(nrf_802154_delayed_trx_receive_cancel, id);
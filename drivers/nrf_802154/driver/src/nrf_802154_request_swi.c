@@ -48,7 +48,7 @@
 #include "nrf_802154_core.h"
 #include "nrf_802154_critical_section.h"
 #include "nrf_802154_debug.h"
-#include "nrf_802154_queue.h"
+#include "nrf_802154_mpsc_queue.h"
 #include "nrf_802154_rx_buffer.h"
 #include "nrf_802154_swi.h"
 #include "nrf_802154_utils.h"
@@ -62,9 +62,10 @@
 
 /** Size of requests queue.
  *
- * Two is minimal queue size. It is not expected in current implementation to queue a few requests.
+ * Four is minimal queue size. It allows a few threads preempting each other to issue requests
+ * concurrently.
  */
-#define REQ_QUEUE_SIZE 2
+#define REQ_QUEUE_SIZE 4
 
 #define REQ_INT        NRF_EGU_INT_TRIGGERED2   ///< Label of request interrupt.
 #define REQ_TASK       NRF_EGU_TASK_TRIGGER2    ///< Label of request task.
@@ -76,7 +77,10 @@ typedef enum
     REQ_TYPE_SLEEP,
     REQ_TYPE_RECEIVE,
     REQ_TYPE_TRANSMIT,
+    REQ_TYPE_TRANSMIT_PREPARE,
+    REQ_TYPE_TRANSMIT_COMMIT,
     REQ_TYPE_ENERGY_DETECTION,
+    REQ_TYPE_ENERGY_SCAN,
     REQ_TYPE_CCA,
     REQ_TYPE_CONTINUOUS_CARRIER,
     REQ_TYPE_MODULATED_CARRIER,
@@ -89,6 +93,8 @@ typedef enum
     REQ_TYPE_TRANSMIT_AT,
     REQ_TYPE_TRANSMIT_AT_CANCEL,
     REQ_TYPE_RECEIVE_AT,
+    REQ_TYPE_RECEIVE_AT_PERIODIC,
+    REQ_TYPE_RECEIVE_AT_DUTY_CYCLED,
     REQ_TYPE_RECEIVE_AT_CANCEL,
     REQ_TYPE_CSMA_CA_START,
 } nrf_802154_req_type_t;
@@ -126,6 +132,22 @@ typedef struct
             bool                         * p_result;   ///< Transmit request result.
         } transmit;                                    ///< Transmit request details.
 
+#if NRF_802154_TX_PREPARE_ENABLED
+        struct
+        {
+            uint8_t                              * p_data;     ///< Pointer to a buffer containing PHR and PSDU of the frame to prepare.
+            const nrf_802154_transmit_metadata_t * p_metadata; ///< Pointer to metadata of the frame to prepare.
+            bool                                 * p_result;   ///< Transmit prepare request result.
+        } transmit_prepare;                                    ///< Transmit prepare request details.
+
+        struct
+        {
+            nrf_802154_term_t term_lvl; ///< Request priority.
+            req_originator_t  req_orig; ///< Request originator.
+            bool            * p_result; ///< Transmit commit request result.
+        } transmit_commit;              ///< Transmit commit request details.
+#endif // NRF_802154_TX_PREPARE_ENABLED
+
         struct
         {
             nrf_802154_term_t term_lvl; ///< Request priority.
@@ -133,6 +155,14 @@ typedef struct
             uint32_t          time_us;  ///< Requested time of energy detection procedure.
         } energy_detection;             ///< Energy detection request details.
 
+        struct
+        {
+            nrf_802154_term_t term_lvl;     ///< Request priority.
+            bool            * p_result;     ///< Energy scan request result.
+            uint32_t          channel_mask; ///< Mask of channels to be scanned.
+            uint32_t          dwell_us;     ///< Time of energy detection on each channel.
+        } energy_scan;                      ///< Energy scan request details.
+
         struct
         {
             nrf_802154_term_t term_lvl; ///< Request priority.
@@ -210,6 +240,29 @@ typedef struct
             bool   * p_result;
         } receive_at;
 
+        struct
+        {
+            uint64_t rx_time;
+            uint32_t period;
+            uint32_t timeout;
+            uint8_t  channel;
+            uint32_t count;
+            uint32_t id;
+            bool   * p_result;
+        } receive_at_periodic;
+
+        struct
+        {
+            uint64_t rx_time;
+            uint32_t period;
+            uint32_t window;
+            uint32_t extension;
+            uint8_t  channel;
+            uint32_t count;
+            uint32_t id;
+            bool   * p_result;
+        } receive_at_duty_cycled;
+
         struct
         {
             uint32_t id;
@@ -229,44 +282,57 @@ typedef struct
 } nrf_802154_req_data_t;
 
 /**@brief Instance of a requests queue */
-static nrf_802154_queue_t m_requests_queue;
+static nrf_802154_mpsc_queue_t m_requests_queue;
 
 /**@brief Memory holding requests queue items */
 static nrf_802154_req_data_t m_requests_queue_memory[REQ_QUEUE_SIZE];
 
-/**@brief State of the MCU critical section */
-static volatile nrf_802154_mcu_critical_state_t m_mcu_cs;
+/**@brief Memory holding sequence numbers of requests queue items */
+static volatile uint32_t m_requests_queue_seq[REQ_QUEUE_SIZE];
+
+/**@brief Priority of the SWI processing requests, cached at initialization */
+static uint32_t m_swi_priority;
 
 /**
  * Enter request block.
  *
- * This is a helper function used in all request functions to atomically
- * find an empty slot in request queue and allow atomic slot update.
+ * This is a helper function used in all request functions to reserve an empty slot
+ * in the request queue. The slot is reserved without entering a critical section, so a request
+ * issued from a context preempting another requesting context never waits for the preempted one.
+ *
+ * @param[out] p_pos  Position of the reserved slot in the request queue.
  *
  * @return Pointer to an empty slot in the request queue.
  */
-static nrf_802154_req_data_t * req_enter(void)
+static nrf_802154_req_data_t * req_enter(uint32_t * p_pos)
 {
-    nrf_802154_mcu_critical_enter(m_mcu_cs);
+    nrf_802154_req_data_t * p_slot =
+        (nrf_802154_req_data_t *)nrf_802154_mpsc_queue_push_try_begin(&m_requests_queue, p_pos);
 
-    assert(!nrf_802154_queue_is_full(&m_requests_queue));
+    assert(p_slot != NULL);
 
-    return (nrf_802154_req_data_t *)nrf_802154_queue_push_begin(&m_requests_queue);
+    return p_slot;
 }
 
 /**
  * Exit request block.
  *
- * This is a helper function used in all request functions to end atomic slot update
- * and trigger SWI to process the request from the slot.
+ * This is a helper function used in all request functions to publish the slot
+ * and trigger SWI to process the request from the slot. The function returns after the request
+ * is processed, which happens immediately as SWI preempts the requesting context.
+ *
+ * @param[in] pos  Position of the slot returned by @ref req_enter.
  */
-static void req_exit(void)
+static void req_exit(uint32_t pos)
 {
-    nrf_802154_queue_push_commit(&m_requests_queue);
+    nrf_802154_mpsc_queue_push_commit(&m_requests_queue, pos);
 
     nrf_egu_task_trigger(NRF_802154_EGU_INSTANCE, REQ_TASK);
 
-    nrf_802154_mcu_critical_exit(m_mcu_cs);
+    while (!nrf_802154_mpsc_queue_is_consumed(&m_requests_queue, pos))
+    {
+        // Wait until SWI handler processes the request.
+    }
 }
 
 /** Assert if SWI interrupt is disabled. */
@@ -306,15 +372,17 @@ static inline void assert_interrupt_status(void)
     return result;
 
 /** Check if active vector priority is high enough to call requests directly.
+ *
+ *  Requests called from a context that the SWI cannot preempt are executed in place, which
+ *  is safe, as such a context already blocks the processing of queued requests. Only lower
+ *  priority contexts pay for the queue and the SWI round trip.
  *
  *  @retval  true   Active vector priority is greater or equal to SWI priority.
  *  @retval  false  Active vector priority is lower than SWI priority.
  */
 static bool active_vector_priority_is_high(void)
 {
-
-    return nrf_802154_critical_section_active_vector_priority_get() <=
-           nrf_802154_irq_priority_get(NRF_802154_EGU_IRQN);
+    return nrf_802154_critical_section_active_vector_priority_get() <= m_swi_priority;
 }
 
 /**
@@ -325,13 +393,14 @@ static bool active_vector_priority_is_high(void)
  */
 static void swi_sleep(nrf_802154_term_t term_lvl, bool * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    uint32_t                pos;
+    nrf_802154_req_data_t * p_slot = req_enter(&pos);
 
     p_slot->type                = REQ_TYPE_SLEEP;
     p_slot->data.sleep.term_lvl = term_lvl;
     p_slot->data.sleep.p_result = p_result;
 
-    req_exit();
+    req_exit(pos);
 }
 
 /**
@@ -351,7 +420,8 @@ static void swi_receive(nrf_802154_term_t              term_lvl,
                         uint32_t                       id,
                         bool                         * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    uint32_t                pos;
+    nrf_802154_req_data_t * p_slot = req_enter(&pos);
 
     p_slot->type                     = REQ_TYPE_RECEIVE;
     p_slot->data.receive.term_lvl    = term_lvl;
@@ -361,7 +431,7 @@ static void swi_receive(nrf_802154_term_t              term_lvl,
     p_slot->data.receive.id          = id;
     p_slot->data.receive.p_result    = p_result;
 
-    req_exit();
+    req_exit(pos);
 }
 
 /**
@@ -384,7 +454,8 @@ static void swi_transmit(nrf_802154_term_t              term_lvl,
                          nrf_802154_notification_func_t notify_function,
                          bool                         * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    uint32_t                pos;
+    nrf_802154_req_data_t * p_slot = req_enter(&pos);
 
     p_slot->type                     = REQ_TYPE_TRANSMIT;
     p_slot->data.transmit.term_lvl   = term_lvl;
@@ -394,9 +465,59 @@ static void swi_transmit(nrf_802154_term_t              term_lvl,
     p_slot->data.transmit.notif_func = notify_function;
     p_slot->data.transmit.p_result   = p_result;
 
-    req_exit();
+    req_exit(pos);
+}
+
+#if NRF_802154_TX_PREPARE_ENABLED
+
+/**
+ * @brief Requests preparation of a frame to transmit from the SWI priority.
+ *
+ * @param[in]   p_data      Pointer to a buffer that contains PHR and PSDU of the frame to be
+ *                          prepared.
+ * @param[in]   p_metadata  Pointer to metadata of the frame to be prepared.
+ * @param[out]  p_result    Result of the frame preparation.
+ */
+static void swi_transmit_prepare(uint8_t                              * p_data,
+                                 const nrf_802154_transmit_metadata_t * p_metadata,
+                                 bool                                 * p_result)
+{
+    uint32_t                pos;
+    nrf_802154_req_data_t * p_slot = req_enter(&pos);
+
+    p_slot->type                             = REQ_TYPE_TRANSMIT_PREPARE;
+    p_slot->data.transmit_prepare.p_data     = p_data;
+    p_slot->data.transmit_prepare.p_metadata = p_metadata;
+    p_slot->data.transmit_prepare.p_result   = p_result;
+
+    req_exit(pos);
+}
+
+/**
+ * @brief Requests entering the @ref RADIO_STATE_TX state for the prepared frame from the SWI
+ *        priority.
+ *
+ * @param[in]   term_lvl  Termination level of this request. Selects procedures to abort.
+ * @param[in]   req_orig  Module that originates this request.
+ * @param[out]  p_result  Result of entering the transmit state.
+ */
+static void swi_transmit_commit(nrf_802154_term_t term_lvl,
+                                req_originator_t  req_orig,
+                                bool            * p_result)
+{
+    uint32_t                pos;
+    nrf_802154_req_data_t * p_slot = req_enter(&pos);
+
+    p_slot->type                          = REQ_TYPE_TRANSMIT_COMMIT;
+    p_slot->data.transmit_commit.term_lvl = term_lvl;
+    p_slot->data.transmit_commit.req_orig = req_orig;
+    p_slot->data.transmit_commit.p_result = p_result;
+
+    req_exit(pos);
 }
 
+#endif // NRF_802154_TX_PREPARE_ENABLED
+
 /**
  * @brief Requests entering the @ref RADIO_STATE_ED state from the SWI priority.
  *
@@ -408,14 +529,40 @@ static void swi_energy_detection(nrf_802154_term_t term_lvl,
                                  uint32_t          time_us,
                                  bool            * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    uint32_t                pos;
+    nrf_802154_req_data_t * p_slot = req_enter(&pos);
 
     p_slot->type                           = REQ_TYPE_ENERGY_DETECTION;
     p_slot->data.energy_detection.term_lvl = term_lvl;
     p_slot->data.energy_detection.time_us  = time_us;
     p_slot->data.energy_detection.p_result = p_result;
 
-    req_exit();
+    req_exit(pos);
+}
+
+/**
+ * @brief Requests scanning energy on multiple channels from the SWI priority.
+ *
+ * @param[in]   term_lvl      Termination level of this request. Selects procedures to abort.
+ * @param[in]   channel_mask  Mask of channels to be scanned.
+ * @param[in]   dwell_us      Duration of energy detection on each channel.
+ * @param[out]  p_result      Result of entering the energy detection state.
+ */
+static void swi_energy_scan(nrf_802154_term_t term_lvl,
+                            uint32_t          channel_mask,
+                            uint32_t          dwell_us,
+                            bool            * p_result)
+{
+    uint32_t                pos;
+    nrf_802154_req_data_t * p_slot = req_enter(&pos);
+
+    p_slot->type                          = REQ_TYPE_ENERGY_SCAN;
+    p_slot->data.energy_scan.term_lvl     = term_lvl;
+    p_slot->data.energy_scan.channel_mask = channel_mask;
+    p_slot->data.energy_scan.dwell_us     = dwell_us;
+    p_slot->data.energy_scan.p_result     = p_result;
+
+    req_exit(pos);
 }
 
 /**
@@ -426,13 +573,14 @@ static void swi_energy_detection(nrf_802154_term_t term_lvl,
  */
 static void swi_cca(nrf_802154_term_t term_lvl, bool * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    uint32_t                pos;
+    nrf_802154_req_data_t * p_slot = req_enter(&pos);
 
     p_slot->type              = REQ_TYPE_CCA;
     p_slot->data.cca.term_lvl = term_lvl;
     p_slot->data.cca.p_result = p_result;
 
-    req_exit();
+    req_exit(pos);
 }
 
 #if NRF_802154_CARRIER_FUNCTIONS_ENABLED
@@ -445,13 +593,14 @@ static void swi_cca(nrf_802154_term_t term_lvl, bool * p_result)
  */
 static void swi_continuous_carrier(nrf_802154_term_t term_lvl, bool * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    uint32_t                pos;
+    nrf_802154_req_data_t * p_slot = req_enter(&pos);
 
     p_slot->type                             = REQ_TYPE_CONTINUOUS_CARRIER;
     p_slot->data.continuous_carrier.term_lvl = term_lvl;
     p_slot->data.continuous_carrier.p_result = p_result;
 
-    req_exit();
+    req_exit(pos);
 }
 
 /**
@@ -465,14 +614,15 @@ static void swi_modulated_carrier(nrf_802154_term_t term_lvl,
                                   const uint8_t   * p_data,
                                   bool            * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    uint32_t                pos;
+    nrf_802154_req_data_t * p_slot = req_enter(&pos);
 
     p_slot->type                            = REQ_TYPE_MODULATED_CARRIER;
     p_slot->data.modulated_carrier.term_lvl = term_lvl;
     p_slot->data.modulated_carrier.p_data   = p_data;
     p_slot->data.modulated_carrier.p_result = p_result;
 
-    req_exit();
+    req_exit(pos);
 }
 
 #endif // NRF_802154_CARRIER_FUNCTIONS_ENABLED
@@ -486,13 +636,14 @@ static void swi_modulated_carrier(nrf_802154_term_t term_lvl,
  */
 static void swi_buffer_free(uint8_t * p_data, bool * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    uint32_t                pos;
+    nrf_802154_req_data_t * p_slot = req_enter(&pos);
 
     p_slot->type                      = REQ_TYPE_BUFFER_FREE;
     p_slot->data.buffer_free.p_data   = p_data;
     p_slot->data.buffer_free.p_result = p_result;
 
-    req_exit();
+    req_exit(pos);
 }
 
 /**
@@ -503,12 +654,13 @@ static void swi_buffer_free(uint8_t * p_data, bool * p_result)
  */
 static void swi_antenna_update(bool * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    uint32_t                pos;
+    nrf_802154_req_data_t * p_slot = req_enter(&pos);
 
     p_slot->type                         = REQ_TYPE_ANTENNA_UPDATE;
     p_slot->data.antenna_update.p_result = p_result;
 
-    req_exit();
+    req_exit(pos);
 }
 
 /**
@@ -519,13 +671,14 @@ static void swi_antenna_update(bool * p_result)
  */
 static void swi_channel_update(req_originator_t req_orig, bool * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    uint32_t                pos;
+    nrf_802154_req_data_t * p_slot = req_enter(&pos);
 
     p_slot->type                         = REQ_TYPE_CHANNEL_UPDATE;
     p_slot->data.channel_update.p_result = p_result;
     p_slot->data.channel_update.req_orig = req_orig;
 
-    req_exit();
+    req_exit(pos);
 }
 
 /**
@@ -536,12 +689,13 @@ static void swi_channel_update(req_originator_t req_orig, bool * p_result)
  */
 static void swi_cca_cfg_update(bool * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    uint32_t                pos;
+    nrf_802154_req_data_t * p_slot = req_enter(&pos);
 
     p_slot->type                         = REQ_TYPE_CCA_CFG_UPDATE;
     p_slot->data.cca_cfg_update.p_result = p_result;
 
-    req_exit();
+    req_exit(pos);
 }
 
 /**
@@ -552,12 +706,13 @@ static void swi_cca_cfg_update(bool * p_result)
  */
 static void swi_rssi_measure(bool * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    uint32_t                pos;
+    nrf_802154_req_data_t * p_slot = req_enter(&pos);
 
     p_slot->type                       = REQ_TYPE_RSSI_MEASURE;
     p_slot->data.rssi_measure.p_result = p_result;
 
-    req_exit();
+    req_exit(pos);
 }
 
 /**
@@ -569,13 +724,14 @@ static void swi_rssi_measure(bool * p_result)
  */
 static void swi_rssi_measurement_get(int8_t * p_rssi, bool * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    uint32_t                pos;
+    nrf_802154_req_data_t * p_slot = req_enter(&pos);
 
     p_slot->type                   = REQ_TYPE_RSSI_GET;
     p_slot->data.rssi_get.p_rssi   = p_rssi;
     p_slot->data.rssi_get.p_result = p_result;
 
-    req_exit();
+    req_exit(pos);
 }
 
 #if NRF_802154_DELAYED_TRX_ENABLED
@@ -584,7 +740,8 @@ static void swi_transmit_at(uint8_t                                 * p_data,
                             const nrf_802154_transmit_at_metadata_t * p_metadata,
                             bool                                    * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    uint32_t                pos;
+    nrf_802154_req_data_t * p_slot = req_enter(&pos);
 
     p_slot->type                        = REQ_TYPE_TRANSMIT_AT;
     p_slot->data.transmit_at.p_data     = p_data;
@@ -592,17 +749,18 @@ static void swi_transmit_at(uint8_t                                 * p_data,
     p_slot->data.transmit_at.p_metadata = p_metadata;
     p_slot->data.transmit_at.p_result   = p_result;
 
-    req_exit();
+    req_exit(pos);
 }
 
 static void swi_transmit_at_cancel(bool * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    uint32_t                pos;
+    nrf_802154_req_data_t * p_slot = req_enter(&pos);
 
     p_slot->type                             = REQ_TYPE_TRANSMIT_AT_CANCEL;
     p_slot->data.transmit_at_cancel.p_result = p_result;
 
-    req_exit();
+    req_exit(pos);
 }
 
 static void swi_receive_at(uint64_t rx_time,
@@ -611,7 +769,8 @@ static void swi_receive_at(uint64_t rx_time,
                            uint32_t id,
                            bool   * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    uint32_t                pos;
+    nrf_802154_req_data_t * p_slot = req_enter(&pos);
 
     p_slot->type                     = REQ_TYPE_RECEIVE_AT;
     p_slot->data.receive_at.rx_time  = rx_time;
@@ -620,18 +779,67 @@ static void swi_receive_at(uint64_t rx_time,
     p_slot->data.receive_at.id       = id;
     p_slot->data.receive_at.p_result = p_result;
 
-    req_exit();
+    req_exit(pos);
+}
+
+static void swi_receive_at_periodic(uint64_t rx_time,
+                                    uint32_t period,
+                                    uint32_t timeout,
+                                    uint8_t  channel,
+                                    uint32_t count,
+                                    uint32_t id,
+                                    bool   * p_result)
+{
+    uint32_t                pos;
+    nrf_802154_req_data_t * p_slot = req_enter(&pos);
+
+    p_slot->type                              = REQ_TYPE_RECEIVE_AT_PERIODIC;
+    p_slot->data.receive_at_periodic.rx_time  = rx_time;
+    p_slot->data.receive_at_periodic.period   = period;
+    p_slot->data.receive_at_periodic.timeout  = timeout;
+    p_slot->data.receive_at_periodic.channel  = channel;
+    p_slot->data.receive_at_periodic.count    = count;
+    p_slot->data.receive_at_periodic.id       = id;
+    p_slot->data.receive_at_periodic.p_result = p_result;
+
+    req_exit(pos);
+}
+
+static void swi_receive_at_duty_cycled(uint64_t rx_time,
+                                       uint32_t period,
+                                       uint32_t window,
+                                       uint32_t extension,
+                                       uint8_t  channel,
+                                       uint32_t count,
+                                       uint32_t id,
+                                       bool   * p_result)
+{
+    uint32_t                pos;
+    nrf_802154_req_data_t * p_slot = req_enter(&pos);
+
+    p_slot->type                                  = REQ_TYPE_RECEIVE_AT_DUTY_CYCLED;
+    p_slot->data.receive_at_duty_cycled.rx_time   = rx_time;
+    p_slot->data.receive_at_duty_cycled.period    = period;
+    p_slot->data.receive_at_duty_cycled.window    = window;
+    p_slot->data.receive_at_duty_cycled.extension = extension;
+    p_slot->data.receive_at_duty_cycled.channel   = channel;
+    p_slot->data.receive_at_duty_cycled.count     = count;
+    p_slot->data.receive_at_duty_cycled.id        = id;
+    p_slot->data.receive_at_duty_cycled.p_result  = p_result;
+
+    req_exit(pos);
 }
 
 static void swi_receive_at_cancel(uint32_t id, bool * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    uint32_t                pos;
+    nrf_802154_req_data_t * p_slot = req_enter(&pos);
 
     p_slot->type                            = REQ_TYPE_RECEIVE_AT_CANCEL;
     p_slot->data.receive_at_cancel.id       = id;
     p_slot->data.receive_at_cancel.p_result = p_result;
 
-    req_exit();
+    req_exit(pos);
 }
 
 #endif // NRF_802154_DELAYED_TRX_ENABLED
@@ -640,25 +848,31 @@ static void swi_csma_ca_start(uint8_t                                      * p_d
                               const nrf_802154_transmit_csma_ca_metadata_t * p_metadata,
                               bool                                         * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    uint32_t                pos;
+    nrf_802154_req_data_t * p_slot = req_enter(&pos);
 
     p_slot->type                          = REQ_TYPE_CSMA_CA_START;
     p_slot->data.csma_ca_start.p_data     = p_data;
     p_slot->data.csma_ca_start.p_metadata = p_metadata;
     p_slot->data.csma_ca_start.p_result   = p_result;
-    req_exit();
+    req_exit(pos);
 }
 
 void nrf_802154_request_init(void)
 {
-    nrf_802154_queue_init(&m_requests_queue,
-                          m_requests_queue_memory,
-                          sizeof(m_requests_queue_memory),
-                          sizeof(m_requests_queue_memory[0]));
+    nrf_802154_mpsc_queue_init(&m_requests_queue,
+                               m_requests_queue_memory,
+                               m_requests_queue_seq,
+                               sizeof(m_requests_queue_memory),
+                               sizeof(m_requests_queue_memory[0]));
 
     nrf_egu_int_enable(NRF_802154_EGU_INSTANCE, REQ_INT);
 
     nrf_802154_swi_init();
+
+    // The priority is set once by the SWI initialization, so it does not need to be read back
+    // from the interrupt controller on every request.
+    m_swi_priority = nrf_802154_irq_priority_get(NRF_802154_EGU_IRQN);
 }
 
 bool nrf_802154_request_sleep(nrf_802154_term_t term_lvl)
@@ -696,6 +910,26 @@ bool nrf_802154_request_transmit(nrf_802154_term_t              term_lvl,
                      notify_function)
 }
 
+#if NRF_802154_TX_PREPARE_ENABLED
+bool nrf_802154_request_transmit_prepare(uint8_t                              * p_data,
+                                         const nrf_802154_transmit_metadata_t * p_metadata)
+{
+    REQUEST_FUNCTION(nrf_802154_core_transmit_prepare,
+                     swi_transmit_prepare,
+                     p_data,
+                     p_metadata)
+}
+
+bool nrf_802154_request_transmit_commit(nrf_802154_term_t term_lvl, req_originator_t req_orig)
+{
+    REQUEST_FUNCTION(nrf_802154_core_transmit_commit,
+                     swi_transmit_commit,
+                     term_lvl,
+                     req_orig)
+}
+
+#endif // NRF_802154_TX_PREPARE_ENABLED
+
 bool nrf_802154_request_energy_detection(nrf_802154_term_t term_lvl,
                                          uint32_t          time_us)
 {
@@ -705,6 +939,17 @@ bool nrf_802154_request_energy_detection(nrf_802154_term_t term_lvl,
                      time_us)
 }
 
+bool nrf_802154_request_energy_scan(nrf_802154_term_t term_lvl,
+                                    uint32_t          channel_mask,
+                                    uint32_t          dwell_us)
+{
+    REQUEST_FUNCTION(nrf_802154_core_energy_scan,
+                     swi_energy_scan,
+                     term_lvl,
+                     channel_mask,
+                     dwell_us)
+}
+
 bool nrf_802154_request_cca(nrf_802154_term_t term_lvl)
 {
     REQUEST_FUNCTION(nrf_802154_core_cca, swi_cca, term_lvl)
@@ -782,6 +1027,42 @@ bool nrf_802154_request_receive_at(uint64_t rx_time,
     REQUEST_FUNCTION(nrf_802154_delayed_trx_receive, swi_receive_at, rx_time, timeout, channel, id);
 }
 
+bool nrf_802154_request_receive_at_periodic(uint64_t rx_time,
+                                            uint32_t period,
+                                            uint32_t timeout,
+                                            uint8_t  channel,
+                                            uint32_t count,
+                                            uint32_t id)
+{
+    REQUEST_FUNCTION(nrf_802154_delayed_trx_receive_periodic,
+                     swi_receive_at_periodic,
+                     rx_time,
+                     period,
+                     timeout,
+                     channel,
+                     count,
+                     id);
+}
+
+bool nrf_802154_request_receive_at_duty_cycled(uint64_t rx_time,
+                                               uint32_t period,
+                                               uint32_t window,
+                                               uint32_t extension,
+                                               uint8_t  channel,
+                                               uint32_t count,
+                                               uint32_t id)
+{
+    REQUEST_FUNCTION(nrf_802154_delayed_trx_receive_duty_cycled,
+                     swi_receive_at_duty_cycled,
+                     rx_time,
+                     period,
+                     window,
+                     extension,
+                     channel,
+                     count,
+                     id);
+}
+
 bool nrf_802154_request_receive_at_cancel(uint32_t id)
 {
     REQUEST_FUNCTION(nrf_802154_delayed_trx_receive_cancel, swi_receive_at_cancel, id);
@@ -801,10 +1082,11 @@ bool nrf_802154_request_csma_ca_start(uint8_t
 /**@brief Handles REQ_EVENT on NRF_802154_EGU_INSTANCE */
 static void irq_handler_req_event(void)
 {
-    while (!nrf_802154_queue_is_empty(&m_requests_queue))
+    uint32_t                pos;
+    nrf_802154_req_data_t * p_slot;
+
+    while ((p_slot = nrf_802154_mpsc_queue_pop_begin(&m_requests_queue, &pos)) != NULL)
     {
-        nrf_802154_req_data_t * p_slot =
-            (nrf_802154_req_data_t *)nrf_802154_queue_pop_begin(&m_requests_queue);
 
         switch (p_slot->type)
         {
@@ -831,6 +1113,20 @@ static void irq_handler_req_event(void)
                                              p_slot->data.transmit.notif_func);
                 break;
 
+#if NRF_802154_TX_PREPARE_ENABLED
+            case REQ_TYPE_TRANSMIT_PREPARE:
+                *(p_slot->data.transmit_prepare.p_result) =
+                    nrf_802154_core_transmit_prepare(p_slot->data.transmit_prepare.p_data,
+                                                     p_slot->data.transmit_prepare.p_metadata);
+                break;
+
+            case REQ_TYPE_TRANSMIT_COMMIT:
+                *(p_slot->data.transmit_commit.p_result) =
+                    nrf_802154_core_transmit_commit(p_slot->data.transmit_commit.term_lvl,
+                                                    p_slot->data.transmit_commit.req_orig);
+                break;
+#endif // NRF_802154_TX_PREPARE_ENABLED
+
             case REQ_TYPE_ENERGY_DETECTION:
                 *(p_slot->data.energy_detection.p_result) =
                     nrf_802154_core_energy_detection(
@@ -838,6 +1134,14 @@ static void irq_handler_req_event(void)
                         p_slot->data.energy_detection.time_us);
                 break;
 
+            case REQ_TYPE_ENERGY_SCAN:
+                *(p_slot->data.energy_scan.p_result) =
+                    nrf_802154_core_energy_scan(
+                        p_slot->data.energy_scan.term_lvl,
+                        p_slot->data.energy_scan.channel_mask,
+                        p_slot->data.energy_scan.dwell_us);
+                break;
+
             case REQ_TYPE_CCA:
                 *(p_slot->data.cca.p_result) = nrf_802154_core_cca(p_slot->data.cca.term_lvl);
                 break;
@@ -906,6 +1210,29 @@ static void irq_handler_req_event(void)
                                                    p_slot->data.receive_at.id);
                 break;
 
+            case REQ_TYPE_RECEIVE_AT_PERIODIC:
+                *(p_slot->data.receive_at_periodic.p_result) =
+                    nrf_802154_delayed_trx_receive_periodic(
+                        p_slot->data.receive_at_periodic.rx_time,
+                        p_slot->data.receive_at_periodic.period,
+                        p_slot->data.receive_at_periodic.timeout,
+                        p_slot->data.receive_at_periodic.channel,
+                        p_slot->data.receive_at_periodic.count,
+                        p_slot->data.receive_at_periodic.id);
+                break;
+
+            case REQ_TYPE_RECEIVE_AT_DUTY_CYCLED:
+                *(p_slot->data.receive_at_duty_cycled.p_result) =
+                    nrf_802154_delayed_trx_receive_duty_cycled(
+                        p_slot->data.receive_at_duty_cycled.rx_time,
+                        p_slot->data.receive_at_duty_cycled.period,
+                        p_slot->data.receive_at_duty_cycled.window,
+                        p_slot->data.receive_at_duty_cycled.extension,
+                        p_slot->data.receive_at_duty_cycled.channel,
+                        p_slot->data.receive_at_duty_cycled.count,
+                        p_slot->data.receive_at_duty_cycled.id);
+                break;
+
             case REQ_TYPE_RECEIVE_AT_CANCEL:
                 *(p_slot->data.receive_at_cancel.p_result) =
                     nrf_802154_delayed_trx_receive_cancel(p_slot->data.receive_at_cancel.id);
@@ -922,7 +1249,7 @@ static void irq_handler_req_event(void)
                 assert(false);
         }
 
-        nrf_802154_queue_pop_commit(&m_requests_queue);
+        nrf_802154_mpsc_queue_pop_commit(&m_requests_queue, pos);
     }
 }
 
@@ -38,6 +38,7 @@
  *
  */
 #include "nrf_802154_rssi.h"
+#include "nrf_802154_config.h"
 #include "nrf_802154_nrfx_addons.h"
 #include "nrf_802154_const.h"
 
@@ -49,7 +50,7 @@
 #if defined(NRF52_SERIES)
 
 /* Implementation for nRF52 family. */
-int8_t nrf_802154_rssi_sample_temp_corr_value_get(uint8_t rssi_sample)
+static int8_t temp_corr_value_calculate(uint8_t rssi_sample)
 {
     (void)rssi_sample;
 
@@ -137,7 +138,7 @@ static int8_t normalize_rssi(int32_t rssi_value)
 }
 
 /* Implementation based on Errata 87 for nRF53 family. */
-int8_t nrf_802154_rssi_sample_temp_corr_value_get(uint8_t rssi_sample)
+static int8_t temp_corr_value_calculate(uint8_t rssi_sample)
 {
     int32_t temp;
     int32_t rssi_sample_i32;
@@ -156,6 +157,38 @@ int8_t nrf_802154_rssi_sample_temp_corr_value_get(uint8_t rssi_sample)
 
 #endif
 
+#if NRF_802154_RSSI_TEMP_CORR_TABLE_ENABLED
+
+/** @brief Number of entries of the temperature correction table. */
+#define TEMP_CORR_TABLE_SIZE (UINT8_MAX + 1U)
+
+/** @brief Temperature correction values for the last reported temperature, indexed by sample. */
+static volatile int8_t m_temp_corr_table[TEMP_CORR_TABLE_SIZE];
+
+void nrf_802154_rssi_temp_corr_table_update(void)
+{
+    // Entries are updated one by one. A reader racing with the update gets a correction valid
+    // either for the previous or for the current temperature.
+    for (uint32_t i = 0U; i < TEMP_CORR_TABLE_SIZE; i++)
+    {
+        m_temp_corr_table[i] = temp_corr_value_calculate((uint8_t)i);
+    }
+}
+
+int8_t nrf_802154_rssi_sample_temp_corr_value_get(uint8_t rssi_sample)
+{
+    return m_temp_corr_table[rssi_sample];
+}
+
+#else // NRF_802154_RSSI_TEMP_CORR_TABLE_ENABLED
+
+int8_t nrf_802154_rssi_sample_temp_corr_value_get(uint8_t rssi_sample)
+{
+    return temp_corr_value_calculate(rssi_sample);
+}
+
+#endif // NRF_802154_RSSI_TEMP_CORR_TABLE_ENABLED
+
 uint8_t nrf_802154_rssi_sample_corrected_get(uint8_t rssi_sample)
 {
     return rssi_sample + nrf_802154_rssi_sample_temp_corr_value_get(rssi_sample);
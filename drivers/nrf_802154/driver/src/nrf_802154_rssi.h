@@ -37,6 +37,8 @@
 
 #include <stdint.h>
 
+#include "nrf_802154_config.h"
+
 /**
  * @defgroup nrf_802154_rssi RSSI measurement function
  * @{
@@ -55,6 +57,18 @@
  */
 int8_t nrf_802154_rssi_sample_temp_corr_value_get(uint8_t rssi_sample);
 
+#if NRF_802154_RSSI_TEMP_CORR_TABLE_ENABLED
+
+/**
+ * @brief Recalculates the temperature correction table for the last reported temperature.
+ *
+ * This function must be called during the initialization of the driver and each time
+ * the temperature reported by the platform changes.
+ */
+void nrf_802154_rssi_temp_corr_table_update(void);
+
+#endif // NRF_802154_RSSI_TEMP_CORR_TABLE_ENABLED
+
 /**
  * @brief Adjusts the given RSSISAMPLE value by a temperature correction factor.
  *
@@ -40,33 +40,315 @@
 
 #include "nrf_802154_rx_buffer.h"
 
+#include <assert.h>
 #include <stddef.h>
+#include <string.h>
 
 #include "nrf_802154_config.h"
+#include "nrf_802154_sl_atomics.h"
+#include "nrf_802154_stats.h"
+#include "hal/nrf_common.h"
 
 #if NRF_802154_RX_BUFFERS < 1
 #error Not enough rx buffers in the 802.15.4 radio driver.
 #endif
 
+#if NRF_802154_RX_BUFFER_SLAB_ENABLED
+#if NRF_802154_RX_SMALL_BUFFERS < 1
+#error Not enough small rx buffers in the 802.15.4 radio driver.
+#endif
+
+#if (NRF_802154_RX_SMALL_BUFFER_SIZE <= PHR_SIZE) || \
+    (NRF_802154_RX_SMALL_BUFFER_SIZE > (MAX_PACKET_SIZE + PHR_SIZE))
+#error Invalid size of small rx buffers in the 802.15.4 radio driver.
+#endif
+#endif
+
+#define FREE_MASK_BITS_PER_WORD 32U ///< Number of buffers tracked by a single mask word.
+#define FREE_MASK_WORDS                                    \
+    ((NRF_802154_RX_BUFFERS + FREE_MASK_BITS_PER_WORD - 1U) \
+     / FREE_MASK_BITS_PER_WORD)                            ///< Number of mask words.
+
 rx_buffer_t nrf_802154_rx_buffers[NRF_802154_RX_BUFFERS]; ///< Receive buffers.
 
-void nrf_802154_rx_buffer_init(void)
+/** Bitmap of free buffers. Bit n of word w is set if buffer (w * 32 + n) is free. */
+static uint32_t m_free_mask[FREE_MASK_WORDS];
+
+/** Number of free buffers. */
+static uint32_t m_free_count;
+
+#if NRF_802154_RX_BUFFER_SLAB_ENABLED
+
+#define SMALL_FREE_MASK_WORDS                                    \
+    ((NRF_802154_RX_SMALL_BUFFERS + FREE_MASK_BITS_PER_WORD - 1U) \
+     / FREE_MASK_BITS_PER_WORD)                                  ///< Number of small mask words.
+
+/**
+ * @brief Structure that contains a received frame short enough to be moved out of its
+ *        full-size buffer.
+ */
+typedef struct
+{
+    uint8_t data[NRF_802154_RX_SMALL_BUFFER_SIZE];
+} rx_small_buffer_t;
+
+static rx_small_buffer_t m_small_buffers[NRF_802154_RX_SMALL_BUFFERS]; ///< Small receive buffers.
+
+/** Bitmap of free small buffers, laid out like @ref m_free_mask. */
+static uint32_t m_small_free_mask[SMALL_FREE_MASK_WORDS];
+
+/**
+ * @brief Gets index of the given buffer in @ref m_small_buffers.
+ *
+ * @param[in]  p_buffer  Pointer to a buffer.
+ *
+ * @returns  Index of the buffer, or NRF_802154_RX_SMALL_BUFFERS if it is not a small buffer.
+ */
+static uint32_t small_buffer_index_get(const void * p_buffer)
+{
+    uintptr_t addr  = (uintptr_t)p_buffer;
+    uintptr_t start = (uintptr_t)&m_small_buffers[0];
+    uintptr_t end   = (uintptr_t)&m_small_buffers[NRF_802154_RX_SMALL_BUFFERS];
+
+    if ((addr < start) || (addr >= end))
+    {
+        return NRF_802154_RX_SMALL_BUFFERS;
+    }
+
+    assert(((addr - start) % sizeof(rx_small_buffer_t)) == 0U);
+
+    return (uint32_t)((addr - start) / sizeof(rx_small_buffer_t));
+}
+
+#endif // NRF_802154_RX_BUFFER_SLAB_ENABLED
+
+/**
+ * @brief Gets index of the given buffer in @ref nrf_802154_rx_buffers.
+ *
+ * @param[in]  p_buffer  Pointer to the buffer.
+ *
+ * @returns  Index of the buffer.
+ */
+static uint32_t buffer_index_get(const rx_buffer_t * p_buffer)
+{
+    uint32_t index = (uint32_t)(p_buffer - nrf_802154_rx_buffers);
+
+    assert(index < NRF_802154_RX_BUFFERS);
+
+    return index;
+}
+
+/**
+ * @brief Atomically modifies the free flag of the given buffer.
+ *
+ * @param[in]  p_mask  Bitmap the buffer is tracked in.
+ * @param[in]  index   Index of the buffer.
+ * @param[in]  free    Requested state of the buffer.
+ *
+ * @retval true   The state of the buffer changed.
+ * @retval false  The buffer was already in the requested state.
+ */
+static bool free_flag_update(uint32_t * p_mask, uint32_t index, bool free)
+{
+    uint32_t * p_word   = &p_mask[index / FREE_MASK_BITS_PER_WORD];
+    uint32_t   bit      = 1UL << (index % FREE_MASK_BITS_PER_WORD);
+    uint32_t   expected = nrf_802154_sl_atomic_load_u32(p_word);
+    uint32_t   desired;
+
+    do
+    {
+        if (((expected & bit) != 0U) == free)
+        {
+            return false;
+        }
+
+        desired = free ? (expected | bit) : (expected & ~bit);
+    }
+    while (!nrf_802154_sl_atomic_cas_u32(p_word, &expected, desired));
+
+    return true;
+}
+
+/**
+ * @brief Atomically adds a signed delta to the free buffers counter.
+ *
+ * @param[in]  delta  Value to add to the counter.
+ *
+ * @returns  Value of the counter after the update.
+ */
+static uint32_t free_count_update(int32_t delta)
+{
+    uint32_t expected = nrf_802154_sl_atomic_load_u32(&m_free_count);
+    uint32_t desired;
+
+    do
+    {
+        desired = expected + (uint32_t)delta;
+    }
+    while (!nrf_802154_sl_atomic_cas_u32(&m_free_count, &expected, desired));
+
+    return desired;
+}
+
+/**
+ * @brief Marks all buffers tracked in the given bitmap as free.
+ *
+ * @param[out]  p_mask  Bitmap to initialize.
+ * @param[in]   words   Number of words in the bitmap.
+ * @param[in]   count   Number of buffers tracked in the bitmap.
+ */
+static void free_mask_init(uint32_t * p_mask, uint32_t words, uint32_t count)
+{
+    for (uint32_t i = 0; i < words; i++)
+    {
+        p_mask[i] = 0U;
+    }
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        p_mask[i / FREE_MASK_BITS_PER_WORD] |= 1UL << (i % FREE_MASK_BITS_PER_WORD);
+    }
+}
+
+/**
+ * @brief Finds a free buffer in the given bitmap.
+ *
+ * @param[in]  p_mask  Bitmap to search.
+ * @param[in]  words   Number of words in the bitmap.
+ *
+ * @returns  Index of a free buffer, or UINT32_MAX if all buffers are in use.
+ */
+static uint32_t free_index_find(uint32_t * p_mask, uint32_t words)
 {
-    for (uint32_t i = 0; i < NRF_802154_RX_BUFFERS; i++)
+    for (uint32_t i = 0; i < words; i++)
     {
-        nrf_802154_rx_buffers[i].free = true;
+        uint32_t mask = nrf_802154_sl_atomic_load_u32(&p_mask[i]);
+
+        if (mask != 0U)
+        {
+            return i * FREE_MASK_BITS_PER_WORD + (31U - NRF_CLZ(mask));
+        }
     }
+
+    return UINT32_MAX;
+}
+
+#if NRF_802154_RX_BUFFER_SLAB_ENABLED
+
+/**
+ * @brief Atomically reserves a free small buffer.
+ *
+ * @returns  Pointer to the reserved buffer, or NULL if all small buffers are in use.
+ */
+static rx_small_buffer_t * small_buffer_claim(void)
+{
+    uint32_t index;
+
+    do
+    {
+        index = free_index_find(m_small_free_mask, SMALL_FREE_MASK_WORDS);
+
+        if (index == UINT32_MAX)
+        {
+            return NULL;
+        }
+    }
+    while (!free_flag_update(m_small_free_mask, index, false));
+
+    return &m_small_buffers[index];
+}
+
+#endif // NRF_802154_RX_BUFFER_SLAB_ENABLED
+
+void nrf_802154_rx_buffer_init(void)
+{
+    free_mask_init(m_free_mask, FREE_MASK_WORDS, NRF_802154_RX_BUFFERS);
+#if NRF_802154_RX_BUFFER_SLAB_ENABLED
+    free_mask_init(m_small_free_mask, SMALL_FREE_MASK_WORDS, NRF_802154_RX_SMALL_BUFFERS);
+#endif
+
+    nrf_802154_sl_atomic_store_u32(&m_free_count, NRF_802154_RX_BUFFERS);
+    nrf_802154_stat_watermark_write(rx_buffers_free_min, NRF_802154_RX_BUFFERS);
 }
 
 rx_buffer_t * nrf_802154_rx_buffer_free_find(void)
 {
-    for (uint32_t i = 0; i < NRF_802154_RX_BUFFERS; i++)
+    uint32_t index = free_index_find(m_free_mask, FREE_MASK_WORDS);
+
+    return (index == UINT32_MAX) ? NULL : &nrf_802154_rx_buffers[index];
+}
+
+bool nrf_802154_rx_buffer_is_free(const rx_buffer_t * p_buffer)
+{
+    uint32_t * p_mask = m_free_mask;
+    uint32_t   index;
+    uint32_t   mask;
+
+#if NRF_802154_RX_BUFFER_SLAB_ENABLED
+    index = small_buffer_index_get(p_buffer);
+
+    if (index < NRF_802154_RX_SMALL_BUFFERS)
+    {
+        p_mask = m_small_free_mask;
+    }
+    else
+#endif
+    {
+        index = buffer_index_get(p_buffer);
+    }
+
+    mask = nrf_802154_sl_atomic_load_u32(&p_mask[index / FREE_MASK_BITS_PER_WORD]);
+
+    return (mask & (1UL << (index % FREE_MASK_BITS_PER_WORD))) != 0U;
+}
+
+void nrf_802154_rx_buffer_mark_used(rx_buffer_t * p_buffer)
+{
+    if (free_flag_update(m_free_mask, buffer_index_get(p_buffer), false))
     {
-        if (nrf_802154_rx_buffers[i].free)
+        uint32_t free_count = free_count_update(-1);
+
+        nrf_802154_stat_watermark_low_update(rx_buffers_free_min, free_count);
+    }
+}
+
+void nrf_802154_rx_buffer_mark_free(rx_buffer_t * p_buffer)
+{
+#if NRF_802154_RX_BUFFER_SLAB_ENABLED
+    uint32_t small_index = small_buffer_index_get(p_buffer);
+
+    if (small_index < NRF_802154_RX_SMALL_BUFFERS)
+    {
+        (void)free_flag_update(m_small_free_mask, small_index, true);
+        return;
+    }
+#endif
+
+    if (free_flag_update(m_free_mask, buffer_index_get(p_buffer), true))
+    {
+        (void)free_count_update(1);
+    }
+}
+
+uint8_t * nrf_802154_rx_buffer_frame_commit(rx_buffer_t * p_buffer)
+{
+#if NRF_802154_RX_BUFFER_SLAB_ENABLED
+    uint32_t size = PHR_SIZE + (p_buffer->data[PHR_OFFSET] & PHR_LENGTH_MASK);
+
+    if (size <= NRF_802154_RX_SMALL_BUFFER_SIZE)
+    {
+        rx_small_buffer_t * p_small = small_buffer_claim();
+
+        if (p_small != NULL)
         {
-            return &nrf_802154_rx_buffers[i];
+            // The full-size buffer is not marked as used, so it receives the next frame.
+            memcpy(p_small->data, p_buffer->data, size);
+            return p_small->data;
         }
     }
+#endif
+
+    nrf_802154_rx_buffer_mark_used(p_buffer);
 
-    return NULL;
+    return p_buffer->data;
 }
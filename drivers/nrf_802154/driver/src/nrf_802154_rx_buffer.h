@@ -55,7 +55,6 @@ extern "C" {
 typedef struct
 {
     uint8_t data[MAX_PACKET_SIZE + 1];
-    bool    free; // If this buffer is free or contains a frame.
 } rx_buffer_t;
 
 /**
@@ -75,10 +74,58 @@ void nrf_802154_rx_buffer_init(void);
 /**
  * @brief Gets a free buffer to receive a frame.
  *
+ * The returned buffer is not reserved. It stays free until it is marked as used with
+ * @ref nrf_802154_rx_buffer_mark_used.
+ *
  * @returns  Pointer to a free buffer, or NULL if no free buffer is available.
  */
 rx_buffer_t * nrf_802154_rx_buffer_free_find(void);
 
+/**
+ * @brief Checks if the given buffer is free.
+ *
+ * @param[in]  p_buffer  Pointer to one of the buffers from @ref nrf_802154_rx_buffers, or to
+ *                       a frame returned by @ref nrf_802154_rx_buffer_frame_commit.
+ *
+ * @retval true   The buffer is free.
+ * @retval false  The buffer contains a frame.
+ */
+bool nrf_802154_rx_buffer_is_free(const rx_buffer_t * p_buffer);
+
+/**
+ * @brief Marks the given buffer as containing a received frame.
+ *
+ * Marking a buffer that is already in use has no effect.
+ *
+ * @param[in]  p_buffer  Pointer to one of the buffers from @ref nrf_802154_rx_buffers.
+ */
+void nrf_802154_rx_buffer_mark_used(rx_buffer_t * p_buffer);
+
+/**
+ * @brief Marks the given buffer as free.
+ *
+ * Marking a buffer that is already free has no effect.
+ *
+ * @param[in]  p_buffer  Pointer to one of the buffers from @ref nrf_802154_rx_buffers, or to
+ *                       a frame returned by @ref nrf_802154_rx_buffer_frame_commit.
+ */
+void nrf_802154_rx_buffer_mark_free(rx_buffer_t * p_buffer);
+
+/**
+ * @brief Keeps the frame received to the given buffer until it is freed.
+ *
+ * If @ref NRF_802154_RX_BUFFER_SLAB_ENABLED is set and the frame fits in a free small buffer,
+ * the frame is copied there and @p p_buffer stays free for the next reception. Otherwise
+ * @p p_buffer is marked as used, as with @ref nrf_802154_rx_buffer_mark_used.
+ *
+ * @param[in]  p_buffer  Pointer to one of the buffers from @ref nrf_802154_rx_buffers containing
+ *                       a received frame.
+ *
+ * @returns  Pointer to the kept frame, to be passed to @ref nrf_802154_rx_buffer_mark_free
+ *           once the frame is no longer needed.
+ */
+uint8_t * nrf_802154_rx_buffer_frame_commit(rx_buffer_t * p_buffer);
+
 #ifdef __cplusplus
 }
 #endif
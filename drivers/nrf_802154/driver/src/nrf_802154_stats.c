@@ -37,8 +37,18 @@
 #include "nrf_802154.h"
 #include "nrf_802154_stats.h"
 
+#if NRF_802154_STAT_WINDOW_ENABLED
+#include <string.h>
+
+#include "nrf_802154_sl_atomics.h"
+#include "nrf_802154_sl_timer.h"
+#endif
+
 #define NUMBER_OF_STAT_COUNTERS (sizeof(nrf_802154_stat_counters_t) / sizeof(uint32_t))
 #define NUMBER_OF_STAT_TOTALS   (sizeof(nrf_802154_stat_totals_t) / sizeof(uint64_t))
+#define NUMBER_OF_WATERMARKS    (sizeof(nrf_802154_stat_watermarks_t) / sizeof(uint32_t))
+#define NUMBER_OF_CONGESTION_RATES \
+    (sizeof(nrf_802154_stat_congestion_t) / sizeof(uint32_t))
 
 /**@brief Structure holding statistics about the Radio Driver behavior. */
 volatile nrf_802154_stats_t g_nrf_802154_stats;
@@ -46,6 +56,34 @@ volatile nrf_802154_stats_t g_nrf_802154_stats;
 /**@brief Structure holding total times spent in certain states. */
 volatile nrf_802154_stat_totals_t g_nrf_802154_stat_totals;
 
+#if NRF_802154_STAT_WINDOW_ENABLED
+
+/**@brief Number of banks the windowed statistics are gathered in. */
+#define STAT_WINDOW_BANK_COUNT 2U
+
+/**@brief Structure holding the event counts of a statistics window. */
+typedef struct
+{
+    uint32_t rx_frames;                                                         ///< Number of received frames.
+    uint32_t tx_frames;                                                         ///< Number of transmitted frames.
+    uint32_t acks_transmitted;                                                  ///< Number of transmitted ACK frames.
+    uint32_t acks_received;                                                     ///< Number of received ACK frames.
+    uint32_t cca_failed_attempts;                                               ///< Number of failed CCA attempts.
+    uint32_t rssi_histogram[NRF_802154_STAT_WINDOW_RSSI_BUCKETS];               ///< Histogram of the RSSI of received frames.
+    uint32_t csma_backoff_histogram[NRF_802154_STAT_WINDOW_CSMA_BACKOFF_BUCKETS]; ///< Histogram of CSMA-CA backoffs.
+    uint32_t noise_samples;                                                     ///< Number of RSSI samples of the idle channel.
+    uint32_t noise_histogram[NRF_802154_STAT_WINDOW_RSSI_BUCKETS];              ///< Histogram of the RSSI of the idle channel.
+} stat_window_bank_t;
+
+// The events are counted in the active bank. A snapshot switches the active bank first and then
+// reads and clears the previous one, so the counting never has to be blocked.
+static stat_window_bank_t       m_window_banks[STAT_WINDOW_BANK_COUNT]; ///< Banks of event counts.
+static uint32_t                 m_window_bank_active;                   ///< Index of the bank the events are counted in.
+static uint64_t                 m_window_start;                         ///< Time when the current window started.
+static nrf_802154_stat_totals_t m_window_totals_start;                  ///< Total times when the current window started.
+
+#endif // NRF_802154_STAT_WINDOW_ENABLED
+
 void nrf_802154_stats_get(nrf_802154_stats_t * p_stats)
 {
     *p_stats = g_nrf_802154_stats;
@@ -89,6 +127,36 @@ void nrf_802154_stat_counters_reset(void)
     }
 }
 
+void nrf_802154_stat_watermarks_get(nrf_802154_stat_watermarks_t * p_stat_watermarks)
+{
+    *p_stat_watermarks = g_nrf_802154_stats.watermarks;
+}
+
+void nrf_802154_stat_watermarks_reset(void)
+{
+    volatile uint32_t * p_dst = (volatile uint32_t *)(&g_nrf_802154_stats.watermarks);
+
+    for (size_t i = 0; i < NUMBER_OF_WATERMARKS; ++i)
+    {
+        *(p_dst++) = UINT32_MAX;
+    }
+}
+
+void nrf_802154_stat_congestion_get(nrf_802154_stat_congestion_t * p_stat_congestion)
+{
+    *p_stat_congestion = g_nrf_802154_stats.congestion;
+}
+
+void nrf_802154_stat_congestion_reset(void)
+{
+    volatile uint32_t * p_dst = (volatile uint32_t *)(&g_nrf_802154_stats.congestion);
+
+    for (size_t i = 0; i < NUMBER_OF_CONGESTION_RATES; ++i)
+    {
+        *(p_dst++) = 0U;
+    }
+}
+
 void nrf_802154_stat_totals_get(nrf_802154_stat_totals_t * p_stat_totals)
 {
     volatile uint64_t * p_dst = (volatile uint64_t *)p_stat_totals;
@@ -117,3 +185,130 @@ __WEAK void nrf_802154_stat_totals_get_notify(void)
      * to hold state until the moment of call.
      */
 }
+
+#if NRF_802154_STAT_WINDOW_ENABLED
+
+/**@brief Gets the bank the events of the current statistics window are counted in. */
+static stat_window_bank_t * window_bank_active_get(void)
+{
+    return &m_window_banks[nrf_802154_sl_atomic_load_u32(&m_window_bank_active)];
+}
+
+/**@brief Atomically increments a counter of a statistics window.
+ *
+ * @param[inout] p_value  Pointer to the counter to increment.
+ */
+static void window_counter_increment(uint32_t * p_value)
+{
+    uint32_t value = nrf_802154_sl_atomic_load_u32(p_value);
+
+    while (!nrf_802154_sl_atomic_cas_u32(p_value, &value, value + 1U))
+    {
+        // Retry with the updated value
+    }
+}
+
+/**@brief Gets the bucket of the RSSI histogram that the given RSSI falls into.
+ *
+ * @param[in] rssi  RSSI in dBm.
+ *
+ * @return Index of the bucket.
+ */
+static uint8_t window_rssi_bucket_get(int8_t rssi)
+{
+    int32_t offset = (int32_t)rssi - NRF_802154_STAT_WINDOW_RSSI_BUCKET_MIN;
+
+    if (offset < 0)
+    {
+        return 0U;
+    }
+
+    uint32_t bucket = 1U + (uint32_t)offset / NRF_802154_STAT_WINDOW_RSSI_BUCKET_WIDTH;
+
+    return (bucket < NRF_802154_STAT_WINDOW_RSSI_BUCKETS) ?
+           (uint8_t)bucket : (uint8_t)(NRF_802154_STAT_WINDOW_RSSI_BUCKETS - 1U);
+}
+
+void nrf_802154_stat_window_rx_frame_record(int8_t rssi)
+{
+    stat_window_bank_t * p_bank = window_bank_active_get();
+
+    window_counter_increment(&p_bank->rx_frames);
+    window_counter_increment(&p_bank->rssi_histogram[window_rssi_bucket_get(rssi)]);
+}
+
+void nrf_802154_stat_window_tx_frame_record(void)
+{
+    window_counter_increment(&window_bank_active_get()->tx_frames);
+}
+
+void nrf_802154_stat_window_ack_tx_record(void)
+{
+    window_counter_increment(&window_bank_active_get()->acks_transmitted);
+}
+
+void nrf_802154_stat_window_ack_rx_record(void)
+{
+    window_counter_increment(&window_bank_active_get()->acks_received);
+}
+
+void nrf_802154_stat_window_cca_fail_record(void)
+{
+    window_counter_increment(&window_bank_active_get()->cca_failed_attempts);
+}
+
+void nrf_802154_stat_window_csma_ca_record(uint8_t backoffs)
+{
+    uint8_t bucket = (backoffs < NRF_802154_STAT_WINDOW_CSMA_BACKOFF_BUCKETS) ?
+                     backoffs : (uint8_t)(NRF_802154_STAT_WINDOW_CSMA_BACKOFF_BUCKETS - 1U);
+
+    window_counter_increment(&window_bank_active_get()->csma_backoff_histogram[bucket]);
+}
+
+void nrf_802154_stat_window_noise_record(int8_t rssi)
+{
+    stat_window_bank_t * p_bank = window_bank_active_get();
+
+    window_counter_increment(&p_bank->noise_samples);
+    window_counter_increment(&p_bank->noise_histogram[window_rssi_bucket_get(rssi)]);
+}
+
+void nrf_802154_stat_window_snapshot(nrf_802154_stat_window_t * p_window)
+{
+    uint32_t                 ended  = nrf_802154_sl_atomic_load_u32(&m_window_bank_active);
+    uint64_t                 now    = nrf_802154_sl_timer_current_time_get();
+    stat_window_bank_t     * p_bank = &m_window_banks[ended];
+    nrf_802154_stat_totals_t totals;
+
+    // Events that happen from now on are counted in the next window
+    nrf_802154_sl_atomic_store_u32(&m_window_bank_active, (ended + 1U) % STAT_WINDOW_BANK_COUNT);
+
+    nrf_802154_stat_totals_get(&totals);
+
+    p_window->duration            = now - m_window_start;
+    p_window->listening_time      = totals.total_listening_time -
+                                    m_window_totals_start.total_listening_time;
+    p_window->receive_time        = totals.total_receive_time -
+                                    m_window_totals_start.total_receive_time;
+    p_window->transmit_time       = totals.total_transmit_time -
+                                    m_window_totals_start.total_transmit_time;
+    p_window->rx_frames           = p_bank->rx_frames;
+    p_window->tx_frames           = p_bank->tx_frames;
+    p_window->acks_transmitted    = p_bank->acks_transmitted;
+    p_window->acks_received       = p_bank->acks_received;
+    p_window->cca_failed_attempts = p_bank->cca_failed_attempts;
+    p_window->noise_samples       = p_bank->noise_samples;
+
+    memcpy(p_window->rssi_histogram, p_bank->rssi_histogram, sizeof(p_window->rssi_histogram));
+    memcpy(p_window->csma_backoff_histogram,
+           p_bank->csma_backoff_histogram,
+           sizeof(p_window->csma_backoff_histogram));
+    memcpy(p_window->noise_histogram, p_bank->noise_histogram, sizeof(p_window->noise_histogram));
+
+    memset(p_bank, 0, sizeof(*p_bank));
+
+    m_window_start        = now;
+    m_window_totals_start = totals;
+}
+
+#endif // NRF_802154_STAT_WINDOW_ENABLED
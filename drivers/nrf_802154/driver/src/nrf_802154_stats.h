@@ -35,6 +35,9 @@
 #ifndef NRF_802154_STATS_H_
 #define NRF_802154_STATS_H_
 
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
 #include "nrf_802154_types.h"
 #include "nrf_802154_utils.h"
 
@@ -87,6 +90,85 @@ extern volatile nrf_802154_stat_totals_t g_nrf_802154_stat_totals;
     }                                                           \
     while (0)
 
+/**@brief Write one of the @ref nrf_802154_stat_watermarks_t fields.
+ *
+ * @param field_name    Identifier of struct member to write
+ * @param value         Value to write
+ */
+#define nrf_802154_stat_watermark_write(field_name, value)    \
+    do                                                        \
+    {                                                         \
+        nrf_802154_mcu_critical_state_t mcu_cs;               \
+                                                              \
+        nrf_802154_mcu_critical_enter(mcu_cs);                \
+        (g_nrf_802154_stats.watermarks.field_name) = (value); \
+        nrf_802154_mcu_critical_exit(mcu_cs);                 \
+    }                                                         \
+    while (0)
+
+/**@brief Lower one of the @ref nrf_802154_stat_watermarks_t fields if @p value is smaller.
+ *
+ * @param field_name    Identifier of struct member to update
+ * @param value         Currently observed value
+ */
+#define nrf_802154_stat_watermark_low_update(field_name, value)     \
+    do                                                              \
+    {                                                               \
+        nrf_802154_mcu_critical_state_t mcu_cs;                     \
+                                                                    \
+        nrf_802154_mcu_critical_enter(mcu_cs);                      \
+        if ((value) < g_nrf_802154_stats.watermarks.field_name)     \
+        {                                                           \
+            (g_nrf_802154_stats.watermarks.field_name) = (value);   \
+        }                                                           \
+        nrf_802154_mcu_critical_exit(mcu_cs);                       \
+    }                                                               \
+    while (0)
+
+/**@brief Write the congestion rate of a channel in @ref nrf_802154_stat_congestion_t.
+ *
+ * @param channel  Channel number, from 11 to 26.
+ * @param value    Congestion rate to write.
+ */
+#define nrf_802154_stat_congestion_rate_write(channel, value)                    \
+    do                                                                            \
+    {                                                                             \
+        nrf_802154_mcu_critical_state_t mcu_cs;                                   \
+                                                                                  \
+        nrf_802154_mcu_critical_enter(mcu_cs);                                    \
+        g_nrf_802154_stats.congestion.cca_busy_rate[(channel) - 11U] = (value);   \
+        nrf_802154_mcu_critical_exit(mcu_cs);                                     \
+    }                                                                             \
+    while (0)
+
+/**@brief Read the congestion rate of a channel from @ref nrf_802154_stat_congestion_t. */
+#define nrf_802154_stat_congestion_rate_read(variable, channel)                  \
+    do                                                                            \
+    {                                                                             \
+        nrf_802154_mcu_critical_state_t mcu_cs;                                   \
+                                                                                  \
+        nrf_802154_mcu_critical_enter(mcu_cs);                                    \
+        *(variable) = g_nrf_802154_stats.congestion.cca_busy_rate[(channel) - 11U]; \
+        nrf_802154_mcu_critical_exit(mcu_cs);                                     \
+    }                                                                             \
+    while (0)
+
+/**@brief Write the calibrated CCA ED threshold of a channel in @ref nrf_802154_stat_congestion_t.
+ *
+ * @param channel  Channel number, from 11 to 26.
+ * @param value    Threshold to write.
+ */
+#define nrf_802154_stat_congestion_ed_threshold_write(channel, value)              \
+    do                                                                              \
+    {                                                                               \
+        nrf_802154_mcu_critical_state_t mcu_cs;                                     \
+                                                                                    \
+        nrf_802154_mcu_critical_enter(mcu_cs);                                      \
+        g_nrf_802154_stats.congestion.cca_ed_threshold[(channel) - 11U] = (value);  \
+        nrf_802154_mcu_critical_exit(mcu_cs);                                       \
+    }                                                                               \
+    while (0)
+
 #define nrf_802154_stat_totals_increment(field_name, value) \
     do                                                      \
     {                                                       \
@@ -113,11 +195,104 @@ extern void nrf_802154_stat_totals_get_notify(void);
     *(variable) = nrf_802154_stat_timestamp_read_func(offsetof(nrf_802154_stat_timestamps_t, \
                                                                field_name))
 
+#define nrf_802154_stat_watermark_write(field_name, value)                                   \
+    nrf_802154_stat_watermark_write_func(offsetof(nrf_802154_stat_watermarks_t, field_name), \
+                                         (value))
+
+#define nrf_802154_stat_watermark_low_update(field_name, value)                                   \
+    nrf_802154_stat_watermark_low_update_func(offsetof(nrf_802154_stat_watermarks_t, field_name), \
+                                              (value))
+
+#define nrf_802154_stat_congestion_rate_write(channel, value) \
+    nrf_802154_stat_congestion_rate_write_func((channel), (value))
+
+#define nrf_802154_stat_congestion_rate_read(variable, channel) \
+    *(variable) = nrf_802154_stat_congestion_rate_read_func(channel)
+
+#define nrf_802154_stat_congestion_ed_threshold_write(channel, value) \
+    nrf_802154_stat_congestion_ed_threshold_write_func((channel), (value))
+
 // Functions for which mocks are generated.
 void nrf_802154_stat_counter_increment_func(size_t field_offset);
 void nrf_802154_stat_timestamp_write_func(size_t field_offset, uint64_t value);
 uint64_t nrf_802154_stat_timestamp_read_func(size_t field_offset);
+void nrf_802154_stat_watermark_write_func(size_t field_offset, uint32_t value);
+void nrf_802154_stat_watermark_low_update_func(size_t field_offset, uint32_t value);
+void nrf_802154_stat_congestion_rate_write_func(uint8_t channel, uint32_t value);
+uint32_t nrf_802154_stat_congestion_rate_read_func(uint8_t channel);
+void nrf_802154_stat_congestion_ed_threshold_write_func(uint8_t channel, uint32_t value);
 
 #endif // !defined(UNIT_TEST)
 
+#if NRF_802154_STAT_WINDOW_ENABLED
+
+/**@brief Records a received frame in the current statistics window.
+ *
+ * @param rssi  RSSI of the received frame in dBm.
+ */
+void nrf_802154_stat_window_rx_frame_record(int8_t rssi);
+
+/**@brief Records a transmitted frame in the current statistics window. */
+void nrf_802154_stat_window_tx_frame_record(void);
+
+/**@brief Records a transmitted ACK frame in the current statistics window. */
+void nrf_802154_stat_window_ack_tx_record(void);
+
+/**@brief Records a received ACK frame in the current statistics window. */
+void nrf_802154_stat_window_ack_rx_record(void);
+
+/**@brief Records a failed CCA attempt in the current statistics window. */
+void nrf_802154_stat_window_cca_fail_record(void);
+
+/**@brief Records a finished CSMA-CA procedure in the current statistics window.
+ *
+ * @param backoffs  Number of backoffs performed by the procedure.
+ */
+void nrf_802154_stat_window_csma_ca_record(uint8_t backoffs);
+
+/**@brief Records an RSSI sample of the idle channel in the current statistics window.
+ *
+ * @param rssi  Sampled RSSI in dBm.
+ */
+void nrf_802154_stat_window_noise_record(int8_t rssi);
+
+#else // NRF_802154_STAT_WINDOW_ENABLED
+
+static inline void nrf_802154_stat_window_rx_frame_record(int8_t rssi)
+{
+    (void)rssi;
+}
+
+static inline void nrf_802154_stat_window_tx_frame_record(void)
+{
+    // Intentionally empty
+}
+
+static inline void nrf_802154_stat_window_ack_tx_record(void)
+{
+    // Intentionally empty
+}
+
+static inline void nrf_802154_stat_window_ack_rx_record(void)
+{
+    // Intentionally empty
+}
+
+static inline void nrf_802154_stat_window_cca_fail_record(void)
+{
+    // Intentionally empty
+}
+
+static inline void nrf_802154_stat_window_csma_ca_record(uint8_t backoffs)
+{
+    (void)backoffs;
+}
+
+static inline void nrf_802154_stat_window_noise_record(int8_t rssi)
+{
+    (void)rssi;
+}
+
+#endif // NRF_802154_STAT_WINDOW_ENABLED
+
 #endif /* NRF_802154_STATS_H_ */
@@ -47,6 +47,7 @@
 #include "compiler_abstraction.h"
 #include "nrf_802154.h"
 #include "nrf_802154_config.h"
+#include "nrf_802154_profiler.h"
 #include "platform/nrf_802154_irq.h"
 
 #if NRF_802154_INTERNAL_SWI_IRQ_HANDLING
@@ -73,9 +74,13 @@ __WEAK void nrf_802154_request_swi_irq_handler(void)
 
 static void swi_irq_handler(void)
 {
+    uint32_t profile_start = nrf_802154_profiler_begin();
+
     nrf_802154_trx_swi_irq_handler();
     nrf_802154_notification_swi_irq_handler();
     nrf_802154_request_swi_irq_handler();
+
+    nrf_802154_profiler_end(NRF_802154_PROFILE_POINT_SWI_IRQ, profile_start);
 }
 
 void nrf_802154_swi_init(void)
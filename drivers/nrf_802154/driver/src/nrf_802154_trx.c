@@ -39,11 +39,15 @@
 #include <assert.h>
 #include <string.h>
 
+#include "nrf_802154_ant_div_tx.h"
 #include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
+#include "nrf_802154_noise_monitor.h"
 #include "nrf_802154_peripherals.h"
 #include "nrf_802154_pib.h"
+#include "nrf_802154_profiler.h"
 #include "nrf_802154_rssi.h"
+#include "nrf_802154_stats.h"
 #include "nrf_802154_swi.h"
 #include "nrf_802154_trx_ppi_api.h"
 #include "nrf_802154_utils.h"
@@ -71,6 +75,12 @@
 #define EGU_SYNC_TASK         NRF_EGU_TASK_TRIGGER3
 #define EGU_SYNC_INTMASK      NRF_EGU_INT_TRIGGERED3
 
+#if NRF_802154_ACK_TIMEOUT_HW_ENABLED
+#define EGU_ACK_TIMEOUT_EVENT   NRF_EGU_EVENT_TRIGGERED4
+#define EGU_ACK_TIMEOUT_TASK    NRF_EGU_TASK_TRIGGER4
+#define EGU_ACK_TIMEOUT_INTMASK NRF_EGU_INT_TRIGGERED4
+#endif
+
 #if defined(NRF52840_XXAA) || \
     defined(NRF52833_XXAA)
 #define PPI_CCAIDLE_FEM       NRF_802154_PPI_RADIO_CCAIDLE_TO_FEM_GPIOTE ///< PPI that connects RADIO CCAIDLE event with GPIOTE tasks used by FEM
@@ -203,6 +213,10 @@ typedef struct
     bool          tx_started;             ///< If the requested transmission has started.
     bool          rssi_started;
     volatile bool rssi_settled;
+    bool          rx_fast_rearm;          ///< If the receiver ramp-up is triggered by the end of ACK transmission.
+#if NRF_802154_ACK_TIMEOUT_HW_ENABLED
+    bool          ack_timeout_hw_armed;   ///< If the ACK waiting window is enforced by TIMER compare.
+#endif
 } nrf_802154_flags_t;
 
 static nrf_802154_flags_t m_flags; ///< Flags used to store the current driver state.
@@ -211,6 +225,31 @@ static nrf_802154_flags_t m_flags; ///< Flags used to store the current driver s
 static volatile uint32_t m_timer_value_on_radio_end_event;
 static volatile bool     m_transmit_with_cca;
 
+#if NRF_802154_ACK_TIMEOUT_HW_ENABLED
+static uint32_t m_ack_timeout_hw; ///< ACK waiting window enforced by hardware [us], 0 if disabled.
+#endif
+
+static nrf_radio_config_t m_radio_config;       ///< RADIO configuration applied when the trx is enabled.
+static nrf_radio_config_t m_radio_config_reset; ///< RADIO configuration right after the reset.
+static bool               m_radio_config_valid; ///< If @c m_radio_config has been captured.
+
+#if NRF_802154_LIGHT_SLEEP_ENABLED
+static bool m_light_sleep;           ///< If the RADIO configuration is retained while disabled.
+static bool m_radio_config_retained; ///< If the RADIO was left configured when disabled.
+#endif
+
+#if NRF_802154_FEM_CONFIG_CACHE_ENABLED
+typedef struct
+{
+    mpsl_fem_gain_t pa_gain;       ///< FEM PA gain last passed to the FEM.
+    bool            pa_gain_valid; ///< If @c pa_gain holds the gain currently set in the FEM.
+    bool            pa_disabled;   ///< If the FEM reported its PA disabled.
+    bool            lna_disabled;  ///< If the FEM reported its LNA disabled.
+} fem_config_cache_t;
+
+static fem_config_cache_t m_fem_cache; ///< FEM configuration results kept between operations.
+#endif
+
 static void timer_frequency_set_1mhz(void);
 
 static void rxframe_finish_disable_ppis(void);
@@ -340,6 +379,11 @@ static void cca_configuration_update(void)
     nrf_802154_cca_cfg_t cca_cfg;
 
     nrf_802154_pib_cca_cfg_get(&cca_cfg);
+#if NRF_802154_CCA_ED_CALIBRATION_ENABLED
+    // Channels that have not been sampled yet keep the configured threshold.
+    (void)nrf_802154_noise_monitor_cca_ed_threshold_get(nrf_802154_pib_channel_get(),
+                                                        &cca_cfg.ed_threshold);
+#endif
     nrf_radio_cca_configure(NRF_RADIO,
                             cca_cfg.mode,
                             nrf_802154_rssi_cca_ed_threshold_corrected_get(cca_cfg.ed_threshold),
@@ -367,16 +411,96 @@ static void trigger_disable_to_start_rampup(void)
     }
 }
 
-/** Configure FEM to set LNA at appropriate time. */
-static void fem_for_lna_set(void)
+/** Drop the cached FEM configuration results. */
+static void fem_cache_reset(void)
+{
+#if NRF_802154_FEM_CONFIG_CACHE_ENABLED
+    memset(&m_fem_cache, 0, sizeof(m_fem_cache));
+#endif
+}
+
+/** Set FEM PA gain unless the same gain is already set. */
+static void fem_pa_gain_set(const mpsl_fem_gain_t * p_fem_gain_data)
+{
+#if NRF_802154_FEM_CONFIG_CACHE_ENABLED
+    if (m_fem_cache.pa_gain_valid &&
+        (m_fem_cache.pa_gain.gain_db == p_fem_gain_data->gain_db) &&
+        (m_fem_cache.pa_gain.private_setting == p_fem_gain_data->private_setting))
+    {
+        return;
+    }
+
+    m_fem_cache.pa_gain_valid = (mpsl_fem_pa_gain_set(p_fem_gain_data) == 0);
+    m_fem_cache.pa_gain       = *p_fem_gain_data;
+#else
+    (void)mpsl_fem_pa_gain_set(p_fem_gain_data);
+#endif
+}
+
+/** Configure FEM PA unless the FEM already reported its PA disabled.
+ *
+ * @return Result of @ref mpsl_fem_pa_configuration_set.
+ */
+static int32_t fem_pa_configuration_set(const mpsl_fem_event_t * p_activate_event,
+                                        const mpsl_fem_event_t * p_deactivate_event)
 {
-    if (mpsl_fem_lna_configuration_set(&m_activate_rx_cc0, NULL) == 0)
+#if NRF_802154_FEM_CONFIG_CACHE_ENABLED
+    if (m_fem_cache.pa_disabled)
+    {
+        return -NRF_EPERM;
+    }
+
+    int32_t result = mpsl_fem_pa_configuration_set(p_activate_event, p_deactivate_event);
+
+    m_fem_cache.pa_disabled = (result == -NRF_EPERM);
+
+    return result;
+#else
+    return mpsl_fem_pa_configuration_set(p_activate_event, p_deactivate_event);
+#endif
+}
+
+/** Configure FEM LNA unless the FEM already reported its LNA disabled.
+ *
+ * @return Result of @ref mpsl_fem_lna_configuration_set.
+ */
+static int32_t fem_lna_configuration_set(const mpsl_fem_event_t * p_activate_event,
+                                         const mpsl_fem_event_t * p_deactivate_event)
+{
+#if NRF_802154_FEM_CONFIG_CACHE_ENABLED
+    if (m_fem_cache.lna_disabled)
+    {
+        return -NRF_EPERM;
+    }
+
+    int32_t result = mpsl_fem_lna_configuration_set(p_activate_event, p_deactivate_event);
+
+    m_fem_cache.lna_disabled = (result == -NRF_EPERM);
+
+    return result;
+#else
+    return mpsl_fem_lna_configuration_set(p_activate_event, p_deactivate_event);
+#endif
+}
+
+/** Configure FEM to set LNA at appropriate time.
+ *
+ * @retval true   The LNA activation has been configured and TIMER is used by the FEM.
+ * @retval false  The LNA activation has not been configured.
+ */
+static bool fem_for_lna_set(void)
+{
+    if (fem_lna_configuration_set(&m_activate_rx_cc0, NULL) == 0)
     {
         nrf_timer_shorts_enable(m_activate_rx_cc0.event.timer.p_timer_instance,
                                 NRF_TIMER_SHORT_COMPARE0_STOP_MASK);
 
         nrf_802154_trx_ppi_for_fem_set();
+
+        return true;
     }
+
+    return false;
 }
 
 /** Reset FEM configuration for LNA. */
@@ -399,8 +523,8 @@ static void fem_for_lna_reset(void)
  */
 static void fem_for_pa_set(const mpsl_fem_gain_t * p_fem_gain_data)
 {
-    (void)mpsl_fem_pa_gain_set(p_fem_gain_data);
-    if (mpsl_fem_pa_configuration_set(&m_activate_tx_cc0, NULL) == 0)
+    fem_pa_gain_set(p_fem_gain_data);
+    if (fem_pa_configuration_set(&m_activate_tx_cc0, NULL) == 0)
     {
         nrf_timer_shorts_enable(m_activate_tx_cc0.event.timer.p_timer_instance,
                                 NRF_TIMER_SHORT_COMPARE0_STOP_MASK);
@@ -430,19 +554,19 @@ static void fem_for_tx_set(bool cca, const mpsl_fem_gain_t * p_fem_gain_data)
 {
     bool success;
 
-    (void)mpsl_fem_pa_gain_set(p_fem_gain_data);
+    fem_pa_gain_set(p_fem_gain_data);
 
     if (cca)
     {
         bool pa_set  = false;
         bool lna_set = false;
 
-        if (mpsl_fem_lna_configuration_set(&m_activate_rx_cc0, &m_ccaidle) == 0)
+        if (fem_lna_configuration_set(&m_activate_rx_cc0, &m_ccaidle) == 0)
         {
             lna_set = true;
         }
 
-        if (mpsl_fem_pa_configuration_set(&m_ccaidle, NULL) == 0)
+        if (fem_pa_configuration_set(&m_ccaidle, NULL) == 0)
         {
             pa_set = true;
         }
@@ -452,7 +576,7 @@ static void fem_for_tx_set(bool cca, const mpsl_fem_gain_t * p_fem_gain_data)
     }
     else
     {
-        success = (mpsl_fem_pa_configuration_set(&m_activate_tx_cc0, NULL) == 0);
+        success = (fem_pa_configuration_set(&m_activate_tx_cc0, NULL) == 0);
     }
 
     if (success)
@@ -568,12 +692,124 @@ static inline void wait_until_radio_is_disabled(void)
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
 }
 
+#if NRF_802154_FAST_RX_REARM_ENABLED
+
+/** Wait until the RADIO finishes ramping down after the ACK transmission. */
+static void rx_fast_rearm_ramp_down_wait(void)
+{
+    while (nrf_radio_state_get(NRF_RADIO) == NRF_RADIO_STATE_TXDISABLE)
+    {
+        // Intentionally empty: the ramp-down lasts 21 us at most.
+    }
+
+    nrf_802154_trx_ppi_for_ramp_up_propagation_delay_wait();
+}
+
+/** Cancel the receiver ramp-up triggered by the end of ACK transmission. */
+static void rx_fast_rearm_cancel(void)
+{
+    m_flags.rx_fast_rearm = false;
+
+    rx_fast_rearm_ramp_down_wait();
+
+    nrf_802154_trx_ppi_for_ramp_up_clear(NRF_RADIO_TASK_RXEN, true);
+
+    nrf_radio_task_trigger(NRF_RADIO, NRF_RADIO_TASK_DISABLE);
+    nrf_timer_task_trigger(NRF_802154_TIMER_INSTANCE, NRF_TIMER_TASK_SHUTDOWN);
+}
+
+#endif // NRF_802154_FAST_RX_REARM_ENABLED
+
+/** Configure the RADIO for 802.15.4 operation through the register setters. */
+static void radio_config_set(void)
+{
+    nrf_radio_packet_conf_t packet_conf;
+
+    nrf_radio_mode_set(NRF_RADIO, NRF_RADIO_MODE_IEEE802154_250KBIT);
+
+#if defined(NRF5340_XXAA)
+    // Apply ERRATA-117 after setting RADIO mode to NRF_RADIO_MODE_IEEE802154_250KBIT.
+    errata_117_apply();
+#endif
+
+    memset(&packet_conf, 0, sizeof(packet_conf));
+    packet_conf.lflen  = 8;
+    packet_conf.plen   = NRF_RADIO_PREAMBLE_LENGTH_32BIT_ZERO;
+    packet_conf.crcinc = true;
+    packet_conf.maxlen = MAX_PACKET_SIZE;
+    nrf_radio_packet_configure(NRF_RADIO, &packet_conf);
+
+#if defined(RADIO_MODECNF0_RU_Msk)
+    nrf_radio_modecnf0_set(NRF_RADIO, true, 0);
+#endif
+
+    // Configure CRC
+    nrf_radio_crc_configure(NRF_RADIO, CRC_LENGTH, NRF_RADIO_CRC_ADDR_IEEE802154, CRC_POLYNOMIAL);
+}
+
+/** Configure the RADIO for 802.15.4 operation right after the peripheral reset.
+ *
+ * The first call configures the RADIO through the register setters and captures both the reset
+ * and the resulting configuration. Subsequent calls write only the registers whose values differ
+ * from the reset ones, skipping the encoding of the configuration.
+ */
+static void radio_config_apply(void)
+{
+    if (!m_radio_config_valid)
+    {
+        nrf_radio_config_get(NRF_RADIO, &m_radio_config_reset);
+        radio_config_set();
+        nrf_radio_config_get(NRF_RADIO, &m_radio_config);
+        m_radio_config_valid = true;
+    }
+    else
+    {
+        nrf_radio_config_t shadow = m_radio_config_reset;
+
+        nrf_radio_config_apply(NRF_RADIO, &m_radio_config, &shadow);
+
+#if defined(NRF5340_XXAA)
+        // Apply ERRATA-117 after setting RADIO mode to NRF_RADIO_MODE_IEEE802154_250KBIT.
+        errata_117_apply();
+#endif
+    }
+}
+
+#if NRF_802154_LIGHT_SLEEP_ENABLED
+
+/** Check if the RADIO still holds the configuration it was left with when disabled.
+ *
+ * The RADIO may have been used by other drivers while the trx module was disabled, so
+ * the configuration registers are compared with the captured configuration.
+ */
+static bool radio_config_is_retained(void)
+{
+    nrf_radio_config_t current;
+
+    if (!m_radio_config_retained)
+    {
+        return false;
+    }
+
+    m_radio_config_retained = false;
+
+    nrf_radio_config_get(NRF_RADIO, &current);
+
+    return memcmp(&current, &m_radio_config, sizeof(current)) == 0;
+}
+
+#endif // NRF_802154_LIGHT_SLEEP_ENABLED
+
 void nrf_802154_trx_module_reset(void)
 {
     m_trx_state                      = TRX_STATE_DISABLED;
     m_timer_value_on_radio_end_event = 0;
     m_transmit_with_cca              = false;
     mp_receive_buffer                = NULL;
+    m_radio_config_valid             = false;
+#if NRF_802154_LIGHT_SLEEP_ENABLED
+    m_radio_config_retained = false;
+#endif
 
     memset(&m_flags, 0, sizeof(m_flags));
 }
@@ -597,43 +833,30 @@ void nrf_802154_trx_enable(void)
 
     assert(m_trx_state == TRX_STATE_DISABLED);
 
+    fem_cache_reset();
+
     nrf_timer_init();
-    nrf_radio_reset();
 
-#if defined(NRF52840_XXAA) || \
-    defined(NRF52833_XXAA)
-    // Apply DEVICE-CONFIG-254 if needed.
-    if (mpsl_fem_device_config_254_apply_get())
-    {
-        device_config_254_apply_tx();
-    }
+#if NRF_802154_LIGHT_SLEEP_ENABLED
+    if (!radio_config_is_retained())
 #endif
+    {
+        nrf_radio_reset();
 
-    nrf_radio_packet_conf_t packet_conf;
-
-    nrf_radio_mode_set(NRF_RADIO, NRF_RADIO_MODE_IEEE802154_250KBIT);
-
-#if defined(NRF5340_XXAA)
-    // Apply ERRATA-117 after setting RADIO mode to NRF_RADIO_MODE_IEEE802154_250KBIT.
-    errata_117_apply();
+#if defined(NRF52840_XXAA) || \
+        defined(NRF52833_XXAA)
+        // Apply DEVICE-CONFIG-254 if needed.
+        if (mpsl_fem_device_config_254_apply_get())
+        {
+            device_config_254_apply_tx();
+        }
 #endif
 
-    memset(&packet_conf, 0, sizeof(packet_conf));
-    packet_conf.lflen  = 8;
-    packet_conf.plen   = NRF_RADIO_PREAMBLE_LENGTH_32BIT_ZERO;
-    packet_conf.crcinc = true;
-    packet_conf.maxlen = MAX_PACKET_SIZE;
-    nrf_radio_packet_configure(NRF_RADIO, &packet_conf);
+        radio_config_apply();
+    }
 
     NRF_802154_TRX_ENABLE_INTERNAL();
 
-#if defined(RADIO_MODECNF0_RU_Msk)
-    nrf_radio_modecnf0_set(NRF_RADIO, true, 0);
-#endif
-
-    // Configure CRC
-    nrf_radio_crc_configure(NRF_RADIO, CRC_LENGTH, NRF_RADIO_CRC_ADDR_IEEE802154, CRC_POLYNOMIAL);
-
     nrf_802154_trx_ppi_for_enable();
 
     // Configure CCA
@@ -736,8 +959,19 @@ void nrf_802154_trx_disable(void)
 
     if (m_trx_state != TRX_STATE_DISABLED)
     {
+#if NRF_802154_LIGHT_SLEEP_ENABLED
+        // The configuration is retained only if no operation uses the RADIO or the PPIs.
+        bool retain = m_light_sleep &&
+                      ((m_trx_state == TRX_STATE_IDLE) || (m_trx_state == TRX_STATE_FINISHED));
+#else
+        bool retain = false;
+#endif
+
 #if defined(RADIO_POWER_POWER_Msk)
-        nrf_radio_power_set(NRF_RADIO, false);
+        if (!retain)
+        {
+            nrf_radio_power_set(NRF_RADIO, false);
+        }
 #endif
         nrf_802154_irq_clear_pending(nrfx_get_irq_number(NRF_RADIO));
 
@@ -747,7 +981,25 @@ void nrf_802154_trx_disable(void)
 #if !defined(RADIO_POWER_POWER_Msk)
         nrf_radio_task_trigger(NRF_RADIO, NRF_RADIO_TASK_DISABLE);
         wait_until_radio_is_disabled();
-        nrf_radio_reset();
+
+        if (!retain)
+        {
+            nrf_radio_reset();
+        }
+#endif
+
+#if NRF_802154_LIGHT_SLEEP_ENABLED
+        if (retain)
+        {
+#if defined(RADIO_POWER_POWER_Msk)
+            nrf_radio_task_trigger(NRF_RADIO, NRF_RADIO_TASK_DISABLE);
+            wait_until_radio_is_disabled();
+#endif
+            nrf_radio_int_disable(NRF_RADIO, UINT32_MAX);
+            nrf_radio_shorts_set(NRF_RADIO, SHORTS_IDLE);
+        }
+
+        m_radio_config_retained = retain;
 #endif
 
 #if defined(RADIO_INTENSET_SYNC_Msk)
@@ -762,7 +1014,10 @@ void nrf_802154_trx_disable(void)
         nrf_timer_task_trigger(NRF_802154_TIMER_INSTANCE, NRF_TIMER_TASK_SHUTDOWN);
 
 #if defined(RADIO_POWER_POWER_Msk)
-        nrf_radio_power_set(NRF_RADIO, true);
+        if (!retain)
+        {
+            nrf_radio_power_set(NRF_RADIO, true);
+        }
 #endif
 
         mpsl_fem_lna_configuration_clear();
@@ -778,6 +1033,7 @@ void nrf_802154_trx_disable(void)
         m_flags.missing_receive_buffer = false;
         m_flags.rssi_started           = false;
         m_flags.tx_started             = false;
+        m_flags.rx_fast_rearm          = false;
 
         m_trx_state = TRX_STATE_DISABLED;
 
@@ -793,6 +1049,15 @@ void nrf_802154_trx_disable(void)
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
+#if NRF_802154_LIGHT_SLEEP_ENABLED
+
+void nrf_802154_trx_light_sleep_set(bool enabled)
+{
+    m_light_sleep = enabled;
+}
+
+#endif // NRF_802154_LIGHT_SLEEP_ENABLED
+
 static void rx_automatic_antenna_handle(void)
 {
     switch (m_trx_state)
@@ -854,8 +1119,9 @@ static void rx_antenna_update(void)
 /**
  * Updates the antenna for transmission, according to antenna diversity configuration.
  *
- * Antenna diversity for tx is not currently supported. If antenna diversity is not
- * in disabled state, default antenna will always be used for transmission.
+ * In the manual mode the configured antenna is used, unless the automatic selection of
+ * the transmit antenna is enabled in @ref nrf_802154_ant_div_tx.h, which provides the antenna
+ * selected for the current frame.
  */
 static void tx_antenna_update(void)
 {
@@ -870,8 +1136,7 @@ static void tx_antenna_update(void)
             break;
 
         case NRF_802154_SL_ANT_DIV_MODE_MANUAL:
-            result = nrf_802154_sl_ant_div_antenna_set(
-                nrf_802154_sl_ant_div_cfg_antenna_get(NRF_802154_SL_ANT_DIV_OP_TX));
+            result = nrf_802154_sl_ant_div_antenna_set(nrf_802154_ant_div_tx_antenna_get());
             break;
 
         case NRF_802154_SL_ANT_DIV_MODE_AUTO:
@@ -1010,6 +1275,41 @@ bool nrf_802154_trx_receive_buffer_set(void * p_receive_buffer)
     return result;
 }
 
+#if NRF_802154_FAST_RX_REARM_ENABLED
+
+/**
+ * @brief Complete the configuration of the receiver ramped up by hardware after ACK transmission.
+ *
+ * @param[in]  p_ack_tx_power  Transmit power of ACK frames sent in response to received frames.
+ */
+static void rx_fast_rearm_finish(const nrf_802154_fal_tx_power_split_t * p_ack_tx_power)
+{
+    /* Current state of peripherals
+     * RADIO is ramping up or has already ramped up to receive, the self-disabling PPI_EGU_RAMP_UP
+     *    has been already triggered
+     * PPIs starting the TIMER on DISABLED event are still enabled
+     * TIMER is shutdown, so it counts from 0 when the frame reception ends
+     * FEM is not used
+     */
+    fem_pa_gain_set(&p_ack_tx_power->fem);
+
+    m_timer_value_on_radio_end_event = 0U;
+
+    nrf_802154_trx_antenna_update();
+
+    nrf_802154_stat_counter_increment(rx_fast_rearms);
+
+    // The RADIO could have ramped up before the shorts were set. Start reception by software.
+    if (!m_flags.missing_receive_buffer &&
+        (nrf_radio_state_get(NRF_RADIO) == NRF_RADIO_STATE_RXIDLE))
+    {
+        nrf_radio_task_trigger(NRF_RADIO, NRF_RADIO_TASK_START);
+        nrf_802154_stat_counter_increment(rx_fast_rearm_late_starts);
+    }
+}
+
+#endif // NRF_802154_FAST_RX_REARM_ENABLED
+
 void nrf_802154_trx_receive_frame(uint8_t                                 bcc,
                                   nrf_802154_trx_ramp_up_trigger_mode_t   rampup_trigg_mode,
                                   nrf_802154_trx_receive_notifications_t  notifications_mask,
@@ -1020,6 +1320,20 @@ void nrf_802154_trx_receive_frame(uint8_t                                 bcc,
     uint32_t ints_to_enable = 0U;
     uint32_t shorts         = SHORTS_RX;
 
+#if NRF_802154_FAST_RX_REARM_ENABLED
+    bool fast_rearm = m_flags.rx_fast_rearm;
+
+    if (fast_rearm)
+    {
+        assert(rampup_trigg_mode == TRX_RAMP_UP_SW_TRIGGER);
+
+        // The ramp-up was triggered by hardware when the ACK transmission ended. The TIMER
+        // was started by the same event, so it must be stopped afterwards.
+        m_flags.rx_fast_rearm = false;
+        rx_fast_rearm_ramp_down_wait();
+    }
+#endif
+
     // Force the TIMER to be stopped and count from 0.
     nrf_timer_task_trigger(NRF_802154_TIMER_INSTANCE, NRF_TIMER_TASK_SHUTDOWN);
 
@@ -1100,10 +1414,20 @@ void nrf_802154_trx_receive_frame(uint8_t                                 bcc,
 
     nrf_radio_int_enable(NRF_RADIO, ints_to_enable);
 
+#if NRF_802154_FAST_RX_REARM_ENABLED
+    if (fast_rearm)
+    {
+        rx_fast_rearm_finish(p_ack_tx_power);
+
+        nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+        return;
+    }
+#endif
+
     // Set FEM
     uint32_t delta_time;
 
-    if (mpsl_fem_lna_configuration_set(&m_activate_rx_cc0, NULL) == 0)
+    if (fem_lna_configuration_set(&m_activate_rx_cc0, NULL) == 0)
     {
         delta_time = nrf_timer_cc_get(NRF_802154_TIMER_INSTANCE,
                                       NRF_TIMER_CC_CHANNEL0);
@@ -1115,7 +1439,7 @@ void nrf_802154_trx_receive_frame(uint8_t                                 bcc,
     }
 
     // Set FEM PA gain for ACK transmission
-    mpsl_fem_pa_gain_set(&p_ack_tx_power->fem);
+    fem_pa_gain_set(&p_ack_tx_power->fem);
 
     m_timer_value_on_radio_end_event = delta_time;
 
@@ -1137,6 +1461,37 @@ void nrf_802154_trx_receive_frame(uint8_t                                 bcc,
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
+#if NRF_802154_ACK_TIMEOUT_HW_ENABLED
+/** Configure TIMER and (D)PPI to disable RADIO when no ACK starts within the waiting window. */
+static void ack_timeout_hw_arm(void)
+{
+    // TIMER is started by the ramp-up trigger, see nrf_802154_trx_ppi_for_ramp_up_set.
+    nrf_timer_task_trigger(NRF_802154_TIMER_INSTANCE, NRF_TIMER_TASK_CLEAR);
+    nrf_timer_cc_set(NRF_802154_TIMER_INSTANCE, NRF_TIMER_CC_CHANNEL1, m_ack_timeout_hw);
+    nrf_timer_event_clear(NRF_802154_TIMER_INSTANCE, NRF_TIMER_EVENT_COMPARE1);
+
+    // TIMER.EVENT_COMPARE1 -> RADIO.TASK_DISABLE
+    //                      -> EGU.TASK_ACK_TIMEOUT -> SWI_IRQHandler -> RADIO_IRQ pended
+    nrf_egu_event_clear(NRF_802154_EGU_INSTANCE, EGU_ACK_TIMEOUT_EVENT);
+    nrf_egu_int_enable(NRF_802154_EGU_INSTANCE, EGU_ACK_TIMEOUT_INTMASK);
+    nrf_802154_trx_ppi_for_ack_timeout_set(EGU_ACK_TIMEOUT_TASK);
+}
+
+/** Deconfigure TIMER and (D)PPI used to enforce the ACK waiting window. */
+static void ack_timeout_hw_disarm(void)
+{
+    nrf_802154_trx_ppi_for_ack_timeout_clear(EGU_ACK_TIMEOUT_TASK);
+    nrf_egu_int_disable(NRF_802154_EGU_INSTANCE, EGU_ACK_TIMEOUT_INTMASK);
+    nrf_egu_event_clear(NRF_802154_EGU_INSTANCE, EGU_ACK_TIMEOUT_EVENT);
+}
+
+void nrf_802154_trx_receive_ack_timeout_set(uint32_t timeout_us)
+{
+    m_ack_timeout_hw = timeout_us;
+}
+
+#endif // NRF_802154_ACK_TIMEOUT_HW_ENABLED
+
 void nrf_802154_trx_receive_ack(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
@@ -1168,9 +1523,27 @@ void nrf_802154_trx_receive_ack(void)
 
     nrf_radio_int_enable(NRF_RADIO, ints_to_enable);
 
+#if NRF_802154_ACK_TIMEOUT_HW_ENABLED
+    bool lna_configured = fem_for_lna_set();
+
+    // The FEM stops the TIMER on its own compare event, so the waiting window can be enforced
+    // by the TIMER only when the LNA activation does not use it.
+    m_flags.ack_timeout_hw_armed = !lna_configured && (m_ack_timeout_hw != 0U);
+
+    if (m_flags.ack_timeout_hw_armed)
+    {
+        ack_timeout_hw_arm();
+    }
+
+    nrf_802154_trx_antenna_update();
+    nrf_802154_trx_ppi_for_ramp_up_set(NRF_RADIO_TASK_RXEN,
+                                       TRX_RAMP_UP_SW_TRIGGER,
+                                       m_flags.ack_timeout_hw_armed);
+#else
     fem_for_lna_set();
     nrf_802154_trx_antenna_update();
     nrf_802154_trx_ppi_for_ramp_up_set(NRF_RADIO_TASK_RXEN, TRX_RAMP_UP_SW_TRIGGER, false);
+#endif
 
     trigger_disable_to_start_rampup();
 
@@ -1335,6 +1708,8 @@ bool nrf_802154_trx_transmit_ack(const void * p_transmit_buffer, uint32_t delay_
 
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
+    nrf_802154_profiler_mark_end(NRF_802154_PROFILE_POINT_RX_TO_ACK);
+
     bool result = false;
 
     assert(m_trx_state == TRX_STATE_RXFRAME_FINISHED);
@@ -1374,7 +1749,9 @@ bool nrf_802154_trx_transmit_ack(const void * p_transmit_buffer, uint32_t delay_
     m_activate_tx_cc0_timeshifted.event.timer.counter_period.end = timer_cc_ramp_up_start +
                                                                    TXRU_TIME;
 
-    if (mpsl_fem_pa_configuration_set(&m_activate_tx_cc0_timeshifted, NULL) == 0)
+    bool fem_used = (fem_pa_configuration_set(&m_activate_tx_cc0_timeshifted, NULL) == 0);
+
+    if (fem_used)
     {
         // FEM scheduled its operations on timer, so the timer must be running until last
         // operation scheduled by the FEM (TIMER's CC0), which is later than radio ramp up
@@ -1438,6 +1815,15 @@ bool nrf_802154_trx_transmit_ack(const void * p_transmit_buffer, uint32_t delay_
         uint32_t ints_to_enable = NRF_RADIO_INT_PHYEND_MASK | NRF_RADIO_INT_ADDRESS_MASK;
 
         nrf_radio_int_enable(NRF_RADIO, ints_to_enable);
+
+#if NRF_802154_FAST_RX_REARM_ENABLED
+        if (!fem_used)
+        {
+            // Let the DISABLED event ending the ACK transmission ramp up the receiver.
+            nrf_802154_trx_ppi_for_ramp_up_set(NRF_RADIO_TASK_RXEN, TRX_RAMP_UP_SW_TRIGGER, true);
+            m_flags.rx_fast_rearm = true;
+        }
+#endif
     }
     else
     {
@@ -1576,10 +1962,18 @@ void nrf_802154_trx_abort(void)
     {
         case TRX_STATE_DISABLED:
         case TRX_STATE_IDLE:
-        case TRX_STATE_FINISHED:
             /* Nothing to do, intentionally empty */
             break;
 
+        case TRX_STATE_FINISHED:
+#if NRF_802154_FAST_RX_REARM_ENABLED
+            if (m_flags.rx_fast_rearm)
+            {
+                rx_fast_rearm_cancel();
+            }
+#endif
+            break;
+
         case TRX_STATE_GOING_IDLE:
             go_idle_abort();
             break;
@@ -1727,7 +2121,17 @@ static void rxack_finish_disable_ppis(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
 
+#if NRF_802154_ACK_TIMEOUT_HW_ENABLED
+    if (m_flags.ack_timeout_hw_armed)
+    {
+        ack_timeout_hw_disarm();
+    }
+
+    nrf_802154_trx_ppi_for_ramp_up_clear(NRF_RADIO_TASK_RXEN, m_flags.ack_timeout_hw_armed);
+    m_flags.ack_timeout_hw_armed = false;
+#else
     nrf_802154_trx_ppi_for_ramp_up_clear(NRF_RADIO_TASK_RXEN, false);
+#endif
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
 }
@@ -2074,7 +2478,7 @@ static void irq_handler_ready(void)
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
-static void irq_handler_address(void)
+NRF_802154_HOT_FUNC static void irq_handler_address(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
@@ -2092,6 +2496,13 @@ static void irq_handler_address(void)
             break;
 
         case TRX_STATE_RXACK:
+#if NRF_802154_ACK_TIMEOUT_HW_ENABLED
+            if (m_flags.ack_timeout_hw_armed)
+            {
+                // ACK has started within the waiting window, RADIO must not be disabled anymore.
+                nrf_timer_task_trigger(NRF_802154_TIMER_INSTANCE, NRF_TIMER_TASK_STOP);
+            }
+#endif
             m_flags.rssi_started = true;
             nrf_802154_trx_receive_ack_started();
             break;
@@ -2114,7 +2525,7 @@ static void irq_handler_address(void)
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
-static void irq_handler_bcmatch(void)
+NRF_802154_HOT_FUNC static void irq_handler_bcmatch(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
@@ -2176,13 +2587,14 @@ static void irq_handler_crcerror(void)
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
-static void irq_handler_crcok(void)
+NRF_802154_HOT_FUNC static void irq_handler_crcok(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
     switch (m_trx_state)
     {
         case TRX_STATE_RXFRAME:
+            nrf_802154_profiler_mark(NRF_802154_PROFILE_POINT_RX_TO_ACK);
             m_flags.rssi_started = true;
             rxframe_finish();
             m_trx_state = TRX_STATE_RXFRAME_FINISHED;
@@ -2336,6 +2748,14 @@ static void transmit_ack_abort(void)
 
     nrf_802154_trx_ppi_for_ack_tx_clear();
 
+#if NRF_802154_FAST_RX_REARM_ENABLED
+    if (m_flags.rx_fast_rearm)
+    {
+        m_flags.rx_fast_rearm = false;
+        nrf_802154_trx_ppi_for_ramp_up_clear(NRF_RADIO_TASK_RXEN, true);
+    }
+#endif
+
     nrf_radio_shorts_set(NRF_RADIO, SHORTS_IDLE);
 
     mpsl_fem_pa_configuration_clear();
@@ -2356,7 +2776,7 @@ static void transmit_ack_abort(void)
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
 }
 
-static void irq_handler_phyend(void)
+NRF_802154_HOT_FUNC static void irq_handler_phyend(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
@@ -2396,7 +2816,7 @@ static void go_idle_finish(void)
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
 }
 
-static void irq_handler_disabled(void)
+NRF_802154_HOT_FUNC static void irq_handler_disabled(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
@@ -2492,10 +2912,31 @@ static void irq_handler_sync(void)
 
 #endif
 
-void nrf_802154_radio_irq_handler(void)
+#if NRF_802154_ACK_TIMEOUT_HW_ENABLED
+static void irq_handler_ack_timeout(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
+    assert(m_trx_state == TRX_STATE_RXACK);
+
+    // RADIO.TASK_DISABLE has already been triggered by (D)PPI.
+    rxack_finish();
+
+    m_trx_state = TRX_STATE_FINISHED;
+
+    nrf_802154_trx_receive_ack_timeout();
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+}
+
+#endif
+
+NRF_802154_HOT_FUNC void nrf_802154_radio_irq_handler(void)
+{
+    uint32_t profile_start = nrf_802154_profiler_begin();
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
     // Prevent interrupting of this handler by requests from higher priority code.
     nrf_802154_critical_section_forcefully_enter();
 
@@ -2594,8 +3035,22 @@ void nrf_802154_radio_irq_handler(void)
         irq_handler_edend();
     }
 
+#if NRF_802154_ACK_TIMEOUT_HW_ENABLED
+    // Note: The end of the ACK waiting window is signalled through EGU, like the SYNC event.
+    // The EGU event is cleared in the SWI handler, so the TIMER event is checked here.
+    if (m_flags.ack_timeout_hw_armed &&
+        nrf_timer_event_check(NRF_802154_TIMER_INSTANCE, NRF_TIMER_EVENT_COMPARE1))
+    {
+        nrf_timer_event_clear(NRF_802154_TIMER_INSTANCE, NRF_TIMER_EVENT_COMPARE1);
+
+        irq_handler_ack_timeout();
+    }
+#endif
+
     nrf_802154_critical_section_exit();
 
+    nrf_802154_profiler_end(NRF_802154_PROFILE_POINT_RADIO_IRQ, profile_start);
+
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
 
@@ -2607,7 +3062,7 @@ void RADIO_IRQHandler(void)
 
 #endif // NRF_802154_INTERNAL_RADIO_IRQ_HANDLING
 
-#if defined(RADIO_INTENSET_SYNC_Msk)
+#if defined(RADIO_INTENSET_SYNC_Msk) || NRF_802154_ACK_TIMEOUT_HW_ENABLED
 void nrf_802154_trx_swi_irq_handler(void)
 {
     // If this handler is preempted by MARGIN, RADIO IRQ might be set to pending
@@ -2617,6 +3072,7 @@ void nrf_802154_trx_swi_irq_handler(void)
 
     nrf_802154_mcu_critical_enter(mcu_crit_state);
 
+#if defined(RADIO_INTENSET_SYNC_Msk)
     if (nrf_egu_int_enable_check(NRF_802154_EGU_INSTANCE, EGU_SYNC_INTMASK) &&
         nrf_egu_event_check(NRF_802154_EGU_INSTANCE, EGU_SYNC_EVENT))
     {
@@ -2634,6 +3090,18 @@ void nrf_802154_trx_swi_irq_handler(void)
 
         nrf_802154_irq_set_pending(nrfx_get_irq_number(NRF_RADIO));
     }
+#endif
+
+#if NRF_802154_ACK_TIMEOUT_HW_ENABLED
+    if (nrf_egu_int_enable_check(NRF_802154_EGU_INSTANCE, EGU_ACK_TIMEOUT_INTMASK) &&
+        nrf_egu_event_check(NRF_802154_EGU_INSTANCE, EGU_ACK_TIMEOUT_EVENT))
+    {
+        nrf_egu_event_clear(NRF_802154_EGU_INSTANCE, EGU_ACK_TIMEOUT_EVENT);
+
+        // The ACK timeout is processed in RADIO_IRQ for the same reasons as the sync event.
+        nrf_802154_irq_set_pending(nrfx_get_irq_number(NRF_RADIO));
+    }
+#endif
 
     nrf_802154_mcu_critical_exit(mcu_crit_state);
 }
@@ -2693,3 +3161,15 @@ const nrf_802154_sl_event_handle_t * nrf_802154_trx_radio_phyend_event_handle_ge
 
     return &r;
 }
+
+const nrf_802154_sl_event_handle_t * nrf_802154_trx_radio_framestart_event_handle_get(void)
+{
+    static const nrf_802154_sl_event_handle_t r = {
+        .event_addr = (uint32_t)&NRF_RADIO->EVENTS_FRAMESTART,
+#if defined(DPPI_PRESENT)
+        .shared = false
+#endif
+    };
+
+    return &r;
+}
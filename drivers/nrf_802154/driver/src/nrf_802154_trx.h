@@ -162,6 +162,21 @@ void nrf_802154_trx_enable(void);
  */
 void nrf_802154_trx_disable(void);
 
+#if NRF_802154_LIGHT_SLEEP_ENABLED
+
+/**@brief Selects if the RADIO configuration is to be retained while the trx module is disabled.
+ *
+ * When enabled, @ref nrf_802154_trx_disable called while no operation is in progress leaves
+ * the RADIO configured instead of resetting it. The following @ref nrf_802154_trx_enable
+ * then skips the reset and the reconfiguration of the RADIO if its configuration has not been
+ * changed while the trx module was disabled.
+ *
+ * @param[in] enabled  If the RADIO configuration is to be retained.
+ */
+void nrf_802154_trx_light_sleep_set(bool enabled);
+
+#endif // NRF_802154_LIGHT_SLEEP_ENABLED
+
 /**
  * @brief Updates currently used antenna.
  *
@@ -220,10 +235,25 @@ void nrf_802154_trx_receive_frame(uint8_t                                 bcc,
  * - @ref nrf_802154_trx_receive_ack_started is called when a frame has just started being received.
  * - when a frame is received with correct crc, @ref nrf_802154_trx_receive_ack_received is called.
  * - when a frame is received with incorrect crc, @ref nrf_802154_trx_receive_ack_crcerror is called.
+ * - when no frame starts within the window set by @ref nrf_802154_trx_receive_ack_timeout_set,
+ *   @ref nrf_802154_trx_receive_ack_timeout is called.
  * - no bcmatch events are generated.
  */
 void nrf_802154_trx_receive_ack(void);
 
+#if NRF_802154_ACK_TIMEOUT_HW_ENABLED
+/**@brief Sets the ACK waiting window enforced by hardware.
+ *
+ * The window is applied by subsequent calls to @ref nrf_802154_trx_receive_ack. It is measured
+ * from the ramp-up trigger of the receiver. When it elapses before an ACK frame starts, the RADIO
+ * is disabled by (D)PPI. The window is not enforced if the TIMER is needed by the front-end module.
+ *
+ * @param[in] timeout_us  Length of the window in microseconds, 0 to disable the feature.
+ */
+void nrf_802154_trx_receive_ack_timeout_set(uint32_t timeout_us);
+
+#endif // NRF_802154_ACK_TIMEOUT_HW_ENABLED
+
 /**@brief Starts RSSI measurement.
  *
  * @note This function succeeds when TRX module is in receive frame state only (started with @ref nrf_802154_trx_receive_frame)
@@ -603,6 +633,29 @@ extern void nrf_802154_trx_receive_ack_received(void);
  */
 extern void nrf_802154_trx_receive_ack_crcerror(void);
 
+#if NRF_802154_ACK_TIMEOUT_HW_ENABLED
+/**@brief Handler called when no ack started within the ACK waiting window.
+ *
+ * This handler is called from an ISR when:
+ * - receive ack operation has been started with a call to @ref nrf_802154_trx_receive_ack
+ *   with the window set by @ref nrf_802154_trx_receive_ack_timeout_set
+ * - the RADIO did not receive an address of a frame on air before the window elapsed
+ *
+ * When this handler is called following holds:
+ * - the RADIO peripheral started ramping down (or it ramped down already)
+ * - trx module is in @c FINISHED state.
+ *
+ * Implementation is responsible for:
+ * - leaving @c FINISHED state. It may do this by call to:
+ *     - @ref nrf_802154_trx_receive_frame,
+ *     - @ref nrf_802154_trx_transmit_frame,
+ *     - @ref nrf_802154_trx_go_idle,
+ *     - @ref nrf_802154_trx_disable.
+ */
+extern void nrf_802154_trx_receive_ack_timeout(void);
+
+#endif // NRF_802154_ACK_TIMEOUT_HW_ENABLED
+
 /**@brief Handler called when a cca operation during transmit attempt started.
  *
  * This handler is called from an ISR when:
@@ -800,6 +853,12 @@ const nrf_802154_sl_event_handle_t * nrf_802154_trx_radio_crcok_event_handle_get
  */
 const nrf_802154_sl_event_handle_t * nrf_802154_trx_radio_phyend_event_handle_get(void);
 
+/**@brief Returns RADIO->EVENTS_FRAMESTART handle that hardware can subscribe to.
+ *
+ * @return RADIO->EVENTS_FRAMESTART handle that hardware can subscribe to.
+ */
+const nrf_802154_sl_event_handle_t * nrf_802154_trx_radio_framestart_event_handle_get(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -55,6 +55,7 @@
 #define PPI_EGU_RAMP_UP             NRF_802154_DPPI_EGU_TO_RADIO_RAMP_UP
 #define PPI_TIMER_TX_ACK            NRF_802154_DPPI_TIMER_COMPARE_TO_RADIO_TXEN
 #define PPI_RADIO_SYNC_EGU_SYNC     NRF_802154_DPPI_RADIO_SYNC_TO_EGU_SYNC
+#define PPI_TIMER_ACK_TIMEOUT       NRF_802154_DPPI_TIMER_COMPARE_TO_RADIO_DISABLE
 
 void nrf_802154_trx_ppi_for_enable(void)
 {
@@ -252,6 +253,39 @@ void nrf_802154_trx_ppi_for_ack_tx_clear(void)
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
 }
 
+#if NRF_802154_ACK_TIMEOUT_HW_ENABLED
+void nrf_802154_trx_ppi_for_ack_timeout_set(nrf_egu_task_t task)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
+
+    // TIMER_COMPARE1 ----> RADIO_DISABLE
+    //                \---> EGU_TASK
+    nrf_radio_subscribe_set(NRF_RADIO, NRF_RADIO_TASK_DISABLE, PPI_TIMER_ACK_TIMEOUT);
+    nrf_egu_subscribe_set(NRF_802154_EGU_INSTANCE, task, PPI_TIMER_ACK_TIMEOUT);
+    nrf_timer_publish_set(NRF_802154_TIMER_INSTANCE,
+                          NRF_TIMER_EVENT_COMPARE1,
+                          PPI_TIMER_ACK_TIMEOUT);
+
+    nrf_dppi_channels_enable(NRF_802154_DPPIC_INSTANCE, (1UL << PPI_TIMER_ACK_TIMEOUT));
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
+}
+
+void nrf_802154_trx_ppi_for_ack_timeout_clear(nrf_egu_task_t task)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
+
+    nrf_dppi_channels_disable(NRF_802154_DPPIC_INSTANCE, (1UL << PPI_TIMER_ACK_TIMEOUT));
+
+    nrf_radio_subscribe_clear(NRF_RADIO, NRF_RADIO_TASK_DISABLE);
+    nrf_egu_subscribe_clear(NRF_802154_EGU_INSTANCE, task);
+    nrf_timer_publish_clear(NRF_802154_TIMER_INSTANCE, NRF_TIMER_EVENT_COMPARE1);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
+}
+
+#endif // NRF_802154_ACK_TIMEOUT_HW_ENABLED
+
 void nrf_802154_trx_ppi_for_fem_set(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
@@ -66,6 +66,7 @@
 #define PPI_EGU_TIMER_START        NRF_802154_PPI_EGU_TO_TIMER_START          ///< PPI that connects EGU event with TIMER START task
 #define PPI_TIMER_TX_ACK           NRF_802154_PPI_TIMER_COMPARE_TO_RADIO_TXEN ///< PPI that connects TIMER COMPARE event with RADIO TXEN task
 #define PPI_RADIO_SYNC_EGU_SYNC    NRF_802154_PPI_RADIO_SYNC_TO_EGU_SYNC      ///< PPI that connects RADIO SYNC event with EGU task for SYNC channel
+#define PPI_TIMER_ACK_TIMEOUT      NRF_802154_PPI_TIMER_COMPARE_TO_RADIO_DISABLE ///< PPI that connects TIMER COMPARE event with RADIO DISABLE task and EGU task
 
 void nrf_802154_trx_ppi_for_enable(void)
 {
@@ -235,6 +236,37 @@ void nrf_802154_trx_ppi_for_ack_tx_clear(void)
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
 }
 
+#if NRF_802154_ACK_TIMEOUT_HW_ENABLED
+void nrf_802154_trx_ppi_for_ack_timeout_set(nrf_egu_task_t task)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
+
+    nrf_ppi_channel_and_fork_endpoint_setup(NRF_PPI,
+                                            PPI_TIMER_ACK_TIMEOUT,
+                                            nrf_timer_event_address_get(NRF_802154_TIMER_INSTANCE,
+                                                                        NRF_TIMER_EVENT_COMPARE1),
+                                            nrf_radio_task_address_get(NRF_RADIO,
+                                                                       NRF_RADIO_TASK_DISABLE),
+                                            nrf_egu_task_address_get(NRF_802154_EGU_INSTANCE,
+                                                                     task));
+    nrf_ppi_channel_enable(NRF_PPI, PPI_TIMER_ACK_TIMEOUT);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
+}
+
+void nrf_802154_trx_ppi_for_ack_timeout_clear(nrf_egu_task_t task)
+{
+    (void)task;
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
+
+    nrf_ppi_channel_disable(NRF_PPI, PPI_TIMER_ACK_TIMEOUT);
+    nrf_ppi_channel_and_fork_endpoint_setup(NRF_PPI, PPI_TIMER_ACK_TIMEOUT, 0, 0, 0);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
+}
+
+#endif // NRF_802154_ACK_TIMEOUT_HW_ENABLED
+
 void nrf_802154_trx_ppi_for_fem_set(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
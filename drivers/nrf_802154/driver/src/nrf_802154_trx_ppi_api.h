@@ -173,6 +173,26 @@ void nrf_802154_trx_ppi_for_ack_tx_set(void);
  */
 void nrf_802154_trx_ppi_for_ack_tx_clear(void);
 
+#if NRF_802154_ACK_TIMEOUT_HW_ENABLED
+/**
+ * @brief Set PPIs to connect TIMER event with radio DISABLE task, needed to end ACK RX in hardware.
+ *
+ * The same TIMER event also triggers the given EGU task, so that the end of the ACK waiting
+ * window is signalled with an IRQ.
+ *
+ * @param[in] task EGU task triggered when the ACK waiting window elapses.
+ */
+void nrf_802154_trx_ppi_for_ack_timeout_set(nrf_egu_task_t task);
+
+/**
+ * @brief Clear PPIs to connect TIMER event with radio DISABLE task, needed to end ACK RX in hardware.
+ *
+ * @param[in] task EGU task triggered when the ACK waiting window elapses. See @ref nrf_802154_trx_ppi_for_ack_timeout_set
+ */
+void nrf_802154_trx_ppi_for_ack_timeout_clear(nrf_egu_task_t task);
+
+#endif // NRF_802154_ACK_TIMEOUT_HW_ENABLED
+
 /**
  * @brief Configure PPIs needed for external LNA or PA. Radio DISABLED event will be connected to timer START task.
  * As a result, FEM ramp-up will be scheduled during the radio ramp-up period, with timing based on FEM implementation used.
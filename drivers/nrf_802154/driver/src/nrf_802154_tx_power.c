@@ -33,34 +33,163 @@
  */
 
 #include "nrf_802154_tx_power.h"
+
+#include <stdbool.h>
+
+#include "nrf_802154_config.h"
 #include "nrf_802154_pib.h"
+#include "nrf_802154_tx_power_control.h"
 #include "nrf_802154_utils.h"
 #include "nrf_802154_fal.h"
 
+#if NRF_802154_TX_POWER_SPLIT_CACHE_ENABLED
+
+#define CACHE_FIRST_CHANNEL 11U ///< The lowest channel for which the splits are cached.
+#define CACHE_CHANNELS      16U ///< Number of channels for which the splits are cached.
+#define CACHE_WAYS          2U  ///< Number of requested powers cached for each channel.
+
+/**@brief Transmit power split cached for a channel and a requested power. */
+typedef struct
+{
+    nrf_802154_fal_tx_power_split_t split;    ///< Split of the requested power.
+    int8_t                          power;    ///< Requested power in dBm.
+    int8_t                          achieved; ///< Real achieved total power in dBm.
+    bool                            valid;    ///< If the entry holds a computed split.
+} tx_power_split_entry_t;
+
+/**@brief Transmit power splits cached for each channel. */
+static tx_power_split_entry_t m_cache[CACHE_CHANNELS][CACHE_WAYS];
+
+/**@brief Index of the least recently used entry of each channel. */
+static uint8_t m_cache_lru[CACHE_CHANNELS];
+
+/**@brief Counter incremented on each invalidation of the cache. */
+static uint32_t m_cache_epoch;
+
+/**
+ * @brief Splits the transmit power, using the cached split if available.
+ *
+ * @param[in]  channel        The channel based on which the power should be constrained.
+ * @param[in]  power          Requested transmit power in dBm.
+ * @param[out] p_split_power  Pointer to the structure holding TX power split into components in dBm.
+ *
+ * @retval  The real achieved total transmission power in dBm.
+ */
+static int8_t tx_power_split(uint8_t                                 channel,
+                             int8_t                                  power,
+                             nrf_802154_fal_tx_power_split_t * const p_split_power)
+{
+    uint32_t idx = (uint32_t)channel - CACHE_FIRST_CHANNEL;
+
+    if (idx >= CACHE_CHANNELS)
+    {
+        return nrf_802154_fal_tx_power_split(channel, power, p_split_power);
+    }
+
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    uint32_t                        epoch;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    for (uint32_t way = 0U; way < CACHE_WAYS; way++)
+    {
+        const tx_power_split_entry_t * p_entry = &m_cache[idx][way];
+
+        if (p_entry->valid && (p_entry->power == power))
+        {
+            int8_t achieved = p_entry->achieved;
+
+            *p_split_power   = p_entry->split;
+            m_cache_lru[idx] = (uint8_t)((way + 1U) % CACHE_WAYS);
+
+            nrf_802154_mcu_critical_exit(mcu_cs);
+            return achieved;
+        }
+    }
+
+    epoch = m_cache_epoch;
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    // The split is computed outside of the critical section, as it may take considerable time.
+    int8_t achieved = nrf_802154_fal_tx_power_split(channel, power, p_split_power);
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    // Do not store the split if the cache was invalidated in the meantime.
+    if (epoch == m_cache_epoch)
+    {
+        tx_power_split_entry_t * p_entry = &m_cache[idx][m_cache_lru[idx]];
+
+        p_entry->split    = *p_split_power;
+        p_entry->power    = power;
+        p_entry->achieved = achieved;
+        p_entry->valid    = true;
+
+        m_cache_lru[idx] = (uint8_t)((m_cache_lru[idx] + 1U) % CACHE_WAYS);
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return achieved;
+}
+
+void nrf_802154_tx_power_split_cache_invalidate(void)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    for (uint32_t idx = 0U; idx < CACHE_CHANNELS; idx++)
+    {
+        for (uint32_t way = 0U; way < CACHE_WAYS; way++)
+        {
+            m_cache[idx][way].valid = false;
+        }
+    }
+
+    m_cache_epoch++;
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+#else // NRF_802154_TX_POWER_SPLIT_CACHE_ENABLED
+
+static inline int8_t tx_power_split(uint8_t                                 channel,
+                                    int8_t                                  power,
+                                    nrf_802154_fal_tx_power_split_t * const p_split_power)
+{
+    return nrf_802154_fal_tx_power_split(channel, power, p_split_power);
+}
+
+#endif // NRF_802154_TX_POWER_SPLIT_CACHE_ENABLED
+
 int8_t nrf_802154_tx_power_convert_metadata_to_tx_power_split(
     uint8_t                                 channel,
     nrf_802154_tx_power_metadata_t          tx_power,
+    const uint8_t                         * p_frame,
     nrf_802154_fal_tx_power_split_t * const p_tx_power_split)
 {
     int8_t power_unconstrained =
-        tx_power.use_metadata_value ? tx_power.power : nrf_802154_pib_tx_power_get();
+        tx_power.use_metadata_value ? tx_power.power :
+        nrf_802154_tx_power_control_power_get(p_frame, nrf_802154_pib_tx_power_get());
 
-    return nrf_802154_fal_tx_power_split(channel, power_unconstrained, p_tx_power_split);
+    return tx_power_split(channel, power_unconstrained, p_tx_power_split);
 }
 
 int8_t nrf_802154_tx_power_split_pib_power_get(
     nrf_802154_fal_tx_power_split_t * const p_split_power)
 {
-    return nrf_802154_fal_tx_power_split(nrf_802154_pib_channel_get(),
-                                         nrf_802154_pib_tx_power_get(),
-                                         p_split_power);
+    return tx_power_split(nrf_802154_pib_channel_get(),
+                          nrf_802154_pib_tx_power_get(),
+                          p_split_power);
 }
 
 int8_t nrf_802154_tx_power_split_pib_power_for_channel_get(
     uint8_t                                 channel,
     nrf_802154_fal_tx_power_split_t * const p_split_power)
 {
-    return nrf_802154_fal_tx_power_split(channel,
-                                         nrf_802154_pib_tx_power_get(),
-                                         p_split_power);
+    return tx_power_split(channel,
+                          nrf_802154_pib_tx_power_get(),
+                          p_split_power);
 }
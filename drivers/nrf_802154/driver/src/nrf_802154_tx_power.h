@@ -45,8 +45,12 @@
 
  * This function also ensures that the values meet the constraints for the given channel.
  *
+ * If the metadata does not specify the power, the power stored in PIB is adapted to the destination
+ * of the frame by @ref nrf_802154_tx_power_control_power_get.
+ *
  * @param[in]  channel             The channel to be used for transmission
  * @param[in]  tx_power            The value passed to the transmit metadata.
+ * @param[in]  p_frame             Pointer to a buffer that contains PHR and PSDU of the frame.
  * @param[out] p_tx_power_split    Pointer to the structure holding TX power split into raw components in dBm.
  *
  * @retval  The real achieved total transmission power in dBm.
@@ -55,6 +59,7 @@
 int8_t nrf_802154_tx_power_convert_metadata_to_tx_power_split(
     uint8_t                                 channel,
     nrf_802154_tx_power_metadata_t          tx_power,
+    const uint8_t                         * p_frame,
     nrf_802154_fal_tx_power_split_t * const p_tx_power_split);
 
 /**@brief Get the transmit power stored in PIB after applying the power constraints for the current channel and splitting
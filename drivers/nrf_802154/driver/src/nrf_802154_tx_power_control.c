@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   This file implements the adaptation of the transmit power to each peer.
+ *
+ */
+
+#include "nrf_802154_tx_power_control.h"
+
+#if NRF_802154_TX_POWER_CONTROL_PEERS_COUNT > 0
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_802154_const.h"
+#include "nrf_802154_nrfx_addons.h"
+#include "nrf_802154_utils.h"
+#include "mac_features/nrf_802154_frame_parser.h"
+
+#define PEER_KEY_NONE NRF_802154_FRAME_PARSER_DST_KEY_NONE ///< Key of an unused peer entry.
+
+/**@brief Entry describing a peer. */
+typedef struct
+{
+    uint64_t key;       ///< Key identifying the peer or @ref PEER_KEY_NONE.
+    uint8_t  reduction; ///< Reduction of the requested transmit power in dB.
+} peer_t;
+
+static peer_t  m_peers[NRF_802154_TX_POWER_CONTROL_PEERS_COUNT]; ///< Tracked peers.
+static uint8_t m_peer_next;                                       ///< Index of the entry to be replaced by a new peer.
+
+/**
+ * @brief Gets the key identifying the destination of a frame.
+ *
+ * @param[in]  p_frame  Pointer to a buffer that contains PHR and PSDU of the frame.
+ *
+ * @return Key of the destination or @ref PEER_KEY_NONE if the frame is not unicast.
+ */
+static uint64_t peer_key_get(const uint8_t * p_frame)
+{
+    nrf_802154_frame_parser_data_t frame_data;
+
+    bool result = nrf_802154_frame_parser_data_init(p_frame,
+                                                    p_frame[PHR_OFFSET] + PHR_SIZE,
+                                                    PARSE_LEVEL_ADDRESSING_END,
+                                                    &frame_data);
+
+    return result ? nrf_802154_frame_parser_dst_key_get(&frame_data) : PEER_KEY_NONE;
+}
+
+/**
+ * @brief Gets the entry of a peer.
+ *
+ * @param[in]  key     Key of the peer.
+ * @param[in]  create  If an entry is to be created when the peer is not tracked yet.
+ *
+ * @return Pointer to the entry or NULL if the peer is not tracked.
+ */
+static peer_t * peer_get(uint64_t key, bool create)
+{
+    if (key == PEER_KEY_NONE)
+    {
+        return NULL;
+    }
+
+    for (uint8_t i = 0; i < NRF_802154_TX_POWER_CONTROL_PEERS_COUNT; i++)
+    {
+        if (m_peers[i].key == key)
+        {
+            return &m_peers[i];
+        }
+    }
+
+    if (!create)
+    {
+        return NULL;
+    }
+
+    peer_t * p_peer = &m_peers[m_peer_next];
+
+    m_peer_next = (m_peer_next + 1U) % NRF_802154_TX_POWER_CONTROL_PEERS_COUNT;
+
+    p_peer->key       = key;
+    p_peer->reduction = 0U;
+
+    return p_peer;
+}
+
+/**
+ * @brief Adapts the transmit power reduction of a peer to the RSSI of an ACK received from it.
+ *
+ * The power is raised at once by the missing margin, while it is lowered by one step at a time
+ * and only when the margin exceeds the target by more than the hysteresis. This way a single
+ * strong ACK does not cut the power, and a weak link recovers without delay.
+ *
+ * @param[inout]  p_peer    Pointer to the entry of the peer.
+ * @param[in]     ack_rssi  RSSI of the ACK in dBm.
+ */
+static void peer_adapt(peer_t * p_peer, int8_t ack_rssi)
+{
+    int16_t margin    = (int16_t)ack_rssi - ED_RSSIOFFS;
+    int16_t reduction = p_peer->reduction;
+
+    if (margin < NRF_802154_TX_POWER_CONTROL_TARGET_MARGIN_DB)
+    {
+        reduction -= NRF_802154_TX_POWER_CONTROL_TARGET_MARGIN_DB - margin;
+    }
+    else if (margin > NRF_802154_TX_POWER_CONTROL_TARGET_MARGIN_DB +
+             NRF_802154_TX_POWER_CONTROL_HYSTERESIS_DB)
+    {
+        reduction += NRF_802154_TX_POWER_CONTROL_STEP_DB;
+    }
+    else
+    {
+        // Intentionally empty: the margin is within the hysteresis band.
+    }
+
+    if (reduction < 0)
+    {
+        reduction = 0;
+    }
+
+    if (reduction > UINT8_MAX)
+    {
+        reduction = UINT8_MAX;
+    }
+
+    p_peer->reduction = (uint8_t)reduction;
+}
+
+void nrf_802154_tx_power_control_init(void)
+{
+    memset(m_peers, 0, sizeof(m_peers));
+
+    m_peer_next = 0U;
+}
+
+int8_t nrf_802154_tx_power_control_power_get(const uint8_t * p_frame, int8_t power)
+{
+    uint64_t                        key       = peer_key_get(p_frame);
+    uint8_t                         reduction = 0U;
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    const peer_t * p_peer = peer_get(key, false);
+
+    if (p_peer != NULL)
+    {
+        reduction = p_peer->reduction;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    if (power <= NRF_802154_TX_POWER_CONTROL_MIN_POWER_DBM)
+    {
+        // The requested power is already at or below the lower bound.
+        return power;
+    }
+
+    int16_t adapted = (int16_t)power - reduction;
+
+    return (int8_t)((adapted > NRF_802154_TX_POWER_CONTROL_MIN_POWER_DBM) ?
+                    adapted : NRF_802154_TX_POWER_CONTROL_MIN_POWER_DBM);
+}
+
+void nrf_802154_tx_power_control_tx_outcome_hook(
+    const uint8_t                             * p_frame,
+    nrf_802154_tx_error_t                       error,
+    const nrf_802154_transmit_done_metadata_t * p_meta)
+{
+    bool ack_received = (error == NRF_802154_TX_ERROR_NONE) &&
+                        (p_meta->data.transmitted.p_ack != NULL);
+
+    if (!ack_received && (error != NRF_802154_TX_ERROR_NO_ACK))
+    {
+        // The outcome does not tell anything about the link to the destination.
+        return;
+    }
+
+    uint64_t                        key = peer_key_get(p_frame);
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    peer_t * p_peer = peer_get(key, ack_received);
+
+    if (p_peer == NULL)
+    {
+        // Intentionally empty: broadcast frame or a lost ACK of an untracked peer.
+    }
+    else if (ack_received)
+    {
+        peer_adapt(p_peer, p_meta->data.transmitted.power);
+    }
+    else
+    {
+        // The ACK may have been lost because of too low power, so fall back to the full power.
+        p_peer->reduction = 0U;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+#endif // NRF_802154_TX_POWER_CONTROL_PEERS_COUNT > 0
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @brief Module that adapts the transmit power to each peer.
+ *
+ * For recent unicast destinations the module keeps a reduction of the transmit power, adapted
+ * from the RSSI of the received ACKs so that the link margin approaches
+ * @ref NRF_802154_TX_POWER_CONTROL_TARGET_MARGIN_DB. The reduction is applied to the power
+ * stored in PIB when a frame is transmitted without a power in its metadata.
+ */
+
+#ifndef NRF_802154_TX_POWER_CONTROL_H__
+#define NRF_802154_TX_POWER_CONTROL_H__
+
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_types.h"
+
+#if NRF_802154_TX_POWER_CONTROL_PEERS_COUNT > 0
+
+/**
+ * @brief Initializes the transmit power control module.
+ */
+void nrf_802154_tx_power_control_init(void);
+
+/**
+ * @brief Gets the transmit power to be used for a frame.
+ *
+ * @param[in]  p_frame  Pointer to a buffer that contains PHR and PSDU of the frame.
+ * @param[in]  power    Transmit power requested for the frame in dBm.
+ *
+ * @return Transmit power adapted to the destination of the frame in dBm.
+ */
+int8_t nrf_802154_tx_power_control_power_get(const uint8_t * p_frame, int8_t power);
+
+/**
+ * @brief Adapts the transmit power of the destination of a frame to the outcome of its transmission.
+ *
+ * @param[in]  p_frame  Pointer to a buffer that contains PHR and PSDU of the transmitted frame.
+ * @param[in]  error    Cause of failed transmission or @ref NRF_802154_TX_ERROR_NONE.
+ * @param[in]  p_meta   Pointer to metadata of the transmission.
+ */
+void nrf_802154_tx_power_control_tx_outcome_hook(
+    const uint8_t                             * p_frame,
+    nrf_802154_tx_error_t                       error,
+    const nrf_802154_transmit_done_metadata_t * p_meta);
+
+#else // NRF_802154_TX_POWER_CONTROL_PEERS_COUNT > 0
+
+static inline void nrf_802154_tx_power_control_init(void)
+{
+    // Intentionally empty
+}
+
+static inline int8_t nrf_802154_tx_power_control_power_get(const uint8_t * p_frame, int8_t power)
+{
+    (void)p_frame;
+
+    return power;
+}
+
+#endif // NRF_802154_TX_POWER_CONTROL_PEERS_COUNT > 0
+
+#endif // NRF_802154_TX_POWER_CONTROL_H__
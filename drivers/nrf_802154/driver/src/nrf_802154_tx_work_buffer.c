@@ -36,10 +36,13 @@
 #include <stddef.h>
 #include <string.h>
 
+#include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
 #include "nrf_802154_tx_work_buffer.h"
 
+#if !NRF_802154_TX_IN_PLACE_ENABLED
 static uint8_t   m_work_buffer[MAX_PACKET_SIZE + PHR_SIZE]; ///< Work buffer.
+#endif
 static uint8_t * mp_original_frame;                         ///< Pointer to the original frame the work buffer is currently bound to.
 static uint8_t   m_plain_text_offset;                       ///< Offset of encryption plain text.
 static bool      m_is_secured;                              ///< Flag that indicates if work buffer has been successfully secured.
@@ -65,12 +68,20 @@ void nrf_802154_tx_work_buffer_reset(const nrf_802154_transmitted_frame_props_t
 uint8_t * nrf_802154_tx_work_buffer_enable_for(uint8_t * p_original_frame)
 {
     mp_original_frame = p_original_frame;
+#if NRF_802154_TX_IN_PLACE_ENABLED
+    return p_original_frame;
+#else
     return m_work_buffer;
+#endif
 }
 
 const uint8_t * nrf_802154_tx_work_buffer_get(const uint8_t * p_original_frame)
 {
+#if NRF_802154_TX_IN_PLACE_ENABLED
+    return p_original_frame;
+#else
     return mp_original_frame ? m_work_buffer : p_original_frame;
+#endif
 }
 
 void nrf_802154_tx_work_buffer_original_frame_update(
@@ -82,6 +93,10 @@ void nrf_802154_tx_work_buffer_original_frame_update(
     p_frame_props->is_secured          = m_is_secured;
     p_frame_props->dynamic_data_is_set = m_is_dynamic_data_updated;
 
+#if NRF_802154_TX_IN_PLACE_ENABLED
+    // The original frame has been modified in place, there is nothing to copy.
+    (void)p_original_frame;
+#else
     if (mp_original_frame == NULL)
     {
         return;
@@ -105,6 +120,7 @@ void nrf_802154_tx_work_buffer_original_frame_update(
     {
         // Intentionally empty.
     }
+#endif
 }
 
 void nrf_802154_tx_work_buffer_is_secured_set(void)
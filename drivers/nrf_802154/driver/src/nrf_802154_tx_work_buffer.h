@@ -43,6 +43,9 @@
  * By default, the using of work buffer is turned off. If desired, it can be turned on with
  * @ref nrf_802154_tx_work_buffer_enable_for.
  *
+ * When @ref NRF_802154_TX_IN_PLACE_ENABLED is set, no separate work buffer is allocated and
+ * the original frame itself serves as the work buffer.
+ *
  */
 
 #ifndef NRF_802154_TX_WORK_BUFFER_H_
@@ -137,6 +137,56 @@ bool nrf_802154_ack_data_clear(const uint8_t       * p_addr,
                                bool                  extended,
                                nrf_802154_ack_data_t data_type);
 
+/**
+ * @brief Sets the ACK data for multiple addresses at once.
+ *
+ * This function is equivalent to calling @ref nrf_802154_ack_data_set for every address
+ * in @p p_addrs, but the addresses are merged into the list in chunks, each applied within
+ * a single critical section. If the same address appears more than once in @p p_addrs,
+ * its last occurrence is applied.
+ *
+ * @param[in]  p_addrs    Array of @p num_addrs addresses of nodes stored one after another
+ *                        (each little-endian).
+ * @param[in]  extended   If the given addresses are extended MAC addresses or short MAC addresses.
+ * @param[in]  num_addrs  Number of addresses in @p p_addrs.
+ * @param[in]  p_data     Pointer to the buffer containing the data to be set for the subsequent
+ *                        addresses, concatenated in the order of @p p_addrs. Ignored for
+ *                        @ref NRF_802154_ACK_DATA_PENDING_BIT.
+ * @param[in]  p_lengths  Array of @p num_addrs lengths of the data to be set for the subsequent
+ *                        addresses. Ignored for @ref NRF_802154_ACK_DATA_PENDING_BIT.
+ * @param[in]  data_type  Type of data to be set. Refer to the @ref nrf_802154_ack_data_t type.
+ *
+ * @retval True   All addresses successfully added to the list.
+ * @retval False  Not enough memory to store some of the addresses in the list.
+ */
+bool nrf_802154_ack_data_set_batch(const uint8_t       * p_addrs,
+                                   bool                  extended,
+                                   uint8_t               num_addrs,
+                                   const void          * p_data,
+                                   const uint8_t       * p_lengths,
+                                   nrf_802154_ack_data_t data_type);
+
+/**
+ * @brief Removes multiple addresses for which the ACK data is set from the list at once.
+ *
+ * This function is equivalent to calling @ref nrf_802154_ack_data_clear for every address
+ * in @p p_addrs, but the list is compacted in chunks, each applied within a single
+ * critical section.
+ *
+ * @param[in]  p_addrs    Array of @p num_addrs addresses of nodes stored one after another
+ *                        (each little-endian).
+ * @param[in]  extended   If the given addresses are extended MAC addresses or short MAC addresses.
+ * @param[in]  num_addrs  Number of addresses in @p p_addrs.
+ * @param[in]  data_type  Type of data to be removed. Refer to the @ref nrf_802154_ack_data_t type.
+ *
+ * @retval True   All addresses removed from the list.
+ * @retval False  Some of the addresses not found in the list.
+ */
+bool nrf_802154_ack_data_clear_batch(const uint8_t       * p_addrs,
+                                     bool                  extended,
+                                     uint8_t               num_addrs,
+                                     nrf_802154_ack_data_t data_type);
+
 /**
  * @brief Enables or disables setting a pending bit in automatically transmitted ACK frames.
  *
@@ -317,6 +367,37 @@ bool nrf_802154_receive_at(uint64_t rx_time,
                            uint8_t  channel,
                            uint32_t id);
 
+/**
+ * @brief Requests periodic reception windows starting at the specified time.
+ *
+ * This function works as a periodic version of @ref nrf_802154_receive_at. The driver schedules
+ * the consecutive windows internally, so there is no need to request each window separately.
+ * Frames received in any of the windows are reported as usual. Windows that end without
+ * a frame are not reported. @ref nrf_802154_receive_failed is called only once, when the last
+ * window ends, with the error that ended that window.
+ *
+ * A scheduled series of windows can be cancelled by a call to @ref nrf_802154_receive_at_cancel.
+ *
+ * @note The identifier @p id follows the same rules as in @ref nrf_802154_receive_at.
+ *
+ * @param[in]   rx_time  Absolute time of the first window used by the SL Timer, in microseconds (us).
+ * @param[in]   period   Time between the beginnings of consecutive windows, in microseconds (us).
+ * @param[in]   timeout  Length of each window, in microseconds (us).
+ * @param[in]   channel  Radio channel on which the frames are to be received.
+ * @param[in]   count    Number of windows. If 0, the windows are repeated until cancelled.
+ * @param[in]   id       Identifier of the scheduled reception windows.
+ *
+ * @retval  true   The reception procedure was scheduled.
+ * @retval  false  The driver could not schedule the reception procedure or the windows do not fit
+ *                 in @p period.
+ */
+bool nrf_802154_receive_at_periodic(uint64_t rx_time,
+                                    uint32_t period,
+                                    uint32_t timeout,
+                                    uint8_t  channel,
+                                    uint32_t count,
+                                    uint32_t id);
+
 /**
  * @brief Cancels a delayed reception scheduled by a call to @ref nrf_802154_receive_at.
  *
@@ -461,6 +542,25 @@ bool nrf_802154_modulated_carrier(const uint8_t * p_data);
  */
 bool nrf_802154_energy_detection(uint32_t time_us);
 
+/**
+ * @brief Performs the energy detection procedure on multiple channels.
+ *
+ * The channels selected by @p channel_mask are scanned one by one in increasing order. The results
+ * of all channels are reported at once by @ref nrf_802154_energy_scan_done.
+ *
+ * @note @ref nrf_802154_energy_scan_done can be called before this function returns a result.
+ * @note If the procedure is aborted, @ref nrf_802154_energy_detection_failed is called instead.
+ *
+ * @param[in]  channel_mask   Mask of channels to be scanned. Bit @c n selects channel @c n.
+ *                            Only channels 11-26 can be selected.
+ * @param[in]  dwell_time_us  Duration of energy detection on each channel. The given value is
+ *                            rounded up to multiplication of 8 symbols (128 us).
+ *
+ * @retval  true   The energy scan procedure was scheduled.
+ * @retval  false  The driver could not schedule the energy scan procedure.
+ */
+bool nrf_802154_energy_scan(uint32_t channel_mask, uint32_t dwell_time_us);
+
 /**
  * @brief Changes the radio state to @ref RADIO_STATE_TX.
  *
@@ -88,6 +88,20 @@ extern void nrf_802154_energy_detected(uint8_t result);
  */
 extern void nrf_802154_energy_detection_failed(nrf_802154_ed_error_t error);
 
+/**
+ * @brief Notifies that the energy scan procedure finished.
+ *
+ * @note The @p p_results buffer is valid only during the execution of this function.
+ *
+ * @param[in]  channel_mask   Mask of scanned channels.
+ * @param[in]  p_results      Maximum energy detected on the scanned channels, in increasing
+ *                            channel order.
+ * @param[in]  results_count  Number of elements in @p p_results.
+ */
+extern void nrf_802154_energy_scan_done(uint32_t        channel_mask,
+                                        const uint8_t * p_results,
+                                        uint8_t         results_count);
+
 /**
  * @brief Notifies about the start of the ACK frame transmission.
  *
@@ -364,6 +364,12 @@ typedef struct
     bool                  use_global_frame_counter; // !< Whether to use the global frame counter instead of the one defined in this structure.
 } nrf_802154_key_t;
 
+/**@brief Maximum number of channels scanned by @ref nrf_802154_energy_scan. */
+#define NRF_802154_ENERGY_SCAN_CHANNELS_MAX  16U
+
+/**@brief Mask of channels that can be scanned by @ref nrf_802154_energy_scan. */
+#define NRF_802154_ENERGY_SCAN_CHANNELS_MASK 0x07FFF800UL
+
 /**
  *@}
  **/
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2021 - 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file nrf_802154_serialization_shared_mem.h
+ * @brief Memory shared by both peers of 802.15.4 serialization.
+ *
+ * Used when @ref NRF_802154_SER_SHARED_MEM_ENABLED is set.
+ */
+
+#ifndef NRF_802154_SERIALIZATION_SHARED_MEM_H__
+#define NRF_802154_SERIALIZATION_SHARED_MEM_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @brief Checks if a buffer is located in memory accessible at the same address by both peers.
+ *
+ * @param[in]  p_data  Pointer to the beginning of the buffer.
+ * @param[in]  size    Size of the buffer.
+ *
+ * @retval true   The whole buffer is located in the shared memory.
+ * @retval false  At least a part of the buffer is not located in the shared memory.
+ */
+bool nrf_802154_serialization_shared_mem_contains(const void * p_data, size_t size);
+
+#endif // NRF_802154_SERIALIZATION_SHARED_MEM_H__
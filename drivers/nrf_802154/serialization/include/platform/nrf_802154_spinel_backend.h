@@ -63,6 +63,84 @@ extern "C" {
 nrf_802154_ser_err_t nrf_802154_spinel_encoded_packet_send(const void * p_data,
                                                            size_t       data_len);
 
+/**
+ * @brief Reserves a transmit buffer of the spinel backend to encode a frame directly into it.
+ *
+ * The buffer is lent out until it is passed to
+ * @ref nrf_802154_spinel_encoded_packet_buffer_commit or
+ * @ref nrf_802154_spinel_encoded_packet_buffer_release. The backend should provide
+ * a buffer of at least @ref NRF_802154_SPINEL_FRAME_BUFFER_SIZE bytes.
+ *
+ * A default implementation that never lends a buffer is provided. In that case frames are
+ * encoded into a temporary buffer and sent with @ref nrf_802154_spinel_encoded_packet_send.
+ *
+ * @param[out] p_buffer_size  Size of the reserved buffer.
+ *
+ * @returns  Pointer to the reserved buffer or NULL if no buffer could be reserved.
+ *
+ */
+void * nrf_802154_spinel_encoded_packet_buffer_reserve(size_t * p_buffer_size);
+
+/**
+ * @brief Sends a spinel frame encoded into a buffer reserved with
+ *        @ref nrf_802154_spinel_encoded_packet_buffer_reserve.
+ *
+ * The buffer is returned to the backend when this function returns.
+ *
+ * @param[in]  p_buffer  Pointer to the reserved buffer.
+ * @param[in]  data_len  Number of bytes of the encoded frame.
+ *
+ * @returns  zero on success or negative error value on failure.
+ *
+ */
+nrf_802154_ser_err_t nrf_802154_spinel_encoded_packet_buffer_commit(void * p_buffer,
+                                                                    size_t data_len);
+
+/**
+ * @brief Returns a buffer reserved with @ref nrf_802154_spinel_encoded_packet_buffer_reserve
+ *        to the backend without sending it.
+ *
+ * @param[in]  p_buffer  Pointer to the reserved buffer.
+ *
+ */
+void nrf_802154_spinel_encoded_packet_buffer_release(void * p_buffer);
+
+/**
+ * @brief Sends a spinel frame over a lane of spinel backend.
+ *
+ * Used when @ref NRF_802154_SER_PRIORITY_LANES_ENABLED is set. A default implementation that
+ * sends all frames with @ref nrf_802154_spinel_encoded_packet_send is provided.
+ *
+ * @param[in]  lane      Lane to send the frame over.
+ * @param[in]  p_data    Pointer to a buffer that contains spinel encoded frame.
+ * @param[in]  data_len  Size of the @ref p_data buffer.
+ *
+ * @returns  number of bytes sent or negative error value on failure.
+ *
+ */
+nrf_802154_ser_err_t nrf_802154_spinel_encoded_packet_lane_send(nrf_802154_spinel_lane_t lane,
+                                                                const void             * p_data,
+                                                                size_t                   data_len);
+
+/**
+ * @brief Sends a spinel frame encoded into a buffer reserved with
+ *        @ref nrf_802154_spinel_encoded_packet_buffer_reserve over a lane of spinel backend.
+ *
+ * Used when @ref NRF_802154_SER_PRIORITY_LANES_ENABLED is set. A default implementation that
+ * sends all frames with @ref nrf_802154_spinel_encoded_packet_buffer_commit is provided.
+ *
+ * @param[in]  lane      Lane to send the frame over.
+ * @param[in]  p_buffer  Pointer to the reserved buffer.
+ * @param[in]  data_len  Number of bytes of the encoded frame.
+ *
+ * @returns  zero on success or negative error value on failure.
+ *
+ */
+nrf_802154_ser_err_t nrf_802154_spinel_encoded_packet_buffer_lane_commit(
+    nrf_802154_spinel_lane_t lane,
+    void                   * p_buffer,
+    size_t                   data_len);
+
 /**
  * @brief Initializes spinel backend.
  *
@@ -48,6 +48,18 @@
 extern "C" {
 #endif
 
+/**
+ * @brief Lanes of the spinel backend.
+ *
+ * Frames are kept in order within a lane only. See @ref NRF_802154_SER_PRIORITY_LANES_ENABLED.
+ */
+typedef enum
+{
+    NRF_802154_SPINEL_LANE_BULK,   ///< Lane of the requests, responses and received frames.
+    NRF_802154_SPINEL_LANE_URGENT, ///< Lane of the latency-critical notifications.
+    NRF_802154_SPINEL_LANE_COUNT,  ///< Number of lanes.
+} nrf_802154_spinel_lane_t;
+
 /**
  * @brief Notifies that spinel frame was received over spinel backend.
  *
@@ -57,6 +69,23 @@ extern "C" {
  */
 extern void nrf_802154_spinel_encoded_packet_received(const void * p_data, size_t data_len);
 
+/**
+ * @brief Notifies that spinel frame was received over a lane of spinel backend.
+ *
+ * If the frame is received while another frame is being decoded, it is copied and decoded
+ * later, after the frames already waiting on the urgent lane. Without
+ * @ref NRF_802154_SER_PRIORITY_LANES_ENABLED the frame is decoded immediately, like with
+ * @ref nrf_802154_spinel_encoded_packet_received.
+ *
+ * @param[in]  lane      Lane the frame was received over.
+ * @param[in]  p_data    Pointer to a buffer that contains received frame.
+ * @param[in]  data_len  Size of the @ref p_data buffer.
+ *
+ */
+extern void nrf_802154_spinel_encoded_packet_lane_received(nrf_802154_spinel_lane_t lane,
+                                                           const void             * p_data,
+                                                           size_t                   data_len);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @file nrf_802154_spinel_backend_uart.h
+ * @brief UART spinel backend of 802.15.4 serialization.
+ *
+ * Used when @ref NRF_802154_SER_BACKEND_UART_ENABLED is set. The backend implements
+ * the functions declared in nrf_802154_spinel_backend.h on top of the UARTE driver.
+ */
+
+#ifndef NRF_802154_SPINEL_BACKEND_UART_H__
+#define NRF_802154_SPINEL_BACKEND_UART_H__
+
+#include <stdint.h>
+
+#include <nrfx_uarte.h>
+
+/**
+ * @brief Hardware resources used by the UART spinel backend.
+ */
+typedef struct
+{
+    nrfx_uarte_t        uarte;        ///< UARTE instance. Its interrupt must call the nrfx handler.
+    nrfx_uarte_config_t uarte_config; ///< UARTE configuration. @c p_context is overwritten.
+    NRF_TIMER_Type    * p_counter;    ///< TIMER instance counting received bytes.
+    uint8_t             ppi_channel;  ///< (D)PPI channel for counting received bytes.
+} nrf_802154_spinel_backend_uart_config_t;
+
+/**
+ * @brief Provides the hardware resources used by the UART spinel backend.
+ *
+ * Called once from @ref nrf_802154_backend_init. Implemented by the platform.
+ *
+ * @param[out] p_config  Configuration to fill.
+ */
+extern void nrf_802154_spinel_backend_uart_config_get(
+    nrf_802154_spinel_backend_uart_config_t * p_config);
+
+/**
+ * @brief Passes data received over an idle line to the UART spinel backend.
+ *
+ * Frames are passed on as soon as a reception chunk fills up. Frames shorter than a chunk
+ * are passed on when this function detects that no byte was received since its previous call,
+ * so the period of the calls bounds the latency of such frames. A period of a few byte times
+ * at the configured baud rate keeps the latency low. Received frames are passed to
+ * @ref nrf_802154_spinel_encoded_packet_received from the context of this function or from
+ * the UARTE interrupt.
+ */
+void nrf_802154_spinel_backend_uart_poll(void);
+
+#endif // NRF_802154_SPINEL_BACKEND_UART_H__
@@ -42,6 +42,11 @@
 #ifndef NRF_802154_SERIALIZATION_H_
 #define NRF_802154_SERIALIZATION_H_
 
+#include <stdbool.h>
+
+#include "nrf_802154_serialization_config.h"
+#include "nrf_802154_serialization_error.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -52,6 +57,46 @@ extern "C" {
  */
 void nrf_802154_serialization_init(void);
 
+#if NRF_802154_SER_PIPELINE_ENABLED
+
+/**
+ * @brief Starts pipelining of serialized requests.
+ *
+ * Until @ref nrf_802154_serialization_pipeline_end is called, the API calls that respond only
+ * with a status return as soon as the request is sent without waiting for the network core.
+ * Requests are tagged with spinel transaction identifiers and their statuses are collected
+ * asynchronously. When all transaction identifiers are in use, the next request waits for
+ * the outstanding statuses first. API calls returning a value other than a status still
+ * wait for their responses.
+ *
+ * In the fire-and-forget mode, the network core reports only failed requests.
+ *
+ * @note The pipeline is intended for sequences of calls issued from a single context, like
+ *       the driver configuration during initialization. Requests issued concurrently from
+ *       other contexts are pipelined as well and their failures are reported only by
+ *       @ref nrf_802154_serialization_pipeline_end.
+ *
+ * @param[in]  fire_and_forget  If the network core should skip successful statuses.
+ */
+void nrf_802154_serialization_pipeline_begin(bool fire_and_forget);
+
+/**
+ * @brief Finishes pipelining of serialized requests.
+ *
+ * Waits until the network core processes all the requests pipelined since
+ * @ref nrf_802154_serialization_pipeline_begin was called.
+ *
+ * @retval NRF_802154_SERIALIZATION_ERROR_OK                All pipelined requests succeeded.
+ * @retval NRF_802154_SERIALIZATION_ERROR_RESPONSE_INVALID  At least one pipelined request failed
+ *                                                          or its status was not received.
+ * @retval NRF_802154_SERIALIZATION_ERROR_RESPONSE_TIMEOUT  The network core did not confirm
+ *                                                          processing of the requests in time.
+ * @return Other negative error value if the synchronization request could not be sent.
+ */
+nrf_802154_ser_err_t nrf_802154_serialization_pipeline_end(void);
+
+#endif // NRF_802154_SER_PIPELINE_ENABLED
+
 #ifdef __cplusplus
 }
 #endif
@@ -49,4 +49,203 @@
 #define NRF_802154_TX_BUFFERS 4
 #endif
 
+/**
+ * @brief Enables coalescing of received frame notifications sent by the network core.
+ *
+ * When enabled, several received frames are sent to the application core in a single
+ * spinel frame. The frames are sent when @ref NRF_802154_SER_RX_BATCH_MAX_COUNT frames are
+ * pending, when @ref NRF_802154_SER_RX_BATCH_MAX_LATENCY_US elapses since the oldest pending
+ * frame was received, or before any other notification to keep notifications ordered.
+ */
+#ifndef NRF_802154_SER_RX_BATCH_ENABLED
+#define NRF_802154_SER_RX_BATCH_ENABLED 0
+#endif
+
+/**
+ * @brief Maximum number of received frames coalesced before they are sent.
+ */
+#ifndef NRF_802154_SER_RX_BATCH_MAX_COUNT
+#define NRF_802154_SER_RX_BATCH_MAX_COUNT 4
+#endif
+
+/**
+ * @brief Maximum time in microseconds a received frame can wait to be coalesced with others.
+ */
+#ifndef NRF_802154_SER_RX_BATCH_MAX_LATENCY_US
+#define NRF_802154_SER_RX_BATCH_MAX_LATENCY_US 1000
+#endif
+
+/**
+ * @brief Enables passing received frames through memory shared by both cores.
+ *
+ * When enabled, a received frame located in the memory reported by
+ * @ref nrf_802154_serialization_shared_mem_contains is not copied into the spinel frame.
+ * Only its address is sent and the application core accesses the frame in place until it
+ * calls @ref nrf_802154_buffer_free_raw. The platform is responsible for placing the receive
+ * buffers of the driver in the shared memory. Frames outside of it are sent as usual.
+ */
+#ifndef NRF_802154_SER_SHARED_MEM_ENABLED
+#define NRF_802154_SER_SHARED_MEM_ENABLED 0
+#endif
+
+/**
+ * @brief Enables pipelining of serialized configuration requests on the application core.
+ *
+ * When enabled, requests issued between @ref nrf_802154_serialization_pipeline_begin and
+ * @ref nrf_802154_serialization_pipeline_end do not wait for the status returned by the network
+ * core. The statuses are collected asynchronously and reported by
+ * @ref nrf_802154_serialization_pipeline_end.
+ */
+#ifndef NRF_802154_SER_PIPELINE_ENABLED
+#define NRF_802154_SER_PIPELINE_ENABLED 0
+#endif
+
+/**
+ * @brief Enables estimation of the network core time on the application core.
+ *
+ * When enabled, @ref nrf_802154_time_get is served from the local clock provided by
+ * @ref nrf_802154_serialization_local_time_get corrected with the estimated offset and drift
+ * between both clocks. The estimate is refreshed with a request to the network core once per
+ * @ref NRF_802154_SER_TIME_SYNC_REFRESH_PERIOD_US.
+ */
+#ifndef NRF_802154_SER_TIME_SYNC_ENABLED
+#define NRF_802154_SER_TIME_SYNC_ENABLED 0
+#endif
+
+/**
+ * @brief Maximum time in microseconds the network core time is estimated without refreshing.
+ *
+ * The error of the estimate is bounded by half of the request round trip time increased by
+ * the residual drift accumulated within this period.
+ */
+#ifndef NRF_802154_SER_TIME_SYNC_REFRESH_PERIOD_US
+#define NRF_802154_SER_TIME_SYNC_REFRESH_PERIOD_US 1000000
+#endif
+
+/**
+ * @brief Maximum drift in ppm between the clocks of both cores accepted by the estimation.
+ *
+ * Drift measured above this value is clamped, as it results from an inaccurate measurement
+ * rather than from the clock sources.
+ */
+#ifndef NRF_802154_SER_TIME_SYNC_MAX_DRIFT_PPM
+#define NRF_802154_SER_TIME_SYNC_MAX_DRIFT_PPM 100
+#endif
+
+/**
+ * @brief Enables statistics of the serialization link.
+ *
+ * When enabled, frames and bytes sent and received are counted per spinel property. On the
+ * application core, round trip times of awaited responses are measured with
+ * @ref nrf_802154_serialization_local_time_get. The statistics are read with the functions
+ * declared in nrf_802154_serialization_stats.h.
+ */
+#ifndef NRF_802154_SER_STATS_ENABLED
+#define NRF_802154_SER_STATS_ENABLED 0
+#endif
+
+/**
+ * @brief Enables the mirror of the network core PIB and capabilities on the application core.
+ *
+ * When enabled, the channel, the transmit power, the capabilities, the CCA configuration and
+ * the CSMA-CA parameters are remembered on the application core once they are successfully set
+ * or read. Subsequent getters of these values are served locally, without a request to
+ * the network core. The mirror is cleared by @ref nrf_802154_init.
+ */
+#ifndef NRF_802154_SER_PIB_MIRROR_ENABLED
+#define NRF_802154_SER_PIB_MIRROR_ENABLED 0
+#endif
+
+/**
+ * @brief Enables compact serialization of received frame notifications.
+ *
+ * When enabled, the network core notifies received frames that are not coalesced by
+ * @ref NRF_802154_SER_RX_BATCH_ENABLED nor located in shared memory with
+ * @c SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW_COMPACT. The frame handle and
+ * the timestamp are sent as varint differences against the previous compact notification,
+ * which saves about 8 bytes per frame. After a failed notification the next one carries
+ * the full values again.
+ */
+#ifndef NRF_802154_SER_COMPACT_NOTIFICATIONS_ENABLED
+#define NRF_802154_SER_COMPACT_NOTIFICATIONS_ENABLED 0
+#endif
+
+/**
+ * @brief Enables the urgent and bulk lanes of the serialization transport.
+ *
+ * When enabled, the network core sends the transmission results, the CCA results and
+ * the ACK-started notifications on the urgent lane, and all other frames on the bulk lane.
+ * Frames are kept in order only within a lane, so an urgent notification does not wait behind
+ * received frames queued in the transport. Backends implement the lanes with
+ * @ref nrf_802154_spinel_encoded_packet_lane_send and
+ * @ref nrf_802154_spinel_encoded_packet_buffer_lane_commit and pass received frames to
+ * @ref nrf_802154_spinel_encoded_packet_lane_received. Frames that arrive while the receiving
+ * side is busy decoding are queued per lane and the urgent ones are decoded first, so
+ * the callouts invoked by the decoder must not wait for responses of serialized requests.
+ * Backends that do not implement the lanes keep sending all frames in a single ordered stream.
+ */
+#ifndef NRF_802154_SER_PRIORITY_LANES_ENABLED
+#define NRF_802154_SER_PRIORITY_LANES_ENABLED 0
+#endif
+
+/**
+ * @brief Number of received frames that can be queued on the urgent lane.
+ */
+#ifndef NRF_802154_SER_LANE_URGENT_RX_SLOTS
+#define NRF_802154_SER_LANE_URGENT_RX_SLOTS 2
+#endif
+
+/**
+ * @brief Number of received frames that can be queued on the bulk lane.
+ *
+ * Each slot holds a spinel frame of the maximum size. A frame received while all the slots of
+ * its lane are in use is dropped with @ref NRF_802154_SERIALIZATION_ERROR_NO_MEMORY.
+ */
+#ifndef NRF_802154_SER_LANE_BULK_RX_SLOTS
+#define NRF_802154_SER_LANE_BULK_RX_SLOTS 4
+#endif
+
+/**
+ * @brief Enables the UART spinel backend.
+ *
+ * When enabled, spinel frames are exchanged with the other chip over UARTE, delimited with
+ * HDLC-lite framing and protected with the 16-bit HDLC frame check sequence. Reception runs
+ * in the streaming mode of the UARTE driver. The platform provides the hardware resources
+ * with @ref nrf_802154_spinel_backend_uart_config_get and calls
+ * @ref nrf_802154_spinel_backend_uart_poll periodically. Hardware flow control is
+ * recommended, so that the receiver throttles the transmitter when it falls behind.
+ */
+#ifndef NRF_802154_SER_BACKEND_UART_ENABLED
+#define NRF_802154_SER_BACKEND_UART_ENABLED 0
+#endif
+
+/**
+ * @brief Number of spinel frames the UART backend can hold while they are transmitted.
+ *
+ * Each buffer holds a spinel frame of the maximum size with every byte escaped. Sending fails
+ * with @ref NRF_802154_SERIALIZATION_ERROR_NO_MEMORY when all the buffers are in use.
+ * The value must not exceed NRFX_UARTE_TX_QUEUE_SIZE increased by one.
+ */
+#ifndef NRF_802154_SER_BACKEND_UART_TX_BUFFERS
+#define NRF_802154_SER_BACKEND_UART_TX_BUFFERS 4
+#endif
+
+/**
+ * @brief Size in bytes of a single chunk of the UART backend reception ring.
+ */
+#ifndef NRF_802154_SER_BACKEND_UART_RX_CHUNK_SIZE
+#define NRF_802154_SER_BACKEND_UART_RX_CHUNK_SIZE 64
+#endif
+
+/**
+ * @brief Number of chunks of the UART backend reception ring.
+ *
+ * Received data must be processed before the ring wraps around, so the ring should hold
+ * at least the number of bytes received within the longest UARTE interrupt latency and
+ * the period of @ref nrf_802154_spinel_backend_uart_poll.
+ */
+#ifndef NRF_802154_SER_BACKEND_UART_RX_CHUNK_COUNT
+#define NRF_802154_SER_BACKEND_UART_RX_CHUNK_COUNT 4
+#endif
+
 #endif // NRF_802154_SER_CONFIG_H__
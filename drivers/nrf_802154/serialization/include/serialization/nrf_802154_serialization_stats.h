@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @defgroup nrf_802154_serialization_stats
+ * 802.15.4 radio driver serialization statistics
+ * @{
+ *
+ */
+
+#ifndef NRF_802154_SERIALIZATION_STATS_H_
+#define NRF_802154_SERIALIZATION_STATS_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_serialization_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Statistics of a single spinel property.
+ */
+typedef struct
+{
+    uint32_t sent_frames;     ///< Number of frames sent with the property.
+    uint32_t sent_bytes;      ///< Number of bytes of the encoded frames sent with the property.
+    uint32_t received_frames; ///< Number of frames received with the property.
+    uint32_t received_bytes;  ///< Number of bytes of the encoded frames received with the property.
+    uint32_t awaited;         ///< Number of responses awaited after sending the property.
+    uint32_t await_timeouts;  ///< Number of awaited responses that were not received in time.
+    uint32_t await_min_us;    ///< Shortest round trip time of a received response.
+    uint32_t await_max_us;    ///< Longest round trip time of a received response.
+    uint64_t await_total_us;  ///< Sum of round trip times of received responses.
+} nrf_802154_serialization_prop_stats_t;
+
+/**
+ * @brief Statistics of the serialization link.
+ */
+typedef struct
+{
+    uint32_t sent_frames;     ///< Number of frames sent.
+    uint32_t sent_bytes;      ///< Number of bytes of the encoded frames sent.
+    uint32_t received_frames; ///< Number of frames received.
+    uint32_t received_bytes;  ///< Number of bytes of the encoded frames received.
+    uint32_t buffers_peak;    ///< Peak number of buffers allocated for remote peer's frames.
+} nrf_802154_serialization_stats_t;
+
+#if NRF_802154_SER_STATS_ENABLED
+
+/**
+ * @brief Gets statistics of the serialization link of this core.
+ *
+ * @param[out] p_stats  Pointer to the structure to be filled with the statistics.
+ */
+void nrf_802154_serialization_stats_get(nrf_802154_serialization_stats_t * p_stats);
+
+/**
+ * @brief Gets statistics of a spinel property on this core.
+ *
+ * All the properties that are not vendor properties of the 802.15.4 serialization, like
+ * @c SPINEL_PROP_LAST_STATUS, share a single entry.
+ *
+ * The average round trip time is @c await_total_us divided by the number of received
+ * responses, i.e. @c awaited decreased by @c await_timeouts.
+ *
+ * @param[in]  property  Spinel property.
+ * @param[out] p_stats   Pointer to the structure to be filled with the statistics.
+ */
+void nrf_802154_serialization_prop_stats_get(uint32_t                                property,
+                                             nrf_802154_serialization_prop_stats_t * p_stats);
+
+/**
+ * @brief Resets all the statistics of the serialization link of this core.
+ */
+void nrf_802154_serialization_stats_reset(void);
+
+#endif // NRF_802154_SER_STATS_ENABLED
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_802154_SERIALIZATION_STATS_H_ */
+
+/** @} */
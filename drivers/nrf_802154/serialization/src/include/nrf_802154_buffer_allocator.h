@@ -64,22 +64,37 @@
 #define NRF_802154_BUFFER_ALLOCATOR_MEMORY_SIZE(capacity) \
     ((capacity) * (sizeof(nrf_802154_buffer_t)))
 
+/** @brief Maximum number of buffers a single buffer allocator instance can store. */
+#define NRF_802154_BUFFER_ALLOCATOR_MAX_CAPACITY 0xFFFEU
+
 /** @brief Structure representing a buffer. */
 typedef struct
 {
     /** @brief Stored data. */
-    uint8_t       data[NRF_802154_BUFFER_ALLOCATOR_DEFAULT_BUFFER_LEN];
+    uint8_t           data[NRF_802154_BUFFER_ALLOCATOR_DEFAULT_BUFFER_LEN];
+    /** @brief Index of the next buffer in the free list. Valid only when the buffer is free. */
+    volatile uint16_t next_free;
     /** @brief Flag indicating if a buffer is currently in use. */
-    volatile bool taken;
+    volatile bool     taken;
 } nrf_802154_buffer_t;
 
 /** @brief Structure representing a buffer allocator. */
 typedef struct
 {
     /** @brief Pointer to a memory used to store buffers. */
-    void * p_memory;
+    void            * p_memory;
     /** @brief Maximum number of buffers the buffer allocator instance is able to store. */
-    size_t capacity;
+    size_t            capacity;
+    /** @brief Head of the free list.
+     *
+     * Lower 16 bits hold the index of the first free buffer. Upper 16 bits hold a tag that is
+     * incremented on every allocation to protect the list against the ABA problem.
+     */
+    volatile uint32_t free_head;
+    /** @brief Number of buffers currently allocated. */
+    volatile uint32_t used;
+    /** @brief Highest number of buffers allocated at the same time. */
+    volatile uint32_t peak_used;
 } nrf_802154_buffer_allocator_t;
 
 /**
@@ -105,9 +120,11 @@ void nrf_802154_buffer_allocator_init(nrf_802154_buffer_allocator_t * p_obj,
  *
  * @param[in] p_obj  Pointer to a buffer allocator that stores the buffer pool to allocate from.
  *
+ * @note This function is lock-free and can be called from any context.
+ *
  * @return Pointer to allocated buffer or NULL if no buffer could be allocated.
  */
-void * nrf_802154_buffer_allocator_alloc(const nrf_802154_buffer_allocator_t * p_obj);
+void * nrf_802154_buffer_allocator_alloc(nrf_802154_buffer_allocator_t * p_obj);
 
 /**
  * @brief Frees buffer allocated for 802.15.4 reception or transmission.
@@ -116,8 +133,9 @@ void * nrf_802154_buffer_allocator_alloc(const nrf_802154_buffer_allocator_t * p
  * @param[in] p_buffer  Pointer to a buffer to free.
  *
  * @note This function should be used complementary to @ref nrf_802154_buffer_allocator_alloc.
+ *       It is lock-free and can be called from any context.
  */
-void nrf_802154_buffer_allocator_free(const nrf_802154_buffer_allocator_t * p_obj, void * p_buffer);
+void nrf_802154_buffer_allocator_free(nrf_802154_buffer_allocator_t * p_obj, void * p_buffer);
 
 /**
  * @brief Gets total number of buffers a buffer allocator can store.
@@ -132,4 +150,43 @@ static inline size_t nrf_802154_buffer_allocator_capacity(
     return p_obj->capacity;
 }
 
+/**
+ * @brief Checks if a buffer belongs to the pool of a buffer allocator.
+ *
+ * @param[in] p_obj     Pointer to a buffer allocator to check.
+ * @param[in] p_buffer  Pointer to a buffer to check.
+ *
+ * @retval true   @p p_buffer points to memory managed by @p p_obj.
+ * @retval false  @p p_buffer points outside of the memory managed by @p p_obj.
+ */
+static inline bool nrf_802154_buffer_allocator_owns(const nrf_802154_buffer_allocator_t * p_obj,
+                                                    const void                          * p_buffer)
+{
+    const uint8_t * p_begin = (const uint8_t *)p_obj->p_memory;
+    const uint8_t * p_end   = p_begin + NRF_802154_BUFFER_ALLOCATOR_MEMORY_SIZE(p_obj->capacity);
+
+    return ((const uint8_t *)p_buffer >= p_begin) && ((const uint8_t *)p_buffer < p_end);
+}
+
+/**
+ * @brief Gets the highest number of buffers allocated at the same time.
+ *
+ * @param[in] p_obj  Pointer to a buffer allocator to check.
+ *
+ * @return  Peak number of allocated buffers since initialization or the last call to
+ *          @ref nrf_802154_buffer_allocator_peak_usage_reset.
+ */
+static inline size_t nrf_802154_buffer_allocator_peak_usage_get(
+    const nrf_802154_buffer_allocator_t * p_obj)
+{
+    return p_obj->peak_used;
+}
+
+/**
+ * @brief Resets the peak usage of a buffer allocator to the number of buffers currently allocated.
+ *
+ * @param[in] p_obj  Pointer to a buffer allocator to reset.
+ */
+void nrf_802154_buffer_allocator_peak_usage_reset(nrf_802154_buffer_allocator_t * p_obj);
+
 #endif // NRF_802154_BUFFER_ALLOCATOR_H__
@@ -58,7 +58,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 
-#include "nrf_802154_kvmap.h"
+#include "nrf_802154_kvmap_u32.h"
 #include "nrf_802154_buffer_allocator.h"
 
 /**@brief Type of a buffer manager for destination peer of serialization. */
@@ -66,10 +66,10 @@ typedef struct
 {
     /**@brief Map for matching local pointers to remote buffer handle.
      *
-     * Key is a local pointer (@c void*)
+     * Key is a local pointer (@c void* stored as @c uint32_t)
      * Value is a remote buffer handle (@c uint32_t)
      */
-    nrf_802154_kvmap_t            map;
+    nrf_802154_kvmap_u32_t        map;
 
     /**@brief Allocator providing storage for local buffers. */
     nrf_802154_buffer_allocator_t allocator;
@@ -79,7 +79,7 @@ typedef struct
  * @param buffers_count     Number of buffers to be tracked.
  */
 #define NRF_802154_BUFFER_MGR_DST_MAP_MEMSIZE(buffers_count) \
-    NRF_802154_KVMAP_MEMORY_SIZE((buffers_count), sizeof(void *), sizeof(uint32_t))
+    NRF_802154_KVMAP_U32_MEMORY_SIZE(buffers_count)
 
 /**@brief Defines instance of @ref rf_802154_buffer_mgr_dst_t with all necessary accompanying
  *        variables.
@@ -176,6 +176,23 @@ bool nrf_802154_buffer_mgr_dst_add(
     size_t                        data_size,
     void                       ** pp_local_pointer);
 
+/**@brief Adds a remote buffer handle to a buffer manager for a buffer shared with the remote peer.
+ *
+ * No buffer is allocated and no data is copied. The local pointer is the address
+ * of the shared buffer, which stays owned by the remote peer.
+ *
+ * @param[in,out] p_obj           Pointer to a buffer manager object.
+ * @param[in]     buffer_handle   Handle of a remote buffer.
+ * @param[in]     p_shared        Pointer to the shared buffer.
+ *
+ * @retval true   Buffer added to tracking
+ * @retval false  Out of memory
+ */
+bool nrf_802154_buffer_mgr_dst_add_shared(
+    nrf_802154_buffer_mgr_dst_t * p_obj,
+    uint32_t                      buffer_handle,
+    void                        * p_shared);
+
 /**@brief Searches remote buffer handle by a local buffer pointer.
  *
  * @param[in,out] p_obj           Pointer to an host buffer manager object.
@@ -196,6 +213,7 @@ bool nrf_802154_buffer_mgr_dst_search_by_local_pointer(
 /**@brief Removes a local pointer to remote buffer handle association from a buffer manager.
  *
  * This function frees buffer pointed by a @p p_local_pointer if it exists in buffer manager.
+ * Buffers added by @ref nrf_802154_buffer_mgr_dst_add_shared are not freed.
  *
  * @param[in,out] p_obj           Pointer to a buffer manager object.
  * @param[in]     p_local_pointer Local pointer to be removed from buffer manager.
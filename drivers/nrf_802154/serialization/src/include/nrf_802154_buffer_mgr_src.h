@@ -59,20 +59,20 @@
 #include <stdbool.h>
 #include <stdint.h>
 
-#include "nrf_802154_kvmap.h"
+#include "nrf_802154_kvmap_u32.h"
 
 /**@brief Type of a buffer manager object for a source peer. */
 typedef struct
 {
     /**@brief Map for holding source peer local buffer pointers. */
-    nrf_802154_kvmap_t map;
+    nrf_802154_kvmap_u32_t map;
 } nrf_802154_buffer_mgr_src_t;
 
 /**@brief Calculates number of bytes needed to store map.
  * @param buffers_count     Number of buffers to be tracked.
  */
 #define NRF_802154_BUFFER_MGR_SRC_MAP_MEMSIZE(buffers_count) \
-    NRF_802154_KVMAP_MEMORY_SIZE((buffers_count), sizeof(uint32_t), 0U)
+    NRF_802154_KVMAP_U32_MEMORY_SIZE(buffers_count)
 
 /**@brief Defines instance of @ref nrf_802154_buffer_mgr_src_t with all necessary accompanying
  *        variables.
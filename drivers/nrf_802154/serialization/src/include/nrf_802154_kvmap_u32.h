@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2020 - 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/**@file nrf_802154_kvmap_u32.h
+ * @brief Key-value map with 32-bit keys and values using an open-addressing hash table.
+ *
+ * Compared to @ref nrf_802154_kvmap_t, this map has the key size fixed at compile time
+ * and finds items in constant expected time regardless of the number of stored items.
+ */
+
+#ifndef NRF_802154_KVMAP_U32_H_INCLUDED__
+#define NRF_802154_KVMAP_U32_H_INCLUDED__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**@brief Key value that cannot be stored in the map. It marks an empty slot. */
+#define NRF_802154_KVMAP_U32_KEY_INVALID 0UL
+
+/**@brief Structure representing a single slot of a map */
+typedef struct
+{
+    /**@brief Key of the item or @ref NRF_802154_KVMAP_U32_KEY_INVALID if the slot is empty */
+    uint32_t key;
+    /**@brief Value associated with the key */
+    uint32_t value;
+} nrf_802154_kvmap_u32_slot_t;
+
+/**@brief Structure representing a key-value map with 32-bit keys and values */
+typedef struct
+{
+    /**@brief Pointer to a memory used to store slots */
+    nrf_802154_kvmap_u32_slot_t * p_slots;
+    /**@brief Number of slots in the hash table */
+    size_t                        num_slots;
+    /**@brief Maximum number of items the key-value map instance is able to store */
+    size_t                        capacity;
+    /**@brief Number of currently stored items */
+    size_t                        count;
+} nrf_802154_kvmap_u32_t;
+
+/**@brief Calculates number of hash table slots needed to store given number of items.
+ *
+ * The table is kept at most half full so that probe sequences stay short.
+ */
+#define NRF_802154_KVMAP_U32_SLOTS(capacity) (2U * (capacity))
+
+/**@brief Calculates capacity of memory required to store a key-value map.
+ *
+ * Example:
+ * @code
+ * static uint8_t m_map_memory[NRF_802154_KVMAP_U32_MEMORY_SIZE(10)] __attribute__((aligned(4)));
+ * static nrf_802154_kvmap_u32_t m_map;
+ *
+ * nrf_802154_kvmap_u32_init(&m_map, m_map_memory, sizeof(m_map_memory));
+ * @endcode
+ */
+#define NRF_802154_KVMAP_U32_MEMORY_SIZE(capacity) \
+    (NRF_802154_KVMAP_U32_SLOTS(capacity) * sizeof(nrf_802154_kvmap_u32_slot_t))
+
+/**@brief Initializes a key-value map instance.
+ *
+ * @param[out] p_kvmap  Pointer to an object to initialize.
+ *                      The pointed object should persist as long as the map is in use.
+ *                      Cannot be NULL.
+ * @param[in] p_memory  Pointer to a 4-byte aligned memory to be used as slots storage.
+ *                      Memory pointed by this pointer should persist as long as
+ *                      the map pointed by @p p_kvmap is in use.
+ *                      Cannot be NULL (with exception, when memsize is 0)
+ * @param[in] memsize   Size of the memory pointed by @p p_memory. When defining
+ *                      storage you can use @ref NRF_802154_KVMAP_U32_MEMORY_SIZE helper macro.
+ */
+void nrf_802154_kvmap_u32_init(nrf_802154_kvmap_u32_t * p_kvmap,
+                               void                   * p_memory,
+                               size_t                   memsize);
+
+/**@brief Returns total number of items a key-value map can store
+ *
+ * @param[in] p_kvmap   Pointer to a key-value map to examine
+ *
+ * @return              Number of items a key-value map can store
+ */
+static inline size_t nrf_802154_kvmap_u32_capacity(const nrf_802154_kvmap_u32_t * p_kvmap)
+{
+    return p_kvmap->capacity;
+}
+
+/**@brief Returns current number of items a key-value actually holds.
+ *
+ * @param[in] p_kvmap   Pointer to a key-value map to examine
+ *
+ * @return              Number of items a key-value map holds
+ */
+static inline size_t nrf_802154_kvmap_u32_count(const nrf_802154_kvmap_u32_t * p_kvmap)
+{
+    return p_kvmap->count;
+}
+
+/**@brief Adds a key-value pair to a map.
+ *
+ * @param[in,out] p_kvmap   Pointer to a key-value map to modify
+ * @param[in]     key       Key to add. Must not be equal to @ref NRF_802154_KVMAP_U32_KEY_INVALID.
+ * @param[in]     value     Value associated with the key to add.
+ *
+ * @retval true     The key-value pair was successfully added to the map.
+ *                  This value is returned also when the key was already present in
+ *                  the map. In this case just the value is updated.
+ * @retval false    Maximum capacity of the map has been reached and new item
+ *                  could not be added.
+ */
+bool nrf_802154_kvmap_u32_add(nrf_802154_kvmap_u32_t * p_kvmap, uint32_t key, uint32_t value);
+
+/**@brief Removes a key-value pair from a map.
+ *
+ * @param[in,out] p_kvmap   Pointer to a key-value map to modify
+ * @param[in]     key       Key to remove.
+ *
+ * @retval true     The key was present in the map and has been removed.
+ * @retval false    The key was not found in the map. The map in unmodified.
+ */
+bool nrf_802154_kvmap_u32_remove(nrf_802154_kvmap_u32_t * p_kvmap, uint32_t key);
+
+/**@brief Searches for a key in a key-value map.
+ *
+ * @param[in]  p_kvmap  Pointer to a key-value map to search.
+ * @param[in]  key      Key to search.
+ * @param[out] p_value  If NULL. No value associated with potentially found key is retrieved.
+ *                      If not NULL, when the key is found, the value associated with the key
+ *                      is stored behind @p p_value. When the key is not found memory behind
+ *                      this pointer remains unmodified.
+ *
+ * @retval true     The key has been found.
+ * @retval false    The key has not been found. Memory pointed by @p p_value
+ *                  has been not modified.
+ */
+bool nrf_802154_kvmap_u32_search(const nrf_802154_kvmap_u32_t * p_kvmap,
+                                 uint32_t                       key,
+                                 uint32_t                     * p_value);
+
+#endif /* NRF_802154_KVMAP_U32_H_INCLUDED__ */
@@ -45,6 +45,7 @@
 #include "nrf_802154_serialization_error.h"
 #include "nrf_802154_buffer_mgr_dst.h"
 #include "nrf_802154_buffer_mgr_src.h"
+#include "nrf_802154_spinel_codec.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -73,6 +74,29 @@ extern "C" {
 #define NRF_802154_SPINEL_FRAME_BUFFER_SIZE (NRF_802154_SPINEL_FRAME_MAX_SIZE + \
                                              SPINEL_ENCRYPTER_EXTRA_DATA_SIZE)
 
+/**
+ * @brief Spinel transaction identifier of requests that are not correlated with a response.
+ */
+#define NRF_802154_SPINEL_TID_NONE             0U
+
+/**
+ * @brief First spinel transaction identifier used by pipelined requests.
+ */
+#define NRF_802154_SPINEL_TID_PIPELINE_FIRST   1U
+
+/**
+ * @brief Last spinel transaction identifier used by pipelined requests.
+ */
+#define NRF_802154_SPINEL_TID_PIPELINE_LAST    14U
+
+/**
+ * @brief Spinel transaction identifier of fire-and-forget requests.
+ *
+ * The network core does not respond with @c SPINEL_STATUS_OK to requests carrying this
+ * transaction identifier. Only failures are reported back to the application core.
+ */
+#define NRF_802154_SPINEL_TID_FIRE_AND_FORGET  15U
+
 /**
  * @brief Serializes data according to format string and sends it over spinel backend.
  *
@@ -85,6 +109,34 @@ extern "C" {
  */
 nrf_802154_ser_err_t nrf_802154_spinel_send(const char * p_fmt, ...);
 
+/**
+ * @brief Serializes data according to format string and sends it over the urgent lane of spinel
+ *        backend.
+ *
+ * Without @ref NRF_802154_SER_PRIORITY_LANES_ENABLED this function is equivalent to
+ * @ref nrf_802154_spinel_send.
+ *
+ * @param[in]  p_fmt  Pointer to a format string describing data types to be serialized.
+ *                    Format string should conform to spinel specification.
+ * @param[in]  ...    Data to be serialized and sent according to @ref p_fmt format string.
+ *
+ * @returns  number of bytes sent or negative error value on failure.
+ *
+ */
+nrf_802154_ser_err_t nrf_802154_spinel_send_urgent(const char * p_fmt, ...);
+
+/**
+ * @brief Encodes a spinel frame with a precompiled encoder and sends it over spinel backend.
+ *
+ * @param[in]  encoder  Encoder producing the complete spinel frame.
+ * @param[in]  p_args   Pointer to arguments passed to @p encoder.
+ *
+ * @returns  zero on success or negative error value on failure.
+ *
+ */
+nrf_802154_ser_err_t nrf_802154_spinel_send_encoded(nrf_802154_spinel_encoder_t encoder,
+                                                    const void                * p_args);
+
 /**
  * @brief Gets buffer manager for transactions originated by the remote serialization peer.
  *
@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) 2020 - 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/**
+ * @defgroup nrf_802154_spinel_serialization_codec
+ * 802.15.4 radio driver spinel serialization precompiled codecs
+ * @{
+ *
+ * Encoders and decoders in this module produce and consume exactly the same bytes as
+ * @ref spinel_datatype_pack and @ref spinel_datatype_unpack driven by the corresponding
+ * @c SPINEL_DATATYPE_NRF_802154_* format strings. The layout of each command is fixed at
+ * compile time, so the per-frame commands skip the generic format string interpreter.
+ */
+
+#ifndef NRF_802154_SPINEL_CODEC_H_
+#define NRF_802154_SPINEL_CODEC_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../spinel_base/spinel.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Type of a function that encodes a complete spinel frame.
+ *
+ * @param[out] p_out    Pointer to a buffer for the encoded frame.
+ * @param[in]  out_len  Size of the buffer pointed by @p p_out.
+ * @param[in]  p_args   Pointer to command specific arguments to encode.
+ *
+ * @returns  number of bytes of the encoded frame or negative value on failure.
+ */
+typedef spinel_ssize_t (* nrf_802154_spinel_encoder_t)(uint8_t    * p_out,
+                                                       size_t       out_len,
+                                                       const void * p_args);
+
+/**
+ * @brief Arguments of SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW.
+ */
+typedef struct
+{
+    uint32_t        frame_handle; ///< Handle of the received frame.
+    const uint8_t * p_frame;      ///< Pointer to the content of the received frame.
+    size_t          hdata_len;    ///< Length of the frame content as in @ref NRF_802154_HDATA_LENGTH.
+    int8_t          power;        ///< RSSI of the received frame.
+    uint8_t         lqi;          ///< LQI of the received frame.
+    uint64_t        timestamp;    ///< Timestamp of the received frame.
+} nrf_802154_spinel_received_timestamp_raw_args_t;
+
+/**
+ * @brief Arguments of SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW_BATCH.
+ */
+typedef struct
+{
+    const nrf_802154_spinel_received_timestamp_raw_args_t * p_frames;        ///< Frames to encode.
+    size_t                                                  count;           ///< Number of frames pointed by @c p_frames.
+    size_t                                                * p_encoded_count; ///< Number of frames that fit in the encoded frame.
+} nrf_802154_spinel_received_timestamp_raw_batch_args_t;
+
+/**
+ * @brief Reference of SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW_COMPACT.
+ *
+ * Both cores keep a copy of the values of the previous compact notification.
+ */
+typedef struct
+{
+    uint32_t frame_handle; ///< Frame handle of the previous notification.
+    uint64_t timestamp;    ///< Timestamp of the previous notification.
+    bool     valid;        ///< Indicates if the values above can be used as the reference.
+} nrf_802154_spinel_compact_ref_t;
+
+/**
+ * @brief Arguments of SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW_COMPACT.
+ */
+typedef struct
+{
+    const nrf_802154_spinel_received_timestamp_raw_args_t * p_rx;  ///< Frame to encode.
+    const nrf_802154_spinel_compact_ref_t                 * p_ref; ///< Reference to encode against.
+} nrf_802154_spinel_received_timestamp_raw_compact_args_t;
+
+/**
+ * @brief Decodes a spinel frame header.
+ *
+ * Equivalent of unpacking @c SPINEL_DATATYPE_COMMAND_S @c SPINEL_DATATYPE_DATA_S.
+ *
+ * @param[in]  p_data        Pointer to a buffer that contains spinel frame.
+ * @param[in]  data_len      Size of the @p p_data buffer.
+ * @param[out] p_cmd         Decoded command.
+ * @param[out] pp_cmd_data   Pointer to data of the command.
+ * @param[out] p_cmd_data_len Length of data of the command.
+ *
+ * @returns  number of bytes decoded or negative value on failure.
+ */
+spinel_ssize_t nrf_802154_spinel_codec_cmd_decode(const void       * p_data,
+                                                  size_t             data_len,
+                                                  spinel_command_t * p_cmd,
+                                                  const void      ** pp_cmd_data,
+                                                  size_t           * p_cmd_data_len);
+
+/**
+ * @brief Decodes a property key of a property command.
+ *
+ * Equivalent of unpacking @c SPINEL_DATATYPE_UINT_PACKED_S @c SPINEL_DATATYPE_DATA_S.
+ *
+ * @param[in]  p_cmd_data          Pointer to data of a property command.
+ * @param[in]  cmd_data_len        Size of the @p p_cmd_data buffer.
+ * @param[out] p_property          Decoded property key.
+ * @param[out] pp_property_data    Pointer to data of the property.
+ * @param[out] p_property_data_len Length of data of the property.
+ *
+ * @returns  number of bytes decoded or negative value on failure.
+ */
+spinel_ssize_t nrf_802154_spinel_codec_prop_decode(const void        * p_cmd_data,
+                                                   size_t              cmd_data_len,
+                                                   spinel_prop_key_t * p_property,
+                                                   const void       ** pp_property_data,
+                                                   size_t            * p_property_data_len);
+
+/**
+ * @brief Encodes SPINEL_CMD_PROP_VALUE_IS of
+ *        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW.
+ *
+ * Conforms to @ref nrf_802154_spinel_encoder_t. @p p_args points to
+ * @ref nrf_802154_spinel_received_timestamp_raw_args_t.
+ */
+spinel_ssize_t nrf_802154_spinel_codec_received_timestamp_raw_encode(uint8_t    * p_out,
+                                                                     size_t       out_len,
+                                                                     const void * p_args);
+
+/**
+ * @brief Decodes property data of SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW.
+ *
+ * @param[in]  p_property_data    Pointer to data of the property.
+ * @param[in]  property_data_len  Size of the @p p_property_data buffer.
+ * @param[out] p_args             Decoded arguments. @c p_frame points into @p p_property_data.
+ *
+ * @returns  number of bytes decoded or negative value on failure.
+ */
+spinel_ssize_t nrf_802154_spinel_codec_received_timestamp_raw_decode(
+    const void                                      * p_property_data,
+    size_t                                            property_data_len,
+    nrf_802154_spinel_received_timestamp_raw_args_t * p_args);
+
+/**
+ * @brief Encodes SPINEL_CMD_PROP_VALUE_IS of
+ *        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW_BATCH.
+ *
+ * Conforms to @ref nrf_802154_spinel_encoder_t. @p p_args points to
+ * @ref nrf_802154_spinel_received_timestamp_raw_batch_args_t. As many frames as fit into
+ * @p out_len are encoded, but at least one. Number of encoded frames is stored behind
+ * @c p_encoded_count.
+ */
+spinel_ssize_t nrf_802154_spinel_codec_received_timestamp_raw_batch_encode(uint8_t    * p_out,
+                                                                           size_t       out_len,
+                                                                           const void * p_args);
+
+/**
+ * @brief Encodes SPINEL_CMD_PROP_VALUE_IS of
+ *        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW_COMPACT.
+ *
+ * Conforms to @ref nrf_802154_spinel_encoder_t. @p p_args points to
+ * @ref nrf_802154_spinel_received_timestamp_raw_compact_args_t. The reference is not modified,
+ * the caller updates it with @ref nrf_802154_spinel_codec_compact_ref_update once the
+ * frame is sent.
+ */
+spinel_ssize_t nrf_802154_spinel_codec_received_timestamp_raw_compact_encode(
+    uint8_t    * p_out,
+    size_t       out_len,
+    const void * p_args);
+
+/**
+ * @brief Decodes property data of
+ *        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW_COMPACT.
+ *
+ * @param[in]    p_property_data    Pointer to data of the property.
+ * @param[in]    property_data_len  Size of the @p p_property_data buffer.
+ * @param[inout] p_ref              Reference to decode against. Updated on success.
+ * @param[out]   p_args             Decoded arguments. @c p_frame points into @p p_property_data.
+ *
+ * @returns  number of bytes decoded or negative value on failure.
+ */
+spinel_ssize_t nrf_802154_spinel_codec_received_timestamp_raw_compact_decode(
+    const void                                      * p_property_data,
+    size_t                                            property_data_len,
+    nrf_802154_spinel_compact_ref_t                 * p_ref,
+    nrf_802154_spinel_received_timestamp_raw_args_t * p_args);
+
+/**
+ * @brief Stores the values of a notified frame as the reference of the next compact
+ *        notification.
+ *
+ * @param[out] p_ref  Reference to update.
+ * @param[in]  p_rx   Notified frame.
+ */
+void nrf_802154_spinel_codec_compact_ref_update(
+    nrf_802154_spinel_compact_ref_t                       * p_ref,
+    const nrf_802154_spinel_received_timestamp_raw_args_t * p_rx);
+
+/**
+ * @brief Encodes SPINEL_CMD_PROP_VALUE_SET of SPINEL_PROP_VENDOR_NORDIC_NRF_802154_BUFFER_FREE_RAW.
+ *
+ * Conforms to @ref nrf_802154_spinel_encoder_t. @p p_args points to @c uint32_t handle
+ * of the buffer to free.
+ */
+spinel_ssize_t nrf_802154_spinel_codec_buffer_free_raw_encode(uint8_t    * p_out,
+                                                              size_t       out_len,
+                                                              const void * p_args);
+
+/**
+ * @brief Decodes property data of SPINEL_PROP_VENDOR_NORDIC_NRF_802154_BUFFER_FREE_RAW.
+ *
+ * @param[in]  p_property_data    Pointer to data of the property.
+ * @param[in]  property_data_len  Size of the @p p_property_data buffer.
+ * @param[out] p_buffer_handle    Decoded handle of the buffer to free.
+ *
+ * @returns  number of bytes decoded or negative value on failure.
+ */
+spinel_ssize_t nrf_802154_spinel_codec_buffer_free_raw_decode(const void * p_property_data,
+                                                              size_t       property_data_len,
+                                                              uint32_t   * p_buffer_handle);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_802154_SPINEL_CODEC_H_ */
+
+/** @} */
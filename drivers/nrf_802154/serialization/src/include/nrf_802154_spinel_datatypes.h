@@ -453,6 +453,68 @@ typedef enum
     SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_GLOBAL_FRAME_COUNTER_SET_IF_LARGER =
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 64,
 
+    /**
+     * Vendor property for nrf_802154_ack_data_set_batch serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_SET_BATCH =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 65,
+
+    /**
+     * Vendor property for nrf_802154_ack_data_clear_batch serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_CLEAR_BATCH =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 66,
+
+    /**
+     * Vendor property for serialization of multiple nrf_802154_received_timestamp_raw calls
+     * in a single frame.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW_BATCH =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 67,
+
+    /**
+     * Vendor property for nrf_802154_received_timestamp_raw serialization of a frame
+     * located in memory shared by both cores.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW_SHARED =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 68,
+
+    /**
+     * Vendor property for nrf_802154_receive_at_periodic serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_AT_PERIODIC =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 69,
+
+    /**
+     * Vendor property for nrf_802154_energy_scan serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_SCAN =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 70,
+
+    /**
+     * Vendor property for nrf_802154_energy_scan_done serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_SCAN_DONE =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 71,
+
+    /**
+     * Vendor property confirming that all pipelined requests sent before it were processed.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PIPELINE_SYNC =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 72,
+
+    /**
+     * Vendor property for nrf_802154_received_timestamp_raw serialization with the frame
+     * handle and the timestamp encoded relative to the previous notification.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW_COMPACT =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 73,
+
+    /**
+     * Marks the end of the vendor properties. Must remain the last entry.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154__END,
+
 } spinel_prop_vendor_key_t;
 
 /**
@@ -572,21 +634,24 @@ typedef enum
  */
 #define SPINEL_DATATYPE_NRF_802154_TRANSMIT_CSMA_CA_METADATA_S             \
     SPINEL_DATATYPE_NRF_802154_TRANSMITTED_FRAME_PROPS_S /* frame_props */ \
-    SPINEL_DATATYPE_NRF_802154_TX_POWER_METADATA_S       /* tx_power */
+    SPINEL_DATATYPE_NRF_802154_TX_POWER_METADATA_S       /* tx_power */    \
+    SPINEL_DATATYPE_UINT8_S                              /* max_frame_retries */
 
 /**
  * @brief Encodes an instance of @ref SPINEL_DATATYPE_NRF_802154_TRANSMIT_CSMA_CA_METADATA_S data type.
  */
 #define NRF_802154_TRANSMIT_CSMA_CA_METADATA_ENCODE(tx_metadata)          \
     NRF_802154_TRANSMITTED_FRAME_PROPS_ENCODE((tx_metadata).frame_props), \
-    NRF_802154_TX_POWER_METADATA_ENCODE((tx_metadata).tx_power)
+    NRF_802154_TX_POWER_METADATA_ENCODE((tx_metadata).tx_power),          \
+    ((tx_metadata).max_frame_retries)
 
 /**
  * @brief Decodes an instance of @ref SPINEL_DATATYPE_NRF_802154_TRANSMIT_CSMA_CA_METADATA_S data type.
  */
 #define NRF_802154_TRANSMIT_CSMA_CA_METADATA_DECODE(tx_metadata)          \
     NRF_802154_TRANSMITTED_FRAME_PROPS_DECODE((tx_metadata).frame_props), \
-    NRF_802154_TX_POWER_METADATA_DECODE((tx_metadata).tx_power)
+    NRF_802154_TX_POWER_METADATA_DECODE((tx_metadata).tx_power),          \
+    (&(tx_metadata).max_frame_retries)
 
 /**
  * @brief Spinel data type description for nrf_802154_csma_ca_min_be_set.
@@ -791,6 +856,22 @@ typedef enum
  */
 #define SPINEL_DATATYPE_NRF_802154_RECEIVE_AT_RET          SPINEL_DATATYPE_BOOL_S
 
+/**
+ * @brief Spinel data type description for nrf_802154_receive_at_periodic.
+ */
+#define SPINEL_DATATYPE_NRF_802154_RECEIVE_AT_PERIODIC \
+    SPINEL_DATATYPE_UINT64_S /* rx_time */             \
+    SPINEL_DATATYPE_UINT32_S /* period */              \
+    SPINEL_DATATYPE_UINT32_S /* timeout */             \
+    SPINEL_DATATYPE_UINT8_S  /* channel */             \
+    SPINEL_DATATYPE_UINT32_S /* count */               \
+    SPINEL_DATATYPE_UINT32_S /* window id */           \
+
+/**
+ * @brief Spinel data type description for nrf_802154_receive_at_periodic result.
+ */
+#define SPINEL_DATATYPE_NRF_802154_RECEIVE_AT_PERIODIC_RET SPINEL_DATATYPE_BOOL_S
+
 /**
  * @brief Spinel data type description for nrf_802154_receive_at_cancel.
  */
@@ -866,6 +947,30 @@ typedef enum
  */
 #define SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION_FAILED SPINEL_DATATYPE_UINT8_S
 
+/**
+ * @brief Spinel data type description for nrf_802154_energy_scan.
+ */
+#define SPINEL_DATATYPE_NRF_802154_ENERGY_SCAN         \
+    SPINEL_DATATYPE_UINT32_S /* channel_mask */        \
+    SPINEL_DATATYPE_UINT32_S /* dwell_time_us */       \
+
+/**
+ * @brief Spinel data type description for nrf_802154_energy_scan result.
+ */
+#define SPINEL_DATATYPE_NRF_802154_ENERGY_SCAN_RET SPINEL_DATATYPE_BOOL_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_energy_scan_done.
+ */
+#define SPINEL_DATATYPE_NRF_802154_ENERGY_SCAN_DONE    \
+    SPINEL_DATATYPE_UINT32_S    /* channel_mask */     \
+    SPINEL_DATATYPE_DATA_WLEN_S /* results */          \
+
+/**
+ * @brief Spinel data type description for the pipeline synchronization request.
+ */
+#define SPINEL_DATATYPE_NRF_802154_PIPELINE_SYNC SPINEL_DATATYPE_NULL_S
+
 /**
  * @brief Spinel data type description for nrf_802154_continuous_carrier.
  */
@@ -910,6 +1015,45 @@ typedef enum
     SPINEL_DATATYPE_UINT8_S            /* lqi */            \
     SPINEL_DATATYPE_UINT64_S           /* timestamp */
 
+/**
+ * @brief Spinel data type description for a number of received frames in
+ *        @ref SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW_BATCH.
+ *
+ * The count is followed by the given number of
+ * @ref SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW instances.
+ */
+#define SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW_BATCH_COUNT SPINEL_DATATYPE_UINT8_S
+
+/**
+ * @brief Spinel data type description for
+ *        @ref SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW_SHARED.
+ */
+#define SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW_SHARED \
+    SPINEL_DATATYPE_UINT32_S /* Frame handle */                 \
+    SPINEL_DATATYPE_UINT32_S /* Frame address */                \
+    SPINEL_DATATYPE_INT8_S   /* Power */                        \
+    SPINEL_DATATYPE_UINT8_S  /* lqi */                          \
+    SPINEL_DATATYPE_UINT64_S /* timestamp */
+
+/**
+ * @brief Spinel data type description for flags of
+ *        @ref SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW_COMPACT.
+ *
+ * The flags are followed by the zigzag encoded difference between the frame handle and the
+ * handle of the previous notification, the power, the lqi and the zigzag encoded difference
+ * between the timestamp and the timestamp of the previous notification. Both differences are
+ * little endian base 128 varints. The frame content as in @ref NRF_802154_HDATA_LENGTH fills
+ * the rest of the property data.
+ */
+#define SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW_COMPACT_FLAGS SPINEL_DATATYPE_UINT8_S
+
+/**
+ * @brief Flag of @ref SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW_COMPACT
+ *        indicating that the differences are relative to zero instead of the previous
+ *        notification.
+ */
+#define NRF_802154_SPINEL_COMPACT_FLAG_REFERENCE_RESET 0x01U
+
 /**
  * @brief Spinel data type description for nrf_802154_receive_failed
  */
@@ -1024,6 +1168,44 @@ typedef enum
  */
 #define SPINEL_DATATYPE_NRF_802154_ACK_DATA_CLEAR_RET SPINEL_DATATYPE_BOOL_S
 
+/**
+ * @brief Spinel data type desription for nrf_802154_ack_data_set_batch.
+ */
+#define SPINEL_DATATYPE_NRF_802154_ACK_DATA_SET_BATCH                    \
+    SPINEL_DATATYPE_DATA_WLEN_S /* Addresses */                          \
+    SPINEL_DATATYPE_BOOL_S      /* Extended */                           \
+    SPINEL_DATATYPE_DATA_WLEN_S /* Lengths of the data to be set */      \
+    SPINEL_DATATYPE_DATA_WLEN_S /* Concatenated data to be set */        \
+    SPINEL_DATATYPE_UINT8_S     /* Type of the data */
+
+/**
+ * @brief Spinel data type desription for nrf_802154_ack_data_set_batch return value.
+ */
+#define SPINEL_DATATYPE_NRF_802154_ACK_DATA_SET_BATCH_RET SPINEL_DATATYPE_BOOL_S
+
+/**
+ * @brief Spinel data type desription for nrf_802154_ack_data_clear_batch.
+ */
+#define SPINEL_DATATYPE_NRF_802154_ACK_DATA_CLEAR_BATCH \
+    SPINEL_DATATYPE_DATA_WLEN_S /* Addresses */         \
+    SPINEL_DATATYPE_BOOL_S      /* Extended */          \
+    SPINEL_DATATYPE_UINT8_S     /* Type of the data */
+
+/**
+ * @brief Spinel data type desription for nrf_802154_ack_data_clear_batch return value.
+ */
+#define SPINEL_DATATYPE_NRF_802154_ACK_DATA_CLEAR_BATCH_RET SPINEL_DATATYPE_BOOL_S
+
+/**
+ * @brief Maximal size of the addresses and data encoded by a single
+ *        @ref SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_SET_BATCH or
+ *        @ref SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_CLEAR_BATCH command.
+ *
+ * The remaining part of the Spinel frame is reserved for the header, the property identifier
+ * and the remaining fields of the command.
+ */
+#define NRF_802154_SPINEL_ACK_DATA_BATCH_PAYLOAD_MAX_SIZE 280
+
 /**
  * @brief Spinel data type description for nrf_802154_transmit_csma_ca_raw.
  */
@@ -1049,6 +1231,7 @@ typedef enum
  */
 #define SPINEL_DATATYPE_NRF_802154_TRANSMIT_DONE_METADATA_S                \
     SPINEL_DATATYPE_NRF_802154_TRANSMITTED_FRAME_PROPS_S /* Frame props */ \
+    SPINEL_DATATYPE_UINT8_S                              /* Retries */     \
     SPINEL_DATATYPE_UINT8_S                              /* Length */      \
     SPINEL_DATATYPE_INT8_S                               /* Power */       \
     SPINEL_DATATYPE_UINT8_S                              /* LQI */         \
@@ -1063,6 +1246,7 @@ typedef enum
  */
 #define NRF_802154_TRANSMIT_DONE_METADATA_ENCODE(metadata, ack_handle) \
     NRF_802154_TRANSMITTED_FRAME_PROPS_ENCODE((metadata).frame_props), \
+    (metadata).retries,                                                \
     (metadata).data.transmitted.length,                                \
     (metadata).data.transmitted.power,                                 \
     (metadata).data.transmitted.lqi,                                   \
@@ -1081,6 +1265,7 @@ typedef enum
  */
 #define NRF_802154_TRANSMIT_DONE_METADATA_DECODE(metadata, ack_handle, ack_length) \
     NRF_802154_TRANSMITTED_FRAME_PROPS_DECODE((metadata).frame_props),             \
+    &(metadata).retries,                                                           \
     &(metadata).data.transmitted.length,                                           \
     &(metadata).data.transmitted.power,                                            \
     &(metadata).data.transmitted.lqi,                                              \
@@ -1090,24 +1275,27 @@ typedef enum
 /**
  * @brief Spinel data type description for nrf_802154_transmit_failed_metadata.
  */
-#define SPINEL_DATATYPE_NRF_802154_TRANSMIT_FAILED_METADATA_S \
-    SPINEL_DATATYPE_NRF_802154_TRANSMITTED_FRAME_PROPS_S /* Frame props */
+#define SPINEL_DATATYPE_NRF_802154_TRANSMIT_FAILED_METADATA_S              \
+    SPINEL_DATATYPE_NRF_802154_TRANSMITTED_FRAME_PROPS_S /* Frame props */ \
+    SPINEL_DATATYPE_UINT8_S                              /* Retries */
 
 /**
  * @brief Encodes an instance of @ref SPINEL_DATATYPE_NRF_802154_TRANSMIT_FAILED_METADATA_S data type.
  *
  * @param[in]  metadata    Transmit failed metadata structure to be encoded.
  */
-#define NRF_802154_TRANSMIT_FAILED_METADATA_ENCODE(metadata) \
-    NRF_802154_TRANSMITTED_FRAME_PROPS_ENCODE((metadata).frame_props)
+#define NRF_802154_TRANSMIT_FAILED_METADATA_ENCODE(metadata)            \
+    NRF_802154_TRANSMITTED_FRAME_PROPS_ENCODE((metadata).frame_props), \
+    (metadata).retries
 
 /**
  * @brief Decodes an instance of @ref SPINEL_DATATYPE_NRF_802154_TRANSMIT_FAILED_METADATA_S data type.
  *
  * @param[out]  metadata    Transmit failed metadata structure to which store decoded data.
  */
-#define NRF_802154_TRANSMIT_FAILED_METADATA_DECODE(metadata) \
-    NRF_802154_TRANSMITTED_FRAME_PROPS_DECODE((metadata).frame_props)
+#define NRF_802154_TRANSMIT_FAILED_METADATA_DECODE(metadata)            \
+    NRF_802154_TRANSMITTED_FRAME_PROPS_DECODE((metadata).frame_props), \
+    &(metadata).retries
 
 /**
  * @brief Spinel data type description for nrf_802154_transmitted_raw.
@@ -42,14 +42,80 @@
 #ifndef NRF_802154_SPINEL_DEC_H_
 #define NRF_802154_SPINEL_DEC_H_
 
+#include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
+#include "../spinel_base/spinel.h"
+#include "nrf_802154_spinel_datatypes.h"
 #include "nrf_802154_serialization_error.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @brief Function decoding a vendor property and dealing with it.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_property_data buffer.
+ *
+ * @returns zero on success or negative error value on failure.
+ */
+typedef nrf_802154_ser_err_t (* nrf_802154_spinel_prop_decoder_t)(const void * p_property_data,
+                                                                   size_t       property_data_len);
+
+/**
+ * @brief Designated initializer of an entry of a table indexed by vendor property.
+ *
+ * @param[in]  prop   Vendor property without the @c SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ prefix.
+ * @param[in]  value  Value of the entry.
+ */
+#define NRF_802154_SPINEL_VENDOR_PROP_ENTRY(prop, value) \
+    [SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ ## prop -     \
+     SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN] = (value)
+
+/**
+ * @brief Gets index of a vendor property in a table indexed by vendor property.
+ *
+ * @param[in]  property     Spinel property.
+ * @param[in]  table_size   Number of entries of the table.
+ * @param[out] p_index      Index of the property in the table.
+ *
+ * @retval true   The property has an entry in the table.
+ * @retval false  The property is not a vendor property or it is beyond the table.
+ */
+static inline bool nrf_802154_spinel_vendor_prop_index_get(spinel_prop_key_t property,
+                                                           size_t            table_size,
+                                                           size_t          * p_index)
+{
+    // Properties below the vendor range wrap around to large values
+    size_t index = (size_t)((uint32_t)property -
+                            (uint32_t)SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN);
+
+    *p_index = index;
+
+    return index < table_size;
+}
+
+/**
+ * @brief Dispatches a vendor property to its decoder found in a table.
+ *
+ * @param[in]  p_decoders         Table of decoders indexed by vendor property.
+ * @param[in]  decoders_count     Number of entries of the @p p_decoders table.
+ * @param[in]  property           Spinel property received.
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_property_data buffer.
+ *
+ * @returns zero on success or negative error value on failure.
+ */
+nrf_802154_ser_err_t nrf_802154_spinel_dispatch_prop(
+    const nrf_802154_spinel_prop_decoder_t * p_decoders,
+    size_t                                   decoders_count,
+    spinel_prop_key_t                        property,
+    const void                             * p_property_data,
+    size_t                                   property_data_len);
+
 /**
  * @brief Decode and dispatch spinel command.
  *
@@ -62,6 +128,16 @@ extern "C" {
 nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd(const void * p_packet_data,
                                                   size_t       packet_data_len);
 
+/**
+ * @brief Gets transaction identifier of the spinel command being dispatched.
+ *
+ * @note The value is valid only within @ref nrf_802154_spinel_dispatch_cmd.
+ *
+ * @returns Transaction identifier received in the header byte of the command or
+ *          @ref NRF_802154_SPINEL_TID_NONE outside of the command dispatch.
+ */
+uint8_t nrf_802154_spinel_decoded_cmd_tid_get(void);
+
 /**
  * @brief Dispatches spinel command.
  *
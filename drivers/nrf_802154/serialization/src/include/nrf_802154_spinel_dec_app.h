@@ -43,6 +43,7 @@
 #define NRF_802154_SPINEL_DEC_APP_H_
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include "../spinel_base/spinel.h"
 #include "nrf_802154_serialization_error.h"
@@ -219,6 +220,18 @@ nrf_802154_ser_err_t nrf_802154_spinel_decode_prop_nrf_802154_stat_timestamps_ge
 nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd_prop_value_is(const void * cmd_data,
                                                                 size_t       cmd_data_len);
 
+/**
+ * @brief Handles SPINEL_PROP_LAST_STATUS received for a pipelined request.
+ *
+ * @note This function is implemented by the application core serialization and is called
+ *       instead of notifying the response notifier when the status carries a transaction
+ *       identifier.
+ *
+ * @param[in]  tid     Transaction identifier of the request the status responds to.
+ * @param[in]  status  Status of the request.
+ */
+extern void nrf_802154_spinel_pipeline_status_received(uint8_t tid, spinel_status_t status);
+
 #ifdef __cplusplus
 }
 #endif
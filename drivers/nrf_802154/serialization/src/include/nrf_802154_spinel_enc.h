@@ -50,8 +50,9 @@ extern "C" {
 #endif
 
 /**
- * @brief Serialize and send spinel command.
+ * @brief Serialize and send spinel command with a transaction identifier.
  *
+ * @param[in]  tid    Spinel transaction identifier placed in the header byte.
  * @param[in]  cmd    Spinel command to be serialized and sent.
  * @param[in]  p_fmt  Pointer to a format string describing data types to be serialized.
  *                    Format string should conform to spinel specification.
@@ -60,12 +61,44 @@ extern "C" {
  * @returns  number of bytes sent or negative error value on failure.
  *
  */
-#define nrf_802154_spinel_send_cmd(cmd, p_fmt, ...)         \
-    nrf_802154_spinel_send(SPINEL_DATATYPE_COMMAND_S p_fmt, \
-                           SPINEL_HEADER_FLAG,              \
-                           cmd,                             \
+#define nrf_802154_spinel_send_cmd_tid(tid, cmd, p_fmt, ...)                                 \
+    nrf_802154_spinel_send(SPINEL_DATATYPE_COMMAND_S p_fmt,                                  \
+                           (uint8_t)(SPINEL_HEADER_FLAG | ((tid) & SPINEL_HEADER_TID_MASK)), \
+                           cmd,                                                              \
                            __VA_ARGS__)
 
+/**
+ * @brief Serialize and send spinel command.
+ *
+ * @param[in]  cmd    Spinel command to be serialized and sent.
+ * @param[in]  p_fmt  Pointer to a format string describing data types to be serialized.
+ *                    Format string should conform to spinel specification.
+ * @param[in]  ...    Data to be serialized and sent according to @ref p_fmt format string.
+ *
+ * @returns  number of bytes sent or negative error value on failure.
+ *
+ */
+#define nrf_802154_spinel_send_cmd(cmd, p_fmt, ...) \
+    nrf_802154_spinel_send_cmd_tid(NRF_802154_SPINEL_TID_NONE, cmd, p_fmt, __VA_ARGS__)
+
+/**
+ * @brief Serialize and send spinel command over the urgent lane.
+ *
+ * @param[in]  cmd    Spinel command to be serialized and sent.
+ * @param[in]  p_fmt  Pointer to a format string describing data types to be serialized.
+ *                    Format string should conform to spinel specification.
+ * @param[in]  ...    Data to be serialized and sent according to @ref p_fmt format string.
+ *
+ * @returns  number of bytes sent or negative error value on failure.
+ *
+ */
+#define nrf_802154_spinel_send_cmd_urgent(cmd, p_fmt, ...)                     \
+    nrf_802154_spinel_send_urgent(SPINEL_DATATYPE_COMMAND_S p_fmt,             \
+                                  (uint8_t)(SPINEL_HEADER_FLAG |               \
+                                            NRF_802154_SPINEL_TID_NONE),       \
+                                  cmd,                                         \
+                                  __VA_ARGS__)
+
 #ifdef __cplusplus
 }
 #endif
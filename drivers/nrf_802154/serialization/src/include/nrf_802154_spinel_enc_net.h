@@ -53,15 +53,17 @@ extern "C" {
 /**
  * @brief Serialize and send spinel property SPINEL_PROP_LAST_STATUS.
  *
+ * The status is sent with the transaction identifier of the request being dispatched, so that
+ * the application core can correlate it with a pipelined request. @c SPINEL_STATUS_OK is not
+ * sent for requests marked with @ref NRF_802154_SPINEL_TID_FIRE_AND_FORGET.
+ *
  * @param[in]  status  Spinel status to be serialized and sent.
  *
- * @returns  number of bytes sent or negative error value on failure.
+ * @returns  number of bytes sent, zero if the status is not sent or negative error value
+ *           on failure.
  *
  */
-#define nrf_802154_spinel_send_prop_last_status_is(status)                            \
-    nrf_802154_spinel_send_cmd_prop_value_is(SPINEL_PROP_LAST_STATUS,                 \
-                                             SPINEL_DATATYPE_SPINEL_PROP_LAST_STATUS, \
-                                             status)
+nrf_802154_ser_err_t nrf_802154_spinel_send_prop_last_status_is(spinel_status_t status);
 
 /**
  * @brief Serialize and send spinel command SPINEL_CMD_PROP_VALUE_IS.
@@ -80,6 +82,42 @@ extern "C" {
                                prop,                                \
                                __VA_ARGS__)
 
+/**
+ * @brief Serialize and send spinel command SPINEL_CMD_PROP_VALUE_IS over the urgent lane.
+ *
+ * @param[in]  prop   Spinel property to be serialized and sent.
+ * @param[in]  p_fmt  Pointer to a format string describing data types to be serialized.
+ *                    Format string should conform to spinel specification.
+ * @param[in]  ...    Data to be serialized and sent according to @ref p_fmt format string.
+ *
+ * @returns  number of bytes sent or negative error value on failure.
+ *
+ */
+#define nrf_802154_spinel_send_cmd_prop_value_is_urgent(prop, p_fmt, ...) \
+    nrf_802154_spinel_send_cmd_urgent(SPINEL_CMD_PROP_VALUE_IS,            \
+                                      SPINEL_DATATYPE_UINT_PACKED_S p_fmt, \
+                                      prop,                                \
+                                      __VA_ARGS__)
+
+/**
+ * @brief Serialize and send spinel command SPINEL_CMD_PROP_VALUE_IS with a transaction identifier.
+ *
+ * @param[in]  tid    Spinel transaction identifier of the request this command responds to.
+ * @param[in]  prop   Spinel property to be serialized and sent.
+ * @param[in]  p_fmt  Pointer to a format string describing data types to be serialized.
+ *                    Format string should conform to spinel specification.
+ * @param[in]  ...    Data to be serialized and sent according to @ref p_fmt format string.
+ *
+ * @returns  number of bytes sent or negative error value on failure.
+ *
+ */
+#define nrf_802154_spinel_send_cmd_prop_value_is_tid(tid, prop, p_fmt, ...) \
+    nrf_802154_spinel_send_cmd_tid(tid,                                     \
+                                   SPINEL_CMD_PROP_VALUE_IS,                \
+                                   SPINEL_DATATYPE_UINT_PACKED_S p_fmt,     \
+                                   prop,                                    \
+                                   __VA_ARGS__)
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file nrf_802154_spinel_stats.h
+ * @brief Collection of the statistics of the 802.15.4 serialization link.
+ *
+ * Used when @ref NRF_802154_SER_STATS_ENABLED is set.
+ */
+
+#ifndef NRF_802154_SPINEL_STATS_H_
+#define NRF_802154_SPINEL_STATS_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "../spinel_base/spinel.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Records a spinel frame sent to the remote peer.
+ *
+ * @param[in]  p_frame    Pointer to the encoded spinel frame.
+ * @param[in]  frame_len  Size of the @p p_frame buffer.
+ */
+void nrf_802154_spinel_stats_frame_sent(const void * p_frame, size_t frame_len);
+
+/**
+ * @brief Records a spinel frame received from the remote peer.
+ *
+ * @param[in]  p_frame    Pointer to the encoded spinel frame.
+ * @param[in]  frame_len  Size of the @p p_frame buffer.
+ */
+void nrf_802154_spinel_stats_frame_received(const void * p_frame, size_t frame_len);
+
+/**
+ * @brief Starts measuring the round trip time of a request.
+ *
+ * @note Only one request can be measured at a time, like only one response can be awaited.
+ *
+ * @param[in]  property  Property of the request.
+ */
+void nrf_802154_spinel_stats_await_begin(spinel_prop_key_t property);
+
+/**
+ * @brief Finishes measuring the round trip time of a request.
+ *
+ * @param[in]  received  If the response was received before the timeout.
+ */
+void nrf_802154_spinel_stats_await_end(bool received);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_802154_SPINEL_STATS_H_ */
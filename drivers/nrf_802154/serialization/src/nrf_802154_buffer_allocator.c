@@ -39,72 +39,132 @@
 
 #include "nrf_802154_buffer_allocator.h"
 
-#include "nrf_802154_serialization_crit_sect.h"
+#include <nrfx.h>
 
 #include <assert.h>
 #include <stdbool.h>
 #include <stdint.h>
 
-static uint8_t * buffer_alloc(nrf_802154_buffer_t * p_buffer_pool, size_t buffer_pool_len)
+#define FREE_HEAD_INDEX_MASK 0x0000FFFFUL ///< Mask of the buffer index in the free list head.
+#define FREE_HEAD_TAG_INC    0x00010000UL ///< Value added to the free list head to bump its tag.
+#define FREE_LIST_END        0xFFFFU      ///< Index marking the end of the free list.
+
+/** @brief Atomic compare-and-swap operation.
+ *
+ * @param[in]    p_obj       Pointer to an object to modify.
+ * @param[inout] p_expected  Pointer to expected value. In case of failure it is updated with
+ *                           current value of the object.
+ * @param[in]    desired     Desired value of the object.
+ *
+ * @retval  true   The object was assigned new value.
+ * @retval  false  The object was not modified.
+ */
+static bool atomic_cas_u32(volatile uint32_t * p_obj, uint32_t * p_expected, uint32_t desired)
 {
-    nrf_802154_buffer_t * p_buffer  = NULL;
-    bool                  success   = false;
-    bool                  retry     = false;
-    uint32_t              crit_sect = 0UL;
+    __DMB();
 
     do
     {
-        retry = false;
+        uint32_t old_val = __LDREXW(p_obj);
 
-        // Iterate over the buffer pool to search for a free buffer
-        for (uint32_t i = 0; i < buffer_pool_len; i++)
+        if (old_val != *p_expected)
         {
-            p_buffer = &p_buffer_pool[i];
-
-            if (!p_buffer->taken)
-            {
-                // Free buffer detected. Enter critical section to take it
-                nrf_802154_serialization_crit_sect_enter(&crit_sect);
-
-                if (p_buffer->taken)
-                {
-                    // The allocation was preempted and the buffer was taken by higher priority
-                    // Reiterate over the buffer pool and search for a free buffer again
-                    retry = true;
-                }
-                else
-                {
-                    // The allocation can be performed safely
-                    p_buffer->taken = true;
-                    success         = true;
-                }
-
-                nrf_802154_serialization_crit_sect_exit(crit_sect);
-
-                break;
-            }
+            *p_expected = old_val;
+            __CLREX();
+            return false;
         }
     }
-    while (retry);
+    while (__STREXW(desired, p_obj));
+
+    __DMB();
 
-    return success ? p_buffer->data : NULL;
+    return true;
 }
 
-static void buffer_free(nrf_802154_buffer_t * p_buffer_to_free,
-                        nrf_802154_buffer_t * p_buffer_pool,
-                        size_t                buffer_pool_len)
+/** @brief Updates peak usage of the buffer allocator with a new number of used buffers.
+ *
+ * @param[inout] p_obj  Pointer to the buffer allocator.
+ * @param[in]    used   Number of buffers allocated right now.
+ */
+static void peak_used_update(nrf_802154_buffer_allocator_t * p_obj, uint32_t used)
 {
-    uint32_t crit_sect = 0UL;
-    size_t   idx       =
-        ((uintptr_t)p_buffer_to_free - (uintptr_t)p_buffer_pool) / sizeof(nrf_802154_buffer_t);
+    uint32_t peak = p_obj->peak_used;
 
-    assert(idx < buffer_pool_len);
+    do
+    {
+        if (peak >= used)
+        {
+            break;
+        }
+    }
+    while (!atomic_cas_u32(&p_obj->peak_used, &peak, used));
+}
+
+static uint8_t * buffer_alloc(nrf_802154_buffer_allocator_t * p_obj)
+{
+    nrf_802154_buffer_t * p_buffer_pool = (nrf_802154_buffer_t *)p_obj->p_memory;
+    uint32_t              head          = p_obj->free_head;
+    uint32_t              new_head;
+    uint32_t              idx;
+    uint32_t              used;
 
-    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+    do
+    {
+        idx = head & FREE_HEAD_INDEX_MASK;
+
+        if (idx == FREE_LIST_END)
+        {
+            return NULL;
+        }
+
+        // Reading next_free of a buffer taken in the meantime is harmless, because the tag
+        // in the head has changed and the swap below fails.
+        new_head = ((head + FREE_HEAD_TAG_INC) & ~FREE_HEAD_INDEX_MASK) |
+                   p_buffer_pool[idx].next_free;
+    }
+    while (!atomic_cas_u32(&p_obj->free_head, &head, new_head));
+
+    assert(!p_buffer_pool[idx].taken);
+    p_buffer_pool[idx].taken = true;
+
+    used = p_obj->used;
+
+    while (!atomic_cas_u32(&p_obj->used, &used, used + 1U))
+    {
+        // Retry with the updated value
+    }
+
+    peak_used_update(p_obj, used + 1U);
+
+    return p_buffer_pool[idx].data;
+}
+
+static void buffer_free(nrf_802154_buffer_allocator_t * p_obj,
+                        nrf_802154_buffer_t           * p_buffer_to_free)
+{
+    nrf_802154_buffer_t * p_buffer_pool = (nrf_802154_buffer_t *)p_obj->p_memory;
+    uint32_t              head          = p_obj->free_head;
+    uint32_t              used          = p_obj->used;
+    size_t                idx           =
+        ((uintptr_t)p_buffer_to_free - (uintptr_t)p_buffer_pool) / sizeof(nrf_802154_buffer_t);
+
+    assert(idx < p_obj->capacity);
+    assert(p_buffer_pool[idx].taken);
 
     p_buffer_pool[idx].taken = false;
 
-    nrf_802154_serialization_crit_sect_exit(crit_sect);
+    while (!atomic_cas_u32(&p_obj->used, &used, used - 1U))
+    {
+        // Retry with the updated value
+    }
+
+    do
+    {
+        p_buffer_pool[idx].next_free = (uint16_t)(head & FREE_HEAD_INDEX_MASK);
+    }
+    while (!atomic_cas_u32(&p_obj->free_head,
+                           &head,
+                           (head & ~FREE_HEAD_INDEX_MASK) | (uint32_t)idx));
 }
 
 void nrf_802154_buffer_allocator_init(nrf_802154_buffer_allocator_t * p_obj,
@@ -114,25 +174,36 @@ void nrf_802154_buffer_allocator_init(nrf_802154_buffer_allocator_t * p_obj,
     size_t capacity = memsize / sizeof(nrf_802154_buffer_t);
 
     assert((capacity == 0U) || ((capacity != 0U) && (p_memory != NULL)));
+    assert(capacity <= NRF_802154_BUFFER_ALLOCATOR_MAX_CAPACITY);
 
-    p_obj->p_memory = p_memory;
-    p_obj->capacity = capacity;
+    p_obj->p_memory  = p_memory;
+    p_obj->capacity  = capacity;
+    p_obj->used      = 0U;
+    p_obj->peak_used = 0U;
 
     nrf_802154_buffer_t * p_buffer = (nrf_802154_buffer_t *)p_obj->p_memory;
 
     for (size_t i = 0; i < p_obj->capacity; i++)
     {
-        p_buffer[i].taken = false;
+        p_buffer[i].taken     = false;
+        p_buffer[i].next_free = ((i + 1U) < capacity) ? (uint16_t)(i + 1U) : FREE_LIST_END;
     }
+
+    p_obj->free_head = (capacity != 0U) ? 0U : FREE_LIST_END;
+}
+
+void * nrf_802154_buffer_allocator_alloc(nrf_802154_buffer_allocator_t * p_obj)
+{
+    return buffer_alloc(p_obj);
 }
 
-void * nrf_802154_buffer_allocator_alloc(const nrf_802154_buffer_allocator_t * p_obj)
+void nrf_802154_buffer_allocator_free(nrf_802154_buffer_allocator_t * p_obj,
+                                      void                          * p_buffer)
 {
-    return buffer_alloc((nrf_802154_buffer_t *)p_obj->p_memory, p_obj->capacity);
+    buffer_free(p_obj, (nrf_802154_buffer_t *)p_buffer);
 }
 
-void nrf_802154_buffer_allocator_free(const nrf_802154_buffer_allocator_t * p_obj,
-                                      void                                * p_buffer)
+void nrf_802154_buffer_allocator_peak_usage_reset(nrf_802154_buffer_allocator_t * p_obj)
 {
-    buffer_free(p_buffer, (nrf_802154_buffer_t *)p_obj->p_memory, p_obj->capacity);
+    p_obj->peak_used = p_obj->used;
 }
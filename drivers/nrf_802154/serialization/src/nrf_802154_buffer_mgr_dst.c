@@ -34,6 +34,8 @@
 
 /**@file nrf_802154_buffer_mgr_dst.c
  * @brief Buffer management for destination peer of a nRF 802.15.4 serialization.
+ *
+ * @note Implementation valid for 32-bit architectures only
  */
 
 #include "nrf_802154_buffer_mgr_dst.h"
@@ -47,11 +49,12 @@ void nrf_802154_buffer_mgr_dst_init(
     void                        * p_allocator_memory,
     size_t                        buffers_count)
 {
-    nrf_802154_kvmap_init(&p_obj->map,
-                          p_map_memory,
-                          NRF_802154_BUFFER_MGR_DST_MAP_MEMSIZE(buffers_count),
-                          sizeof(void *),
-                          sizeof(uint32_t));
+    /* Local pointers are used as keys of a map with 32-bit keys */
+    assert(sizeof(void *) == sizeof(uint32_t) );
+
+    nrf_802154_kvmap_u32_init(&p_obj->map,
+                              p_map_memory,
+                              NRF_802154_BUFFER_MGR_DST_MAP_MEMSIZE(buffers_count));
 
     nrf_802154_buffer_allocator_init(&p_obj->allocator,
                                      p_allocator_memory,
@@ -72,23 +75,41 @@ bool nrf_802154_buffer_mgr_dst_add(
     if (*pp_local_pointer != NULL)
     {
         memcpy(*pp_local_pointer, p_data, data_size);
-        result = nrf_802154_kvmap_add(&p_obj->map, pp_local_pointer, &buffer_handle);
+        result = nrf_802154_kvmap_u32_add(&p_obj->map,
+                                          (uint32_t)(uintptr_t)*pp_local_pointer,
+                                          buffer_handle);
 
-        /* Allocator is a pool allocator of fixed size.
-         * If allocator managed to allocate, there must be place in the map.
+        /* Shared buffers take entries of the map without allocating,
+         * so the map can be full even if allocator managed to allocate.
          */
-        assert(result);
+        if (!result)
+        {
+            nrf_802154_buffer_allocator_free(&p_obj->allocator, *pp_local_pointer);
+        }
     }
 
     return result;
 }
 
+bool nrf_802154_buffer_mgr_dst_add_shared(
+    nrf_802154_buffer_mgr_dst_t * p_obj,
+    uint32_t                      buffer_handle,
+    void                        * p_shared)
+{
+    /* Shared buffers must never be confused with buffers of the allocator */
+    assert(!nrf_802154_buffer_allocator_owns(&p_obj->allocator, p_shared));
+
+    return nrf_802154_kvmap_u32_add(&p_obj->map, (uint32_t)(uintptr_t)p_shared, buffer_handle);
+}
+
 bool nrf_802154_buffer_mgr_dst_search_by_local_pointer(
     nrf_802154_buffer_mgr_dst_t * p_obj,
     void                        * p_local_pointer,
     uint32_t                    * p_buffer_handle)
 {
-    return nrf_802154_kvmap_search(&p_obj->map, &p_local_pointer, p_buffer_handle);
+    return nrf_802154_kvmap_u32_search(&p_obj->map,
+                                       (uint32_t)(uintptr_t)p_local_pointer,
+                                       p_buffer_handle);
 }
 
 bool nrf_802154_buffer_mgr_dst_remove_by_local_pointer(
@@ -97,8 +118,8 @@ bool nrf_802154_buffer_mgr_dst_remove_by_local_pointer(
 {
     bool result;
 
-    result = nrf_802154_kvmap_remove(&p_obj->map, &p_local_pointer);
-    if (result)
+    result = nrf_802154_kvmap_u32_remove(&p_obj->map, (uint32_t)(uintptr_t)p_local_pointer);
+    if (result && nrf_802154_buffer_allocator_owns(&p_obj->allocator, p_local_pointer))
     {
         nrf_802154_buffer_allocator_free(&p_obj->allocator, p_local_pointer);
     }
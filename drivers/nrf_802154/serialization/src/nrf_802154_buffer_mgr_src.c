@@ -52,11 +52,9 @@ void nrf_802154_buffer_mgr_src_init(
      * When this is true only presence of buffer handle can be checked */
     assert(sizeof(void *) == sizeof(uint32_t) );
 
-    nrf_802154_kvmap_init(&p_obj->map,
-                          p_map_memory,
-                          NRF_802154_BUFFER_MGR_SRC_MAP_MEMSIZE(buffers_count),
-                          sizeof(uint32_t),
-                          0U);
+    nrf_802154_kvmap_u32_init(&p_obj->map,
+                              p_map_memory,
+                              NRF_802154_BUFFER_MGR_SRC_MAP_MEMSIZE(buffers_count));
 }
 
 bool nrf_802154_buffer_mgr_src_add(
@@ -67,7 +65,7 @@ bool nrf_802154_buffer_mgr_src_add(
     bool     result;
     uint32_t buffer_handle = (uintptr_t)p_buffer;
 
-    result = nrf_802154_kvmap_add(&p_obj->map, &buffer_handle, NULL);
+    result = nrf_802154_kvmap_u32_add(&p_obj->map, buffer_handle, 0U);
     if (result)
     {
         *p_buffer_handle = buffer_handle;
@@ -83,7 +81,7 @@ bool nrf_802154_buffer_mgr_src_search_by_buffer_handle(
 {
     bool result = false;
 
-    if (nrf_802154_kvmap_search(&p_obj->map, &buffer_handle, NULL))
+    if (nrf_802154_kvmap_u32_search(&p_obj->map, buffer_handle, NULL))
     {
         *pp_buffer = (void *)buffer_handle;
         result     = true;
@@ -95,5 +93,5 @@ bool nrf_802154_buffer_mgr_src_remove_by_buffer_handle(
     nrf_802154_buffer_mgr_src_t * p_obj,
     uint32_t                      buffer_handle)
 {
-    return nrf_802154_kvmap_remove(&p_obj->map, &buffer_handle);
+    return nrf_802154_kvmap_u32_remove(&p_obj->map, buffer_handle);
 }
@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2020 - 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/**@file nrf_802154_kvmap_u32.c
+ * @brief Key-value map with 32-bit keys and values using an open-addressing hash table.
+ */
+
+#include "nrf_802154_kvmap_u32.h"
+
+#include "nrf_802154_serialization_crit_sect.h"
+
+#include <assert.h>
+#include <stdint.h>
+
+#define HASH_MULTIPLIER 0x9E3779B1UL ///< Multiplier of the Fibonacci hash (2^32 / golden ratio).
+
+/** @brief Calculates the slot a key should be stored in when there are no collisions. */
+static size_t home_slot_get(const nrf_802154_kvmap_u32_t * p_kvmap, uint32_t key)
+{
+    uint32_t hash = key * HASH_MULTIPLIER;
+
+    return (size_t)(((uint64_t)hash * p_kvmap->num_slots) >> 32);
+}
+
+/** @brief Returns the slot following the given one in the probe sequence. */
+static size_t slot_next(const nrf_802154_kvmap_u32_t * p_kvmap, size_t slot)
+{
+    slot++;
+
+    return (slot == p_kvmap->num_slots) ? 0U : slot;
+}
+
+/**
+ * @brief Searches for a key using linear probing.
+ *
+ * @param[in]  p_kvmap  Pointer to a key-value map to search.
+ * @param[in]  key      Key to search.
+ * @param[out] p_slot   Slot holding the key if found, otherwise the first empty slot
+ *                      in the probe sequence of the key.
+ *
+ * @retval true   The key has been found.
+ * @retval false  The key has not been found.
+ */
+static bool slot_by_key_search(const nrf_802154_kvmap_u32_t * p_kvmap,
+                               uint32_t                       key,
+                               size_t                       * p_slot)
+{
+    size_t slot = home_slot_get(p_kvmap, key);
+
+    /* The table is never full, so the loop always reaches an empty slot */
+    while (p_kvmap->p_slots[slot].key != NRF_802154_KVMAP_U32_KEY_INVALID)
+    {
+        if (p_kvmap->p_slots[slot].key == key)
+        {
+            *p_slot = slot;
+            return true;
+        }
+
+        slot = slot_next(p_kvmap, slot);
+    }
+
+    *p_slot = slot;
+    return false;
+}
+
+/**
+ * @brief Empties a slot and moves back the following items of the cluster.
+ *
+ * Backward shift deletion keeps every probe sequence unbroken without tombstones.
+ *
+ * @param[in,out] p_kvmap  Pointer to a key-value map to modify.
+ * @param[in]     hole     Slot to empty.
+ */
+static void slot_free(nrf_802154_kvmap_u32_t * p_kvmap, size_t hole)
+{
+    size_t slot = slot_next(p_kvmap, hole);
+
+    while (p_kvmap->p_slots[slot].key != NRF_802154_KVMAP_U32_KEY_INVALID)
+    {
+        size_t home = home_slot_get(p_kvmap, p_kvmap->p_slots[slot].key);
+
+        /* Distances along the probe sequence from the home slot of the item */
+        size_t dist_to_slot =
+            (slot + p_kvmap->num_slots - home) % p_kvmap->num_slots;
+        size_t dist_to_hole =
+            (hole + p_kvmap->num_slots - home) % p_kvmap->num_slots;
+
+        if (dist_to_hole < dist_to_slot)
+        {
+            /* The item can be found through the hole, so it is moved there */
+            p_kvmap->p_slots[hole] = p_kvmap->p_slots[slot];
+            hole                   = slot;
+        }
+
+        slot = slot_next(p_kvmap, slot);
+    }
+
+    p_kvmap->p_slots[hole].key = NRF_802154_KVMAP_U32_KEY_INVALID;
+}
+
+void nrf_802154_kvmap_u32_init(nrf_802154_kvmap_u32_t * p_kvmap,
+                               void                   * p_memory,
+                               size_t                   memsize)
+{
+    size_t num_slots = memsize / sizeof(nrf_802154_kvmap_u32_slot_t);
+
+    assert((num_slots == 0U) || (p_memory != NULL));
+
+    p_kvmap->p_slots   = (nrf_802154_kvmap_u32_slot_t *)p_memory;
+    p_kvmap->num_slots = num_slots;
+    p_kvmap->capacity  = num_slots / 2U;
+    p_kvmap->count     = 0U;
+
+    for (size_t i = 0U; i < num_slots; i++)
+    {
+        p_kvmap->p_slots[i].key = NRF_802154_KVMAP_U32_KEY_INVALID;
+    }
+}
+
+bool nrf_802154_kvmap_u32_add(nrf_802154_kvmap_u32_t * p_kvmap, uint32_t key, uint32_t value)
+{
+    uint32_t crit_sect = 0UL;
+    size_t   slot;
+    bool     success = true;
+
+    assert(key != NRF_802154_KVMAP_U32_KEY_INVALID);
+
+    if (p_kvmap->num_slots == 0U)
+    {
+        return false;
+    }
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    if (slot_by_key_search(p_kvmap, key, &slot))
+    {
+        /* Item already present */
+        p_kvmap->p_slots[slot].value = value;
+    }
+    else if (p_kvmap->count >= p_kvmap->capacity)
+    {
+        /* Item not found, but the map is at full capacity. Don't add the item */
+        success = false;
+    }
+    else
+    {
+        /* Not found, store in the empty slot that ended the search */
+        p_kvmap->p_slots[slot].key   = key;
+        p_kvmap->p_slots[slot].value = value;
+
+        p_kvmap->count++;
+    }
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+    return success;
+}
+
+bool nrf_802154_kvmap_u32_remove(nrf_802154_kvmap_u32_t * p_kvmap, uint32_t key)
+{
+    uint32_t crit_sect = 0UL;
+    size_t   slot;
+    bool     success = false;
+
+    if ((p_kvmap->num_slots == 0U) || (key == NRF_802154_KVMAP_U32_KEY_INVALID))
+    {
+        return false;
+    }
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    if (slot_by_key_search(p_kvmap, key, &slot))
+    {
+        slot_free(p_kvmap, slot);
+        p_kvmap->count--;
+        success = true;
+    }
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+    return success;
+}
+
+bool nrf_802154_kvmap_u32_search(const nrf_802154_kvmap_u32_t * p_kvmap,
+                                 uint32_t                       key,
+                                 uint32_t                     * p_value)
+{
+    uint32_t crit_sect = 0UL;
+    size_t   slot;
+    bool     success = false;
+
+    if ((p_kvmap->num_slots == 0U) || (key == NRF_802154_KVMAP_U32_KEY_INVALID))
+    {
+        return false;
+    }
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    if (slot_by_key_search(p_kvmap, key, &slot))
+    {
+        /* Copy value associated with the key if requested */
+        if (p_value != NULL)
+        {
+            *p_value = p_kvmap->p_slots[slot].value;
+        }
+
+        success = true;
+    }
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+    return success;
+}
@@ -34,12 +34,18 @@
 
 #include "nrf_802154_spinel.h"
 
+#include <assert.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include <stddef.h>
+#include <string.h>
+
+#include <nrfx.h>
 
 #include "../spinel_base/spinel.h"
 #include "nrf_802154_spinel_dec.h"
 #include "nrf_802154_spinel_backend.h"
+#include "nrf_802154_serialization_crit_sect.h"
 #include "nrf_802154_spinel_log.h"
 #include "nrf_802154_spinel_response_notifier.h"
 #include "nrf_802154_serialization_error.h"
@@ -48,6 +54,10 @@
 #include "nrf_802154_buffer_mgr_src.h"
 #include "nrf_802154_serialization_config.h"
 
+#if NRF_802154_SER_STATS_ENABLED
+#include "nrf_802154_spinel_stats.h"
+#endif
+
 #if CONFIG_NRF_802154_SER_HOST
 NRF_802154_BUFFER_MGR_SRC_INST_DECL_STATIC(m_src_mgr, NRF_802154_TX_BUFFERS);
 NRF_802154_BUFFER_MGR_DST_INST_DECL_STATIC(m_dst_mgr, NRF_802154_RX_BUFFERS);
@@ -72,12 +82,67 @@ nrf_802154_buffer_mgr_src_t * nrf_802154_spinel_src_buffer_mgr_get(void)
     return &m_src_mgr;
 }
 
+#if NRF_802154_SER_PRIORITY_LANES_ENABLED
+
+/** @brief Frame queued on a lane until it can be decoded. */
+typedef struct
+{
+    size_t  data_len;                                  ///< Length of the frame.
+    uint8_t data[NRF_802154_SPINEL_FRAME_BUFFER_SIZE]; ///< Frame.
+} lane_rx_slot_t;
+
+/** @brief Queue of frames received over a lane. */
+typedef struct
+{
+    lane_rx_slot_t * p_slots;    ///< Slots of the queue.
+    uint8_t          slot_count; ///< Number of slots of the queue.
+    uint8_t          head;       ///< Index of the oldest queued frame.
+    uint8_t          count;      ///< Number of queued frames.
+} lane_rx_queue_t;
+
+static lane_rx_slot_t m_lane_urgent_rx_slots[NRF_802154_SER_LANE_URGENT_RX_SLOTS];
+static lane_rx_slot_t m_lane_bulk_rx_slots[NRF_802154_SER_LANE_BULK_RX_SLOTS];
+
+/** @brief Queues of received frames, indexed by @ref nrf_802154_spinel_lane_t. */
+static lane_rx_queue_t m_lane_rx_queues[NRF_802154_SPINEL_LANE_COUNT] =
+{
+    [NRF_802154_SPINEL_LANE_BULK] =
+    {
+        .p_slots    = m_lane_bulk_rx_slots,
+        .slot_count = NRF_802154_SER_LANE_BULK_RX_SLOTS,
+    },
+    [NRF_802154_SPINEL_LANE_URGENT] =
+    {
+        .p_slots    = m_lane_urgent_rx_slots,
+        .slot_count = NRF_802154_SER_LANE_URGENT_RX_SLOTS,
+    },
+};
+
+/** @brief Indicates that a frame is being decoded, so that received frames must be queued. */
+static bool m_lane_rx_decoding;
+
+static void lane_rx_queues_init(void)
+{
+    for (uint32_t lane = 0U; lane < NRF_802154_SPINEL_LANE_COUNT; lane++)
+    {
+        m_lane_rx_queues[lane].head  = 0U;
+        m_lane_rx_queues[lane].count = 0U;
+    }
+
+    m_lane_rx_decoding = false;
+}
+
+#endif // NRF_802154_SER_PRIORITY_LANES_ENABLED
+
 void nrf_802154_serialization_init(void)
 {
     SERIALIZATION_ERROR_INIT(error);
 
     buffer_mgr_init();
     nrf_802154_spinel_response_notifier_init();
+#if NRF_802154_SER_PRIORITY_LANES_ENABLED
+    lane_rx_queues_init();
+#endif
 
     nrf_802154_ser_err_t ret = nrf_802154_backend_init();
 
@@ -89,19 +154,187 @@ bail:
     return;
 }
 
-nrf_802154_ser_err_t nrf_802154_spinel_send(const char * p_fmt, ...)
+/**
+ * @brief Sends an encoded frame over a lane of the backend.
+ *
+ * @param[in]  lane      Lane to send the frame over.
+ * @param[in]  p_data    Pointer to the encoded frame.
+ * @param[in]  data_len  Length of the encoded frame.
+ *
+ * @returns  number of bytes sent or negative error value on failure.
+ */
+static inline nrf_802154_ser_err_t packet_send(nrf_802154_spinel_lane_t lane,
+                                               const void             * p_data,
+                                               size_t                   data_len)
+{
+#if NRF_802154_SER_PRIORITY_LANES_ENABLED
+    return nrf_802154_spinel_encoded_packet_lane_send(lane, p_data, data_len);
+#else
+    (void)lane;
+    return nrf_802154_spinel_encoded_packet_send(p_data, data_len);
+#endif
+}
+
+/**
+ * @brief Sends a frame encoded into a buffer lent by the backend over a lane of the backend.
+ *
+ * @param[in]  lane      Lane to send the frame over.
+ * @param[in]  p_buffer  Pointer to the buffer reserved from the backend.
+ * @param[in]  data_len  Length of the encoded frame.
+ *
+ * @returns  zero on success or negative error value on failure.
+ */
+static inline nrf_802154_ser_err_t packet_buffer_commit(nrf_802154_spinel_lane_t lane,
+                                                        void                   * p_buffer,
+                                                        size_t                   data_len)
+{
+#if NRF_802154_SER_PRIORITY_LANES_ENABLED
+    return nrf_802154_spinel_encoded_packet_buffer_lane_commit(lane, p_buffer, data_len);
+#else
+    (void)lane;
+    return nrf_802154_spinel_encoded_packet_buffer_commit(p_buffer, data_len);
+#endif
+}
+
+/**
+ * @brief Serializes data into a temporary buffer and sends it with a copy into the backend.
+ *
+ * Kept out of line so that the temporary buffer occupies stack only when the backend
+ * does not lend its transmit buffers.
+ *
+ * @param[in]  lane   Lane to send the frame over.
+ * @param[in]  p_fmt  Pointer to a format string describing data types to be serialized.
+ * @param[in]  args   Data to be serialized.
+ *
+ * @returns  zero on success or negative error value on failure.
+ */
+static __attribute__((noinline)) nrf_802154_ser_err_t spinel_vsend_copy(
+    nrf_802154_spinel_lane_t lane,
+    const char             * p_fmt,
+    va_list                  args)
 {
     uint8_t        command_buff[NRF_802154_SPINEL_FRAME_BUFFER_SIZE];
     spinel_ssize_t siz;
 
-    va_list args;
+    siz = spinel_datatype_vpack(command_buff, sizeof(command_buff), p_fmt, args);
+
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_ENCODING_FAILURE;
+    }
+
+    NRF_802154_SPINEL_LOG_RAW("Sending spinel frame\n");
+    NRF_802154_SPINEL_LOG_BUFF_NAMED(command_buff, siz, "data");
+
+#if NRF_802154_SER_STATS_ENABLED
+    nrf_802154_spinel_stats_frame_sent(command_buff, (size_t)siz);
+#endif
+
+    return packet_send(lane, command_buff, (size_t)siz);
+}
+
+/**
+ * @brief Serializes data directly into a transmit buffer lent by the backend and sends it.
+ *
+ * @param[in]  lane         Lane to send the frame over.
+ * @param[in]  p_buffer     Pointer to the buffer reserved from the backend.
+ * @param[in]  buffer_size  Size of the buffer pointed by @p p_buffer.
+ * @param[in]  p_fmt        Pointer to a format string describing data types to be serialized.
+ * @param[in]  args         Data to be serialized.
+ *
+ * @returns  zero on success or negative error value on failure.
+ */
+static nrf_802154_ser_err_t spinel_vsend_zero_copy(nrf_802154_spinel_lane_t lane,
+                                                   void                   * p_buffer,
+                                                   size_t                   buffer_size,
+                                                   const char             * p_fmt,
+                                                   va_list                  args)
+{
+    spinel_ssize_t siz;
+
+    siz = spinel_datatype_vpack(p_buffer, buffer_size, p_fmt, args);
+
+    if (siz < 0)
+    {
+        nrf_802154_spinel_encoded_packet_buffer_release(p_buffer);
+        return NRF_802154_SERIALIZATION_ERROR_ENCODING_FAILURE;
+    }
+
+    NRF_802154_SPINEL_LOG_RAW("Sending spinel frame\n");
+    NRF_802154_SPINEL_LOG_BUFF_NAMED(p_buffer, siz, "data");
+
+#if NRF_802154_SER_STATS_ENABLED
+    nrf_802154_spinel_stats_frame_sent(p_buffer, (size_t)siz);
+#endif
+
+    return packet_buffer_commit(lane, p_buffer, (size_t)siz);
+}
+
+/**
+ * @brief Serializes data and sends it over a lane of the backend.
+ *
+ * @param[in]  lane   Lane to send the frame over.
+ * @param[in]  p_fmt  Pointer to a format string describing data types to be serialized.
+ * @param[in]  args   Data to be serialized.
+ *
+ * @returns  zero on success or negative error value on failure.
+ */
+static nrf_802154_ser_err_t spinel_vsend(nrf_802154_spinel_lane_t lane,
+                                         const char             * p_fmt,
+                                         va_list                  args)
+{
+    size_t buffer_size = 0U;
+    void * p_buffer    = nrf_802154_spinel_encoded_packet_buffer_reserve(&buffer_size);
+
+    if (p_buffer != NULL)
+    {
+        return spinel_vsend_zero_copy(lane, p_buffer, buffer_size, p_fmt, args);
+    }
+
+    return spinel_vsend_copy(lane, p_fmt, args);
+}
+
+nrf_802154_ser_err_t nrf_802154_spinel_send(const char * p_fmt, ...)
+{
+    nrf_802154_ser_err_t ret;
+    va_list              args;
 
     va_start(args, p_fmt);
+    ret = spinel_vsend(NRF_802154_SPINEL_LANE_BULK, p_fmt, args);
+    va_end(args);
 
-    siz = spinel_datatype_vpack(command_buff, sizeof(command_buff), p_fmt, args);
+    return ret;
+}
 
+nrf_802154_ser_err_t nrf_802154_spinel_send_urgent(const char * p_fmt, ...)
+{
+    nrf_802154_ser_err_t ret;
+    va_list              args;
+
+    va_start(args, p_fmt);
+    ret = spinel_vsend(NRF_802154_SPINEL_LANE_URGENT, p_fmt, args);
     va_end(args);
 
+    return ret;
+}
+
+/**
+ * @brief Encodes a frame with a precompiled encoder into a temporary buffer and sends it.
+ *
+ * @param[in]  encoder  Encoder producing the complete spinel frame.
+ * @param[in]  p_args   Pointer to arguments passed to @p encoder.
+ *
+ * @returns  zero on success or negative error value on failure.
+ */
+static __attribute__((noinline)) nrf_802154_ser_err_t spinel_send_encoded_copy(
+    nrf_802154_spinel_encoder_t encoder,
+    const void                * p_args)
+{
+    uint8_t        command_buff[NRF_802154_SPINEL_FRAME_BUFFER_SIZE];
+    spinel_ssize_t siz;
+
+    siz = encoder(command_buff, sizeof(command_buff), p_args);
+
     if (siz < 0)
     {
         return NRF_802154_SERIALIZATION_ERROR_ENCODING_FAILURE;
@@ -110,14 +343,105 @@ nrf_802154_ser_err_t nrf_802154_spinel_send(const char * p_fmt, ...)
     NRF_802154_SPINEL_LOG_RAW("Sending spinel frame\n");
     NRF_802154_SPINEL_LOG_BUFF_NAMED(command_buff, siz, "data");
 
-    return nrf_802154_spinel_encoded_packet_send(command_buff, (size_t)siz);
+#if NRF_802154_SER_STATS_ENABLED
+    nrf_802154_spinel_stats_frame_sent(command_buff, (size_t)siz);
+#endif
+
+    return packet_send(NRF_802154_SPINEL_LANE_BULK, command_buff, (size_t)siz);
 }
 
-void nrf_802154_spinel_encoded_packet_received(const void * p_data, size_t data_len)
+nrf_802154_ser_err_t nrf_802154_spinel_send_encoded(nrf_802154_spinel_encoder_t encoder,
+                                                    const void                * p_args)
+{
+    spinel_ssize_t siz;
+    size_t         buffer_size = 0U;
+    void         * p_buffer    = nrf_802154_spinel_encoded_packet_buffer_reserve(&buffer_size);
+
+    if (p_buffer == NULL)
+    {
+        return spinel_send_encoded_copy(encoder, p_args);
+    }
+
+    siz = encoder(p_buffer, buffer_size, p_args);
+
+    if (siz < 0)
+    {
+        nrf_802154_spinel_encoded_packet_buffer_release(p_buffer);
+        return NRF_802154_SERIALIZATION_ERROR_ENCODING_FAILURE;
+    }
+
+    NRF_802154_SPINEL_LOG_RAW("Sending spinel frame\n");
+    NRF_802154_SPINEL_LOG_BUFF_NAMED(p_buffer, siz, "data");
+
+#if NRF_802154_SER_STATS_ENABLED
+    nrf_802154_spinel_stats_frame_sent(p_buffer, (size_t)siz);
+#endif
+
+    return packet_buffer_commit(NRF_802154_SPINEL_LANE_BULK, p_buffer, (size_t)siz);
+}
+
+__WEAK void * nrf_802154_spinel_encoded_packet_buffer_reserve(size_t * p_buffer_size)
+{
+    /* By default the backend does not lend its buffers, frames are copied into it instead. */
+    *p_buffer_size = 0U;
+
+    return NULL;
+}
+
+__WEAK nrf_802154_ser_err_t nrf_802154_spinel_encoded_packet_buffer_commit(void * p_buffer,
+                                                                           size_t data_len)
+{
+    /* Never called, because the default reserve implementation never lends a buffer. */
+    (void)p_buffer;
+    (void)data_len;
+    assert(false);
+
+    return NRF_802154_SERIALIZATION_ERROR_BACKEND_FAILURE;
+}
+
+__WEAK void nrf_802154_spinel_encoded_packet_buffer_release(void * p_buffer)
+{
+    /* Never called, because the default reserve implementation never lends a buffer. */
+    (void)p_buffer;
+    assert(false);
+}
+
+__WEAK nrf_802154_ser_err_t nrf_802154_spinel_encoded_packet_lane_send(
+    nrf_802154_spinel_lane_t lane,
+    const void             * p_data,
+    size_t                   data_len)
+{
+    /* By default the backend has a single ordered stream shared by all lanes. */
+    (void)lane;
+
+    return nrf_802154_spinel_encoded_packet_send(p_data, data_len);
+}
+
+__WEAK nrf_802154_ser_err_t nrf_802154_spinel_encoded_packet_buffer_lane_commit(
+    nrf_802154_spinel_lane_t lane,
+    void                   * p_buffer,
+    size_t                   data_len)
+{
+    (void)lane;
+
+    return nrf_802154_spinel_encoded_packet_buffer_commit(p_buffer, data_len);
+}
+
+/**
+ * @brief Decodes a received frame.
+ *
+ * @param[in]  p_data    Pointer to a buffer that contains received frame.
+ * @param[in]  data_len  Size of the @p p_data buffer.
+ */
+static void packet_decode(const void * p_data, size_t data_len)
 {
     NRF_802154_SPINEL_LOG_RAW("Received spinel frame\n");
     NRF_802154_SPINEL_LOG_BUFF_NAMED(p_data, data_len, "data");
 
+#if NRF_802154_SER_STATS_ENABLED
+    nrf_802154_spinel_stats_frame_received(p_data, data_len);
+#endif
+
     SERIALIZATION_ERROR_INIT(error);
 
     nrf_802154_ser_err_t err = nrf_802154_spinel_decode_cmd(p_data, data_len);
@@ -129,3 +453,146 @@ bail:
 
     return;
 }
+
+#if NRF_802154_SER_PRIORITY_LANES_ENABLED
+
+/**
+ * @brief Takes the oldest queued frame, the urgent lane first, or marks the decoding finished.
+ *
+ * @param[out] p_lane  Lane of the taken frame.
+ *
+ * @returns  Pointer to the slot of the taken frame or NULL if no frame is queued.
+ */
+static lane_rx_slot_t * lane_rx_next_get(nrf_802154_spinel_lane_t * p_lane)
+{
+    static const nrf_802154_spinel_lane_t lanes_by_priority[] =
+    {
+        NRF_802154_SPINEL_LANE_URGENT,
+        NRF_802154_SPINEL_LANE_BULK,
+    };
+
+    lane_rx_slot_t * p_slot = NULL;
+    uint32_t         critical_section;
+
+    nrf_802154_serialization_crit_sect_enter(&critical_section);
+
+    for (size_t i = 0U; i < NRFX_ARRAY_SIZE(lanes_by_priority); i++)
+    {
+        lane_rx_queue_t * p_queue = &m_lane_rx_queues[lanes_by_priority[i]];
+
+        if (p_queue->count != 0U)
+        {
+            p_slot  = &p_queue->p_slots[p_queue->head];
+            *p_lane = lanes_by_priority[i];
+            break;
+        }
+    }
+
+    if (p_slot == NULL)
+    {
+        m_lane_rx_decoding = false;
+    }
+
+    nrf_802154_serialization_crit_sect_exit(critical_section);
+
+    return p_slot;
+}
+
+/** @brief Frees the oldest queued frame of a lane after it was decoded. */
+static void lane_rx_slot_free(nrf_802154_spinel_lane_t lane)
+{
+    lane_rx_queue_t * p_queue = &m_lane_rx_queues[lane];
+    uint32_t          critical_section;
+
+    nrf_802154_serialization_crit_sect_enter(&critical_section);
+    p_queue->head = (uint8_t)((p_queue->head + 1U) % p_queue->slot_count);
+    p_queue->count--;
+    nrf_802154_serialization_crit_sect_exit(critical_section);
+}
+
+void nrf_802154_spinel_encoded_packet_lane_received(nrf_802154_spinel_lane_t lane,
+                                                    const void             * p_data,
+                                                    size_t                   data_len)
+{
+    SERIALIZATION_ERROR_INIT(error);
+
+    lane_rx_queue_t * p_queue;
+    lane_rx_slot_t  * p_slot;
+    uint32_t          critical_section;
+    bool              decode_now = false;
+
+    SERIALIZATION_ERROR_IF((lane >= NRF_802154_SPINEL_LANE_COUNT) ||
+                           (data_len > NRF_802154_SPINEL_FRAME_BUFFER_SIZE),
+                           NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE,
+                           error,
+                           bail);
+
+    p_queue = &m_lane_rx_queues[lane];
+
+    nrf_802154_serialization_crit_sect_enter(&critical_section);
+
+    if (!m_lane_rx_decoding)
+    {
+        // Nothing is queued, so the frame is decoded in place without a copy
+        m_lane_rx_decoding = true;
+        decode_now         = true;
+    }
+    else if (p_queue->count < p_queue->slot_count)
+    {
+        p_slot = &p_queue->p_slots[(p_queue->head + p_queue->count) % p_queue->slot_count];
+
+        // The slot is not visible to the decoding context until the count is incremented
+        memcpy(p_slot->data, p_data, data_len);
+        p_slot->data_len = data_len;
+        p_queue->count++;
+    }
+    else
+    {
+        nrf_802154_serialization_crit_sect_exit(critical_section);
+        SERIALIZATION_ERROR(NRF_802154_SERIALIZATION_ERROR_NO_MEMORY, error, bail);
+    }
+
+    nrf_802154_serialization_crit_sect_exit(critical_section);
+
+    if (decode_now)
+    {
+        nrf_802154_spinel_lane_t next_lane;
+
+        packet_decode(p_data, data_len);
+
+        // Drain the frames received in the meantime, the urgent ones first
+        while ((p_slot = lane_rx_next_get(&next_lane)) != NULL)
+        {
+            packet_decode(p_slot->data, p_slot->data_len);
+            lane_rx_slot_free(next_lane);
+        }
+    }
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return;
+}
+
+void nrf_802154_spinel_encoded_packet_received(const void * p_data, size_t data_len)
+{
+    nrf_802154_spinel_encoded_packet_lane_received(NRF_802154_SPINEL_LANE_BULK, p_data, data_len);
+}
+
+#else // NRF_802154_SER_PRIORITY_LANES_ENABLED
+
+void nrf_802154_spinel_encoded_packet_lane_received(nrf_802154_spinel_lane_t lane,
+                                                    const void             * p_data,
+                                                    size_t                   data_len)
+{
+    (void)lane;
+
+    packet_decode(p_data, data_len);
+}
+
+void nrf_802154_spinel_encoded_packet_received(const void * p_data, size_t data_len)
+{
+    packet_decode(p_data, data_len);
+}
+
+#endif // NRF_802154_SER_PRIORITY_LANES_ENABLED
@@ -50,6 +50,7 @@
 #include "../spinel_base/spinel.h"
 #include "nrf_802154_serialization.h"
 #include "nrf_802154_spinel.h"
+#include "nrf_802154_spinel_codec.h"
 #include "nrf_802154_spinel_datatypes.h"
 #include "nrf_802154_spinel_enc_app.h"
 #include "nrf_802154_spinel_dec_app.h"
@@ -65,6 +66,55 @@
 #include "nrf_802154_types.h"
 #include "nrf_802154_nrfx_addons.h"
 
+#if NRF_802154_SER_PIPELINE_ENABLED || NRF_802154_SER_TIME_SYNC_ENABLED
+#include "nrf_802154_serialization_crit_sect.h"
+#endif
+
+#if NRF_802154_SER_TIME_SYNC_ENABLED
+#include "nrf_802154_serialization_local_time.h"
+#endif
+
+#if NRF_802154_SER_STATS_ENABLED
+#include "nrf_802154_spinel_stats.h"
+#endif
+
+/**
+ * @brief Lock the response notifier before sending a request awaiting a response.
+ *
+ * @param[in]  property  Awaited property.
+ *
+ */
+static void response_notifier_lock(spinel_prop_key_t property)
+{
+#if NRF_802154_SER_STATS_ENABLED
+    nrf_802154_spinel_stats_await_begin(property);
+#endif
+
+    nrf_802154_spinel_response_notifier_lock_before_request(property);
+}
+
+/**
+ * @brief Wait with timeout for the property locked with @ref response_notifier_lock.
+ *
+ * @param[in]  timeout   Timeout in us.
+ *
+ * @returns  pointer to @ref nrf_802154_spinel_notify_buff_t with notified property data
+ *           or NULL in case of timeout.
+ *
+ */
+static nrf_802154_spinel_notify_buff_t * response_notifier_await(uint32_t timeout)
+{
+    nrf_802154_spinel_notify_buff_t * p_notify_data;
+
+    p_notify_data = nrf_802154_spinel_response_notifier_property_await(timeout);
+
+#if NRF_802154_SER_STATS_ENABLED
+    nrf_802154_spinel_stats_await_end(p_notify_data != NULL);
+#endif
+
+    return p_notify_data;
+}
+
 /**
  * @brief Wait with timeout for SPINEL_STATUS_OK to be received.
  *
@@ -81,7 +131,7 @@ static nrf_802154_ser_err_t status_ok_await(uint32_t timeout)
 
     SERIALIZATION_ERROR_INIT(error);
 
-    p_notify_data = nrf_802154_spinel_response_notifier_property_await(timeout);
+    p_notify_data = response_notifier_await(timeout);
 
     SERIALIZATION_ERROR_IF(p_notify_data == NULL,
                            NRF_802154_SERIALIZATION_ERROR_RESPONSE_TIMEOUT,
@@ -110,6 +160,264 @@ bail:
     return error;
 }
 
+#if NRF_802154_SER_PIB_MIRROR_ENABLED
+
+#define PIB_MIRROR_CHANNEL      (1U << 0) ///< Channel is mirrored.
+#define PIB_MIRROR_TX_POWER     (1U << 1) ///< Transmit power is mirrored.
+#define PIB_MIRROR_CAPABILITIES (1U << 2) ///< Capabilities are mirrored.
+#define PIB_MIRROR_CCA_CFG      (1U << 3) ///< CCA configuration is mirrored.
+#define PIB_MIRROR_MIN_BE       (1U << 4) ///< CSMA-CA minimum backoff exponent is mirrored.
+#define PIB_MIRROR_MAX_BE       (1U << 5) ///< CSMA-CA maximum backoff exponent is mirrored.
+#define PIB_MIRROR_MAX_BACKOFFS (1U << 6) ///< CSMA-CA maximum number of backoffs is mirrored.
+
+/**@brief Values of the network core PIB and capabilities known to the application core. */
+static struct
+{
+    volatile uint32_t         valid;        ///< Bitmask of the mirrored values.
+    uint8_t                   channel;      ///< Channel.
+    int8_t                    tx_power;     ///< Transmit power.
+    nrf_802154_capabilities_t capabilities; ///< Capabilities of the radio driver.
+    nrf_802154_cca_cfg_t      cca_cfg;      ///< CCA configuration.
+    uint8_t                   min_be;       ///< CSMA-CA minimum backoff exponent.
+    uint8_t                   max_be;       ///< CSMA-CA maximum backoff exponent.
+    uint8_t                   max_backoffs; ///< CSMA-CA maximum number of backoffs.
+} m_pib_mirror;
+
+/**
+ * @brief Check if a value is mirrored and can be served without a request.
+ *
+ * @param[in]  value  One of the PIB_MIRROR_* values.
+ *
+ */
+static bool pib_mirror_is_valid(uint32_t value)
+{
+    return (m_pib_mirror.valid & value) != 0U;
+}
+
+/**
+ * @brief Mark a value as mirrored after it is stored in @ref m_pib_mirror.
+ *
+ * @param[in]  value  One of the PIB_MIRROR_* values.
+ *
+ */
+static void pib_mirror_validate(uint32_t value)
+{
+    m_pib_mirror.valid |= value;
+}
+
+/**
+ * @brief Mark values as unknown, so that they are requested from the network core again.
+ *
+ * @param[in]  values  Bitmask of the PIB_MIRROR_* values.
+ *
+ */
+static void pib_mirror_invalidate(uint32_t values)
+{
+    m_pib_mirror.valid &= ~values;
+}
+
+#endif // NRF_802154_SER_PIB_MIRROR_ENABLED
+
+#if NRF_802154_SER_PIPELINE_ENABLED
+
+/**@brief Number of transaction identifiers available for pipelined requests. */
+#define PIPELINE_TID_COUNT \
+    (NRF_802154_SPINEL_TID_PIPELINE_LAST - NRF_802154_SPINEL_TID_PIPELINE_FIRST + 1U)
+
+/**@brief Indicates if the requests are pipelined. */
+static volatile bool m_pipeline_active;
+
+/**@brief Indicates if the network core reports only failures of pipelined requests. */
+static volatile bool m_pipeline_fire_and_forget;
+
+/**@brief Indicates if any pipelined request failed. */
+static volatile bool m_pipeline_failed;
+
+/**@brief Bitmask of transaction identifiers of requests waiting for their statuses. */
+static volatile uint16_t m_pipeline_pending;
+
+/**@brief Transaction identifier of the most recently pipelined request. */
+static uint8_t m_pipeline_last_tid = NRF_802154_SPINEL_TID_PIPELINE_LAST;
+
+/**
+ * @brief Wait until the network core processes all requests sent before.
+ *
+ * The network core responds to requests in the order they are received, so the status of
+ * the synchronization request is received after the statuses of all pipelined requests.
+ *
+ * @returns  zero on success or negative error value on failure.
+ *
+ */
+static nrf_802154_ser_err_t pipeline_sync(void)
+{
+    nrf_802154_ser_err_t res;
+    uint32_t             crit_sect;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    response_notifier_lock(SPINEL_PROP_LAST_STATUS);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PIPELINE_SYNC,
+        SPINEL_DATATYPE_NRF_802154_PIPELINE_SYNC,
+        NULL);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    // The response trails the responses to all the requests still in flight
+    res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT *
+                          (PIPELINE_TID_COUNT + 1U));
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    if (m_pipeline_pending != 0U)
+    {
+        // Statuses that did not arrive before the synchronization response are lost
+        m_pipeline_pending = 0U;
+        m_pipeline_failed  = true;
+    }
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+    return error;
+}
+
+/**
+ * @brief Allocate transaction identifier for a pipelined request.
+ *
+ * @returns  Transaction identifier to be sent with the request.
+ *
+ */
+static uint8_t pipeline_tid_alloc(void)
+{
+    uint8_t  tid;
+    uint32_t crit_sect;
+
+    if (m_pipeline_fire_and_forget)
+    {
+        return NRF_802154_SPINEL_TID_FIRE_AND_FORGET;
+    }
+
+    tid = (m_pipeline_last_tid >= NRF_802154_SPINEL_TID_PIPELINE_LAST) ?
+          NRF_802154_SPINEL_TID_PIPELINE_FIRST : (m_pipeline_last_tid + 1U);
+
+    if ((m_pipeline_pending & (1U << tid)) != 0U)
+    {
+        // All transaction identifiers are in flight
+        if (pipeline_sync() != NRF_802154_SERIALIZATION_ERROR_OK)
+        {
+            m_pipeline_failed = true;
+        }
+    }
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+    m_pipeline_pending |= (uint16_t)(1U << tid);
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+    m_pipeline_last_tid = tid;
+
+    return tid;
+}
+
+void nrf_802154_spinel_pipeline_status_received(uint8_t tid, spinel_status_t status)
+{
+    uint32_t crit_sect;
+
+    NRF_802154_SPINEL_LOG_BANNER_RESPONSE();
+    NRF_802154_SPINEL_LOG_VAR("%u", tid);
+    NRF_802154_SPINEL_LOG_VAR_NAMED("%s", spinel_status_to_cstr(status), "status");
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    m_pipeline_pending &= (uint16_t)~(1U << tid);
+
+    if (status != SPINEL_STATUS_OK)
+    {
+        m_pipeline_failed = true;
+    }
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+}
+
+void nrf_802154_serialization_pipeline_begin(bool fire_and_forget)
+{
+    m_pipeline_fire_and_forget = fire_and_forget;
+    m_pipeline_failed          = false;
+    m_pipeline_active          = true;
+}
+
+nrf_802154_ser_err_t nrf_802154_serialization_pipeline_end(void)
+{
+    nrf_802154_ser_err_t res;
+
+    m_pipeline_active = false;
+
+    res = pipeline_sync();
+
+    if ((res == NRF_802154_SERIALIZATION_ERROR_OK) && m_pipeline_failed)
+    {
+        res = NRF_802154_SERIALIZATION_ERROR_RESPONSE_INVALID;
+    }
+
+#if NRF_802154_SER_PIB_MIRROR_ENABLED
+    if (res != NRF_802154_SERIALIZATION_ERROR_OK)
+    {
+        // It is unknown which of the pipelined setters took effect
+        pib_mirror_invalidate(UINT32_MAX);
+    }
+#endif
+
+    m_pipeline_fire_and_forget = false;
+    m_pipeline_failed          = false;
+
+    return res;
+}
+
+#endif // NRF_802154_SER_PIPELINE_ENABLED
+
+/**
+ * @brief Prepare sending a request answered with SPINEL_PROP_LAST_STATUS.
+ *
+ * @returns  Transaction identifier to be sent with the request. @ref NRF_802154_SPINEL_TID_NONE
+ *           if the status is going to be awaited with @ref status_response_await.
+ *
+ */
+static uint8_t status_request_prepare(void)
+{
+#if NRF_802154_SER_PIPELINE_ENABLED
+    if (m_pipeline_active)
+    {
+        return pipeline_tid_alloc();
+    }
+#endif
+
+    response_notifier_lock(SPINEL_PROP_LAST_STATUS);
+
+    return NRF_802154_SPINEL_TID_NONE;
+}
+
+/**
+ * @brief Wait with timeout for SPINEL_STATUS_OK to be received unless the request is pipelined.
+ *
+ * @param[in]  tid       Transaction identifier returned by @ref status_request_prepare.
+ * @param[in]  timeout   Timeout in us.
+ *
+ * @returns  zero on success or negative error value on failure.
+ *
+ */
+static nrf_802154_ser_err_t status_response_await(uint8_t tid, uint32_t timeout)
+{
+    if (tid != NRF_802154_SPINEL_TID_NONE)
+    {
+        // The status is collected by nrf_802154_spinel_pipeline_status_received
+        return NRF_802154_SERIALIZATION_ERROR_OK;
+    }
+
+    return status_ok_await(timeout);
+}
+
 /**
  * @brief Wait with timeout for some single bool property to be received.
  *
@@ -127,7 +435,7 @@ static nrf_802154_ser_err_t net_generic_bool_response_await(uint32_t timeout,
 
     SERIALIZATION_ERROR_INIT(error);
 
-    p_notify_data = nrf_802154_spinel_response_notifier_property_await(timeout);
+    p_notify_data = response_notifier_await(timeout);
 
     SERIALIZATION_ERROR_IF(p_notify_data == NULL,
                            NRF_802154_SERIALIZATION_ERROR_RESPONSE_TIMEOUT,
@@ -169,7 +477,7 @@ static nrf_802154_ser_err_t net_generic_uint8_response_await(uint32_t  timeout,
 
     SERIALIZATION_ERROR_INIT(error);
 
-    p_notify_data = nrf_802154_spinel_response_notifier_property_await(timeout);
+    p_notify_data = response_notifier_await(timeout);
 
     SERIALIZATION_ERROR_IF(p_notify_data == NULL,
                            NRF_802154_SERIALIZATION_ERROR_RESPONSE_TIMEOUT,
@@ -212,7 +520,7 @@ static nrf_802154_ser_err_t net_generic_uint16_response_await(uint32_t   timeout
 
     SERIALIZATION_ERROR_INIT(error);
 
-    p_notify_data = nrf_802154_spinel_response_notifier_property_await(timeout);
+    p_notify_data = response_notifier_await(timeout);
 
     SERIALIZATION_ERROR_IF(p_notify_data == NULL,
                            NRF_802154_SERIALIZATION_ERROR_RESPONSE_TIMEOUT,
@@ -255,8 +563,7 @@ static nrf_802154_ser_err_t tx_power_await(uint32_t timeout, int8_t * p_power)
 
     SERIALIZATION_ERROR_INIT(error);
 
-    p_notify_data = nrf_802154_spinel_response_notifier_property_await(
-        timeout);
+    p_notify_data = response_notifier_await(timeout);
 
     SERIALIZATION_ERROR_IF(p_notify_data == NULL,
                            NRF_802154_SERIALIZATION_ERROR_RESPONSE_TIMEOUT,
@@ -298,8 +605,7 @@ static nrf_802154_ser_err_t capabilities_await(uint32_t                    timeo
 
     SERIALIZATION_ERROR_INIT(error);
 
-    p_notify_data = nrf_802154_spinel_response_notifier_property_await(
-        timeout);
+    p_notify_data = response_notifier_await(timeout);
 
     SERIALIZATION_ERROR_IF(p_notify_data == NULL,
                            NRF_802154_SERIALIZATION_ERROR_RESPONSE_TIMEOUT,
@@ -341,8 +647,7 @@ static nrf_802154_ser_err_t time_await(uint32_t   timeout,
 
     SERIALIZATION_ERROR_INIT(error);
 
-    p_notify_data = nrf_802154_spinel_response_notifier_property_await(
-        timeout);
+    p_notify_data = response_notifier_await(timeout);
 
     SERIALIZATION_ERROR_IF(p_notify_data == NULL,
                            NRF_802154_SERIALIZATION_ERROR_RESPONSE_TIMEOUT,
@@ -384,8 +689,7 @@ static nrf_802154_ser_err_t cca_cfg_await(uint32_t               timeout,
 
     SERIALIZATION_ERROR_INIT(error);
 
-    p_notify_data = nrf_802154_spinel_response_notifier_property_await(
-        timeout);
+    p_notify_data = response_notifier_await(timeout);
 
     SERIALIZATION_ERROR_IF(p_notify_data == NULL,
                            NRF_802154_SERIALIZATION_ERROR_RESPONSE_TIMEOUT,
@@ -415,6 +719,10 @@ bail:
 
 void nrf_802154_init(void)
 {
+#if NRF_802154_SER_PIB_MIRROR_ENABLED
+    pib_mirror_invalidate(UINT32_MAX);
+#endif
+
     nrf_802154_serialization_init();
 }
 
@@ -427,8 +735,7 @@ bool nrf_802154_sleep(void)
 
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
 
-    nrf_802154_spinel_response_notifier_lock_before_request(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SLEEP);
+    response_notifier_lock(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SLEEP);
 
     res = nrf_802154_spinel_send_cmd_prop_value_set(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SLEEP,
                                                     SPINEL_DATATYPE_NRF_802154_SLEEP,
@@ -456,8 +763,7 @@ nrf_802154_sleep_error_t nrf_802154_sleep_if_idle(void)
 
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
 
-    nrf_802154_spinel_response_notifier_lock_before_request(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SLEEP_IF_IDLE);
+    response_notifier_lock(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SLEEP_IF_IDLE);
 
     res = nrf_802154_spinel_send_cmd_prop_value_set(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SLEEP_IF_IDLE,
@@ -486,8 +792,7 @@ bool nrf_802154_receive(void)
 
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
 
-    nrf_802154_spinel_response_notifier_lock_before_request(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE);
+    response_notifier_lock(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE);
 
     res = nrf_802154_spinel_send_cmd_prop_value_set(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE,
                                                     SPINEL_DATATYPE_NRF_802154_RECEIVE,
@@ -518,8 +823,7 @@ bool nrf_802154_receive_at(uint64_t rx_time,
 
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
 
-    nrf_802154_spinel_response_notifier_lock_before_request(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_AT);
+    response_notifier_lock(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_AT);
 
     res = nrf_802154_spinel_send_cmd_prop_value_set(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_AT,
@@ -543,6 +847,45 @@ bail:
 
 }
 
+bool nrf_802154_receive_at_periodic(uint64_t rx_time,
+                                    uint32_t period,
+                                    uint32_t timeout,
+                                    uint8_t  channel,
+                                    uint32_t count,
+                                    uint32_t id)
+{
+    nrf_802154_ser_err_t res;
+    bool                 rx_at_result = false;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+
+    response_notifier_lock(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_AT_PERIODIC);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_AT_PERIODIC,
+        SPINEL_DATATYPE_NRF_802154_RECEIVE_AT_PERIODIC,
+        rx_time,
+        period,
+        timeout,
+        channel,
+        count,
+        id);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = net_generic_bool_response_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT,
+                                          &rx_at_result);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return rx_at_result;
+}
+
 bool nrf_802154_receive_at_cancel(uint32_t id)
 {
     nrf_802154_ser_err_t res;
@@ -552,8 +895,7 @@ bool nrf_802154_receive_at_cancel(uint32_t id)
 
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
 
-    nrf_802154_spinel_response_notifier_lock_before_request(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_AT_CANCEL);
+    response_notifier_lock(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_AT_CANCEL);
 
     res = nrf_802154_spinel_send_cmd_prop_value_set(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_AT_CANCEL,
@@ -582,16 +924,18 @@ void nrf_802154_pan_id_set(const uint8_t * p_pan_id)
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
     NRF_802154_SPINEL_LOG_BUFF(p_pan_id, PAN_ID_SIZE);
 
-    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
+    uint8_t tid = status_request_prepare();
 
-    res = nrf_802154_spinel_send_cmd_prop_value_set(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PAN_ID_SET,
-                                                    SPINEL_DATATYPE_NRF_802154_PAN_ID_SET,
-                                                    p_pan_id,
-                                                    PAN_ID_SIZE);
+    res = nrf_802154_spinel_send_cmd_prop_value_set_tid(
+        tid,
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PAN_ID_SET,
+        SPINEL_DATATYPE_NRF_802154_PAN_ID_SET,
+        p_pan_id,
+        PAN_ID_SIZE);
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
-    res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+    res = status_response_await(tid, CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
 bail:
@@ -609,9 +953,10 @@ void nrf_802154_short_address_set(const uint8_t * p_short_address)
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
     NRF_802154_SPINEL_LOG_BUFF(p_short_address, SHORT_ADDRESS_SIZE);
 
-    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
+    uint8_t tid = status_request_prepare();
 
-    res = nrf_802154_spinel_send_cmd_prop_value_set(
+    res = nrf_802154_spinel_send_cmd_prop_value_set_tid(
+        tid,
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SHORT_ADDRESS_SET,
         SPINEL_DATATYPE_NRF_802154_SHORT_ADDRESS_SET,
         p_short_address,
@@ -619,7 +964,7 @@ void nrf_802154_short_address_set(const uint8_t * p_short_address)
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
-    res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+    res = status_response_await(tid, CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
 bail:
@@ -637,9 +982,10 @@ void nrf_802154_extended_address_set(const uint8_t * p_extended_address)
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
     NRF_802154_SPINEL_LOG_BUFF(p_extended_address, EXTENDED_ADDRESS_SIZE);
 
-    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
+    uint8_t tid = status_request_prepare();
 
-    res = nrf_802154_spinel_send_cmd_prop_value_set(
+    res = nrf_802154_spinel_send_cmd_prop_value_set_tid(
+        tid,
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_EXTENDED_ADDRESS_SET,
         SPINEL_DATATYPE_NRF_802154_EXTENDED_ADDRESS_SET,
         p_extended_address,
@@ -647,7 +993,7 @@ void nrf_802154_extended_address_set(const uint8_t * p_extended_address)
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
-    res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+    res = status_response_await(tid, CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
 bail:
@@ -665,16 +1011,17 @@ void nrf_802154_pan_coord_set(bool enabled)
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
     NRF_802154_SPINEL_LOG_VAR_NAMED("%s", enabled ? "true" : "false", "enabled");
 
-    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
+    uint8_t tid = status_request_prepare();
 
-    res = nrf_802154_spinel_send_cmd_prop_value_set(
+    res = nrf_802154_spinel_send_cmd_prop_value_set_tid(
+        tid,
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PAN_COORD_SET,
         SPINEL_DATATYPE_NRF_802154_PAN_COORD_SET,
         enabled);
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
-    res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+    res = status_response_await(tid, CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
 bail:
@@ -692,16 +1039,17 @@ void nrf_802154_promiscuous_set(bool enabled)
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
     NRF_802154_SPINEL_LOG_VAR_NAMED("%s", enabled ? "true" : "false", "enabled");
 
-    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
+    uint8_t tid = status_request_prepare();
 
-    res = nrf_802154_spinel_send_cmd_prop_value_set(
+    res = nrf_802154_spinel_send_cmd_prop_value_set_tid(
+        tid,
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PROMISCUOUS_SET,
         SPINEL_DATATYPE_NRF_802154_PROMISCUOUS_SET,
         enabled);
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
-    res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+    res = status_response_await(tid, CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
 bail:
@@ -717,16 +1065,17 @@ void nrf_802154_src_addr_matching_method_set(nrf_802154_src_addr_match_t match_m
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
     NRF_802154_SPINEL_LOG_VAR("%u", match_method);
 
-    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
+    uint8_t tid = status_request_prepare();
 
-    res = nrf_802154_spinel_send_cmd_prop_value_set(
+    res = nrf_802154_spinel_send_cmd_prop_value_set_tid(
+        tid,
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SRC_ADDR_MATCHING_METHOD_SET,
         SPINEL_DATATYPE_NRF_802154_SRC_ADDR_MATCHING_METHOD_SET,
         match_method);
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
-    res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+    res = status_response_await(tid, CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
 bail:
@@ -748,8 +1097,7 @@ bool nrf_802154_ack_data_set(const uint8_t       * p_addr,
     NRF_802154_SPINEL_LOG_BUFF(p_addr, extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE);
     NRF_802154_SPINEL_LOG_VAR_NAMED("%s", (extended ? "true" : "false"), "extended");
 
-    nrf_802154_spinel_response_notifier_lock_before_request(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_SET);
+    response_notifier_lock(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_SET);
 
     res = nrf_802154_spinel_send_cmd_prop_value_set(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_SET,
@@ -786,8 +1134,7 @@ bool nrf_802154_ack_data_clear(const uint8_t       * p_addr,
     NRF_802154_SPINEL_LOG_BUFF(p_addr, extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE);
     NRF_802154_SPINEL_LOG_VAR_NAMED("%s", (extended ? "true" : "false"), "extended");
 
-    nrf_802154_spinel_response_notifier_lock_before_request(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_CLEAR);
+    response_notifier_lock(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_CLEAR);
 
     res = nrf_802154_spinel_send_cmd_prop_value_set(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_CLEAR,
@@ -809,6 +1156,174 @@ bail:
     return ack_data_clear_res;
 }
 
+/**
+ * @brief Calculate the number of subsequent addresses of a batch that fit in one Spinel command.
+ *
+ * @param[in]  addr_size  Size of a single address.
+ * @param[in]  num_addrs  Number of remaining addresses in the batch.
+ * @param[in]  p_lengths  Pointer to the lengths of the data of the remaining addresses or NULL.
+ * @param[out] p_data_len Total length of the data of the addresses that fit in one command.
+ *
+ * @returns  Number of addresses that fit in one command.
+ */
+static uint8_t ack_data_batch_chunk_size_get(uint8_t         addr_size,
+                                             uint8_t         num_addrs,
+                                             const uint8_t * p_lengths,
+                                             size_t        * p_data_len)
+{
+    size_t  payload_len = 0;
+    uint8_t count       = 0;
+
+    *p_data_len = 0;
+
+    while (count < num_addrs)
+    {
+        size_t entry_len = addr_size;
+
+        if (p_lengths != NULL)
+        {
+            entry_len += sizeof(uint8_t) + p_lengths[count];
+        }
+
+        if (payload_len + entry_len > NRF_802154_SPINEL_ACK_DATA_BATCH_PAYLOAD_MAX_SIZE)
+        {
+            break;
+        }
+
+        payload_len += entry_len;
+        *p_data_len += (p_lengths != NULL) ? p_lengths[count] : 0U;
+        count++;
+    }
+
+    return count;
+}
+
+bool nrf_802154_ack_data_set_batch(const uint8_t       * p_addrs,
+                                   bool                  extended,
+                                   uint8_t               num_addrs,
+                                   const void          * p_data,
+                                   const uint8_t       * p_lengths,
+                                   nrf_802154_ack_data_t data_type)
+{
+    nrf_802154_ser_err_t res;
+    bool                 ack_data_set_res = true;
+    uint8_t              addr_size        = extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
+    const uint8_t      * p_chunk_data     = (const uint8_t *)p_data;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_VAR("%u", num_addrs);
+    NRF_802154_SPINEL_LOG_VAR_NAMED("%s", (extended ? "true" : "false"), "extended");
+
+    if (data_type != NRF_802154_ACK_DATA_IE)
+    {
+        p_chunk_data = NULL;
+        p_lengths    = NULL;
+    }
+
+    // Addresses are sent in as few commands as the Spinel frame size allows.
+    while (num_addrs > 0)
+    {
+        bool    chunk_res = false;
+        size_t  data_len;
+        uint8_t count = ack_data_batch_chunk_size_get(addr_size, num_addrs, p_lengths, &data_len);
+
+        SERIALIZATION_ERROR_IF(count == 0,
+                               NRF_802154_SERIALIZATION_ERROR_ENCODING_FAILURE,
+                               error,
+                               bail);
+
+        response_notifier_lock(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_SET_BATCH);
+
+        res = nrf_802154_spinel_send_cmd_prop_value_set(
+            SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_SET_BATCH,
+            SPINEL_DATATYPE_NRF_802154_ACK_DATA_SET_BATCH,
+            p_addrs,
+            (size_t)(addr_size * count),
+            extended,
+            p_lengths,
+            (p_lengths != NULL) ? (size_t)count : 0U,
+            p_chunk_data,
+            data_len,
+            data_type);
+
+        SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+        res = net_generic_bool_response_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT,
+                                              &chunk_res);
+
+        SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+        ack_data_set_res &= chunk_res;
+
+        if (p_lengths != NULL)
+        {
+            p_chunk_data += data_len;
+            p_lengths    += count;
+        }
+
+        p_addrs   += addr_size * count;
+        num_addrs -= count;
+    }
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return ack_data_set_res && (error == NRF_802154_SERIALIZATION_ERROR_OK);
+}
+
+bool nrf_802154_ack_data_clear_batch(const uint8_t       * p_addrs,
+                                     bool                  extended,
+                                     uint8_t               num_addrs,
+                                     nrf_802154_ack_data_t data_type)
+{
+    nrf_802154_ser_err_t res;
+    bool                 ack_data_clear_res = true;
+    uint8_t              addr_size          = extended ? EXTENDED_ADDRESS_SIZE :
+                                              SHORT_ADDRESS_SIZE;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_VAR("%u", num_addrs);
+    NRF_802154_SPINEL_LOG_VAR_NAMED("%s", (extended ? "true" : "false"), "extended");
+
+    while (num_addrs > 0)
+    {
+        bool    chunk_res = false;
+        size_t  data_len;
+        uint8_t count = ack_data_batch_chunk_size_get(addr_size, num_addrs, NULL, &data_len);
+
+        response_notifier_lock(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_CLEAR_BATCH);
+
+        res = nrf_802154_spinel_send_cmd_prop_value_set(
+            SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_CLEAR_BATCH,
+            SPINEL_DATATYPE_NRF_802154_ACK_DATA_CLEAR_BATCH,
+            p_addrs,
+            (size_t)(addr_size * count),
+            extended,
+            data_type);
+
+        SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+        res = net_generic_bool_response_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT,
+                                              &chunk_res);
+
+        SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+        ack_data_clear_res &= chunk_res;
+
+        p_addrs   += addr_size * count;
+        num_addrs -= count;
+    }
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return ack_data_clear_res && (error == NRF_802154_SERIALIZATION_ERROR_OK);
+}
+
 void nrf_802154_auto_pending_bit_set(bool enabled)
 {
     nrf_802154_ser_err_t res;
@@ -818,16 +1333,17 @@ void nrf_802154_auto_pending_bit_set(bool enabled)
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
     NRF_802154_SPINEL_LOG_VAR_NAMED("%s", (enabled ? "true" : "false"), "enabled");
 
-    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
+    uint8_t tid = status_request_prepare();
 
-    res = nrf_802154_spinel_send_cmd_prop_value_set(
+    res = nrf_802154_spinel_send_cmd_prop_value_set_tid(
+        tid,
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_AUTO_PENDING_BIT_SET,
         SPINEL_DATATYPE_NRF_802154_AUTO_PENDING_BIT_SET,
         enabled);
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
-    res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+    res = status_response_await(tid, CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
 bail:
@@ -845,8 +1361,7 @@ bool nrf_802154_pending_bit_for_addr_set(const uint8_t * p_addr, bool extended)
     NRF_802154_SPINEL_LOG_BUFF(p_addr, extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE);
     NRF_802154_SPINEL_LOG_VAR_NAMED("%s", (extended ? "true" : "false"), "extended");
 
-    nrf_802154_spinel_response_notifier_lock_before_request(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_SET);
+    response_notifier_lock(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_SET);
 
     res = nrf_802154_spinel_send_cmd_prop_value_set(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_SET,
@@ -878,8 +1393,7 @@ bool nrf_802154_pending_bit_for_addr_clear(const uint8_t * p_addr, bool extended
     NRF_802154_SPINEL_LOG_BUFF(p_addr, extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE);
     NRF_802154_SPINEL_LOG_VAR_NAMED("%s", (extended ? "true" : "false"), "extended");
 
-    nrf_802154_spinel_response_notifier_lock_before_request(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR);
+    response_notifier_lock(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR);
 
     res = nrf_802154_spinel_send_cmd_prop_value_set(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR,
@@ -909,16 +1423,17 @@ void nrf_802154_pending_bit_for_addr_reset(bool extended)
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
     NRF_802154_SPINEL_LOG_VAR_NAMED("%s", (extended ? "true" : "false"), "extended");
 
-    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
+    uint8_t tid = status_request_prepare();
 
-    res = nrf_802154_spinel_send_cmd_prop_value_set(
+    res = nrf_802154_spinel_send_cmd_prop_value_set_tid(
+        tid,
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_RESET,
         SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_RESET,
         extended);
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
-    res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+    res = status_response_await(tid, CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
 bail:
@@ -935,18 +1450,24 @@ void nrf_802154_channel_set(uint8_t channel)
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
     NRF_802154_SPINEL_LOG_VAR("%u", channel);
 
-    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
+    uint8_t tid = status_request_prepare();
 
-    res = nrf_802154_spinel_send_cmd_prop_value_set(
+    res = nrf_802154_spinel_send_cmd_prop_value_set_tid(
+        tid,
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CHANNEL_SET,
         SPINEL_DATATYPE_NRF_802154_CHANNEL_SET,
         channel);
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
-    res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+    res = status_response_await(tid, CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
+#if NRF_802154_SER_PIB_MIRROR_ENABLED
+    m_pib_mirror.channel = channel;
+    pib_mirror_validate(PIB_MIRROR_CHANNEL);
+#endif
+
 bail:
     SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
 
@@ -958,12 +1479,18 @@ uint8_t nrf_802154_channel_get(void)
     nrf_802154_ser_err_t res;
     uint8_t              channel = 0;
 
+#if NRF_802154_SER_PIB_MIRROR_ENABLED
+    if (pib_mirror_is_valid(PIB_MIRROR_CHANNEL))
+    {
+        return m_pib_mirror.channel;
+    }
+#endif
+
     SERIALIZATION_ERROR_INIT(error);
 
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
 
-    nrf_802154_spinel_response_notifier_lock_before_request(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CHANNEL_GET);
+    response_notifier_lock(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CHANNEL_GET);
 
     res = nrf_802154_spinel_send_cmd_prop_value_set(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CHANNEL_GET,
@@ -976,6 +1503,11 @@ uint8_t nrf_802154_channel_get(void)
                                            &channel);
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
+#if NRF_802154_SER_PIB_MIRROR_ENABLED
+    m_pib_mirror.channel = channel;
+    pib_mirror_validate(PIB_MIRROR_CHANNEL);
+#endif
+
 bail:
     SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
 
@@ -991,7 +1523,7 @@ bool nrf_802154_cca(void)
 
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
 
-    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CCA);
+    response_notifier_lock(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CCA);
 
     res = nrf_802154_spinel_send_cmd_prop_value_set(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CCA,
@@ -1022,8 +1554,7 @@ bool nrf_802154_continuous_carrier(void)
 
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
 
-    nrf_802154_spinel_response_notifier_lock_before_request(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CONTINUOUS_CARRIER);
+    response_notifier_lock(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CONTINUOUS_CARRIER);
 
     res = nrf_802154_spinel_send_cmd_prop_value_set(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CONTINUOUS_CARRIER,
@@ -1053,8 +1584,7 @@ bool nrf_802154_modulated_carrier(const uint8_t * p_data)
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
     NRF_802154_SPINEL_LOG_BUFF(p_data, RAW_PAYLOAD_OFFSET + p_data[0]);
 
-    nrf_802154_spinel_response_notifier_lock_before_request(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_MODULATED_CARRIER);
+    response_notifier_lock(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_MODULATED_CARRIER);
 
     res = nrf_802154_spinel_send_cmd_prop_value_set(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_MODULATED_CARRIER,
@@ -1086,8 +1616,7 @@ bool nrf_802154_energy_detection(uint32_t time_us)
 
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
 
-    nrf_802154_spinel_response_notifier_lock_before_request(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_DETECTION);
+    response_notifier_lock(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_DETECTION);
 
     res = nrf_802154_spinel_send_cmd_prop_value_set(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_DETECTION,
@@ -1107,6 +1636,36 @@ bail:
     return ed_result;
 }
 
+bool nrf_802154_energy_scan(uint32_t channel_mask, uint32_t dwell_time_us)
+{
+    nrf_802154_ser_err_t res;
+    bool                 scan_result = false;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+
+    response_notifier_lock(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_SCAN);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_SCAN,
+        SPINEL_DATATYPE_NRF_802154_ENERGY_SCAN,
+        channel_mask,
+        dwell_time_us);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = net_generic_bool_response_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT,
+                                          &scan_result);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return scan_result;
+}
+
 #if NRF_802154_CSMA_CA_ENABLED
 
 bool nrf_802154_transmit_csma_ca_raw(uint8_t                                      * p_data,
@@ -1138,8 +1697,7 @@ bool nrf_802154_transmit_csma_ca_raw(uint8_t
 
     SERIALIZATION_ERROR_IF(!handle_added, NRF_802154_SERIALIZATION_ERROR_NO_MEMORY, error, bail);
 
-    nrf_802154_spinel_response_notifier_lock_before_request(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_CSMA_CA_RAW);
+    response_notifier_lock(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_CSMA_CA_RAW);
 
     res = nrf_802154_spinel_send_cmd_prop_value_set(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_CSMA_CA_RAW,
@@ -1180,8 +1738,7 @@ bool nrf_802154_csma_ca_min_be_set(uint8_t min_be)
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
     NRF_802154_SPINEL_LOG_VAR("%u", min_be);
 
-    nrf_802154_spinel_response_notifier_lock_before_request(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MIN_BE_SET);
+    response_notifier_lock(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MIN_BE_SET);
 
     res = nrf_802154_spinel_send_cmd_prop_value_set(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MIN_BE_SET,
@@ -1194,6 +1751,14 @@ bool nrf_802154_csma_ca_min_be_set(uint8_t min_be)
                                           &result);
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
+#if NRF_802154_SER_PIB_MIRROR_ENABLED
+    if (result)
+    {
+        m_pib_mirror.min_be = min_be;
+        pib_mirror_validate(PIB_MIRROR_MIN_BE);
+    }
+#endif
+
 bail:
     SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
 
@@ -1205,12 +1770,18 @@ uint8_t nrf_802154_csma_ca_min_be_get(void)
     nrf_802154_ser_err_t res;
     uint8_t              min_be = 0;
 
+#if NRF_802154_SER_PIB_MIRROR_ENABLED
+    if (pib_mirror_is_valid(PIB_MIRROR_MIN_BE))
+    {
+        return m_pib_mirror.min_be;
+    }
+#endif
+
     SERIALIZATION_ERROR_INIT(error);
 
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
 
-    nrf_802154_spinel_response_notifier_lock_before_request(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MIN_BE_GET);
+    response_notifier_lock(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MIN_BE_GET);
 
     res = nrf_802154_spinel_send_cmd_prop_value_set(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MIN_BE_GET,
@@ -1223,6 +1794,11 @@ uint8_t nrf_802154_csma_ca_min_be_get(void)
                                            &min_be);
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
+#if NRF_802154_SER_PIB_MIRROR_ENABLED
+    m_pib_mirror.min_be = min_be;
+    pib_mirror_validate(PIB_MIRROR_MIN_BE);
+#endif
+
 bail:
     SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
 
@@ -1239,8 +1815,7 @@ bool nrf_802154_csma_ca_max_be_set(uint8_t max_be)
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
     NRF_802154_SPINEL_LOG_VAR("%u", max_be);
 
-    nrf_802154_spinel_response_notifier_lock_before_request(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BE_SET);
+    response_notifier_lock(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BE_SET);
 
     res = nrf_802154_spinel_send_cmd_prop_value_set(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BE_SET,
@@ -1253,6 +1828,14 @@ bool nrf_802154_csma_ca_max_be_set(uint8_t max_be)
                                           &result);
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
+#if NRF_802154_SER_PIB_MIRROR_ENABLED
+    if (result)
+    {
+        m_pib_mirror.max_be = max_be;
+        pib_mirror_validate(PIB_MIRROR_MAX_BE);
+    }
+#endif
+
 bail:
     SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
 
@@ -1264,12 +1847,18 @@ uint8_t nrf_802154_csma_ca_max_be_get(void)
     nrf_802154_ser_err_t res;
     uint8_t              max_be = 0;
 
+#if NRF_802154_SER_PIB_MIRROR_ENABLED
+    if (pib_mirror_is_valid(PIB_MIRROR_MAX_BE))
+    {
+        return m_pib_mirror.max_be;
+    }
+#endif
+
     SERIALIZATION_ERROR_INIT(error);
 
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
 
-    nrf_802154_spinel_response_notifier_lock_before_request(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BE_GET);
+    response_notifier_lock(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BE_GET);
 
     res = nrf_802154_spinel_send_cmd_prop_value_set(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BE_GET,
@@ -1282,6 +1871,11 @@ uint8_t nrf_802154_csma_ca_max_be_get(void)
                                            &max_be);
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
+#if NRF_802154_SER_PIB_MIRROR_ENABLED
+    m_pib_mirror.max_be = max_be;
+    pib_mirror_validate(PIB_MIRROR_MAX_BE);
+#endif
+
 bail:
     SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
 
@@ -1297,18 +1891,24 @@ void nrf_802154_csma_ca_max_backoffs_set(uint8_t max_backoffs)
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
     NRF_802154_SPINEL_LOG_VAR("%u", max_backoffs);
 
-    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
+    uint8_t tid = status_request_prepare();
 
-    res = nrf_802154_spinel_send_cmd_prop_value_set(
+    res = nrf_802154_spinel_send_cmd_prop_value_set_tid(
+        tid,
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BACKOFFS_SET,
         SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BACKOFFS_SET,
         max_backoffs);
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
-    res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+    res = status_response_await(tid, CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
+#if NRF_802154_SER_PIB_MIRROR_ENABLED
+    m_pib_mirror.max_backoffs = max_backoffs;
+    pib_mirror_validate(PIB_MIRROR_MAX_BACKOFFS);
+#endif
+
 bail:
     SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
 
@@ -1320,12 +1920,18 @@ uint8_t nrf_802154_csma_ca_max_backoffs_get(void)
     nrf_802154_ser_err_t res;
     uint8_t              max_backoffs = 0;
 
+#if NRF_802154_SER_PIB_MIRROR_ENABLED
+    if (pib_mirror_is_valid(PIB_MIRROR_MAX_BACKOFFS))
+    {
+        return m_pib_mirror.max_backoffs;
+    }
+#endif
+
     SERIALIZATION_ERROR_INIT(error);
 
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
 
-    nrf_802154_spinel_response_notifier_lock_before_request(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BACKOFFS_GET);
+    response_notifier_lock(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BACKOFFS_GET);
 
     res = nrf_802154_spinel_send_cmd_prop_value_set(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BACKOFFS_GET,
@@ -1338,6 +1944,11 @@ uint8_t nrf_802154_csma_ca_max_backoffs_get(void)
                                            &max_backoffs);
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
+#if NRF_802154_SER_PIB_MIRROR_ENABLED
+    m_pib_mirror.max_backoffs = max_backoffs;
+    pib_mirror_validate(PIB_MIRROR_MAX_BACKOFFS);
+#endif
+
 bail:
     SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
 
@@ -1356,8 +1967,7 @@ nrf_802154_test_mode_csmaca_backoff_t nrf_802154_test_mode_csmaca_backoff_get(vo
 
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
 
-    nrf_802154_spinel_response_notifier_lock_before_request(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TEST_MODE_CSMACA_BACKOFF_GET);
+    response_notifier_lock(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TEST_MODE_CSMACA_BACKOFF_GET);
 
     res = nrf_802154_spinel_send_cmd_prop_value_set(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TEST_MODE_CSMACA_BACKOFF_GET,
@@ -1385,16 +1995,17 @@ void nrf_802154_test_mode_csmaca_backoff_set(nrf_802154_test_mode_csmaca_backoff
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
     NRF_802154_SPINEL_LOG_VAR("%u", value);
 
-    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
+    uint8_t tid = status_request_prepare();
 
-    res = nrf_802154_spinel_send_cmd_prop_value_set(
+    res = nrf_802154_spinel_send_cmd_prop_value_set_tid(
+        tid,
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TEST_MODE_CSMACA_BACKOFF_SET,
         SPINEL_DATATYPE_NRF_802154_TEST_MODE_CSMACA_BACKOFF_SET,
         value);
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
-    res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+    res = status_response_await(tid, CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
 bail:
@@ -1435,8 +2046,7 @@ bool nrf_802154_transmit_raw(uint8_t                              * p_data,
 
     SERIALIZATION_ERROR_IF(!handle_added, NRF_802154_SERIALIZATION_ERROR_NO_MEMORY, error, bail);
 
-    nrf_802154_spinel_response_notifier_lock_before_request(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW);
+    response_notifier_lock(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW);
 
     res = nrf_802154_spinel_send_cmd_prop_value_set(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW,
@@ -1500,8 +2110,7 @@ bool nrf_802154_transmit_raw_at(uint8_t                                 * p_data
 
     SERIALIZATION_ERROR_IF(!handle_added, NRF_802154_SERIALIZATION_ERROR_NO_MEMORY, error, bail);
 
-    nrf_802154_spinel_response_notifier_lock_before_request(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW_AT);
+    response_notifier_lock(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW_AT);
 
     res = nrf_802154_spinel_send_cmd_prop_value_set(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW_AT,
@@ -1542,8 +2151,7 @@ bool nrf_802154_transmit_at_cancel(void)
 
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
 
-    nrf_802154_spinel_response_notifier_lock_before_request(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_AT_CANCEL);
+    response_notifier_lock(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_AT_CANCEL);
 
     res = nrf_802154_spinel_send_cmd_prop_value_set(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_AT_CANCEL,
@@ -1583,12 +2191,11 @@ void nrf_802154_buffer_free_raw(uint8_t * p_data)
                            error,
                            bail);
 
-    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
+    response_notifier_lock(SPINEL_PROP_LAST_STATUS);
 
-    res = nrf_802154_spinel_send_cmd_prop_value_set(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_BUFFER_FREE_RAW,
-        SPINEL_DATATYPE_NRF_802154_BUFFER_FREE_RAW,
-        data_handle);
+    // This request is sent for every received frame, so the generic encoder is skipped
+    res = nrf_802154_spinel_send_encoded(nrf_802154_spinel_codec_buffer_free_raw_encode,
+                                         &data_handle);
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
@@ -1618,18 +2225,24 @@ void nrf_802154_tx_power_set(int8_t power)
 
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
 
-    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
+    uint8_t tid = status_request_prepare();
 
-    res = nrf_802154_spinel_send_cmd_prop_value_set(
+    res = nrf_802154_spinel_send_cmd_prop_value_set_tid(
+        tid,
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_POWER_SET,
         SPINEL_DATATYPE_NRF_802154_TX_POWER_SET,
         power);
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
-    res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+    res = status_response_await(tid, CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
+#if NRF_802154_SER_PIB_MIRROR_ENABLED
+    m_pib_mirror.tx_power = power;
+    pib_mirror_validate(PIB_MIRROR_TX_POWER);
+#endif
+
 bail:
     SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
 
@@ -1641,12 +2254,18 @@ int8_t nrf_802154_tx_power_get(void)
     int32_t res;
     int8_t  power = 0;
 
+#if NRF_802154_SER_PIB_MIRROR_ENABLED
+    if (pib_mirror_is_valid(PIB_MIRROR_TX_POWER))
+    {
+        return m_pib_mirror.tx_power;
+    }
+#endif
+
     SERIALIZATION_ERROR_INIT(error);
 
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
 
-    nrf_802154_spinel_response_notifier_lock_before_request(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_POWER_GET);
+    response_notifier_lock(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_POWER_GET);
 
     res = nrf_802154_spinel_send_cmd_prop_value_set(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_POWER_GET,
@@ -1658,6 +2277,11 @@ int8_t nrf_802154_tx_power_get(void)
     res = tx_power_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT, &power);
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
+#if NRF_802154_SER_PIB_MIRROR_ENABLED
+    m_pib_mirror.tx_power = power;
+    pib_mirror_validate(PIB_MIRROR_TX_POWER);
+#endif
+
 bail:
     SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
 
@@ -1669,12 +2293,18 @@ nrf_802154_capabilities_t nrf_802154_capabilities_get(void)
     int32_t                   res;
     nrf_802154_capabilities_t caps = 0UL;
 
+#if NRF_802154_SER_PIB_MIRROR_ENABLED
+    if (pib_mirror_is_valid(PIB_MIRROR_CAPABILITIES))
+    {
+        return m_pib_mirror.capabilities;
+    }
+#endif
+
     SERIALIZATION_ERROR_INIT(error);
 
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
 
-    nrf_802154_spinel_response_notifier_lock_before_request(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CAPABILITIES_GET);
+    response_notifier_lock(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CAPABILITIES_GET);
 
     res = nrf_802154_spinel_send_cmd_prop_value_set(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CAPABILITIES_GET,
@@ -1686,23 +2316,34 @@ nrf_802154_capabilities_t nrf_802154_capabilities_get(void)
     res = capabilities_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT, &caps);
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
+#if NRF_802154_SER_PIB_MIRROR_ENABLED
+    m_pib_mirror.capabilities = caps;
+    pib_mirror_validate(PIB_MIRROR_CAPABILITIES);
+#endif
+
 bail:
     SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
 
     return caps;
 }
 
-uint64_t nrf_802154_time_get(void)
+/**
+ * @brief Get current time of the network core with a request.
+ *
+ * @param[out] p_time  Pointer to the time variable which needs to be populated.
+ *
+ * @returns  zero on success or negative error value on failure.
+ *
+ */
+static nrf_802154_ser_err_t remote_time_get(uint64_t * p_time)
 {
-    int32_t  res;
-    uint64_t time = 0UL;
+    int32_t res;
 
     SERIALIZATION_ERROR_INIT(error);
 
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
 
-    nrf_802154_spinel_response_notifier_lock_before_request(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TIME_GET);
+    response_notifier_lock(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TIME_GET);
 
     res = nrf_802154_spinel_send_cmd_prop_value_set(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TIME_GET,
@@ -1711,7 +2352,156 @@ uint64_t nrf_802154_time_get(void)
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
-    res = time_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT, &time);
+    res = time_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT, p_time);
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    return error;
+}
+
+#if NRF_802154_SER_TIME_SYNC_ENABLED
+
+/**@brief Scale of the drift between the clocks, parts per billion. */
+#define TIME_SYNC_DRIFT_SCALE     1000000000LL
+
+/**@brief Maximum absolute value of the drift between the clocks in @ref TIME_SYNC_DRIFT_SCALE. */
+#define TIME_SYNC_DRIFT_MAX       (NRF_802154_SER_TIME_SYNC_MAX_DRIFT_PPM * 1000LL)
+
+/**@brief Reference point of the network core time estimation. */
+typedef struct
+{
+    uint64_t local;  ///< Local time of the reference point.
+    uint64_t remote; ///< Network core time of the reference point.
+    int64_t  drift;  ///< Drift of the network core clock relative to the local clock in ppb.
+    bool     valid;  ///< Indicates if the reference point was measured.
+} time_sync_ref_t;
+
+/**@brief Latest reference point of the network core time estimation. */
+static time_sync_ref_t m_time_sync_ref;
+
+/**@brief Latest estimate returned, keeping the estimates monotonic across refreshes. */
+static uint64_t m_time_sync_last;
+
+/**
+ * @brief Measure a new reference point of the network core time estimation.
+ *
+ * The network core time is assigned to the middle of the request round trip, so the error
+ * of the reference point does not exceed half of the round trip time.
+ *
+ * @returns  zero on success or negative error value on failure.
+ *
+ */
+static nrf_802154_ser_err_t time_sync_refresh(void)
+{
+    nrf_802154_ser_err_t res;
+    uint64_t             remote;
+    uint64_t             local_before;
+    uint64_t             local_after;
+    uint64_t             local;
+    uint32_t             crit_sect;
+
+    local_before = nrf_802154_serialization_local_time_get();
+    res          = remote_time_get(&remote);
+    local_after  = nrf_802154_serialization_local_time_get();
+
+    if (res < 0)
+    {
+        return res;
+    }
+
+    local = local_before + (local_after - local_before) / 2U;
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    time_sync_ref_t ref = m_time_sync_ref;
+
+    if (ref.valid && (local > ref.local))
+    {
+        int64_t local_delta  = (int64_t)(local - ref.local);
+        int64_t remote_delta = (int64_t)(remote - ref.remote);
+        int64_t drift        = ((remote_delta - local_delta) * TIME_SYNC_DRIFT_SCALE) /
+                               local_delta;
+
+        if (drift > TIME_SYNC_DRIFT_MAX)
+        {
+            drift = TIME_SYNC_DRIFT_MAX;
+        }
+        else if (drift < -TIME_SYNC_DRIFT_MAX)
+        {
+            drift = -TIME_SYNC_DRIFT_MAX;
+        }
+
+        m_time_sync_ref.drift = drift;
+    }
+
+    m_time_sync_ref.local  = local;
+    m_time_sync_ref.remote = remote;
+    m_time_sync_ref.valid  = true;
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+    return NRF_802154_SERIALIZATION_ERROR_OK;
+}
+
+uint64_t nrf_802154_time_get(void)
+{
+    nrf_802154_ser_err_t res;
+    time_sync_ref_t      ref;
+    uint64_t             now;
+    uint64_t             elapsed;
+    uint64_t             time;
+    uint32_t             crit_sect;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+    ref = m_time_sync_ref;
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+    now = nrf_802154_serialization_local_time_get();
+
+    if (!ref.valid || (now - ref.local >= NRF_802154_SER_TIME_SYNC_REFRESH_PERIOD_US))
+    {
+        res = time_sync_refresh();
+        SERIALIZATION_ERROR_CHECK(res, error, bail);
+    }
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    ref     = m_time_sync_ref;
+    now     = nrf_802154_serialization_local_time_get();
+    elapsed = (now > ref.local) ? (now - ref.local) : 0U;
+    time    = ref.remote + elapsed +
+              (uint64_t)(((int64_t)elapsed * ref.drift) / TIME_SYNC_DRIFT_SCALE);
+
+    if (time < m_time_sync_last)
+    {
+        // The new reference point moved the estimate backwards
+        time = m_time_sync_last;
+    }
+
+    m_time_sync_last = time;
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+    return time;
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return 0UL;
+}
+
+#else // NRF_802154_SER_TIME_SYNC_ENABLED
+
+uint64_t nrf_802154_time_get(void)
+{
+    int32_t  res;
+    uint64_t time = 0UL;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    res = remote_time_get(&time);
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
 bail:
@@ -1720,6 +2510,8 @@ bail:
     return time;
 }
 
+#endif // NRF_802154_SER_TIME_SYNC_ENABLED
+
 void nrf_802154_cca_cfg_set(const nrf_802154_cca_cfg_t * p_cfg)
 {
     nrf_802154_ser_err_t res;
@@ -1732,16 +2524,22 @@ void nrf_802154_cca_cfg_set(const nrf_802154_cca_cfg_t * p_cfg)
     NRF_802154_SPINEL_LOG_VAR_NAMED("%u", p_cfg->corr_threshold, "Corr threshold");
     NRF_802154_SPINEL_LOG_VAR_NAMED("%u", p_cfg->corr_limit, "Corr limit");
 
-    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
+#if NRF_802154_SER_PIB_MIRROR_ENABLED
+    // Only the fields relevant to the mode are updated, so the result is requested on next get
+    pib_mirror_invalidate(PIB_MIRROR_CCA_CFG);
+#endif
 
-    res = nrf_802154_spinel_send_cmd_prop_value_set(
+    uint8_t tid = status_request_prepare();
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set_tid(
+        tid,
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CCA_CFG_SET,
         SPINEL_DATATYPE_NRF_802154_CCA_CFG_SET,
         NRF_802154_CCA_CFG_ENCODE(*p_cfg));
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
-    res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+    res = status_response_await(tid, CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
 bail:
@@ -1754,12 +2552,19 @@ void nrf_802154_cca_cfg_get(nrf_802154_cca_cfg_t * p_cfg)
 {
     nrf_802154_ser_err_t res;
 
+#if NRF_802154_SER_PIB_MIRROR_ENABLED
+    if (pib_mirror_is_valid(PIB_MIRROR_CCA_CFG))
+    {
+        *p_cfg = m_pib_mirror.cca_cfg;
+        return;
+    }
+#endif
+
     SERIALIZATION_ERROR_INIT(error);
 
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
 
-    nrf_802154_spinel_response_notifier_lock_before_request(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CCA_CFG_GET);
+    response_notifier_lock(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CCA_CFG_GET);
 
     res = nrf_802154_spinel_send_cmd_prop_value_set(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CCA_CFG_GET,
@@ -1771,6 +2576,11 @@ void nrf_802154_cca_cfg_get(nrf_802154_cca_cfg_t * p_cfg)
     res = cca_cfg_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT, p_cfg);
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
+#if NRF_802154_SER_PIB_MIRROR_ENABLED
+    m_pib_mirror.cca_cfg = *p_cfg;
+    pib_mirror_validate(PIB_MIRROR_CCA_CFG);
+#endif
+
 bail:
     SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
 }
@@ -1802,16 +2612,17 @@ void nrf_802154_security_global_frame_counter_set(uint32_t frame_counter)
 
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
 
-    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
+    uint8_t tid = status_request_prepare();
 
-    res = nrf_802154_spinel_send_cmd_prop_value_set(
+    res = nrf_802154_spinel_send_cmd_prop_value_set_tid(
+        tid,
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_GLOBAL_FRAME_COUNTER_SET,
         SPINEL_DATATYPE_NRF_802154_SECURITY_GLOBAL_FRAME_COUNTER_SET,
         frame_counter);
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
-    res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+    res = status_response_await(tid, CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
 bail:
@@ -1828,16 +2639,17 @@ void nrf_802154_security_global_frame_counter_set_if_larger(uint32_t frame_count
 
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
 
-    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
+    uint8_t tid = status_request_prepare();
 
-    res = nrf_802154_spinel_send_cmd_prop_value_set(
+    res = nrf_802154_spinel_send_cmd_prop_value_set_tid(
+        tid,
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_GLOBAL_FRAME_COUNTER_SET_IF_LARGER,
         SPINEL_DATATYPE_NRF_802154_SECURITY_GLOBAL_FRAME_COUNTER_SET,
         frame_counter);
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
-    res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+    res = status_response_await(tid, CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
 bail:
@@ -1855,8 +2667,7 @@ nrf_802154_security_error_t nrf_802154_security_key_store(nrf_802154_key_t * p_k
 
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
 
-    nrf_802154_spinel_response_notifier_lock_before_request(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_STORE);
+    response_notifier_lock(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_STORE);
 
     res = nrf_802154_spinel_send_cmd_prop_value_set(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_STORE,
@@ -1883,8 +2694,7 @@ nrf_802154_security_error_t nrf_802154_security_key_remove(nrf_802154_key_id_t *
 
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
 
-    nrf_802154_spinel_response_notifier_lock_before_request(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_REMOVE);
+    response_notifier_lock(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_REMOVE);
 
     res = nrf_802154_spinel_send_cmd_prop_value_set(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_REMOVE,
@@ -1910,16 +2720,17 @@ void nrf_802154_csl_writer_period_set(uint16_t period)
 
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
 
-    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
+    uint8_t tid = status_request_prepare();
 
-    res = nrf_802154_spinel_send_cmd_prop_value_set(
+    res = nrf_802154_spinel_send_cmd_prop_value_set_tid(
+        tid,
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSL_WRITER_PERIOD_SET,
         SPINEL_DATATYPE_NRF_802154_CSL_WRITER_PERIOD_SET,
         period);
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
-    res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+    res = status_response_await(tid, CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
 bail:
@@ -1936,16 +2747,17 @@ void nrf_802154_csl_writer_anchor_time_set(uint64_t anchor_time)
 
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
 
-    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
+    uint8_t tid = status_request_prepare();
 
-    res = nrf_802154_spinel_send_cmd_prop_value_set(
+    res = nrf_802154_spinel_send_cmd_prop_value_set_tid(
+        tid,
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSL_WRITER_ANCHOR_TIME_SET,
         SPINEL_DATATYPE_NRF_802154_CSL_WRITER_ANCHOR_TIME_SET,
         anchor_time);
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
-    res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+    res = status_response_await(tid, CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
 bail:
@@ -1962,8 +2774,7 @@ static nrf_802154_ser_err_t stat_timestamps_get_ret_await(uint32_t
 
     SERIALIZATION_ERROR_INIT(error);
 
-    p_notify_data = nrf_802154_spinel_response_notifier_property_await(
-        timeout);
+    p_notify_data = response_notifier_await(timeout);
 
     SERIALIZATION_ERROR_IF(p_notify_data == NULL,
                            NRF_802154_SERIALIZATION_ERROR_RESPONSE_TIMEOUT,
@@ -1996,8 +2807,7 @@ void nrf_802154_stat_timestamps_get(nrf_802154_stat_timestamps_t * p_stat_timest
 
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
 
-    nrf_802154_spinel_response_notifier_lock_before_request(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_STAT_TIMESTAMPS_GET);
+    response_notifier_lock(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_STAT_TIMESTAMPS_GET);
 
     res = nrf_802154_spinel_send_cmd_prop_value_set(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_STAT_TIMESTAMPS_GET,
@@ -2025,8 +2835,7 @@ nrf_802154_ifs_mode_t nrf_802154_ifs_mode_get(void)
 
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
 
-    nrf_802154_spinel_response_notifier_lock_before_request(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MODE_GET);
+    response_notifier_lock(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MODE_GET);
 
     res = nrf_802154_spinel_send_cmd_prop_value_set(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MODE_GET,
@@ -2055,8 +2864,7 @@ bool nrf_802154_ifs_mode_set(nrf_802154_ifs_mode_t mode)
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
     NRF_802154_SPINEL_LOG_VAR("%u", mode);
 
-    nrf_802154_spinel_response_notifier_lock_before_request(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MODE_SET);
+    response_notifier_lock(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MODE_SET);
 
     res = nrf_802154_spinel_send_cmd_prop_value_set(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MODE_SET,
@@ -2084,8 +2892,7 @@ uint16_t nrf_802154_ifs_min_sifs_period_get(void)
 
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
 
-    nrf_802154_spinel_response_notifier_lock_before_request(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MIN_SIFS_PERIOD_GET);
+    response_notifier_lock(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MIN_SIFS_PERIOD_GET);
 
     res = nrf_802154_spinel_send_cmd_prop_value_set(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MIN_SIFS_PERIOD_GET,
@@ -2112,16 +2919,17 @@ void nrf_802154_ifs_min_sifs_period_set(uint16_t period)
 
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
 
-    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
+    uint8_t tid = status_request_prepare();
 
-    res = nrf_802154_spinel_send_cmd_prop_value_set(
+    res = nrf_802154_spinel_send_cmd_prop_value_set_tid(
+        tid,
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MIN_SIFS_PERIOD_SET,
         SPINEL_DATATYPE_NRF_802154_IFS_MIN_SIFS_PERIOD_SET,
         period);
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
-    res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+    res = status_response_await(tid, CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
 bail:
@@ -2139,8 +2947,7 @@ uint16_t nrf_802154_ifs_min_lifs_period_get(void)
 
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
 
-    nrf_802154_spinel_response_notifier_lock_before_request(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MIN_LIFS_PERIOD_GET);
+    response_notifier_lock(SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MIN_LIFS_PERIOD_GET);
 
     res = nrf_802154_spinel_send_cmd_prop_value_set(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MIN_LIFS_PERIOD_GET,
@@ -2167,16 +2974,17 @@ void nrf_802154_ifs_min_lifs_period_set(uint16_t period)
 
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
 
-    nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
+    uint8_t tid = status_request_prepare();
 
-    res = nrf_802154_spinel_send_cmd_prop_value_set(
+    res = nrf_802154_spinel_send_cmd_prop_value_set_tid(
+        tid,
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MIN_LIFS_PERIOD_SET,
         SPINEL_DATATYPE_NRF_802154_IFS_MIN_LIFS_PERIOD_SET,
         period);
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
-    res = status_ok_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
+    res = status_response_await(tid, CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT);
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
 bail:
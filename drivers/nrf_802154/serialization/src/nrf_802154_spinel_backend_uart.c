@@ -0,0 +1,588 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @file nrf_802154_spinel_backend_uart.c
+ * @brief UART spinel backend with HDLC-lite framing.
+ *
+ * Each spinel frame is followed by its 16-bit HDLC frame check sequence and delimited with
+ * flag bytes. Flag and escape bytes within the frame are escaped as in RFC 1662.
+ *
+ * With @ref NRF_802154_SER_PRIORITY_LANES_ENABLED each frame is preceded by the number of its
+ * lane, covered by the frame check sequence. Frames waiting for the UARTE are kept in a queue
+ * per lane and the urgent queue is always served first, so an urgent frame waits at most for
+ * the frames already handed to the UARTE driver.
+ */
+
+#include "nrf_802154_serialization_config.h"
+
+#if NRF_802154_SER_BACKEND_UART_ENABLED
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <nrfx.h>
+#include <nrfx_uarte.h>
+
+#include "nrf_802154_serialization_crit_sect.h"
+#include "nrf_802154_serialization_error.h"
+#include "nrf_802154_spinel.h"
+#include "nrf_802154_spinel_backend.h"
+#include "nrf_802154_spinel_backend_callouts.h"
+#include "nrf_802154_spinel_backend_uart.h"
+
+#define HDLC_FLAG         0x7EU   ///< Byte delimiting frames.
+#define HDLC_ESCAPE       0x7DU   ///< Byte preceding an escaped byte.
+#define HDLC_ESCAPE_XOR   0x20U   ///< Value XORed with an escaped byte.
+#define HDLC_FCS_INIT     0xFFFFU ///< Initial value of the frame check sequence.
+#define HDLC_FCS_GOOD     0xF0B8U ///< Frame check sequence calculated over a frame and its FCS.
+#define HDLC_FCS_LEN      sizeof(uint16_t)
+
+#if NRF_802154_SER_PRIORITY_LANES_ENABLED
+#define LANE_TAG_LEN      1U      ///< Length of the lane number preceding each frame.
+
+/**
+ * @brief Number of frames handed to the UARTE driver at a time.
+ *
+ * One frame is transmitted while the next one waits armed, so that frames follow each other
+ * without a gap on the line.
+ */
+#define TX_IN_FLIGHT_MAX  2U
+#else
+#define LANE_TAG_LEN      0U
+#endif
+
+/** @brief Size of a transmit buffer holding a frame of the maximum size with all bytes escaped. */
+#define TX_BUFFER_SIZE    (2U * (NRF_802154_SPINEL_FRAME_BUFFER_SIZE + HDLC_FCS_LEN) + \
+                           LANE_TAG_LEN + 2U)
+
+/** @brief Size of a buffer holding a received frame with its lane number and FCS. */
+#define RX_FRAME_SIZE     (LANE_TAG_LEN + NRF_802154_SPINEL_FRAME_BUFFER_SIZE + HDLC_FCS_LEN)
+
+#define RX_RING_SIZE      (NRF_802154_SER_BACKEND_UART_RX_CHUNK_SIZE * \
+                           NRF_802154_SER_BACKEND_UART_RX_CHUNK_COUNT)
+
+NRFX_STATIC_ASSERT(NRF_802154_SER_BACKEND_UART_TX_BUFFERS <= 32);
+NRFX_STATIC_ASSERT(NRF_802154_SER_BACKEND_UART_RX_CHUNK_COUNT >= 3);
+
+/** @brief Lookup table of the HDLC frame check sequence, polynomial 0x8408. */
+static const uint16_t m_fcs_table[256] =
+{
+    0x0000U, 0x1189U, 0x2312U, 0x329BU, 0x4624U, 0x57ADU, 0x6536U, 0x74BFU,
+    0x8C48U, 0x9DC1U, 0xAF5AU, 0xBED3U, 0xCA6CU, 0xDBE5U, 0xE97EU, 0xF8F7U,
+    0x1081U, 0x0108U, 0x3393U, 0x221AU, 0x56A5U, 0x472CU, 0x75B7U, 0x643EU,
+    0x9CC9U, 0x8D40U, 0xBFDBU, 0xAE52U, 0xDAEDU, 0xCB64U, 0xF9FFU, 0xE876U,
+    0x2102U, 0x308BU, 0x0210U, 0x1399U, 0x6726U, 0x76AFU, 0x4434U, 0x55BDU,
+    0xAD4AU, 0xBCC3U, 0x8E58U, 0x9FD1U, 0xEB6EU, 0xFAE7U, 0xC87CU, 0xD9F5U,
+    0x3183U, 0x200AU, 0x1291U, 0x0318U, 0x77A7U, 0x662EU, 0x54B5U, 0x453CU,
+    0xBDCBU, 0xAC42U, 0x9ED9U, 0x8F50U, 0xFBEFU, 0xEA66U, 0xD8FDU, 0xC974U,
+    0x4204U, 0x538DU, 0x6116U, 0x709FU, 0x0420U, 0x15A9U, 0x2732U, 0x36BBU,
+    0xCE4CU, 0xDFC5U, 0xED5EU, 0xFCD7U, 0x8868U, 0x99E1U, 0xAB7AU, 0xBAF3U,
+    0x5285U, 0x430CU, 0x7197U, 0x601EU, 0x14A1U, 0x0528U, 0x37B3U, 0x263AU,
+    0xDECDU, 0xCF44U, 0xFDDFU, 0xEC56U, 0x98E9U, 0x8960U, 0xBBFBU, 0xAA72U,
+    0x6306U, 0x728FU, 0x4014U, 0x519DU, 0x2522U, 0x34ABU, 0x0630U, 0x17B9U,
+    0xEF4EU, 0xFEC7U, 0xCC5CU, 0xDDD5U, 0xA96AU, 0xB8E3U, 0x8A78U, 0x9BF1U,
+    0x7387U, 0x620EU, 0x5095U, 0x411CU, 0x35A3U, 0x242AU, 0x16B1U, 0x0738U,
+    0xFFCFU, 0xEE46U, 0xDCDDU, 0xCD54U, 0xB9EBU, 0xA862U, 0x9AF9U, 0x8B70U,
+    0x8408U, 0x9581U, 0xA71AU, 0xB693U, 0xC22CU, 0xD3A5U, 0xE13EU, 0xF0B7U,
+    0x0840U, 0x19C9U, 0x2B52U, 0x3ADBU, 0x4E64U, 0x5FEDU, 0x6D76U, 0x7CFFU,
+    0x9489U, 0x8500U, 0xB79BU, 0xA612U, 0xD2ADU, 0xC324U, 0xF1BFU, 0xE036U,
+    0x18C1U, 0x0948U, 0x3BD3U, 0x2A5AU, 0x5EE5U, 0x4F6CU, 0x7DF7U, 0x6C7EU,
+    0xA50AU, 0xB483U, 0x8618U, 0x9791U, 0xE32EU, 0xF2A7U, 0xC03CU, 0xD1B5U,
+    0x2942U, 0x38CBU, 0x0A50U, 0x1BD9U, 0x6F66U, 0x7EEFU, 0x4C74U, 0x5DFDU,
+    0xB58BU, 0xA402U, 0x9699U, 0x8710U, 0xF3AFU, 0xE226U, 0xD0BDU, 0xC134U,
+    0x39C3U, 0x284AU, 0x1AD1U, 0x0B58U, 0x7FE7U, 0x6E6EU, 0x5CF5U, 0x4D7CU,
+    0xC60CU, 0xD785U, 0xE51EU, 0xF497U, 0x8028U, 0x91A1U, 0xA33AU, 0xB2B3U,
+    0x4A44U, 0x5BCDU, 0x6956U, 0x78DFU, 0x0C60U, 0x1DE9U, 0x2F72U, 0x3EFBU,
+    0xD68DU, 0xC704U, 0xF59FU, 0xE416U, 0x90A9U, 0x8120U, 0xB3BBU, 0xA232U,
+    0x5AC5U, 0x4B4CU, 0x79D7U, 0x685EU, 0x1CE1U, 0x0D68U, 0x3FF3U, 0x2E7AU,
+    0xE70EU, 0xF687U, 0xC41CU, 0xD595U, 0xA12AU, 0xB0A3U, 0x8238U, 0x93B1U,
+    0x6B46U, 0x7ACFU, 0x4854U, 0x59DDU, 0x2D62U, 0x3CEBU, 0x0E70U, 0x1FF9U,
+    0xF78FU, 0xE606U, 0xD49DU, 0xC514U, 0xB1ABU, 0xA022U, 0x92B9U, 0x8330U,
+    0x7BC7U, 0x6A4EU, 0x58D5U, 0x495CU, 0x3DE3U, 0x2C6AU, 0x1EF1U, 0x0F78U,
+};
+
+/** @brief Hardware resources used by the backend. */
+static nrf_802154_spinel_backend_uart_config_t m_config;
+
+/** @brief Transmit buffers. */
+static uint8_t m_tx_buffers[NRF_802154_SER_BACKEND_UART_TX_BUFFERS][TX_BUFFER_SIZE];
+
+/** @brief Bitmask of the transmit buffers being transmitted. */
+static uint32_t m_tx_buffers_busy;
+
+#if NRF_802154_SER_PRIORITY_LANES_ENABLED
+
+/** @brief Queue of the transmit buffers of a lane waiting to be handed to the UARTE driver. */
+typedef struct
+{
+    uint8_t idx[NRF_802154_SER_BACKEND_UART_TX_BUFFERS]; ///< Indexes of the queued buffers.
+    uint8_t head;                                        ///< Position of the oldest buffer.
+    uint8_t count;                                       ///< Number of queued buffers.
+} tx_lane_queue_t;
+
+/** @brief Queues of the transmit buffers, indexed by @ref nrf_802154_spinel_lane_t. */
+static tx_lane_queue_t m_tx_lane_queues[NRF_802154_SPINEL_LANE_COUNT];
+
+/** @brief Lengths of the frames encoded into the transmit buffers. */
+static size_t m_tx_lengths[NRF_802154_SER_BACKEND_UART_TX_BUFFERS];
+
+/** @brief Number of transmit buffers handed to the UARTE driver. */
+static uint8_t m_tx_in_flight;
+
+#endif // NRF_802154_SER_PRIORITY_LANES_ENABLED
+
+/** @brief Reception ring filled by EasyDMA. */
+static uint8_t m_rx_ring[RX_RING_SIZE];
+
+/** @brief Frame being received. */
+static uint8_t m_rx_frame[RX_FRAME_SIZE];
+
+/** @brief Number of bytes stored in @ref m_rx_frame. */
+static size_t m_rx_frame_len;
+
+/** @brief Frame check sequence of the bytes stored in @ref m_rx_frame. */
+static uint16_t m_rx_fcs;
+
+/** @brief Indicates that the previous received byte was @ref HDLC_ESCAPE. */
+static bool m_rx_escaped;
+
+/** @brief Indicates that the frame being received is dropped until the next flag. */
+static bool m_rx_dropped;
+
+#if !NRF_802154_SER_PRIORITY_LANES_ENABLED
+
+/** @brief Returns a transmit buffer to the pool. */
+static void tx_buffer_free(uint32_t idx)
+{
+    uint32_t critical_section;
+
+    nrf_802154_serialization_crit_sect_enter(&critical_section);
+    m_tx_buffers_busy &= ~(1UL << idx);
+    nrf_802154_serialization_crit_sect_exit(critical_section);
+}
+
+#endif // !NRF_802154_SER_PRIORITY_LANES_ENABLED
+
+/**
+ * @brief Reserves a transmit buffer from the pool.
+ *
+ * @param[out] p_idx  Index of the reserved buffer.
+ *
+ * @retval true   A buffer was reserved.
+ * @retval false  All the buffers are in use.
+ */
+static bool tx_buffer_alloc(uint32_t * p_idx)
+{
+    uint32_t critical_section;
+    uint32_t idx;
+
+    nrf_802154_serialization_crit_sect_enter(&critical_section);
+
+    for (idx = 0U; idx < NRF_802154_SER_BACKEND_UART_TX_BUFFERS; idx++)
+    {
+        if ((m_tx_buffers_busy & (1UL << idx)) == 0U)
+        {
+            m_tx_buffers_busy |= 1UL << idx;
+            break;
+        }
+    }
+
+    nrf_802154_serialization_crit_sect_exit(critical_section);
+
+    *p_idx = idx;
+
+    return idx < NRF_802154_SER_BACKEND_UART_TX_BUFFERS;
+}
+
+#if NRF_802154_SER_PRIORITY_LANES_ENABLED
+
+/**
+ * @brief Hands the queued transmit buffers to the UARTE driver, the urgent lane first.
+ *
+ * Must be called within the serialization critical section.
+ */
+static void tx_lanes_kick(void)
+{
+    while (m_tx_in_flight < TX_IN_FLIGHT_MAX)
+    {
+        tx_lane_queue_t * p_queue = &m_tx_lane_queues[NRF_802154_SPINEL_LANE_URGENT];
+
+        if (p_queue->count == 0U)
+        {
+            p_queue = &m_tx_lane_queues[NRF_802154_SPINEL_LANE_BULK];
+        }
+
+        if (p_queue->count == 0U)
+        {
+            break;
+        }
+
+        uint32_t idx = p_queue->idx[p_queue->head];
+
+        p_queue->head = (uint8_t)((p_queue->head + 1U) % NRF_802154_SER_BACKEND_UART_TX_BUFFERS);
+        p_queue->count--;
+
+        if (nrfx_uarte_tx_queue(&m_config.uarte, m_tx_buffers[idx],
+                                m_tx_lengths[idx]) == NRFX_SUCCESS)
+        {
+            m_tx_in_flight++;
+        }
+        else
+        {
+            // The frame has already been reported as sent, so it can only be dropped
+            m_tx_buffers_busy &= ~(1UL << idx);
+        }
+    }
+}
+
+/** @brief Returns a transmitted buffer to the pool and hands the next queued one to the UARTE. */
+static void tx_done(uint32_t idx)
+{
+    uint32_t critical_section;
+
+    nrf_802154_serialization_crit_sect_enter(&critical_section);
+    m_tx_buffers_busy &= ~(1UL << idx);
+    m_tx_in_flight--;
+    tx_lanes_kick();
+    nrf_802154_serialization_crit_sect_exit(critical_section);
+}
+
+#endif // NRF_802154_SER_PRIORITY_LANES_ENABLED
+
+/** @brief Updates the frame check sequence with a byte. */
+static inline uint16_t fcs_update(uint16_t fcs, uint8_t byte)
+{
+    return (uint16_t)((fcs >> 8) ^ m_fcs_table[(fcs ^ byte) & 0xFFU]);
+}
+
+/** @brief Writes a byte escaping it if needed. */
+static inline uint8_t * hdlc_byte_put(uint8_t * p_out, uint8_t byte)
+{
+    if ((byte == HDLC_FLAG) || (byte == HDLC_ESCAPE))
+    {
+        *p_out++ = HDLC_ESCAPE;
+        byte    ^= HDLC_ESCAPE_XOR;
+    }
+
+    *p_out++ = byte;
+
+    return p_out;
+}
+
+/**
+ * @brief Writes a frame with HDLC-lite framing.
+ *
+ * @param[out] p_out     Pointer to a buffer of at least @ref TX_BUFFER_SIZE bytes.
+ * @param[in]  lane      Lane of the frame.
+ * @param[in]  p_data    Pointer to the frame.
+ * @param[in]  data_len  Length of the frame.
+ *
+ * @returns  Number of bytes written.
+ */
+static size_t hdlc_encode(uint8_t                * p_out,
+                          nrf_802154_spinel_lane_t lane,
+                          const uint8_t          * p_data,
+                          size_t                   data_len)
+{
+    uint8_t * p_pos = p_out;
+    uint16_t  fcs   = HDLC_FCS_INIT;
+
+    *p_pos++ = HDLC_FLAG;
+
+#if NRF_802154_SER_PRIORITY_LANES_ENABLED
+    fcs   = fcs_update(fcs, (uint8_t)lane);
+    p_pos = hdlc_byte_put(p_pos, (uint8_t)lane);
+#else
+    (void)lane;
+#endif
+
+    for (size_t i = 0U; i < data_len; i++)
+    {
+        fcs   = fcs_update(fcs, p_data[i]);
+        p_pos = hdlc_byte_put(p_pos, p_data[i]);
+    }
+
+    fcs   = (uint16_t)~fcs;
+    p_pos = hdlc_byte_put(p_pos, (uint8_t)fcs);
+    p_pos = hdlc_byte_put(p_pos, (uint8_t)(fcs >> 8));
+
+    *p_pos++ = HDLC_FLAG;
+
+    return (size_t)(p_pos - p_out);
+}
+
+/** @brief Starts reception of a new frame. */
+static void rx_frame_reset(void)
+{
+    m_rx_frame_len = 0U;
+    m_rx_fcs       = HDLC_FCS_INIT;
+    m_rx_escaped   = false;
+    m_rx_dropped   = false;
+}
+
+/** @brief Passes on the received frame if it is complete and valid. */
+static void rx_frame_end(void)
+{
+    if (!m_rx_dropped && (m_rx_frame_len > LANE_TAG_LEN + HDLC_FCS_LEN) &&
+        (m_rx_fcs == HDLC_FCS_GOOD))
+    {
+#if NRF_802154_SER_PRIORITY_LANES_ENABLED
+        if (m_rx_frame[0] < NRF_802154_SPINEL_LANE_COUNT)
+        {
+            nrf_802154_spinel_encoded_packet_lane_received(
+                (nrf_802154_spinel_lane_t)m_rx_frame[0],
+                &m_rx_frame[LANE_TAG_LEN],
+                m_rx_frame_len - LANE_TAG_LEN - HDLC_FCS_LEN);
+        }
+#else
+        nrf_802154_spinel_encoded_packet_received(m_rx_frame, m_rx_frame_len - HDLC_FCS_LEN);
+#endif
+    }
+
+    rx_frame_reset();
+}
+
+/** @brief Feeds received bytes to the deframer. */
+static void rx_data_process(const uint8_t * p_data, size_t data_len)
+{
+    for (size_t i = 0U; i < data_len; i++)
+    {
+        uint8_t byte = p_data[i];
+
+        if (byte == HDLC_FLAG)
+        {
+            rx_frame_end();
+            continue;
+        }
+
+        if (m_rx_dropped)
+        {
+            continue;
+        }
+
+        if (byte == HDLC_ESCAPE)
+        {
+            m_rx_escaped = true;
+            continue;
+        }
+
+        if (m_rx_escaped)
+        {
+            byte        ^= HDLC_ESCAPE_XOR;
+            m_rx_escaped = false;
+        }
+
+        if (m_rx_frame_len == RX_FRAME_SIZE)
+        {
+            // Too long to be a valid frame, wait for the next flag
+            m_rx_dropped = true;
+            continue;
+        }
+
+        m_rx_frame[m_rx_frame_len++] = byte;
+        m_rx_fcs                     = fcs_update(m_rx_fcs, byte);
+    }
+}
+
+static void uarte_event_handler(nrfx_uarte_event_t const * p_event, void * p_context)
+{
+    (void)p_context;
+
+    switch (p_event->type)
+    {
+        case NRFX_UARTE_EVT_RX_DATA:
+            rx_data_process(p_event->data.rxtx.p_data, p_event->data.rxtx.bytes);
+            break;
+
+        case NRFX_UARTE_EVT_TX_DONE:
+        {
+            uint32_t idx = (uint32_t)((size_t)(p_event->data.rxtx.p_data - &m_tx_buffers[0][0]) /
+                                      TX_BUFFER_SIZE);
+
+#if NRF_802154_SER_PRIORITY_LANES_ENABLED
+            tx_done(idx);
+#else
+            tx_buffer_free(idx);
+#endif
+            break;
+        }
+
+        case NRFX_UARTE_EVT_ERROR:
+            // Bytes of the frame being received were lost or corrupted
+            m_rx_dropped = true;
+            break;
+
+        default:
+            break;
+    }
+}
+
+nrf_802154_ser_err_t nrf_802154_backend_init(void)
+{
+    nrf_802154_spinel_backend_uart_config_get(&m_config);
+
+    m_config.uarte_config.p_context = NULL;
+    m_tx_buffers_busy               = 0U;
+#if NRF_802154_SER_PRIORITY_LANES_ENABLED
+    m_tx_in_flight = 0U;
+
+    for (uint32_t lane = 0U; lane < NRF_802154_SPINEL_LANE_COUNT; lane++)
+    {
+        m_tx_lane_queues[lane].head  = 0U;
+        m_tx_lane_queues[lane].count = 0U;
+    }
+#endif
+    rx_frame_reset();
+
+    if (nrfx_uarte_init(&m_config.uarte, &m_config.uarte_config,
+                        uarte_event_handler) != NRFX_SUCCESS)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_INIT_FAILED;
+    }
+
+    nrfx_uarte_rx_stream_config_t stream_config =
+    {
+        .p_buffer    = m_rx_ring,
+        .chunk_size  = NRF_802154_SER_BACKEND_UART_RX_CHUNK_SIZE,
+        .chunk_count = NRF_802154_SER_BACKEND_UART_RX_CHUNK_COUNT,
+        .p_counter   = m_config.p_counter,
+        .ppi_channel = m_config.ppi_channel,
+    };
+
+    if (nrfx_uarte_rx_stream_start(&m_config.uarte, &stream_config) != NRFX_SUCCESS)
+    {
+        nrfx_uarte_uninit(&m_config.uarte);
+        return NRF_802154_SERIALIZATION_ERROR_INIT_FAILED;
+    }
+
+    return NRF_802154_SERIALIZATION_ERROR_OK;
+}
+
+#if NRF_802154_SER_PRIORITY_LANES_ENABLED
+
+nrf_802154_ser_err_t nrf_802154_spinel_encoded_packet_lane_send(nrf_802154_spinel_lane_t lane,
+                                                                const void             * p_data,
+                                                                size_t                   data_len)
+{
+    uint32_t critical_section;
+    uint32_t idx;
+
+    if ((data_len > NRF_802154_SPINEL_FRAME_BUFFER_SIZE) || (lane >= NRF_802154_SPINEL_LANE_COUNT))
+    {
+        return NRF_802154_SERIALIZATION_ERROR_BACKEND_FAILURE;
+    }
+
+    if (!tx_buffer_alloc(&idx))
+    {
+        // The link is congested, the caller decides whether to retry or to drop the frame
+        return NRF_802154_SERIALIZATION_ERROR_NO_MEMORY;
+    }
+
+    // The buffer is owned by this call, so the frame is encoded outside of the critical section
+    m_tx_lengths[idx] = hdlc_encode(m_tx_buffers[idx], lane, (const uint8_t *)p_data, data_len);
+
+    nrf_802154_serialization_crit_sect_enter(&critical_section);
+
+    tx_lane_queue_t * p_queue = &m_tx_lane_queues[lane];
+
+    // A queue holds at most all the buffers, so it cannot overflow
+    p_queue->idx[(p_queue->head + p_queue->count) % NRF_802154_SER_BACKEND_UART_TX_BUFFERS] =
+        (uint8_t)idx;
+    p_queue->count++;
+
+    tx_lanes_kick();
+
+    nrf_802154_serialization_crit_sect_exit(critical_section);
+
+    return (nrf_802154_ser_err_t)data_len;
+}
+
+nrf_802154_ser_err_t nrf_802154_spinel_encoded_packet_send(const void * p_data,
+                                                           size_t       data_len)
+{
+    return nrf_802154_spinel_encoded_packet_lane_send(NRF_802154_SPINEL_LANE_BULK,
+                                                      p_data,
+                                                      data_len);
+}
+
+#else // NRF_802154_SER_PRIORITY_LANES_ENABLED
+
+nrf_802154_ser_err_t nrf_802154_spinel_encoded_packet_send(const void * p_data,
+                                                           size_t       data_len)
+{
+    uint32_t   critical_section;
+    uint32_t   idx;
+    size_t     frame_len;
+    nrfx_err_t err;
+
+    if (data_len > NRF_802154_SPINEL_FRAME_BUFFER_SIZE)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_BACKEND_FAILURE;
+    }
+
+    if (!tx_buffer_alloc(&idx))
+    {
+        // The link is congested, the caller decides whether to retry or to drop the frame
+        return NRF_802154_SERIALIZATION_ERROR_NO_MEMORY;
+    }
+
+    // The buffer is owned by this call, so the frame is encoded outside of the critical section
+    frame_len = hdlc_encode(m_tx_buffers[idx],
+                            NRF_802154_SPINEL_LANE_BULK,
+                            (const uint8_t *)p_data,
+                            data_len);
+
+    nrf_802154_serialization_crit_sect_enter(&critical_section);
+    err = nrfx_uarte_tx_queue(&m_config.uarte, m_tx_buffers[idx], frame_len);
+    nrf_802154_serialization_crit_sect_exit(critical_section);
+
+    if (err != NRFX_SUCCESS)
+    {
+        tx_buffer_free(idx);
+
+        return (err == NRFX_ERROR_NO_MEM) ? NRF_802154_SERIALIZATION_ERROR_NO_MEMORY :
+               NRF_802154_SERIALIZATION_ERROR_BACKEND_FAILURE;
+    }
+
+    return (nrf_802154_ser_err_t)data_len;
+}
+
+#endif // NRF_802154_SER_PRIORITY_LANES_ENABLED
+
+void nrf_802154_spinel_backend_uart_poll(void)
+{
+    nrfx_uarte_rx_stream_poll(&m_config.uarte);
+}
+
+#endif // NRF_802154_SER_BACKEND_UART_ENABLED
@@ -0,0 +1,534 @@
+/*
+ * Copyright (c) 2020 - 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/**
+ * @file nrf_802154_spinel_codec.c
+ * @brief Precompiled encoders and decoders of frequently used spinel commands.
+ */
+
+#include "nrf_802154_spinel_codec.h"
+
+#include <string.h>
+
+#include "nrf_802154_spinel_datatypes.h"
+
+#define HEADER_LEN            sizeof(uint8_t)  ///< Length of spinel header.
+#define CMD_MAX_LEN           3U               ///< Maximum length of a packed command or property key.
+#define HDATA_HANDLE_LEN      sizeof(uint32_t) ///< Length of the handle in HDATA.
+#define STRUCT_PREFIX_LEN     sizeof(uint16_t) ///< Length of the struct length prefix.
+#define MAX_PACK_LENGTH       32767U           ///< Same limit as applied by spinel_datatype_unpack.
+#define VARINT_MAX_LEN        10U              ///< Maximum length of a 64-bit varint.
+#define HANDLE_VARINT_MAX_LEN 5U               ///< Maximum length of a 32-bit varint.
+
+/** @brief Maximum length of the compact property data excluding the frame content. */
+#define COMPACT_FIXED_MAX_LEN                                                     \
+    (sizeof(uint8_t) + HANDLE_VARINT_MAX_LEN + sizeof(int8_t) + sizeof(uint8_t) + \
+     VARINT_MAX_LEN)
+
+/** @brief Writes a 16-bit value in little endian byte order. */
+static inline uint8_t * u16_put(uint8_t * p_out, uint16_t value)
+{
+    p_out[0] = (uint8_t)value;
+    p_out[1] = (uint8_t)(value >> 8);
+
+    return p_out + sizeof(uint16_t);
+}
+
+/** @brief Writes a 32-bit value in little endian byte order. */
+static inline uint8_t * u32_put(uint8_t * p_out, uint32_t value)
+{
+    p_out = u16_put(p_out, (uint16_t)value);
+
+    return u16_put(p_out, (uint16_t)(value >> 16));
+}
+
+/** @brief Writes a 64-bit value in little endian byte order. */
+static inline uint8_t * u64_put(uint8_t * p_out, uint64_t value)
+{
+    p_out = u32_put(p_out, (uint32_t)value);
+
+    return u32_put(p_out, (uint32_t)(value >> 32));
+}
+
+/** @brief Reads a 16-bit value stored in little endian byte order. */
+static inline uint16_t u16_get(const uint8_t * p_in)
+{
+    return (uint16_t)p_in[0] | (uint16_t)((uint16_t)p_in[1] << 8);
+}
+
+/** @brief Reads a 32-bit value stored in little endian byte order. */
+static inline uint32_t u32_get(const uint8_t * p_in)
+{
+    return (uint32_t)u16_get(p_in) | ((uint32_t)u16_get(p_in + 2) << 16);
+}
+
+/** @brief Reads a 64-bit value stored in little endian byte order. */
+static inline uint64_t u64_get(const uint8_t * p_in)
+{
+    return (uint64_t)u32_get(p_in) | ((uint64_t)u32_get(p_in + 4) << 32);
+}
+
+/** @brief Writes a little endian base 128 varint. */
+static uint8_t * varint_put(uint8_t * p_out, uint64_t value)
+{
+    while (value >= 0x80U)
+    {
+        *p_out++ = (uint8_t)(value | 0x80U);
+        value  >>= 7;
+    }
+
+    *p_out++ = (uint8_t)value;
+
+    return p_out;
+}
+
+/**
+ * @brief Reads a little endian base 128 varint.
+ *
+ * @param[in]  p_in    Pointer to a buffer to decode.
+ * @param[in]  in_len  Size of the @p p_in buffer.
+ * @param[out] p_value Decoded value.
+ *
+ * @returns  number of bytes decoded or 0 on failure.
+ */
+static size_t varint_get(const uint8_t * p_in, size_t in_len, uint64_t * p_value)
+{
+    uint64_t value = 0U;
+
+    for (size_t i = 0U; (i < in_len) && (i < VARINT_MAX_LEN); i++)
+    {
+        value |= (uint64_t)(p_in[i] & 0x7FU) << (7U * i);
+
+        if ((p_in[i] & 0x80U) == 0U)
+        {
+            *p_value = value;
+            return i + 1U;
+        }
+    }
+
+    return 0U;
+}
+
+/** @brief Maps a signed difference onto an unsigned value, so that small magnitudes are short. */
+static inline uint64_t zigzag_encode(int64_t value)
+{
+    return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+}
+
+/** @brief Inverse of @ref zigzag_encode. */
+static inline int64_t zigzag_decode(uint64_t value)
+{
+    return (int64_t)(value >> 1) ^ -(int64_t)(value & 1U);
+}
+
+/**
+ * @brief Writes the header, command and property key of a property command.
+ *
+ * @param[out] p_out     Pointer to a buffer of at least
+ *                       (@ref HEADER_LEN + 2 * @ref CMD_MAX_LEN) bytes.
+ * @param[in]  cmd       Spinel command.
+ * @param[in]  property  Spinel property key.
+ *
+ * @returns  Pointer to the first byte following the encoded fields.
+ */
+static uint8_t * cmd_prop_header_put(uint8_t * p_out, spinel_command_t cmd,
+                                     spinel_prop_key_t property)
+{
+    *p_out++ = SPINEL_HEADER_FLAG;
+    p_out   += spinel_packed_uint_encode(p_out, CMD_MAX_LEN, cmd);
+    p_out   += spinel_packed_uint_encode(p_out, CMD_MAX_LEN, property);
+
+    return p_out;
+}
+
+/**
+ * @brief Decodes a packed unsigned integer followed by a trailing data block.
+ *
+ * @param[in]  p_data      Pointer to a buffer to decode.
+ * @param[in]  data_len    Size of the @p p_data buffer.
+ * @param[out] p_value     Decoded packed unsigned integer.
+ * @param[out] pp_rest     Pointer to the trailing data.
+ * @param[out] p_rest_len  Length of the trailing data.
+ *
+ * @returns  number of bytes decoded or negative value on failure.
+ */
+static spinel_ssize_t packed_uint_and_data_decode(const uint8_t * p_data,
+                                                  size_t          data_len,
+                                                  uint32_t      * p_value,
+                                                  const void   ** pp_rest,
+                                                  size_t        * p_rest_len)
+{
+    unsigned int   value;
+    spinel_ssize_t pui_len;
+
+    if ((data_len == 0U) || (data_len > MAX_PACK_LENGTH))
+    {
+        return -1;
+    }
+
+    pui_len = spinel_packed_uint_decode(p_data, (spinel_size_t)data_len, &value);
+
+    if ((pui_len <= 0) || ((size_t)pui_len > data_len) || (value >= SPINEL_MAX_UINT_PACKED))
+    {
+        return -1;
+    }
+
+    *p_value    = value;
+    *pp_rest    = p_data + pui_len;
+    *p_rest_len = data_len - (size_t)pui_len;
+
+    return (spinel_ssize_t)data_len;
+}
+
+spinel_ssize_t nrf_802154_spinel_codec_cmd_decode(const void       * p_data,
+                                                  size_t             data_len,
+                                                  spinel_command_t * p_cmd,
+                                                  const void      ** pp_cmd_data,
+                                                  size_t           * p_cmd_data_len)
+{
+    const uint8_t * p_bytes = (const uint8_t *)p_data;
+
+    if ((data_len < HEADER_LEN) || (data_len > MAX_PACK_LENGTH))
+    {
+        return -1;
+    }
+
+    /* The header byte is not used by the 802.15.4 serialization */
+    if (packed_uint_and_data_decode(p_bytes + HEADER_LEN,
+                                    data_len - HEADER_LEN,
+                                    p_cmd,
+                                    pp_cmd_data,
+                                    p_cmd_data_len) < 0)
+    {
+        return -1;
+    }
+
+    return (spinel_ssize_t)data_len;
+}
+
+spinel_ssize_t nrf_802154_spinel_codec_prop_decode(const void        * p_cmd_data,
+                                                   size_t              cmd_data_len,
+                                                   spinel_prop_key_t * p_property,
+                                                   const void       ** pp_property_data,
+                                                   size_t            * p_property_data_len)
+{
+    return packed_uint_and_data_decode((const uint8_t *)p_cmd_data,
+                                       cmd_data_len,
+                                       p_property,
+                                       pp_property_data,
+                                       p_property_data_len);
+}
+
+/** @brief Calculates length of encoded property data of a received frame. */
+static size_t received_timestamp_raw_body_len(
+    const nrf_802154_spinel_received_timestamp_raw_args_t * p_rx)
+{
+    return STRUCT_PREFIX_LEN + HDATA_HANDLE_LEN + p_rx->hdata_len + sizeof(int8_t) +
+           sizeof(uint8_t) + sizeof(uint64_t);
+}
+
+/**
+ * @brief Writes property data of a received frame.
+ *
+ * @param[out] p_out  Pointer to a buffer of at least @ref received_timestamp_raw_body_len bytes.
+ * @param[in]  p_rx   Received frame to encode.
+ *
+ * @returns  Pointer to the first byte following the encoded property data.
+ */
+static uint8_t * received_timestamp_raw_body_put(
+    uint8_t                                               * p_out,
+    const nrf_802154_spinel_received_timestamp_raw_args_t * p_rx)
+{
+    p_out    = u16_put(p_out, (uint16_t)(HDATA_HANDLE_LEN + p_rx->hdata_len));
+    p_out    = u32_put(p_out, p_rx->frame_handle);
+    memcpy(p_out, p_rx->p_frame, p_rx->hdata_len);
+    p_out   += p_rx->hdata_len;
+    *p_out++ = (uint8_t)p_rx->power;
+    *p_out++ = p_rx->lqi;
+
+    return u64_put(p_out, p_rx->timestamp);
+}
+
+spinel_ssize_t nrf_802154_spinel_codec_received_timestamp_raw_encode(uint8_t    * p_out,
+                                                                     size_t       out_len,
+                                                                     const void * p_args)
+{
+    const nrf_802154_spinel_received_timestamp_raw_args_t * p_rx = p_args;
+
+    uint8_t * p_pos = p_out;
+
+    /* Upper bound check, the packed command and property key may take less space */
+    if (((HEADER_LEN + 2U * CMD_MAX_LEN + received_timestamp_raw_body_len(p_rx)) > out_len) ||
+        ((HDATA_HANDLE_LEN + p_rx->hdata_len) > UINT16_MAX))
+    {
+        return -1;
+    }
+
+    p_pos = cmd_prop_header_put(p_pos,
+                                SPINEL_CMD_PROP_VALUE_IS,
+                                SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW);
+    p_pos = received_timestamp_raw_body_put(p_pos, p_rx);
+
+    return (spinel_ssize_t)(p_pos - p_out);
+}
+
+spinel_ssize_t nrf_802154_spinel_codec_received_timestamp_raw_batch_encode(uint8_t    * p_out,
+                                                                           size_t       out_len,
+                                                                           const void * p_args)
+{
+    const nrf_802154_spinel_received_timestamp_raw_batch_args_t * p_batch = p_args;
+
+    uint8_t * p_pos     = p_out;
+    uint8_t * p_count   = NULL;
+    size_t    remaining = out_len;
+    size_t    count     = 0U;
+
+    if (remaining < (HEADER_LEN + 2U * CMD_MAX_LEN + sizeof(uint8_t)))
+    {
+        return -1;
+    }
+
+    p_pos = cmd_prop_header_put(p_pos,
+                                SPINEL_CMD_PROP_VALUE_IS,
+                                SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW_BATCH);
+    p_count    = p_pos++;
+    remaining -= (size_t)(p_pos - p_out);
+
+    while ((count < p_batch->count) && (count < UINT8_MAX))
+    {
+        const nrf_802154_spinel_received_timestamp_raw_args_t * p_rx = &p_batch->p_frames[count];
+
+        size_t body_len = received_timestamp_raw_body_len(p_rx);
+
+        if ((body_len > remaining) || ((HDATA_HANDLE_LEN + p_rx->hdata_len) > UINT16_MAX))
+        {
+            break;
+        }
+
+        p_pos      = received_timestamp_raw_body_put(p_pos, p_rx);
+        remaining -= body_len;
+        count++;
+    }
+
+    if (count == 0U)
+    {
+        return -1;
+    }
+
+    *p_count                  = (uint8_t)count;
+    *p_batch->p_encoded_count = count;
+
+    return (spinel_ssize_t)(p_pos - p_out);
+}
+
+spinel_ssize_t nrf_802154_spinel_codec_received_timestamp_raw_decode(
+    const void                                      * p_property_data,
+    size_t                                            property_data_len,
+    nrf_802154_spinel_received_timestamp_raw_args_t * p_args)
+{
+    const uint8_t * p_pos = (const uint8_t *)p_property_data;
+    size_t          struct_len;
+    size_t          total_len;
+
+    if (property_data_len < STRUCT_PREFIX_LEN)
+    {
+        return -1;
+    }
+
+    struct_len = u16_get(p_pos);
+    total_len  = STRUCT_PREFIX_LEN + struct_len + sizeof(int8_t) + sizeof(uint8_t) +
+                 sizeof(uint64_t);
+
+    if ((struct_len < HDATA_HANDLE_LEN) || (struct_len >= SPINEL_FRAME_MAX_SIZE) ||
+        (total_len > property_data_len))
+    {
+        return -1;
+    }
+
+    p_pos += STRUCT_PREFIX_LEN;
+
+    p_args->frame_handle = u32_get(p_pos);
+    p_args->p_frame      = p_pos + HDATA_HANDLE_LEN;
+    p_args->hdata_len    = struct_len - HDATA_HANDLE_LEN;
+    p_pos               += struct_len;
+    p_args->power        = (int8_t)p_pos[0];
+    p_args->lqi          = p_pos[1];
+    p_args->timestamp    = u64_get(p_pos + 2);
+
+    return (spinel_ssize_t)total_len;
+}
+
+spinel_ssize_t nrf_802154_spinel_codec_received_timestamp_raw_compact_encode(
+    uint8_t    * p_out,
+    size_t       out_len,
+    const void * p_args)
+{
+    const nrf_802154_spinel_received_timestamp_raw_compact_args_t * p_compact = p_args;
+    const nrf_802154_spinel_received_timestamp_raw_args_t         * p_rx      = p_compact->p_rx;
+
+    uint8_t * p_pos      = p_out;
+    uint8_t   flags      = NRF_802154_SPINEL_COMPACT_FLAG_REFERENCE_RESET;
+    uint32_t  ref_handle = 0U;
+    uint64_t  ref_time   = 0U;
+
+    /* Upper bound check, the varints may take less space */
+    if ((HEADER_LEN + 2U * CMD_MAX_LEN + COMPACT_FIXED_MAX_LEN + p_rx->hdata_len) > out_len)
+    {
+        return -1;
+    }
+
+    if (p_compact->p_ref->valid)
+    {
+        flags      = 0U;
+        ref_handle = p_compact->p_ref->frame_handle;
+        ref_time   = p_compact->p_ref->timestamp;
+    }
+
+    p_pos = cmd_prop_header_put(p_pos,
+                                SPINEL_CMD_PROP_VALUE_IS,
+                                SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW_COMPACT);
+    *p_pos++ = flags;
+    p_pos    = varint_put(p_pos, zigzag_encode((int32_t)(p_rx->frame_handle - ref_handle)));
+    *p_pos++ = (uint8_t)p_rx->power;
+    *p_pos++ = p_rx->lqi;
+    p_pos    = varint_put(p_pos, zigzag_encode((int64_t)(p_rx->timestamp - ref_time)));
+    memcpy(p_pos, p_rx->p_frame, p_rx->hdata_len);
+    p_pos   += p_rx->hdata_len;
+
+    return (spinel_ssize_t)(p_pos - p_out);
+}
+
+spinel_ssize_t nrf_802154_spinel_codec_received_timestamp_raw_compact_decode(
+    const void                                      * p_property_data,
+    size_t                                            property_data_len,
+    nrf_802154_spinel_compact_ref_t                 * p_ref,
+    nrf_802154_spinel_received_timestamp_raw_args_t * p_args)
+{
+    const uint8_t * p_pos      = (const uint8_t *)p_property_data;
+    size_t          remaining  = property_data_len;
+    uint32_t        ref_handle = 0U;
+    uint64_t        ref_time   = 0U;
+    uint64_t        handle_diff;
+    uint64_t        time_diff;
+    size_t          len;
+
+    if ((remaining < sizeof(uint8_t)) || (remaining > MAX_PACK_LENGTH))
+    {
+        return -1;
+    }
+
+    if ((*p_pos & NRF_802154_SPINEL_COMPACT_FLAG_REFERENCE_RESET) == 0U)
+    {
+        /* The differences cannot be resolved without the previous notification */
+        if (!p_ref->valid)
+        {
+            return -1;
+        }
+
+        ref_handle = p_ref->frame_handle;
+        ref_time   = p_ref->timestamp;
+    }
+
+    p_pos++;
+    remaining--;
+
+    len = varint_get(p_pos, remaining, &handle_diff);
+
+    if ((len == 0U) || ((remaining - len) < (sizeof(int8_t) + sizeof(uint8_t))))
+    {
+        return -1;
+    }
+
+    p_args->frame_handle = ref_handle + (uint32_t)zigzag_decode(handle_diff);
+    p_args->power        = (int8_t)p_pos[len];
+    p_args->lqi          = p_pos[len + 1U];
+    p_pos               += len + sizeof(int8_t) + sizeof(uint8_t);
+    remaining           -= len + sizeof(int8_t) + sizeof(uint8_t);
+
+    len = varint_get(p_pos, remaining, &time_diff);
+
+    if (len == 0U)
+    {
+        return -1;
+    }
+
+    p_args->timestamp = ref_time + (uint64_t)zigzag_decode(time_diff);
+    p_args->p_frame   = p_pos + len;
+    p_args->hdata_len = remaining - len;
+
+    nrf_802154_spinel_codec_compact_ref_update(p_ref, p_args);
+
+    return (spinel_ssize_t)property_data_len;
+}
+
+void nrf_802154_spinel_codec_compact_ref_update(
+    nrf_802154_spinel_compact_ref_t                       * p_ref,
+    const nrf_802154_spinel_received_timestamp_raw_args_t * p_rx)
+{
+    p_ref->frame_handle = p_rx->frame_handle;
+    p_ref->timestamp    = p_rx->timestamp;
+    p_ref->valid        = true;
+}
+
+spinel_ssize_t nrf_802154_spinel_codec_buffer_free_raw_encode(uint8_t    * p_out,
+                                                              size_t       out_len,
+                                                              const void * p_args)
+{
+    uint8_t * p_pos = p_out;
+
+    if ((HEADER_LEN + 2U * CMD_MAX_LEN + sizeof(uint32_t)) > out_len)
+    {
+        return -1;
+    }
+
+    p_pos = cmd_prop_header_put(p_pos,
+                                SPINEL_CMD_PROP_VALUE_SET,
+                                SPINEL_PROP_VENDOR_NORDIC_NRF_802154_BUFFER_FREE_RAW);
+    p_pos = u32_put(p_pos, *(const uint32_t *)p_args);
+
+    return (spinel_ssize_t)(p_pos - p_out);
+}
+
+spinel_ssize_t nrf_802154_spinel_codec_buffer_free_raw_decode(const void * p_property_data,
+                                                              size_t       property_data_len,
+                                                              uint32_t   * p_buffer_handle)
+{
+    if (property_data_len < sizeof(uint32_t))
+    {
+        return -1;
+    }
+
+    *p_buffer_handle = u32_get((const uint8_t *)p_property_data);
+
+    return (spinel_ssize_t)sizeof(uint32_t);
+}
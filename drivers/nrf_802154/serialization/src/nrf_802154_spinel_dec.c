@@ -37,29 +37,65 @@
 #include <stddef.h>
 
 #include "../spinel_base/spinel.h"
+#include "nrf_802154_spinel.h"
+#include "nrf_802154_spinel_codec.h"
 #include "nrf_802154_spinel_dec.h"
+#include "nrf_802154_spinel_log.h"
 #include "nrf_802154_serialization_error.h"
 
+/**@brief Transaction identifier of the spinel command being dispatched. */
+static spinel_tid_t m_cmd_tid = NRF_802154_SPINEL_TID_NONE;
+
 nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd(const void * p_packet_data,
                                                   size_t       packet_data_len)
 {
-    uint8_t          header;
     spinel_command_t cmd;
     const void     * p_cmd_data;
     size_t           cmd_data_len;
 
-    spinel_ssize_t siz = spinel_datatype_unpack(p_packet_data,
-                                                packet_data_len,
-                                                SPINEL_DATATYPE_COMMAND_S SPINEL_DATATYPE_DATA_S,
-                                                &header,
-                                                &cmd,
-                                                &p_cmd_data,
-                                                &cmd_data_len);
+    spinel_ssize_t siz = nrf_802154_spinel_codec_cmd_decode(p_packet_data,
+                                                            packet_data_len,
+                                                            &cmd,
+                                                            &p_cmd_data,
+                                                            &cmd_data_len);
 
     if (siz < 0)
     {
         return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
     }
 
-    return nrf_802154_spinel_dispatch_cmd(cmd, p_cmd_data, cmd_data_len);
+    nrf_802154_ser_err_t res;
+
+    m_cmd_tid = SPINEL_HEADER_GET_TID(((const uint8_t *)p_packet_data)[0]);
+    res       = nrf_802154_spinel_dispatch_cmd(cmd, p_cmd_data, cmd_data_len);
+    m_cmd_tid = NRF_802154_SPINEL_TID_NONE;
+
+    return res;
+}
+
+uint8_t nrf_802154_spinel_decoded_cmd_tid_get(void)
+{
+    return m_cmd_tid;
+}
+
+nrf_802154_ser_err_t nrf_802154_spinel_dispatch_prop(
+    const nrf_802154_spinel_prop_decoder_t * p_decoders,
+    size_t                                   decoders_count,
+    spinel_prop_key_t                        property,
+    const void                             * p_property_data,
+    size_t                                   property_data_len)
+{
+    size_t index;
+
+    if (nrf_802154_spinel_vendor_prop_index_get(property, decoders_count, &index) &&
+        (p_decoders[index] != NULL))
+    {
+        return p_decoders[index](p_property_data, property_data_len);
+    }
+
+    NRF_802154_SPINEL_LOG_RAW("Unsupported property: %s(%u)\n",
+                              spinel_prop_key_to_cstr(property),
+                              property);
+
+    return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
 }
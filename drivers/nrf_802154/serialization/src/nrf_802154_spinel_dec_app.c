@@ -42,10 +42,13 @@
 
 #include "../spinel_base/spinel.h"
 #include "nrf_802154_spinel.h"
+#include "nrf_802154_spinel_codec.h"
 #include "nrf_802154_spinel_datatypes.h"
 #include "nrf_802154_spinel_dec.h"
+#include "nrf_802154_spinel_dec_app.h"
 #include "nrf_802154_spinel_response_notifier.h"
 #include "nrf_802154_spinel_log.h"
+#include "nrf_802154_serialization_config.h"
 #include "nrf_802154_serialization_error.h"
 #include "nrf_802154_buffer_mgr_dst.h"
 #include "nrf_802154_buffer_mgr_src.h"
@@ -134,6 +137,37 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_energy_detected(
     return NRF_802154_SERIALIZATION_ERROR_OK;
 }
 
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_SCAN_DONE.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_data buffer.
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_energy_scan_done(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    uint32_t        channel_mask;
+    const uint8_t * p_results;
+    size_t          results_len;
+
+    spinel_ssize_t siz = spinel_datatype_unpack(p_property_data,
+                                                property_data_len,
+                                                SPINEL_DATATYPE_NRF_802154_ENERGY_SCAN_DONE,
+                                                &channel_mask,
+                                                &p_results,
+                                                &results_len);
+
+    if ((siz < 0) || (results_len > NRF_802154_ENERGY_SCAN_CHANNELS_MAX))
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    nrf_802154_energy_scan_done(channel_mask, p_results, (uint8_t)results_len);
+
+    return NRF_802154_SERIALIZATION_ERROR_OK;
+}
+
 /**
  * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_DETECTION_FAILED.
  *
@@ -161,6 +195,40 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_energy_detection_faile
     return NRF_802154_SERIALIZATION_ERROR_OK;
 }
 
+/**
+ * @brief Stores a received frame locally and calls @ref nrf_802154_received_timestamp_raw.
+ *
+ * @param[in]  p_rx  Decoded received frame.
+ */
+static nrf_802154_ser_err_t received_frame_dispatch(
+    const nrf_802154_spinel_received_timestamp_raw_args_t * p_rx)
+{
+    void * p_local_ptr;
+
+    if (p_rx->hdata_len < NRF_802154_HDATA_LENGTH(0U))
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    // Associate the remote frame handle with a local pointer
+    // and copy the buffer content there
+    bool frame_added = nrf_802154_buffer_mgr_dst_add(
+        nrf_802154_spinel_dst_buffer_mgr_get(),
+        p_rx->frame_handle,
+        p_rx->p_frame,
+        NRF_802154_DATA_LEN_FROM_HDATA_LEN(p_rx->hdata_len),
+        &p_local_ptr);
+
+    if (!frame_added)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_NO_MEMORY;
+    }
+
+    nrf_802154_received_timestamp_raw(p_local_ptr, p_rx->power, p_rx->lqi, p_rx->timestamp);
+
+    return NRF_802154_SERIALIZATION_ERROR_OK;
+}
+
 /**
  * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW.
  *
@@ -171,44 +239,142 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_received_timestamp_raw
     const void * p_property_data,
     size_t       property_data_len)
 {
-    uint32_t remote_frame_handle;
-    void   * p_frame;
-    size_t   frame_hdata_len;
+    nrf_802154_spinel_received_timestamp_raw_args_t rx;
+
+    // This notification is sent for every received frame, so it skips the generic decoder
+    spinel_ssize_t siz = nrf_802154_spinel_codec_received_timestamp_raw_decode(p_property_data,
+                                                                               property_data_len,
+                                                                               &rx);
+
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    return received_frame_dispatch(&rx);
+}
+
+/**@brief Values of the previous compact received frame notification. */
+static nrf_802154_spinel_compact_ref_t m_rx_compact_ref;
+
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW_COMPACT.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_data buffer.
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_received_timestamp_raw_compact(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    nrf_802154_spinel_received_timestamp_raw_args_t rx;
+
+    spinel_ssize_t siz = nrf_802154_spinel_codec_received_timestamp_raw_compact_decode(
+        p_property_data,
+        property_data_len,
+        &m_rx_compact_ref,
+        &rx);
+
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    return received_frame_dispatch(&rx);
+}
+
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW_SHARED.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_data buffer.
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_received_timestamp_raw_shared(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    uint32_t frame_handle;
+    uint32_t frame_address;
     int8_t   power;
     uint8_t  lqi;
     uint64_t timestamp;
-    void   * p_local_ptr;
 
     spinel_ssize_t siz = spinel_datatype_unpack(p_property_data,
                                                 property_data_len,
-                                                SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW,
-                                                NRF_802154_HDATA_DECODE(remote_frame_handle,
-                                                                        p_frame,
-                                                                        frame_hdata_len),
+                                                SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW_SHARED,
+                                                &frame_handle,
+                                                &frame_address,
                                                 &power,
                                                 &lqi,
                                                 &timestamp);
 
-    if (siz < 0)
+    if ((siz < 0) || (frame_address == 0U))
     {
         return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
     }
 
-    // Associate the remote frame handle with a local pointer
-    // and copy the buffer content there
-    bool frame_added = nrf_802154_buffer_mgr_dst_add(
-        nrf_802154_spinel_dst_buffer_mgr_get(),
-        remote_frame_handle,
-        p_frame,
-        NRF_802154_DATA_LEN_FROM_HDATA_LEN(frame_hdata_len),
-        &p_local_ptr);
+    uint8_t * p_frame = (uint8_t *)(uintptr_t)frame_address;
+
+    // The frame stays in the shared memory, only the handle association is stored
+    bool frame_added = nrf_802154_buffer_mgr_dst_add_shared(nrf_802154_spinel_dst_buffer_mgr_get(),
+                                                            frame_handle,
+                                                            p_frame);
 
     if (!frame_added)
     {
         return NRF_802154_SERIALIZATION_ERROR_NO_MEMORY;
     }
 
-    nrf_802154_received_timestamp_raw(p_local_ptr, power, lqi, timestamp);
+    nrf_802154_received_timestamp_raw(p_frame, power, lqi, timestamp);
+
+    return NRF_802154_SERIALIZATION_ERROR_OK;
+}
+
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW_BATCH.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_data buffer.
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_received_timestamp_raw_batch(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    const uint8_t * p_pos = (const uint8_t *)p_property_data;
+    size_t          remaining;
+    uint8_t         count;
+
+    if (property_data_len < sizeof(uint8_t))
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    count     = *p_pos++;
+    remaining = property_data_len - sizeof(uint8_t);
+
+    for (uint8_t i = 0U; i < count; i++)
+    {
+        nrf_802154_spinel_received_timestamp_raw_args_t rx;
+
+        spinel_ssize_t siz = nrf_802154_spinel_codec_received_timestamp_raw_decode(p_pos,
+                                                                                   remaining,
+                                                                                   &rx);
+
+        if (siz < 0)
+        {
+            return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+        }
+
+        p_pos     += siz;
+        remaining -= (size_t)siz;
+
+        nrf_802154_ser_err_t res = received_frame_dispatch(&rx);
+
+        if (res != NRF_802154_SERIALIZATION_ERROR_OK)
+        {
+            return res;
+        }
+    }
 
     return NRF_802154_SERIALIZATION_ERROR_OK;
 }
@@ -552,6 +718,89 @@ nrf_802154_ser_err_t nrf_802154_spinel_decode_prop_nrf_802154_stat_timestamps_ge
             NRF_802154_SERIALIZATION_ERROR_OK);
 }
 
+/**@brief Decoders of the properties notified by the network core, indexed by vendor property. */
+static const nrf_802154_spinel_prop_decoder_t m_prop_value_is_decoders[] =
+{
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(CCA_DONE, spinel_decode_prop_nrf_802154_cca_done),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(CCA_FAILED, spinel_decode_prop_nrf_802154_cca_failed),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(ENERGY_DETECTED,
+                                        spinel_decode_prop_nrf_802154_energy_detected),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(ENERGY_DETECTION_FAILED,
+                                        spinel_decode_prop_nrf_802154_energy_detection_failed),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(ENERGY_SCAN_DONE,
+                                        spinel_decode_prop_nrf_802154_energy_scan_done),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(RECEIVED_TIMESTAMP_RAW,
+                                        spinel_decode_prop_nrf_802154_received_timestamp_raw),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(RECEIVED_TIMESTAMP_RAW_BATCH,
+                                        spinel_decode_prop_nrf_802154_received_timestamp_raw_batch),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(
+        RECEIVED_TIMESTAMP_RAW_COMPACT,
+        spinel_decode_prop_nrf_802154_received_timestamp_raw_compact),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(
+        RECEIVED_TIMESTAMP_RAW_SHARED,
+        spinel_decode_prop_nrf_802154_received_timestamp_raw_shared),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(TRANSMITTED_RAW,
+                                        spinel_decode_prop_nrf_802154_transmitted_raw),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(TRANSMIT_FAILED,
+                                        spinel_decode_prop_nrf_802154_transmit_failed),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(RECEIVE_FAILED,
+                                        spinel_decode_prop_nrf_802154_receive_failed),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(TX_ACK_STARTED,
+                                        spinel_decode_prop_nrf_802154_tx_ack_started),
+};
+
+/**@brief Properties awaited by the response notifier, indexed by vendor property. */
+static const bool m_prop_value_is_responses[] =
+{
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(SLEEP, true),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(SLEEP_IF_IDLE, true),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(RECEIVE, true),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(RECEIVE_AT, true),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(RECEIVE_AT_PERIODIC, true),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(RECEIVE_AT_CANCEL, true),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(CCA, true),
+#if NRF_802154_CARRIER_FUNCTIONS_ENABLED
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(CONTINUOUS_CARRIER, true),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(MODULATED_CARRIER, true),
+#endif
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(ENERGY_DETECTION, true),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(ENERGY_SCAN, true),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(TX_POWER_GET, true),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(CHANNEL_GET, true),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(CAPABILITIES_GET, true),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(TIME_GET, true),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(CCA_CFG_GET, true),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(SECURITY_KEY_STORE, true),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(SECURITY_KEY_REMOVE, true),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(PENDING_BIT_FOR_ADDR_SET, true),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(PENDING_BIT_FOR_ADDR_CLEAR, true),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(ACK_DATA_SET, true),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(ACK_DATA_CLEAR, true),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(TRANSMIT_RAW, true),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(TRANSMIT_RAW_AT, true),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(TRANSMIT_AT_CANCEL, true),
+#if NRF_802154_CSMA_CA_ENABLED
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(TRANSMIT_CSMA_CA_RAW, true),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(CSMA_CA_MIN_BE_SET, true),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(CSMA_CA_MIN_BE_GET, true),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(CSMA_CA_MAX_BE_SET, true),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(CSMA_CA_MAX_BE_GET, true),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(CSMA_CA_MAX_BACKOFFS_SET, true),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(CSMA_CA_MAX_BACKOFFS_GET, true),
+#endif // NRF_802154_CSMA_CA_ENABLED
+#if NRF_802154_TEST_MODES_ENABLED
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(TEST_MODE_CSMACA_BACKOFF_SET, true),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(TEST_MODE_CSMACA_BACKOFF_GET, true),
+#endif // NRF_802154_TEST_MODES_ENABLED
+#if NRF_802154_IFS_ENABLED
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(IFS_MODE_SET, true),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(IFS_MODE_GET, true),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(IFS_MIN_SIFS_PERIOD_GET, true),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(IFS_MIN_LIFS_PERIOD_GET, true),
+#endif // NRF_802154_IFS_ENABLED
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(STAT_TIMESTAMPS_GET, true),
+};
+
 nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd_prop_value_is(
     const void * p_cmd_data,
     size_t       cmd_data_len)
@@ -561,150 +810,69 @@ nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd_prop_value_is(
     size_t            property_data_len;
     spinel_ssize_t    siz;
 
-    siz = spinel_datatype_unpack(p_cmd_data,
-                                 cmd_data_len,
-                                 SPINEL_DATATYPE_UINT_PACKED_S SPINEL_DATATYPE_DATA_S,
-                                 &property,
-                                 &p_property_data,
-                                 &property_data_len);
+    siz = nrf_802154_spinel_codec_prop_decode(p_cmd_data,
+                                              cmd_data_len,
+                                              &property,
+                                              &p_property_data,
+                                              &property_data_len);
 
     if (siz < 0)
     {
         return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
     }
 
-    switch (property)
+#if NRF_802154_SER_PIPELINE_ENABLED
+    uint8_t tid = nrf_802154_spinel_decoded_cmd_tid_get();
+
+    if ((property == SPINEL_PROP_LAST_STATUS) && (tid != NRF_802154_SPINEL_TID_NONE))
     {
-        case SPINEL_PROP_LAST_STATUS:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SLEEP:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SLEEP_IF_IDLE:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_AT:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_AT_CANCEL:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CCA:
-            // fall through
-#if NRF_802154_CARRIER_FUNCTIONS_ENABLED
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CONTINUOUS_CARRIER:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_MODULATED_CARRIER:
-            // fall through
-#endif
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_DETECTION:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_POWER_GET:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CHANNEL_GET:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CAPABILITIES_GET:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TIME_GET:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CCA_CFG_GET:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_STORE:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_REMOVE:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_SET:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_SET:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_CLEAR:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW_AT:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_AT_CANCEL:
-            // fall through
-#if NRF_802154_CSMA_CA_ENABLED
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_CSMA_CA_RAW:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MIN_BE_SET:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MIN_BE_GET:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BE_SET:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BE_GET:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BACKOFFS_SET:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BACKOFFS_GET:
-            // fall through
-#endif // NRF_802154_CSMA_CA_ENABLED
-#if NRF_802154_TEST_MODES_ENABLED
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TEST_MODE_CSMACA_BACKOFF_SET:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TEST_MODE_CSMACA_BACKOFF_GET:
-            // fall through
-#endif // NRF_802154_TEST_MODES_ENABLED
-#if NRF_802154_IFS_ENABLED
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MODE_SET:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MODE_GET:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MIN_SIFS_PERIOD_GET:
-        // fall through
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MIN_LIFS_PERIOD_GET:
-            // fall through
-#endif // NRF_802154_IFS_ENABLED
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_STAT_TIMESTAMPS_GET:
-            nrf_802154_spinel_response_notifier_property_notify(property,
-                                                                p_property_data,
-                                                                property_data_len);
-            return NRF_802154_SERIALIZATION_ERROR_OK;
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CCA_DONE:
-            return spinel_decode_prop_nrf_802154_cca_done(p_property_data,
-                                                          property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CCA_FAILED:
-            return spinel_decode_prop_nrf_802154_cca_failed(p_property_data,
-                                                            property_data_len);
+        // Status of a pipelined request, nobody waits for it
+        spinel_status_t      status;
+        nrf_802154_ser_err_t res = nrf_802154_spinel_decode_prop_last_status(p_property_data,
+                                                                             property_data_len,
+                                                                             &status);
 
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_DETECTED:
-            return spinel_decode_prop_nrf_802154_energy_detected(p_property_data,
-                                                                 property_data_len);
+        if (res < 0)
+        {
+            return res;
+        }
 
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_DETECTION_FAILED:
-            return spinel_decode_prop_nrf_802154_energy_detection_failed(p_property_data,
-                                                                         property_data_len);
+        nrf_802154_spinel_pipeline_status_received(tid, status);
 
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW:
-            return spinel_decode_prop_nrf_802154_received_timestamp_raw(p_property_data,
-                                                                        property_data_len);
+        return NRF_802154_SERIALIZATION_ERROR_OK;
+    }
+#endif // NRF_802154_SER_PIPELINE_ENABLED
 
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMITTED_RAW:
-            return spinel_decode_prop_nrf_802154_transmitted_raw(p_property_data,
-                                                                 property_data_len);
+    size_t index;
 
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_FAILED:
-            return spinel_decode_prop_nrf_802154_transmit_failed(p_property_data,
-                                                                 property_data_len);
+    // Notifications, like the ones of received and transmitted frames, are looked up first
+    if (nrf_802154_spinel_vendor_prop_index_get(property,
+                                                sizeof(m_prop_value_is_decoders) /
+                                                sizeof(m_prop_value_is_decoders[0]),
+                                                &index) &&
+        (m_prop_value_is_decoders[index] != NULL))
+    {
+        return m_prop_value_is_decoders[index](p_property_data, property_data_len);
+    }
 
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_FAILED:
-            return spinel_decode_prop_nrf_802154_receive_failed(p_property_data,
-                                                                property_data_len);
+    if ((property == SPINEL_PROP_LAST_STATUS) ||
+        (nrf_802154_spinel_vendor_prop_index_get(property,
+                                                 sizeof(m_prop_value_is_responses) /
+                                                 sizeof(m_prop_value_is_responses[0]),
+                                                 &index) &&
+         m_prop_value_is_responses[index]))
+    {
+        nrf_802154_spinel_response_notifier_property_notify(property,
+                                                            p_property_data,
+                                                            property_data_len);
+        return NRF_802154_SERIALIZATION_ERROR_OK;
+    }
 
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_ACK_STARTED:
-            return spinel_decode_prop_nrf_802154_tx_ack_started(p_property_data,
-                                                                property_data_len);
+    NRF_802154_SPINEL_LOG_RAW("Unsupported property: %s(%u)\n",
+                              spinel_prop_key_to_cstr(property),
+                              property);
 
-        default:
-            NRF_802154_SPINEL_LOG_RAW("Unsupported property: %s(%u)\n",
-                                      spinel_prop_key_to_cstr(property),
-                                      property);
-            return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
-    }
+    return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
 }
 
 nrf_802154_ser_err_t nrf_802154_spinel_dispatch_cmd(spinel_command_t cmd,
@@ -792,4 +960,14 @@ __WEAK void nrf_802154_energy_detection_failed(nrf_802154_ed_error_t error)
     // Intentionally empty
 }
 
+__WEAK void nrf_802154_energy_scan_done(uint32_t        channel_mask,
+                                        const uint8_t * p_results,
+                                        uint8_t         results_count)
+{
+    (void)channel_mask;
+    (void)p_results;
+    (void)results_count;
+    // Intentionally empty
+}
+
 #endif // TEST
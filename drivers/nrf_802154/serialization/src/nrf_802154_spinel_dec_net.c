@@ -38,6 +38,7 @@
 #include "nrf_802154_const.h"
 
 #include "../spinel_base/spinel.h"
+#include "nrf_802154_spinel_codec.h"
 #include "nrf_802154_spinel_datatypes.h"
 #include "nrf_802154_spinel_dec.h"
 #include "nrf_802154_spinel_enc_net.h"
@@ -160,6 +161,48 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_receive_at(
         result);
 }
 
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_AT_PERIODIC.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_property_data buffer.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_receive_at_periodic(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    uint64_t       rx_time;
+    uint32_t       period;
+    uint32_t       timeout;
+    uint8_t        channel;
+    uint32_t       count;
+    uint32_t       id;
+    spinel_ssize_t siz;
+
+    siz = spinel_datatype_unpack(p_property_data,
+                                 property_data_len,
+                                 SPINEL_DATATYPE_NRF_802154_RECEIVE_AT_PERIODIC,
+                                 &rx_time,
+                                 &period,
+                                 &timeout,
+                                 &channel,
+                                 &count,
+                                 &id);
+
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    bool result = nrf_802154_receive_at_periodic(rx_time, period, timeout, channel, count, id);
+
+    return nrf_802154_spinel_send_cmd_prop_value_is(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_AT_PERIODIC,
+        SPINEL_DATATYPE_NRF_802154_RECEIVE_AT_PERIODIC_RET,
+        result);
+}
+
 /**
  * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_AT_CANCEL.
  *
@@ -512,6 +555,40 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_energy_detection(
         result);
 }
 
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_SCAN.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_property_data buffer.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_energy_scan(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    uint32_t       channel_mask;
+    uint32_t       dwell_time_us;
+    spinel_ssize_t siz;
+
+    siz = spinel_datatype_unpack(p_property_data,
+                                 property_data_len,
+                                 SPINEL_DATATYPE_NRF_802154_ENERGY_SCAN,
+                                 &channel_mask,
+                                 &dwell_time_us);
+
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    bool result = nrf_802154_energy_scan(channel_mask, dwell_time_us);
+
+    return nrf_802154_spinel_send_cmd_prop_value_is(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_SCAN,
+        SPINEL_DATATYPE_NRF_802154_ENERGY_SCAN_RET,
+        result);
+}
+
 /**
  * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_AUTO_PENDING_BIT_SET.
  *
@@ -816,6 +893,138 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_ack_data_clear(
         ack_data_clear_res);
 }
 
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_SET_BATCH.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_property_data buffer.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_ack_data_set_batch(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    const uint8_t       * p_addrs;
+    size_t                addrs_len;
+    bool                  extended;
+    const uint8_t       * p_lengths;
+    size_t                lengths_len;
+    const void          * p_data;
+    size_t                data_len;
+    nrf_802154_ack_data_t data_type;
+    spinel_ssize_t        siz;
+    size_t                addr_size;
+    size_t                num_addrs;
+
+    siz = spinel_datatype_unpack(p_property_data,
+                                 property_data_len,
+                                 SPINEL_DATATYPE_NRF_802154_ACK_DATA_SET_BATCH,
+                                 &p_addrs,
+                                 &addrs_len,
+                                 &extended,
+                                 &p_lengths,
+                                 &lengths_len,
+                                 &p_data,
+                                 &data_len,
+                                 &data_type);
+
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    addr_size = extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
+    num_addrs = addrs_len / addr_size;
+
+    if (((addrs_len % addr_size) != 0) || (num_addrs > UINT8_MAX))
+    {
+        return NRF_802154_SERIALIZATION_ERROR_REQUEST_INVALID;
+    }
+
+    if (data_type == NRF_802154_ACK_DATA_IE)
+    {
+        size_t total_len = 0;
+
+        if (lengths_len != num_addrs)
+        {
+            return NRF_802154_SERIALIZATION_ERROR_REQUEST_INVALID;
+        }
+
+        for (size_t i = 0; i < lengths_len; i++)
+        {
+            total_len += p_lengths[i];
+        }
+
+        if (total_len != data_len)
+        {
+            return NRF_802154_SERIALIZATION_ERROR_REQUEST_INVALID;
+        }
+    }
+
+    bool ack_data_set_res = nrf_802154_ack_data_set_batch(p_addrs,
+                                                          extended,
+                                                          (uint8_t)num_addrs,
+                                                          p_data,
+                                                          p_lengths,
+                                                          data_type);
+
+    return nrf_802154_spinel_send_cmd_prop_value_is(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_SET_BATCH,
+        SPINEL_DATATYPE_NRF_802154_ACK_DATA_SET_BATCH_RET,
+        ack_data_set_res);
+}
+
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_CLEAR_BATCH.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_property_data buffer.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_ack_data_clear_batch(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    const uint8_t       * p_addrs;
+    size_t                addrs_len;
+    bool                  extended;
+    nrf_802154_ack_data_t data_type;
+    spinel_ssize_t        siz;
+    size_t                addr_size;
+    size_t                num_addrs;
+
+    siz = spinel_datatype_unpack(p_property_data,
+                                 property_data_len,
+                                 SPINEL_DATATYPE_NRF_802154_ACK_DATA_CLEAR_BATCH,
+                                 &p_addrs,
+                                 &addrs_len,
+                                 &extended,
+                                 &data_type);
+
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    addr_size = extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
+    num_addrs = addrs_len / addr_size;
+
+    if (((addrs_len % addr_size) != 0) || (num_addrs > UINT8_MAX))
+    {
+        return NRF_802154_SERIALIZATION_ERROR_REQUEST_INVALID;
+    }
+
+    bool ack_data_clear_res = nrf_802154_ack_data_clear_batch(p_addrs,
+                                                              extended,
+                                                              (uint8_t)num_addrs,
+                                                              data_type);
+
+    return nrf_802154_spinel_send_cmd_prop_value_is(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_CLEAR_BATCH,
+        SPINEL_DATATYPE_NRF_802154_ACK_DATA_CLEAR_BATCH_RET,
+        ack_data_clear_res);
+}
+
 #if NRF_802154_CSMA_CA_ENABLED
 
 /**
@@ -1438,10 +1647,10 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_buffer_free_raw(
     uint32_t local_frame_handle;
     void   * p_local_ptr;
 
-    spinel_ssize_t siz = spinel_datatype_unpack(p_property_data,
-                                                property_data_len,
-                                                SPINEL_DATATYPE_NRF_802154_BUFFER_FREE_RAW,
-                                                &local_frame_handle);
+    // This request is sent for every received frame, so it skips the generic decoder
+    spinel_ssize_t siz = nrf_802154_spinel_codec_buffer_free_raw_decode(p_property_data,
+                                                                        property_data_len,
+                                                                        &local_frame_handle);
 
     if (siz < 0)
     {
@@ -1810,259 +2019,172 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_csl_writer_anchor_time
 
 #endif // NRF_802154_DELAYED_TRX_ENABLED && NRF_802154_IE_WRITER_ENABLED
 
-nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd_prop_value_set(const void * p_cmd_data,
-                                                                 size_t       cmd_data_len)
+/**
+ * @brief Deal with SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PIPELINE_SYNC request and send response.
+ *
+ * Requests are processed in the order they are received, so responding to this request
+ * confirms that all statuses of the requests sent before it were already sent.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer - unused here (no additional data to decode).
+ * @param[in]  property_data_len  Size of the @ref p_data buffer - unused here.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_pipeline_sync(
+    const void * p_property_data,
+    size_t       property_data_len)
 {
-    spinel_prop_key_t property;
-    const void      * p_property_data;
-    size_t            property_data_len;
-    spinel_ssize_t    siz;
-
-    siz = spinel_datatype_unpack(p_cmd_data,
-                                 cmd_data_len,
-                                 SPINEL_DATATYPE_UINT_PACKED_S SPINEL_DATATYPE_DATA_S,
-                                 &property,
-                                 &p_property_data,
-                                 &property_data_len);
-
-    if (siz < 0)
-    {
-        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
-    }
-
-    switch (property)
-    {
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SLEEP:
-            return spinel_decode_prop_nrf_802154_sleep(p_property_data, property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SLEEP_IF_IDLE:
-            return spinel_decode_prop_nrf_802154_sleep_if_idle(p_property_data, property_data_len);
+    (void)p_property_data;
+    (void)property_data_len;
 
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE:
-            return spinel_decode_prop_nrf_802154_receive(p_property_data, property_data_len);
+    return nrf_802154_spinel_send_prop_last_status_is(SPINEL_STATUS_OK);
+}
 
+/**@brief Decoders of the properties set by the application core, indexed by vendor property. */
+static const nrf_802154_spinel_prop_decoder_t m_prop_value_set_decoders[] =
+{
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(SLEEP, spinel_decode_prop_nrf_802154_sleep),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(SLEEP_IF_IDLE, spinel_decode_prop_nrf_802154_sleep_if_idle),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(RECEIVE, spinel_decode_prop_nrf_802154_receive),
 #if NRF_802154_DELAYED_TRX_ENABLED
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_AT:
-            return spinel_decode_prop_nrf_802154_receive_at(p_property_data, property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_AT_CANCEL:
-            return spinel_decode_prop_nrf_802154_receive_at_cancel(p_property_data,
-                                                                   property_data_len);
-
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(RECEIVE_AT, spinel_decode_prop_nrf_802154_receive_at),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(RECEIVE_AT_PERIODIC,
+                                        spinel_decode_prop_nrf_802154_receive_at_periodic),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(RECEIVE_AT_CANCEL,
+                                        spinel_decode_prop_nrf_802154_receive_at_cancel),
 #endif // NRF_802154_DELAYED_TRX_ENABLED
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CHANNEL_GET:
-            return spinel_decode_prop_nrf_802154_channel_get(p_property_data, property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CHANNEL_SET:
-            return spinel_decode_prop_nrf_802154_channel_set(p_property_data, property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_AUTO_PENDING_BIT_SET:
-            return spinel_decode_prop_nrf_802154_auto_pending_bit_set(p_property_data,
-                                                                      property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_SET:
-            return spinel_decode_prop_nrf_802154_pending_bit_for_addr_set(p_property_data,
-                                                                          property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR:
-            return spinel_decode_prop_nrf_802154_pending_bit_for_addr_clear(p_property_data,
-                                                                            property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PENDING_BIT_FOR_ADDR_RESET:
-            return spinel_decode_prop_nrf_802154_pending_bit_for_addr_reset(p_property_data,
-                                                                            property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SRC_ADDR_MATCHING_METHOD_SET:
-            return spinel_decode_prop_nrf_802154_src_addr_matching_method_set(p_property_data,
-                                                                              property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PAN_ID_SET:
-            return spinel_decode_prop_nrf_802154_pan_id_set(p_property_data, property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SHORT_ADDRESS_SET:
-            return spinel_decode_prop_nrf_802154_short_address_set(p_property_data,
-                                                                   property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_EXTENDED_ADDRESS_SET:
-            return spinel_decode_prop_nrf_802154_extended_address_set(p_property_data,
-                                                                      property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PAN_COORD_SET:
-            return spinel_decode_prop_nrf_802154_pan_coord_set(p_property_data, property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_PROMISCUOUS_SET:
-            return spinel_decode_prop_nrf_802154_promiscuous_set(p_property_data,
-                                                                 property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CCA:
-            return spinel_decode_prop_nrf_802154_cca(p_property_data, property_data_len);
-
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(CHANNEL_GET, spinel_decode_prop_nrf_802154_channel_get),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(CHANNEL_SET, spinel_decode_prop_nrf_802154_channel_set),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(AUTO_PENDING_BIT_SET,
+                                        spinel_decode_prop_nrf_802154_auto_pending_bit_set),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(PENDING_BIT_FOR_ADDR_SET,
+                                        spinel_decode_prop_nrf_802154_pending_bit_for_addr_set),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(PENDING_BIT_FOR_ADDR_CLEAR,
+                                        spinel_decode_prop_nrf_802154_pending_bit_for_addr_clear),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(PENDING_BIT_FOR_ADDR_RESET,
+                                        spinel_decode_prop_nrf_802154_pending_bit_for_addr_reset),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(SRC_ADDR_MATCHING_METHOD_SET,
+                                        spinel_decode_prop_nrf_802154_src_addr_matching_method_set),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(PAN_ID_SET, spinel_decode_prop_nrf_802154_pan_id_set),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(SHORT_ADDRESS_SET,
+                                        spinel_decode_prop_nrf_802154_short_address_set),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(EXTENDED_ADDRESS_SET,
+                                        spinel_decode_prop_nrf_802154_extended_address_set),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(PAN_COORD_SET, spinel_decode_prop_nrf_802154_pan_coord_set),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(PROMISCUOUS_SET,
+                                        spinel_decode_prop_nrf_802154_promiscuous_set),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(CCA, spinel_decode_prop_nrf_802154_cca),
 #if NRF_802154_CARRIER_FUNCTIONS_ENABLED
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CONTINUOUS_CARRIER:
-            return spinel_decode_prop_nrf_802154_continuous_carrier(p_property_data,
-                                                                    property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_MODULATED_CARRIER:
-            return spinel_decode_prop_nrf_802154_modulated_carrier(p_property_data,
-                                                                   property_data_len);
-
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(CONTINUOUS_CARRIER,
+                                        spinel_decode_prop_nrf_802154_continuous_carrier),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(MODULATED_CARRIER,
+                                        spinel_decode_prop_nrf_802154_modulated_carrier),
 #endif // NRF_802154_CARRIER_FUNCTIONS_ENABLED
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_DETECTION:
-            return spinel_decode_prop_nrf_802154_energy_detection(p_property_data,
-                                                                  property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_POWER_SET:
-            return spinel_decode_prop_nrf_802154_tx_power_set(p_property_data, property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_POWER_GET:
-            return spinel_decode_prop_nrf_802154_tx_power_get(p_property_data, property_data_len);
-
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(ENERGY_DETECTION,
+                                        spinel_decode_prop_nrf_802154_energy_detection),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(ENERGY_SCAN, spinel_decode_prop_nrf_802154_energy_scan),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(TX_POWER_SET, spinel_decode_prop_nrf_802154_tx_power_set),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(TX_POWER_GET, spinel_decode_prop_nrf_802154_tx_power_get),
 #if NRF_802154_CSMA_CA_ENABLED
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_CSMA_CA_RAW:
-            return spinel_decode_prop_nrf_802154_transmit_csma_ca_raw(p_property_data,
-                                                                      property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MIN_BE_SET:
-            return spinel_decode_prop_nrf_802154_csma_ca_min_be_set(p_property_data,
-                                                                    property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MIN_BE_GET:
-            return spinel_decode_prop_nrf_802154_csma_ca_min_be_get(p_property_data,
-                                                                    property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BE_SET:
-            return spinel_decode_prop_nrf_802154_csma_ca_max_be_set(p_property_data,
-                                                                    property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BE_GET:
-            return spinel_decode_prop_nrf_802154_csma_ca_max_be_get(p_property_data,
-                                                                    property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BACKOFFS_SET:
-            return spinel_decode_prop_nrf_802154_csma_ca_max_backoffs_set(p_property_data,
-                                                                          property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BACKOFFS_GET:
-            return spinel_decode_prop_nrf_802154_csma_ca_max_backoffs_get(p_property_data,
-                                                                          property_data_len);
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(TRANSMIT_CSMA_CA_RAW,
+                                        spinel_decode_prop_nrf_802154_transmit_csma_ca_raw),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(CSMA_CA_MIN_BE_SET,
+                                        spinel_decode_prop_nrf_802154_csma_ca_min_be_set),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(CSMA_CA_MIN_BE_GET,
+                                        spinel_decode_prop_nrf_802154_csma_ca_min_be_get),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(CSMA_CA_MAX_BE_SET,
+                                        spinel_decode_prop_nrf_802154_csma_ca_max_be_set),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(CSMA_CA_MAX_BE_GET,
+                                        spinel_decode_prop_nrf_802154_csma_ca_max_be_get),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(CSMA_CA_MAX_BACKOFFS_SET,
+                                        spinel_decode_prop_nrf_802154_csma_ca_max_backoffs_set),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(CSMA_CA_MAX_BACKOFFS_GET,
+                                        spinel_decode_prop_nrf_802154_csma_ca_max_backoffs_get),
 #endif // NRF_802154_CSMA_CA_ENABLED
-
 #if NRF_802154_TEST_MODES_ENABLED
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TEST_MODE_CSMACA_BACKOFF_SET:
-            return spinel_decode_prop_nrf_802154_test_mode_csmaca_backoff_set(p_property_data,
-                                                                              property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TEST_MODE_CSMACA_BACKOFF_GET:
-            return spinel_decode_prop_nrf_802154_test_mode_csmaca_backoff_get(p_property_data,
-                                                                              property_data_len);
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(TEST_MODE_CSMACA_BACKOFF_SET,
+                                        spinel_decode_prop_nrf_802154_test_mode_csmaca_backoff_set),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(TEST_MODE_CSMACA_BACKOFF_GET,
+                                        spinel_decode_prop_nrf_802154_test_mode_csmaca_backoff_get),
 #endif // NRF_802154_TEST_MODES_ENABLED
-
 #if NRF_802154_IFS_ENABLED
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MODE_SET:
-            return spinel_decode_prop_nrf_802154_ifs_mode_set(p_property_data,
-                                                              property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MODE_GET:
-            return spinel_decode_prop_nrf_802154_ifs_mode_get(p_property_data,
-                                                              property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MIN_SIFS_PERIOD_SET:
-            return spinel_decode_prop_nrf_802154_ifs_min_sifs_period_set(p_property_data,
-                                                                         property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MIN_SIFS_PERIOD_GET:
-            return spinel_decode_prop_nrf_802154_ifs_min_sifs_period_get(p_property_data,
-                                                                         property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MIN_LIFS_PERIOD_SET:
-            return spinel_decode_prop_nrf_802154_ifs_min_lifs_period_set(p_property_data,
-                                                                         property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_IFS_MIN_LIFS_PERIOD_GET:
-            return spinel_decode_prop_nrf_802154_ifs_min_lifs_period_get(p_property_data,
-                                                                         property_data_len);
-
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(IFS_MODE_SET, spinel_decode_prop_nrf_802154_ifs_mode_set),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(IFS_MODE_GET, spinel_decode_prop_nrf_802154_ifs_mode_get),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(IFS_MIN_SIFS_PERIOD_SET,
+                                        spinel_decode_prop_nrf_802154_ifs_min_sifs_period_set),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(IFS_MIN_SIFS_PERIOD_GET,
+                                        spinel_decode_prop_nrf_802154_ifs_min_sifs_period_get),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(IFS_MIN_LIFS_PERIOD_SET,
+                                        spinel_decode_prop_nrf_802154_ifs_min_lifs_period_set),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(IFS_MIN_LIFS_PERIOD_GET,
+                                        spinel_decode_prop_nrf_802154_ifs_min_lifs_period_get),
 #endif // NRF_802154_IFS_ENABLED
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW:
-            return spinel_decode_prop_nrf_802154_transmit_raw(p_property_data, property_data_len);
-
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(TRANSMIT_RAW, spinel_decode_prop_nrf_802154_transmit_raw),
 #if NRF_802154_DELAYED_TRX_ENABLED
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_RAW_AT:
-            return spinel_decode_prop_nrf_802154_transmit_raw_at(p_property_data,
-                                                                 property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_AT_CANCEL:
-            return spinel_decode_prop_nrf_802154_transmit_at_cancel(p_property_data,
-                                                                    property_data_len);
-
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(TRANSMIT_RAW_AT,
+                                        spinel_decode_prop_nrf_802154_transmit_raw_at),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(TRANSMIT_AT_CANCEL,
+                                        spinel_decode_prop_nrf_802154_transmit_at_cancel),
 #endif // NRF_802154_DELAYED_TRX_ENABLED
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_BUFFER_FREE_RAW:
-            return spinel_decode_prop_nrf_802154_buffer_free_raw(p_property_data,
-                                                                 property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CAPABILITIES_GET:
-            return spinel_decode_prop_nrf_802154_capabilities_get(p_property_data,
-                                                                  property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TIME_GET:
-            return spinel_decode_prop_nrf_802154_time_get(p_property_data,
-                                                          property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CCA_CFG_GET:
-            return spinel_decode_prop_nrf_802154_cca_cfg_get(p_property_data, property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CCA_CFG_SET:
-            return spinel_decode_prop_nrf_802154_cca_cfg_set(p_property_data, property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_SET:
-            return spinel_decode_prop_nrf_802154_ack_data_set(p_property_data,
-                                                              property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_CLEAR:
-            return spinel_decode_prop_nrf_802154_ack_data_clear(p_property_data,
-                                                                property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_GLOBAL_FRAME_COUNTER_SET:
-            return spinel_decode_prop_nrf_802154_security_global_frame_counter_set(p_property_data,
-                                                                                   property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_STORE:
-            return spinel_decode_prop_nrf_802154_security_key_store(p_property_data,
-                                                                    property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_KEY_REMOVE:
-            return spinel_decode_prop_nrf_802154_security_key_remove(p_property_data,
-                                                                     property_data_len);
-
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(BUFFER_FREE_RAW,
+                                        spinel_decode_prop_nrf_802154_buffer_free_raw),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(CAPABILITIES_GET,
+                                        spinel_decode_prop_nrf_802154_capabilities_get),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(TIME_GET, spinel_decode_prop_nrf_802154_time_get),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(CCA_CFG_GET, spinel_decode_prop_nrf_802154_cca_cfg_get),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(CCA_CFG_SET, spinel_decode_prop_nrf_802154_cca_cfg_set),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(ACK_DATA_SET, spinel_decode_prop_nrf_802154_ack_data_set),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(ACK_DATA_CLEAR,
+                                        spinel_decode_prop_nrf_802154_ack_data_clear),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(ACK_DATA_SET_BATCH,
+                                        spinel_decode_prop_nrf_802154_ack_data_set_batch),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(ACK_DATA_CLEAR_BATCH,
+                                        spinel_decode_prop_nrf_802154_ack_data_clear_batch),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(
+        SECURITY_GLOBAL_FRAME_COUNTER_SET,
+        spinel_decode_prop_nrf_802154_security_global_frame_counter_set),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(SECURITY_KEY_STORE,
+                                        spinel_decode_prop_nrf_802154_security_key_store),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(SECURITY_KEY_REMOVE,
+                                        spinel_decode_prop_nrf_802154_security_key_remove),
 #if NRF_802154_DELAYED_TRX_ENABLED && NRF_802154_IE_WRITER_ENABLED
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSL_WRITER_PERIOD_SET:
-            return spinel_decode_prop_nrf_802154_csl_writer_period_set(p_property_data,
-                                                                       property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSL_WRITER_ANCHOR_TIME_SET:
-            return spinel_decode_prop_nrf_802154_csl_writer_anchor_time_set(p_property_data,
-                                                                            property_data_len);
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(CSL_WRITER_PERIOD_SET,
+                                        spinel_decode_prop_nrf_802154_csl_writer_period_set),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(CSL_WRITER_ANCHOR_TIME_SET,
+                                        spinel_decode_prop_nrf_802154_csl_writer_anchor_time_set),
 #endif // NRF_802154_DELAYED_TRX_ENABLED && NRF_802154_IE_WRITER_ENABLED
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(STAT_TIMESTAMPS_GET,
+                                        spinel_decode_prop_nrf_802154_stat_timestamps_get),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(
+        SECURITY_GLOBAL_FRAME_COUNTER_SET_IF_LARGER,
+        spinel_decode_prop_nrf_802154_security_global_frame_counter_set_if_larger),
+    NRF_802154_SPINEL_VENDOR_PROP_ENTRY(PIPELINE_SYNC, spinel_decode_prop_nrf_802154_pipeline_sync),
+};
 
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_STAT_TIMESTAMPS_GET:
-            return spinel_decode_prop_nrf_802154_stat_timestamps_get(p_property_data,
-                                                                     property_data_len);
-
-        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_SECURITY_GLOBAL_FRAME_COUNTER_SET_IF_LARGER:
-            return spinel_decode_prop_nrf_802154_security_global_frame_counter_set_if_larger(
-                p_property_data,
-                property_data_len);
+nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd_prop_value_set(const void * p_cmd_data,
+                                                                 size_t       cmd_data_len)
+{
+    spinel_prop_key_t property;
+    const void      * p_property_data;
+    size_t            property_data_len;
+    spinel_ssize_t    siz;
 
-        default:
-            NRF_802154_SPINEL_LOG_RAW("Unsupported property: %s(%u)\n",
-                                      spinel_prop_key_to_cstr(property),
-                                      property);
-            return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    siz = nrf_802154_spinel_codec_prop_decode(p_cmd_data,
+                                              cmd_data_len,
+                                              &property,
+                                              &p_property_data,
+                                              &property_data_len);
 
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
     }
+
+    return nrf_802154_spinel_dispatch_prop(
+        m_prop_value_set_decoders,
+        sizeof(m_prop_value_set_decoders) / sizeof(m_prop_value_set_decoders[0]),
+        property,
+        p_property_data,
+        property_data_len);
 }
 
 nrf_802154_ser_err_t nrf_802154_spinel_dispatch_cmd(spinel_command_t cmd,
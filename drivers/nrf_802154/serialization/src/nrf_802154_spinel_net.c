@@ -48,7 +48,9 @@
 
 #include "../spinel_base/spinel.h"
 #include "nrf_802154_spinel.h"
+#include "nrf_802154_spinel_codec.h"
 #include "nrf_802154_spinel_datatypes.h"
+#include "nrf_802154_spinel_dec.h"
 #include "nrf_802154_spinel_enc_net.h"
 #include "nrf_802154_spinel_log.h"
 #include "nrf_802154_spinel_response_notifier.h"
@@ -56,12 +58,261 @@
 #include "nrf_802154_serialization_error_helper.h"
 #include "nrf_802154_buffer_mgr_dst.h"
 #include "nrf_802154_buffer_mgr_src.h"
+#include "nrf_802154_serialization_config.h"
 
 #include "nrf_802154.h"
 
+#if NRF_802154_SER_RX_BATCH_ENABLED
+#include "nrf_802154_serialization_crit_sect.h"
+#include "nrf_802154_sl_timer.h"
+#endif
+
+#if NRF_802154_SER_SHARED_MEM_ENABLED
+#include "nrf_802154_serialization_shared_mem.h"
+#endif
+
 /**@brief A pointer to the last transmitted ACK frame. */
 static const uint8_t * volatile mp_last_tx_ack;
 
+#if NRF_802154_SER_RX_BATCH_ENABLED
+
+/**@brief Received frames waiting to be sent to the application core. */
+static nrf_802154_spinel_received_timestamp_raw_args_t
+    m_rx_batch[NRF_802154_SER_RX_BATCH_MAX_COUNT];
+
+/**@brief Number of valid entries in @ref m_rx_batch. */
+static volatile uint8_t m_rx_batch_count;
+
+/**@brief Timer bounding the time the oldest entry of @ref m_rx_batch can wait. */
+static nrf_802154_sl_timer_t m_rx_batch_timer;
+
+/**@brief Indicates if @ref m_rx_batch_timer was initialized. */
+static bool m_rx_batch_timer_initialized;
+
+/**
+ * @brief Releases received frames that could not be sent to the application core.
+ *
+ * @param[in]  p_frames  Array of frames to release.
+ * @param[in]  count     Number of frames in @p p_frames.
+ */
+static void rx_batch_drop(const nrf_802154_spinel_received_timestamp_raw_args_t * p_frames,
+                          size_t                                                  count)
+{
+    for (size_t i = 0U; i < count; i++)
+    {
+        nrf_802154_buffer_mgr_src_remove_by_buffer_handle(nrf_802154_spinel_src_buffer_mgr_get(),
+                                                          p_frames[i].frame_handle);
+
+        nrf_802154_buffer_free_raw((uint8_t *)p_frames[i].p_frame);
+    }
+}
+
+/**
+ * @brief Sends all received frames waiting in @ref m_rx_batch.
+ *
+ * Frames that could not be sent are dropped.
+ */
+static nrf_802154_ser_err_t rx_batch_flush(void)
+{
+    nrf_802154_spinel_received_timestamp_raw_args_t frames[NRF_802154_SER_RX_BATCH_MAX_COUNT];
+    nrf_802154_ser_err_t                            res = NRF_802154_SERIALIZATION_ERROR_OK;
+    size_t                                          count;
+    size_t                                          sent = 0U;
+    uint32_t                                        crit_sect;
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    count = m_rx_batch_count;
+
+    for (size_t i = 0U; i < count; i++)
+    {
+        frames[i] = m_rx_batch[i];
+    }
+
+    m_rx_batch_count = 0U;
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+    if (count == 0U)
+    {
+        return res;
+    }
+
+    if (m_rx_batch_timer_initialized)
+    {
+        (void)nrf_802154_sl_timer_remove(&m_rx_batch_timer);
+    }
+
+    while (sent < count)
+    {
+        size_t encoded_count = 0U;
+
+        nrf_802154_spinel_received_timestamp_raw_batch_args_t batch =
+        {
+            .p_frames        = &frames[sent],
+            .count           = count - sent,
+            .p_encoded_count = &encoded_count,
+        };
+
+        res = nrf_802154_spinel_send_encoded(
+            nrf_802154_spinel_codec_received_timestamp_raw_batch_encode,
+            &batch);
+
+        if (res < 0)
+        {
+            break;
+        }
+
+        sent += encoded_count;
+    }
+
+    if (sent < count)
+    {
+        // Serialization failed. Drop the frames that were not sent
+        rx_batch_drop(&frames[sent], count - sent);
+    }
+
+    return (res < 0) ? res : NRF_802154_SERIALIZATION_ERROR_OK;
+}
+
+/**
+ * @brief Flushes @ref m_rx_batch when the oldest pending frame has waited long enough.
+ *
+ * @param[in]  p_timer  Timer that triggered.
+ */
+static void rx_batch_timeout(nrf_802154_sl_timer_t * p_timer)
+{
+    (void)p_timer;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    nrf_802154_ser_err_t res = rx_batch_flush();
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return;
+}
+
+/**
+ * @brief Queues a received frame to be sent together with the following ones.
+ *
+ * @param[in]  p_rx  Received frame.
+ */
+static nrf_802154_ser_err_t rx_batch_add(
+    const nrf_802154_spinel_received_timestamp_raw_args_t * p_rx)
+{
+    uint32_t crit_sect;
+    uint8_t  count;
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    count             = m_rx_batch_count;
+    m_rx_batch[count] = *p_rx;
+    count++;
+    m_rx_batch_count  = count;
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+    if (count >= NRF_802154_SER_RX_BATCH_MAX_COUNT)
+    {
+        return rx_batch_flush();
+    }
+
+    if (count == 1U)
+    {
+        if (!m_rx_batch_timer_initialized)
+        {
+            nrf_802154_sl_timer_init(&m_rx_batch_timer);
+            m_rx_batch_timer_initialized = true;
+        }
+
+        (void)nrf_802154_sl_timer_remove(&m_rx_batch_timer);
+
+        m_rx_batch_timer.trigger_time = nrf_802154_sl_timer_current_time_get() +
+                                        NRF_802154_SER_RX_BATCH_MAX_LATENCY_US;
+        m_rx_batch_timer.action_type              = NRF_802154_SL_TIMER_ACTION_TYPE_CALLBACK;
+        m_rx_batch_timer.action.callback.callback = rx_batch_timeout;
+
+        nrf_802154_sl_timer_ret_t ret;
+
+        ret = nrf_802154_sl_timer_add(&m_rx_batch_timer);
+
+        if (ret != NRF_802154_SL_TIMER_RET_SUCCESS)
+        {
+            // The latency bound cannot be guaranteed, send the frame immediately
+            return rx_batch_flush();
+        }
+    }
+
+    return NRF_802154_SERIALIZATION_ERROR_OK;
+}
+
+#else // NRF_802154_SER_RX_BATCH_ENABLED
+
+static inline nrf_802154_ser_err_t rx_batch_flush(void)
+{
+    return NRF_802154_SERIALIZATION_ERROR_OK;
+}
+
+#endif // NRF_802154_SER_RX_BATCH_ENABLED
+
+/**
+ * @brief Flushes the received frames that must be notified before an urgent notification.
+ *
+ * With the priority lanes, urgent notifications are not ordered with the received frames,
+ * so they do not wait for the coalesced frames to be sent.
+ */
+static inline nrf_802154_ser_err_t urgent_notification_rx_flush(void)
+{
+#if NRF_802154_SER_PRIORITY_LANES_ENABLED
+    return NRF_802154_SERIALIZATION_ERROR_OK;
+#else
+    return rx_batch_flush();
+#endif
+}
+
+#if NRF_802154_SER_COMPACT_NOTIFICATIONS_ENABLED && !NRF_802154_SER_RX_BATCH_ENABLED
+
+/**@brief Values of the previous compact received frame notification. */
+static nrf_802154_spinel_compact_ref_t m_rx_compact_ref;
+
+/**
+ * @brief Sends a received frame notification encoded against the previous one.
+ *
+ * @param[in]  p_rx  Received frame to notify.
+ */
+static nrf_802154_ser_err_t rx_compact_send(
+    const nrf_802154_spinel_received_timestamp_raw_args_t * p_rx)
+{
+    nrf_802154_spinel_received_timestamp_raw_compact_args_t compact =
+    {
+        .p_rx  = p_rx,
+        .p_ref = &m_rx_compact_ref,
+    };
+
+    nrf_802154_ser_err_t res = nrf_802154_spinel_send_encoded(
+        nrf_802154_spinel_codec_received_timestamp_raw_compact_encode,
+        &compact);
+
+    if (res < 0)
+    {
+        // It is unknown if the application core decoded the frame, so the next
+        // notification carries the full values
+        m_rx_compact_ref.valid = false;
+    }
+    else
+    {
+        nrf_802154_spinel_codec_compact_ref_update(&m_rx_compact_ref, p_rx);
+    }
+
+    return res;
+}
+
+#endif // NRF_802154_SER_COMPACT_NOTIFICATIONS_ENABLED && !NRF_802154_SER_RX_BATCH_ENABLED
+
 static void local_transmitted_frame_ptr_free(void * p_frame)
 {
     SERIALIZATION_ERROR_INIT(error);
@@ -81,16 +332,35 @@ bail:
     return;
 }
 
+nrf_802154_ser_err_t nrf_802154_spinel_send_prop_last_status_is(spinel_status_t status)
+{
+    uint8_t tid = nrf_802154_spinel_decoded_cmd_tid_get();
+
+    if ((tid == NRF_802154_SPINEL_TID_FIRE_AND_FORGET) && (status == SPINEL_STATUS_OK))
+    {
+        // The application core does not wait for the status of fire-and-forget requests
+        return NRF_802154_SERIALIZATION_ERROR_OK;
+    }
+
+    return nrf_802154_spinel_send_cmd_prop_value_is_tid(tid,
+                                                        SPINEL_PROP_LAST_STATUS,
+                                                        SPINEL_DATATYPE_SPINEL_PROP_LAST_STATUS,
+                                                        status);
+}
+
 void nrf_802154_cca_done(bool channel_free)
 {
     nrf_802154_ser_err_t res;
 
     SERIALIZATION_ERROR_INIT(error);
 
+    res = urgent_notification_rx_flush();
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
     NRF_802154_SPINEL_LOG_VAR_NAMED("%s", channel_free ? "true" : "false", "channel_free");
 
-    res = nrf_802154_spinel_send_cmd_prop_value_is(
+    res = nrf_802154_spinel_send_cmd_prop_value_is_urgent(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CCA_DONE,
         SPINEL_DATATYPE_NRF_802154_CCA_DONE,
         channel_free);
@@ -109,10 +379,13 @@ void nrf_802154_cca_failed(nrf_802154_cca_error_t err)
 
     SERIALIZATION_ERROR_INIT(error);
 
+    res = urgent_notification_rx_flush();
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
     NRF_802154_SPINEL_LOG_VAR("%u", err);
 
-    res = nrf_802154_spinel_send_cmd_prop_value_is(
+    res = nrf_802154_spinel_send_cmd_prop_value_is_urgent(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CCA_FAILED,
         SPINEL_DATATYPE_NRF_802154_CCA_FAILED,
         err);
@@ -131,6 +404,9 @@ void nrf_802154_energy_detected(uint8_t result)
 
     SERIALIZATION_ERROR_INIT(error);
 
+    res = rx_batch_flush();
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
     NRF_802154_SPINEL_LOG_VAR("%u", result);
 
@@ -147,12 +423,44 @@ bail:
     return;
 }
 
+void nrf_802154_energy_scan_done(uint32_t        channel_mask,
+                                 const uint8_t * p_results,
+                                 uint8_t         results_count)
+{
+    nrf_802154_ser_err_t res;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    res = rx_batch_flush();
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_VAR("%u", results_count);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_is(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_SCAN_DONE,
+        SPINEL_DATATYPE_NRF_802154_ENERGY_SCAN_DONE,
+        channel_mask,
+        p_results,
+        (size_t)results_count);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return;
+}
+
 void nrf_802154_energy_detection_failed(nrf_802154_ed_error_t err)
 {
     nrf_802154_ser_err_t res;
 
     SERIALIZATION_ERROR_INIT(error);
 
+    res = rx_batch_flush();
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
     NRF_802154_SPINEL_LOG_VAR("%u", err);
 
@@ -189,7 +497,16 @@ static nrf_802154_ser_err_t last_tx_ack_started_send(void)
     {
         mp_last_tx_ack = NULL;
 
-        res = nrf_802154_spinel_send_cmd_prop_value_is(
+        // Frames received before the Ack was sent must be notified first, unless the Ack
+        // notification takes the urgent lane
+        res = urgent_notification_rx_flush();
+
+        if (res < 0)
+        {
+            return res;
+        }
+
+        res = nrf_802154_spinel_send_cmd_prop_value_is_urgent(
             SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_ACK_STARTED,
             SPINEL_DATATYPE_NRF_802154_TX_ACK_STARTED,
             p_last_tx_ack,
@@ -227,14 +544,65 @@ void nrf_802154_received_timestamp_raw(uint8_t * p_data,
         SERIALIZATION_ERROR(NRF_802154_SERIALIZATION_ERROR_NO_MEMORY, error, bail);
     }
 
-    // Serialize the call
-    res = nrf_802154_spinel_send_cmd_prop_value_is(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW,
-        SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW,
-        NRF_802154_HDATA_ENCODE(local_data_handle, p_data, p_data[0]),
-        power,
-        lqi,
-        time);
+    nrf_802154_spinel_received_timestamp_raw_args_t rx =
+    {
+        .frame_handle = local_data_handle,
+        .p_frame      = p_data,
+        .hdata_len    = NRF_802154_HDATA_LENGTH(p_data[0]),
+        .power        = power,
+        .lqi          = lqi,
+        .timestamp    = time,
+    };
+
+#if NRF_802154_SER_SHARED_MEM_ENABLED
+    if (nrf_802154_serialization_shared_mem_contains(p_data, (size_t)p_data[0] + 1U))
+    {
+        // The frame is accessible by the application core, send only its address.
+        // Pending frames are sent first to keep them ordered.
+        res = rx_batch_flush();
+
+        if (res >= 0)
+        {
+            res = nrf_802154_spinel_send_cmd_prop_value_is(
+                SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW_SHARED,
+                SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW_SHARED,
+                local_data_handle,
+                (uint32_t)(uintptr_t)p_data,
+                power,
+                lqi,
+                time);
+        }
+
+        if (res < 0)
+        {
+            // Serialization failed. Drop the frame, clean up and throw an error
+            nrf_802154_buffer_mgr_src_remove_by_buffer_handle(
+                nrf_802154_spinel_src_buffer_mgr_get(),
+                local_data_handle);
+
+            nrf_802154_buffer_free_raw(p_data);
+
+            SERIALIZATION_ERROR(res, error, bail);
+        }
+
+        goto bail;
+    }
+#endif
+
+#if NRF_802154_SER_RX_BATCH_ENABLED
+    // Coalesce the frame with the following ones. Frames that cannot be sent
+    // are released by the batching logic.
+    res = rx_batch_add(&rx);
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+#else
+    // Serialize the call. This happens for every received frame, so the generic encoder
+    // is skipped.
+#if NRF_802154_SER_COMPACT_NOTIFICATIONS_ENABLED
+    res = rx_compact_send(&rx);
+#else
+    res = nrf_802154_spinel_send_encoded(nrf_802154_spinel_codec_received_timestamp_raw_encode,
+                                         &rx);
+#endif
 
     if (res < 0)
     {
@@ -246,6 +614,7 @@ void nrf_802154_received_timestamp_raw(uint8_t * p_data,
 
         SERIALIZATION_ERROR(res, error, bail);
     }
+#endif
 
 bail:
     SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
@@ -262,6 +631,9 @@ void nrf_802154_receive_failed(nrf_802154_rx_error_t error, uint32_t id)
     res = last_tx_ack_started_send();
     SERIALIZATION_ERROR_CHECK(res, ser_error, bail);
 
+    res = rx_batch_flush();
+    SERIALIZATION_ERROR_CHECK(res, ser_error, bail);
+
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
     NRF_802154_SPINEL_LOG_VAR("%u", error);
 
@@ -287,6 +659,10 @@ void nrf_802154_transmitted_raw(uint8_t                                   * p_fr
 
     SERIALIZATION_ERROR_INIT(error);
 
+    nrf_802154_ser_err_t res = urgent_notification_rx_flush();
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
     NRF_802154_SPINEL_LOG_BUFF(p_frame, p_frame[0]);
 
@@ -319,7 +695,7 @@ void nrf_802154_transmitted_raw(uint8_t                                   * p_fr
     }
 
     // Serialize the call
-    nrf_802154_ser_err_t res = nrf_802154_spinel_send_cmd_prop_value_is(
+    res = nrf_802154_spinel_send_cmd_prop_value_is_urgent(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMITTED_RAW,
         SPINEL_DATATYPE_NRF_802154_TRANSMITTED_RAW,
         NRF_802154_TRANSMITTED_RAW_ENCODE(remote_frame_handle, p_frame, *p_metadata, ack_handle));
@@ -344,6 +720,10 @@ void nrf_802154_transmit_failed(uint8_t                                   * p_fr
 
     SERIALIZATION_ERROR_INIT(error);
 
+    nrf_802154_ser_err_t res = urgent_notification_rx_flush();
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
     NRF_802154_SPINEL_LOG_BUFF(p_frame, p_frame[0]);
 
@@ -360,7 +740,7 @@ void nrf_802154_transmit_failed(uint8_t                                   * p_fr
                            bail);
 
     // Serialize the call
-    nrf_802154_ser_err_t res = nrf_802154_spinel_send_cmd_prop_value_is(
+    res = nrf_802154_spinel_send_cmd_prop_value_is_urgent(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_FAILED,
         SPINEL_DATATYPE_NRF_802154_TRANSMIT_FAILED,
         NRF_802154_TRANSMIT_FAILED_ENCODE(remote_frame_handle, p_frame, tx_error, *p_metadata));
@@ -382,6 +762,12 @@ bail:
 void nrf_802154_spinel_net_module_reset(void)
 {
     mp_last_tx_ack = NULL;
+#if NRF_802154_SER_RX_BATCH_ENABLED
+    m_rx_batch_count = 0U;
+#endif
+#if NRF_802154_SER_COMPACT_NOTIFICATIONS_ENABLED && !NRF_802154_SER_RX_BATCH_ENABLED
+    m_rx_compact_ref.valid = false;
+#endif
 }
 
 #endif
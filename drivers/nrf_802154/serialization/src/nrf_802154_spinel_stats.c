@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file nrf_802154_spinel_stats.c
+ * @brief Statistics of the 802.15.4 serialization link.
+ */
+
+#include "nrf_802154_serialization_config.h"
+
+#if NRF_802154_SER_STATS_ENABLED
+
+#include <stdint.h>
+#include <string.h>
+
+#include "../spinel_base/spinel.h"
+#include "nrf_802154_spinel.h"
+#include "nrf_802154_spinel_codec.h"
+#include "nrf_802154_spinel_datatypes.h"
+#include "nrf_802154_spinel_stats.h"
+#include "nrf_802154_serialization_stats.h"
+#include "nrf_802154_serialization_crit_sect.h"
+#include "nrf_802154_buffer_allocator.h"
+#include "nrf_802154_buffer_mgr_dst.h"
+
+#if CONFIG_NRF_802154_SER_HOST
+#include "nrf_802154_serialization_local_time.h"
+#endif
+
+/**@brief Number of property statistics entries: one per vendor property and one shared. */
+#define PROP_STATS_COUNT \
+    (1U + SPINEL_PROP_VENDOR_NORDIC_NRF_802154__END - SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN)
+
+/**@brief Index of the entry shared by the properties outside of the vendor range. */
+#define PROP_STATS_OTHER_INDEX 0U
+
+/**@brief Statistics of the link. */
+static nrf_802154_serialization_stats_t m_stats;
+
+/**@brief Statistics of the properties, indexed with @ref prop_stats_index. */
+static nrf_802154_serialization_prop_stats_t m_prop_stats[PROP_STATS_COUNT];
+
+#if CONFIG_NRF_802154_SER_HOST
+
+/**@brief Property of the request whose round trip time is measured. */
+static spinel_prop_key_t m_await_property;
+
+/**@brief Local time the request whose round trip time is measured was started at. */
+static uint64_t m_await_start;
+
+#endif // CONFIG_NRF_802154_SER_HOST
+
+/**
+ * @brief Gets index of a property in @ref m_prop_stats.
+ *
+ * @param[in]  property  Spinel property.
+ *
+ * @returns  Index of the entry holding statistics of @p property.
+ */
+static size_t prop_stats_index(spinel_prop_key_t property)
+{
+    // Properties below the vendor range wrap around to large values
+    uint32_t offset = (uint32_t)property - (uint32_t)SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN;
+
+    if (offset >= (PROP_STATS_COUNT - 1U))
+    {
+        return PROP_STATS_OTHER_INDEX;
+    }
+
+    return offset + 1U;
+}
+
+/**
+ * @brief Gets property carried by an encoded spinel frame.
+ *
+ * @param[in]  p_frame    Pointer to the encoded spinel frame.
+ * @param[in]  frame_len  Size of the @p p_frame buffer.
+ *
+ * @returns  Property carried by the frame or @c SPINEL_PROP_LAST_STATUS if the frame could not
+ *           be decoded. Either counts towards the shared entry.
+ */
+static spinel_prop_key_t frame_property_get(const void * p_frame, size_t frame_len)
+{
+    spinel_command_t  cmd;
+    spinel_prop_key_t property = SPINEL_PROP_LAST_STATUS;
+    const void      * p_cmd_data;
+    size_t            cmd_data_len;
+    const void      * p_property_data;
+    size_t            property_data_len;
+
+    if ((nrf_802154_spinel_codec_cmd_decode(p_frame,
+                                            frame_len,
+                                            &cmd,
+                                            &p_cmd_data,
+                                            &cmd_data_len) < 0) ||
+        (nrf_802154_spinel_codec_prop_decode(p_cmd_data,
+                                             cmd_data_len,
+                                             &property,
+                                             &p_property_data,
+                                             &property_data_len) < 0))
+    {
+        return SPINEL_PROP_LAST_STATUS;
+    }
+
+    return property;
+}
+
+void nrf_802154_spinel_stats_frame_sent(const void * p_frame, size_t frame_len)
+{
+    nrf_802154_serialization_prop_stats_t * p_prop_stats;
+    uint32_t                                crit_sect;
+
+    p_prop_stats = &m_prop_stats[prop_stats_index(frame_property_get(p_frame, frame_len))];
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    m_stats.sent_frames++;
+    m_stats.sent_bytes += frame_len;
+    p_prop_stats->sent_frames++;
+    p_prop_stats->sent_bytes += frame_len;
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+}
+
+void nrf_802154_spinel_stats_frame_received(const void * p_frame, size_t frame_len)
+{
+    nrf_802154_serialization_prop_stats_t * p_prop_stats;
+    uint32_t                                crit_sect;
+
+    p_prop_stats = &m_prop_stats[prop_stats_index(frame_property_get(p_frame, frame_len))];
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    m_stats.received_frames++;
+    m_stats.received_bytes += frame_len;
+    p_prop_stats->received_frames++;
+    p_prop_stats->received_bytes += frame_len;
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+}
+
+#if CONFIG_NRF_802154_SER_HOST
+
+void nrf_802154_spinel_stats_await_begin(spinel_prop_key_t property)
+{
+    m_await_property = property;
+    m_await_start    = nrf_802154_serialization_local_time_get();
+}
+
+void nrf_802154_spinel_stats_await_end(bool received)
+{
+    nrf_802154_serialization_prop_stats_t * p_prop_stats;
+    uint64_t                                elapsed;
+    uint32_t                                crit_sect;
+
+    elapsed      = nrf_802154_serialization_local_time_get() - m_await_start;
+    p_prop_stats = &m_prop_stats[prop_stats_index(m_await_property)];
+
+    if (elapsed > UINT32_MAX)
+    {
+        elapsed = UINT32_MAX;
+    }
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    bool first = (p_prop_stats->awaited == p_prop_stats->await_timeouts);
+
+    p_prop_stats->awaited++;
+
+    if (!received)
+    {
+        p_prop_stats->await_timeouts++;
+    }
+    else
+    {
+        if (first || (elapsed < p_prop_stats->await_min_us))
+        {
+            p_prop_stats->await_min_us = (uint32_t)elapsed;
+        }
+
+        if (elapsed > p_prop_stats->await_max_us)
+        {
+            p_prop_stats->await_max_us = (uint32_t)elapsed;
+        }
+
+        p_prop_stats->await_total_us += elapsed;
+    }
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+}
+
+#endif // CONFIG_NRF_802154_SER_HOST
+
+void nrf_802154_serialization_stats_get(nrf_802154_serialization_stats_t * p_stats)
+{
+    uint32_t crit_sect;
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+    *p_stats = m_stats;
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+    p_stats->buffers_peak = (uint32_t)nrf_802154_buffer_allocator_peak_usage_get(
+        &nrf_802154_spinel_dst_buffer_mgr_get()->allocator);
+}
+
+void nrf_802154_serialization_prop_stats_get(uint32_t                                property,
+                                             nrf_802154_serialization_prop_stats_t * p_stats)
+{
+    uint32_t crit_sect;
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+    *p_stats = m_prop_stats[prop_stats_index((spinel_prop_key_t)property)];
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+}
+
+void nrf_802154_serialization_stats_reset(void)
+{
+    uint32_t crit_sect;
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+    memset(&m_stats, 0, sizeof(m_stats));
+    memset(m_prop_stats, 0, sizeof(m_prop_stats));
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+    nrf_802154_buffer_allocator_peak_usage_reset(&nrf_802154_spinel_dst_buffer_mgr_get()->allocator);
+}
+
+#endif // NRF_802154_SER_STATS_ENABLED
@@ -215,6 +215,15 @@ void nrf_802154_sl_timer_module_uninit(void);
  */
 uint64_t nrf_802154_sl_timer_current_time_get(void);
 
+/**@brief Gets the precision with which timers are scheduled.
+ *
+ * A timer triggers no earlier than at its @ref nrf_802154_sl_timer_t::trigger_time, but
+ * the trigger may be delayed by up to the returned value, in addition to the latency of ISRs.
+ *
+ * @return Scheduling precision in microseconds.
+ */
+uint32_t nrf_802154_sl_timer_precision_get(void);
+
 /**@brief Initializes a timer instance.
  *
  * This function plays a role of a constructor. It should be called once
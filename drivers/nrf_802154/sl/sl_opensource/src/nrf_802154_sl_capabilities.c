@@ -36,5 +36,5 @@
 
 nrf_802154_sl_capabilities_t nrf_802154_sl_capabilities_get(void)
 {
-    return 0;
+    return NRF_802154_SL_CAPABILITY_MULTITIMER;
 }
@@ -41,10 +41,37 @@
 
 #include "rsch/nrf_802154_rsch.h"
 #include "platform/nrf_802154_clock.h"
+#include "nrf_802154_sl_timer.h"
+#include "nrf_802154_sl_utils.h"
+
+/**@brief States of a delayed timeslot slot. */
+typedef enum
+{
+    DLY_TS_STATE_FREE,      ///< The slot is not used.
+    DLY_TS_STATE_SCHEDULED, ///< The timeslot is requested and waits for its trigger time.
+    DLY_TS_STATE_STARTED,   ///< The timeslot has started and waits to be cancelled by its owner.
+} dly_ts_state_t;
+
+/**@brief Delayed timeslot kept by the scheduler. */
+typedef struct
+{
+    rsch_dly_ts_param_t     param; ///< Parameters of the request.
+    nrf_802154_sl_timer_t   timer; ///< Timer notifying the start of the timeslot.
+    volatile dly_ts_state_t state; ///< State of the slot.
+} dly_ts_t;
 
 static rsch_prio_t m_prev_prio;
+static rsch_prio_t m_core_prio; ///< Priority requested by the core.
 static bool        m_ready;
 
+static dly_ts_t   m_dly_ts[NRF_802154_RSCH_DLY_TS_SLOTS]; ///< Delayed timeslots.
+static dly_ts_t * mp_dly_ts_current;                      ///< Delayed timeslot whose start is being notified.
+
+#if defined(NRF52_SERIES)
+static nrf_802154_sl_timer_t m_ppi_timer;   ///< Timer triggering the PPI of a started timeslot.
+static uint32_t              m_ppi_channel; ///< PPI channel triggered by @ref m_ppi_timer.
+#endif
+
 /**
  * @brief Notifies the core that the approved RSCH priority has changed.
  *
@@ -55,19 +82,162 @@ static bool        m_ready;
  */
 extern void nrf_802154_rsch_crit_sect_prio_changed(rsch_prio_t prio);
 
+/***************************************************************************************************
+ * Private functions
+ **************************************************************************************************/
+
+/** @brief Gets the maximum number of delayed timeslots of the given operation type. */
+static uint32_t dly_ts_op_slots_get(rsch_dly_ts_op_t op)
+{
+    switch (op)
+    {
+        case RSCH_DLY_TS_OP_DTX:
+            return NRF_802154_RSCH_DLY_TS_OP_DTX_SLOTS;
+
+        case RSCH_DLY_TS_OP_DRX:
+            return NRF_802154_RSCH_DLY_TS_OP_DRX_SLOTS;
+
+        case RSCH_DLY_TS_OP_CSMACA:
+            return NRF_802154_RSCH_DLY_TS_OP_CSMACA_SLOTS;
+
+        default:
+            return 0U;
+    }
+}
+
+/** @brief Searches for a used delayed timeslot with the given identifier. */
+static dly_ts_t * dly_ts_by_id_search(rsch_dly_ts_id_t id)
+{
+    for (uint32_t i = 0; i < NRF_802154_RSCH_DLY_TS_SLOTS; i++)
+    {
+        if ((m_dly_ts[i].state != DLY_TS_STATE_FREE) && (m_dly_ts[i].param.id == id))
+        {
+            return &m_dly_ts[i];
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Gets the highest priority of all requested delayed timeslots.
+ *
+ * Preconditions of delayed timeslots are requested as soon as the timeslots are requested and are
+ * held until the last of them is cancelled, so closely spaced timeslots share a single grant.
+ */
+static rsch_prio_t dly_ts_prio_get(void)
+{
+    rsch_prio_t prio = RSCH_PRIO_IDLE;
+
+    for (uint32_t i = 0; i < NRF_802154_RSCH_DLY_TS_SLOTS; i++)
+    {
+        if ((m_dly_ts[i].state != DLY_TS_STATE_FREE) && (m_dly_ts[i].param.prio > prio))
+        {
+            prio = m_dly_ts[i].param.prio;
+        }
+    }
+
+    return prio;
+}
+
+/** @brief Requests the higher of the priorities needed by the core and by delayed timeslots. */
+static void prio_update(void)
+{
+    rsch_prio_t prio     = m_core_prio;
+    rsch_prio_t dly_prio = dly_ts_prio_get();
+
+    if (dly_prio > prio)
+    {
+        prio = dly_prio;
+    }
+
+    if (m_prev_prio != prio)
+    {
+        if (prio == RSCH_PRIO_IDLE)
+        {
+            nrf_802154_clock_hfclk_stop();
+
+            m_ready = false;
+
+            nrf_802154_rsch_crit_sect_prio_changed(RSCH_PRIO_IDLE);
+        }
+        else if (m_prev_prio == RSCH_PRIO_IDLE)
+        {
+            assert(!m_ready);
+
+            nrf_802154_clock_hfclk_start();
+        }
+        else
+        {
+            // Intentionally empty
+        }
+
+        m_prev_prio = prio;
+    }
+}
+
+#if defined(NRF52_SERIES)
+/** @brief Triggers the task bound to the PPI channel of a started delayed timeslot. */
+static void ppi_timer_callback(nrf_802154_sl_timer_t * p_timer)
+{
+    (void)p_timer;
+
+    *(volatile uint32_t *)NRF_PPI->CH[m_ppi_channel].TEP = 1UL;
+}
+
+#endif
+
+/** @brief Notifies the owner of a delayed timeslot that the timeslot has started. */
+static void dly_ts_timer_callback(nrf_802154_sl_timer_t * p_timer)
+{
+    dly_ts_t * p_dly_ts = (dly_ts_t *)p_timer->user_data.p_pointer;
+
+    if (p_dly_ts->state != DLY_TS_STATE_SCHEDULED)
+    {
+        return;
+    }
+
+    p_dly_ts->state   = DLY_TS_STATE_STARTED;
+    mp_dly_ts_current = p_dly_ts;
+
+    p_dly_ts->param.started_callback(p_dly_ts->param.id);
+
+    mp_dly_ts_current = NULL;
+}
+
 /***************************************************************************************************
  * Public API
  **************************************************************************************************/
 
 void nrf_802154_rsch_init(void)
 {
-    m_ready     = false;
-    m_prev_prio = RSCH_PRIO_IDLE;
+    m_ready           = false;
+    m_prev_prio       = RSCH_PRIO_IDLE;
+    m_core_prio       = RSCH_PRIO_IDLE;
+    mp_dly_ts_current = NULL;
+
+    for (uint32_t i = 0; i < NRF_802154_RSCH_DLY_TS_SLOTS; i++)
+    {
+        m_dly_ts[i].state = DLY_TS_STATE_FREE;
+        nrf_802154_sl_timer_init(&m_dly_ts[i].timer);
+    }
+
+#if defined(NRF52_SERIES)
+    nrf_802154_sl_timer_init(&m_ppi_timer);
+#endif
 }
 
 void nrf_802154_rsch_uninit(void)
 {
-    // Intenionally empty
+    for (uint32_t i = 0; i < NRF_802154_RSCH_DLY_TS_SLOTS; i++)
+    {
+        nrf_802154_sl_timer_deinit(&m_dly_ts[i].timer);
+        m_dly_ts[i].state = DLY_TS_STATE_FREE;
+    }
+
+#if defined(NRF52_SERIES)
+    nrf_802154_sl_timer_deinit(&m_ppi_timer);
+#endif
 }
 
 void nrf_802154_rsch_continuous_ended(void)
@@ -86,7 +256,7 @@ bool nrf_802154_rsch_timeslot_request(uint32_t length_us)
 
 bool nrf_802154_rsch_timeslot_is_requested(void)
 {
-    return false;
+    return dly_ts_prio_get() != RSCH_PRIO_IDLE;
 }
 
 bool nrf_802154_rsch_prec_is_approved(rsch_prec_t prec, rsch_prio_t prio)
@@ -107,29 +277,9 @@ void nrf_802154_clock_hfclk_ready(void)
 
 void nrf_802154_rsch_crit_sect_prio_request(rsch_prio_t prio)
 {
-    if (m_prev_prio != prio)
-    {
-        if (prio == RSCH_PRIO_IDLE)
-        {
-            nrf_802154_clock_hfclk_stop();
-
-            m_ready = false;
-
-            nrf_802154_rsch_crit_sect_prio_changed(RSCH_PRIO_IDLE);
-        }
-        else if (m_prev_prio == RSCH_PRIO_IDLE)
-        {
-            assert(!m_ready);
+    m_core_prio = prio;
 
-            nrf_802154_clock_hfclk_start();
-        }
-        else
-        {
-            // Intentionally empty
-        }
-
-        m_prev_prio = prio;
-    }
+    prio_update();
 }
 
 void nrf_802154_rsch_crit_sect_init(void)
@@ -159,31 +309,160 @@ void nrf_802154_critical_section_rsch_process_pending(void)
 
 bool nrf_802154_rsch_delayed_timeslot_request(const rsch_dly_ts_param_t * p_dly_ts_param)
 {
-    (void)p_dly_ts_param;
+    dly_ts_t                         * p_dly_ts = NULL;
+    uint32_t                           op_used  = 0U;
+    nrf_802154_sl_mcu_critical_state_t mcu_cs;
 
-    return false;
+#if !defined(NRF52_SERIES)
+    if (p_dly_ts_param->ppi_trigger_en)
+    {
+        // Triggering DPPI channels from software is not supported by this implementation
+        return false;
+    }
+#endif
+
+    if ((p_dly_ts_param->type == RSCH_DLY_TS_TYPE_PRECISE) &&
+        !nrf_802154_sl_time64_is_in_future(nrf_802154_sl_timer_current_time_get(),
+                                           p_dly_ts_param->trigger_time))
+    {
+        return false;
+    }
+
+    nrf_802154_sl_mcu_critical_enter(mcu_cs);
+
+    for (uint32_t i = 0; i < NRF_802154_RSCH_DLY_TS_SLOTS; i++)
+    {
+        if (m_dly_ts[i].state == DLY_TS_STATE_FREE)
+        {
+            if (p_dly_ts == NULL)
+            {
+                p_dly_ts = &m_dly_ts[i];
+            }
+        }
+        else if (m_dly_ts[i].param.op == p_dly_ts_param->op)
+        {
+            op_used++;
+        }
+    }
+
+    if ((p_dly_ts == NULL) || (op_used >= dly_ts_op_slots_get(p_dly_ts_param->op)))
+    {
+        nrf_802154_sl_mcu_critical_exit(mcu_cs);
+        return false;
+    }
+
+    p_dly_ts->param = *p_dly_ts_param;
+    p_dly_ts->state = DLY_TS_STATE_SCHEDULED;
+
+    nrf_802154_sl_mcu_critical_exit(mcu_cs);
+
+    prio_update();
+
+    p_dly_ts->timer.trigger_time             = p_dly_ts_param->trigger_time;
+    p_dly_ts->timer.user_data.p_pointer      = p_dly_ts;
+    p_dly_ts->timer.action_type              = NRF_802154_SL_TIMER_ACTION_TYPE_CALLBACK;
+    p_dly_ts->timer.action.callback.callback = dly_ts_timer_callback;
+
+    if (nrf_802154_sl_timer_add(&p_dly_ts->timer) != NRF_802154_SL_TIMER_RET_SUCCESS)
+    {
+        p_dly_ts->state = DLY_TS_STATE_FREE;
+        prio_update();
+
+        return false;
+    }
+
+    return true;
 }
 
 bool nrf_802154_rsch_delayed_timeslot_cancel(rsch_dly_ts_id_t dly_ts_id, bool handler)
 {
-    (void)dly_ts_id;
-    (void)handler;
+    dly_ts_t * p_dly_ts = dly_ts_by_id_search(dly_ts_id);
 
-    return false;
+    if (p_dly_ts == NULL)
+    {
+        return false;
+    }
+
+    if (handler)
+    {
+        assert(p_dly_ts->state == DLY_TS_STATE_STARTED);
+    }
+    else
+    {
+        (void)nrf_802154_sl_timer_remove(&p_dly_ts->timer);
+    }
+
+    p_dly_ts->state = DLY_TS_STATE_FREE;
+
+    prio_update();
+
+    return true;
 }
 
 bool nrf_802154_rsch_delayed_timeslot_priority_update(rsch_dly_ts_id_t dly_ts_id,
                                                       rsch_prio_t      dly_ts_prio)
 {
-    (void)dly_ts_id;
-    (void)dly_ts_prio;
+    dly_ts_t * p_dly_ts = dly_ts_by_id_search(dly_ts_id);
 
-    return false;
+    if (p_dly_ts == NULL)
+    {
+        return false;
+    }
+
+    p_dly_ts->param.prio = dly_ts_prio;
+
+    prio_update();
+
+    return true;
 }
 
 bool nrf_802154_rsch_delayed_timeslot_ppi_update(uint32_t ppi_channel)
 {
+#if defined(NRF52_SERIES)
+    dly_ts_t * p_dly_ts = mp_dly_ts_current;
+
+    if ((p_dly_ts == NULL) || !p_dly_ts->param.ppi_trigger_en)
+    {
+        return false;
+    }
+
+    uint64_t trigger_time = p_dly_ts->param.trigger_time + p_dly_ts->param.ppi_trigger_dly;
+
+    (void)nrf_802154_sl_timer_remove(&m_ppi_timer);
+
+    if (!nrf_802154_sl_time64_is_in_future(nrf_802154_sl_timer_current_time_get(),
+                                           trigger_time))
+    {
+        return false;
+    }
+
+    m_ppi_channel                        = ppi_channel;
+    m_ppi_timer.trigger_time             = trigger_time;
+    m_ppi_timer.action_type              = NRF_802154_SL_TIMER_ACTION_TYPE_CALLBACK;
+    m_ppi_timer.action.callback.callback = ppi_timer_callback;
+
+    return nrf_802154_sl_timer_add(&m_ppi_timer) == NRF_802154_SL_TIMER_RET_SUCCESS;
+#else
     (void)ppi_channel;
 
     return false;
+#endif
+}
+
+bool nrf_802154_rsch_delayed_timeslot_time_to_start_get(rsch_dly_ts_id_t dly_ts_id,
+                                                        uint64_t       * p_time_to_start)
+{
+    dly_ts_t * p_dly_ts = dly_ts_by_id_search(dly_ts_id);
+
+    if ((p_dly_ts == NULL) || (p_dly_ts->state != DLY_TS_STATE_SCHEDULED))
+    {
+        return false;
+    }
+
+    uint64_t now = nrf_802154_sl_timer_current_time_get();
+
+    *p_time_to_start = nrf_802154_sl_time64_is_in_future(now, p_dly_ts->param.trigger_time) ?
+                       (p_dly_ts->param.trigger_time - now) : 0U;
+
+    return true;
 }
@@ -34,6 +34,7 @@
 
 #include "nrf_802154_sl_utils.h"
 
+#include <stddef.h>
 #include <stdlib.h>
 #include <stdint.h>
 
@@ -42,10 +43,69 @@
 
 #include "nrf_802154_sl_timer.h"
 
+/**@brief Node of the list of active timers, placed in private fields of a timer.
+ *
+ * A timer is in the list of active timers if and only if @c p_next is not NULL.
+ */
+typedef struct timer_node_s
+{
+    struct timer_node_s * p_next; ///< Next node of the list.
+    struct timer_node_s * p_prev; ///< Previous node of the list.
+} timer_node_t;
+
+BUILD_ASSERT(sizeof(timer_node_t) <= sizeof(nrf_802154_sl_timer_priv_placeholder_t));
+BUILD_ASSERT(offsetof(nrf_802154_sl_timer_t, priv) == 0);
+
 static void timeout_handler(struct k_timer * timer_id);
 
 K_TIMER_DEFINE(timer, timeout_handler, NULL);
 
+/**@brief Sentinel of the circular list of active timers, sorted by trigger time. */
+static timer_node_t m_active_timers = {&m_active_timers, &m_active_timers};
+
+/**@brief Gets the list node of a timer. */
+static inline timer_node_t * timer_node_get(nrf_802154_sl_timer_t * p_timer)
+{
+    return (timer_node_t *)&p_timer->priv;
+}
+
+/**@brief Gets the timer containing a list node. */
+static inline nrf_802154_sl_timer_t * node_timer_get(timer_node_t * p_node)
+{
+    return (nrf_802154_sl_timer_t *)p_node;
+}
+
+/**@brief Unlinks a node from the list of active timers.
+ *
+ * @note This function must be called from a critical section.
+ */
+static void node_unlink(timer_node_t * p_node)
+{
+    p_node->p_prev->p_next = p_node->p_next;
+    p_node->p_next->p_prev = p_node->p_prev;
+    p_node->p_next         = NULL;
+    p_node->p_prev         = NULL;
+}
+
+/**@brief Starts the kernel timer for the earliest active timer or stops it if there is none.
+ *
+ * @note This function must be called from a critical section.
+ */
+static void kernel_timer_update(void)
+{
+    if (m_active_timers.p_next == &m_active_timers)
+    {
+        k_timer_stop(&timer);
+        return;
+    }
+
+    uint64_t trigger_time = node_timer_get(m_active_timers.p_next)->trigger_time;
+    uint64_t now          = nrf_802154_sl_timer_current_time_get();
+    uint64_t target       = (trigger_time > now) ? (trigger_time - now) : 1U;
+
+    k_timer_start(&timer, K_USEC(target), K_NO_WAIT);
+}
+
 void nrf_802154_timer_coord_init(void)
 {
     // Intentionally empty
@@ -73,7 +133,18 @@ void nrf_802154_sl_timer_module_init(void)
 
 void nrf_802154_sl_timer_module_uninit(void)
 {
-    // Intentionally empty
+    nrf_802154_sl_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_sl_mcu_critical_enter(mcu_cs);
+
+    while (m_active_timers.p_next != &m_active_timers)
+    {
+        node_unlink(m_active_timers.p_next);
+    }
+
+    k_timer_stop(&timer);
+
+    nrf_802154_sl_mcu_critical_exit(mcu_cs);
 }
 
 uint64_t nrf_802154_sl_timer_current_time_get(void)
@@ -81,60 +152,138 @@ uint64_t nrf_802154_sl_timer_current_time_get(void)
     return NRF_802154_SL_RTC_TICKS_TO_US(k_uptime_ticks());
 }
 
+uint32_t nrf_802154_sl_timer_precision_get(void)
+{
+    return NRF_802154_SL_US_PER_TICK;
+}
+
 void nrf_802154_sl_timer_init(nrf_802154_sl_timer_t * p_timer)
 {
-    // Intentionally empty
+    timer_node_t * p_node = timer_node_get(p_timer);
+
+    p_node->p_next = NULL;
+    p_node->p_prev = NULL;
 }
 
 void nrf_802154_sl_timer_deinit(nrf_802154_sl_timer_t * p_timer)
 {
-    // Intentionally empty
+    (void)nrf_802154_sl_timer_remove(p_timer);
 }
 
 nrf_802154_sl_timer_ret_t nrf_802154_sl_timer_add(nrf_802154_sl_timer_t * p_timer)
 {
-    uint64_t now    = nrf_802154_sl_timer_current_time_get();
-    int32_t  target = p_timer->trigger_time - now;
+    timer_node_t                     * p_node = timer_node_get(p_timer);
+    timer_node_t                     * p_pos;
+    nrf_802154_sl_mcu_critical_state_t mcu_cs;
 
-    target = MAX(target, 1);
+    if ((p_timer->action_type & NRF_802154_SL_TIMER_ACTION_TYPE_HARDWARE) != 0U)
+    {
+        // Triggering hardware tasks is not supported by this implementation
+        return NRF_802154_SL_TIMER_RET_BAD_REQUEST;
+    }
 
-    k_timer_user_data_set(&timer, p_timer); // Passing arguments is not supported.
-    k_timer_start(&timer, K_USEC(target), K_NO_WAIT);
+    nrf_802154_sl_mcu_critical_enter(mcu_cs);
 
-    return NRF_802154_SL_TIMER_RET_SUCCESS;
-}
+    assert(p_node->p_next == NULL);
 
-nrf_802154_sl_timer_ret_t nrf_802154_sl_timer_remove(nrf_802154_sl_timer_t * p_timer)
-{
-    nrf_802154_sl_timer_ret_t ret;
+    // Insert after the active timers that trigger no later than the added one, so that timers
+    // with equal trigger times fire in the order they were added
+    p_pos = m_active_timers.p_prev;
 
-    if (k_timer_status_get(&timer) > 0)
+    while ((p_pos != &m_active_timers) &&
+           (node_timer_get(p_pos)->trigger_time > p_timer->trigger_time))
     {
-        /* Timer has expired. */
-        ret = NRF_802154_SL_TIMER_RET_INACTIVE;
+        p_pos = p_pos->p_prev;
     }
-    else if (k_timer_remaining_get(&timer) == 0)
+
+    p_node->p_prev        = p_pos;
+    p_node->p_next        = p_pos->p_next;
+    p_pos->p_next->p_prev = p_node;
+    p_pos->p_next         = p_node;
+
+    if (m_active_timers.p_next == p_node)
     {
-        /* Timer was stopped (by someone else) before expiring. */
-        ret = NRF_802154_SL_TIMER_RET_INACTIVE;
+        kernel_timer_update();
     }
-    else
+
+    nrf_802154_sl_mcu_critical_exit(mcu_cs);
+
+    return NRF_802154_SL_TIMER_RET_SUCCESS;
+}
+
+nrf_802154_sl_timer_ret_t nrf_802154_sl_timer_remove(nrf_802154_sl_timer_t * p_timer)
+{
+    timer_node_t                     * p_node = timer_node_get(p_timer);
+    nrf_802154_sl_timer_ret_t          ret    = NRF_802154_SL_TIMER_RET_INACTIVE;
+    nrf_802154_sl_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_sl_mcu_critical_enter(mcu_cs);
+
+    if (p_node->p_next != NULL)
     {
-        /* Timer is still running. */
-        k_timer_stop(&timer);
+        bool was_first = (m_active_timers.p_next == p_node);
+
+        node_unlink(p_node);
+
+        if (was_first)
+        {
+            kernel_timer_update();
+        }
 
         ret = NRF_802154_SL_TIMER_RET_SUCCESS;
     }
 
+    nrf_802154_sl_mcu_critical_exit(mcu_cs);
+
     return ret;
 }
 
+nrf_802154_sl_timer_ret_t nrf_802154_sl_timer_update_ppi(nrf_802154_sl_timer_t * p_timer,
+                                                         uint32_t                ppi_chn)
+{
+    (void)p_timer;
+    (void)ppi_chn;
+
+    return NRF_802154_SL_TIMER_RET_BAD_REQUEST;
+}
+
 static void timeout_handler(struct k_timer * timer_id)
 {
-    nrf_802154_sl_timer_t * p_timer =
-        (nrf_802154_sl_timer_t *)k_timer_user_data_get(timer_id);
+    (void)timer_id;
+
+    while (true)
+    {
+        nrf_802154_sl_timer_t            * p_timer = NULL;
+        nrf_802154_sl_mcu_critical_state_t mcu_cs;
+
+        nrf_802154_sl_mcu_critical_enter(mcu_cs);
+
+        if (m_active_timers.p_next != &m_active_timers)
+        {
+            nrf_802154_sl_timer_t * p_first = node_timer_get(m_active_timers.p_next);
 
-    p_timer->action.callback.callback(p_timer);
+            if (p_first->trigger_time <= nrf_802154_sl_timer_current_time_get())
+            {
+                node_unlink(m_active_timers.p_next);
+                p_timer = p_first;
+            }
+            else
+            {
+                kernel_timer_update();
+            }
+        }
+
+        nrf_802154_sl_mcu_critical_exit(mcu_cs);
+
+        if (p_timer == NULL)
+        {
+            break;
+        }
+
+        // The callback is called outside of the critical section, so that it can add the timer
+        // again or manipulate other timers
+        p_timer->action.callback.callback(p_timer);
+    }
 }
 
 void nrf_802154_platform_sl_lp_timer_init(void)
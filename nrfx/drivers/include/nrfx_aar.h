@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_AAR_H__
+#define NRFX_AAR_H__
+
+#include <nrfx.h>
+#include <hal/nrf_aar.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_aar AAR driver
+ * @{
+ * @ingroup nrf_aar
+ * @brief   Accelerated Address Resolver (AAR) peripheral driver.
+ *
+ * The driver resolves batches of Bluetooth LE resolvable private addresses against a table
+ * of Identity Resolving Keys (IRKs) stored in RAM. The peripheral checks a limited number of
+ * IRKs in a single run, so larger tables are split into chunks of
+ * @ref NRFX_AAR_IRK_COUNT_MAX_PER_RUN IRKs, which are checked one after another in the interrupt
+ * context until the address is resolved or the whole table is checked.
+ *
+ * @note The AAR peripheral shares its registers and the AES core with the CCM peripheral.
+ *       Do not use CCM while the resolution is in progress.
+ */
+
+/** @brief Size of the Identity Resolving Key, in bytes. */
+#define NRFX_AAR_IRK_SIZE 16
+
+/** @brief Size of the Bluetooth LE device address, in bytes. */
+#define NRFX_AAR_ADDR_SIZE 6
+
+/** @brief Maximum number of IRKs checked by the peripheral in a single run. */
+#define NRFX_AAR_IRK_COUNT_MAX_PER_RUN 16
+
+/** @brief Index reported for an address that does not match any IRK. */
+#define NRFX_AAR_NOT_RESOLVED UINT16_MAX
+
+/** @brief Structure for AAR configuration. */
+typedef struct
+{
+    uint8_t interrupt_priority; ///< Interrupt priority.
+} nrfx_aar_config_t;
+
+/**
+ * @brief AAR default configuration.
+ *
+ * This configuration sets up the driver with the following options:
+ * - interrupt priority equal to @ref NRFX_AAR_DEFAULT_CONFIG_IRQ_PRIORITY
+ */
+#define NRFX_AAR_DEFAULT_CONFIG                                  \
+{                                                                \
+    .interrupt_priority = NRFX_AAR_DEFAULT_CONFIG_IRQ_PRIORITY,  \
+}
+
+/** @brief Structure describing the completed resolution of a batch of addresses. */
+typedef struct
+{
+    uint8_t const *  p_addrs;        ///< Pointer to the resolved addresses.
+    size_t           addr_count;     ///< Number of the resolved addresses.
+    uint16_t const * p_indices;      ///< Pointer to the indices of the IRKs matching the addresses, or @ref NRFX_AAR_NOT_RESOLVED.
+    size_t           resolved_count; ///< Number of addresses that matched an IRK.
+} nrfx_aar_evt_t;
+
+/**
+ * @brief AAR driver event handler type.
+ *
+ * @param[in] p_event   Pointer to the structure describing the resolution.
+ * @param[in] p_context User context.
+ */
+typedef void (* nrfx_aar_event_handler_t)(nrfx_aar_evt_t const * p_event, void * p_context);
+
+/**
+ * @brief Function for initializing the AAR driver.
+ *
+ * @param[in] p_config  Pointer to the structure with the initial configuration.
+ * @param[in] handler   Event handler provided by the user. Must not be NULL.
+ * @param[in] p_context Context passed to the event handler.
+ *
+ * @retval NRFX_SUCCESS                   Driver was successfully initialized.
+ * @retval NRFX_ERROR_ALREADY_INITIALIZED Driver was already initialized.
+ */
+nrfx_err_t nrfx_aar_init(nrfx_aar_config_t const * p_config,
+                         nrfx_aar_event_handler_t  handler,
+                         void *                    p_context);
+
+/**
+ * @brief Function for uninitializing the AAR driver.
+ *
+ * The resolution in progress is aborted and the event handler is not called for it.
+ */
+void nrfx_aar_uninit(void);
+
+/**
+ * @brief Function for starting the resolution of a batch of addresses.
+ *
+ * The addresses are resolved one after another. For every address, the index of the first
+ * matching IRK in @p p_irks is stored in @p p_indices, or @ref NRFX_AAR_NOT_RESOLVED if no IRK
+ * matches. The event handler is called when all addresses are resolved.
+ *
+ * The IRKs and the addresses are read by the peripheral with EasyDMA, so the IRK table must
+ * be placed in the Data RAM region. The IRKs and the addresses are expected in the byte order
+ * used by the peripheral. All buffers must stay valid until the event handler is called.
+ *
+ * @param[in]  p_irks     Pointer to the table of IRKs.
+ * @param[in]  irk_count  Number of IRKs in the table.
+ * @param[in]  p_addrs    Pointer to the consecutive addresses to resolve.
+ * @param[in]  addr_count Number of addresses to resolve.
+ * @param[out] p_indices  Pointer to the buffer for @p addr_count indices of the matching IRKs.
+ *
+ * @retval NRFX_SUCCESS             The resolution was started.
+ * @retval NRFX_ERROR_BUSY          Another resolution is in progress.
+ * @retval NRFX_ERROR_INVALID_ADDR  The IRK table is not placed in the Data RAM region.
+ * @retval NRFX_ERROR_INVALID_PARAM There are no IRKs or no addresses to resolve.
+ */
+nrfx_err_t nrfx_aar_resolve(uint8_t const * p_irks,
+                            uint16_t        irk_count,
+                            uint8_t const * p_addrs,
+                            size_t          addr_count,
+                            uint16_t *      p_indices);
+
+/**
+ * @brief Function for checking if a resolution is in progress.
+ *
+ * @retval true  A resolution is in progress.
+ * @retval false The driver is idle.
+ */
+bool nrfx_aar_is_busy(void);
+
+/** @} */
+
+
+void nrfx_aar_irq_handler(void);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_AAR_H__
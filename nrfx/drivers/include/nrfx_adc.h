@@ -60,6 +60,8 @@ typedef struct
 {
     nrf_adc_value_t * p_buffer; ///< Pointer to the buffer with converted samples.
     uint16_t          size;     ///< Number of samples in the buffer.
+    uint32_t          sequence; ///< Number of buffers completed since the ring conversion was started.
+    bool              overrun;  ///< True if the buffer was refilled in the ring mode before it was released.
 } nrfx_adc_done_evt_t;
 
 /** @brief SAMPLE event structure. */
@@ -252,6 +254,51 @@ nrfx_err_t nrfx_adc_sample_convert(nrfx_adc_channel_t const * p_channel,
  */
 nrfx_err_t nrfx_adc_buffer_convert(nrf_adc_value_t * buffer, uint16_t size);
 
+/**
+ * @brief Function for starting continuous conversion into a ring of buffers.
+ *
+ * In the ring mode every START task converts exactly one channel, and the enabled channels are
+ * sampled in turn in the order they were enabled. The END interrupt only stores the result and
+ * selects the next channel, so when the START task is triggered over (D)PPI by a TIMER, every
+ * sample is taken at a fixed point in time regardless of the interrupt latency. The interrupt
+ * must be handled before the next START task is triggered, otherwise the sample is lost.
+ *
+ * Each filled buffer is reported with @ref NRFX_ADC_EVT_DONE, and the driver continues with
+ * the next buffer of the ring without user interaction. Buffers must be returned with
+ * @ref nrfx_adc_ring_buffer_release once processed. A buffer that is reused while still unreleased
+ * is reported with the @p overrun flag set, like in the ring mode of the SAADC driver.
+ *
+ * @note The ring mode can be used only in non-blocking mode. The conversion continues
+ *       until @ref nrfx_adc_ring_stop is called.
+ *
+ * @param[in] p_buffers Pointer to the contiguous memory holding @p count buffers.
+ * @param[in] size      Number of samples in each buffer. Must be a multiple of the number
+ *                      of the enabled channels.
+ * @param[in] count     Number of buffers in the ring. Must be at least 2.
+ *
+ * @retval NRFX_SUCCESS              The conversion was started.
+ * @retval NRFX_ERROR_BUSY           The driver is busy.
+ * @retval NRFX_ERROR_INVALID_STATE  The driver is in blocking mode or no channel is enabled.
+ * @retval NRFX_ERROR_INVALID_PARAM  Less than two buffers were provided.
+ * @retval NRFX_ERROR_INVALID_LENGTH The buffer size is not a multiple of the number
+ *                                   of the enabled channels.
+ */
+nrfx_err_t nrfx_adc_ring_convert(nrf_adc_value_t * p_buffers, uint16_t size, uint8_t count);
+
+/**
+ * @brief Function for releasing the oldest ring buffer reported with @ref NRFX_ADC_EVT_DONE.
+ *
+ * Buffers are released in the order in which they were reported.
+ */
+void nrfx_adc_ring_buffer_release(void);
+
+/**
+ * @brief Function for stopping the ring conversion.
+ *
+ * The samples stored in the partially filled buffer are discarded.
+ */
+void nrfx_adc_ring_stop(void);
+
 /**
  * @brief Function for retrieving the ADC state.
  *
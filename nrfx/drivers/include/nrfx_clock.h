@@ -103,6 +103,34 @@ void nrfx_clock_start(nrf_clock_domain_t domain);
  */
 void nrfx_clock_stop(nrf_clock_domain_t domain);
 
+/**
+ * @brief Function for requesting HFCLK with the high-accuracy source.
+ *
+ * Requests are reference counted, so several independent users (for example the radio,
+ * USB and high-speed peripherals) can share the crystal oscillator without stopping it
+ * for each other. The oscillator is started on the first request only. The
+ * @ref NRFX_CLOCK_EVT_HFCLK_STARTED event is reported then, other users can check
+ * the state with @ref nrfx_clock_hfclk_is_running.
+ *
+ * @note Requests must not be mixed with direct @ref nrfx_clock_start() and
+ *       @ref nrfx_clock_stop() calls for the HFCLK domain.
+ */
+void nrfx_clock_hfclk_request(void);
+
+/**
+ * @brief Function for releasing HFCLK requested with @ref nrfx_clock_hfclk_request.
+ *
+ * The oscillator is stopped when the last request is released.
+ */
+void nrfx_clock_hfclk_release(void);
+
+/**
+ * @brief Function for getting the number of active HFCLK requests.
+ *
+ * @return Number of requests made with @ref nrfx_clock_hfclk_request and not released yet.
+ */
+uint32_t nrfx_clock_hfclk_request_count_get(void);
+
 /**
  * @brief Function for checking the specified clock domain state.
  *
@@ -121,9 +149,56 @@ NRFX_STATIC_INLINE bool nrfx_clock_is_running(nrf_clock_domain_t domain, void *
 
 #if defined(CLOCK_FEATURE_HFCLK_DIVIDE_PRESENT) || NRF_CLOCK_HAS_HFCLK192M || \
     defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Clock divider change handler prototype.
+ *
+ * Called from the context of @ref nrfx_clock_divider_set, after the new divider
+ * has taken effect. For the HFCLK domain, SystemCoreClock is already updated.
+ *
+ * @param[in] domain    Clock domain whose divider changed.
+ * @param[in] div       New divider of the clock domain.
+ * @param[in] p_context User context passed with the listener.
+ */
+typedef void (* nrfx_clock_divider_handler_t)(nrf_clock_domain_t    domain,
+                                              nrf_clock_hfclk_div_t div,
+                                              void *                p_context);
+
+/**
+ * @brief Clock divider change listener.
+ *
+ * The structure is owned by the caller and must stay valid as long as the listener
+ * is registered.
+ */
+typedef struct nrfx_clock_divider_listener_s
+{
+    nrfx_clock_divider_handler_t           handler;   ///< Handler called after the divider changes.
+    void *                                 p_context; ///< User context passed to the handler.
+    struct nrfx_clock_divider_listener_s * p_next;    ///< Next registered listener. For internal use only.
+} nrfx_clock_divider_listener_t;
+
+/**
+ * @brief Function for registering a listener notified about clock divider changes.
+ *
+ * Drivers whose timings depend on a divided clock (for example, delays or baud rate
+ * settings derived from the core clock) register here to re-derive them when
+ * @ref nrfx_clock_divider_set changes the divider.
+ *
+ * @param[in] p_listener Pointer to the listener. Must not be already registered.
+ */
+void nrfx_clock_divider_listener_add(nrfx_clock_divider_listener_t * p_listener);
+
+/**
+ * @brief Function for unregistering a clock divider change listener.
+ *
+ * @param[in] p_listener Pointer to the listener.
+ */
+void nrfx_clock_divider_listener_remove(nrfx_clock_divider_listener_t * p_listener);
+
 /**
  * @brief Function for setting the specified clock domain divider.
  *
+ * Registered divider listeners are notified after the divider is successfully changed.
+ *
  * @param[in] domain Clock domain.
  * @param[in] div    New divider for the clock domain.
  *
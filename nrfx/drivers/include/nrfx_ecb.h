@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_ECB_H__
+#define NRFX_ECB_H__
+
+#include <nrfx.h>
+#include <hal/nrf_ecb.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_ecb ECB driver
+ * @{
+ * @ingroup nrf_ecb
+ * @brief   AES Electronic Codebook mode encryption (ECB) peripheral driver.
+ *
+ * The driver shares the peripheral between multiple users by scheduling encryption jobs.
+ * A job consists of one or more blocks encrypted with the same key. Jobs are ordered by
+ * priority and a job of higher priority takes over the peripheral as soon as the block
+ * being encrypted is completed, so that time-critical users, such as the radio protocol
+ * stacks, are delayed by at most one block. Jobs of the same priority are executed in the
+ * submission order.
+ */
+
+/** @brief Size of the AES block, in bytes. */
+#define NRFX_ECB_BLOCK_SIZE 16
+
+/** @brief Size of the AES key, in bytes. */
+#define NRFX_ECB_KEY_SIZE 16
+
+/** @brief Highest priority of an encryption job. */
+#define NRFX_ECB_JOB_PRIORITY_HIGHEST 0
+
+/** @brief Lowest priority of an encryption job. */
+#define NRFX_ECB_JOB_PRIORITY_LOWEST  UINT8_MAX
+
+/** @brief Structure for ECB configuration. */
+typedef struct
+{
+    uint8_t interrupt_priority; ///< Interrupt priority.
+} nrfx_ecb_config_t;
+
+/**
+ * @brief ECB default configuration.
+ *
+ * This configuration sets up the driver with the following options:
+ * - interrupt priority equal to @ref NRFX_ECB_DEFAULT_CONFIG_IRQ_PRIORITY
+ */
+#define NRFX_ECB_DEFAULT_CONFIG                                  \
+{                                                                \
+    .interrupt_priority = NRFX_ECB_DEFAULT_CONFIG_IRQ_PRIORITY,  \
+}
+
+typedef struct nrfx_ecb_job_s nrfx_ecb_job_t;
+
+/**
+ * @brief Block handler prototype.
+ *
+ * The handler is used by jobs in which every block depends on the result of the previous one,
+ * for example in the CBC-MAC or CTR modes. It is called in the ECB interrupt context after every
+ * block of the job is encrypted, and once from @ref nrfx_ecb_job_submit to get the first block.
+ * Jobs of lower priority are not started while the handler is executed.
+ *
+ * @param[in]  p_job        Pointer to the job.
+ * @param[in]  p_ciphertext Pointer to the encrypted block, or NULL if the first block is requested.
+ * @param[out] p_cleartext  Pointer to the buffer for the next block to encrypt.
+ * @param[in]  p_context    User context.
+ *
+ * @retval true  The next block was stored in @p p_cleartext.
+ * @retval false The job is complete.
+ */
+typedef bool (* nrfx_ecb_block_handler_t)(nrfx_ecb_job_t * p_job,
+                                          uint8_t const  * p_ciphertext,
+                                          uint8_t        * p_cleartext,
+                                          void           * p_context);
+
+/**
+ * @brief Job completion handler prototype.
+ *
+ * @param[in] p_job     Pointer to the completed job.
+ * @param[in] p_context User context.
+ */
+typedef void (* nrfx_ecb_job_handler_t)(nrfx_ecb_job_t * p_job, void * p_context);
+
+/**
+ * @brief Structure describing an encryption job.
+ *
+ * A job encrypts either @p blocks consecutive blocks from @p p_in into @p p_out, or the blocks
+ * provided by @p block_handler if it is not NULL. The structure is owned by the driver from the
+ * moment it is submitted with @ref nrfx_ecb_job_submit until it completes or is cancelled.
+ */
+struct nrfx_ecb_job_s
+{
+    uint8_t const *          p_key;                          ///< Pointer to the key.
+    uint8_t const *          p_in;                           ///< Pointer to the cleartext blocks. Used only if @p block_handler is NULL.
+    uint8_t *                p_out;                          ///< Pointer to the buffer for the ciphertext blocks. Used only if @p block_handler is NULL.
+    size_t                   blocks;                         ///< Number of blocks. Used only if @p block_handler is NULL.
+    nrfx_ecb_block_handler_t block_handler;                  ///< Block handler. Can be NULL.
+    nrfx_ecb_job_handler_t   handler;                        ///< Completion handler. Can be NULL.
+    void *                   p_context;                      ///< Context passed to the handlers.
+    uint8_t                  priority;                       ///< Job priority. @ref NRFX_ECB_JOB_PRIORITY_HIGHEST is the highest.
+    volatile uint8_t         state;                          ///< Internal: state of the job.
+    size_t                   progress;                       ///< Internal: number of blocks encrypted.
+    uint8_t                  cleartext[NRFX_ECB_BLOCK_SIZE]; ///< Internal: next block to encrypt.
+    nrfx_ecb_job_t *         p_next;                         ///< Internal: next job in the queue.
+};
+
+/**
+ * @brief Function for initializing the ECB driver.
+ *
+ * @param[in] p_config Pointer to the structure with the initial configuration.
+ *
+ * @retval NRFX_SUCCESS                   Driver was successfully initialized.
+ * @retval NRFX_ERROR_ALREADY_INITIALIZED Driver was already initialized.
+ */
+nrfx_err_t nrfx_ecb_init(nrfx_ecb_config_t const * p_config);
+
+/**
+ * @brief Function for uninitializing the ECB driver.
+ *
+ * The block being encrypted is aborted and all submitted jobs are dropped without calling
+ * their handlers.
+ */
+void nrfx_ecb_uninit(void);
+
+/**
+ * @brief Function for submitting an encryption job.
+ *
+ * The job starts immediately if the peripheral is idle. Otherwise it waits for the jobs of
+ * higher or equal priority that are already submitted and takes over the peripheral from
+ * a job of lower priority when the block of that job being encrypted is completed. The job
+ * of lower priority is resumed when there are no jobs of higher priority.
+ *
+ * The function can be called from any context, including the job handlers.
+ *
+ * @param[in] p_job Pointer to the job. Must stay valid until the job completes or is cancelled.
+ *
+ * @retval NRFX_SUCCESS             The job was submitted.
+ * @retval NRFX_ERROR_INVALID_STATE The driver is not initialized.
+ * @retval NRFX_ERROR_BUSY          The job is already submitted.
+ * @retval NRFX_ERROR_INVALID_PARAM The job has no blocks to encrypt.
+ */
+nrfx_err_t nrfx_ecb_job_submit(nrfx_ecb_job_t * p_job);
+
+/**
+ * @brief Function for cancelling an encryption job.
+ *
+ * If a block of the job is being encrypted, it is aborted and the peripheral is handed over
+ * to the next job. The handlers of the cancelled job are not called after this function returns,
+ * unless the job is submitted again.
+ *
+ * @param[in] p_job Pointer to the job.
+ *
+ * @retval true  The job was cancelled.
+ * @retval false The job was not submitted or has already completed.
+ */
+bool nrfx_ecb_job_cancel(nrfx_ecb_job_t * p_job);
+
+/**
+ * @brief Function for checking if an encryption job is submitted and not yet completed.
+ *
+ * @param[in] p_job Pointer to the job.
+ *
+ * @retval true  The job is pending.
+ * @retval false The job is not pending.
+ */
+bool nrfx_ecb_job_pending_check(nrfx_ecb_job_t const * p_job);
+
+/** @} */
+
+
+void nrfx_ecb_irq_handler(void);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_ECB_H__
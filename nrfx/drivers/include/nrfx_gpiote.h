@@ -75,6 +75,17 @@ typedef void (*nrfx_gpiote_interrupt_handler_t)(nrfx_gpiote_pin_t     pin,
                                                 nrfx_gpiote_trigger_t trigger,
                                                 void *                p_context);
 
+/**
+ * @brief Port event handler prototype.
+ *
+ * @param[in] port      Index of the GPIO port.
+ * @param[in] pins      Bitmask of port pins for which events were dispatched.
+ * @param[in] p_context User context.
+ */
+typedef void (*nrfx_gpiote_port_handler_t)(uint32_t port,
+                                           uint32_t pins,
+                                           void *   p_context);
+
 /** @brief Structure for configuring a GPIOTE task. */
 typedef struct
 {
@@ -121,6 +132,22 @@ typedef struct
     void *                          p_context; ///< Context passed to the event handler.
 } nrfx_gpiote_handler_config_t;
 
+/**
+ * @brief Latency classes of managed input pins.
+ *
+ * GPIOTE channels are assigned to managed input pins in the order of the classes, starting
+ * from @ref NRFX_GPIOTE_LATENCY_CLASS_CRITICAL. The remaining pins use the sensing mechanism,
+ * which has a longer latency but consumes less power.
+ */
+typedef enum
+{
+    NRFX_GPIOTE_LATENCY_CLASS_CRITICAL, ///< Pin is assigned a channel before pins of any other class.
+    NRFX_GPIOTE_LATENCY_CLASS_HIGH,     ///< Pin is assigned a channel if all critical pins have one.
+    NRFX_GPIOTE_LATENCY_CLASS_NORMAL,   ///< Pin is assigned a channel only if there are spare channels.
+    NRFX_GPIOTE_LATENCY_CLASS_SENSE,    ///< Pin always uses the sensing mechanism.
+    NRFX_GPIOTE_LATENCY_CLASS_MAX,      ///< Latency classes count.
+} nrfx_gpiote_latency_class_t;
+
 /** @brief Input pin configuration. */
 typedef struct
 {
@@ -451,6 +478,18 @@ void nrfx_gpiote_trigger_disable(nrfx_gpiote_pin_t pin);
 void nrfx_gpiote_global_callback_set(nrfx_gpiote_interrupt_handler_t handler,
                                      void *                          p_context);
 
+/**
+ * @brief Set callback called once per port with all pins that fired in a PORT event.
+ *
+ * The callback is invoked after the pin handlers, for every port with at least one pin
+ * for which a pin event was dispatched during the sensing mechanism processing. It allows
+ * handling of button matrices or encoders in a single call instead of per-pin calls.
+ *
+ * @param[in] handler   Port handler. NULL to disable.
+ * @param[in] p_context Context passed to the handler.
+ */
+void nrfx_gpiote_port_callback_set(nrfx_gpiote_port_handler_t handler, void * p_context);
+
 /**
  * @brief Function for retrieving Task/Event channel index associated with the given pin.
  *
@@ -462,6 +501,50 @@ void nrfx_gpiote_global_callback_set(nrfx_gpiote_interrupt_handler_t handler,
  */
 nrfx_err_t nrfx_gpiote_channel_get(nrfx_gpiote_pin_t pin, uint8_t *p_channel);
 
+/**
+ * @brief Function for initializing an input pin whose trigger placement is managed by the driver.
+ *
+ * The driver places the trigger of the pin either on a GPIOTE channel or on the sensing
+ * mechanism, according to the latency class of the pin. Channels are allocated with
+ * @ref nrfx_gpiote_channel_alloc, so channels allocated by the application are never taken over.
+ * When a managed pin is initialized or uninitialized, the driver moves the triggers of the other
+ * managed pins, so that the channels available to the driver are used by the pins of the most
+ * latency-critical classes. Level triggers always use the sensing mechanism.
+ *
+ * The trigger is enabled together with the interrupt when the function returns. The channel
+ * currently used by the pin can be checked with @ref nrfx_gpiote_channel_get.
+ *
+ * @note A pin can miss a transition while its trigger is being moved.
+ *
+ * @param[in] pin              Absolute pin number.
+ * @param[in] p_input_config   Pin configuration.
+ * @param[in] trigger          Trigger. Must not be @ref NRFX_GPIOTE_TRIGGER_NONE.
+ * @param[in] p_handler_config Handler configuration. If NULL, no pin handler is used.
+ * @param[in] latency_class    Latency class of the pin.
+ *
+ * @retval NRFX_SUCCESS             Initialization was successful.
+ * @retval NRFX_ERROR_BUSY          Pin is already used by the driver.
+ * @retval NRFX_ERROR_NO_MEM        No space for a new handler.
+ */
+nrfx_err_t nrfx_gpiote_managed_input_init(nrfx_gpiote_pin_t                    pin,
+                                          nrfx_gpiote_input_config_t const *   p_input_config,
+                                          nrfx_gpiote_trigger_t                trigger,
+                                          nrfx_gpiote_handler_config_t const * p_handler_config,
+                                          nrfx_gpiote_latency_class_t          latency_class);
+
+/**
+ * @brief Function for uninitializing a managed input pin.
+ *
+ * The pin is restored to the default configuration and its channel, if any, is handed over
+ * to the most latency-critical managed pin that uses the sensing mechanism.
+ *
+ * @param[in] pin Absolute pin number.
+ *
+ * @retval NRFX_SUCCESS             Uninitialization was successful.
+ * @retval NRFX_ERROR_INVALID_PARAM Pin is not a managed input pin.
+ */
+nrfx_err_t nrfx_gpiote_managed_input_uninit(nrfx_gpiote_pin_t pin);
+
 /**
  * @brief Function for initializing a GPIOTE output pin.
  * @details The output pin can be controlled by the CPU or by PPI. The initial
@@ -771,6 +854,122 @@ void nrfx_gpiote_set_task_trigger(nrfx_gpiote_pin_t pin);
 void nrfx_gpiote_clr_task_trigger(nrfx_gpiote_pin_t pin);
 #endif // defined(GPIOTE_FEATURE_CLR_PRESENT) || defined(__NRFX_DOXYGEN__)
 
+#if defined(PPI_PRESENT) || defined(DPPI_PRESENT) || defined(__NRFX_DOXYGEN__)
+
+#ifndef NRFX_GPIOTE_ROUTE_MAX_ENDPOINTS
+/**
+ * @brief Maximum number of task endpoints driven by a single signal route.
+ *
+ * With PPI, one task endpoint and one fork are available, so only up to 2 endpoints
+ * can be used regardless of this setting.
+ */
+#define NRFX_GPIOTE_ROUTE_MAX_ENDPOINTS 2
+#endif
+
+/**
+ * @brief Structure holding resources of a hardware signal route.
+ *
+ * Signal route connects a pin to peripheral tasks or a peripheral event to a pin
+ * using a GPIOTE channel and a (D)PPI channel, without CPU involvement.
+ * The structure is filled by the driver and must be kept by the user while the route is set up.
+ */
+typedef struct
+{
+    uint32_t          eep;                                   ///< Event endpoint of the route.
+    uint32_t          teps[NRFX_GPIOTE_ROUTE_MAX_ENDPOINTS]; ///< Task endpoints of the route.
+    uint8_t           tep_count;                             ///< Number of task endpoints used.
+    nrfx_gpiote_pin_t pin;                                   ///< Pin used by the route.
+    uint8_t           gpiote_ch;                             ///< GPIOTE channel used by the route.
+    uint8_t           gppi_ch;                               ///< (D)PPI channel used by the route.
+    bool              is_input;                              ///< True if the pin is the route source.
+} nrfx_gpiote_route_t;
+
+/**
+ * @brief Function for routing pin edges to tasks of other peripherals.
+ *
+ * The function allocates a GPIOTE channel and a (D)PPI channel, configures the pin
+ * as input with the GPIOTE IN event and connects the event to all given task endpoints.
+ * On failure, all resources allocated so far are released. The route is disabled
+ * until @ref nrfx_gpiote_route_enable is called.
+ *
+ * @param[out] p_route   Pointer to the route structure to be filled.
+ * @param[in]  pin       Absolute pin number.
+ * @param[in]  trigger   Edge triggering the tasks. Level triggers are not supported.
+ * @param[in]  pull      Pull configuration of the pin.
+ * @param[in]  p_teps    Array of task endpoint addresses.
+ * @param[in]  tep_count Number of task endpoints in @p p_teps.
+ *
+ * @retval NRFX_SUCCESS             Route was set up successfully.
+ * @retval NRFX_ERROR_INVALID_PARAM Invalid trigger or number of task endpoints.
+ * @retval NRFX_ERROR_NO_MEM        No GPIOTE or (D)PPI channel available.
+ * @retval NRFX_ERROR_NOT_SUPPORTED (D)PPI driver is not enabled.
+ */
+nrfx_err_t nrfx_gpiote_route_input_setup(nrfx_gpiote_route_t * p_route,
+                                         nrfx_gpiote_pin_t     pin,
+                                         nrfx_gpiote_trigger_t trigger,
+                                         nrf_gpio_pin_pull_t   pull,
+                                         uint32_t const *      p_teps,
+                                         uint8_t               tep_count);
+
+/**
+ * @brief Function for routing an event of other peripheral to the pin.
+ *
+ * The function allocates a GPIOTE channel and a (D)PPI channel, configures the pin
+ * as output driven by the GPIOTE OUT task and connects the given event to the task.
+ * The event can additionally be forked to other task endpoints.
+ * On failure, all resources allocated so far are released. The route is disabled
+ * until @ref nrfx_gpiote_route_enable is called.
+ *
+ * @param[out] p_route    Pointer to the route structure to be filled.
+ * @param[in]  pin        Absolute pin number.
+ * @param[in]  eep        Address of the event endpoint.
+ * @param[in]  action     Action performed on the pin: set (@ref NRF_GPIOTE_POLARITY_LOTOHI),
+ *                        clear (@ref NRF_GPIOTE_POLARITY_HITOLO) or toggle
+ *                        (@ref NRF_GPIOTE_POLARITY_TOGGLE).
+ * @param[in]  init_val   Initial pin state.
+ * @param[in]  p_teps     Array of additional task endpoint addresses. Can be NULL.
+ * @param[in]  tep_count  Number of task endpoints in @p p_teps.
+ *
+ * @retval NRFX_SUCCESS             Route was set up successfully.
+ * @retval NRFX_ERROR_INVALID_PARAM Invalid action or number of task endpoints.
+ * @retval NRFX_ERROR_NO_MEM        No GPIOTE or (D)PPI channel available.
+ * @retval NRFX_ERROR_NOT_SUPPORTED (D)PPI driver is not enabled.
+ */
+nrfx_err_t nrfx_gpiote_route_output_setup(nrfx_gpiote_route_t * p_route,
+                                          nrfx_gpiote_pin_t     pin,
+                                          uint32_t              eep,
+                                          nrf_gpiote_polarity_t action,
+                                          nrf_gpiote_outinit_t  init_val,
+                                          uint32_t const *      p_teps,
+                                          uint8_t               tep_count);
+
+/**
+ * @brief Function for enabling the signal route.
+ *
+ * @param[in] p_route Pointer to the route set up with @ref nrfx_gpiote_route_input_setup
+ *                    or @ref nrfx_gpiote_route_output_setup.
+ */
+void nrfx_gpiote_route_enable(nrfx_gpiote_route_t const * p_route);
+
+/**
+ * @brief Function for disabling the signal route.
+ *
+ * @param[in] p_route Pointer to the route.
+ */
+void nrfx_gpiote_route_disable(nrfx_gpiote_route_t const * p_route);
+
+/**
+ * @brief Function for tearing down the signal route.
+ *
+ * The route is disabled, the pin is restored to the default configuration and
+ * both GPIOTE and (D)PPI channels are freed.
+ *
+ * @param[in] p_route Pointer to the route.
+ */
+void nrfx_gpiote_route_free(nrfx_gpiote_route_t * p_route);
+
+#endif // defined(PPI_PRESENT) || defined(DPPI_PRESENT) || defined(__NRFX_DOXYGEN__)
+
 #if NRF_GPIOTE_HAS_LATENCY || defined(__NRFX_DOXYGEN__)
 /**
  * @brief Function for setting the latency setting.
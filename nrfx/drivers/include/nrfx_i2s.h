@@ -105,6 +105,24 @@ typedef struct
     uint32_t const * p_tx_buffer; ///< Pointer to the buffer with data to be sent.
 } nrfx_i2s_buffers_t;
 
+/**
+ * @brief I2S driver ring of buffers.
+ *
+ * Entries of the ring are used by the peripheral one after another. The application fills
+ * TX buffers ahead of time, advancing the producer index with @ref nrfx_i2s_ring_tx_commit,
+ * and processes received RX buffers, advancing the consumer index
+ * with @ref nrfx_i2s_ring_rx_release. All indices are free-running counters of entries;
+ * the entry used for a given index is the index modulo @p count.
+ */
+typedef struct
+{
+    nrfx_i2s_buffers_t const * p_buffers; ///< Array of buffer pairs forming the ring.
+    uint16_t                   count;     ///< Number of entries in the array. Must be at least 3.
+    volatile uint32_t          produced;  ///< Producer index: number of entries filled with TX data.
+    volatile uint32_t          consumed;  ///< Consumer index: number of entries with processed RX data.
+    volatile uint32_t          released;  ///< Number of entries completed by the peripheral. Updated by the driver.
+} nrfx_i2s_ring_t;
+
 #if NRF_I2S_HAS_CLKCONFIG || defined(__NRFX_DOXYGEN__)
     /** @brief I2S additional clock source configuration. */
     #define NRF_I2S_DEFAULT_EXTENDED_CLKSRC_CONFIG \
@@ -160,6 +178,15 @@ typedef struct
     /**< The I2S peripheral has been stopped and all buffers that were passed
      *   to the driver have been released. */
 
+#define NRFX_I2S_STATUS_RING_UNDERRUN       (1UL << 2)
+    /**< Ring mode only. The application did not fill the next TX entry in time.
+     *   The buffers currently in use are used by the peripheral once more. */
+
+#define NRFX_I2S_STATUS_RING_OVERRUN        (1UL << 3)
+    /**< Ring mode only. The application did not release the RX entry to be used next.
+     *   The buffers currently in use are used by the peripheral once more,
+     *   so the data received to them is overwritten. */
+
 /**
  * @brief I2S driver data handler type.
  *
@@ -204,6 +231,12 @@ typedef struct
  *                    It can be 0 or a combination of the following flags:
  *                    - @ref NRFX_I2S_STATUS_NEXT_BUFFERS_NEEDED
  *                    - @ref NRFX_I2S_STATUS_TRANSFER_STOPPED
+ *                    - @ref NRFX_I2S_STATUS_RING_UNDERRUN
+ *                    - @ref NRFX_I2S_STATUS_RING_OVERRUN
+ *
+ * In ring mode (see @ref nrfx_i2s_ring_start), the handler is called when an entry of the ring
+ * is completed, with @c p_released pointing to that entry, and when an underrun or overrun
+ * occurs. @ref NRFX_I2S_STATUS_NEXT_BUFFERS_NEEDED is never reported in this mode.
  */
 typedef void (* nrfx_i2s_data_handler_t)(nrfx_i2s_buffers_t const * p_released,
                                          uint32_t                   status);
@@ -285,6 +318,173 @@ nrfx_err_t nrfx_i2s_start(nrfx_i2s_buffers_t const * p_initial_buffers,
  */
 nrfx_err_t nrfx_i2s_next_buffers_set(nrfx_i2s_buffers_t const * p_buffers);
 
+/**
+ * @brief Function for initializing the ring of buffers.
+ *
+ * @param[out] p_ring    Pointer to the ring structure.
+ * @param[in]  p_buffers Array of buffer pairs. All entries must use the same directions
+ *                       (either RX, TX, or both) and the same buffer size.
+ * @param[in]  count     Number of entries in the array. Must be at least 3.
+ */
+void nrfx_i2s_ring_init(nrfx_i2s_ring_t *          p_ring,
+                        nrfx_i2s_buffers_t const * p_buffers,
+                        uint16_t                   count);
+
+/**
+ * @brief Function for starting the continuous I2S transfer that cycles through a ring of buffers.
+ *
+ * The driver moves to the next entry of the ring on its own, so the application does not
+ * have to supply buffers from the data handler. If the next entry is not ready when
+ * the peripheral needs it (TX data not committed or RX data not released yet), the current
+ * buffers are used once more and @ref NRFX_I2S_STATUS_RING_UNDERRUN or
+ * @ref NRFX_I2S_STATUS_RING_OVERRUN is reported.
+ *
+ * If TX is used, at least the first TX entry must be committed before the transfer is started.
+ * The transfer is stopped with @ref nrfx_i2s_stop.
+ *
+ * @param[in] p_ring      Pointer to the ring initialized with @ref nrfx_i2s_ring_init.
+ *                        Must stay valid until the transfer is stopped.
+ * @param[in] buffer_size Size of the buffers (in 32-bit words). Must not be 0.
+ * @param[in] flags       Transfer options (0 for default settings).
+ *                        Currently, no additional flags are available.
+ *
+ * @retval NRFX_SUCCESS             The operation was successful.
+ * @retval NRFX_ERROR_INVALID_STATE Transfer was already started, the driver has not been
+ *                                  initialized, or no TX entry has been committed.
+ * @retval NRFX_ERROR_INVALID_ADDR  The provided buffers are not placed
+ *                                  in the Data RAM region.
+ */
+nrfx_err_t nrfx_i2s_ring_start(nrfx_i2s_ring_t * p_ring,
+                               uint16_t          buffer_size,
+                               uint8_t           flags);
+
+/**
+ * @brief Function for getting the next ring entry to be filled with TX data.
+ *
+ * @param[in] p_ring Pointer to the ring structure.
+ *
+ * @return Pointer to the entry or NULL if all entries are filled and not yet
+ *         completed by the peripheral.
+ */
+nrfx_i2s_buffers_t const * nrfx_i2s_ring_tx_get(nrfx_i2s_ring_t const * p_ring);
+
+/**
+ * @brief Function for committing the TX entry returned by @ref nrfx_i2s_ring_tx_get.
+ *
+ * @param[in,out] p_ring Pointer to the ring structure.
+ */
+void nrfx_i2s_ring_tx_commit(nrfx_i2s_ring_t * p_ring);
+
+/**
+ * @brief Function for getting the next ring entry with received RX data.
+ *
+ * @param[in] p_ring Pointer to the ring structure.
+ *
+ * @return Pointer to the entry or NULL if there is no completed entry to be processed.
+ */
+nrfx_i2s_buffers_t const * nrfx_i2s_ring_rx_get(nrfx_i2s_ring_t const * p_ring);
+
+/**
+ * @brief Function for releasing the RX entry returned by @ref nrfx_i2s_ring_rx_get,
+ *        so that it can be filled again.
+ *
+ * @param[in,out] p_ring Pointer to the ring structure.
+ */
+void nrfx_i2s_ring_rx_release(nrfx_i2s_ring_t * p_ring);
+
+/** @brief PCM sample formats handled by the sample conversion functions. */
+typedef enum
+{
+    NRFX_I2S_PCM_S16, ///< Signed 16-bit samples.
+    NRFX_I2S_PCM_S32, ///< Signed 32-bit samples.
+                      /**< Narrower I2S samples are left-aligned, for example
+                       *   24-bit samples occupy bits 31-8. */
+} nrfx_i2s_pcm_format_t;
+
+/**
+ * @brief Function for getting the number of frames that fit in an I2S buffer.
+ *
+ * A frame consists of one sample per enabled channel. The number depends on the sample width
+ * and channels set in the driver configuration.
+ *
+ * @param[in] buffer_size Size of the buffer (in 32-bit words).
+ *
+ * @return Number of frames.
+ */
+uint32_t nrfx_i2s_pcm_frames_get(uint16_t buffer_size);
+
+/**
+ * @brief Function for converting PCM samples into the I2S buffer layout.
+ *
+ * Samples are interleaved in both buffers when both channels are enabled. They are written
+ * to the I2S buffer with the width set in the driver configuration. PCM samples wider than
+ * that are truncated, narrower ones are padded with zeros in the least significant bits.
+ *
+ * @param[out] p_dst  Pointer to the I2S buffer.
+ * @param[in]  p_src  Pointer to the PCM samples. Must be aligned to the sample size.
+ * @param[in]  format Format of the PCM samples.
+ * @param[in]  frames Number of frames to be converted.
+ *
+ * @return Number of 32-bit words written to the I2S buffer.
+ */
+uint32_t nrfx_i2s_pcm_pack(uint32_t *            p_dst,
+                           void const *          p_src,
+                           nrfx_i2s_pcm_format_t format,
+                           uint32_t              frames);
+
+/**
+ * @brief Function for converting samples from the I2S buffer layout into PCM samples.
+ *
+ * @param[out] p_dst  Pointer to the buffer for PCM samples. Must be aligned to the sample size.
+ * @param[in]  p_src  Pointer to the I2S buffer.
+ * @param[in]  format Format of the PCM samples.
+ * @param[in]  frames Number of frames to be converted.
+ *
+ * @return Number of 32-bit words read from the I2S buffer.
+ */
+uint32_t nrfx_i2s_pcm_unpack(void *                p_dst,
+                             uint32_t const *      p_src,
+                             nrfx_i2s_pcm_format_t format,
+                             uint32_t              frames);
+
+/**
+ * @brief Function for filling the next TX entry of the ring with PCM samples and committing it.
+ *
+ * The samples are converted directly into the buffer of the entry, without an intermediate
+ * copy. The function can also be used to fill the entries before the transfer is started.
+ *
+ * @param[in,out] p_ring Pointer to the ring structure.
+ * @param[in]     p_src  Pointer to the PCM samples.
+ * @param[in]     format Format of the PCM samples.
+ * @param[in]     frames Number of frames to be converted. Must not exceed the number returned
+ *                       by @ref nrfx_i2s_pcm_frames_get for the size of the ring buffers.
+ *
+ * @retval NRFX_SUCCESS      The entry was filled and committed.
+ * @retval NRFX_ERROR_NO_MEM All entries are filled and not yet completed by the peripheral.
+ */
+nrfx_err_t nrfx_i2s_ring_tx_pack(nrfx_i2s_ring_t *     p_ring,
+                                 void const *          p_src,
+                                 nrfx_i2s_pcm_format_t format,
+                                 uint32_t              frames);
+
+/**
+ * @brief Function for converting the next received RX entry of the ring into PCM samples
+ *        and releasing it.
+ *
+ * @param[in,out] p_ring Pointer to the ring structure.
+ * @param[out]    p_dst  Pointer to the buffer for PCM samples.
+ * @param[in]     format Format of the PCM samples.
+ * @param[in]     frames Number of frames to be converted. Must not exceed the number returned
+ *                       by @ref nrfx_i2s_pcm_frames_get for the size of the ring buffers.
+ *
+ * @retval NRFX_SUCCESS    The entry was converted and released.
+ * @retval NRFX_ERROR_BUSY There is no completed entry to be processed yet.
+ */
+nrfx_err_t nrfx_i2s_ring_rx_unpack(nrfx_i2s_ring_t *     p_ring,
+                                   void *                p_dst,
+                                   nrfx_i2s_pcm_format_t format,
+                                   uint32_t              frames);
+
 /** @brief Function for stopping the I2S transfer. */
 void nrfx_i2s_stop(void);
 
@@ -75,6 +75,38 @@ typedef struct
     uint32_t receive_events_enabled;             ///< Bitmask with events to be enabled to generate interrupt.
 } nrfx_ipc_config_t;
 
+/**
+ * @brief Header of a single-producer single-consumer message ring placed in shared memory.
+ *
+ * The header is followed by @p slot_count slots, each holding a 32-bit message length
+ * and up to @p slot_size bytes of message data. Use @ref NRFX_IPC_RING_SHM_SIZE to get
+ * the size of the whole shared memory region.
+ */
+typedef struct
+{
+    volatile uint32_t wr_idx;     ///< Number of messages written. Modified only by the producer.
+    volatile uint32_t rd_idx;     ///< Number of messages read. Modified only by the consumer.
+    uint16_t          slot_size;  ///< Maximum message size in bytes. Multiple of 4.
+    uint16_t          slot_count; ///< Number of slots. Power of 2.
+} nrfx_ipc_ring_shm_t;
+
+/**
+ * @brief Macro for getting the size of the shared memory region for a message ring.
+ *
+ * @param[in] _slot_size  Maximum message size in bytes. Must be a multiple of 4.
+ * @param[in] _slot_count Number of slots. Must be a power of 2.
+ */
+#define NRFX_IPC_RING_SHM_SIZE(_slot_size, _slot_count) \
+    (sizeof(nrfx_ipc_ring_shm_t) + (_slot_count) * (sizeof(uint32_t) + (_slot_size)))
+
+/** @brief Local endpoint of a message ring. */
+typedef struct
+{
+    nrfx_ipc_ring_shm_t * p_shm;      ///< Shared memory region of the ring.
+    uint8_t               send_index; ///< Index of the SEND task used as the doorbell. Used only by the producer.
+    bool                  coalesce;   ///< True if the doorbell is rung only for a message written into an empty ring.
+} nrfx_ipc_ring_t;
+
 /**
  * @brief Function for initializing the IPC driver.
  *
@@ -197,6 +229,65 @@ NRFX_STATIC_INLINE void nrfx_ipc_receive_config_set(uint8_t event_index, uint32_
  */
 NRFX_STATIC_INLINE void nrfx_ipc_send_config_set(uint8_t send_index, uint32_t channel_bitmask);
 
+/**
+ * @brief Function for initializing the shared memory region of a message ring.
+ *
+ * This function must be called by one of the cores only, before any of them uses the ring.
+ *
+ * @param[out] p_shm      Pointer to the shared memory region of
+ *                        @ref NRFX_IPC_RING_SHM_SIZE bytes. Must be word-aligned.
+ * @param[in]  slot_size  Maximum message size in bytes. Must be a multiple of 4.
+ * @param[in]  slot_count Number of slots. Must be a power of 2.
+ */
+void nrfx_ipc_ring_shm_init(void * p_shm, uint16_t slot_size, uint16_t slot_count);
+
+/**
+ * @brief Function for initializing the local endpoint of a message ring.
+ *
+ * In the coalescing mode, the producer rings the doorbell only when it writes a message into
+ * an empty ring, so the consumer must read all messages from the ring each time it is signalled.
+ *
+ * @param[out] p_ring     Pointer to the endpoint structure.
+ * @param[in]  p_shm      Pointer to the shared memory region initialized with
+ *                        @ref nrfx_ipc_ring_shm_init.
+ * @param[in]  send_index Index of the SEND task used as the doorbell. Ignored by the consumer.
+ * @param[in]  coalesce   True to enable doorbell coalescing. Ignored by the consumer.
+ */
+void nrfx_ipc_ring_init(nrfx_ipc_ring_t * p_ring,
+                        void *            p_shm,
+                        uint8_t           send_index,
+                        bool              coalesce);
+
+/**
+ * @brief Function for writing a message to the ring and ringing the doorbell.
+ *
+ * Only one context on the producer core may write to a given ring.
+ *
+ * @param[in] p_ring Pointer to the producer endpoint.
+ * @param[in] p_data Pointer to the message data.
+ * @param[in] length Message length in bytes.
+ *
+ * @retval NRFX_SUCCESS              The message was written.
+ * @retval NRFX_ERROR_NO_MEM         The ring is full.
+ * @retval NRFX_ERROR_INVALID_LENGTH The message does not fit into a slot.
+ */
+nrfx_err_t nrfx_ipc_ring_send(nrfx_ipc_ring_t * p_ring, void const * p_data, uint16_t length);
+
+/**
+ * @brief Function for reading a message from the ring.
+ *
+ * Only one context on the consumer core may read from a given ring.
+ *
+ * @param[in]  p_ring   Pointer to the consumer endpoint.
+ * @param[out] p_data   Pointer to the buffer for the message data. Must be able to hold
+ *                      a message of the slot size.
+ * @param[out] p_length Length of the message in bytes.
+ *
+ * @retval true  A message was read.
+ * @retval false The ring is empty.
+ */
+bool nrfx_ipc_ring_recv(nrfx_ipc_ring_t * p_ring, void * p_data, uint16_t * p_length);
+
 /** @} */
 
 
@@ -320,6 +320,64 @@ void nrfx_nfct_autocolres_enable(void);
  */
 void nrfx_nfct_autocolres_disable(void);
 
+/** @brief Response template for a command answered by the driver. */
+typedef struct
+{
+    uint8_t const * p_cmd;    ///< Command APDU prefix to match, excluding the ISO-DEP PCB byte.
+    uint8_t         cmd_size; ///< Number of bytes of @p p_cmd to compare.
+    uint8_t const * p_rsp;    ///< Response APDU, excluding the ISO-DEP PCB byte.
+    uint16_t        rsp_size; ///< Size of the response APDU.
+} nrfx_nfct_rsp_template_t;
+
+/** @brief Configuration of the automatic response mode. */
+typedef struct
+{
+    nrfx_nfct_rsp_template_t const * p_templates;    ///< Table of response templates, checked in order.
+    size_t                           template_count; ///< Number of response templates.
+    uint8_t const *                  p_file;         ///< Content of the file served by the READ BINARY command, or NULL.
+    uint16_t                         file_size;      ///< Size of the file served by the READ BINARY command.
+    uint8_t *                        p_tx_buffer;    ///< Buffer in which the responses are assembled.
+    uint16_t                         tx_buffer_size; ///< Size of the response buffer.
+} nrfx_nfct_autorsp_config_t;
+
+/**
+ * @brief Function for starting the automatic response mode.
+ *
+ * In this mode, ISO-DEP I-blocks received from the poller are first checked by the driver
+ * in the interrupt handler. A READ BINARY command is answered with a chunk of the cached
+ * file followed by the status word, and any other command that matches a response template
+ * is answered with the template response. The response echoes the received PCB byte and is
+ * transmitted within the frame delay window. Afterwards, reception is restarted with the buffer
+ * passed most recently to @ref nrfx_nfct_rx.
+ *
+ * Frames that are answered automatically are not reported to the upper layer, so neither
+ * @ref NRFX_NFCT_EVT_RX_FRAMEEND nor the TX events are generated for them. Any other frame,
+ * including S-blocks, R-blocks, and chained I-blocks, is reported as usual.
+ *
+ * @note The ISO-DEP block number is kept by the poller and echoed by the tag, so automatically
+ *       answered frames do not break the block numbering of the upper layer, provided that it
+ *       echoes the PCB byte of the frame it responds to.
+ *
+ * @param[in] p_config Pointer to the automatic response configuration. The structure and
+ *                     the data it points to must remain valid until
+ *                     @ref nrfx_nfct_autorsp_stop is called.
+ *
+ * @retval NRFX_SUCCESS             The automatic response mode was started.
+ * @retval NRFX_ERROR_INVALID_STATE The driver is not initialized.
+ * @retval NRFX_ERROR_INVALID_ADDR  The response buffer is not placed in the Data RAM region.
+ */
+nrfx_err_t nrfx_nfct_autorsp_start(nrfx_nfct_autorsp_config_t const * p_config);
+
+/** @brief Function for stopping the automatic response mode. */
+void nrfx_nfct_autorsp_stop(void);
+
+/**
+ * @brief Function for getting the number of frames answered automatically.
+ *
+ * @return Number of frames answered by the driver since @ref nrfx_nfct_autorsp_start was called.
+ */
+uint32_t nrfx_nfct_autorsp_count_get(void);
+
 /** @} */
 
 
@@ -239,6 +239,9 @@ void nrfx_nvmc_bytes_write(uint32_t address, void const * src, uint32_t num_byte
  *
  * To determine if the last flash write has been completed, use @ref nrfx_nvmc_write_done_check().
  *
+ * On SoCs with the READYNEXT register, each word is buffered while the previous one
+ * is still being programmed.
+ *
  * @note Depending on the source of the code being executed,
  *       the CPU may be halted during the operation.
  *       Refer to the Product Specification for more information.
@@ -249,6 +252,132 @@ void nrfx_nvmc_bytes_write(uint32_t address, void const * src, uint32_t num_byte
  */
 void nrfx_nvmc_words_write(uint32_t address, void const * src, uint32_t num_words);
 
+/**
+ * @brief Structure holding the state of the write coalescing buffer.
+ *
+ * The buffer keeps the bytes of one partially written flash word in RAM, so that
+ * consecutive small writes result in a single word program.
+ */
+typedef struct
+{
+    uint32_t word_addr;     ///< Address of the buffered word.
+    uint32_t word;          ///< Buffered word value.
+    uint8_t  byte_mask;     ///< Bitmask of bytes in the buffered word that were written.
+    uint32_t bytes_written; ///< Number of logical bytes written through the buffer.
+    uint32_t word_programs; ///< Number of physical word programs performed.
+} nrfx_nvmc_coalesce_t;
+
+/**
+ * @brief Function for initializing the write coalescing buffer.
+ *
+ * @param[out] p_buffer Pointer to the coalescing buffer.
+ */
+void nrfx_nvmc_coalesce_init(nrfx_nvmc_coalesce_t * p_buffer);
+
+/**
+ * @brief Function for writing bytes to flash through the coalescing buffer.
+ *
+ * Bytes of a partially written word are kept in RAM until the word is complete,
+ * a write to a different word is requested or @ref nrfx_nvmc_coalesce_flush is called.
+ * Programs that would not change the flash content are skipped.
+ *
+ * @note Bytes held in the buffer are not yet present in flash.
+ *
+ * @param[in,out] p_buffer  Pointer to the coalescing buffer.
+ * @param[in]     address   Address to write to.
+ * @param[in]     src       Pointer to data to copy from.
+ * @param[in]     num_bytes Number of bytes to write.
+ */
+void nrfx_nvmc_coalesce_write(nrfx_nvmc_coalesce_t * p_buffer,
+                              uint32_t               address,
+                              void const *           src,
+                              uint32_t               num_bytes);
+
+/**
+ * @brief Function for programming the partially written word held in the coalescing buffer.
+ *
+ * @param[in,out] p_buffer Pointer to the coalescing buffer.
+ */
+void nrfx_nvmc_coalesce_flush(nrfx_nvmc_coalesce_t * p_buffer);
+
+#ifndef NRFX_NVMC_JOB_ERASE_SLICE_MS
+/** @brief Duration of a single partial erase step performed by the job engine, in milliseconds. */
+#define NRFX_NVMC_JOB_ERASE_SLICE_MS 5
+#endif
+
+#ifndef NRFX_NVMC_JOB_WRITE_SLICE_WORDS
+/** @brief Number of words written in a single step performed by the job engine. */
+#define NRFX_NVMC_JOB_WRITE_SLICE_WORDS 16
+#endif
+
+/** @brief Flash job types. */
+typedef enum
+{
+    NRFX_NVMC_JOB_ERASE, ///< Erase of consecutive pages.
+    NRFX_NVMC_JOB_WRITE, ///< Write of consecutive words.
+} nrfx_nvmc_job_type_t;
+
+typedef struct nrfx_nvmc_job_s nrfx_nvmc_job_t;
+
+/**
+ * @brief Flash job completion handler prototype.
+ *
+ * @param[in] p_job     Pointer to the completed job.
+ * @param[in] p_context User context.
+ */
+typedef void (* nrfx_nvmc_job_handler_t)(nrfx_nvmc_job_t * p_job, void * p_context);
+
+/**
+ * @brief Structure describing a flash job.
+ *
+ * The structure is owned by the driver from the moment it is submitted with
+ * @ref nrfx_nvmc_job_submit until its handler is called.
+ */
+struct nrfx_nvmc_job_s
+{
+    nrfx_nvmc_job_type_t    type;      ///< Job type.
+    uint32_t                address;   ///< Address of the first page to erase or the first word to write.
+    void const *            p_src;     ///< Pointer to data to copy from. Used only by write jobs.
+    uint32_t                count;     ///< Number of pages to erase or number of words to write.
+    nrfx_nvmc_job_handler_t handler;   ///< Completion handler. Can be NULL.
+    void *                  p_context; ///< Context passed to the completion handler.
+    uint32_t                progress;  ///< Internal: number of pages erased or words written.
+    bool                    started;   ///< Internal: flag indicating that the page erase is in progress.
+    nrfx_nvmc_job_t *       p_next;    ///< Internal: next job in the queue.
+};
+
+/**
+ * @brief Function for queuing a flash erase or write job.
+ *
+ * Jobs are executed in the submission order by @ref nrfx_nvmc_job_process, in slices short
+ * enough not to block time-critical code for the whole operation. Page erase is split into
+ * partial erase steps of @ref NRFX_NVMC_JOB_ERASE_SLICE_MS each, where supported;
+ * otherwise each page is erased in one step. Writes are split into batches of
+ * @ref NRFX_NVMC_JOB_WRITE_SLICE_WORDS words.
+ *
+ * @note The job engine uses the partial erase functionality of the driver. Do not use
+ *       @ref nrfx_nvmc_page_partial_erase_init while jobs are pending.
+ *
+ * @param[in] p_job Pointer to the job. Must stay valid until its handler is called.
+ *
+ * @retval NRFX_SUCCESS            The job was queued.
+ * @retval NRFX_ERROR_INVALID_ADDR Erase address is not aligned to the size of the page
+ *                                 or write address or source is not word-aligned.
+ */
+nrfx_err_t nrfx_nvmc_job_submit(nrfx_nvmc_job_t * p_job);
+
+/**
+ * @brief Function for performing the next slice of the queued flash jobs.
+ *
+ * The function is expected to be called from a timer or an idle hook. It performs at most
+ * one erase step or one batch of word writes and calls the job handler when the job completes.
+ * It must not be called concurrently from different contexts.
+ *
+ * @retval true  There are still jobs pending. Call the function again.
+ * @retval false All jobs have been completed.
+ */
+bool nrfx_nvmc_job_process(void);
+
 /**
  * @brief Function for reading a 16-bit aligned halfword from the OTP (UICR)
  *
@@ -58,6 +58,54 @@ typedef enum
     NRFX_PDM_ERROR_OVERFLOW = 1 ///< Overflow error.
 } nrfx_pdm_error_t;
 
+/** @brief Gain of the PDM filter that leaves the samples unscaled. */
+#define NRFX_PDM_FILTER_GAIN_UNITY 256
+
+/** @brief High-pass filter coefficient suitable for removing the DC offset (0.995 in Q15 format). */
+#define NRFX_PDM_FILTER_HPF_DC_REMOVAL 32604
+
+/** @brief PDM sample filter configuration structure. */
+typedef struct
+{
+    uint16_t gain;       ///< Linear gain in Q8.8 format. @ref NRFX_PDM_FILTER_GAIN_UNITY disables scaling.
+    uint16_t hpf_coef;   ///< Pole of the first-order high-pass filter in Q15 format. 0 disables the filter.
+                         /**< The filter runs at the output (decimated) sample rate.
+                          *   Use @ref NRFX_PDM_FILTER_HPF_DC_REMOVAL to only remove the DC offset. */
+    uint8_t  decimation; ///< Decimation factor: 1 (no decimation), 2, or 3.
+                         /**< Samples are decimated by averaging, which also acts
+                          *   as a simple anti-aliasing filter. */
+    bool     in_irq;     ///< True if ring entries are to be processed in the PDM interrupt
+                         ///< handler before being released, false if the application calls
+                         ///< @ref nrfx_pdm_filter_process on its own.
+} nrfx_pdm_filter_config_t;
+
+/** @brief PDM sample filter default configuration that removes the DC offset in the interrupt handler. */
+#define NRFX_PDM_FILTER_DEFAULT_CONFIG             \
+{                                                  \
+    .gain       = NRFX_PDM_FILTER_GAIN_UNITY,      \
+    .hpf_coef   = NRFX_PDM_FILTER_HPF_DC_REMOVAL,  \
+    .decimation = 1,                               \
+    .in_irq     = true,                            \
+}
+
+/**
+ * @brief PDM driver ring of sample buffers.
+ *
+ * The ring is a single memory block divided into @p count entries of @p entry_length samples
+ * each. The driver fills the entries one after another and the application processes them,
+ * advancing the consumer index with @ref nrfx_pdm_ring_release. Both indices are free-running
+ * counters of entries; the entry used for a given index is the index modulo @p count.
+ */
+typedef struct
+{
+    int16_t *         p_buffer;     ///< Memory block of @p count * @p entry_length samples. Must be word-aligned.
+    uint16_t          entry_length; ///< Length of a single entry in 16-bit words. Must be even.
+    uint16_t          count;        ///< Number of entries in the ring. Must be at least 3.
+    volatile uint32_t released;     ///< Number of entries filled by the peripheral. Updated by the driver.
+    volatile uint32_t consumed;     ///< Number of entries processed by the application.
+    uint16_t          data_length;  ///< Number of valid samples in each released entry. Updated by the driver.
+} nrfx_pdm_ring_t;
+
 /** @brief PDM event structure. */
 typedef struct
 {
@@ -225,6 +273,91 @@ nrfx_err_t nrfx_pdm_stop(void);
  */
 nrfx_err_t nrfx_pdm_buffer_set(int16_t * buffer, uint16_t buffer_length);
 
+/**
+ * @brief Function for initializing the ring of sample buffers.
+ *
+ * @param[out] p_ring       Pointer to the ring structure.
+ * @param[in]  p_buffer     Memory block of @p count * @p entry_length samples. Must be word-aligned.
+ * @param[in]  entry_length Length of a single entry in 16-bit words. Must be even.
+ * @param[in]  count        Number of entries. Must be at least 3.
+ */
+void nrfx_pdm_ring_init(nrfx_pdm_ring_t * p_ring,
+                        int16_t *         p_buffer,
+                        uint16_t          entry_length,
+                        uint16_t          count);
+
+/**
+ * @brief Function for starting the PDM sampling into a ring of buffers.
+ *
+ * The driver moves to the next entry of the ring on its own, so buffer request events
+ * are not generated and @ref nrfx_pdm_buffer_set must not be used. The event handler is called
+ * with @p buffer_released pointing to each filled entry. If the application does not release
+ * entries in time, the entry currently being filled is overwritten and the event with
+ * @ref NRFX_PDM_ERROR_OVERFLOW is generated.
+ *
+ * Sampling is stopped with @ref nrfx_pdm_stop.
+ *
+ * @param[in] p_ring Pointer to the ring initialized with @ref nrfx_pdm_ring_init.
+ *                   Must stay valid until sampling is stopped.
+ *
+ * @retval NRFX_SUCCESS              Sampling was started successfully.
+ * @retval NRFX_ERROR_BUSY           Sampling is already in progress or previous start/stop
+ *                                   operation is in progress.
+ * @retval NRFX_ERROR_INVALID_STATE  The driver was not initialized.
+ * @retval NRFX_ERROR_INVALID_LENGTH The entry length is not a multiple of the number
+ *                                   of samples consumed by the filter to produce one output.
+ */
+nrfx_err_t nrfx_pdm_ring_start(nrfx_pdm_ring_t * p_ring);
+
+/**
+ * @brief Function for getting the oldest filled ring entry not processed yet.
+ *
+ * @param[in]  p_ring   Pointer to the ring structure.
+ * @param[out] p_length Number of valid samples in the entry. Can be NULL.
+ *
+ * @return Pointer to the entry or NULL if there is no filled entry to be processed.
+ */
+int16_t * nrfx_pdm_ring_get(nrfx_pdm_ring_t const * p_ring, uint16_t * p_length);
+
+/**
+ * @brief Function for releasing the entry returned by @ref nrfx_pdm_ring_get,
+ *        so that it can be filled again.
+ *
+ * @param[in,out] p_ring Pointer to the ring structure.
+ */
+void nrfx_pdm_ring_release(nrfx_pdm_ring_t * p_ring);
+
+/**
+ * @brief Function for configuring the sample filter.
+ *
+ * The filter processes samples in the following order: decimation, high-pass filtering,
+ * and gain with saturation to 16 bits. In the stereo mode, each channel is processed
+ * separately. The filter state is reset when this function is called.
+ *
+ * @param[in] p_config Pointer to the filter configuration. NULL disables the filter.
+ *
+ * @retval NRFX_SUCCESS             The filter was configured successfully.
+ * @retval NRFX_ERROR_BUSY          Sampling is in progress.
+ * @retval NRFX_ERROR_INVALID_PARAM Invalid decimation factor was specified.
+ */
+nrfx_err_t nrfx_pdm_filter_set(nrfx_pdm_filter_config_t const * p_config);
+
+/**
+ * @brief Function for processing samples in place with the configured filter.
+ *
+ * Ring entries are processed automatically if the filter was configured with
+ * @ref nrfx_pdm_filter_config_t::in_irq set. Otherwise, this function can be called
+ * from a deferred context. As the filter keeps its state between calls, buffers
+ * must be processed in the order in which they were filled.
+ *
+ * @param[in,out] p_samples Samples to be processed.
+ * @param[in]     length    Number of samples. Any remainder that does not form
+ *                          a complete decimation set is dropped.
+ *
+ * @return Number of output samples stored at the beginning of @p p_samples.
+ */
+uint16_t nrfx_pdm_filter_process(int16_t * p_samples, uint16_t length);
+
 #ifndef NRFX_DECLARE_ONLY
 NRFX_STATIC_INLINE uint32_t nrfx_pdm_task_address_get(nrf_pdm_task_t task)
 {
@@ -204,11 +204,46 @@ typedef enum
     NRFX_PWM_EVT_END_SEQ1, /**< End of sequence 1 reached. Its data can be
                                 safely modified now. */
     NRFX_PWM_EVT_STOPPED,  ///< The PWM peripheral has been stopped.
+    NRFX_PWM_EVT_STREAM_UNDERFLOW, /**< Streaming playback only. The producer
+                                        did not provide the next chunk in time,
+                                        so idle values are played instead. */
 } nrfx_pwm_evt_type_t;
 
 /** @brief PWM driver event handler type. */
 typedef void (* nrfx_pwm_handler_t)(nrfx_pwm_evt_type_t event_type, void * p_context);
 
+/**
+ * @brief PWM streaming playback producer type.
+ *
+ * The producer is called from the PWM interrupt handler each time one of the two
+ * sequences of the peripheral is loaded and can be replaced with the next chunk
+ * of duty cycle values. The producer sets @p values and @p length in @p p_chunk.
+ * The @p repeats and @p end_delay fields are preset with values from the stream
+ * configuration and can be modified as well.
+ *
+ * Values of a chunk are read by the peripheral until the producer is called twice more,
+ * so the data returned two calls before can be reused in each call. In particular, two
+ * buffers are enough when the producer fills them directly from the interrupt handler.
+ *
+ * @param[in,out] p_chunk   Chunk to be played next. Setting its length to 0 signals
+ *                          that no data is available yet, which results in
+ *                          @ref NRFX_PWM_EVT_STREAM_UNDERFLOW.
+ * @param[in]     p_context Context passed to the event handler.
+ *
+ * @retval true  Playback is to be continued.
+ * @retval false End of the stream. The peripheral is stopped after the chunk
+ *               that is being played now and @p p_chunk is ignored.
+ */
+typedef bool (* nrfx_pwm_stream_producer_t)(nrf_pwm_sequence_t * p_chunk, void * p_context);
+
+/** @brief PWM streaming playback configuration structure. */
+typedef struct
+{
+    nrfx_pwm_stream_producer_t producer;   ///< Function providing chunks of duty cycle values.
+    uint16_t                   idle_value; ///< Duty cycle value played on all channels when the producer has no data.
+    uint32_t                   repeats;    ///< Default number of times each duty cycle value is repeated (after being played once).
+} nrfx_pwm_stream_config_t;
+
 /**
  * @brief Function for initializing the PWM driver.
  *
@@ -302,6 +337,32 @@ uint32_t nrfx_pwm_complex_playback(nrfx_pwm_t const *         p_instance,
                                    uint16_t                   playback_count,
                                    uint32_t                   flags);
 
+/**
+ * @brief Function for starting a streaming playback of arbitrary length.
+ *
+ * Both sequences of the peripheral are played alternately and each of them is
+ * replaced with the next chunk obtained from the producer as soon as it is loaded,
+ * so the playback is continuous. The playback ends when the producer signals the end
+ * of the stream or when @ref nrfx_pwm_stop is called.
+ *
+ * The @ref NRFX_PWM_EVT_END_SEQ0, @ref NRFX_PWM_EVT_END_SEQ1, and
+ * @ref NRFX_PWM_EVT_FINISHED events are not generated during the streaming playback.
+ *
+ * @note The driver must be initialized with an event handler, as the producer is
+ *       called from the PWM interrupt handler.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ * @param[in] p_config   Pointer to the streaming configuration.
+ * @param[in] flags      Additional options. Only @ref NRFX_PWM_FLAG_START_VIA_TASK
+ *                       is supported, or 0 for default settings.
+ *
+ * @return Address of the task to be triggered to start the playback if the @ref
+ *         NRFX_PWM_FLAG_START_VIA_TASK flag was used, 0 otherwise.
+ */
+uint32_t nrfx_pwm_stream_playback(nrfx_pwm_t const *               p_instance,
+                                  nrfx_pwm_stream_config_t const * p_config,
+                                  uint32_t                         flags);
+
 /**
  * @brief Function for advancing the active sequence.
  *
@@ -119,15 +119,23 @@ typedef struct
     uint16_t accdbl; /**< Accumulated double transitions. */
 } nrfx_qdec_report_data_evt_t;
 
+/** @brief QDEC position event data. */
+typedef struct
+{
+    int32_t position; /**< Position in transitions. */
+    int16_t velocity; /**< Transitions accumulated in the last report period. */
+} nrfx_qdec_position_data_evt_t;
+
 /** @brief QDEC event handler structure. */
 typedef struct
 {
     nrf_qdec_event_t  type; /**< Event type. */
     union
     {
-        nrfx_qdec_sample_data_evt_t sample; /**< Sample event data. */
-        nrfx_qdec_report_data_evt_t report; /**< Report event data. */
-    } data;                                 /**< Union to store event data. */
+        nrfx_qdec_sample_data_evt_t   sample;   /**< Sample event data. */
+        nrfx_qdec_report_data_evt_t   report;   /**< Report event data. */
+        nrfx_qdec_position_data_evt_t position; /**< Report event data in the position tracking mode. */
+    } data;                                     /**< Union to store event data. */
 } nrfx_qdec_event_t;
 
 /**
@@ -182,6 +190,61 @@ void nrfx_qdec_disable(void);
  */
 void nrfx_qdec_accumulators_read(int16_t * p_acc, int16_t * p_accdbl);
 
+/**
+ * @brief Function for starting the position tracking mode.
+ *
+ * In this mode, the driver accumulates the reports into a 32-bit position, so the
+ * 16-bit accumulator of the peripheral cannot overflow as long as the report period
+ * is short enough for the fastest movement. The @ref NRF_QDEC_EVENT_REPORTRDY event
+ * is then passed to the event handler, with the position event data, only when
+ * the position has changed by at least @p threshold transitions since the last
+ * notification. The intermediate reports are handled within the driver.
+ *
+ * @note The driver must be initialized with reporting enabled.
+ * @note Function asserts if module is uninitialized.
+ *
+ * @param[in] position  Initial position in transitions.
+ * @param[in] threshold Position change that triggers the notification. Must not be 0.
+ *
+ * @retval NRFX_SUCCESS             Position tracking was started.
+ * @retval NRFX_ERROR_INVALID_STATE Reporting is disabled.
+ */
+nrfx_err_t nrfx_qdec_position_tracking_start(int32_t position, uint32_t threshold);
+
+/**
+ * @brief Function for stopping the position tracking mode.
+ *
+ * Afterwards, all reports are passed to the event handler with the report event data.
+ *
+ * @note Function asserts if module is uninitialized.
+ */
+void nrfx_qdec_position_tracking_stop(void);
+
+/**
+ * @brief Function for getting the current position in the position tracking mode.
+ *
+ * The position includes the transitions that are accumulated in the peripheral,
+ * but not reported yet, so it is up-to-date regardless of the report period.
+ * The accumulator is not cleared.
+ *
+ * @note Function asserts if position tracking is not started.
+ *
+ * @return Position in transitions.
+ */
+int32_t nrfx_qdec_position_get(void);
+
+/**
+ * @brief Function for getting the velocity estimate in the position tracking mode.
+ *
+ * The velocity is the number of transitions accumulated in the last report period
+ * in which movement was detected.
+ *
+ * @note Function asserts if position tracking is not started.
+ *
+ * @return Velocity in transitions per report period.
+ */
+int16_t nrfx_qdec_velocity_get(void);
+
 /**
  * @brief Function for returning the address of the specified QDEC task.
  *
@@ -181,6 +181,66 @@ typedef struct
 /** @brief QSPI driver event handler type. */
 typedef void (*nrfx_qspi_handler_t)(nrfx_qspi_evt_t event, void * p_context);
 
+#ifndef NRFX_QSPI_SG_BOUNCE_SIZE
+/**
+ * @brief Size of the internal buffer used for scatter-gather segment fragments, in bytes.
+ *
+ * Must be a multiple of 4.
+ */
+#define NRFX_QSPI_SG_BOUNCE_SIZE 32
+#endif
+
+/** @brief Structure describing a single segment of a scatter-gather transfer. */
+typedef struct
+{
+    void * p_buffer; ///< Pointer to the segment data.
+    size_t length;   ///< Length of the segment in bytes.
+} nrfx_qspi_iovec_t;
+
+/** @brief QSPI job types. */
+typedef enum
+{
+    NRFX_QSPI_JOB_READ,   ///< Read from the memory.
+    NRFX_QSPI_JOB_WRITE,  ///< Write to the memory.
+    NRFX_QSPI_JOB_ERASE,  ///< Erase of consecutive blocks.
+    NRFX_QSPI_JOB_READV,  ///< Scatter-gather read from the memory.
+    NRFX_QSPI_JOB_WRITEV, ///< Scatter-gather write to the memory.
+} nrfx_qspi_job_type_t;
+
+typedef struct nrfx_qspi_job_s nrfx_qspi_job_t;
+
+/**
+ * @brief QSPI job completion handler type.
+ *
+ * @param[in] p_job     Pointer to the completed job.
+ * @param[in] p_context User context.
+ */
+typedef void (*nrfx_qspi_job_handler_t)(nrfx_qspi_job_t * p_job, void * p_context);
+
+/**
+ * @brief Structure describing a QSPI job.
+ *
+ * The structure is owned by the driver from the moment it is submitted with
+ * @ref nrfx_qspi_job_submit until its handler is called.
+ */
+struct nrfx_qspi_job_s
+{
+    nrfx_qspi_job_type_t      type;        ///< Job type.
+    uint32_t                  address;     ///< Memory address of the transfer or of the first block to erase.
+    void *                    p_buffer;    ///< Data buffer. Used by read and write jobs.
+    size_t                    length;      ///< Length of the data buffer in bytes.
+    nrfx_qspi_iovec_t const * p_iov;       ///< Array of segments. Used by scatter-gather jobs.
+    size_t                    iov_count;   ///< Number of segments in the array.
+    nrf_qspi_erase_len_t      erase_len;   ///< Size of a single erase block. Used by erase jobs.
+    uint32_t                  erase_count; ///< Number of blocks to erase. Used by erase jobs.
+    nrfx_qspi_job_handler_t   handler;     ///< Completion handler. Can be NULL.
+    void *                    p_context;   ///< Context passed to the completion handler.
+    uint32_t                  progress;    ///< Internal: number of blocks erased or bytes transferred.
+    size_t                    iov_idx;     ///< Internal: index of the current segment.
+    size_t                    iov_offset;  ///< Internal: offset in the current segment.
+    nrfx_qspi_job_t *         p_next;      ///< Internal: next job in the queue.
+};
+
 /**
  * @brief Function for initializing the QSPI driver instance.
  *
@@ -239,6 +299,7 @@ void nrfx_qspi_uninit(void);
  * @retval NRFX_ERROR_BUSY         The driver currently handles another operation.
  * @retval NRFX_ERROR_INVALID_ADDR The provided buffer is not placed in the Data RAM region
  *                                 or its address is not aligned to a 32-bit word.
+ * @retval NRFX_ERROR_TIMEOUT      The memory did not leave the automatic DPM in time.
  */
 nrfx_err_t nrfx_qspi_read(void *   p_rx_buffer,
                           size_t   rx_buffer_length,
@@ -270,11 +331,58 @@ nrfx_err_t nrfx_qspi_read(void *   p_rx_buffer,
  * @retval NRFX_ERROR_BUSY         The driver currently handles other operation.
  * @retval NRFX_ERROR_INVALID_ADDR The provided buffer is not placed in the Data RAM region
  *                                 or its address is not aligned to a 32-bit word.
+ * @retval NRFX_ERROR_TIMEOUT      The memory did not leave the automatic DPM in time.
  */
 nrfx_err_t nrfx_qspi_write(void const * p_tx_buffer,
                            size_t       tx_buffer_length,
                            uint32_t     dst_address);
 
+/**
+ * @brief Function for reading consecutive data from the QSPI memory into several buffers.
+ *
+ * Segments are filled in order, starting at @p src_address. Parts of segments that
+ * are placed in the Data RAM region at the same offset from a 32-bit word boundary as their
+ * memory address are read directly by the peripheral. Remaining fragments are read in chunks of
+ * up to @ref NRFX_QSPI_SG_BOUNCE_SIZE bytes through an internal buffer and copied to the segments.
+ *
+ * @note The function can be used only in blocking mode. In interrupt mode,
+ *       submit a @ref NRFX_QSPI_JOB_READV job with @ref nrfx_qspi_job_submit instead.
+ *
+ * @param[in] p_iov       Array of segments to be filled.
+ * @param[in] iov_count   Number of segments in the array.
+ * @param[in] src_address Address in memory to read from.
+ *
+ * @retval NRFX_SUCCESS            The operation was successful.
+ * @retval NRFX_ERROR_INVALID_ADDR The address is not aligned to a 32-bit word.
+ * @retval NRFX_ERROR_FORBIDDEN    The driver works in interrupt mode.
+ */
+nrfx_err_t nrfx_qspi_readv(nrfx_qspi_iovec_t const * p_iov,
+                           size_t                    iov_count,
+                           uint32_t                  src_address);
+
+/**
+ * @brief Function for writing data from several buffers to consecutive QSPI memory locations.
+ *
+ * Segments are handled as in @ref nrfx_qspi_readv. Segments do not need to be placed
+ * in the Data RAM region; the ones that are not are written through the internal buffer.
+ * If the total length is not a multiple of 4, the last word is padded with 0xFF bytes,
+ * which leaves the corresponding memory bytes unchanged.
+ *
+ * @note The function can be used only in blocking mode. In interrupt mode,
+ *       submit a @ref NRFX_QSPI_JOB_WRITEV job with @ref nrfx_qspi_job_submit instead.
+ *
+ * @param[in] p_iov       Array of segments to be written.
+ * @param[in] iov_count   Number of segments in the array.
+ * @param[in] dst_address Address in memory to write to.
+ *
+ * @retval NRFX_SUCCESS            The operation was successful.
+ * @retval NRFX_ERROR_INVALID_ADDR The address is not aligned to a 32-bit word.
+ * @retval NRFX_ERROR_FORBIDDEN    The driver works in interrupt mode.
+ */
+nrfx_err_t nrfx_qspi_writev(nrfx_qspi_iovec_t const * p_iov,
+                            size_t                    iov_count,
+                            uint32_t                  dst_address);
+
 /**
  * @brief Function for starting erasing of one memory block - 4KB, 64KB, or the whole chip.
  *
@@ -297,6 +405,7 @@ nrfx_err_t nrfx_qspi_write(void const * p_tx_buffer,
  *                                 was commissioned (handler mode).
  * @retval NRFX_ERROR_INVALID_ADDR The provided start address is not aligned to a 32-bit word.
  * @retval NRFX_ERROR_BUSY         The driver currently handles another operation.
+ * @retval NRFX_ERROR_TIMEOUT      The memory did not leave the automatic DPM in time.
  */
 nrfx_err_t nrfx_qspi_erase(nrf_qspi_erase_len_t length,
                            uint32_t             start_address);
@@ -327,6 +436,33 @@ nrfx_qspi_evt_ext_t const * nrfx_qspi_event_extended_get(void);
  */
 bool nrfx_qspi_xfer_buffered_check(void);
 
+/**
+ * @brief Function for queuing a read, write or erase job.
+ *
+ * Jobs are executed back to back from the QSPI interrupt. Reads and writes are executed
+ * in the submission order. Erase jobs are split into single blocks and queued reads and writes
+ * are executed between consecutive blocks, so that a long erase does not delay them by more
+ * than one block erase time. The QSPI peripheral polls the status register of the memory
+ * before it generates the READY event, so the next job starts only when the memory is no longer busy.
+ *
+ * Scatter-gather jobs are executed in consecutive transfers, each started from the interrupt
+ * handler as soon as the previous one completes. See @ref nrfx_qspi_readv for how the segments
+ * are transferred.
+ *
+ * @note Reads and writes are not ordered with respect to pending erase jobs.
+ * @note The function can be used only if the driver was initialized with a handler.
+ *
+ * @param[in] p_job Pointer to the job. Must stay valid until its handler is called.
+ *
+ * @retval NRFX_SUCCESS             The job was queued.
+ * @retval NRFX_ERROR_INVALID_ADDR  The buffer is not placed in the Data RAM region or is not
+ *                                  word-aligned, or the address is not word-aligned.
+ * @retval NRFX_ERROR_INVALID_PARAM Invalid number of blocks to erase or empty segment array.
+ * @retval NRFX_ERROR_FORBIDDEN     The driver works in blocking mode.
+ * @retval NRFX_ERROR_TIMEOUT       The memory did not leave the automatic DPM in time.
+ */
+nrfx_err_t nrfx_qspi_job_submit(nrfx_qspi_job_t * p_job);
+
 /**
  * @brief Function for getting the current driver status and status byte of memory device with
  *        testing WIP (write in progress) bit.
@@ -407,6 +543,12 @@ nrfx_err_t nrfx_qspi_lfm_start(nrf_qspi_cinstr_conf_t const * p_config);
  *
  * Both specified buffers must be at least @p transfer_length bytes in size.
  *
+ * Data is transferred through the CINSTRDAT registers in frames of 8 bytes, as the QSPI
+ * peripheral has no EasyDMA support for custom instructions. Transfers that only send data
+ * use a tight register loop. Large buffers, like display framebuffers, can be streamed in
+ * chunks by calling the function repeatedly with @p finalize set to false for all but
+ * the last chunk.
+ *
  * @param[in]  p_tx_buffer     Pointer to the array with data to send.
  *                             Can be NULL if there is nothing to send.
  * @param[out] p_rx_buffer     Pointer to the array for receiving data.
@@ -424,6 +566,76 @@ nrfx_err_t nrfx_qspi_lfm_xfer(void const * p_tx_buffer,
                               size_t       transfer_length,
                               bool         finalize);
 
+/** @brief Structure for the automatic Deep Power-down Mode (DPM) configuration. */
+typedef struct
+{
+    uint32_t idle_timeout;  ///< Idle time after which the memory enters DPM, in units passed to @ref nrfx_qspi_dpm_idle_process.
+    uint16_t enter_time_us; ///< Time needed by the memory to enter DPM (tDP), in microseconds.
+    uint16_t exit_time_us;  ///< Time needed by the memory to exit DPM (tRES1), in microseconds.
+} nrfx_qspi_dpm_config_t;
+
+/** @brief Structure holding the automatic DPM statistics. */
+typedef struct
+{
+    uint32_t enter_count;        ///< Number of times the memory was put into DPM.
+    uint32_t wake_count;         ///< Number of wake-ups caused by memory accesses.
+    uint32_t wake_time_us_total; ///< Accumulated time of the wake-ups, in microseconds.
+    uint32_t wake_time_us_max;   ///< Longest wake-up, in microseconds.
+} nrfx_qspi_dpm_stats_t;
+
+/**
+ * @brief Function for enabling the automatic Deep Power-down Mode (DPM).
+ *
+ * When enabled, the memory is put into DPM by @ref nrfx_qspi_dpm_idle_process after
+ * it stays idle for the configured time, and it is woken up transparently before the next
+ * transfer, erase or custom instruction. The QSPI peripheral holds the transfer for
+ * the configured exit time (tRES1) after sending the release command.
+ *
+ * @note Accesses through the XIP region do not wake the memory up. Do not use this
+ *       feature together with XIP.
+ *
+ * @param[in] p_config Pointer to the structure with the DPM configuration.
+ *
+ * @retval NRFX_SUCCESS    Automatic DPM was enabled.
+ * @retval NRFX_ERROR_BUSY Driver currently handles other operation.
+ */
+nrfx_err_t nrfx_qspi_dpm_auto_enable(nrfx_qspi_dpm_config_t const * p_config);
+
+/**
+ * @brief Function for disabling the automatic DPM.
+ *
+ * The memory is woken up if it is in DPM.
+ *
+ * @retval NRFX_SUCCESS       Automatic DPM was disabled.
+ * @retval NRFX_ERROR_BUSY    Driver currently handles other operation.
+ * @retval NRFX_ERROR_TIMEOUT The memory did not leave DPM in time.
+ */
+nrfx_err_t nrfx_qspi_dpm_auto_disable(void);
+
+/**
+ * @brief Function for advancing the idle time of the automatic DPM.
+ *
+ * The driver has no time base of its own, so the function is to be called periodically,
+ * for example from a timer handler or an idle hook. The idle time is counted only while
+ * the driver is idle and is reset by every memory access. When it reaches the configured
+ * timeout, the memory is put into DPM.
+ *
+ * @param[in] elapsed Time elapsed since the previous call, in units of the configured timeout.
+ */
+void nrfx_qspi_dpm_idle_process(uint32_t elapsed);
+
+/**
+ * @brief Function for getting the automatic DPM statistics.
+ *
+ * The wake-up time is measured with busy-wait steps of 1 us, so it is approximate.
+ *
+ * @param[out] p_stats Pointer to the structure to be filled with the statistics.
+ */
+void nrfx_qspi_dpm_stats_get(nrfx_qspi_dpm_stats_t * p_stats);
+
+/** @brief Function for clearing the automatic DPM statistics. */
+void nrfx_qspi_dpm_stats_clear(void);
+
 #if NRF_QSPI_HAS_XIP_ENC || defined(__NRFX_DOXYGEN__)
 /**
  * @brief Function for setting the XIP encryption.
@@ -450,6 +662,57 @@ nrfx_err_t nrfx_qspi_xip_encrypt(nrf_qspi_encryption_t const * p_config);
 nrfx_err_t nrfx_qspi_dma_encrypt(nrf_qspi_encryption_t const * p_config);
 #endif
 
+#if (defined(CACHE_PRESENT) && !defined(NRF_TRUSTZONE_NONSECURE)) || defined(__NRFX_DOXYGEN__)
+/** @brief Structure holding the cache profiling counters of the XIP region. */
+typedef struct
+{
+    uint32_t instruction_hits;   ///< Number of instruction fetches served from the cache.
+    uint32_t instruction_misses; ///< Number of instruction fetches that missed the cache.
+    uint32_t data_hits;          ///< Number of data reads served from the cache.
+    uint32_t data_misses;        ///< Number of data reads that missed the cache.
+} nrfx_qspi_xip_cache_stats_t;
+
+/**
+ * @brief Function for configuring the cache used for XIP accesses.
+ *
+ * The cache is invalidated before it is enabled, so that no stale content of the external
+ * memory is used after the memory was modified with DMA transfers.
+ *
+ * @note The cache is shared with the internal flash memory, so disabling it also affects
+ *       code executed from the internal flash.
+ *
+ * @param[in] enable    True if the cache is to be enabled, false otherwise.
+ * @param[in] profiling True if the cache profiling counters are to be enabled, false otherwise.
+ */
+void nrfx_qspi_xip_cache_configure(bool enable, bool profiling);
+
+/**
+ * @brief Function for reading ahead the given XIP area into the cache.
+ *
+ * The cache has no hardware prefetch, so the function reads a single word of each
+ * cache line in the area. Subsequent accesses to the area are then served from the cache,
+ * as long as the lines are not evicted.
+ *
+ * @param[in] offset Offset of the area from the start of the XIP region.
+ * @param[in] length Length of the area in bytes.
+ */
+void nrfx_qspi_xip_prefetch(uint32_t offset, size_t length);
+
+/**
+ * @brief Function for getting the cache profiling counters of the XIP region.
+ *
+ * @param[out] p_stats Pointer to the structure to be filled with the counters.
+ */
+void nrfx_qspi_xip_cache_stats_get(nrfx_qspi_xip_cache_stats_t * p_stats);
+
+/**
+ * @brief Function for clearing the cache profiling counters.
+ *
+ * @note Counters of both the internal flash and XIP regions are cleared.
+ */
+void nrfx_qspi_xip_cache_stats_clear(void);
+#endif
+
 /** @} */
 
 
@@ -103,6 +103,48 @@ void nrfx_rng_stop(void);
 /** @brief Function for uninitializing the nrfx_rng module. */
 void nrfx_rng_uninit(void);
 
+/**
+ * @brief Function for enabling the entropy pool.
+ *
+ * When the pool is enabled, random values are collected in the background into the provided
+ * ring buffer instead of being passed to the event handler. Generation is stopped when the pool
+ * becomes full and restarted by @ref nrfx_rng_pool_get when the number of bytes in the pool drops
+ * below the low watermark. The bias correction of the peripheral is enabled for the whole
+ * lifetime of the pool, regardless of the driver configuration.
+ *
+ * @param[in] p_buffer      Pointer to the pool buffer.
+ * @param[in] size          Size of the pool buffer. Must be a power of 2.
+ * @param[in] low_watermark Number of bytes in the pool below which generation is restarted.
+ *                          Must not be greater than @p size.
+ *
+ * @retval NRFX_SUCCESS             The pool was enabled and is being filled.
+ * @retval NRFX_ERROR_INVALID_STATE The driver is not initialized or the pool is already enabled.
+ */
+nrfx_err_t nrfx_rng_pool_enable(uint8_t * p_buffer, uint16_t size, uint16_t low_watermark);
+
+/**
+ * @brief Function for disabling the entropy pool.
+ *
+ * Generation is stopped and the bytes remaining in the pool are discarded.
+ * Bias correction is restored according to the driver configuration.
+ */
+void nrfx_rng_pool_disable(void);
+
+/**
+ * @brief Function for getting random bytes from the entropy pool.
+ *
+ * The function does not wait for the peripheral. It only copies the bytes that are
+ * available in the pool and returns immediately. It is lock-free and can be called
+ * concurrently from any context, including the RNG event handler.
+ *
+ * @param[out] p_buf Pointer to the buffer for random bytes.
+ * @param[in]  len   Number of requested bytes.
+ *
+ * @return Number of bytes copied to @p p_buf, which is less than @p len
+ *         if the pool does not contain enough bytes.
+ */
+uint16_t nrfx_rng_pool_get(uint8_t * p_buf, uint16_t len);
+
 /** @} */
 
 
@@ -171,6 +171,8 @@ typedef struct
 {
     nrf_saadc_value_t * p_buffer; ///< Pointer to the buffer with converted samples.
     uint16_t            size;     ///< Number of samples in the buffer.
+    uint32_t            sequence; ///< Number of buffers completed since the conversion was triggered.
+    bool                overrun;  ///< True if the buffer was refilled in the ring mode before it was released.
 } nrfx_saadc_done_evt_t;
 
 /** @brief SAADC driver limit event data. */
@@ -354,6 +356,45 @@ nrfx_err_t nrfx_saadc_advanced_mode_set(uint32_t                        channel_
  */
 nrfx_err_t nrfx_saadc_buffer_set(nrf_saadc_value_t * p_buffer, uint16_t size);
 
+/**
+ * @brief Function for supplying a ring of buffers to be cycled by the driver.
+ *
+ * In the ring mode the driver latches the next buffer of the ring on every STARTED event
+ * by itself, so @ref NRFX_SAADC_EVT_BUF_REQ is not generated and the conversion continues
+ * until @ref nrfx_saadc_abort() is called. Combined with the internal timer or with
+ * the SAMPLE task triggered over (D)PPI and @p start_on_end (or the END-to-START (D)PPI
+ * connection) in advanced mode configuration, sampling runs gap-free without CPU involvement
+ * in the buffer swap.
+ *
+ * Each filled buffer is reported with @ref NRFX_SAADC_EVT_DONE and must be returned with
+ * @ref nrfx_saadc_ring_buffer_release() once processed. A buffer that is reused while still
+ * unreleased is reported with the @p overrun flag set.
+ *
+ * @note The ring mode can be used only in the advanced non-blocking mode. It ends
+ *       when @ref NRFX_SAADC_EVT_FINISHED is generated.
+ *
+ * @param[in] p_buffers Pointer to the contiguous memory holding @p count buffers.
+ * @param[in] size      Number of @ref nrf_saadc_value_t samples in each buffer.
+ * @param[in] count     Number of buffers in the ring. Must be at least 2.
+ *
+ * @retval NRFX_SUCCESS                   The ring was supplied successfully.
+ * @retval NRFX_ERROR_INVALID_ADDR        The provided memory is not in the Data RAM region.
+ * @retval NRFX_ERROR_INVALID_LENGTH      The buffer size is not aligned to the number of activated
+ *                                        channels or is too long for the EasyDMA to handle.
+ * @retval NRFX_ERROR_INVALID_PARAM       Less than two buffers were provided.
+ * @retval NRFX_ERROR_INVALID_STATE       The driver is not in the advanced non-blocking mode
+ *                                        or the conversion is ongoing.
+ * @retval NRFX_ERROR_ALREADY_INITIALIZED Buffers were already supplied.
+ */
+nrfx_err_t nrfx_saadc_ring_set(nrf_saadc_value_t * p_buffers, uint16_t size, uint8_t count);
+
+/**
+ * @brief Function for releasing the oldest ring buffer reported with @ref NRFX_SAADC_EVT_DONE.
+ *
+ * Buffers are released in the order in which they were reported.
+ */
+void nrfx_saadc_ring_buffer_release(void);
+
 /**
  * @brief Function for triggering the conversion in the configured mode.
  *
@@ -403,6 +444,97 @@ void nrfx_saadc_abort(void);
  */
 nrfx_err_t nrfx_saadc_limits_set(uint8_t channel, int16_t limit_low, int16_t limit_high);
 
+/**
+ * @brief Function for starting the limit monitoring mode.
+ *
+ * In this mode, conversions are triggered in hardware by @p trigger_event, for example
+ * an RTC or TIMER compare event, and the results are written to a scratch buffer inside
+ * the driver. The buffer is rearmed in hardware after every conversion, and the results
+ * are never reported. The CPU is woken up only by @ref NRFX_SAADC_EVT_LIMIT events,
+ * so the limits of the monitored channels should be set with @ref nrfx_saadc_limits_set.
+ *
+ * @note The advanced mode must be configured with an event handler, without the internal timer,
+ *       and with no buffer set.
+ * @note The mode is left only with @ref nrfx_saadc_monitor_stop.
+ *
+ * @param[in] trigger_event      Address of the event that triggers conversions.
+ * @param[in] sample_ppi_channel (D)PPI channel connecting @p trigger_event with the SAMPLE task.
+ * @param[in] start_ppi_channel  (D)PPI channel connecting the END event with the START task.
+ *
+ * @retval NRFX_SUCCESS             Monitoring is started.
+ * @retval NRFX_ERROR_INVALID_STATE The driver is not configured in the non-blocking
+ *                                  advanced mode.
+ * @retval NRFX_ERROR_BUSY          A buffer is already set for the driver.
+ */
+nrfx_err_t nrfx_saadc_monitor_start(uint32_t trigger_event,
+                                    uint8_t  sample_ppi_channel,
+                                    uint8_t  start_ppi_channel);
+
+/**
+ * @brief Function for stopping the limit monitoring mode.
+ *
+ * The (D)PPI channels used by the mode are disabled and their endpoints are cleared.
+ * The driver returns to the advanced mode with the limits kept.
+ */
+void nrfx_saadc_monitor_stop(void);
+
+/**
+ * @brief Function for splitting interleaved conversion results into per-channel buffers.
+ *
+ * In the advanced mode with several channels activated, the SAADC stores one sample
+ * of each activated channel in ascending channel order, one set after another.
+ * This function writes samples of each activated channel into a separate output buffer
+ * and optionally decimates them with a boxcar (first-order CIC) filter, that is each output
+ * sample is the average of @p decimation consecutive samples of the given channel.
+ *
+ * @note On cores with the DSP extension, single-channel decimation uses SIMD instructions.
+ *
+ * @param[in]  p_samples  Pointer to the buffer with interleaved samples, typically reported
+ *                        with @ref NRFX_SAADC_EVT_DONE.
+ * @param[in]  size       Number of @ref nrf_saadc_value_t samples in @p p_samples.
+ * @param[in]  decimation Number of samples averaged into one output sample. Use 1 to only
+ *                        deinterleave the samples.
+ * @param[out] pp_outputs Array of output buffers, one for each activated channel in ascending
+ *                        channel order. Each buffer must be able to hold
+ *                        @p size / (activated channel count * @p decimation) samples.
+ *                        The output may overlap the input only for the first channel.
+ *
+ * @retval NRFX_SUCCESS             Samples were processed successfully.
+ * @retval NRFX_ERROR_INVALID_STATE No channels are activated.
+ * @retval NRFX_ERROR_INVALID_PARAM Decimation factor equal to 0 was requested.
+ * @retval NRFX_ERROR_INVALID_LENGTH @p size is not a multiple of the activated channel count
+ *                                   multiplied by @p decimation.
+ */
+nrfx_err_t nrfx_saadc_samples_process(nrf_saadc_value_t const *   p_samples,
+                                      uint16_t                    size,
+                                      uint16_t                    decimation,
+                                      nrf_saadc_value_t * const * pp_outputs);
+
+/**
+ * @brief Function for converting samples of one channel to microvolts.
+ *
+ * The scale of the channel is derived from its gain, reference and mode when it is configured
+ * and from the resolution set with the activation of the channel. The offset measured
+ * with @ref nrfx_saadc_offset_calibrate is already compensated by the SAADC in the samples.
+ *
+ * @note The samples must belong to the given channel only, for example an output
+ *       of @ref nrfx_saadc_samples_process.
+ *
+ * @param[in]  channel   Channel the samples were taken on.
+ * @param[in]  p_samples Pointer to the buffer with samples.
+ * @param[in]  size      Number of samples in @p p_samples.
+ * @param[out] p_output  Pointer to the buffer the voltages in microvolts are written to.
+ *                       It must be able to hold @p size values.
+ *
+ * @retval NRFX_SUCCESS              Samples were converted successfully.
+ * @retval NRFX_ERROR_INVALID_STATE  The channel is not activated.
+ * @retval NRFX_ERROR_NOT_SUPPORTED  The channel uses the VDD reference, so its scale is unknown.
+ */
+nrfx_err_t nrfx_saadc_samples_convert(uint8_t                   channel,
+                                      nrf_saadc_value_t const * p_samples,
+                                      uint16_t                  size,
+                                      int32_t *                 p_output);
+
 /**
  * @brief Function for starting the SAADC offset calibration.
  *
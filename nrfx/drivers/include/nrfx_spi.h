@@ -251,6 +251,9 @@ void nrfx_spi_uninit(nrfx_spi_t const * p_instance);
  * Otherwise, the transfer is performed in blocking mode, which means that this function
  * returns when the transfer is finished.
  *
+ * @note If @ref NRFX_SPI_EASYDMA_BRIDGE_ENABLED is set, transfers with buffers in RAM
+ *       are executed by the SPIM peripheral with EasyDMA, at the cost of a single interrupt.
+ *
  * @param p_instance  Pointer to the driver instance structure.
  * @param p_xfer_desc Pointer to the transfer descriptor.
  * @param flags       Transfer options (0 for default settings).
@@ -37,6 +37,7 @@
 #include <nrfx.h>
 #include <hal/nrf_spim.h>
 #include <hal/nrf_gpio.h>
+#include <hal/nrf_timer.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -253,9 +254,28 @@ typedef struct
  */
 typedef enum
 {
-    NRFX_SPIM_EVENT_DONE, ///< Transfer done.
+    NRFX_SPIM_EVENT_DONE,      ///< Transfer done.
+    NRFX_SPIM_EVENT_LIST_DONE, ///< All transfers from the transaction list done.
+    NRFX_SPIM_EVENT_HALF_DONE, ///< First half of the circular acquisition buffer filled.
+    NRFX_SPIM_EVENT_FULL_DONE, ///< Second half of the circular acquisition buffer filled.
 } nrfx_spim_evt_type_t;
 
+/** @brief Transaction list item structure. */
+typedef struct
+{
+    nrfx_spim_xfer_desc_t xfer;       ///< Transfer buffers and lengths.
+    uint8_t               ss_pin;     ///< Slave Select pin used for the transaction.
+                                      /**< Set to @ref NRFX_SPIM_PIN_NOT_USED to use
+                                       *   the Slave Select configured for the instance.
+                                       *   Any other pin is controlled by the driver as
+                                       *   a regular GPIO, with the polarity configured
+                                       *   for the instance, and must be configured
+                                       *   as output by the user. */
+#if NRFX_CHECK(NRFX_SPIM_EXTENDED_ENABLED) || defined(__NRFX_DOXYGEN__)
+    uint8_t               cmd_length; ///< Number of command bytes, as in @ref nrfx_spim_xfer_dcx.
+#endif
+} nrfx_spim_xfer_list_item_t;
+
 /** @brief SPIM event description with transmission details. */
 typedef struct
 {
@@ -267,6 +287,83 @@ typedef struct
 typedef void (* nrfx_spim_evt_handler_t)(nrfx_spim_evt_t const * p_event,
                                          void *                  p_context);
 
+/**
+ * @brief Configuration structure of the SPIM circular acquisition.
+ *
+ * The acquisition buffer holds @p sample_count samples of @p sample_size bytes each.
+ * Every transfer sends the same @p p_tx_buffer and stores the received sample right after
+ * the previous one.
+ */
+typedef struct
+{
+    uint8_t const *  p_tx_buffer;       ///< Pointer to the data sent in every transfer, for example an ADC read command.
+    size_t           tx_length;         ///< Length of @p p_tx_buffer.
+    uint8_t *        p_buffer;          ///< Pointer to the acquisition buffer of @p sample_count * @p sample_size bytes.
+    size_t           sample_size;       ///< Number of bytes received in a single transfer.
+    uint16_t         sample_count;      ///< Number of samples in the buffer. Must be even.
+    NRF_TIMER_Type * p_counter;         ///< TIMER instance used to count transfers.
+                                        /**< The TIMER is switched to the counter mode and must not be
+                                         *   used for any other purpose while the acquisition is active. */
+    uint8_t          count_ppi_channel; ///< (D)PPI channel connecting the END event with the COUNT task of @p p_counter.
+    uint8_t          stop_ppi_channel;  ///< (D)PPI channel connecting the COMPARE0 event of @p p_counter with the STOP task.
+} nrfx_spim_circular_config_t;
+
+/** @brief Configuration structure of a device connected to a shared SPIM bus. */
+typedef struct
+{
+    uint8_t              ss_pin;         ///< Slave Select pin number of the device (optional).
+                                         /**< Set to @ref NRFX_SPIM_PIN_NOT_USED
+                                          *   if this signal is not needed. The pin is
+                                          *   controlled by the driver as a regular GPIO. */
+    bool                 ss_active_high; ///< Polarity of the Slave Select pin during transmission.
+    uint8_t              orc;            ///< Overrun character.
+    nrf_spim_frequency_t frequency;      ///< SPIM frequency.
+    nrf_spim_mode_t      mode;           ///< SPIM mode.
+    nrf_spim_bit_order_t bit_order;      ///< SPIM bit order.
+} nrfx_spim_device_config_t;
+
+/**
+ * @brief Shared SPIM bus device default configuration.
+ *
+ * This configuration sets up the device with the following options:
+ * - SS pin active low
+ * - over-run character set to 0xFF
+ * - clock frequency: 4 MHz
+ * - mode: 0 (SCK active high, sample on leading edge of the clock signal)
+ * - MSB shifted out first
+ *
+ * @param[in] _pin_ss SS pin.
+ */
+#define NRFX_SPIM_DEVICE_DEFAULT_CONFIG(_pin_ss)      \
+{                                                     \
+    .ss_pin         = _pin_ss,                        \
+    .ss_active_high = false,                          \
+    .orc            = 0xFF,                           \
+    .frequency      = NRF_SPIM_FREQ_4M,               \
+    .mode           = NRF_SPIM_MODE_0,                \
+    .bit_order      = NRF_SPIM_BIT_ORDER_MSB_FIRST,   \
+}
+
+/**
+ * @brief Structure of a device connected to a shared SPIM bus.
+ *
+ * The structure is initialized with @ref nrfx_spim_device_init and must not be modified by the user.
+ */
+typedef struct
+{
+    nrfx_spim_device_config_t config; ///< Cached device configuration.
+} nrfx_spim_device_t;
+
+/** @brief Structure of a request queued on a shared SPIM bus. */
+typedef struct nrfx_spim_bus_request_s
+{
+    nrfx_spim_device_t const *       p_device;  ///< Device the transfer is addressed to.
+    nrfx_spim_xfer_desc_t            xfer;      ///< Transfer details.
+    nrfx_spim_evt_handler_t          handler;   ///< Handler called when the transfer is done.
+    void *                           p_context; ///< Context passed to the handler.
+    struct nrfx_spim_bus_request_s * p_next;    ///< For internal use by the driver.
+} nrfx_spim_bus_request_t;
+
 /**
  * @brief Function for initializing the SPIM driver instance.
  *
@@ -304,6 +401,30 @@ nrfx_err_t nrfx_spim_init(nrfx_spim_t const *        p_instance,
  */
 void nrfx_spim_uninit(nrfx_spim_t const * p_instance);
 
+/**
+ * @brief Function for suspending the SPIM driver instance.
+ *
+ * The peripheral is disabled, which releases its clock and EasyDMA requests. The driver
+ * configuration and the pin setup are preserved, so that @ref nrfx_spim_resume restores
+ * the instance without a full reinitialization. No transfer can be started while the instance
+ * is suspended.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ *
+ * @retval NRFX_SUCCESS    The instance was suspended or it was already suspended.
+ * @retval NRFX_ERROR_BUSY A transfer is in progress. The instance was not suspended.
+ */
+nrfx_err_t nrfx_spim_suspend(nrfx_spim_t const * p_instance);
+
+/**
+ * @brief Function for resuming the SPIM driver instance suspended with @ref nrfx_spim_suspend.
+ *
+ * If the instance is not suspended, the function has no effect.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ */
+void nrfx_spim_resume(nrfx_spim_t const * p_instance);
+
 /**
  * @brief Function for starting the SPIM data transfer.
  *
@@ -384,8 +505,153 @@ nrfx_err_t nrfx_spim_xfer_dcx(nrfx_spim_t const *           p_instance,
                               nrfx_spim_xfer_desc_t const * p_xfer_desc,
                               uint32_t                      flags,
                               uint8_t                       cmd_length);
+
+/**
+ * @brief Function for calibrating the sample delay for input serial data on MISO.
+ *
+ * The function performs the transfer described by @p p_xfer_desc once for every available
+ * sample delay and compares the received data with @p p_expected. The transfer must read
+ * a pattern known in advance, for example the JEDEC ID of a flash memory, or the data sent on
+ * MOSI when it is looped back to MISO. The delay in the middle of the longest range of delays
+ * for which the data is received correctly is then applied to the instance.
+ *
+ * Calibration is needed at the highest frequencies, where the delay of the signal on the board
+ * traces becomes a significant part of the SCK period. The result depends only on the board and
+ * the connected device, so it can be stored in @ref nrfx_spim_config_t::rx_delay and reused
+ * for subsequent initializations of the driver.
+ *
+ * @note The function can be used only when the driver works in the blocking mode.
+ * @note The receive buffer is overwritten before every transfer.
+ *
+ * @param[in]  p_instance  Pointer to the driver instance structure.
+ * @param[in]  p_xfer_desc Pointer to the descriptor of the transfer that reads the pattern.
+ * @param[in]  p_expected  Pointer to the pattern expected in the receive buffer.
+ *                         Its size must be equal to the length of the receive buffer.
+ * @param[out] p_rx_delay  Pointer to the variable to be filled with the applied delay.
+ *
+ * @retval NRFX_SUCCESS             The delay is calibrated and applied.
+ * @retval NRFX_ERROR_INVALID_STATE The driver works in the non-blocking mode.
+ * @retval NRFX_ERROR_INTERNAL      The pattern is not received correctly with any delay.
+ *                                  The previous delay is restored.
+ * @retval NRFX_ERROR_BUSY          The driver is not ready for a new transfer.
+ * @retval NRFX_ERROR_INVALID_ADDR  The provided buffers are not placed in the Data
+ *                                  RAM region.
+ */
+nrfx_err_t nrfx_spim_rx_delay_calibrate(nrfx_spim_t const *           p_instance,
+                                        nrfx_spim_xfer_desc_t const * p_xfer_desc,
+                                        uint8_t const *               p_expected,
+                                        uint8_t *                     p_rx_delay);
 #endif
 
+/**
+ * @brief Function for executing a list of transactions.
+ *
+ * The transactions are executed one after another, each with its own buffers and Slave Select
+ * and, if extended features are enabled, its own number of DCX command bytes. The next
+ * transaction is set up directly from the END interrupt, without calling the event handler.
+ * A single @ref NRFX_SPIM_EVENT_LIST_DONE event, with the details of the last transfer,
+ * is generated when the whole list is executed. In blocking mode, the function returns
+ * after the last transaction is finished.
+ *
+ * @note Peripherals using EasyDMA (including SPIM) require the transfer buffers
+ *       to be placed in the Data RAM region. If this condition is not met for any
+ *       of the transactions, this function will fail with the error code
+ *       NRFX_ERROR_INVALID_ADDR and no transaction is started.
+ *
+ * @param p_instance Pointer to the driver instance structure.
+ * @param p_list     Pointer to the array of transactions. The array must remain valid until
+ *                   the whole list is executed.
+ * @param count      Number of transactions in @p p_list.
+ *
+ * @retval NRFX_SUCCESS            The procedure is successful.
+ * @retval NRFX_ERROR_BUSY         The driver is not ready for a new transfer.
+ * @retval NRFX_ERROR_INVALID_ADDR The provided buffers are not placed in the Data
+ *                                 RAM region.
+ */
+nrfx_err_t nrfx_spim_xfer_list(nrfx_spim_t const *                p_instance,
+                               nrfx_spim_xfer_list_item_t const * p_list,
+                               size_t                             count);
+
+/**
+ * @brief Function for registering a device connected to a shared SPIM bus.
+ *
+ * The device configuration is cached in @p p_device, and its Slave Select pin, if used,
+ * is configured as an inactive output.
+ *
+ * @param[out] p_device Pointer to the device structure to be initialized.
+ * @param[in]  p_config Pointer to the structure with the device configuration.
+ */
+void nrfx_spim_device_init(nrfx_spim_device_t *              p_device,
+                           nrfx_spim_device_config_t const * p_config);
+
+/**
+ * @brief Function for queuing a transfer to a device on a shared SPIM bus.
+ *
+ * Requests from all contexts are executed in the order of submission. Before a transfer starts,
+ * the driver writes the FREQUENCY, CONFIG, and ORC registers only if the transfer is addressed
+ * to a different device than the previous one and only with the values that differ.
+ * The handler of the request is called from the SPIM interrupt context when the transfer is done.
+ * Transfers started with @ref nrfx_spim_xfer use the configuration of the instance and are
+ * arbitrated with the queued requests.
+ *
+ * @note Peripherals using EasyDMA (including SPIM) require the transfer buffers
+ *       to be placed in the Data RAM region. If this condition is not met,
+ *       this function will fail with the error code NRFX_ERROR_INVALID_ADDR.
+ *
+ * @param p_instance Pointer to the driver instance structure.
+ * @param p_request  Pointer to the request. The request must remain valid until its handler
+ *                   is called.
+ *
+ * @retval NRFX_SUCCESS             The request is queued.
+ * @retval NRFX_ERROR_INVALID_STATE The driver works in the blocking mode.
+ * @retval NRFX_ERROR_INVALID_ADDR  The provided buffers are not placed in the Data
+ *                                  RAM region.
+ */
+nrfx_err_t nrfx_spim_bus_submit(nrfx_spim_t const *       p_instance,
+                                nrfx_spim_bus_request_t * p_request);
+
+/**
+ * @brief Function for starting the circular acquisition.
+ *
+ * The transfers are started in hardware, typically by a TIMER compare event connected through
+ * (D)PPI with the task returned by @ref nrfx_spim_start_task_get. The received samples are
+ * written one after another into the acquisition buffer, and the transfers are counted in
+ * hardware by @p p_config->p_counter. Every time half of the buffer is filled, the counter stops
+ * the SPIM between two transfers and the driver reports the filled half with
+ * @ref NRFX_SPIM_EVENT_HALF_DONE or @ref NRFX_SPIM_EVENT_FULL_DONE. After the second half,
+ * the receive pointer is moved back to the beginning of the buffer. No CPU involvement is needed
+ * for any single sample.
+ *
+ * Data reported with an event remains valid until the acquisition reaches the same half again.
+ *
+ * @note This function is available only in the non-blocking mode.
+ * @note Slave Select must be either controlled by hardware or not used.
+ *
+ * @warning The receive pointer is moved back in the SPIM interrupt. The interrupt that reports
+ *          the second half must be processed before the next transfer is started,
+ *          otherwise the sample is written past the end of the buffer.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ * @param[in] p_config   Pointer to the structure with the acquisition configuration.
+ *
+ * @retval NRFX_SUCCESS             The acquisition is started.
+ * @retval NRFX_ERROR_INVALID_STATE The driver works in the blocking mode.
+ * @retval NRFX_ERROR_BUSY          The driver is not ready for a new transfer.
+ * @retval NRFX_ERROR_INVALID_ADDR  The provided buffers are not placed in the Data
+ *                                  RAM region.
+ */
+nrfx_err_t nrfx_spim_circular_start(nrfx_spim_t const *                 p_instance,
+                                    nrfx_spim_circular_config_t const * p_config);
+
+/**
+ * @brief Function for stopping the circular acquisition.
+ *
+ * Samples received after the last reported half of the buffer are not reported.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ */
+void nrfx_spim_circular_stop(nrfx_spim_t const * p_instance);
+
 /**
  * @brief Function for returning the address of a SPIM start task.
  *
@@ -413,6 +679,9 @@ uint32_t nrfx_spim_end_event_get(nrfx_spim_t const * p_instance);
 /**
  * @brief Function for aborting ongoing transfer.
  *
+ * @note Requests queued with @ref nrfx_spim_bus_submit are discarded without calling
+ *       their handlers.
+ *
  * @param[in] p_instance Pointer to the driver instance structure.
  */
 void nrfx_spim_abort(nrfx_spim_t const * p_instance);
@@ -256,6 +256,85 @@ nrfx_err_t nrfx_spis_buffers_set(nrfx_spis_t const * p_instance,
                                  uint8_t *           p_rx_buffer,
                                  size_t              rx_buffer_length);
 
+/** @brief Structure describing the buffers of a single SPI transaction. */
+typedef struct
+{
+    uint8_t const * p_tx_buffer; //!< Pointer to the TX buffer. Can be NULL when the buffer length is zero.
+    size_t          tx_length;   //!< Length of the TX buffer in bytes.
+    uint8_t *       p_rx_buffer; //!< Pointer to the RX buffer. Can be NULL when the buffer length is zero.
+    size_t          rx_length;   //!< Length of the RX buffer in bytes.
+} nrfx_spis_buffers_t;
+
+/**
+ * @brief Structure of the transaction queue.
+ *
+ * The structure and the array of buffer pairs are provided by the user and must remain
+ * valid as long as the queue is used by the driver.
+ */
+typedef struct
+{
+    nrfx_spis_buffers_t * p_buffers; //!< Array of buffer pairs.
+    uint32_t              count;     //!< Number of elements in the @p p_buffers array.
+    volatile uint32_t     queued;    //!< Number of buffer pairs queued. For internal use only.
+    volatile uint32_t     armed;     //!< Number of buffer pairs given to the peripheral. For internal use only.
+    volatile uint32_t     completed; //!< Number of completed transactions. For internal use only.
+    volatile bool         starved;   //!< True if the CPU holds the semaphore waiting for buffers. For internal use only.
+} nrfx_spis_queue_t;
+
+/**
+ * @brief Function for starting the transaction queue mode.
+ *
+ * In this mode, the driver keeps a queue of buffer pairs registered in advance with
+ * @ref nrfx_spis_queue_push(). As soon as a transaction ends, the driver gives the next
+ * queued pair to the peripheral from the interrupt handler, without waiting for
+ * the application, so an SPI master can perform back-to-back transactions.
+ * Transactions are completed in the order in which the buffer pairs were queued,
+ * and each is reported with the @ref NRFX_SPIS_XFER_DONE event. After that event,
+ * the buffers of the oldest queued pair can be reused.
+ * The @ref NRFX_SPIS_BUFFERS_SET_DONE event is not generated in this mode.
+ *
+ * If the queue runs empty, the driver holds the semaphore, so the master gets
+ * the DEF and ORC characters until the next buffer pair is queued.
+ *
+ * @note @ref nrfx_spis_buffers_set() cannot be used while the queue mode is active.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ * @param[in] p_queue    Pointer to the queue structure with the array of buffer pairs set.
+ *
+ * @retval NRFX_SUCCESS             The queue mode was started.
+ * @retval NRFX_ERROR_INVALID_STATE A single transaction is being prepared or the queue mode
+ *                                  is already active.
+ */
+nrfx_err_t nrfx_spis_queue_start(nrfx_spis_t const * p_instance, nrfx_spis_queue_t * p_queue);
+
+/**
+ * @brief Function for adding a buffer pair to the transaction queue.
+ *
+ * @note This function can be called from the callback function context.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ * @param[in] p_buffers  Pointer to the buffer pair. The structure is copied into the queue.
+ *
+ * @retval NRFX_SUCCESS              The buffer pair was queued.
+ * @retval NRFX_ERROR_INVALID_STATE  The queue mode is not active.
+ * @retval NRFX_ERROR_NO_MEM         The queue is full.
+ * @retval NRFX_ERROR_INVALID_ADDR   The provided buffers are not placed in the Data
+ *                                   RAM region.
+ * @retval NRFX_ERROR_INVALID_LENGTH Provided lengths exceed the EasyDMA limits for the peripheral.
+ */
+nrfx_err_t nrfx_spis_queue_push(nrfx_spis_t const *         p_instance,
+                                nrfx_spis_buffers_t const * p_buffers);
+
+/**
+ * @brief Function for stopping the transaction queue mode.
+ *
+ * The buffer pairs that have not been completed are discarded. A transaction that
+ * is in progress is not reported, but it may still access its buffers until it ends.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ */
+void nrfx_spis_queue_stop(nrfx_spis_t const * p_instance);
+
 /**
  * @brief Macro returning SPIS interrupt handler.
  *
@@ -135,6 +135,40 @@ int32_t nrfx_temp_calculate(int32_t raw_measurement);
  */
 nrfx_err_t nrfx_temp_measure(void);
 
+#if defined(PPI_PRESENT) || defined(DPPI_PRESENT) || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Function for starting periodic temperature measurements triggered by hardware.
+ *
+ * The specified event, for example a TIMER or RTC compare event configured by the user
+ * to occur periodically, is connected to the TEMP START task through a (D)PPI channel
+ * allocated by the driver. The measurements are then started without CPU involvement.
+ * The data handler is called for the first measurement and afterwards only
+ * when the result differs from the last reported one by more than @p threshold.
+ *
+ * @note The driver must be initialized in non-blocking mode.
+ * @note The TEMP peripheral does not compare the results by itself, so the TEMP interrupt
+ *       still occurs for every measurement. The data handler and the consumers
+ *       of the temperature values are not invoked for insignificant changes.
+ *
+ * @param[in] event_addr Address of the event that triggers the measurements.
+ *                       On devices with DPPI, the event must not be published yet.
+ * @param[in] threshold  Change threshold, in raw units of 0.25[C].
+ *
+ * @retval NRFX_SUCCESS             Periodic measurements were started.
+ * @retval NRFX_ERROR_INVALID_STATE The driver is in blocking mode or periodic measurements
+ *                                  are already started.
+ * @retval NRFX_ERROR_NO_MEM        No (D)PPI channel available.
+ */
+nrfx_err_t nrfx_temp_periodic_start(uint32_t event_addr, uint32_t threshold);
+
+/**
+ * @brief Function for stopping periodic temperature measurements.
+ *
+ * The (D)PPI channel allocated by @ref nrfx_temp_periodic_start is released.
+ */
+void nrfx_temp_periodic_stop(void);
+#endif
+
 #ifndef NRFX_DECLARE_ONLY
 NRFX_STATIC_INLINE int32_t nrfx_temp_result_get(void)
 {
@@ -275,6 +275,10 @@ void nrfx_twi_disable(nrfx_twi_t const * p_instance);
  * Some flag combinations are invalid:
  * - @ref NRFX_TWI_FLAG_TX_NO_STOP with @ref nrfx_twi_xfer_desc_t.type different than @ref NRFX_TWI_XFER_TX
  *
+ * @note If @ref NRFX_TWI_EASYDMA_BRIDGE_ENABLED is set, TX, RX, and TX-RX transfers with buffers
+ *       in RAM and without the @ref NRFX_TWI_FLAG_TX_NO_STOP and @ref NRFX_TWI_FLAG_SUSPEND flags
+ *       are executed by the TWIM peripheral with EasyDMA, at the cost of a single interrupt.
+ *
  * @param[in] p_instance  Pointer to the driver instance structure.
  * @param[in] p_xfer_desc Pointer to the transfer descriptor.
  * @param[in] flags       Transfer options (0 for default settings).
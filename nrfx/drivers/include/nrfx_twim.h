@@ -37,6 +37,7 @@
 #include <nrfx.h>
 #include <nrfx_twi_twim.h>
 #include <hal/nrf_twim.h>
+#include <hal/nrf_timer.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -146,7 +147,8 @@ typedef enum
     NRFX_TWIM_EVT_ADDRESS_NACK, ///< Error event: NACK received after sending the address.
     NRFX_TWIM_EVT_DATA_NACK,    ///< Error event: NACK received after sending a data byte.
     NRFX_TWIM_EVT_OVERRUN,      ///< Error event: The unread data is replaced by new data.
-    NRFX_TWIM_EVT_BUS_ERROR     ///< Error event: An unexpected transition occurred on the bus.
+    NRFX_TWIM_EVT_BUS_ERROR,    ///< Error event: An unexpected transition occurred on the bus.
+    NRFX_TWIM_EVT_SEQUENCE_DONE ///< All transfers of the sequence completed event.
 } nrfx_twim_evt_type_t;
 
 /** @brief TWI master driver transfer types. */
@@ -221,6 +223,28 @@ typedef struct
     nrfx_twim_xfer_desc_t xfer_desc; ///< Transfer details.
 } nrfx_twim_evt_t;
 
+/** @brief Structure for a sequence of TWI transfers. */
+typedef struct
+{
+    nrfx_twim_xfer_desc_t const * p_xfers;     ///< Array of transfers to be executed in order.
+                                               /**< Only @ref NRFX_TWIM_XFER_TX,
+                                                *   @ref NRFX_TWIM_XFER_RX, and
+                                                *   @ref NRFX_TWIM_XFER_TXRX types are supported.
+                                                *   Receive buffer pointers are ignored. */
+    size_t                        count;       ///< Number of transfers in @p p_xfers.
+    uint8_t *                     p_rx_buffer; ///< Buffer for data received in the sequence.
+                                               /**< Data received by consecutive transfers is
+                                                *   placed one after another. The buffer must be
+                                                *   large enough to hold the data of all transfers. */
+    NRF_TIMER_Type *              p_timer;     ///< TIMER instance re-triggering the sequence (optional).
+                                               /**< Set to NULL to execute the sequence once.
+                                                *   The TIMER must be configured and started by
+                                                *   the user, with the period longer than
+                                                *   the duration of the whole sequence. */
+    nrf_timer_cc_channel_t        cc_channel;  ///< Compare channel of @p p_timer that triggers the sequence.
+    uint8_t                       ppi_channel; ///< (D)PPI channel connecting @p p_timer with the TWIM start task.
+} nrfx_twim_sequence_t;
+
 /** @brief TWI event handler prototype. */
 typedef void (* nrfx_twim_evt_handler_t)(nrfx_twim_evt_t const * p_event,
                                          void *                  p_context);
@@ -270,6 +294,30 @@ void nrfx_twim_enable(nrfx_twim_t const * p_instance);
  */
 void nrfx_twim_disable(nrfx_twim_t const * p_instance);
 
+/**
+ * @brief Function for suspending the TWIM driver instance.
+ *
+ * The peripheral is disabled, which releases its clock and EasyDMA requests. The driver
+ * configuration and the pin setup are preserved, so that @ref nrfx_twim_resume restores
+ * the instance without a full reinitialization. No transfer can be started while the instance
+ * is suspended.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ *
+ * @retval NRFX_SUCCESS    The instance was suspended or it was already suspended.
+ * @retval NRFX_ERROR_BUSY A transfer is in progress. The instance was not suspended.
+ */
+nrfx_err_t nrfx_twim_suspend(nrfx_twim_t const * p_instance);
+
+/**
+ * @brief Function for resuming the TWIM driver instance suspended with @ref nrfx_twim_suspend.
+ *
+ * If the instance is not suspended, the function has no effect.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ */
+void nrfx_twim_resume(nrfx_twim_t const * p_instance);
+
 /**
  * @brief Function for performing a TWI transfer.
  *
@@ -329,6 +377,47 @@ nrfx_err_t nrfx_twim_xfer(nrfx_twim_t           const * p_instance,
                           nrfx_twim_xfer_desc_t const * p_xfer_desc,
                           uint32_t                      flags);
 
+/**
+ * @brief Function for starting a sequence of transfers.
+ *
+ * The transfers are executed one after another, each with its own slave address. The next
+ * transfer is set up directly from the interrupt that ends the previous one, without calling
+ * the event handler. The handler is called with an error event for each failed transfer, and
+ * with @ref NRFX_TWIM_EVT_SEQUENCE_DONE event when all transfers of the sequence are done.
+ *
+ * If @ref nrfx_twim_sequence_t.p_timer is set, the sequence is executed periodically. The first
+ * transfer is prepared in advance and started by the COMPARE event of the TIMER through (D)PPI,
+ * so the sweeps are timed by hardware. The received data is overwritten in every sweep.
+ *
+ * @note This function is available only in the non-blocking mode.
+ *
+ * @note Peripherals using EasyDMA (including TWIM) require the transfer buffers
+ *       to be placed in the Data RAM region. If this condition is not met for any
+ *       of the transfers, this function will fail with the error code
+ *       NRFX_ERROR_INVALID_ADDR and no transfer is started.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ * @param[in] p_sequence Pointer to the sequence description. The structure and the array
+ *                       of transfers must remain valid until the sequence is done.
+ *
+ * @retval NRFX_SUCCESS             The sequence is started.
+ * @retval NRFX_ERROR_BUSY          The driver is not ready for a new transfer.
+ * @retval NRFX_ERROR_INVALID_STATE The driver works in the blocking mode.
+ * @retval NRFX_ERROR_INVALID_ADDR  The provided buffers are not placed in the Data RAM region.
+ */
+nrfx_err_t nrfx_twim_sequence_start(nrfx_twim_t const *          p_instance,
+                                    nrfx_twim_sequence_t const * p_sequence);
+
+/**
+ * @brief Function for stopping a periodic sequence.
+ *
+ * If the sequence is waiting for the trigger, it is stopped immediately. Otherwise,
+ * the ongoing sweep is finished and @ref NRFX_TWIM_EVT_SEQUENCE_DONE event is generated.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ */
+void nrfx_twim_sequence_stop(nrfx_twim_t const * p_instance);
+
 /**
  * @brief Function for checking the TWI driver state.
  *
@@ -96,7 +96,9 @@ typedef enum
                                      */
     NRFX_TWIS_EVT_WRITE_DONE,   ///< Write request finished - process data.
     NRFX_TWIS_EVT_WRITE_ERROR,  ///< Write request finished with error.
-    NRFX_TWIS_EVT_GENERAL_ERROR ///< Error that happens not inside WRITE or READ transaction.
+    NRFX_TWIS_EVT_GENERAL_ERROR, ///< Error that happens not inside WRITE or READ transaction.
+    NRFX_TWIS_EVT_REGMAP_WRITE,  ///< Registers were written in the register map mode.
+    NRFX_TWIS_EVT_REGMAP_READ,   ///< Registers were read in the register map mode.
 } nrfx_twis_evt_type_t;
 
 /**
@@ -115,6 +117,14 @@ typedef enum
     NRFX_TWIS_ERROR_UNEXPECTED_EVENT = 1 << 8                    /**< Unexpected event detected by state machine. */
 } nrfx_twis_error_t;
 
+/** @brief Data of the register map events. */
+typedef struct
+{
+    uint8_t  match;  ///< Index of the slave address used in the transaction.
+    uint8_t  offset; ///< Sub-address of the first register accessed.
+    uint16_t length; ///< Number of registers accessed.
+} nrfx_twis_regmap_evt_t;
+
 /** @brief TWIS driver event structure. */
 typedef struct
 {
@@ -126,6 +136,8 @@ typedef struct
         uint32_t tx_amount; ///< Data for @ref NRFX_TWIS_EVT_READ_DONE.
         uint32_t rx_amount; ///< Data for @ref NRFX_TWIS_EVT_WRITE_DONE.
         uint32_t error;     ///< Data for @ref NRFX_TWIS_EVT_GENERAL_ERROR.
+        nrfx_twis_regmap_evt_t regmap; ///< Data for @ref NRFX_TWIS_EVT_REGMAP_WRITE and
+                                       ///< @ref NRFX_TWIS_EVT_REGMAP_READ.
     } data;                 ///< Union to store event data.
 } nrfx_twis_evt_t;
 
@@ -246,6 +258,61 @@ void nrfx_twis_enable(nrfx_twis_t const * p_instance);
  */
 void nrfx_twis_disable(nrfx_twis_t const * p_instance);
 
+/** @brief Register file served in the register map mode. */
+typedef struct
+{
+    uint8_t *        p_regs;  ///< Registers. Must be placed in the Data RAM region.
+    size_t           size;    ///< Number of registers, up to 256.
+    volatile uint8_t pointer; ///< Sub-address of the next register to be accessed. For internal use only.
+} nrfx_twis_regmap_t;
+
+/** @brief Structure for the register map mode configuration. */
+typedef struct
+{
+    nrfx_twis_regmap_t * p_regmap[2];  ///< Register files for the slave addresses set in the configuration.
+                                       /**< Set to NULL for an unused address. */
+    uint8_t *            p_scratch;    ///< Buffer for the incoming writes. Must be placed in the Data RAM region.
+    size_t               scratch_size; ///< Size of the scratch buffer. It limits the length of a write,
+                                       ///< including the sub-address byte.
+} nrfx_twis_regmap_config_t;
+
+/**
+ * @brief Function for starting the register map mode.
+ *
+ * In this mode, the driver serves the bus transactions from the register files itself,
+ * without requesting buffers from the application. The first byte of a write sets the
+ * sub-address pointer of the register file of the addressed slave, and the following
+ * bytes are stored in consecutive registers. A read returns the registers starting at
+ * the current pointer. The pointer is incremented with each register accessed.
+ * The application is notified with @ref NRFX_TWIS_EVT_REGMAP_WRITE or
+ * @ref NRFX_TWIS_EVT_REGMAP_READ only after the transaction.
+ *
+ * The receive buffer is armed in advance, so writes are never clock-stretched.
+ * Reads are stretched only until the driver interrupt handler points the transmission
+ * at the current register, as the pointer may have been written just before
+ * in the same transaction. The application event handler is not involved in that.
+ *
+ * @note The driver must be enabled and initialized with an event handler.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ * @param[in] p_config   Pointer to the register map configuration.
+ *
+ * @retval NRFX_SUCCESS             The register map mode was started.
+ * @retval NRFX_ERROR_INVALID_STATE The driver is not enabled, is in blocking mode,
+ *                                  or a transaction is in progress.
+ * @retval NRFX_ERROR_INVALID_ADDR  The register files or the scratch buffer are not placed
+ *                                  in the Data RAM region.
+ */
+nrfx_err_t nrfx_twis_regmap_start(nrfx_twis_t const *               p_instance,
+                                  nrfx_twis_regmap_config_t const * p_config);
+
+/**
+ * @brief Function for stopping the register map mode.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ */
+void nrfx_twis_regmap_stop(nrfx_twis_t const * p_instance);
+
 /**
  * @brief Function for getting and clearing the last error flags.
  *
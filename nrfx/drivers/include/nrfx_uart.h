@@ -245,6 +245,10 @@ NRFX_STATIC_INLINE uint32_t nrfx_uart_event_address_get(nrfx_uart_t const * p_in
  * returns when the transfer is finished. Blocking mode is not using interrupt
  * so there is no context switching inside the function.
  *
+ * @note If @ref NRFX_UART_EASYDMA_BRIDGE_ENABLED is set and the receiver is not in use,
+ *       data in RAM is sent by the UARTE peripheral with EasyDMA, at the cost of two interrupts.
+ *       A reception started during such transmission switches it back to one interrupt per byte.
+ *
  * @param[in] p_instance Pointer to the driver instance structure.
  * @param[in] p_data     Pointer to data.
  * @param[in] length     Number of bytes to send.
@@ -36,6 +36,8 @@
 
 #include <nrfx.h>
 #include <hal/nrf_uarte.h>
+#include <hal/nrf_timer.h>
+#include <helpers/nrfx_gppi.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -73,6 +75,23 @@ enum {
 };
 #endif
 
+#ifndef NRFX_UARTE_TX_QUEUE_SIZE
+/** @brief Maximum number of buffers waiting in the transmission queue of each instance. */
+#define NRFX_UARTE_TX_QUEUE_SIZE 4
+#endif
+
+#ifndef NRFX_UARTE_TX_BOUNCE_SIZE
+/**
+ * @brief Size of each of the two RAM bounce buffers of every instance, in bytes.
+ *
+ * When not zero, @ref nrfx_uarte_tx accepts data placed outside the Data RAM region,
+ * for example constant tables in flash. Such data is copied chunk by chunk into
+ * the bounce buffers and the chunks are sent back to back. The size must not exceed
+ * the MAXCNT limit of the UARTE instances. Set to 0 to disable.
+ */
+#define NRFX_UARTE_TX_BOUNCE_SIZE 0
+#endif
+
 /** @brief Macro for creating a UARTE driver instance. */
 #define NRFX_UARTE_INSTANCE(id)                               \
 {                                                             \
@@ -86,6 +105,7 @@ typedef enum
     NRFX_UARTE_EVT_TX_DONE, ///< Requested TX transfer completed.
     NRFX_UARTE_EVT_RX_DONE, ///< Requested RX transfer completed.
     NRFX_UARTE_EVT_ERROR,   ///< Error reported by UART peripheral.
+    NRFX_UARTE_EVT_RX_DATA, ///< Data received in the streaming reception mode is available.
 } nrfx_uarte_evt_type_t;
 
 /** @brief Structure for the UARTE configuration. */
@@ -160,6 +180,35 @@ typedef struct
     }                                                                               \
 }
 
+/**
+ * @brief Structure for the UARTE streaming reception configuration.
+ *
+ * The reception buffer is treated as a ring of @p chunk_count chunks of @p chunk_size bytes each.
+ * The chunks are filled by EasyDMA one after another without any software intervention other than
+ * setting up the next chunk pointer.
+ */
+typedef struct
+{
+    uint8_t *                 p_buffer;         ///< Pointer to the ring buffer of at least @p chunk_size * @p chunk_count bytes.
+    size_t                    chunk_size;       ///< Size of a single chunk, in bytes.
+    uint8_t                   chunk_count;      ///< Number of chunks in the ring. Must be at least 3.
+    NRF_TIMER_Type *          p_counter;        ///< TIMER instance used to count received bytes.
+                                                /**< The TIMER is switched to the counter mode and must not be
+                                                 *   used for any other purpose while the stream is active. */
+    uint8_t                   ppi_channel;      ///< (D)PPI channel connecting the RXDRDY event with the COUNT task of @p p_counter.
+    uint8_t                   idle_polls;       ///< Number of consecutive idle polls after which the receiver is powered down.
+                                                /**< Set to 0 to keep the receiver running while the stream is active.
+                                                 *   See @ref nrfx_uarte_rx_stream_poll for details. */
+    uint32_t                  wake_event;       ///< Address of the event that restarts the powered down receiver.
+                                                /**< The event must be generated on the falling edge of the RX line,
+                                                 *   for example the GPIOTE PORT event with the sensing for low level
+                                                 *   enabled on the RX pin. Ignored if @p idle_polls is 0. */
+    uint8_t                   wake_ppi_channel; ///< (D)PPI channel connecting @p wake_event with the STARTRX task.
+                                                /**< Ignored if @p idle_polls is 0. */
+    nrfx_gppi_channel_group_t wake_ppi_group;   ///< (D)PPI channel group that disables @p wake_ppi_channel once the receiver is restarted.
+                                                /**< Ignored if @p idle_polls is 0. */
+} nrfx_uarte_rx_stream_config_t;
+
 /** @brief Structure for the UARTE transfer completion event. */
 typedef struct
 {
@@ -223,6 +272,30 @@ nrfx_err_t nrfx_uarte_init(nrfx_uarte_t const *        p_instance,
  */
 void nrfx_uarte_uninit(nrfx_uarte_t const * p_instance);
 
+/**
+ * @brief Function for suspending the UARTE driver instance.
+ *
+ * The peripheral is disabled, which releases its clock and EasyDMA requests. The driver
+ * configuration and the pin setup are preserved, so that @ref nrfx_uarte_resume restores
+ * the instance without a full reinitialization. No transmission or reception can be started while the instance
+ * is suspended.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ *
+ * @retval NRFX_SUCCESS    The instance was suspended or it was already suspended.
+ * @retval NRFX_ERROR_BUSY A transmission or reception is in progress. The instance was not suspended.
+ */
+nrfx_err_t nrfx_uarte_suspend(nrfx_uarte_t const * p_instance);
+
+/**
+ * @brief Function for resuming the UARTE driver instance suspended with @ref nrfx_uarte_suspend.
+ *
+ * If the instance is not suspended, the function has no effect.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ */
+void nrfx_uarte_resume(nrfx_uarte_t const * p_instance);
+
 /**
  * @brief Function for getting the address of the specified UARTE task.
  *
@@ -256,7 +329,10 @@ NRFX_STATIC_INLINE uint32_t nrfx_uarte_event_address_get(nrfx_uarte_t const * p_
  *
  * @note Peripherals using EasyDMA (including UARTE) require the transfer buffers
  *       to be placed in the Data RAM region. If this condition is not met,
- *       this function will fail with the error code NRFX_ERROR_INVALID_ADDR.
+ *       this function will fail with the error code NRFX_ERROR_INVALID_ADDR,
+ *       unless @ref NRFX_UARTE_TX_BOUNCE_SIZE is not zero. In that case, the data
+ *       is sent through the bounce buffers of the instance and its length is not
+ *       limited by the MAXCNT register.
  *
  * @param[in] p_instance Pointer to the driver instance structure.
  * @param[in] p_data     Pointer to data.
@@ -275,6 +351,52 @@ nrfx_err_t nrfx_uarte_tx(nrfx_uarte_t const * p_instance,
                          uint8_t const *      p_data,
                          size_t               length);
 
+/**
+ * @brief Function for queuing data for transmission over UARTE.
+ *
+ * If no transfer is in progress, the transmission starts immediately. Otherwise the buffer is
+ * added to the transmission queue and is sent right after the previous one. The pointer to
+ * the next buffer is set up as soon as the current transfer is started and the transfer is
+ * restarted directly from the ENDTX interrupt, so there is no gap on the line as long as
+ * the interrupt latency is lower than the time of sending a single byte.
+ * @ref NRFX_UARTE_EVT_TX_DONE event is generated for each of the queued buffers, in order.
+ *
+ * @note This function is available only in the non-blocking mode.
+ *
+ * @note Peripherals using EasyDMA (including UARTE) require the transfer buffers
+ *       to be placed in the Data RAM region. If this condition is not met,
+ *       this function will fail with the error code NRFX_ERROR_INVALID_ADDR.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ * @param[in] p_data     Pointer to data. The buffer must remain valid until
+ *                       @ref NRFX_UARTE_EVT_TX_DONE event for it is generated.
+ * @param[in] length     Number of bytes to send. Maximum possible length is
+ *                       dependent on the used SoC (see the MAXCNT register
+ *                       description in the Product Specification). The driver
+ *                       checks it with assertion.
+ *
+ * @retval NRFX_SUCCESS             The buffer is being transmitted or is queued.
+ * @retval NRFX_ERROR_INVALID_STATE The driver works in the blocking mode.
+ * @retval NRFX_ERROR_NO_MEM        The transmission queue is full.
+ * @retval NRFX_ERROR_INVALID_ADDR  p_data does not point to RAM buffer.
+ */
+nrfx_err_t nrfx_uarte_tx_queue(nrfx_uarte_t const * p_instance,
+                               uint8_t const *      p_data,
+                               size_t               length);
+
+/**
+ * @brief Function for discarding the transmission queue and aborting the ongoing transmission.
+ *
+ * @note @ref NRFX_UARTE_EVT_TX_DONE event will be generated only for the ongoing transfer.
+ *       It will contain number of bytes sent until the flush was called.
+ *       No events are generated for the discarded buffers.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ *
+ * @return Number of bytes of the discarded buffers that were not sent at all.
+ */
+size_t nrfx_uarte_tx_queue_flush(nrfx_uarte_t const * p_instance);
+
 /**
  * @brief Function for checking if UARTE is currently transmitting.
  *
@@ -287,6 +409,7 @@ bool nrfx_uarte_tx_in_progress(nrfx_uarte_t const * p_instance);
 
 /**
  * @brief Function for aborting any ongoing transmission.
+ * @note Buffers waiting in the transmission queue are discarded.
  * @note @ref NRFX_UARTE_EVT_TX_DONE event will be generated in non-blocking mode.
  *       It will contain number of bytes sent until the abort was called. The event
  *       handler will be called from the UARTE interrupt context.
@@ -373,6 +496,78 @@ bool nrfx_uarte_rx_ready(nrfx_uarte_t const * p_instance);
  */
 void nrfx_uarte_rx_abort(nrfx_uarte_t const * p_instance);
 
+/**
+ * @brief Function for starting the streaming reception.
+ *
+ * In the streaming mode the receiver runs continuously, with EasyDMA chaining the chunks of
+ * the ring buffer specified in @p p_config. Received bytes are counted in hardware by a TIMER
+ * working in the counter mode, so no per-byte interrupts are needed. Received data is reported
+ * with @ref NRFX_UARTE_EVT_RX_DATA events, which point directly into the ring buffer:
+ * - when a chunk is filled completely,
+ * - from @ref nrfx_uarte_rx_stream_poll, when no new byte was received since its previous call,
+ *   that is, when the line has been idle for at least the polling period.
+ *
+ * Data reported with an event remains valid until EasyDMA wraps around the ring and reaches
+ * the chunk again. If data is overwritten before it is reported, the overwritten bytes are skipped
+ * and @ref NRFX_UARTE_EVT_ERROR event with @ref NRF_UARTE_ERROR_OVERRUN_MASK is generated,
+ * with the number of lost bytes provided in the event data.
+ *
+ * @note This function is available only in the non-blocking mode.
+ *
+ * @warning The pointer to the next chunk is set up in the RXSTARTED interrupt. If the UARTE
+ *          interrupt is processed with a delay long enough for a whole chunk to be filled,
+ *          the reception continues into the previously used chunk. To prevent this from happening,
+ *          keep the UARTE interrupt latency low or use large enough chunks.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ * @param[in] p_config   Pointer to the structure with the streaming reception configuration.
+ *
+ * @retval NRFX_SUCCESS             The streaming reception is started.
+ * @retval NRFX_ERROR_INVALID_STATE The driver works in the blocking mode.
+ * @retval NRFX_ERROR_BUSY          The driver is already receiving.
+ * @retval NRFX_ERROR_INVALID_ADDR  The ring buffer is not placed in RAM.
+ */
+nrfx_err_t nrfx_uarte_rx_stream_start(nrfx_uarte_t const *                  p_instance,
+                                      nrfx_uarte_rx_stream_config_t const * p_config);
+
+/**
+ * @brief Function for checking the streaming reception for idle line.
+ *
+ * This function must be called periodically while the streaming reception is active.
+ * If no byte was received since the previous call, all data received but not reported yet is
+ * reported with @ref NRFX_UARTE_EVT_RX_DATA events. The polling period thus defines the idle
+ * timeout of the stream. The event handler is called from the context of this function.
+ *
+ * If @ref nrfx_uarte_rx_stream_config_t::idle_polls is not 0 and the line stays idle for that
+ * many consecutive calls, the receiver is powered down, so that it no longer keeps the high
+ * frequency clock running. The receiver is restarted in hardware, without any CPU involvement,
+ * by the wake event on the first falling edge of the RX line. The stream then continues from
+ * the beginning of the ring buffer, so data reported before the receiver was powered down remains
+ * valid only until it is restarted.
+ *
+ * @note The receiver needs some time to start after the wake event, so the byte that wakes it up
+ *       may be lost or received incorrectly. To keep the link lossless, the peer is expected to
+ *       precede data sent after an idle period with a single wake byte of value 0xFF and to
+ *       discard it on the receiving side. With hardware flow control the wake byte is not needed,
+ *       provided that the peer does not transmit while the RTS line is inactive.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ */
+void nrfx_uarte_rx_stream_poll(nrfx_uarte_t const * p_instance);
+
+/**
+ * @brief Function for stopping the streaming reception.
+ *
+ * @note All data received until the receiver is stopped is reported with
+ *       @ref NRFX_UARTE_EVT_RX_DATA events, followed by @ref NRFX_UARTE_EVT_RX_DONE event
+ *       with no data, which marks the end of the stream. The event handler will be called
+ *       from the UARTE interrupt context, or from the context of this function if the receiver
+ *       is powered down after an idle period.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ */
+void nrfx_uarte_rx_stream_stop(nrfx_uarte_t const * p_instance);
+
 /**
  * @brief Function for reading error source mask. Mask contains values from @ref nrf_uarte_error_mask_t.
  * @note Function must be used in the blocking mode only. In case of non-blocking mode, an error event is
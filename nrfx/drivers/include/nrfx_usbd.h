@@ -71,6 +71,26 @@ extern "C" {
  */
 #define NRFX_USBD_FEEDER_BUFFER_SIZE NRFX_USBD_EPSIZE
 
+#ifndef NRFX_USBD_DMA_PRIORITY_LEVELS
+/**
+ * @brief Number of EasyDMA scheduling priority levels.
+ *
+ * @sa nrfx_usbd_ep_dma_priority_set
+ */
+#define NRFX_USBD_DMA_PRIORITY_LEVELS 3
+#endif
+
+#ifndef NRFX_USBD_DMA_SCHEDULER_QUOTA
+/**
+ * @brief Maximum number of consecutive EasyDMA transfers granted to higher priority endpoints
+ *        while endpoints with lower priority are waiting.
+ *
+ * When the quota is used up, a single transfer of the highest priority waiting endpoint
+ * of a lower level is started. Set to 0 for strict priority scheduling.
+ */
+#define NRFX_USBD_DMA_SCHEDULER_QUOTA 8
+#endif
+
 /**
  * @name Macros for creating endpoint identifiers.
  *
@@ -150,6 +170,9 @@ typedef enum
                                *   For Tx (IN: Device->Host):
                                *   The last packet from requested transfer has been transfered over USB bus and acknowledged.
                                */
+    NRFX_USBD_EVT_ISO_STREAM, /**< Isochronous stream buffer handled or stream error detected.
+                               *   See @ref nrfx_usbd_iso_stream_start.
+                               */
     NRFX_USBD_EVT_CNT         /**< Number of defined events. */
 } nrfx_usbd_event_type_t;
 
@@ -177,6 +200,24 @@ typedef enum
     NRFX_USBD_EP_BUSY,     /**< Transfer is in progress. */
 } nrfx_usbd_ep_status_t;
 
+/**
+ * @brief Isochronous stream status codes.
+ *
+ * Status codes reported together with @ref NRFX_USBD_EVT_ISO_STREAM.
+ */
+typedef enum
+{
+    NRFX_USBD_ISO_STREAM_DONE,     /**< For IN stream: the buffer was copied to the endpoint and can be refilled.
+                                    *   For OUT stream: the buffer contains data received in the previous frame.
+                                    */
+    NRFX_USBD_ISO_STREAM_UNDERRUN, /**< IN stream: no buffer was submitted before the frame start.
+                                    *   No data is sent in the frame.
+                                    */
+    NRFX_USBD_ISO_STREAM_OVERRUN,  /**< OUT stream: no free buffer at the frame start.
+                                    *   Data received in the previous frame is dropped.
+                                    */
+} nrfx_usbd_iso_stream_status_t;
+
 /**
  * @brief Event structure.
  *
@@ -197,6 +238,12 @@ typedef struct
             nrfx_usbd_ep_t        ep;     /**< Endpoint number. */
             nrfx_usbd_ep_status_t status; /**< Status for the endpoint. */
         } eptransfer;                     /**< Endpoint transfer status. */
+        struct {
+            nrfx_usbd_ep_t                ep;       /**< Endpoint number. */
+            nrfx_usbd_iso_stream_status_t status;   /**< Stream status. */
+            void *                        p_buffer; /**< Handled buffer. NULL for errors. */
+            size_t                        size;     /**< Number of bytes in the handled buffer. */
+        } isostream;                      /**< Data available for @ref NRFX_USBD_EVT_ISO_STREAM. */
     } data;                               /**< Union to store event data. */
 } nrfx_usbd_evt_t;
 
@@ -232,6 +279,23 @@ typedef struct
     size_t size;                 //!< Size of the requested transfer.
 } nrfx_usbd_ep_transfer_t;
 
+/**
+ * @brief Ring buffer that bulk IN transfers can be streamed from.
+ *
+ * The producer writes data at @p head and the driver sends it directly
+ * from the ring storage, starting at @p tail. One byte of the storage is always left unused
+ * to distinguish a full ring from an empty one.
+ *
+ * @sa nrfx_usbd_ep_ring_transfer
+ */
+typedef struct
+{
+    uint8_t *       p_buffer; //!< Ring storage. Must be placed in the Data RAM region.
+    size_t          size;     //!< Size of the ring storage in bytes.
+    volatile size_t head;     //!< Offset of the next byte to be written by the producer.
+    volatile size_t tail;     //!< Offset of the next byte to be sent by the driver.
+} nrfx_usbd_ring_t;
+
 /**
  * @brief Flags for the current transfer.
  *
@@ -684,6 +748,133 @@ nrfx_err_t nrfx_usbd_ep_transfer(nrfx_usbd_ep_t ep,
 nrfx_err_t nrfx_usbd_ep_handled_transfer(nrfx_usbd_ep_t ep,
                                          nrfx_usbd_handler_desc_t const * p_handler);
 
+/**
+ * @brief Initialize the ring buffer for streamed transfers.
+ *
+ * @param[out] p_ring   Ring buffer to be initialized.
+ * @param[in]  p_buffer Ring storage. Must be placed in the Data RAM region.
+ * @param[in]  size     Size of the ring storage in bytes. At least 2.
+ */
+void nrfx_usbd_ring_init(nrfx_usbd_ring_t * p_ring, uint8_t * p_buffer, size_t size);
+
+/**
+ * @brief Get the contiguous free space of the ring buffer.
+ *
+ * The producer writes data directly to the returned space and then
+ * makes it available with @ref nrfx_usbd_ring_commit.
+ *
+ * @param[in]  p_ring  Ring buffer.
+ * @param[out] pp_data Start of the free space.
+ *
+ * @return Number of bytes that can be written at @p pp_data.
+ */
+size_t nrfx_usbd_ring_claim(nrfx_usbd_ring_t const * p_ring, uint8_t ** pp_data);
+
+/**
+ * @brief Make bytes written by the producer available for sending.
+ *
+ * @param[in,out] p_ring Ring buffer.
+ * @param[in]     length Number of bytes written, not higher than the value returned by
+ *                       the preceding @ref nrfx_usbd_ring_claim call.
+ */
+void nrfx_usbd_ring_commit(nrfx_usbd_ring_t * p_ring, size_t length);
+
+/**
+ * @brief Start streaming the data from the ring buffer over a bulk IN endpoint.
+ *
+ * Packets are sent directly from the ring storage. Only a packet that wraps around the
+ * end of the storage is copied to the internal feeder buffer. Data committed while the
+ * transfer is in progress is sent within the same transfer. The transfer finishes
+ * with @ref NRFX_USBD_EVT_EPTRANSFER event when the ring becomes empty. The last packet is
+ * shorter than the endpoint size unless the data ends exactly at a packet boundary;
+ * no zero-length packet is added.
+ *
+ * @param[in] ep     IN endpoint number, other than EPIN0 and the isochronous endpoint.
+ * @param[in] p_ring Ring buffer with data to send. Must stay valid until the transfer finishes.
+ *
+ * @retval NRFX_SUCCESS              Transfer queued or started.
+ * @retval NRFX_ERROR_BUSY           Selected endpoint is pending.
+ * @retval NRFX_ERROR_INVALID_LENGTH The ring buffer is empty.
+ */
+nrfx_err_t nrfx_usbd_ep_ring_transfer(nrfx_usbd_ep_t ep, nrfx_usbd_ring_t * p_ring);
+
+/**
+ * @brief Set the EasyDMA scheduling priority of the endpoint.
+ *
+ * When several endpoints are ready for an EasyDMA transfer, the one with the highest priority
+ * is served first. Endpoints with the same priority are served in the round-robin manner.
+ * Lower priority endpoints are served at least once after every
+ * @ref NRFX_USBD_DMA_SCHEDULER_QUOTA higher priority transfers.
+ * By default, all endpoints have the lowest priority.
+ *
+ * @param[in] ep       Endpoint number.
+ * @param[in] priority Priority level. 0 is the highest, @ref NRFX_USBD_DMA_PRIORITY_LEVELS - 1
+ *                     is the lowest.
+ */
+void nrfx_usbd_ep_dma_priority_set(nrfx_usbd_ep_t ep, uint8_t priority);
+
+/**
+ * @brief Start double-buffered streaming on an isochronous endpoint.
+ *
+ * The driver arms the endpoint with one of the two buffers at every Start Of Frame,
+ * so no transfer has to be set up by the application within the frame deadline.
+ * The SOF interrupt must be enabled with @ref nrfx_usbd_start.
+ *
+ * For the IN endpoint, both buffers are initially owned by the application. A buffer filled
+ * with data is handed over with @ref nrfx_usbd_iso_stream_buffer_submit and sent in the next
+ * frame. @ref NRFX_USBD_EVT_ISO_STREAM with @ref NRFX_USBD_ISO_STREAM_DONE status returns
+ * the buffer when its data is copied to the endpoint. A frame without any submitted
+ * buffer is reported with @ref NRFX_USBD_ISO_STREAM_UNDERRUN status.
+ *
+ * For the OUT endpoint, both buffers are initially owned by the driver. Data received in
+ * a frame is copied to a free buffer at the start of the next frame and the buffer is passed to
+ * the application with @ref NRFX_USBD_ISO_STREAM_DONE status. The application returns it with
+ * @ref nrfx_usbd_iso_stream_buffer_submit. Data received while no buffer is free is dropped
+ * and reported with @ref NRFX_USBD_ISO_STREAM_OVERRUN status.
+ *
+ * @note Do not use @ref nrfx_usbd_ep_transfer on the endpoint while the stream is running.
+ *
+ * @param[in] ep          Isochronous endpoint number.
+ * @param[in] p_buffer0   First stream buffer.
+ * @param[in] p_buffer1   Second stream buffer.
+ * @param[in] buffer_size Size of each buffer in bytes. For the OUT endpoint, it must not be
+ *                        less than the endpoint max packet size.
+ *
+ * @retval NRFX_SUCCESS            Stream started.
+ * @retval NRFX_ERROR_BUSY         The stream is already running or a transfer is pending on the endpoint.
+ * @retval NRFX_ERROR_INVALID_ADDR The buffers are not placed in the Data RAM region.
+ */
+nrfx_err_t nrfx_usbd_iso_stream_start(nrfx_usbd_ep_t ep,
+                                      void *         p_buffer0,
+                                      void *         p_buffer1,
+                                      size_t         buffer_size);
+
+/**
+ * @brief Hand a stream buffer over to the driver.
+ *
+ * @param[in] ep       Isochronous endpoint number.
+ * @param[in] p_buffer One of the stream buffers, currently owned by the application.
+ * @param[in] size     For the IN endpoint, number of bytes to be sent in the frame.
+ *                     It must not be higher than the endpoint max packet size.
+ *                     Ignored for the OUT endpoint.
+ *
+ * @retval NRFX_SUCCESS             The buffer was handed over.
+ * @retval NRFX_ERROR_INVALID_STATE The stream is not running.
+ * @retval NRFX_ERROR_INVALID_PARAM The buffer does not belong to the stream or is already
+ *                                  owned by the driver.
+ */
+nrfx_err_t nrfx_usbd_iso_stream_buffer_submit(nrfx_usbd_ep_t ep, void * p_buffer, size_t size);
+
+/**
+ * @brief Stop streaming on an isochronous endpoint.
+ *
+ * The buffer armed for the current frame is still transferred and reported with
+ * @ref NRFX_USBD_ISO_STREAM_DONE status. The stream can be restarted after that.
+ *
+ * @param[in] ep Isochronous endpoint number.
+ */
+void nrfx_usbd_iso_stream_stop(nrfx_usbd_ep_t ep);
+
 /**
  * @brief Get the temporary buffer to be used by the feeder.
  *
@@ -0,0 +1,277 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx.h>
+
+#if NRFX_CHECK(NRFX_AAR_ENABLED)
+
+#include <nrfx_aar.h>
+#include <helpers/nrfx_prof.h>
+#include <string.h>
+
+#define NRFX_LOG_MODULE AAR
+#include <nrfx_log.h>
+
+/*
+ * The peripheral reads the address from a packet in the RADIO format, in which it follows
+ * the S0, LENGTH and S1 fields.
+ */
+#define AAR_ADDR_OFFSET  3 ///< Offset of the address from the address pointer.
+#define AAR_SCRATCH_SIZE 3 ///< Size of the scratch area required by the peripheral.
+
+/** @brief Control block of the AAR driver. */
+typedef struct
+{
+    nrfx_aar_event_handler_t handler;                                  ///< Event handler.
+    void *                   p_context;                                ///< Context passed to the event handler.
+    nrfx_drv_state_t         state;                                    ///< Driver state.
+    volatile bool            busy;                                     ///< Flag indicating that a resolution is in progress.
+    uint8_t const *          p_irks;                                   ///< Pointer to the table of IRKs.
+    uint16_t                 irk_count;                                ///< Number of IRKs in the table.
+    uint16_t                 irk_idx;                                  ///< Index of the first IRK checked in the current run.
+    uint8_t const *          p_addrs;                                  ///< Pointer to the addresses to resolve.
+    size_t                   addr_count;                               ///< Number of addresses to resolve.
+    size_t                   addr_idx;                                 ///< Index of the address being resolved.
+    size_t                   resolved_count;                           ///< Number of addresses resolved so far.
+    uint16_t *               p_indices;                                ///< Pointer to the indices of the matching IRKs.
+    uint8_t                  addr[AAR_ADDR_OFFSET + NRFX_AAR_ADDR_SIZE]; ///< Address being resolved, in the packet layout.
+    uint8_t                  scratch[AAR_SCRATCH_SIZE];                ///< Scratch area of the peripheral.
+} aar_control_block_t;
+
+static aar_control_block_t m_cb;
+
+/**
+ * @brief Function for starting a run that checks the next chunk of IRKs against the address.
+ */
+static void aar_run_start(void)
+{
+    uint16_t irk_num = NRFX_MIN((uint16_t)(m_cb.irk_count - m_cb.irk_idx),
+                                (uint16_t)NRFX_AAR_IRK_COUNT_MAX_PER_RUN);
+
+    nrf_aar_irk_pointer_set(NRF_AAR, m_cb.p_irks + m_cb.irk_idx * NRFX_AAR_IRK_SIZE);
+    nrf_aar_irk_number_set(NRF_AAR, (uint8_t)irk_num);
+
+    nrf_aar_event_clear(NRF_AAR, NRF_AAR_EVENT_RESOLVED);
+    nrf_aar_event_clear(NRF_AAR, NRF_AAR_EVENT_NOTRESOLVED);
+    nrf_aar_event_clear(NRF_AAR, NRF_AAR_EVENT_END);
+    nrf_aar_task_trigger(NRF_AAR, NRF_AAR_TASK_START);
+}
+
+/**
+ * @brief Function for starting the resolution of the next address.
+ */
+static void aar_addr_start(void)
+{
+    memcpy(&m_cb.addr[AAR_ADDR_OFFSET],
+           m_cb.p_addrs + m_cb.addr_idx * NRFX_AAR_ADDR_SIZE,
+           NRFX_AAR_ADDR_SIZE);
+    m_cb.irk_idx = 0;
+
+    aar_run_start();
+}
+
+nrfx_err_t nrfx_aar_init(nrfx_aar_config_t const * p_config,
+                         nrfx_aar_event_handler_t  handler,
+                         void *                    p_context)
+{
+    NRFX_ASSERT(p_config);
+    NRFX_ASSERT(handler);
+
+    nrfx_err_t err_code;
+
+    if (m_cb.state != NRFX_DRV_STATE_UNINITIALIZED)
+    {
+        err_code = NRFX_ERROR_ALREADY_INITIALIZED;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    m_cb.handler   = handler;
+    m_cb.p_context = p_context;
+    m_cb.busy      = false;
+
+    nrf_aar_int_enable(NRF_AAR, NRF_AAR_INT_END_MASK);
+    NRFX_IRQ_PRIORITY_SET(nrfx_get_irq_number(NRF_AAR), p_config->interrupt_priority);
+    NRFX_IRQ_ENABLE(nrfx_get_irq_number(NRF_AAR));
+
+    m_cb.state = NRFX_DRV_STATE_INITIALIZED;
+
+    err_code = NRFX_SUCCESS;
+    NRFX_LOG_INFO("Function: %s, error code: %s.", __func__, NRFX_LOG_ERROR_STRING_GET(err_code));
+    return err_code;
+}
+
+void nrfx_aar_uninit(void)
+{
+    NRFX_ASSERT(m_cb.state == NRFX_DRV_STATE_INITIALIZED);
+
+    NRFX_IRQ_DISABLE(nrfx_get_irq_number(NRF_AAR));
+    nrf_aar_int_disable(NRF_AAR, NRF_AAR_INT_END_MASK);
+
+    if (m_cb.busy)
+    {
+        nrf_aar_task_trigger(NRF_AAR, NRF_AAR_TASK_STOP);
+        nrf_aar_disable(NRF_AAR);
+        m_cb.busy = false;
+    }
+
+    m_cb.state = NRFX_DRV_STATE_UNINITIALIZED;
+    NRFX_LOG_INFO("Uninitialized.");
+}
+
+nrfx_err_t nrfx_aar_resolve(uint8_t const * p_irks,
+                            uint16_t        irk_count,
+                            uint8_t const * p_addrs,
+                            size_t          addr_count,
+                            uint16_t *      p_indices)
+{
+    NRFX_ASSERT(m_cb.state == NRFX_DRV_STATE_INITIALIZED);
+    NRFX_ASSERT(p_irks);
+    NRFX_ASSERT(p_addrs);
+    NRFX_ASSERT(p_indices);
+
+    nrfx_err_t err_code = NRFX_SUCCESS;
+
+    if (m_cb.busy)
+    {
+        err_code = NRFX_ERROR_BUSY;
+    }
+    else if (!nrfx_is_in_ram(p_irks))
+    {
+        err_code = NRFX_ERROR_INVALID_ADDR;
+    }
+    else if ((irk_count == 0) || (addr_count == 0))
+    {
+        err_code = NRFX_ERROR_INVALID_PARAM;
+    }
+
+    if (err_code != NRFX_SUCCESS)
+    {
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    m_cb.busy           = true;
+    m_cb.p_irks         = p_irks;
+    m_cb.irk_count      = irk_count;
+    m_cb.p_addrs        = p_addrs;
+    m_cb.addr_count     = addr_count;
+    m_cb.addr_idx       = 0;
+    m_cb.resolved_count = 0;
+    m_cb.p_indices      = p_indices;
+
+    // The pointers are shared with the CCM peripheral, so they are set for every resolution.
+    nrf_aar_addr_pointer_set(NRF_AAR, m_cb.addr);
+    nrf_aar_scratch_pointer_set(NRF_AAR, m_cb.scratch);
+    nrf_aar_enable(NRF_AAR);
+
+    aar_addr_start();
+
+    return NRFX_SUCCESS;
+}
+
+bool nrfx_aar_is_busy(void)
+{
+    return m_cb.busy;
+}
+
+/**
+ * @brief Function for processing the result of the completed run.
+ *
+ * @retval true  All addresses have been resolved.
+ * @retval false The resolution continues with the next run.
+ */
+static bool aar_run_finished(void)
+{
+    if (nrf_aar_event_check(NRF_AAR, NRF_AAR_EVENT_RESOLVED))
+    {
+        m_cb.p_indices[m_cb.addr_idx] = m_cb.irk_idx + nrf_aar_resolution_status_get(NRF_AAR);
+        m_cb.resolved_count++;
+    }
+    else
+    {
+        m_cb.irk_idx += NRFX_MIN((uint16_t)(m_cb.irk_count - m_cb.irk_idx),
+                                 (uint16_t)NRFX_AAR_IRK_COUNT_MAX_PER_RUN);
+        if (m_cb.irk_idx < m_cb.irk_count)
+        {
+            // The address may match an IRK of the next chunk.
+            aar_run_start();
+            return false;
+        }
+
+        m_cb.p_indices[m_cb.addr_idx] = NRFX_AAR_NOT_RESOLVED;
+    }
+
+    if (++m_cb.addr_idx < m_cb.addr_count)
+    {
+        aar_addr_start();
+        return false;
+    }
+
+    return true;
+}
+
+NRFX_IRQ_HANDLER_ATTR void nrfx_aar_irq_handler(void)
+{
+    NRFX_PROF_IRQ_ENTER(aar);
+
+    if (nrf_aar_event_check(NRF_AAR, NRF_AAR_EVENT_END))
+    {
+        nrf_aar_event_clear(NRF_AAR, NRF_AAR_EVENT_END);
+        NRFX_LOG_DEBUG("Event: NRF_AAR_EVENT_END.");
+
+        if (aar_run_finished())
+        {
+            // Release the registers shared with the CCM peripheral.
+            nrf_aar_disable(NRF_AAR);
+            m_cb.busy = false;
+
+            nrfx_aar_evt_t const event = {
+                .p_addrs        = m_cb.p_addrs,
+                .addr_count     = m_cb.addr_count,
+                .p_indices      = m_cb.p_indices,
+                .resolved_count = m_cb.resolved_count,
+            };
+
+            m_cb.handler(&event, m_cb.p_context);
+        }
+    }
+
+    NRFX_PROF_IRQ_EXIT();
+}
+
+#endif // NRFX_CHECK(NRFX_AAR_ENABLED)
@@ -36,6 +36,7 @@
 #if NRFX_CHECK(NRFX_ADC_ENABLED)
 
 #include <nrfx_adc.h>
+#include <helpers/nrfx_prof.h>
 
 #define NRFX_LOG_MODULE ADC
 #include <nrfx_log.h>
@@ -50,6 +51,13 @@ typedef struct
     nrf_adc_value_t        * p_buffer;
     uint16_t                 size;
     uint16_t                 idx;
+    nrf_adc_value_t        * p_ring;
+    uint8_t                  ring_count;
+    uint8_t                  ring_next;
+    uint32_t                 ring_latched;
+    volatile uint32_t        ring_released;
+    uint32_t                 sequence;
+    bool                     overrun;
     nrfx_drv_state_t         state;
 } adc_cb_t;
 
@@ -95,6 +103,7 @@ void nrfx_adc_uninit(void)
     // switch back to the first channel in the list (when the number of samples
     // to read is bigger than the number of enabled channels).
     m_cb.p_head = NULL;
+    m_cb.p_ring = NULL;
 
     m_cb.state = NRFX_DRV_STATE_UNINITIALIZED;
 }
@@ -293,15 +302,160 @@ nrfx_err_t nrfx_adc_buffer_convert(nrf_adc_value_t * buffer, uint16_t size)
     }
 }
 
+nrfx_err_t nrfx_adc_ring_convert(nrf_adc_value_t * p_buffers, uint16_t size, uint8_t count)
+{
+    NRFX_ASSERT(m_cb.state != NRFX_DRV_STATE_UNINITIALIZED);
+    NRFX_ASSERT(p_buffers);
+
+    nrfx_err_t err_code;
+
+    if (m_cb.state == NRFX_DRV_STATE_POWERED_ON)
+    {
+        err_code = NRFX_ERROR_BUSY;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    if (!m_cb.event_handler || !m_cb.p_head)
+    {
+        err_code = NRFX_ERROR_INVALID_STATE;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    if (count < 2)
+    {
+        err_code = NRFX_ERROR_INVALID_PARAM;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    uint16_t channel_count = 0;
+    for (nrfx_adc_channel_t const * p_channel = m_cb.p_head;
+         p_channel != NULL;
+         p_channel = p_channel->p_next)
+    {
+        channel_count++;
+    }
+
+    // Every buffer must start with the first channel, so that the position of a sample
+    // in the buffer identifies its channel.
+    if ((size == 0) || (size % channel_count != 0))
+    {
+        err_code = NRFX_ERROR_INVALID_LENGTH;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    m_cb.state          = NRFX_DRV_STATE_POWERED_ON;
+    m_cb.p_current_conv = m_cb.p_head;
+    m_cb.p_ring         = p_buffers;
+    m_cb.ring_count     = count;
+    m_cb.ring_next      = 1;
+    m_cb.ring_latched   = 1;
+    m_cb.ring_released  = 0;
+    m_cb.sequence       = 0;
+    m_cb.overrun        = false;
+    m_cb.size           = size;
+    m_cb.idx            = 0;
+    m_cb.p_buffer       = p_buffers;
+
+    nrf_adc_init(NRF_ADC, &m_cb.p_current_conv->config);
+    nrf_adc_event_clear(NRF_ADC, NRF_ADC_EVENT_END);
+    nrf_adc_enable(NRF_ADC);
+    nrf_adc_int_enable(NRF_ADC, NRF_ADC_INT_END_MASK);
+
+    err_code = NRFX_SUCCESS;
+    NRFX_LOG_INFO("Function: %s, error code: %s.", __func__, NRFX_LOG_ERROR_STRING_GET(err_code));
+    return err_code;
+}
+
+void nrfx_adc_ring_buffer_release(void)
+{
+    NRFX_ASSERT(m_cb.ring_released < m_cb.sequence);
+
+    m_cb.ring_released++;
+}
+
+void nrfx_adc_ring_stop(void)
+{
+    NRFX_ASSERT(m_cb.state != NRFX_DRV_STATE_UNINITIALIZED);
+
+    nrf_adc_int_disable(NRF_ADC, NRF_ADC_INT_END_MASK);
+    nrf_adc_task_trigger(NRF_ADC, NRF_ADC_TASK_STOP);
+    nrf_adc_disable(NRF_ADC);
+    nrf_adc_event_clear(NRF_ADC, NRF_ADC_EVENT_END);
+    NRFX_IRQ_PENDING_CLEAR(ADC_IRQn);
+
+    m_cb.p_ring = NULL;
+    m_cb.state  = NRFX_DRV_STATE_INITIALIZED;
+}
+
+static void adc_ring_sample_process(void)
+{
+    nrf_adc_event_clear(NRF_ADC, NRF_ADC_EVENT_END);
+    m_cb.p_buffer[m_cb.idx] = (nrf_adc_value_t)nrf_adc_result_get(NRF_ADC);
+    m_cb.idx++;
+
+    // With a single channel the configuration stays the same, otherwise the next channel
+    // is selected here, so that it is ready for the next START task.
+    if (m_cb.p_head->p_next != NULL)
+    {
+        m_cb.p_current_conv = m_cb.p_current_conv->p_next ?
+                              m_cb.p_current_conv->p_next : m_cb.p_head;
+        nrf_adc_disable(NRF_ADC);
+        nrf_adc_init(NRF_ADC, &m_cb.p_current_conv->config);
+        nrf_adc_enable(NRF_ADC);
+    }
+
+    if (m_cb.idx < m_cb.size)
+    {
+        return;
+    }
+
+    nrfx_adc_evt_t evt;
+    evt.type               = NRFX_ADC_EVT_DONE;
+    evt.data.done.p_buffer = m_cb.p_buffer;
+    evt.data.done.size     = m_cb.size;
+    evt.data.done.sequence = m_cb.sequence;
+    evt.data.done.overrun  = m_cb.overrun;
+
+    // Continue with the next buffer before the event is handled, so that the samples
+    // taken in the meantime are not lost.
+    m_cb.p_buffer = &m_cb.p_ring[(size_t)m_cb.ring_next * m_cb.size];
+    m_cb.idx      = 0;
+    // The buffer held the result that was reported ring_count buffers earlier.
+    m_cb.overrun  = ((m_cb.ring_latched - m_cb.ring_released) >= m_cb.ring_count);
+    m_cb.ring_latched++;
+    m_cb.ring_next = (uint8_t)((m_cb.ring_next + 1) % m_cb.ring_count);
+    m_cb.sequence++;
+
+    NRFX_LOG_DEBUG("Event: %s.", EVT_TO_STR(NRF_ADC_EVENT_END));
+    m_cb.event_handler(&evt);
+}
+
 bool nrfx_adc_is_busy(void)
 {
     NRFX_ASSERT(m_cb.state != NRFX_DRV_STATE_UNINITIALIZED);
     return (m_cb.state == NRFX_DRV_STATE_POWERED_ON) ? true : false;
 }
 
-void nrfx_adc_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_adc_irq_handler(void)
 {
-    if (m_cb.p_buffer == NULL)
+    NRFX_PROF_IRQ_ENTER(adc);
+    if (m_cb.p_ring)
+    {
+        adc_ring_sample_process();
+    }
+    else if (m_cb.p_buffer == NULL)
     {
         nrf_adc_event_clear(NRF_ADC, NRF_ADC_EVENT_END);
         NRFX_LOG_DEBUG("Event: %s.", EVT_TO_STR(NRF_ADC_EVENT_END));
@@ -323,11 +477,14 @@ void nrfx_adc_irq_handler(void)
         evt.type = NRFX_ADC_EVT_DONE;
         evt.data.done.p_buffer = m_cb.p_buffer;
         evt.data.done.size     = m_cb.size;
+        evt.data.done.sequence = 0;
+        evt.data.done.overrun  = false;
         m_cb.state = NRFX_DRV_STATE_INITIALIZED;
         NRFX_LOG_DEBUG("ADC data:");
         NRFX_LOG_HEXDUMP_DEBUG((uint8_t *)m_cb.p_buffer, m_cb.size * sizeof(nrf_adc_value_t));
         m_cb.event_handler(&evt);
     }
+    NRFX_PROF_IRQ_EXIT();
 }
 
 #endif // NRFX_CHECK(NRFX_ADC_ENABLED)
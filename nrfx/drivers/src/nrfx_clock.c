@@ -36,6 +36,7 @@
 #if NRFX_CHECK(NRFX_CLOCK_ENABLED)
 
 #include <nrfx_clock.h>
+#include <helpers/nrfx_prof.h>
 #include <nrf_erratas.h>
 
 #define NRFX_LOG_MODULE CLOCK
@@ -135,6 +136,7 @@ typedef struct
 #if NRFX_CHECK(USE_WORKAROUND_FOR_ANOMALY_201)
     bool                            hfclk_started;      /*< Anomaly 201 workaround. */
 #endif
+    uint32_t                        hfclk_requests;     /*< Number of active HFCLK requests. */
 
 #if NRFX_CHECK(NRFX_CLOCK_CONFIG_LF_CAL_ENABLED)
     volatile nrfx_clock_cal_state_t cal_state;
@@ -143,6 +145,11 @@ typedef struct
 
 static nrfx_clock_cb_t m_clock_cb;
 
+#if defined(CLOCK_FEATURE_HFCLK_DIVIDE_PRESENT) || NRF_CLOCK_HAS_HFCLK192M
+/** @brief Head of the list of listeners notified about clock divider changes. */
+static nrfx_clock_divider_listener_t * mp_divider_listeners;
+#endif
+
 /**
  * This variable is used to check whether common POWER_CLOCK common interrupt
  * should be disabled or not if @ref nrfx_power tries to disable the interrupt.
@@ -287,6 +294,7 @@ nrfx_err_t nrfx_clock_init(nrfx_clock_event_handler_t event_handler)
         m_clock_cb.cal_state = CAL_STATE_IDLE;
 #endif
         m_clock_cb.event_handler = event_handler;
+        m_clock_cb.hfclk_requests = 0;
         m_clock_cb.module_initialized = true;
 #if NRFX_CHECK(USE_WORKAROUND_FOR_ANOMALY_201)
         m_clock_cb.hfclk_started = false;
@@ -351,6 +359,7 @@ void nrfx_clock_uninit(void)
 #if NRF_CLOCK_HAS_HFCLKAUDIO
     clock_stop(NRF_CLOCK_DOMAIN_HFCLKAUDIO);
 #endif
+    m_clock_cb.hfclk_requests = 0;
     m_clock_cb.module_initialized = false;
     NRFX_LOG_INFO("Uninitialized.");
 }
@@ -430,6 +439,36 @@ void nrfx_clock_stop(nrf_clock_domain_t domain)
     clock_stop(domain);
 }
 
+void nrfx_clock_hfclk_request(void)
+{
+    NRFX_ASSERT(m_clock_cb.module_initialized);
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    if (m_clock_cb.hfclk_requests++ == 0)
+    {
+        nrfx_clock_start(NRF_CLOCK_DOMAIN_HFCLK);
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+}
+
+void nrfx_clock_hfclk_release(void)
+{
+    NRFX_ASSERT(m_clock_cb.module_initialized);
+    NRFX_ASSERT(m_clock_cb.hfclk_requests > 0);
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    if (--m_clock_cb.hfclk_requests == 0)
+    {
+        clock_stop(NRF_CLOCK_DOMAIN_HFCLK);
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+}
+
+uint32_t nrfx_clock_hfclk_request_count_get(void)
+{
+    return m_clock_cb.hfclk_requests;
+}
+
 nrfx_err_t nrfx_clock_calibration_start(void)
 {
     nrfx_err_t err_code = NRFX_SUCCESS;
@@ -562,7 +601,7 @@ nrfx_err_t nrfx_clock_divider_set(nrf_clock_domain_t domain,
                     return NRFX_ERROR_INVALID_PARAM;
             }
             SystemCoreClockUpdate();
-            return NRFX_SUCCESS;
+            break;
 #endif
 #if NRF_CLOCK_HAS_HFCLK192M
         case NRF_CLOCK_DOMAIN_HFCLK192M:
@@ -574,17 +613,59 @@ nrfx_err_t nrfx_clock_divider_set(nrf_clock_domain_t domain,
             {
                 nrf_clock_hfclk192m_div_set(NRF_CLOCK, div);
             }
-            return NRFX_SUCCESS;
+            break;
 #endif
         default:
             NRFX_ASSERT(0);
             return NRFX_ERROR_NOT_SUPPORTED;
     }
+
+    /* Listeners are notified after the new divider is in effect and, for HFCLK,
+     * after SystemCoreClock has been updated, so they can re-derive their timings. */
+    for (nrfx_clock_divider_listener_t * p_listener = mp_divider_listeners;
+         p_listener != NULL;
+         p_listener = p_listener->p_next)
+    {
+        p_listener->handler(domain, div, p_listener->p_context);
+    }
+
+    return NRFX_SUCCESS;
+}
+
+void nrfx_clock_divider_listener_add(nrfx_clock_divider_listener_t * p_listener)
+{
+    NRFX_ASSERT(p_listener);
+    NRFX_ASSERT(p_listener->handler);
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    p_listener->p_next   = mp_divider_listeners;
+    mp_divider_listeners = p_listener;
+    NRFX_CRITICAL_SECTION_EXIT();
+}
+
+void nrfx_clock_divider_listener_remove(nrfx_clock_divider_listener_t * p_listener)
+{
+    NRFX_ASSERT(p_listener);
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    nrfx_clock_divider_listener_t ** pp_item = &mp_divider_listeners;
+    while (*pp_item != NULL)
+    {
+        if (*pp_item == p_listener)
+        {
+            *pp_item = p_listener->p_next;
+            p_listener->p_next = NULL;
+            break;
+        }
+        pp_item = &(*pp_item)->p_next;
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
 }
 #endif
 
-void nrfx_clock_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_clock_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(clock);
     if (nrf_clock_event_check(NRF_CLOCK, NRF_CLOCK_EVENT_HFCLKSTARTED))
     {
         nrf_clock_event_clear(NRF_CLOCK, NRF_CLOCK_EVENT_HFCLKSTARTED);
@@ -672,6 +753,7 @@ void nrfx_clock_irq_handler(void)
         m_clock_cb.event_handler(NRFX_CLOCK_EVT_HFCLK192M_STARTED);
     }
 #endif
+    NRFX_PROF_IRQ_EXIT();
 }
 
 #endif // NRFX_CHECK(NRFX_CLOCK_ENABLED)
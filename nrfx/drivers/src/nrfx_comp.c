@@ -36,6 +36,7 @@
 #if NRFX_CHECK(NRFX_COMP_ENABLED)
 
 #include <nrfx_comp.h>
+#include <helpers/nrfx_prof.h>
 #include "prs/nrfx_prs.h"
 
 #define NRFX_LOG_MODULE COMP
@@ -63,12 +64,14 @@ static void comp_execute_handler(nrf_comp_event_t event, uint32_t event_mask)
     }
 }
 
-void nrfx_comp_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_comp_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(comp);
     comp_execute_handler(NRF_COMP_EVENT_READY, COMP_INTENSET_READY_Msk);
     comp_execute_handler(NRF_COMP_EVENT_DOWN,  COMP_INTENSET_DOWN_Msk);
     comp_execute_handler(NRF_COMP_EVENT_UP,    COMP_INTENSET_UP_Msk);
     comp_execute_handler(NRF_COMP_EVENT_CROSS, COMP_INTENSET_CROSS_Msk);
+    NRFX_PROF_IRQ_EXIT();
 }
 
 
@@ -65,6 +65,9 @@ static nrfx_atomic_t   m_allocated_channels = DPPI_AVAILABLE_CHANNELS_MASK;
 /**< Bitmap representing groups availability. */
 static nrfx_atomic_t   m_allocated_groups = DPPI_AVAILABLE_GROUPS_MASK;
 
+/**< Lock of the read-modify-write updates of the group registers. */
+NRFX_LOCK_DECLARE(m_dppi_lock);
+
 void nrfx_dppi_free(void)
 {
     uint32_t mask = DPPI_AVAILABLE_GROUPS_MASK & ~m_allocated_groups;
@@ -160,9 +163,9 @@ nrfx_err_t nrfx_dppi_channel_include_in_group(uint8_t                  channel,
     }
     else
     {
-        NRFX_CRITICAL_SECTION_ENTER();
+        NRFX_LOCK_TAKE(m_dppi_lock);
         nrf_dppi_channels_include_in_group(NRF_DPPIC, DPPI_BIT_SET(channel), group);
-        NRFX_CRITICAL_SECTION_EXIT();
+        NRFX_LOCK_GIVE(m_dppi_lock);
     }
     NRFX_LOG_INFO("Function: %s, error code: %s.", __func__, NRFX_LOG_ERROR_STRING_GET(err_code));
     return err_code;
@@ -180,9 +183,9 @@ nrfx_err_t nrfx_dppi_channel_remove_from_group(uint8_t                  channel,
     }
     else
     {
-        NRFX_CRITICAL_SECTION_ENTER();
+        NRFX_LOCK_TAKE(m_dppi_lock);
         nrf_dppi_channels_remove_from_group(NRF_DPPIC, DPPI_BIT_SET(channel), group);
-        NRFX_CRITICAL_SECTION_EXIT();
+        NRFX_LOCK_GIVE(m_dppi_lock);
     }
     NRFX_LOG_INFO("Function: %s, error code: %s.", __func__, NRFX_LOG_ERROR_STRING_GET(err_code));
     return err_code;
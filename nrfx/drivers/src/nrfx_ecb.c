@@ -0,0 +1,420 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx.h>
+
+#if NRFX_CHECK(NRFX_ECB_ENABLED)
+
+#include <nrfx_ecb.h>
+#include <helpers/nrfx_prof.h>
+#include <string.h>
+
+#define NRFX_LOG_MODULE ECB
+#include <nrfx_log.h>
+
+#define ECB_DATA_KEY_OFFSET        0                                          ///< Offset of the key in the ECB data structure.
+#define ECB_DATA_CLEARTEXT_OFFSET  NRFX_ECB_KEY_SIZE                          ///< Offset of the cleartext in the ECB data structure.
+#define ECB_DATA_CIPHERTEXT_OFFSET (NRFX_ECB_KEY_SIZE + NRFX_ECB_BLOCK_SIZE)  ///< Offset of the ciphertext in the ECB data structure.
+#define ECB_DATA_SIZE              (NRFX_ECB_KEY_SIZE + 2 * NRFX_ECB_BLOCK_SIZE) ///< Size of the ECB data structure.
+
+/** @brief States of an encryption job. */
+typedef enum
+{
+    JOB_STATE_IDLE,       ///< The job is not submitted.
+    JOB_STATE_PENDING,    ///< The job is queued and its next block is ready to be encrypted.
+    JOB_STATE_ACTIVE,     ///< The block of the job is being encrypted.
+    JOB_STATE_PROCESSING, ///< The encrypted block of the job is being processed.
+} job_state_t;
+
+/** @brief Control block of the ECB driver. */
+typedef struct
+{
+    nrfx_drv_state_t state;               ///< Driver state.
+    nrfx_ecb_job_t * p_head;              ///< Queue of submitted jobs, ordered by priority.
+    nrfx_ecb_job_t * p_active;            ///< Job whose block is being encrypted. NULL if the peripheral is idle.
+    nrfx_ecb_job_t * p_loaded;            ///< Job whose key is loaded into the ECB data structure.
+    uint8_t          data[ECB_DATA_SIZE]; ///< ECB data structure accessed by the peripheral.
+} ecb_control_block_t;
+
+static ecb_control_block_t m_cb;
+
+/** @brief Lock of the job queue, shared with the interrupt handler. */
+NRFX_LOCK_DECLARE(m_ecb_lock);
+
+/**
+ * @brief Function for inserting a job into the queue behind the jobs of higher or equal priority.
+ *
+ * @param[in] p_job Pointer to the job.
+ */
+static void queue_insert(nrfx_ecb_job_t * p_job)
+{
+    nrfx_ecb_job_t ** pp_link = &m_cb.p_head;
+
+    while (*pp_link && ((*pp_link)->priority <= p_job->priority))
+    {
+        pp_link = &(*pp_link)->p_next;
+    }
+
+    p_job->p_next = *pp_link;
+    *pp_link      = p_job;
+}
+
+/**
+ * @brief Function for removing a job from the queue.
+ *
+ * @param[in] p_job Pointer to the job.
+ */
+static void queue_remove(nrfx_ecb_job_t * p_job)
+{
+    nrfx_ecb_job_t ** pp_link = &m_cb.p_head;
+
+    while (*pp_link && (*pp_link != p_job))
+    {
+        pp_link = &(*pp_link)->p_next;
+    }
+
+    if (*pp_link)
+    {
+        *pp_link = p_job->p_next;
+    }
+    p_job->p_next = NULL;
+}
+
+/**
+ * @brief Function for getting the next block of a job.
+ *
+ * @param[in] p_job        Pointer to the job.
+ * @param[in] p_ciphertext Pointer to the encrypted block, or NULL if the first block is requested.
+ *
+ * @retval true  The next block was stored in the job.
+ * @retval false The job is complete.
+ */
+static bool job_block_next(nrfx_ecb_job_t * p_job, uint8_t const * p_ciphertext)
+{
+    if (p_job->block_handler)
+    {
+        return p_job->block_handler(p_job, p_ciphertext, p_job->cleartext, p_job->p_context);
+    }
+
+    if (p_ciphertext)
+    {
+        memcpy(p_job->p_out + p_job->progress * NRFX_ECB_BLOCK_SIZE,
+               p_ciphertext,
+               NRFX_ECB_BLOCK_SIZE);
+        p_job->progress++;
+    }
+
+    if (p_job->progress >= p_job->blocks)
+    {
+        return false;
+    }
+
+    memcpy(p_job->cleartext,
+           p_job->p_in + p_job->progress * NRFX_ECB_BLOCK_SIZE,
+           NRFX_ECB_BLOCK_SIZE);
+
+    return true;
+}
+
+/**
+ * @brief Function for stopping the block being encrypted.
+ *
+ * Must be called in a critical section.
+ */
+static void ecb_stop(void)
+{
+    nrf_ecb_int_disable(NRF_ECB, NRF_ECB_INT_ENDECB_MASK | NRF_ECB_INT_ERRORECB_MASK);
+    nrf_ecb_task_trigger(NRF_ECB, NRF_ECB_TASK_STOPECB);
+    nrf_ecb_event_clear(NRF_ECB, NRF_ECB_EVENT_ENDECB);
+    nrf_ecb_event_clear(NRF_ECB, NRF_ECB_EVENT_ERRORECB);
+    nrf_ecb_int_enable(NRF_ECB, NRF_ECB_INT_ENDECB_MASK | NRF_ECB_INT_ERRORECB_MASK);
+
+    m_cb.p_active = NULL;
+}
+
+/**
+ * @brief Function for starting the next block of the job of the highest priority.
+ *
+ * Must be called in a critical section. Does nothing if the peripheral is busy.
+ */
+static void ecb_start(void)
+{
+    nrfx_ecb_job_t * p_job = m_cb.p_head;
+
+    // While the block of the first job is being processed, the jobs behind it are not started.
+    // Otherwise the next block of the first job would have to wait for them.
+    if (m_cb.p_active || !p_job || (p_job->state != JOB_STATE_PENDING))
+    {
+        return;
+    }
+
+    if (m_cb.p_loaded != p_job)
+    {
+        memcpy(&m_cb.data[ECB_DATA_KEY_OFFSET], p_job->p_key, NRFX_ECB_KEY_SIZE);
+        m_cb.p_loaded = p_job;
+    }
+    memcpy(&m_cb.data[ECB_DATA_CLEARTEXT_OFFSET], p_job->cleartext, NRFX_ECB_BLOCK_SIZE);
+
+    p_job->state  = JOB_STATE_ACTIVE;
+    m_cb.p_active = p_job;
+
+    nrf_ecb_event_clear(NRF_ECB, NRF_ECB_EVENT_ENDECB);
+    nrf_ecb_event_clear(NRF_ECB, NRF_ECB_EVENT_ERRORECB);
+    nrf_ecb_task_trigger(NRF_ECB, NRF_ECB_TASK_STARTECB);
+}
+
+nrfx_err_t nrfx_ecb_init(nrfx_ecb_config_t const * p_config)
+{
+    NRFX_ASSERT(p_config);
+
+    nrfx_err_t err_code;
+
+    if (m_cb.state != NRFX_DRV_STATE_UNINITIALIZED)
+    {
+        err_code = NRFX_ERROR_ALREADY_INITIALIZED;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    m_cb.p_head   = NULL;
+    m_cb.p_active = NULL;
+    m_cb.p_loaded = NULL;
+
+    nrf_ecb_data_pointer_set(NRF_ECB, m_cb.data);
+    nrf_ecb_event_clear(NRF_ECB, NRF_ECB_EVENT_ENDECB);
+    nrf_ecb_event_clear(NRF_ECB, NRF_ECB_EVENT_ERRORECB);
+    nrf_ecb_int_enable(NRF_ECB, NRF_ECB_INT_ENDECB_MASK | NRF_ECB_INT_ERRORECB_MASK);
+
+    NRFX_IRQ_PRIORITY_SET(ECB_IRQn, p_config->interrupt_priority);
+    NRFX_IRQ_ENABLE(ECB_IRQn);
+
+    m_cb.state = NRFX_DRV_STATE_INITIALIZED;
+
+    err_code = NRFX_SUCCESS;
+    NRFX_LOG_INFO("Function: %s, error code: %s.", __func__, NRFX_LOG_ERROR_STRING_GET(err_code));
+    return err_code;
+}
+
+void nrfx_ecb_uninit(void)
+{
+    NRFX_ASSERT(m_cb.state == NRFX_DRV_STATE_INITIALIZED);
+
+    NRFX_IRQ_DISABLE(ECB_IRQn);
+
+    NRFX_LOCK_TAKE(m_ecb_lock);
+    ecb_stop();
+    nrf_ecb_int_disable(NRF_ECB, NRF_ECB_INT_ENDECB_MASK | NRF_ECB_INT_ERRORECB_MASK);
+
+    while (m_cb.p_head)
+    {
+        nrfx_ecb_job_t * p_job = m_cb.p_head;
+
+        m_cb.p_head   = p_job->p_next;
+        p_job->p_next = NULL;
+        p_job->state  = JOB_STATE_IDLE;
+    }
+    m_cb.p_loaded = NULL;
+    NRFX_LOCK_GIVE(m_ecb_lock);
+
+    m_cb.state = NRFX_DRV_STATE_UNINITIALIZED;
+    NRFX_LOG_INFO("Uninitialized.");
+}
+
+nrfx_err_t nrfx_ecb_job_submit(nrfx_ecb_job_t * p_job)
+{
+    NRFX_ASSERT(p_job);
+    NRFX_ASSERT(p_job->p_key);
+    NRFX_ASSERT(p_job->block_handler || (p_job->p_in && p_job->p_out));
+
+    nrfx_err_t err_code = NRFX_SUCCESS;
+
+    if (m_cb.state != NRFX_DRV_STATE_INITIALIZED)
+    {
+        err_code = NRFX_ERROR_INVALID_STATE;
+    }
+    else if (p_job->state != JOB_STATE_IDLE)
+    {
+        err_code = NRFX_ERROR_BUSY;
+    }
+    else
+    {
+        p_job->progress = 0;
+        p_job->p_next   = NULL;
+
+        if (!job_block_next(p_job, NULL))
+        {
+            err_code = NRFX_ERROR_INVALID_PARAM;
+        }
+    }
+
+    if (err_code != NRFX_SUCCESS)
+    {
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    NRFX_LOCK_TAKE(m_ecb_lock);
+    if (m_cb.p_loaded == p_job)
+    {
+        // The key of a submitted job may be different than the one it had before.
+        m_cb.p_loaded = NULL;
+    }
+    p_job->state = JOB_STATE_PENDING;
+    queue_insert(p_job);
+    ecb_start();
+    NRFX_LOCK_GIVE(m_ecb_lock);
+
+    return NRFX_SUCCESS;
+}
+
+bool nrfx_ecb_job_cancel(nrfx_ecb_job_t * p_job)
+{
+    NRFX_ASSERT(p_job);
+
+    bool cancelled = false;
+
+    NRFX_LOCK_TAKE(m_ecb_lock);
+    if (p_job->state != JOB_STATE_IDLE)
+    {
+        if (m_cb.p_active == p_job)
+        {
+            ecb_stop();
+        }
+
+        // A job whose block is being processed is not resumed, see nrfx_ecb_irq_handler.
+        queue_remove(p_job);
+        p_job->state = JOB_STATE_IDLE;
+        cancelled    = true;
+
+        ecb_start();
+    }
+    NRFX_LOCK_GIVE(m_ecb_lock);
+
+    return cancelled;
+}
+
+bool nrfx_ecb_job_pending_check(nrfx_ecb_job_t const * p_job)
+{
+    NRFX_ASSERT(p_job);
+
+    return p_job->state != JOB_STATE_IDLE;
+}
+
+/**
+ * @brief Function for processing the encrypted block of a job.
+ *
+ * @param[in] p_job        Pointer to the job.
+ * @param[in] p_ciphertext Pointer to the encrypted block.
+ */
+static void job_block_process(nrfx_ecb_job_t * p_job, uint8_t const * p_ciphertext)
+{
+    bool more = job_block_next(p_job, p_ciphertext);
+    bool done = false;
+
+    NRFX_LOCK_TAKE(m_ecb_lock);
+    // The job could have been cancelled while its block was being processed.
+    if (p_job->state == JOB_STATE_PROCESSING)
+    {
+        if (more)
+        {
+            p_job->state = JOB_STATE_PENDING;
+        }
+        else
+        {
+            queue_remove(p_job);
+            p_job->state = JOB_STATE_IDLE;
+            done         = true;
+        }
+
+        ecb_start();
+    }
+    NRFX_LOCK_GIVE(m_ecb_lock);
+
+    if (done && p_job->handler)
+    {
+        p_job->handler(p_job, p_job->p_context);
+    }
+}
+
+NRFX_IRQ_HANDLER_ATTR void nrfx_ecb_irq_handler(void)
+{
+    NRFX_PROF_IRQ_ENTER(ecb);
+
+    uint8_t          ciphertext[NRFX_ECB_BLOCK_SIZE];
+    nrfx_ecb_job_t * p_job = NULL;
+
+    // The events are checked in a critical section, so that they cannot refer to a block
+    // of a job that has been cancelled in the meantime.
+    NRFX_LOCK_TAKE(m_ecb_lock);
+    if (nrf_ecb_event_check(NRF_ECB, NRF_ECB_EVENT_ERRORECB))
+    {
+        nrf_ecb_event_clear(NRF_ECB, NRF_ECB_EVENT_ERRORECB);
+
+        // The block was aborted by a peripheral sharing the AES core, such as CCM or AAR.
+        // The ECB data structure is intact, so the block is encrypted again.
+        if (m_cb.p_active)
+        {
+            nrf_ecb_task_trigger(NRF_ECB, NRF_ECB_TASK_STARTECB);
+        }
+    }
+
+    if (nrf_ecb_event_check(NRF_ECB, NRF_ECB_EVENT_ENDECB))
+    {
+        nrf_ecb_event_clear(NRF_ECB, NRF_ECB_EVENT_ENDECB);
+
+        p_job = m_cb.p_active;
+        if (p_job)
+        {
+            memcpy(ciphertext, &m_cb.data[ECB_DATA_CIPHERTEXT_OFFSET], NRFX_ECB_BLOCK_SIZE);
+            p_job->state  = JOB_STATE_PROCESSING;
+            m_cb.p_active = NULL;
+
+            // A job of higher priority submitted in the meantime takes over the peripheral.
+            ecb_start();
+        }
+    }
+    NRFX_LOCK_GIVE(m_ecb_lock);
+
+    if (p_job)
+    {
+        job_block_process(p_job, ciphertext);
+    }
+
+    NRFX_PROF_IRQ_EXIT();
+}
+
+#endif // NRFX_CHECK(NRFX_ECB_ENABLED)
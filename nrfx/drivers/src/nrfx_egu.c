@@ -64,6 +64,7 @@
 #endif
 
 #include <nrfx_egu.h>
+#include <helpers/nrfx_prof.h>
 
 typedef struct
 {
@@ -157,7 +158,7 @@ void nrfx_egu_uninit(nrfx_egu_t const * p_instance)
     p_cb->state = NRFX_DRV_STATE_UNINITIALIZED;
 }
 
-static void egu_irq_handler(NRF_EGU_Type * p_reg, egu_control_block_t * p_cb)
+NRFX_IRQ_HANDLER_ATTR static void egu_irq_handler(NRF_EGU_Type * p_reg, egu_control_block_t * p_cb)
 {
     uint32_t int_mask = nrf_egu_int_enable_check(p_reg, ~0uL);
 
@@ -173,44 +174,56 @@ static void egu_irq_handler(NRF_EGU_Type * p_reg, egu_control_block_t * p_cb)
 }
 
 #if NRFX_CHECK(NRFX_EGU0_ENABLED)
-void nrfx_egu_0_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_egu_0_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(egu_0);
     egu_irq_handler(NRF_EGU0, &m_cb[NRFX_EGU0_INST_IDX]);
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
 #if NRFX_CHECK(NRFX_EGU1_ENABLED)
-void nrfx_egu_1_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_egu_1_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(egu_1);
     egu_irq_handler(NRF_EGU1, &m_cb[NRFX_EGU1_INST_IDX]);
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
 #if NRFX_CHECK(NRFX_EGU2_ENABLED)
-void nrfx_egu_2_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_egu_2_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(egu_2);
     egu_irq_handler(NRF_EGU2, &m_cb[NRFX_EGU2_INST_IDX]);
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
 #if NRFX_CHECK(NRFX_EGU3_ENABLED)
-void nrfx_egu_3_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_egu_3_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(egu_3);
     egu_irq_handler(NRF_EGU3, &m_cb[NRFX_EGU3_INST_IDX]);
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
 #if NRFX_CHECK(NRFX_EGU4_ENABLED)
-void nrfx_egu_4_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_egu_4_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(egu_4);
     egu_irq_handler(NRF_EGU4, &m_cb[NRFX_EGU4_INST_IDX]);
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
 #if NRFX_CHECK(NRFX_EGU5_ENABLED)
-void nrfx_egu_5_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_egu_5_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(egu_5);
     egu_irq_handler(NRF_EGU5, &m_cb[NRFX_EGU5_INST_IDX]);
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
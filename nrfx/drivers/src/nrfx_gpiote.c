@@ -35,7 +35,11 @@
 #if NRFX_CHECK(NRFX_GPIOTE_ENABLED)
 
 #include <nrfx_gpiote.h>
+#include <helpers/nrfx_prof.h>
 #include <helpers/nrfx_flag32_allocator.h>
+#if defined(PPI_PRESENT) || defined(DPPI_PRESENT)
+#include <helpers/nrfx_gppi.h>
+#endif
 #include "nrf_bitmask.h"
 #include <string.h>
 
@@ -58,6 +62,15 @@
         (GPIOTE_CH_NUM + NRFX_GPIOTE_CONFIG_NUM_OF_LOW_POWER_EVENTS)
 #endif
 
+/* Number of task endpoints that a single (D)PPI channel can drive. */
+#if defined(DPPI_PRESENT)
+#define ROUTE_ENDPOINTS_SUPPORTED NRFX_GPIOTE_ROUTE_MAX_ENDPOINTS
+#elif defined(PPI_FEATURE_FORKS_PRESENT)
+#define ROUTE_ENDPOINTS_SUPPORTED NRFX_MIN(NRFX_GPIOTE_ROUTE_MAX_ENDPOINTS, 2)
+#else
+#define ROUTE_ENDPOINTS_SUPPORTED 1
+#endif
+
 /* Verify that trigger matches gpiote enum. */
 NRFX_STATIC_ASSERT(NRFX_GPIOTE_TRIGGER_LOTOHI == GPIOTE_CONFIG_POLARITY_LoToHi);
 NRFX_STATIC_ASSERT(NRFX_GPIOTE_TRIGGER_HITOLO == GPIOTE_CONFIG_POLARITY_HiToLo);
@@ -156,9 +169,16 @@ typedef struct
     /* Global handler called on each event */
     nrfx_gpiote_handler_config_t global_handler;
 
+    /* Handler called once per port with pins that fired in PORT event. */
+    nrfx_gpiote_port_handler_t   port_handler;
+    void *                       p_port_context;
+
     /* Each pin state */
     uint16_t                     pin_flags[MAX_PIN_NUMBER];
 
+    /* Latency class of each managed input pin increased by one, 0 for other pins. */
+    uint8_t                      managed_class[MAX_PIN_NUMBER];
+
     /* Mask for tracking gpiote channel allocation. */
     nrfx_atomic_t                available_channels_mask;
 
@@ -167,6 +187,14 @@ typedef struct
 
 #if !defined(NRF_GPIO_LATCH_PRESENT)
     uint32_t                     port_pins[GPIO_COUNT];
+
+    /* Pins with sensing configured by the driver for high and low level. */
+    uint32_t                     sense_high_pins[GPIO_COUNT];
+    uint32_t                     sense_low_pins[GPIO_COUNT];
+
+    /* Pins using sensing with high and low level trigger. */
+    uint32_t                     level_high_pins[GPIO_COUNT];
+    uint32_t                     level_low_pins[GPIO_COUNT];
 #endif
     nrfx_drv_state_t             state;
 } gpiote_control_block_t;
@@ -321,6 +349,8 @@ static void pin_handler_trigger_uninit(nrfx_gpiote_pin_t pin)
     {
 #if !defined(NRF_GPIO_LATCH_PRESENT)
         nrf_bitmask_bit_clear(pin, (uint8_t *)m_cb.port_pins);
+        nrf_bitmask_bit_clear(pin, (uint8_t *)m_cb.level_high_pins);
+        nrf_bitmask_bit_clear(pin, (uint8_t *)m_cb.level_low_pins);
 #endif
     }
 
@@ -412,6 +442,28 @@ static inline nrf_gpio_pin_sense_t get_initial_sense(nrfx_gpiote_pin_t pin)
     return sense;
 }
 
+/** @brief Function for configuring pin sensing and tracking it in the port masks.
+ *
+ * @param[in] pin   Absolute pin.
+ * @param[in] sense Sense level.
+ */
+static void pin_sense_set(nrfx_gpiote_pin_t pin, nrf_gpio_pin_sense_t sense)
+{
+    nrf_gpio_cfg_sense_set(pin, sense);
+#if !defined(NRF_GPIO_LATCH_PRESENT)
+    nrf_bitmask_bit_clear(pin, (uint8_t *)m_cb.sense_high_pins);
+    nrf_bitmask_bit_clear(pin, (uint8_t *)m_cb.sense_low_pins);
+    if (sense == NRF_GPIO_PIN_SENSE_HIGH)
+    {
+        nrf_bitmask_bit_set(pin, (uint8_t *)m_cb.sense_high_pins);
+    }
+    else if (sense == NRF_GPIO_PIN_SENSE_LOW)
+    {
+        nrf_bitmask_bit_set(pin, (uint8_t *)m_cb.sense_low_pins);
+    }
+#endif
+}
+
 nrfx_err_t nrfx_gpiote_input_configure(nrfx_gpiote_pin_t                    pin,
                                        nrfx_gpiote_input_config_t const *   p_input_config,
                                        nrfx_gpiote_trigger_config_t const * p_trigger_config,
@@ -479,6 +531,8 @@ nrfx_err_t nrfx_gpiote_input_configure(nrfx_gpiote_pin_t                    pin,
             }
         }
 #if !defined(NRF_GPIO_LATCH_PRESENT)
+        nrf_bitmask_bit_clear(pin, (uint8_t *)m_cb.level_high_pins);
+        nrf_bitmask_bit_clear(pin, (uint8_t *)m_cb.level_low_pins);
         if (use_evt || trigger == NRFX_GPIOTE_TRIGGER_NONE)
         {
             nrf_bitmask_bit_clear(pin, (uint8_t *)m_cb.port_pins);
@@ -486,6 +540,14 @@ nrfx_err_t nrfx_gpiote_input_configure(nrfx_gpiote_pin_t                    pin,
         else
         {
             nrf_bitmask_bit_set(pin, (uint8_t *)m_cb.port_pins);
+            if (trigger == NRFX_GPIOTE_TRIGGER_HIGH)
+            {
+                nrf_bitmask_bit_set(pin, (uint8_t *)m_cb.level_high_pins);
+            }
+            else if (trigger == NRFX_GPIOTE_TRIGGER_LOW)
+            {
+                nrf_bitmask_bit_set(pin, (uint8_t *)m_cb.level_low_pins);
+            }
         }
 #endif
         m_cb.pin_flags[pin] &= ~PIN_FLAG_TRIG_MODE_MASK;
@@ -560,6 +622,12 @@ void nrfx_gpiote_global_callback_set(nrfx_gpiote_interrupt_handler_t handler, vo
     m_cb.global_handler.p_context = p_context;
 }
 
+void nrfx_gpiote_port_callback_set(nrfx_gpiote_port_handler_t handler, void * p_context)
+{
+    m_cb.port_handler = handler;
+    m_cb.p_port_context = p_context;
+}
+
 nrfx_err_t nrfx_gpiote_channel_get(nrfx_gpiote_pin_t pin, uint8_t *p_channel)
 {
     NRFX_ASSERT(p_channel);
@@ -602,6 +670,7 @@ nrfx_err_t nrfx_gpiote_init(uint8_t interrupt_priority)
     }
 
     memset(m_cb.pin_flags, 0, sizeof(m_cb.pin_flags));
+    memset(m_cb.managed_class, 0, sizeof(m_cb.managed_class));
 
     NRFX_IRQ_PRIORITY_SET(nrfx_get_irq_number(NRF_GPIOTE), interrupt_priority);
     NRFX_IRQ_ENABLE(nrfx_get_irq_number(NRF_GPIOTE));
@@ -622,6 +691,7 @@ bool nrfx_gpiote_is_init(void)
     return (m_cb.state != NRFX_DRV_STATE_UNINITIALIZED) ? true : false;
 }
 
+static bool managed_input_release(nrfx_gpiote_pin_t pin);
 
 void nrfx_gpiote_uninit(void)
 {
@@ -633,7 +703,11 @@ void nrfx_gpiote_uninit(void)
     {
         if (nrf_gpio_pin_present_check(i) && pin_in_use(i))
         {
-            if (m_cb.pin_flags[i] & PIN_FLAG_LEGACY_API_PIN)
+            if (m_cb.managed_class[i])
+            {
+                (void)managed_input_release(i);
+            }
+            else if (m_cb.pin_flags[i] & PIN_FLAG_LEGACY_API_PIN)
             {
                 m_cb.pin_flags[i] &= ~PIN_FLAG_LEGACY_API_PIN;
                 if (pin_has_trigger(i))
@@ -1004,7 +1078,7 @@ void nrfx_gpiote_trigger_enable(nrfx_gpiote_pin_t pin, bool int_enable)
     else
     {
         NRFX_ASSERT(int_enable);
-        nrf_gpio_cfg_sense_set(pin, get_initial_sense(pin));
+        pin_sense_set(pin, get_initial_sense(pin));
     }
 }
 
@@ -1019,7 +1093,7 @@ void nrfx_gpiote_trigger_disable(nrfx_gpiote_pin_t pin)
     }
     else
     {
-        nrf_gpio_cfg_sense_set(pin, NRF_GPIO_PIN_NOSENSE);
+        pin_sense_set(pin, NRF_GPIO_PIN_NOSENSE);
     }
 }
 
@@ -1056,6 +1130,193 @@ void nrfx_gpiote_in_uninit(nrfx_gpiote_pin_t pin)
     (void)err;
 }
 
+/** @brief Function for uninitializing a managed input pin without rebalancing the other pins.
+ *
+ * @param[in] pin Absolute pin.
+ *
+ * @return True if the pin released a GPIOTE channel.
+ */
+static bool managed_input_release(nrfx_gpiote_pin_t pin)
+{
+    bool       channel_used = pin_in_use_by_te(pin);
+    uint8_t    ch           = pin_te_get(pin);
+    nrfx_err_t err;
+
+    m_cb.managed_class[pin] = 0;
+    err = nrfx_gpiote_pin_uninit(pin);
+    NRFX_ASSERT(err == NRFX_SUCCESS);
+
+    if (channel_used)
+    {
+        err = nrfx_gpiote_channel_free(ch);
+        NRFX_ASSERT(err == NRFX_SUCCESS);
+    }
+
+    (void)err;
+    return channel_used;
+}
+
+/** @brief Function for moving the trigger of a managed input pin.
+ *
+ * @param[in] pin         Absolute pin.
+ * @param[in] use_channel True to place the trigger on a GPIOTE channel, false to use sensing.
+ *
+ * @retval true  The trigger was moved.
+ * @retval false No channel could be allocated. The trigger uses sensing.
+ */
+static bool managed_input_move(nrfx_gpiote_pin_t pin, bool use_channel)
+{
+    nrfx_gpiote_trigger_config_t trigger_config = {
+        .trigger      = PIN_FLAG_TRIG_MODE_GET(m_cb.pin_flags[pin]),
+        .p_in_channel = NULL,
+    };
+    uint8_t    ch;
+    nrfx_err_t err;
+
+    if (use_channel)
+    {
+        if (nrfx_gpiote_channel_alloc(&ch) != NRFX_SUCCESS)
+        {
+            return false;
+        }
+        trigger_config.p_in_channel = &ch;
+    }
+
+    nrfx_gpiote_trigger_disable(pin);
+    if (pin_in_use_by_te(pin))
+    {
+        ch = pin_te_get(pin);
+        nrf_gpiote_te_default(NRF_GPIOTE, ch);
+        err = nrfx_gpiote_channel_free(ch);
+        NRFX_ASSERT(err == NRFX_SUCCESS);
+    }
+
+    err = nrfx_gpiote_input_configure(pin, NULL, &trigger_config, NULL);
+    NRFX_ASSERT(err == NRFX_SUCCESS);
+    (void)err;
+
+    nrfx_gpiote_trigger_enable(pin, true);
+
+    return true;
+}
+
+/** @brief Function for assigning the GPIOTE channels available to the driver to the managed
+ *         input pins of the most latency-critical classes.
+ */
+static void managed_inputs_rebalance(void)
+{
+    uint32_t desired[(MAX_PIN_NUMBER + 31) / 32] = {0};
+    uint32_t budget = 0;
+    uint32_t i;
+
+    /* Channels that can be used are the free ones and the ones held by managed pins. */
+    for (i = 0; i < GPIOTE_CH_NUM; i++)
+    {
+        if (m_cb.available_channels_mask & NRFX_BIT(i))
+        {
+            budget++;
+        }
+    }
+
+    for (i = 0; i < MAX_PIN_NUMBER; i++)
+    {
+        if (m_cb.managed_class[i] && pin_in_use_by_te(i))
+        {
+            budget++;
+        }
+    }
+
+    for (uint8_t cls = NRFX_GPIOTE_LATENCY_CLASS_CRITICAL;
+         (cls < NRFX_GPIOTE_LATENCY_CLASS_SENSE) && budget;
+         cls++)
+    {
+        for (i = 0; (i < MAX_PIN_NUMBER) && budget; i++)
+        {
+            if ((m_cb.managed_class[i] == cls + 1) &&
+                !is_level(PIN_FLAG_TRIG_MODE_GET(m_cb.pin_flags[i])))
+            {
+                nrf_bitmask_bit_set(i, (uint8_t *)desired);
+                budget--;
+            }
+        }
+    }
+
+    /* Release channels first, so that they can be taken by the promoted pins. */
+    for (i = 0; i < MAX_PIN_NUMBER; i++)
+    {
+        if (m_cb.managed_class[i] && pin_in_use_by_te(i) &&
+            !nrf_bitmask_bit_is_set(i, (uint8_t *)desired))
+        {
+            (void)managed_input_move(i, false);
+        }
+    }
+
+    for (i = 0; i < MAX_PIN_NUMBER; i++)
+    {
+        if (m_cb.managed_class[i] && !pin_in_use_by_te(i) &&
+            nrf_bitmask_bit_is_set(i, (uint8_t *)desired))
+        {
+            if (!managed_input_move(i, true))
+            {
+                /* Channels were allocated by the application in the meantime. */
+                break;
+            }
+        }
+    }
+}
+
+nrfx_err_t nrfx_gpiote_managed_input_init(nrfx_gpiote_pin_t                    pin,
+                                          nrfx_gpiote_input_config_t const *   p_input_config,
+                                          nrfx_gpiote_trigger_t                trigger,
+                                          nrfx_gpiote_handler_config_t const * p_handler_config,
+                                          nrfx_gpiote_latency_class_t          latency_class)
+{
+    NRFX_ASSERT(m_cb.state == NRFX_DRV_STATE_INITIALIZED);
+    NRFX_ASSERT(nrf_gpio_pin_present_check(pin));
+    NRFX_ASSERT(p_input_config);
+    NRFX_ASSERT(trigger != NRFX_GPIOTE_TRIGGER_NONE);
+    NRFX_ASSERT(latency_class < NRFX_GPIOTE_LATENCY_CLASS_MAX);
+
+    nrfx_gpiote_trigger_config_t const trigger_config = {
+        .trigger      = trigger,
+        .p_in_channel = NULL,
+    };
+    nrfx_err_t err;
+
+    if (pin_in_use(pin))
+    {
+        return NRFX_ERROR_BUSY;
+    }
+
+    /* The pin starts with sensing and is promoted to a channel by rebalancing. */
+    err = nrfx_gpiote_input_configure(pin, p_input_config, &trigger_config, p_handler_config);
+    if (err != NRFX_SUCCESS)
+    {
+        (void)nrfx_gpiote_pin_uninit(pin);
+        return err;
+    }
+
+    m_cb.managed_class[pin] = (uint8_t)latency_class + 1;
+    nrfx_gpiote_trigger_enable(pin, true);
+    managed_inputs_rebalance();
+
+    return NRFX_SUCCESS;
+}
+
+nrfx_err_t nrfx_gpiote_managed_input_uninit(nrfx_gpiote_pin_t pin)
+{
+    if (!m_cb.managed_class[pin])
+    {
+        return NRFX_ERROR_INVALID_PARAM;
+    }
+
+    if (managed_input_release(pin))
+    {
+        managed_inputs_rebalance();
+    }
+
+    return NRFX_SUCCESS;
+}
 
 bool nrfx_gpiote_in_is_set(nrfx_gpiote_pin_t pin)
 {
@@ -1085,6 +1346,240 @@ uint32_t nrfx_gpiote_in_event_addr_get(nrfx_gpiote_pin_t pin)
     return nrf_gpiote_event_address_get(NRF_GPIOTE, event);
 }
 
+#if defined(PPI_PRESENT) || defined(DPPI_PRESENT)
+/** @brief Function for connecting the route event endpoint to its task endpoints.
+ *
+ * @param[in,out] p_route Route with the event endpoint and task endpoints filled in.
+ *
+ * @return Result of (D)PPI channel allocation.
+ */
+static nrfx_err_t route_connect(nrfx_gpiote_route_t * p_route)
+{
+    nrfx_err_t err_code = nrfx_gppi_channel_alloc(&p_route->gppi_ch);
+    if (err_code != NRFX_SUCCESS)
+    {
+        return err_code;
+    }
+
+    nrfx_gppi_channel_endpoints_setup(p_route->gppi_ch, p_route->eep, p_route->teps[0]);
+#if defined(PPI_FEATURE_FORKS_PRESENT) || defined(DPPI_PRESENT)
+    for (uint8_t i = 1; i < p_route->tep_count; i++)
+    {
+        nrfx_gppi_fork_endpoint_setup(p_route->gppi_ch, p_route->teps[i]);
+    }
+#endif
+
+    return NRFX_SUCCESS;
+}
+
+/** @brief Function for releasing the pin and GPIOTE channel used by the route.
+ *
+ * @param[in] p_route Route.
+ */
+static void route_pin_release(nrfx_gpiote_route_t const * p_route)
+{
+    nrfx_err_t err_code;
+
+    err_code = nrfx_gpiote_pin_uninit(p_route->pin);
+    NRFX_ASSERT(err_code == NRFX_SUCCESS);
+    err_code = nrfx_gpiote_channel_free(p_route->gpiote_ch);
+    NRFX_ASSERT(err_code == NRFX_SUCCESS);
+    (void)err_code;
+}
+
+nrfx_err_t nrfx_gpiote_route_input_setup(nrfx_gpiote_route_t * p_route,
+                                         nrfx_gpiote_pin_t     pin,
+                                         nrfx_gpiote_trigger_t trigger,
+                                         nrf_gpio_pin_pull_t   pull,
+                                         uint32_t const *      p_teps,
+                                         uint8_t               tep_count)
+{
+    NRFX_ASSERT(p_route);
+    NRFX_ASSERT(p_teps);
+
+    nrfx_err_t err_code;
+
+    if ((trigger == NRFX_GPIOTE_TRIGGER_NONE) || is_level(trigger) ||
+        (tep_count == 0) || (tep_count > ROUTE_ENDPOINTS_SUPPORTED))
+    {
+        err_code = NRFX_ERROR_INVALID_PARAM;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    err_code = nrfx_gpiote_channel_alloc(&p_route->gpiote_ch);
+    if (err_code != NRFX_SUCCESS)
+    {
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    nrfx_gpiote_input_config_t   input_config   = { .pull = pull };
+    nrfx_gpiote_trigger_config_t trigger_config = {
+        .trigger      = trigger,
+        .p_in_channel = &p_route->gpiote_ch
+    };
+
+    p_route->pin      = pin;
+    p_route->is_input = true;
+    err_code = nrfx_gpiote_input_configure(pin, &input_config, &trigger_config, NULL);
+    if (err_code != NRFX_SUCCESS)
+    {
+        (void)nrfx_gpiote_channel_free(p_route->gpiote_ch);
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    p_route->eep       = nrfx_gpiote_in_event_addr_get(pin);
+    p_route->tep_count = tep_count;
+    for (uint8_t i = 0; i < tep_count; i++)
+    {
+        p_route->teps[i] = p_teps[i];
+    }
+
+    err_code = route_connect(p_route);
+    if (err_code != NRFX_SUCCESS)
+    {
+        route_pin_release(p_route);
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    return NRFX_SUCCESS;
+}
+
+nrfx_err_t nrfx_gpiote_route_output_setup(nrfx_gpiote_route_t * p_route,
+                                          nrfx_gpiote_pin_t     pin,
+                                          uint32_t              eep,
+                                          nrf_gpiote_polarity_t action,
+                                          nrf_gpiote_outinit_t  init_val,
+                                          uint32_t const *      p_teps,
+                                          uint8_t               tep_count)
+{
+    NRFX_ASSERT(p_route);
+    NRFX_ASSERT(eep);
+    NRFX_ASSERT(p_teps || (tep_count == 0));
+
+    nrfx_err_t err_code;
+
+    if ((action == NRF_GPIOTE_POLARITY_NONE) ||
+        (tep_count + 1 > ROUTE_ENDPOINTS_SUPPORTED))
+    {
+        err_code = NRFX_ERROR_INVALID_PARAM;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    err_code = nrfx_gpiote_channel_alloc(&p_route->gpiote_ch);
+    if (err_code != NRFX_SUCCESS)
+    {
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    nrfx_gpiote_output_config_t output_config = NRFX_GPIOTE_DEFAULT_OUTPUT_CONFIG;
+    nrfx_gpiote_task_config_t   task_config   = {
+        .task_ch  = p_route->gpiote_ch,
+        .polarity = action,
+        .init_val = init_val
+    };
+
+    p_route->pin      = pin;
+    p_route->is_input = false;
+    err_code = nrfx_gpiote_output_configure(pin, &output_config, &task_config);
+    if (err_code != NRFX_SUCCESS)
+    {
+        (void)nrfx_gpiote_channel_free(p_route->gpiote_ch);
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    p_route->eep       = eep;
+    p_route->teps[0]   = nrfx_gpiote_out_task_addr_get(pin);
+    p_route->tep_count = (uint8_t)(tep_count + 1);
+    for (uint8_t i = 0; i < tep_count; i++)
+    {
+        p_route->teps[i + 1] = p_teps[i];
+    }
+
+    err_code = route_connect(p_route);
+    if (err_code != NRFX_SUCCESS)
+    {
+        route_pin_release(p_route);
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    nrfx_gpiote_out_task_enable(pin);
+
+    return NRFX_SUCCESS;
+}
+
+void nrfx_gpiote_route_enable(nrfx_gpiote_route_t const * p_route)
+{
+    NRFX_ASSERT(p_route);
+
+    if (p_route->is_input)
+    {
+        nrfx_gpiote_trigger_enable(p_route->pin, false);
+    }
+    nrfx_gppi_channels_enable(NRFX_BIT(p_route->gppi_ch));
+}
+
+void nrfx_gpiote_route_disable(nrfx_gpiote_route_t const * p_route)
+{
+    NRFX_ASSERT(p_route);
+
+    nrfx_gppi_channels_disable(NRFX_BIT(p_route->gppi_ch));
+    if (p_route->is_input)
+    {
+        nrfx_gpiote_trigger_disable(p_route->pin);
+    }
+}
+
+void nrfx_gpiote_route_free(nrfx_gpiote_route_t * p_route)
+{
+    NRFX_ASSERT(p_route);
+
+    nrfx_gpiote_route_disable(p_route);
+
+    nrfx_gppi_event_endpoint_clear(p_route->gppi_ch, p_route->eep);
+    nrfx_gppi_task_endpoint_clear(p_route->gppi_ch, p_route->teps[0]);
+#if defined(PPI_FEATURE_FORKS_PRESENT) || defined(DPPI_PRESENT)
+    for (uint8_t i = 1; i < p_route->tep_count; i++)
+    {
+        nrfx_gppi_fork_endpoint_clear(p_route->gppi_ch, p_route->teps[i]);
+    }
+#endif
+    nrfx_err_t err_code = nrfx_gppi_channel_free(p_route->gppi_ch);
+    NRFX_ASSERT(err_code == NRFX_SUCCESS);
+    (void)err_code;
+
+    if (!p_route->is_input)
+    {
+        nrfx_gpiote_out_task_disable(p_route->pin);
+    }
+    route_pin_release(p_route);
+    p_route->tep_count = 0;
+}
+#endif // defined(PPI_PRESENT) || defined(DPPI_PRESENT)
+
 static void call_handler(nrfx_gpiote_pin_t pin, nrfx_gpiote_trigger_t trigger)
 {
     nrfx_gpiote_handler_config_t const * handler = channel_handler_get(pin);
@@ -1099,7 +1594,15 @@ static void call_handler(nrfx_gpiote_pin_t pin, nrfx_gpiote_trigger_t trigger)
     }
 }
 
-static void next_sense_cond_call_handler(nrfx_gpiote_pin_t     pin,
+/** @brief Function for re-arming sensing of the pin and calling handlers if needed.
+ *
+ * @param[in] pin     Absolute pin.
+ * @param[in] trigger Trigger configured for the pin.
+ * @param[in] sense   Sense level that caused the event.
+ *
+ * @return True if handlers were called for the pin.
+ */
+static bool next_sense_cond_call_handler(nrfx_gpiote_pin_t     pin,
                                          nrfx_gpiote_trigger_t trigger,
                                          nrf_gpio_pin_sense_t  sense)
 {
@@ -1113,6 +1616,7 @@ static void next_sense_cond_call_handler(nrfx_gpiote_pin_t     pin,
             nrf_gpio_cfg_sense_set(pin, NRF_GPIO_PIN_NOSENSE);
             nrf_gpio_cfg_sense_set(pin, sense);
         }
+        return true;
     }
     else
     {
@@ -1122,7 +1626,7 @@ static void next_sense_cond_call_handler(nrfx_gpiote_pin_t     pin,
         nrf_gpio_pin_sense_t next_sense = (sense == NRF_GPIO_PIN_SENSE_HIGH) ?
                 NRF_GPIO_PIN_SENSE_LOW : NRF_GPIO_PIN_SENSE_HIGH;
 
-        nrf_gpio_cfg_sense_set(pin, next_sense);
+        pin_sense_set(pin, next_sense);
 
         /* Invoke user handler only if the sensed pin level matches its polarity
          * configuration. Call handler unconditionally in case of toggle trigger or
@@ -1132,6 +1636,28 @@ static void next_sense_cond_call_handler(nrfx_gpiote_pin_t     pin,
             (sense == NRF_GPIO_PIN_SENSE_LOW && trigger == NRFX_GPIOTE_TRIGGER_HITOLO))
         {
             call_handler(pin, trigger);
+            return true;
+        }
+    }
+    return false;
+}
+
+/** @brief Function for calling the port handler for each port with fired pins.
+ *
+ * @param[in] fired Array of per-port bitmasks of pins for which handlers were called.
+ */
+static void port_handler_call(uint32_t const * fired)
+{
+    if (!m_cb.port_handler)
+    {
+        return;
+    }
+
+    for (uint32_t i = 0; i < GPIO_COUNT; i++)
+    {
+        if (fired[i])
+        {
+            m_cb.port_handler(i, fired[i], m_cb.p_port_context);
         }
     }
 }
@@ -1157,6 +1683,7 @@ static bool latch_pending_read_and_check(uint32_t * latch)
 static void port_event_handle(void)
 {
     uint32_t latch[GPIO_COUNT];
+    uint32_t fired[GPIO_COUNT] = {0};
 
     nrf_gpio_latches_read_and_clear(0, GPIO_COUNT, latch);
 
@@ -1175,7 +1702,10 @@ static void port_event_handle(void)
                 nrf_bitmask_bit_clear(pin, latch);
                 sense = nrf_gpio_pin_sense_get(pin);
 
-                next_sense_cond_call_handler(pin, trigger, sense);
+                if (next_sense_cond_call_handler(pin, trigger, sense))
+                {
+                    nrf_bitmask_bit_set(pin, fired);
+                }
                 /* Try to clear LATCH bit corresponding to currently processed pin.
                  * This may not succeed if the pin's state changed during the interrupt processing
                  * and now it matches the new sense configuration. In such case,
@@ -1188,6 +1718,8 @@ static void port_event_handle(void)
          * something came between deciding to exit and clearing PORT event. */
         nrf_gpiote_event_clear(NRF_GPIOTE, NRF_GPIOTE_EVENT_PORT);
     } while (latch_pending_read_and_check(latch));
+
+    port_handler_call(fired);
 }
 
 #else
@@ -1224,6 +1756,7 @@ static void port_event_handle(void)
 {
     uint32_t pins_to_check[GPIO_COUNT];
     uint32_t input[GPIO_COUNT] = {0};
+    uint32_t fired[GPIO_COUNT] = {0};
     uint8_t rel_pin;
     uint8_t pin;
     nrfx_gpiote_trigger_t trigger;
@@ -1238,25 +1771,27 @@ static void port_event_handle(void)
     do {
         for (uint32_t i = 0; i < GPIO_COUNT; i++)
         {
-            while (pins_to_check[i])
+            /* Process further only pins whose state matches their sense level. */
+            uint32_t pin_mask = pins_to_check[i] &
+                                ((input[i] & m_cb.sense_high_pins[i]) |
+                                 (~input[i] & m_cb.sense_low_pins[i]));
+
+            while (pin_mask)
             {
                 nrf_gpio_pin_sense_t sense;
-                bool pin_state;
 
-                rel_pin = NRF_CTZ(pins_to_check[i]);
-                pins_to_check[i] &= ~NRFX_BIT(rel_pin);
+                rel_pin = NRF_CTZ(pin_mask);
+                pin_mask &= ~NRFX_BIT(rel_pin);
                 /* Absolute */
                 pin = rel_pin + 32 * i;
 
                 trigger = PIN_FLAG_TRIG_MODE_GET(m_cb.pin_flags[pin]);
-                sense = nrf_gpio_pin_sense_get(pin);
-                pin_state = nrf_bitmask_bit_is_set(pin, input);
+                sense = (m_cb.sense_high_pins[i] & NRFX_BIT(rel_pin)) ?
+                        NRF_GPIO_PIN_SENSE_HIGH : NRF_GPIO_PIN_SENSE_LOW;
 
-                /* Process pin further only if its state matches its sense level. */
-                if ((pin_state && (sense == NRF_GPIO_PIN_SENSE_HIGH)) ||
-                    (!pin_state && (sense == NRF_GPIO_PIN_SENSE_LOW)) )
+                if (next_sense_cond_call_handler(pin, trigger, sense))
                 {
-                    next_sense_cond_call_handler(pin, trigger, sense);
+                    fired[i] |= NRFX_BIT(rel_pin);
                 }
             }
         }
@@ -1273,30 +1808,17 @@ static void port_event_handle(void)
          * it will be set in pins_to_check. */
         for (uint32_t i = 0; i < GPIO_COUNT; i++)
         {
-            uint32_t pin_mask = pins_to_check[i];
+            uint32_t sensed = pins_to_check[i] &
+                              (m_cb.sense_high_pins[i] | m_cb.sense_low_pins[i]);
 
-            while (pin_mask)
-            {
-                rel_pin = NRF_CTZ(pin_mask);
-                pin_mask &= ~NRFX_BIT(rel_pin);
-                pin = rel_pin + 32 * i;
-                if (nrf_gpio_pin_sense_get(pin) != NRF_GPIO_PIN_NOSENSE)
-                {
-                    trigger = PIN_FLAG_TRIG_MODE_GET(m_cb.pin_flags[pin]);
-                    if (trigger == NRFX_GPIOTE_TRIGGER_HIGH)
-                    {
-                        input[i] &= ~NRFX_BIT(rel_pin);
-                    }
-                    else if (trigger == NRFX_GPIOTE_TRIGGER_LOW)
-                    {
-                        input[i] |= NRFX_BIT(rel_pin);
-                    }
-                }
-            }
+            input[i] &= ~(sensed & m_cb.level_high_pins[i]);
+            input[i] |= (sensed & m_cb.level_low_pins[i]);
         }
 
         nrf_gpiote_event_clear(NRF_GPIOTE, NRF_GPIOTE_EVENT_PORT);
     } while (input_read_and_check(input, pins_to_check));
+
+    port_handler_call(fired);
 }
 #endif // defined(NRF_GPIO_LATCH_PRESENT)
 
@@ -1313,8 +1835,9 @@ static void gpiote_evt_handle(uint32_t mask)
     }
 }
 
-void nrfx_gpiote_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_gpiote_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(gpiote);
     uint32_t status = 0;
     uint32_t i;
     nrf_gpiote_event_t event = NRF_GPIOTE_EVENT_IN_0;
@@ -1343,6 +1866,7 @@ void nrfx_gpiote_irq_handler(void)
 
     /* Process pin events. */
     gpiote_evt_handle(status);
+    NRFX_PROF_IRQ_EXIT();
 }
 
 #endif // NRFX_CHECK(NRFX_GPIOTE_ENABLED)
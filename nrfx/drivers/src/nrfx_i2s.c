@@ -36,7 +36,9 @@
 #if NRFX_CHECK(NRFX_I2S_ENABLED)
 
 #include <nrfx_i2s.h>
+#include <helpers/nrfx_prof.h>
 #include <hal/nrf_gpio.h>
+#include <string.h>
 
 #define NRFX_LOG_MODULE I2S
 #include <nrfx_log.h>
@@ -83,8 +85,15 @@ typedef struct
     bool skip_psel_cfg  : 1;
 
     uint16_t            buffer_size;
+    uint8_t             sample_bits;   // Width of samples in the buffers.
+    uint8_t             channel_count; // Number of samples in a frame.
     nrfx_i2s_buffers_t  next_buffers;
     nrfx_i2s_buffers_t  current_buffers;
+
+    nrfx_i2s_ring_t *   p_ring;       // Ring of buffers, NULL if not in ring mode.
+    uint32_t            ring_active;  // Index of the ring entry used by the peripheral.
+    uint32_t            ring_pending; // Index of the ring entry set as the next one.
+    bool                ring_started; // True if the peripheral started using the ring.
 } i2s_control_block_t;
 static i2s_control_block_t m_cb;
 
@@ -184,6 +193,37 @@ static void deconfigure_pins(void)
     }
 }
 
+static uint8_t sample_bits_get(nrf_i2s_swidth_t sample_width)
+{
+    switch (sample_width)
+    {
+        case NRF_I2S_SWIDTH_8BIT:
+#if defined(I2S_CONFIG_SWIDTH_SWIDTH_8BitIn16)
+        case NRF_I2S_SWIDTH_8BIT_IN16BIT:
+#endif
+#if defined(I2S_CONFIG_SWIDTH_SWIDTH_8BitIn32)
+        case NRF_I2S_SWIDTH_8BIT_IN32BIT:
+#endif
+            return 8;
+
+        case NRF_I2S_SWIDTH_16BIT:
+#if defined(I2S_CONFIG_SWIDTH_SWIDTH_16BitIn32)
+        case NRF_I2S_SWIDTH_16BIT_IN32BIT:
+#endif
+            return 16;
+
+#if defined(I2S_CONFIG_SWIDTH_SWIDTH_32Bit)
+        case NRF_I2S_SWIDTH_32BIT:
+            return 32;
+#endif
+
+        default:
+            // 24-bit samples occupy the lower three bytes of a word.
+            return 24;
+    }
+}
+
+
 nrfx_err_t nrfx_i2s_init(nrfx_i2s_config_t const * p_config,
                          nrfx_i2s_data_handler_t   handler)
 {
@@ -226,6 +266,8 @@ nrfx_err_t nrfx_i2s_init(nrfx_i2s_config_t const * p_config,
     m_cb.skip_gpio_cfg = p_config->skip_gpio_cfg;
     m_cb.skip_psel_cfg = p_config->skip_psel_cfg;
     m_cb.handler = handler;
+    m_cb.sample_bits = sample_bits_get(p_config->sample_width);
+    m_cb.channel_count = (p_config->channels == NRF_I2S_CHANNELS_STEREO) ? 2 : 1;
 
     NRFX_IRQ_PRIORITY_SET(nrfx_get_irq_number(NRF_I2S0), p_config->irq_priority);
     NRFX_IRQ_ENABLE(nrfx_get_irq_number(NRF_I2S0));
@@ -400,6 +442,314 @@ nrfx_err_t nrfx_i2s_next_buffers_set(nrfx_i2s_buffers_t const * p_buffers)
 }
 
 
+void nrfx_i2s_ring_init(nrfx_i2s_ring_t *          p_ring,
+                        nrfx_i2s_buffers_t const * p_buffers,
+                        uint16_t                   count)
+{
+    NRFX_ASSERT(p_ring);
+    NRFX_ASSERT(p_buffers);
+    NRFX_ASSERT(count >= 3);
+
+    p_ring->p_buffers = p_buffers;
+    p_ring->count     = count;
+    p_ring->produced  = 0;
+    p_ring->consumed  = 0;
+    p_ring->released  = 0;
+}
+
+
+nrfx_err_t nrfx_i2s_ring_start(nrfx_i2s_ring_t * p_ring,
+                               uint16_t          buffer_size,
+                               uint8_t           flags)
+{
+    NRFX_ASSERT(p_ring);
+    NRFX_ASSERT(p_ring->count >= 3);
+
+    nrfx_err_t err_code;
+
+    if ((m_cb.state != NRFX_DRV_STATE_INITIALIZED) ||
+        ((p_ring->p_buffers[0].p_tx_buffer != NULL) && (p_ring->produced == 0)))
+    {
+        err_code = NRFX_ERROR_INVALID_STATE;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    // The ring must be set before the transfer is started, as the first
+    // interrupt occurs right after the START task is triggered.
+    p_ring->released  = 0;
+    m_cb.p_ring       = p_ring;
+    m_cb.ring_active  = 0;
+    m_cb.ring_pending = 0;
+    m_cb.ring_started = false;
+
+    err_code = nrfx_i2s_start(&p_ring->p_buffers[0], buffer_size, flags);
+    if (err_code != NRFX_SUCCESS)
+    {
+        m_cb.p_ring = NULL;
+    }
+    return err_code;
+}
+
+
+nrfx_i2s_buffers_t const * nrfx_i2s_ring_tx_get(nrfx_i2s_ring_t const * p_ring)
+{
+    NRFX_ASSERT(p_ring);
+
+    uint32_t produced = p_ring->produced;
+    if (produced >= p_ring->released + p_ring->count)
+    {
+        return NULL;
+    }
+    return &p_ring->p_buffers[produced % p_ring->count];
+}
+
+
+void nrfx_i2s_ring_tx_commit(nrfx_i2s_ring_t * p_ring)
+{
+    NRFX_ASSERT(p_ring);
+    NRFX_ASSERT(p_ring->produced < p_ring->released + p_ring->count);
+
+    p_ring->produced++;
+}
+
+
+nrfx_i2s_buffers_t const * nrfx_i2s_ring_rx_get(nrfx_i2s_ring_t const * p_ring)
+{
+    NRFX_ASSERT(p_ring);
+
+    uint32_t consumed = p_ring->consumed;
+    if (consumed >= p_ring->released)
+    {
+        return NULL;
+    }
+    return &p_ring->p_buffers[consumed % p_ring->count];
+}
+
+
+void nrfx_i2s_ring_rx_release(nrfx_i2s_ring_t * p_ring)
+{
+    NRFX_ASSERT(p_ring);
+    NRFX_ASSERT(p_ring->consumed < p_ring->released);
+
+    p_ring->consumed++;
+}
+
+
+uint32_t nrfx_i2s_pcm_frames_get(uint16_t buffer_size)
+{
+    NRFX_ASSERT(m_cb.state != NRFX_DRV_STATE_UNINITIALIZED);
+
+    uint32_t samples_per_word = (m_cb.sample_bits <= 16) ? (32 / m_cb.sample_bits) : 1;
+    return (buffer_size * samples_per_word) / m_cb.channel_count;
+}
+
+
+static void pack_s32_to_16bit(uint32_t * p_dst, int32_t const * p_src, uint32_t count)
+{
+    uint32_t i = 0;
+
+    for (; i + 1 < count; i += 2)
+    {
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+        // Merge the upper halfwords of both samples in a single instruction.
+        *p_dst++ = __PKHTB((uint32_t)p_src[i + 1], (uint32_t)p_src[i], 16);
+#else
+        *p_dst++ = ((uint32_t)p_src[i] >> 16) | ((uint32_t)p_src[i + 1] & 0xFFFF0000UL);
+#endif
+    }
+    if (i < count)
+    {
+        *p_dst = (uint32_t)p_src[i] >> 16;
+    }
+}
+
+
+static void unpack_32bit_to_s16(int16_t * p_dst, uint32_t const * p_src, uint32_t count)
+{
+    uint8_t  shift = (uint8_t)(32 - m_cb.sample_bits);
+    uint32_t i     = 0;
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+    if (nrfx_is_word_aligned(p_dst))
+    {
+        uint32_t * p_pair = (uint32_t *)p_dst;
+
+        // Merge the upper halfwords of two left-aligned samples in a single instruction.
+        for (; i + 1 < count; i += 2)
+        {
+            *p_pair++ = __PKHTB(p_src[i + 1] << shift, p_src[i] << shift, 16);
+        }
+    }
+#endif
+    for (; i < count; i++)
+    {
+        p_dst[i] = (int16_t)((int32_t)(p_src[i] << shift) >> 16);
+    }
+}
+
+
+uint32_t nrfx_i2s_pcm_pack(uint32_t *            p_dst,
+                           void const *          p_src,
+                           nrfx_i2s_pcm_format_t format,
+                           uint32_t              frames)
+{
+    NRFX_ASSERT(m_cb.state != NRFX_DRV_STATE_UNINITIALIZED);
+    NRFX_ASSERT(p_dst);
+    NRFX_ASSERT(p_src);
+
+    int16_t const * p_s16 = (int16_t const *)p_src;
+    int32_t const * p_s32 = (int32_t const *)p_src;
+    uint32_t        count = frames * m_cb.channel_count;
+
+    if (m_cb.sample_bits == 8)
+    {
+        int8_t * p_s8 = (int8_t *)p_dst;
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            p_s8[i] = (format == NRFX_I2S_PCM_S16) ? (int8_t)(p_s16[i] >> 8) :
+                                                     (int8_t)(p_s32[i] >> 24);
+        }
+        return NRFX_CEIL_DIV(count, 4);
+    }
+
+    if (m_cb.sample_bits == 16)
+    {
+        if (format == NRFX_I2S_PCM_S16)
+        {
+            // Interleaved 16-bit samples already have the layout of the I2S buffer.
+            memcpy(p_dst, p_s16, count * sizeof(int16_t));
+        }
+        else
+        {
+            pack_s32_to_16bit(p_dst, p_s32, count);
+        }
+        return NRFX_CEIL_DIV(count, 2);
+    }
+
+    uint8_t shift = (uint8_t)(32 - m_cb.sample_bits);
+    if (format == NRFX_I2S_PCM_S16)
+    {
+        for (uint32_t i = 0; i < count; i++)
+        {
+            p_dst[i] = (uint32_t)p_s16[i] << (16 - shift);
+        }
+    }
+    else
+    {
+        for (uint32_t i = 0; i < count; i++)
+        {
+            p_dst[i] = (uint32_t)(p_s32[i] >> shift);
+        }
+    }
+    return count;
+}
+
+
+uint32_t nrfx_i2s_pcm_unpack(void *                p_dst,
+                             uint32_t const *      p_src,
+                             nrfx_i2s_pcm_format_t format,
+                             uint32_t              frames)
+{
+    NRFX_ASSERT(m_cb.state != NRFX_DRV_STATE_UNINITIALIZED);
+    NRFX_ASSERT(p_dst);
+    NRFX_ASSERT(p_src);
+
+    int16_t * p_s16 = (int16_t *)p_dst;
+    int32_t * p_s32 = (int32_t *)p_dst;
+    uint32_t  count = frames * m_cb.channel_count;
+
+    if (m_cb.sample_bits == 8)
+    {
+        int8_t const * p_s8 = (int8_t const *)p_src;
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            if (format == NRFX_I2S_PCM_S16)
+            {
+                p_s16[i] = (int16_t)(p_s8[i] * 0x100);
+            }
+            else
+            {
+                p_s32[i] = (int32_t)p_s8[i] * 0x1000000;
+            }
+        }
+        return NRFX_CEIL_DIV(count, 4);
+    }
+
+    if (m_cb.sample_bits == 16)
+    {
+        if (format == NRFX_I2S_PCM_S16)
+        {
+            memcpy(p_s16, p_src, count * sizeof(int16_t));
+        }
+        else
+        {
+            for (uint32_t i = 0; i < count; i++)
+            {
+                uint32_t word = p_src[i / 2];
+                p_s32[i] = (int32_t)((i & 1) ? (word & 0xFFFF0000UL) : (word << 16));
+            }
+        }
+        return NRFX_CEIL_DIV(count, 2);
+    }
+
+    if (format == NRFX_I2S_PCM_S16)
+    {
+        unpack_32bit_to_s16(p_s16, p_src, count);
+    }
+    else
+    {
+        uint8_t shift = (uint8_t)(32 - m_cb.sample_bits);
+        for (uint32_t i = 0; i < count; i++)
+        {
+            p_s32[i] = (int32_t)(p_src[i] << shift);
+        }
+    }
+    return count;
+}
+
+
+nrfx_err_t nrfx_i2s_ring_tx_pack(nrfx_i2s_ring_t *     p_ring,
+                                 void const *          p_src,
+                                 nrfx_i2s_pcm_format_t format,
+                                 uint32_t              frames)
+{
+    nrfx_i2s_buffers_t const * p_entry = nrfx_i2s_ring_tx_get(p_ring);
+    if (!p_entry)
+    {
+        return NRFX_ERROR_NO_MEM;
+    }
+    NRFX_ASSERT(p_entry->p_tx_buffer);
+
+    // The application owns the TX buffers of the ring, so they can be written here.
+    (void)nrfx_i2s_pcm_pack((uint32_t *)p_entry->p_tx_buffer, p_src, format, frames);
+    nrfx_i2s_ring_tx_commit(p_ring);
+    return NRFX_SUCCESS;
+}
+
+
+nrfx_err_t nrfx_i2s_ring_rx_unpack(nrfx_i2s_ring_t *     p_ring,
+                                   void *                p_dst,
+                                   nrfx_i2s_pcm_format_t format,
+                                   uint32_t              frames)
+{
+    nrfx_i2s_buffers_t const * p_entry = nrfx_i2s_ring_rx_get(p_ring);
+    if (!p_entry)
+    {
+        return NRFX_ERROR_BUSY;
+    }
+    NRFX_ASSERT(p_entry->p_rx_buffer);
+
+    (void)nrfx_i2s_pcm_unpack(p_dst, p_entry->p_rx_buffer, format, frames);
+    nrfx_i2s_ring_rx_release(p_ring);
+    return NRFX_SUCCESS;
+}
+
+
 void nrfx_i2s_stop(void)
 {
     NRFX_ASSERT(m_cb.state != NRFX_DRV_STATE_UNINITIALIZED);
@@ -419,8 +769,64 @@ void nrfx_i2s_stop(void)
 }
 
 
-void nrfx_i2s_irq_handler(void)
+static void ring_buffers_update(void)
+{
+    nrfx_i2s_ring_t *          p_ring     = m_cb.p_ring;
+    nrfx_i2s_buffers_t const * p_released = NULL;
+    uint32_t                   status     = 0;
+
+    // The peripheral has just started using the entry set as the next one,
+    // so the entry used so far is completed, unless it is used once more.
+    if (m_cb.ring_started && (m_cb.ring_active != m_cb.ring_pending))
+    {
+        p_released = &p_ring->p_buffers[m_cb.ring_active % p_ring->count];
+        p_ring->released = m_cb.ring_active + 1;
+    }
+    m_cb.ring_active  = m_cb.ring_pending;
+    m_cb.ring_started = true;
+
+    uint32_t next = m_cb.ring_active + 1;
+    if (m_cb.use_tx && (next >= p_ring->produced))
+    {
+        status |= NRFX_I2S_STATUS_RING_UNDERRUN;
+    }
+    if (m_cb.use_rx && (next >= p_ring->consumed + p_ring->count))
+    {
+        status |= NRFX_I2S_STATUS_RING_OVERRUN;
+    }
+
+    m_cb.current_buffers = p_ring->p_buffers[m_cb.ring_active % p_ring->count];
+    if (status == 0)
+    {
+        nrfx_i2s_buffers_t const * p_next = &p_ring->p_buffers[next % p_ring->count];
+        if (m_cb.use_tx)
+        {
+            nrf_i2s_tx_buffer_set(NRF_I2S0, p_next->p_tx_buffer);
+        }
+        if (m_cb.use_rx)
+        {
+            nrf_i2s_rx_buffer_set(NRF_I2S0, p_next->p_rx_buffer);
+        }
+        m_cb.next_buffers = *p_next;
+        m_cb.ring_pending = next;
+    }
+    else
+    {
+        // Registers are left unchanged, so the current buffers are used again.
+        m_cb.next_buffers.p_rx_buffer = NULL;
+        m_cb.next_buffers.p_tx_buffer = NULL;
+    }
+
+    if ((p_released != NULL) || (status != 0))
+    {
+        m_cb.handler(p_released, status);
+    }
+}
+
+
+NRFX_IRQ_HANDLER_ATTR void nrfx_i2s_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(i2s);
     if (nrf_i2s_event_check(NRF_I2S0, NRF_I2S_EVENT_TXPTRUPD))
     {
         nrf_i2s_event_clear(NRF_I2S0, NRF_I2S_EVENT_TXPTRUPD);
@@ -456,6 +862,7 @@ void nrfx_i2s_irq_handler(void)
         // the flag signaling that the transfer has finished, so that it is
         // possible to start a new transfer directly from the handler function.
         m_cb.state = NRFX_DRV_STATE_INITIALIZED;
+        m_cb.p_ring = NULL;
         NRFX_LOG_INFO("Stopped.");
 
         m_cb.handler(&m_cb.next_buffers, NRFX_I2S_STATUS_TRANSFER_STOPPED);
@@ -473,12 +880,16 @@ void nrfx_i2s_irq_handler(void)
             m_cb.tx_ready = false;
             m_cb.rx_ready = false;
 
+            if (m_cb.p_ring)
+            {
+                ring_buffers_update();
+            }
             // If the application did not supply the buffers for the next
             // part of the transfer until this moment, the current buffers
             // cannot be released, since the I2S peripheral already started
             // using them. Signal this situation to the application by
             // passing NULL instead of the structure with released buffers.
-            if (m_cb.buffers_reused)
+            else if (m_cb.buffers_reused)
             {
                 m_cb.buffers_reused = false;
                 // This will most likely be set at this point. However, there is
@@ -507,6 +918,7 @@ void nrfx_i2s_irq_handler(void)
 
         }
     }
+    NRFX_PROF_IRQ_EXIT();
 }
 
 #endif // NRFX_CHECK(NRFX_I2S_ENABLED)
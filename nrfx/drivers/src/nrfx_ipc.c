@@ -36,6 +36,8 @@
 #if NRFX_CHECK(NRFX_IPC_ENABLED)
 
 #include <nrfx_ipc.h>
+#include <helpers/nrfx_prof.h>
+#include <string.h>
 
 // Control block - driver instance local data.
 typedef struct
@@ -142,8 +144,116 @@ void nrfx_ipc_send_task_channel_assign(uint8_t send_index, uint8_t channel_index
     nrf_ipc_send_config_set(NRF_IPC, send_index, channel_bitmask);
 }
 
-void nrfx_ipc_irq_handler(void)
+static uint32_t * ipc_ring_slot_get(nrfx_ipc_ring_shm_t * p_shm, uint32_t index)
 {
+    uint32_t stride = sizeof(uint32_t) + p_shm->slot_size;
+    uint8_t * p_slots = (uint8_t *)(p_shm + 1);
+
+    return (uint32_t *)&p_slots[(index & (p_shm->slot_count - 1UL)) * stride];
+}
+
+void nrfx_ipc_ring_shm_init(void * p_shm, uint16_t slot_size, uint16_t slot_count)
+{
+    NRFX_ASSERT(p_shm);
+    NRFX_ASSERT(nrfx_is_word_aligned(p_shm));
+    NRFX_ASSERT((slot_size % sizeof(uint32_t)) == 0);
+    NRFX_ASSERT(slot_count && ((slot_count & (slot_count - 1)) == 0));
+
+    nrfx_ipc_ring_shm_t * p_hdr = (nrfx_ipc_ring_shm_t *)p_shm;
+    p_hdr->wr_idx     = 0;
+    p_hdr->rd_idx     = 0;
+    p_hdr->slot_size  = slot_size;
+    p_hdr->slot_count = slot_count;
+    __DMB();
+}
+
+void nrfx_ipc_ring_init(nrfx_ipc_ring_t * p_ring,
+                        void *            p_shm,
+                        uint8_t           send_index,
+                        bool              coalesce)
+{
+    NRFX_ASSERT(p_ring);
+    NRFX_ASSERT(p_shm);
+    NRFX_ASSERT(send_index < IPC_CONF_NUM);
+
+    p_ring->p_shm      = (nrfx_ipc_ring_shm_t *)p_shm;
+    p_ring->send_index = send_index;
+    p_ring->coalesce   = coalesce;
+}
+
+nrfx_err_t nrfx_ipc_ring_send(nrfx_ipc_ring_t * p_ring, void const * p_data, uint16_t length)
+{
+    NRFX_ASSERT(p_ring);
+    NRFX_ASSERT(p_data || (length == 0));
+
+    nrfx_ipc_ring_shm_t * p_shm = p_ring->p_shm;
+
+    if (length > p_shm->slot_size)
+    {
+        return NRFX_ERROR_INVALID_LENGTH;
+    }
+
+    uint32_t wr_idx = p_shm->wr_idx;
+    if ((wr_idx - p_shm->rd_idx) >= p_shm->slot_count)
+    {
+        return NRFX_ERROR_NO_MEM;
+    }
+
+    uint32_t * p_slot = ipc_ring_slot_get(p_shm, wr_idx);
+    p_slot[0] = length;
+    memcpy(&p_slot[1], p_data, length);
+
+    // The message must be visible to the other core before the index is,
+    // and the index must be published before the consumer index is checked,
+    // so that either the consumer sees the new message or the producer sees
+    // the ring drained.
+    __DMB();
+    p_shm->wr_idx = wr_idx + 1;
+    __DMB();
+
+    if (!p_ring->coalesce || (p_shm->rd_idx == wr_idx))
+    {
+        nrfx_ipc_signal(p_ring->send_index);
+    }
+
+    return NRFX_SUCCESS;
+}
+
+bool nrfx_ipc_ring_recv(nrfx_ipc_ring_t * p_ring, void * p_data, uint16_t * p_length)
+{
+    NRFX_ASSERT(p_ring);
+    NRFX_ASSERT(p_data);
+    NRFX_ASSERT(p_length);
+
+    nrfx_ipc_ring_shm_t * p_shm = p_ring->p_shm;
+
+    uint32_t rd_idx = p_shm->rd_idx;
+    if (rd_idx == p_shm->wr_idx)
+    {
+        return false;
+    }
+
+    // Do not read the message before its index is observed.
+    __DMB();
+
+    uint32_t const * p_slot = ipc_ring_slot_get(p_shm, rd_idx);
+    uint32_t length = p_slot[0];
+    NRFX_ASSERT(length <= p_shm->slot_size);
+    memcpy(p_data, &p_slot[1], length);
+    *p_length = (uint16_t)length;
+
+    // The slot must be read completely before it is handed back to the producer,
+    // and the consumer index must be published before the producer index is checked again.
+    __DMB();
+    p_shm->rd_idx = rd_idx + 1;
+    __DMB();
+
+    return true;
+}
+
+NRFX_IRQ_HANDLER_ATTR void nrfx_ipc_irq_handler(void)
+{
+    NRFX_PROF_IRQ_ENTER(ipc);
     // Get the information about events that fire this interrupt
     uint32_t events_map = nrf_ipc_int_pending_get(NRF_IPC);
     // Clear these events
@@ -166,6 +276,7 @@ void nrfx_ipc_irq_handler(void)
         m_ipc_cb.handler(events_map, m_ipc_cb.p_context);
 #endif
     }
+    NRFX_PROF_IRQ_EXIT();
 }
 
 #endif // NRFX_CHECK(NRFX_IPC_ENABLED)
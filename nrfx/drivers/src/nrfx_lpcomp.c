@@ -36,6 +36,7 @@
 #if NRFX_CHECK(NRFX_LPCOMP_ENABLED)
 
 #include <nrfx_lpcomp.h>
+#include <helpers/nrfx_prof.h>
 #include "prs/nrfx_prs.h"
 
 #define NRFX_LOG_MODULE LPCOMP
@@ -64,12 +65,14 @@ static void lpcomp_execute_handler(nrf_lpcomp_event_t event, uint32_t event_mask
     }
 }
 
-void nrfx_lpcomp_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_lpcomp_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(lpcomp);
     lpcomp_execute_handler(NRF_LPCOMP_EVENT_READY, NRF_LPCOMP_INT_READY_MASK);
     lpcomp_execute_handler(NRF_LPCOMP_EVENT_DOWN,  NRF_LPCOMP_INT_DOWN_MASK);
     lpcomp_execute_handler(NRF_LPCOMP_EVENT_UP,    NRF_LPCOMP_INT_UP_MASK);
     lpcomp_execute_handler(NRF_LPCOMP_EVENT_CROSS, NRF_LPCOMP_INT_CROSS_MASK);
+    NRFX_PROF_IRQ_EXIT();
 }
 
 nrfx_err_t nrfx_lpcomp_init(nrfx_lpcomp_config_t const * p_config,
@@ -36,6 +36,8 @@
 #if NRFX_CHECK(NRFX_NFCT_ENABLED)
 
 #include <nrfx_nfct.h>
+#include <helpers/nrfx_prof.h>
+#include <string.h>
 
 #define NRFX_LOG_MODULE NFCT
 #include <nrfx_log.h>
@@ -113,6 +115,19 @@ static nrfx_nfct_timer_workaround_t m_timer_workaround =
 #endif
 
 /* Macros for conversion of bits to bytes. */
+/* Interrupts required by the automatic response mode. */
+#define NRFX_NFCT_AUTORSP_INT_MASK (NRF_NFCT_INT_RXFRAMEEND_MASK | \
+                                    NRF_NFCT_INT_TXFRAMEEND_MASK)
+
+/* ISO-DEP I-block PCB without chaining, CID, and NAD, with the block number masked. */
+#define NRFX_NFCT_ISODEP_PCB_I_BLOCK      0x02
+#define NRFX_NFCT_ISODEP_PCB_I_BLOCK_MASK 0xFE
+
+/* READ BINARY command of the ISO/IEC 7816-4 standard: CLA INS P1 P2 Le. */
+#define NRFX_NFCT_APDU_READ_BINARY_INS  0xB0
+#define NRFX_NFCT_APDU_READ_BINARY_SIZE 5
+#define NRFX_NFCT_APDU_SW_SIZE          2
+
 #define NRFX_NFCT_BYTES_TO_BITS(_bytes) ((_bytes) << 3)
 #define NRFX_NFCT_BITS_TO_BYTES(_bits)  ((_bits)  >> 3)
 
@@ -144,6 +159,11 @@ typedef struct
     volatile bool      field_on;
     uint32_t           frame_delay_max;
     uint32_t           frame_delay_min;
+
+    nrfx_nfct_data_desc_t                      rx_data;        /**< Buffer passed most recently to @ref nrfx_nfct_rx. */
+    nrfx_nfct_autorsp_config_t const * volatile p_autorsp;     /**< Automatic response configuration, NULL if the mode is inactive. */
+    volatile bool                              autorsp_tx;     /**< Automatic response is being transmitted. */
+    uint32_t                                   autorsp_count;  /**< Number of frames answered automatically. */
 } nrfx_nfct_control_block_t;
 
 static nrfx_nfct_control_block_t m_nfct_cb;
@@ -417,7 +437,122 @@ nrf_nfct_sensres_nfcid1_size_t nrf_nfct_nfcid1_size_to_sensres_size(uint8_t nfci
 
 static inline void nrfx_nfct_rxtx_int_enable(uint32_t rxtx_int_mask)
 {
-    nrf_nfct_int_enable(NRF_NFCT, rxtx_int_mask & m_nfct_cb.config.rxtx_int_mask);
+    uint32_t enabled_mask = m_nfct_cb.config.rxtx_int_mask;
+
+    if (m_nfct_cb.p_autorsp != NULL)
+    {
+        enabled_mask |= NRFX_NFCT_AUTORSP_INT_MASK;
+    }
+    nrf_nfct_int_enable(NRF_NFCT, rxtx_int_mask & enabled_mask);
+}
+
+/**
+ * @brief Function for assembling the response to the READ BINARY command.
+ *
+ * @param[in]  p_config Pointer to the automatic response configuration.
+ * @param[in]  p_apdu   Pointer to the command APDU.
+ * @param[out] p_rsp    Buffer for the response APDU.
+ * @param[in]  max_size Size of the response buffer.
+ *
+ * @return Size of the response APDU.
+ */
+static uint32_t nrfx_nfct_autorsp_read_binary(nrfx_nfct_autorsp_config_t const * p_config,
+                                              uint8_t const *                    p_apdu,
+                                              uint8_t *                          p_rsp,
+                                              uint32_t                           max_size)
+{
+    uint32_t offset = ((uint32_t)p_apdu[2] << 8) | p_apdu[3];
+    uint32_t length = (p_apdu[4] == 0) ? 256 : p_apdu[4];
+
+    if ((p_apdu[2] & 0x80) || (offset > p_config->file_size))
+    {
+        /* Wrong parameters P1-P2: offset outside the file. */
+        p_rsp[0] = 0x6B;
+        p_rsp[1] = 0x00;
+        return NRFX_NFCT_APDU_SW_SIZE;
+    }
+
+    length = NRFX_MIN(length, p_config->file_size - offset);
+    length = NRFX_MIN(length, max_size - NRFX_NFCT_APDU_SW_SIZE);
+
+    memcpy(p_rsp, &p_config->p_file[offset], length);
+    p_rsp[length]     = 0x90;
+    p_rsp[length + 1] = 0x00;
+    return length + NRFX_NFCT_APDU_SW_SIZE;
+}
+
+/**
+ * @brief Function for answering the received frame in the automatic response mode.
+ *
+ * @param[in] p_frame Pointer to the received frame.
+ * @param[in] size    Size of the received frame.
+ *
+ * @retval true  The frame was answered and must not be reported to the upper layer.
+ * @retval false The frame must be handled by the upper layer.
+ */
+static bool nrfx_nfct_autorsp_process(uint8_t const * p_frame, uint32_t size)
+{
+    nrfx_nfct_autorsp_config_t const * p_config = m_nfct_cb.p_autorsp;
+
+    if ((p_config == NULL) || (size < 2) ||
+        ((p_frame[0] & NRFX_NFCT_ISODEP_PCB_I_BLOCK_MASK) != NRFX_NFCT_ISODEP_PCB_I_BLOCK))
+    {
+        return false;
+    }
+
+    uint8_t const * p_apdu    = &p_frame[1];
+    uint32_t        apdu_size = size - 1;
+    uint8_t *       p_rsp     = &p_config->p_tx_buffer[1];
+    uint32_t        max_size  = p_config->tx_buffer_size - 1u;
+    uint32_t        rsp_size  = 0;
+
+    if ((p_config->p_file != NULL)                         &&
+        (apdu_size == NRFX_NFCT_APDU_READ_BINARY_SIZE)     &&
+        (p_apdu[0] == 0x00)                                &&
+        (p_apdu[1] == NRFX_NFCT_APDU_READ_BINARY_INS))
+    {
+        rsp_size = nrfx_nfct_autorsp_read_binary(p_config, p_apdu, p_rsp, max_size);
+    }
+    else
+    {
+        for (size_t i = 0; i < p_config->template_count; i++)
+        {
+            nrfx_nfct_rsp_template_t const * p_template = &p_config->p_templates[i];
+
+            if ((apdu_size >= p_template->cmd_size) &&
+                (p_template->rsp_size <= max_size)  &&
+                (memcmp(p_apdu, p_template->p_cmd, p_template->cmd_size) == 0))
+            {
+                memcpy(p_rsp, p_template->p_rsp, p_template->rsp_size);
+                rsp_size = p_template->rsp_size;
+                break;
+            }
+        }
+    }
+
+    if (rsp_size == 0)
+    {
+        return false;
+    }
+
+    /* The tag responds with the block number of the received I-block. */
+    p_config->p_tx_buffer[0] = p_frame[0];
+
+    nrfx_nfct_data_desc_t tx_data =
+    {
+        .data_size = rsp_size + 1,
+        .p_data    = p_config->p_tx_buffer,
+    };
+
+    m_nfct_cb.autorsp_tx = true;
+    if (nrfx_nfct_tx(&tx_data, NRF_NFCT_FRAME_DELAY_MODE_WINDOWGRID) != NRFX_SUCCESS)
+    {
+        m_nfct_cb.autorsp_tx = false;
+        return false;
+    }
+
+    m_nfct_cb.autorsp_count++;
+    return true;
 }
 
 nrfx_err_t nrfx_nfct_init(nrfx_nfct_config_t const * p_config)
@@ -507,6 +642,7 @@ void nrfx_nfct_rx(nrfx_nfct_data_desc_t const * p_tx_data)
 {
     NRFX_ASSERT(p_tx_data);
 
+    m_nfct_cb.rx_data = *p_tx_data;
     nrf_nfct_rxtx_buffer_set(NRF_NFCT, (uint8_t *) p_tx_data->p_data, p_tx_data->data_size);
 
     nrfx_nfct_rxtx_int_enable(NRFX_NFCT_RX_INT_MASK);
@@ -795,8 +931,61 @@ void nrfx_nfct_autocolres_disable(void)
 #endif //defined(NRF52832_XXAA) || defined(NRF52832_XXAB)
 }
 
-void nrfx_nfct_irq_handler(void)
+nrfx_err_t nrfx_nfct_autorsp_start(nrfx_nfct_autorsp_config_t const * p_config)
+{
+    NRFX_ASSERT(p_config);
+    NRFX_ASSERT(p_config->p_tx_buffer);
+    NRFX_ASSERT(p_config->tx_buffer_size > NRFX_NFCT_APDU_SW_SIZE);
+    NRFX_ASSERT((p_config->template_count == 0) || p_config->p_templates);
+
+    nrfx_err_t err_code;
+
+    if (m_nfct_cb.state == NRFX_DRV_STATE_UNINITIALIZED)
+    {
+        err_code = NRFX_ERROR_INVALID_STATE;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    if (!nrfx_is_in_ram(p_config->p_tx_buffer))
+    {
+        err_code = NRFX_ERROR_INVALID_ADDR;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    m_nfct_cb.autorsp_tx    = false;
+    m_nfct_cb.autorsp_count = 0;
+    m_nfct_cb.p_autorsp     = p_config;
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    /* Reception may already be armed with only the upper layer events enabled. */
+    nrfx_nfct_rxtx_int_enable(NRFX_NFCT_RX_INT_MASK);
+
+    return NRFX_SUCCESS;
+}
+
+void nrfx_nfct_autorsp_stop(void)
+{
+    NRFX_CRITICAL_SECTION_ENTER();
+    m_nfct_cb.p_autorsp = NULL;
+    nrf_nfct_int_disable(NRF_NFCT, NRFX_NFCT_AUTORSP_INT_MASK & ~m_nfct_cb.config.rxtx_int_mask);
+    NRFX_CRITICAL_SECTION_EXIT();
+}
+
+uint32_t nrfx_nfct_autorsp_count_get(void)
+{
+    return m_nfct_cb.autorsp_count;
+}
+
+NRFX_IRQ_HANDLER_ATTR void nrfx_nfct_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(nfct);
     nrfx_nfct_field_state_t current_field = NRFX_NFC_FIELD_STATE_NONE;
 
     if (NRFX_NFCT_EVT_ACTIVE(FIELDDETECTED))
@@ -863,9 +1052,18 @@ void nrfx_nfct_irq_handler(void)
             nrf_nfct_rx_frame_status_clear(NRF_NFCT, NRFX_NFCT_FRAME_STATUS_RX_ALL_MASK);
         }
 
-        NRFX_NFCT_CB_HANDLE(m_nfct_cb.config.cb, nfct_evt);
+        if ((nfct_evt.params.rx_frameend.rx_status == 0) &&
+            nrfx_nfct_autorsp_process(nfct_evt.params.rx_frameend.rx_data.p_data,
+                                      nfct_evt.params.rx_frameend.rx_data.data_size))
+        {
+            NRFX_LOG_DEBUG("Rx fend, auto response");
+        }
+        else if (m_nfct_cb.config.rxtx_int_mask & NRF_NFCT_INT_RXFRAMEEND_MASK)
+        {
+            NRFX_NFCT_CB_HANDLE(m_nfct_cb.config.cb, nfct_evt);
 
-        NRFX_LOG_DEBUG("Rx fend");
+            NRFX_LOG_DEBUG("Rx fend");
+        }
     }
 
     if (NRFX_NFCT_EVT_ACTIVE(SELECTED))
@@ -927,7 +1125,7 @@ void nrfx_nfct_irq_handler(void)
     {
         nrf_nfct_event_clear(NRF_NFCT, NRF_NFCT_EVENT_TXFRAMESTART);
 
-        if (m_nfct_cb.config.cb != NULL)
+        if ((m_nfct_cb.config.cb != NULL) && !m_nfct_cb.autorsp_tx)
         {
             nrfx_nfct_evt_t nfct_evt;
 
@@ -952,10 +1150,20 @@ void nrfx_nfct_irq_handler(void)
         /* Ignore any frame transmission until a new TX is scheduled by nrfx_nfct_tx() */
         nrf_nfct_int_disable(NRF_NFCT, NRFX_NFCT_TX_INT_MASK);
 
-        NRFX_NFCT_CB_HANDLE(m_nfct_cb.config.cb, nfct_evt);
+        if (m_nfct_cb.autorsp_tx)
+        {
+            /* Wait for the next command in place of the upper layer. */
+            m_nfct_cb.autorsp_tx = false;
+            nrfx_nfct_rx(&m_nfct_cb.rx_data);
+        }
+        else if (m_nfct_cb.config.rxtx_int_mask & NRF_NFCT_INT_TXFRAMEEND_MASK)
+        {
+            NRFX_NFCT_CB_HANDLE(m_nfct_cb.config.cb, nfct_evt);
 
-        NRFX_LOG_DEBUG("Tx fend");
+            NRFX_LOG_DEBUG("Tx fend");
+        }
     }
+    NRFX_PROF_IRQ_EXIT();
 }
 
 #endif // NRFX_CHECK(NRFX_NFCT_ENABLED)
@@ -110,6 +110,15 @@ static uint32_t m_partial_erase_page_addr = NVMC_PARTIAL_ERASE_INVALID_ADDR;
 
 #endif // defined(NRF_NVMC_PARTIAL_ERASE_PRESENT)
 
+/** Head of the flash job queue. */
+static nrfx_nvmc_job_t * m_job_head;
+
+/** Tail of the flash job queue. */
+static nrfx_nvmc_job_t * m_job_tail;
+
+/** Lock of the flash job queue. */
+NRFX_LOCK_DECLARE(m_job_lock);
+
 static uint32_t flash_page_size_get(void)
 {
     uint32_t flash_page_size = 0;
@@ -238,7 +247,8 @@ static void nvmc_erase_mode_set(void)
 
 static void nvmc_word_write(uint32_t addr, uint32_t value)
 {
-#if defined(NRF91_SERIES)
+#if defined(NVMC_READYNEXT_READYNEXT_Msk)
+    /* The next word is buffered while the previous one is still being programmed. */
     while (!nrf_nvmc_write_ready_check(NRF_NVMC))
     {}
 #else
@@ -250,6 +260,15 @@ static void nvmc_word_write(uint32_t addr, uint32_t value)
     __DMB();
 }
 
+static void nvmc_write_done_wait(void)
+{
+#if defined(NVMC_READYNEXT_READYNEXT_Msk)
+    /* The access mode must not be changed before the last buffered word is programmed. */
+    while (!nrf_nvmc_ready_check(NRF_NVMC))
+    {}
+#endif
+}
+
 static void nvmc_words_write(uint32_t addr, void const * src, uint32_t num_words)
 {
     for (uint32_t i = 0; i < num_words; i++)
@@ -409,6 +428,7 @@ void nrfx_nvmc_word_write(uint32_t addr, uint32_t value)
 
     nvmc_word_write(addr, value);
 
+    nvmc_write_done_wait();
     nvmc_readonly_mode_set();
 }
 
@@ -471,6 +491,7 @@ void nrfx_nvmc_bytes_write(uint32_t addr, void const * src, uint32_t num_bytes)
         nvmc_word_write(addr, partial_word_create(addr, bytes_src, trailing_bytes));
     }
 
+    nvmc_write_done_wait();
     nvmc_readonly_mode_set();
 }
 
@@ -484,7 +505,229 @@ void nrfx_nvmc_words_write(uint32_t addr, void const * src, uint32_t num_words)
 
     nvmc_words_write(addr, src, num_words);
 
+    nvmc_write_done_wait();
+    nvmc_readonly_mode_set();
+}
+
+void nrfx_nvmc_coalesce_init(nrfx_nvmc_coalesce_t * p_buffer)
+{
+    NRFX_ASSERT(p_buffer);
+
+    p_buffer->byte_mask     = 0;
+    p_buffer->bytes_written = 0;
+    p_buffer->word_programs = 0;
+}
+
+void nrfx_nvmc_coalesce_flush(nrfx_nvmc_coalesce_t * p_buffer)
+{
+    NRFX_ASSERT(p_buffer);
+
+    if (!p_buffer->byte_mask)
+    {
+        return;
+    }
+
+    uint32_t mask = 0;
+    for (uint32_t i = 0; i < NVMC_BYTES_IN_WORD; i++)
+    {
+        if (p_buffer->byte_mask & NRFX_BIT(i))
+        {
+            mask |= 0xFFUL << (8 * i);
+        }
+    }
+
+    // Bytes not written through the buffer keep their current flash content.
+    uint32_t flash_word = *(uint32_t const *)p_buffer->word_addr;
+    uint32_t value      = (p_buffer->word & mask) | (flash_word & ~mask);
+
+    p_buffer->byte_mask = 0;
+
+    NRFX_ASSERT(nrfx_nvmc_word_writable_check(p_buffer->word_addr, value));
+    if (value == flash_word)
+    {
+        return;
+    }
+
+    nvmc_write_mode_set();
+    nvmc_word_write(p_buffer->word_addr, value);
+    nvmc_write_done_wait();
     nvmc_readonly_mode_set();
+    p_buffer->word_programs++;
+}
+
+void nrfx_nvmc_coalesce_write(nrfx_nvmc_coalesce_t * p_buffer,
+                              uint32_t               addr,
+                              void const *           src,
+                              uint32_t               num_bytes)
+{
+    NRFX_ASSERT(p_buffer);
+    NRFX_ASSERT(is_valid_address(addr, true));
+
+    uint8_t const * p_bytes = (uint8_t const *)src;
+
+    p_buffer->bytes_written += num_bytes;
+
+    while (num_bytes)
+    {
+        uint32_t word_addr = addr & ~(uint32_t)(NVMC_BYTES_IN_WORD - 1);
+        uint32_t offset    = addr - word_addr;
+
+        if (p_buffer->byte_mask && (p_buffer->word_addr != word_addr))
+        {
+            nrfx_nvmc_coalesce_flush(p_buffer);
+        }
+        if (!p_buffer->byte_mask)
+        {
+            p_buffer->word_addr = word_addr;
+            p_buffer->word      = 0xFFFFFFFF;
+        }
+
+        for (; (offset < NVMC_BYTES_IN_WORD) && num_bytes; offset++, num_bytes--, addr++)
+        {
+            p_buffer->word &= ~(0xFFUL << (8 * offset));
+            p_buffer->word |= (uint32_t)(*p_bytes++) << (8 * offset);
+            p_buffer->byte_mask |= NRFX_BIT(offset);
+        }
+
+        if (p_buffer->byte_mask == NRFX_BIT_MASK(NVMC_BYTES_IN_WORD))
+        {
+            nrfx_nvmc_coalesce_flush(p_buffer);
+        }
+    }
+}
+
+nrfx_err_t nrfx_nvmc_job_submit(nrfx_nvmc_job_t * p_job)
+{
+    NRFX_ASSERT(p_job);
+    NRFX_ASSERT(p_job->count);
+
+    if (p_job->type == NRFX_NVMC_JOB_ERASE)
+    {
+        NRFX_ASSERT(is_valid_address(p_job->address, false));
+        if (!is_page_aligned_check(p_job->address))
+        {
+            return NRFX_ERROR_INVALID_ADDR;
+        }
+    }
+    else
+    {
+        NRFX_ASSERT(is_valid_address(p_job->address, true));
+        NRFX_ASSERT(p_job->p_src);
+        if (!nrfx_is_word_aligned((void const *)p_job->address) ||
+            !nrfx_is_word_aligned(p_job->p_src))
+        {
+            return NRFX_ERROR_INVALID_ADDR;
+        }
+    }
+
+    p_job->progress = 0;
+    p_job->started  = false;
+    p_job->p_next   = NULL;
+
+    NRFX_LOCK_TAKE(m_job_lock);
+    if (m_job_tail)
+    {
+        m_job_tail->p_next = p_job;
+    }
+    else
+    {
+        m_job_head = p_job;
+    }
+    m_job_tail = p_job;
+    NRFX_LOCK_GIVE(m_job_lock);
+
+    return NRFX_SUCCESS;
+}
+
+/**
+ * @brief Function for performing one step of the erase job.
+ *
+ * @param[in,out] p_job Erase job.
+ */
+static void job_erase_step(nrfx_nvmc_job_t * p_job)
+{
+    uint32_t addr = p_job->address + p_job->progress * flash_page_size_get();
+
+#if defined(NRF_NVMC_PARTIAL_ERASE_PRESENT)
+    if (!p_job->started)
+    {
+        nrfx_err_t err_code = nrfx_nvmc_page_partial_erase_init(addr,
+                                                                NRFX_NVMC_JOB_ERASE_SLICE_MS);
+        NRFX_ASSERT(err_code == NRFX_SUCCESS);
+        (void)err_code;
+        p_job->started = true;
+    }
+
+    if (nrfx_nvmc_page_partial_erase_continue())
+    {
+        p_job->started = false;
+        p_job->progress++;
+    }
+#else
+    (void)nrfx_nvmc_page_erase(addr);
+    p_job->progress++;
+#endif
+}
+
+/**
+ * @brief Function for performing one batch of the write job.
+ *
+ * @param[in,out] p_job Write job.
+ */
+static void job_write_step(nrfx_nvmc_job_t * p_job)
+{
+    uint32_t num_words = NRFX_MIN(p_job->count - p_job->progress,
+                                  (uint32_t)NRFX_NVMC_JOB_WRITE_SLICE_WORDS);
+
+    nvmc_write_mode_set();
+    nvmc_words_write(p_job->address + p_job->progress * NVMC_BYTES_IN_WORD,
+                     (uint32_t const *)p_job->p_src + p_job->progress,
+                     num_words);
+    while (!nrf_nvmc_ready_check(NRF_NVMC))
+    {}
+    nvmc_readonly_mode_set();
+
+    p_job->progress += num_words;
+}
+
+bool nrfx_nvmc_job_process(void)
+{
+    nrfx_nvmc_job_t * p_job = m_job_head;
+
+    if (!p_job)
+    {
+        return false;
+    }
+
+    if (p_job->type == NRFX_NVMC_JOB_ERASE)
+    {
+        job_erase_step(p_job);
+    }
+    else
+    {
+        job_write_step(p_job);
+    }
+
+    if (p_job->progress < p_job->count)
+    {
+        return true;
+    }
+
+    NRFX_LOCK_TAKE(m_job_lock);
+    m_job_head = p_job->p_next;
+    if (!m_job_head)
+    {
+        m_job_tail = NULL;
+    }
+    NRFX_LOCK_GIVE(m_job_lock);
+
+    if (p_job->handler)
+    {
+        p_job->handler(p_job, p_job->p_context);
+    }
+
+    // The handler may have submitted another job.
+    return (m_job_head != NULL);
 }
 
 uint16_t nrfx_nvmc_otp_halfword_read(uint32_t addr)
@@ -36,6 +36,7 @@
 #if NRFX_CHECK(NRFX_PDM_ENABLED)
 
 #include <nrfx_pdm.h>
+#include <helpers/nrfx_prof.h>
 #include <hal/nrf_gpio.h>
 
 #define NRFX_LOG_MODULE PDM
@@ -69,18 +70,237 @@ typedef struct
     uint8_t                   error;            ///< Driver error flag.
     volatile uint8_t          irq_buff_request; ///< Request the next buffer in the ISR.
     bool                      skip_gpio_cfg;    ///< Do not touch GPIO configuration of used pins.
+    bool                      stereo;           ///< Stereo mode is used.
+    nrfx_pdm_ring_t *         p_ring;           ///< Ring of buffers, NULL if not in ring mode.
+    uint32_t                  ring_active;      ///< Index of the ring entry being filled.
+    uint32_t                  ring_pending;     ///< Index of the ring entry set as the next one.
+    bool                      filter_enabled;   ///< Sample filter is configured.
+    nrfx_pdm_filter_config_t  filter;           ///< Sample filter configuration.
+    int16_t                   hpf_x1[2];        ///< Previous input of the high-pass filter, per channel.
+    int16_t                   hpf_y1[2];        ///< Previous output of the high-pass filter, per channel.
 } nrfx_pdm_cb_t;
 
 static nrfx_pdm_cb_t m_cb;
 
 
-void nrfx_pdm_irq_handler(void)
+static int16_t pdm_sat16(int32_t value)
 {
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+    return (int16_t)__SSAT(value, 16);
+#else
+    if (value > INT16_MAX)
+    {
+        return INT16_MAX;
+    }
+    if (value < INT16_MIN)
+    {
+        return INT16_MIN;
+    }
+    return (int16_t)value;
+#endif
+}
+
+/**
+ * @brief Function for applying the high-pass filter and the gain to a decimated sample.
+ *
+ * @param[in] x  Decimated sample.
+ * @param[in] ch Channel the sample belongs to.
+ *
+ * @return Output sample.
+ */
+static int16_t pdm_filter_sample(int32_t x, uint8_t ch)
+{
+    if (m_cb.filter.hpf_coef)
+    {
+        // y[n] = x[n] - x[n-1] + a * y[n-1]
+        int32_t y = x - m_cb.hpf_x1[ch] +
+                    (((int32_t)m_cb.filter.hpf_coef * m_cb.hpf_y1[ch]) >> 15);
+        m_cb.hpf_x1[ch] = (int16_t)x;
+        m_cb.hpf_y1[ch] = pdm_sat16(y);
+        x = m_cb.hpf_y1[ch];
+    }
+    if (m_cb.filter.gain != NRFX_PDM_FILTER_GAIN_UNITY)
+    {
+        x = (x * (int32_t)m_cb.filter.gain) >> 8;
+    }
+    return pdm_sat16(x);
+}
+
+uint16_t nrfx_pdm_filter_process(int16_t * p_samples, uint16_t length)
+{
+    NRFX_ASSERT(p_samples);
+
+    if (!m_cb.filter_enabled)
+    {
+        return length;
+    }
+
+    uint8_t  channels = m_cb.stereo ? 2 : 1;
+    uint8_t  factor   = m_cb.filter.decimation;
+    uint16_t set_size = (uint16_t)(channels * factor);
+    uint16_t out      = 0;
+
+    for (uint16_t i = 0; (uint32_t)i + set_size <= length; i += set_size)
+    {
+        int32_t sum[2];
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+        if ((channels == 1) && (factor == 2) && !((uint32_t)&p_samples[i] & 0x3UL))
+        {
+            // Sum both halfword samples of the word in a single instruction.
+            sum[0] = (int32_t)__SMLAD(*(uint32_t const *)&p_samples[i], 0x00010001UL, 0);
+        }
+        else
+#endif
+        {
+            sum[0] = 0;
+            sum[1] = 0;
+            for (uint8_t k = 0; k < factor; k++)
+            {
+                for (uint8_t ch = 0; ch < channels; ch++)
+                {
+                    sum[ch] += p_samples[i + k * channels + ch];
+                }
+            }
+        }
+
+        for (uint8_t ch = 0; ch < channels; ch++)
+        {
+            p_samples[out++] = pdm_filter_sample(sum[ch] / factor, ch);
+        }
+    }
+
+    return out;
+}
+
+nrfx_err_t nrfx_pdm_filter_set(nrfx_pdm_filter_config_t const * p_config)
+{
+    nrfx_err_t err_code;
+
+    if (m_cb.op_state != NRFX_PDM_STATE_IDLE)
+    {
+        err_code = NRFX_ERROR_BUSY;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    if (p_config && ((p_config->decimation < 1) || (p_config->decimation > 3)))
+    {
+        err_code = NRFX_ERROR_INVALID_PARAM;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    m_cb.filter_enabled = (p_config != NULL);
+    if (p_config)
+    {
+        m_cb.filter = *p_config;
+    }
+    m_cb.hpf_x1[0] = 0;
+    m_cb.hpf_x1[1] = 0;
+    m_cb.hpf_y1[0] = 0;
+    m_cb.hpf_y1[1] = 0;
+
+    return NRFX_SUCCESS;
+}
+
+static int16_t * pdm_ring_entry(nrfx_pdm_ring_t const * p_ring, uint32_t index)
+{
+    return &p_ring->p_buffer[(index % p_ring->count) * p_ring->entry_length];
+}
+
+/** @brief Function for handling the STARTED event in the ring mode. */
+static void pdm_ring_started(void)
+{
+    nrfx_pdm_ring_t * p_ring = m_cb.p_ring;
+    nrfx_pdm_evt_t    evt    =
+    {
+        .buffer_requested = false,
+        .buffer_released  = NULL,
+        .error            = NRFX_PDM_NO_ERROR,
+    };
+
+    // The peripheral has just started filling the entry set as the next one,
+    // so the previous entry is full, unless it is being overwritten.
+    if (m_cb.op_state == NRFX_PDM_STATE_STARTING)
+    {
+        m_cb.op_state = NRFX_PDM_STATE_RUNNING;
+    }
+    else if (m_cb.ring_active != m_cb.ring_pending)
+    {
+        evt.buffer_released = pdm_ring_entry(p_ring, m_cb.ring_active);
+        if (m_cb.filter_enabled && m_cb.filter.in_irq)
+        {
+            (void)nrfx_pdm_filter_process(evt.buffer_released, p_ring->entry_length);
+        }
+        p_ring->released = m_cb.ring_active + 1;
+        m_cb.ring_active = m_cb.ring_pending;
+    }
+
+    uint32_t next = m_cb.ring_active + 1;
+    if (next < p_ring->consumed + p_ring->count)
+    {
+        nrf_pdm_buffer_set(NRF_PDM0,
+                           (uint32_t *)pdm_ring_entry(p_ring, next),
+                           p_ring->entry_length);
+        m_cb.ring_pending = next;
+        m_cb.error = 0;
+    }
+    else if (m_cb.error == 0)
+    {
+        // The buffer pointer is left unchanged, so the entry being filled
+        // now is going to be overwritten.
+        m_cb.error = 1;
+        evt.error = NRFX_PDM_ERROR_OVERFLOW;
+    }
+
+    if (evt.buffer_released || (evt.error != NRFX_PDM_NO_ERROR))
+    {
+        m_cb.event_handler(&evt);
+    }
+}
+
+/** @brief Function for handling the STOPPED event in the ring mode. */
+static void pdm_ring_stopped(void)
+{
+    nrfx_pdm_ring_t * p_ring = m_cb.p_ring;
+    nrfx_pdm_evt_t    evt    =
+    {
+        .buffer_requested = false,
+        .buffer_released  = pdm_ring_entry(p_ring, m_cb.ring_active),
+        .error            = NRFX_PDM_NO_ERROR,
+    };
+
+    // Release the entry that was being filled when sampling was stopped.
+    // The entry set as the next one has not been used.
+    if (m_cb.filter_enabled && m_cb.filter.in_irq)
+    {
+        (void)nrfx_pdm_filter_process(evt.buffer_released, p_ring->entry_length);
+    }
+    p_ring->released = m_cb.ring_active + 1;
+    m_cb.p_ring = NULL;
+    m_cb.event_handler(&evt);
+}
+
+
+NRFX_IRQ_HANDLER_ATTR void nrfx_pdm_irq_handler(void)
+{
+    NRFX_PROF_IRQ_ENTER(pdm);
     if (nrf_pdm_event_check(NRF_PDM0, NRF_PDM_EVENT_STARTED))
     {
         nrf_pdm_event_clear(NRF_PDM0, NRF_PDM_EVENT_STARTED);
         NRFX_LOG_DEBUG("Event: %s.", EVT_TO_STR(NRF_PDM_EVENT_STARTED));
 
+        if (m_cb.p_ring)
+        {
+            pdm_ring_started();
+            NRFX_PROF_IRQ_EXIT();
+            return;
+        }
+
         uint8_t finished_buffer = m_cb.active_buffer;
 
         // Check if the next buffer was set before.
@@ -135,6 +355,13 @@ void nrfx_pdm_irq_handler(void)
         nrf_pdm_disable(NRF_PDM0);
         m_cb.op_state = NRFX_PDM_STATE_IDLE;
 
+        if (m_cb.p_ring)
+        {
+            pdm_ring_stopped();
+            NRFX_PROF_IRQ_EXIT();
+            return;
+        }
+
         // Release the buffers.
         nrfx_pdm_evt_t evt;
         evt.error = NRFX_PDM_NO_ERROR;
@@ -167,6 +394,7 @@ void nrfx_pdm_irq_handler(void)
         m_cb.irq_buff_request = 0;
         m_cb.event_handler(&evt);
     }
+    NRFX_PROF_IRQ_EXIT();
 }
 
 
@@ -203,6 +431,8 @@ nrfx_err_t nrfx_pdm_init(nrfx_pdm_config_t const * p_config,
     m_cb.event_handler = event_handler;
     m_cb.op_state = NRFX_PDM_STATE_IDLE;
     m_cb.skip_gpio_cfg = p_config->skip_gpio_cfg;
+    m_cb.stereo = (p_config->mode == NRF_PDM_MODE_STEREO);
+    m_cb.p_ring = NULL;
 
 #if NRF_PDM_HAS_RATIO_CONFIG
     nrf_pdm_ratio_set(NRF_PDM0, p_config->ratio);
@@ -291,6 +521,7 @@ nrfx_err_t nrfx_pdm_start(void)
         return err_code;
     }
 
+    m_cb.p_ring = NULL;
     m_cb.op_state = NRFX_PDM_STATE_STARTING;
     pdm_buf_request();
 
@@ -301,9 +532,113 @@ nrfx_err_t nrfx_pdm_start(void)
     return err_code;
 }
 
-nrfx_err_t nrfx_pdm_buffer_set(int16_t * buffer, uint16_t buffer_length)
+void nrfx_pdm_ring_init(nrfx_pdm_ring_t * p_ring,
+                        int16_t *         p_buffer,
+                        uint16_t          entry_length,
+                        uint16_t          count)
 {
+    NRFX_ASSERT(p_ring);
+    NRFX_ASSERT(p_buffer);
+    NRFX_ASSERT(((uint32_t)p_buffer & 0x3UL) == 0);
+    NRFX_ASSERT(entry_length && ((entry_length & 0x1) == 0));
+    NRFX_ASSERT(entry_length <= NRFX_PDM_MAX_BUFFER_SIZE);
+    NRFX_ASSERT(count >= 3);
+
+    p_ring->p_buffer     = p_buffer;
+    p_ring->entry_length = entry_length;
+    p_ring->count        = count;
+    p_ring->released     = 0;
+    p_ring->consumed     = 0;
+    p_ring->data_length  = entry_length;
+}
+
+nrfx_err_t nrfx_pdm_ring_start(nrfx_pdm_ring_t * p_ring)
+{
+    NRFX_ASSERT(p_ring);
+    nrfx_err_t err_code;
+
     if (m_cb.drv_state == NRFX_DRV_STATE_UNINITIALIZED)
+    {
+        err_code = NRFX_ERROR_INVALID_STATE;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+    if (m_cb.op_state != NRFX_PDM_STATE_IDLE)
+    {
+        err_code = NRFX_ERROR_BUSY;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    uint16_t data_length = p_ring->entry_length;
+    if (m_cb.filter_enabled)
+    {
+        uint16_t set_size = (uint16_t)((m_cb.stereo ? 2 : 1) * m_cb.filter.decimation);
+        if (p_ring->entry_length % set_size)
+        {
+            err_code = NRFX_ERROR_INVALID_LENGTH;
+            NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                             __func__,
+                             NRFX_LOG_ERROR_STRING_GET(err_code));
+            return err_code;
+        }
+        if (m_cb.filter.in_irq)
+        {
+            data_length = (uint16_t)(p_ring->entry_length / m_cb.filter.decimation);
+        }
+    }
+
+    p_ring->released    = 0;
+    p_ring->consumed    = 0;
+    p_ring->data_length = data_length;
+
+    m_cb.p_ring       = p_ring;
+    m_cb.ring_active  = 0;
+    m_cb.ring_pending = 0;
+    m_cb.error        = 0;
+    m_cb.op_state     = NRFX_PDM_STATE_STARTING;
+
+    nrf_pdm_buffer_set(NRF_PDM0, (uint32_t *)p_ring->p_buffer, p_ring->entry_length);
+    pdm_start();
+
+    err_code = NRFX_SUCCESS;
+    NRFX_LOG_INFO("Function: %s, error code: %s.",
+                  __func__,
+                  NRFX_LOG_ERROR_STRING_GET(err_code));
+    return err_code;
+}
+
+int16_t * nrfx_pdm_ring_get(nrfx_pdm_ring_t const * p_ring, uint16_t * p_length)
+{
+    NRFX_ASSERT(p_ring);
+
+    uint32_t consumed = p_ring->consumed;
+    if (consumed >= p_ring->released)
+    {
+        return NULL;
+    }
+    if (p_length)
+    {
+        *p_length = p_ring->data_length;
+    }
+    return pdm_ring_entry(p_ring, consumed);
+}
+
+void nrfx_pdm_ring_release(nrfx_pdm_ring_t * p_ring)
+{
+    NRFX_ASSERT(p_ring);
+    NRFX_ASSERT(p_ring->consumed < p_ring->released);
+
+    p_ring->consumed++;
+}
+
+nrfx_err_t nrfx_pdm_buffer_set(int16_t * buffer, uint16_t buffer_length)
+{
+    if ((m_cb.drv_state == NRFX_DRV_STATE_UNINITIALIZED) || m_cb.p_ring)
     {
         return NRFX_ERROR_INVALID_STATE;
     }
@@ -360,6 +695,7 @@ nrfx_err_t nrfx_pdm_stop(void)
         {
             nrf_pdm_disable(NRF_PDM0);
             m_cb.op_state = NRFX_PDM_STATE_IDLE;
+            m_cb.p_ring = NULL;
             err_code = NRFX_SUCCESS;
             NRFX_LOG_INFO("Function: %s, error code: %s.",
                           __func__,
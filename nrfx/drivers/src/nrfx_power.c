@@ -36,6 +36,7 @@
 #if NRFX_CHECK(NRFX_POWER_ENABLED)
 
 #include <nrfx_power.h>
+#include <helpers/nrfx_prof.h>
 
 #if NRFX_CHECK(NRFX_CLOCK_ENABLED)
 
@@ -287,8 +288,9 @@ void nrfx_power_usbevt_uninit(void)
 #endif /* NRF_POWER_HAS_USBREG */
 
 
-void nrfx_power_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_power_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(power);
     uint32_t enabled = nrf_power_int_enable_get(NRF_POWER);
     /* Prevent "unused variable" warning when all below blocks are disabled. */
     (void)enabled;
@@ -341,6 +343,7 @@ void nrfx_power_irq_handler(void)
         m_usbevt_handler(NRFX_POWER_USB_EVT_READY);
     }
 #endif
+    NRFX_PROF_IRQ_EXIT();
 }
 
 #if NRFX_CHECK(NRFX_CLOCK_ENABLED)
@@ -354,7 +357,7 @@ void nrfx_power_irq_handler(void)
  * function instead of another one defined as weak will require additional
  * actions, and might be even impossible.
  */
-void nrfx_power_clock_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_power_clock_irq_handler(void)
 {
     nrfx_power_irq_handler();
     nrfx_clock_irq_handler();
@@ -47,6 +47,9 @@ static nrfx_atomic_t m_channels_allocated = NRFX_PPI_PROG_APP_CHANNELS_MASK;
 /** @brief Bitmask representing groups availability. */
 static nrfx_atomic_t m_groups_allocated = NRFX_PPI_ALL_APP_GROUPS_MASK;
 
+/** @brief Lock of the read-modify-write updates of the group registers. */
+NRFX_LOCK_DECLARE(m_ppi_lock);
+
 
 /**
  * @brief Compute a group mask (needed for driver internals, not used for NRF_PPI registers).
@@ -328,9 +331,9 @@ nrfx_err_t nrfx_ppi_channels_remove_from_group(uint32_t                channel_m
     }
     else
     {
-        NRFX_CRITICAL_SECTION_ENTER();
+        NRFX_LOCK_TAKE(m_ppi_lock);
         nrf_ppi_channels_remove_from_group(NRF_PPI, channel_mask, group);
-        NRFX_CRITICAL_SECTION_EXIT();
+        NRFX_LOCK_GIVE(m_ppi_lock);
     }
     NRFX_LOG_INFO("Function: %s, error code: %s.", __func__, NRFX_LOG_ERROR_STRING_GET(err_code));
     return err_code;
@@ -355,9 +358,9 @@ nrfx_err_t nrfx_ppi_channels_include_in_group(uint32_t                channel_ma
     }
     else
     {
-        NRFX_CRITICAL_SECTION_ENTER();
+        NRFX_LOCK_TAKE(m_ppi_lock);
         nrf_ppi_channels_include_in_group(NRF_PPI, channel_mask, group);
-        NRFX_CRITICAL_SECTION_EXIT();
+        NRFX_LOCK_GIVE(m_ppi_lock);
     }
     NRFX_LOG_INFO("Function: %s, error code: %s.", __func__, NRFX_LOG_ERROR_STRING_GET(err_code));
     return err_code;
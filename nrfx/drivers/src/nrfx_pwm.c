@@ -41,6 +41,7 @@
 #endif
 
 #include <nrfx_pwm.h>
+#include <helpers/nrfx_prof.h>
 #include <hal/nrf_gpio.h>
 
 #define NRFX_LOG_MODULE PWM
@@ -71,13 +72,18 @@
 typedef struct
 {
 #if defined(USE_DMA_ISSUE_WORKAROUND)
-    uint32_t                  starting_task_address;
+    uint32_t                   starting_task_address;
 #endif
-    nrfx_pwm_handler_t        handler;
-    void *                    p_context;
-    nrfx_drv_state_t volatile state;
-    uint8_t                   flags;
-    bool                      skip_gpio_cfg;
+    nrfx_pwm_handler_t         handler;
+    void *                     p_context;
+    nrfx_drv_state_t volatile  state;
+    uint8_t                    flags;
+    bool                       skip_gpio_cfg;
+    bool                       stream;
+    bool                       stream_ending;
+    nrfx_pwm_stream_producer_t stream_producer;
+    uint32_t                   stream_repeats;
+    uint16_t                   stream_idle[NRF_PWM_CHANNEL_COUNT];
 } pwm_control_block_t;
 static pwm_control_block_t m_cb[NRFX_PWM_ENABLED_COUNT];
 
@@ -325,6 +331,8 @@ uint32_t nrfx_pwm_simple_playback(nrfx_pwm_t const *         p_instance,
     }
     nrf_pwm_shorts_set(p_instance->p_registers, shorts_mask);
 
+    p_cb->stream = false;
+
     NRFX_LOG_INFO("Function: %s, sequence length: %d.",
                   __func__,
                   p_sequence->length);
@@ -367,6 +375,8 @@ uint32_t nrfx_pwm_complex_playback(nrfx_pwm_t const *         p_instance,
     }
     nrf_pwm_shorts_set(p_instance->p_registers, shorts_mask);
 
+    p_cb->stream = false;
+
     NRFX_LOG_INFO("Function: %s, sequence 0 length: %d.",
                   __func__,
                   p_sequence_0->length);
@@ -383,6 +393,91 @@ uint32_t nrfx_pwm_complex_playback(nrfx_pwm_t const *         p_instance,
 }
 
 
+/**
+ * @brief Function for setting the next chunk of the streaming playback for a given sequence.
+ *
+ * @param[in] p_pwm  Pointer to the PWM peripheral registers.
+ * @param[in] p_cb   Pointer to the driver instance control block.
+ * @param[in] seq_id Identifier of the sequence that has just been loaded (0 or 1).
+ *
+ * @retval true  New chunk was set.
+ * @retval false The producer has no data, so idle values were set instead.
+ */
+static bool stream_chunk_set(NRF_PWM_Type *        p_pwm,
+                             pwm_control_block_t * p_cb,
+                             uint8_t               seq_id)
+{
+    nrf_pwm_sequence_t chunk =
+    {
+        .values.p_raw = NULL,
+        .length       = 0,
+        .repeats      = p_cb->stream_repeats,
+        .end_delay    = 0,
+    };
+
+    if (!p_cb->stream_ending)
+    {
+        if (!p_cb->stream_producer(&chunk, p_cb->p_context))
+        {
+            // The sequence that is being played now is the last one.
+            p_cb->stream_ending = true;
+            nrf_pwm_shorts_set(p_pwm, (seq_id == 0) ? NRF_PWM_SHORT_SEQEND1_STOP_MASK
+                                                    : NRF_PWM_SHORT_SEQEND0_STOP_MASK);
+            return true;
+        }
+        if (chunk.length)
+        {
+            NRFX_ASSERT(nrfx_is_in_ram(chunk.values.p_raw));
+            nrf_pwm_sequence_set(p_pwm, seq_id, &chunk);
+            return true;
+        }
+    }
+
+    // Idle values for all channels are valid in every loading mode.
+    chunk.values.p_raw = p_cb->stream_idle;
+    chunk.length       = NRF_PWM_CHANNEL_COUNT;
+    chunk.repeats      = 0;
+    nrf_pwm_sequence_set(p_pwm, seq_id, &chunk);
+    return p_cb->stream_ending;
+}
+
+
+uint32_t nrfx_pwm_stream_playback(nrfx_pwm_t const *               p_instance,
+                                  nrfx_pwm_stream_config_t const * p_config,
+                                  uint32_t                         flags)
+{
+    pwm_control_block_t * p_cb  = &m_cb[p_instance->drv_inst_idx];
+    NRFX_ASSERT(p_cb->state != NRFX_DRV_STATE_UNINITIALIZED);
+    NRFX_ASSERT(p_cb->handler);
+    NRFX_ASSERT(p_config);
+    NRFX_ASSERT(p_config->producer);
+
+    p_cb->stream_producer = p_config->producer;
+    p_cb->stream_repeats  = p_config->repeats;
+    p_cb->stream_ending   = false;
+    for (uint8_t i = 0; i < NRF_PWM_CHANNEL_COUNT; i++)
+    {
+        p_cb->stream_idle[i] = p_config->idle_value;
+    }
+
+    // Sequences are played alternately without an end, as the playback is
+    // restarted from sequence 0 when the loop is done. This may be changed
+    // when the first chunks are obtained.
+    nrf_pwm_loop_set(p_instance->p_registers, 1);
+    nrf_pwm_shorts_set(p_instance->p_registers, NRF_PWM_SHORT_LOOPSDONE_SEQSTART0_MASK);
+    (void)stream_chunk_set(p_instance->p_registers, p_cb, 0);
+    (void)stream_chunk_set(p_instance->p_registers, p_cb, 1);
+
+    p_cb->stream = true;
+
+    NRFX_LOG_INFO("Function: %s, streaming started.", __func__);
+    return start_playback(p_instance, p_cb,
+        (flags & NRFX_PWM_FLAG_START_VIA_TASK) | NRFX_PWM_FLAG_NO_EVT_FINISHED |
+        NRFX_PWM_FLAG_SIGNAL_END_SEQ0 | NRFX_PWM_FLAG_SIGNAL_END_SEQ1,
+        NRF_PWM_TASK_SEQSTART0);
+}
+
+
 bool nrfx_pwm_stop(nrfx_pwm_t const * p_instance,
                    bool               wait_until_stopped)
 {
@@ -446,14 +541,22 @@ bool nrfx_pwm_is_stopped(nrfx_pwm_t const * p_instance)
 }
 
 
-static void irq_handler(NRF_PWM_Type * p_pwm, pwm_control_block_t * p_cb)
+NRFX_IRQ_HANDLER_ATTR static void irq_handler(NRF_PWM_Type * p_pwm, pwm_control_block_t * p_cb)
 {
     // The user handler is called for SEQEND0 and SEQEND1 events only when the
     // user asks for it (by setting proper flags when starting the playback).
+    // In the streaming playback, these events are used to set the next chunks.
     if (nrf_pwm_event_check(p_pwm, NRF_PWM_EVENT_SEQEND0))
     {
         nrf_pwm_event_clear(p_pwm, NRF_PWM_EVENT_SEQEND0);
-        if ((p_cb->flags & NRFX_PWM_FLAG_SIGNAL_END_SEQ0) && p_cb->handler)
+        if (p_cb->stream)
+        {
+            if (!stream_chunk_set(p_pwm, p_cb, 0))
+            {
+                p_cb->handler(NRFX_PWM_EVT_STREAM_UNDERFLOW, p_cb->p_context);
+            }
+        }
+        else if ((p_cb->flags & NRFX_PWM_FLAG_SIGNAL_END_SEQ0) && p_cb->handler)
         {
             p_cb->handler(NRFX_PWM_EVT_END_SEQ0, p_cb->p_context);
         }
@@ -461,7 +564,14 @@ static void irq_handler(NRF_PWM_Type * p_pwm, pwm_control_block_t * p_cb)
     if (nrf_pwm_event_check(p_pwm, NRF_PWM_EVENT_SEQEND1))
     {
         nrf_pwm_event_clear(p_pwm, NRF_PWM_EVENT_SEQEND1);
-        if ((p_cb->flags & NRFX_PWM_FLAG_SIGNAL_END_SEQ1) && p_cb->handler)
+        if (p_cb->stream)
+        {
+            if (!stream_chunk_set(p_pwm, p_cb, 1))
+            {
+                p_cb->handler(NRFX_PWM_EVT_STREAM_UNDERFLOW, p_cb->p_context);
+            }
+        }
+        else if ((p_cb->flags & NRFX_PWM_FLAG_SIGNAL_END_SEQ1) && p_cb->handler)
         {
             p_cb->handler(NRFX_PWM_EVT_END_SEQ1, p_cb->p_context);
         }
@@ -483,6 +593,7 @@ static void irq_handler(NRF_PWM_Type * p_pwm, pwm_control_block_t * p_cb)
         nrf_pwm_event_clear(p_pwm, NRF_PWM_EVENT_STOPPED);
 
         p_cb->state = NRFX_DRV_STATE_INITIALIZED;
+        p_cb->stream = false;
         if (p_cb->handler)
         {
             p_cb->handler(NRFX_PWM_EVT_STOPPED, p_cb->p_context);
@@ -509,30 +620,38 @@ void DMA_ISSUE_EGU_IRQHandler(void)
 
 
 #if NRFX_CHECK(NRFX_PWM0_ENABLED)
-void nrfx_pwm_0_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_pwm_0_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(pwm_0);
     irq_handler(NRF_PWM0, &m_cb[NRFX_PWM0_INST_IDX]);
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
 #if NRFX_CHECK(NRFX_PWM1_ENABLED)
-void nrfx_pwm_1_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_pwm_1_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(pwm_1);
     irq_handler(NRF_PWM1, &m_cb[NRFX_PWM1_INST_IDX]);
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
 #if NRFX_CHECK(NRFX_PWM2_ENABLED)
-void nrfx_pwm_2_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_pwm_2_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(pwm_2);
     irq_handler(NRF_PWM2, &m_cb[NRFX_PWM2_INST_IDX]);
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
 #if NRFX_CHECK(NRFX_PWM3_ENABLED)
-void nrfx_pwm_3_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_pwm_3_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(pwm_3);
     irq_handler(NRF_PWM3, &m_cb[NRFX_PWM3_INST_IDX]);
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
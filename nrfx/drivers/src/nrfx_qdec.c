@@ -36,6 +36,7 @@
 #if NRFX_CHECK(NRFX_QDEC_ENABLED)
 
 #include <nrfx_qdec.h>
+#include <helpers/nrfx_prof.h>
 #include <hal/nrf_gpio.h>
 
 #define NRFX_LOG_MODULE QDEC
@@ -52,8 +53,47 @@ static nrfx_qdec_event_handler_t m_qdec_event_handler = NULL;
 static nrfx_drv_state_t m_state = NRFX_DRV_STATE_UNINITIALIZED;
 static bool m_skip_gpio_cfg;
 
-void nrfx_qdec_irq_handler(void)
+/** @brief Position tracking state. */
+static struct
 {
+    bool              active;    ///< True if the position tracking mode is started.
+    volatile int32_t  position;  ///< Position including all processed reports.
+    volatile int16_t  velocity;  ///< Accumulator value of the last report.
+    int32_t           notified;  ///< Position provided in the last notification.
+    uint32_t          threshold; ///< Position change that triggers the notification.
+} m_tracking;
+
+/** @brief Lock of the position tracking state, shared with the interrupt handler. */
+NRFX_LOCK_DECLARE(m_tracking_lock);
+
+/**
+ * @brief Function for processing the report in the position tracking mode.
+ *
+ * @param[in] acc Accumulated transitions of the report.
+ *
+ * @retval true  The notification is to be passed to the event handler.
+ * @retval false The position change is below the threshold.
+ */
+static bool tracking_report_process(int16_t acc)
+{
+    m_tracking.position += acc;
+    m_tracking.velocity  = acc;
+
+    int32_t  diff   = m_tracking.position - m_tracking.notified;
+    uint32_t change = (uint32_t)((diff < 0) ? -diff : diff);
+
+    if (change < m_tracking.threshold)
+    {
+        return false;
+    }
+
+    m_tracking.notified = m_tracking.position;
+    return true;
+}
+
+NRFX_IRQ_HANDLER_ATTR void nrfx_qdec_irq_handler(void)
+{
+    NRFX_PROF_IRQ_ENTER(qdec);
     nrfx_qdec_event_t event;
     if ( nrf_qdec_event_check(NRF_QDEC, NRF_QDEC_EVENT_SAMPLERDY) &&
          nrf_qdec_int_enable_check(NRF_QDEC, NRF_QDEC_INT_SAMPLERDY_MASK) )
@@ -74,9 +114,21 @@ void nrfx_qdec_irq_handler(void)
 
         event.type = NRF_QDEC_EVENT_REPORTRDY;
 
-        event.data.report.acc    = (int16_t)nrf_qdec_accread_get(NRF_QDEC);
-        event.data.report.accdbl = (uint16_t)nrf_qdec_accdblread_get(NRF_QDEC);
-        m_qdec_event_handler(event);
+        if (m_tracking.active)
+        {
+            if (tracking_report_process((int16_t)nrf_qdec_accread_get(NRF_QDEC)))
+            {
+                event.data.position.position = m_tracking.position;
+                event.data.position.velocity = m_tracking.velocity;
+                m_qdec_event_handler(event);
+            }
+        }
+        else
+        {
+            event.data.report.acc    = (int16_t)nrf_qdec_accread_get(NRF_QDEC);
+            event.data.report.accdbl = (uint16_t)nrf_qdec_accdblread_get(NRF_QDEC);
+            m_qdec_event_handler(event);
+        }
     }
 
     if ( nrf_qdec_event_check(NRF_QDEC, NRF_QDEC_EVENT_ACCOF) &&
@@ -88,6 +140,7 @@ void nrfx_qdec_irq_handler(void)
         event.type = NRF_QDEC_EVENT_ACCOF;
         m_qdec_event_handler(event);
     }
+    NRFX_PROF_IRQ_EXIT();
 }
 
 
@@ -174,6 +227,7 @@ void nrfx_qdec_uninit(void)
     NRFX_IRQ_DISABLE(nrfx_get_irq_number(NRF_QDEC));
 
     nrf_qdec_shorts_disable(NRF_QDEC, NRF_QDEC_SHORT_REPORTRDY_READCLRACC_MASK);
+    m_tracking.active = false;
 
     if (!m_skip_gpio_cfg)
     {
@@ -223,4 +277,70 @@ void nrfx_qdec_accumulators_read(int16_t * p_acc, int16_t * p_accdbl)
     NRFX_LOG_HEXDUMP_DEBUG((uint8_t *)p_accdbl, sizeof(p_accdbl[0]));
 }
 
+nrfx_err_t nrfx_qdec_position_tracking_start(int32_t position, uint32_t threshold)
+{
+    NRFX_ASSERT(m_state != NRFX_DRV_STATE_UNINITIALIZED);
+    NRFX_ASSERT(threshold > 0);
+    nrfx_err_t err_code;
+
+    if (!nrf_qdec_int_enable_check(NRF_QDEC, NRF_QDEC_INT_REPORTRDY_MASK))
+    {
+        err_code = NRFX_ERROR_INVALID_STATE;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    NRFX_LOCK_TAKE(m_tracking_lock);
+    m_tracking.position  = position;
+    m_tracking.notified  = position;
+    m_tracking.velocity  = 0;
+    m_tracking.threshold = threshold;
+    m_tracking.active    = true;
+    NRFX_LOCK_GIVE(m_tracking_lock);
+
+    err_code = NRFX_SUCCESS;
+    NRFX_LOG_INFO("Function: %s, error code: %s.", __func__, NRFX_LOG_ERROR_STRING_GET(err_code));
+    return err_code;
+}
+
+void nrfx_qdec_position_tracking_stop(void)
+{
+    NRFX_ASSERT(m_state != NRFX_DRV_STATE_UNINITIALIZED);
+    m_tracking.active = false;
+}
+
+int32_t nrfx_qdec_position_get(void)
+{
+    NRFX_ASSERT(m_tracking.active);
+
+    int32_t position;
+    bool    report_before;
+    bool    report_after;
+
+    NRFX_LOCK_TAKE(m_tracking_lock);
+    // A report that is ready, but not processed yet, has already been moved out of ACC
+    // by the shortcut. Retry if a report occurred while ACC was being read.
+    do {
+        report_before = nrf_qdec_event_check(NRF_QDEC, NRF_QDEC_EVENT_REPORTRDY);
+        position      = m_tracking.position + nrf_qdec_acc_get(NRF_QDEC);
+        report_after  = nrf_qdec_event_check(NRF_QDEC, NRF_QDEC_EVENT_REPORTRDY);
+    } while (report_before != report_after);
+
+    if (report_after)
+    {
+        position += (int16_t)nrf_qdec_accread_get(NRF_QDEC);
+    }
+    NRFX_LOCK_GIVE(m_tracking_lock);
+
+    return position;
+}
+
+int16_t nrfx_qdec_velocity_get(void)
+{
+    NRFX_ASSERT(m_tracking.active);
+    return m_tracking.velocity;
+}
+
 #endif // NRFX_CHECK(NRFX_QDEC_ENABLED)
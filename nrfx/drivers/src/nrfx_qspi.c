@@ -36,8 +36,11 @@
 #if NRFX_CHECK(NRFX_QSPI_ENABLED)
 
 #include <nrfx_qspi.h>
+#include <helpers/nrfx_prof.h>
 #include <hal/nrf_gpio.h>
+#include <soc/nrfx_coredep.h>
 #include <nrf_erratas.h>
+#include <string.h>
 
 /** @brief Command byte used to read status register. */
 #define QSPI_STD_CMD_RDSR 0x05
@@ -59,6 +62,18 @@
  */
 #define QSPI_DEF_WAIT_ATTEMPTS 50000
 
+/**
+ * @brief Number of READY event polls after which a long frame mode transfer of a single
+ *        frame is considered to be timed out.
+ *
+ * A frame of 9 bytes takes at most 72 us at the lowest supported SCK frequency, what is
+ * well below the resulting limit.
+ */
+#define QSPI_LFM_POLL_ATTEMPTS 100000
+
+/** @brief Unit of the DPMDUR register fields in microseconds (256 periods of 16 MHz clock). */
+#define QSPI_DPMDUR_UNIT_US 16
+
 /**
  * @brief Macro for initializing a QSPI pin.
  *
@@ -76,6 +91,16 @@
     #define USE_WORKAROUND_FOR_ANOMALY_121 1
 #endif
 
+#if defined(CACHE_PRESENT) && !defined(NRF_TRUSTZONE_NONSECURE)
+#include <hal/nrf_cache.h>
+
+/** @brief Start address of the XIP region. */
+#define QSPI_XIP_START_ADDR 0x10000000uL
+
+/** @brief Size of the cache line in bytes. */
+#define QSPI_CACHE_LINE_SIZE 16
+#endif
+
 /** @brief QSPI driver states.*/
 typedef enum
 {
@@ -90,21 +115,39 @@ typedef enum
 /** @brief Control block - driver instance local data. */
 typedef struct
 {
-    nrfx_qspi_handler_t handler;            /**< Handler. */
-    void *              p_context;          /**< Driver context used in interrupt. */
-    void *              p_buffer_primary;   /**< Pointer to the primary buffer. */
-    void *              p_buffer_secondary; /**< Pointer to the secondary buffer. */
-    uint32_t            size_primary;       /**< Size of the primary buffer. */
-    uint32_t            size_secondary;     /**< Size of the secondary buffer. */
-    uint32_t            addr_primary;       /**< Address for the primary buffer. */
-    uint32_t            addr_secondary;     /**< Address for the secondary buffer. */
-    nrfx_qspi_evt_ext_t evt_ext;            /**< Extended event. */
-    nrfx_qspi_state_t   state;              /**< Driver state. */
-    bool                skip_gpio_cfg;      /**< Do not touch GPIO configuration of used pins. */
+    nrfx_qspi_handler_t   handler;            /**< Handler. */
+    void *                p_context;          /**< Driver context used in interrupt. */
+    void *                p_buffer_primary;   /**< Pointer to the primary buffer. */
+    void *                p_buffer_secondary; /**< Pointer to the secondary buffer. */
+    uint32_t              size_primary;       /**< Size of the primary buffer. */
+    uint32_t              size_secondary;     /**< Size of the secondary buffer. */
+    uint32_t              addr_primary;       /**< Address for the primary buffer. */
+    uint32_t              addr_secondary;     /**< Address for the secondary buffer. */
+    nrfx_qspi_evt_ext_t   evt_ext;            /**< Extended event. */
+    nrfx_qspi_state_t     state;              /**< Driver state. */
+    bool                  skip_gpio_cfg;      /**< Do not touch GPIO configuration of used pins. */
+    nrfx_qspi_job_t *     p_job;              /**< Job currently being executed. */
+    nrfx_qspi_job_t *     p_job_head;         /**< Head of the read and write job queue. */
+    nrfx_qspi_job_t *     p_job_tail;         /**< Tail of the read and write job queue. */
+    nrfx_qspi_job_t *     p_erase_head;       /**< Head of the erase job queue. */
+    nrfx_qspi_job_t *     p_erase_tail;       /**< Tail of the erase job queue. */
+    size_t                sg_length;          /**< Length of the current scatter-gather transfer. */
+    bool                  sg_bounced;         /**< Current scatter-gather transfer uses the bounce buffer. */
+    uint32_t              sg_bounce[NRFX_QSPI_SG_BOUNCE_SIZE / sizeof(uint32_t)];
+                                              /**< Bounce buffer for scatter-gather fragments. */
+    bool                  dpm_auto;           /**< Automatic DPM is enabled. */
+    bool                  dpm_active;         /**< The memory was put into DPM by the driver. */
+    uint32_t              dpm_timeout;        /**< Idle time after which the memory enters DPM. */
+    uint32_t              dpm_idle;           /**< Idle time counted since the last access. */
+    nrfx_qspi_dpm_stats_t dpm_stats;          /**< Automatic DPM statistics. */
 } qspi_control_block_t;
 
 static qspi_control_block_t m_cb;
 
+static void qspi_job_next_start(void);
+
+static nrfx_err_t qspi_dpm_wake(void);
+
 static nrfx_err_t qspi_xfer(void *            p_buffer,
                             size_t            length,
                             uint32_t          address,
@@ -124,6 +167,12 @@ static nrfx_err_t qspi_xfer(void *            p_buffer,
         return NRFX_ERROR_BUSY;
     }
 
+    nrfx_err_t err_code = qspi_dpm_wake();
+    if (err_code != NRFX_SUCCESS)
+    {
+        return err_code;
+    }
+
     bool is_first_buffer = false;
     if (m_cb.handler)
     {
@@ -173,6 +222,183 @@ static nrfx_err_t qspi_xfer(void *            p_buffer,
     return NRFX_SUCCESS;
 }
 
+/**
+ * @brief Function for copying data between the scatter-gather segments and the bounce buffer.
+ *
+ * The job position in the segment array is advanced by the number of bytes copied.
+ *
+ * @param[in,out] p_job     Scatter-gather job.
+ * @param[in]     length    Number of bytes to copy.
+ * @param[in]     to_bounce True if data is to be copied from the segments to the bounce buffer,
+ *                          false if in the opposite direction.
+ *
+ * @return Number of bytes copied. Lower than @p length if the end of the segment array was reached.
+ */
+static size_t qspi_sg_copy(nrfx_qspi_job_t * p_job, size_t length, bool to_bounce)
+{
+    uint8_t * p_bounce = (uint8_t *)m_cb.sg_bounce;
+    size_t    copied   = 0;
+
+    while ((copied < length) && (p_job->iov_idx < p_job->iov_count))
+    {
+        nrfx_qspi_iovec_t const * p_seg  = &p_job->p_iov[p_job->iov_idx];
+        uint8_t *                 p_data = (uint8_t *)p_seg->p_buffer + p_job->iov_offset;
+        size_t                    chunk  = NRFX_MIN(p_seg->length - p_job->iov_offset,
+                                                    length - copied);
+
+        if (to_bounce)
+        {
+            memcpy(&p_bounce[copied], p_data, chunk);
+        }
+        else
+        {
+            memcpy(p_data, &p_bounce[copied], chunk);
+        }
+        copied            += chunk;
+        p_job->iov_offset += chunk;
+        if (p_job->iov_offset == p_seg->length)
+        {
+            p_job->iov_idx++;
+            p_job->iov_offset = 0;
+        }
+    }
+    return copied;
+}
+
+/**
+ * @brief Function for preparing the next transfer of a scatter-gather job.
+ *
+ * Segment parts that can be handled by EasyDMA are transferred directly. Other fragments are
+ * transferred through the bounce buffer. For writes, the bounce buffer is filled with the data
+ * and padded with 0xFF bytes.
+ *
+ * @param[in,out] p_job      Scatter-gather job.
+ * @param[out]    pp_buffer  Buffer to be used for the transfer.
+ * @param[out]    p_length   Length of the transfer in bytes.
+ * @param[out]    p_bounced  True if the bounce buffer is used for the transfer.
+ *
+ * @retval true  The transfer is prepared.
+ * @retval false All segments were transferred.
+ */
+static bool qspi_sg_step_prepare(nrfx_qspi_job_t * p_job,
+                                 void **           pp_buffer,
+                                 size_t *          p_length,
+                                 bool *            p_bounced)
+{
+    while ((p_job->iov_idx < p_job->iov_count) &&
+           (p_job->p_iov[p_job->iov_idx].length == 0))
+    {
+        p_job->iov_idx++;
+    }
+    if (p_job->iov_idx >= p_job->iov_count)
+    {
+        return false;
+    }
+
+    nrfx_qspi_iovec_t const * p_seg     = &p_job->p_iov[p_job->iov_idx];
+    uint8_t *                 p_data    = (uint8_t *)p_seg->p_buffer + p_job->iov_offset;
+    size_t                    remaining = p_seg->length - p_job->iov_offset;
+
+    if (nrfx_is_in_ram(p_data) && nrfx_is_word_aligned(p_data) &&
+        (remaining >= sizeof(uint32_t)))
+    {
+        *pp_buffer = p_data;
+        *p_length  = remaining & ~(sizeof(uint32_t) - 1);
+        *p_bounced = false;
+
+        p_job->iov_offset += *p_length;
+        if (p_job->iov_offset == p_seg->length)
+        {
+            p_job->iov_idx++;
+            p_job->iov_offset = 0;
+        }
+    }
+    else
+    {
+        size_t length = NRFX_MIN(NRFX_QSPI_SG_BOUNCE_SIZE,
+                                 NRFX_CEIL_DIV(remaining, sizeof(uint32_t)) * sizeof(uint32_t));
+
+        if (p_job->type == NRFX_QSPI_JOB_WRITEV)
+        {
+            size_t copied = qspi_sg_copy(p_job, length, true);
+            memset((uint8_t *)m_cb.sg_bounce + copied, 0xFF, length - copied);
+        }
+        *pp_buffer = m_cb.sg_bounce;
+        *p_length  = length;
+        *p_bounced = true;
+    }
+    return true;
+}
+
+/**
+ * @brief Function for finalizing a completed transfer of a scatter-gather job.
+ *
+ * @param[in,out] p_job   Scatter-gather job.
+ * @param[in]     length  Length of the completed transfer in bytes.
+ * @param[in]     bounced True if the bounce buffer was used for the transfer.
+ */
+static void qspi_sg_step_complete(nrfx_qspi_job_t * p_job, size_t length, bool bounced)
+{
+    if (bounced && (p_job->type == NRFX_QSPI_JOB_READV))
+    {
+        (void)qspi_sg_copy(p_job, length, false);
+    }
+    p_job->progress += length;
+}
+
+static nrfx_err_t qspi_xferv(nrfx_qspi_iovec_t const * p_iov,
+                             size_t                    iov_count,
+                             uint32_t                  address,
+                             nrfx_qspi_job_type_t      type)
+{
+    NRFX_ASSERT(m_cb.state != NRFX_QSPI_STATE_UNINITIALIZED);
+    NRFX_ASSERT(p_iov || (iov_count == 0));
+
+    if (m_cb.handler)
+    {
+        return NRFX_ERROR_FORBIDDEN;
+    }
+
+    if (!nrfx_is_word_aligned((void const *)address))
+    {
+        return NRFX_ERROR_INVALID_ADDR;
+    }
+
+    nrfx_qspi_job_t job = {
+        .type      = type,
+        .address   = address,
+        .p_iov     = p_iov,
+        .iov_count = iov_count,
+    };
+    void * p_buffer;
+    size_t length;
+    bool   bounced;
+
+    while (qspi_sg_step_prepare(&job, &p_buffer, &length, &bounced))
+    {
+        nrf_qspi_task_t task;
+        if (type == NRFX_QSPI_JOB_WRITEV)
+        {
+            nrf_qspi_write_buffer_set(NRF_QSPI, p_buffer, length, address + job.progress);
+            task = NRF_QSPI_TASK_WRITESTART;
+        }
+        else
+        {
+            nrf_qspi_read_buffer_set(NRF_QSPI, p_buffer, length, address + job.progress);
+            task = NRF_QSPI_TASK_READSTART;
+        }
+
+        nrf_qspi_event_clear(NRF_QSPI, NRF_QSPI_EVENT_READY);
+        nrf_qspi_task_trigger(NRF_QSPI, task);
+        while (!nrf_qspi_event_check(NRF_QSPI, NRF_QSPI_EVENT_READY))
+        {}
+
+        qspi_sg_step_complete(&job, length, bounced);
+    }
+
+    return NRFX_SUCCESS;
+}
+
 static bool qspi_pins_configure(nrfx_qspi_config_t const * p_config)
 {
     // If both GPIO configuration and pin selection are to be skipped,
@@ -262,10 +488,9 @@ static void qspi_pins_deconfigure(void)
 static nrfx_err_t qspi_ready_wait(void)
 {
     bool result;
-    NRFX_WAIT_FOR(nrf_qspi_event_check(NRF_QSPI, NRF_QSPI_EVENT_READY),
-                                       QSPI_DEF_WAIT_ATTEMPTS,
-                                       QSPI_DEF_WAIT_TIME_US,
-                                       result);
+    NRFX_COREDEP_WAIT_FOR_US(nrf_qspi_event_check(NRF_QSPI, NRF_QSPI_EVENT_READY),
+                             QSPI_DEF_WAIT_ATTEMPTS * QSPI_DEF_WAIT_TIME_US,
+                             result);
     if (!result)
     {
         return NRFX_ERROR_TIMEOUT;
@@ -274,6 +499,76 @@ static nrfx_err_t qspi_ready_wait(void)
     return NRFX_SUCCESS;
 }
 
+/*
+ * The peripheral stays activated from the initialization until the uninitialization of
+ * the driver, so the DPM helpers below access the IFCONFIG1 register without the anomaly
+ * 215 and 43 workaround. The ACTIVATE task is avoided on purpose, as it must not be
+ * triggered while the memory is in DPM.
+ */
+
+/** @brief Function for putting the memory into the Deep Power-down Mode. */
+static void qspi_dpm_enter(void)
+{
+    nrf_qspi_int_disable(NRF_QSPI, NRF_QSPI_INT_READY_MASK);
+    nrf_qspi_dpmen_set(NRF_QSPI, true);
+
+    m_cb.dpm_active = true;
+    m_cb.dpm_stats.enter_count++;
+}
+
+/**
+ * @brief Function for waking the memory up before an access.
+ *
+ * The function also resets the idle time counted for the automatic DPM.
+ *
+ * @retval NRFX_SUCCESS       The memory is ready for the access.
+ * @retval NRFX_ERROR_TIMEOUT The memory did not leave DPM in time.
+ */
+static nrfx_err_t qspi_dpm_wake(void)
+{
+    m_cb.dpm_idle = 0;
+    if (!m_cb.dpm_active)
+    {
+        return NRFX_SUCCESS;
+    }
+
+    // Entering DPM may still be in progress and DPMEN must not be changed until it ends.
+    bool result;
+    NRFX_COREDEP_WAIT_FOR_US(!nrf_qspi_busy_check(NRF_QSPI),
+                             QSPI_DEF_WAIT_ATTEMPTS * QSPI_DEF_WAIT_TIME_US,
+                             result);
+    if (!result)
+    {
+        return NRFX_ERROR_TIMEOUT;
+    }
+
+    nrf_qspi_int_disable(NRF_QSPI, NRF_QSPI_INT_READY_MASK);
+    nrf_qspi_dpmen_set(NRF_QSPI, false);
+
+    // The peripheral stays busy for the DPMDUR.EXIT time (tRES1) after sending
+    // the release command. Count the wait to provide the wake-up statistics.
+    uint32_t wake_us = 0;
+    while (nrf_qspi_dpm_check(NRF_QSPI) || nrf_qspi_busy_check(NRF_QSPI))
+    {
+        if (wake_us >= QSPI_DEF_WAIT_ATTEMPTS * QSPI_DEF_WAIT_TIME_US)
+        {
+            return NRFX_ERROR_TIMEOUT;
+        }
+        nrfx_coredep_delay_us(1);
+        wake_us++;
+    }
+
+    m_cb.dpm_active = false;
+    m_cb.dpm_stats.wake_count++;
+    m_cb.dpm_stats.wake_time_us_total += wake_us;
+    if (wake_us > m_cb.dpm_stats.wake_time_us_max)
+    {
+        m_cb.dpm_stats.wake_time_us_max = wake_us;
+    }
+
+    return NRFX_SUCCESS;
+}
+
 nrfx_err_t nrfx_qspi_init(nrfx_qspi_config_t const * p_config,
                           nrfx_qspi_handler_t        handler,
                           void *                     p_context)
@@ -339,6 +634,14 @@ nrfx_err_t nrfx_qspi_init(nrfx_qspi_config_t const * p_config,
 
     m_cb.p_buffer_primary = NULL;
     m_cb.p_buffer_secondary = NULL;
+    m_cb.p_job = NULL;
+    m_cb.p_job_head = NULL;
+    m_cb.p_job_tail = NULL;
+    m_cb.p_erase_head = NULL;
+    m_cb.p_erase_tail = NULL;
+    m_cb.dpm_auto = false;
+    m_cb.dpm_active = false;
+    memset(&m_cb.dpm_stats, 0, sizeof(m_cb.dpm_stats));
     m_cb.state = NRFX_QSPI_STATE_IDLE;
 
     nrf_qspi_enable(NRF_QSPI);
@@ -362,6 +665,12 @@ nrfx_err_t nrfx_qspi_cinstr_xfer(nrf_qspi_cinstr_conf_t const * p_config,
         return NRFX_ERROR_BUSY;
     }
 
+    nrfx_err_t err_code = qspi_dpm_wake();
+    if (err_code != NRFX_SUCCESS)
+    {
+        return err_code;
+    }
+
     /* In some cases, only opcode should be sent. To prevent execution, set function code is
      * surrounded by an if.
      */
@@ -430,6 +739,12 @@ nrfx_err_t nrfx_qspi_lfm_start(nrf_qspi_cinstr_conf_t const * p_config)
         return NRFX_ERROR_BUSY;
     }
 
+    nrfx_err_t err_code = qspi_dpm_wake();
+    if (err_code != NRFX_SUCCESS)
+    {
+        return err_code;
+    }
+
     /* For transferring arbitrary byte length custom instructions driver has to switch to
      * blocking mode. If driver was previously configured to non-blocking mode, interrupts
      * will get reenabled before next standard transfer.
@@ -466,14 +781,77 @@ nrfx_err_t nrfx_qspi_lfm_start(nrf_qspi_cinstr_conf_t const * p_config)
     return NRFX_SUCCESS;
 }
 
-nrfx_err_t nrfx_qspi_lfm_xfer(void const * p_tx_buffer,
-                              void *       p_rx_buffer,
-                              size_t       transfer_length,
-                              bool         finalize)
+/**
+ * @brief Function for sending data in the long frame mode with a tight register loop.
+ *
+ * Full frames are loaded into the CINSTRDAT registers as two words and the READY event
+ * is polled directly, without the timeout bookkeeping of @ref qspi_ready_wait.
+ *
+ * @param[in] p_tx     Data to send.
+ * @param[in] length   Number of bytes to send.
+ * @param[in] finalize True if the long frame mode is to be finalized after the last frame.
+ *
+ * @retval NRFX_SUCCESS       The data was sent.
+ * @retval NRFX_ERROR_TIMEOUT A frame was not sent in time. Long frame mode is aborted.
+ */
+static nrfx_err_t qspi_lfm_tx_stream(uint8_t const * p_tx, size_t length, bool finalize)
 {
-    NRFX_ASSERT(m_cb.state != NRFX_QSPI_STATE_UNINITIALIZED);
-    NRFX_ASSERT(nrf_qspi_cinstr_long_transfer_is_ongoing(NRF_QSPI));
+    for (size_t offset = 0; offset < length; offset += 8)
+    {
+        size_t                remaining = length - offset;
+        nrf_qspi_cinstr_len_t frame_len = NRF_QSPI_CINSTR_LEN_9B;
+        bool                  last      = false;
+
+        if (remaining > 8)
+        {
+            uint32_t dat0;
+            uint32_t dat1;
 
+            memcpy(&dat0, &p_tx[offset], sizeof(dat0));
+            memcpy(&dat1, &p_tx[offset + sizeof(dat0)], sizeof(dat1));
+            nrf_qspi_cinstrdata_raw_set(NRF_QSPI, dat0, dat1);
+        }
+        else
+        {
+            frame_len = (nrf_qspi_cinstr_len_t)(remaining + 1);
+            last      = finalize;
+            nrf_qspi_cinstrdata_set(NRF_QSPI, frame_len, &p_tx[offset]);
+        }
+
+        nrf_qspi_event_clear(NRF_QSPI, NRF_QSPI_EVENT_READY);
+        nrf_qspi_cinstr_long_transfer_continue(NRF_QSPI, frame_len, last);
+
+        uint32_t attempts = QSPI_LFM_POLL_ATTEMPTS;
+        while (!nrf_qspi_event_check(NRF_QSPI, NRF_QSPI_EVENT_READY))
+        {
+            if (--attempts == 0)
+            {
+                nrf_qspi_cinstr_long_transfer_continue(NRF_QSPI, NRF_QSPI_CINSTR_LEN_1B, true);
+                return NRFX_ERROR_TIMEOUT;
+            }
+        }
+    }
+
+    return NRFX_SUCCESS;
+}
+
+/**
+ * @brief Function for sending and receiving data in the long frame mode.
+ *
+ * @param[in]  p_tx_buffer     Data to send. Can be NULL if there is nothing to send.
+ * @param[out] p_rx_buffer     Buffer for received data. Can be NULL if there is nothing
+ *                             to receive.
+ * @param[in]  transfer_length Number of bytes to send and receive.
+ * @param[in]  finalize        True if the long frame mode is to be finalized after the last frame.
+ *
+ * @retval NRFX_SUCCESS       The data was transferred.
+ * @retval NRFX_ERROR_TIMEOUT A frame was not transferred in time. Long frame mode is aborted.
+ */
+static nrfx_err_t qspi_lfm_xfer_loop(void const * p_tx_buffer,
+                                     void *       p_rx_buffer,
+                                     size_t       transfer_length,
+                                     bool         finalize)
+{
     nrfx_err_t status = NRFX_SUCCESS;
 
     /* Perform transfers in packets of 8 bytes. Last transfer may be shorter. */
@@ -519,11 +897,45 @@ nrfx_err_t nrfx_qspi_lfm_xfer(void const * p_tx_buffer,
                                     &((uint8_t *)p_rx_buffer)[curr_byte]);
         }
     }
+
+    return status;
+}
+
+nrfx_err_t nrfx_qspi_lfm_xfer(void const * p_tx_buffer,
+                              void *       p_rx_buffer,
+                              size_t       transfer_length,
+                              bool         finalize)
+{
+    NRFX_ASSERT(m_cb.state != NRFX_QSPI_STATE_UNINITIALIZED);
+    NRFX_ASSERT(nrf_qspi_cinstr_long_transfer_is_ongoing(NRF_QSPI));
+
+    nrfx_err_t status;
+
+    if (p_tx_buffer && !p_rx_buffer)
+    {
+        // Send-only transfers, like streaming of a framebuffer, use the tight loop.
+        status = qspi_lfm_tx_stream((uint8_t const *)p_tx_buffer, transfer_length, finalize);
+    }
+    else
+    {
+        status = qspi_lfm_xfer_loop(p_tx_buffer, p_rx_buffer, transfer_length, finalize);
+    }
+
     nrf_qspi_event_clear(NRF_QSPI, NRF_QSPI_EVENT_READY);
 
     if ((finalize) || (status == NRFX_ERROR_TIMEOUT))
     {
         m_cb.state = NRFX_QSPI_STATE_IDLE;
+        if (m_cb.handler)
+        {
+            // Start jobs queued during the long frame mode transfer.
+            NRFX_CRITICAL_SECTION_ENTER();
+            if (m_cb.state == NRFX_QSPI_STATE_IDLE)
+            {
+                qspi_job_next_start();
+            }
+            NRFX_CRITICAL_SECTION_EXIT();
+        }
     }
 
     return status;
@@ -570,6 +982,10 @@ void nrfx_qspi_uninit(void)
         nrf_qspi_cinstr_long_transfer_continue(NRF_QSPI, NRF_QSPI_CINSTR_LEN_1B, true);
     }
 
+    // Do not leave the memory in DPM, as the next initialization may not expect it.
+    (void)qspi_dpm_wake();
+    m_cb.dpm_auto = false;
+
     nrf_qspi_int_disable(NRF_QSPI, NRF_QSPI_INT_READY_MASK);
 
     nrf_qspi_task_trigger(NRF_QSPI, NRF_QSPI_TASK_DEACTIVATE);
@@ -600,6 +1016,20 @@ nrfx_err_t nrfx_qspi_read(void *   p_rx_buffer,
     return qspi_xfer((void *)p_rx_buffer, rx_buffer_length, src_address, NRFX_QSPI_STATE_READ);
 }
 
+nrfx_err_t nrfx_qspi_readv(nrfx_qspi_iovec_t const * p_iov,
+                           size_t                    iov_count,
+                           uint32_t                  src_address)
+{
+    return qspi_xferv(p_iov, iov_count, src_address, NRFX_QSPI_JOB_READV);
+}
+
+nrfx_err_t nrfx_qspi_writev(nrfx_qspi_iovec_t const * p_iov,
+                            size_t                    iov_count,
+                            uint32_t                  dst_address)
+{
+    return qspi_xferv(p_iov, iov_count, dst_address, NRFX_QSPI_JOB_WRITEV);
+}
+
 nrfx_err_t nrfx_qspi_erase(nrf_qspi_erase_len_t length,
                            uint32_t             start_address)
 {
@@ -614,6 +1044,12 @@ nrfx_err_t nrfx_qspi_erase(nrf_qspi_erase_len_t length,
     {
         return NRFX_ERROR_BUSY;
     }
+
+    nrfx_err_t err_code = qspi_dpm_wake();
+    if (err_code != NRFX_SUCCESS)
+    {
+        return err_code;
+    }
     m_cb.state = NRFX_QSPI_STATE_ERASE;
 
     nrf_qspi_erase_ptr_set(NRF_QSPI, start_address, length);
@@ -651,6 +1087,95 @@ bool nrfx_qspi_xfer_buffered_check(void)
     return (bool)m_cb.p_buffer_secondary;
 }
 
+nrfx_err_t nrfx_qspi_dpm_auto_enable(nrfx_qspi_dpm_config_t const * p_config)
+{
+    NRFX_ASSERT(m_cb.state != NRFX_QSPI_STATE_UNINITIALIZED);
+    NRFX_ASSERT(p_config);
+
+    if (m_cb.state != NRFX_QSPI_STATE_IDLE)
+    {
+        return NRFX_ERROR_BUSY;
+    }
+
+    nrf_qspi_dpmdur_set(NRF_QSPI,
+                        (uint16_t)NRFX_CEIL_DIV(p_config->enter_time_us, QSPI_DPMDUR_UNIT_US),
+                        (uint16_t)NRFX_CEIL_DIV(p_config->exit_time_us, QSPI_DPMDUR_UNIT_US));
+    nrf_qspi_ifconfig0_raw_set(NRF_QSPI, nrf_qspi_ifconfig0_raw_get(NRF_QSPI) |
+                                         QSPI_IFCONFIG0_DPMENABLE_Msk);
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    m_cb.dpm_timeout = p_config->idle_timeout;
+    m_cb.dpm_idle = 0;
+    m_cb.dpm_auto = true;
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    return NRFX_SUCCESS;
+}
+
+nrfx_err_t nrfx_qspi_dpm_auto_disable(void)
+{
+    NRFX_ASSERT(m_cb.state != NRFX_QSPI_STATE_UNINITIALIZED);
+
+    if (m_cb.state != NRFX_QSPI_STATE_IDLE)
+    {
+        return NRFX_ERROR_BUSY;
+    }
+
+    m_cb.dpm_auto = false;
+    nrfx_err_t err_code = qspi_dpm_wake();
+    if (err_code != NRFX_SUCCESS)
+    {
+        return err_code;
+    }
+
+    nrf_qspi_ifconfig0_raw_set(NRF_QSPI, nrf_qspi_ifconfig0_raw_get(NRF_QSPI) &
+                                         ~QSPI_IFCONFIG0_DPMENABLE_Msk);
+    return NRFX_SUCCESS;
+}
+
+void nrfx_qspi_dpm_idle_process(uint32_t elapsed)
+{
+    NRFX_ASSERT(m_cb.state != NRFX_QSPI_STATE_UNINITIALIZED);
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    if (m_cb.dpm_auto && !m_cb.dpm_active)
+    {
+        if ((m_cb.state != NRFX_QSPI_STATE_IDLE) || nrf_qspi_busy_check(NRF_QSPI))
+        {
+            // Transfers in blocking mode do not change the driver state.
+            m_cb.dpm_idle = 0;
+        }
+        else if (m_cb.dpm_idle >= m_cb.dpm_timeout)
+        {
+            // The timeout is checked before the elapsed time is added, so that the memory
+            // does not enter DPM between the wake-up and the start of an access that was
+            // requested right before this call.
+            qspi_dpm_enter();
+        }
+        else
+        {
+            m_cb.dpm_idle += elapsed;
+        }
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+}
+
+void nrfx_qspi_dpm_stats_get(nrfx_qspi_dpm_stats_t * p_stats)
+{
+    NRFX_ASSERT(p_stats);
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    *p_stats = m_cb.dpm_stats;
+    NRFX_CRITICAL_SECTION_EXIT();
+}
+
+void nrfx_qspi_dpm_stats_clear(void)
+{
+    NRFX_CRITICAL_SECTION_ENTER();
+    memset(&m_cb.dpm_stats, 0, sizeof(m_cb.dpm_stats));
+    NRFX_CRITICAL_SECTION_EXIT();
+}
+
 #if NRF_QSPI_HAS_XIP_ENC
 nrfx_err_t nrfx_qspi_xip_encrypt(nrf_qspi_encryption_t const * p_config)
 {
@@ -699,6 +1224,294 @@ nrfx_err_t nrfx_qspi_dma_encrypt(nrf_qspi_encryption_t const * p_config)
 }
 #endif
 
+#if defined(CACHE_PRESENT) && !defined(NRF_TRUSTZONE_NONSECURE)
+void nrfx_qspi_xip_cache_configure(bool enable, bool profiling)
+{
+    if (enable)
+    {
+        nrf_cache_invalidate(NRF_CACHE);
+        nrf_cache_enable(NRF_CACHE);
+    }
+    else
+    {
+        nrf_cache_disable(NRF_CACHE);
+    }
+    nrf_cache_profiling_set(NRF_CACHE, profiling);
+}
+
+void nrfx_qspi_xip_prefetch(uint32_t offset, size_t length)
+{
+    uint32_t addr = QSPI_XIP_START_ADDR + (offset & ~(uint32_t)(QSPI_CACHE_LINE_SIZE - 1));
+    uint32_t end  = QSPI_XIP_START_ADDR + offset + length;
+
+    for (; addr < end; addr += QSPI_CACHE_LINE_SIZE)
+    {
+        (void)*(uint32_t const volatile *)addr;
+    }
+}
+
+void nrfx_qspi_xip_cache_stats_get(nrfx_qspi_xip_cache_stats_t * p_stats)
+{
+    NRFX_ASSERT(p_stats);
+
+    p_stats->instruction_hits   = nrf_cache_instruction_hit_counter_get(NRF_CACHE,
+                                                                        NRF_CACHE_REGION_XIP);
+    p_stats->instruction_misses = nrf_cache_instruction_miss_counter_get(NRF_CACHE,
+                                                                         NRF_CACHE_REGION_XIP);
+    p_stats->data_hits          = nrf_cache_data_hit_counter_get(NRF_CACHE,
+                                                                 NRF_CACHE_REGION_XIP);
+    p_stats->data_misses        = nrf_cache_data_miss_counter_get(NRF_CACHE,
+                                                                  NRF_CACHE_REGION_XIP);
+}
+
+void nrfx_qspi_xip_cache_stats_clear(void)
+{
+    nrf_cache_profiling_counters_clear(NRF_CACHE);
+}
+#endif
+
+/**
+ * @brief Function for appending the job to the queue.
+ *
+ * @param[in]     p_job   Job to be appended.
+ * @param[in,out] pp_head Pointer to the queue head.
+ * @param[in,out] pp_tail Pointer to the queue tail.
+ */
+static void qspi_job_append(nrfx_qspi_job_t *  p_job,
+                            nrfx_qspi_job_t ** pp_head,
+                            nrfx_qspi_job_t ** pp_tail)
+{
+    p_job->p_next = NULL;
+    if (*pp_tail)
+    {
+        (*pp_tail)->p_next = p_job;
+    }
+    else
+    {
+        *pp_head = p_job;
+    }
+    *pp_tail = p_job;
+}
+
+/**
+ * @brief Function for starting the next transfer or block erase of the job.
+ *
+ * @param[in] p_job Job to be continued.
+ *
+ * @retval true  The operation was started.
+ * @retval false The job has no more data to transfer.
+ */
+static bool qspi_job_step_start(nrfx_qspi_job_t * p_job)
+{
+    nrf_qspi_task_t task;
+
+    switch (p_job->type)
+    {
+        case NRFX_QSPI_JOB_READ:
+            m_cb.state = NRFX_QSPI_STATE_READ;
+            nrf_qspi_read_buffer_set(NRF_QSPI, p_job->p_buffer, p_job->length, p_job->address);
+            task = NRF_QSPI_TASK_READSTART;
+            break;
+
+        case NRFX_QSPI_JOB_WRITE:
+            m_cb.state = NRFX_QSPI_STATE_WRITE;
+            nrf_qspi_write_buffer_set(NRF_QSPI, p_job->p_buffer, p_job->length, p_job->address);
+            task = NRF_QSPI_TASK_WRITESTART;
+            break;
+
+        case NRFX_QSPI_JOB_READV:
+        case NRFX_QSPI_JOB_WRITEV:
+        {
+            void * p_buffer;
+
+            if (!qspi_sg_step_prepare(p_job, &p_buffer, &m_cb.sg_length, &m_cb.sg_bounced))
+            {
+                return false;
+            }
+            if (p_job->type == NRFX_QSPI_JOB_READV)
+            {
+                m_cb.state = NRFX_QSPI_STATE_READ;
+                nrf_qspi_read_buffer_set(NRF_QSPI, p_buffer, m_cb.sg_length,
+                                         p_job->address + p_job->progress);
+                task = NRF_QSPI_TASK_READSTART;
+            }
+            else
+            {
+                m_cb.state = NRFX_QSPI_STATE_WRITE;
+                nrf_qspi_write_buffer_set(NRF_QSPI, p_buffer, m_cb.sg_length,
+                                          p_job->address + p_job->progress);
+                task = NRF_QSPI_TASK_WRITESTART;
+            }
+            break;
+        }
+
+        default:
+        {
+            uint32_t block_size = (p_job->erase_len == NRF_QSPI_ERASE_LEN_64KB) ?
+                                  0x10000 : 0x1000;
+
+            m_cb.state = NRFX_QSPI_STATE_ERASE;
+            nrf_qspi_erase_ptr_set(NRF_QSPI,
+                                   p_job->address + p_job->progress * block_size,
+                                   p_job->erase_len);
+            task = NRF_QSPI_TASK_ERASESTART;
+            break;
+        }
+    }
+
+    nrf_qspi_event_clear(NRF_QSPI, NRF_QSPI_EVENT_READY);
+    nrf_qspi_int_enable(NRF_QSPI, NRF_QSPI_INT_READY_MASK);
+    nrf_qspi_task_trigger(NRF_QSPI, task);
+    return true;
+}
+
+/**
+ * @brief Function for starting the next queued job.
+ *
+ * Reads and writes take precedence over erase jobs, which are executed one block at a time.
+ * Must be called with the QSPI interrupt masked or from the QSPI interrupt handler.
+ */
+static void qspi_job_next_start(void)
+{
+    nrfx_qspi_job_t * p_job = m_cb.p_job_head;
+
+    if (p_job)
+    {
+        m_cb.p_job_head = p_job->p_next;
+        if (!m_cb.p_job_head)
+        {
+            m_cb.p_job_tail = NULL;
+        }
+    }
+    else
+    {
+        // Erase job stays in the queue until its last block is erased.
+        p_job = m_cb.p_erase_head;
+    }
+
+    m_cb.p_job = p_job;
+    if (!p_job)
+    {
+        m_cb.state = NRFX_QSPI_STATE_IDLE;
+        return;
+    }
+
+    (void)qspi_job_step_start(p_job);
+}
+
+nrfx_err_t nrfx_qspi_job_submit(nrfx_qspi_job_t * p_job)
+{
+    NRFX_ASSERT(m_cb.state != NRFX_QSPI_STATE_UNINITIALIZED);
+    NRFX_ASSERT(p_job);
+
+    if (!m_cb.handler)
+    {
+        return NRFX_ERROR_FORBIDDEN;
+    }
+
+    if (!nrfx_is_word_aligned((void const *)p_job->address))
+    {
+        return NRFX_ERROR_INVALID_ADDR;
+    }
+
+    if (p_job->type == NRFX_QSPI_JOB_ERASE)
+    {
+        if ((p_job->erase_count == 0) ||
+            ((p_job->erase_len == NRF_QSPI_ERASE_LEN_ALL) && (p_job->erase_count != 1)))
+        {
+            return NRFX_ERROR_INVALID_PARAM;
+        }
+    }
+    else if ((p_job->type == NRFX_QSPI_JOB_READV) || (p_job->type == NRFX_QSPI_JOB_WRITEV))
+    {
+        size_t total = 0;
+
+        NRFX_ASSERT(p_job->p_iov || (p_job->iov_count == 0));
+        for (size_t i = 0; i < p_job->iov_count; i++)
+        {
+            total += p_job->p_iov[i].length;
+        }
+        if (total == 0)
+        {
+            return NRFX_ERROR_INVALID_PARAM;
+        }
+    }
+    else if (!nrfx_is_in_ram(p_job->p_buffer) || !nrfx_is_word_aligned(p_job->p_buffer))
+    {
+        return NRFX_ERROR_INVALID_ADDR;
+    }
+
+    p_job->progress   = 0;
+    p_job->iov_idx    = 0;
+    p_job->iov_offset = 0;
+
+    if (m_cb.state == NRFX_QSPI_STATE_IDLE)
+    {
+        nrfx_err_t err_code = qspi_dpm_wake();
+        if (err_code != NRFX_SUCCESS)
+        {
+            return err_code;
+        }
+    }
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    if (p_job->type == NRFX_QSPI_JOB_ERASE)
+    {
+        qspi_job_append(p_job, &m_cb.p_erase_head, &m_cb.p_erase_tail);
+    }
+    else
+    {
+        qspi_job_append(p_job, &m_cb.p_job_head, &m_cb.p_job_tail);
+    }
+
+    if (m_cb.state == NRFX_QSPI_STATE_IDLE)
+    {
+        qspi_job_next_start();
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    return NRFX_SUCCESS;
+}
+
+/** @brief Function for handling the end of the current job step. */
+static void qspi_job_event_handle(void)
+{
+    nrfx_qspi_job_t * p_job = m_cb.p_job;
+    bool              done  = true;
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    if (p_job->type == NRFX_QSPI_JOB_ERASE)
+    {
+        p_job->progress++;
+        done = (p_job->progress >= p_job->erase_count);
+        if (done)
+        {
+            m_cb.p_erase_head = p_job->p_next;
+            if (!m_cb.p_erase_head)
+            {
+                m_cb.p_erase_tail = NULL;
+            }
+        }
+    }
+    else if ((p_job->type == NRFX_QSPI_JOB_READV) || (p_job->type == NRFX_QSPI_JOB_WRITEV))
+    {
+        // Chain the next transfer of the job without going through the queue.
+        qspi_sg_step_complete(p_job, m_cb.sg_length, m_cb.sg_bounced);
+        done = !qspi_job_step_start(p_job);
+    }
+
+    if (done || (p_job->type == NRFX_QSPI_JOB_ERASE))
+    {
+        qspi_job_next_start();
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    if (done && p_job->handler)
+    {
+        p_job->handler(p_job, p_job->p_context);
+    }
+}
+
 static void qspi_event_xfer_handle(nrfx_qspi_evt_ext_xfer_t * p_xfer)
 {
     p_xfer->p_buffer = (uint8_t *)m_cb.p_buffer_primary;
@@ -748,13 +1561,21 @@ static void qspi_extended_event_process(nrfx_qspi_evt_ext_t * p_event)
     }
 }
 
-void nrfx_qspi_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_qspi_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(qspi);
     // Catch Event ready interrupts
     if (nrf_qspi_event_check(NRF_QSPI, NRF_QSPI_EVENT_READY))
     {
         nrf_qspi_event_clear(NRF_QSPI, NRF_QSPI_EVENT_READY);
 
+        if (m_cb.p_job)
+        {
+            qspi_job_event_handle();
+            NRFX_PROF_IRQ_EXIT();
+            return;
+        }
+
         qspi_extended_event_process(&m_cb.evt_ext);
         if (!m_cb.p_buffer_primary)
         {
@@ -763,7 +1584,19 @@ void nrfx_qspi_irq_handler(void)
 
         m_cb.handler(NRFX_QSPI_EVENT_DONE, m_cb.p_context);
         m_cb.evt_ext.type = NRFX_QSPI_EVENT_NONE;
+
+        if (m_cb.state == NRFX_QSPI_STATE_IDLE)
+        {
+            // Start jobs queued while the operation was in progress.
+            NRFX_CRITICAL_SECTION_ENTER();
+            if (m_cb.state == NRFX_QSPI_STATE_IDLE)
+            {
+                qspi_job_next_start();
+            }
+            NRFX_CRITICAL_SECTION_EXIT();
+        }
     }
+    NRFX_PROF_IRQ_EXIT();
 }
 
 #endif // NRFX_CHECK(NRFX_QSPI_ENABLED)
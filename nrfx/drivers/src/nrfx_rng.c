@@ -36,6 +36,7 @@
 #if NRFX_CHECK(NRFX_RNG_ENABLED)
 
 #include <nrfx_rng.h>
+#include <helpers/nrfx_prof.h>
 
 #define NRFX_LOG_MODULE RNG
 #include <nrfx_log.h>
@@ -50,6 +51,30 @@ static nrfx_drv_state_t m_rng_state;
  */
 static nrfx_rng_evt_handler_t m_rng_hndl;
 
+/**
+ * @brief Error correction setting from the driver configuration.
+ */
+static bool m_rng_error_correction;
+
+/**
+ * @brief Entropy pool.
+ *
+ * The pool is a ring with a single producer (interrupt handler) and possibly
+ * multiple consumers. Both indices are free-running. Consumers copy bytes
+ * first and then claim them by advancing the tail with compare-and-swap,
+ * so the producer cannot overwrite bytes that are being copied.
+ */
+typedef struct
+{
+    uint8_t * volatile p_buffer;      ///< Pool buffer, NULL if the pool is disabled.
+    uint32_t           mask;          ///< Pool size minus one.
+    uint32_t           low_watermark; ///< Fill level below which generation is restarted.
+    volatile uint32_t  head;          ///< Number of bytes stored by the producer.
+    nrfx_atomic_t      tail;          ///< Number of bytes taken by consumers.
+} rng_pool_t;
+
+static rng_pool_t m_rng_pool;
+
 nrfx_err_t nrfx_rng_init(nrfx_rng_config_t const * p_config, nrfx_rng_evt_handler_t handler)
 {
     NRFX_ASSERT(p_config);
@@ -60,6 +85,7 @@ nrfx_err_t nrfx_rng_init(nrfx_rng_config_t const * p_config, nrfx_rng_evt_handle
     }
 
     m_rng_hndl = handler;
+    m_rng_error_correction = p_config->error_correction;
 
     if (p_config->error_correction)
     {
@@ -89,10 +115,89 @@ void nrfx_rng_stop(void)
     nrf_rng_task_trigger(NRF_RNG, NRF_RNG_TASK_STOP);
 }
 
+nrfx_err_t nrfx_rng_pool_enable(uint8_t * p_buffer, uint16_t size, uint16_t low_watermark)
+{
+    NRFX_ASSERT(p_buffer);
+    NRFX_ASSERT(size && ((size & (size - 1)) == 0));
+    NRFX_ASSERT(low_watermark <= size);
+
+    nrfx_err_t err_code;
+
+    if ((m_rng_state != NRFX_DRV_STATE_INITIALIZED) || m_rng_pool.p_buffer)
+    {
+        err_code = NRFX_ERROR_INVALID_STATE;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    m_rng_pool.mask          = size - 1;
+    m_rng_pool.low_watermark = low_watermark;
+    m_rng_pool.head          = 0;
+    m_rng_pool.tail          = 0;
+    m_rng_pool.p_buffer      = p_buffer;
+
+    nrf_rng_error_correction_enable(NRF_RNG);
+    nrfx_rng_start();
+
+    return NRFX_SUCCESS;
+}
+
+void nrfx_rng_pool_disable(void)
+{
+    NRFX_ASSERT(m_rng_state == NRFX_DRV_STATE_INITIALIZED);
+
+    nrfx_rng_stop();
+    m_rng_pool.p_buffer = NULL;
+    if (!m_rng_error_correction)
+    {
+        nrf_rng_error_correction_disable(NRF_RNG);
+    }
+}
+
+uint16_t nrfx_rng_pool_get(uint8_t * p_buf, uint16_t len)
+{
+    NRFX_ASSERT(p_buf);
+
+    uint8_t const * p_pool = m_rng_pool.p_buffer;
+    uint32_t        tail;
+    uint32_t        count;
+
+    if (!p_pool)
+    {
+        return 0;
+    }
+
+    do {
+        tail = m_rng_pool.tail;
+        count = m_rng_pool.head - tail;
+        if (count > len)
+        {
+            count = len;
+        }
+        for (uint32_t i = 0; i < count; i++)
+        {
+            p_buf[i] = p_pool[(tail + i) & m_rng_pool.mask];
+        }
+    } while (count && !NRFX_ATOMIC_CAS(&m_rng_pool.tail, tail, tail + count));
+
+    // Starting an already running generation is harmless, so the pool
+    // is refilled whenever it was found below the watermark.
+    if ((m_rng_pool.head - m_rng_pool.tail) < m_rng_pool.low_watermark)
+    {
+        nrfx_rng_start();
+    }
+
+    return (uint16_t)count;
+}
+
 void nrfx_rng_uninit(void)
 {
     NRFX_ASSERT(m_rng_state == NRFX_DRV_STATE_INITIALIZED);
 
+    m_rng_pool.p_buffer = NULL;
+
     nrf_rng_int_disable(NRF_RNG, NRF_RNG_INT_VALRDY_MASK);
     nrf_rng_task_trigger(NRF_RNG, NRF_RNG_TASK_STOP);
     NRFX_IRQ_DISABLE(RNG_IRQn);
@@ -101,15 +206,37 @@ void nrfx_rng_uninit(void)
     NRFX_LOG_INFO("Uninitialized.");
 }
 
-void nrfx_rng_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_rng_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(rng);
     nrf_rng_event_clear(NRF_RNG, NRF_RNG_EVENT_VALRDY);
 
     uint8_t rng_value = nrf_rng_random_value_get(NRF_RNG);
 
-    m_rng_hndl(rng_value);
+    uint8_t * p_pool = m_rng_pool.p_buffer;
+    if (p_pool)
+    {
+        uint32_t head = m_rng_pool.head;
+        uint32_t used = head - m_rng_pool.tail;
+        if (used <= m_rng_pool.mask)
+        {
+            p_pool[head & m_rng_pool.mask] = rng_value;
+            m_rng_pool.head = ++head;
+            used++;
+        }
+        if (used > m_rng_pool.mask)
+        {
+            // The pool is full, generation is resumed when it drops below the watermark.
+            nrfx_rng_stop();
+        }
+    }
+    else
+    {
+        m_rng_hndl(rng_value);
+    }
 
     NRFX_LOG_DEBUG("Event: NRF_RNG_EVENT_VALRDY.");
+    NRFX_PROF_IRQ_EXIT();
 }
 
 #endif // NRFX_CHECK(NRFX_RNG_ENABLED)
@@ -41,6 +41,7 @@
 #endif
 
 #include <nrfx_rtc.h>
+#include <helpers/nrfx_prof.h>
 
 #define NRFX_LOG_MODULE RTC
 #include <nrfx_log.h>
@@ -279,9 +280,9 @@ uint32_t nrfx_rtc_max_ticks_get(nrfx_rtc_t const * p_instance)
     return ticks;
 }
 
-static void irq_handler(NRF_RTC_Type * p_reg,
-                        uint32_t       instance_id,
-                        uint32_t       channel_count)
+NRFX_IRQ_HANDLER_ATTR static void irq_handler(NRF_RTC_Type * p_reg,
+                                              uint32_t       instance_id,
+                                              uint32_t       channel_count)
 {
     uint32_t i;
     uint32_t int_mask = (uint32_t)NRF_RTC_INT_COMPARE0_MASK;
@@ -326,23 +327,29 @@ static void irq_handler(NRF_RTC_Type * p_reg,
 }
 
 #if NRFX_CHECK(NRFX_RTC0_ENABLED)
-void nrfx_rtc_0_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_rtc_0_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(rtc_0);
     irq_handler(NRF_RTC0, NRFX_RTC0_INST_IDX, NRF_RTC_CC_CHANNEL_COUNT(0));
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
 #if NRFX_CHECK(NRFX_RTC1_ENABLED)
-void nrfx_rtc_1_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_rtc_1_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(rtc_1);
     irq_handler(NRF_RTC1, NRFX_RTC1_INST_IDX, NRF_RTC_CC_CHANNEL_COUNT(1));
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
 #if NRFX_CHECK(NRFX_RTC2_ENABLED)
-void nrfx_rtc_2_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_rtc_2_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(rtc_2);
     irq_handler(NRF_RTC2, NRFX_RTC2_INST_IDX, NRF_RTC_CC_CHANNEL_COUNT(2));
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
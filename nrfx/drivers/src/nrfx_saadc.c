@@ -34,6 +34,8 @@
 
 #if NRFX_CHECK(NRFX_SAADC_ENABLED)
 #include <nrfx_saadc.h>
+#include <helpers/nrfx_prof.h>
+#include <helpers/nrfx_gppi.h>
 
 #define NRFX_LOG_MODULE SAADC
 #include <nrfx_log.h>
@@ -52,6 +54,9 @@
 /** @brief Bitmask of all available SAADC channels. */
 #define SAADC_ALL_CHANNELS_MASK ((1UL << SAADC_CH_NUM) - 1UL)
 
+/** @brief Voltage of the internal reference in microvolts. */
+#define SAADC_INTERNAL_REFERENCE_UV 600000UL
+
 /** @brief SAADC driver states.*/
 typedef enum
 {
@@ -62,6 +67,7 @@ typedef enum
     NRF_SAADC_STATE_ADV_MODE,
     NRF_SAADC_STATE_ADV_MODE_SAMPLE,
     NRF_SAADC_STATE_ADV_MODE_SAMPLE_STARTED,
+    NRF_SAADC_STATE_MONITOR,
     NRF_SAADC_STATE_CALIBRATION
 } nrf_saadc_state_t;
 
@@ -73,11 +79,27 @@ typedef struct
     nrf_saadc_value_t *        p_buffer_primary;             ///< Pointer to the primary result buffer.
     nrf_saadc_value_t *        p_buffer_secondary;           ///< Pointer to the secondary result buffer.
     nrf_saadc_value_t          calib_samples[2];             ///< Scratch buffer for post-calibration samples.
+    nrf_saadc_value_t          monitor_scratch[SAADC_CH_NUM]; ///< Scratch buffer for samples taken in the monitoring mode.
+    uint32_t                   monitor_trigger_event;        ///< Address of the event triggering conversions in the monitoring mode.
+    uint8_t                    monitor_sample_ppi_channel;   ///< (D)PPI channel triggering the SAMPLE task in the monitoring mode.
+    uint8_t                    monitor_start_ppi_channel;    ///< (D)PPI channel triggering the START task in the monitoring mode.
     uint16_t                   size_primary;                 ///< Size of the primary result buffer.
     uint16_t                   size_secondary;               ///< Size of the secondary result buffer.
     uint16_t                   samples_converted;            ///< Number of samples present in result buffer when in the blocking mode.
+    nrf_saadc_value_t *        p_ring;                       ///< Pointer to the ring of buffers, NULL if the ring mode is not used.
+    uint16_t                   ring_size;                    ///< Number of samples in each ring buffer.
+    uint8_t                    ring_count;                   ///< Number of buffers in the ring.
+    uint8_t                    ring_next;                    ///< Index of the ring buffer to be latched next.
+    uint32_t                   ring_latched;                 ///< Number of ring buffers latched since the ring was set.
+    volatile uint32_t          ring_released;                ///< Number of ring buffers released by the user.
+    uint32_t                   sequence;                     ///< Sequence number of the primary buffer.
+    bool                       overrun_primary;              ///< Flag indicating that the primary buffer overwrote unreleased data.
+    bool                       overrun_secondary;            ///< Flag indicating that the secondary buffer overwrote unreleased data.
     nrf_saadc_input_t          channels_pselp[SAADC_CH_NUM]; ///< Array holding each channel positive input.
     nrf_saadc_input_t          channels_pseln[SAADC_CH_NUM]; ///< Array holding each channel negative input.
+    uint32_t                   channels_range[SAADC_CH_NUM]; ///< Array holding each channel input range in microvolts, 0 if unknown.
+    uint8_t                    channels_diff;                ///< Bitmask of the channels configured in differential mode.
+    nrf_saadc_resolution_t     resolution;                   ///< Resolution of the samples.
     nrf_saadc_state_t          saadc_state;                  ///< State of the SAADC driver.
     nrf_saadc_state_t          saadc_state_prev;             ///< Previous state of the SAADC driver.
     uint8_t                    channels_configured;          ///< Bitmask of the configured channels.
@@ -146,6 +168,44 @@ static nrfx_err_t saadc_channel_count_get(uint32_t  ch_to_activate_mask,
     return NRFX_SUCCESS;
 }
 
+/**
+ * @brief Function for getting the input range of the channel.
+ *
+ * @param[in] p_config Pointer to the channel configuration.
+ *
+ * @return Voltage in microvolts corresponding to the full scale of the samples,
+ *         0 if it depends on the supply voltage.
+ */
+static uint32_t saadc_channel_range_get(nrf_saadc_channel_config_t const * p_config)
+{
+    if (p_config->reference != NRF_SAADC_REFERENCE_INTERNAL)
+    {
+        return 0;
+    }
+
+    switch (p_config->gain)
+    {
+        case NRF_SAADC_GAIN1_6:
+            return SAADC_INTERNAL_REFERENCE_UV * 6;
+        case NRF_SAADC_GAIN1_5:
+            return SAADC_INTERNAL_REFERENCE_UV * 5;
+        case NRF_SAADC_GAIN1_4:
+            return SAADC_INTERNAL_REFERENCE_UV * 4;
+        case NRF_SAADC_GAIN1_3:
+            return SAADC_INTERNAL_REFERENCE_UV * 3;
+        case NRF_SAADC_GAIN1_2:
+            return SAADC_INTERNAL_REFERENCE_UV * 2;
+        case NRF_SAADC_GAIN1:
+            return SAADC_INTERNAL_REFERENCE_UV;
+        case NRF_SAADC_GAIN2:
+            return SAADC_INTERNAL_REFERENCE_UV / 2;
+        case NRF_SAADC_GAIN4:
+            return SAADC_INTERNAL_REFERENCE_UV / 4;
+        default:
+            return 0;
+    }
+}
+
 static void saadc_channel_config(nrfx_saadc_channel_t const * p_channel)
 {
     NRFX_ASSERT(p_channel->pin_p != NRF_SAADC_INPUT_DISABLED);
@@ -153,6 +213,16 @@ static void saadc_channel_config(nrfx_saadc_channel_t const * p_channel)
     nrf_saadc_channel_init(NRF_SAADC, p_channel->channel_index, &p_channel->channel_config);
     m_cb.channels_pselp[p_channel->channel_index] = p_channel->pin_p;
     m_cb.channels_pseln[p_channel->channel_index] = p_channel->pin_n;
+    m_cb.channels_range[p_channel->channel_index] =
+        saadc_channel_range_get(&p_channel->channel_config);
+    if (p_channel->channel_config.mode == NRF_SAADC_MODE_DIFFERENTIAL)
+    {
+        m_cb.channels_diff |= 1U << p_channel->channel_index;
+    }
+    else
+    {
+        m_cb.channels_diff &= ~(1U << p_channel->channel_index);
+    }
     m_cb.channels_configured |= 1U << p_channel->channel_index;
 }
 
@@ -218,10 +288,12 @@ static void saadc_generic_mode_set(uint32_t                   ch_to_activate_mas
 
     m_cb.p_buffer_primary = NULL;
     m_cb.p_buffer_secondary = NULL;
+    m_cb.p_ring = NULL;
     m_cb.event_handler = event_handler;
     m_cb.channels_activated = ch_to_activate_mask;
     m_cb.samples_converted = 0;
 
+    m_cb.resolution = resolution;
     nrf_saadc_resolution_set(NRF_SAADC, resolution);
     nrf_saadc_oversample_set(NRF_SAADC, oversampling);
     if (event_handler)
@@ -524,6 +596,57 @@ nrfx_err_t nrfx_saadc_buffer_set(nrf_saadc_value_t * p_buffer, uint16_t size)
     return NRFX_SUCCESS;
 }
 
+nrfx_err_t nrfx_saadc_ring_set(nrf_saadc_value_t * p_buffers, uint16_t size, uint8_t count)
+{
+    NRFX_ASSERT(m_cb.saadc_state != NRF_SAADC_STATE_UNINITIALIZED);
+
+    if ((m_cb.saadc_state != NRF_SAADC_STATE_ADV_MODE) || !m_cb.event_handler)
+    {
+        return NRFX_ERROR_INVALID_STATE;
+    }
+
+    if (m_cb.p_buffer_primary)
+    {
+        return NRFX_ERROR_ALREADY_INITIALIZED;
+    }
+
+    if (count < 2)
+    {
+        return NRFX_ERROR_INVALID_PARAM;
+    }
+
+    if (!nrfx_is_in_ram(p_buffers))
+    {
+        return NRFX_ERROR_INVALID_ADDR;
+    }
+
+    if ((size % m_cb.channels_activated_count != 0) ||
+        (size >= (1 << SAADC_EASYDMA_MAXCNT_SIZE))  ||
+        (!size))
+    {
+        return NRFX_ERROR_INVALID_LENGTH;
+    }
+
+    m_cb.p_ring            = p_buffers;
+    m_cb.ring_size         = size;
+    m_cb.ring_count        = count;
+    m_cb.ring_next         = 1;
+    m_cb.ring_latched      = 1;
+    m_cb.ring_released     = 0;
+    m_cb.overrun_primary   = false;
+    m_cb.size_primary      = size;
+    m_cb.p_buffer_primary  = p_buffers;
+
+    return NRFX_SUCCESS;
+}
+
+void nrfx_saadc_ring_buffer_release(void)
+{
+    NRFX_ASSERT(m_cb.ring_released < m_cb.sequence);
+
+    m_cb.ring_released++;
+}
+
 nrfx_err_t nrfx_saadc_mode_trigger(void)
 {
     NRFX_ASSERT(m_cb.saadc_state != NRF_SAADC_STATE_UNINITIALIZED);
@@ -652,6 +775,161 @@ void nrfx_saadc_abort(void)
     }
 }
 
+/**
+ * @brief Function for summing samples of a single channel stored one after another.
+ *
+ * @param[in] p_samples Pointer to the first sample.
+ * @param[in] count     Number of samples to be summed.
+ *
+ * @return Sum of the samples.
+ */
+static int32_t saadc_samples_sum(nrf_saadc_value_t const * p_samples, uint16_t count)
+{
+    int32_t sum = 0;
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+    if (((uint32_t)p_samples & 0x3UL) && count)
+    {
+        sum += *p_samples++;
+        count--;
+    }
+
+    // Sum two halfword samples per instruction.
+    uint32_t const * p_words = (uint32_t const *)p_samples;
+    for (; count >= 2; count -= 2)
+    {
+        sum = (int32_t)__SMLAD(*p_words++, 0x00010001UL, (uint32_t)sum);
+    }
+    p_samples = (nrf_saadc_value_t const *)p_words;
+#endif
+
+    while (count--)
+    {
+        sum += *p_samples++;
+    }
+
+    return sum;
+}
+
+nrfx_err_t nrfx_saadc_samples_process(nrf_saadc_value_t const *   p_samples,
+                                      uint16_t                    size,
+                                      uint16_t                    decimation,
+                                      nrf_saadc_value_t * const * pp_outputs)
+{
+    NRFX_ASSERT(m_cb.saadc_state != NRF_SAADC_STATE_UNINITIALIZED);
+    NRFX_ASSERT(p_samples);
+    NRFX_ASSERT(pp_outputs);
+
+    uint8_t ch_count = m_cb.channels_activated_count;
+    if (!m_cb.channels_activated)
+    {
+        return NRFX_ERROR_INVALID_STATE;
+    }
+
+    if (!decimation)
+    {
+        return NRFX_ERROR_INVALID_PARAM;
+    }
+
+    uint32_t set_size = (uint32_t)ch_count * decimation;
+    if (size % set_size != 0)
+    {
+        return NRFX_ERROR_INVALID_LENGTH;
+    }
+
+    uint16_t out_count = (uint16_t)(size / set_size);
+
+    if (ch_count == 1)
+    {
+        nrf_saadc_value_t * p_out = pp_outputs[0];
+        for (uint16_t i = 0; i < out_count; i++)
+        {
+            int32_t sum = saadc_samples_sum(&p_samples[(uint32_t)i * decimation], decimation);
+            p_out[i] = (nrf_saadc_value_t)(sum / decimation);
+        }
+        return NRFX_SUCCESS;
+    }
+
+    for (uint16_t i = 0; i < out_count; i++)
+    {
+        nrf_saadc_value_t const * p_set = &p_samples[i * set_size];
+        for (uint8_t ch = 0; ch < ch_count; ch++)
+        {
+            int32_t sum = 0;
+            for (uint16_t n = 0; n < decimation; n++)
+            {
+                sum += p_set[(uint32_t)n * ch_count + ch];
+            }
+            pp_outputs[ch][i] = (nrf_saadc_value_t)(sum / decimation);
+        }
+    }
+
+    return NRFX_SUCCESS;
+}
+
+/**
+ * @brief Function for getting the number of bits of the samples.
+ *
+ * @param[in] resolution Resolution of the samples.
+ *
+ * @return Number of bits.
+ */
+static uint8_t saadc_resolution_bits_get(nrf_saadc_resolution_t resolution)
+{
+    switch (resolution)
+    {
+        case NRF_SAADC_RESOLUTION_8BIT:
+            return 8;
+        case NRF_SAADC_RESOLUTION_10BIT:
+            return 10;
+        case NRF_SAADC_RESOLUTION_12BIT:
+            return 12;
+        case NRF_SAADC_RESOLUTION_14BIT:
+            return 14;
+        default:
+            NRFX_ASSERT(false);
+            return 0;
+    }
+}
+
+nrfx_err_t nrfx_saadc_samples_convert(uint8_t                   channel,
+                                      nrf_saadc_value_t const * p_samples,
+                                      uint16_t                  size,
+                                      int32_t *                 p_output)
+{
+    NRFX_ASSERT(m_cb.saadc_state != NRF_SAADC_STATE_UNINITIALIZED);
+    NRFX_ASSERT(channel < SAADC_CH_NUM);
+    NRFX_ASSERT(p_samples);
+    NRFX_ASSERT(p_output);
+
+    if (!(m_cb.channels_activated & (1U << channel)))
+    {
+        return NRFX_ERROR_INVALID_STATE;
+    }
+
+    if (!m_cb.channels_range[channel])
+    {
+        return NRFX_ERROR_NOT_SUPPORTED;
+    }
+
+    uint8_t bits = saadc_resolution_bits_get(m_cb.resolution);
+    if (m_cb.channels_diff & (1U << channel))
+    {
+        // In differential mode, the full scale is covered by positive samples only.
+        bits--;
+    }
+
+    // Microvolts per LSB in the Q16 format, so each sample takes one long multiplication.
+    int64_t scale = (int64_t)(((uint64_t)m_cb.channels_range[channel] << 16) >> bits);
+
+    for (uint16_t i = 0; i < size; i++)
+    {
+        p_output[i] = (int32_t)((p_samples[i] * scale) >> 16);
+    }
+
+    return NRFX_SUCCESS;
+}
+
 nrfx_err_t nrfx_saadc_limits_set(uint8_t channel, int16_t limit_low, int16_t limit_high)
 {
     NRFX_ASSERT(m_cb.saadc_state != NRF_SAADC_STATE_UNINITIALIZED);
@@ -702,6 +980,78 @@ nrfx_err_t nrfx_saadc_limits_set(uint8_t channel, int16_t limit_low, int16_t lim
     return NRFX_SUCCESS;
 }
 
+nrfx_err_t nrfx_saadc_monitor_start(uint32_t trigger_event,
+                                    uint8_t  sample_ppi_channel,
+                                    uint8_t  start_ppi_channel)
+{
+    NRFX_ASSERT(m_cb.saadc_state != NRF_SAADC_STATE_UNINITIALIZED);
+    NRFX_ASSERT(trigger_event);
+
+    if ((m_cb.saadc_state != NRF_SAADC_STATE_ADV_MODE) || !m_cb.event_handler)
+    {
+        return NRFX_ERROR_INVALID_STATE;
+    }
+
+    if (m_cb.p_buffer_primary)
+    {
+        return NRFX_ERROR_BUSY;
+    }
+
+    m_cb.monitor_trigger_event      = trigger_event;
+    m_cb.monitor_sample_ppi_channel = sample_ppi_channel;
+    m_cb.monitor_start_ppi_channel  = start_ppi_channel;
+    m_cb.saadc_state                = NRF_SAADC_STATE_MONITOR;
+
+    // Only the limit interrupts are kept enabled, the samples are never reported.
+    nrf_saadc_int_disable(NRF_SAADC,
+                          NRF_SAADC_INT_STARTED | NRF_SAADC_INT_STOPPED | NRF_SAADC_INT_END);
+
+    nrfx_gppi_channel_endpoints_setup(sample_ppi_channel,
+                                      trigger_event,
+                                      nrf_saadc_task_address_get(NRF_SAADC,
+                                                                 NRF_SAADC_TASK_SAMPLE));
+    // Rearm the scratch buffer as soon as it is filled, so that the next trigger is handled.
+    nrfx_gppi_channel_endpoints_setup(start_ppi_channel,
+                                      nrf_saadc_event_address_get(NRF_SAADC, NRF_SAADC_EVENT_END),
+                                      nrf_saadc_task_address_get(NRF_SAADC, NRF_SAADC_TASK_START));
+
+    nrf_saadc_enable(NRF_SAADC);
+    nrf_saadc_buffer_init(NRF_SAADC, m_cb.monitor_scratch, m_cb.channels_activated_count);
+    nrf_saadc_task_trigger(NRF_SAADC, NRF_SAADC_TASK_START);
+
+    nrfx_gppi_channels_enable(NRFX_BIT(sample_ppi_channel) | NRFX_BIT(start_ppi_channel));
+
+    return NRFX_SUCCESS;
+}
+
+void nrfx_saadc_monitor_stop(void)
+{
+    NRFX_ASSERT(m_cb.saadc_state == NRF_SAADC_STATE_MONITOR);
+
+    nrfx_gppi_channels_disable(NRFX_BIT(m_cb.monitor_sample_ppi_channel) |
+                               NRFX_BIT(m_cb.monitor_start_ppi_channel));
+    nrfx_gppi_event_endpoint_clear(m_cb.monitor_sample_ppi_channel, m_cb.monitor_trigger_event);
+    nrfx_gppi_task_endpoint_clear(m_cb.monitor_sample_ppi_channel,
+                                  nrf_saadc_task_address_get(NRF_SAADC, NRF_SAADC_TASK_SAMPLE));
+    nrfx_gppi_event_endpoint_clear(m_cb.monitor_start_ppi_channel,
+                                   nrf_saadc_event_address_get(NRF_SAADC, NRF_SAADC_EVENT_END));
+    nrfx_gppi_task_endpoint_clear(m_cb.monitor_start_ppi_channel,
+                                  nrf_saadc_task_address_get(NRF_SAADC, NRF_SAADC_TASK_START));
+
+    nrf_saadc_task_trigger(NRF_SAADC, NRF_SAADC_TASK_STOP);
+    while (!nrf_saadc_event_check(NRF_SAADC, NRF_SAADC_EVENT_STOPPED))
+    {}
+    nrf_saadc_disable(NRF_SAADC);
+
+    nrf_saadc_event_clear(NRF_SAADC, NRF_SAADC_EVENT_STOPPED);
+    nrf_saadc_event_clear(NRF_SAADC, NRF_SAADC_EVENT_STARTED);
+    nrf_saadc_event_clear(NRF_SAADC, NRF_SAADC_EVENT_END);
+    nrf_saadc_int_enable(NRF_SAADC,
+                         NRF_SAADC_INT_STARTED | NRF_SAADC_INT_STOPPED | NRF_SAADC_INT_END);
+
+    m_cb.saadc_state = NRF_SAADC_STATE_ADV_MODE;
+}
+
 nrfx_err_t nrfx_saadc_offset_calibrate(nrfx_saadc_event_handler_t calib_event_handler)
 {
     NRFX_ASSERT(m_cb.saadc_state != NRF_SAADC_STATE_UNINITIALIZED);
@@ -782,6 +1132,22 @@ static void saadc_pre_calibration_state_restore(void)
     nrf_saadc_int_set(NRF_SAADC, int_mask);
 }
 
+/** @brief Function for latching the next buffer of the ring as the secondary buffer. */
+static void saadc_ring_next_set(void)
+{
+    nrf_saadc_value_t * p_buffer = &m_cb.p_ring[(size_t)m_cb.ring_next * m_cb.ring_size];
+
+    nrf_saadc_buffer_init(NRF_SAADC, p_buffer, m_cb.ring_size);
+    m_cb.size_secondary     = m_cb.ring_size;
+    m_cb.p_buffer_secondary = p_buffer;
+
+    // The buffer held the result that was reported ring_count buffers earlier.
+    m_cb.overrun_secondary = ((m_cb.ring_latched - m_cb.ring_released) >= m_cb.ring_count);
+
+    m_cb.ring_latched++;
+    m_cb.ring_next = (uint8_t)((m_cb.ring_next + 1) % m_cb.ring_count);
+}
+
 static void saadc_event_started_handle(void)
 {
     nrfx_saadc_evt_t evt_data;
@@ -808,7 +1174,17 @@ static void saadc_event_started_handle(void)
             /* FALLTHROUGH */
 
         case NRF_SAADC_STATE_ADV_MODE_SAMPLE_STARTED:
-            if (!m_cb.p_buffer_secondary)
+            if (m_cb.p_buffer_secondary)
+            {
+                break;
+            }
+
+            if (m_cb.p_ring)
+            {
+                // In the ring mode the next buffer is supplied without user interaction.
+                saadc_ring_next_set();
+            }
+            else
             {
                 // Send next buffer request only if it was not provided earlier,
                 // before conversion start or outside of user's callback context.
@@ -838,6 +1214,8 @@ static void saadc_event_end_handle(void)
     evt_data.type = NRFX_SAADC_EVT_DONE;
     evt_data.data.done.p_buffer = m_cb.p_buffer_primary;
     evt_data.data.done.size = m_cb.size_primary;
+    evt_data.data.done.sequence = m_cb.sequence;
+    evt_data.data.done.overrun = false;
 
     switch (m_cb.saadc_state)
     {
@@ -856,12 +1234,19 @@ static void saadc_event_end_handle(void)
             {
                 nrf_saadc_task_trigger(NRF_SAADC, NRF_SAADC_TASK_START);
             }
+            if (m_cb.p_ring)
+            {
+                evt_data.data.done.overrun = m_cb.overrun_primary;
+            }
+            m_cb.sequence++;
             m_cb.event_handler(&evt_data);
             m_cb.p_buffer_primary = m_cb.p_buffer_secondary;
             m_cb.size_primary     = m_cb.size_secondary;
+            m_cb.overrun_primary  = m_cb.overrun_secondary;
             m_cb.p_buffer_secondary = NULL;
             if (!m_cb.p_buffer_primary)
             {
+                m_cb.p_ring = NULL;
                 nrf_saadc_disable(NRF_SAADC);
                 m_cb.saadc_state = NRF_SAADC_STATE_ADV_MODE;
                 evt_data.type = NRFX_SAADC_EVT_FINISHED;
@@ -902,8 +1287,19 @@ static void saadc_event_limits_handle(uint8_t limits_activated, nrf_saadc_limit_
     }
 }
 
-void nrfx_saadc_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_saadc_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(saadc);
+    if (m_cb.saadc_state == NRF_SAADC_STATE_MONITOR)
+    {
+        // Samples taken in the monitoring mode are not reported, so their events are left
+        // for the (D)PPI to rearm the buffer.
+        saadc_event_limits_handle(m_cb.limits_low_activated,  NRF_SAADC_LIMIT_LOW);
+        saadc_event_limits_handle(m_cb.limits_high_activated, NRF_SAADC_LIMIT_HIGH);
+        NRFX_PROF_IRQ_EXIT();
+        return;
+    }
+
     if (nrf_saadc_event_check(NRF_SAADC, NRF_SAADC_EVENT_CALIBRATEDONE))
     {
         nrf_saadc_event_clear(NRF_SAADC, NRF_SAADC_EVENT_CALIBRATEDONE);
@@ -951,5 +1347,6 @@ void nrfx_saadc_irq_handler(void)
         saadc_event_limits_handle(m_cb.limits_low_activated,  NRF_SAADC_LIMIT_LOW);
         saadc_event_limits_handle(m_cb.limits_high_activated, NRF_SAADC_LIMIT_HIGH);
     }
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif // NRFX_CHECK(NRFX_SAADC_ENABLED)
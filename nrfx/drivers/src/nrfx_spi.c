@@ -41,9 +41,25 @@
 #endif
 
 #include <nrfx_spi.h>
+#include <helpers/nrfx_prof.h>
 #include "prs/nrfx_prs.h"
 #include <hal/nrf_gpio.h>
 
+#if NRFX_CHECK(NRFX_SPI_EASYDMA_BRIDGE_ENABLED)
+#if !defined(SPIM_PRESENT)
+#error "SPI EasyDMA bridge requires the SPIM peripheral."
+#endif
+#include <hal/nrf_spim.h>
+#include <nrf_erratas.h>
+
+// SPI and SPIM instances with the same ID share the base address, so the registers
+// of the legacy instance can be accessed through the SPIM HAL.
+#define SPI_TO_SPIM(p_spi) ((NRF_SPIM_Type *)(p_spi))
+
+#define SPI_DMA_LENGTH_VALIDATE(length1, length2) \
+    NRFX_EASYDMA_LENGTH_VALIDATE(SPIM0, length1, length2)
+#endif
+
 #define NRFX_LOG_MODULE SPI
 #include <nrfx_log.h>
 
@@ -61,6 +77,9 @@ typedef struct
     size_t  bytes_transferred;
     bool    abort;
     bool    skip_gpio_cfg;
+#if NRFX_CHECK(NRFX_SPI_EASYDMA_BRIDGE_ENABLED)
+    bool    dma_active;
+#endif
 } spi_control_block_t;
 static spi_control_block_t m_cb[NRFX_SPI_ENABLED_COUNT];
 
@@ -197,9 +216,15 @@ void nrfx_spi_uninit(nrfx_spi_t const * p_instance)
     {
         NRFX_IRQ_DISABLE(nrfx_get_irq_number(p_instance->p_reg));
         nrf_spi_int_disable(p_spi, NRF_SPI_ALL_INTS_MASK);
+#if NRFX_CHECK(NRFX_SPI_EASYDMA_BRIDGE_ENABLED)
+        nrf_spim_int_disable(SPI_TO_SPIM(p_spi), NRF_SPIM_ALL_INTS_MASK);
+#endif
     }
 
     nrf_spi_disable(p_spi);
+#if NRFX_CHECK(NRFX_SPI_EASYDMA_BRIDGE_ENABLED)
+    p_cb->dma_active = false;
+#endif
 
     if (!p_cb->skip_gpio_cfg)
     {
@@ -299,10 +324,107 @@ static bool transfer_byte(NRF_SPI_Type * p_spi, spi_control_block_t * p_cb)
             p_cb->bytes_transferred < p_cb->evt.xfer_desc.rx_length);
 }
 
+#if NRFX_CHECK(NRFX_SPI_EASYDMA_BRIDGE_ENABLED)
+static bool spi_dma_eligible(nrfx_spi_xfer_desc_t const * p_xfer_desc)
+{
+    if (((p_xfer_desc->tx_length > 0) && !nrfx_is_in_ram(p_xfer_desc->p_tx_buffer)) ||
+        ((p_xfer_desc->rx_length > 0) && !nrfx_is_in_ram(p_xfer_desc->p_rx_buffer)))
+    {
+        return false;
+    }
+
+    // SPIM clocks out an additional byte in single-byte transactions on SoCs
+    // affected by anomaly 58, so such transfers are left to SPI.
+    if (nrf52_errata_58() &&
+        (p_xfer_desc->rx_length == 1) && (p_xfer_desc->tx_length <= 1))
+    {
+        return false;
+    }
+
+    return SPI_DMA_LENGTH_VALIDATE(p_xfer_desc->tx_length, p_xfer_desc->rx_length);
+}
+
+static void spi_dma_end(NRF_SPI_Type * p_spi, spi_control_block_t * p_cb)
+{
+    NRF_SPIM_Type * p_spim = SPI_TO_SPIM(p_spi);
+
+    nrf_spim_int_disable(p_spim, NRF_SPIM_INT_END_MASK | NRF_SPIM_INT_STOPPED_MASK);
+
+    if (p_cb->abort)
+    {
+        size_t tx_amount = nrf_spim_tx_amount_get(p_spim);
+        size_t rx_amount = nrf_spim_rx_amount_get(p_spim);
+
+        if (tx_amount < p_cb->evt.xfer_desc.tx_length)
+        {
+            p_cb->evt.xfer_desc.tx_length = tx_amount;
+        }
+        if (rx_amount < p_cb->evt.xfer_desc.rx_length)
+        {
+            p_cb->evt.xfer_desc.rx_length = rx_amount;
+        }
+    }
+
+    nrf_spim_event_clear(p_spim, NRF_SPIM_EVENT_END);
+    nrf_spim_event_clear(p_spim, NRF_SPIM_EVENT_STOPPED);
+    nrf_spim_disable(p_spim);
+    nrf_spi_enable(p_spi);
+    p_cb->dma_active = false;
+}
+
+static void spi_dma_xfer(NRF_SPI_Type               * p_spi,
+                         spi_control_block_t        * p_cb,
+                         nrfx_spi_xfer_desc_t const * p_xfer_desc)
+{
+    NRF_SPIM_Type * p_spim = SPI_TO_SPIM(p_spi);
+
+    // The frequency, configuration, and pin selection registers are common for both
+    // peripheral modes, so only the mode needs to be switched.
+    nrf_spi_int_disable(p_spi, NRF_SPI_INT_READY_MASK);
+    nrf_spi_disable(p_spi);
+    nrf_spim_enable(p_spim);
+
+    nrf_spim_orc_set(p_spim, p_cb->orc);
+    nrf_spim_tx_buffer_set(p_spim, p_xfer_desc->p_tx_buffer, p_xfer_desc->tx_length);
+    nrf_spim_rx_buffer_set(p_spim, p_xfer_desc->p_rx_buffer, p_xfer_desc->rx_length);
+    nrf_spim_event_clear(p_spim, NRF_SPIM_EVENT_END);
+    nrf_spim_event_clear(p_spim, NRF_SPIM_EVENT_STOPPED);
+
+    p_cb->dma_active = true;
+    nrf_spim_task_trigger(p_spim, NRF_SPIM_TASK_START);
+
+    if (p_cb->handler)
+    {
+        // STOPPED is generated instead of END when the transfer is aborted.
+        nrf_spim_int_enable(p_spim, NRF_SPIM_INT_END_MASK | NRF_SPIM_INT_STOPPED_MASK);
+    }
+    else
+    {
+        while (!nrf_spim_event_check(p_spim, NRF_SPIM_EVENT_END) &&
+               !nrf_spim_event_check(p_spim, NRF_SPIM_EVENT_STOPPED))
+        {}
+        NRFX_LOG_DEBUG("SPIM: Event: NRF_SPIM_EVENT_END.");
+        spi_dma_end(p_spi, p_cb);
+        if (p_cb->ss_pin != NRFX_SPI_PIN_NOT_USED)
+        {
+            nrf_gpio_pin_write(p_cb->ss_pin, 1);
+        }
+    }
+}
+#endif // NRFX_CHECK(NRFX_SPI_EASYDMA_BRIDGE_ENABLED)
+
 static void spi_xfer(NRF_SPI_Type               * p_spi,
                      spi_control_block_t        * p_cb,
                      nrfx_spi_xfer_desc_t const * p_xfer_desc)
 {
+#if NRFX_CHECK(NRFX_SPI_EASYDMA_BRIDGE_ENABLED)
+    if (spi_dma_eligible(p_xfer_desc))
+    {
+        spi_dma_xfer(p_spi, p_cb, p_xfer_desc);
+        return;
+    }
+#endif
+
     p_cb->bytes_transferred = 0;
     nrf_spi_int_disable(p_spi, NRF_SPI_INT_READY_MASK);
 
@@ -404,12 +526,28 @@ void nrfx_spi_abort(nrfx_spi_t const * p_instance)
     spi_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
     NRFX_ASSERT(p_cb->state != NRFX_DRV_STATE_UNINITIALIZED);
     p_cb->abort = true;
+#if NRFX_CHECK(NRFX_SPI_EASYDMA_BRIDGE_ENABLED)
+    if (p_cb->dma_active)
+    {
+        nrf_spim_task_trigger(SPI_TO_SPIM(p_instance->p_reg), NRF_SPIM_TASK_STOP);
+    }
+#endif
 }
 
-static void irq_handler(NRF_SPI_Type * p_spi, spi_control_block_t * p_cb)
+NRFX_IRQ_HANDLER_ATTR static void irq_handler(NRF_SPI_Type * p_spi, spi_control_block_t * p_cb)
 {
     NRFX_ASSERT(p_cb->handler);
 
+#if NRFX_CHECK(NRFX_SPI_EASYDMA_BRIDGE_ENABLED)
+    if (p_cb->dma_active)
+    {
+        NRFX_LOG_DEBUG("Event: NRF_SPIM_EVENT_END.");
+        spi_dma_end(p_spi, p_cb);
+        finish_transfer(p_cb);
+        return;
+    }
+#endif
+
     nrf_spi_event_clear(p_spi, NRF_SPI_EVENT_READY);
     NRFX_LOG_DEBUG("Event: NRF_SPI_EVENT_READY.");
 
@@ -420,23 +558,29 @@ static void irq_handler(NRF_SPI_Type * p_spi, spi_control_block_t * p_cb)
 }
 
 #if NRFX_CHECK(NRFX_SPI0_ENABLED)
-void nrfx_spi_0_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_spi_0_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(spi_0);
     irq_handler(NRF_SPI0, &m_cb[NRFX_SPI0_INST_IDX]);
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
 #if NRFX_CHECK(NRFX_SPI1_ENABLED)
-void nrfx_spi_1_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_spi_1_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(spi_1);
     irq_handler(NRF_SPI1, &m_cb[NRFX_SPI1_INST_IDX]);
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
 #if NRFX_CHECK(NRFX_SPI2_ENABLED)
-void nrfx_spi_2_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_spi_2_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(spi_2);
     irq_handler(NRF_SPI2, &m_cb[NRFX_SPI2_INST_IDX]);
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
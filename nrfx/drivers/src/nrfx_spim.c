@@ -43,8 +43,12 @@
 
 
 #include <nrfx_spim.h>
+#include <helpers/nrfx_prof.h>
+#include <helpers/nrfx_gppi.h>
 #include "prs/nrfx_prs.h"
 #include <hal/nrf_gpio.h>
+#include <soc/nrfx_coredep.h>
+#include <string.h>
 
 #define NRFX_LOG_MODULE SPIM
 #include <nrfx_log.h>
@@ -54,6 +58,12 @@
 #error "Extended options are not available in the SoC currently in use."
 #endif
 
+#if NRFX_CHECK(NRFX_SPIM_EXTENDED_ENABLED)
+// Largest sample delay for input serial data on MISO, in 64 MHz clock cycles.
+#define SPIM_RX_DELAY_MAX \
+    (SPIM_IFTIMING_RXDELAY_RXDELAY_Msk >> SPIM_IFTIMING_RXDELAY_RXDELAY_Pos)
+#endif
+
 #define SPIMX_LENGTH_VALIDATE(peripheral, drv_inst_idx, rx_len, tx_len) \
     (((drv_inst_idx) == NRFX_CONCAT_3(NRFX_, peripheral, _INST_IDX)) && \
      NRFX_EASYDMA_LENGTH_VALIDATE(peripheral, rx_len, tx_len))
@@ -188,6 +198,7 @@ typedef struct
     bool    ss_active_high : 1;
 #if NRFX_CHECK(NRFX_SPIM_EXTENDED_ENABLED)
     bool    use_hw_ss      : 1;
+    uint8_t rx_delay;
 #endif
     uint8_t ss_pin;
 
@@ -195,9 +206,56 @@ typedef struct
     size_t  tx_length;
     size_t  rx_length;
 #endif
+
+    nrfx_spim_xfer_list_item_t const * p_list;
+    size_t                             list_count;
+    size_t                             list_idx;
+    volatile bool                      list_active;
+
+    nrfx_spim_device_t                 instance_device;
+    nrfx_spim_device_t const *         p_applied_device;
+    nrfx_spim_bus_request_t *          p_bus_head;
+    nrfx_spim_bus_request_t *          p_bus_tail;
+    volatile bool                      bus_xfer;
+    bool                               suspended;
+
+    bool                               circular_active;
+    bool                               circular_second_half;
+    uint8_t *                          p_circular_buffer;
+    size_t                             circular_sample_size;
+    size_t                             circular_half_size;
+    NRF_TIMER_Type *                   p_circular_counter;
+    uint8_t                            circular_count_ppi_channel;
+    uint8_t                            circular_stop_ppi_channel;
 } spim_control_block_t;
 static spim_control_block_t m_cb[NRFX_SPIM_ENABLED_COUNT];
 
+/** @brief Lock of the bus ownership of all the instances. */
+NRFX_LOCK_DECLARE(m_spim_lock);
+
+#if (NRFX_CHECK(NRFX_SPIM0_ENABLED) + NRFX_CHECK(NRFX_SPIM1_ENABLED) + \
+     NRFX_CHECK(NRFX_SPIM2_ENABLED) + NRFX_CHECK(NRFX_SPIM3_ENABLED) + \
+     NRFX_CHECK(NRFX_SPIM4_ENABLED)) == 1
+// Only one instance is enabled, so its registers and control block are known at compile time.
+#if NRFX_CHECK(NRFX_SPIM0_ENABLED)
+#define SPIM_SINGLE_REG NRF_SPIM0
+#elif NRFX_CHECK(NRFX_SPIM1_ENABLED)
+#define SPIM_SINGLE_REG NRF_SPIM1
+#elif NRFX_CHECK(NRFX_SPIM2_ENABLED)
+#define SPIM_SINGLE_REG NRF_SPIM2
+#elif NRFX_CHECK(NRFX_SPIM3_ENABLED)
+#define SPIM_SINGLE_REG NRF_SPIM3
+#elif NRFX_CHECK(NRFX_SPIM4_ENABLED)
+#define SPIM_SINGLE_REG NRF_SPIM4
+#endif
+
+#define SPIM_REG(p_instance) ((void)(p_instance), SPIM_SINGLE_REG)
+#define SPIM_CB(p_instance)  ((void)(p_instance), &m_cb[0])
+#else
+#define SPIM_REG(p_instance) ((p_instance)->p_reg)
+#define SPIM_CB(p_instance)  (&m_cb[(p_instance)->drv_inst_idx])
+#endif
+
 #if NRFX_CHECK(NRFX_SPIM3_NRF52840_ANOMALY_198_WORKAROUND_ENABLED)
 
 // Workaround for nRF52840 anomaly 198: SPIM3 transmit data might be corrupted.
@@ -243,18 +301,22 @@ static void spim_abort(NRF_SPIM_Type * p_spim, spim_control_block_t * p_cb)
 {
     nrf_spim_task_trigger(p_spim, NRF_SPIM_TASK_STOP);
     bool stopped;
-    NRFX_WAIT_FOR(nrf_spim_event_check(p_spim, NRF_SPIM_EVENT_STOPPED), 100, 1, stopped);
+    NRFX_COREDEP_WAIT_FOR_US(nrf_spim_event_check(p_spim, NRF_SPIM_EVENT_STOPPED), 100, stopped);
     if (!stopped)
     {
         NRFX_LOG_ERROR("Failed to stop instance with base address: %p.", (void *)p_spim);
     }
     p_cb->transfer_in_progress = false;
+    p_cb->list_active          = false;
+    p_cb->bus_xfer             = false;
+    p_cb->p_bus_head           = NULL;
+    p_cb->p_bus_tail           = NULL;
 }
 
 static void configure_pins(nrfx_spim_t const *        p_instance,
                            nrfx_spim_config_t const * p_config)
 {
-    NRF_SPIM_Type * p_spim = (NRF_SPIM_Type *)p_instance->p_reg;
+    NRF_SPIM_Type * p_spim = (NRF_SPIM_Type *)SPIM_REG(p_instance);
 
     if (!p_config->skip_gpio_cfg)
     {
@@ -380,8 +442,8 @@ nrfx_err_t nrfx_spim_init(nrfx_spim_t const *        p_instance,
                           void *                     p_context)
 {
     NRFX_ASSERT(p_config);
-    spim_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
-    NRF_SPIM_Type * p_spim = (NRF_SPIM_Type *)p_instance->p_reg;
+    spim_control_block_t * p_cb = SPIM_CB(p_instance);
+    NRF_SPIM_Type * p_spim = (NRF_SPIM_Type *)SPIM_REG(p_instance);
     nrfx_err_t err_code;
 
     if (p_cb->state != NRFX_DRV_STATE_UNINITIALIZED)
@@ -461,7 +523,7 @@ nrfx_err_t nrfx_spim_init(nrfx_spim_t const *        p_instance,
         nrfx_spim_4_irq_handler,
         #endif
     };
-    if (nrfx_prs_acquire(p_instance->p_reg,
+    if (nrfx_prs_acquire(SPIM_REG(p_instance),
             irq_handlers[p_instance->drv_inst_idx]) != NRFX_SUCCESS)
     {
         err_code = NRFX_ERROR_BUSY;
@@ -479,6 +541,7 @@ nrfx_err_t nrfx_spim_init(nrfx_spim_t const *        p_instance,
     p_cb->ss_active_high = p_config->ss_active_high;
 #if NRFX_CHECK(NRFX_SPIM_EXTENDED_ENABLED)
     p_cb->use_hw_ss = p_config->use_hw_ss;
+    p_cb->rx_delay  = p_config->rx_delay;
 #endif
     p_cb->ss_pin = p_config->ss_pin;
 
@@ -494,13 +557,24 @@ nrfx_err_t nrfx_spim_init(nrfx_spim_t const *        p_instance,
 
     nrf_spim_orc_set(p_spim, p_config->orc);
 
+    p_cb->instance_device.config.ss_pin         = NRFX_SPIM_PIN_NOT_USED;
+    p_cb->instance_device.config.ss_active_high = p_config->ss_active_high;
+    p_cb->instance_device.config.orc            = p_config->orc;
+    p_cb->instance_device.config.frequency      = p_config->frequency;
+    p_cb->instance_device.config.mode           = p_config->mode;
+    p_cb->instance_device.config.bit_order      = p_config->bit_order;
+    p_cb->p_applied_device = &p_cb->instance_device;
+    p_cb->p_bus_head       = NULL;
+    p_cb->p_bus_tail       = NULL;
+    p_cb->bus_xfer         = false;
+
     nrf_spim_enable(p_spim);
 
     if (p_cb->handler)
     {
-        NRFX_IRQ_PRIORITY_SET(nrfx_get_irq_number(p_instance->p_reg),
+        NRFX_IRQ_PRIORITY_SET(nrfx_get_irq_number(SPIM_REG(p_instance)),
             p_config->irq_priority);
-        NRFX_IRQ_ENABLE(nrfx_get_irq_number(p_instance->p_reg));
+        NRFX_IRQ_ENABLE(nrfx_get_irq_number(SPIM_REG(p_instance)));
     }
 
     p_cb->transfer_in_progress = false;
@@ -523,13 +597,13 @@ static void spim_pin_uninit(uint32_t pin)
 
 void nrfx_spim_uninit(nrfx_spim_t const * p_instance)
 {
-    spim_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    spim_control_block_t * p_cb = SPIM_CB(p_instance);
     NRFX_ASSERT(p_cb->state != NRFX_DRV_STATE_UNINITIALIZED);
-    NRF_SPIM_Type * p_spim = p_instance->p_reg;
+    NRF_SPIM_Type * p_spim = SPIM_REG(p_instance);
 
     if (p_cb->handler)
     {
-        NRFX_IRQ_DISABLE(nrfx_get_irq_number(p_instance->p_reg));
+        NRFX_IRQ_DISABLE(nrfx_get_irq_number(SPIM_REG(p_instance)));
         nrf_spim_int_disable(p_spim, NRF_SPIM_ALL_INTS_MASK);
         if (p_cb->transfer_in_progress)
         {
@@ -565,10 +639,56 @@ void nrfx_spim_uninit(nrfx_spim_t const * p_instance)
 #endif
 
 #if NRFX_CHECK(NRFX_PRS_ENABLED)
-    nrfx_prs_release(p_instance->p_reg);
+    nrfx_prs_release(SPIM_REG(p_instance));
+#endif
+
+    p_cb->state     = NRFX_DRV_STATE_UNINITIALIZED;
+    p_cb->suspended = false;
+}
+
+nrfx_err_t nrfx_spim_suspend(nrfx_spim_t const * p_instance)
+{
+    spim_control_block_t * p_cb   = SPIM_CB(p_instance);
+    NRF_SPIM_Type *        p_spim = SPIM_REG(p_instance);
+    NRFX_ASSERT(p_cb->state != NRFX_DRV_STATE_UNINITIALIZED);
+
+    nrfx_err_t err_code;
+
+    if (p_cb->transfer_in_progress || p_cb->list_active ||
+        p_cb->bus_xfer || (p_cb->p_bus_head != NULL))
+    {
+        err_code = NRFX_ERROR_BUSY;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    if (!p_cb->suspended)
+    {
+        // The pins keep their GPIO configuration, so the lines stay at their idle levels.
+        nrf_spim_disable(p_spim);
+#if NRFX_CHECK(USE_WORKAROUND_FOR_ANOMALY_195)
+        if (p_spim == NRF_SPIM3)
+        {
+            *(volatile uint32_t *)0x4002F004 = 1;
+        }
 #endif
+        p_cb->suspended = true;
+    }
 
-    p_cb->state = NRFX_DRV_STATE_UNINITIALIZED;
+    return NRFX_SUCCESS;
+}
+
+void nrfx_spim_resume(nrfx_spim_t const * p_instance)
+{
+    spim_control_block_t * p_cb = SPIM_CB(p_instance);
+
+    if (p_cb->suspended)
+    {
+        p_cb->suspended = false;
+        nrf_spim_enable(SPIM_REG(p_instance));
+    }
 }
 
 #if NRFX_CHECK(NRFX_SPIM_EXTENDED_ENABLED)
@@ -580,9 +700,87 @@ nrfx_err_t nrfx_spim_xfer_dcx(nrfx_spim_t const *           p_instance,
     (void)flags;
 
     NRFX_ASSERT(cmd_length <= NRF_SPIM_DCX_CNT_ALL_CMD);
-    nrf_spim_dcx_cnt_set((NRF_SPIM_Type *)p_instance->p_reg, cmd_length);
+    nrf_spim_dcx_cnt_set((NRF_SPIM_Type *)SPIM_REG(p_instance), cmd_length);
     return nrfx_spim_xfer(p_instance, p_xfer_desc, 0);
 }
+
+nrfx_err_t nrfx_spim_rx_delay_calibrate(nrfx_spim_t const *           p_instance,
+                                        nrfx_spim_xfer_desc_t const * p_xfer_desc,
+                                        uint8_t const *               p_expected,
+                                        uint8_t *                     p_rx_delay)
+{
+    spim_control_block_t * p_cb   = SPIM_CB(p_instance);
+    NRF_SPIM_Type *        p_spim = SPIM_REG(p_instance);
+    NRFX_ASSERT(p_cb->state != NRFX_DRV_STATE_UNINITIALIZED);
+    NRFX_ASSERT(p_xfer_desc->p_rx_buffer != NULL);
+    NRFX_ASSERT(p_expected);
+    NRFX_ASSERT(p_rx_delay);
+
+    nrfx_err_t err_code;
+
+    if (p_cb->handler)
+    {
+        err_code = NRFX_ERROR_INVALID_STATE;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    uint8_t best_start = 0;
+    uint8_t best_count = 0;
+    uint8_t run_count  = 0;
+
+    for (uint8_t delay = 0; delay <= SPIM_RX_DELAY_MAX; delay++)
+    {
+        // Make sure that a transfer which does not overwrite the buffer is not accepted.
+        for (size_t i = 0; i < p_xfer_desc->rx_length; i++)
+        {
+            p_xfer_desc->p_rx_buffer[i] = (uint8_t)~p_expected[i];
+        }
+
+        nrf_spim_iftiming_set(p_spim, delay);
+
+        err_code = nrfx_spim_xfer(p_instance, p_xfer_desc, 0);
+        if (err_code != NRFX_SUCCESS)
+        {
+            nrf_spim_iftiming_set(p_spim, p_cb->rx_delay);
+            return err_code;
+        }
+
+        if (memcmp(p_xfer_desc->p_rx_buffer, p_expected, p_xfer_desc->rx_length) == 0)
+        {
+            run_count++;
+            if (run_count > best_count)
+            {
+                best_count = run_count;
+                best_start = (uint8_t)(delay + 1 - run_count);
+            }
+        }
+        else
+        {
+            run_count = 0;
+        }
+    }
+
+    if (best_count == 0)
+    {
+        nrf_spim_iftiming_set(p_spim, p_cb->rx_delay);
+        err_code = NRFX_ERROR_INTERNAL;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    p_cb->rx_delay = (uint8_t)(best_start + (best_count - 1) / 2);
+    nrf_spim_iftiming_set(p_spim, p_cb->rx_delay);
+    *p_rx_delay = p_cb->rx_delay;
+
+    NRFX_LOG_INFO("RX delay calibrated to %d, valid range: %d-%d.",
+                  p_cb->rx_delay, best_start, best_start + best_count - 1);
+    return NRFX_SUCCESS;
+}
 #endif
 
 static void set_ss_pin_state(spim_control_block_t * p_cb, bool active)
@@ -647,11 +845,41 @@ static void spim_list_enable_handle(NRF_SPIM_Type * p_spim, uint32_t flags)
     }
 }
 
+static void device_apply(NRF_SPIM_Type *            p_spim,
+                         spim_control_block_t *     p_cb,
+                         nrfx_spim_device_t const * p_device)
+{
+    nrfx_spim_device_config_t const * p_prev   = &p_cb->p_applied_device->config;
+    nrfx_spim_device_config_t const * p_config = &p_device->config;
+
+    if (p_cb->p_applied_device == p_device)
+    {
+        return;
+    }
+
+    if (p_prev->frequency != p_config->frequency)
+    {
+        nrf_spim_frequency_set(p_spim, p_config->frequency);
+    }
+    if ((p_prev->mode != p_config->mode) || (p_prev->bit_order != p_config->bit_order))
+    {
+        nrf_spim_configure(p_spim, p_config->mode, p_config->bit_order);
+    }
+    if (p_prev->orc != p_config->orc)
+    {
+        nrf_spim_orc_set(p_spim, p_config->orc);
+    }
+
+    p_cb->p_applied_device = p_device;
+}
+
 static nrfx_err_t spim_xfer(NRF_SPIM_Type               * p_spim,
                             spim_control_block_t        * p_cb,
                             nrfx_spim_xfer_desc_t const * p_xfer_desc,
                             uint32_t                      flags)
 {
+    NRFX_ASSERT(!p_cb->suspended);
+
     nrfx_err_t err_code;
     // EasyDMA requires that transfer buffers are placed in Data RAM region;
     // signal error if they are not.
@@ -730,7 +958,7 @@ nrfx_err_t nrfx_spim_xfer(nrfx_spim_t const *           p_instance,
                           nrfx_spim_xfer_desc_t const * p_xfer_desc,
                           uint32_t                      flags)
 {
-    spim_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    spim_control_block_t * p_cb = SPIM_CB(p_instance);
     NRFX_ASSERT(p_cb->state != NRFX_DRV_STATE_UNINITIALIZED);
     NRFX_ASSERT(p_xfer_desc->p_tx_buffer != NULL || p_xfer_desc->tx_length == 0);
     NRFX_ASSERT(p_xfer_desc->p_rx_buffer != NULL || p_xfer_desc->rx_length == 0);
@@ -744,8 +972,19 @@ nrfx_err_t nrfx_spim_xfer(nrfx_spim_t const *           p_instance,
                 (p_cb->ss_pin == NRFX_SPIM_PIN_NOT_USED));
 
     nrfx_err_t err_code = NRFX_SUCCESS;
+    bool       busy;
 
-    if (p_cb->transfer_in_progress)
+    // The check is atomic, as the bus can also be claimed for requests queued from other contexts.
+    NRFX_LOCK_TAKE(m_spim_lock);
+    busy = p_cb->transfer_in_progress;
+    if (!busy && p_cb->handler && !(flags & (NRFX_SPIM_FLAG_REPEATED_XFER |
+                                             NRFX_SPIM_FLAG_NO_XFER_EVT_HANDLER)))
+    {
+        p_cb->transfer_in_progress = true;
+    }
+    NRFX_LOCK_GIVE(m_spim_lock);
+
+    if (busy)
     {
         err_code = NRFX_ERROR_BUSY;
         NRFX_LOG_WARNING("Function: %s, error code: %s.",
@@ -753,44 +992,497 @@ nrfx_err_t nrfx_spim_xfer(nrfx_spim_t const *           p_instance,
                          NRFX_LOG_ERROR_STRING_GET(err_code));
         return err_code;
     }
+
+    p_cb->evt.xfer_desc = *p_xfer_desc;
+
+    device_apply(SPIM_REG(p_instance), p_cb, &p_cb->instance_device);
+    set_ss_pin_state(p_cb, true);
+
+    return spim_xfer(SPIM_REG(p_instance), p_cb,  p_xfer_desc, flags);
+}
+
+static void list_item_ss_set(spim_control_block_t             * p_cb,
+                             nrfx_spim_xfer_list_item_t const * p_item,
+                             bool                               active)
+{
+    if (p_item->ss_pin == NRFX_SPIM_PIN_NOT_USED)
+    {
+        set_ss_pin_state(p_cb, active);
+    }
     else
     {
-        if (p_cb->handler && !(flags & (NRFX_SPIM_FLAG_REPEATED_XFER |
-                                        NRFX_SPIM_FLAG_NO_XFER_EVT_HANDLER)))
+        nrf_gpio_pin_write(p_item->ss_pin,
+                           p_cb->ss_active_high ? active : !active);
+    }
+}
+
+static void list_item_start(NRF_SPIM_Type * p_spim, spim_control_block_t * p_cb)
+{
+    nrfx_spim_xfer_list_item_t const * p_item = &p_cb->p_list[p_cb->list_idx];
+
+#if NRFX_CHECK(NRFX_SPIM_EXTENDED_ENABLED)
+    NRFX_ASSERT(p_item->cmd_length <= NRF_SPIM_DCX_CNT_ALL_CMD);
+    nrf_spim_dcx_cnt_set(p_spim, p_item->cmd_length);
+#endif
+
+    p_cb->evt.xfer_desc = p_item->xfer;
+    list_item_ss_set(p_cb, p_item, true);
+
+    // Buffers of all transactions were validated when the list was set up.
+    (void)spim_xfer(p_spim, p_cb, &p_item->xfer, 0);
+}
+
+nrfx_err_t nrfx_spim_xfer_list(nrfx_spim_t const *                p_instance,
+                               nrfx_spim_xfer_list_item_t const * p_list,
+                               size_t                             count)
+{
+    spim_control_block_t * p_cb   = SPIM_CB(p_instance);
+    NRF_SPIM_Type *        p_spim = (NRF_SPIM_Type *)SPIM_REG(p_instance);
+    NRFX_ASSERT(p_cb->state != NRFX_DRV_STATE_UNINITIALIZED);
+    NRFX_ASSERT(!p_cb->suspended);
+    NRFX_ASSERT(p_list);
+    NRFX_ASSERT(count > 0);
+
+    nrfx_err_t err_code;
+    bool       busy;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        nrfx_spim_xfer_desc_t const * p_xfer = &p_list[i].xfer;
+
+        NRFX_ASSERT(p_xfer->p_tx_buffer != NULL || p_xfer->tx_length == 0);
+        NRFX_ASSERT(p_xfer->p_rx_buffer != NULL || p_xfer->rx_length == 0);
+        NRFX_ASSERT(SPIM_LENGTH_VALIDATE(p_instance->drv_inst_idx,
+                                         p_xfer->rx_length,
+                                         p_xfer->tx_length));
+
+        // EasyDMA requires that transfer buffers are placed in Data RAM region;
+        // signal error if they are not.
+        if ((p_xfer->p_tx_buffer != NULL && !nrfx_is_in_ram(p_xfer->p_tx_buffer)) ||
+            (p_xfer->p_rx_buffer != NULL && !nrfx_is_in_ram(p_xfer->p_rx_buffer)))
         {
-            p_cb->transfer_in_progress = true;
+            err_code = NRFX_ERROR_INVALID_ADDR;
+            NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                             __func__,
+                             NRFX_LOG_ERROR_STRING_GET(err_code));
+            return err_code;
         }
     }
 
-    p_cb->evt.xfer_desc = *p_xfer_desc;
+    NRFX_LOCK_TAKE(m_spim_lock);
+    busy = p_cb->transfer_in_progress;
+    if (!busy && p_cb->handler)
+    {
+        p_cb->transfer_in_progress = true;
+    }
+    NRFX_LOCK_GIVE(m_spim_lock);
 
-    set_ss_pin_state(p_cb, true);
+    if (busy)
+    {
+        err_code = NRFX_ERROR_BUSY;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    p_cb->p_list     = p_list;
+    p_cb->list_count = count;
+    p_cb->list_idx   = 0;
+
+    device_apply(p_spim, p_cb, &p_cb->instance_device);
 
-    return spim_xfer(p_instance->p_reg, p_cb,  p_xfer_desc, flags);
+    if (!p_cb->handler)
+    {
+        for (; p_cb->list_idx < count; p_cb->list_idx++)
+        {
+            list_item_start(p_spim, p_cb);
+            // In blocking mode the instance Slave Select is already deactivated.
+            list_item_ss_set(p_cb, &p_list[p_cb->list_idx], false);
+        }
+        return NRFX_SUCCESS;
+    }
+
+    p_cb->list_active = true;
+    list_item_start(p_spim, p_cb);
+
+    NRFX_LOG_INFO("Transaction list started, %d transfers.", (int)count);
+    return NRFX_SUCCESS;
+}
+
+/**
+ * @brief Function for handling the END event of a transaction from the list.
+ *
+ * @retval true  The next transaction is started.
+ * @retval false The list is finished.
+ */
+static bool list_item_end_handle(NRF_SPIM_Type * p_spim, spim_control_block_t * p_cb)
+{
+    list_item_ss_set(p_cb, &p_cb->p_list[p_cb->list_idx], false);
+
+    if (++p_cb->list_idx < p_cb->list_count)
+    {
+        list_item_start(p_spim, p_cb);
+        return true;
+    }
+
+    p_cb->list_active = false;
+    return false;
+}
+
+static void device_ss_set(nrfx_spim_device_t const * p_device, bool active)
+{
+    if (p_device->config.ss_pin != NRFX_SPIM_PIN_NOT_USED)
+    {
+        nrf_gpio_pin_write(p_device->config.ss_pin,
+                           p_device->config.ss_active_high ? active : !active);
+    }
+}
+
+void nrfx_spim_device_init(nrfx_spim_device_t *              p_device,
+                           nrfx_spim_device_config_t const * p_config)
+{
+    NRFX_ASSERT(p_device);
+    NRFX_ASSERT(p_config);
+
+    p_device->config = *p_config;
+
+    if (p_config->ss_pin != NRFX_SPIM_PIN_NOT_USED)
+    {
+        device_ss_set(p_device, false);
+        nrf_gpio_cfg_output(p_config->ss_pin);
+    }
+}
+
+static void bus_request_start(NRF_SPIM_Type * p_spim, spim_control_block_t * p_cb)
+{
+    nrfx_spim_bus_request_t * p_request = p_cb->p_bus_head;
+
+    device_apply(p_spim, p_cb, p_request->p_device);
+
+    p_cb->bus_xfer      = true;
+    p_cb->evt.xfer_desc = p_request->xfer;
+    device_ss_set(p_request->p_device, true);
+
+    // Buffers were validated when the request was submitted.
+    (void)spim_xfer(p_spim, p_cb, &p_request->xfer, 0);
+}
+
+/**
+ * @brief Function for starting the first queued request if the bus is idle.
+ *
+ * @retval true  A request is started.
+ * @retval false The bus is busy or there are no requests queued.
+ */
+static bool bus_pending_start(NRF_SPIM_Type * p_spim, spim_control_block_t * p_cb)
+{
+    bool start;
+
+    NRFX_LOCK_TAKE(m_spim_lock);
+    start = !p_cb->transfer_in_progress && (p_cb->p_bus_head != NULL);
+    if (start)
+    {
+        p_cb->transfer_in_progress = true;
+    }
+    NRFX_LOCK_GIVE(m_spim_lock);
+
+    if (start)
+    {
+        bus_request_start(p_spim, p_cb);
+    }
+    return start;
+}
+
+static void bus_request_end(NRF_SPIM_Type * p_spim, spim_control_block_t * p_cb)
+{
+    nrfx_spim_bus_request_t * p_request = p_cb->p_bus_head;
+    nrfx_spim_evt_t           evt;
+
+    device_ss_set(p_request->p_device, false);
+
+    evt.type      = NRFX_SPIM_EVENT_DONE;
+    evt.xfer_desc = p_request->xfer;
+
+    NRFX_LOCK_TAKE(m_spim_lock);
+    p_cb->p_bus_head = p_request->p_next;
+    if (p_cb->p_bus_head == NULL)
+    {
+        p_cb->p_bus_tail = NULL;
+    }
+    p_cb->bus_xfer             = false;
+    p_cb->transfer_in_progress = false;
+    NRFX_LOCK_GIVE(m_spim_lock);
+
+    // Start the next request before notifying to keep the bus busy.
+    (void)bus_pending_start(p_spim, p_cb);
+
+    p_request->handler(&evt, p_request->p_context);
+}
+
+nrfx_err_t nrfx_spim_bus_submit(nrfx_spim_t const *       p_instance,
+                                nrfx_spim_bus_request_t * p_request)
+{
+    spim_control_block_t * p_cb = SPIM_CB(p_instance);
+    NRFX_ASSERT(p_cb->state != NRFX_DRV_STATE_UNINITIALIZED);
+    NRFX_ASSERT(!p_cb->suspended);
+    NRFX_ASSERT(p_request->p_device);
+    NRFX_ASSERT(p_request->handler);
+    NRFX_ASSERT(p_request->xfer.p_tx_buffer != NULL || p_request->xfer.tx_length == 0);
+    NRFX_ASSERT(p_request->xfer.p_rx_buffer != NULL || p_request->xfer.rx_length == 0);
+    NRFX_ASSERT(SPIM_LENGTH_VALIDATE(p_instance->drv_inst_idx,
+                                     p_request->xfer.rx_length,
+                                     p_request->xfer.tx_length));
+
+    nrfx_err_t err_code;
+
+    if (!p_cb->handler)
+    {
+        err_code = NRFX_ERROR_INVALID_STATE;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    // EasyDMA requires that transfer buffers are placed in Data RAM region;
+    // signal error if they are not.
+    if ((p_request->xfer.p_tx_buffer != NULL && !nrfx_is_in_ram(p_request->xfer.p_tx_buffer)) ||
+        (p_request->xfer.p_rx_buffer != NULL && !nrfx_is_in_ram(p_request->xfer.p_rx_buffer)))
+    {
+        err_code = NRFX_ERROR_INVALID_ADDR;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    p_request->p_next = NULL;
+
+    NRFX_LOCK_TAKE(m_spim_lock);
+    if (p_cb->p_bus_tail != NULL)
+    {
+        p_cb->p_bus_tail->p_next = p_request;
+    }
+    else
+    {
+        p_cb->p_bus_head = p_request;
+    }
+    p_cb->p_bus_tail = p_request;
+    NRFX_LOCK_GIVE(m_spim_lock);
+
+    (void)bus_pending_start(SPIM_REG(p_instance), p_cb);
+
+    return NRFX_SUCCESS;
+}
+
+nrfx_err_t nrfx_spim_circular_start(nrfx_spim_t const *                 p_instance,
+                                    nrfx_spim_circular_config_t const * p_config)
+{
+    spim_control_block_t * p_cb   = SPIM_CB(p_instance);
+    NRF_SPIM_Type *        p_spim = SPIM_REG(p_instance);
+    NRFX_ASSERT(p_cb->state != NRFX_DRV_STATE_UNINITIALIZED);
+    NRFX_ASSERT(!p_cb->suspended);
+    NRFX_ASSERT(p_config->p_buffer);
+    NRFX_ASSERT(p_config->p_counter);
+    NRFX_ASSERT(p_config->p_tx_buffer != NULL || p_config->tx_length == 0);
+    NRFX_ASSERT((p_config->sample_count >= 2) && ((p_config->sample_count % 2) == 0));
+    NRFX_ASSERT(SPIM_LENGTH_VALIDATE(p_instance->drv_inst_idx,
+                                     p_config->sample_size,
+                                     p_config->tx_length));
+#if NRFX_CHECK(NRFX_SPIM_EXTENDED_ENABLED)
+    NRFX_ASSERT(p_cb->use_hw_ss || (p_cb->ss_pin == NRFX_SPIM_PIN_NOT_USED));
+#else
+    NRFX_ASSERT(p_cb->ss_pin == NRFX_SPIM_PIN_NOT_USED);
+#endif
+
+    nrfx_err_t err_code;
+
+    if (!p_cb->handler)
+    {
+        err_code = NRFX_ERROR_INVALID_STATE;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    if ((p_config->p_tx_buffer != NULL && !nrfx_is_in_ram(p_config->p_tx_buffer)) ||
+        !nrfx_is_in_ram(p_config->p_buffer))
+    {
+        err_code = NRFX_ERROR_INVALID_ADDR;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    NRFX_LOCK_TAKE(m_spim_lock);
+    bool busy = p_cb->transfer_in_progress || p_cb->list_active ||
+                p_cb->bus_xfer || (p_cb->p_bus_head != NULL);
+    if (!busy)
+    {
+        p_cb->transfer_in_progress = true;
+    }
+    NRFX_LOCK_GIVE(m_spim_lock);
+
+    if (busy)
+    {
+        err_code = NRFX_ERROR_BUSY;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    device_apply(p_spim, p_cb, &p_cb->instance_device);
+
+    p_cb->p_circular_buffer          = p_config->p_buffer;
+    p_cb->circular_sample_size       = p_config->sample_size;
+    p_cb->circular_half_size         = p_config->sample_size * (p_config->sample_count / 2);
+    p_cb->circular_second_half       = false;
+    p_cb->p_circular_counter         = p_config->p_counter;
+    p_cb->circular_count_ppi_channel = p_config->count_ppi_channel;
+    p_cb->circular_stop_ppi_channel  = p_config->stop_ppi_channel;
+    p_cb->circular_active            = true;
+
+    // The counter stops the SPIM right after the last transfer of each half of the buffer,
+    // when the bus is idle until the next transfer is triggered.
+    nrf_timer_task_trigger(p_config->p_counter, NRF_TIMER_TASK_STOP);
+    nrf_timer_mode_set(p_config->p_counter, NRF_TIMER_MODE_COUNTER);
+    nrf_timer_bit_width_set(p_config->p_counter, NRF_TIMER_BIT_WIDTH_16);
+    nrf_timer_cc_set(p_config->p_counter, NRF_TIMER_CC_CHANNEL0, p_config->sample_count / 2);
+    nrf_timer_shorts_enable(p_config->p_counter, NRF_TIMER_SHORT_COMPARE0_CLEAR_MASK);
+    nrf_timer_task_trigger(p_config->p_counter, NRF_TIMER_TASK_CLEAR);
+    nrf_timer_task_trigger(p_config->p_counter, NRF_TIMER_TASK_START);
+
+    nrfx_gppi_channel_endpoints_setup(p_config->count_ppi_channel,
+                                      nrf_spim_event_address_get(p_spim, NRF_SPIM_EVENT_END),
+                                      nrf_timer_task_address_get(p_config->p_counter,
+                                                                 NRF_TIMER_TASK_COUNT));
+    nrfx_gppi_channel_endpoints_setup(p_config->stop_ppi_channel,
+                                      nrf_timer_event_address_get(p_config->p_counter,
+                                                                  NRF_TIMER_EVENT_COMPARE0),
+                                      nrf_spim_task_address_get(p_spim, NRF_SPIM_TASK_STOP));
+    nrfx_gppi_channels_enable(NRFX_BIT(p_config->count_ppi_channel) |
+                              NRFX_BIT(p_config->stop_ppi_channel));
+
+    nrf_spim_tx_buffer_set(p_spim, p_config->p_tx_buffer, p_config->tx_length);
+    nrf_spim_rx_buffer_set(p_spim, p_config->p_buffer, p_config->sample_size);
+    nrf_spim_tx_list_disable(p_spim);
+    nrf_spim_rx_list_enable(p_spim);
+
+    nrf_spim_event_clear(p_spim, NRF_SPIM_EVENT_END);
+    nrf_spim_event_clear(p_spim, NRF_SPIM_EVENT_STOPPED);
+    nrf_spim_int_disable(p_spim, NRF_SPIM_INT_END_MASK);
+    nrf_spim_int_enable(p_spim, NRF_SPIM_INT_STOPPED_MASK);
+
+    NRFX_LOG_INFO("Circular acquisition started, %d samples of %d bytes.",
+                  p_config->sample_count,
+                  (int)p_config->sample_size);
+    return NRFX_SUCCESS;
+}
+
+void nrfx_spim_circular_stop(nrfx_spim_t const * p_instance)
+{
+    spim_control_block_t * p_cb   = SPIM_CB(p_instance);
+    NRF_SPIM_Type *        p_spim = SPIM_REG(p_instance);
+    NRFX_ASSERT(p_cb->circular_active);
+
+    nrf_spim_int_disable(p_spim, NRF_SPIM_INT_STOPPED_MASK);
+
+    nrfx_gppi_channels_disable(NRFX_BIT(p_cb->circular_count_ppi_channel) |
+                               NRFX_BIT(p_cb->circular_stop_ppi_channel));
+    nrfx_gppi_event_endpoint_clear(p_cb->circular_count_ppi_channel,
+                                   nrf_spim_event_address_get(p_spim, NRF_SPIM_EVENT_END));
+    nrfx_gppi_task_endpoint_clear(p_cb->circular_count_ppi_channel,
+                                  nrf_timer_task_address_get(p_cb->p_circular_counter,
+                                                             NRF_TIMER_TASK_COUNT));
+    nrfx_gppi_event_endpoint_clear(p_cb->circular_stop_ppi_channel,
+                                   nrf_timer_event_address_get(p_cb->p_circular_counter,
+                                                               NRF_TIMER_EVENT_COMPARE0));
+    nrfx_gppi_task_endpoint_clear(p_cb->circular_stop_ppi_channel,
+                                  nrf_spim_task_address_get(p_spim, NRF_SPIM_TASK_STOP));
+
+    nrf_timer_task_trigger(p_cb->p_circular_counter, NRF_TIMER_TASK_STOP);
+    nrf_timer_shorts_disable(p_cb->p_circular_counter, NRF_TIMER_SHORT_COMPARE0_CLEAR_MASK);
+
+    p_cb->circular_active = false;
+    spim_abort(p_spim, p_cb);
+    nrf_spim_event_clear(p_spim, NRF_SPIM_EVENT_STOPPED);
+    nrf_spim_event_clear(p_spim, NRF_SPIM_EVENT_END);
+    nrf_spim_rx_list_disable(p_spim);
+
+    NRFX_LOG_INFO("Circular acquisition stopped.");
 }
 
 void nrfx_spim_abort(nrfx_spim_t const * p_instance)
 {
-    spim_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    spim_control_block_t * p_cb = SPIM_CB(p_instance);
     NRFX_ASSERT(p_cb->state != NRFX_DRV_STATE_UNINITIALIZED);
 
-    spim_abort(p_instance->p_reg, p_cb);
+    if (p_cb->list_active)
+    {
+        list_item_ss_set(p_cb, &p_cb->p_list[p_cb->list_idx], false);
+    }
+    if (p_cb->bus_xfer)
+    {
+        device_ss_set(p_cb->p_bus_head->p_device, false);
+    }
+    spim_abort(SPIM_REG(p_instance), p_cb);
 }
 
 uint32_t nrfx_spim_start_task_get(nrfx_spim_t const * p_instance)
 {
-    NRF_SPIM_Type * p_spim = (NRF_SPIM_Type *)p_instance->p_reg;
+    NRF_SPIM_Type * p_spim = (NRF_SPIM_Type *)SPIM_REG(p_instance);
     return nrf_spim_task_address_get(p_spim, NRF_SPIM_TASK_START);
 }
 
 uint32_t nrfx_spim_end_event_get(nrfx_spim_t const * p_instance)
 {
-    NRF_SPIM_Type * p_spim = (NRF_SPIM_Type *)p_instance->p_reg;
+    NRF_SPIM_Type * p_spim = (NRF_SPIM_Type *)SPIM_REG(p_instance);
     return nrf_spim_event_address_get(p_spim, NRF_SPIM_EVENT_END);
 }
 
-static void irq_handler(NRF_SPIM_Type * p_spim, spim_control_block_t * p_cb)
+NRFX_IRQ_HANDLER_ATTR static void circular_irq_handler(NRF_SPIM_Type *        p_spim,
+                                                       spim_control_block_t * p_cb)
 {
+    if (!nrf_spim_event_check(p_spim, NRF_SPIM_EVENT_STOPPED))
+    {
+        return;
+    }
+    nrf_spim_event_clear(p_spim, NRF_SPIM_EVENT_STOPPED);
+    nrf_timer_event_clear(p_cb->p_circular_counter, NRF_TIMER_EVENT_COMPARE0);
+
+    p_cb->evt.xfer_desc.p_tx_buffer = NULL;
+    p_cb->evt.xfer_desc.tx_length   = 0;
+    p_cb->evt.xfer_desc.rx_length   = p_cb->circular_half_size;
+
+    if (p_cb->circular_second_half)
+    {
+        // Move the pointer back before the next transfer is triggered.
+        nrf_spim_rx_buffer_set(p_spim, p_cb->p_circular_buffer, p_cb->circular_sample_size);
+
+        p_cb->evt.type                  = NRFX_SPIM_EVENT_FULL_DONE;
+        p_cb->evt.xfer_desc.p_rx_buffer = &p_cb->p_circular_buffer[p_cb->circular_half_size];
+    }
+    else
+    {
+        p_cb->evt.type                  = NRFX_SPIM_EVENT_HALF_DONE;
+        p_cb->evt.xfer_desc.p_rx_buffer = p_cb->p_circular_buffer;
+    }
+    p_cb->circular_second_half = !p_cb->circular_second_half;
+
+    p_cb->handler(&p_cb->evt, p_cb->p_context);
+}
+
+NRFX_IRQ_HANDLER_ATTR static void irq_handler(NRF_SPIM_Type * p_spim, spim_control_block_t * p_cb)
+{
+    if (p_cb->circular_active)
+    {
+        // The END event is generated for every sample and is handled by the (D)PPI only.
+        circular_irq_handler(p_spim, p_cb);
+        return;
+    }
 
 #if NRFX_CHECK(NRFX_SPIM_NRF52_ANOMALY_109_WORKAROUND_ENABLED)
     if ((nrf_spim_int_enable_check(p_spim, NRF_SPIM_INT_STARTED_MASK)) &&
@@ -826,42 +1518,69 @@ static void irq_handler(NRF_SPIM_Type * p_spim, spim_control_block_t * p_cb)
         nrf_spim_event_clear(p_spim, NRF_SPIM_EVENT_END);
         NRFX_ASSERT(p_cb->handler);
         NRFX_LOG_DEBUG("Event: NRF_SPIM_EVENT_END.");
-        finish_transfer(p_cb);
+        if (p_cb->bus_xfer)
+        {
+            bus_request_end(p_spim, p_cb);
+        }
+        else if (!p_cb->list_active)
+        {
+            finish_transfer(p_cb);
+            // Requests queued on the bus wait until the transfer started directly is done.
+            (void)bus_pending_start(p_spim, p_cb);
+        }
+        else if (!list_item_end_handle(p_spim, p_cb))
+        {
+            p_cb->transfer_in_progress = false;
+
+            p_cb->evt.type = NRFX_SPIM_EVENT_LIST_DONE;
+            p_cb->handler(&p_cb->evt, p_cb->p_context);
+            (void)bus_pending_start(p_spim, p_cb);
+        }
     }
 }
 
 #if NRFX_CHECK(NRFX_SPIM0_ENABLED)
-void nrfx_spim_0_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_spim_0_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(spim_0);
     irq_handler(NRF_SPIM0, &m_cb[NRFX_SPIM0_INST_IDX]);
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
 #if NRFX_CHECK(NRFX_SPIM1_ENABLED)
-void nrfx_spim_1_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_spim_1_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(spim_1);
     irq_handler(NRF_SPIM1, &m_cb[NRFX_SPIM1_INST_IDX]);
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
 #if NRFX_CHECK(NRFX_SPIM2_ENABLED)
-void nrfx_spim_2_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_spim_2_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(spim_2);
     irq_handler(NRF_SPIM2, &m_cb[NRFX_SPIM2_INST_IDX]);
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
 #if NRFX_CHECK(NRFX_SPIM3_ENABLED)
-void nrfx_spim_3_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_spim_3_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(spim_3);
     irq_handler(NRF_SPIM3, &m_cb[NRFX_SPIM3_INST_IDX]);
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
 #if NRFX_CHECK(NRFX_SPIM4_ENABLED)
-void nrfx_spim_4_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_spim_4_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(spim_4);
     irq_handler(NRF_SPIM4, &m_cb[NRFX_SPIM4_INST_IDX]);
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
@@ -43,6 +43,7 @@
 #endif
 
 #include <nrfx_spis.h>
+#include <helpers/nrfx_prof.h>
 #include "prs/nrfx_prs.h"
 
 #define NRFX_LOG_MODULE SPIS
@@ -122,10 +123,14 @@ typedef struct
     volatile nrfx_spis_state_t spi_state;       //!< SPI slave state.
     void *                     p_context;       //!< Context set on initialization.
     bool                       skip_gpio_cfg;
+    nrfx_spis_queue_t *        p_queue;         //!< Transaction queue. NULL if the queue mode is not active.
 } spis_cb_t;
 
 static spis_cb_t m_cb[NRFX_SPIS_ENABLED_COUNT];
 
+/** @brief Lock of the transaction queues of all the instances. */
+NRFX_LOCK_DECLARE(m_spis_lock);
+
 static void configure_pins(NRF_SPIS_Type *            p_spis,
                            nrfx_spis_config_t const * p_config)
 {
@@ -262,6 +267,7 @@ nrfx_err_t nrfx_spis_init(nrfx_spis_t const *        p_instance,
     p_cb->spi_state = SPIS_STATE_INIT;
     p_cb->handler   = event_handler;
     p_cb->p_context = p_context;
+    p_cb->p_queue   = NULL;
 
 #if defined(USE_DMA_ISSUE_WORKAROUND)
     // Configure a GPIOTE channel to generate interrupts on each falling edge
@@ -428,6 +434,15 @@ nrfx_err_t nrfx_spis_buffers_set(nrfx_spis_t const * p_instance,
         return err_code;
     }
 
+    if (p_cb->p_queue)
+    {
+        err_code = NRFX_ERROR_INVALID_STATE;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
     switch (p_cb->spi_state)
     {
         case SPIS_STATE_INIT:
@@ -456,8 +471,206 @@ nrfx_err_t nrfx_spis_buffers_set(nrfx_spis_t const * p_instance,
     return err_code;
 }
 
-static void spis_irq_handler(NRF_SPIS_Type * p_spis, spis_cb_t * p_cb)
+/**
+ * @brief Function for giving the next queued buffer pair to the peripheral.
+ *
+ * Must be called with the semaphore held by the CPU. If no buffer pair is queued,
+ * the semaphore is kept until @ref nrfx_spis_queue_push is called.
+ *
+ * @param[in] p_spis  SPIS instance register.
+ * @param[in] p_queue Transaction queue.
+ */
+static void queue_arm(NRF_SPIS_Type * p_spis, nrfx_spis_queue_t * p_queue)
+{
+    if (p_queue->armed == p_queue->queued)
+    {
+        p_queue->starved = true;
+        return;
+    }
+
+    nrfx_spis_buffers_t const * p_buffers = &p_queue->p_buffers[p_queue->armed % p_queue->count];
+
+    nrf_spis_tx_buffer_set(p_spis, p_buffers->p_tx_buffer, p_buffers->tx_length);
+    nrf_spis_rx_buffer_set(p_spis, p_buffers->p_rx_buffer, p_buffers->rx_length);
+    p_queue->armed++;
+    p_queue->starved = false;
+
+    nrf_spis_task_trigger(p_spis, NRF_SPIS_TASK_RELEASE);
+}
+
+nrfx_err_t nrfx_spis_queue_start(nrfx_spis_t const * p_instance, nrfx_spis_queue_t * p_queue)
+{
+    NRFX_ASSERT(p_queue);
+    NRFX_ASSERT(p_queue->p_buffers);
+    NRFX_ASSERT(p_queue->count > 0);
+
+    spis_cb_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    NRFX_ASSERT(p_cb->state != NRFX_DRV_STATE_UNINITIALIZED);
+    nrfx_err_t err_code;
+
+    if (p_cb->p_queue || (p_cb->spi_state == SPIS_BUFFER_RESOURCE_REQUESTED))
+    {
+        err_code = NRFX_ERROR_INVALID_STATE;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    p_queue->queued    = 0;
+    p_queue->armed     = 0;
+    p_queue->completed = 0;
+    p_queue->starved   = false;
+
+    p_cb->p_queue   = p_queue;
+    p_cb->spi_state = SPIS_STATE_INIT;
+
+    // The first buffer pair, if already queued, is given to the peripheral
+    // when the semaphore is acquired.
+    nrf_spis_task_trigger(p_instance->p_reg, NRF_SPIS_TASK_ACQUIRE);
+
+    err_code = NRFX_SUCCESS;
+    NRFX_LOG_INFO("Function: %s, error code: %s.", __func__, NRFX_LOG_ERROR_STRING_GET(err_code));
+    return err_code;
+}
+
+nrfx_err_t nrfx_spis_queue_push(nrfx_spis_t const *         p_instance,
+                                nrfx_spis_buffers_t const * p_buffers)
 {
+    NRFX_ASSERT(p_buffers);
+    NRFX_ASSERT(p_buffers->p_tx_buffer != NULL || p_buffers->tx_length == 0);
+    NRFX_ASSERT(p_buffers->p_rx_buffer != NULL || p_buffers->rx_length == 0);
+
+    spis_cb_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    nrfx_spis_queue_t * p_queue = p_cb->p_queue;
+    nrfx_err_t err_code;
+
+    if (!p_queue)
+    {
+        err_code = NRFX_ERROR_INVALID_STATE;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    if (!SPIS_LENGTH_VALIDATE(p_instance->drv_inst_idx,
+                              p_buffers->rx_length,
+                              p_buffers->tx_length))
+    {
+        return NRFX_ERROR_INVALID_LENGTH;
+    }
+
+    if ((p_buffers->p_tx_buffer != NULL && !nrfx_is_in_ram(p_buffers->p_tx_buffer)) ||
+        (p_buffers->p_rx_buffer != NULL && !nrfx_is_in_ram(p_buffers->p_rx_buffer)))
+    {
+        err_code = NRFX_ERROR_INVALID_ADDR;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    err_code = NRFX_SUCCESS;
+
+    NRFX_LOCK_TAKE(m_spis_lock);
+    if (p_queue->queued - p_queue->completed == p_queue->count)
+    {
+        err_code = NRFX_ERROR_NO_MEM;
+    }
+    else
+    {
+        p_queue->p_buffers[p_queue->queued % p_queue->count] = *p_buffers;
+        p_queue->queued++;
+
+        if (p_queue->starved)
+        {
+            queue_arm(p_instance->p_reg, p_queue);
+        }
+    }
+    NRFX_LOCK_GIVE(m_spis_lock);
+
+    if (err_code != NRFX_SUCCESS)
+    {
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+    }
+    return err_code;
+}
+
+void nrfx_spis_queue_stop(nrfx_spis_t const * p_instance)
+{
+    spis_cb_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    NRFX_ASSERT(p_cb->p_queue);
+
+    NRFX_LOCK_TAKE(m_spis_lock);
+    if (p_cb->p_queue->starved)
+    {
+        // Give the semaphore back with empty buffers, so that the master gets
+        // the DEF and ORC characters as before the queue mode was started.
+        nrf_spis_tx_buffer_set(p_instance->p_reg, NULL, 0);
+        nrf_spis_rx_buffer_set(p_instance->p_reg, NULL, 0);
+        nrf_spis_task_trigger(p_instance->p_reg, NRF_SPIS_TASK_RELEASE);
+    }
+    p_cb->p_queue = NULL;
+    NRFX_LOCK_GIVE(m_spis_lock);
+
+    NRFX_LOG_INFO("Queue mode stopped.");
+}
+
+/**
+ * @brief Function for handling the SPIS events in the transaction queue mode.
+ *
+ * @param[in] p_spis SPIS instance register.
+ * @param[in] p_cb   SPIS instance control block.
+ */
+NRFX_IRQ_HANDLER_ATTR static void spis_queue_irq_handler(NRF_SPIS_Type * p_spis, spis_cb_t * p_cb)
+{
+    nrfx_spis_queue_t * p_queue = p_cb->p_queue;
+
+    // The semaphore is acquired by the END_ACQUIRE shortcut right after the transaction,
+    // so the next buffer pair is given to the peripheral before the completed
+    // transaction is reported.
+    if (nrf_spis_event_check(p_spis, NRF_SPIS_EVENT_ACQUIRED))
+    {
+        nrf_spis_event_clear(p_spis, NRF_SPIS_EVENT_ACQUIRED);
+        NRFX_LOG_DEBUG("SPIS: Event: %s.", EVT_TO_STR(NRF_SPIS_EVENT_ACQUIRED));
+
+        NRFX_LOCK_TAKE(m_spis_lock);
+        queue_arm(p_spis, p_queue);
+        NRFX_LOCK_GIVE(m_spis_lock);
+    }
+
+    if (nrf_spis_event_check(p_spis, NRF_SPIS_EVENT_END))
+    {
+        nrf_spis_event_clear(p_spis, NRF_SPIS_EVENT_END);
+        NRFX_LOG_DEBUG("SPIS: Event: %s.", EVT_TO_STR(NRF_SPIS_EVENT_END));
+
+        // Transactions performed while the queue was starved
+        // do not complete any buffer pair.
+        if (p_queue->completed != p_queue->armed)
+        {
+            nrfx_spis_evt_t event;
+
+            p_queue->completed++;
+
+            event.evt_type  = NRFX_SPIS_XFER_DONE;
+            event.rx_amount = nrf_spis_rx_amount_get(p_spis);
+            event.tx_amount = nrf_spis_tx_amount_get(p_spis);
+            p_cb->handler(&event, p_cb->p_context);
+        }
+    }
+}
+
+NRFX_IRQ_HANDLER_ATTR static void spis_irq_handler(NRF_SPIS_Type * p_spis, spis_cb_t * p_cb)
+{
+    if (p_cb->p_queue)
+    {
+        spis_queue_irq_handler(p_spis, p_cb);
+        return;
+    }
+
     // @note: as multiple events can be pending for processing, the correct event processing order
     // is as follows:
     // - SPI semaphore acquired event.
@@ -506,30 +719,38 @@ static void spis_irq_handler(NRF_SPIS_Type * p_spis, spis_cb_t * p_cb)
 }
 
 #if NRFX_CHECK(NRFX_SPIS0_ENABLED)
-void nrfx_spis_0_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_spis_0_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(spis_0);
     spis_irq_handler(NRF_SPIS0, &m_cb[NRFX_SPIS0_INST_IDX]);
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
 #if NRFX_CHECK(NRFX_SPIS1_ENABLED)
-void nrfx_spis_1_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_spis_1_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(spis_1);
     spis_irq_handler(NRF_SPIS1, &m_cb[NRFX_SPIS1_INST_IDX]);
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
 #if NRFX_CHECK(NRFX_SPIS2_ENABLED)
-void nrfx_spis_2_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_spis_2_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(spis_2);
     spis_irq_handler(NRF_SPIS2, &m_cb[NRFX_SPIS2_INST_IDX]);
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
 #if NRFX_CHECK(NRFX_SPIS3_ENABLED)
-void nrfx_spis_3_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_spis_3_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(spis_3);
     spis_irq_handler(NRF_SPIS3, &m_cb[NRFX_SPIS3_INST_IDX]);
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
@@ -36,6 +36,10 @@
 #if NRFX_CHECK(NRFX_TEMP_ENABLED)
 
 #include <nrfx_temp.h>
+#include <helpers/nrfx_prof.h>
+#if defined(PPI_PRESENT) || defined(DPPI_PRESENT)
+#include <helpers/nrfx_gppi.h>
+#endif
 
 #if !defined(USE_WORKAROUND_FOR_TEMP_OFFSET_ANOMALY) && defined(NRF51)
 // Enable workaround for nRF51 series anomaly 28
@@ -55,6 +59,19 @@ static nrfx_drv_state_t m_temp_state;
 /** @brief Pointer to handler to be called from interrupt routine. */
 static nrfx_temp_data_handler_t m_data_handler;
 
+#if defined(PPI_PRESENT) || defined(DPPI_PRESENT)
+/** @brief Control block of periodic measurements. */
+static struct
+{
+    bool     active;     ///< True if periodic measurements are started.
+    bool     reported;   ///< True if any result was reported since the start.
+    uint8_t  channel;    ///< (D)PPI channel connecting the trigger event to the START task.
+    uint32_t event_addr; ///< Address of the trigger event.
+    uint32_t threshold;  ///< Change threshold in raw units.
+    int32_t  last;       ///< Last reported result.
+} m_periodic;
+#endif
+
 nrfx_err_t nrfx_temp_init(nrfx_temp_config_t const * p_config, nrfx_temp_data_handler_t handler)
 {
     NRFX_ASSERT(p_config);
@@ -84,6 +101,12 @@ nrfx_err_t nrfx_temp_init(nrfx_temp_config_t const * p_config, nrfx_temp_data_ha
 void nrfx_temp_uninit(void)
 {
     NRFX_ASSERT(m_temp_state == NRFX_DRV_STATE_INITIALIZED);
+#if defined(PPI_PRESENT) || defined(DPPI_PRESENT)
+    if (m_periodic.active)
+    {
+        nrfx_temp_periodic_stop();
+    }
+#endif
     nrf_temp_task_trigger(NRF_TEMP, NRF_TEMP_TASK_STOP);
 
     if (m_data_handler)
@@ -133,8 +156,83 @@ nrfx_err_t nrfx_temp_measure(void)
     return result;
 }
 
-void nrfx_temp_irq_handler(void)
+#if defined(PPI_PRESENT) || defined(DPPI_PRESENT)
+nrfx_err_t nrfx_temp_periodic_start(uint32_t event_addr, uint32_t threshold)
+{
+    NRFX_ASSERT(m_temp_state == NRFX_DRV_STATE_INITIALIZED);
+    NRFX_ASSERT(event_addr);
+
+    if (!m_data_handler || m_periodic.active)
+    {
+        return NRFX_ERROR_INVALID_STATE;
+    }
+
+    nrfx_err_t err_code = nrfx_gppi_channel_alloc(&m_periodic.channel);
+    if (err_code != NRFX_SUCCESS)
+    {
+        return err_code;
+    }
+
+    m_periodic.event_addr = event_addr;
+    m_periodic.threshold  = threshold;
+    m_periodic.reported   = false;
+    m_periodic.active     = true;
+
+    nrfx_gppi_channel_endpoints_setup(m_periodic.channel,
+                                      event_addr,
+                                      nrf_temp_task_address_get(NRF_TEMP,
+                                                                NRF_TEMP_TASK_START));
+    nrfx_gppi_channels_enable(NRFX_BIT(m_periodic.channel));
+
+    return NRFX_SUCCESS;
+}
+
+void nrfx_temp_periodic_stop(void)
+{
+    NRFX_ASSERT(m_temp_state == NRFX_DRV_STATE_INITIALIZED);
+    NRFX_ASSERT(m_periodic.active);
+
+    nrfx_gppi_channels_disable(NRFX_BIT(m_periodic.channel));
+    nrfx_gppi_event_endpoint_clear(m_periodic.channel, m_periodic.event_addr);
+    nrfx_gppi_task_endpoint_clear(m_periodic.channel,
+                                  nrf_temp_task_address_get(NRF_TEMP, NRF_TEMP_TASK_START));
+    (void)nrfx_gppi_channel_free(m_periodic.channel);
+
+    m_periodic.active = false;
+}
+
+/**
+ * @brief Function for checking if the result of the periodic measurement is to be reported.
+ *
+ * @param[in] raw_temp Result of the measurement.
+ *
+ * @retval true  The result is to be reported.
+ * @retval false The result differs insignificantly from the last reported one.
+ */
+static bool periodic_result_check(int32_t raw_temp)
+{
+    if (!m_periodic.active)
+    {
+        return true;
+    }
+
+    int32_t  diff = raw_temp - m_periodic.last;
+    uint32_t change = (uint32_t)((diff < 0) ? -diff : diff);
+
+    if (m_periodic.reported && (change <= m_periodic.threshold))
+    {
+        return false;
+    }
+
+    m_periodic.last     = raw_temp;
+    m_periodic.reported = true;
+    return true;
+}
+#endif
+
+NRFX_IRQ_HANDLER_ATTR void nrfx_temp_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(temp);
     NRFX_ASSERT(m_data_handler);
 
     nrf_temp_task_trigger(NRF_TEMP, NRF_TEMP_TASK_STOP);
@@ -142,7 +240,13 @@ void nrfx_temp_irq_handler(void)
 
     uint32_t raw_temp = nrfx_temp_result_get();
 
-    m_data_handler(raw_temp);
+#if defined(PPI_PRESENT) || defined(DPPI_PRESENT)
+    if (periodic_result_check((int32_t)raw_temp))
+#endif
+    {
+        m_data_handler(raw_temp);
+    }
+    NRFX_PROF_IRQ_EXIT();
 }
 
 #endif // NRFX_CHECK(NRFX_TEMP_ENABLED)
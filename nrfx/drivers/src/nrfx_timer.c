@@ -58,6 +58,7 @@
 #endif
 
 #include <nrfx_timer.h>
+#include <helpers/nrfx_prof.h>
 
 #define NRFX_LOG_MODULE TIMER
 #include <nrfx_log.h>
@@ -267,9 +268,9 @@ void nrfx_timer_compare_int_disable(nrfx_timer_t const * p_instance,
         nrf_timer_compare_int_get(channel));
 }
 
-static void irq_handler(NRF_TIMER_Type        * p_reg,
-                        timer_control_block_t * p_cb,
-                        uint8_t                 channel_count)
+NRFX_IRQ_HANDLER_ATTR static void irq_handler(NRF_TIMER_Type        * p_reg,
+                                              timer_control_block_t * p_cb,
+                                              uint8_t                 channel_count)
 {
     uint8_t i;
     for (i = 0; i < channel_count; ++i)
@@ -291,42 +292,52 @@ static void irq_handler(NRF_TIMER_Type        * p_reg,
 }
 
 #if NRFX_CHECK(NRFX_TIMER0_ENABLED)
-void nrfx_timer_0_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_timer_0_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(timer_0);
     irq_handler(NRF_TIMER0, &m_cb[NRFX_TIMER0_INST_IDX],
         NRF_TIMER_CC_CHANNEL_COUNT(0));
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
 #if NRFX_CHECK(NRFX_TIMER1_ENABLED)
-void nrfx_timer_1_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_timer_1_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(timer_1);
     irq_handler(NRF_TIMER1, &m_cb[NRFX_TIMER1_INST_IDX],
         NRF_TIMER_CC_CHANNEL_COUNT(1));
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
 #if NRFX_CHECK(NRFX_TIMER2_ENABLED)
-void nrfx_timer_2_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_timer_2_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(timer_2);
     irq_handler(NRF_TIMER2, &m_cb[NRFX_TIMER2_INST_IDX],
         NRF_TIMER_CC_CHANNEL_COUNT(2));
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
 #if NRFX_CHECK(NRFX_TIMER3_ENABLED)
-void nrfx_timer_3_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_timer_3_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(timer_3);
     irq_handler(NRF_TIMER3, &m_cb[NRFX_TIMER3_INST_IDX],
         NRF_TIMER_CC_CHANNEL_COUNT(3));
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
 #if NRFX_CHECK(NRFX_TIMER4_ENABLED)
-void nrfx_timer_4_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_timer_4_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(timer_4);
     irq_handler(NRF_TIMER4, &m_cb[NRFX_TIMER4_INST_IDX],
         NRF_TIMER_CC_CHANNEL_COUNT(4));
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
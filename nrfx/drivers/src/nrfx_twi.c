@@ -40,9 +40,24 @@
 #endif
 
 #include <nrfx_twi.h>
+#include <helpers/nrfx_prof.h>
 #include <hal/nrf_gpio.h>
 #include "prs/nrfx_prs.h"
 
+#if NRFX_CHECK(NRFX_TWI_EASYDMA_BRIDGE_ENABLED)
+#if !defined(TWIM_PRESENT)
+#error "TWI EasyDMA bridge requires the TWIM peripheral."
+#endif
+#include <hal/nrf_twim.h>
+
+// TWI and TWIM instances with the same ID share the base address, so the registers
+// of the legacy instance can be accessed through the TWIM HAL.
+#define TWI_TO_TWIM(p_twi) ((NRF_TWIM_Type *)(p_twi))
+
+#define TWI_DMA_LENGTH_VALIDATE(length1, length2) \
+    NRFX_EASYDMA_LENGTH_VALIDATE(TWIM0, length1, length2)
+#endif
+
 #define NRFX_LOG_MODULE TWI
 #include <nrfx_log.h>
 
@@ -110,6 +125,10 @@ typedef struct
     size_t                  bytes_transferred;
     bool                    hold_bus_uninit;
     bool                    skip_gpio_cfg;
+#if NRFX_CHECK(NRFX_TWI_EASYDMA_BRIDGE_ENABLED)
+    bool                    bus_held;
+    bool                    dma_active;
+#endif
 } twi_control_block_t;
 
 static twi_control_block_t m_cb[NRFX_TWI_ENABLED_COUNT];
@@ -203,6 +222,10 @@ nrfx_err_t nrfx_twi_init(nrfx_twi_t const *        p_instance,
     p_cb->busy            = false;
     p_cb->hold_bus_uninit = p_config->hold_bus_uninit;
     p_cb->skip_gpio_cfg   = p_config->skip_gpio_cfg;
+#if NRFX_CHECK(NRFX_TWI_EASYDMA_BRIDGE_ENABLED)
+    p_cb->bus_held        = false;
+    p_cb->dma_active      = false;
+#endif
 
     /* To secure correct signal levels on the pins used by the TWI
        master when the system is in OFF mode, and when the TWI master is
@@ -281,6 +304,11 @@ void nrfx_twi_disable(nrfx_twi_t const * p_instance)
     NRF_TWI_Type * p_twi = p_instance->p_twi;
     nrf_twi_int_disable(p_twi, NRF_TWI_ALL_INTS_MASK);
     nrf_twi_shorts_disable(p_twi, NRF_TWI_ALL_SHORTS_MASK);
+#if NRFX_CHECK(NRFX_TWI_EASYDMA_BRIDGE_ENABLED)
+    nrf_twim_shorts_set(TWI_TO_TWIM(p_twi), 0);
+    p_cb->dma_active = false;
+    p_cb->bus_held   = false;
+#endif
     nrf_twi_disable(p_twi);
 
     p_cb->state = NRFX_DRV_STATE_INITIALIZED;
@@ -570,6 +598,177 @@ static nrfx_err_t twi_rx_start_transfer(NRF_TWI_Type        * p_twi,
     return ret_code;
 }
 
+#if NRFX_CHECK(NRFX_TWI_EASYDMA_BRIDGE_ENABLED)
+static bool twi_dma_eligible(twi_control_block_t const *  p_cb,
+                             nrfx_twi_xfer_desc_t const * p_xfer_desc,
+                             uint32_t                     flags)
+{
+    // TXTX transfers and transfers that leave the bus suspended need the per-byte state
+    // machine of TWI. The bus must also not be held by a previous transfer of that kind,
+    // as switching the peripheral mode would release it.
+    if ((p_xfer_desc->type == NRFX_TWI_XFER_TXTX) ||
+        (flags & (NRFX_TWI_FLAG_TX_NO_STOP | NRFX_TWI_FLAG_SUSPEND)) ||
+        p_cb->bus_held)
+    {
+        return false;
+    }
+
+    if (!nrfx_is_in_ram(p_xfer_desc->p_primary_buf) ||
+        ((p_xfer_desc->type == NRFX_TWI_XFER_TXRX) &&
+         !nrfx_is_in_ram(p_xfer_desc->p_secondary_buf)))
+    {
+        return false;
+    }
+
+    return TWI_DMA_LENGTH_VALIDATE(p_xfer_desc->primary_length,
+                                   p_xfer_desc->type == NRFX_TWI_XFER_TXRX ?
+                                   p_xfer_desc->secondary_length : 0);
+}
+
+static void twi_dma_end(NRF_TWI_Type * p_twi, twi_control_block_t * p_cb)
+{
+    NRF_TWIM_Type * p_twim = TWI_TO_TWIM(p_twi);
+
+    if (p_cb->xfer_desc.type == NRFX_TWI_XFER_TX)
+    {
+        p_cb->bytes_transferred = nrf_twim_txd_amount_get(p_twim);
+    }
+    else
+    {
+        if (p_cb->xfer_desc.type == NRFX_TWI_XFER_TXRX)
+        {
+            // Report the transfer as finished after its secondary part, as the per-byte
+            // state machine does.
+            p_cb->p_curr_buf  = p_cb->xfer_desc.p_secondary_buf;
+            p_cb->curr_length = p_cb->xfer_desc.secondary_length;
+        }
+        p_cb->bytes_transferred = nrf_twim_rxd_amount_get(p_twim);
+    }
+
+    nrf_twim_int_disable(p_twim, NRF_TWIM_ALL_INTS_MASK);
+    nrf_twim_shorts_set(p_twim, 0);
+    nrf_twim_disable(p_twim);
+    nrf_twi_enable(p_twi);
+    p_cb->dma_active = false;
+
+    // A premature STOP condition is not signaled by the peripheral as an error.
+    if (!p_cb->error && (p_cb->bytes_transferred != p_cb->curr_length))
+    {
+        p_cb->error = true;
+    }
+}
+
+// Returns true as long as the EasyDMA transfer is in progress, like twi_transfer.
+static bool twi_dma_transfer(NRF_TWI_Type * p_twi, twi_control_block_t * p_cb)
+{
+    NRF_TWIM_Type * p_twim = TWI_TO_TWIM(p_twi);
+
+    if (nrf_twim_event_check(p_twim, NRF_TWIM_EVENT_ERROR))
+    {
+        nrf_twim_event_clear(p_twim, NRF_TWIM_EVENT_ERROR);
+        NRFX_LOG_DEBUG("TWIM: Event: NRF_TWIM_EVENT_ERROR.");
+        if (!p_cb->error)
+        {
+            nrf_twim_task_trigger(p_twim, NRF_TWIM_TASK_STOP);
+            p_cb->error = true;
+        }
+    }
+
+    if (!nrf_twim_event_check(p_twim, NRF_TWIM_EVENT_STOPPED))
+    {
+        return true;
+    }
+
+    nrf_twim_event_clear(p_twim, NRF_TWIM_EVENT_STOPPED);
+    NRFX_LOG_DEBUG("TWIM: Event: NRF_TWIM_EVENT_STOPPED.");
+    twi_dma_end(p_twi, p_cb);
+    return false;
+}
+
+static nrfx_err_t twi_dma_start_transfer(NRF_TWI_Type        * p_twi,
+                                         twi_control_block_t * p_cb)
+{
+    NRF_TWIM_Type *  p_twim   = TWI_TO_TWIM(p_twi);
+    nrfx_err_t       ret_code = NRFX_SUCCESS;
+    volatile int32_t hw_timeout;
+    nrf_twim_task_t  start_task;
+
+    hw_timeout = HW_TIMEOUT;
+
+    // The address, frequency, and pin selection registers are common for both
+    // peripheral modes, so only the mode needs to be switched.
+    nrf_twi_disable(p_twi);
+    nrf_twim_enable(p_twim);
+
+    nrf_twim_event_clear(p_twim, NRF_TWIM_EVENT_STOPPED);
+    nrf_twim_event_clear(p_twim, NRF_TWIM_EVENT_ERROR);
+    (void)nrf_twim_errorsrc_get_and_clear(p_twim);
+
+    p_cb->bytes_transferred = 0;
+    p_cb->error             = false;
+    p_cb->dma_active        = true;
+
+    switch (p_cb->xfer_desc.type)
+    {
+        case NRFX_TWI_XFER_TXRX:
+            nrf_twim_tx_buffer_set(p_twim, p_cb->xfer_desc.p_primary_buf,
+                                   p_cb->xfer_desc.primary_length);
+            nrf_twim_rx_buffer_set(p_twim, p_cb->xfer_desc.p_secondary_buf,
+                                   p_cb->xfer_desc.secondary_length);
+            nrf_twim_shorts_set(p_twim, NRF_TWIM_SHORT_LASTTX_STARTRX_MASK |
+                                        NRF_TWIM_SHORT_LASTRX_STOP_MASK);
+            start_task = NRF_TWIM_TASK_STARTTX;
+            break;
+
+        case NRFX_TWI_XFER_RX:
+            nrf_twim_rx_buffer_set(p_twim, p_cb->xfer_desc.p_primary_buf,
+                                   p_cb->xfer_desc.primary_length);
+            nrf_twim_shorts_set(p_twim, NRF_TWIM_SHORT_LASTRX_STOP_MASK);
+            start_task = NRF_TWIM_TASK_STARTRX;
+            break;
+
+        default:
+            nrf_twim_tx_buffer_set(p_twim, p_cb->xfer_desc.p_primary_buf,
+                                   p_cb->xfer_desc.primary_length);
+            nrf_twim_shorts_set(p_twim, NRF_TWIM_SHORT_LASTTX_STOP_MASK);
+            start_task = NRF_TWIM_TASK_STARTTX;
+            break;
+    }
+
+    if (p_cb->handler)
+    {
+        // STOPPED and ERROR interrupts are at the same positions in both peripheral modes.
+        p_cb->int_mask = NRF_TWIM_INT_STOPPED_MASK | NRF_TWIM_INT_ERROR_MASK;
+        nrf_twim_task_trigger(p_twim, start_task);
+        nrf_twim_int_enable(p_twim, p_cb->int_mask);
+    }
+    else
+    {
+        nrf_twim_task_trigger(p_twim, start_task);
+
+        while ((hw_timeout > 0) &&
+               twi_dma_transfer(p_twi, p_cb))
+        {
+            hw_timeout--;
+        }
+
+        if (hw_timeout <= 0)
+        {
+            // Switching the peripheral back to TWI mode also aborts the transfer.
+            twi_dma_end(p_twi, p_cb);
+            ret_code = NRFX_ERROR_INTERNAL;
+        }
+        else if (p_cb->error)
+        {
+            uint32_t errorsrc = nrf_twi_errorsrc_get_and_clear(p_twi);
+
+            ret_code = errorsrc ? twi_process_error(errorsrc) : NRFX_ERROR_INTERNAL;
+        }
+    }
+    return ret_code;
+}
+#endif // NRFX_CHECK(NRFX_TWI_EASYDMA_BRIDGE_ENABLED)
+
 static nrfx_err_t twi_xfer(NRF_TWI_Type               * p_twi,
                            twi_control_block_t        * p_cb,
                            nrfx_twi_xfer_desc_t const * p_xfer_desc,
@@ -612,6 +811,20 @@ static nrfx_err_t twi_xfer(NRF_TWI_Type               * p_twi,
     p_cb->p_curr_buf  = p_xfer_desc->p_primary_buf;
     nrf_twi_address_set(p_twi, p_xfer_desc->address);
 
+#if NRFX_CHECK(NRFX_TWI_EASYDMA_BRIDGE_ENABLED)
+    bool use_dma = twi_dma_eligible(p_cb, p_xfer_desc, flags);
+
+    // The bus stays held after a TX transfer without a stop condition or
+    // after a suspended transfer, both of which use the per-byte state machine.
+    p_cb->bus_held = !use_dma &&
+                     ((flags & (NRFX_TWI_FLAG_TX_NO_STOP | NRFX_TWI_FLAG_SUSPEND)) != 0);
+
+    if (use_dma)
+    {
+        err_code = twi_dma_start_transfer(p_twi, p_cb);
+    }
+    else
+#endif
     if (p_xfer_desc->type != NRFX_TWI_XFER_RX)
     {
         p_cb->curr_tx_no_stop = ((p_xfer_desc->type == NRFX_TWI_XFER_TX) &&
@@ -676,10 +889,20 @@ uint32_t nrfx_twi_stopped_event_get(nrfx_twi_t const * p_instance)
     return nrf_twi_event_address_get(p_instance->p_twi, NRF_TWI_EVENT_STOPPED);
 }
 
-static void twi_irq_handler(NRF_TWI_Type * p_twi, twi_control_block_t * p_cb)
+NRFX_IRQ_HANDLER_ATTR static void twi_irq_handler(NRF_TWI_Type * p_twi, twi_control_block_t * p_cb)
 {
     NRFX_ASSERT(p_cb->handler);
 
+#if NRFX_CHECK(NRFX_TWI_EASYDMA_BRIDGE_ENABLED)
+    if (p_cb->dma_active)
+    {
+        if (twi_dma_transfer(p_twi, p_cb))
+        {
+            return;
+        }
+    }
+    else
+#endif
     if (twi_transfer(p_twi, p_cb))
     {
         return;
@@ -750,16 +973,20 @@ static void twi_irq_handler(NRF_TWI_Type * p_twi, twi_control_block_t * p_cb)
 }
 
 #if NRFX_CHECK(NRFX_TWI0_ENABLED)
-void nrfx_twi_0_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_twi_0_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(twi_0);
     twi_irq_handler(NRF_TWI0, &m_cb[NRFX_TWI0_INST_IDX]);
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
 #if NRFX_CHECK(NRFX_TWI1_ENABLED)
-void nrfx_twi_1_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_twi_1_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(twi_1);
     twi_irq_handler(NRF_TWI1, &m_cb[NRFX_TWI1_INST_IDX]);
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
@@ -43,7 +43,9 @@
 #endif
 
 #include <nrfx_twim.h>
+#include <helpers/nrfx_prof.h>
 #include <hal/nrf_gpio.h>
+#include <helpers/nrfx_gppi.h>
 #include "prs/nrfx_prs.h"
 
 #define NRFX_LOG_MODULE TWIM
@@ -55,7 +57,8 @@
     (event == NRFX_TWIM_EVT_DATA_NACK    ? "EVT_DATA_NACK"    : \
     (event == NRFX_TWIM_EVT_OVERRUN      ? "EVT_OVERRUN"      : \
     (event == NRFX_TWIM_EVT_BUS_ERROR    ? "EVT_BUS_ERROR"    : \
-                                           "UNKNOWN ERROR")))))
+    (event == NRFX_TWIM_EVT_SEQUENCE_DONE ? "EVT_SEQUENCE_DONE" : \
+                                           "UNKNOWN ERROR"))))))
 
 #define EVT_TO_STR_TWIM(event)                                        \
     (event == NRF_TWIM_EVENT_STOPPED   ? "NRF_TWIM_EVENT_STOPPED"   : \
@@ -136,10 +139,36 @@ typedef struct
 #if NRFX_CHECK(NRFX_TWIM_NRF52_ANOMALY_109_WORKAROUND_ENABLED)
     nrf_twim_frequency_t    bus_frequency;
 #endif
+    nrfx_twim_sequence_t const * p_sequence;
+    size_t                       sequence_idx;
+    size_t                       sequence_rx_offset;
+    bool                         sequence_armed;
+    volatile bool                sequence_stopping;
+    bool                         suspended;
 } twim_control_block_t;
 
 static twim_control_block_t m_cb[NRFX_TWIM_ENABLED_COUNT];
 
+#if (NRFX_CHECK(NRFX_TWIM0_ENABLED) + NRFX_CHECK(NRFX_TWIM1_ENABLED) + \
+     NRFX_CHECK(NRFX_TWIM2_ENABLED) + NRFX_CHECK(NRFX_TWIM3_ENABLED)) == 1
+// Only one instance is enabled, so its registers and control block are known at compile time.
+#if NRFX_CHECK(NRFX_TWIM0_ENABLED)
+#define TWIM_SINGLE_REG NRF_TWIM0
+#elif NRFX_CHECK(NRFX_TWIM1_ENABLED)
+#define TWIM_SINGLE_REG NRF_TWIM1
+#elif NRFX_CHECK(NRFX_TWIM2_ENABLED)
+#define TWIM_SINGLE_REG NRF_TWIM2
+#elif NRFX_CHECK(NRFX_TWIM3_ENABLED)
+#define TWIM_SINGLE_REG NRF_TWIM3
+#endif
+
+#define TWIM_REG(p_instance) ((void)(p_instance), TWIM_SINGLE_REG)
+#define TWIM_CB(p_instance)  ((void)(p_instance), &m_cb[0])
+#else
+#define TWIM_REG(p_instance) ((p_instance)->p_twim)
+#define TWIM_CB(p_instance)  (&m_cb[(p_instance)->drv_inst_idx])
+#endif
+
 static nrfx_err_t twi_process_error(uint32_t errorsrc)
 {
     nrfx_err_t ret = NRFX_ERROR_INTERNAL;
@@ -275,8 +304,8 @@ nrfx_err_t nrfx_twim_init(nrfx_twim_t const *        p_instance,
                           void *                     p_context)
 {
     NRFX_ASSERT(p_config);
-    twim_control_block_t * p_cb  = &m_cb[p_instance->drv_inst_idx];
-    NRF_TWIM_Type * p_twim = p_instance->p_twim;
+    twim_control_block_t * p_cb  = TWIM_CB(p_instance);
+    NRF_TWIM_Type * p_twim = TWIM_REG(p_instance);
     nrfx_err_t err_code;
 
     if (p_cb->state != NRFX_DRV_STATE_UNINITIALIZED)
@@ -303,7 +332,7 @@ nrfx_err_t nrfx_twim_init(nrfx_twim_t const *        p_instance,
         nrfx_twim_3_irq_handler,
         #endif
     };
-    if (nrfx_prs_acquire(p_instance->p_twim,
+    if (nrfx_prs_acquire(TWIM_REG(p_instance),
             irq_handlers[p_instance->drv_inst_idx]) != NRFX_SUCCESS)
     {
         err_code = NRFX_ERROR_BUSY;
@@ -334,9 +363,9 @@ nrfx_err_t nrfx_twim_init(nrfx_twim_t const *        p_instance,
 
     if (p_cb->handler)
     {
-        NRFX_IRQ_PRIORITY_SET(nrfx_get_irq_number(p_instance->p_twim),
+        NRFX_IRQ_PRIORITY_SET(nrfx_get_irq_number(TWIM_REG(p_instance)),
             p_config->interrupt_priority);
-        NRFX_IRQ_ENABLE(nrfx_get_irq_number(p_instance->p_twim));
+        NRFX_IRQ_ENABLE(nrfx_get_irq_number(TWIM_REG(p_instance)));
     }
 
     p_cb->state = NRFX_DRV_STATE_INITIALIZED;
@@ -348,35 +377,36 @@ nrfx_err_t nrfx_twim_init(nrfx_twim_t const *        p_instance,
 
 void nrfx_twim_uninit(nrfx_twim_t const * p_instance)
 {
-    twim_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    twim_control_block_t * p_cb = TWIM_CB(p_instance);
     NRFX_ASSERT(p_cb->state != NRFX_DRV_STATE_UNINITIALIZED);
 
     if (p_cb->handler)
     {
-        NRFX_IRQ_DISABLE(nrfx_get_irq_number(p_instance->p_twim));
+        NRFX_IRQ_DISABLE(nrfx_get_irq_number(TWIM_REG(p_instance)));
     }
     nrfx_twim_disable(p_instance);
 
 #if NRFX_CHECK(NRFX_PRS_ENABLED)
-    nrfx_prs_release(p_instance->p_twim);
+    nrfx_prs_release(TWIM_REG(p_instance));
 #endif
 
     if (!p_cb->skip_gpio_cfg && !p_cb->hold_bus_uninit)
     {
-        nrf_gpio_cfg_default(nrf_twim_scl_pin_get(p_instance->p_twim));
-        nrf_gpio_cfg_default(nrf_twim_sda_pin_get(p_instance->p_twim));
+        nrf_gpio_cfg_default(nrf_twim_scl_pin_get(TWIM_REG(p_instance)));
+        nrf_gpio_cfg_default(nrf_twim_sda_pin_get(TWIM_REG(p_instance)));
     }
 
+    p_cb->suspended = false;
     p_cb->state = NRFX_DRV_STATE_UNINITIALIZED;
     NRFX_LOG_INFO("Instance uninitialized: %d.", p_instance->drv_inst_idx);
 }
 
 void nrfx_twim_enable(nrfx_twim_t const * p_instance)
 {
-    twim_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    twim_control_block_t * p_cb = TWIM_CB(p_instance);
     NRFX_ASSERT(p_cb->state == NRFX_DRV_STATE_INITIALIZED);
 
-    nrf_twim_enable(p_instance->p_twim);
+    nrf_twim_enable(TWIM_REG(p_instance));
 
     p_cb->state = NRFX_DRV_STATE_POWERED_ON;
     NRFX_LOG_INFO("Instance enabled: %d.", p_instance->drv_inst_idx);
@@ -384,10 +414,10 @@ void nrfx_twim_enable(nrfx_twim_t const * p_instance)
 
 void nrfx_twim_disable(nrfx_twim_t const * p_instance)
 {
-    twim_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    twim_control_block_t * p_cb = TWIM_CB(p_instance);
     NRFX_ASSERT(p_cb->state != NRFX_DRV_STATE_UNINITIALIZED);
 
-    NRF_TWIM_Type * p_twim = p_instance->p_twim;
+    NRF_TWIM_Type * p_twim = TWIM_REG(p_instance);
     p_cb->int_mask = 0;
     nrf_twim_int_disable(p_twim, NRF_TWIM_ALL_INTS_MASK);
     nrf_twim_shorts_disable(p_twim, NRF_TWIM_ALL_SHORTS_MASK);
@@ -398,10 +428,46 @@ void nrfx_twim_disable(nrfx_twim_t const * p_instance)
     NRFX_LOG_INFO("Instance disabled: %d.", p_instance->drv_inst_idx);
 }
 
+nrfx_err_t nrfx_twim_suspend(nrfx_twim_t const * p_instance)
+{
+    twim_control_block_t * p_cb = TWIM_CB(p_instance);
+    NRFX_ASSERT(p_cb->state != NRFX_DRV_STATE_UNINITIALIZED);
+
+    nrfx_err_t err_code;
+
+    if (p_cb->busy || p_cb->p_sequence != NULL)
+    {
+        err_code = NRFX_ERROR_BUSY;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    // An instance that has been disabled by the user is left as it is.
+    if (p_cb->state == NRFX_DRV_STATE_POWERED_ON)
+    {
+        nrfx_twim_disable(p_instance);
+        p_cb->suspended = true;
+    }
+
+    return NRFX_SUCCESS;
+}
+
+void nrfx_twim_resume(nrfx_twim_t const * p_instance)
+{
+    twim_control_block_t * p_cb = TWIM_CB(p_instance);
+
+    if (p_cb->suspended)
+    {
+        p_cb->suspended = false;
+        nrfx_twim_enable(p_instance);
+    }
+}
 
 bool nrfx_twim_is_busy(nrfx_twim_t const * p_instance)
 {
-    twim_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    twim_control_block_t * p_cb = TWIM_CB(p_instance);
     return p_cb->busy;
 }
 
@@ -667,7 +733,7 @@ nrfx_err_t nrfx_twim_xfer(nrfx_twim_t           const * p_instance,
                                      p_xfer_desc->secondary_length));
 
     nrfx_err_t err_code = NRFX_SUCCESS;
-    twim_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    twim_control_block_t * p_cb = TWIM_CB(p_instance);
 
     // TXRX and TXTX transfers are supported only in non-blocking mode.
     NRFX_ASSERT( !((p_cb->handler == NULL) && (p_xfer_desc->type == NRFX_TWIM_XFER_TXRX)));
@@ -684,26 +750,246 @@ nrfx_err_t nrfx_twim_xfer(nrfx_twim_t           const * p_instance,
     NRFX_LOG_HEXDUMP_DEBUG(p_xfer_desc->p_secondary_buf,
                            p_xfer_desc->secondary_length * sizeof(p_xfer_desc->p_secondary_buf[0]));
 
-    err_code = twim_xfer(p_cb, (NRF_TWIM_Type *)p_instance->p_twim, p_xfer_desc, flags);
+    err_code = twim_xfer(p_cb, (NRF_TWIM_Type *)TWIM_REG(p_instance), p_xfer_desc, flags);
     NRFX_LOG_WARNING("Function: %s, error code: %s.",
                      __func__,
                      NRFX_LOG_ERROR_STRING_GET(err_code));
     return err_code;
 }
 
+static void sequence_xfer_start(NRF_TWIM_Type * p_twim, twim_control_block_t * p_cb, bool hold)
+{
+    nrfx_twim_sequence_t const * p_sequence = p_cb->p_sequence;
+    nrfx_twim_xfer_desc_t        xfer_desc  = p_sequence->p_xfers[p_cb->sequence_idx];
+
+    if (p_cb->sequence_idx == 0)
+    {
+        p_cb->sequence_rx_offset = 0;
+    }
+
+    if (xfer_desc.type == NRFX_TWIM_XFER_RX)
+    {
+        xfer_desc.p_primary_buf = &p_sequence->p_rx_buffer[p_cb->sequence_rx_offset];
+        p_cb->sequence_rx_offset += xfer_desc.primary_length;
+    }
+    else if (xfer_desc.type == NRFX_TWIM_XFER_TXRX)
+    {
+        xfer_desc.p_secondary_buf = &p_sequence->p_rx_buffer[p_cb->sequence_rx_offset];
+        p_cb->sequence_rx_offset += xfer_desc.secondary_length;
+    }
+
+    // Buffers of all transfers were validated when the sequence was started.
+    p_cb->busy = false;
+    if (hold)
+    {
+        nrf_twim_event_clear(p_twim, NRF_TWIM_EVENT_TXSTARTED);
+        nrf_twim_event_clear(p_twim, NRF_TWIM_EVENT_RXSTARTED);
+        (void)twim_xfer(p_cb, p_twim, &xfer_desc, NRFX_TWIM_FLAG_HOLD_XFER);
+        p_cb->sequence_armed = true;
+        nrfx_gppi_channels_enable(NRFX_BIT(p_sequence->ppi_channel));
+    }
+    else
+    {
+        (void)twim_xfer(p_cb, p_twim, &xfer_desc, 0);
+    }
+}
+
+static void sequence_release(twim_control_block_t * p_cb)
+{
+    nrfx_twim_sequence_t const * p_sequence = p_cb->p_sequence;
+
+    if (p_sequence->p_timer != NULL)
+    {
+        nrfx_gppi_channels_disable(NRFX_BIT(p_sequence->ppi_channel));
+    }
+
+    p_cb->p_sequence        = NULL;
+    p_cb->sequence_armed    = false;
+    p_cb->sequence_stopping = false;
+}
+
+/**
+ * @brief Function for processing the end of a transfer that belongs to the sequence.
+ *
+ * @param[in] p_twim  Pointer to the TWIM registers.
+ * @param[in] p_cb    Pointer to the control block.
+ * @param[in] p_event Pointer to the event describing the result of the transfer.
+ */
+static void sequence_xfer_end(NRF_TWIM_Type *         p_twim,
+                              twim_control_block_t *  p_cb,
+                              nrfx_twim_evt_t const * p_event)
+{
+    nrfx_twim_sequence_t const * p_sequence = p_cb->p_sequence;
+    nrfx_twim_evt_t              event;
+
+    if (p_cb->sequence_armed)
+    {
+        // The sweep has been triggered, so the trigger must not restart it until it is done.
+        nrfx_gppi_channels_disable(NRFX_BIT(p_sequence->ppi_channel));
+        p_cb->sequence_armed = false;
+    }
+
+    p_cb->busy = false;
+
+    if (p_event->type != NRFX_TWIM_EVT_DONE)
+    {
+        p_cb->handler(p_event, p_cb->p_context);
+    }
+
+    if (++p_cb->sequence_idx < p_sequence->count)
+    {
+        sequence_xfer_start(p_twim, p_cb, false);
+        return;
+    }
+
+    event.type      = NRFX_TWIM_EVT_SEQUENCE_DONE;
+    event.xfer_desc = p_event->xfer_desc;
+
+    p_cb->sequence_idx = 0;
+    if ((p_sequence->p_timer != NULL) && !p_cb->sequence_stopping)
+    {
+        sequence_xfer_start(p_twim, p_cb, true);
+    }
+    else
+    {
+        sequence_release(p_cb);
+    }
+
+    p_cb->handler(&event, p_cb->p_context);
+}
+
+nrfx_err_t nrfx_twim_sequence_start(nrfx_twim_t const *          p_instance,
+                                    nrfx_twim_sequence_t const * p_sequence)
+{
+    twim_control_block_t * p_cb   = TWIM_CB(p_instance);
+    NRF_TWIM_Type *        p_twim = (NRF_TWIM_Type *)TWIM_REG(p_instance);
+    nrfx_err_t             err_code;
+    size_t                 rx_length = 0;
+
+    NRFX_ASSERT(p_cb->state != NRFX_DRV_STATE_UNINITIALIZED);
+    NRFX_ASSERT(p_sequence->p_xfers);
+    NRFX_ASSERT(p_sequence->count > 0);
+
+    if (!p_cb->handler)
+    {
+        err_code = NRFX_ERROR_INVALID_STATE;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    for (size_t i = 0; i < p_sequence->count; i++)
+    {
+        nrfx_twim_xfer_desc_t const * p_xfer = &p_sequence->p_xfers[i];
+
+        NRFX_ASSERT(p_xfer->type != NRFX_TWIM_XFER_TXTX);
+        NRFX_ASSERT(TWIM_LENGTH_VALIDATE(p_instance->drv_inst_idx,
+                                         p_xfer->primary_length,
+                                         p_xfer->secondary_length));
+
+        if (p_xfer->type == NRFX_TWIM_XFER_RX)
+        {
+            rx_length += p_xfer->primary_length;
+        }
+        else
+        {
+            if (p_xfer->type == NRFX_TWIM_XFER_TXRX)
+            {
+                rx_length += p_xfer->secondary_length;
+            }
+            if (p_xfer->primary_length != 0 && !nrfx_is_in_ram(p_xfer->p_primary_buf))
+            {
+                err_code = NRFX_ERROR_INVALID_ADDR;
+                NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                                 __func__,
+                                 NRFX_LOG_ERROR_STRING_GET(err_code));
+                return err_code;
+            }
+        }
+    }
+
+    if ((rx_length != 0) && !nrfx_is_in_ram(p_sequence->p_rx_buffer))
+    {
+        err_code = NRFX_ERROR_INVALID_ADDR;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    nrf_twim_int_disable(p_twim, NRF_TWIM_ALL_INTS_MASK);
+    if (p_cb->busy || (p_cb->p_sequence != NULL))
+    {
+        nrf_twim_int_enable(p_twim, p_cb->int_mask);
+        err_code = NRFX_ERROR_BUSY;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    p_cb->p_sequence        = p_sequence;
+    p_cb->sequence_idx      = 0;
+    p_cb->sequence_armed    = false;
+    p_cb->sequence_stopping = false;
+
+    if (p_sequence->p_timer != NULL)
+    {
+        nrf_timer_event_t compare_event = nrf_timer_compare_event_get(p_sequence->cc_channel);
+
+        nrfx_gppi_channel_endpoints_setup(p_sequence->ppi_channel,
+            nrf_timer_event_address_get(p_sequence->p_timer, compare_event),
+            nrfx_twim_start_task_get(p_instance, p_sequence->p_xfers[0].type));
+    }
+
+    sequence_xfer_start(p_twim, p_cb, p_sequence->p_timer != NULL);
+
+    NRFX_LOG_INFO("Sequence started, %d transfers.", (int)p_sequence->count);
+    return NRFX_SUCCESS;
+}
+
+void nrfx_twim_sequence_stop(nrfx_twim_t const * p_instance)
+{
+    twim_control_block_t * p_cb   = TWIM_CB(p_instance);
+    NRF_TWIM_Type *        p_twim = (NRF_TWIM_Type *)TWIM_REG(p_instance);
+
+    NRFX_ASSERT(p_cb->p_sequence != NULL);
+
+    nrf_twim_int_disable(p_twim, NRF_TWIM_ALL_INTS_MASK);
+    nrfx_gppi_channels_disable(NRFX_BIT(p_cb->p_sequence->ppi_channel));
+
+    if (p_cb->sequence_armed &&
+        !nrf_twim_event_check(p_twim, NRF_TWIM_EVENT_TXSTARTED) &&
+        !nrf_twim_event_check(p_twim, NRF_TWIM_EVENT_RXSTARTED))
+    {
+        // The prepared transfer has not been triggered, so it can be dropped right away.
+        nrf_twim_shorts_set(p_twim, 0);
+        p_cb->int_mask = 0;
+        p_cb->busy     = false;
+        sequence_release(p_cb);
+        NRFX_LOG_INFO("Sequence stopped.");
+        return;
+    }
+
+    p_cb->sequence_stopping = true;
+    nrf_twim_int_enable(p_twim, p_cb->int_mask);
+}
+
 uint32_t nrfx_twim_start_task_get(nrfx_twim_t const * p_instance,
                                   nrfx_twim_xfer_type_t xfer_type)
 {
-    return nrf_twim_task_address_get(p_instance->p_twim,
+    return nrf_twim_task_address_get(TWIM_REG(p_instance),
         (xfer_type != NRFX_TWIM_XFER_RX) ? NRF_TWIM_TASK_STARTTX : NRF_TWIM_TASK_STARTRX);
 }
 
 uint32_t nrfx_twim_stopped_event_get(nrfx_twim_t const * p_instance)
 {
-    return nrf_twim_event_address_get(p_instance->p_twim, NRF_TWIM_EVENT_STOPPED);
+    return nrf_twim_event_address_get(TWIM_REG(p_instance), NRF_TWIM_EVENT_STOPPED);
 }
 
-static void twim_irq_handler(NRF_TWIM_Type * p_twim, twim_control_block_t * p_cb)
+NRFX_IRQ_HANDLER_ATTR static void twim_irq_handler(NRF_TWIM_Type        * p_twim,
+                                                   twim_control_block_t * p_cb)
 {
 
 #if NRFX_CHECK(NRFX_TWIM_NRF52_ANOMALY_109_WORKAROUND_ENABLED)
@@ -857,6 +1143,12 @@ static void twim_irq_handler(NRF_TWIM_Type * p_twim, twim_control_block_t * p_cb
         NRFX_LOG_DEBUG("Event: %s.", EVT_TO_STR(NRFX_TWIM_EVT_DONE));
     }
 
+    if (p_cb->p_sequence != NULL)
+    {
+        sequence_xfer_end(p_twim, p_cb, &event);
+        return;
+    }
+
     if (!p_cb->repeated)
     {
         p_cb->busy = false;
@@ -869,30 +1161,38 @@ static void twim_irq_handler(NRF_TWIM_Type * p_twim, twim_control_block_t * p_cb
 }
 
 #if NRFX_CHECK(NRFX_TWIM0_ENABLED)
-void nrfx_twim_0_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_twim_0_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(twim_0);
     twim_irq_handler(NRF_TWIM0, &m_cb[NRFX_TWIM0_INST_IDX]);
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
 #if NRFX_CHECK(NRFX_TWIM1_ENABLED)
-void nrfx_twim_1_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_twim_1_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(twim_1);
     twim_irq_handler(NRF_TWIM1, &m_cb[NRFX_TWIM1_INST_IDX]);
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
 #if NRFX_CHECK(NRFX_TWIM2_ENABLED)
-void nrfx_twim_2_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_twim_2_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(twim_2);
     twim_irq_handler(NRF_TWIM2, &m_cb[NRFX_TWIM2_INST_IDX]);
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
 #if NRFX_CHECK(NRFX_TWIM3_ENABLED)
-void nrfx_twim_3_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_twim_3_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(twim_3);
     twim_irq_handler(NRF_TWIM3, &m_cb[NRFX_TWIM3_INST_IDX]);
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
@@ -43,7 +43,9 @@
 #endif
 
 #include <nrfx_twis.h>
+#include <helpers/nrfx_prof.h>
 #include "prs/nrfx_prs.h"
+#include <string.h>
 
 #define NRFX_LOG_MODULE TWIS
 #include <nrfx_log.h>
@@ -86,6 +88,12 @@ typedef struct
 
     volatile bool                   semaphore;
     bool                            skip_gpio_cfg;
+
+    // Register map mode. Active if p_scratch is not NULL.
+    nrfx_twis_regmap_t *            p_regmap[2];
+    uint8_t *                       p_scratch;
+    size_t                          scratch_size;
+    uint8_t                         regmap_match;
 } twis_control_block_t;
 static twis_control_block_t m_cb[NRFX_TWIS_ENABLED_COUNT];
 
@@ -246,9 +254,164 @@ static inline void nrfx_twis_process_error(twis_control_block_t * p_cb,
     call_event_handler(p_cb, &evdata);
 }
 
+/**
+ * @brief Function for notifying about a completed register map access.
+ *
+ * @param[in] p_cb   Pointer to the driver instance control block.
+ * @param[in] type   Event type.
+ * @param[in] offset Sub-address of the first register accessed.
+ * @param[in] length Number of registers accessed.
+ */
+static void regmap_notify(twis_control_block_t const * p_cb,
+                          nrfx_twis_evt_type_t         type,
+                          uint8_t                      offset,
+                          size_t                       length)
+{
+    nrfx_twis_evt_t evdata;
+
+    evdata.type               = type;
+    evdata.data.regmap.match  = p_cb->regmap_match;
+    evdata.data.regmap.offset = offset;
+    evdata.data.regmap.length = (uint16_t)length;
+    call_event_handler(p_cb, &evdata);
+}
+
+/**
+ * @brief Function for completing a write in the register map mode.
+ *
+ * The received data is moved from the scratch buffer into the register file
+ * and the scratch buffer is armed again for the next write.
+ */
+static void regmap_write_finish(NRF_TWIS_Type * p_reg, twis_control_block_t * p_cb)
+{
+    nrfx_twis_regmap_t * p_regmap = p_cb->p_regmap[p_cb->regmap_match];
+    size_t               amount   = nrf_twis_rx_amount_get(p_reg);
+
+    if (p_regmap != NULL && amount > 0)
+    {
+        uint8_t offset = p_cb->p_scratch[0];
+        size_t  length = amount - 1;
+
+        if (offset >= p_regmap->size)
+        {
+            length = 0;
+        }
+        else if (length > p_regmap->size - offset)
+        {
+            length = p_regmap->size - offset;
+        }
+
+        memcpy(&p_regmap->p_regs[offset], &p_cb->p_scratch[1], length);
+        p_regmap->pointer = (uint8_t)(offset + length);
+
+        nrf_twis_rx_prepare(p_reg, p_cb->p_scratch, p_cb->scratch_size);
+        regmap_notify(p_cb, NRFX_TWIS_EVT_REGMAP_WRITE, offset, length);
+    }
+    else
+    {
+        nrf_twis_rx_prepare(p_reg, p_cb->p_scratch, p_cb->scratch_size);
+    }
+}
+
+/** @brief Function for completing a read in the register map mode. */
+static void regmap_read_finish(NRF_TWIS_Type * p_reg, twis_control_block_t * p_cb)
+{
+    nrfx_twis_regmap_t * p_regmap = p_cb->p_regmap[p_cb->regmap_match];
+    size_t               amount   = nrf_twis_tx_amount_get(p_reg);
+
+    if (p_regmap != NULL && amount > 0)
+    {
+        uint8_t offset = p_regmap->pointer;
+
+        p_regmap->pointer = (uint8_t)(offset + amount);
+        regmap_notify(p_cb, NRFX_TWIS_EVT_REGMAP_READ, offset, amount);
+    }
+}
+
+/**
+ * @brief Function for handling the TWIS events in the register map mode.
+ *
+ * The READ_SUSPEND shortcut holds every read until the transmission is pointed
+ * at the current register of the addressed register file.
+ */
+NRFX_IRQ_HANDLER_ATTR static void regmap_irq_handler(NRF_TWIS_Type        * p_reg,
+                                                     twis_control_block_t * p_cb)
+{
+    nrfx_twis_substate_t substate = p_cb->substate;
+
+    if (nrf_twis_event_get_and_clear(p_reg, NRF_TWIS_EVENT_ERROR))
+    {
+        nrfx_twis_process_error(p_cb,
+                                NRFX_TWIS_EVT_GENERAL_ERROR,
+                                nrf_twis_error_source_get_and_clear(p_reg));
+    }
+
+    (void)nrf_twis_event_get_and_clear(p_reg, NRF_TWIS_EVENT_RXSTARTED);
+    (void)nrf_twis_event_get_and_clear(p_reg, NRF_TWIS_EVENT_TXSTARTED);
+
+    if (nrf_twis_event_get_and_clear(p_reg, NRF_TWIS_EVENT_WRITE))
+    {
+        if (substate == NRFX_TWIS_SUBSTATE_READ_PENDING)
+        {
+            regmap_read_finish(p_reg, p_cb);
+        }
+        p_cb->regmap_match = (uint8_t)nrf_twis_match_get(p_reg);
+        substate = NRFX_TWIS_SUBSTATE_WRITE_PENDING;
+    }
+
+    if (nrf_twis_event_get_and_clear(p_reg, NRF_TWIS_EVENT_READ))
+    {
+        if (substate == NRFX_TWIS_SUBSTATE_WRITE_PENDING)
+        {
+            regmap_write_finish(p_reg, p_cb);
+        }
+        else if (substate == NRFX_TWIS_SUBSTATE_READ_PENDING)
+        {
+            regmap_read_finish(p_reg, p_cb);
+        }
+
+        p_cb->regmap_match = (uint8_t)nrf_twis_match_get(p_reg);
+        nrfx_twis_regmap_t const * p_regmap = p_cb->p_regmap[p_cb->regmap_match];
+        if (p_regmap != NULL && p_regmap->pointer < p_regmap->size)
+        {
+            nrf_twis_tx_prepare(p_reg,
+                                &p_regmap->p_regs[p_regmap->pointer],
+                                p_regmap->size - p_regmap->pointer);
+        }
+        else
+        {
+            // The master gets the over-read character.
+            nrf_twis_tx_prepare(p_reg, NULL, 0);
+        }
+        nrf_twis_task_trigger(p_reg, NRF_TWIS_TASK_RESUME);
+        substate = NRFX_TWIS_SUBSTATE_READ_PENDING;
+    }
+
+    if (nrf_twis_event_get_and_clear(p_reg, NRF_TWIS_EVENT_STOPPED))
+    {
+        if (substate == NRFX_TWIS_SUBSTATE_WRITE_PENDING)
+        {
+            regmap_write_finish(p_reg, p_cb);
+        }
+        else if (substate == NRFX_TWIS_SUBSTATE_READ_PENDING)
+        {
+            regmap_read_finish(p_reg, p_cb);
+        }
+        substate = NRFX_TWIS_SUBSTATE_IDLE;
+    }
+
+    p_cb->substate = substate;
+}
+
 static void nrfx_twis_state_machine(NRF_TWIS_Type *        p_reg,
                                     twis_control_block_t * p_cb)
 {
+    if (p_cb->p_scratch != NULL)
+    {
+        regmap_irq_handler(p_reg, p_cb);
+        return;
+    }
+
     if (!NRFX_TWIS_NO_SYNC_MODE)
     {
         /* Exclude parallel processing of this function */
@@ -550,6 +713,7 @@ nrfx_err_t nrfx_twis_init(nrfx_twis_t const *        p_instance,
         p_cb->semaphore = 0;
     }
     /* Set internal instance variables */
+    p_cb->p_scratch  = NULL;
     p_cb->substate   = NRFX_TWIS_SUBSTATE_IDLE;
     p_cb->ev_handler = event_handler;
     p_cb->state      = NRFX_DRV_STATE_INITIALIZED;
@@ -616,6 +780,85 @@ void nrfx_twis_disable(nrfx_twis_t const * p_instance)
     p_cb->state = NRFX_DRV_STATE_INITIALIZED;
 }
 
+nrfx_err_t nrfx_twis_regmap_start(nrfx_twis_t const *               p_instance,
+                                  nrfx_twis_regmap_config_t const * p_config)
+{
+    NRFX_ASSERT(p_config);
+    NRFX_ASSERT(p_config->p_scratch);
+    NRFX_ASSERT(p_config->scratch_size > 0);
+
+    nrfx_err_t             err_code;
+    NRF_TWIS_Type *        p_reg = p_instance->p_reg;
+    twis_control_block_t * p_cb  = &m_cb[p_instance->drv_inst_idx];
+
+    if (p_cb->state != NRFX_DRV_STATE_POWERED_ON ||
+        p_cb->ev_handler == NULL ||
+        p_cb->substate != NRFX_TWIS_SUBSTATE_IDLE)
+    {
+        err_code = NRFX_ERROR_INVALID_STATE;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    bool in_ram = nrfx_is_in_ram(p_config->p_scratch);
+    for (uint8_t i = 0; i < NRFX_ARRAY_SIZE(p_config->p_regmap); i++)
+    {
+        nrfx_twis_regmap_t * p_regmap = p_config->p_regmap[i];
+        if (p_regmap != NULL)
+        {
+            NRFX_ASSERT(p_regmap->size > 0 && p_regmap->size <= 256);
+            in_ram = in_ram && nrfx_is_in_ram(p_regmap->p_regs);
+            p_regmap->pointer = 0;
+        }
+    }
+    if (!in_ram)
+    {
+        err_code = NRFX_ERROR_INVALID_ADDR;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    nrf_twis_int_disable(p_reg, m_used_ints_mask);
+
+    p_cb->p_regmap[0]  = p_config->p_regmap[0];
+    p_cb->p_regmap[1]  = p_config->p_regmap[1];
+    p_cb->scratch_size = p_config->scratch_size;
+    p_cb->p_scratch    = p_config->p_scratch;
+    p_cb->regmap_match = 0;
+
+    nrf_twis_shorts_enable(p_reg, NRF_TWIS_SHORT_READ_SUSPEND_MASK);
+    nrf_twis_rx_prepare(p_reg, p_cb->p_scratch, p_cb->scratch_size);
+
+    nrf_twis_int_enable(p_reg, NRF_TWIS_INT_STOPPED_MASK |
+                               NRF_TWIS_INT_ERROR_MASK   |
+                               NRF_TWIS_INT_WRITE_MASK   |
+                               NRF_TWIS_INT_READ_MASK);
+
+    err_code = NRFX_SUCCESS;
+    NRFX_LOG_INFO("Function: %s, error code: %s.", __func__, NRFX_LOG_ERROR_STRING_GET(err_code));
+    return err_code;
+}
+
+void nrfx_twis_regmap_stop(nrfx_twis_t const * p_instance)
+{
+    NRF_TWIS_Type *        p_reg = p_instance->p_reg;
+    twis_control_block_t * p_cb  = &m_cb[p_instance->drv_inst_idx];
+    NRFX_ASSERT(p_cb->p_scratch != NULL);
+
+    nrf_twis_int_disable(p_reg, m_used_ints_mask);
+    nrf_twis_shorts_disable(p_reg, NRF_TWIS_SHORT_READ_SUSPEND_MASK);
+
+    p_cb->p_scratch = NULL;
+    p_cb->substate  = NRFX_TWIS_SUBSTATE_IDLE;
+
+    nrfx_twis_clear_all_events(p_reg);
+    nrf_twis_int_enable(p_reg, m_used_ints_mask);
+}
+
 /* ARM recommends not using the LDREX and STREX instructions in C code.
  * This is because the compiler might generate loads and stores between
  * LDREX and STREX, potentially clearing the exclusive monitor set by LDREX.
@@ -818,30 +1061,38 @@ bool nrfx_twis_is_pending_rx(nrfx_twis_t const * p_instance)
 
 
 #if NRFX_CHECK(NRFX_TWIS0_ENABLED)
-void nrfx_twis_0_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_twis_0_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(twis_0);
     nrfx_twis_state_machine(NRF_TWIS0, &m_cb[NRFX_TWIS0_INST_IDX]);
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
 #if NRFX_CHECK(NRFX_TWIS1_ENABLED)
-void nrfx_twis_1_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_twis_1_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(twis_1);
     nrfx_twis_state_machine(NRF_TWIS1, &m_cb[NRFX_TWIS1_INST_IDX]);
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
 #if NRFX_CHECK(NRFX_TWIS2_ENABLED)
-void nrfx_twis_2_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_twis_2_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(twis_2);
     nrfx_twis_state_machine(NRF_TWIS2, &m_cb[NRFX_TWIS2_INST_IDX]);
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
 #if NRFX_CHECK(NRFX_TWIS3_ENABLED)
-void nrfx_twis_3_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_twis_3_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(twis_3);
     nrfx_twis_state_machine(NRF_TWIS3, &m_cb[NRFX_TWIS3_INST_IDX]);
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
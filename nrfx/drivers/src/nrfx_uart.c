@@ -40,9 +40,24 @@
 #endif
 
 #include <nrfx_uart.h>
+#include <helpers/nrfx_prof.h>
 #include "prs/nrfx_prs.h"
 #include <hal/nrf_gpio.h>
 
+#if NRFX_CHECK(NRFX_UART_EASYDMA_BRIDGE_ENABLED)
+#if !defined(UARTE_PRESENT)
+#error "UART EasyDMA bridge requires the UARTE peripheral."
+#endif
+#include <hal/nrf_uarte.h>
+
+// UART and UARTE instances with the same ID share the base address, so the registers
+// of the legacy instance can be accessed through the UARTE HAL.
+#define UART_TO_UARTE(p_uart) ((NRF_UARTE_Type *)(p_uart))
+
+#define UART_DMA_LENGTH_VALIDATE(length) \
+    NRFX_EASYDMA_LENGTH_VALIDATE(UARTE0, length, 0)
+#endif
+
 #define NRFX_LOG_MODULE UART
 #include <nrfx_log.h>
 
@@ -67,12 +82,19 @@ typedef struct
     volatile size_t           rx_counter;
     volatile bool             tx_abort;
     bool                      rx_enabled;
+#if NRFX_CHECK(NRFX_UART_EASYDMA_BRIDGE_ENABLED)
+    volatile bool             tx_dma;
+#endif
     nrfx_drv_state_t          state;
     bool                      skip_gpio_cfg : 1;
     bool                      skip_psel_cfg : 1;
 } uart_control_block_t;
 static uart_control_block_t m_cb[NRFX_UART_ENABLED_COUNT];
 
+#if NRFX_CHECK(NRFX_UART_EASYDMA_BRIDGE_ENABLED)
+static void uart_dma_tx_release(NRF_UART_Type * p_uart, uart_control_block_t * p_cb);
+#endif
+
 static void apply_config(nrfx_uart_t        const * p_instance,
                          nrfx_uart_config_t const * p_config)
 {
@@ -234,6 +256,9 @@ nrfx_err_t nrfx_uart_init(nrfx_uart_t const *        p_instance,
     p_cb->rx_secondary_buffer_length = 0;
     p_cb->rx_enabled                 = false;
     p_cb->tx_buffer_length           = 0;
+#if NRFX_CHECK(NRFX_UART_EASYDMA_BRIDGE_ENABLED)
+    p_cb->tx_dma                     = false;
+#endif
     p_cb->state                      = NRFX_DRV_STATE_INITIALIZED;
     NRFX_LOG_INFO("Function: %s, error code: %s.",
                   __func__,
@@ -245,6 +270,13 @@ void nrfx_uart_uninit(nrfx_uart_t const * p_instance)
 {
     uart_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
 
+#if NRFX_CHECK(NRFX_UART_EASYDMA_BRIDGE_ENABLED)
+    if (p_cb->tx_dma)
+    {
+        uart_dma_tx_release(p_instance->p_reg, p_cb);
+    }
+#endif
+
     nrf_uart_disable(p_instance->p_reg);
 
     if (p_cb->handler)
@@ -294,6 +326,121 @@ static bool tx_blocking(NRF_UART_Type * p_uart, uart_control_block_t * p_cb)
     return true;
 }
 
+#if NRFX_CHECK(NRFX_UART_EASYDMA_BRIDGE_ENABLED)
+static bool uart_dma_tx_eligible(uart_control_block_t const * p_cb)
+{
+    // Reception uses the UART mode of the peripheral, so the transmission can be
+    // moved to the UARTE mode only when the receiver is not in use.
+    return !p_cb->rx_enabled && (p_cb->rx_buffer_length == 0) &&
+           nrfx_is_in_ram(p_cb->p_tx_buffer) &&
+           UART_DMA_LENGTH_VALIDATE(p_cb->tx_buffer_length);
+}
+
+static void uart_dma_tx_start(NRF_UART_Type * p_uart, uart_control_block_t * p_cb)
+{
+    NRF_UARTE_Type * p_uarte = UART_TO_UARTE(p_uart);
+
+    // The baud rate, configuration, and pin selection registers are common for both
+    // peripheral modes, so only the mode needs to be switched.
+    nrf_uart_int_disable(p_uart, NRF_UART_INT_MASK_TXDRDY);
+    nrf_uart_disable(p_uart);
+    nrf_uarte_enable(p_uarte);
+
+    nrf_uarte_event_clear(p_uarte, NRF_UARTE_EVENT_TXDRDY);
+    nrf_uarte_event_clear(p_uarte, NRF_UARTE_EVENT_ENDTX);
+    nrf_uarte_event_clear(p_uarte, NRF_UARTE_EVENT_TXSTOPPED);
+    nrf_uarte_tx_buffer_set(p_uarte, p_cb->p_tx_buffer, p_cb->tx_buffer_length);
+
+    p_cb->tx_dma = true;
+    if (p_cb->handler)
+    {
+        nrf_uarte_int_enable(p_uarte, NRF_UARTE_INT_ENDTX_MASK | NRF_UARTE_INT_TXSTOPPED_MASK);
+    }
+    nrf_uarte_task_trigger(p_uarte, NRF_UARTE_TASK_STARTTX);
+}
+
+// Stops the transmission in the UARTE mode, stores the number of bytes sent so far
+// in the TX counter, and switches the peripheral back to the UART mode.
+// TXDRDY stays set if any byte was sent, so that the per-byte code can complete
+// the transmission.
+static void uart_dma_tx_release(NRF_UART_Type * p_uart, uart_control_block_t * p_cb)
+{
+    NRF_UARTE_Type * p_uarte = UART_TO_UARTE(p_uart);
+
+    nrf_uarte_int_disable(p_uarte, NRF_UARTE_INT_ENDTX_MASK | NRF_UARTE_INT_TXSTOPPED_MASK);
+    if (!nrf_uarte_event_check(p_uarte, NRF_UARTE_EVENT_TXSTOPPED))
+    {
+        nrf_uarte_task_trigger(p_uarte, NRF_UARTE_TASK_STOPTX);
+        while (!nrf_uarte_event_check(p_uarte, NRF_UARTE_EVENT_TXSTOPPED))
+        {}
+    }
+    nrf_uarte_event_clear(p_uarte, NRF_UARTE_EVENT_TXSTOPPED);
+    nrf_uarte_event_clear(p_uarte, NRF_UARTE_EVENT_ENDTX);
+
+    p_cb->tx_counter = nrf_uarte_tx_amount_get(p_uarte);
+    nrf_uarte_disable(p_uarte);
+    nrf_uart_enable(p_uart);
+    p_cb->tx_dma = false;
+
+    if (p_cb->handler)
+    {
+        nrf_uart_int_enable(p_uart, NRF_UART_INT_MASK_TXDRDY);
+    }
+}
+
+// Reception requires the UART mode, so a transmission in progress in the UARTE mode
+// is stopped and continued byte by byte.
+static void uart_dma_tx_downgrade(NRF_UART_Type * p_uart, uart_control_block_t * p_cb)
+{
+    if (!p_cb->tx_dma)
+    {
+        return;
+    }
+
+    uart_dma_tx_release(p_uart, p_cb);
+
+    // Use a local variable to avoid undefined order of accessing two volatile variables
+    // in one statement.
+    size_t const tx_buffer_length = p_cb->tx_buffer_length;
+    if (!p_cb->tx_abort && (p_cb->tx_counter < tx_buffer_length))
+    {
+        nrf_uart_task_trigger(p_uart, NRF_UART_TASK_STARTTX);
+        tx_byte(p_uart, p_cb);
+    }
+}
+
+static void uart_dma_tx_wait(NRF_UART_Type * p_uart, uart_control_block_t * p_cb)
+{
+    // The transmission can also be stopped by an abort or by a reception request.
+    while (p_cb->tx_dma &&
+           !nrf_uarte_event_check(UART_TO_UARTE(p_uart), NRF_UARTE_EVENT_ENDTX))
+    {}
+
+    if (p_cb->tx_dma)
+    {
+        uart_dma_tx_release(p_uart, p_cb);
+    }
+}
+
+NRFX_IRQ_HANDLER_ATTR static void uart_dma_tx_irq_handler(NRF_UART_Type        * p_uart,
+                                                          uart_control_block_t * p_cb)
+{
+    NRF_UARTE_Type * p_uarte = UART_TO_UARTE(p_uart);
+
+    if (nrf_uarte_event_check(p_uarte, NRF_UARTE_EVENT_ENDTX))
+    {
+        nrf_uarte_event_clear(p_uarte, NRF_UARTE_EVENT_ENDTX);
+        nrf_uarte_task_trigger(p_uarte, NRF_UARTE_TASK_STOPTX);
+    }
+
+    if (nrf_uarte_event_check(p_uarte, NRF_UARTE_EVENT_TXSTOPPED))
+    {
+        // The TX_DONE event is generated by the per-byte code on the pending TXDRDY event.
+        uart_dma_tx_release(p_uart, p_cb);
+    }
+}
+#endif // NRFX_CHECK(NRFX_UART_EASYDMA_BRIDGE_ENABLED)
+
 nrfx_err_t nrfx_uart_tx(nrfx_uart_t const * p_instance,
                         uint8_t const *     p_data,
                         size_t              length)
@@ -325,13 +472,25 @@ nrfx_err_t nrfx_uart_tx(nrfx_uart_t const * p_instance,
 
     err_code = NRFX_SUCCESS;
 
-    nrf_uart_event_clear(p_instance->p_reg, NRF_UART_EVENT_TXDRDY);
-    nrf_uart_task_trigger(p_instance->p_reg, NRF_UART_TASK_STARTTX);
+#if NRFX_CHECK(NRFX_UART_EASYDMA_BRIDGE_ENABLED)
+    if (uart_dma_tx_eligible(p_cb))
+    {
+        uart_dma_tx_start(p_instance->p_reg, p_cb);
+    }
+    else
+#endif
+    {
+        nrf_uart_event_clear(p_instance->p_reg, NRF_UART_EVENT_TXDRDY);
+        nrf_uart_task_trigger(p_instance->p_reg, NRF_UART_TASK_STARTTX);
 
-    tx_byte(p_instance->p_reg, p_cb);
+        tx_byte(p_instance->p_reg, p_cb);
+    }
 
     if (p_cb->handler == NULL)
     {
+#if NRFX_CHECK(NRFX_UART_EASYDMA_BRIDGE_ENABLED)
+        uart_dma_tx_wait(p_instance->p_reg, p_cb);
+#endif
         if (!tx_blocking(p_instance->p_reg, p_cb))
         {
             // The transfer has been aborted.
@@ -390,6 +549,10 @@ nrfx_err_t nrfx_uart_rx(nrfx_uart_t const * p_instance,
 
     bool second_buffer = false;
 
+#if NRFX_CHECK(NRFX_UART_EASYDMA_BRIDGE_ENABLED)
+    uart_dma_tx_downgrade(p_instance->p_reg, p_cb);
+#endif
+
     if (p_cb->handler)
     {
         nrf_uart_int_disable(p_instance->p_reg, NRF_UART_INT_MASK_RXDRDY |
@@ -504,6 +667,9 @@ void nrfx_uart_rx_enable(nrfx_uart_t const * p_instance)
 {
     if (!m_cb[p_instance->drv_inst_idx].rx_enabled)
     {
+#if NRFX_CHECK(NRFX_UART_EASYDMA_BRIDGE_ENABLED)
+        uart_dma_tx_downgrade(p_instance->p_reg, &m_cb[p_instance->drv_inst_idx]);
+#endif
         rx_enable(p_instance);
         m_cb[p_instance->drv_inst_idx].rx_enabled = true;
     }
@@ -553,6 +719,12 @@ void nrfx_uart_tx_abort(nrfx_uart_t const * p_instance)
     uart_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
 
     p_cb->tx_abort = true;
+#if NRFX_CHECK(NRFX_UART_EASYDMA_BRIDGE_ENABLED)
+    if (p_cb->tx_dma)
+    {
+        uart_dma_tx_release(p_instance->p_reg, p_cb);
+    }
+#endif
     nrf_uart_task_trigger(p_instance->p_reg, NRF_UART_TASK_STOPTX);
     if (p_cb->handler)
     {
@@ -571,8 +743,8 @@ void nrfx_uart_rx_abort(nrfx_uart_t const * p_instance)
     NRFX_LOG_INFO("RX transaction aborted.");
 }
 
-static void uart_irq_handler(NRF_UART_Type *        p_uart,
-                             uart_control_block_t * p_cb)
+NRFX_IRQ_HANDLER_ATTR static void uart_irq_handler(NRF_UART_Type *        p_uart,
+                                                   uart_control_block_t * p_cb)
 {
     if (nrf_uart_int_enable_check(p_uart, NRF_UART_INT_MASK_ERROR) &&
         nrf_uart_event_check(p_uart, NRF_UART_EVENT_ERROR))
@@ -629,6 +801,13 @@ static void uart_irq_handler(NRF_UART_Type *        p_uart,
         }
     }
 
+#if NRFX_CHECK(NRFX_UART_EASYDMA_BRIDGE_ENABLED)
+    if (p_cb->tx_dma)
+    {
+        uart_dma_tx_irq_handler(p_uart, p_cb);
+    }
+    else
+#endif
     if (nrf_uart_event_check(p_uart, NRF_UART_EVENT_TXDRDY))
     {
         // Use a local variable to avoid undefined order of accessing two volatile variables
@@ -666,9 +845,11 @@ static void uart_irq_handler(NRF_UART_Type *        p_uart,
 }
 
 #if NRFX_CHECK(NRFX_UART0_ENABLED)
-void nrfx_uart_0_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_uart_0_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(uart_0);
     uart_irq_handler(NRF_UART0, &m_cb[NRFX_UART0_INST_IDX]);
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
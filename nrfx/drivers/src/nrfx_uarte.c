@@ -43,8 +43,11 @@
 #endif
 
 #include <nrfx_uarte.h>
+#include <helpers/nrfx_prof.h>
 #include "prs/nrfx_prs.h"
 #include <hal/nrf_gpio.h>
+#include <helpers/nrfx_gppi.h>
+#include <string.h>
 
 #define NRFX_LOG_MODULE UARTE
 #include <nrfx_log.h>
@@ -87,6 +90,12 @@
      UARTE2_LENGTH_VALIDATE(drv_inst_idx, length, 0) || \
      UARTE3_LENGTH_VALIDATE(drv_inst_idx, length, 0))
 
+typedef struct
+{
+    uint8_t const * p_data;
+    size_t          length;
+} uarte_tx_desc_t;
+
 typedef struct
 {
     void                     * p_context;
@@ -101,14 +110,64 @@ typedef struct
     bool                       rx_aborted;
     bool                       skip_gpio_cfg : 1;
     bool                       skip_psel_cfg : 1;
+    bool                       rx_stream_active;
+    uint8_t                    rx_stream_chunk_count;
+    uint8_t                    rx_stream_next_chunk;
+    uint8_t                    rx_stream_ppi_channel;
+    size_t                     rx_stream_chunk_size;
+    size_t                     rx_stream_read_offset;
+    uint32_t                   rx_stream_read_count;
+    uint32_t                   rx_stream_chunk_start_count;
+    uint32_t                   rx_stream_poll_count;
+    NRF_TIMER_Type           * p_rx_stream_counter;
+    uint8_t                    rx_stream_idle_polls;
+    uint8_t                    rx_stream_idle_count;
+    bool                       rx_stream_idle;
+    uint8_t                    rx_stream_wake_ppi_channel;
+    uint32_t                   rx_stream_wake_event;
+    nrfx_gppi_channel_group_t  rx_stream_wake_ppi_group;
+    uarte_tx_desc_t            tx_queue[NRFX_UARTE_TX_QUEUE_SIZE];
+    uint8_t                    tx_queue_head;
+    uint8_t                    tx_queue_count;
+    bool                       tx_queue_armed;
+    bool                       tx_started;
+    bool                       suspended;
+#if NRFX_UARTE_TX_BOUNCE_SIZE > 0
+    uint8_t                    tx_bounce[2][NRFX_UARTE_TX_BOUNCE_SIZE];
+    uint8_t            const * p_tx_bounce_src;  ///< Next byte to be copied to a bounce buffer.
+    size_t                     tx_bounce_left;   ///< Bytes not yet copied to a bounce buffer.
+    size_t                     tx_bounce_armed;  ///< Length of the chunk set up to follow the ongoing one.
+    size_t                     tx_bounce_sent;   ///< Bytes of the chunks already sent.
+    uint8_t                    tx_bounce_idx;    ///< Bounce buffer to be filled next.
+#endif
 } uarte_control_block_t;
 static uarte_control_block_t m_cb[NRFX_UARTE_ENABLED_COUNT];
 
+#if (NRFX_CHECK(NRFX_UARTE0_ENABLED) + NRFX_CHECK(NRFX_UARTE1_ENABLED) + \
+     NRFX_CHECK(NRFX_UARTE2_ENABLED) + NRFX_CHECK(NRFX_UARTE3_ENABLED)) == 1
+// Only one instance is enabled, so its registers and control block are known at compile time.
+#if NRFX_CHECK(NRFX_UARTE0_ENABLED)
+#define UARTE_SINGLE_REG NRF_UARTE0
+#elif NRFX_CHECK(NRFX_UARTE1_ENABLED)
+#define UARTE_SINGLE_REG NRF_UARTE1
+#elif NRFX_CHECK(NRFX_UARTE2_ENABLED)
+#define UARTE_SINGLE_REG NRF_UARTE2
+#elif NRFX_CHECK(NRFX_UARTE3_ENABLED)
+#define UARTE_SINGLE_REG NRF_UARTE3
+#endif
+
+#define UARTE_REG(p_instance) ((void)(p_instance), UARTE_SINGLE_REG)
+#define UARTE_CB(p_instance)  ((void)(p_instance), &m_cb[0])
+#else
+#define UARTE_REG(p_instance) ((p_instance)->p_reg)
+#define UARTE_CB(p_instance)  (&m_cb[(p_instance)->drv_inst_idx])
+#endif
+
 static void apply_config(nrfx_uarte_t        const * p_instance,
                          nrfx_uarte_config_t const * p_config)
 {
-    nrf_uarte_baudrate_set(p_instance->p_reg, p_config->baudrate);
-    nrf_uarte_configure(p_instance->p_reg, &p_config->hal_cfg);
+    nrf_uarte_baudrate_set(UARTE_REG(p_instance), p_config->baudrate);
+    nrf_uarte_configure(UARTE_REG(p_instance), &p_config->hal_cfg);
 
     if (!p_config->skip_gpio_cfg)
     {
@@ -124,7 +183,7 @@ static void apply_config(nrfx_uarte_t        const * p_instance,
     }
     if (!p_config->skip_psel_cfg)
     {
-        nrf_uarte_txrx_pins_set(p_instance->p_reg,
+        nrf_uarte_txrx_pins_set(UARTE_REG(p_instance),
                                 p_config->pseltxd, p_config->pselrxd);
     }
 
@@ -144,7 +203,7 @@ static void apply_config(nrfx_uarte_t        const * p_instance,
         }
         if (!p_config->skip_psel_cfg)
         {
-            nrf_uarte_hwfc_pins_set(p_instance->p_reg,
+            nrf_uarte_hwfc_pins_set(UARTE_REG(p_instance),
                                     p_config->pselrts, p_config->pselcts);
         }
     }
@@ -153,34 +212,37 @@ static void apply_config(nrfx_uarte_t        const * p_instance,
 static void interrupts_enable(nrfx_uarte_t const * p_instance,
                               uint8_t              interrupt_priority)
 {
-    nrf_uarte_event_clear(p_instance->p_reg, NRF_UARTE_EVENT_ENDRX);
-    nrf_uarte_event_clear(p_instance->p_reg, NRF_UARTE_EVENT_ENDTX);
-    nrf_uarte_event_clear(p_instance->p_reg, NRF_UARTE_EVENT_ERROR);
-    nrf_uarte_event_clear(p_instance->p_reg, NRF_UARTE_EVENT_RXTO);
-    nrf_uarte_event_clear(p_instance->p_reg, NRF_UARTE_EVENT_TXSTOPPED);
-    nrf_uarte_int_enable(p_instance->p_reg, NRF_UARTE_INT_ENDRX_MASK |
-                                            NRF_UARTE_INT_ENDTX_MASK |
-                                            NRF_UARTE_INT_ERROR_MASK |
-                                            NRF_UARTE_INT_RXTO_MASK  |
-                                            NRF_UARTE_INT_TXSTOPPED_MASK);
-    NRFX_IRQ_PRIORITY_SET(nrfx_get_irq_number((void *)p_instance->p_reg),
+    nrf_uarte_event_clear(UARTE_REG(p_instance), NRF_UARTE_EVENT_ENDRX);
+    nrf_uarte_event_clear(UARTE_REG(p_instance), NRF_UARTE_EVENT_ENDTX);
+    nrf_uarte_event_clear(UARTE_REG(p_instance), NRF_UARTE_EVENT_ERROR);
+    nrf_uarte_event_clear(UARTE_REG(p_instance), NRF_UARTE_EVENT_RXTO);
+    nrf_uarte_event_clear(UARTE_REG(p_instance), NRF_UARTE_EVENT_TXSTOPPED);
+    nrf_uarte_event_clear(UARTE_REG(p_instance), NRF_UARTE_EVENT_TXSTARTED);
+    nrf_uarte_int_enable(UARTE_REG(p_instance), NRF_UARTE_INT_ENDRX_MASK     |
+                                            NRF_UARTE_INT_ENDTX_MASK     |
+                                            NRF_UARTE_INT_ERROR_MASK     |
+                                            NRF_UARTE_INT_RXTO_MASK      |
+                                            NRF_UARTE_INT_TXSTOPPED_MASK |
+                                            NRF_UARTE_INT_TXSTARTED_MASK);
+    NRFX_IRQ_PRIORITY_SET(nrfx_get_irq_number((void *)UARTE_REG(p_instance)),
                           interrupt_priority);
-    NRFX_IRQ_ENABLE(nrfx_get_irq_number((void *)p_instance->p_reg));
+    NRFX_IRQ_ENABLE(nrfx_get_irq_number((void *)UARTE_REG(p_instance)));
 }
 
 static void interrupts_disable(nrfx_uarte_t const * p_instance)
 {
-    nrf_uarte_int_disable(p_instance->p_reg, NRF_UARTE_INT_ENDRX_MASK |
-                                             NRF_UARTE_INT_ENDTX_MASK |
-                                             NRF_UARTE_INT_ERROR_MASK |
-                                             NRF_UARTE_INT_RXTO_MASK  |
-                                             NRF_UARTE_INT_TXSTOPPED_MASK);
-    NRFX_IRQ_DISABLE(nrfx_get_irq_number((void *)p_instance->p_reg));
+    nrf_uarte_int_disable(UARTE_REG(p_instance), NRF_UARTE_INT_ENDRX_MASK     |
+                                             NRF_UARTE_INT_ENDTX_MASK     |
+                                             NRF_UARTE_INT_ERROR_MASK     |
+                                             NRF_UARTE_INT_RXTO_MASK      |
+                                             NRF_UARTE_INT_TXSTOPPED_MASK |
+                                             NRF_UARTE_INT_TXSTARTED_MASK);
+    NRFX_IRQ_DISABLE(nrfx_get_irq_number((void *)UARTE_REG(p_instance)));
 }
 
 static void pins_to_default(nrfx_uarte_t const * p_instance)
 {
-    uarte_control_block_t const * p_cb = &m_cb[p_instance->drv_inst_idx];
+    uarte_control_block_t const * p_cb = UARTE_CB(p_instance);
 
     /* Reset pins to default states */
     uint32_t txd;
@@ -188,14 +250,14 @@ static void pins_to_default(nrfx_uarte_t const * p_instance)
     uint32_t rts;
     uint32_t cts;
 
-    txd = nrf_uarte_tx_pin_get(p_instance->p_reg);
-    rxd = nrf_uarte_rx_pin_get(p_instance->p_reg);
-    rts = nrf_uarte_rts_pin_get(p_instance->p_reg);
-    cts = nrf_uarte_cts_pin_get(p_instance->p_reg);
+    txd = nrf_uarte_tx_pin_get(UARTE_REG(p_instance));
+    rxd = nrf_uarte_rx_pin_get(UARTE_REG(p_instance));
+    rts = nrf_uarte_rts_pin_get(UARTE_REG(p_instance));
+    cts = nrf_uarte_cts_pin_get(UARTE_REG(p_instance));
     if (!p_cb->skip_psel_cfg)
     {
-        nrf_uarte_txrx_pins_disconnect(p_instance->p_reg);
-        nrf_uarte_hwfc_pins_disconnect(p_instance->p_reg);
+        nrf_uarte_txrx_pins_disconnect(UARTE_REG(p_instance));
+        nrf_uarte_hwfc_pins_disconnect(UARTE_REG(p_instance));
     }
 
     if (!p_cb->skip_gpio_cfg)
@@ -226,19 +288,19 @@ static void apply_workaround_for_enable_anomaly(nrfx_uarte_t const * p_instance)
     // - nRF91 - anomaly 23
     // - nRF53 - anomaly 44
     volatile uint32_t const * rxenable_reg =
-        (volatile uint32_t *)(((uint32_t)p_instance->p_reg) + 0x564);
+        (volatile uint32_t *)(((uint32_t)UARTE_REG(p_instance)) + 0x564);
     volatile uint32_t const * txenable_reg =
-        (volatile uint32_t *)(((uint32_t)p_instance->p_reg) + 0x568);
+        (volatile uint32_t *)(((uint32_t)UARTE_REG(p_instance)) + 0x568);
 
     if (*txenable_reg == 1)
     {
-        nrf_uarte_task_trigger(p_instance->p_reg, NRF_UARTE_TASK_STOPTX);
+        nrf_uarte_task_trigger(UARTE_REG(p_instance), NRF_UARTE_TASK_STOPTX);
     }
 
     if (*rxenable_reg == 1)
     {
-        nrf_uarte_enable(p_instance->p_reg);
-        nrf_uarte_task_trigger(p_instance->p_reg, NRF_UARTE_TASK_STOPRX);
+        nrf_uarte_enable(UARTE_REG(p_instance));
+        nrf_uarte_task_trigger(UARTE_REG(p_instance), NRF_UARTE_TASK_STOPRX);
 
         bool workaround_succeded;
         // The UARTE is able to receive up to four bytes after the STOPRX task has been triggered.
@@ -248,11 +310,11 @@ static void apply_workaround_for_enable_anomaly(nrfx_uarte_t const * p_instance)
         if (!workaround_succeded)
         {
             NRFX_LOG_ERROR("Failed to apply workaround for instance with base address: %p.",
-                           (void *)p_instance->p_reg);
+                           (void *)UARTE_REG(p_instance));
         }
 
-        (void)nrf_uarte_errorsrc_get_and_clear(p_instance->p_reg);
-        nrf_uarte_disable(p_instance->p_reg);
+        (void)nrf_uarte_errorsrc_get_and_clear(UARTE_REG(p_instance));
+        nrf_uarte_disable(UARTE_REG(p_instance));
     }
 #else
     (void)(p_instance);
@@ -264,7 +326,7 @@ nrfx_err_t nrfx_uarte_init(nrfx_uarte_t const *        p_instance,
                            nrfx_uarte_event_handler_t  event_handler)
 {
     NRFX_ASSERT(p_config);
-    uarte_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    uarte_control_block_t * p_cb = UARTE_CB(p_instance);
     nrfx_err_t err_code = NRFX_SUCCESS;
 
     if (p_cb->state != NRFX_DRV_STATE_UNINITIALIZED)
@@ -291,7 +353,7 @@ nrfx_err_t nrfx_uarte_init(nrfx_uarte_t const *        p_instance,
         nrfx_uarte_3_irq_handler,
         #endif
     };
-    if (nrfx_prs_acquire(p_instance->p_reg,
+    if (nrfx_prs_acquire(UARTE_REG(p_instance),
             irq_handlers[p_instance->drv_inst_idx]) != NRFX_SUCCESS)
     {
         err_code = NRFX_ERROR_BUSY;
@@ -317,7 +379,7 @@ nrfx_err_t nrfx_uarte_init(nrfx_uarte_t const *        p_instance,
         interrupts_enable(p_instance, p_config->interrupt_priority);
     }
 
-    nrf_uarte_enable(p_instance->p_reg);
+    nrf_uarte_enable(UARTE_REG(p_instance));
     p_cb->rx_buffer_length           = 0;
     p_cb->rx_secondary_buffer_length = 0;
     p_cb->tx_buffer_length           = 0;
@@ -328,10 +390,43 @@ nrfx_err_t nrfx_uarte_init(nrfx_uarte_t const *        p_instance,
     return err_code;
 }
 
+static void rx_stream_release(NRF_UARTE_Type *        p_uarte,
+                              uarte_control_block_t * p_cb)
+{
+    nrf_uarte_int_disable(p_uarte, NRF_UARTE_INT_RXSTARTED_MASK);
+    nrfx_gppi_channels_disable(NRFX_BIT(p_cb->rx_stream_ppi_channel));
+    nrfx_gppi_event_endpoint_clear(p_cb->rx_stream_ppi_channel,
+                                   nrf_uarte_event_address_get(p_uarte,
+                                                               NRF_UARTE_EVENT_RXDRDY));
+    nrfx_gppi_task_endpoint_clear(p_cb->rx_stream_ppi_channel,
+                                  nrf_timer_task_address_get(p_cb->p_rx_stream_counter,
+                                                             NRF_TIMER_TASK_COUNT));
+    nrf_timer_task_trigger(p_cb->p_rx_stream_counter, NRF_TIMER_TASK_STOP);
+
+    if (p_cb->rx_stream_idle_polls != 0)
+    {
+        nrfx_gppi_group_disable(p_cb->rx_stream_wake_ppi_group);
+        nrfx_gppi_channels_remove_from_group(NRFX_BIT(p_cb->rx_stream_wake_ppi_channel),
+                                             p_cb->rx_stream_wake_ppi_group);
+        nrfx_gppi_fork_endpoint_clear(p_cb->rx_stream_wake_ppi_channel,
+            nrfx_gppi_task_address_get(
+                nrfx_gppi_group_disable_task_get(p_cb->rx_stream_wake_ppi_group)));
+        nrfx_gppi_event_endpoint_clear(p_cb->rx_stream_wake_ppi_channel,
+                                       p_cb->rx_stream_wake_event);
+        nrfx_gppi_task_endpoint_clear(p_cb->rx_stream_wake_ppi_channel,
+                                      nrf_uarte_task_address_get(p_uarte,
+                                                                 NRF_UARTE_TASK_STARTRX));
+    }
+
+    p_cb->rx_stream_idle   = false;
+    p_cb->rx_stream_active = false;
+    p_cb->rx_buffer_length = 0;
+}
+
 void nrfx_uarte_uninit(nrfx_uarte_t const * p_instance)
 {
-    uarte_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
-    NRF_UARTE_Type * p_reg = p_instance->p_reg;
+    uarte_control_block_t * p_cb = UARTE_CB(p_instance);
+    NRF_UARTE_Type * p_reg = UARTE_REG(p_instance);
 
     if (p_cb->handler)
     {
@@ -362,7 +457,12 @@ void nrfx_uarte_uninit(nrfx_uarte_t const * p_instance)
                   40000, 1, stopped);
     if (!stopped)
     {
-        NRFX_LOG_ERROR("Failed to stop instance with base address: %p.", (void *)p_instance->p_reg);
+        NRFX_LOG_ERROR("Failed to stop instance with base address: %p.", (void *)UARTE_REG(p_instance));
+    }
+
+    if (p_cb->rx_stream_active)
+    {
+        rx_stream_release(p_reg, p_cb);
     }
 
     nrf_uarte_disable(p_reg);
@@ -373,26 +473,119 @@ void nrfx_uarte_uninit(nrfx_uarte_t const * p_instance)
     nrfx_prs_release(p_reg);
 #endif
 
+    p_cb->tx_queue_count = 0;
+    p_cb->tx_queue_armed = false;
+    p_cb->suspended      = false;
+
     p_cb->state   = NRFX_DRV_STATE_UNINITIALIZED;
     p_cb->handler = NULL;
     NRFX_LOG_INFO("Instance uninitialized: %d.", p_instance->drv_inst_idx);
 }
 
+nrfx_err_t nrfx_uarte_suspend(nrfx_uarte_t const * p_instance)
+{
+    uarte_control_block_t * p_cb = UARTE_CB(p_instance);
+    NRFX_ASSERT(p_cb->state == NRFX_DRV_STATE_INITIALIZED);
+
+    nrfx_err_t err_code;
+
+    if (p_cb->tx_buffer_length || p_cb->rx_buffer_length ||
+        p_cb->rx_secondary_buffer_length || p_cb->rx_stream_active ||
+        (p_cb->tx_queue_count != 0))
+    {
+        err_code = NRFX_ERROR_BUSY;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    if (!p_cb->suspended)
+    {
+        // The TX line keeps its GPIO configuration, so it stays at the idle (high) level.
+        nrf_uarte_disable(UARTE_REG(p_instance));
+        p_cb->suspended = true;
+    }
+
+    return NRFX_SUCCESS;
+}
+
+void nrfx_uarte_resume(nrfx_uarte_t const * p_instance)
+{
+    uarte_control_block_t * p_cb = UARTE_CB(p_instance);
+
+    if (p_cb->suspended)
+    {
+        p_cb->suspended = false;
+        nrf_uarte_enable(UARTE_REG(p_instance));
+    }
+}
+
+#if NRFX_UARTE_TX_BOUNCE_SIZE > 0
+static size_t tx_bounce_fill(uarte_control_block_t * p_cb,
+                             uint8_t const **        pp_chunk)
+{
+    size_t    chunk   = NRFX_MIN(p_cb->tx_bounce_left, (size_t)NRFX_UARTE_TX_BOUNCE_SIZE);
+    uint8_t * p_chunk = p_cb->tx_bounce[p_cb->tx_bounce_idx];
+
+    memcpy(p_chunk, p_cb->p_tx_bounce_src, chunk);
+    p_cb->p_tx_bounce_src += chunk;
+    p_cb->tx_bounce_left  -= chunk;
+    p_cb->tx_bounce_idx   ^= 1;
+
+    *pp_chunk = p_chunk;
+    return chunk;
+}
+
+static void tx_bounce_arm(NRF_UARTE_Type *        p_uarte,
+                          uarte_control_block_t * p_cb)
+{
+    uint8_t const * p_chunk;
+    size_t          chunk = tx_bounce_fill(p_cb, &p_chunk);
+
+    // The ongoing chunk is sent from the other bounce buffer and its pointer is already latched.
+    nrf_uarte_tx_buffer_set(p_uarte, p_chunk, chunk);
+    p_cb->tx_bounce_armed = chunk;
+}
+#endif
+
+static bool tx_bounce_pending(uarte_control_block_t const * p_cb)
+{
+#if NRFX_UARTE_TX_BOUNCE_SIZE > 0
+    return (p_cb->tx_bounce_left != 0) || (p_cb->tx_bounce_armed != 0);
+#else
+    (void)p_cb;
+    return false;
+#endif
+}
+
+static size_t tx_amount_get(NRF_UARTE_Type *              p_uarte,
+                            uarte_control_block_t const * p_cb)
+{
+#if NRFX_UARTE_TX_BOUNCE_SIZE > 0
+    return p_cb->tx_bounce_sent + nrf_uarte_tx_amount_get(p_uarte);
+#else
+    (void)p_cb;
+    return nrf_uarte_tx_amount_get(p_uarte);
+#endif
+}
+
 nrfx_err_t nrfx_uarte_tx(nrfx_uarte_t const * p_instance,
                          uint8_t const *      p_data,
                          size_t               length)
 {
-    uarte_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    uarte_control_block_t * p_cb = UARTE_CB(p_instance);
     NRFX_ASSERT(p_cb->state == NRFX_DRV_STATE_INITIALIZED);
+    NRFX_ASSERT(!p_cb->suspended);
     NRFX_ASSERT(p_data);
     NRFX_ASSERT(length > 0);
-    NRFX_ASSERT(UARTE_LENGTH_VALIDATE(p_instance->drv_inst_idx, length));
 
     nrfx_err_t err_code;
+    bool       bounce = !nrfx_is_in_ram(p_data);
 
     // EasyDMA requires that transfer buffers are placed in DataRAM,
-    // signal error if the are not.
-    if (!nrfx_is_in_ram(p_data))
+    // signal error if the are not and they cannot be bounced.
+    if (bounce && (NRFX_UARTE_TX_BOUNCE_SIZE == 0))
     {
         err_code = NRFX_ERROR_INVALID_ADDR;
         NRFX_LOG_WARNING("Function: %s, error code: %s.",
@@ -400,6 +593,7 @@ nrfx_err_t nrfx_uarte_tx(nrfx_uarte_t const * p_instance,
                          NRFX_LOG_ERROR_STRING_GET(err_code));
         return err_code;
     }
+    NRFX_ASSERT(bounce || UARTE_LENGTH_VALIDATE(p_instance->drv_inst_idx, length));
 
     if (nrfx_uarte_tx_in_progress(p_instance))
     {
@@ -419,10 +613,28 @@ nrfx_err_t nrfx_uarte_tx(nrfx_uarte_t const * p_instance,
 
     err_code = NRFX_SUCCESS;
 
-    nrf_uarte_event_clear(p_instance->p_reg, NRF_UARTE_EVENT_ENDTX);
-    nrf_uarte_event_clear(p_instance->p_reg, NRF_UARTE_EVENT_TXSTOPPED);
-    nrf_uarte_tx_buffer_set(p_instance->p_reg, p_cb->p_tx_buffer, p_cb->tx_buffer_length);
-    nrf_uarte_task_trigger(p_instance->p_reg, NRF_UARTE_TASK_STARTTX);
+    uint8_t const * p_chunk = p_data;
+    size_t          chunk   = length;
+
+#if NRFX_UARTE_TX_BOUNCE_SIZE > 0
+    p_cb->tx_bounce_left  = 0;
+    p_cb->tx_bounce_armed = 0;
+    p_cb->tx_bounce_sent  = 0;
+    if (bounce)
+    {
+        p_cb->p_tx_bounce_src = p_data;
+        p_cb->tx_bounce_left  = length;
+        p_cb->tx_bounce_idx   = 0;
+        chunk = tx_bounce_fill(p_cb, &p_chunk);
+    }
+#endif
+
+    p_cb->tx_started = false;
+    nrf_uarte_event_clear(UARTE_REG(p_instance), NRF_UARTE_EVENT_ENDTX);
+    nrf_uarte_event_clear(UARTE_REG(p_instance), NRF_UARTE_EVENT_TXSTOPPED);
+    nrf_uarte_event_clear(UARTE_REG(p_instance), NRF_UARTE_EVENT_TXSTARTED);
+    nrf_uarte_tx_buffer_set(UARTE_REG(p_instance), p_chunk, chunk);
+    nrf_uarte_task_trigger(UARTE_REG(p_instance), NRF_UARTE_TASK_STARTTX);
 
     if (p_cb->handler == NULL)
     {
@@ -430,8 +642,19 @@ nrfx_err_t nrfx_uarte_tx(nrfx_uarte_t const * p_instance,
         bool txstopped;
         do
         {
-            endtx     = nrf_uarte_event_check(p_instance->p_reg, NRF_UARTE_EVENT_ENDTX);
-            txstopped = nrf_uarte_event_check(p_instance->p_reg, NRF_UARTE_EVENT_TXSTOPPED);
+            endtx     = nrf_uarte_event_check(UARTE_REG(p_instance), NRF_UARTE_EVENT_ENDTX);
+            txstopped = nrf_uarte_event_check(UARTE_REG(p_instance), NRF_UARTE_EVENT_TXSTOPPED);
+#if NRFX_UARTE_TX_BOUNCE_SIZE > 0
+            if (endtx && !txstopped && (p_cb->tx_bounce_left != 0))
+            {
+                p_cb->tx_bounce_sent += nrf_uarte_tx_amount_get(UARTE_REG(p_instance));
+                chunk = tx_bounce_fill(p_cb, &p_chunk);
+                nrf_uarte_event_clear(UARTE_REG(p_instance), NRF_UARTE_EVENT_ENDTX);
+                nrf_uarte_tx_buffer_set(UARTE_REG(p_instance), p_chunk, chunk);
+                nrf_uarte_task_trigger(UARTE_REG(p_instance), NRF_UARTE_TASK_STARTTX);
+                endtx = false;
+            }
+#endif
         }
         while ((!endtx) && (!txstopped));
 
@@ -443,9 +666,9 @@ nrfx_err_t nrfx_uarte_tx(nrfx_uarte_t const * p_instance,
         {
             // Transmitter has to be stopped by triggering the STOPTX task to achieve
             // the lowest possible level of the UARTE power consumption.
-            nrf_uarte_task_trigger(p_instance->p_reg, NRF_UARTE_TASK_STOPTX);
+            nrf_uarte_task_trigger(UARTE_REG(p_instance), NRF_UARTE_TASK_STOPTX);
 
-            while (!nrf_uarte_event_check(p_instance->p_reg, NRF_UARTE_EVENT_TXSTOPPED))
+            while (!nrf_uarte_event_check(UARTE_REG(p_instance), NRF_UARTE_EVENT_TXSTOPPED))
             {}
         }
         p_cb->tx_buffer_length = 0;
@@ -455,18 +678,144 @@ nrfx_err_t nrfx_uarte_tx(nrfx_uarte_t const * p_instance,
     return err_code;
 }
 
+static void tx_queue_arm(NRF_UARTE_Type *        p_uarte,
+                         uarte_control_block_t * p_cb)
+{
+    uarte_tx_desc_t const * p_desc = &p_cb->tx_queue[p_cb->tx_queue_head];
+
+    // The pointer of the ongoing transfer is already latched, so the next one can be set up.
+    nrf_uarte_tx_buffer_set(p_uarte, p_desc->p_data, p_desc->length);
+    p_cb->tx_queue_armed = true;
+}
+
+static size_t tx_queue_clear(nrfx_uarte_t const *    p_instance,
+                             uarte_control_block_t * p_cb)
+{
+    uint32_t const int_mask  = NRF_UARTE_INT_ENDTX_MASK     |
+                               NRF_UARTE_INT_TXSTOPPED_MASK |
+                               NRF_UARTE_INT_TXSTARTED_MASK;
+    size_t         discarded = 0;
+
+    if (p_cb->handler == NULL)
+    {
+        return 0;
+    }
+
+    nrf_uarte_int_disable(UARTE_REG(p_instance), int_mask);
+
+#if NRFX_UARTE_TX_BOUNCE_SIZE > 0
+    // The remaining chunks of a bounced transfer are dropped as well.
+    p_cb->tx_bounce_left  = 0;
+    p_cb->tx_bounce_armed = 0;
+#endif
+    while (p_cb->tx_queue_count != 0)
+    {
+        discarded += p_cb->tx_queue[p_cb->tx_queue_head].length;
+        p_cb->tx_queue_head = (p_cb->tx_queue_head + 1) % NRFX_UARTE_TX_QUEUE_SIZE;
+        p_cb->tx_queue_count--;
+    }
+    p_cb->tx_queue_armed = false;
+
+    nrf_uarte_int_enable(UARTE_REG(p_instance), int_mask);
+
+    return discarded;
+}
+
+nrfx_err_t nrfx_uarte_tx_queue(nrfx_uarte_t const * p_instance,
+                               uint8_t const *      p_data,
+                               size_t               length)
+{
+    uarte_control_block_t * p_cb = UARTE_CB(p_instance);
+    uint32_t const          int_mask = NRF_UARTE_INT_ENDTX_MASK     |
+                                       NRF_UARTE_INT_TXSTOPPED_MASK |
+                                       NRF_UARTE_INT_TXSTARTED_MASK;
+    NRFX_ASSERT(p_cb->state == NRFX_DRV_STATE_INITIALIZED);
+    NRFX_ASSERT(!p_cb->suspended);
+    NRFX_ASSERT(p_data);
+    NRFX_ASSERT(length > 0);
+    NRFX_ASSERT(UARTE_LENGTH_VALIDATE(p_instance->drv_inst_idx, length));
+
+    nrfx_err_t err_code;
+
+    if (p_cb->handler == NULL)
+    {
+        err_code = NRFX_ERROR_INVALID_STATE;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    // EasyDMA requires that transfer buffers are placed in DataRAM,
+    // signal error if the are not.
+    if (!nrfx_is_in_ram(p_data))
+    {
+        err_code = NRFX_ERROR_INVALID_ADDR;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    nrf_uarte_int_disable(UARTE_REG(p_instance), int_mask);
+
+    if (!nrfx_uarte_tx_in_progress(p_instance))
+    {
+        nrf_uarte_int_enable(UARTE_REG(p_instance), int_mask);
+        return nrfx_uarte_tx(p_instance, p_data, length);
+    }
+
+    if (p_cb->tx_queue_count == NRFX_UARTE_TX_QUEUE_SIZE)
+    {
+        nrf_uarte_int_enable(UARTE_REG(p_instance), int_mask);
+        err_code = NRFX_ERROR_NO_MEM;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    uint8_t tail = (p_cb->tx_queue_head + p_cb->tx_queue_count) % NRFX_UARTE_TX_QUEUE_SIZE;
+
+    p_cb->tx_queue[tail].p_data = p_data;
+    p_cb->tx_queue[tail].length = length;
+    p_cb->tx_queue_count++;
+
+    // If the ongoing transfer has not started yet, the buffer is armed from TXSTARTED interrupt.
+    // The same happens if the chunks of a bounced transfer are still to be sent.
+    if (p_cb->tx_started && !p_cb->tx_queue_armed && !tx_bounce_pending(p_cb))
+    {
+        tx_queue_arm(UARTE_REG(p_instance), p_cb);
+    }
+
+    nrf_uarte_int_enable(UARTE_REG(p_instance), int_mask);
+
+    NRFX_LOG_INFO("Transfer queued tx_len: %d.", length);
+    return NRFX_SUCCESS;
+}
+
+size_t nrfx_uarte_tx_queue_flush(nrfx_uarte_t const * p_instance)
+{
+    size_t discarded = tx_queue_clear(p_instance, UARTE_CB(p_instance));
+
+    nrfx_uarte_tx_abort(p_instance);
+
+    return discarded;
+}
+
 bool nrfx_uarte_tx_in_progress(nrfx_uarte_t const * p_instance)
 {
-    return (m_cb[p_instance->drv_inst_idx].tx_buffer_length != 0);
+    return (UARTE_CB(p_instance)->tx_buffer_length != 0);
 }
 
 nrfx_err_t nrfx_uarte_rx(nrfx_uarte_t const * p_instance,
                          uint8_t *            p_data,
                          size_t               length)
 {
-    uarte_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    uarte_control_block_t * p_cb = UARTE_CB(p_instance);
 
-    NRFX_ASSERT(m_cb[p_instance->drv_inst_idx].state == NRFX_DRV_STATE_INITIALIZED);
+    NRFX_ASSERT(UARTE_CB(p_instance)->state == NRFX_DRV_STATE_INITIALIZED);
+    NRFX_ASSERT(!UARTE_CB(p_instance)->suspended);
     NRFX_ASSERT(p_data);
     NRFX_ASSERT(length > 0);
     NRFX_ASSERT(UARTE_LENGTH_VALIDATE(p_instance->drv_inst_idx, length));
@@ -488,16 +837,16 @@ nrfx_err_t nrfx_uarte_rx(nrfx_uarte_t const * p_instance,
 
     if (p_cb->handler)
     {
-        nrf_uarte_int_disable(p_instance->p_reg, NRF_UARTE_INT_ERROR_MASK |
+        nrf_uarte_int_disable(UARTE_REG(p_instance), NRF_UARTE_INT_ERROR_MASK |
                                                  NRF_UARTE_INT_ENDRX_MASK);
     }
     if (p_cb->rx_buffer_length != 0)
     {
-        if (p_cb->rx_secondary_buffer_length != 0)
+        if (p_cb->rx_stream_active || (p_cb->rx_secondary_buffer_length != 0))
         {
             if (p_cb->handler)
             {
-                nrf_uarte_int_enable(p_instance->p_reg, NRF_UARTE_INT_ERROR_MASK |
+                nrf_uarte_int_enable(UARTE_REG(p_instance), NRF_UARTE_INT_ERROR_MASK |
                                                         NRF_UARTE_INT_ENDRX_MASK);
             }
             err_code = NRFX_ERROR_BUSY;
@@ -525,30 +874,30 @@ nrfx_err_t nrfx_uarte_rx(nrfx_uarte_t const * p_instance,
 
     err_code = NRFX_SUCCESS;
 
-    nrf_uarte_event_clear(p_instance->p_reg, NRF_UARTE_EVENT_ENDRX);
-    nrf_uarte_event_clear(p_instance->p_reg, NRF_UARTE_EVENT_RXTO);
-    nrf_uarte_rx_buffer_set(p_instance->p_reg, p_data, length);
+    nrf_uarte_event_clear(UARTE_REG(p_instance), NRF_UARTE_EVENT_ENDRX);
+    nrf_uarte_event_clear(UARTE_REG(p_instance), NRF_UARTE_EVENT_RXTO);
+    nrf_uarte_rx_buffer_set(UARTE_REG(p_instance), p_data, length);
     if (!second_buffer)
     {
-        nrf_uarte_task_trigger(p_instance->p_reg, NRF_UARTE_TASK_STARTRX);
+        nrf_uarte_task_trigger(UARTE_REG(p_instance), NRF_UARTE_TASK_STARTRX);
     }
     else
     {
-        nrf_uarte_shorts_enable(p_instance->p_reg, NRF_UARTE_SHORT_ENDRX_STARTRX);
+        nrf_uarte_shorts_enable(UARTE_REG(p_instance), NRF_UARTE_SHORT_ENDRX_STARTRX);
     }
 
-    if (m_cb[p_instance->drv_inst_idx].handler == NULL)
+    if (UARTE_CB(p_instance)->handler == NULL)
     {
         bool endrx;
         bool rxto;
         bool error;
         do {
-            endrx  = nrf_uarte_event_check(p_instance->p_reg, NRF_UARTE_EVENT_ENDRX);
-            rxto   = nrf_uarte_event_check(p_instance->p_reg, NRF_UARTE_EVENT_RXTO);
-            error  = nrf_uarte_event_check(p_instance->p_reg, NRF_UARTE_EVENT_ERROR);
+            endrx  = nrf_uarte_event_check(UARTE_REG(p_instance), NRF_UARTE_EVENT_ENDRX);
+            rxto   = nrf_uarte_event_check(UARTE_REG(p_instance), NRF_UARTE_EVENT_RXTO);
+            error  = nrf_uarte_event_check(UARTE_REG(p_instance), NRF_UARTE_EVENT_ERROR);
         } while ((!endrx) && (!rxto) && (!error));
 
-        m_cb[p_instance->drv_inst_idx].rx_buffer_length = 0;
+        UARTE_CB(p_instance)->rx_buffer_length = 0;
 
         if (error)
         {
@@ -563,7 +912,7 @@ nrfx_err_t nrfx_uarte_rx(nrfx_uarte_t const * p_instance,
     else
     {
         p_cb->rx_aborted = false;
-        nrf_uarte_int_enable(p_instance->p_reg, NRF_UARTE_INT_ERROR_MASK |
+        nrf_uarte_int_enable(UARTE_REG(p_instance), NRF_UARTE_INT_ERROR_MASK |
                                                 NRF_UARTE_INT_ENDRX_MASK);
     }
     NRFX_LOG_INFO("Function: %s, error code: %s.", __func__, NRFX_LOG_ERROR_STRING_GET(err_code));
@@ -572,13 +921,13 @@ nrfx_err_t nrfx_uarte_rx(nrfx_uarte_t const * p_instance,
 
 bool nrfx_uarte_rx_ready(nrfx_uarte_t const * p_instance)
 {
-    return nrf_uarte_event_check(p_instance->p_reg, NRF_UARTE_EVENT_ENDRX);
+    return nrf_uarte_event_check(UARTE_REG(p_instance), NRF_UARTE_EVENT_ENDRX);
 }
 
 uint32_t nrfx_uarte_errorsrc_get(nrfx_uarte_t const * p_instance)
 {
-    nrf_uarte_event_clear(p_instance->p_reg, NRF_UARTE_EVENT_ERROR);
-    return nrf_uarte_errorsrc_get_and_clear(p_instance->p_reg);
+    nrf_uarte_event_clear(UARTE_REG(p_instance), NRF_UARTE_EVENT_ERROR);
+    return nrf_uarte_errorsrc_get_and_clear(UARTE_REG(p_instance));
 }
 
 static void rx_done_event(uarte_control_block_t * p_cb,
@@ -610,13 +959,16 @@ static void tx_done_event(uarte_control_block_t * p_cb,
 
 void nrfx_uarte_tx_abort(nrfx_uarte_t const * p_instance)
 {
-    uarte_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    uarte_control_block_t * p_cb = UARTE_CB(p_instance);
 
-    nrf_uarte_event_clear(p_instance->p_reg, NRF_UARTE_EVENT_TXSTOPPED);
-    nrf_uarte_task_trigger(p_instance->p_reg, NRF_UARTE_TASK_STOPTX);
+    // Queued buffers must not be started from ENDTX generated by the STOPTX task.
+    (void)tx_queue_clear(p_instance, p_cb);
+
+    nrf_uarte_event_clear(UARTE_REG(p_instance), NRF_UARTE_EVENT_TXSTOPPED);
+    nrf_uarte_task_trigger(UARTE_REG(p_instance), NRF_UARTE_TASK_STOPTX);
     if (p_cb->handler == NULL)
     {
-        while (!nrf_uarte_event_check(p_instance->p_reg, NRF_UARTE_EVENT_TXSTOPPED))
+        while (!nrf_uarte_event_check(UARTE_REG(p_instance), NRF_UARTE_EVENT_TXSTOPPED))
         {}
     }
     NRFX_LOG_INFO("TX transaction aborted.");
@@ -624,28 +976,364 @@ void nrfx_uarte_tx_abort(nrfx_uarte_t const * p_instance)
 
 void nrfx_uarte_rx_abort(nrfx_uarte_t const * p_instance)
 {
-    uarte_control_block_t * p_cb = &m_cb[p_instance->drv_inst_idx];
+    uarte_control_block_t * p_cb = UARTE_CB(p_instance);
 
     // Short between ENDRX event and STARTRX task must be disabled before
     // aborting transmission.
-    if (p_cb->rx_secondary_buffer_length != 0)
+    if (p_cb->rx_stream_active || (p_cb->rx_secondary_buffer_length != 0))
     {
-        nrf_uarte_shorts_disable(p_instance->p_reg, NRF_UARTE_SHORT_ENDRX_STARTRX);
+        nrf_uarte_shorts_disable(UARTE_REG(p_instance), NRF_UARTE_SHORT_ENDRX_STARTRX);
     }
     p_cb->rx_aborted = true;
-    nrf_uarte_task_trigger(p_instance->p_reg, NRF_UARTE_TASK_STOPRX);
+    nrf_uarte_task_trigger(UARTE_REG(p_instance), NRF_UARTE_TASK_STOPRX);
     NRFX_LOG_INFO("RX transaction aborted.");
 }
 
-static void uarte_irq_handler(NRF_UARTE_Type *        p_uarte,
-                              uarte_control_block_t * p_cb)
+static uint32_t rx_stream_count_get(uarte_control_block_t const * p_cb)
+{
+    nrf_timer_task_trigger(p_cb->p_rx_stream_counter, NRF_TIMER_TASK_CAPTURE0);
+    return nrf_timer_cc_get(p_cb->p_rx_stream_counter, NRF_TIMER_CC_CHANNEL0);
+}
+
+static void rx_stream_report(uarte_control_block_t * p_cb,
+                             uint32_t                count)
+{
+    nrfx_uarte_event_t event;
+    size_t             ring_size = p_cb->rx_stream_chunk_size * p_cb->rx_stream_chunk_count;
+    uint32_t           pending   = count - p_cb->rx_stream_read_count;
+
+    // Data up to the given count may have already been reported by the idle line detection.
+    if ((int32_t)pending <= 0)
+    {
+        return;
+    }
+
+    // Only the chunk being currently written overwrites data, so the remaining chunks
+    // of the ring hold data that is still valid.
+    if (pending > (ring_size - p_cb->rx_stream_chunk_size))
+    {
+        size_t lost = pending - (ring_size - p_cb->rx_stream_chunk_size);
+
+        p_cb->rx_stream_read_count  += lost;
+        p_cb->rx_stream_read_offset  = (p_cb->rx_stream_read_offset + lost) % ring_size;
+
+        event.type                   = NRFX_UARTE_EVT_ERROR;
+        event.data.error.error_mask  = NRF_UARTE_ERROR_OVERRUN_MASK;
+        event.data.error.rxtx.bytes  = lost;
+        event.data.error.rxtx.p_data = NULL;
+
+        p_cb->handler(&event, p_cb->p_context);
+    }
+
+    while (p_cb->rx_stream_read_count != count)
+    {
+        size_t chunk_end = ((p_cb->rx_stream_read_offset / p_cb->rx_stream_chunk_size) + 1) *
+                           p_cb->rx_stream_chunk_size;
+        size_t bytes     = NRFX_MIN((size_t)(count - p_cb->rx_stream_read_count),
+                                    chunk_end - p_cb->rx_stream_read_offset);
+
+        event.type             = NRFX_UARTE_EVT_RX_DATA;
+        event.data.rxtx.bytes  = bytes;
+        event.data.rxtx.p_data = &p_cb->p_rx_buffer[p_cb->rx_stream_read_offset];
+
+        p_cb->rx_stream_read_count  += bytes;
+        p_cb->rx_stream_read_offset  = (chunk_end == ring_size) ?
+                                       0 : (p_cb->rx_stream_read_offset + bytes);
+
+        p_cb->handler(&event, p_cb->p_context);
+    }
+}
+
+nrfx_err_t nrfx_uarte_rx_stream_start(nrfx_uarte_t const *                  p_instance,
+                                      nrfx_uarte_rx_stream_config_t const * p_config)
+{
+    uarte_control_block_t * p_cb    = UARTE_CB(p_instance);
+    NRF_UARTE_Type *        p_uarte = UARTE_REG(p_instance);
+    nrfx_err_t              err_code;
+
+    NRFX_ASSERT(p_cb->state == NRFX_DRV_STATE_INITIALIZED);
+    NRFX_ASSERT(!p_cb->suspended);
+    NRFX_ASSERT(p_config->p_buffer);
+    NRFX_ASSERT(p_config->p_counter);
+    NRFX_ASSERT(p_config->chunk_count >= 3);
+    NRFX_ASSERT(p_config->chunk_size > 0);
+    NRFX_ASSERT(UARTE_LENGTH_VALIDATE(p_instance->drv_inst_idx, p_config->chunk_size));
+
+    if (!p_cb->handler)
+    {
+        err_code = NRFX_ERROR_INVALID_STATE;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    // EasyDMA requires that transfer buffers are placed in DataRAM,
+    // signal error if the are not.
+    if (!nrfx_is_in_ram(p_config->p_buffer))
+    {
+        err_code = NRFX_ERROR_INVALID_ADDR;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    if (p_cb->rx_buffer_length != 0)
+    {
+        err_code = NRFX_ERROR_BUSY;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    p_cb->p_rx_buffer                 = p_config->p_buffer;
+    p_cb->rx_buffer_length            = p_config->chunk_size;
+    p_cb->rx_secondary_buffer_length  = 0;
+    p_cb->rx_aborted                  = false;
+    p_cb->rx_stream_chunk_size        = p_config->chunk_size;
+    p_cb->rx_stream_chunk_count       = p_config->chunk_count;
+    p_cb->rx_stream_next_chunk        = 1;
+    p_cb->rx_stream_ppi_channel       = p_config->ppi_channel;
+    p_cb->rx_stream_read_offset       = 0;
+    p_cb->rx_stream_read_count        = 0;
+    p_cb->rx_stream_chunk_start_count = 0;
+    p_cb->rx_stream_poll_count        = 0;
+    p_cb->p_rx_stream_counter         = p_config->p_counter;
+    p_cb->rx_stream_idle_polls        = p_config->idle_polls;
+    p_cb->rx_stream_idle_count        = 0;
+    p_cb->rx_stream_idle              = false;
+    p_cb->rx_stream_wake_ppi_channel  = p_config->wake_ppi_channel;
+    p_cb->rx_stream_wake_event        = p_config->wake_event;
+    p_cb->rx_stream_wake_ppi_group    = p_config->wake_ppi_group;
+    p_cb->rx_stream_active            = true;
+
+    nrf_timer_task_trigger(p_config->p_counter, NRF_TIMER_TASK_STOP);
+    nrf_timer_mode_set(p_config->p_counter, NRF_TIMER_MODE_COUNTER);
+    nrf_timer_bit_width_set(p_config->p_counter, NRF_TIMER_BIT_WIDTH_32);
+    nrf_timer_task_trigger(p_config->p_counter, NRF_TIMER_TASK_CLEAR);
+    nrf_timer_task_trigger(p_config->p_counter, NRF_TIMER_TASK_START);
+
+    nrfx_gppi_channel_endpoints_setup(p_config->ppi_channel,
+                                      nrf_uarte_event_address_get(p_uarte,
+                                                                  NRF_UARTE_EVENT_RXDRDY),
+                                      nrf_timer_task_address_get(p_config->p_counter,
+                                                                 NRF_TIMER_TASK_COUNT));
+    nrfx_gppi_channels_enable(NRFX_BIT(p_config->ppi_channel));
+
+    if (p_config->idle_polls != 0)
+    {
+        // The wake channel disables itself through the group, so that only the first falling
+        // edge of the RX line restarts the receiver. It is enabled when the receiver goes idle.
+        nrfx_gppi_group_disable(p_config->wake_ppi_group);
+        nrfx_gppi_channel_endpoints_setup(p_config->wake_ppi_channel,
+                                          p_config->wake_event,
+                                          nrf_uarte_task_address_get(p_uarte,
+                                                                     NRF_UARTE_TASK_STARTRX));
+        nrfx_gppi_fork_endpoint_setup(p_config->wake_ppi_channel,
+            nrfx_gppi_task_address_get(nrfx_gppi_group_disable_task_get(p_config->wake_ppi_group)));
+        nrfx_gppi_channels_include_in_group(NRFX_BIT(p_config->wake_ppi_channel),
+                                            p_config->wake_ppi_group);
+    }
+
+    nrf_uarte_event_clear(p_uarte, NRF_UARTE_EVENT_ENDRX);
+    nrf_uarte_event_clear(p_uarte, NRF_UARTE_EVENT_RXTO);
+    nrf_uarte_event_clear(p_uarte, NRF_UARTE_EVENT_RXSTARTED);
+    nrf_uarte_rx_buffer_set(p_uarte, p_config->p_buffer, p_config->chunk_size);
+    nrf_uarte_shorts_enable(p_uarte, NRF_UARTE_SHORT_ENDRX_STARTRX);
+    nrf_uarte_int_enable(p_uarte, NRF_UARTE_INT_RXSTARTED_MASK);
+    nrf_uarte_task_trigger(p_uarte, NRF_UARTE_TASK_STARTRX);
+
+    NRFX_LOG_INFO("Streaming reception started, %d chunks of %d bytes.",
+                  p_config->chunk_count,
+                  (int)p_config->chunk_size);
+    return NRFX_SUCCESS;
+}
+
+void nrfx_uarte_rx_stream_poll(nrfx_uarte_t const * p_instance)
 {
+    uarte_control_block_t * p_cb = UARTE_CB(p_instance);
+    uint32_t const          int_mask = NRF_UARTE_INT_ENDRX_MASK     |
+                                       NRF_UARTE_INT_RXSTARTED_MASK |
+                                       NRF_UARTE_INT_RXTO_MASK      |
+                                       NRF_UARTE_INT_ERROR_MASK;
+
+    nrf_uarte_int_disable(UARTE_REG(p_instance), int_mask);
+
+    if (!p_cb->rx_stream_active)
+    {
+        // The stream has been stopped in the meantime, RXSTARTED interrupt must stay disabled.
+        nrf_uarte_int_enable(UARTE_REG(p_instance), int_mask & ~NRF_UARTE_INT_RXSTARTED_MASK);
+        return;
+    }
+
+    if (!p_cb->rx_aborted && !p_cb->rx_stream_idle)
+    {
+        uint32_t count = rx_stream_count_get(p_cb);
+
+        if (count == p_cb->rx_stream_poll_count)
+        {
+            // The line is idle, so all counted bytes have already been written to RAM.
+            rx_stream_report(p_cb, count);
+
+            if ((p_cb->rx_stream_idle_polls != 0) &&
+                (++p_cb->rx_stream_idle_count >= p_cb->rx_stream_idle_polls))
+            {
+                // Power down the receiver, the ring is rewound once it is stopped.
+                nrf_uarte_shorts_disable(UARTE_REG(p_instance), NRF_UARTE_SHORT_ENDRX_STARTRX);
+                p_cb->rx_stream_idle = true;
+                p_cb->rx_aborted     = true;
+                nrf_uarte_task_trigger(UARTE_REG(p_instance), NRF_UARTE_TASK_STOPRX);
+                NRFX_LOG_INFO("Streaming reception idle.");
+            }
+        }
+        else
+        {
+            p_cb->rx_stream_idle_count = 0;
+        }
+        p_cb->rx_stream_poll_count = count;
+    }
+
+    nrf_uarte_int_enable(UARTE_REG(p_instance), int_mask);
+}
+
+void nrfx_uarte_rx_stream_stop(nrfx_uarte_t const * p_instance)
+{
+    uarte_control_block_t * p_cb    = UARTE_CB(p_instance);
+    NRF_UARTE_Type *        p_uarte = UARTE_REG(p_instance);
+
+    NRFX_ASSERT(p_cb->rx_stream_active);
+
+    if (p_cb->rx_stream_idle)
+    {
+        nrfx_gppi_group_disable(p_cb->rx_stream_wake_ppi_group);
+        p_cb->rx_stream_idle = false;
+
+        if (!p_cb->rx_aborted && !nrf_uarte_event_check(p_uarte, NRF_UARTE_EVENT_RXSTARTED))
+        {
+            // The receiver is powered down and there is no data left to be reported.
+            rx_stream_release(p_uarte, p_cb);
+            NRFX_LOG_INFO("Streaming reception stopped.");
+            rx_done_event(p_cb, 0, NULL);
+            return;
+        }
+    }
+
+    nrf_uarte_shorts_disable(p_uarte, NRF_UARTE_SHORT_ENDRX_STARTRX);
+    p_cb->rx_aborted = true;
+    nrf_uarte_task_trigger(p_uarte, NRF_UARTE_TASK_STOPRX);
+    NRFX_LOG_INFO("Streaming reception stopped.");
+}
+
+/** @brief Prepare the stream for the receiver to be restarted at the beginning of the ring. */
+static void rx_stream_rewind(NRF_UARTE_Type *        p_uarte,
+                             uarte_control_block_t * p_cb)
+{
+    nrf_timer_task_trigger(p_cb->p_rx_stream_counter, NRF_TIMER_TASK_CLEAR);
+
+    p_cb->rx_stream_next_chunk        = 1;
+    p_cb->rx_stream_read_offset       = 0;
+    p_cb->rx_stream_read_count        = 0;
+    p_cb->rx_stream_chunk_start_count = 0;
+    p_cb->rx_stream_poll_count        = 0;
+    p_cb->rx_stream_idle_count        = 0;
+
+    nrf_uarte_event_clear(p_uarte, NRF_UARTE_EVENT_ENDRX);
+    nrf_uarte_event_clear(p_uarte, NRF_UARTE_EVENT_RXSTARTED);
+    nrf_uarte_rx_buffer_set(p_uarte, p_cb->p_rx_buffer, p_cb->rx_stream_chunk_size);
+    nrf_uarte_shorts_enable(p_uarte, NRF_UARTE_SHORT_ENDRX_STARTRX);
+}
+
+NRFX_IRQ_HANDLER_ATTR static void rx_stream_irq_handler(NRF_UARTE_Type *        p_uarte,
+                                                        uarte_control_block_t * p_cb)
+{
+    if (nrf_uarte_event_check(p_uarte, NRF_UARTE_EVENT_RXSTARTED))
+    {
+        nrf_uarte_event_clear(p_uarte, NRF_UARTE_EVENT_RXSTARTED);
+
+        // The receiver has been restarted by the wake event, which also disabled the wake channel.
+        p_cb->rx_stream_idle = false;
+
+        // The pointer of the chunk being filled is already latched, set up the next one.
+        nrf_uarte_rx_buffer_set(p_uarte,
+                                &p_cb->p_rx_buffer[p_cb->rx_stream_next_chunk *
+                                                   p_cb->rx_stream_chunk_size],
+                                p_cb->rx_stream_chunk_size);
+        p_cb->rx_stream_next_chunk = (p_cb->rx_stream_next_chunk + 1) %
+                                     p_cb->rx_stream_chunk_count;
+    }
+
     if (nrf_uarte_event_check(p_uarte, NRF_UARTE_EVENT_ERROR))
     {
         nrfx_uarte_event_t event;
 
         nrf_uarte_event_clear(p_uarte, NRF_UARTE_EVENT_ERROR);
 
+        // The reception is not aborted, the stream continues after the error is reported.
+        event.type                   = NRFX_UARTE_EVT_ERROR;
+        event.data.error.error_mask  = nrf_uarte_errorsrc_get_and_clear(p_uarte);
+        event.data.error.rxtx.bytes  = 0;
+        event.data.error.rxtx.p_data = NULL;
+
+        p_cb->handler(&event, p_cb->p_context);
+    }
+
+    if (nrf_uarte_event_check(p_uarte, NRF_UARTE_EVENT_ENDRX))
+    {
+        nrf_uarte_event_clear(p_uarte, NRF_UARTE_EVENT_ENDRX);
+
+        if (!p_cb->rx_aborted)
+        {
+            uint32_t count = rx_stream_count_get(p_cb);
+
+            p_cb->rx_stream_chunk_start_count += p_cb->rx_stream_chunk_size;
+
+            // ENDRX events of several chunks may be merged if the interrupt is delayed.
+            // A chunk is known to be complete once a byte of the following one is counted.
+            while ((count - p_cb->rx_stream_chunk_start_count) > p_cb->rx_stream_chunk_size)
+            {
+                p_cb->rx_stream_chunk_start_count += p_cb->rx_stream_chunk_size;
+            }
+
+            rx_stream_report(p_cb, p_cb->rx_stream_chunk_start_count);
+        }
+    }
+
+    if (nrf_uarte_event_check(p_uarte, NRF_UARTE_EVENT_RXTO))
+    {
+        nrf_uarte_event_clear(p_uarte, NRF_UARTE_EVENT_RXTO);
+
+        if (p_cb->rx_aborted && p_cb->rx_stream_idle)
+        {
+            rx_stream_report(p_cb, rx_stream_count_get(p_cb));
+            rx_stream_rewind(p_uarte, p_cb);
+            p_cb->rx_aborted = false;
+            nrfx_gppi_group_enable(p_cb->rx_stream_wake_ppi_group);
+        }
+        else if (p_cb->rx_aborted)
+        {
+            rx_stream_report(p_cb, rx_stream_count_get(p_cb));
+            rx_stream_release(p_uarte, p_cb);
+            p_cb->rx_aborted = false;
+            rx_done_event(p_cb, 0, NULL);
+        }
+    }
+}
+
+NRFX_IRQ_HANDLER_ATTR static void uarte_irq_handler(NRF_UARTE_Type *        p_uarte,
+                                                    uarte_control_block_t * p_cb)
+{
+    if (p_cb->rx_stream_active)
+    {
+        rx_stream_irq_handler(p_uarte, p_cb);
+    }
+    else if (nrf_uarte_event_check(p_uarte, NRF_UARTE_EVENT_ERROR))
+    {
+        nrfx_uarte_event_t event;
+
+        nrf_uarte_event_clear(p_uarte, NRF_UARTE_EVENT_ERROR);
+
         event.type                   = NRFX_UARTE_EVT_ERROR;
         event.data.error.error_mask  = nrf_uarte_errorsrc_get_and_clear(p_uarte);
         event.data.error.rxtx.bytes  = nrf_uarte_rx_amount_get(p_uarte);
@@ -696,7 +1384,64 @@ static void uarte_irq_handler(NRF_UARTE_Type *        p_uarte,
         }
     }
 
-    if (nrf_uarte_event_check(p_uarte, NRF_UARTE_EVENT_ENDTX))
+    if (nrf_uarte_event_check(p_uarte, NRF_UARTE_EVENT_TXSTARTED))
+    {
+        nrf_uarte_event_clear(p_uarte, NRF_UARTE_EVENT_TXSTARTED);
+
+        p_cb->tx_started = true;
+#if NRFX_UARTE_TX_BOUNCE_SIZE > 0
+        if (p_cb->tx_bounce_left != 0)
+        {
+            tx_bounce_arm(p_uarte, p_cb);
+        }
+        else
+#endif
+        if ((p_cb->tx_queue_count != 0) && !p_cb->tx_queue_armed)
+        {
+            tx_queue_arm(p_uarte, p_cb);
+        }
+    }
+
+#if NRFX_UARTE_TX_BOUNCE_SIZE > 0
+    if (nrf_uarte_event_check(p_uarte, NRF_UARTE_EVENT_ENDTX) && (p_cb->tx_bounce_armed != 0))
+    {
+        nrf_uarte_event_clear(p_uarte, NRF_UARTE_EVENT_ENDTX);
+
+        // The next chunk is already set up, so it is started right away, like a queued buffer.
+        p_cb->tx_bounce_sent += nrf_uarte_tx_amount_get(p_uarte);
+        p_cb->tx_bounce_armed = 0;
+        p_cb->tx_started      = false;
+        nrf_uarte_task_trigger(p_uarte, NRF_UARTE_TASK_STARTTX);
+    }
+    else
+#endif
+    if (nrf_uarte_event_check(p_uarte, NRF_UARTE_EVENT_ENDTX) && p_cb->tx_queue_armed)
+    {
+        nrf_uarte_event_clear(p_uarte, NRF_UARTE_EVENT_ENDTX);
+
+        // Start the armed buffer first to keep the gap on the line as short as possible.
+        p_cb->tx_started = false;
+        nrf_uarte_task_trigger(p_uarte, NRF_UARTE_TASK_STARTTX);
+
+        uarte_tx_desc_t const * p_desc = &p_cb->tx_queue[p_cb->tx_queue_head];
+        nrfx_uarte_event_t      event;
+
+        event.type             = NRFX_UARTE_EVT_TX_DONE;
+        event.data.rxtx.bytes  = p_cb->tx_buffer_length;
+        event.data.rxtx.p_data = (uint8_t *)p_cb->p_tx_buffer;
+
+        p_cb->p_tx_buffer      = p_desc->p_data;
+        p_cb->tx_buffer_length = p_desc->length;
+        p_cb->tx_queue_head    = (p_cb->tx_queue_head + 1) % NRFX_UARTE_TX_QUEUE_SIZE;
+        p_cb->tx_queue_count--;
+        p_cb->tx_queue_armed   = false;
+#if NRFX_UARTE_TX_BOUNCE_SIZE > 0
+        p_cb->tx_bounce_sent   = 0;
+#endif
+
+        p_cb->handler(&event, p_cb->p_context);
+    }
+    else if (nrf_uarte_event_check(p_uarte, NRF_UARTE_EVENT_ENDTX))
     {
         nrf_uarte_event_clear(p_uarte, NRF_UARTE_EVENT_ENDTX);
 
@@ -706,7 +1451,7 @@ static void uarte_irq_handler(NRF_UARTE_Type *        p_uarte,
 
         if (p_cb->tx_buffer_length != 0)
         {
-            tx_done_event(p_cb, nrf_uarte_tx_amount_get(p_uarte));
+            tx_done_event(p_cb, tx_amount_get(p_uarte, p_cb));
         }
     }
 
@@ -715,36 +1460,44 @@ static void uarte_irq_handler(NRF_UARTE_Type *        p_uarte,
         nrf_uarte_event_clear(p_uarte, NRF_UARTE_EVENT_TXSTOPPED);
         if (p_cb->tx_buffer_length != 0)
         {
-            tx_done_event(p_cb, nrf_uarte_tx_amount_get(p_uarte));
+            tx_done_event(p_cb, tx_amount_get(p_uarte, p_cb));
         }
     }
 }
 
 #if NRFX_CHECK(NRFX_UARTE0_ENABLED)
-void nrfx_uarte_0_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_uarte_0_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(uarte_0);
     uarte_irq_handler(NRF_UARTE0, &m_cb[NRFX_UARTE0_INST_IDX]);
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
 #if NRFX_CHECK(NRFX_UARTE1_ENABLED)
-void nrfx_uarte_1_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_uarte_1_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(uarte_1);
     uarte_irq_handler(NRF_UARTE1, &m_cb[NRFX_UARTE1_INST_IDX]);
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
 #if NRFX_CHECK(NRFX_UARTE2_ENABLED)
-void nrfx_uarte_2_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_uarte_2_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(uarte_2);
     uarte_irq_handler(NRF_UARTE2, &m_cb[NRFX_UARTE2_INST_IDX]);
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
 #if NRFX_CHECK(NRFX_UARTE3_ENABLED)
-void nrfx_uarte_3_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_uarte_3_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(uarte_3);
     uarte_irq_handler(NRF_UARTE3, &m_cb[NRFX_UARTE3_INST_IDX]);
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
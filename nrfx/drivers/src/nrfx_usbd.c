@@ -36,6 +36,7 @@
 #if NRFX_CHECK(NRFX_USBD_ENABLED)
 
 #include <nrfx_usbd.h>
+#include <helpers/nrfx_prof.h>
 #include "nrfx_usbd_errata.h"
 #include <string.h>
 
@@ -275,6 +276,25 @@ static nrfx_atomic_t m_ep_dma_waiting;
  */
 static bool m_dma_pending;
 
+/**
+ * @brief Endpoints assigned to each EasyDMA scheduling priority level.
+ *
+ * Bit positions are the same as in @ref m_ep_dma_waiting. Every endpoint belongs to exactly one level.
+ */
+static uint32_t m_dma_prio_mask[NRFX_USBD_DMA_PRIORITY_LEVELS] = {
+    [NRFX_USBD_DMA_PRIORITY_LEVELS - 1] = NRFX_USBD_EPIN_BIT_MASK | NRFX_USBD_EPOUT_BIT_MASK
+};
+
+/**
+ * @brief Number of consecutive EasyDMA transfers granted while lower priority endpoints were waiting.
+ */
+static uint8_t m_dma_quota_cnt;
+
+/**
+ * @brief Bit position of the endpoint served by the last EasyDMA transfer.
+ */
+static uint8_t m_dma_last_pos;
+
 /**
  * @brief First time enabling after reset. Used in nRF52 errata 223.
  */
@@ -331,6 +351,30 @@ nrfx_usbd_transfer_t m_ep_feeder_state[NRF_USBD_EPIN_CNT];
  */
 nrfx_usbd_transfer_t m_ep_consumer_state[NRF_USBD_EPOUT_CNT];
 
+/**
+ * @brief The structure that holds the state of a double-buffered isochronous stream.
+ */
+typedef struct
+{
+    void *   p_buffer[2]; //!< Stream buffers.
+    size_t   size[2];     //!< Number of bytes submitted in the IN stream buffers.
+    size_t   buffer_size; //!< Size of each stream buffer.
+    uint8_t  ready_mask;  //!< IN: buffers filled by the user. OUT: buffers free for reception.
+    uint8_t  next;        //!< Buffer to be used first in the next frame.
+    uint8_t  armed_idx;   //!< Buffer armed for the current frame.
+    bool     armed;       //!< True if a buffer is armed and not yet transferred by EasyDMA.
+    bool     active;      //!< True if the stream is running.
+} usbd_iso_stream_t;
+
+/**
+ * @brief Isochronous stream states.
+ */
+static struct
+{
+    usbd_iso_stream_t in;  //!< Stream on the ISO IN endpoint.
+    usbd_iso_stream_t out; //!< Stream on the ISO OUT endpoint.
+} m_iso_stream;
+
 
 /**
  * @brief Buffer used to send data directly from FLASH.
@@ -512,6 +556,56 @@ bool nrfx_usbd_feeder_ram(
     return (p_transfer->size != 0);
 }
 
+/**
+ * @brief Integrated feeder from a ring buffer.
+ *
+ * Packets are sent directly from the ring storage. A packet that wraps around the end
+ * of the storage is assembled in the feeder buffer.
+ *
+ * @param[out]    p_next    See @ref nrfx_usbd_feeder_t documentation.
+ * @param[in,out] p_context See @ref nrfx_usbd_feeder_t documentation.
+ * @param[in]     ep_size   See @ref nrfx_usbd_feeder_t documentation.
+ *
+ * @retval true  Continue transfer.
+ * @retval false This was the last transfer.
+ */
+static bool usbd_feeder_ring(
+    nrfx_usbd_ep_transfer_t * p_next,
+    void * p_context,
+    size_t ep_size)
+{
+    nrfx_usbd_ring_t * p_ring = (nrfx_usbd_ring_t *)p_context;
+    size_t head = p_ring->head;
+    size_t tail = p_ring->tail;
+    size_t used = (head >= tail) ? (head - tail) : (p_ring->size - tail + head);
+
+    size_t tx_size = NRFX_MIN(used, ep_size);
+    size_t contiguous = p_ring->size - tail;
+    if (tx_size <= contiguous)
+    {
+        p_next->p_data.tx = &p_ring->p_buffer[tail];
+    }
+    else
+    {
+        uint8_t * p_buffer = (uint8_t *)nrfx_usbd_feeder_buffer_get();
+        NRFX_ASSERT(tx_size <= NRFX_USBD_FEEDER_BUFFER_SIZE);
+        memcpy(p_buffer, &p_ring->p_buffer[tail], contiguous);
+        memcpy(p_buffer + contiguous, p_ring->p_buffer, tx_size - contiguous);
+        p_next->p_data.tx = p_buffer;
+    }
+    p_next->size = tx_size;
+
+    /* EasyDMA copies the packet before the producer can be resumed, so the space is released now. */
+    tail += tx_size;
+    if (tail >= p_ring->size)
+    {
+        tail -= p_ring->size;
+    }
+    p_ring->tail = tail;
+
+    return (used > tx_size);
+}
+
 /**
  * @brief Integrated feeder from RAM source with ZLP.
  *
@@ -961,6 +1055,124 @@ static inline void nrf_usbd_epin_dma_handler(nrfx_usbd_ep_t ep)
     }
 }
 
+/**
+ * @brief Send the isochronous stream event to the user.
+ *
+ * @param[in] ep       Endpoint number.
+ * @param[in] status   Stream status.
+ * @param[in] p_buffer Handled buffer or NULL.
+ * @param[in] size     Number of bytes in the handled buffer.
+ */
+static void usbd_iso_stream_evt_send(nrfx_usbd_ep_t                ep,
+                                     nrfx_usbd_iso_stream_status_t status,
+                                     void *                        p_buffer,
+                                     size_t                        size)
+{
+    const nrfx_usbd_evt_t evt = {
+        NRFX_USBD_EVT_ISO_STREAM,
+        .data = {
+            .isostream = {
+                .ep       = ep,
+                .status   = status,
+                .p_buffer = p_buffer,
+                .size     = size
+            }
+        }
+    };
+    m_event_handler(&evt);
+}
+
+/**
+ * @brief Hand the buffer transferred by EasyDMA back to the user.
+ *
+ * @param[in]     ep       Endpoint number.
+ * @param[in,out] p_stream Stream state.
+ */
+static void usbd_iso_stream_dma_done(nrfx_usbd_ep_t ep, usbd_iso_stream_t * p_stream)
+{
+    uint8_t idx = p_stream->armed_idx;
+    size_t  size;
+
+    p_stream->armed = false;
+    /* The whole frame is always transferred at once */
+    ep_state_access(ep)->handler.feeder = NULL;
+    if (NRF_USBD_EPIN_CHECK(ep))
+    {
+        size = p_stream->size[idx];
+    }
+    else
+    {
+        size = ep_state_access(ep)->transfer_cnt;
+    }
+    usbd_iso_stream_evt_send(ep, NRFX_USBD_ISO_STREAM_DONE, p_stream->p_buffer[idx], size);
+}
+
+/**
+ * @brief Arm the isochronous stream endpoint for the current frame.
+ *
+ * Called at Start Of Frame. The next buffer handed over to the driver is configured
+ * as the endpoint transfer and EasyDMA is started by @ref usbd_dmareq_process.
+ *
+ * @param[in]     ep       Endpoint number.
+ * @param[in,out] p_stream Stream state.
+ */
+static void usbd_iso_stream_sof_process(nrfx_usbd_ep_t ep, usbd_iso_stream_t * p_stream)
+{
+    if (!p_stream->active || p_stream->armed)
+    {
+        return;
+    }
+    if (NRF_USBD_EPOUT_CHECK(ep) &&
+        (nrf_usbd_episoout_size_get(NRF_USBD, ep) == NRF_USBD_EPISOOUT_NO_DATA))
+    {
+        /* Nothing received in the previous frame */
+        return;
+    }
+
+    uint8_t idx = p_stream->next;
+    if ((p_stream->ready_mask & (1U << idx)) == 0)
+    {
+        idx ^= 1U;
+    }
+    if ((p_stream->ready_mask & (1U << idx)) == 0)
+    {
+        usbd_iso_stream_evt_send(ep,
+                                 NRF_USBD_EPIN_CHECK(ep) ? NRFX_USBD_ISO_STREAM_UNDERRUN :
+                                                           NRFX_USBD_ISO_STREAM_OVERRUN,
+                                 NULL,
+                                 0);
+        return;
+    }
+
+    usbd_ep_state_t *      p_state = ep_state_access(ep);
+    nrfx_usbd_transfer_t * p_context;
+    if (NRF_USBD_EPIN_CHECK(ep))
+    {
+        p_context = m_ep_feeder_state + NRF_USBD_EP_NR_GET(ep);
+        p_context->p_data.tx = p_stream->p_buffer[idx];
+        p_context->size      = p_stream->size[idx];
+        p_state->handler.feeder = nrfx_usbd_feeder_ram;
+    }
+    else
+    {
+        p_context = m_ep_consumer_state + NRF_USBD_EP_NR_GET(ep);
+        p_context->p_data.rx = p_stream->p_buffer[idx];
+        p_context->size      = p_stream->buffer_size;
+        p_state->handler.consumer = nrfx_usbd_consumer;
+    }
+    p_context->flags   = 0;
+    p_state->p_context = p_context;
+
+    p_state->transfer_cnt = 0;
+    p_state->status       = NRFX_USBD_EP_OK;
+
+    p_stream->ready_mask &= ~(1U << idx);
+    p_stream->armed_idx   = idx;
+    p_stream->armed       = true;
+    p_stream->next        = idx ^ 1U;
+    (void)(NRFX_ATOMIC_FETCH_OR(&m_ep_dma_waiting, 1U << ep2bit(ep)));
+}
+
 /**
  * @brief Handler for EasyDMA event from in isochronous endpoint.
  */
@@ -975,7 +1187,12 @@ static inline void nrf_usbd_epiniso_dma_handler(nrfx_usbd_ep_t ep)
     usbd_dma_pending_clear();
 
     usbd_ep_state_t * p_state = ep_state_access(ep);
-    if (NRFX_USBD_EP_ABORTED == p_state->status)
+    if (m_iso_stream.in.armed)
+    {
+        (void)(NRFX_ATOMIC_FETCH_AND(&m_ep_dma_waiting, ~(1U << ep2bit(ep))));
+        usbd_iso_stream_dma_done(ep, &m_iso_stream.in);
+    }
+    else if (NRFX_USBD_EP_ABORTED == p_state->status)
     {
         /* Clear transfer information just in case */
         (void)(NRFX_ATOMIC_FETCH_AND(&m_ep_dma_waiting, ~(1U << ep2bit(ep))));
@@ -1076,7 +1293,12 @@ static inline void nrf_usbd_epoutiso_dma_handler(nrfx_usbd_ep_t ep)
     usbd_dma_pending_clear();
 
     usbd_ep_state_t * p_state = ep_state_access(ep);
-    if (NRFX_USBD_EP_ABORTED == p_state->status)
+    if (m_iso_stream.out.armed)
+    {
+        (void)(NRFX_ATOMIC_FETCH_AND(&m_ep_dma_waiting, ~(1U << ep2bit(ep))));
+        usbd_iso_stream_dma_done(ep, &m_iso_stream.out);
+    }
+    else if (NRFX_USBD_EP_ABORTED == p_state->status)
     {
         /* Nothing to do - just ignore */
     }
@@ -1129,6 +1351,9 @@ static void ev_sof_handler(void)
     }
     m_ep_ready |= iso_ready_mask;
 
+    usbd_iso_stream_sof_process(NRFX_USBD_EPIN8, &m_iso_stream.in);
+    usbd_iso_stream_sof_process(NRFX_USBD_EPOUT8, &m_iso_stream.out);
+
     m_event_handler(&evt);
 }
 
@@ -1300,6 +1525,7 @@ static void ev_epdata_handler(void)
  *
  * Function that realizes algorithm to schedule right channel for EasyDMA transfer.
  * It gets a variable with flags for the endpoints currently requiring transfer.
+ * The endpoint with the highest priority is selected, see @ref nrfx_usbd_ep_dma_priority_set.
  *
  * @param[in] req Bit flags for channels currently requiring transfer.
  *                Bits 0...8 used for IN endpoints.
@@ -1310,8 +1536,43 @@ static void ev_epdata_handler(void)
  */
 static uint8_t usbd_dma_scheduler_algorithm(uint32_t req)
 {
-    /* Only prioritized scheduling mode is supported. */
-    return NRF_CTZ(req);
+    uint8_t  level = 0;
+    uint32_t cand  = req & m_dma_prio_mask[0];
+
+    while (cand == 0)
+    {
+        level++;
+        NRFX_ASSERT(level < NRFX_USBD_DMA_PRIORITY_LEVELS);
+        cand = req & m_dma_prio_mask[level];
+    }
+
+    uint32_t lower = req & ~cand;
+    if ((NRFX_USBD_DMA_SCHEDULER_QUOTA > 0) && (lower != 0))
+    {
+        if (m_dma_quota_cnt >= NRFX_USBD_DMA_SCHEDULER_QUOTA)
+        {
+            /* Quota used up - serve the best waiting endpoint of a lower level once. */
+            m_dma_quota_cnt = 0;
+            do
+            {
+                level++;
+                cand = lower & m_dma_prio_mask[level];
+            } while (cand == 0);
+        }
+        else
+        {
+            m_dma_quota_cnt++;
+        }
+    }
+    else
+    {
+        m_dma_quota_cnt = 0;
+    }
+
+    /* Round robin within the level - first candidate after the last served endpoint. */
+    uint32_t after = cand & ~((2UL << m_dma_last_pos) - 1UL);
+    m_dma_last_pos = (uint8_t)NRF_CTZ((after != 0) ? after : cand);
+    return m_dma_last_pos;
 }
 
 /**
@@ -1619,8 +1880,9 @@ static const nrfx_irq_handler_t m_isr[] =
  *
  * @{
  */
-void nrfx_usbd_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_usbd_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(usbd);
     const uint32_t enabled = nrf_usbd_int_enable_get(NRF_USBD);
     uint32_t to_process = enabled;
     uint32_t active = 0;
@@ -1653,6 +1915,7 @@ void nrfx_usbd_irq_handler(void)
     {
         m_isr[USBD_INTEN_EP0SETUP_Pos]();
     }
+    NRFX_PROF_IRQ_EXIT();
 }
 
 /** @} */
@@ -1667,6 +1930,8 @@ nrfx_err_t nrfx_usbd_init(nrfx_usbd_event_handler_t event_handler)
         return NRFX_ERROR_INVALID_STATE;
     }
 
+    nrfx_usbd_errata_init();
+
     m_event_handler = event_handler;
     m_drv_state = NRFX_DRV_STATE_INITIALIZED;
 
@@ -1831,6 +2096,10 @@ void nrfx_usbd_stop(void)
     {
         /* Abort transfers */
         usbd_ep_abort_all();
+        m_iso_stream.in.active  = false;
+        m_iso_stream.in.armed   = false;
+        m_iso_stream.out.active = false;
+        m_iso_stream.out.armed  = false;
 
         /* Disable pullups */
         nrf_usbd_pullup_disable(NRF_USBD);
@@ -2125,6 +2394,182 @@ nrfx_err_t nrfx_usbd_ep_transfer(
     return ret;
 }
 
+void nrfx_usbd_ring_init(nrfx_usbd_ring_t * p_ring, uint8_t * p_buffer, size_t size)
+{
+    NRFX_ASSERT(p_ring);
+    NRFX_ASSERT(nrfx_is_in_ram(p_buffer));
+    NRFX_ASSERT(size >= 2);
+
+    p_ring->p_buffer = p_buffer;
+    p_ring->size     = size;
+    p_ring->head     = 0;
+    p_ring->tail     = 0;
+}
+
+size_t nrfx_usbd_ring_claim(nrfx_usbd_ring_t const * p_ring, uint8_t ** pp_data)
+{
+    NRFX_ASSERT(p_ring);
+    NRFX_ASSERT(pp_data);
+
+    size_t head = p_ring->head;
+    size_t tail = p_ring->tail;
+
+    *pp_data = &p_ring->p_buffer[head];
+    if (tail > head)
+    {
+        return tail - head - 1;
+    }
+    /* Keep one byte free if the free space ends at the end of the storage. */
+    return p_ring->size - head - ((tail == 0) ? 1 : 0);
+}
+
+void nrfx_usbd_ring_commit(nrfx_usbd_ring_t * p_ring, size_t length)
+{
+    NRFX_ASSERT(p_ring);
+
+    size_t head = p_ring->head + length;
+    if (head >= p_ring->size)
+    {
+        head -= p_ring->size;
+    }
+    p_ring->head = head;
+}
+
+nrfx_err_t nrfx_usbd_ep_ring_transfer(nrfx_usbd_ep_t ep, nrfx_usbd_ring_t * p_ring)
+{
+    NRFX_ASSERT(NRF_USBD_EPIN_CHECK(ep));
+    NRFX_ASSERT(NRF_USBD_EP_NR_GET(ep) != 0);
+    NRFX_ASSERT(!NRF_USBD_EPISO_CHECK(ep));
+    NRFX_ASSERT(p_ring);
+
+    if (p_ring->head == p_ring->tail)
+    {
+        nrfx_err_t err_code = NRFX_ERROR_INVALID_LENGTH;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    const nrfx_usbd_handler_desc_t handler = {
+        .handler   = { .feeder = usbd_feeder_ring },
+        .p_context = p_ring
+    };
+    return nrfx_usbd_ep_handled_transfer(ep, &handler);
+}
+
+void nrfx_usbd_ep_dma_priority_set(nrfx_usbd_ep_t ep, uint8_t priority)
+{
+    NRFX_ASSERT(priority < NRFX_USBD_DMA_PRIORITY_LEVELS);
+
+    uint32_t ep_mask = 1UL << ep2bit(ep);
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    for (uint8_t level = 0; level < NRFX_USBD_DMA_PRIORITY_LEVELS; level++)
+    {
+        m_dma_prio_mask[level] &= ~ep_mask;
+    }
+    m_dma_prio_mask[priority] |= ep_mask;
+    NRFX_CRITICAL_SECTION_EXIT();
+}
+
+nrfx_err_t nrfx_usbd_iso_stream_start(nrfx_usbd_ep_t ep,
+                                      void *         p_buffer0,
+                                      void *         p_buffer1,
+                                      size_t         buffer_size)
+{
+    NRFX_ASSERT(NRF_USBD_EPISO_CHECK(ep));
+    NRFX_ASSERT(NRF_USBD_EPIN_CHECK(ep) ||
+                (buffer_size >= ep_state_access(ep)->max_packet_size));
+
+    nrfx_err_t err_code;
+    if (!nrfx_is_in_ram(p_buffer0) || !nrfx_is_in_ram(p_buffer1))
+    {
+        err_code = NRFX_ERROR_INVALID_ADDR;
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+        return err_code;
+    }
+
+    usbd_iso_stream_t * p_stream = NRF_USBD_EPIN_CHECK(ep) ? &m_iso_stream.in : &m_iso_stream.out;
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    if (p_stream->active || p_stream->armed ||
+        (m_ep_dma_waiting & (1U << ep2bit(ep))))
+    {
+        err_code = NRFX_ERROR_BUSY;
+    }
+    else
+    {
+        p_stream->p_buffer[0] = p_buffer0;
+        p_stream->p_buffer[1] = p_buffer1;
+        p_stream->size[0]     = 0;
+        p_stream->size[1]     = 0;
+        p_stream->buffer_size = buffer_size;
+        /* IN buffers are filled by the user first, OUT buffers are free for reception. */
+        p_stream->ready_mask  = NRF_USBD_EPIN_CHECK(ep) ? 0 : 3;
+        p_stream->next        = 0;
+        p_stream->active      = true;
+        err_code = NRFX_SUCCESS;
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    if (err_code != NRFX_SUCCESS)
+    {
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+    }
+    return err_code;
+}
+
+nrfx_err_t nrfx_usbd_iso_stream_buffer_submit(nrfx_usbd_ep_t ep, void * p_buffer, size_t size)
+{
+    NRFX_ASSERT(NRF_USBD_EPISO_CHECK(ep));
+    NRFX_ASSERT(NRF_USBD_EPOUT_CHECK(ep) ||
+                ((size > 0) && (size <= ep_state_access(ep)->max_packet_size)));
+
+    usbd_iso_stream_t * p_stream = NRF_USBD_EPIN_CHECK(ep) ? &m_iso_stream.in : &m_iso_stream.out;
+    nrfx_err_t          err_code = NRFX_SUCCESS;
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    uint8_t idx = (p_buffer == p_stream->p_buffer[0]) ? 0 : 1;
+    if (!p_stream->active)
+    {
+        err_code = NRFX_ERROR_INVALID_STATE;
+    }
+    else if ((p_buffer != p_stream->p_buffer[idx]) ||
+             (p_stream->ready_mask & (1U << idx)) ||
+             (p_stream->armed && (p_stream->armed_idx == idx)))
+    {
+        err_code = NRFX_ERROR_INVALID_PARAM;
+    }
+    else
+    {
+        p_stream->size[idx]   = size;
+        p_stream->ready_mask |= (1U << idx);
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    if (err_code != NRFX_SUCCESS)
+    {
+        NRFX_LOG_WARNING("Function: %s, error code: %s.",
+                         __func__,
+                         NRFX_LOG_ERROR_STRING_GET(err_code));
+    }
+    return err_code;
+}
+
+void nrfx_usbd_iso_stream_stop(nrfx_usbd_ep_t ep)
+{
+    NRFX_ASSERT(NRF_USBD_EPISO_CHECK(ep));
+
+    usbd_iso_stream_t * p_stream = NRF_USBD_EPIN_CHECK(ep) ? &m_iso_stream.in : &m_iso_stream.out;
+
+    p_stream->active = false;
+}
+
 nrfx_err_t nrfx_usbd_ep_handled_transfer(
     nrfx_usbd_ep_t                   ep,
     nrfx_usbd_handler_desc_t const * p_handler)
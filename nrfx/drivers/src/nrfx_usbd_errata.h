@@ -46,40 +46,97 @@
 #define NRFX_USBD_ERRATA_ENABLE 1
 #endif
 
+/**
+ * @brief Macro for checking at compile time if the workaround for the given erratum
+ *        can be needed on the target at all.
+ *
+ * When this evaluates to 0, the run-time check and the whole workaround are optimized out.
+ */
+#define NRFX_USBD_ERRATA_POSSIBLE(id) (NRFX_USBD_ERRATA_ENABLE && NRF52_ERRATA_##id##_PRESENT)
+
+/** @brief Bits of the errata mask resolved by @ref nrfx_usbd_errata_init. */
+#define NRFX_USBD_ERRATA_166_MASK (1U << 0)
+#define NRFX_USBD_ERRATA_171_MASK (1U << 1)
+#define NRFX_USBD_ERRATA_187_MASK (1U << 2)
+#define NRFX_USBD_ERRATA_199_MASK (1U << 3)
+#define NRFX_USBD_ERRATA_211_MASK (1U << 4)
+#define NRFX_USBD_ERRATA_223_MASK (1U << 5)
+
+/**
+ * @brief Errata that apply to the device the code is running on.
+ *
+ * Resolved once, so that the checks in the transfer and event paths do not need
+ * to read FICR every time.
+ */
+static uint8_t m_usbd_errata_mask;
+
+/** @brief Function for resolving the errata that apply to the device. */
+static inline void nrfx_usbd_errata_init(void)
+{
+    uint8_t mask = 0;
+
+    if (NRFX_USBD_ERRATA_POSSIBLE(166) && nrf52_errata_166())
+    {
+        mask |= NRFX_USBD_ERRATA_166_MASK;
+    }
+    if (NRFX_USBD_ERRATA_POSSIBLE(171) && nrf52_errata_171())
+    {
+        mask |= NRFX_USBD_ERRATA_171_MASK;
+    }
+    if (NRFX_USBD_ERRATA_POSSIBLE(187) && nrf52_errata_187())
+    {
+        mask |= NRFX_USBD_ERRATA_187_MASK;
+    }
+    if (NRFX_USBD_ERRATA_POSSIBLE(199) && nrf52_errata_199())
+    {
+        mask |= NRFX_USBD_ERRATA_199_MASK;
+    }
+    if (NRFX_USBD_ERRATA_POSSIBLE(211) && nrf52_errata_211())
+    {
+        mask |= NRFX_USBD_ERRATA_211_MASK;
+    }
+    if (NRFX_USBD_ERRATA_POSSIBLE(223) && nrf52_errata_223())
+    {
+        mask |= NRFX_USBD_ERRATA_223_MASK;
+    }
+
+    m_usbd_errata_mask = mask;
+}
+
 /* Errata: ISO double buffering not functional. **/
 static inline bool nrfx_usbd_errata_166(void)
 {
-    return NRFX_USBD_ERRATA_ENABLE && nrf52_errata_166();
+    return NRFX_USBD_ERRATA_POSSIBLE(166) && (m_usbd_errata_mask & NRFX_USBD_ERRATA_166_MASK);
 }
 
 /* Errata: USBD might not reach its active state. **/
 static inline bool nrfx_usbd_errata_171(void)
 {
-    return NRFX_USBD_ERRATA_ENABLE && nrf52_errata_171();
+    return NRFX_USBD_ERRATA_POSSIBLE(171) && (m_usbd_errata_mask & NRFX_USBD_ERRATA_171_MASK);
 }
 
 /* Errata: USB cannot be enabled. **/
 static inline bool nrfx_usbd_errata_187(void)
 {
-    return NRFX_USBD_ERRATA_ENABLE && nrf52_errata_187();
+    return NRFX_USBD_ERRATA_POSSIBLE(187) && (m_usbd_errata_mask & NRFX_USBD_ERRATA_187_MASK);
 }
 
 /* Errata: USBD cannot receive tasks during DMA. **/
 static inline bool nrfx_usbd_errata_199(void)
 {
-    return NRFX_USBD_ERRATA_ENABLE && nrf52_errata_199();
+    return NRFX_USBD_ERRATA_POSSIBLE(199) && (m_usbd_errata_mask & NRFX_USBD_ERRATA_199_MASK);
 }
 
 /* Errata: Device remains in SUSPEND too long. */
 static inline bool nrfx_usbd_errata_211(void)
 {
-    return NRFX_USBD_ERRATA_ENABLE && nrf52_errata_211();
+    return NRFX_USBD_ERRATA_POSSIBLE(211) && (m_usbd_errata_mask & NRFX_USBD_ERRATA_211_MASK);
 }
 
 /* Errata: Unexpected behavior after reset. **/
 static inline bool nrfx_usbd_errata_223(void)
 {
-    return NRFX_USBD_ERRATA_ENABLE && nrf52_errata_223();
+    return NRFX_USBD_ERRATA_POSSIBLE(223) && (m_usbd_errata_mask & NRFX_USBD_ERRATA_223_MASK);
 }
 
 #endif // NRFX_USBD_ERRATA_H__
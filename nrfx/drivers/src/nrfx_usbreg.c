@@ -36,6 +36,7 @@
 #if NRFX_CHECK(NRFX_USBREG_ENABLED)
 
 #include <nrfx_usbreg.h>
+#include <helpers/nrfx_prof.h>
 
 static nrfx_usbreg_event_handler_t m_usbevt_handler;
 
@@ -80,8 +81,9 @@ void nrfx_usbreg_uninit(void)
     m_usbevt_handler = NULL;
 }
 
-void nrfx_usbreg_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_usbreg_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(usbreg);
     if (nrf_usbreg_event_check(NRF_USBREGULATOR, NRF_USBREG_EVENT_USBDETECTED))
     {
         nrf_usbreg_event_clear(NRF_USBREGULATOR, NRF_USBREG_EVENT_USBDETECTED);
@@ -97,6 +99,7 @@ void nrfx_usbreg_irq_handler(void)
         nrf_usbreg_event_clear(NRF_USBREGULATOR, NRF_USBREG_EVENT_USBPWRRDY);
         m_usbevt_handler(NRFX_USBREG_EVT_READY);
     }
+    NRFX_PROF_IRQ_EXIT();
 }
 
 #endif // NRFX_CHECK(NRFX_USBREG_ENABLED)
@@ -40,6 +40,7 @@
 #endif
 
 #include <nrfx_wdt.h>
+#include <helpers/nrfx_prof.h>
 
 #define NRFX_LOG_MODULE WDT
 #include <nrfx_log.h>
@@ -159,24 +160,28 @@ void nrfx_wdt_channel_feed(nrfx_wdt_t const * p_instance, nrfx_wdt_channel_id ch
 }
 
 #if NRFX_CHECK(NRFX_WDT0_ENABLED) && !NRFX_CHECK(NRFX_WDT_CONFIG_NO_IRQ)
-void nrfx_wdt_0_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_wdt_0_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(wdt_0);
     if (nrf_wdt_event_check(NRF_WDT0, NRF_WDT_EVENT_TIMEOUT))
     {
         m_cb[NRFX_WDT0_INST_IDX].wdt_event_handler();
         nrf_wdt_event_clear(NRF_WDT0, NRF_WDT_EVENT_TIMEOUT);
     }
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
 #if NRFX_CHECK(NRFX_WDT1_ENABLED) && !NRFX_CHECK(NRFX_WDT_CONFIG_NO_IRQ)
-void nrfx_wdt_1_irq_handler(void)
+NRFX_IRQ_HANDLER_ATTR void nrfx_wdt_1_irq_handler(void)
 {
+    NRFX_PROF_IRQ_ENTER(wdt_1);
     if (nrf_wdt_event_check(NRF_WDT1, NRF_WDT_EVENT_TIMEOUT))
     {
         m_cb[NRFX_WDT1_INST_IDX].wdt_event_handler();
         nrf_wdt_event_clear(NRF_WDT1, NRF_WDT_EVENT_TIMEOUT);
     }
+    NRFX_PROF_IRQ_EXIT();
 }
 #endif
 
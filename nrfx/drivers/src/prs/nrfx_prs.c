@@ -45,11 +45,24 @@
         NRFX_LOG_ERROR_STRING_GET(ret_code))
 
 
+// Offsets of the registers common to all peripherals that share PRS boxes.
+#define PRS_INTENSET_OFFSET 0x304
+#define PRS_INTENCLR_OFFSET 0x308
+#define PRS_ENABLE_OFFSET   0x500
+
+#define PRS_REG(p_base_addr, offset) \
+    (*(volatile uint32_t *)((uint32_t)(p_base_addr) + (offset)))
+
 typedef struct {
-    nrfx_irq_handler_t handler;
-    bool               acquired;
+    nrfx_irq_handler_t      handler;
+    bool                    acquired;
+    bool                    shared;
+    nrfx_prs_role_t const * p_role;
 } prs_box_t;
 
+// Lock of the state of all the boxes. It must also exclude the interrupts of the shared peripherals.
+NRFX_LOCK_DECLARE(m_prs_lock);
+
 #define PRS_BOX_DEFINE(n)                                                    \
     static prs_box_t m_prs_box_##n = { .handler = NULL, .acquired = false }; \
     void nrfx_prs_box_##n##_irq_handler(void)                                \
@@ -118,7 +131,7 @@ nrfx_err_t nrfx_prs_acquire(void       const * p_base_addr,
     {
         bool busy = false;
 
-        NRFX_CRITICAL_SECTION_ENTER();
+        NRFX_LOCK_TAKE(m_prs_lock);
         if (p_box->acquired)
         {
             busy = true;
@@ -127,8 +140,9 @@ nrfx_err_t nrfx_prs_acquire(void       const * p_base_addr,
         {
             p_box->handler  = irq_handler;
             p_box->acquired = true;
+            p_box->p_role   = NULL;
         }
-        NRFX_CRITICAL_SECTION_EXIT();
+        NRFX_LOCK_GIVE(m_prs_lock);
 
         if (busy)
         {
@@ -152,7 +166,100 @@ void nrfx_prs_release(void const * p_base_addr)
     {
         p_box->handler  = NULL;
         p_box->acquired = false;
+        p_box->shared   = false;
+        p_box->p_role   = NULL;
+    }
+}
+
+nrfx_err_t nrfx_prs_role_capture(void const * p_base_addr, nrfx_prs_role_t * p_role)
+{
+    NRFX_ASSERT(p_base_addr);
+    NRFX_ASSERT(p_role);
+    NRFX_ASSERT(p_role->reg_count == 0 || (p_role->p_regs && p_role->p_values));
+
+    nrfx_err_t ret_code;
+
+    prs_box_t * p_box = prs_box_get(p_base_addr);
+    if (p_box == NULL)
+    {
+        ret_code = NRFX_ERROR_NOT_SUPPORTED;
+        LOG_FUNCTION_EXIT(WARNING, ret_code);
+        return ret_code;
+    }
+    if (!p_box->acquired)
+    {
+        ret_code = NRFX_ERROR_INVALID_STATE;
+        LOG_FUNCTION_EXIT(WARNING, ret_code);
+        return ret_code;
+    }
+
+    for (uint8_t i = 0; i < p_role->reg_count; i++)
+    {
+        p_role->p_values[i] = PRS_REG(p_base_addr, p_role->p_regs[i]);
+    }
+    p_role->enable      = PRS_REG(p_base_addr, PRS_ENABLE_OFFSET);
+    p_role->int_mask    = PRS_REG(p_base_addr, PRS_INTENSET_OFFSET);
+    p_role->irq_handler = p_box->handler;
+
+    // Park the peripheral so that the next role can be configured from scratch.
+    PRS_REG(p_base_addr, PRS_INTENCLR_OFFSET) = UINT32_MAX;
+    PRS_REG(p_base_addr, PRS_ENABLE_OFFSET)   = 0;
+
+    NRFX_LOCK_TAKE(m_prs_lock);
+    p_box->acquired = false;
+    p_box->shared   = true;
+    p_box->p_role   = NULL;
+    NRFX_LOCK_GIVE(m_prs_lock);
+
+    ret_code = NRFX_SUCCESS;
+    LOG_FUNCTION_EXIT(INFO, ret_code);
+    return ret_code;
+}
+
+nrfx_err_t nrfx_prs_role_switch(void const * p_base_addr, nrfx_prs_role_t const * p_role)
+{
+    NRFX_ASSERT(p_base_addr);
+    NRFX_ASSERT(p_role);
+
+    nrfx_err_t ret_code;
+
+    prs_box_t * p_box = prs_box_get(p_base_addr);
+    if (p_box == NULL)
+    {
+        ret_code = NRFX_ERROR_NOT_SUPPORTED;
+        LOG_FUNCTION_EXIT(WARNING, ret_code);
+        return ret_code;
     }
+    if (!p_box->shared)
+    {
+        ret_code = NRFX_ERROR_INVALID_STATE;
+        LOG_FUNCTION_EXIT(WARNING, ret_code);
+        return ret_code;
+    }
+
+    if (p_box->p_role == p_role)
+    {
+        return NRFX_SUCCESS;
+    }
+
+    PRS_REG(p_base_addr, PRS_INTENCLR_OFFSET) = UINT32_MAX;
+    PRS_REG(p_base_addr, PRS_ENABLE_OFFSET)   = 0;
+
+    for (uint8_t i = 0; i < p_role->reg_count; i++)
+    {
+        PRS_REG(p_base_addr, p_role->p_regs[i]) = p_role->p_values[i];
+    }
+
+    NRFX_LOCK_TAKE(m_prs_lock);
+    p_box->handler  = p_role->irq_handler;
+    p_box->acquired = true;
+    p_box->p_role   = p_role;
+    NRFX_LOCK_GIVE(m_prs_lock);
+
+    PRS_REG(p_base_addr, PRS_ENABLE_OFFSET)   = p_role->enable;
+    PRS_REG(p_base_addr, PRS_INTENSET_OFFSET) = p_role->int_mask;
+
+    return NRFX_SUCCESS;
 }
 
 
@@ -146,6 +146,98 @@ nrfx_err_t nrfx_prs_acquire(void       const * p_base_addr,
  */
 void nrfx_prs_release(void const * p_base_addr);
 
+/**
+ * @brief Register context of a peripheral role sharing a PRS box.
+ *
+ * The structure is owned by the user and must remain valid as long as the role
+ * is used with @ref nrfx_prs_role_switch(). The register list can be one of
+ * the predefined ones, for example @ref NRFX_PRS_ROLE_SPIM_REGS or
+ * @ref NRFX_PRS_ROLE_TWIM_REGS.
+ */
+typedef struct
+{
+    uint16_t const *   p_regs;      ///< Offsets of the registers that make up the role context.
+    uint32_t *         p_values;    ///< Storage for the register values, @p reg_count words long.
+    uint8_t            reg_count;   ///< Number of registers in the context.
+    uint32_t           enable;      ///< For internal use only.
+    uint32_t           int_mask;    ///< For internal use only.
+    nrfx_irq_handler_t irq_handler; ///< For internal use only.
+} nrfx_prs_role_t;
+
+#if NRFX_CHECK(NRFX_SPIM_ENABLED) || defined(__NRFX_DOXYGEN__)
+/** @brief Offsets of the SPIM registers that make up the SPIM role context. */
+#define NRFX_PRS_ROLE_SPIM_REGS                 \
+{                                               \
+    offsetof(NRF_SPIM_Type, SHORTS),            \
+    offsetof(NRF_SPIM_Type, PSEL.SCK),          \
+    offsetof(NRF_SPIM_Type, PSEL.MOSI),         \
+    offsetof(NRF_SPIM_Type, PSEL.MISO),         \
+    offsetof(NRF_SPIM_Type, FREQUENCY),         \
+    offsetof(NRF_SPIM_Type, CONFIG),            \
+    offsetof(NRF_SPIM_Type, ORC),               \
+}
+#endif
+
+#if NRFX_CHECK(NRFX_TWIM_ENABLED) || defined(__NRFX_DOXYGEN__)
+/** @brief Offsets of the TWIM registers that make up the TWIM role context. */
+#define NRFX_PRS_ROLE_TWIM_REGS                 \
+{                                               \
+    offsetof(NRF_TWIM_Type, SHORTS),            \
+    offsetof(NRF_TWIM_Type, PSEL.SCL),          \
+    offsetof(NRF_TWIM_Type, PSEL.SDA),          \
+    offsetof(NRF_TWIM_Type, FREQUENCY),         \
+    offsetof(NRF_TWIM_Type, ADDRESS),           \
+}
+#endif
+
+/**
+ * @brief Function for capturing the register context of the role that currently
+ *        owns the PRS box.
+ *
+ * This function allows several drivers to be initialized at the same time on
+ * the peripherals sharing one PRS box and to alternate between them with
+ * @ref nrfx_prs_role_switch() instead of a full uninitialization and
+ * initialization of each driver. The intended sequence is as follows:
+ * - Initialize (and if applicable, enable) the first driver, then capture its role.
+ *   The shared peripheral is disabled and the box becomes available for the next driver.
+ * - Initialize the next driver on the same box and capture its role. Repeat for
+ *   every role.
+ * - Switch between roles with @ref nrfx_prs_role_switch().
+ *
+ * The pin configuration done by the drivers is not touched when switching,
+ * so the roles must use separate pins.
+ *
+ * @param[in]     p_base_addr Base pointer of the peripheral that owns the box.
+ * @param[in,out] p_role      Role to be captured.
+ *
+ * @retval NRFX_SUCCESS             The role context was captured successfully.
+ * @retval NRFX_ERROR_INVALID_STATE The box is not acquired.
+ * @retval NRFX_ERROR_NOT_SUPPORTED The peripheral is not handled by the PRS subsystem.
+ */
+nrfx_err_t nrfx_prs_role_capture(void const * p_base_addr, nrfx_prs_role_t * p_role);
+
+/**
+ * @brief Function for switching the shared peripheral to the specified role.
+ *
+ * The box caches the active role, so switching to the role that is already
+ * active does not access the peripheral at all. Otherwise, the peripheral is
+ * disabled, the registers of the role are restored, the peripheral is enabled
+ * again and the role's interrupt handler is registered in the box.
+ *
+ * @note The peripheral must be idle when this function is called.
+ *       No transfer of the role that is currently active can be ongoing.
+ * @note Roles captured for a box become invalid once any of the drivers
+ *       sharing the box is uninitialized.
+ *
+ * @param[in] p_base_addr Base pointer of any peripheral associated with the box.
+ * @param[in] p_role      Role captured with @ref nrfx_prs_role_capture().
+ *
+ * @retval NRFX_SUCCESS             The role is active.
+ * @retval NRFX_ERROR_INVALID_STATE No role was captured for the box.
+ * @retval NRFX_ERROR_NOT_SUPPORTED The peripheral is not handled by the PRS subsystem.
+ */
+nrfx_err_t nrfx_prs_role_switch(void const * p_base_addr, nrfx_prs_role_t const * p_role);
+
 /** @} */
 
 void nrfx_prs_box_0_irq_handler(void);
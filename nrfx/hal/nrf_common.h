@@ -42,6 +42,10 @@ extern "C" {
 #define NRFX_EVENT_READBACK_ENABLED 1
 #endif
 
+#ifndef NRFX_IRQ_HANDLER_ATTR
+#define NRFX_IRQ_HANDLER_ATTR
+#endif
+
 #if !defined(NRFX_CONFIG_API_VER_2_9)  && \
     !defined(NRFX_CONFIG_API_VER_2_10) && \
     !defined(NRFX_CONFIG_API_VER_2_11)
@@ -81,6 +81,44 @@ extern "C" {
 #define NRF_GPIO_PIN_MAP(port, pin) (((port) << 5) | ((pin) & 0x1F))
 
 
+/**
+ * @brief Macro for getting the mask of a pin in a given port, for use in constant expressions.
+ *
+ * @param[in] port       Port number.
+ * @param[in] pin_number Absolute pin number.
+ *
+ * @return Mask of the pin if it belongs to @p port, 0 otherwise.
+ */
+#define NRF_GPIO_PORT_PIN_MASK(port, pin_number) \
+    ((((pin_number) >> 5) == (port)) ? (1UL << ((pin_number) & 0x1F)) : 0UL)
+
+/** @brief Number of values served by a parallel bus. */
+#define NRF_GPIO_BUS_VALUES 256
+
+/** @brief Number of pins of a parallel bus. */
+#define NRF_GPIO_BUS_WIDTH  8
+
+/**
+ * @brief Pin group descriptor.
+ *
+ * A group can span all ports. It can be defined at compile time with
+ * @ref NRF_GPIO_PORT_PIN_MASK or built with @ref nrf_gpio_pin_group_from_pins.
+ */
+typedef struct
+{
+    uint32_t mask[GPIO_COUNT]; ///< Masks of the pins in the group, one per port.
+} nrf_gpio_pin_group_t;
+
+/** @brief Lookup table of a parallel bus, with the pins to be set for each value of the bus. */
+typedef nrf_gpio_pin_group_t nrf_gpio_bus_lut_t[NRF_GPIO_BUS_VALUES];
+
+/** @brief Parallel bus descriptor. */
+typedef struct
+{
+    nrf_gpio_pin_group_t const * p_lut; ///< Lookup table with @ref NRF_GPIO_BUS_VALUES entries.
+    nrf_gpio_pin_group_t         pins;  ///< All pins of the bus.
+} nrf_gpio_bus_t;
+
 /** @brief Pin direction definitions. */
 typedef enum
 {
@@ -487,6 +525,86 @@ NRF_STATIC_INLINE void nrf_gpio_ports_read(uint32_t   start_port,
                                            uint32_t   length,
                                            uint32_t * p_masks);
 
+/**
+ * @brief Function for building a pin group from a list of pins.
+ *
+ * @param[out] p_group    Pointer to the pin group descriptor.
+ * @param[in]  p_pins     Array of absolute pin numbers.
+ * @param[in]  pin_count  Number of pins in the array.
+ */
+NRF_STATIC_INLINE void nrf_gpio_pin_group_from_pins(nrf_gpio_pin_group_t * p_group,
+                                                    uint32_t const *       p_pins,
+                                                    uint32_t               pin_count);
+
+/**
+ * @brief Function for configuring all pins of a group.
+ *
+ * The PIN_CNF value is computed once and written to each pin of the group.
+ *
+ * @param p_group Pointer to the pin group descriptor.
+ * @param dir     Pin direction.
+ * @param input   Connect or disconnect the input buffer.
+ * @param pull    Pull configuration.
+ * @param drive   Drive configuration.
+ * @param sense   Pin sensing mechanism.
+ */
+NRF_STATIC_INLINE void nrf_gpio_pin_group_cfg(nrf_gpio_pin_group_t const * p_group,
+                                              nrf_gpio_pin_dir_t           dir,
+                                              nrf_gpio_pin_input_t         input,
+                                              nrf_gpio_pin_pull_t          pull,
+                                              nrf_gpio_pin_drive_t         drive,
+                                              nrf_gpio_pin_sense_t         sense);
+
+/**
+ * @brief Function for setting all pins of a group to the logic high level.
+ *
+ * @param p_group Pointer to the pin group descriptor.
+ */
+NRF_STATIC_INLINE void nrf_gpio_pin_group_set(nrf_gpio_pin_group_t const * p_group);
+
+/**
+ * @brief Function for setting all pins of a group to the logic low level.
+ *
+ * @param p_group Pointer to the pin group descriptor.
+ */
+NRF_STATIC_INLINE void nrf_gpio_pin_group_clear(nrf_gpio_pin_group_t const * p_group);
+
+/**
+ * @brief Function for writing the pins of a group on all ports.
+ *
+ * Each port is updated with a single OUTSET and a single OUTCLR write, so pins
+ * outside the group are not affected.
+ *
+ * @param p_group  Pointer to the group of pins to be written.
+ * @param p_values Pointer to the group of pins to be set high. The remaining pins
+ *                 of @p p_group are set low.
+ */
+NRF_STATIC_INLINE void nrf_gpio_pin_group_write(nrf_gpio_pin_group_t const * p_group,
+                                                nrf_gpio_pin_group_t const * p_values);
+
+/**
+ * @brief Function for initializing a parallel bus.
+ *
+ * The lookup table is filled in with the pins to be set for every value of the bus,
+ * so that writing a value does not require any bit manipulation.
+ *
+ * @param[out] p_bus  Pointer to the parallel bus descriptor.
+ * @param[out] p_lut  Lookup table to be filled in. It must remain valid as long as the bus is used.
+ * @param[in]  p_pins Array of @ref NRF_GPIO_BUS_WIDTH absolute pin numbers, from the least
+ *                    significant bit of the bus.
+ */
+NRF_STATIC_INLINE void nrf_gpio_bus_init(nrf_gpio_bus_t *   p_bus,
+                                         nrf_gpio_bus_lut_t p_lut,
+                                         uint32_t const *   p_pins);
+
+/**
+ * @brief Function for writing a value onto a parallel bus.
+ *
+ * @param p_bus Pointer to the parallel bus descriptor.
+ * @param value Value to be written.
+ */
+NRF_STATIC_INLINE void nrf_gpio_bus_write(nrf_gpio_bus_t const * p_bus, uint8_t value);
+
 #if defined(NRF_GPIO_LATCH_PRESENT)
 /**
  * @brief Function for reading latch state of multiple consecutive ports.
@@ -921,6 +1039,154 @@ NRF_STATIC_INLINE void nrf_gpio_ports_read(uint32_t   start_port,
 }
 
 
+NRF_STATIC_INLINE void nrf_gpio_pin_group_from_pins(nrf_gpio_pin_group_t * p_group,
+                                                    uint32_t const *       p_pins,
+                                                    uint32_t               pin_count)
+{
+    uint32_t port;
+
+    for (port = 0; port < GPIO_COUNT; port++)
+    {
+        p_group->mask[port] = 0;
+    }
+
+    for (; pin_count > 0; pin_count--)
+    {
+        uint32_t pin_number = *p_pins++;
+
+        NRFX_ASSERT(nrf_gpio_pin_present_check(pin_number));
+        port = nrf_gpio_pin_port_number_extract(&pin_number);
+        p_group->mask[port] |= (1UL << pin_number);
+    }
+}
+
+
+NRF_STATIC_INLINE void nrf_gpio_pin_group_cfg(nrf_gpio_pin_group_t const * p_group,
+                                              nrf_gpio_pin_dir_t           dir,
+                                              nrf_gpio_pin_input_t         input,
+                                              nrf_gpio_pin_pull_t          pull,
+                                              nrf_gpio_pin_drive_t         drive,
+                                              nrf_gpio_pin_sense_t         sense)
+{
+    NRF_GPIO_Type * gpio_regs[GPIO_COUNT] = GPIO_REG_LIST;
+    uint32_t cnf = ((uint32_t)dir << GPIO_PIN_CNF_DIR_Pos)     |
+                   ((uint32_t)input << GPIO_PIN_CNF_INPUT_Pos) |
+                   ((uint32_t)pull << GPIO_PIN_CNF_PULL_Pos)   |
+                   ((uint32_t)drive << GPIO_PIN_CNF_DRIVE_Pos) |
+                   ((uint32_t)sense << GPIO_PIN_CNF_SENSE_Pos);
+    uint32_t port;
+
+    for (port = 0; port < GPIO_COUNT; port++)
+    {
+        NRF_GPIO_Type * reg  = gpio_regs[port];
+        uint32_t        mask = p_group->mask[port];
+
+        while (mask)
+        {
+            uint32_t pin_number = NRF_CTZ(mask);
+            mask &= ~(1UL << pin_number);
+#if NRF_GPIO_HAS_SEL
+            /* Preserve MCUSEL setting. */
+            reg->PIN_CNF[pin_number] = (reg->PIN_CNF[pin_number] & GPIO_PIN_CNF_MCUSEL_Msk) | cnf;
+#else
+            reg->PIN_CNF[pin_number] = cnf;
+#endif
+        }
+    }
+}
+
+
+NRF_STATIC_INLINE void nrf_gpio_pin_group_set(nrf_gpio_pin_group_t const * p_group)
+{
+    NRF_GPIO_Type * gpio_regs[GPIO_COUNT] = GPIO_REG_LIST;
+    uint32_t port;
+
+    for (port = 0; port < GPIO_COUNT; port++)
+    {
+        if (p_group->mask[port])
+        {
+            nrf_gpio_port_out_set(gpio_regs[port], p_group->mask[port]);
+        }
+    }
+}
+
+
+NRF_STATIC_INLINE void nrf_gpio_pin_group_clear(nrf_gpio_pin_group_t const * p_group)
+{
+    NRF_GPIO_Type * gpio_regs[GPIO_COUNT] = GPIO_REG_LIST;
+    uint32_t port;
+
+    for (port = 0; port < GPIO_COUNT; port++)
+    {
+        if (p_group->mask[port])
+        {
+            nrf_gpio_port_out_clear(gpio_regs[port], p_group->mask[port]);
+        }
+    }
+}
+
+
+NRF_STATIC_INLINE void nrf_gpio_pin_group_write(nrf_gpio_pin_group_t const * p_group,
+                                                nrf_gpio_pin_group_t const * p_values)
+{
+    NRF_GPIO_Type * gpio_regs[GPIO_COUNT] = GPIO_REG_LIST;
+    uint32_t port;
+
+    for (port = 0; port < GPIO_COUNT; port++)
+    {
+        uint32_t mask = p_group->mask[port];
+
+        if (mask)
+        {
+            uint32_t set_mask = mask & p_values->mask[port];
+
+            nrf_gpio_port_out_set(gpio_regs[port], set_mask);
+            nrf_gpio_port_out_clear(gpio_regs[port], mask ^ set_mask);
+        }
+    }
+}
+
+
+NRF_STATIC_INLINE void nrf_gpio_bus_init(nrf_gpio_bus_t *   p_bus,
+                                         nrf_gpio_bus_lut_t p_lut,
+                                         uint32_t const *   p_pins)
+{
+    uint32_t value;
+    uint32_t bit;
+
+    nrf_gpio_pin_group_from_pins(&p_bus->pins, p_pins, NRF_GPIO_BUS_WIDTH);
+
+    for (value = 0; value < NRF_GPIO_BUS_VALUES; value++)
+    {
+        uint32_t port;
+
+        for (port = 0; port < GPIO_COUNT; port++)
+        {
+            p_lut[value].mask[port] = 0;
+        }
+
+        for (bit = 0; bit < NRF_GPIO_BUS_WIDTH; bit++)
+        {
+            if (value & (1UL << bit))
+            {
+                uint32_t pin_number = p_pins[bit];
+
+                port = nrf_gpio_pin_port_number_extract(&pin_number);
+                p_lut[value].mask[port] |= (1UL << pin_number);
+            }
+        }
+    }
+
+    p_bus->p_lut = p_lut;
+}
+
+
+NRF_STATIC_INLINE void nrf_gpio_bus_write(nrf_gpio_bus_t const * p_bus, uint8_t value)
+{
+    nrf_gpio_pin_group_write(&p_bus->pins, &p_bus->p_lut[value]);
+}
+
+
 #if defined(NRF_GPIO_LATCH_PRESENT)
 NRF_STATIC_INLINE void nrf_gpio_latches_read(uint32_t   start_port,
                                              uint32_t   length,
@@ -553,6 +553,36 @@ NRF_STATIC_INLINE uint8_t nrf_qspi_sreg_get(NRF_QSPI_Type const * p_reg);
  */
 NRF_STATIC_INLINE bool nrf_qspi_busy_check(NRF_QSPI_Type const * p_reg);
 
+/**
+ * @brief Function for checking if the external memory is in the Deep Power-down Mode (DPM).
+ *
+ * @param[in] p_reg Pointer to the structure of registers of the peripheral.
+ *
+ * @retval true  The memory is in DPM.
+ * @retval false The memory is not in DPM.
+ */
+NRF_STATIC_INLINE bool nrf_qspi_dpm_check(NRF_QSPI_Type const * p_reg);
+
+/**
+ * @brief Function for requesting the external memory to enter or exit the DPM.
+ *
+ * The DPM feature must be enabled in the IFCONFIG0 register. Only the DPMEN field
+ * of the IFCONFIG1 register is modified.
+ *
+ * @param[in] p_reg Pointer to the structure of registers of the peripheral.
+ * @param[in] enter True if the memory is to enter DPM, false if it is to exit DPM.
+ */
+NRF_STATIC_INLINE void nrf_qspi_dpmen_set(NRF_QSPI_Type * p_reg, bool enter);
+
+/**
+ * @brief Function for setting the durations needed by the external memory to enter and exit DPM.
+ *
+ * @param[in] p_reg Pointer to the structure of registers of the peripheral.
+ * @param[in] enter Duration of entering DPM, in units of 16 us.
+ * @param[in] exit  Duration of exiting DPM, in units of 16 us.
+ */
+NRF_STATIC_INLINE void nrf_qspi_dpmdur_set(NRF_QSPI_Type * p_reg, uint16_t enter, uint16_t exit);
+
 /**
  * @brief Function for setting registers sending with custom instruction transmission.
  *
@@ -567,6 +597,19 @@ NRF_STATIC_INLINE void nrf_qspi_cinstrdata_set(NRF_QSPI_Type *       p_reg,
                                                nrf_qspi_cinstr_len_t length,
                                                void const *          p_tx_data);
 
+/**
+ * @brief Function for setting all eight data bytes of the custom instruction at once.
+ *
+ * The least significant byte of @p dat0 is sent first.
+ *
+ * @param[in] p_reg Pointer to the structure of registers of the peripheral.
+ * @param[in] dat0  Data bytes 0-3.
+ * @param[in] dat1  Data bytes 4-7.
+ */
+NRF_STATIC_INLINE void nrf_qspi_cinstrdata_raw_set(NRF_QSPI_Type * p_reg,
+                                                   uint32_t        dat0,
+                                                   uint32_t        dat1);
+
 /**
  * @brief Function for getting data from register after custom instruction transmission.
  *
@@ -866,6 +909,25 @@ NRF_STATIC_INLINE bool nrf_qspi_busy_check(NRF_QSPI_Type const * p_reg)
             QSPI_STATUS_READY_Pos) == QSPI_STATUS_READY_BUSY;
 }
 
+NRF_STATIC_INLINE bool nrf_qspi_dpm_check(NRF_QSPI_Type const * p_reg)
+{
+    return ((p_reg->STATUS & QSPI_STATUS_DPM_Msk) >>
+            QSPI_STATUS_DPM_Pos) == QSPI_STATUS_DPM_Enabled;
+}
+
+NRF_STATIC_INLINE void nrf_qspi_dpmen_set(NRF_QSPI_Type * p_reg, bool enter)
+{
+    p_reg->IFCONFIG1 = (p_reg->IFCONFIG1 & ~QSPI_IFCONFIG1_DPMEN_Msk) |
+                       ((enter ? QSPI_IFCONFIG1_DPMEN_Enter : QSPI_IFCONFIG1_DPMEN_Exit)
+                        << QSPI_IFCONFIG1_DPMEN_Pos);
+}
+
+NRF_STATIC_INLINE void nrf_qspi_dpmdur_set(NRF_QSPI_Type * p_reg, uint16_t enter, uint16_t exit)
+{
+    p_reg->DPMDUR = ((uint32_t)enter << QSPI_DPMDUR_ENTER_Pos) |
+                    ((uint32_t)exit  << QSPI_DPMDUR_EXIT_Pos);
+}
+
 NRF_STATIC_INLINE void nrf_qspi_cinstrdata_set(NRF_QSPI_Type *       p_reg,
                                                nrf_qspi_cinstr_len_t length,
                                                void const *          p_tx_data)
@@ -911,6 +973,14 @@ NRF_STATIC_INLINE void nrf_qspi_cinstrdata_set(NRF_QSPI_Type *       p_reg,
     }
 }
 
+NRF_STATIC_INLINE void nrf_qspi_cinstrdata_raw_set(NRF_QSPI_Type * p_reg,
+                                                   uint32_t        dat0,
+                                                   uint32_t        dat1)
+{
+    p_reg->CINSTRDAT1 = dat1;
+    p_reg->CINSTRDAT0 = dat0;
+}
+
 NRF_STATIC_INLINE void nrf_qspi_cinstrdata_get(NRF_QSPI_Type const * p_reg,
                                                nrf_qspi_cinstr_len_t length,
                                                void *                p_rx_data)
@@ -397,6 +397,27 @@ typedef struct
     bool whiteen;                     /**< Enable or disable packet whitening. */
 } nrf_radio_packet_conf_t;
 
+/**
+ * @brief Snapshot of the RADIO registers that define a protocol configuration.
+ *
+ * The fields hold raw register values, so a snapshot captured with
+ * @ref nrf_radio_config_get can be reapplied without encoding it again.
+ */
+typedef struct
+{
+    uint32_t mode;     /**< Value of the MODE register. */
+    uint32_t pcnf0;    /**< Value of the PCNF0 register. */
+    uint32_t pcnf1;    /**< Value of the PCNF1 register. */
+    uint32_t crccnf;   /**< Value of the CRCCNF register. */
+    uint32_t crcpoly;  /**< Value of the CRCPOLY register. */
+    uint32_t crcinit;  /**< Value of the CRCINIT register. */
+    uint32_t shorts;   /**< Value of the SHORTS register. */
+    uint32_t tifs;     /**< Value of the TIFS register. */
+#if defined(RADIO_MODECNF0_RU_Msk) || defined(__NRFX_DOXYGEN__)
+    uint32_t modecnf0; /**< Value of the MODECNF0 register. */
+#endif
+} nrf_radio_config_t;
+
 #if defined(RADIO_DFEMODE_DFEOPMODE_Msk) || defined(__NRFX_DOXYGEN__)
 /** @brief Direction Finding operation modes. */
 typedef enum
@@ -1383,6 +1404,33 @@ NRF_STATIC_INLINE void nrf_radio_dfe_buffer_set(NRF_RADIO_Type * p_reg,
 NRF_STATIC_INLINE uint32_t nrf_radio_dfe_amount_get(NRF_RADIO_Type const * p_reg);
 #endif
 
+/**
+ * @brief Function for capturing the protocol configuration of the RADIO.
+ *
+ * @param[in]  p_reg    Pointer to the structure of registers of the peripheral.
+ * @param[out] p_config Pointer to the structure to be filled with the register values.
+ */
+NRF_STATIC_INLINE void nrf_radio_config_get(NRF_RADIO_Type const * p_reg,
+                                            nrf_radio_config_t *   p_config);
+
+/**
+ * @brief Function for applying the protocol configuration to the RADIO.
+ *
+ * Only the registers whose values in @p p_config differ from the ones in @p p_shadow
+ * are written. The MODE register is written first, as the remaining ones may depend on it.
+ * When the function returns, @p p_shadow is equal to @p p_config.
+ *
+ * @note @p p_shadow must reflect the current content of the registers, for example
+ *       a snapshot captured right after the peripheral was reset.
+ *
+ * @param[in]     p_reg    Pointer to the structure of registers of the peripheral.
+ * @param[in]     p_config Pointer to the configuration to be applied.
+ * @param[in,out] p_shadow Pointer to the configuration currently held by the peripheral.
+ */
+NRF_STATIC_INLINE void nrf_radio_config_apply(NRF_RADIO_Type *           p_reg,
+                                              nrf_radio_config_t const * p_config,
+                                              nrf_radio_config_t *       p_shadow);
+
 #ifndef NRF_DECLARE_ONLY
 
 NRF_STATIC_INLINE void nrf_radio_task_trigger(NRF_RADIO_Type * p_reg, nrf_radio_task_t task)
@@ -2030,6 +2078,68 @@ NRF_STATIC_INLINE uint32_t nrf_radio_dfe_amount_get(NRF_RADIO_Type const * p_reg
 }
 #endif
 
+NRF_STATIC_INLINE void nrf_radio_config_get(NRF_RADIO_Type const * p_reg,
+                                            nrf_radio_config_t *   p_config)
+{
+    p_config->mode     = p_reg->MODE;
+    p_config->pcnf0    = p_reg->PCNF0;
+    p_config->pcnf1    = p_reg->PCNF1;
+    p_config->crccnf   = p_reg->CRCCNF;
+    p_config->crcpoly  = p_reg->CRCPOLY;
+    p_config->crcinit  = p_reg->CRCINIT;
+    p_config->shorts   = p_reg->SHORTS;
+    p_config->tifs     = p_reg->TIFS;
+#if defined(RADIO_MODECNF0_RU_Msk)
+    p_config->modecnf0 = p_reg->MODECNF0;
+#endif
+}
+
+NRF_STATIC_INLINE void nrf_radio_config_apply(NRF_RADIO_Type *           p_reg,
+                                              nrf_radio_config_t const * p_config,
+                                              nrf_radio_config_t *       p_shadow)
+{
+    if (p_config->mode != p_shadow->mode)
+    {
+        p_reg->MODE = p_config->mode;
+    }
+    if (p_config->pcnf0 != p_shadow->pcnf0)
+    {
+        p_reg->PCNF0 = p_config->pcnf0;
+    }
+    if (p_config->pcnf1 != p_shadow->pcnf1)
+    {
+        p_reg->PCNF1 = p_config->pcnf1;
+    }
+    if (p_config->crccnf != p_shadow->crccnf)
+    {
+        p_reg->CRCCNF = p_config->crccnf;
+    }
+    if (p_config->crcpoly != p_shadow->crcpoly)
+    {
+        p_reg->CRCPOLY = p_config->crcpoly;
+    }
+    if (p_config->crcinit != p_shadow->crcinit)
+    {
+        p_reg->CRCINIT = p_config->crcinit;
+    }
+    if (p_config->shorts != p_shadow->shorts)
+    {
+        p_reg->SHORTS = p_config->shorts;
+    }
+    if (p_config->tifs != p_shadow->tifs)
+    {
+        p_reg->TIFS = p_config->tifs;
+    }
+#if defined(RADIO_MODECNF0_RU_Msk)
+    if (p_config->modecnf0 != p_shadow->modecnf0)
+    {
+        p_reg->MODECNF0 = p_config->modecnf0;
+    }
+#endif
+
+    *p_shadow = *p_config;
+}
+
 #endif // NRF_DECLARE_ONLY
 
 /** @} */
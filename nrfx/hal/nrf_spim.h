@@ -540,6 +540,24 @@ NRF_STATIC_INLINE void nrf_spim_rx_buffer_set(NRF_SPIM_Type * p_reg,
                                               uint8_t *       p_buffer,
                                               size_t          length);
 
+/**
+ * @brief Function for getting the number of bytes transmitted in the last transaction.
+ *
+ * @param[in] p_reg Pointer to the structure of registers of the peripheral.
+ *
+ * @return Number of bytes transmitted.
+ */
+NRF_STATIC_INLINE size_t nrf_spim_tx_amount_get(NRF_SPIM_Type const * p_reg);
+
+/**
+ * @brief Function for getting the number of bytes received in the last transaction.
+ *
+ * @param[in] p_reg Pointer to the structure of registers of the peripheral.
+ *
+ * @return Number of bytes received.
+ */
+NRF_STATIC_INLINE size_t nrf_spim_rx_amount_get(NRF_SPIM_Type const * p_reg);
+
 /**
  * @brief Function for setting the SPI configuration.
  *
@@ -807,6 +825,16 @@ NRF_STATIC_INLINE void nrf_spim_rx_buffer_set(NRF_SPIM_Type * p_reg,
     p_reg->RXD.MAXCNT = length;
 }
 
+NRF_STATIC_INLINE size_t nrf_spim_tx_amount_get(NRF_SPIM_Type const * p_reg)
+{
+    return p_reg->TXD.AMOUNT;
+}
+
+NRF_STATIC_INLINE size_t nrf_spim_rx_amount_get(NRF_SPIM_Type const * p_reg)
+{
+    return p_reg->RXD.AMOUNT;
+}
+
 NRF_STATIC_INLINE void nrf_spim_configure(NRF_SPIM_Type *      p_reg,
                                           nrf_spim_mode_t      spi_mode,
                                           nrf_spim_bit_order_t spi_bit_order)
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx.h>
+#include <helpers/nrfx_binlog.h>
+
+#if NRFX_CHECK(NRFX_BINLOG_ENABLED)
+
+NRFX_STATIC_ASSERT((NRFX_BINLOG_BUFFER_SIZE & (NRFX_BINLOG_BUFFER_SIZE - 1)) == 0);
+
+#define BINLOG_INDEX_MASK (NRFX_BINLOG_BUFFER_SIZE - 1)
+
+/** @brief Ring of the log entries. An entry is complete when its descriptor is set. */
+static nrfx_binlog_entry_t m_entries[NRFX_BINLOG_BUFFER_SIZE];
+
+/** @brief Index of the next entry to be reserved. Never wraps within the ring. */
+static nrfx_atomic_t m_write_idx;
+
+/** @brief Index of the next entry to be taken out. */
+static volatile uint32_t m_read_idx;
+
+/** @brief Number of dropped entries. */
+static nrfx_atomic_t m_dropped;
+
+/** @brief Timestamp source. */
+static nrfx_binlog_timestamp_t m_timestamp;
+
+void nrfx_binlog_init(nrfx_binlog_timestamp_t timestamp)
+{
+    for (uint32_t i = 0; i < NRFX_BINLOG_BUFFER_SIZE; i++)
+    {
+        m_entries[i].p_desc = NULL;
+    }
+
+    m_timestamp = timestamp;
+    m_read_idx  = 0;
+    (void)NRFX_ATOMIC_FETCH_STORE(&m_write_idx, 0);
+    (void)NRFX_ATOMIC_FETCH_STORE(&m_dropped, 0);
+}
+
+void nrfx_binlog_put(nrfx_binlog_desc_t const * p_desc,
+                     uint32_t                   arg0,
+                     uint32_t                   arg1,
+                     uint32_t                   arg2,
+                     uint32_t                   arg3)
+{
+    uint32_t idx;
+
+    // Reserve an entry. A context that preempts this one reserves the next entry,
+    // so entries are never shared.
+    do {
+        idx = m_write_idx;
+        if ((idx - m_read_idx) >= NRFX_BINLOG_BUFFER_SIZE)
+        {
+            (void)NRFX_ATOMIC_FETCH_ADD(&m_dropped, 1);
+            return;
+        }
+    } while (!NRFX_ATOMIC_CAS(&m_write_idx, idx, idx + 1));
+
+    nrfx_binlog_entry_t * p_entry = &m_entries[idx & BINLOG_INDEX_MASK];
+
+    p_entry->timestamp = m_timestamp ? m_timestamp() : 0;
+    p_entry->args[0]   = arg0;
+    p_entry->args[1]   = arg1;
+    p_entry->args[2]   = arg2;
+    p_entry->args[3]   = arg3;
+
+    // Setting the descriptor completes the entry.
+    __DMB();
+    p_entry->p_desc = p_desc;
+}
+
+bool nrfx_binlog_get(nrfx_binlog_entry_t * p_entry)
+{
+    NRFX_ASSERT(p_entry);
+
+    uint32_t              idx     = m_read_idx;
+    nrfx_binlog_entry_t * p_slot  = &m_entries[idx & BINLOG_INDEX_MASK];
+
+    if ((idx == m_write_idx) || (p_slot->p_desc == NULL))
+    {
+        return false;
+    }
+
+    __DMB();
+    p_entry->p_desc    = p_slot->p_desc;
+    p_entry->timestamp = p_slot->timestamp;
+    for (uint32_t i = 0; i < NRFX_BINLOG_ARGS_MAX; i++)
+    {
+        p_entry->args[i] = p_slot->args[i];
+    }
+
+    // Release the entry before it can be reserved again.
+    p_slot->p_desc = NULL;
+    __DMB();
+    m_read_idx = idx + 1;
+    return true;
+}
+
+uint32_t nrfx_binlog_dropped_get_and_clear(void)
+{
+    return NRFX_ATOMIC_FETCH_STORE(&m_dropped, 0);
+}
+
+#endif // NRFX_CHECK(NRFX_BINLOG_ENABLED)
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_BINLOG_H__
+#define NRFX_BINLOG_H__
+
+#include <nrfx.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_binlog Deferred binary logging
+ * @{
+ * @ingroup nrfx
+ * @brief   Logging backend that records binary entries to be decoded on the host.
+ *
+ * Instead of formatting a message, a log call stores a compact entry in a lock-free ring:
+ * the address of a constant descriptor holding the module name, the format string and
+ * the severity level of the call site, a timestamp, and up to four arguments converted
+ * to 32-bit words. Entries can be recorded from any context, including interrupt handlers,
+ * at the cost of a few stores. Entries are dropped when the ring is full.
+ *
+ * The application takes the entries out of the ring with @ref nrfx_binlog_get, when
+ * it has time, and forwards them to the host as they are. The host resolves the descriptor
+ * addresses and the addresses of string arguments using the ELF file of the firmware.
+ * Arguments that are strings must therefore point to constant data, such as @c __func__
+ * or the strings returned by @ref NRFX_LOG_ERROR_STRING_GET. Floating-point arguments
+ * are not supported.
+ *
+ * To use this backend for the driver logs, map the macros of @ref nrfx_log to
+ * @ref NRFX_BINLOG in the nrfx_log.h file of the host environment, for example:
+ * @code
+ * #define NRFX_LOG_ERROR(format, ...) NRFX_BINLOG(NRFX_BINLOG_LEVEL_ERROR, format, ##__VA_ARGS__)
+ * @endcode
+ */
+
+#ifndef NRFX_BINLOG_ENABLED
+/** @brief Symbol specifying whether the binary logging is enabled. */
+#define NRFX_BINLOG_ENABLED 0
+#endif
+
+#ifndef NRFX_BINLOG_BUFFER_SIZE
+/** @brief Number of entries in the ring. Must be a power of 2. */
+#define NRFX_BINLOG_BUFFER_SIZE 64
+#endif
+
+#ifndef NRFX_BINLOG_DESC_ATTR
+/**
+ * @brief Attributes of the call site descriptors.
+ *
+ * Can be used to place the descriptors in a section that is not loaded to the device.
+ */
+#define NRFX_BINLOG_DESC_ATTR
+#endif
+
+/** @brief Maximum number of arguments of a log call. */
+#define NRFX_BINLOG_ARGS_MAX 4
+
+/** @brief Severity levels. */
+typedef enum
+{
+    NRFX_BINLOG_LEVEL_ERROR   = 1, ///< Error.
+    NRFX_BINLOG_LEVEL_WARNING = 2, ///< Warning.
+    NRFX_BINLOG_LEVEL_INFO    = 3, ///< Information.
+    NRFX_BINLOG_LEVEL_DEBUG   = 4, ///< Debug.
+} nrfx_binlog_level_t;
+
+/** @brief Call site descriptor. */
+typedef struct
+{
+    char const * p_module;  ///< Name of the module.
+    char const * p_format;  ///< printf-style format string.
+    uint8_t      level;     ///< Severity level.
+    uint8_t      arg_count; ///< Number of arguments.
+} nrfx_binlog_desc_t;
+
+/** @brief Log entry. */
+typedef struct
+{
+    nrfx_binlog_desc_t const * volatile p_desc;                     ///< Call site descriptor.
+    uint32_t                            timestamp;                  ///< Timestamp of the entry.
+    uint32_t                            args[NRFX_BINLOG_ARGS_MAX]; ///< Arguments.
+} nrfx_binlog_entry_t;
+
+/**
+ * @brief Timestamp source type.
+ *
+ * @return Current timestamp, in units chosen by the application.
+ */
+typedef uint32_t (* nrfx_binlog_timestamp_t)(void);
+
+#ifndef __NRFX_DOXYGEN__
+#define NRFX_BINLOG_ARGS_COUNT(...) \
+    NRFX_BINLOG_ARGS_COUNT_(_, ##__VA_ARGS__, NRFX_BINLOG_TOO_MANY_ARGUMENTS, 4, 3, 2, 1, 0)
+#define NRFX_BINLOG_ARGS_COUNT_(_0, _1, _2, _3, _4, _5, n, ...) n
+
+#define NRFX_BINLOG_ARG(a) ((uint32_t)(uintptr_t)(a))
+#define NRFX_BINLOG_ARGS_0()           0, 0, 0, 0
+#define NRFX_BINLOG_ARGS_1(a)          NRFX_BINLOG_ARG(a), 0, 0, 0
+#define NRFX_BINLOG_ARGS_2(a, b)       NRFX_BINLOG_ARG(a), NRFX_BINLOG_ARG(b), 0, 0
+#define NRFX_BINLOG_ARGS_3(a, b, c)    NRFX_BINLOG_ARG(a), NRFX_BINLOG_ARG(b), \
+                                       NRFX_BINLOG_ARG(c), 0
+#define NRFX_BINLOG_ARGS_4(a, b, c, d) NRFX_BINLOG_ARG(a), NRFX_BINLOG_ARG(b), \
+                                       NRFX_BINLOG_ARG(c), NRFX_BINLOG_ARG(d)
+#define NRFX_BINLOG_ARGS(n, ...)   NRFX_BINLOG_ARGS_(n, __VA_ARGS__)
+#define NRFX_BINLOG_ARGS_(n, ...)  NRFX_BINLOG_ARGS_ ## n(__VA_ARGS__)
+
+#define NRFX_BINLOG_STRINGIFY(x)  NRFX_BINLOG_STRINGIFY_(x)
+#define NRFX_BINLOG_STRINGIFY_(x) #x
+#endif
+
+#if NRFX_CHECK(NRFX_BINLOG_ENABLED) || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Macro for recording a log entry.
+ *
+ * The module name is taken from @c NRFX_LOG_MODULE.
+ *
+ * @param _level  Severity level, one of @ref nrfx_binlog_level_t.
+ * @param _format printf-style format string literal, optionally followed by
+ *                up to @ref NRFX_BINLOG_ARGS_MAX integer or pointer arguments.
+ */
+#define NRFX_BINLOG(_level, _format, ...)                                     \
+do {                                                                          \
+    NRFX_BINLOG_DESC_ATTR static const nrfx_binlog_desc_t binlog_desc =       \
+    {                                                                         \
+        .p_module  = NRFX_BINLOG_STRINGIFY(NRFX_LOG_MODULE),                  \
+        .p_format  = _format,                                                 \
+        .level     = (uint8_t)(_level),                                       \
+        .arg_count = NRFX_BINLOG_ARGS_COUNT(__VA_ARGS__),                     \
+    };                                                                        \
+    nrfx_binlog_put(&binlog_desc,                                             \
+        NRFX_BINLOG_ARGS(NRFX_BINLOG_ARGS_COUNT(__VA_ARGS__), ##__VA_ARGS__)); \
+} while (0)
+#else
+#define NRFX_BINLOG(_level, _format, ...)
+#endif
+
+/**
+ * @brief Function for initializing the binary logging.
+ *
+ * Entries that are in the ring are discarded.
+ *
+ * @param[in] timestamp Timestamp source. If NULL, the timestamps are 0.
+ */
+void nrfx_binlog_init(nrfx_binlog_timestamp_t timestamp);
+
+/**
+ * @brief Function for recording a log entry.
+ *
+ * Prefer using @ref NRFX_BINLOG, which creates the call site descriptor.
+ * This function is lock-free and can be called from any context.
+ *
+ * @param[in] p_desc Pointer to the call site descriptor.
+ * @param[in] arg0   First argument.
+ * @param[in] arg1   Second argument.
+ * @param[in] arg2   Third argument.
+ * @param[in] arg3   Fourth argument.
+ */
+void nrfx_binlog_put(nrfx_binlog_desc_t const * p_desc,
+                     uint32_t                   arg0,
+                     uint32_t                   arg1,
+                     uint32_t                   arg2,
+                     uint32_t                   arg3);
+
+/**
+ * @brief Function for taking the oldest entry out of the ring.
+ *
+ * This function must be called from a single context at a time.
+ *
+ * @param[out] p_entry Pointer to the structure to be filled with the entry.
+ *
+ * @retval true  An entry was taken out of the ring.
+ * @retval false The ring is empty, or the oldest entry is still being recorded.
+ */
+bool nrfx_binlog_get(nrfx_binlog_entry_t * p_entry);
+
+/**
+ * @brief Function for getting and clearing the number of dropped entries.
+ *
+ * @return Number of entries dropped because the ring was full.
+ */
+uint32_t nrfx_binlog_dropped_get_and_clear(void);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_BINLOG_H__
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <nrfx.h>
+
+#if NRFX_CHECK(NRFX_CLOCK_ENABLED) && defined(CLOCK_FEATURE_HFCLK_DIVIDE_PRESENT)
+
+#include <helpers/nrfx_cpufreq.h>
+
+/** @brief Number of pending boost requests. */
+static uint32_t m_boost_requests;
+
+nrfx_err_t nrfx_cpufreq_init(void)
+{
+    nrfx_err_t err_code;
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    m_boost_requests = 0;
+    err_code = nrfx_clock_divider_set(NRF_CLOCK_DOMAIN_HFCLK, NRFX_CPUFREQ_CONFIG_IDLE_DIV);
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    return err_code;
+}
+
+nrfx_err_t nrfx_cpufreq_boost_request(void)
+{
+    nrfx_err_t err_code = NRFX_SUCCESS;
+
+    /* The count and the divider are updated together, so that a release preempting
+     * a request cannot leave the boost divider set with no pending requests. */
+    NRFX_CRITICAL_SECTION_ENTER();
+    if (m_boost_requests == 0)
+    {
+        err_code = nrfx_clock_divider_set(NRF_CLOCK_DOMAIN_HFCLK, NRFX_CPUFREQ_CONFIG_BOOST_DIV);
+    }
+    if (err_code == NRFX_SUCCESS)
+    {
+        m_boost_requests++;
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    return err_code;
+}
+
+void nrfx_cpufreq_boost_release(void)
+{
+    NRFX_CRITICAL_SECTION_ENTER();
+    NRFX_ASSERT(m_boost_requests > 0);
+    if (--m_boost_requests == 0)
+    {
+        nrfx_err_t err_code =
+            nrfx_clock_divider_set(NRF_CLOCK_DOMAIN_HFCLK, NRFX_CPUFREQ_CONFIG_IDLE_DIV);
+        NRFX_ASSERT(err_code == NRFX_SUCCESS);
+        (void)err_code;
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+}
+
+bool nrfx_cpufreq_is_boosted(void)
+{
+    return m_boost_requests > 0;
+}
+
+#endif // NRFX_CHECK(NRFX_CLOCK_ENABLED) && defined(CLOCK_FEATURE_HFCLK_DIVIDE_PRESENT)
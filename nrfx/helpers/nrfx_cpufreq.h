@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef NRFX_CPUFREQ_H__
+#define NRFX_CPUFREQ_H__
+
+#include <nrfx.h>
+#include <nrfx_clock.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_cpufreq CPU frequency policy
+ * @{
+ * @ingroup nrfx
+ * @brief   On-demand scaling of the CPU clock through the HFCLK divider.
+ *
+ * The CPU runs at the idle divider by default. Code that needs more processing power,
+ * for example a signal processing block or a cryptographic operation, surrounds it with
+ * @ref nrfx_cpufreq_boost_request and @ref nrfx_cpufreq_boost_release. The requests are
+ * counted: the first request switches the HFCLK to the boost divider and the last release
+ * switches it back to the idle divider.
+ *
+ * The divider is changed with @ref nrfx_clock_divider_set, so the listeners registered with
+ * @ref nrfx_clock_divider_listener_add are notified about every switch. Code that reads
+ * SystemCoreClock at the time of use, such as @ref nrfx_coredep_delay_us and
+ * the SysTick driver, follows the change without a listener.
+ */
+
+#ifndef NRFX_CPUFREQ_CONFIG_IDLE_DIV
+/** @brief HFCLK divider used when no boost is requested. */
+#define NRFX_CPUFREQ_CONFIG_IDLE_DIV NRF_CLOCK_HFCLK_DIV_2
+#endif
+
+#ifndef NRFX_CPUFREQ_CONFIG_BOOST_DIV
+/** @brief HFCLK divider used while at least one boost is requested. */
+#define NRFX_CPUFREQ_CONFIG_BOOST_DIV NRF_CLOCK_HFCLK_DIV_1
+#endif
+
+/**
+ * @brief Function for initializing the CPU frequency policy.
+ *
+ * Sets the idle divider and clears the pending boost requests.
+ *
+ * @retval NRFX_SUCCESS             The policy was initialized.
+ * @retval NRFX_ERROR_INVALID_PARAM The configured idle divider is not supported.
+ */
+nrfx_err_t nrfx_cpufreq_init(void);
+
+/**
+ * @brief Function for requesting the boost frequency.
+ *
+ * The first pending request switches the HFCLK to the boost divider. The divider listeners
+ * are called from the context of this function.
+ *
+ * @retval NRFX_SUCCESS             The boost frequency is in effect.
+ * @retval NRFX_ERROR_INVALID_PARAM The configured boost divider is not supported.
+ */
+nrfx_err_t nrfx_cpufreq_boost_request(void);
+
+/**
+ * @brief Function for releasing a boost request.
+ *
+ * The release of the last pending request switches the HFCLK back to the idle divider.
+ * Every call must match a successful call to @ref nrfx_cpufreq_boost_request.
+ */
+void nrfx_cpufreq_boost_release(void);
+
+/**
+ * @brief Function for checking whether the boost frequency is in effect.
+ *
+ * @retval true  At least one boost request is pending.
+ * @retval false No boost request is pending.
+ */
+bool nrfx_cpufreq_is_boosted(void);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_CPUFREQ_H__
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <nrfx.h>
+
+#if NRFX_CHECK(NRFX_TIMER_ENABLED) && NRFX_CHECK(NRFX_GPIOTE_ENABLED) && \
+    (defined(PPI_PRESENT) || defined(DPPI_PRESENT))
+
+#include <helpers/nrfx_debounce.h>
+#include <helpers/nrfx_gppi.h>
+
+/** @brief Compare channel that detects the end of the debounce time. */
+#define DEBOUNCE_CC_CHANNEL NRF_TIMER_CC_CHANNEL0
+
+static void timer_event_handler(nrf_timer_event_t event_type, void * p_context)
+{
+    nrfx_debounce_t * p_debounce = (nrfx_debounce_t *)p_context;
+
+    if (event_type != NRF_TIMER_EVENT_COMPARE0)
+    {
+        return;
+    }
+
+    // The timer has been stopped and cleared by the shortcuts. The input may have bounced
+    // back to the reported level, in which case nothing changed.
+    bool state = nrf_gpio_pin_read(p_debounce->pin) ? true : false;
+    if (state != p_debounce->state)
+    {
+        p_debounce->state = state;
+        p_debounce->handler(state, p_debounce->p_context);
+    }
+}
+
+nrfx_err_t nrfx_debounce_init(nrfx_debounce_t *              p_debounce,
+                              nrfx_timer_t const *           p_timer,
+                              nrfx_debounce_config_t const * p_config,
+                              nrfx_debounce_handler_t        handler,
+                              void *                         p_context)
+{
+    NRFX_ASSERT(p_debounce);
+    NRFX_ASSERT(p_timer);
+    NRFX_ASSERT(p_config);
+    NRFX_ASSERT(p_config->debounce_us > 0);
+    NRFX_ASSERT(handler);
+    NRFX_ASSERT(nrfx_gpiote_is_init());
+
+    nrfx_err_t err_code;
+
+    p_debounce->p_timer   = p_timer;
+    p_debounce->handler   = handler;
+    p_debounce->p_context = p_context;
+    p_debounce->pin       = p_config->pin;
+
+    nrfx_timer_config_t timer_config =
+    {
+        .frequency          = NRF_TIMER_FREQ_1MHz,
+        .mode               = NRF_TIMER_MODE_TIMER,
+        .bit_width          = NRF_TIMER_BIT_WIDTH_32,
+        .interrupt_priority = p_config->interrupt_priority,
+        .p_context          = p_debounce,
+    };
+
+    err_code = nrfx_timer_init(p_timer, &timer_config, timer_event_handler);
+    if (err_code != NRFX_SUCCESS)
+    {
+        return err_code;
+    }
+
+    err_code = nrfx_gpiote_channel_alloc(&p_debounce->gpiote_channel);
+    if (err_code != NRFX_SUCCESS)
+    {
+        nrfx_timer_uninit(p_timer);
+        return err_code;
+    }
+
+    err_code = nrfx_gppi_channel_alloc(&p_debounce->ppi_channel);
+    if (err_code != NRFX_SUCCESS)
+    {
+        (void)nrfx_gpiote_channel_free(p_debounce->gpiote_channel);
+        nrfx_timer_uninit(p_timer);
+        return err_code;
+    }
+
+    nrfx_gpiote_input_config_t input_config =
+    {
+        .pull = p_config->pull,
+    };
+    nrfx_gpiote_trigger_config_t trigger_config =
+    {
+        .trigger      = NRFX_GPIOTE_TRIGGER_TOGGLE,
+        .p_in_channel = &p_debounce->gpiote_channel,
+    };
+
+    err_code = nrfx_gpiote_input_configure(p_debounce->pin, &input_config, &trigger_config, NULL);
+    if (err_code != NRFX_SUCCESS)
+    {
+        (void)nrfx_gppi_channel_free(p_debounce->ppi_channel);
+        (void)nrfx_gpiote_channel_free(p_debounce->gpiote_channel);
+        nrfx_timer_uninit(p_timer);
+        return err_code;
+    }
+
+    nrfx_timer_extended_compare(p_timer,
+                                DEBOUNCE_CC_CHANNEL,
+                                nrfx_timer_us_to_ticks(p_timer, p_config->debounce_us),
+                                NRF_TIMER_SHORT_COMPARE0_CLEAR_MASK |
+                                NRF_TIMER_SHORT_COMPARE0_STOP_MASK,
+                                true);
+
+    // Every edge restarts the debounce time from zero.
+    nrfx_gppi_channel_endpoints_setup(p_debounce->ppi_channel,
+                                      nrfx_gpiote_in_event_addr_get(p_debounce->pin),
+                                      nrfx_timer_task_address_get(p_timer,
+                                                                  NRF_TIMER_TASK_CLEAR));
+    nrfx_gppi_fork_endpoint_setup(p_debounce->ppi_channel,
+                                  nrfx_timer_task_address_get(p_timer, NRF_TIMER_TASK_START));
+
+    p_debounce->state = nrf_gpio_pin_read(p_debounce->pin) ? true : false;
+
+    nrfx_gppi_channels_enable(NRFX_BIT(p_debounce->ppi_channel));
+    nrfx_gpiote_trigger_enable(p_debounce->pin, false);
+
+    return NRFX_SUCCESS;
+}
+
+void nrfx_debounce_uninit(nrfx_debounce_t * p_debounce)
+{
+    NRFX_ASSERT(p_debounce);
+
+    nrfx_timer_t const * p_timer = p_debounce->p_timer;
+
+    nrfx_gpiote_trigger_disable(p_debounce->pin);
+
+    nrfx_gppi_channels_disable(NRFX_BIT(p_debounce->ppi_channel));
+    nrfx_gppi_event_endpoint_clear(p_debounce->ppi_channel,
+                                   nrfx_gpiote_in_event_addr_get(p_debounce->pin));
+    nrfx_gppi_task_endpoint_clear(p_debounce->ppi_channel,
+                                  nrfx_timer_task_address_get(p_timer, NRF_TIMER_TASK_CLEAR));
+    nrfx_gppi_fork_endpoint_clear(p_debounce->ppi_channel,
+                                  nrfx_timer_task_address_get(p_timer, NRF_TIMER_TASK_START));
+    (void)nrfx_gppi_channel_free(p_debounce->ppi_channel);
+
+    (void)nrfx_gpiote_pin_uninit(p_debounce->pin);
+    (void)nrfx_gpiote_channel_free(p_debounce->gpiote_channel);
+
+    nrfx_timer_uninit(p_timer);
+}
+
+bool nrfx_debounce_state_get(nrfx_debounce_t const * p_debounce)
+{
+    NRFX_ASSERT(p_debounce);
+
+    return p_debounce->state;
+}
+
+#endif // NRFX_CHECK(NRFX_TIMER_ENABLED) && NRFX_CHECK(NRFX_GPIOTE_ENABLED)
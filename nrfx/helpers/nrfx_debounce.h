@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef NRFX_DEBOUNCE_H__
+#define NRFX_DEBOUNCE_H__
+
+#include <nrfx.h>
+#include <nrfx_gpiote.h>
+#include <nrfx_timer.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_debounce Debounced input
+ * @{
+ * @ingroup nrfx
+ * @brief   Hardware debouncing of a GPIO input with GPIOTE and TIMER.
+ *
+ * Both edges of the input generate a GPIOTE IN event, which is connected over PPI or DPPI
+ * to the CLEAR and START tasks of a TIMER instance. Every bounce restarts the timer, so
+ * its compare event is generated only once the input has been stable for the debounce
+ * time. Only then the CPU is interrupted, the level of the input is read and, if it
+ * differs from the last reported one, passed to the handler. The GPIOTE IN event has
+ * no interrupt enabled, so a noisy input does not cause an interrupt storm.
+ *
+ * The TIMER driver instance and one GPIOTE channel are initialized and owned by the input.
+ * The GPIOTE driver must be initialized.
+ */
+
+/**
+ * @brief Debounced input handler type.
+ *
+ * @param[in] state     Stable level of the input, true if high.
+ * @param[in] p_context User context.
+ */
+typedef void (* nrfx_debounce_handler_t)(bool state, void * p_context);
+
+/** @brief Debounced input configuration structure. */
+typedef struct
+{
+    nrfx_gpiote_pin_t   pin;                ///< Absolute pin number.
+    nrf_gpio_pin_pull_t pull;               ///< Pull configuration of the pin.
+    uint32_t            debounce_us;        ///< Time the input must be stable to be reported, in microseconds.
+    uint8_t             interrupt_priority; ///< Interrupt priority of the TIMER instance.
+} nrfx_debounce_config_t;
+
+/** @brief Debounced input instance structure. */
+typedef struct
+{
+    nrfx_timer_t const *    p_timer;        ///< TIMER driver instance. For internal use only.
+    nrfx_debounce_handler_t handler;        ///< Input handler. For internal use only.
+    void *                  p_context;      ///< User context. For internal use only.
+    nrfx_gpiote_pin_t       pin;            ///< Absolute pin number. For internal use only.
+    uint8_t                 gpiote_channel; ///< GPIOTE channel of the pin. For internal use only.
+    uint8_t                 ppi_channel;    ///< Channel restarting the timer. For internal use only.
+    bool                    state;          ///< Last reported level. For internal use only.
+} nrfx_debounce_t;
+
+/**
+ * @brief Function for initializing and enabling the debounced input.
+ *
+ * @param[out] p_debounce Pointer to the input instance structure.
+ * @param[in]  p_timer    Pointer to the TIMER driver instance, which must not be initialized.
+ * @param[in]  p_config   Pointer to the input configuration.
+ * @param[in]  handler    Input handler. Must not be NULL.
+ * @param[in]  p_context  User context passed to the handler.
+ *
+ * @retval NRFX_SUCCESS             The input was enabled.
+ * @retval NRFX_ERROR_INVALID_STATE The TIMER driver instance is already initialized.
+ * @retval NRFX_ERROR_INVALID_PARAM The pin is already used as a task output.
+ * @retval NRFX_ERROR_NO_MEM        There are not enough available GPIOTE or (D)PPI channels.
+ */
+nrfx_err_t nrfx_debounce_init(nrfx_debounce_t *              p_debounce,
+                              nrfx_timer_t const *           p_timer,
+                              nrfx_debounce_config_t const * p_config,
+                              nrfx_debounce_handler_t        handler,
+                              void *                         p_context);
+
+/**
+ * @brief Function for disabling and uninitializing the debounced input.
+ *
+ * @param[in] p_debounce Pointer to the input instance structure.
+ */
+void nrfx_debounce_uninit(nrfx_debounce_t * p_debounce);
+
+/**
+ * @brief Function for getting the last reported level of the input.
+ *
+ * @param[in] p_debounce Pointer to the input instance structure.
+ *
+ * @retval true  The input is high.
+ * @retval false The input is low.
+ */
+bool nrfx_debounce_state_get(nrfx_debounce_t const * p_debounce);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_DEBOUNCE_H__
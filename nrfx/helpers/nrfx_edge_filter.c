@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx.h>
+
+#if NRFX_CHECK(NRFX_TIMER_ENABLED) && (defined(PPI_PRESENT) || defined(DPPI_PRESENT))
+
+#include <helpers/nrfx_edge_filter.h>
+#include <helpers/nrfx_gppi.h>
+
+/** @brief Compare channel used to detect the count. */
+#define EDGE_FILTER_CC_CHANNEL NRF_TIMER_CC_CHANNEL0
+
+#if NRF_TIMER_HAS_LOW_POWER_MODE
+#define EDGE_FILTER_TIMER_MODE NRF_TIMER_MODE_LOW_POWER_COUNTER
+#else
+#define EDGE_FILTER_TIMER_MODE NRF_TIMER_MODE_COUNTER
+#endif
+
+/** @brief Function for getting the address of the event counted in the current state. */
+static uint32_t counted_event_get(nrfx_edge_filter_t const * p_filter)
+{
+    if ((p_filter->state == NRFX_EDGE_FILTER_STATE_HIGH) && p_filter->down_event_addr)
+    {
+        return p_filter->down_event_addr;
+    }
+    return p_filter->up_event_addr;
+}
+
+static void timer_event_handler(nrf_timer_event_t event_type, void * p_context)
+{
+    nrfx_edge_filter_t * p_filter = (nrfx_edge_filter_t *)p_context;
+
+    if (event_type != NRF_TIMER_EVENT_COMPARE0)
+    {
+        return;
+    }
+
+    // The counter has been cleared by the shortcut. Start counting
+    // the transitions in the opposite direction.
+    if (p_filter->down_event_addr)
+    {
+        nrfx_gppi_event_endpoint_clear(p_filter->count_channel, counted_event_get(p_filter));
+    }
+    p_filter->state = (p_filter->state == NRFX_EDGE_FILTER_STATE_LOW) ?
+                      NRFX_EDGE_FILTER_STATE_HIGH : NRFX_EDGE_FILTER_STATE_LOW;
+    if (p_filter->down_event_addr)
+    {
+        nrfx_gppi_event_endpoint_setup(p_filter->count_channel, counted_event_get(p_filter));
+        nrfx_timer_clear(p_filter->p_timer);
+    }
+
+    p_filter->handler(p_filter->state, p_filter->p_context);
+}
+
+nrfx_err_t nrfx_edge_filter_init(nrfx_edge_filter_t *              p_filter,
+                                 nrfx_timer_t const *              p_timer,
+                                 nrfx_edge_filter_config_t const * p_config,
+                                 nrfx_edge_filter_handler_t        handler,
+                                 void *                            p_context)
+{
+    NRFX_ASSERT(p_filter);
+    NRFX_ASSERT(p_timer);
+    NRFX_ASSERT(p_config);
+    NRFX_ASSERT(p_config->up_event_addr);
+    NRFX_ASSERT(p_config->count > 0);
+    NRFX_ASSERT(handler);
+
+    nrfx_err_t err_code;
+
+    p_filter->p_timer           = p_timer;
+    p_filter->handler           = handler;
+    p_filter->p_context         = p_context;
+    p_filter->up_event_addr     = p_config->up_event_addr;
+    p_filter->down_event_addr   = p_config->down_event_addr;
+    p_filter->window_event_addr = p_config->window_event_addr;
+    p_filter->state             = p_config->initial_state;
+
+    nrfx_timer_config_t timer_config =
+    {
+        .frequency          = NRF_TIMER_FREQ_16MHz,
+        .mode               = EDGE_FILTER_TIMER_MODE,
+        .bit_width          = NRF_TIMER_BIT_WIDTH_16,
+        .interrupt_priority = p_config->interrupt_priority,
+        .p_context          = p_filter,
+    };
+
+    err_code = nrfx_timer_init(p_timer, &timer_config, timer_event_handler);
+    if (err_code != NRFX_SUCCESS)
+    {
+        return err_code;
+    }
+
+    err_code = nrfx_gppi_channel_alloc(&p_filter->count_channel);
+    if (err_code != NRFX_SUCCESS)
+    {
+        nrfx_timer_uninit(p_timer);
+        return err_code;
+    }
+
+    if (p_filter->window_event_addr)
+    {
+        err_code = nrfx_gppi_channel_alloc(&p_filter->window_channel);
+        if (err_code != NRFX_SUCCESS)
+        {
+            (void)nrfx_gppi_channel_free(p_filter->count_channel);
+            nrfx_timer_uninit(p_timer);
+            return err_code;
+        }
+
+        nrfx_gppi_channel_endpoints_setup(p_filter->window_channel,
+                                          p_filter->window_event_addr,
+                                          nrfx_timer_task_address_get(p_timer,
+                                                                      NRF_TIMER_TASK_CLEAR));
+    }
+
+    nrfx_gppi_channel_endpoints_setup(p_filter->count_channel,
+                                      counted_event_get(p_filter),
+                                      nrfx_timer_task_address_get(p_timer,
+                                                                  NRF_TIMER_TASK_COUNT));
+
+    nrfx_timer_extended_compare(p_timer,
+                                EDGE_FILTER_CC_CHANNEL,
+                                p_config->count,
+                                NRF_TIMER_SHORT_COMPARE0_CLEAR_MASK,
+                                true);
+    nrfx_timer_enable(p_timer);
+
+    nrfx_gppi_channels_enable(NRFX_BIT(p_filter->count_channel) |
+                              (p_filter->window_event_addr ?
+                               NRFX_BIT(p_filter->window_channel) : 0));
+    return NRFX_SUCCESS;
+}
+
+void nrfx_edge_filter_uninit(nrfx_edge_filter_t * p_filter)
+{
+    NRFX_ASSERT(p_filter);
+
+    nrfx_timer_t const * p_timer = p_filter->p_timer;
+
+    nrfx_gppi_channels_disable(NRFX_BIT(p_filter->count_channel));
+    nrfx_gppi_event_endpoint_clear(p_filter->count_channel, counted_event_get(p_filter));
+    nrfx_gppi_task_endpoint_clear(p_filter->count_channel,
+                                  nrfx_timer_task_address_get(p_timer, NRF_TIMER_TASK_COUNT));
+    (void)nrfx_gppi_channel_free(p_filter->count_channel);
+
+    if (p_filter->window_event_addr)
+    {
+        nrfx_gppi_channels_disable(NRFX_BIT(p_filter->window_channel));
+        nrfx_gppi_event_endpoint_clear(p_filter->window_channel, p_filter->window_event_addr);
+        nrfx_gppi_task_endpoint_clear(p_filter->window_channel,
+                                      nrfx_timer_task_address_get(p_timer, NRF_TIMER_TASK_CLEAR));
+        (void)nrfx_gppi_channel_free(p_filter->window_channel);
+    }
+
+    nrfx_timer_uninit(p_timer);
+}
+
+nrfx_edge_filter_state_t nrfx_edge_filter_state_get(nrfx_edge_filter_t const * p_filter)
+{
+    NRFX_ASSERT(p_filter);
+
+    return p_filter->state;
+}
+
+#endif // NRFX_CHECK(NRFX_TIMER_ENABLED) && (defined(PPI_PRESENT) || defined(DPPI_PRESENT))
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_EDGE_FILTER_H__
+#define NRFX_EDGE_FILTER_H__
+
+#include <nrfx.h>
+#include <nrfx_timer.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_edge_filter Edge filter
+ * @{
+ * @ingroup nrfx
+ * @brief   Hardware counting of comparator transitions with a hysteresis state machine.
+ *
+ * The filter counts the transition events of a comparator, such as the UP and DOWN events
+ * of COMP or LPCOMP, with a TIMER instance in the counter mode, connected over PPI or DPPI.
+ * The CPU is woken only when the configured number of transitions is counted.
+ * In the meantime, the comparator interrupts can be left disabled.
+ *
+ * The filter has two states. In the low state it counts the transitions to high,
+ * and once the count is reached it switches to the high state and starts counting
+ * the transitions to low, and the other way round. If only one event is configured,
+ * the filter counts it in both states.
+ *
+ * An optional window event, for example a periodic RTC compare event, clears the counter,
+ * so that the transitions must happen within a single window period to be reported.
+ * The windows are consecutive, not sliding, so a burst of transitions that spans
+ * a window boundary is split.
+ *
+ * The TIMER driver instance is initialized and owned by the filter.
+ */
+
+/** @brief Filter states. */
+typedef enum
+{
+    NRFX_EDGE_FILTER_STATE_LOW,  ///< Transitions to high are counted.
+    NRFX_EDGE_FILTER_STATE_HIGH, ///< Transitions to low are counted.
+} nrfx_edge_filter_state_t;
+
+/**
+ * @brief Filter handler type.
+ *
+ * @param[in] state     State that the filter has entered.
+ * @param[in] p_context User context.
+ */
+typedef void (* nrfx_edge_filter_handler_t)(nrfx_edge_filter_state_t state, void * p_context);
+
+/** @brief Filter configuration structure. */
+typedef struct
+{
+    uint32_t                 up_event_addr;      ///< Address of the event of a transition to high.
+    uint32_t                 down_event_addr;    ///< Address of the event of a transition to low,
+                                                 ///< or 0 to count @p up_event_addr in both states.
+    uint32_t                 window_event_addr;  ///< Address of the event that restarts the window, or 0.
+    uint16_t                 count;              ///< Number of transitions reported as one state change.
+    nrfx_edge_filter_state_t initial_state;      ///< Initial state of the filter.
+    uint8_t                  interrupt_priority; ///< Interrupt priority of the TIMER instance.
+} nrfx_edge_filter_config_t;
+
+/** @brief Filter instance structure. */
+typedef struct
+{
+    nrfx_timer_t const *       p_timer;           ///< TIMER driver instance. For internal use only.
+    nrfx_edge_filter_handler_t handler;           ///< Filter handler. For internal use only.
+    void *                     p_context;         ///< User context. For internal use only.
+    uint32_t                   up_event_addr;     ///< Event of a transition to high. For internal use only.
+    uint32_t                   down_event_addr;   ///< Event of a transition to low. For internal use only.
+    uint32_t                   window_event_addr; ///< Event restarting the window. For internal use only.
+    uint8_t                    count_channel;     ///< Channel connected to the COUNT task. For internal use only.
+    uint8_t                    window_channel;    ///< Channel connected to the CLEAR task. For internal use only.
+    nrfx_edge_filter_state_t   state;             ///< Current state. For internal use only.
+} nrfx_edge_filter_t;
+
+/**
+ * @brief Function for initializing and starting the filter.
+ *
+ * @param[out] p_filter  Pointer to the filter instance structure.
+ * @param[in]  p_timer   Pointer to the TIMER driver instance, which must not be initialized.
+ * @param[in]  p_config  Pointer to the filter configuration.
+ * @param[in]  handler   Filter handler. Must not be NULL.
+ * @param[in]  p_context User context passed to the handler.
+ *
+ * @retval NRFX_SUCCESS             The filter was started.
+ * @retval NRFX_ERROR_INVALID_STATE The TIMER driver instance is already initialized.
+ * @retval NRFX_ERROR_NO_MEM        There are not enough available (D)PPI channels.
+ */
+nrfx_err_t nrfx_edge_filter_init(nrfx_edge_filter_t *              p_filter,
+                                 nrfx_timer_t const *              p_timer,
+                                 nrfx_edge_filter_config_t const * p_config,
+                                 nrfx_edge_filter_handler_t        handler,
+                                 void *                            p_context);
+
+/**
+ * @brief Function for stopping and uninitializing the filter.
+ *
+ * @param[in] p_filter Pointer to the filter instance structure.
+ */
+void nrfx_edge_filter_uninit(nrfx_edge_filter_t * p_filter);
+
+/**
+ * @brief Function for getting the current state of the filter.
+ *
+ * @param[in] p_filter Pointer to the filter instance structure.
+ *
+ * @return Current state.
+ */
+nrfx_edge_filter_state_t nrfx_edge_filter_state_get(nrfx_edge_filter_t const * p_filter);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_EDGE_FILTER_H__
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx.h>
+
+#if NRFX_CHECK(NRFX_EGU_ENABLED)
+
+#include <helpers/nrfx_evtbus.h>
+
+#define EVTBUS_WORD_IDX(event_id) ((event_id) / 32)
+#define EVTBUS_BIT_MASK(event_id) (1UL << ((event_id) % 32))
+
+void nrfx_evtbus_init(nrfx_evtbus_t * p_bus, nrfx_evtbus_config_t const * p_config)
+{
+    NRFX_ASSERT(p_bus);
+    NRFX_ASSERT(p_config);
+    NRFX_ASSERT(p_config->p_lanes);
+    NRFX_ASSERT(p_config->p_events);
+    NRFX_ASSERT(p_config->p_pending);
+
+    p_bus->config = *p_config;
+
+    for (size_t i = 0; i < NRFX_EVTBUS_PENDING_WORDS(p_config->event_count); i++)
+    {
+        p_config->p_pending[i] = 0;
+    }
+
+    for (uint16_t id = 0; id < p_config->event_count; id++)
+    {
+        nrfx_evtbus_event_t const * p_event = &p_config->p_events[id];
+
+        NRFX_ASSERT(p_event->handler);
+        NRFX_ASSERT(p_event->lane < p_config->lane_count);
+        NRFX_ASSERT(p_event->channel <
+                    nrf_egu_channel_count(p_config->p_lanes[p_event->lane].p_reg));
+
+        nrfx_egu_int_enable(&p_config->p_lanes[p_event->lane], 1UL << p_event->channel);
+    }
+}
+
+void nrfx_evtbus_uninit(nrfx_evtbus_t * p_bus)
+{
+    NRFX_ASSERT(p_bus);
+
+    nrfx_evtbus_config_t const * p_config = &p_bus->config;
+
+    for (uint16_t id = 0; id < p_config->event_count; id++)
+    {
+        nrfx_evtbus_event_t const * p_event = &p_config->p_events[id];
+
+        nrfx_egu_int_disable(&p_config->p_lanes[p_event->lane], 1UL << p_event->channel);
+    }
+
+    for (size_t i = 0; i < NRFX_EVTBUS_PENDING_WORDS(p_config->event_count); i++)
+    {
+        (void)NRFX_ATOMIC_FETCH_STORE(&p_config->p_pending[i], 0);
+    }
+}
+
+bool nrfx_evtbus_post(nrfx_evtbus_t * p_bus, uint16_t event_id)
+{
+    NRFX_ASSERT(p_bus);
+    NRFX_ASSERT(event_id < p_bus->config.event_count);
+
+    nrfx_evtbus_config_t const * p_config = &p_bus->config;
+    uint32_t                     mask     = EVTBUS_BIT_MASK(event_id);
+
+    if (NRFX_ATOMIC_FETCH_OR(&p_config->p_pending[EVTBUS_WORD_IDX(event_id)], mask) & mask)
+    {
+        return false;
+    }
+
+    nrfx_evtbus_event_t const * p_event = &p_config->p_events[event_id];
+    nrfx_egu_trigger(&p_config->p_lanes[p_event->lane], p_event->channel);
+    return true;
+}
+
+bool nrfx_evtbus_cancel(nrfx_evtbus_t * p_bus, uint16_t event_id)
+{
+    NRFX_ASSERT(p_bus);
+    NRFX_ASSERT(event_id < p_bus->config.event_count);
+
+    uint32_t mask = EVTBUS_BIT_MASK(event_id);
+
+    return (NRFX_ATOMIC_FETCH_AND(&p_bus->config.p_pending[EVTBUS_WORD_IDX(event_id)], ~mask)
+            & mask) != 0;
+}
+
+bool nrfx_evtbus_is_pending(nrfx_evtbus_t const * p_bus, uint16_t event_id)
+{
+    NRFX_ASSERT(p_bus);
+    NRFX_ASSERT(event_id < p_bus->config.event_count);
+
+    return (p_bus->config.p_pending[EVTBUS_WORD_IDX(event_id)] & EVTBUS_BIT_MASK(event_id)) != 0;
+}
+
+void nrfx_evtbus_irq_handler(nrfx_evtbus_t * p_bus, uint8_t lane, uint8_t event_idx)
+{
+    NRFX_ASSERT(p_bus);
+
+    nrfx_evtbus_config_t const * p_config = &p_bus->config;
+
+    for (size_t word = 0; word < NRFX_EVTBUS_PENDING_WORDS(p_config->event_count); word++)
+    {
+        uint32_t pending = p_config->p_pending[word];
+
+        while (pending)
+        {
+            uint16_t                    id      = (uint16_t)(word * 32 + NRF_CTZ(pending));
+            nrfx_evtbus_event_t const * p_event = &p_config->p_events[id];
+            uint32_t                    mask    = EVTBUS_BIT_MASK(id);
+
+            pending &= ~mask;
+            if ((p_event->lane != lane) || (p_event->channel != event_idx))
+            {
+                continue;
+            }
+
+            // The flag is cleared before the handler is called, so the event can be posted
+            // again from the handler or from a context that preempts it.
+            if (NRFX_ATOMIC_FETCH_AND(&p_config->p_pending[word], ~mask) & mask)
+            {
+                p_event->handler(id, p_event->p_context);
+            }
+        }
+    }
+}
+
+#endif // NRFX_CHECK(NRFX_EGU_ENABLED)
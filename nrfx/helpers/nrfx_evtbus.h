@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_EVTBUS_H__
+#define NRFX_EVTBUS_H__
+
+#include <nrfx.h>
+#include <nrfx_egu.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_evtbus Software event bus
+ * @{
+ * @ingroup nrfx
+ * @brief   Deferred execution of logical events on top of the EGU driver.
+ *
+ * The bus maps a static table of logical events onto EGU channels. Posting an event marks it
+ * as pending and triggers its EGU channel, and the handler of the event is then called from
+ * the interrupt handler of the EGU instance. The EGU instances used by the bus are called lanes,
+ * and the interrupt priority of a lane determines the priority at which its events are handled.
+ *
+ * Several events can share a channel. Posting an event that is already pending is coalesced
+ * into a single call of its handler. Events are posted without a critical section and
+ * without any allocation, so they can be posted from any context.
+ *
+ * The EGU driver instances must be initialized by the user, who forwards the events
+ * from the EGU driver handler of each lane to @ref nrfx_evtbus_irq_handler.
+ */
+
+/** @brief Number of words needed to store the pending flags of @p count events. */
+#define NRFX_EVTBUS_PENDING_WORDS(count) (((count) + 31u) / 32u)
+
+/**
+ * @brief Event handler type.
+ *
+ * @param[in] event_id  Identifier of the event, that is its index in the event table.
+ * @param[in] p_context User context registered for the event.
+ */
+typedef void (* nrfx_evtbus_handler_t)(uint16_t event_id, void * p_context);
+
+/** @brief Event descriptor. */
+typedef struct
+{
+    nrfx_evtbus_handler_t handler;   ///< Event handler.
+    void *                p_context; ///< User context passed to the event handler.
+    uint8_t               lane;      ///< Index of the EGU instance in the lane table.
+    uint8_t               channel;   ///< EGU channel triggered when the event is posted.
+} nrfx_evtbus_event_t;
+
+/**
+ * @brief Macro for defining an entry of the event table.
+ *
+ * @param[in] _handler Event handler.
+ * @param[in] _context User context.
+ * @param[in] _lane    Index of the EGU instance in the lane table.
+ * @param[in] _channel EGU channel.
+ */
+#define NRFX_EVTBUS_EVENT(_handler, _context, _lane, _channel) \
+{                                                              \
+    .handler   = _handler,                                     \
+    .p_context = _context,                                     \
+    .lane      = _lane,                                        \
+    .channel   = _channel,                                     \
+}
+
+/** @brief Event bus configuration structure. */
+typedef struct
+{
+    nrfx_egu_t const *          p_lanes;     ///< Table of the EGU driver instances.
+    uint8_t                     lane_count;  ///< Number of the EGU driver instances.
+    nrfx_evtbus_event_t const * p_events;    ///< Table of the events.
+    uint16_t                    event_count; ///< Number of the events.
+    nrfx_atomic_t *             p_pending;   ///< Storage for the pending flags, of size
+                                             ///< @ref NRFX_EVTBUS_PENDING_WORDS(event_count) words.
+} nrfx_evtbus_config_t;
+
+/** @brief Event bus instance structure. */
+typedef struct
+{
+    nrfx_evtbus_config_t config; ///< Configuration of the bus. For internal use only.
+} nrfx_evtbus_t;
+
+/**
+ * @brief Function for initializing the event bus.
+ *
+ * The interrupts of the channels used by the events are enabled in the EGU driver instances.
+ *
+ * @note The EGU driver instances must be initialized before with an event handler
+ *       that forwards the events to @ref nrfx_evtbus_irq_handler.
+ *
+ * @param[out] p_bus    Pointer to the instance structure.
+ * @param[in]  p_config Pointer to the configuration structure. The tables it points to
+ *                      must remain valid as long as the bus is used.
+ */
+void nrfx_evtbus_init(nrfx_evtbus_t * p_bus, nrfx_evtbus_config_t const * p_config);
+
+/**
+ * @brief Function for uninitializing the event bus.
+ *
+ * Pending events are discarded without calling their handlers.
+ *
+ * @param[in] p_bus Pointer to the instance structure.
+ */
+void nrfx_evtbus_uninit(nrfx_evtbus_t * p_bus);
+
+/**
+ * @brief Function for posting an event.
+ *
+ * This function is lock-free and can be called from any context.
+ *
+ * @param[in] p_bus    Pointer to the instance structure.
+ * @param[in] event_id Identifier of the event.
+ *
+ * @retval true  The event was posted.
+ * @retval false The event was already pending and the post was coalesced.
+ */
+bool nrfx_evtbus_post(nrfx_evtbus_t * p_bus, uint16_t event_id);
+
+/**
+ * @brief Function for cancelling a pending event.
+ *
+ * @param[in] p_bus    Pointer to the instance structure.
+ * @param[in] event_id Identifier of the event.
+ *
+ * @retval true  The event was pending and has been cancelled.
+ * @retval false The event was not pending.
+ */
+bool nrfx_evtbus_cancel(nrfx_evtbus_t * p_bus, uint16_t event_id);
+
+/**
+ * @brief Function for checking whether an event is pending.
+ *
+ * @param[in] p_bus    Pointer to the instance structure.
+ * @param[in] event_id Identifier of the event.
+ *
+ * @retval true  The event is pending.
+ * @retval false The event is not pending.
+ */
+bool nrfx_evtbus_is_pending(nrfx_evtbus_t const * p_bus, uint16_t event_id);
+
+/**
+ * @brief Function for handling the EGU events of a lane.
+ *
+ * Call this function from the EGU driver event handler of the lane. The handlers
+ * of all the pending events mapped onto the channel are called in the order of
+ * their identifiers.
+ *
+ * @param[in] p_bus     Pointer to the instance structure.
+ * @param[in] lane      Index of the EGU instance in the lane table.
+ * @param[in] event_idx Index of the EGU event reported to the EGU driver event handler.
+ */
+void nrfx_evtbus_irq_handler(nrfx_evtbus_t * p_bus, uint8_t lane, uint8_t event_idx);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_EVTBUS_H__
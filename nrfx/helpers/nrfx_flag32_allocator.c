@@ -91,3 +91,122 @@ nrfx_err_t nrfx_flag32_free(nrfx_atomic_t * p_mask, uint8_t flag)
 
     return NRFX_SUCCESS;
 }
+
+void nrfx_flagn_init(nrfx_atomic_t * p_masks, uint16_t flag_count)
+{
+    uint16_t words = NRFX_FLAGN_WORDS(flag_count);
+
+    for (uint16_t i = 0; i < words; i++)
+    {
+        uint16_t bits = flag_count - (uint16_t)(i * 32);
+        p_masks[i] = (bits >= 32) ? UINT32_MAX : (NRFX_BIT(bits) - 1);
+    }
+}
+
+bool nrfx_flagn_is_allocated(nrfx_atomic_t const * p_masks, uint16_t flag)
+{
+    return (p_masks[flag / 32] & NRFX_BIT(flag % 32)) ? false : true;
+}
+
+/**
+ * @brief Function for claiming one of the available flags from a single mask word.
+ *
+ * @param[in,out] p_mask  Mask word.
+ * @param[in]     allowed Mask of bits that can be claimed.
+ * @param[in]     lowest  True to claim the lowest available bit, false to claim the highest one.
+ *
+ * @return Position of the claimed bit or -1 if no bit is available.
+ */
+static int8_t nrfx_flagn_word_claim(nrfx_atomic_t * p_mask, uint32_t allowed, bool lowest)
+{
+    int8_t idx;
+    uint32_t prev_mask, avail;
+
+    do {
+        prev_mask = *p_mask;
+        avail = prev_mask & allowed;
+        if (!avail) {
+            return -1;
+        }
+
+        idx = lowest ? (int8_t)NRF_CTZ(avail) : (int8_t)(31 - NRF_CLZ(avail));
+    } while (!NRFX_ATOMIC_CAS(p_mask, prev_mask, prev_mask & ~NRFX_BIT(idx)));
+
+    return idx;
+}
+
+nrfx_err_t nrfx_flagn_alloc(nrfx_atomic_t * p_masks, uint16_t flag_count, uint16_t * p_flag)
+{
+    uint16_t words = NRFX_FLAGN_WORDS(flag_count);
+
+    for (uint16_t i = words; i > 0; i--)
+    {
+        // Skip full words without touching them with CAS.
+        if (!p_masks[i - 1])
+        {
+            continue;
+        }
+
+        int8_t idx = nrfx_flagn_word_claim(&p_masks[i - 1], UINT32_MAX, false);
+        if (idx >= 0)
+        {
+            *p_flag = (uint16_t)((i - 1) * 32 + idx);
+            return NRFX_SUCCESS;
+        }
+    }
+
+    return NRFX_ERROR_NO_MEM;
+}
+
+nrfx_err_t nrfx_flagn_alloc_from(nrfx_atomic_t * p_masks,
+                                 uint16_t        flag_count,
+                                 uint16_t        hint,
+                                 uint16_t *      p_flag)
+{
+    uint16_t words = NRFX_FLAGN_WORDS(flag_count);
+    if (hint >= flag_count)
+    {
+        hint = 0;
+    }
+
+    uint16_t first = hint / 32;
+    uint32_t upper = ~(NRFX_BIT(hint % 32) - 1);
+
+    // The first word is visited twice: once for the bits from the hint upwards
+    // and once more at the end of the search for the bits below the hint.
+    for (uint16_t n = 0; n <= words; n++)
+    {
+        uint16_t i = (uint16_t)((first + n) % words);
+        uint32_t allowed = (n == 0) ? upper : ((n == words) ? ~upper : UINT32_MAX);
+
+        if (p_masks[i] & allowed)
+        {
+            int8_t idx = nrfx_flagn_word_claim(&p_masks[i], allowed, true);
+            if (idx >= 0)
+            {
+                *p_flag = (uint16_t)(i * 32 + idx);
+                return NRFX_SUCCESS;
+            }
+        }
+    }
+
+    return NRFX_ERROR_NO_MEM;
+}
+
+nrfx_err_t nrfx_flagn_free(nrfx_atomic_t * p_masks, uint16_t flag)
+{
+    nrfx_atomic_t * p_mask = &p_masks[flag / 32];
+    uint32_t new_mask, prev_mask;
+
+    if ((NRFX_BIT(flag % 32) & *p_mask))
+    {
+        return NRFX_ERROR_INVALID_PARAM;
+    }
+
+    do {
+        prev_mask = *p_mask;
+        new_mask = prev_mask | NRFX_BIT(flag % 32);
+    } while (!NRFX_ATOMIC_CAS(p_mask, prev_mask, new_mask));
+
+    return NRFX_SUCCESS;
+}
@@ -111,6 +111,89 @@ nrfx_err_t nrfx_flag32_alloc(nrfx_atomic_t * p_mask, uint8_t * p_flag);
  */
 nrfx_err_t nrfx_flag32_free(nrfx_atomic_t * p_mask, uint8_t flag);
 
+/**
+ * @brief Macro for getting the number of mask words needed by the multi-word allocator.
+ *
+ * @param[in] flag_count Number of flags.
+ */
+#define NRFX_FLAGN_WORDS(flag_count) (((flag_count) + 31) / 32)
+
+/**
+ * @brief Function for initializing the multi-word allocator mask with all flags available.
+ *
+ * Flag @c n is represented by bit (n % 32) of the mask word (n / 32).
+ *
+ * @param[out] p_masks    Array of @ref NRFX_FLAGN_WORDS(flag_count) mask words.
+ * @param[in]  flag_count Number of flags.
+ */
+void nrfx_flagn_init(nrfx_atomic_t * p_masks, uint16_t flag_count);
+
+/**
+ * @brief Function for checking if given flag of the multi-word allocator is allocated.
+ *
+ * @note This check may not be valid if context is preempted and state is changed.
+ *
+ * @param[in] p_masks Array of mask words.
+ * @param[in] flag    Flag index.
+ *
+ * @return True if specified flag is allocated, false otherwise.
+ */
+bool nrfx_flagn_is_allocated(nrfx_atomic_t const * p_masks, uint16_t flag);
+
+/**
+ * @brief Function for allocating a flag in the multi-word mask.
+ *
+ * @note Function is thread safe, it uses @ref NRFX_ATOMIC_CAS macro on a single mask word.
+ *       No further synchronization mechanism is needed, provided the macro is properly
+ *       implemented (see @ref nrfx_glue).
+ *
+ * Flags are allocated from the highest index, the same as in @ref nrfx_flag32_alloc.
+ *
+ * @param[in,out] p_masks    Array of mask words. On successful allocation flag is cleared.
+ * @param[in]     flag_count Number of flags.
+ * @param[out]    p_flag     Index of the allocated flag.
+ *
+ * @retval NRFX_SUCCESS      Allocation was successful.
+ * @retval NRFX_ERROR_NO_MEM No resource available.
+ */
+nrfx_err_t nrfx_flagn_alloc(nrfx_atomic_t * p_masks, uint16_t flag_count, uint16_t * p_flag);
+
+/**
+ * @brief Function for allocating the first available flag at or after the given hint.
+ *
+ * The search wraps around to flag 0 if no flag is available from @p hint upwards.
+ * Passing the index following the previously allocated flag as the hint spreads
+ * the allocations evenly across all flags.
+ *
+ * @note Function is thread safe, see @ref nrfx_flagn_alloc.
+ *
+ * @param[in,out] p_masks    Array of mask words. On successful allocation flag is cleared.
+ * @param[in]     flag_count Number of flags.
+ * @param[in]     hint       Index of the flag from which the search starts.
+ * @param[out]    p_flag     Index of the allocated flag.
+ *
+ * @retval NRFX_SUCCESS      Allocation was successful.
+ * @retval NRFX_ERROR_NO_MEM No resource available.
+ */
+nrfx_err_t nrfx_flagn_alloc_from(nrfx_atomic_t * p_masks,
+                                 uint16_t        flag_count,
+                                 uint16_t        hint,
+                                 uint16_t *      p_flag);
+
+/**
+ * @brief Function for freeing a flag allocated with @ref nrfx_flagn_alloc
+ *        or @ref nrfx_flagn_alloc_from.
+ *
+ * @note Function is thread safe, see @ref nrfx_flagn_alloc.
+ *
+ * @param[in,out] p_masks Array of mask words. On successful freeing flag is set.
+ * @param[in]     flag    Flag index.
+ *
+ * @retval NRFX_SUCCESS             Freeing was successful.
+ * @retval NRFX_ERROR_INVALID_PARAM Flag was not allocated.
+ */
+nrfx_err_t nrfx_flagn_free(nrfx_atomic_t * p_masks, uint16_t flag);
+
 /** @} */
 
 #ifdef __cplusplus
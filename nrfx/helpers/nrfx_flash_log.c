@@ -0,0 +1,423 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx.h>
+
+#if NRFX_CHECK(NRFX_NVMC_ENABLED)
+
+#include <helpers/nrfx_flash_log.h>
+#include <string.h>
+
+#define FLASH_LOG_ERASED_WORD UINT32_MAX
+#define FLASH_LOG_PAGE_MAGIC  0x474F4C46UL ///< "FLOG", marks a started page.
+
+/** @brief Page header: magic word, written last, page sequence number, first record number. */
+#define FLASH_LOG_PAGE_MAGIC_OFFSET        0
+#define FLASH_LOG_PAGE_SEQ_OFFSET          4
+#define FLASH_LOG_PAGE_FIRST_RECORD_OFFSET 8
+#define FLASH_LOG_PAGE_HEADER_SIZE         12
+
+/** @brief Record header: data length in bits 15:0 and its inverse in bits 31:16. */
+#define FLASH_LOG_RECORD_HEADER_SIZE 4
+#define FLASH_LOG_RECORD_SEQ_SIZE    4
+#define FLASH_LOG_RECORD_OVERHEAD    (FLASH_LOG_RECORD_HEADER_SIZE + FLASH_LOG_RECORD_SEQ_SIZE)
+
+static uint32_t word_read(uint32_t address)
+{
+    return *(uint32_t const volatile *)address;
+}
+
+static uint32_t padded_length(uint16_t length)
+{
+    return ((uint32_t)length + 3) & ~3UL;
+}
+
+static uint32_t record_size(uint16_t length)
+{
+    return FLASH_LOG_RECORD_OVERHEAD + padded_length(length);
+}
+
+static uint32_t record_header(uint16_t length)
+{
+    return (uint32_t)length | ((uint32_t)(uint16_t)~length << 16);
+}
+
+static bool record_header_decode(uint32_t header, uint16_t * p_length)
+{
+    *p_length = (uint16_t)header;
+    return (header != FLASH_LOG_ERASED_WORD) &&
+           ((uint16_t)(header >> 16) == (uint16_t)~*p_length);
+}
+
+static uint32_t page_address(nrfx_flash_log_t const * p_log, uint32_t page_seq)
+{
+    return p_log->start_address + (page_seq % p_log->page_count) * p_log->page_size;
+}
+
+/** @brief Function for reading the sequence number of a started page at the given index. */
+static bool page_seq_get(nrfx_flash_log_t const * p_log, uint32_t idx, uint32_t * p_seq)
+{
+    uint32_t address = p_log->start_address + idx * p_log->page_size;
+
+    if (word_read(address + FLASH_LOG_PAGE_MAGIC_OFFSET) != FLASH_LOG_PAGE_MAGIC)
+    {
+        return false;
+    }
+
+    *p_seq = word_read(address + FLASH_LOG_PAGE_SEQ_OFFSET);
+    return (*p_seq % p_log->page_count) == idx;
+}
+
+static bool page_is_blank(nrfx_flash_log_t const * p_log, uint32_t address)
+{
+    for (uint32_t offset = 0; offset < p_log->page_size; offset += sizeof(uint32_t))
+    {
+        if (word_read(address + offset) != FLASH_LOG_ERASED_WORD)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void erase_handler(nrfx_nvmc_job_t * p_job, void * p_context)
+{
+    nrfx_flash_log_t * p_log = (nrfx_flash_log_t *)p_context;
+
+    (void)p_job;
+    p_log->erase_pending = false;
+}
+
+/** @brief Function for making sure that the page after the current one gets erased. */
+static void next_page_erase(nrfx_flash_log_t * p_log)
+{
+    uint32_t address = page_address(p_log, p_log->head_seq + 1);
+
+    if (page_is_blank(p_log, address))
+    {
+        p_log->erase_pending = false;
+        return;
+    }
+
+    p_log->erase_pending = true;
+    p_log->erase_job     = (nrfx_nvmc_job_t){
+        .type      = NRFX_NVMC_JOB_ERASE,
+        .address   = address,
+        .count     = 1,
+        .handler   = erase_handler,
+        .p_context = p_log,
+    };
+
+    nrfx_err_t err_code = nrfx_nvmc_job_submit(&p_log->erase_job);
+    NRFX_ASSERT(err_code == NRFX_SUCCESS);
+    (void)err_code;
+}
+
+/** @brief Function for starting an erased page as the current one. */
+static void page_start(nrfx_flash_log_t * p_log, uint32_t page_seq)
+{
+    uint32_t address = page_address(p_log, page_seq);
+
+    nrfx_nvmc_word_write(address + FLASH_LOG_PAGE_SEQ_OFFSET, page_seq);
+    nrfx_nvmc_word_write(address + FLASH_LOG_PAGE_FIRST_RECORD_OFFSET, p_log->record_seq);
+    nrfx_nvmc_word_write(address + FLASH_LOG_PAGE_MAGIC_OFFSET, FLASH_LOG_PAGE_MAGIC);
+
+    p_log->head_seq      = page_seq;
+    p_log->write_address = address + FLASH_LOG_PAGE_HEADER_SIZE;
+}
+
+/** @brief Function for finding the write position and the next record number in the current page. */
+static void head_recover(nrfx_flash_log_t * p_log)
+{
+    uint32_t page       = page_address(p_log, p_log->head_seq);
+    uint32_t end        = page + p_log->page_size;
+    uint32_t address    = page + FLASH_LOG_PAGE_HEADER_SIZE;
+    uint32_t record_seq = word_read(page + FLASH_LOG_PAGE_FIRST_RECORD_OFFSET);
+
+    while (address + FLASH_LOG_RECORD_OVERHEAD <= end)
+    {
+        uint32_t header = word_read(address);
+        uint16_t length;
+
+        if (header == FLASH_LOG_ERASED_WORD)
+        {
+            break;
+        }
+
+        if (!record_header_decode(header, &length) || (address + record_size(length) > end))
+        {
+            // The header was torn. The rest of the page cannot be trusted to be erased.
+            address = end;
+            break;
+        }
+
+        // A record whose number was not written completely is skipped.
+        if (word_read(address + FLASH_LOG_RECORD_HEADER_SIZE + padded_length(length)) ==
+            record_seq)
+        {
+            record_seq++;
+        }
+        address += record_size(length);
+    }
+
+    p_log->write_address = address;
+    p_log->record_seq    = record_seq;
+}
+
+static void data_write(uint32_t address, void const * p_data, uint16_t length)
+{
+    uint8_t const * p_src     = (uint8_t const *)p_data;
+    uint32_t        words     = length / sizeof(uint32_t);
+    uint32_t        remainder = length % sizeof(uint32_t);
+    uint32_t        word;
+
+    if (nrfx_is_word_aligned(p_src))
+    {
+        if (words)
+        {
+            nrfx_nvmc_words_write(address, p_src, words);
+        }
+    }
+    else
+    {
+        for (uint32_t i = 0; i < words; i++)
+        {
+            memcpy(&word, &p_src[i * sizeof(uint32_t)], sizeof(word));
+            nrfx_nvmc_word_write(address + i * sizeof(uint32_t), word);
+        }
+    }
+
+    if (remainder)
+    {
+        word = FLASH_LOG_ERASED_WORD;
+        memcpy(&word, &p_src[words * sizeof(uint32_t)], remainder);
+        nrfx_nvmc_word_write(address + words * sizeof(uint32_t), word);
+    }
+}
+
+nrfx_err_t nrfx_flash_log_init(nrfx_flash_log_t * p_log, nrfx_flash_log_config_t const * p_config)
+{
+    NRFX_ASSERT(p_log);
+    NRFX_ASSERT(p_config);
+
+    uint32_t page_size = nrfx_nvmc_flash_page_size_get();
+    uint32_t seq;
+
+    if (p_config->start_address % page_size)
+    {
+        return NRFX_ERROR_INVALID_ADDR;
+    }
+    if (p_config->page_count < 2)
+    {
+        return NRFX_ERROR_INVALID_PARAM;
+    }
+
+    p_log->start_address = p_config->start_address;
+    p_log->page_size     = page_size;
+    p_log->page_count    = p_config->page_count;
+    p_log->erase_pending = false;
+
+    if (page_seq_get(p_log, 0, &seq))
+    {
+        // Pages from index 0 up to the current one belong to the same lap of the rotation,
+        // so their sequence numbers follow the one of the first page. None of the others does.
+        uint32_t first_seq = seq;
+        uint32_t lo        = 0;
+        uint32_t hi        = p_log->page_count;
+
+        while (hi - lo > 1)
+        {
+            uint32_t mid = lo + (hi - lo) / 2;
+
+            if (page_seq_get(p_log, mid, &seq) && (seq == first_seq + mid))
+            {
+                lo = mid;
+            }
+            else
+            {
+                hi = mid;
+            }
+        }
+
+        p_log->head_seq = first_seq + lo;
+        head_recover(p_log);
+    }
+    else if (page_seq_get(p_log, p_log->page_count - 1, &seq))
+    {
+        // The first page is erased ahead of the last one.
+        p_log->head_seq = seq;
+        head_recover(p_log);
+    }
+    else
+    {
+        // There is no log in the region.
+        if (!page_is_blank(p_log, p_log->start_address))
+        {
+            nrfx_err_t err_code = nrfx_nvmc_page_erase(p_log->start_address);
+            NRFX_ASSERT(err_code == NRFX_SUCCESS);
+            (void)err_code;
+        }
+
+        p_log->record_seq = 0;
+        page_start(p_log, 0);
+    }
+
+    next_page_erase(p_log);
+
+    return NRFX_SUCCESS;
+}
+
+uint16_t nrfx_flash_log_record_size_max_get(nrfx_flash_log_t const * p_log)
+{
+    NRFX_ASSERT(p_log);
+
+    uint32_t size = p_log->page_size - FLASH_LOG_PAGE_HEADER_SIZE - FLASH_LOG_RECORD_OVERHEAD;
+
+    return (uint16_t)NRFX_MIN(size, UINT16_MAX);
+}
+
+nrfx_err_t nrfx_flash_log_append(nrfx_flash_log_t * p_log, void const * p_data, uint16_t length)
+{
+    NRFX_ASSERT(p_log);
+    NRFX_ASSERT(p_data || (length == 0));
+
+    if (length > nrfx_flash_log_record_size_max_get(p_log))
+    {
+        return NRFX_ERROR_INVALID_LENGTH;
+    }
+
+    uint32_t size = record_size(length);
+
+    if (p_log->write_address + size > page_address(p_log, p_log->head_seq) + p_log->page_size)
+    {
+        if (p_log->erase_pending)
+        {
+            return NRFX_ERROR_BUSY;
+        }
+
+        page_start(p_log, p_log->head_seq + 1);
+        next_page_erase(p_log);
+    }
+
+    uint32_t address = p_log->write_address;
+
+    nrfx_nvmc_word_write(address, record_header(length));
+    data_write(address + FLASH_LOG_RECORD_HEADER_SIZE, p_data, length);
+    nrfx_nvmc_word_write(address + FLASH_LOG_RECORD_HEADER_SIZE + padded_length(length),
+                         p_log->record_seq);
+
+    p_log->record_seq++;
+    p_log->write_address += size;
+
+    return NRFX_SUCCESS;
+}
+
+void nrfx_flash_log_iter_init(nrfx_flash_log_t const * p_log, nrfx_flash_log_iter_t * p_iter)
+{
+    NRFX_ASSERT(p_log);
+    NRFX_ASSERT(p_iter);
+
+    // The page after the current one is always erased or about to be.
+    uint32_t kept = p_log->page_count - 2;
+
+    p_iter->page_seq = (p_log->head_seq > kept) ? (p_log->head_seq - kept) : 0;
+    p_iter->address  = 0;
+}
+
+bool nrfx_flash_log_iter_next(nrfx_flash_log_t const * p_log,
+                              nrfx_flash_log_iter_t *   p_iter,
+                              nrfx_flash_log_record_t * p_record)
+{
+    NRFX_ASSERT(p_log);
+    NRFX_ASSERT(p_iter);
+    NRFX_ASSERT(p_record);
+
+    while (p_iter->page_seq <= p_log->head_seq)
+    {
+        uint32_t page = page_address(p_log, p_iter->page_seq);
+        uint32_t seq;
+
+        if (!page_seq_get(p_log, p_iter->page_seq % p_log->page_count, &seq) ||
+            (seq != p_iter->page_seq))
+        {
+            // The page was overwritten or has not been started.
+            p_iter->page_seq++;
+            p_iter->address = 0;
+            continue;
+        }
+
+        if (p_iter->address == 0)
+        {
+            p_iter->address = page + FLASH_LOG_PAGE_HEADER_SIZE;
+        }
+
+        uint32_t limit = (p_iter->page_seq == p_log->head_seq) ? p_log->write_address :
+                                                                 (page + p_log->page_size);
+
+        while (p_iter->address + FLASH_LOG_RECORD_OVERHEAD <= limit)
+        {
+            uint32_t address = p_iter->address;
+            uint16_t length;
+
+            if (!record_header_decode(word_read(address), &length) ||
+                (address + record_size(length) > limit))
+            {
+                break;
+            }
+
+            p_iter->address += record_size(length);
+
+            seq = word_read(address + FLASH_LOG_RECORD_HEADER_SIZE + padded_length(length));
+            if (seq != FLASH_LOG_ERASED_WORD)
+            {
+                p_record->seq    = seq;
+                p_record->p_data = (void const *)(address + FLASH_LOG_RECORD_HEADER_SIZE);
+                p_record->length = length;
+                return true;
+            }
+        }
+
+        if (p_iter->page_seq == p_log->head_seq)
+        {
+            // Keep the position, so that records appended later are read by the next call.
+            break;
+        }
+
+        p_iter->page_seq++;
+        p_iter->address = 0;
+    }
+
+    return false;
+}
+
+#endif // NRFX_CHECK(NRFX_NVMC_ENABLED)
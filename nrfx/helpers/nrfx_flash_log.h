@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_FLASH_LOG_H__
+#define NRFX_FLASH_LOG_H__
+
+#include <nrfx.h>
+#include <nrfx_nvmc.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_flash_log Flash log store
+ * @{
+ * @ingroup nrfx_nvmc
+ * @brief   Append-only circular log of records in the internal flash.
+ *
+ * The log occupies a number of consecutive flash pages that are written in rotation.
+ * Each page starts with a header holding the page sequence number, and the page with
+ * sequence number @c s is always placed at index <tt>s % page_count</tt> of the region.
+ * Because of that, the page that is currently written is found at initialization with
+ * a binary search over the page headers, instead of a scan of the whole region. Only
+ * the records of that page are walked to find the write position.
+ *
+ * Records are word-aligned. Each one consists of a length word, the data padded with
+ * 0xFF bytes to a multiple of 4, and a record sequence number that is written last,
+ * so that a record torn by a reset is recognized and skipped.
+ *
+ * Appending takes a time proportional to the record length only. When a page is full,
+ * the next one, which is already erased, is started and the erase of the page after it,
+ * holding the oldest records, is submitted to the NVMC job engine, so it proceeds in
+ * the background as @ref nrfx_nvmc_job_process is called. The records of
+ * <tt>page_count - 1</tt> pages are thus kept.
+ *
+ * The functions of the module must not be called from multiple contexts at a time.
+ */
+
+/** @brief Flash log configuration structure. */
+typedef struct
+{
+    uint32_t start_address; ///< Address of the first page of the log. Must be page-aligned.
+    uint32_t page_count;    ///< Number of pages of the log. At least 2.
+} nrfx_flash_log_config_t;
+
+/** @brief Flash log instance. All fields are for internal use only. */
+typedef struct
+{
+    uint32_t        start_address; ///< Address of the first page of the log.
+    uint32_t        page_size;     ///< Size of a flash page.
+    uint32_t        page_count;    ///< Number of pages of the log.
+    uint32_t        head_seq;      ///< Sequence number of the page that is currently written.
+    uint32_t        write_address; ///< Address at which the next record is written.
+    uint32_t        record_seq;    ///< Sequence number of the next record.
+    nrfx_nvmc_job_t erase_job;     ///< Job erasing the page after the current one.
+    volatile bool   erase_pending; ///< True if the page after the current one is not erased yet.
+} nrfx_flash_log_t;
+
+/** @brief Structure describing a record read from the log. */
+typedef struct
+{
+    uint32_t     seq;    ///< Sequence number of the record.
+    void const * p_data; ///< Pointer to the record data in flash.
+    uint16_t     length; ///< Length of the record data in bytes.
+} nrfx_flash_log_record_t;
+
+/** @brief Iterator over the records of the log. All fields are for internal use only. */
+typedef struct
+{
+    uint32_t page_seq; ///< Sequence number of the iterated page.
+    uint32_t address;  ///< Address of the next record to be read, or 0 if the page is not started.
+} nrfx_flash_log_iter_t;
+
+/**
+ * @brief Function for initializing the log and recovering its state from flash.
+ *
+ * If the region holds no log, a new one is started. If the page after the current one
+ * is not erased, its erase is submitted to the NVMC job engine.
+ *
+ * @param[out] p_log    Pointer to the log instance.
+ * @param[in]  p_config Pointer to the configuration.
+ *
+ * @retval NRFX_SUCCESS             The log was initialized.
+ * @retval NRFX_ERROR_INVALID_ADDR  The start address is not page-aligned.
+ * @retval NRFX_ERROR_INVALID_PARAM The log has less than 2 pages.
+ */
+nrfx_err_t nrfx_flash_log_init(nrfx_flash_log_t * p_log, nrfx_flash_log_config_t const * p_config);
+
+/**
+ * @brief Function for appending a record to the log.
+ *
+ * @param[in] p_log  Pointer to the log instance.
+ * @param[in] p_data Pointer to the record data. Does not need to be word-aligned.
+ * @param[in] length Length of the record data in bytes, not greater than the value returned
+ *                   by @ref nrfx_flash_log_record_size_max_get.
+ *
+ * @retval NRFX_SUCCESS              The record was written.
+ * @retval NRFX_ERROR_INVALID_LENGTH The record does not fit in a page.
+ * @retval NRFX_ERROR_BUSY           The current page is full and the next one is still
+ *                                   being erased. Call @ref nrfx_nvmc_job_process and retry.
+ */
+nrfx_err_t nrfx_flash_log_append(nrfx_flash_log_t * p_log, void const * p_data, uint16_t length);
+
+/**
+ * @brief Function for getting the maximum length of the record data.
+ *
+ * @param[in] p_log Pointer to the log instance.
+ *
+ * @return Maximum length of the record data in bytes.
+ */
+uint16_t nrfx_flash_log_record_size_max_get(nrfx_flash_log_t const * p_log);
+
+/**
+ * @brief Function for initializing the iterator at the oldest record of the log.
+ *
+ * @param[in]  p_log  Pointer to the log instance.
+ * @param[out] p_iter Pointer to the iterator.
+ */
+void nrfx_flash_log_iter_init(nrfx_flash_log_t const * p_log, nrfx_flash_log_iter_t * p_iter);
+
+/**
+ * @brief Function for reading the next record of the log.
+ *
+ * Records are read from the oldest one. Records appended while iterating are read too.
+ *
+ * @param[in]     p_log    Pointer to the log instance.
+ * @param[in,out] p_iter   Pointer to the iterator.
+ * @param[out]    p_record Pointer to the structure to be filled with the record.
+ *
+ * @retval true  A record was read.
+ * @retval false There are no more records.
+ */
+bool nrfx_flash_log_iter_next(nrfx_flash_log_t const * p_log,
+                              nrfx_flash_log_iter_t *   p_iter,
+                              nrfx_flash_log_record_t * p_record);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_FLASH_LOG_H__
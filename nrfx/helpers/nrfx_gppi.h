@@ -172,6 +172,31 @@ typedef enum
 } nrfx_gppi_task_t;
 #endif // defined(__NRFX_DOXYGEN__)
 
+/** @brief Maximum number of channel groups in a connection set. */
+#define NRFX_GPPI_SET_GROUPS_MAX 6
+
+/** @brief Connection between an event and one or two tasks, forming a part of a connection set. */
+typedef struct
+{
+    uint32_t eep;        ///< Address of the event register.
+    uint32_t tep;        ///< Address of the task register.
+    uint32_t fork_tep;   ///< Address of the additional task register, or 0 if not used.
+    uint8_t  group_mask; ///< Mask of groups of the set that the channel is to be included in.
+                         /**< Bit @c n corresponds to the group stored at index @c n
+                          *   in @ref nrfx_gppi_set_t::groups. */
+} nrfx_gppi_connection_t;
+
+/** @brief Connection set structure. */
+typedef struct
+{
+    nrfx_gppi_connection_t const * p_connections;    ///< Array of connections.
+    uint8_t *                      p_channels;       ///< Array that receives the channel allocated for each connection.
+    uint8_t                        connection_count; ///< Number of connections.
+    uint8_t                        group_count;      ///< Number of channel groups to be allocated.
+    nrfx_gppi_channel_group_t      groups[NRFX_GPPI_SET_GROUPS_MAX]; ///< Allocated channel groups. Set by the helper.
+    uint32_t                       channel_mask;     ///< Mask of allocated channels. Set by the helper.
+} nrfx_gppi_set_t;
+
 /**
  * @brief Function for checking if a given channel is enabled.
  *
@@ -395,6 +420,43 @@ __STATIC_INLINE nrfx_err_t nrfx_gppi_group_alloc(nrfx_gppi_channel_group_t * p_g
  * @retval NRFX_ERROR_NOT_SUPPORTED Driver is not enabled.
  */
 __STATIC_INLINE nrfx_err_t nrfx_gppi_group_free(nrfx_gppi_channel_group_t group);
+
+/**
+ * @brief Function for allocating and configuring all channels and groups of a connection set.
+ *
+ * The operation is all-or-nothing: if any channel or group cannot be allocated,
+ * all resources allocated so far are freed and no endpoint is configured.
+ * The channels of the set are left disabled.
+ *
+ * @param[in,out] p_set Pointer to the connection set with the input fields filled in.
+ *
+ * @retval NRFX_SUCCESS             The connection set was configured.
+ * @retval NRFX_ERROR_NO_MEM        There are not enough available channels or groups.
+ * @retval NRFX_ERROR_NOT_SUPPORTED Driver is not enabled.
+ */
+__STATIC_INLINE nrfx_err_t nrfx_gppi_set_setup(nrfx_gppi_set_t * p_set);
+
+/**
+ * @brief Function for enabling all channels of a connection set with a single register write.
+ *
+ * @param[in] p_set Pointer to the configured connection set.
+ */
+__STATIC_INLINE void nrfx_gppi_set_enable(nrfx_gppi_set_t const * p_set);
+
+/**
+ * @brief Function for disabling all channels of a connection set with a single register write.
+ *
+ * @param[in] p_set Pointer to the configured connection set.
+ */
+__STATIC_INLINE void nrfx_gppi_set_disable(nrfx_gppi_set_t const * p_set);
+
+/**
+ * @brief Function for disabling a connection set, clearing its endpoints,
+ *        and freeing its channels and groups.
+ *
+ * @param[in,out] p_set Pointer to the configured connection set.
+ */
+__STATIC_INLINE void nrfx_gppi_set_release(nrfx_gppi_set_t * p_set);
 /** @} */
 
 #if defined(PPI_PRESENT)
@@ -712,6 +774,131 @@ __STATIC_INLINE nrfx_err_t nrfx_gppi_group_free(nrfx_gppi_channel_group_t group)
 #error "Neither PPI nor DPPI is present in the SoC currently in use."
 #endif
 
+__STATIC_INLINE void nrfx_gppi_set_resources_free(nrfx_gppi_set_t * p_set,
+                                                  uint8_t           channel_count,
+                                                  uint8_t           group_count)
+{
+    while (channel_count)
+    {
+        (void)nrfx_gppi_channel_free(p_set->p_channels[--channel_count]);
+    }
+    while (group_count)
+    {
+        (void)nrfx_gppi_group_free(p_set->groups[--group_count]);
+    }
+    p_set->channel_mask = 0;
+}
+
+__STATIC_INLINE nrfx_err_t nrfx_gppi_set_setup(nrfx_gppi_set_t * p_set)
+{
+    NRFX_ASSERT(p_set);
+    NRFX_ASSERT(p_set->p_connections);
+    NRFX_ASSERT(p_set->p_channels);
+    NRFX_ASSERT(p_set->group_count <= NRFX_GPPI_SET_GROUPS_MAX);
+
+    nrfx_err_t err_code = NRFX_SUCCESS;
+    uint8_t    groups   = 0;
+    uint8_t    channels = 0;
+
+    // Allocate everything first, so that nothing is configured if the set does not fit.
+    for (; groups < p_set->group_count; groups++)
+    {
+        err_code = nrfx_gppi_group_alloc(&p_set->groups[groups]);
+        if (err_code != NRFX_SUCCESS)
+        {
+            nrfx_gppi_set_resources_free(p_set, channels, groups);
+            return err_code;
+        }
+    }
+    for (; channels < p_set->connection_count; channels++)
+    {
+        uint8_t channel;
+
+        err_code = nrfx_gppi_channel_alloc(&channel);
+        if (err_code != NRFX_SUCCESS)
+        {
+            nrfx_gppi_set_resources_free(p_set, channels, groups);
+            return err_code;
+        }
+        p_set->p_channels[channels] = channel;
+    }
+
+    uint32_t group_masks[NRFX_GPPI_SET_GROUPS_MAX] = {0};
+
+    p_set->channel_mask = 0;
+    for (uint8_t i = 0; i < p_set->connection_count; i++)
+    {
+        nrfx_gppi_connection_t const * p_conn  = &p_set->p_connections[i];
+        uint8_t                        channel = p_set->p_channels[i];
+
+        nrfx_gppi_channel_endpoints_setup(channel, p_conn->eep, p_conn->tep);
+        if (p_conn->fork_tep)
+        {
+#if defined(PPI_FEATURE_FORKS_PRESENT) || defined(DPPI_PRESENT)
+            nrfx_gppi_fork_endpoint_setup(channel, p_conn->fork_tep);
+#else
+            NRFX_ASSERT(false);
+#endif
+        }
+        for (uint8_t g = 0; g < p_set->group_count; g++)
+        {
+            if (p_conn->group_mask & NRFX_BIT(g))
+            {
+                group_masks[g] |= NRFX_BIT(channel);
+            }
+        }
+        p_set->channel_mask |= NRFX_BIT(channel);
+    }
+
+    // Each group is configured with a single register write.
+    for (uint8_t g = 0; g < p_set->group_count; g++)
+    {
+        nrfx_gppi_group_clear(p_set->groups[g]);
+        nrfx_gppi_channels_include_in_group(group_masks[g], p_set->groups[g]);
+    }
+
+    return NRFX_SUCCESS;
+}
+
+__STATIC_INLINE void nrfx_gppi_set_enable(nrfx_gppi_set_t const * p_set)
+{
+    NRFX_ASSERT(p_set);
+    nrfx_gppi_channels_enable(p_set->channel_mask);
+}
+
+__STATIC_INLINE void nrfx_gppi_set_disable(nrfx_gppi_set_t const * p_set)
+{
+    NRFX_ASSERT(p_set);
+    nrfx_gppi_channels_disable(p_set->channel_mask);
+}
+
+__STATIC_INLINE void nrfx_gppi_set_release(nrfx_gppi_set_t * p_set)
+{
+    NRFX_ASSERT(p_set);
+
+    nrfx_gppi_channels_disable(p_set->channel_mask);
+    for (uint8_t g = 0; g < p_set->group_count; g++)
+    {
+        nrfx_gppi_group_disable(p_set->groups[g]);
+        nrfx_gppi_group_clear(p_set->groups[g]);
+    }
+    for (uint8_t i = 0; i < p_set->connection_count; i++)
+    {
+        nrfx_gppi_connection_t const * p_conn  = &p_set->p_connections[i];
+        uint8_t                        channel = p_set->p_channels[i];
+
+        nrfx_gppi_event_endpoint_clear(channel, p_conn->eep);
+        nrfx_gppi_task_endpoint_clear(channel, p_conn->tep);
+#if defined(PPI_FEATURE_FORKS_PRESENT) || defined(DPPI_PRESENT)
+        if (p_conn->fork_tep)
+        {
+            nrfx_gppi_fork_endpoint_clear(channel, p_conn->fork_tep);
+        }
+#endif
+    }
+    nrfx_gppi_set_resources_free(p_set, p_set->connection_count, p_set->group_count);
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx.h>
+
+#if NRFX_CHECK(NRFX_CLOCK_ENABLED) && NRFX_CHECK(NRFX_RTC_ENABLED)
+
+#include <helpers/nrfx_hfclk_prestart.h>
+
+static void hfclk_request(nrfx_hfclk_prestart_t * p_prestart)
+{
+    if (NRFX_ATOMIC_FETCH_STORE(&p_prestart->requested, 1) == 0)
+    {
+        nrfx_clock_hfclk_request();
+    }
+}
+
+static void prestart_alarm_handler(nrfx_rtc_ext_alarm_t * p_alarm, uint64_t now)
+{
+    (void)now;
+    hfclk_request((nrfx_hfclk_prestart_t *)p_alarm->p_context);
+}
+
+void nrfx_hfclk_prestart_init(nrfx_hfclk_prestart_t * p_prestart,
+                              nrfx_rtc_ext_t *        p_ext,
+                              uint32_t                startup_ticks)
+{
+    NRFX_ASSERT(p_prestart);
+    NRFX_ASSERT(p_ext);
+
+    p_prestart->p_ext         = p_ext;
+    p_prestart->startup_ticks = startup_ticks;
+    p_prestart->requested     = 0;
+    nrfx_rtc_ext_alarm_init(&p_prestart->alarm, prestart_alarm_handler, p_prestart);
+}
+
+nrfx_err_t nrfx_hfclk_prestart_schedule(nrfx_hfclk_prestart_t * p_prestart, uint64_t deadline)
+{
+    NRFX_ASSERT(p_prestart);
+
+    if (p_prestart->requested)
+    {
+        return NRFX_SUCCESS;
+    }
+
+    if (deadline > p_prestart->startup_ticks &&
+        nrfx_rtc_ext_alarm_start(p_prestart->p_ext,
+                                 &p_prestart->alarm,
+                                 deadline - p_prestart->startup_ticks) == NRFX_SUCCESS)
+    {
+        return NRFX_SUCCESS;
+    }
+
+    // The request time has already passed. Cancel the previously scheduled request,
+    // if any, and start the oscillator right away.
+    (void)nrfx_rtc_ext_alarm_stop(p_prestart->p_ext, &p_prestart->alarm);
+    hfclk_request(p_prestart);
+
+    return (nrfx_rtc_ext_time_get(p_prestart->p_ext) + p_prestart->startup_ticks > deadline) ?
+           NRFX_ERROR_TIMEOUT : NRFX_SUCCESS;
+}
+
+void nrfx_hfclk_prestart_release(nrfx_hfclk_prestart_t * p_prestart)
+{
+    NRFX_ASSERT(p_prestart);
+
+    (void)nrfx_rtc_ext_alarm_stop(p_prestart->p_ext, &p_prestart->alarm);
+
+    if (NRFX_ATOMIC_FETCH_STORE(&p_prestart->requested, 0) != 0)
+    {
+        nrfx_clock_hfclk_release();
+    }
+}
+
+#endif // NRFX_CHECK(NRFX_CLOCK_ENABLED) && NRFX_CHECK(NRFX_RTC_ENABLED)
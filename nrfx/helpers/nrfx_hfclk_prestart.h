@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_HFCLK_PRESTART_H__
+#define NRFX_HFCLK_PRESTART_H__
+
+#include <nrfx.h>
+#include <nrfx_clock.h>
+#include <helpers/nrfx_rtc_ext.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_hfclk_prestart HFCLK deadline-based prestart
+ * @{
+ * @ingroup nrfx
+ * @brief   Scheduling of HFCLK requests so that the crystal oscillator is stable at a given time.
+ *
+ * Each user of the crystal oscillator (for example the radio protocol stack) owns one
+ * prestart structure. The user schedules the time at which the oscillator must be stable
+ * and the helper issues @ref nrfx_clock_hfclk_request in advance, taking the oscillator startup
+ * time into account. The request is held until the user releases it, so the oscillator
+ * is not stopped and restarted between closely spaced activities of different users.
+ *
+ * The timing is based on the @ref nrfx_rtc_ext layer, which must be initialized by the user.
+ */
+
+/** @brief HFCLK prestart structure. */
+typedef struct
+{
+    nrfx_rtc_ext_t *     p_ext;         ///< Extended RTC time instance. For internal use only.
+    nrfx_rtc_ext_alarm_t alarm;         ///< Alarm that issues the request. For internal use only.
+    uint32_t             startup_ticks; ///< Oscillator startup time in RTC ticks. For internal use only.
+    nrfx_atomic_t        requested;     ///< Non-zero if HFCLK is requested. For internal use only.
+} nrfx_hfclk_prestart_t;
+
+/**
+ * @brief Function for initializing the HFCLK prestart structure.
+ *
+ * @param[out] p_prestart    Pointer to the prestart structure.
+ * @param[in]  p_ext         Pointer to the initialized extended RTC time instance.
+ * @param[in]  startup_ticks Worst-case startup time of the crystal oscillator in RTC ticks,
+ *                           including the interrupt latency of the RTC handler.
+ */
+void nrfx_hfclk_prestart_init(nrfx_hfclk_prestart_t * p_prestart,
+                              nrfx_rtc_ext_t *        p_ext,
+                              uint32_t                startup_ticks);
+
+/**
+ * @brief Function for scheduling HFCLK so that it is stable at the specified time.
+ *
+ * If a previously scheduled request has not been issued yet, it is rescheduled.
+ * If HFCLK is already requested by this user, the request is kept and nothing is scheduled.
+ *
+ * @param[in] p_prestart Pointer to the prestart structure.
+ * @param[in] deadline   Absolute time, in ticks of @ref nrfx_rtc_ext_time_get, at which
+ *                       HFCLK must be stable.
+ *
+ * @retval NRFX_SUCCESS       HFCLK is scheduled or already requested.
+ * @retval NRFX_ERROR_TIMEOUT The deadline is too close to be met. HFCLK was requested
+ *                            immediately and it will become stable after the deadline.
+ */
+nrfx_err_t nrfx_hfclk_prestart_schedule(nrfx_hfclk_prestart_t * p_prestart, uint64_t deadline);
+
+/**
+ * @brief Function for releasing HFCLK.
+ *
+ * The scheduled request is cancelled if it has not been issued yet. Otherwise,
+ * the request is released using @ref nrfx_clock_hfclk_release.
+ *
+ * @param[in] p_prestart Pointer to the prestart structure.
+ */
+void nrfx_hfclk_prestart_release(nrfx_hfclk_prestart_t * p_prestart);
+
+/**
+ * @brief Function for checking if HFCLK is requested by the specified user.
+ *
+ * @param[in] p_prestart Pointer to the prestart structure.
+ *
+ * @retval true  HFCLK is requested. It may still be starting.
+ * @retval false HFCLK is not requested yet or it was released.
+ */
+__STATIC_INLINE bool nrfx_hfclk_prestart_is_requested(nrfx_hfclk_prestart_t const * p_prestart)
+{
+    return (p_prestart->requested != 0);
+}
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_HFCLK_PRESTART_H__
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <nrfx.h>
+
+#if NRFX_CHECK(NRFX_DPPI_ENABLED) && defined(IPC_PRESENT)
+
+#include <helpers/nrfx_ipc_link.h>
+#include <helpers/nrfx_gppi.h>
+
+/** @brief Function for getting the address of the SEND task or the RECEIVE event of the link. */
+static uint32_t ipc_endpoint_get(nrfx_ipc_link_t const * p_link)
+{
+    return p_link->source ?
+           nrf_ipc_task_address_get(NRF_IPC, nrf_ipc_send_task_get(p_link->ipc_channel)) :
+           nrf_ipc_event_address_get(NRF_IPC, nrf_ipc_receive_event_get(p_link->ipc_channel));
+}
+
+static nrfx_err_t link_init(nrfx_ipc_link_t * p_link,
+                            uint8_t           ipc_channel,
+                            uint32_t          endpoint,
+                            bool              source)
+{
+    NRFX_ASSERT(p_link);
+    NRFX_ASSERT(endpoint);
+
+    if ((ipc_channel >= IPC_CH_NUM) || (ipc_channel >= IPC_CONF_NUM))
+    {
+        return NRFX_ERROR_INVALID_PARAM;
+    }
+
+    uint32_t config = source ? nrf_ipc_send_config_get(NRF_IPC, ipc_channel) :
+                               nrf_ipc_receive_config_get(NRF_IPC, ipc_channel);
+
+    if (config != 0)
+    {
+        return NRFX_ERROR_BUSY;
+    }
+
+    nrfx_err_t err = nrfx_gppi_channel_alloc(&p_link->dppi_channel);
+
+    if (err != NRFX_SUCCESS)
+    {
+        return err;
+    }
+
+    p_link->endpoint    = endpoint;
+    p_link->ipc_channel = ipc_channel;
+    p_link->source      = source;
+
+    if (source)
+    {
+        nrf_ipc_send_config_set(NRF_IPC, ipc_channel, NRFX_BIT(ipc_channel));
+        nrfx_gppi_channel_endpoints_setup(p_link->dppi_channel, endpoint, ipc_endpoint_get(p_link));
+    }
+    else
+    {
+        nrf_ipc_receive_config_set(NRF_IPC, ipc_channel, NRFX_BIT(ipc_channel));
+        nrfx_gppi_channel_endpoints_setup(p_link->dppi_channel, ipc_endpoint_get(p_link), endpoint);
+    }
+
+    return NRFX_SUCCESS;
+}
+
+nrfx_err_t nrfx_ipc_link_source_init(nrfx_ipc_link_t * p_link,
+                                     uint8_t           ipc_channel,
+                                     uint32_t          event_address)
+{
+    return link_init(p_link, ipc_channel, event_address, true);
+}
+
+nrfx_err_t nrfx_ipc_link_sink_init(nrfx_ipc_link_t * p_link,
+                                   uint8_t           ipc_channel,
+                                   uint32_t          task_address)
+{
+    return link_init(p_link, ipc_channel, task_address, false);
+}
+
+void nrfx_ipc_link_enable(nrfx_ipc_link_t const * p_link)
+{
+    NRFX_ASSERT(p_link);
+
+    nrfx_gppi_channels_enable(NRFX_BIT(p_link->dppi_channel));
+}
+
+void nrfx_ipc_link_disable(nrfx_ipc_link_t const * p_link)
+{
+    NRFX_ASSERT(p_link);
+
+    nrfx_gppi_channels_disable(NRFX_BIT(p_link->dppi_channel));
+}
+
+void nrfx_ipc_link_uninit(nrfx_ipc_link_t * p_link)
+{
+    NRFX_ASSERT(p_link);
+
+    nrfx_ipc_link_disable(p_link);
+
+    if (p_link->source)
+    {
+        nrfx_gppi_event_endpoint_clear(p_link->dppi_channel, p_link->endpoint);
+        nrfx_gppi_task_endpoint_clear(p_link->dppi_channel, ipc_endpoint_get(p_link));
+        nrf_ipc_send_config_set(NRF_IPC, p_link->ipc_channel, 0);
+    }
+    else
+    {
+        nrfx_gppi_event_endpoint_clear(p_link->dppi_channel, ipc_endpoint_get(p_link));
+        nrfx_gppi_task_endpoint_clear(p_link->dppi_channel, p_link->endpoint);
+        nrf_ipc_receive_config_set(NRF_IPC, p_link->ipc_channel, 0);
+    }
+
+    (void)nrfx_gppi_channel_free(p_link->dppi_channel);
+}
+
+#endif // NRFX_CHECK(NRFX_DPPI_ENABLED) && defined(IPC_PRESENT)
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef NRFX_IPC_LINK_H__
+#define NRFX_IPC_LINK_H__
+
+#include <nrfx.h>
+#include <hal/nrf_ipc.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_ipc_link Cross-core hardware event links
+ * @{
+ * @ingroup nrfx
+ * @brief   Hardware links of peripheral events on one core to tasks on another core.
+ *
+ * A link routes an event of a peripheral in the local domain to a task of a peripheral in
+ * the domain of another core through an IPC channel, with no CPU involvement:
+ * - On the source core, the event is connected over DPPI to the SEND task of the local IPC
+ *   peripheral, which signals the IPC channel.
+ * - On the sink core, the RECEIVE event of the local IPC peripheral, which is generated when
+ *   the IPC channel is signalled, is connected over DPPI to the task.
+ *
+ * Both halves of a link are set up the same way, each by the core it belongs to, and have
+ * to agree only on the IPC channel number. The SEND task and the RECEIVE event with
+ * the index equal to the IPC channel number are used, so these must not be used
+ * by the IPC driver at the same time. The RECEIVE event of a link does not generate
+ * an interrupt.
+ *
+ * Example use cases are triggering RADIO TXEN on the network core from a TIMER on
+ * the application core, or capturing the time of RADIO events of the network core with
+ * a TIMER on the application core.
+ */
+
+/** @brief Link instance structure. */
+typedef struct
+{
+    uint32_t endpoint;     ///< Address of the event or the task of the link on this core. For internal use only.
+    uint8_t  ipc_channel;  ///< IPC channel of the link. For internal use only.
+    uint8_t  dppi_channel; ///< DPPI channel connecting the endpoint with IPC. For internal use only.
+    bool     source;       ///< True if this core is the source of the link. For internal use only.
+} nrfx_ipc_link_t;
+
+/**
+ * @brief Function for setting up the source half of a link on this core.
+ *
+ * The link is disabled after the setup. It is enabled with @ref nrfx_ipc_link_enable.
+ *
+ * @param[out] p_link        Pointer to the link instance structure.
+ * @param[in]  ipc_channel   IPC channel of the link, shared with the sink core.
+ * @param[in]  event_address Address of the event to be sent to the sink core.
+ *
+ * @retval NRFX_SUCCESS             The link half was set up.
+ * @retval NRFX_ERROR_INVALID_PARAM The IPC channel number is out of range.
+ * @retval NRFX_ERROR_BUSY          The SEND task of the IPC channel is already configured.
+ * @retval NRFX_ERROR_NO_MEM        There is no available DPPI channel.
+ */
+nrfx_err_t nrfx_ipc_link_source_init(nrfx_ipc_link_t * p_link,
+                                     uint8_t           ipc_channel,
+                                     uint32_t          event_address);
+
+/**
+ * @brief Function for setting up the sink half of a link on this core.
+ *
+ * The link is disabled after the setup. It is enabled with @ref nrfx_ipc_link_enable.
+ *
+ * @param[out] p_link       Pointer to the link instance structure.
+ * @param[in]  ipc_channel  IPC channel of the link, shared with the source core.
+ * @param[in]  task_address Address of the task to be triggered by the source core.
+ *
+ * @retval NRFX_SUCCESS             The link half was set up.
+ * @retval NRFX_ERROR_INVALID_PARAM The IPC channel number is out of range.
+ * @retval NRFX_ERROR_BUSY          The RECEIVE event of the IPC channel is already configured.
+ * @retval NRFX_ERROR_NO_MEM        There is no available DPPI channel.
+ */
+nrfx_err_t nrfx_ipc_link_sink_init(nrfx_ipc_link_t * p_link,
+                                   uint8_t           ipc_channel,
+                                   uint32_t          task_address);
+
+/**
+ * @brief Function for enabling the half of a link on this core.
+ *
+ * @param[in] p_link Pointer to the link instance structure.
+ */
+void nrfx_ipc_link_enable(nrfx_ipc_link_t const * p_link);
+
+/**
+ * @brief Function for disabling the half of a link on this core.
+ *
+ * @param[in] p_link Pointer to the link instance structure.
+ */
+void nrfx_ipc_link_disable(nrfx_ipc_link_t const * p_link);
+
+/**
+ * @brief Function for tearing down the half of a link on this core.
+ *
+ * The DPPI channel is freed and the IPC configuration of the link is cleared.
+ *
+ * @param[in] p_link Pointer to the link instance structure.
+ */
+void nrfx_ipc_link_uninit(nrfx_ipc_link_t * p_link);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_IPC_LINK_H__
@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx.h>
+
+#if NRFX_CHECK(NRFX_CLOCK_ENABLED) && NRFX_CHECK(NRFX_TEMP_ENABLED) && \
+    NRFX_CHECK(NRFX_CLOCK_CONFIG_LF_CAL_ENABLED)
+
+#include <helpers/nrfx_lfrc_cal.h>
+#include <nrfx_temp.h>
+
+#if NRF_CLOCK_HAS_CALIBRATION_TIMER
+
+#define NRFX_LOG_MODULE CLOCK
+#include <nrfx_log.h>
+
+static void cal_try_start(nrfx_lfrc_cal_t * p_cal)
+{
+    bool start;
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    start = p_cal->cal_pending && nrfx_clock_hfclk_is_running();
+    if (start)
+    {
+        p_cal->cal_pending = false;
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    if (!start)
+    {
+        return;
+    }
+
+    if (nrfx_clock_calibration_start() == NRFX_SUCCESS)
+    {
+        p_cal->calibrating = true;
+    }
+    else
+    {
+        // LFCLK is not running. Give up this calibration and retry at the next check.
+        nrfx_clock_hfclk_release();
+        NRFX_LOG_WARNING("LFRC calibration could not be started.");
+        if (p_cal->running)
+        {
+            nrfx_clock_calibration_timer_start(p_cal->config.interval);
+        }
+    }
+}
+
+static void cal_request(nrfx_lfrc_cal_t * p_cal, int32_t temp, bool temp_trigger)
+{
+    p_cal->pending_temp = temp;
+    p_cal->temp_trigger = temp_trigger;
+    p_cal->cal_pending  = true;
+
+    // HFCLK_STARTED is reported only if the oscillator was not requested before.
+    nrfx_clock_hfclk_request();
+    cal_try_start(p_cal);
+}
+
+static void temp_check(nrfx_lfrc_cal_t * p_cal)
+{
+    if (nrfx_temp_measure() != NRFX_SUCCESS)
+    {
+        // Calibrate anyway, as the drift cannot be estimated.
+        cal_request(p_cal, p_cal->cal_temp, true);
+        return;
+    }
+
+    int32_t temp = nrfx_temp_result_get();
+    int32_t diff = temp - p_cal->cal_temp;
+
+    if ((diff >= p_cal->config.temp_threshold) || (-diff >= p_cal->config.temp_threshold))
+    {
+        cal_request(p_cal, temp, true);
+    }
+    else if (p_cal->skips >= p_cal->skips_allowed)
+    {
+        cal_request(p_cal, temp, false);
+    }
+    else
+    {
+        p_cal->skips++;
+        p_cal->skip_count++;
+        nrfx_clock_calibration_timer_start(p_cal->config.interval);
+    }
+}
+
+static void cal_done(nrfx_lfrc_cal_t * p_cal)
+{
+    nrfx_clock_hfclk_release();
+
+    p_cal->cal_temp = p_cal->pending_temp;
+    p_cal->skips    = 0;
+    p_cal->cal_count++;
+
+    if (p_cal->temp_trigger)
+    {
+        p_cal->skips_allowed /= 2;
+    }
+    else
+    {
+        uint32_t skips_allowed = (uint32_t)p_cal->skips_allowed * 2 + 1;
+        p_cal->skips_allowed = (uint16_t)NRFX_MIN(skips_allowed, p_cal->config.max_skips);
+    }
+
+    if (p_cal->running)
+    {
+        nrfx_clock_calibration_timer_start(p_cal->config.interval);
+    }
+}
+
+void nrfx_lfrc_cal_init(nrfx_lfrc_cal_t * p_cal, nrfx_lfrc_cal_config_t const * p_config)
+{
+    NRFX_ASSERT(p_cal);
+    NRFX_ASSERT(p_config);
+    NRFX_ASSERT(p_config->interval);
+
+    p_cal->config        = *p_config;
+    p_cal->cal_temp      = 0;
+    p_cal->skips         = 0;
+    p_cal->skips_allowed = 0;
+    p_cal->running       = false;
+    p_cal->cal_pending   = false;
+    p_cal->calibrating   = false;
+    p_cal->cal_count     = 0;
+    p_cal->skip_count    = 0;
+}
+
+void nrfx_lfrc_cal_start(nrfx_lfrc_cal_t * p_cal)
+{
+    NRFX_ASSERT(p_cal);
+    NRFX_ASSERT(!p_cal->running);
+
+    p_cal->running = true;
+    p_cal->skips   = 0;
+
+    // Calibrate at the current temperature to get the reference for next checks.
+    int32_t temp = (nrfx_temp_measure() == NRFX_SUCCESS) ? nrfx_temp_result_get() : 0;
+    cal_request(p_cal, temp, false);
+}
+
+void nrfx_lfrc_cal_stop(nrfx_lfrc_cal_t * p_cal)
+{
+    NRFX_ASSERT(p_cal);
+
+    p_cal->running = false;
+    nrfx_clock_calibration_timer_stop();
+}
+
+bool nrfx_lfrc_cal_clock_event_handle(nrfx_lfrc_cal_t * p_cal, nrfx_clock_evt_type_t event)
+{
+    NRFX_ASSERT(p_cal);
+
+    switch (event)
+    {
+        case NRFX_CLOCK_EVT_HFCLK_STARTED:
+            cal_try_start(p_cal);
+            return false;
+
+        case NRFX_CLOCK_EVT_CTTO:
+            if (p_cal->running)
+            {
+                temp_check(p_cal);
+            }
+            return true;
+
+        case NRFX_CLOCK_EVT_CAL_DONE:
+            if (!p_cal->calibrating)
+            {
+                // Calibration started by the application.
+                return false;
+            }
+            p_cal->calibrating = false;
+            cal_done(p_cal);
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+#endif // NRF_CLOCK_HAS_CALIBRATION_TIMER
+
+#endif // NRFX_CHECK(NRFX_CLOCK_ENABLED) && NRFX_CHECK(NRFX_TEMP_ENABLED)
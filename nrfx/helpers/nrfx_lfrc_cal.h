@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_LFRC_CAL_H__
+#define NRFX_LFRC_CAL_H__
+
+#include <nrfx.h>
+#include <nrfx_clock.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_lfrc_cal Adaptive LFRC calibration
+ * @{
+ * @ingroup nrfx
+ * @brief   Calibration of the LFRC oscillator scheduled from the temperature change.
+ *
+ * The calibration timer periodically wakes the helper, which measures the temperature with
+ * the @ref nrfx_temp driver. The calibration, which needs the crystal oscillator, is performed
+ * only when the temperature changed by the configured threshold since the previous
+ * calibration, or when the allowed number of skipped checks is reached.
+ *
+ * The allowed number of skipped checks adapts to the history of the previous calibrations.
+ * It grows after each calibration done at a stable temperature, up to the configured limit,
+ * and it is halved after each calibration triggered by a temperature change. The LFRC does
+ * not report the correction applied by the calibration, so the reason of the previous
+ * calibration is used as the measure of drift.
+ *
+ * The @ref nrfx_temp driver must be initialized in blocking mode and the clock driver
+ * events must be passed to @ref nrfx_lfrc_cal_clock_event_handle. The helper is available
+ * only on SoCs with the calibration timer.
+ */
+
+/** @brief Adaptive LFRC calibration configuration. */
+typedef struct
+{
+    uint8_t  interval;       ///< Interval of temperature checks, in 0.25 s units of the calibration timer.
+    uint8_t  temp_threshold; ///< Temperature change that triggers the calibration, in 0.25 degree units.
+    uint16_t max_skips;      ///< Maximum number of checks skipped between calibrations.
+} nrfx_lfrc_cal_config_t;
+
+/** @brief Adaptive LFRC calibration structure. */
+typedef struct
+{
+    nrfx_lfrc_cal_config_t config;        ///< Configuration. For internal use only.
+    int32_t                cal_temp;      ///< Temperature of the last calibration. For internal use only.
+    int32_t                pending_temp;  ///< Temperature of the calibration in progress. For internal use only.
+    uint16_t               skips;         ///< Checks skipped since the last calibration. For internal use only.
+    uint16_t               skips_allowed; ///< Current limit of skipped checks. For internal use only.
+    bool                   temp_trigger;  ///< Calibration was triggered by temperature. For internal use only.
+    volatile bool          running;       ///< True if the adaptive calibration is running. For internal use only.
+    volatile bool          cal_pending;   ///< True if the calibration waits for HFCLK. For internal use only.
+    volatile bool          calibrating;   ///< True if the calibration was started by the helper. For internal use only.
+    uint32_t               cal_count;     ///< Number of performed calibrations. Read only.
+    uint32_t               skip_count;    ///< Number of skipped calibrations. Read only.
+} nrfx_lfrc_cal_t;
+
+/**
+ * @brief Function for initializing the adaptive LFRC calibration structure.
+ *
+ * @param[out] p_cal    Pointer to the calibration structure.
+ * @param[in]  p_config Pointer to the configuration.
+ */
+void nrfx_lfrc_cal_init(nrfx_lfrc_cal_t * p_cal, nrfx_lfrc_cal_config_t const * p_config);
+
+/**
+ * @brief Function for starting the adaptive LFRC calibration.
+ *
+ * The first calibration is performed right away. LFCLK must be running.
+ *
+ * @param[in] p_cal Pointer to the calibration structure.
+ */
+void nrfx_lfrc_cal_start(nrfx_lfrc_cal_t * p_cal);
+
+/**
+ * @brief Function for stopping the adaptive LFRC calibration.
+ *
+ * A calibration in progress is completed, but no further checks are scheduled.
+ *
+ * @param[in] p_cal Pointer to the calibration structure.
+ */
+void nrfx_lfrc_cal_stop(nrfx_lfrc_cal_t * p_cal);
+
+/**
+ * @brief Function for handling the clock driver events.
+ *
+ * The function is to be called from the event handler passed to @ref nrfx_clock_init.
+ *
+ * @param[in] p_cal Pointer to the calibration structure.
+ * @param[in] event Clock driver event.
+ *
+ * @retval true  The event was consumed by the helper.
+ * @retval false The event is to be handled by the application.
+ *               @ref NRFX_CLOCK_EVT_HFCLK_STARTED is never consumed, and
+ *               @ref NRFX_CLOCK_EVT_CAL_DONE is not consumed if the calibration was
+ *               started by the application.
+ */
+bool nrfx_lfrc_cal_clock_event_handle(nrfx_lfrc_cal_t * p_cal, nrfx_clock_evt_type_t event);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_LFRC_CAL_H__
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <nrfx.h>
+
+#if defined(PPI_PRESENT) || defined(DPPI_PRESENT)
+
+#include <helpers/nrfx_pipeline.h>
+#include <helpers/nrfx_gppi.h>
+
+/** @brief Function for getting the given half of the shared buffer. */
+static uint8_t * half_get(nrfx_pipeline_t const * p_pipe, uint8_t half)
+{
+    return p_pipe->p_buffer + (half ? p_pipe->half_size : 0);
+}
+
+static void event_signal(nrfx_pipeline_t *        p_pipe,
+                         nrfx_pipeline_evt_type_t type,
+                         uint8_t *                p_buffer)
+{
+    if (p_pipe->handler)
+    {
+        nrfx_pipeline_evt_t event =
+        {
+            .type     = type,
+            .p_buffer = p_buffer,
+            .size     = p_pipe->half_size,
+        };
+
+        p_pipe->handler(&event, p_pipe->p_context);
+    }
+}
+
+nrfx_err_t nrfx_pipeline_init(nrfx_pipeline_t *              p_pipe,
+                              nrfx_pipeline_config_t const * p_config,
+                              nrfx_pipeline_handler_t        handler,
+                              void *                         p_context)
+{
+    NRFX_ASSERT(p_pipe);
+    NRFX_ASSERT(p_config);
+    NRFX_ASSERT(p_config->producer.end_event_addr);
+    NRFX_ASSERT(p_config->producer.start_task_addr);
+    NRFX_ASSERT(p_config->producer.started_event_addr);
+    NRFX_ASSERT(p_config->producer.buffer_set);
+    NRFX_ASSERT(p_config->consumer.start_task_addr);
+    NRFX_ASSERT(p_config->consumer.buffer_set);
+    NRFX_ASSERT(nrfx_is_in_ram(p_config->p_buffer));
+    NRFX_ASSERT((p_config->size > 0) && ((p_config->size % 8) == 0));
+
+    nrfx_err_t err_code;
+
+    p_pipe->producer         = p_config->producer;
+    p_pipe->consumer         = p_config->consumer;
+    p_pipe->p_buffer         = p_config->p_buffer;
+    p_pipe->half_size        = p_config->size / 2;
+    p_pipe->handler          = handler;
+    p_pipe->p_context        = p_context;
+    p_pipe->filling_half     = 0;
+    p_pipe->consumer_pending = 0;
+    p_pipe->running          = false;
+
+    err_code = nrfx_gppi_channel_alloc(&p_pipe->channel);
+    if (err_code != NRFX_SUCCESS)
+    {
+        return err_code;
+    }
+
+    // The producer is restarted on the other half at the same time as the consumer is started.
+    nrfx_gppi_channel_endpoints_setup(p_pipe->channel,
+                                      p_pipe->producer.end_event_addr,
+                                      p_pipe->consumer.start_task_addr);
+    nrfx_gppi_fork_endpoint_setup(p_pipe->channel, p_pipe->producer.start_task_addr);
+
+    return NRFX_SUCCESS;
+}
+
+void nrfx_pipeline_uninit(nrfx_pipeline_t * p_pipe)
+{
+    NRFX_ASSERT(p_pipe);
+
+    nrfx_pipeline_stop(p_pipe);
+
+    nrfx_gppi_event_endpoint_clear(p_pipe->channel, p_pipe->producer.end_event_addr);
+    nrfx_gppi_task_endpoint_clear(p_pipe->channel, p_pipe->consumer.start_task_addr);
+    nrfx_gppi_fork_endpoint_clear(p_pipe->channel, p_pipe->producer.start_task_addr);
+    (void)nrfx_gppi_channel_free(p_pipe->channel);
+}
+
+void nrfx_pipeline_start(nrfx_pipeline_t * p_pipe)
+{
+    NRFX_ASSERT(p_pipe);
+    NRFX_ASSERT(!p_pipe->running);
+
+    volatile uint32_t * p_started = (volatile uint32_t *)p_pipe->producer.started_event_addr;
+
+    p_pipe->filling_half     = 0;
+    p_pipe->consumer_pending = 0;
+    p_pipe->running          = true;
+
+    p_pipe->consumer.buffer_set(half_get(p_pipe, 0), p_pipe->half_size,
+                                p_pipe->consumer.p_context);
+    p_pipe->producer.buffer_set(half_get(p_pipe, 0), p_pipe->half_size,
+                                p_pipe->producer.p_context);
+    nrfx_gppi_channels_enable(NRFX_BIT(p_pipe->channel));
+
+    // The interrupts are blocked so that the STARTED event is not cleared by the driver
+    // of the producer before it is seen here.
+    NRFX_CRITICAL_SECTION_ENTER();
+    *p_started = 0;
+    *(volatile uint32_t *)p_pipe->producer.start_task_addr = 1;
+    while (*p_started == 0)
+    {}
+
+    // The first half has been latched, so the second one can be set for the restart
+    // at the END event.
+    p_pipe->producer.buffer_set(half_get(p_pipe, 1), p_pipe->half_size,
+                                p_pipe->producer.p_context);
+    NRFX_CRITICAL_SECTION_EXIT();
+}
+
+void nrfx_pipeline_stop(nrfx_pipeline_t * p_pipe)
+{
+    NRFX_ASSERT(p_pipe);
+
+    nrfx_gppi_channels_disable(NRFX_BIT(p_pipe->channel));
+    p_pipe->running = false;
+}
+
+void nrfx_pipeline_producer_end_handle(nrfx_pipeline_t * p_pipe)
+{
+    NRFX_ASSERT(p_pipe);
+
+    if (!p_pipe->running)
+    {
+        return;
+    }
+
+    uint8_t * p_filled = half_get(p_pipe, p_pipe->filling_half);
+    uint8_t * p_next   = half_get(p_pipe, p_pipe->filling_half ^ 1);
+    int32_t   pending;
+
+    // The END event has started the consumer on the filled half and restarted the producer
+    // on the other one. Both have latched their buffers by now, so the halves for the next
+    // exchange can be set.
+    p_pipe->filling_half ^= 1;
+    p_pipe->producer.buffer_set(p_filled, p_pipe->half_size, p_pipe->producer.p_context);
+    p_pipe->consumer.buffer_set(p_next, p_pipe->half_size, p_pipe->consumer.p_context);
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    pending = ++p_pipe->consumer_pending;
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    if (pending > 1)
+    {
+        // The consumer has been restarted before it sent out the previous half,
+        // which the producer is now overwriting.
+        nrfx_pipeline_stop(p_pipe);
+        event_signal(p_pipe, NRFX_PIPELINE_EVT_OVERRUN, p_filled);
+        return;
+    }
+
+    event_signal(p_pipe, NRFX_PIPELINE_EVT_HANDOFF, p_filled);
+}
+
+void nrfx_pipeline_consumer_end_handle(nrfx_pipeline_t * p_pipe)
+{
+    NRFX_ASSERT(p_pipe);
+
+    // The END event of the consumer may be handled before the END event of the producer
+    // that started the transfer, so the counter may temporarily go below zero.
+    NRFX_CRITICAL_SECTION_ENTER();
+    p_pipe->consumer_pending--;
+    NRFX_CRITICAL_SECTION_EXIT();
+}
+
+#endif // defined(PPI_PRESENT) || defined(DPPI_PRESENT)
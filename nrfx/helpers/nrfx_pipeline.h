@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef NRFX_PIPELINE_H__
+#define NRFX_PIPELINE_H__
+
+#include <nrfx.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_pipeline Peripheral pipeline
+ * @{
+ * @ingroup nrfx
+ * @brief   Data transfer between two EasyDMA peripherals through a shared ping-pong buffer.
+ *
+ * The producer, for example SAADC, UARTE RX or PDM, fills one half of the buffer while
+ * the consumer, for example SPIM, UARTE TX or I2S, sends out the other half. The END event
+ * of the producer is connected over PPI or DPPI to the START task of the consumer and,
+ * through a fork, to the START task of the producer itself, so the halves are exchanged
+ * by hardware. The data is not copied.
+ *
+ * The CPU only hands the buffer ownership over once per half. The handling of the END event
+ * of the producer must call @ref nrfx_pipeline_producer_end_handle, which points both
+ * peripherals to the halves they are to use at the next exchange, and the handling of the END
+ * event of the consumer must call @ref nrfx_pipeline_consumer_end_handle. Both calls
+ * must happen within one half-buffer period.
+ *
+ * The peripherals are started and stopped by their drivers or through the HAL, configured
+ * so that every transfer of the producer fills a whole half. The pipeline only sets
+ * the buffers, through the functions given in the configuration, for example
+ * @ref nrf_uarte_rx_buffer_set and @ref nrf_uarte_tx_buffer_set for a UARTE bridge.
+ */
+
+/** @brief Pipeline event types. */
+typedef enum
+{
+    NRFX_PIPELINE_EVT_HANDOFF, ///< A half of the buffer has been passed from the producer to the consumer.
+    NRFX_PIPELINE_EVT_OVERRUN, ///< The consumer was still sending a half when the next one was filled.
+                               ///< The pipeline is stopped.
+} nrfx_pipeline_evt_type_t;
+
+/** @brief Pipeline event structure. */
+typedef struct
+{
+    nrfx_pipeline_evt_type_t type;     ///< Event type.
+    uint8_t *                p_buffer; ///< Half of the buffer passed to the consumer.
+    size_t                   size;     ///< Size of the half, in bytes.
+} nrfx_pipeline_evt_t;
+
+/**
+ * @brief Pipeline event handler type.
+ *
+ * @param[in] p_event   Pointer to the event structure.
+ * @param[in] p_context User context.
+ */
+typedef void (* nrfx_pipeline_handler_t)(nrfx_pipeline_evt_t const * p_event, void * p_context);
+
+/**
+ * @brief Type of the function setting the buffer of a peripheral.
+ *
+ * The buffer is used by the peripheral from the next START task on.
+ *
+ * @param[in] p_buffer  Pointer to the buffer.
+ * @param[in] size      Size of the buffer, in bytes.
+ * @param[in] p_context Context of the endpoint.
+ */
+typedef void (* nrfx_pipeline_buffer_set_t)(uint8_t * p_buffer, size_t size, void * p_context);
+
+/** @brief Peripheral endpoint of the pipeline. */
+typedef struct
+{
+    uint32_t                   end_event_addr;     ///< Address of the event that ends a transfer.
+    uint32_t                   start_task_addr;    ///< Address of the task that starts a transfer.
+    uint32_t                   started_event_addr; ///< Address of the event that confirms the start of a transfer.
+                                                   ///< Used for the producer only.
+    nrfx_pipeline_buffer_set_t buffer_set;         ///< Function setting the buffer of the peripheral.
+    void *                     p_context;          ///< Context passed to @p buffer_set.
+} nrfx_pipeline_endpoint_t;
+
+/** @brief Pipeline configuration structure. */
+typedef struct
+{
+    nrfx_pipeline_endpoint_t producer; ///< Peripheral filling the buffer.
+    nrfx_pipeline_endpoint_t consumer; ///< Peripheral sending out the buffer.
+    uint8_t *                p_buffer; ///< Shared buffer. Must be placed in Data RAM.
+    size_t                   size;     ///< Size of the shared buffer, in bytes. Must be a multiple of 8.
+} nrfx_pipeline_config_t;
+
+/** @brief Pipeline instance structure. */
+typedef struct
+{
+    nrfx_pipeline_endpoint_t producer;         ///< Peripheral filling the buffer. For internal use only.
+    nrfx_pipeline_endpoint_t consumer;         ///< Peripheral sending out the buffer. For internal use only.
+    uint8_t *                p_buffer;         ///< Shared buffer. For internal use only.
+    size_t                   half_size;        ///< Size of a half of the buffer. For internal use only.
+    nrfx_pipeline_handler_t  handler;          ///< Event handler. For internal use only.
+    void *                   p_context;        ///< User context. For internal use only.
+    uint8_t                  channel;          ///< (D)PPI channel exchanging the halves. For internal use only.
+    uint8_t                  filling_half;     ///< Half being filled by the producer. For internal use only.
+    volatile int32_t         consumer_pending; ///< Consumer transfers started and not ended. For internal use only.
+    volatile bool            running;          ///< If the pipeline is started. For internal use only.
+} nrfx_pipeline_t;
+
+/**
+ * @brief Function for initializing the pipeline.
+ *
+ * @param[out] p_pipe    Pointer to the pipeline instance structure.
+ * @param[in]  p_config  Pointer to the pipeline configuration.
+ * @param[in]  handler   Event handler. Can be NULL if the events are not needed.
+ * @param[in]  p_context User context passed to the handler.
+ *
+ * @retval NRFX_SUCCESS      The pipeline was initialized.
+ * @retval NRFX_ERROR_NO_MEM There is no available (D)PPI channel.
+ */
+nrfx_err_t nrfx_pipeline_init(nrfx_pipeline_t *              p_pipe,
+                              nrfx_pipeline_config_t const * p_config,
+                              nrfx_pipeline_handler_t        handler,
+                              void *                         p_context);
+
+/**
+ * @brief Function for uninitializing the pipeline.
+ *
+ * @param[in] p_pipe Pointer to the pipeline instance structure.
+ */
+void nrfx_pipeline_uninit(nrfx_pipeline_t * p_pipe);
+
+/**
+ * @brief Function for starting the pipeline.
+ *
+ * The buffers of both peripherals are set and the first transfer of the producer is started.
+ * The function waits for the start of the transfer to be confirmed, so the peripherals must
+ * be enabled and configured beforehand.
+ *
+ * @param[in] p_pipe Pointer to the pipeline instance structure.
+ */
+void nrfx_pipeline_start(nrfx_pipeline_t * p_pipe);
+
+/**
+ * @brief Function for stopping the pipeline.
+ *
+ * The halves are no longer exchanged. The transfers in progress are not stopped.
+ *
+ * @param[in] p_pipe Pointer to the pipeline instance structure.
+ */
+void nrfx_pipeline_stop(nrfx_pipeline_t * p_pipe);
+
+/**
+ * @brief Function for handing a filled half of the buffer over to the consumer.
+ *
+ * To be called from the handling of the END event of the producer.
+ *
+ * @param[in] p_pipe Pointer to the pipeline instance structure.
+ */
+void nrfx_pipeline_producer_end_handle(nrfx_pipeline_t * p_pipe);
+
+/**
+ * @brief Function for giving a sent half of the buffer back to the producer.
+ *
+ * To be called from the handling of the END event of the consumer.
+ *
+ * @param[in] p_pipe Pointer to the pipeline instance structure.
+ */
+void nrfx_pipeline_consumer_end_handle(nrfx_pipeline_t * p_pipe);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_PIPELINE_H__
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <helpers/nrfx_pm.h>
+
+static nrfx_pm_node_t * mp_head;
+
+/** @brief Lock of the list of registered nodes. */
+NRFX_LOCK_DECLARE(m_pm_lock);
+
+void nrfx_pm_register(nrfx_pm_node_t * p_node)
+{
+    NRFX_ASSERT(p_node);
+    NRFX_ASSERT(p_node->suspend);
+    NRFX_ASSERT(p_node->resume);
+
+    p_node->suspended = false;
+
+    NRFX_LOCK_TAKE(m_pm_lock);
+    p_node->p_next = mp_head;
+    mp_head        = p_node;
+    NRFX_LOCK_GIVE(m_pm_lock);
+}
+
+void nrfx_pm_unregister(nrfx_pm_node_t * p_node)
+{
+    NRFX_ASSERT(p_node);
+
+    bool found = false;
+
+    NRFX_LOCK_TAKE(m_pm_lock);
+    for (nrfx_pm_node_t ** pp_node = &mp_head; *pp_node != NULL; pp_node = &(*pp_node)->p_next)
+    {
+        if (*pp_node == p_node)
+        {
+            *pp_node = p_node->p_next;
+            found    = true;
+            break;
+        }
+    }
+    NRFX_LOCK_GIVE(m_pm_lock);
+
+    if (found && p_node->suspended)
+    {
+        p_node->suspended = false;
+        p_node->resume(p_node->p_instance);
+    }
+}
+
+size_t nrfx_pm_suspend_all(void)
+{
+    size_t busy_count = 0;
+
+    for (nrfx_pm_node_t * p_node = mp_head; p_node != NULL; p_node = p_node->p_next)
+    {
+        if (p_node->suspended)
+        {
+            continue;
+        }
+
+        if (p_node->suspend(p_node->p_instance) == NRFX_SUCCESS)
+        {
+            p_node->suspended = true;
+        }
+        else
+        {
+            busy_count++;
+        }
+    }
+
+    return busy_count;
+}
+
+void nrfx_pm_resume_all(void)
+{
+    for (nrfx_pm_node_t * p_node = mp_head; p_node != NULL; p_node = p_node->p_next)
+    {
+        if (p_node->suspended)
+        {
+            p_node->suspended = false;
+            p_node->resume(p_node->p_instance);
+        }
+    }
+}
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_PM_H__
+#define NRFX_PM_H__
+
+#include <nrfx.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_pm Driver power manager
+ * @{
+ * @ingroup nrfx
+ * @brief   Aggregated suspend and resume of the driver instances.
+ *
+ * Driver instances that provide the suspend and resume functions (for example TWIM, SPIM,
+ * and UARTE) are registered as nodes of the power manager. A single call to
+ * @ref nrfx_pm_suspend_all then disables all the idle instances, which releases their clock
+ * and EasyDMA requests before the CPU enters System ON idle. Instances that are busy are
+ * skipped and keep running. @ref nrfx_pm_resume_all re-enables only the instances that were
+ * suspended by the power manager. The configuration and the pins of the instances are
+ * preserved, so resuming does not repeat the initialization of the drivers.
+ */
+
+/**
+ * @brief Suspend function type.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ *
+ * @retval NRFX_SUCCESS    The instance was suspended.
+ * @retval NRFX_ERROR_BUSY The instance is busy and was not suspended.
+ */
+typedef nrfx_err_t (* nrfx_pm_suspend_t)(void const * p_instance);
+
+/**
+ * @brief Resume function type.
+ *
+ * @param[in] p_instance Pointer to the driver instance structure.
+ */
+typedef void (* nrfx_pm_resume_t)(void const * p_instance);
+
+/** @brief Power manager node structure. */
+typedef struct nrfx_pm_node_s
+{
+    nrfx_pm_suspend_t       suspend;    ///< Function for suspending the instance.
+    nrfx_pm_resume_t        resume;     ///< Function for resuming the instance.
+    void const *            p_instance; ///< Pointer to the driver instance structure.
+    struct nrfx_pm_node_s * p_next;     ///< Next registered node. For internal use only.
+    bool                    suspended;  ///< True if the instance was suspended by the power
+                                        ///< manager. For internal use only.
+} nrfx_pm_node_t;
+
+/**
+ * @brief Macro for defining a power manager node of a driver instance.
+ *
+ * The macro creates the functions that forward the calls of the power manager to
+ * the @p nrfx_<_drv>_suspend and @p nrfx_<_drv>_resume functions of the driver.
+ *
+ * @param[in] _name       Name of the node variable.
+ * @param[in] _drv        Lowercase name of the driver, for example @p spim.
+ * @param[in] _p_instance Pointer to the driver instance structure.
+ */
+#define NRFX_PM_NODE_DEFINE(_name, _drv, _p_instance)                        \
+    static nrfx_err_t NRFX_CONCAT_2(_name, _suspend)(void const * p_instance) \
+    {                                                                        \
+        return NRFX_CONCAT_3(nrfx_, _drv, _suspend)(                         \
+            (NRFX_CONCAT_3(nrfx_, _drv, _t) const *)p_instance);             \
+    }                                                                        \
+    static void NRFX_CONCAT_2(_name, _resume)(void const * p_instance)        \
+    {                                                                        \
+        NRFX_CONCAT_3(nrfx_, _drv, _resume)(                                 \
+            (NRFX_CONCAT_3(nrfx_, _drv, _t) const *)p_instance);             \
+    }                                                                        \
+    static nrfx_pm_node_t _name =                                            \
+    {                                                                        \
+        .suspend    = NRFX_CONCAT_2(_name, _suspend),                        \
+        .resume     = NRFX_CONCAT_2(_name, _resume),                         \
+        .p_instance = _p_instance,                                           \
+    }
+
+/**
+ * @brief Function for registering a node in the power manager.
+ *
+ * @note The driver instance must be initialized before the first call to
+ *       @ref nrfx_pm_suspend_all and must not be uninitialized while it is registered.
+ *
+ * @param[in] p_node Pointer to the node. The node must remain valid until it is unregistered.
+ */
+void nrfx_pm_register(nrfx_pm_node_t * p_node);
+
+/**
+ * @brief Function for unregistering a node from the power manager.
+ *
+ * If the instance was suspended by the power manager, it is resumed.
+ *
+ * @param[in] p_node Pointer to the node.
+ */
+void nrfx_pm_unregister(nrfx_pm_node_t * p_node);
+
+/**
+ * @brief Function for suspending all the idle registered instances.
+ *
+ * Busy instances are skipped. Instances already suspended by the power manager are counted
+ * as suspended.
+ *
+ * @return Number of the registered instances that are busy and were not suspended.
+ *         Zero means that all the registered instances are suspended.
+ */
+size_t nrfx_pm_suspend_all(void);
+
+/** @brief Function for resuming all the instances suspended by @ref nrfx_pm_suspend_all. */
+void nrfx_pm_resume_all(void);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_PM_H__
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx.h>
+#include <helpers/nrfx_prof.h>
+
+#if NRFX_CHECK(NRFX_PROF_ENABLED)
+
+#include <string.h>
+
+/** @brief List of the registered probes. */
+static nrfx_prof_probe_t * mp_probes;
+
+void nrfx_prof_init(void)
+{
+#if defined(DWT_CTRL_CYCCNTENA_Msk)
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#else
+    nrf_systick_load_set(NRF_SYSTICK_VAL_MASK);
+    nrf_systick_csr_set(
+        NRF_SYSTICK_CSR_CLKSOURCE_CPU |
+        NRF_SYSTICK_CSR_TICKINT_DISABLE |
+        NRF_SYSTICK_CSR_ENABLE);
+#endif
+}
+
+void nrfx_prof_probe_record(nrfx_prof_probe_t * p_probe, uint32_t start)
+{
+    NRFX_ASSERT(p_probe);
+
+    uint32_t cycles = (nrfx_prof_timestamp_get() - start) & NRFX_PROF_TIMESTAMP_MASK;
+
+    if (!p_probe->linked)
+    {
+        NRFX_CRITICAL_SECTION_ENTER();
+        if (!p_probe->linked)
+        {
+            p_probe->p_next = mp_probes;
+            mp_probes       = p_probe;
+            p_probe->linked = true;
+        }
+        NRFX_CRITICAL_SECTION_EXIT();
+    }
+
+    p_probe->count++;
+    p_probe->total += cycles;
+    if (cycles < p_probe->min)
+    {
+        p_probe->min = cycles;
+    }
+    if (cycles > p_probe->max)
+    {
+        p_probe->max = cycles;
+    }
+}
+
+uint32_t nrfx_prof_probe_avg_get(nrfx_prof_probe_t const * p_probe)
+{
+    NRFX_ASSERT(p_probe);
+
+    return p_probe->count ? (uint32_t)(p_probe->total / p_probe->count) : 0;
+}
+
+void nrfx_prof_probe_reset(nrfx_prof_probe_t * p_probe)
+{
+    NRFX_ASSERT(p_probe);
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    p_probe->count = 0;
+    p_probe->total = 0;
+    p_probe->min   = UINT32_MAX;
+    p_probe->max   = 0;
+    NRFX_CRITICAL_SECTION_EXIT();
+}
+
+nrfx_prof_probe_t * nrfx_prof_probe_find(char const * p_name)
+{
+    NRFX_ASSERT(p_name);
+
+    for (nrfx_prof_probe_t * p_probe = mp_probes; p_probe != NULL; p_probe = p_probe->p_next)
+    {
+        if (strcmp(p_probe->p_name, p_name) == 0)
+        {
+            return p_probe;
+        }
+    }
+
+    return NULL;
+}
+
+nrfx_prof_probe_t * nrfx_prof_probe_next(nrfx_prof_probe_t const * p_probe)
+{
+    return p_probe ? p_probe->p_next : mp_probes;
+}
+
+#endif // NRFX_CHECK(NRFX_PROF_ENABLED)
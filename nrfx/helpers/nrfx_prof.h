@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_PROF_H__
+#define NRFX_PROF_H__
+
+#include <nrfx.h>
+#include <hal/nrf_systick.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_prof Cycle-accurate profiling
+ * @{
+ * @ingroup nrfx
+ * @brief   Named probe points accumulating execution time in CPU cycles.
+ *
+ * The time is measured with the DWT cycle counter. On cores without the DWT cycle counter
+ * (Cortex-M0) the SysTick timer is used instead, which limits a single measurement
+ * to 24 bits. The SysTick timer must not be used for other purposes then, except for
+ * @ref nrfx_systick, which configures it in the same way.
+ *
+ * The probe macros expand to nothing unless @ref NRFX_PROF_ENABLED is set, so the probes
+ * can be left in the code without any cost. Setting @ref NRFX_PROF_IRQ_ENABLED additionally
+ * enables the probes built into the IRQ handlers of the drivers, named after the driver
+ * instance, for example "spim_0" or "clock".
+ *
+ * Each probe is registered on its first record and can then be found by its name with
+ * @ref nrfx_prof_probe_find or listed with @ref nrfx_prof_probe_next.
+ */
+
+#ifndef NRFX_PROF_ENABLED
+/** @brief Symbol specifying whether the profiling probes are enabled. */
+#define NRFX_PROF_ENABLED 0
+#endif
+
+#ifndef NRFX_PROF_IRQ_ENABLED
+/** @brief Symbol specifying whether the probes in the driver IRQ handlers are enabled. */
+#define NRFX_PROF_IRQ_ENABLED 0
+#endif
+
+/** @brief Profiling probe structure. */
+typedef struct nrfx_prof_probe_s nrfx_prof_probe_t;
+
+/** @brief Profiling probe structure. */
+struct nrfx_prof_probe_s
+{
+    char const *        p_name; ///< Name of the probe.
+    uint32_t            count;  ///< Number of recorded measurements.
+    uint32_t            min;    ///< Shortest measurement in cycles.
+    uint32_t            max;    ///< Longest measurement in cycles.
+    uint64_t            total;  ///< Sum of all measurements in cycles.
+    nrfx_prof_probe_t * p_next; ///< Next registered probe. For internal use only.
+    bool                linked; ///< True if the probe is registered. For internal use only.
+};
+
+/**
+ * @brief Macro for the probe initializer.
+ *
+ * @param[in] name Name of the probe, as a string literal.
+ */
+#define NRFX_PROF_PROBE_INIT(name) \
+{                                  \
+    .p_name = name,                \
+    .min    = UINT32_MAX,          \
+}
+
+#if defined(DWT_CTRL_CYCCNTENA_Msk) || defined(__NRFX_DOXYGEN__)
+/** @brief Mask of the valid bits of the timestamp. */
+#define NRFX_PROF_TIMESTAMP_MASK UINT32_MAX
+#else
+#define NRFX_PROF_TIMESTAMP_MASK NRF_SYSTICK_VAL_MASK
+#endif
+
+/**
+ * @brief Function for initializing the cycle counter used by the probes.
+ *
+ * Registered probes are not affected.
+ */
+void nrfx_prof_init(void);
+
+/**
+ * @brief Function for getting the current timestamp.
+ *
+ * @return Timestamp in CPU cycles. Only the bits of @ref NRFX_PROF_TIMESTAMP_MASK are valid.
+ */
+__STATIC_INLINE uint32_t nrfx_prof_timestamp_get(void)
+{
+#if defined(DWT_CTRL_CYCCNTENA_Msk)
+    return DWT->CYCCNT;
+#else
+    // SysTick counts down.
+    return NRF_SYSTICK_VAL_MASK - nrf_systick_val_get();
+#endif
+}
+
+/**
+ * @brief Function for recording a measurement in the probe.
+ *
+ * The probe is registered on its first record.
+ *
+ * @note Accumulation is not atomic. A probe must be recorded from a single
+ *       priority level at a time.
+ *
+ * @param[in,out] p_probe Pointer to the probe.
+ * @param[in]     start   Timestamp taken with @ref nrfx_prof_timestamp_get at the start
+ *                        of the measured section.
+ */
+void nrfx_prof_probe_record(nrfx_prof_probe_t * p_probe, uint32_t start);
+
+/**
+ * @brief Function for getting the average of the measurements recorded in the probe.
+ *
+ * @param[in] p_probe Pointer to the probe.
+ *
+ * @return Average measurement in cycles or 0 if no measurement was recorded.
+ */
+uint32_t nrfx_prof_probe_avg_get(nrfx_prof_probe_t const * p_probe);
+
+/**
+ * @brief Function for clearing the measurements of the probe.
+ *
+ * The probe stays registered.
+ *
+ * @param[in,out] p_probe Pointer to the probe.
+ */
+void nrfx_prof_probe_reset(nrfx_prof_probe_t * p_probe);
+
+/**
+ * @brief Function for finding the registered probe by its name.
+ *
+ * @param[in] p_name Name of the probe.
+ *
+ * @return Pointer to the probe or NULL if no probe with the given name is registered.
+ */
+nrfx_prof_probe_t * nrfx_prof_probe_find(char const * p_name);
+
+/**
+ * @brief Function for iterating over the registered probes.
+ *
+ * @param[in] p_probe Pointer to the previous probe or NULL to get the first one.
+ *
+ * @return Pointer to the next probe or NULL if there are no more probes.
+ */
+nrfx_prof_probe_t * nrfx_prof_probe_next(nrfx_prof_probe_t const * p_probe);
+
+#if NRFX_CHECK(NRFX_PROF_ENABLED) || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Macro for starting the measurement with the specified probe.
+ *
+ * The macro defines the probe and takes the start timestamp, so it must be placed where
+ * declarations are allowed. The measurement is finished with @ref NRFX_PROF_STOP used
+ * in the same scope. The probe can be stopped in several places, for example before
+ * each return statement.
+ *
+ * @param[in] name Name of the probe. It must be a valid C identifier.
+ */
+#define NRFX_PROF_START(name)                                                 \
+    static nrfx_prof_probe_t nrfx_prof_##name = NRFX_PROF_PROBE_INIT(#name);  \
+    uint32_t nrfx_prof_##name##_start = nrfx_prof_timestamp_get()
+
+/**
+ * @brief Macro for finishing the measurement started with @ref NRFX_PROF_START.
+ *
+ * @param[in] name Name of the probe, the same as in @ref NRFX_PROF_START.
+ */
+#define NRFX_PROF_STOP(name) \
+    nrfx_prof_probe_record(&nrfx_prof_##name, nrfx_prof_##name##_start)
+#else
+#define NRFX_PROF_START(name)
+#define NRFX_PROF_STOP(name)
+#endif
+
+#if (NRFX_CHECK(NRFX_PROF_ENABLED) && NRFX_CHECK(NRFX_PROF_IRQ_ENABLED)) || \
+    defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Macro for starting the measurement of the driver IRQ handler.
+ *
+ * @param[in] name Name of the IRQ probe. It must be a valid C identifier.
+ */
+#define NRFX_PROF_IRQ_ENTER(name)                                             \
+    static nrfx_prof_probe_t nrfx_prof_irq = NRFX_PROF_PROBE_INIT(#name);     \
+    uint32_t nrfx_prof_irq_start = nrfx_prof_timestamp_get()
+
+/** @brief Macro for finishing the measurement of the driver IRQ handler. */
+#define NRFX_PROF_IRQ_EXIT() \
+    nrfx_prof_probe_record(&nrfx_prof_irq, nrfx_prof_irq_start)
+#else
+#define NRFX_PROF_IRQ_ENTER(name)
+#define NRFX_PROF_IRQ_EXIT()
+#endif
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_PROF_H__
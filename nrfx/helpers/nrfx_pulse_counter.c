@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <nrfx.h>
+
+#if NRFX_CHECK(NRFX_TIMER_ENABLED) && NRFX_CHECK(NRFX_GPIOTE_ENABLED) && \
+    (defined(PPI_PRESENT) || defined(DPPI_PRESENT))
+
+#include <helpers/nrfx_pulse_counter.h>
+#include <helpers/nrfx_gppi.h>
+
+/** @brief Compare channel that detects the wrap of the counter. */
+#define WRAP_CC_CHANNEL    NRF_TIMER_CC_CHANNEL0
+
+/** @brief Capture channel used to read the counter. */
+#define CAPTURE_CC_CHANNEL NRF_TIMER_CC_CHANNEL1
+
+static void timer_event_handler(nrf_timer_event_t event_type, void * p_context)
+{
+    nrfx_pulse_counter_t * p_counter = (nrfx_pulse_counter_t *)p_context;
+
+    if (event_type == NRF_TIMER_EVENT_COMPARE0)
+    {
+        p_counter->wraps++;
+    }
+}
+
+nrfx_err_t nrfx_pulse_counter_init(nrfx_pulse_counter_t *              p_counter,
+                                   nrfx_timer_t const *                p_timer,
+                                   nrfx_pulse_counter_config_t const * p_config)
+{
+    NRFX_ASSERT(p_counter);
+    NRFX_ASSERT(p_timer);
+    NRFX_ASSERT(p_config);
+    NRFX_ASSERT((p_config->trigger == NRFX_GPIOTE_TRIGGER_LOTOHI) ||
+                (p_config->trigger == NRFX_GPIOTE_TRIGGER_HITOLO) ||
+                (p_config->trigger == NRFX_GPIOTE_TRIGGER_TOGGLE));
+    NRFX_ASSERT(nrfx_gpiote_is_init());
+
+    nrfx_err_t err_code;
+
+    p_counter->p_timer    = p_timer;
+    p_counter->pin        = p_config->pin;
+    p_counter->wraps      = 0;
+    p_counter->rate_count = 0;
+
+    nrfx_timer_config_t timer_config =
+    {
+        .frequency          = NRF_TIMER_FREQ_1MHz,
+        .mode               = NRF_TIMER_MODE_COUNTER,
+        .bit_width          = NRF_TIMER_BIT_WIDTH_32,
+        .interrupt_priority = p_config->interrupt_priority,
+        .p_context          = p_counter,
+    };
+
+    err_code = nrfx_timer_init(p_timer, &timer_config, timer_event_handler);
+    if (err_code != NRFX_SUCCESS)
+    {
+        return err_code;
+    }
+
+    err_code = nrfx_gpiote_channel_alloc(&p_counter->gpiote_channel);
+    if (err_code != NRFX_SUCCESS)
+    {
+        nrfx_timer_uninit(p_timer);
+        return err_code;
+    }
+
+    err_code = nrfx_gppi_channel_alloc(&p_counter->ppi_channel);
+    if (err_code != NRFX_SUCCESS)
+    {
+        (void)nrfx_gpiote_channel_free(p_counter->gpiote_channel);
+        nrfx_timer_uninit(p_timer);
+        return err_code;
+    }
+
+    nrfx_gpiote_input_config_t input_config =
+    {
+        .pull = p_config->pull,
+    };
+    nrfx_gpiote_trigger_config_t trigger_config =
+    {
+        .trigger      = p_config->trigger,
+        .p_in_channel = &p_counter->gpiote_channel,
+    };
+
+    err_code = nrfx_gpiote_input_configure(p_counter->pin, &input_config, &trigger_config, NULL);
+    if (err_code != NRFX_SUCCESS)
+    {
+        (void)nrfx_gppi_channel_free(p_counter->ppi_channel);
+        (void)nrfx_gpiote_channel_free(p_counter->gpiote_channel);
+        nrfx_timer_uninit(p_timer);
+        return err_code;
+    }
+
+    // The counter reaches zero again only when it wraps.
+    nrfx_timer_compare(p_timer, WRAP_CC_CHANNEL, 0, true);
+
+    nrfx_gppi_channel_endpoints_setup(p_counter->ppi_channel,
+                                      nrfx_gpiote_in_event_addr_get(p_counter->pin),
+                                      nrfx_timer_task_address_get(p_timer,
+                                                                  NRF_TIMER_TASK_COUNT));
+
+    nrfx_timer_clear(p_timer);
+    nrfx_timer_enable(p_timer);
+
+    nrfx_gppi_channels_enable(NRFX_BIT(p_counter->ppi_channel));
+    nrfx_gpiote_trigger_enable(p_counter->pin, false);
+
+    return NRFX_SUCCESS;
+}
+
+void nrfx_pulse_counter_uninit(nrfx_pulse_counter_t * p_counter)
+{
+    NRFX_ASSERT(p_counter);
+
+    nrfx_timer_t const * p_timer = p_counter->p_timer;
+
+    nrfx_gpiote_trigger_disable(p_counter->pin);
+
+    nrfx_gppi_channels_disable(NRFX_BIT(p_counter->ppi_channel));
+    nrfx_gppi_event_endpoint_clear(p_counter->ppi_channel,
+                                   nrfx_gpiote_in_event_addr_get(p_counter->pin));
+    nrfx_gppi_task_endpoint_clear(p_counter->ppi_channel,
+                                  nrfx_timer_task_address_get(p_timer, NRF_TIMER_TASK_COUNT));
+    (void)nrfx_gppi_channel_free(p_counter->ppi_channel);
+
+    (void)nrfx_gpiote_pin_uninit(p_counter->pin);
+    (void)nrfx_gpiote_channel_free(p_counter->gpiote_channel);
+
+    nrfx_timer_uninit(p_timer);
+}
+
+uint64_t nrfx_pulse_counter_get(nrfx_pulse_counter_t * p_counter)
+{
+    NRFX_ASSERT(p_counter);
+
+    uint32_t low;
+    uint32_t wraps;
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    low   = nrfx_timer_capture(p_counter->p_timer, CAPTURE_CC_CHANNEL);
+    wraps = p_counter->wraps;
+    // A wrap that is not handled yet belongs to the captured value only if the capture
+    // happened after it, in which case the value is small.
+    if (nrf_timer_event_check(p_counter->p_timer->p_reg, NRF_TIMER_EVENT_COMPARE0) &&
+        (low < (UINT32_MAX / 2)))
+    {
+        wraps++;
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    return ((uint64_t)wraps << 32) | low;
+}
+
+uint64_t nrfx_pulse_counter_rate_get(nrfx_pulse_counter_t * p_counter, uint32_t elapsed_us)
+{
+    NRFX_ASSERT(p_counter);
+    NRFX_ASSERT(elapsed_us > 0);
+
+    uint64_t count = nrfx_pulse_counter_get(p_counter);
+    uint64_t delta = count - p_counter->rate_count;
+
+    p_counter->rate_count = count;
+
+    // Pulses per second, in millihertz.
+    return (delta * 1000000000ULL) / elapsed_us;
+}
+
+#endif // NRFX_CHECK(NRFX_TIMER_ENABLED) && NRFX_CHECK(NRFX_GPIOTE_ENABLED)
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef NRFX_PULSE_COUNTER_H__
+#define NRFX_PULSE_COUNTER_H__
+
+#include <nrfx.h>
+#include <nrfx_gpiote.h>
+#include <nrfx_timer.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_pulse_counter Pulse counter
+ * @{
+ * @ingroup nrfx
+ * @brief   Counting of pulses on a GPIO input with GPIOTE and TIMER.
+ *
+ * Each pulse generates a GPIOTE IN event, which is connected over PPI or DPPI to
+ * the COUNT task of a TIMER instance in the counter mode. The pulses are therefore counted
+ * without the CPU. The 32-bit count is extended to 64 bits in software: a compare on zero
+ * interrupts the CPU once per wrap of the counter, that is every 2^32 pulses. The count is
+ * read on demand with the CAPTURE task.
+ *
+ * The TIMER driver instance and one GPIOTE channel are initialized and owned by the counter.
+ * The GPIOTE driver must be initialized.
+ */
+
+/** @brief Pulse counter configuration structure. */
+typedef struct
+{
+    nrfx_gpiote_pin_t     pin;                ///< Absolute pin number.
+    nrf_gpio_pin_pull_t   pull;               ///< Pull configuration of the pin.
+    nrfx_gpiote_trigger_t trigger;            ///< Edge that is counted. Must be an edge trigger.
+    uint8_t               interrupt_priority; ///< Interrupt priority of the TIMER instance.
+} nrfx_pulse_counter_config_t;
+
+/** @brief Pulse counter instance structure. */
+typedef struct
+{
+    nrfx_timer_t const * p_timer;        ///< TIMER driver instance. For internal use only.
+    nrfx_gpiote_pin_t    pin;            ///< Absolute pin number. For internal use only.
+    uint32_t             wraps;          ///< Number of wraps of the counter. For internal use only.
+    uint64_t             rate_count;     ///< Count at the last rate estimation. For internal use only.
+    uint8_t              gpiote_channel; ///< GPIOTE channel of the pin. For internal use only.
+    uint8_t              ppi_channel;    ///< Channel counting the pulses. For internal use only.
+} nrfx_pulse_counter_t;
+
+/**
+ * @brief Function for initializing and enabling the pulse counter.
+ *
+ * The count starts from zero.
+ *
+ * @param[out] p_counter Pointer to the counter instance structure.
+ * @param[in]  p_timer   Pointer to the TIMER driver instance, which must not be initialized.
+ * @param[in]  p_config  Pointer to the counter configuration.
+ *
+ * @retval NRFX_SUCCESS             The counter was enabled.
+ * @retval NRFX_ERROR_INVALID_STATE The TIMER driver instance is already initialized.
+ * @retval NRFX_ERROR_INVALID_PARAM The pin is already used as a task output.
+ * @retval NRFX_ERROR_NO_MEM        There are not enough available GPIOTE or (D)PPI channels.
+ */
+nrfx_err_t nrfx_pulse_counter_init(nrfx_pulse_counter_t *              p_counter,
+                                   nrfx_timer_t const *                p_timer,
+                                   nrfx_pulse_counter_config_t const * p_config);
+
+/**
+ * @brief Function for disabling and uninitializing the pulse counter.
+ *
+ * @param[in] p_counter Pointer to the counter instance structure.
+ */
+void nrfx_pulse_counter_uninit(nrfx_pulse_counter_t * p_counter);
+
+/**
+ * @brief Function for getting the number of pulses counted since initialization.
+ *
+ * @note The function must not be called from an interrupt of a higher priority than
+ *       the interrupt of the TIMER instance.
+ *
+ * @param[in] p_counter Pointer to the counter instance structure.
+ *
+ * @return Number of pulses.
+ */
+uint64_t nrfx_pulse_counter_get(nrfx_pulse_counter_t * p_counter);
+
+/**
+ * @brief Function for estimating the pulse rate since the previous estimation.
+ *
+ * The first estimation covers the time since initialization. The function is meant
+ * to be called periodically, with the time elapsed since the previous call measured by
+ * the caller. The same restriction as for @ref nrfx_pulse_counter_get applies.
+ *
+ * @param[in] p_counter  Pointer to the counter instance structure.
+ * @param[in] elapsed_us Time elapsed since the previous estimation, in microseconds.
+ *                       Must not be 0.
+ *
+ * @return Pulse rate, in millihertz.
+ */
+uint64_t nrfx_pulse_counter_rate_get(nrfx_pulse_counter_t * p_counter, uint32_t elapsed_us);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_PULSE_COUNTER_H__
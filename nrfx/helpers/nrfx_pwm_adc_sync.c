@@ -0,0 +1,279 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <nrfx.h>
+
+#if NRFX_CHECK(NRFX_PWM_ENABLED) && NRFX_CHECK(NRFX_SAADC_ENABLED) && \
+    NRFX_CHECK(NRFX_TIMER_ENABLED) && (defined(PPI_PRESENT) || defined(DPPI_PRESENT))
+
+#include <helpers/nrfx_pwm_adc_sync.h>
+#include <helpers/nrfx_gppi.h>
+
+/** @brief Compare channel of the TIMER that ends the delay. */
+#define PWM_ADC_SYNC_CC_CHANNEL NRF_TIMER_CC_CHANNEL0
+
+/** @brief Synchronization served by the SAADC event handler, which has no context. */
+static nrfx_pwm_adc_sync_t * mp_sync;
+
+/** @brief Function for getting the address of the task started at the end of the PWM period. */
+static uint32_t period_task_get(nrfx_pwm_adc_sync_t const * p_sync)
+{
+    if (p_sync->p_timer)
+    {
+        return nrfx_timer_task_address_get(p_sync->p_timer, NRF_TIMER_TASK_START);
+    }
+    return nrf_saadc_task_address_get(NRF_SAADC, NRF_SAADC_TASK_SAMPLE);
+}
+
+static void saadc_event_handler(nrfx_saadc_evt_t const * p_event)
+{
+    nrfx_pwm_adc_sync_t * p_sync = mp_sync;
+
+    switch (p_event->type)
+    {
+        case NRFX_SAADC_EVT_READY:
+            // The first buffer is latched, so the sampling can follow the PWM.
+            nrfx_gppi_channels_enable(NRFX_BIT(p_sync->period_channel));
+            break;
+
+        case NRFX_SAADC_EVT_DONE:
+        {
+            uint16_t channels = (uint16_t)(p_sync->buffer_size / p_sync->periods);
+
+            p_sync->handler(p_event->data.done.p_buffer,
+                            (uint16_t)(p_event->data.done.size / channels),
+                            p_event->data.done.overrun,
+                            p_sync->p_context);
+            nrfx_saadc_ring_buffer_release();
+            break;
+        }
+
+        default:
+            break;
+    }
+}
+
+static void channels_free(nrfx_pwm_adc_sync_t * p_sync)
+{
+    (void)nrfx_gppi_channel_free(p_sync->period_channel);
+    (void)nrfx_gppi_channel_free(p_sync->restart_channel);
+    if (p_sync->p_timer)
+    {
+        (void)nrfx_gppi_channel_free(p_sync->delay_channel);
+    }
+}
+
+nrfx_err_t nrfx_pwm_adc_sync_init(nrfx_pwm_adc_sync_t *              p_sync,
+                                  nrfx_pwm_adc_sync_config_t const * p_config,
+                                  nrfx_pwm_adc_sync_handler_t        handler,
+                                  void *                             p_context)
+{
+    NRFX_ASSERT(p_sync);
+    NRFX_ASSERT(p_config);
+    NRFX_ASSERT(p_config->p_pwm);
+    NRFX_ASSERT(p_config->p_timer || (p_config->delay_ticks == 0));
+    NRFX_ASSERT(p_config->channel_mask);
+    NRFX_ASSERT(p_config->p_buffers);
+    NRFX_ASSERT(p_config->periods > 0);
+    NRFX_ASSERT(p_config->buffer_count >= 2);
+    NRFX_ASSERT(handler);
+    NRFX_ASSERT(!mp_sync);
+
+    nrfx_err_t err_code;
+    uint16_t   channels = 0;
+
+    for (uint32_t mask = p_config->channel_mask; mask; mask &= mask - 1)
+    {
+        channels++;
+    }
+
+    p_sync->p_timer      = (p_config->delay_ticks > 0) ? p_config->p_timer : NULL;
+    p_sync->handler      = handler;
+    p_sync->p_context    = p_context;
+    p_sync->period_event = nrfx_pwm_event_address_get(p_config->p_pwm,
+                                                      NRF_PWM_EVENT_PWMPERIODEND);
+    p_sync->p_buffers    = p_config->p_buffers;
+    p_sync->buffer_size  = (uint16_t)(p_config->periods * channels);
+    p_sync->periods      = p_config->periods;
+    p_sync->buffer_count = p_config->buffer_count;
+
+    nrfx_saadc_adv_config_t adv_config = NRFX_SAADC_DEFAULT_ADV_CONFIG;
+
+    err_code = nrfx_saadc_advanced_mode_set(p_config->channel_mask,
+                                            p_config->resolution,
+                                            &adv_config,
+                                            saadc_event_handler);
+    if (err_code != NRFX_SUCCESS)
+    {
+        return err_code;
+    }
+
+    err_code = nrfx_gppi_channel_alloc(&p_sync->period_channel);
+    if (err_code != NRFX_SUCCESS)
+    {
+        return err_code;
+    }
+
+    err_code = nrfx_gppi_channel_alloc(&p_sync->restart_channel);
+    if (err_code != NRFX_SUCCESS)
+    {
+        (void)nrfx_gppi_channel_free(p_sync->period_channel);
+        return err_code;
+    }
+
+    if (p_sync->p_timer)
+    {
+        err_code = nrfx_gppi_channel_alloc(&p_sync->delay_channel);
+        if (err_code != NRFX_SUCCESS)
+        {
+            (void)nrfx_gppi_channel_free(p_sync->restart_channel);
+            (void)nrfx_gppi_channel_free(p_sync->period_channel);
+            return err_code;
+        }
+
+        nrfx_timer_config_t timer_config =
+        {
+            .frequency          = NRF_TIMER_FREQ_16MHz,
+            .mode               = NRF_TIMER_MODE_TIMER,
+            .bit_width          = NRF_TIMER_BIT_WIDTH_32,
+            .interrupt_priority = p_config->interrupt_priority,
+            .p_context          = p_sync,
+        };
+
+        err_code = nrfx_timer_init(p_sync->p_timer, &timer_config, NULL);
+        if (err_code != NRFX_SUCCESS)
+        {
+            channels_free(p_sync);
+            return err_code;
+        }
+
+        // One shot per period: the compare clears and stops the TIMER until the next period end.
+        nrfx_timer_extended_compare(p_sync->p_timer,
+                                    PWM_ADC_SYNC_CC_CHANNEL,
+                                    p_config->delay_ticks,
+                                    NRF_TIMER_SHORT_COMPARE0_CLEAR_MASK |
+                                    NRF_TIMER_SHORT_COMPARE0_STOP_MASK,
+                                    false);
+
+        nrfx_gppi_channel_endpoints_setup(p_sync->delay_channel,
+                                          nrfx_timer_compare_event_address_get(
+                                              p_sync->p_timer,
+                                              PWM_ADC_SYNC_CC_CHANNEL),
+                                          nrf_saadc_task_address_get(NRF_SAADC,
+                                                                     NRF_SAADC_TASK_SAMPLE));
+    }
+
+    nrfx_gppi_channel_endpoints_setup(p_sync->period_channel,
+                                      p_sync->period_event,
+                                      period_task_get(p_sync));
+    nrfx_gppi_channel_endpoints_setup(p_sync->restart_channel,
+                                      nrf_saadc_event_address_get(NRF_SAADC, NRF_SAADC_EVENT_END),
+                                      nrf_saadc_task_address_get(NRF_SAADC, NRF_SAADC_TASK_START));
+
+    mp_sync = p_sync;
+    return NRFX_SUCCESS;
+}
+
+void nrfx_pwm_adc_sync_uninit(nrfx_pwm_adc_sync_t * p_sync)
+{
+    NRFX_ASSERT(p_sync);
+    NRFX_ASSERT(mp_sync == p_sync);
+
+    nrfx_pwm_adc_sync_stop(p_sync);
+
+    nrfx_gppi_event_endpoint_clear(p_sync->period_channel, p_sync->period_event);
+    nrfx_gppi_task_endpoint_clear(p_sync->period_channel, period_task_get(p_sync));
+    nrfx_gppi_event_endpoint_clear(p_sync->restart_channel,
+                                   nrf_saadc_event_address_get(NRF_SAADC, NRF_SAADC_EVENT_END));
+    nrfx_gppi_task_endpoint_clear(p_sync->restart_channel,
+                                  nrf_saadc_task_address_get(NRF_SAADC, NRF_SAADC_TASK_START));
+
+    if (p_sync->p_timer)
+    {
+        nrfx_gppi_event_endpoint_clear(p_sync->delay_channel,
+                                       nrfx_timer_compare_event_address_get(
+                                           p_sync->p_timer,
+                                           PWM_ADC_SYNC_CC_CHANNEL));
+        nrfx_gppi_task_endpoint_clear(p_sync->delay_channel,
+                                      nrf_saadc_task_address_get(NRF_SAADC,
+                                                                 NRF_SAADC_TASK_SAMPLE));
+        nrfx_timer_uninit(p_sync->p_timer);
+    }
+
+    channels_free(p_sync);
+    mp_sync = NULL;
+}
+
+nrfx_err_t nrfx_pwm_adc_sync_start(nrfx_pwm_adc_sync_t * p_sync)
+{
+    NRFX_ASSERT(p_sync);
+    NRFX_ASSERT(mp_sync == p_sync);
+
+    nrfx_err_t err_code;
+
+    err_code = nrfx_saadc_ring_set(p_sync->p_buffers, p_sync->buffer_size, p_sync->buffer_count);
+    if (err_code != NRFX_SUCCESS)
+    {
+        return err_code;
+    }
+
+    if (p_sync->p_timer)
+    {
+        nrfx_timer_clear(p_sync->p_timer);
+        nrfx_gppi_channels_enable(NRFX_BIT(p_sync->delay_channel));
+    }
+    nrfx_gppi_channels_enable(NRFX_BIT(p_sync->restart_channel));
+
+    // The channel following the PWM period is enabled on the READY event.
+    return nrfx_saadc_mode_trigger();
+}
+
+void nrfx_pwm_adc_sync_stop(nrfx_pwm_adc_sync_t * p_sync)
+{
+    NRFX_ASSERT(p_sync);
+    NRFX_ASSERT(mp_sync == p_sync);
+
+    nrfx_gppi_channels_disable(NRFX_BIT(p_sync->period_channel) |
+                               NRFX_BIT(p_sync->restart_channel));
+    if (p_sync->p_timer)
+    {
+        nrfx_gppi_channels_disable(NRFX_BIT(p_sync->delay_channel));
+        nrfx_timer_pause(p_sync->p_timer);
+    }
+
+    nrfx_saadc_abort();
+}
+
+#endif // NRFX_CHECK(NRFX_PWM_ENABLED) && NRFX_CHECK(NRFX_SAADC_ENABLED) &&
+       // NRFX_CHECK(NRFX_TIMER_ENABLED) && (defined(PPI_PRESENT) || defined(DPPI_PRESENT))
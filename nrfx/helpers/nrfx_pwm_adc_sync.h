@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef NRFX_PWM_ADC_SYNC_H__
+#define NRFX_PWM_ADC_SYNC_H__
+
+#include <nrfx.h>
+#include <nrfx_pwm.h>
+#include <nrfx_saadc.h>
+#include <nrfx_timer.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_pwm_adc_sync PWM-synchronized SAADC sampling
+ * @{
+ * @ingroup nrfx
+ * @brief   Sampling of the SAADC channels at a fixed point of every PWM period.
+ *
+ * The PWMPERIODEND event of the PWM is connected over PPI or DPPI to the SAMPLE task
+ * of the SAADC, so the enabled channels are sampled once per PWM period. If a delay is
+ * configured, the event starts a one-shot TIMER instead, and the SAMPLE task is triggered by
+ * the TIMER compare event, which places the sampling anywhere in the period, for example
+ * in the middle of the on time of a motor phase. The END event of the SAADC restarts
+ * the conversion in hardware and the SAADC driver cycles the ring of buffers set with
+ * @ref nrfx_saadc_ring_set, so the CPU is woken only once per buffer, every
+ * @ref nrfx_pwm_adc_sync_config_t.periods PWM periods.
+ *
+ * The SAADC driver must be initialized and its channels configured before
+ * @ref nrfx_pwm_adc_sync_init, which sets the driver in the advanced mode and owns its
+ * event handler. The PWM driver instance is initialized and played by the user, and
+ * the TIMER driver instance, if any, is initialized and owned by the helper.
+ * As the SAADC is a single instance, only one synchronization can be active at a time.
+ */
+
+/**
+ * @brief Handler of the samples taken during the configured number of PWM periods.
+ *
+ * The samples are valid only within the handler, as the buffer is given back to the ring
+ * when the handler returns.
+ *
+ * @param[in] p_samples Samples of all enabled channels, ordered by the period and then by the channel.
+ * @param[in] periods   Number of periods in @p p_samples.
+ * @param[in] overrun   True if the buffer was refilled before the previous samples were handled.
+ * @param[in] p_context User context.
+ */
+typedef void (* nrfx_pwm_adc_sync_handler_t)(nrf_saadc_value_t const * p_samples,
+                                             uint16_t                  periods,
+                                             bool                      overrun,
+                                             void *                    p_context);
+
+/** @brief Synchronization configuration structure. */
+typedef struct
+{
+    nrfx_pwm_t const *     p_pwm;              ///< PWM driver instance whose periods are followed.
+    nrfx_timer_t const *   p_timer;            ///< TIMER driver instance, which must not be initialized,
+                                               ///< or NULL if @p delay_ticks is 0.
+    uint32_t               delay_ticks;        ///< Delay from the end of the PWM period to the sampling, in 16 MHz ticks.
+    uint32_t               channel_mask;       ///< Mask of the SAADC channels sampled in every period.
+    nrf_saadc_resolution_t resolution;         ///< Resolution of the samples.
+    nrf_saadc_value_t *    p_buffers;          ///< Ring of @p buffer_count buffers, each holding @p periods samples
+                                               ///< of every channel. Must be placed in Data RAM.
+    uint16_t               periods;            ///< Number of PWM periods reported in one handler call.
+    uint8_t                buffer_count;       ///< Number of buffers in the ring. Must be at least 2.
+    uint8_t                interrupt_priority; ///< Interrupt priority of the TIMER instance.
+} nrfx_pwm_adc_sync_config_t;
+
+/** @brief Synchronization instance structure. */
+typedef struct
+{
+    nrfx_timer_t const *        p_timer;         ///< TIMER driver instance or NULL. For internal use only.
+    nrfx_pwm_adc_sync_handler_t handler;         ///< Samples handler. For internal use only.
+    void *                      p_context;       ///< User context. For internal use only.
+    uint32_t                    period_event;    ///< PWMPERIODEND event address. For internal use only.
+    nrf_saadc_value_t *         p_buffers;       ///< Ring of buffers. For internal use only.
+    uint16_t                    buffer_size;     ///< Number of samples in one buffer. For internal use only.
+    uint16_t                    periods;         ///< Number of periods in one buffer. For internal use only.
+    uint8_t                     buffer_count;    ///< Number of buffers in the ring. For internal use only.
+    uint8_t                     period_channel;  ///< Channel connected to the period end. For internal use only.
+    uint8_t                     delay_channel;   ///< Channel connected to the TIMER compare. For internal use only.
+    uint8_t                     restart_channel; ///< Channel restarting the conversion. For internal use only.
+} nrfx_pwm_adc_sync_t;
+
+/**
+ * @brief Function for initializing the synchronization.
+ *
+ * @param[out] p_sync    Pointer to the synchronization instance structure.
+ * @param[in]  p_config  Pointer to the synchronization configuration.
+ * @param[in]  handler   Samples handler. Must not be NULL.
+ * @param[in]  p_context User context passed to the handler.
+ *
+ * @retval NRFX_SUCCESS             The synchronization was initialized.
+ * @retval NRFX_ERROR_INVALID_STATE The TIMER driver instance is already initialized.
+ * @retval NRFX_ERROR_NO_MEM        There are not enough available (D)PPI channels.
+ * @retval NRFX_ERROR_BUSY          The SAADC is converting or calibrating.
+ * @retval NRFX_ERROR_INVALID_PARAM A channel in the mask is not configured in the SAADC driver.
+ */
+nrfx_err_t nrfx_pwm_adc_sync_init(nrfx_pwm_adc_sync_t *              p_sync,
+                                  nrfx_pwm_adc_sync_config_t const * p_config,
+                                  nrfx_pwm_adc_sync_handler_t        handler,
+                                  void *                             p_context);
+
+/**
+ * @brief Function for uninitializing the synchronization.
+ *
+ * The synchronization is stopped if it is running.
+ *
+ * @param[in] p_sync Pointer to the synchronization instance structure.
+ */
+void nrfx_pwm_adc_sync_uninit(nrfx_pwm_adc_sync_t * p_sync);
+
+/**
+ * @brief Function for starting the synchronized sampling.
+ *
+ * The sampling starts with the first PWM period that ends after the SAADC has latched
+ * the first buffer.
+ *
+ * @param[in] p_sync Pointer to the synchronization instance structure.
+ *
+ * @retval NRFX_SUCCESS              The sampling was started.
+ * @retval NRFX_ERROR_INVALID_STATE  The SAADC is converting.
+ * @retval NRFX_ERROR_INVALID_LENGTH The buffers are too long for the EasyDMA to handle.
+ */
+nrfx_err_t nrfx_pwm_adc_sync_start(nrfx_pwm_adc_sync_t * p_sync);
+
+/**
+ * @brief Function for stopping the synchronized sampling.
+ *
+ * The samples of the buffer in progress are reported to the handler.
+ *
+ * @param[in] p_sync Pointer to the synchronization instance structure.
+ */
+void nrfx_pwm_adc_sync_stop(nrfx_pwm_adc_sync_t * p_sync);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_PWM_ADC_SYNC_H__
@@ -0,0 +1,307 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx.h>
+
+#if NRFX_CHECK(NRFX_QSPI_ENABLED)
+
+#include <helpers/nrfx_qspi_cache.h>
+#include <string.h>
+
+NRFX_STATIC_ASSERT((NRFX_QSPI_CACHE_PAGE_SIZE & (NRFX_QSPI_CACHE_PAGE_SIZE - 1)) == 0);
+NRFX_STATIC_ASSERT(NRFX_QSPI_CACHE_PAGE_SIZE >= 4);
+NRFX_STATIC_ASSERT(NRFX_QSPI_CACHE_PAGE_COUNT > 0);
+
+#define QSPI_CACHE_PAGE_MASK   ((uint32_t)NRFX_QSPI_CACHE_PAGE_SIZE - 1)
+#define QSPI_CACHE_TAG_INVALID UINT32_MAX ///< Not page-aligned, so it matches no read.
+
+/** @brief Sizes of the blocks erased with @ref nrfx_qspi_erase. */
+#define QSPI_CACHE_ERASE_4KB_SIZE  (4UL * 1024UL)
+#define QSPI_CACHE_ERASE_64KB_SIZE (64UL * 1024UL)
+
+/** @brief Cache page descriptor. */
+typedef struct
+{
+    uint32_t tag;      ///< Memory address of the cached page, or QSPI_CACHE_TAG_INVALID.
+    uint32_t last_use; ///< Value of the use counter at the last access, 0 if never accessed.
+} qspi_cache_page_t;
+
+/** @brief Cached data. Adjacent pages are adjacent in RAM, so that two can be read at once. */
+static uint32_t m_data[NRFX_QSPI_CACHE_PAGE_COUNT][NRFX_QSPI_CACHE_PAGE_SIZE / sizeof(uint32_t)];
+
+static qspi_cache_page_t       m_pages[NRFX_QSPI_CACHE_PAGE_COUNT];
+static uint32_t                m_use_counter;
+static uint32_t                m_next_seq_tag; ///< Page expected next by a sequential read pattern.
+static bool                    m_read_ahead;
+static nrfx_qspi_cache_stats_t m_stats;
+
+static void page_touch(size_t idx)
+{
+    if (m_use_counter == UINT32_MAX)
+    {
+        // Restart the counter before it wraps. The order of the pages is lost,
+        // which affects only the choice of the next victims.
+        for (size_t i = 0; i < NRFX_QSPI_CACHE_PAGE_COUNT; i++)
+        {
+            m_pages[i].last_use = (m_pages[i].last_use != 0) ? 1 : 0;
+        }
+        m_use_counter = 1;
+    }
+
+    m_pages[idx].last_use = ++m_use_counter;
+}
+
+static int page_find(uint32_t tag)
+{
+    for (size_t i = 0; i < NRFX_QSPI_CACHE_PAGE_COUNT; i++)
+    {
+        if (m_pages[i].tag == tag)
+        {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+static size_t victim_find(void)
+{
+    size_t victim = 0;
+
+    for (size_t i = 1; i < NRFX_QSPI_CACHE_PAGE_COUNT; i++)
+    {
+        if (m_pages[i].last_use < m_pages[victim].last_use)
+        {
+            victim = i;
+        }
+    }
+    return victim;
+}
+
+#if NRFX_QSPI_CACHE_PAGE_COUNT > 1
+/** @brief Function for finding two adjacent pages whose more recent use is the oldest. */
+static size_t victim_pair_find(void)
+{
+    size_t   victim = 0;
+    uint32_t victim_use = UINT32_MAX;
+
+    for (size_t i = 0; i < NRFX_QSPI_CACHE_PAGE_COUNT - 1; i++)
+    {
+        uint32_t use = NRFX_MAX(m_pages[i].last_use, m_pages[i + 1].last_use);
+
+        if (use < victim_use)
+        {
+            victim     = i;
+            victim_use = use;
+        }
+    }
+    return victim;
+}
+#endif
+
+static nrfx_err_t pages_load(size_t idx, uint32_t tag, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        m_pages[idx + i].tag      = QSPI_CACHE_TAG_INVALID;
+        m_pages[idx + i].last_use = 0;
+    }
+
+    nrfx_err_t err_code = nrfx_qspi_read(m_data[idx], count * NRFX_QSPI_CACHE_PAGE_SIZE, tag);
+    if (err_code != NRFX_SUCCESS)
+    {
+        return err_code;
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        m_pages[idx + i].tag = tag + i * NRFX_QSPI_CACHE_PAGE_SIZE;
+    }
+    // The read-ahead page is touched first, so that it is evicted before the requested one.
+    for (size_t i = count; i > 0; i--)
+    {
+        page_touch(idx + i - 1);
+    }
+    return NRFX_SUCCESS;
+}
+
+static nrfx_err_t page_get(uint32_t tag, size_t * p_idx)
+{
+    int found = page_find(tag);
+
+    if (found >= 0)
+    {
+        m_stats.hits++;
+        *p_idx = (size_t)found;
+        page_touch(*p_idx);
+        return NRFX_SUCCESS;
+    }
+
+    m_stats.misses++;
+
+#if NRFX_QSPI_CACHE_PAGE_COUNT > 1
+    uint32_t next_tag = tag + NRFX_QSPI_CACHE_PAGE_SIZE;
+
+    if (m_read_ahead && (tag == m_next_seq_tag) && (next_tag > tag) && (page_find(next_tag) < 0))
+    {
+        *p_idx = victim_pair_find();
+        m_stats.read_ahead++;
+        return pages_load(*p_idx, tag, 2);
+    }
+#endif
+
+    *p_idx = victim_find();
+    return pages_load(*p_idx, tag, 1);
+}
+
+void nrfx_qspi_cache_init(bool read_ahead)
+{
+    nrfx_qspi_cache_invalidate_all();
+    nrfx_qspi_cache_stats_clear();
+
+    m_read_ahead   = read_ahead;
+    m_use_counter  = 0;
+    m_next_seq_tag = QSPI_CACHE_TAG_INVALID;
+}
+
+nrfx_err_t nrfx_qspi_cache_read(void *   p_rx_buffer,
+                                size_t   rx_buffer_length,
+                                uint32_t src_address)
+{
+    NRFX_ASSERT(p_rx_buffer || (rx_buffer_length == 0));
+
+    uint8_t * p_dst = (uint8_t *)p_rx_buffer;
+
+    while (rx_buffer_length > 0)
+    {
+        uint32_t tag    = src_address & ~QSPI_CACHE_PAGE_MASK;
+        uint32_t offset = src_address & QSPI_CACHE_PAGE_MASK;
+        size_t   chunk  = NRFX_MIN(rx_buffer_length, NRFX_QSPI_CACHE_PAGE_SIZE - offset);
+        size_t   idx;
+
+        nrfx_err_t err_code = page_get(tag, &idx);
+        if (err_code != NRFX_SUCCESS)
+        {
+            return err_code;
+        }
+
+        memcpy(p_dst, (uint8_t const *)m_data[idx] + offset, chunk);
+
+        m_next_seq_tag    = tag + NRFX_QSPI_CACHE_PAGE_SIZE;
+        p_dst            += chunk;
+        src_address      += chunk;
+        rx_buffer_length -= chunk;
+    }
+
+    return NRFX_SUCCESS;
+}
+
+nrfx_err_t nrfx_qspi_cache_write(void const * p_tx_buffer,
+                                 size_t       tx_buffer_length,
+                                 uint32_t     dst_address)
+{
+    nrfx_qspi_cache_invalidate(dst_address, tx_buffer_length);
+    return nrfx_qspi_write(p_tx_buffer, tx_buffer_length, dst_address);
+}
+
+nrfx_err_t nrfx_qspi_cache_erase(nrf_qspi_erase_len_t length,
+                                 uint32_t             start_address)
+{
+    switch (length)
+    {
+        case NRF_QSPI_ERASE_LEN_4KB:
+            nrfx_qspi_cache_invalidate(start_address & ~(QSPI_CACHE_ERASE_4KB_SIZE - 1),
+                                       QSPI_CACHE_ERASE_4KB_SIZE);
+            break;
+
+        case NRF_QSPI_ERASE_LEN_64KB:
+            nrfx_qspi_cache_invalidate(start_address & ~(QSPI_CACHE_ERASE_64KB_SIZE - 1),
+                                       QSPI_CACHE_ERASE_64KB_SIZE);
+            break;
+
+        default:
+            nrfx_qspi_cache_invalidate_all();
+            break;
+    }
+
+    return nrfx_qspi_erase(length, start_address);
+}
+
+nrfx_err_t nrfx_qspi_cache_chip_erase(void)
+{
+    nrfx_qspi_cache_invalidate_all();
+    return nrfx_qspi_chip_erase();
+}
+
+void nrfx_qspi_cache_invalidate(uint32_t address, size_t length)
+{
+    if (length == 0)
+    {
+        return;
+    }
+
+    uint32_t first = address & ~QSPI_CACHE_PAGE_MASK;
+    uint32_t last  = (uint32_t)(address + length - 1) & ~QSPI_CACHE_PAGE_MASK;
+
+    for (size_t i = 0; i < NRFX_QSPI_CACHE_PAGE_COUNT; i++)
+    {
+        if ((m_pages[i].tag != QSPI_CACHE_TAG_INVALID) &&
+            (m_pages[i].tag >= first) && (m_pages[i].tag <= last))
+        {
+            m_pages[i].tag      = QSPI_CACHE_TAG_INVALID;
+            m_pages[i].last_use = 0;
+        }
+    }
+}
+
+void nrfx_qspi_cache_invalidate_all(void)
+{
+    for (size_t i = 0; i < NRFX_QSPI_CACHE_PAGE_COUNT; i++)
+    {
+        m_pages[i].tag      = QSPI_CACHE_TAG_INVALID;
+        m_pages[i].last_use = 0;
+    }
+}
+
+void nrfx_qspi_cache_stats_get(nrfx_qspi_cache_stats_t * p_stats)
+{
+    NRFX_ASSERT(p_stats);
+
+    *p_stats = m_stats;
+}
+
+void nrfx_qspi_cache_stats_clear(void)
+{
+    memset(&m_stats, 0, sizeof(m_stats));
+}
+
+#endif // NRFX_CHECK(NRFX_QSPI_ENABLED)
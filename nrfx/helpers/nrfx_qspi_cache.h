@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_QSPI_CACHE_H__
+#define NRFX_QSPI_CACHE_H__
+
+#include <nrfx.h>
+#include <nrfx_qspi.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_qspi_cache QSPI read cache
+ * @{
+ * @ingroup nrfx_qspi
+ * @brief   Read-through RAM page cache for the external memory.
+ *
+ * Each read done with @ref nrfx_qspi_read pays for the command, the address and the dummy cycles,
+ * and it must be word-aligned. The cache keeps @ref NRFX_QSPI_CACHE_PAGE_COUNT recently read
+ * pages of @ref NRFX_QSPI_CACHE_PAGE_SIZE bytes in RAM, so small reads of any alignment that hit
+ * a cached page take a copy only. Pages are replaced in the least recently used order.
+ *
+ * When a miss follows a read of the preceding page, the missed page and the next one are read
+ * together in a single transfer into two adjacent cache pages, so that sequential reads pay for
+ * the transfer overhead once per two pages.
+ *
+ * Writes and erases done through @ref nrfx_qspi_cache_write, @ref nrfx_qspi_cache_erase, and
+ * @ref nrfx_qspi_cache_chip_erase invalidate the affected pages before the operation is started.
+ * If the memory is modified in another way, call @ref nrfx_qspi_cache_invalidate.
+ *
+ * The QSPI driver must work in the blocking mode when reads are done through the cache.
+ * The functions of the module must not be called from multiple contexts at a time.
+ */
+
+#ifndef NRFX_QSPI_CACHE_PAGE_SIZE
+/** @brief Size of a cache page in bytes. Must be a power of 2 and a multiple of 4. */
+#define NRFX_QSPI_CACHE_PAGE_SIZE 256
+#endif
+
+#ifndef NRFX_QSPI_CACHE_PAGE_COUNT
+/** @brief Number of cache pages. Read-ahead is done only if there are at least 2 pages. */
+#define NRFX_QSPI_CACHE_PAGE_COUNT 8
+#endif
+
+/** @brief Structure holding the cache counters. */
+typedef struct
+{
+    uint32_t hits;       ///< Number of pages accessed by reads that were found in the cache.
+    uint32_t misses;     ///< Number of pages accessed by reads that had to be read from the memory.
+    uint32_t read_ahead; ///< Number of pages read ahead of sequential reads.
+} nrfx_qspi_cache_stats_t;
+
+/**
+ * @brief Function for initializing the cache.
+ *
+ * All pages are invalidated and the counters are cleared.
+ *
+ * @param[in] read_ahead True if pages are to be read ahead of sequential reads, false otherwise.
+ */
+void nrfx_qspi_cache_init(bool read_ahead);
+
+/**
+ * @brief Function for reading data from the QSPI memory through the cache.
+ *
+ * Unlike @ref nrfx_qspi_read, the buffer, the length, and the address do not need to be aligned.
+ * If the data is in the cache, no transfer is done.
+ *
+ * @param[out] p_rx_buffer      Pointer to the receive buffer.
+ * @param[in]  rx_buffer_length Size of the data to read.
+ * @param[in]  src_address      Address in memory to read from.
+ *
+ * @retval NRFX_SUCCESS       The operation was successful.
+ * @retval NRFX_ERROR_BUSY    The driver currently handles another operation.
+ * @retval NRFX_ERROR_TIMEOUT The memory did not leave the automatic DPM in time.
+ */
+nrfx_err_t nrfx_qspi_cache_read(void *   p_rx_buffer,
+                                size_t   rx_buffer_length,
+                                uint32_t src_address);
+
+/**
+ * @brief Function for writing data to the QSPI memory.
+ *
+ * The cached pages overlapping the written area are invalidated, and then @ref nrfx_qspi_write
+ * is called.
+ *
+ * @param[in] p_tx_buffer      Pointer to the writing buffer.
+ * @param[in] tx_buffer_length Size of the data to write.
+ * @param[in] dst_address      Address in memory to write to.
+ *
+ * @return Value returned by @ref nrfx_qspi_write.
+ */
+nrfx_err_t nrfx_qspi_cache_write(void const * p_tx_buffer,
+                                 size_t       tx_buffer_length,
+                                 uint32_t     dst_address);
+
+/**
+ * @brief Function for erasing one memory block.
+ *
+ * The cached pages overlapping the erased block are invalidated, and then @ref nrfx_qspi_erase
+ * is called.
+ *
+ * @param[in] length        Size of data to erase. See @ref nrf_qspi_erase_len_t.
+ * @param[in] start_address Memory address to start erasing.
+ *
+ * @return Value returned by @ref nrfx_qspi_erase.
+ */
+nrfx_err_t nrfx_qspi_cache_erase(nrf_qspi_erase_len_t length,
+                                 uint32_t             start_address);
+
+/**
+ * @brief Function for erasing the whole chip.
+ *
+ * All pages are invalidated, and then @ref nrfx_qspi_chip_erase is called.
+ *
+ * @return Value returned by @ref nrfx_qspi_chip_erase.
+ */
+nrfx_err_t nrfx_qspi_cache_chip_erase(void);
+
+/**
+ * @brief Function for invalidating the cached pages that overlap the given area.
+ *
+ * @param[in] address Start address of the area in memory.
+ * @param[in] length  Length of the area in bytes.
+ */
+void nrfx_qspi_cache_invalidate(uint32_t address, size_t length);
+
+/** @brief Function for invalidating all cached pages. */
+void nrfx_qspi_cache_invalidate_all(void);
+
+/**
+ * @brief Function for getting the cache counters.
+ *
+ * @param[out] p_stats Pointer to the structure to be filled with the counters.
+ */
+void nrfx_qspi_cache_stats_get(nrfx_qspi_cache_stats_t * p_stats);
+
+/** @brief Function for clearing the cache counters. */
+void nrfx_qspi_cache_stats_clear(void);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_QSPI_CACHE_H__
@@ -0,0 +1,307 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx.h>
+
+#if NRFX_CHECK(NRFX_QSPI_ENABLED)
+
+#include <helpers/nrfx_qspi_flash.h>
+
+#define QSPI_FLASH_CMD_RDSR  0x05 ///< Read status register.
+#define QSPI_FLASH_CMD_WRSR  0x01 ///< Write status register.
+#define QSPI_FLASH_CMD_RDSR2 0x35 ///< Read status register 2.
+#define QSPI_FLASH_CMD_WRSR2 0x31 ///< Write status register 2.
+#define QSPI_FLASH_CMD_RDCR  0x15 ///< Read configuration registers of Macronix memories.
+#define QSPI_FLASH_CMD_RDID  0x9F ///< Read JEDEC ID.
+#define QSPI_FLASH_CMD_EN4B  0xB7 ///< Enter 4-byte addressing.
+#define QSPI_FLASH_CMD_EX4B  0xE9 ///< Exit 4-byte addressing.
+
+#define QSPI_FLASH_SR1_QE_MASK    0x40       ///< Quad Enable bit in the status register.
+#define QSPI_FLASH_SR2_QE_MASK    0x02       ///< Quad Enable bit in the status register 2.
+#define QSPI_FLASH_CR2_HP_MASK    0x02       ///< High performance mode bit of Macronix memories.
+#define QSPI_FLASH_ID_FAMILY_MASK 0xFFFF00UL ///< Manufacturer ID and memory type in the JEDEC ID.
+
+/** @brief Largest size that can be addressed with 24-bit addresses. */
+#define QSPI_FLASH_24BIT_SIZE_MAX (16UL * 1024UL * 1024UL)
+
+/** @brief Time of waiting for a status register write to complete. */
+#define QSPI_FLASH_WRITE_WAIT_ATTEMPTS 1000
+#define QSPI_FLASH_WRITE_WAIT_DELAY_US 100
+
+/** @brief Known profiles. */
+static const nrfx_qspi_flash_profile_t m_profiles[] =
+{
+    {
+        .p_name        = "Macronix MX25R",
+        .jedec_id      = 0xC22800,
+        .jedec_id_mask = QSPI_FLASH_ID_FAMILY_MASK,
+        .qe            = NRFX_QSPI_FLASH_QE_SR1_BIT6,
+        .high_perf     = true,
+        .readoc        = NRF_QSPI_READOC_READ4IO,
+        .writeoc       = NRF_QSPI_WRITEOC_PP4IO,
+        .sck_max_hz    = 80000000,
+    },
+    {
+        .p_name        = "Macronix MX25L",
+        .jedec_id      = 0xC22000,
+        .jedec_id_mask = QSPI_FLASH_ID_FAMILY_MASK,
+        .qe            = NRFX_QSPI_FLASH_QE_SR1_BIT6,
+        .high_perf     = false,
+        .readoc        = NRF_QSPI_READOC_READ4IO,
+        .writeoc       = NRF_QSPI_WRITEOC_PP4IO,
+        .sck_max_hz    = 104000000,
+    },
+    {
+        .p_name        = "Winbond W25Q IQ",
+        .jedec_id      = 0xEF4000,
+        .jedec_id_mask = QSPI_FLASH_ID_FAMILY_MASK,
+        .qe            = NRFX_QSPI_FLASH_QE_SR2_BIT1,
+        .high_perf     = false,
+        .readoc        = NRF_QSPI_READOC_READ4IO,
+        .writeoc       = NRF_QSPI_WRITEOC_PP4O,
+        .sck_max_hz    = 104000000,
+    },
+    {
+        .p_name        = "Winbond W25Q IM",
+        .jedec_id      = 0xEF7000,
+        .jedec_id_mask = QSPI_FLASH_ID_FAMILY_MASK,
+        .qe            = NRFX_QSPI_FLASH_QE_SR2_BIT1,
+        .high_perf     = false,
+        .readoc        = NRF_QSPI_READOC_READ4IO,
+        .writeoc       = NRF_QSPI_WRITEOC_PP4O,
+        .sck_max_hz    = 104000000,
+    },
+    {
+        .p_name        = "GigaDevice GD25Q",
+        .jedec_id      = 0xC84000,
+        .jedec_id_mask = QSPI_FLASH_ID_FAMILY_MASK,
+        .qe            = NRFX_QSPI_FLASH_QE_SR2_BIT1,
+        .high_perf     = false,
+        .readoc        = NRF_QSPI_READOC_READ4IO,
+        .writeoc       = NRF_QSPI_WRITEOC_PP4O,
+        .sck_max_hz    = 104000000,
+    },
+    {
+        .p_name        = "ISSI IS25LP",
+        .jedec_id      = 0x9D6000,
+        .jedec_id_mask = QSPI_FLASH_ID_FAMILY_MASK,
+        .qe            = NRFX_QSPI_FLASH_QE_SR1_BIT6,
+        .high_perf     = false,
+        .readoc        = NRF_QSPI_READOC_READ4IO,
+        .writeoc       = NRF_QSPI_WRITEOC_PP4O,
+        .sck_max_hz    = 104000000,
+    },
+};
+
+/**
+ * @brief Function for sending a custom instruction.
+ *
+ * The IO2 and IO3 lines are kept high, so that they are not taken as active WP# and HOLD#.
+ */
+static nrfx_err_t cinstr_xfer(uint8_t               opcode,
+                              nrf_qspi_cinstr_len_t length,
+                              bool                  wren,
+                              void const *          p_tx_buffer,
+                              void *                p_rx_buffer)
+{
+    nrf_qspi_cinstr_conf_t config = NRFX_QSPI_DEFAULT_CINSTR(opcode, length);
+
+    config.io2_level = true;
+    config.io3_level = true;
+    config.wren      = wren;
+    config.wipwait   = wren;
+    return nrfx_qspi_cinstr_xfer(&config, p_tx_buffer, p_rx_buffer);
+}
+
+/** @brief Function for writing registers of the memory and waiting for the write to complete. */
+static nrfx_err_t register_write(uint8_t opcode, nrf_qspi_cinstr_len_t length, void const * p_data)
+{
+    nrfx_err_t err_code = cinstr_xfer(opcode, length, true, p_data, NULL);
+    bool       ready;
+
+    if (err_code != NRFX_SUCCESS)
+    {
+        return err_code;
+    }
+
+    NRFX_WAIT_FOR(nrfx_qspi_mem_busy_check() == NRFX_SUCCESS,
+                  QSPI_FLASH_WRITE_WAIT_ATTEMPTS,
+                  QSPI_FLASH_WRITE_WAIT_DELAY_US,
+                  ready);
+    return ready ? NRFX_SUCCESS : NRFX_ERROR_TIMEOUT;
+}
+
+static nrfx_err_t quad_enable(nrfx_qspi_flash_profile_t const * p_profile)
+{
+    nrfx_err_t err_code;
+    uint8_t    regs[3] = { 0 };
+
+    switch (p_profile->qe)
+    {
+        case NRFX_QSPI_FLASH_QE_SR1_BIT6:
+            err_code = cinstr_xfer(QSPI_FLASH_CMD_RDSR, NRF_QSPI_CINSTR_LEN_2B, false,
+                                   NULL, &regs[0]);
+            if ((err_code == NRFX_SUCCESS) && p_profile->high_perf)
+            {
+                // Configuration registers 1 and 2 are written together with the status register.
+                err_code = cinstr_xfer(QSPI_FLASH_CMD_RDCR, NRF_QSPI_CINSTR_LEN_3B, false,
+                                       NULL, &regs[1]);
+            }
+            if (err_code != NRFX_SUCCESS)
+            {
+                return err_code;
+            }
+            if ((regs[0] & QSPI_FLASH_SR1_QE_MASK) &&
+                (!p_profile->high_perf || (regs[2] & QSPI_FLASH_CR2_HP_MASK)))
+            {
+                return NRFX_SUCCESS;
+            }
+            regs[0] |= QSPI_FLASH_SR1_QE_MASK;
+            regs[2] |= QSPI_FLASH_CR2_HP_MASK;
+            return register_write(QSPI_FLASH_CMD_WRSR,
+                                  p_profile->high_perf ? NRF_QSPI_CINSTR_LEN_4B
+                                                       : NRF_QSPI_CINSTR_LEN_2B,
+                                  regs);
+
+        case NRFX_QSPI_FLASH_QE_SR2_BIT1:
+            err_code = cinstr_xfer(QSPI_FLASH_CMD_RDSR2, NRF_QSPI_CINSTR_LEN_2B, false,
+                                   NULL, &regs[0]);
+            if ((err_code != NRFX_SUCCESS) || (regs[0] & QSPI_FLASH_SR2_QE_MASK))
+            {
+                return err_code;
+            }
+            regs[0] |= QSPI_FLASH_SR2_QE_MASK;
+            return register_write(QSPI_FLASH_CMD_WRSR2, NRF_QSPI_CINSTR_LEN_2B, regs);
+
+        default:
+            return NRFX_SUCCESS;
+    }
+}
+
+/** @brief Function for getting the divider of the highest SCK frequency not above the given one. */
+static nrf_qspi_frequency_t sck_freq_get(uint32_t sck_max_hz)
+{
+    uint32_t div = NRFX_CEIL_DIV(NRF_QSPI_BASE_CLOCK_FREQ, sck_max_hz);
+
+    div = NRFX_MAX(div, 1);
+    div = NRFX_MIN(div, (uint32_t)NRF_QSPI_FREQ_DIV16 + 1);
+    return (nrf_qspi_frequency_t)(div - 1);
+}
+
+nrfx_err_t nrfx_qspi_flash_detect(nrfx_qspi_flash_info_t * p_info)
+{
+    NRFX_ASSERT(p_info);
+
+    uint8_t    id[3];
+    nrfx_err_t err_code = cinstr_xfer(QSPI_FLASH_CMD_RDID, NRF_QSPI_CINSTR_LEN_4B, false,
+                                      NULL, id);
+
+    p_info->jedec_id  = 0;
+    p_info->size      = 0;
+    p_info->p_profile = NULL;
+    if (err_code != NRFX_SUCCESS)
+    {
+        return err_code;
+    }
+
+    p_info->jedec_id = ((uint32_t)id[0] << 16) | ((uint32_t)id[1] << 8) | id[2];
+    // The capacity byte is the base 2 logarithm of the size for the supported families.
+    if ((id[2] >= 16) && (id[2] < 32))
+    {
+        p_info->size = 1UL << id[2];
+    }
+
+    for (size_t i = 0; i < NRFX_ARRAY_SIZE(m_profiles); i++)
+    {
+        if ((p_info->jedec_id & m_profiles[i].jedec_id_mask) == m_profiles[i].jedec_id)
+        {
+            p_info->p_profile = &m_profiles[i];
+            return NRFX_SUCCESS;
+        }
+    }
+    return NRFX_ERROR_NOT_SUPPORTED;
+}
+
+nrfx_err_t nrfx_qspi_flash_profile_apply(nrfx_qspi_flash_info_t const * p_info,
+                                         nrfx_qspi_config_t *           p_config,
+                                         nrfx_qspi_handler_t            handler,
+                                         void *                         p_context)
+{
+    NRFX_ASSERT(p_info);
+    NRFX_ASSERT(p_info->p_profile);
+    NRFX_ASSERT(p_config);
+
+    nrfx_qspi_flash_profile_t const * p_profile = p_info->p_profile;
+    nrfx_qspi_config_t                config    = *p_config;
+    bool                              addr_4b   = (p_info->size > QSPI_FLASH_24BIT_SIZE_MAX);
+    nrfx_err_t                        err_code;
+
+    err_code = quad_enable(p_profile);
+    if (err_code != NRFX_SUCCESS)
+    {
+        return err_code;
+    }
+
+    if (addr_4b && (p_config->prot_if.addrmode != NRF_QSPI_ADDRMODE_32BIT))
+    {
+        err_code = cinstr_xfer(QSPI_FLASH_CMD_EN4B, NRF_QSPI_CINSTR_LEN_1B, true, NULL, NULL);
+        if (err_code != NRFX_SUCCESS)
+        {
+            return err_code;
+        }
+    }
+
+    config.prot_if.readoc   = p_profile->readoc;
+    config.prot_if.writeoc  = p_profile->writeoc;
+    config.prot_if.addrmode = addr_4b ? NRF_QSPI_ADDRMODE_32BIT : NRF_QSPI_ADDRMODE_24BIT;
+    config.phy_if.sck_freq  = sck_freq_get(p_profile->sck_max_hz);
+
+    nrfx_qspi_uninit();
+    err_code = nrfx_qspi_init(&config, handler, p_context);
+    if (err_code != NRFX_SUCCESS)
+    {
+        nrfx_qspi_uninit();
+        (void)nrfx_qspi_init(p_config, handler, p_context);
+        if ((config.prot_if.addrmode == NRF_QSPI_ADDRMODE_32BIT) &&
+            (p_config->prot_if.addrmode != NRF_QSPI_ADDRMODE_32BIT))
+        {
+            (void)cinstr_xfer(QSPI_FLASH_CMD_EX4B, NRF_QSPI_CINSTR_LEN_1B, true, NULL, NULL);
+        }
+        return err_code;
+    }
+
+    *p_config = config;
+    return NRFX_SUCCESS;
+}
+
+#endif // NRFX_CHECK(NRFX_QSPI_ENABLED)
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_QSPI_FLASH_H__
+#define NRFX_QSPI_FLASH_H__
+
+#include <nrfx.h>
+#include <nrfx_qspi.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_qspi_flash QSPI flash profiles
+ * @{
+ * @ingroup nrfx_qspi
+ * @brief   Detection of external flash memories and switching of their performance profiles.
+ *
+ * A profile describes how to bring a family of flash memories into its fastest
+ * mode supported by the QSPI peripheral: the way the Quad Enable bit is set,
+ * the read and write opcodes, and the maximum SCK frequency. The families are
+ * recognized by the JEDEC ID. The 4-byte addressing is entered for memories larger
+ * than 16 MB, as told by the capacity byte of the ID.
+ *
+ * The QSPI peripheral uses the default number of dummy cycles of the memories,
+ * so the profiles do not change it.
+ *
+ * Typical use is to initialize the QSPI driver with a conservative configuration,
+ * such as @ref NRFX_QSPI_DEFAULT_CONFIG, call @ref nrfx_qspi_flash_detect,
+ * and then @ref nrfx_qspi_flash_profile_apply.
+ */
+
+/** @brief Methods of setting the Quad Enable bit. */
+typedef enum
+{
+    NRFX_QSPI_FLASH_QE_NONE,      ///< The memory has no Quad Enable bit.
+    NRFX_QSPI_FLASH_QE_SR1_BIT6,  ///< Bit 6 of the status register, written with WRSR (0x01).
+    NRFX_QSPI_FLASH_QE_SR2_BIT1,  ///< Bit 1 of the status register 2, written with WRSR2 (0x31).
+} nrfx_qspi_flash_qe_t;
+
+/** @brief Flash profile structure. */
+typedef struct
+{
+    char const *         p_name;        ///< Name of the memory family.
+    uint32_t             jedec_id;      ///< Manufacturer ID and memory type, in bits 23:8.
+    uint32_t             jedec_id_mask; ///< Mask applied to the JEDEC ID before it is compared.
+    nrfx_qspi_flash_qe_t qe;            ///< Method of setting the Quad Enable bit.
+    bool                 high_perf;     ///< Switch Macronix ultra low power memories to the high performance mode.
+    nrf_qspi_readoc_t    readoc;        ///< Read opcode.
+    nrf_qspi_writeoc_t   writeoc;       ///< Write opcode.
+    uint32_t             sck_max_hz;    ///< Maximum SCK frequency.
+} nrfx_qspi_flash_profile_t;
+
+/** @brief Structure with information about the detected memory. */
+typedef struct
+{
+    uint32_t                          jedec_id;  ///< JEDEC ID: manufacturer ID, memory type, and capacity.
+    uint32_t                          size;      ///< Size of the memory in bytes, or 0 if unknown.
+    nrfx_qspi_flash_profile_t const * p_profile; ///< Matching profile, or NULL if unknown.
+} nrfx_qspi_flash_info_t;
+
+/**
+ * @brief Function for reading the JEDEC ID of the memory and finding its profile.
+ *
+ * The QSPI driver must be initialized.
+ *
+ * @param[out] p_info Pointer to the structure to be filled with information about the memory.
+ *                    The JEDEC ID and the size are filled even if the profile is not found.
+ *
+ * @retval NRFX_SUCCESS             The profile was found.
+ * @retval NRFX_ERROR_NOT_SUPPORTED There is no profile for the memory.
+ * @retval NRFX_ERROR_BUSY          The driver currently handles another operation.
+ * @retval NRFX_ERROR_TIMEOUT       The external memory is busy or there are connection issues.
+ */
+nrfx_err_t nrfx_qspi_flash_detect(nrfx_qspi_flash_info_t * p_info);
+
+/**
+ * @brief Function for applying the profile to the memory and to the QSPI driver.
+ *
+ * The memory is configured first, and then the QSPI driver is reinitialized with
+ * the configuration updated with the profile. If any step fails, the previous
+ * configuration is restored, so either the whole profile is applied or none of it,
+ * except for the Quad Enable bit, which does not affect single line transfers.
+ *
+ * The QSPI driver must be initialized with @p p_config and must be idle.
+ *
+ * @param[in]     p_info    Pointer to the information about the memory. Its profile is applied.
+ *                          It can be a profile other than the detected one.
+ * @param[in,out] p_config  Pointer to the current configuration of the driver.
+ *                          Updated with the profile on success.
+ * @param[in]     handler   Event handler passed to @ref nrfx_qspi_init.
+ * @param[in]     p_context Context passed to @ref nrfx_qspi_init.
+ *
+ * @retval NRFX_SUCCESS       The profile was applied.
+ * @retval NRFX_ERROR_BUSY    The driver currently handles another operation.
+ * @retval NRFX_ERROR_TIMEOUT The external memory is busy or there are connection issues.
+ */
+nrfx_err_t nrfx_qspi_flash_profile_apply(nrfx_qspi_flash_info_t const * p_info,
+                                         nrfx_qspi_config_t *           p_config,
+                                         nrfx_qspi_handler_t            handler,
+                                         void *                         p_context);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_QSPI_FLASH_H__
@@ -0,0 +1,332 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx.h>
+
+#if NRFX_CHECK(NRFX_RTC_ENABLED)
+
+#include <helpers/nrfx_rtc_ext.h>
+#include <string.h>
+
+/** @brief Number of bits of the RTC counter. */
+#define RTC_EXT_COUNTER_BITS 24
+
+/** @brief Number of bits of the RTC counter half-period. */
+#define RTC_EXT_HALF_BITS    (RTC_EXT_COUNTER_BITS - 1)
+
+uint64_t nrfx_rtc_ext_time_get(nrfx_rtc_ext_t const * p_ext)
+{
+    NRFX_ASSERT(p_ext);
+
+    uint32_t generation = p_ext->generation;
+    uint32_t counter    = nrfx_rtc_counter_get(p_ext->p_rtc);
+
+    // The most significant bit of the counter is expected to match the parity
+    // of the generation. If it does not, the next half-period boundary has been
+    // crossed, but not processed yet, or the generation was updated after it was read.
+    // Either way, the counter value is already one half-period ahead.
+    if (((counter >> RTC_EXT_HALF_BITS) ^ generation) & 1)
+    {
+        generation++;
+    }
+    return ((uint64_t)(generation >> 1) << RTC_EXT_COUNTER_BITS) | counter;
+}
+
+/**
+ * @brief Function for programming the compare channel for the earliest alarm
+ *        or the next half-period boundary, whichever comes first.
+ *
+ * The compare channel is left untouched if it already holds the target that is still
+ * far enough ahead of the counter. Must be called with interrupts disabled.
+ *
+ * @param[in] p_ext Pointer to the instance structure.
+ */
+static void rtc_ext_schedule(nrfx_rtc_ext_t * p_ext)
+{
+    uint64_t now    = nrfx_rtc_ext_time_get(p_ext);
+    uint64_t target = ((now >> RTC_EXT_HALF_BITS) + 1) << RTC_EXT_HALF_BITS;
+
+    if (p_ext->p_head && (p_ext->p_head->expiry < target))
+    {
+        target = p_ext->p_head->expiry;
+    }
+
+    if ((target == p_ext->cc_target) && (target >= now + NRFX_RTC_EXT_MIN_DELTA))
+    {
+        return;
+    }
+
+    // The COMPARE event is guaranteed only if the compare value is at least
+    // NRFX_RTC_EXT_MIN_DELTA ticks ahead of the counter when it is written.
+    // The counter is read back after the write, so if this cannot be confirmed,
+    // the target is moved forward and written again. An alarm that becomes due
+    // in the meantime is then handled at most NRFX_RTC_EXT_MIN_DELTA ticks late,
+    // but never lost.
+    for (;;)
+    {
+        if (target < now + NRFX_RTC_EXT_MIN_DELTA)
+        {
+            target = now + NRFX_RTC_EXT_MIN_DELTA;
+        }
+        (void)nrfx_rtc_cc_set(p_ext->p_rtc,
+                              p_ext->channel,
+                              (uint32_t)target & NRF_RTC_COUNTER_MAX,
+                              true);
+        p_ext->stats.reprogramming++;
+        now = nrfx_rtc_ext_time_get(p_ext);
+        if (target >= now + NRFX_RTC_EXT_MIN_DELTA)
+        {
+            break;
+        }
+    }
+    p_ext->cc_target = target;
+}
+
+static void rtc_ext_unlink(nrfx_rtc_ext_t * p_ext, nrfx_rtc_ext_alarm_t * p_alarm)
+{
+    nrfx_rtc_ext_alarm_t ** pp_item = &p_ext->p_head;
+
+    while (*pp_item != p_alarm)
+    {
+        NRFX_ASSERT(*pp_item);
+        pp_item = &(*pp_item)->p_next;
+    }
+    *pp_item = p_alarm->p_next;
+    p_alarm->active = false;
+}
+
+void nrfx_rtc_ext_init(nrfx_rtc_ext_t * p_ext, nrfx_rtc_t const * p_rtc, uint32_t channel)
+{
+    NRFX_ASSERT(p_ext);
+    NRFX_ASSERT(p_rtc);
+    NRFX_ASSERT(channel < p_rtc->cc_channel_count);
+
+    p_ext->p_rtc     = p_rtc;
+    p_ext->channel   = channel;
+    p_ext->p_head    = NULL;
+    p_ext->cc_target = 0;
+    nrfx_rtc_ext_stats_clear(p_ext);
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    p_ext->generation = nrfx_rtc_counter_get(p_rtc) >> RTC_EXT_HALF_BITS;
+    rtc_ext_schedule(p_ext);
+    NRFX_CRITICAL_SECTION_EXIT();
+}
+
+void nrfx_rtc_ext_uninit(nrfx_rtc_ext_t * p_ext)
+{
+    NRFX_ASSERT(p_ext);
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    (void)nrfx_rtc_cc_disable(p_ext->p_rtc, p_ext->channel);
+    while (p_ext->p_head)
+    {
+        rtc_ext_unlink(p_ext, p_ext->p_head);
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+}
+
+void nrfx_rtc_ext_alarm_init(nrfx_rtc_ext_alarm_t *       p_alarm,
+                             nrfx_rtc_ext_alarm_handler_t handler,
+                             void *                       p_context)
+{
+    NRFX_ASSERT(p_alarm);
+    NRFX_ASSERT(handler);
+
+    p_alarm->p_next    = NULL;
+    p_alarm->expiry    = 0;
+    p_alarm->active    = false;
+    p_alarm->handler   = handler;
+    p_alarm->p_context = p_context;
+}
+
+nrfx_err_t nrfx_rtc_ext_alarm_start(nrfx_rtc_ext_t *       p_ext,
+                                    nrfx_rtc_ext_alarm_t * p_alarm,
+                                    uint64_t               expiry)
+{
+    NRFX_ASSERT(p_ext);
+    NRFX_ASSERT(p_alarm);
+
+    nrfx_err_t err_code = NRFX_SUCCESS;
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    if (expiry <= nrfx_rtc_ext_time_get(p_ext))
+    {
+        err_code = NRFX_ERROR_TIMEOUT;
+    }
+    else
+    {
+        nrfx_rtc_ext_alarm_t * p_head = p_ext->p_head;
+
+        if (p_alarm->active)
+        {
+            rtc_ext_unlink(p_ext, p_alarm);
+        }
+
+        // Alarms with equal expiry times are kept in the order of starting.
+        nrfx_rtc_ext_alarm_t ** pp_item = &p_ext->p_head;
+        while (*pp_item && ((*pp_item)->expiry <= expiry))
+        {
+            pp_item = &(*pp_item)->p_next;
+        }
+        p_alarm->expiry = expiry;
+        p_alarm->p_next = *pp_item;
+        p_alarm->active = true;
+        *pp_item = p_alarm;
+
+        // The compare channel needs an update only if the earliest alarm changed,
+        // including the case of the earliest alarm being rescheduled.
+        if ((p_ext->p_head != p_head) || (p_head == p_alarm))
+        {
+            rtc_ext_schedule(p_ext);
+        }
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    return err_code;
+}
+
+bool nrfx_rtc_ext_alarm_stop(nrfx_rtc_ext_t * p_ext, nrfx_rtc_ext_alarm_t * p_alarm)
+{
+    NRFX_ASSERT(p_ext);
+    NRFX_ASSERT(p_alarm);
+
+    bool was_active;
+
+    // The compare channel is reprogrammed only if the earliest alarm is stopped,
+    // so that it does not cause a needless wakeup.
+    NRFX_CRITICAL_SECTION_ENTER();
+    was_active = p_alarm->active;
+    if (was_active)
+    {
+        bool was_head = (p_ext->p_head == p_alarm);
+
+        rtc_ext_unlink(p_ext, p_alarm);
+        if (was_head)
+        {
+            rtc_ext_schedule(p_ext);
+        }
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    return was_active;
+}
+
+bool nrfx_rtc_ext_next_expiry_get(nrfx_rtc_ext_t const * p_ext, uint64_t * p_expiry)
+{
+    NRFX_ASSERT(p_ext);
+    NRFX_ASSERT(p_expiry);
+
+    bool found = false;
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    if (p_ext->p_head)
+    {
+        *p_expiry = p_ext->p_head->expiry;
+        found = true;
+    }
+    NRFX_CRITICAL_SECTION_EXIT();
+
+    return found;
+}
+
+void nrfx_rtc_ext_stats_get(nrfx_rtc_ext_t const * p_ext, nrfx_rtc_ext_stats_t * p_stats)
+{
+    NRFX_ASSERT(p_ext);
+    NRFX_ASSERT(p_stats);
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    *p_stats = p_ext->stats;
+    NRFX_CRITICAL_SECTION_EXIT();
+}
+
+void nrfx_rtc_ext_stats_clear(nrfx_rtc_ext_t * p_ext)
+{
+    NRFX_ASSERT(p_ext);
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    memset(&p_ext->stats, 0, sizeof(p_ext->stats));
+    NRFX_CRITICAL_SECTION_EXIT();
+}
+
+void nrfx_rtc_ext_irq_handler(nrfx_rtc_ext_t * p_ext, nrfx_rtc_int_type_t int_type)
+{
+    NRFX_ASSERT(p_ext);
+
+    if ((uint32_t)int_type != p_ext->channel)
+    {
+        return;
+    }
+
+    bool expired = false;
+
+    p_ext->stats.wakeups++;
+    for (;;)
+    {
+        nrfx_rtc_ext_alarm_t * p_alarm;
+        uint64_t               now;
+
+        NRFX_CRITICAL_SECTION_ENTER();
+        now = nrfx_rtc_ext_time_get(p_ext);
+        // This is the only place apart from the initialization where the generation
+        // is updated, so the stores never go backwards.
+        p_ext->generation = (uint32_t)(now >> RTC_EXT_HALF_BITS);
+
+        p_alarm = p_ext->p_head;
+        if (p_alarm && (p_alarm->expiry <= now))
+        {
+            p_ext->p_head   = p_alarm->p_next;
+            p_alarm->active = false;
+            p_ext->stats.alarms++;
+            expired = true;
+        }
+        else
+        {
+            p_alarm = NULL;
+            if (!expired)
+            {
+                p_ext->stats.idle_wakeups++;
+            }
+            rtc_ext_schedule(p_ext);
+        }
+        NRFX_CRITICAL_SECTION_EXIT();
+
+        if (!p_alarm)
+        {
+            break;
+        }
+        p_alarm->handler(p_alarm, now);
+    }
+}
+
+#endif // NRFX_CHECK(NRFX_RTC_ENABLED)
@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_RTC_EXT_H__
+#define NRFX_RTC_EXT_H__
+
+#include <nrfx.h>
+#include <nrfx_rtc.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_rtc_ext Extended RTC time layer
+ * @{
+ * @ingroup nrfx
+ * @brief   64-bit monotonic time and multiplexed software alarms on top of the RTC driver.
+ *
+ * The layer extends the 24-bit RTC counter to 64 bits and serves any number of alarms
+ * using a single compare channel. The extended time is derived from a half-period
+ * generation counter, which is updated with a single store at least twice per counter
+ * period. The time can therefore be read from any context, including interrupt handlers
+ * of priority higher than the RTC one, without a critical section and without retrying.
+ *
+ * The RTC driver instance must be initialized by the user, who forwards the compare events
+ * of the selected channel from the RTC driver handler to @ref nrfx_rtc_ext_irq_handler.
+ * The interrupt handler must not be delayed by more than a half of the counter period.
+ *
+ * The layer is suitable for tickless operation. The compare channel is reprogrammed only
+ * when the earliest alarm changes, so the CPU is woken up only for the alarm expiries
+ * and for the half-period boundaries, that is once every 2^23 ticks at most.
+ * @ref nrfx_rtc_ext_next_expiry_get provides the time until which the CPU can sleep,
+ * and the wakeup statistics can be used for power profiling.
+ */
+
+/** @brief Minimum distance, in ticks, between the counter and a compare value that guarantees the COMPARE event. */
+#define NRFX_RTC_EXT_MIN_DELTA 2
+
+/** @brief Alarm structure. */
+typedef struct nrfx_rtc_ext_alarm_s nrfx_rtc_ext_alarm_t;
+
+/**
+ * @brief Alarm handler type.
+ *
+ * @param[in] p_alarm Pointer to the expired alarm. The alarm can be started again from the handler.
+ * @param[in] now     Time at which the alarm was processed, in ticks. It is never earlier than
+ *                    the expiry time and is later only by the interrupt latency, or by
+ *                    @ref NRFX_RTC_EXT_MIN_DELTA ticks at most for alarms that were started
+ *                    too close to their expiry time to program the compare channel.
+ */
+typedef void (* nrfx_rtc_ext_alarm_handler_t)(nrfx_rtc_ext_alarm_t * p_alarm, uint64_t now);
+
+/** @brief Alarm structure. */
+struct nrfx_rtc_ext_alarm_s
+{
+    nrfx_rtc_ext_alarm_t *       p_next;    ///< Next alarm in the queue. For internal use only.
+    uint64_t                     expiry;    ///< Absolute expiry time in ticks. For internal use only.
+    bool                         active;    ///< True if the alarm is in the queue. For internal use only.
+    nrfx_rtc_ext_alarm_handler_t handler;   ///< Alarm handler.
+    void *                       p_context; ///< User context.
+};
+
+/** @brief Wakeup statistics. */
+typedef struct
+{
+    uint32_t wakeups;       ///< Number of compare events handled.
+    uint32_t idle_wakeups;  ///< Number of compare events after which no alarm expired.
+    uint32_t alarms;        ///< Number of expired alarms.
+    uint32_t reprogramming; ///< Number of writes to the compare channel.
+} nrfx_rtc_ext_stats_t;
+
+/** @brief Extended RTC time instance structure. */
+typedef struct
+{
+    nrfx_rtc_t const *     p_rtc;      ///< RTC driver instance. For internal use only.
+    uint32_t               channel;    ///< Compare channel used for alarms. For internal use only.
+    volatile uint32_t      generation; ///< Number of counter half-periods elapsed. For internal use only.
+    nrfx_rtc_ext_alarm_t * p_head;     ///< Queue of active alarms sorted by expiry time. For internal use only.
+    uint64_t               cc_target;  ///< Time programmed in the compare channel. For internal use only.
+    nrfx_rtc_ext_stats_t   stats;      ///< Wakeup statistics. For internal use only.
+} nrfx_rtc_ext_t;
+
+/**
+ * @brief Function for initializing the extended RTC time instance.
+ *
+ * @note The RTC driver instance must be initialized before and enabled by the user,
+ *       with the reliable mode disabled, as late compare values are handled by this layer.
+ *
+ * @param[out] p_ext   Pointer to the instance structure.
+ * @param[in]  p_rtc   Pointer to the RTC driver instance.
+ * @param[in]  channel Compare channel to be used exclusively by this layer.
+ */
+void nrfx_rtc_ext_init(nrfx_rtc_ext_t * p_ext, nrfx_rtc_t const * p_rtc, uint32_t channel);
+
+/**
+ * @brief Function for uninitializing the extended RTC time instance.
+ *
+ * Active alarms are discarded without calling their handlers.
+ *
+ * @param[in] p_ext Pointer to the instance structure.
+ */
+void nrfx_rtc_ext_uninit(nrfx_rtc_ext_t * p_ext);
+
+/**
+ * @brief Function for getting the 64-bit monotonic time.
+ *
+ * This function does not use a critical section and can be called from any context.
+ *
+ * @param[in] p_ext Pointer to the instance structure.
+ *
+ * @return Time in RTC ticks.
+ */
+uint64_t nrfx_rtc_ext_time_get(nrfx_rtc_ext_t const * p_ext);
+
+/**
+ * @brief Function for initializing an alarm.
+ *
+ * @param[out] p_alarm   Pointer to the alarm structure.
+ * @param[in]  handler   Alarm handler. Must not be NULL.
+ * @param[in]  p_context User context.
+ */
+void nrfx_rtc_ext_alarm_init(nrfx_rtc_ext_alarm_t *       p_alarm,
+                             nrfx_rtc_ext_alarm_handler_t handler,
+                             void *                       p_context);
+
+/**
+ * @brief Function for starting an alarm at an absolute time.
+ *
+ * If the alarm is already active, it is rescheduled. Alarms with equal expiry
+ * times expire in the order in which they were started.
+ *
+ * @param[in] p_ext   Pointer to the instance structure.
+ * @param[in] p_alarm Pointer to the alarm initialized with @ref nrfx_rtc_ext_alarm_init.
+ * @param[in] expiry  Absolute expiry time in ticks.
+ *
+ * @retval NRFX_SUCCESS       The alarm was started.
+ * @retval NRFX_ERROR_TIMEOUT The expiry time is not later than the current time.
+ *                            The alarm was not started.
+ */
+nrfx_err_t nrfx_rtc_ext_alarm_start(nrfx_rtc_ext_t *       p_ext,
+                                    nrfx_rtc_ext_alarm_t * p_alarm,
+                                    uint64_t               expiry);
+
+/**
+ * @brief Function for stopping an alarm.
+ *
+ * @param[in] p_ext   Pointer to the instance structure.
+ * @param[in] p_alarm Pointer to the alarm.
+ *
+ * @retval true  The alarm was active and has been stopped.
+ * @retval false The alarm was not active.
+ */
+bool nrfx_rtc_ext_alarm_stop(nrfx_rtc_ext_t * p_ext, nrfx_rtc_ext_alarm_t * p_alarm);
+
+/**
+ * @brief Function for getting the expiry time of the earliest active alarm.
+ *
+ * The function can be used before entering the idle state to decide how long the CPU
+ * can sleep and whether a deeper low power mode is worth entering.
+ *
+ * @param[in]  p_ext    Pointer to the instance structure.
+ * @param[out] p_expiry Absolute expiry time of the earliest alarm, in ticks.
+ *
+ * @retval true  The earliest alarm expiry time was provided.
+ * @retval false There is no active alarm.
+ */
+bool nrfx_rtc_ext_next_expiry_get(nrfx_rtc_ext_t const * p_ext, uint64_t * p_expiry);
+
+/**
+ * @brief Function for getting the wakeup statistics.
+ *
+ * @param[in]  p_ext   Pointer to the instance structure.
+ * @param[out] p_stats Pointer to the structure to be filled with the statistics.
+ */
+void nrfx_rtc_ext_stats_get(nrfx_rtc_ext_t const * p_ext, nrfx_rtc_ext_stats_t * p_stats);
+
+/**
+ * @brief Function for clearing the wakeup statistics.
+ *
+ * @param[in] p_ext Pointer to the instance structure.
+ */
+void nrfx_rtc_ext_stats_clear(nrfx_rtc_ext_t * p_ext);
+
+/**
+ * @brief Function for handling the RTC events used by the extended RTC time layer.
+ *
+ * Call this function from the RTC driver event handler. Events other than the compare
+ * event of the channel used by this layer are ignored.
+ *
+ * @param[in] p_ext    Pointer to the instance structure.
+ * @param[in] int_type Interrupt type reported to the RTC driver event handler.
+ */
+void nrfx_rtc_ext_irq_handler(nrfx_rtc_ext_t * p_ext, nrfx_rtc_int_type_t int_type);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_RTC_EXT_H__
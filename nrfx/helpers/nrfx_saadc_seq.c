@@ -0,0 +1,330 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <nrfx.h>
+
+#if NRFX_CHECK(NRFX_SAADC_ENABLED) && NRFX_CHECK(NRFX_TIMER_ENABLED)
+
+#include <helpers/nrfx_saadc_seq.h>
+
+/** @brief Frequency of the TIMER instance that generates the ticks. */
+#define SEQ_TIMER_FREQUENCY_HZ 16000000UL
+
+/** @brief Compare channel that generates the ticks. */
+#define SEQ_CC_CHANNEL NRF_TIMER_CC_CHANNEL0
+
+/** @brief Control block of the sequencer. Per-stream fields are indexed by the channel. */
+typedef struct
+{
+    nrfx_timer_t const *     p_timer;                 ///< TIMER driver instance generating the ticks.
+    nrfx_saadc_seq_handler_t handler;                 ///< Sequencer handler.
+    void *                   p_context;               ///< User context.
+    nrf_saadc_value_t *      p_buffer[SAADC_CH_NUM];  ///< Stream buffers.
+    uint16_t                 size[SAADC_CH_NUM];      ///< Sizes of the stream buffers.
+    uint16_t                 fill[SAADC_CH_NUM];      ///< Number of samples in the stream buffers.
+    uint32_t                 divider[SAADC_CH_NUM];   ///< Ticks between samples of the channel.
+    uint32_t                 countdown[SAADC_CH_NUM]; ///< Ticks left until the channel is due.
+    nrf_saadc_value_t        scan[SAADC_CH_NUM];      ///< Results of the last scan.
+    uint32_t                 streams_mask;            ///< Channels that have a stream.
+    uint32_t                 active_mask;             ///< Channels activated in the SAADC driver.
+    uint32_t                 pending_mask;            ///< Channels that are due and not yet scanned.
+    uint32_t                 overruns;                ///< Ticks on which a scan was in progress.
+    nrf_saadc_resolution_t   resolution;              ///< Resolution of all conversions.
+    nrf_saadc_oversample_t   oversampling;            ///< Oversampling of all conversions.
+    volatile bool            busy;                    ///< A scan is in progress.
+    bool                     initialized;             ///< The sequencer is initialized.
+} saadc_seq_cb_t;
+
+static saadc_seq_cb_t m_cb;
+
+static uint16_t channel_count_get(uint32_t channel_mask)
+{
+    uint16_t count = 0;
+
+    while (channel_mask)
+    {
+        channel_mask &= channel_mask - 1;
+        count++;
+    }
+    return count;
+}
+
+static void saadc_event_handler(nrfx_saadc_evt_t const * p_event)
+{
+    if ((p_event->type != NRFX_SAADC_EVT_DONE) || !m_cb.initialized)
+    {
+        return;
+    }
+
+    // Results of a scan are stored in the order of the channel indexes.
+    nrf_saadc_value_t const * p_sample = p_event->data.done.p_buffer;
+    uint32_t                  mask     = m_cb.active_mask;
+
+    while (mask)
+    {
+        uint8_t channel = NRF_CTZ(mask);
+        mask &= ~NRFX_BIT(channel);
+
+        m_cb.p_buffer[channel][m_cb.fill[channel]++] = *p_sample++;
+        if (m_cb.fill[channel] == m_cb.size[channel])
+        {
+            m_cb.fill[channel] = 0;
+            m_cb.handler(channel, m_cb.p_buffer[channel], m_cb.size[channel], m_cb.p_context);
+        }
+    }
+
+    m_cb.busy = false;
+}
+
+static void scan_start(void)
+{
+    nrfx_err_t err_code;
+    uint32_t   mask = m_cb.pending_mask;
+
+    // The channels are configured already, so switching the set only rewrites which
+    // of them are connected, and the scan buffer has to follow the new channel count.
+    if (mask != m_cb.active_mask)
+    {
+        err_code = nrfx_saadc_simple_mode_set(mask,
+                                              m_cb.resolution,
+                                              m_cb.oversampling,
+                                              saadc_event_handler);
+        NRFX_ASSERT(err_code == NRFX_SUCCESS);
+        err_code = nrfx_saadc_buffer_set(m_cb.scan, channel_count_get(mask));
+        NRFX_ASSERT(err_code == NRFX_SUCCESS);
+        m_cb.active_mask = mask;
+    }
+
+    m_cb.pending_mask = 0;
+    m_cb.busy = true;
+
+    err_code = nrfx_saadc_mode_trigger();
+    NRFX_ASSERT(err_code == NRFX_SUCCESS);
+    (void)err_code;
+}
+
+static void timer_event_handler(nrf_timer_event_t event_type, void * p_context)
+{
+    (void)p_context;
+
+    if (event_type != NRF_TIMER_EVENT_COMPARE0)
+    {
+        return;
+    }
+
+    uint32_t mask = m_cb.streams_mask;
+    while (mask)
+    {
+        uint8_t channel = NRF_CTZ(mask);
+        mask &= ~NRFX_BIT(channel);
+
+        if (m_cb.countdown[channel] == 0)
+        {
+            m_cb.pending_mask |= NRFX_BIT(channel);
+            m_cb.countdown[channel] = m_cb.divider[channel] - 1;
+        }
+        else
+        {
+            m_cb.countdown[channel]--;
+        }
+    }
+
+    if (!m_cb.pending_mask)
+    {
+        return;
+    }
+
+    // The channels that are due stay pending and are scanned on the next tick.
+    if (m_cb.busy)
+    {
+        m_cb.overruns++;
+        return;
+    }
+
+    scan_start();
+}
+
+nrfx_err_t nrfx_saadc_seq_init(nrfx_timer_t const *            p_timer,
+                               nrfx_saadc_seq_config_t const * p_config,
+                               nrfx_saadc_seq_handler_t        handler,
+                               void *                          p_context)
+{
+    NRFX_ASSERT(p_timer);
+    NRFX_ASSERT(p_config);
+    NRFX_ASSERT(p_config->p_streams);
+    NRFX_ASSERT(p_config->stream_count > 0);
+    NRFX_ASSERT(p_config->stream_count <= SAADC_CH_NUM);
+    NRFX_ASSERT(handler);
+
+    nrfx_err_t err_code;
+
+    if (m_cb.initialized)
+    {
+        return NRFX_ERROR_INVALID_STATE;
+    }
+
+    uint32_t streams_mask = 0;
+    uint32_t max_rate_hz  = 0;
+
+    for (uint8_t i = 0; i < p_config->stream_count; i++)
+    {
+        nrfx_saadc_seq_stream_t const * p_stream = &p_config->p_streams[i];
+
+        NRFX_ASSERT(p_stream->p_buffer);
+        NRFX_ASSERT(p_stream->size > 0);
+
+        if ((p_stream->channel >= SAADC_CH_NUM)          ||
+            (streams_mask & NRFX_BIT(p_stream->channel)) ||
+            (p_stream->rate_hz == 0))
+        {
+            return NRFX_ERROR_INVALID_PARAM;
+        }
+        streams_mask |= NRFX_BIT(p_stream->channel);
+        max_rate_hz = NRFX_MAX(max_rate_hz, p_stream->rate_hz);
+    }
+
+    if (max_rate_hz > SEQ_TIMER_FREQUENCY_HZ)
+    {
+        return NRFX_ERROR_INVALID_PARAM;
+    }
+
+    for (uint8_t i = 0; i < p_config->stream_count; i++)
+    {
+        nrfx_saadc_seq_stream_t const * p_stream = &p_config->p_streams[i];
+
+        if (max_rate_hz % p_stream->rate_hz)
+        {
+            return NRFX_ERROR_INVALID_PARAM;
+        }
+        m_cb.p_buffer[p_stream->channel] = p_stream->p_buffer;
+        m_cb.size[p_stream->channel]     = p_stream->size;
+        m_cb.divider[p_stream->channel]  = max_rate_hz / p_stream->rate_hz;
+    }
+
+    // Activating all the channels once checks that all of them are configured.
+    err_code = nrfx_saadc_simple_mode_set(streams_mask,
+                                          p_config->resolution,
+                                          p_config->oversampling,
+                                          saadc_event_handler);
+    if (err_code != NRFX_SUCCESS)
+    {
+        return err_code;
+    }
+    err_code = nrfx_saadc_buffer_set(m_cb.scan, channel_count_get(streams_mask));
+    if (err_code != NRFX_SUCCESS)
+    {
+        return err_code;
+    }
+
+    nrfx_timer_config_t timer_config =
+    {
+        .frequency          = NRF_TIMER_FREQ_16MHz,
+        .mode               = NRF_TIMER_MODE_TIMER,
+        .bit_width          = NRF_TIMER_BIT_WIDTH_32,
+        .interrupt_priority = p_config->interrupt_priority,
+        .p_context          = NULL,
+    };
+
+    err_code = nrfx_timer_init(p_timer, &timer_config, timer_event_handler);
+    if (err_code != NRFX_SUCCESS)
+    {
+        return err_code;
+    }
+
+    nrfx_timer_extended_compare(p_timer,
+                                SEQ_CC_CHANNEL,
+                                SEQ_TIMER_FREQUENCY_HZ / max_rate_hz,
+                                NRF_TIMER_SHORT_COMPARE0_CLEAR_MASK,
+                                true);
+
+    m_cb.p_timer      = p_timer;
+    m_cb.handler      = handler;
+    m_cb.p_context    = p_context;
+    m_cb.streams_mask = streams_mask;
+    m_cb.active_mask  = streams_mask;
+    m_cb.resolution   = p_config->resolution;
+    m_cb.oversampling = p_config->oversampling;
+    m_cb.busy         = false;
+    m_cb.initialized  = true;
+
+    return NRFX_SUCCESS;
+}
+
+void nrfx_saadc_seq_uninit(void)
+{
+    NRFX_ASSERT(m_cb.initialized);
+
+    nrfx_saadc_seq_stop();
+    nrfx_timer_uninit(m_cb.p_timer);
+    m_cb.initialized = false;
+}
+
+void nrfx_saadc_seq_start(void)
+{
+    NRFX_ASSERT(m_cb.initialized);
+
+    // Slower streams start at different phases, so that they are due on different ticks.
+    uint32_t mask  = m_cb.streams_mask;
+    uint8_t  phase = 0;
+    while (mask)
+    {
+        uint8_t channel = NRF_CTZ(mask);
+        mask &= ~NRFX_BIT(channel);
+
+        m_cb.fill[channel]      = 0;
+        m_cb.countdown[channel] = phase++ % m_cb.divider[channel];
+    }
+
+    m_cb.pending_mask = 0;
+    m_cb.overruns     = 0;
+
+    nrfx_timer_clear(m_cb.p_timer);
+    nrfx_timer_enable(m_cb.p_timer);
+}
+
+void nrfx_saadc_seq_stop(void)
+{
+    NRFX_ASSERT(m_cb.initialized);
+
+    nrfx_timer_disable(m_cb.p_timer);
+}
+
+uint32_t nrfx_saadc_seq_overruns_get(void)
+{
+    NRFX_ASSERT(m_cb.initialized);
+
+    return m_cb.overruns;
+}
+
+#endif // NRFX_CHECK(NRFX_SAADC_ENABLED) && NRFX_CHECK(NRFX_TIMER_ENABLED)
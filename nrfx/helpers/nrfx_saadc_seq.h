@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef NRFX_SAADC_SEQ_H__
+#define NRFX_SAADC_SEQ_H__
+
+#include <nrfx.h>
+#include <nrfx_saadc.h>
+#include <nrfx_timer.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_saadc_seq SAADC scan sequencer
+ * @{
+ * @ingroup nrfx
+ * @brief   Sampling of SAADC channels at individual rates.
+ *
+ * The sequencer runs a TIMER instance at the rate of the fastest stream. Every other rate
+ * must divide it evenly, so each stream is sampled on every N-th tick. On each tick
+ * the subset of channels that are due is converted in one scan of the simple mode. The set
+ * of active channels is only switched with @ref nrfx_saadc_simple_mode_set when it differs
+ * from the previous scan, so the channels are configured only once, by the user, with
+ * @ref nrfx_saadc_channels_config. Slower streams are spread over different ticks, so
+ * that they do not all extend the same scan.
+ *
+ * Samples of each channel are collected in the buffer of its stream, which is passed to
+ * the handler when full and then filled again from the start.
+ *
+ * The SAADC driver must be initialized and the channels configured. There is only one
+ * SAADC, so only one sequencer can exist. The SAADC driver must not be used by anything
+ * else while the sequencer runs.
+ */
+
+/**
+ * @brief Sequencer handler type.
+ *
+ * Called from the SAADC interrupt. The buffer is filled again after the handler returns,
+ * so the samples must be consumed or copied before that.
+ *
+ * @param[in] channel   SAADC channel index of the stream.
+ * @param[in] p_samples Pointer to the stream buffer.
+ * @param[in] size      Number of samples in the stream buffer.
+ * @param[in] p_context User context.
+ */
+typedef void (* nrfx_saadc_seq_handler_t)(uint8_t             channel,
+                                          nrf_saadc_value_t * p_samples,
+                                          uint16_t            size,
+                                          void *              p_context);
+
+/** @brief Stream configuration structure. */
+typedef struct
+{
+    uint8_t             channel;  ///< SAADC channel index, configured with @ref nrfx_saadc_channels_config.
+    uint32_t            rate_hz;  ///< Sampling rate of the channel, in Hz.
+    nrf_saadc_value_t * p_buffer; ///< Stream buffer.
+    uint16_t            size;     ///< Number of samples in the stream buffer.
+} nrfx_saadc_seq_stream_t;
+
+/** @brief Sequencer configuration structure. */
+typedef struct
+{
+    nrfx_saadc_seq_stream_t const * p_streams;          ///< Array of streams, one per channel.
+    uint8_t                         stream_count;       ///< Number of streams.
+    nrf_saadc_resolution_t          resolution;         ///< Resolution of all conversions.
+    nrf_saadc_oversample_t          oversampling;       ///< Oversampling of all conversions.
+    uint8_t                         interrupt_priority; ///< Interrupt priority of the TIMER instance.
+} nrfx_saadc_seq_config_t;
+
+/**
+ * @brief Function for initializing the sequencer.
+ *
+ * @param[in] p_timer   Pointer to the TIMER driver instance, which must not be initialized.
+ * @param[in] p_config  Pointer to the sequencer configuration.
+ * @param[in] handler   Sequencer handler. Must not be NULL.
+ * @param[in] p_context User context passed to the handler.
+ *
+ * @retval NRFX_SUCCESS             The sequencer was initialized.
+ * @retval NRFX_ERROR_INVALID_STATE The sequencer or the TIMER driver instance is already
+ *                                  initialized.
+ * @retval NRFX_ERROR_INVALID_PARAM A channel is used by more than one stream or is not
+ *                                  configured, or a rate does not divide the rate of
+ *                                  the fastest stream.
+ * @retval NRFX_ERROR_BUSY          There is a conversion or calibration ongoing.
+ */
+nrfx_err_t nrfx_saadc_seq_init(nrfx_timer_t const *            p_timer,
+                               nrfx_saadc_seq_config_t const * p_config,
+                               nrfx_saadc_seq_handler_t        handler,
+                               void *                          p_context);
+
+/** @brief Function for uninitializing the sequencer. The sequencer is stopped first. */
+void nrfx_saadc_seq_uninit(void);
+
+/**
+ * @brief Function for starting the sequencer.
+ *
+ * All streams are filled from the start.
+ */
+void nrfx_saadc_seq_start(void);
+
+/**
+ * @brief Function for stopping the sequencer.
+ *
+ * A scan that is in progress is completed.
+ */
+void nrfx_saadc_seq_stop(void);
+
+/**
+ * @brief Function for getting the number of ticks on which a scan was still in progress.
+ *
+ * The channels that were due on such a tick are sampled on the next one instead.
+ *
+ * @return Number of overruns since @ref nrfx_saadc_seq_start.
+ */
+uint32_t nrfx_saadc_seq_overruns_get(void);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_SAADC_SEQ_H__
@@ -0,0 +1,360 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx.h>
+
+#if NRFX_CHECK(NRFX_TIMER_ENABLED) && NRFX_CHECK(NRFX_GPIOTE_ENABLED) && \
+    (defined(PPI_FEATURE_FORKS_PRESENT) || defined(DPPI_PRESENT)) &&   \
+    defined(GPIOTE_FEATURE_SET_PRESENT) && defined(GPIOTE_FEATURE_CLR_PRESENT)
+
+#include <helpers/nrfx_soft_pwm.h>
+#include <helpers/nrfx_gppi.h>
+#include <nrfx_gpiote.h>
+
+/** @brief Function for getting the capture/compare channel that defines the period. */
+static nrf_timer_cc_channel_t period_cc_channel_get(nrfx_soft_pwm_t const * p_pwm)
+{
+    return (nrf_timer_cc_channel_t)(p_pwm->p_timer->cc_channel_count - 1);
+}
+
+/** @brief Function for getting the number of channels setting the outputs. */
+static uint8_t period_channel_count_get(uint8_t output_count)
+{
+#if defined(DPPI_PRESENT)
+    (void)output_count;
+    return 1;
+#else
+    // Each PPI channel sets two outputs, with its task and its fork.
+    return (uint8_t)((output_count + 1) / 2);
+#endif
+}
+
+/** @brief Function for checking if the duty cycle requires the GPIOTE task to be enabled. */
+static bool duty_in_range_check(nrfx_soft_pwm_t const * p_pwm, uint32_t duty)
+{
+    return (duty > 0) && (duty < p_pwm->top_value);
+}
+
+/** @brief Function for getting the current counter value. */
+static uint32_t counter_get(nrfx_soft_pwm_t const * p_pwm)
+{
+    nrf_timer_cc_channel_t period_cc = period_cc_channel_get(p_pwm);
+
+    // The period channel is borrowed for the capture. A COMPARE event is generated only
+    // when the counter is incremented to the CC value, so neither the capture nor the
+    // restore can generate it.
+    uint32_t now = nrfx_timer_capture(p_pwm->p_timer, period_cc);
+    nrf_timer_cc_set(p_pwm->p_timer->p_reg, period_cc, p_pwm->top_value);
+    return now;
+}
+
+static void resources_release(nrfx_soft_pwm_t * p_pwm,
+                              uint8_t           output_count,
+                              uint8_t           duty_channel_count,
+                              uint8_t           period_channel_count)
+{
+    for (uint8_t i = 0; i < output_count; i++)
+    {
+        (void)nrfx_gpiote_pin_uninit(p_pwm->output_pins[i]);
+        (void)nrfx_gpiote_channel_free(p_pwm->gpiote_channels[i]);
+    }
+    for (uint8_t i = 0; i < duty_channel_count; i++)
+    {
+        (void)nrfx_gppi_channel_free(p_pwm->duty_channels[i]);
+    }
+    for (uint8_t i = 0; i < period_channel_count; i++)
+    {
+        (void)nrfx_gppi_channel_free(p_pwm->period_channels[i]);
+    }
+}
+
+static nrfx_err_t output_configure(nrfx_soft_pwm_t * p_pwm, uint8_t output)
+{
+    nrfx_err_t err_code;
+    uint8_t    pin = p_pwm->output_pins[output];
+
+    err_code = nrfx_gpiote_channel_alloc(&p_pwm->gpiote_channels[output]);
+    if (err_code != NRFX_SUCCESS)
+    {
+        return err_code;
+    }
+
+    nrfx_gpiote_output_config_t output_config = NRFX_GPIOTE_DEFAULT_OUTPUT_CONFIG;
+    nrfx_gpiote_task_config_t   task_config   = {
+        .task_ch  = p_pwm->gpiote_channels[output],
+        .polarity = NRF_GPIOTE_POLARITY_TOGGLE,
+        .init_val = NRF_GPIOTE_INITIAL_VALUE_LOW
+    };
+
+    // The pin starts with the duty cycle of 0, driven directly with the task disabled.
+    nrf_gpio_pin_clear(pin);
+    err_code = nrfx_gpiote_output_configure(pin, &output_config, &task_config);
+    if (err_code != NRFX_SUCCESS)
+    {
+        (void)nrfx_gpiote_channel_free(p_pwm->gpiote_channels[output]);
+        return err_code;
+    }
+    nrfx_gpiote_out_task_disable(pin);
+
+    return NRFX_SUCCESS;
+}
+
+static nrfx_err_t resources_alloc(nrfx_soft_pwm_t * p_pwm, uint8_t period_channel_count)
+{
+    nrfx_err_t err_code   = NRFX_SUCCESS;
+    uint8_t    outputs    = 0;
+    uint8_t    duty_chs   = 0;
+    uint8_t    period_chs = 0;
+
+    while ((err_code == NRFX_SUCCESS) && (outputs < p_pwm->output_count))
+    {
+        err_code = output_configure(p_pwm, outputs);
+        outputs += (err_code == NRFX_SUCCESS) ? 1 : 0;
+    }
+    while ((err_code == NRFX_SUCCESS) && (duty_chs < p_pwm->output_count))
+    {
+        err_code = nrfx_gppi_channel_alloc(&p_pwm->duty_channels[duty_chs]);
+        duty_chs += (err_code == NRFX_SUCCESS) ? 1 : 0;
+    }
+    while ((err_code == NRFX_SUCCESS) && (period_chs < period_channel_count))
+    {
+        err_code = nrfx_gppi_channel_alloc(&p_pwm->period_channels[period_chs]);
+        period_chs += (err_code == NRFX_SUCCESS) ? 1 : 0;
+    }
+
+    if (err_code != NRFX_SUCCESS)
+    {
+        resources_release(p_pwm, outputs, duty_chs, period_chs);
+    }
+    return err_code;
+}
+
+static void duty_apply(nrfx_soft_pwm_t * p_pwm)
+{
+    nrfx_timer_t const * p_timer = p_pwm->p_timer;
+
+    for (uint8_t i = 0; i < p_pwm->output_count; i++)
+    {
+        uint8_t  pin      = p_pwm->output_pins[i];
+        uint32_t duty     = p_pwm->pending[i];
+        bool     was_task = duty_in_range_check(p_pwm, p_pwm->duty[i]);
+
+        if (duty_in_range_check(p_pwm, duty))
+        {
+            nrf_timer_cc_set(p_timer->p_reg, (nrf_timer_cc_channel_t)i, duty);
+            if (!was_task)
+            {
+                // The period has just started, so the output is expected to be high.
+                nrfx_gpiote_out_task_force(pin, 1);
+                nrfx_gpiote_out_task_enable(pin);
+            }
+        }
+        else
+        {
+            nrf_gpio_pin_write(pin, (duty > 0) ? 1 : 0);
+            if (was_task)
+            {
+                nrfx_gpiote_out_task_disable(pin);
+            }
+        }
+        p_pwm->duty[i] = duty;
+    }
+
+    // The compare of a duty cycle that has already elapsed is missed in this period.
+    // Clear such outputs now instead of keeping them high until the next compare.
+    uint32_t now = counter_get(p_pwm);
+
+    for (uint8_t i = 0; i < p_pwm->output_count; i++)
+    {
+        if (duty_in_range_check(p_pwm, p_pwm->duty[i]) && (p_pwm->duty[i] <= now))
+        {
+            nrfx_gpiote_clr_task_trigger(p_pwm->output_pins[i]);
+        }
+    }
+}
+
+static void timer_event_handler(nrf_timer_event_t event_type, void * p_context)
+{
+    nrfx_soft_pwm_t * p_pwm = (nrfx_soft_pwm_t *)p_context;
+
+    if (event_type != nrf_timer_compare_event_get(period_cc_channel_get(p_pwm)))
+    {
+        return;
+    }
+
+    nrfx_timer_compare_int_disable(p_pwm->p_timer, period_cc_channel_get(p_pwm));
+    duty_apply(p_pwm);
+    p_pwm->update_pending = false;
+}
+
+nrfx_err_t nrfx_soft_pwm_init(nrfx_soft_pwm_t *              p_pwm,
+                              nrfx_timer_t const *           p_timer,
+                              nrfx_soft_pwm_config_t const * p_config)
+{
+    NRFX_ASSERT(p_pwm);
+    NRFX_ASSERT(p_timer);
+    NRFX_ASSERT(p_config);
+    NRFX_ASSERT(p_config->output_count > 0);
+    NRFX_ASSERT(p_config->output_count <= NRFX_SOFT_PWM_OUTPUT_COUNT_MAX);
+    NRFX_ASSERT(p_config->output_count < p_timer->cc_channel_count);
+    NRFX_ASSERT(p_config->top_value > 1);
+
+    nrfx_err_t err_code;
+    uint8_t    period_channel_count = period_channel_count_get(p_config->output_count);
+
+    p_pwm->p_timer        = p_timer;
+    p_pwm->top_value      = p_config->top_value;
+    p_pwm->output_count   = p_config->output_count;
+    p_pwm->update_pending = false;
+
+    nrfx_timer_config_t timer_config =
+    {
+        .frequency          = p_config->frequency,
+        .mode               = NRF_TIMER_MODE_TIMER,
+        .bit_width          = p_config->bit_width,
+        .interrupt_priority = p_config->interrupt_priority,
+        .p_context          = p_pwm,
+    };
+
+    err_code = nrfx_timer_init(p_timer, &timer_config, timer_event_handler);
+    if (err_code != NRFX_SUCCESS)
+    {
+        return err_code;
+    }
+
+    for (uint8_t i = 0; i < p_pwm->output_count; i++)
+    {
+        p_pwm->output_pins[i] = p_config->output_pins[i];
+        p_pwm->duty[i]        = 0;
+    }
+
+    err_code = resources_alloc(p_pwm, period_channel_count);
+    if (err_code != NRFX_SUCCESS)
+    {
+        nrfx_timer_uninit(p_timer);
+        return err_code;
+    }
+
+    uint32_t period_eep = nrfx_timer_compare_event_address_get(p_timer,
+                                                               period_cc_channel_get(p_pwm));
+    uint32_t channels_mask = 0;
+
+    for (uint8_t i = 0; i < p_pwm->output_count; i++)
+    {
+        uint8_t pin            = p_pwm->output_pins[i];
+        uint8_t period_channel = p_pwm->period_channels[(period_channel_count == 1) ? 0 : i / 2];
+
+        nrfx_gppi_channel_endpoints_setup(p_pwm->duty_channels[i],
+                                          nrfx_timer_compare_event_address_get(p_timer, i),
+                                          nrfx_gpiote_clr_task_addr_get(pin));
+        if ((i == 0) || ((period_channel_count > 1) && ((i % 2) == 0)))
+        {
+            nrfx_gppi_channel_endpoints_setup(period_channel,
+                                              period_eep,
+                                              nrfx_gpiote_set_task_addr_get(pin));
+        }
+        else
+        {
+            nrfx_gppi_fork_endpoint_setup(period_channel, nrfx_gpiote_set_task_addr_get(pin));
+        }
+        channels_mask |= NRFX_BIT(p_pwm->duty_channels[i]) | NRFX_BIT(period_channel);
+    }
+
+    nrfx_timer_extended_compare(p_timer,
+                                period_cc_channel_get(p_pwm),
+                                p_pwm->top_value,
+                                nrf_timer_short_compare_clear_get(period_cc_channel_get(p_pwm)),
+                                false);
+    nrfx_gppi_channels_enable(channels_mask);
+    nrfx_timer_enable(p_timer);
+    return NRFX_SUCCESS;
+}
+
+void nrfx_soft_pwm_uninit(nrfx_soft_pwm_t * p_pwm)
+{
+    NRFX_ASSERT(p_pwm);
+
+    nrfx_timer_t const * p_timer              = p_pwm->p_timer;
+    uint8_t              period_channel_count = period_channel_count_get(p_pwm->output_count);
+    uint32_t             period_eep           =
+        nrfx_timer_compare_event_address_get(p_timer, period_cc_channel_get(p_pwm));
+
+    nrfx_timer_uninit(p_timer);
+
+    for (uint8_t i = 0; i < p_pwm->output_count; i++)
+    {
+        uint8_t pin            = p_pwm->output_pins[i];
+        uint8_t period_channel = p_pwm->period_channels[(period_channel_count == 1) ? 0 : i / 2];
+
+        nrfx_gppi_channels_disable(NRFX_BIT(p_pwm->duty_channels[i]) | NRFX_BIT(period_channel));
+        nrfx_gppi_event_endpoint_clear(p_pwm->duty_channels[i],
+                                       nrfx_timer_compare_event_address_get(p_timer, i));
+        nrfx_gppi_task_endpoint_clear(p_pwm->duty_channels[i], nrfx_gpiote_clr_task_addr_get(pin));
+        nrfx_gppi_event_endpoint_clear(period_channel, period_eep);
+        if ((i == 0) || ((period_channel_count > 1) && ((i % 2) == 0)))
+        {
+            nrfx_gppi_task_endpoint_clear(period_channel, nrfx_gpiote_set_task_addr_get(pin));
+        }
+        else
+        {
+            nrfx_gppi_fork_endpoint_clear(period_channel, nrfx_gpiote_set_task_addr_get(pin));
+        }
+    }
+
+    resources_release(p_pwm, p_pwm->output_count, p_pwm->output_count, period_channel_count);
+}
+
+void nrfx_soft_pwm_duty_set(nrfx_soft_pwm_t * p_pwm, uint32_t const * p_duty)
+{
+    NRFX_ASSERT(p_pwm);
+    NRFX_ASSERT(p_duty);
+
+    // The critical section keeps the interrupt from applying a partially written set.
+    NRFX_CRITICAL_SECTION_ENTER();
+    for (uint8_t i = 0; i < p_pwm->output_count; i++)
+    {
+        p_pwm->pending[i] = p_duty[i];
+    }
+    p_pwm->update_pending = true;
+    nrfx_timer_compare_int_enable(p_pwm->p_timer, period_cc_channel_get(p_pwm));
+    NRFX_CRITICAL_SECTION_EXIT();
+}
+
+bool nrfx_soft_pwm_update_pending_check(nrfx_soft_pwm_t const * p_pwm)
+{
+    NRFX_ASSERT(p_pwm);
+
+    return p_pwm->update_pending;
+}
+
+#endif // NRFX_CHECK(NRFX_TIMER_ENABLED) && NRFX_CHECK(NRFX_GPIOTE_ENABLED)
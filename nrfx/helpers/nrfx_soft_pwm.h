@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_SOFT_PWM_H__
+#define NRFX_SOFT_PWM_H__
+
+#include <nrfx.h>
+#include <nrfx_timer.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_soft_pwm Hardware-assisted software PWM
+ * @{
+ * @ingroup nrfx
+ * @brief   PWM outputs generated by a TIMER instance, (D)PPI and GPIOTE tasks.
+ *
+ * The last capture/compare channel of the TIMER defines the period and clears the counter.
+ * Its COMPARE event sets all outputs with the GPIOTE SET tasks, and the COMPARE event
+ * of the channel of each output clears that output with the GPIOTE CLR task.
+ * The edges are generated by the hardware, so there are no interrupts per edge
+ * and the timing does not depend on the CPU load.
+ *
+ * Every capture/compare channel of the TIMER except for the last one drives one output,
+ * so a TIMER instance with six channels drives five outputs. More outputs require more
+ * TIMER instances.
+ *
+ * The duty cycles of all outputs are updated together at the next period boundary,
+ * from the interrupt of the TIMER. An output whose new duty cycle already elapsed
+ * when the interrupt is handled is cleared by the CPU, so the interrupt latency never
+ * lengthens a pulse by the whole period. The duty cycles of 0 and the full period are
+ * generated by driving the pin directly, with the GPIOTE task disabled.
+ *
+ * The GPIOTE driver must be initialized before the PWM is initialized.
+ * The TIMER driver instance is initialized and owned by the PWM.
+ */
+
+/** @brief Maximum number of outputs. */
+#ifndef NRFX_SOFT_PWM_OUTPUT_COUNT_MAX
+#define NRFX_SOFT_PWM_OUTPUT_COUNT_MAX 5
+#endif
+
+/** @brief Number of (D)PPI channels used to set the outputs at the period boundary. */
+#if defined(DPPI_PRESENT) || defined(__NRFX_DOXYGEN__)
+#define NRFX_SOFT_PWM_PERIOD_CHANNEL_COUNT 1
+#else
+#define NRFX_SOFT_PWM_PERIOD_CHANNEL_COUNT ((NRFX_SOFT_PWM_OUTPUT_COUNT_MAX + 1) / 2)
+#endif
+
+/** @brief PWM configuration structure. */
+typedef struct
+{
+    uint8_t               output_pins[NRFX_SOFT_PWM_OUTPUT_COUNT_MAX]; ///< Pin numbers of the outputs.
+    uint8_t               output_count;       ///< Number of the outputs.
+    nrf_timer_frequency_t frequency;          ///< TIMER frequency.
+    nrf_timer_bit_width_t bit_width;          ///< TIMER bit width.
+    uint32_t              top_value;          ///< Period, in TIMER ticks.
+    uint8_t               interrupt_priority; ///< Interrupt priority of the TIMER instance.
+} nrfx_soft_pwm_config_t;
+
+/** @brief PWM instance structure. */
+typedef struct
+{
+    nrfx_timer_t const * p_timer;            ///< TIMER driver instance. For internal use only.
+    uint32_t             top_value;          ///< Period. For internal use only.
+    uint8_t              output_count;       ///< Number of the outputs. For internal use only.
+    uint8_t              output_pins[NRFX_SOFT_PWM_OUTPUT_COUNT_MAX];     ///< Pins of the outputs. For internal use only.
+    uint8_t              gpiote_channels[NRFX_SOFT_PWM_OUTPUT_COUNT_MAX]; ///< GPIOTE channels of the outputs. For internal use only.
+    uint8_t              duty_channels[NRFX_SOFT_PWM_OUTPUT_COUNT_MAX];   ///< (D)PPI channels clearing the outputs. For internal use only.
+    uint8_t              period_channels[NRFX_SOFT_PWM_PERIOD_CHANNEL_COUNT]; ///< (D)PPI channels setting the outputs. For internal use only.
+    uint32_t             duty[NRFX_SOFT_PWM_OUTPUT_COUNT_MAX];            ///< Current duty cycles. For internal use only.
+    uint32_t             pending[NRFX_SOFT_PWM_OUTPUT_COUNT_MAX];         ///< Duty cycles to be applied. For internal use only.
+    volatile bool        update_pending;     ///< True if the duty cycles are to be applied. For internal use only.
+} nrfx_soft_pwm_t;
+
+/**
+ * @brief Function for initializing and starting the PWM.
+ *
+ * All outputs start with the duty cycle of 0.
+ *
+ * @param[out] p_pwm    Pointer to the PWM instance structure.
+ * @param[in]  p_timer  Pointer to the TIMER driver instance, which must not be initialized.
+ *                      The instance must have more capture/compare channels than the outputs.
+ * @param[in]  p_config Pointer to the PWM configuration.
+ *
+ * @retval NRFX_SUCCESS             The PWM was started.
+ * @retval NRFX_ERROR_INVALID_STATE The TIMER driver instance is already initialized.
+ * @retval NRFX_ERROR_NO_MEM        There are not enough available GPIOTE or (D)PPI channels.
+ * @retval NRFX_ERROR_INVALID_PARAM An output pin cannot be configured.
+ */
+nrfx_err_t nrfx_soft_pwm_init(nrfx_soft_pwm_t *              p_pwm,
+                              nrfx_timer_t const *           p_timer,
+                              nrfx_soft_pwm_config_t const * p_config);
+
+/**
+ * @brief Function for stopping and uninitializing the PWM.
+ *
+ * The output pins are restored to the default configuration.
+ *
+ * @param[in] p_pwm Pointer to the PWM instance structure.
+ */
+void nrfx_soft_pwm_uninit(nrfx_soft_pwm_t * p_pwm);
+
+/**
+ * @brief Function for setting the duty cycles of all outputs.
+ *
+ * The duty cycles are applied together at the next period boundary. If the function
+ * is called again before that, only the last duty cycles are applied.
+ *
+ * @param[in] p_pwm  Pointer to the PWM instance structure.
+ * @param[in] p_duty Array of the duty cycles, one per output, in TIMER ticks.
+ *                   Values equal to or greater than the period keep the output high.
+ */
+void nrfx_soft_pwm_duty_set(nrfx_soft_pwm_t * p_pwm, uint32_t const * p_duty);
+
+/**
+ * @brief Function for checking if the duty cycles set last are yet to be applied.
+ *
+ * @param[in] p_pwm Pointer to the PWM instance structure.
+ *
+ * @retval true  The duty cycles are yet to be applied.
+ * @retval false The duty cycles have been applied.
+ */
+bool nrfx_soft_pwm_update_pending_check(nrfx_soft_pwm_t const * p_pwm);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_SOFT_PWM_H__
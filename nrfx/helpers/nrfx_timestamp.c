@@ -0,0 +1,284 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx.h>
+
+#if NRFX_CHECK(NRFX_TIMER_ENABLED) && (defined(PPI_PRESENT) || defined(DPPI_PRESENT))
+
+#include <helpers/nrfx_timestamp.h>
+#include <helpers/nrfx_gppi.h>
+
+/** @brief Function for getting the capture/compare channel used for the drain interrupt. */
+static nrf_timer_cc_channel_t drain_channel_get(nrfx_timestamp_t const * p_ts)
+{
+    return (nrf_timer_cc_channel_t)p_ts->slot_count;
+}
+
+static uint32_t ticks_mask_get(nrf_timer_bit_width_t bit_width)
+{
+    switch (bit_width)
+    {
+        case NRF_TIMER_BIT_WIDTH_8:
+            return UINT8_MAX;
+        case NRF_TIMER_BIT_WIDTH_16:
+            return UINT16_MAX;
+        case NRF_TIMER_BIT_WIDTH_24:
+            return 0x00FFFFFFUL;
+        default:
+            return UINT32_MAX;
+    }
+}
+
+/** @brief Function for getting the address of the CAPTURE task of the slot shared by the source. */
+static uint32_t capture_task_get(nrfx_timestamp_t const * p_ts, uint8_t source)
+{
+    return nrfx_timer_capture_task_address_get(p_ts->p_timer, source % p_ts->slot_count);
+}
+
+static void source_connect(nrfx_timestamp_t const * p_ts, uint8_t source)
+{
+    nrfx_gppi_channel_endpoints_setup(p_ts->channels[source],
+                                      p_ts->p_event_addrs[source],
+                                      capture_task_get(p_ts, source));
+    nrfx_gppi_channels_enable(NRFX_BIT(p_ts->channels[source]));
+}
+
+static void source_disconnect(nrfx_timestamp_t const * p_ts, uint8_t source)
+{
+    nrfx_gppi_channels_disable(NRFX_BIT(p_ts->channels[source]));
+    nrfx_gppi_event_endpoint_clear(p_ts->channels[source], p_ts->p_event_addrs[source]);
+    nrfx_gppi_task_endpoint_clear(p_ts->channels[source], capture_task_get(p_ts, source));
+}
+
+/** @brief Function for storing the new capture of the given slot and rotating its group. */
+static bool slot_drain(nrfx_timestamp_t * p_ts, uint8_t slot)
+{
+    uint8_t source = p_ts->active[slot];
+    uint8_t next   = (uint8_t)(source + p_ts->slot_count);
+    bool    stored = false;
+
+    if (next >= p_ts->event_count)
+    {
+        next = slot;
+    }
+
+    // Disconnect the source before reading, so that the value read is the last one it captured.
+    if (next != source)
+    {
+        source_disconnect(p_ts, source);
+    }
+
+    uint32_t ticks = nrfx_timer_capture_get(p_ts->p_timer, (nrf_timer_cc_channel_t)slot);
+
+    if (ticks != p_ts->last_ticks[slot])
+    {
+        uint32_t idx = p_ts->write_idx;
+
+        if ((idx - p_ts->read_idx) < p_ts->buffer_size)
+        {
+            nrfx_timestamp_entry_t * p_entry = &p_ts->p_buffer[idx & (p_ts->buffer_size - 1)];
+
+            p_entry->ticks  = ticks;
+            p_entry->source = source;
+            __DMB();
+            p_ts->write_idx = idx + 1;
+            stored = true;
+        }
+        else
+        {
+            (void)NRFX_ATOMIC_FETCH_ADD(&p_ts->dropped, 1);
+        }
+        p_ts->last_ticks[slot] = ticks;
+    }
+
+    if (next != source)
+    {
+        p_ts->active[slot] = next;
+        source_connect(p_ts, next);
+    }
+
+    return stored;
+}
+
+static void timer_event_handler(nrf_timer_event_t event_type, void * p_context)
+{
+    nrfx_timestamp_t *     p_ts   = (nrfx_timestamp_t *)p_context;
+    nrf_timer_cc_channel_t drain  = drain_channel_get(p_ts);
+    bool                   stored = false;
+
+    if (event_type != nrf_timer_compare_event_get(drain))
+    {
+        return;
+    }
+
+    // Schedule the next drain relative to the current counter value, so that a delayed
+    // interrupt does not make the compare value fall behind the counter.
+    uint32_t now = nrfx_timer_capture(p_ts->p_timer, drain);
+    nrfx_timer_compare(p_ts->p_timer, drain, (now + p_ts->drain_period) & p_ts->ticks_mask, true);
+
+    for (uint8_t slot = 0; slot < p_ts->slot_count; slot++)
+    {
+        stored |= slot_drain(p_ts, slot);
+    }
+
+    if (stored && p_ts->handler)
+    {
+        p_ts->handler(p_ts->p_context);
+    }
+}
+
+nrfx_err_t nrfx_timestamp_init(nrfx_timestamp_t *              p_ts,
+                               nrfx_timer_t const *            p_timer,
+                               nrfx_timestamp_config_t const * p_config,
+                               nrfx_timestamp_handler_t        handler,
+                               void *                          p_context)
+{
+    NRFX_ASSERT(p_ts);
+    NRFX_ASSERT(p_timer);
+    NRFX_ASSERT(p_timer->cc_channel_count >= 2);
+    NRFX_ASSERT(p_config);
+    NRFX_ASSERT(p_config->p_event_addrs);
+    NRFX_ASSERT(p_config->event_count > 0);
+    NRFX_ASSERT(p_config->event_count <= NRFX_TIMESTAMP_SOURCE_COUNT_MAX);
+    NRFX_ASSERT(p_config->p_buffer);
+    NRFX_ASSERT(p_config->buffer_size > 0);
+    NRFX_ASSERT((p_config->buffer_size & (p_config->buffer_size - 1)) == 0);
+    NRFX_ASSERT(p_config->drain_period > 0);
+
+    nrfx_err_t err_code;
+    uint8_t    allocated;
+
+    p_ts->p_timer       = p_timer;
+    p_ts->handler       = handler;
+    p_ts->p_context     = p_context;
+    p_ts->p_event_addrs = p_config->p_event_addrs;
+    p_ts->p_buffer      = p_config->p_buffer;
+    p_ts->buffer_size   = p_config->buffer_size;
+    p_ts->write_idx     = 0;
+    p_ts->read_idx      = 0;
+    p_ts->drain_period  = p_config->drain_period;
+    p_ts->ticks_mask    = ticks_mask_get(p_config->bit_width);
+    p_ts->event_count   = p_config->event_count;
+    p_ts->slot_count    = (uint8_t)NRFX_MIN(p_config->event_count,
+                                            (uint8_t)(p_timer->cc_channel_count - 1));
+    (void)NRFX_ATOMIC_FETCH_STORE(&p_ts->dropped, 0);
+
+    nrfx_timer_config_t timer_config =
+    {
+        .frequency          = p_config->frequency,
+        .mode               = NRF_TIMER_MODE_TIMER,
+        .bit_width          = p_config->bit_width,
+        .interrupt_priority = p_config->interrupt_priority,
+        .p_context          = p_ts,
+    };
+
+    err_code = nrfx_timer_init(p_timer, &timer_config, timer_event_handler);
+    if (err_code != NRFX_SUCCESS)
+    {
+        return err_code;
+    }
+
+    for (allocated = 0; allocated < p_ts->event_count; allocated++)
+    {
+        err_code = nrfx_gppi_channel_alloc(&p_ts->channels[allocated]);
+        if (err_code != NRFX_SUCCESS)
+        {
+            while (allocated > 0)
+            {
+                (void)nrfx_gppi_channel_free(p_ts->channels[--allocated]);
+            }
+            nrfx_timer_uninit(p_timer);
+            return err_code;
+        }
+    }
+
+    for (uint8_t slot = 0; slot < p_ts->slot_count; slot++)
+    {
+        p_ts->active[slot]     = slot;
+        p_ts->last_ticks[slot] = 0;
+        nrfx_timer_compare(p_timer, (nrf_timer_cc_channel_t)slot, 0, false);
+        source_connect(p_ts, slot);
+    }
+
+    nrfx_timer_compare(p_timer, drain_channel_get(p_ts), p_ts->drain_period & p_ts->ticks_mask,
+                       true);
+    nrfx_timer_enable(p_timer);
+    return NRFX_SUCCESS;
+}
+
+void nrfx_timestamp_uninit(nrfx_timestamp_t * p_ts)
+{
+    NRFX_ASSERT(p_ts);
+
+    nrfx_timer_uninit(p_ts->p_timer);
+
+    for (uint8_t slot = 0; slot < p_ts->slot_count; slot++)
+    {
+        source_disconnect(p_ts, p_ts->active[slot]);
+    }
+
+    for (uint8_t source = 0; source < p_ts->event_count; source++)
+    {
+        (void)nrfx_gppi_channel_free(p_ts->channels[source]);
+    }
+}
+
+bool nrfx_timestamp_get(nrfx_timestamp_t * p_ts, nrfx_timestamp_entry_t * p_entry)
+{
+    NRFX_ASSERT(p_ts);
+    NRFX_ASSERT(p_entry);
+
+    uint32_t idx = p_ts->read_idx;
+
+    if (idx == p_ts->write_idx)
+    {
+        return false;
+    }
+
+    __DMB();
+    *p_entry = p_ts->p_buffer[idx & (p_ts->buffer_size - 1)];
+
+    // Release the entry before it can be stored again.
+    __DMB();
+    p_ts->read_idx = idx + 1;
+    return true;
+}
+
+uint32_t nrfx_timestamp_dropped_get_and_clear(nrfx_timestamp_t * p_ts)
+{
+    NRFX_ASSERT(p_ts);
+
+    return NRFX_ATOMIC_FETCH_STORE(&p_ts->dropped, 0);
+}
+
+#endif // NRFX_CHECK(NRFX_TIMER_ENABLED) && (defined(PPI_PRESENT) || defined(DPPI_PRESENT))
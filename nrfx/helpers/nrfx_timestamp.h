@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_TIMESTAMP_H__
+#define NRFX_TIMESTAMP_H__
+
+#include <nrfx.h>
+#include <nrfx_timer.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_timestamp Event timestamp capture
+ * @{
+ * @ingroup nrfx
+ * @brief   Hardware timestamping of peripheral events with TIMER CAPTURE tasks.
+ *
+ * Each source event, such as a GPIOTE IN event, SAADC END or RADIO ADDRESS,
+ * is connected over PPI or DPPI to a CAPTURE task of a TIMER instance, so the timestamp
+ * is taken by the hardware, without the interrupt latency jitter of a software read.
+ *
+ * The last capture/compare channel of the TIMER is used for a periodic drain interrupt.
+ * On every drain, the remaining channels (capture slots) are read and new values are
+ * stored in a ring provided by the user, from which they are taken out with
+ * @ref nrfx_timestamp_get. The drain runs at the interrupt priority of the TIMER,
+ * which should be low.
+ *
+ * When there are more sources than capture slots, the sources share the slots
+ * in groups. Only one source of a group is connected at a time, and the connected
+ * source rotates on every drain. That is, every source of a group of N sources is
+ * timestamped during one drain period out of N, which suits the periodic sources,
+ * such as time synchronization signals or flow meter pulses.
+ *
+ * A capture slot holds only the last capture, so a source must not trigger more than
+ * once per drain period. A new capture is detected by a changed value, so a capture
+ * taken exactly one full TIMER period after the previous one is not reported.
+ *
+ * The TIMER driver instance is initialized and owned by the service.
+ */
+
+/** @brief Maximum number of sources. */
+#ifndef NRFX_TIMESTAMP_SOURCE_COUNT_MAX
+#define NRFX_TIMESTAMP_SOURCE_COUNT_MAX 8
+#endif
+
+/** @brief Timestamp entry structure. */
+typedef struct
+{
+    uint32_t ticks;  ///< Captured TIMER value.
+    uint8_t  source; ///< Index of the source in @ref nrfx_timestamp_config_t::p_event_addrs.
+} nrfx_timestamp_entry_t;
+
+/**
+ * @brief Handler type.
+ *
+ * The handler is called from the drain interrupt when new entries have been stored.
+ *
+ * @param[in] p_context User context.
+ */
+typedef void (* nrfx_timestamp_handler_t)(void * p_context);
+
+/** @brief Service configuration structure. */
+typedef struct
+{
+    uint32_t const *         p_event_addrs;      ///< Addresses of the source events.
+    uint8_t                  event_count;        ///< Number of the source events.
+    nrfx_timestamp_entry_t * p_buffer;           ///< Ring of the entries.
+    uint32_t                 buffer_size;        ///< Number of entries in the ring. Must be a power of 2.
+    nrf_timer_frequency_t    frequency;          ///< TIMER frequency.
+    nrf_timer_bit_width_t    bit_width;          ///< TIMER bit width.
+    uint32_t                 drain_period;       ///< Drain period, in TIMER ticks.
+    uint8_t                  interrupt_priority; ///< Interrupt priority of the TIMER instance.
+} nrfx_timestamp_config_t;
+
+/** @brief Service instance structure. */
+typedef struct
+{
+    nrfx_timer_t const *     p_timer;             ///< TIMER driver instance. For internal use only.
+    nrfx_timestamp_handler_t handler;             ///< Handler. For internal use only.
+    void *                   p_context;           ///< User context. For internal use only.
+    uint32_t const *         p_event_addrs;       ///< Source events. For internal use only.
+    nrfx_timestamp_entry_t * p_buffer;            ///< Ring of the entries. For internal use only.
+    uint32_t                 buffer_size;         ///< Size of the ring. For internal use only.
+    volatile uint32_t        write_idx;           ///< Index of the next entry to be stored. For internal use only.
+    volatile uint32_t        read_idx;            ///< Index of the next entry to be taken out. For internal use only.
+    nrfx_atomic_t            dropped;             ///< Number of dropped entries. For internal use only.
+    uint32_t                 drain_period;        ///< Drain period. For internal use only.
+    uint32_t                 ticks_mask;          ///< Mask of the TIMER bit width. For internal use only.
+    uint8_t                  event_count;         ///< Number of the sources. For internal use only.
+    uint8_t                  slot_count;          ///< Number of the capture slots. For internal use only.
+    uint8_t                  channels[NRFX_TIMESTAMP_SOURCE_COUNT_MAX];    ///< (D)PPI channels of the sources. For internal use only.
+    uint8_t                  active[NRFX_TIMESTAMP_SOURCE_COUNT_MAX];      ///< Connected source of each slot. For internal use only.
+    uint32_t                 last_ticks[NRFX_TIMESTAMP_SOURCE_COUNT_MAX];  ///< Last value of each slot. For internal use only.
+} nrfx_timestamp_t;
+
+/**
+ * @brief Function for initializing and starting the service.
+ *
+ * @param[out] p_ts      Pointer to the service instance structure.
+ * @param[in]  p_timer   Pointer to the TIMER driver instance, which must not be initialized.
+ *                       The instance must have at least two capture/compare channels.
+ * @param[in]  p_config  Pointer to the service configuration.
+ * @param[in]  handler   Handler. Can be NULL.
+ * @param[in]  p_context User context passed to the handler.
+ *
+ * @retval NRFX_SUCCESS             The service was started.
+ * @retval NRFX_ERROR_INVALID_STATE The TIMER driver instance is already initialized.
+ * @retval NRFX_ERROR_NO_MEM        There are not enough available (D)PPI channels.
+ */
+nrfx_err_t nrfx_timestamp_init(nrfx_timestamp_t *              p_ts,
+                               nrfx_timer_t const *            p_timer,
+                               nrfx_timestamp_config_t const * p_config,
+                               nrfx_timestamp_handler_t        handler,
+                               void *                          p_context);
+
+/**
+ * @brief Function for stopping and uninitializing the service.
+ *
+ * @param[in] p_ts Pointer to the service instance structure.
+ */
+void nrfx_timestamp_uninit(nrfx_timestamp_t * p_ts);
+
+/**
+ * @brief Function for taking the oldest entry out of the ring.
+ *
+ * The function must not be called from contexts that preempt each other.
+ *
+ * @param[in]  p_ts    Pointer to the service instance structure.
+ * @param[out] p_entry Pointer to the structure to be filled with the entry.
+ *
+ * @retval true  The entry was taken out.
+ * @retval false The ring is empty.
+ */
+bool nrfx_timestamp_get(nrfx_timestamp_t * p_ts, nrfx_timestamp_entry_t * p_entry);
+
+/**
+ * @brief Function for getting and clearing the number of entries dropped because the ring was full.
+ *
+ * @param[in] p_ts Pointer to the service instance structure.
+ *
+ * @return Number of dropped entries.
+ */
+uint32_t nrfx_timestamp_dropped_get_and_clear(nrfx_timestamp_t * p_ts);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_TIMESTAMP_H__
@@ -0,0 +1,920 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <nrfx.h>
+
+#if NRFX_CHECK(NRFX_USBD_ENABLED)
+
+#include <helpers/nrfx_usbd_cdc_acm.h>
+#include <string.h>
+
+NRFX_STATIC_ASSERT((NRFX_USBD_CDC_ACM_TX_BUFFER_SIZE % NRFX_USBD_EPSIZE) == 0);
+NRFX_STATIC_ASSERT(NRFX_USBD_CDC_ACM_TX_BUFFER_SIZE > 0);
+NRFX_STATIC_ASSERT((NRFX_USBD_CDC_ACM_RX_SLOT_SIZE % NRFX_USBD_EPSIZE) == 0);
+NRFX_STATIC_ASSERT(NRFX_USBD_CDC_ACM_RX_SLOT_SIZE > 0);
+NRFX_STATIC_ASSERT(NRFX_USBD_CDC_ACM_RX_SLOT_COUNT >= 2);
+NRFX_STATIC_ASSERT(NRFX_USBD_CDC_ACM_RX_SLOT_COUNT <= UINT8_MAX);
+NRFX_STATIC_ASSERT(NRFX_USBD_CDC_ACM_STRING_LENGTH_MAX <= 126);
+
+/** @brief Endpoints used by the interfaces. */
+#define CDC_ACM_EP_COMM     NRFX_USBD_EPIN1
+#define CDC_ACM_EP_DATA_IN  NRFX_USBD_EPIN2
+#define CDC_ACM_EP_DATA_OUT NRFX_USBD_EPOUT2
+
+#define CDC_ACM_EP_COMM_SIZE     16
+#define CDC_ACM_EP_COMM_INTERVAL 16 ///< Polling interval of the notification endpoint in ms.
+
+#define CDC_ACM_INTERFACE_COMM 0
+#define CDC_ACM_INTERFACE_DATA 1
+#define CDC_ACM_CONFIGURATION  1
+
+#define CDC_ACM_LSB(x) ((uint8_t)((x) & 0xFF))
+#define CDC_ACM_MSB(x) ((uint8_t)(((x) >> 8) & 0xFF))
+
+/** @brief Fields of the bmRequestType of a setup packet. */
+#define USB_REQ_DIR_IN            0x80
+#define USB_REQ_TYPE_MASK         0x60
+#define USB_REQ_TYPE_STANDARD     0x00
+#define USB_REQ_TYPE_CLASS        0x20
+#define USB_REQ_RECIPIENT_MASK    0x1F
+#define USB_REQ_RECIPIENT_DEVICE  0x00
+#define USB_REQ_RECIPIENT_IFACE   0x01
+#define USB_REQ_RECIPIENT_EP      0x02
+
+/** @brief Standard requests. */
+#define USB_REQ_GET_STATUS        0x00
+#define USB_REQ_CLEAR_FEATURE     0x01
+#define USB_REQ_SET_FEATURE       0x03
+#define USB_REQ_SET_ADDRESS       0x05
+#define USB_REQ_GET_DESCRIPTOR    0x06
+#define USB_REQ_GET_CONFIGURATION 0x08
+#define USB_REQ_SET_CONFIGURATION 0x09
+#define USB_REQ_GET_INTERFACE     0x0A
+#define USB_REQ_SET_INTERFACE     0x0B
+
+#define USB_FEATURE_ENDPOINT_HALT 0x00
+
+/** @brief Descriptor types. */
+#define USB_DESC_DEVICE           0x01
+#define USB_DESC_CONFIGURATION    0x02
+#define USB_DESC_STRING           0x03
+#define USB_DESC_INTERFACE        0x04
+#define USB_DESC_ENDPOINT         0x05
+#define USB_DESC_CS_INTERFACE     0x24
+
+#define USB_STRING_MANUFACTURER   1
+#define USB_STRING_PRODUCT        2
+#define USB_STRING_SERIAL         3
+
+/** @brief CDC class requests. */
+#define CDC_REQ_SET_LINE_CODING        0x20
+#define CDC_REQ_GET_LINE_CODING        0x21
+#define CDC_REQ_SET_CONTROL_LINE_STATE 0x22
+#define CDC_REQ_SEND_BREAK             0x23
+
+#define CDC_LINE_CODING_SIZE 7
+#define CDC_LINE_STATE_DTR   (1U << 0)
+#define CDC_LINE_STATE_RTS   (1U << 1)
+
+/** @brief State of the bulk IN endpoint. */
+typedef enum
+{
+    CDC_ACM_TX_IDLE, ///< No transfer in progress.
+    CDC_ACM_TX_RING, ///< Data is streamed from the ring buffer.
+    CDC_ACM_TX_ZLP,  ///< Zero-length packet terminating the data is being sent.
+} cdc_acm_tx_state_t;
+
+static const uint8_t m_device_desc_template[] =
+{
+    18,                      // bLength
+    USB_DESC_DEVICE,         // bDescriptorType
+    0x00, 0x02,              // bcdUSB 2.00
+    0x02,                    // bDeviceClass: CDC
+    0x00,                    // bDeviceSubClass
+    0x00,                    // bDeviceProtocol
+    NRFX_USBD_EPSIZE,        // bMaxPacketSize0
+    0x00, 0x00,              // idVendor, set at initialization
+    0x00, 0x00,              // idProduct, set at initialization
+    0x00, 0x01,              // bcdDevice 1.00
+    0x00,                    // iManufacturer, set at initialization
+    0x00,                    // iProduct, set at initialization
+    0x00,                    // iSerialNumber, set at initialization
+    1,                       // bNumConfigurations
+};
+
+#define CDC_ACM_CONFIG_DESC_SIZE (9 + 9 + 5 + 5 + 4 + 5 + 7 + 9 + 7 + 7)
+
+static const uint8_t m_config_desc[CDC_ACM_CONFIG_DESC_SIZE] =
+{
+    // Configuration
+    9, USB_DESC_CONFIGURATION,
+    CDC_ACM_LSB(CDC_ACM_CONFIG_DESC_SIZE), CDC_ACM_MSB(CDC_ACM_CONFIG_DESC_SIZE),
+    2,                       // bNumInterfaces
+    CDC_ACM_CONFIGURATION,   // bConfigurationValue
+    0,                       // iConfiguration
+    0x80,                    // bmAttributes: bus powered
+    50,                      // bMaxPower: 100 mA
+    // Communication interface
+    9, USB_DESC_INTERFACE,
+    CDC_ACM_INTERFACE_COMM,  // bInterfaceNumber
+    0,                       // bAlternateSetting
+    1,                       // bNumEndpoints
+    0x02,                    // bInterfaceClass: Communication
+    0x02,                    // bInterfaceSubClass: Abstract Control Model
+    0x01,                    // bInterfaceProtocol: AT commands (V.250)
+    0,                       // iInterface
+    // Header functional descriptor, CDC 1.10
+    5, USB_DESC_CS_INTERFACE, 0x00, 0x10, 0x01,
+    // Call management functional descriptor: no call management, data interface
+    5, USB_DESC_CS_INTERFACE, 0x01, 0x00, CDC_ACM_INTERFACE_DATA,
+    // ACM functional descriptor: line coding and serial state requests supported
+    4, USB_DESC_CS_INTERFACE, 0x02, 0x02,
+    // Union functional descriptor
+    5, USB_DESC_CS_INTERFACE, 0x06, CDC_ACM_INTERFACE_COMM, CDC_ACM_INTERFACE_DATA,
+    // Notification endpoint
+    7, USB_DESC_ENDPOINT, CDC_ACM_EP_COMM, 0x03,
+    CDC_ACM_LSB(CDC_ACM_EP_COMM_SIZE), CDC_ACM_MSB(CDC_ACM_EP_COMM_SIZE),
+    CDC_ACM_EP_COMM_INTERVAL,
+    // Data interface
+    9, USB_DESC_INTERFACE,
+    CDC_ACM_INTERFACE_DATA,  // bInterfaceNumber
+    0,                       // bAlternateSetting
+    2,                       // bNumEndpoints
+    0x0A,                    // bInterfaceClass: CDC Data
+    0x00,                    // bInterfaceSubClass
+    0x00,                    // bInterfaceProtocol
+    0,                       // iInterface
+    // Bulk OUT endpoint
+    7, USB_DESC_ENDPOINT, CDC_ACM_EP_DATA_OUT, 0x02,
+    CDC_ACM_LSB(NRFX_USBD_EPSIZE), CDC_ACM_MSB(NRFX_USBD_EPSIZE), 0,
+    // Bulk IN endpoint
+    7, USB_DESC_ENDPOINT, CDC_ACM_EP_DATA_IN, 0x02,
+    CDC_ACM_LSB(NRFX_USBD_EPSIZE), CDC_ACM_MSB(NRFX_USBD_EPSIZE), 0,
+};
+
+/** @brief String descriptor zero: US English is the only language supported. */
+static const uint8_t m_langid_desc[] = { 4, USB_DESC_STRING, 0x09, 0x04 };
+
+static nrfx_usbd_cdc_acm_event_handler_t m_handler;
+static void *                            m_p_context;
+static char const *                      m_strings[3];
+
+static uint8_t m_device_desc[sizeof(m_device_desc_template)];
+static uint8_t m_string_desc[2 + 2 * NRFX_USBD_CDC_ACM_STRING_LENGTH_MAX];
+static uint8_t m_ep0_buffer[CDC_LINE_CODING_SIZE];      ///< Small responses and request data.
+static bool    m_ep0_line_coding;                       ///< Line coding is received on EP0.
+
+static volatile uint8_t         m_configuration;
+static uint16_t                  m_line_state;
+static nrfx_usbd_cdc_acm_line_coding_t m_line_coding;
+
+static nrfx_usbd_ring_t            m_tx_ring;
+static uint8_t                     m_tx_buffer[NRFX_USBD_CDC_ACM_TX_BUFFER_SIZE];
+static volatile cdc_acm_tx_state_t m_tx_state;
+static size_t                      m_tx_start; ///< Ring tail at the start of the current transfer.
+
+static uint8_t          m_rx_slots[NRFX_USBD_CDC_ACM_RX_SLOT_COUNT][NRFX_USBD_CDC_ACM_RX_SLOT_SIZE];
+static size_t           m_rx_length[NRFX_USBD_CDC_ACM_RX_SLOT_COUNT];
+static uint8_t          m_rx_head;    ///< Slot being filled or to be filled next.
+static uint8_t          m_rx_tail;    ///< Slot being read.
+static volatile uint8_t m_rx_filled;  ///< Number of filled slots.
+static size_t           m_rx_offset;  ///< Number of bytes already read from the tail slot.
+static volatile bool    m_rx_armed;
+
+static void event_send(nrfx_usbd_cdc_acm_evt_t const * p_event)
+{
+    m_handler(p_event, m_p_context);
+}
+
+static void line_state_event_send(void)
+{
+    nrfx_usbd_cdc_acm_evt_t evt = {
+        .type = NRFX_USBD_CDC_ACM_EVT_LINE_STATE,
+        .data = {
+            .line_state = {
+                .dtr = (m_line_state & CDC_LINE_STATE_DTR) != 0,
+                .rts = (m_line_state & CDC_LINE_STATE_RTS) != 0,
+            },
+        },
+    };
+    event_send(&evt);
+}
+
+static void line_coding_default_set(void)
+{
+    m_line_coding.baudrate  = 115200;
+    m_line_coding.stop_bits = 0;
+    m_line_coding.parity    = NRFX_USBD_CDC_ACM_PARITY_NONE;
+    m_line_coding.data_bits = 8;
+}
+
+static void tx_ring_start(void)
+{
+    m_tx_start = m_tx_ring.tail;
+    if (nrfx_usbd_ep_ring_transfer(CDC_ACM_EP_DATA_IN, &m_tx_ring) == NRFX_SUCCESS)
+    {
+        m_tx_state = CDC_ACM_TX_RING;
+    }
+    else
+    {
+        m_tx_state = CDC_ACM_TX_IDLE;
+    }
+}
+
+static void tx_transfer_done(void)
+{
+    if (m_tx_ring.head != m_tx_ring.tail)
+    {
+        // Data written during the transfer continues the stream, no terminator is needed yet.
+        tx_ring_start();
+        return;
+    }
+
+    if (m_tx_state == CDC_ACM_TX_RING)
+    {
+        // The ring transfer ends with the first packet that empties the ring. All preceding
+        // packets are full, so the last one is full if the total length is a multiple of the
+        // packet size. The ring size is such a multiple, so the offset modulo the ring size is enough.
+        size_t sent = (m_tx_ring.tail + m_tx_ring.size - m_tx_start) % m_tx_ring.size;
+        if ((sent % NRFX_USBD_EPSIZE) == 0)
+        {
+            static const uint8_t zlp;
+            NRFX_USBD_TRANSFER_IN(transfer, &zlp, 0, 0);
+            if (nrfx_usbd_ep_transfer(CDC_ACM_EP_DATA_IN, &transfer) == NRFX_SUCCESS)
+            {
+                m_tx_state = CDC_ACM_TX_ZLP;
+                return;
+            }
+        }
+    }
+
+    m_tx_state = CDC_ACM_TX_IDLE;
+    nrfx_usbd_cdc_acm_evt_t evt = { .type = NRFX_USBD_CDC_ACM_EVT_TX_DONE };
+    event_send(&evt);
+}
+
+static void rx_arm(void)
+{
+    if (m_rx_armed || (m_configuration == 0) ||
+        (m_rx_filled == NRFX_USBD_CDC_ACM_RX_SLOT_COUNT))
+    {
+        return;
+    }
+
+    NRFX_USBD_TRANSFER_OUT(transfer, m_rx_slots[m_rx_head], NRFX_USBD_CDC_ACM_RX_SLOT_SIZE);
+    if (nrfx_usbd_ep_transfer(CDC_ACM_EP_DATA_OUT, &transfer) == NRFX_SUCCESS)
+    {
+        m_rx_armed = true;
+    }
+}
+
+static void rx_transfer_done(void)
+{
+    size_t size;
+    (void)nrfx_usbd_ep_status_get(CDC_ACM_EP_DATA_OUT, &size);
+
+    m_rx_armed = false;
+    if (size > 0)
+    {
+        m_rx_length[m_rx_head] = size;
+        m_rx_head = (uint8_t)((m_rx_head + 1) % NRFX_USBD_CDC_ACM_RX_SLOT_COUNT);
+        m_rx_filled++;
+    }
+    // Start filling the next slot before the application is notified about this one.
+    rx_arm();
+
+    if (size > 0)
+    {
+        nrfx_usbd_cdc_acm_evt_t evt = { .type = NRFX_USBD_CDC_ACM_EVT_RX_READY };
+        event_send(&evt);
+    }
+}
+
+static void data_interface_start(void)
+{
+    nrfx_usbd_ring_init(&m_tx_ring, m_tx_buffer, sizeof(m_tx_buffer));
+    m_tx_state  = CDC_ACM_TX_IDLE;
+    m_rx_head   = 0;
+    m_rx_tail   = 0;
+    m_rx_filled = 0;
+    m_rx_offset = 0;
+    m_rx_armed  = false;
+
+    nrfx_usbd_ep_enable(CDC_ACM_EP_COMM);
+    nrfx_usbd_ep_enable(CDC_ACM_EP_DATA_IN);
+    nrfx_usbd_ep_enable(CDC_ACM_EP_DATA_OUT);
+    nrfx_usbd_ep_dtoggle_clear(CDC_ACM_EP_COMM);
+    nrfx_usbd_ep_dtoggle_clear(CDC_ACM_EP_DATA_IN);
+    nrfx_usbd_ep_dtoggle_clear(CDC_ACM_EP_DATA_OUT);
+
+    rx_arm();
+}
+
+static void data_interface_stop(void)
+{
+    nrfx_usbd_ep_disable(CDC_ACM_EP_COMM);
+    nrfx_usbd_ep_disable(CDC_ACM_EP_DATA_IN);
+    nrfx_usbd_ep_disable(CDC_ACM_EP_DATA_OUT);
+    m_tx_state = CDC_ACM_TX_IDLE;
+    m_rx_armed = false;
+}
+
+static void configuration_set(uint8_t configuration)
+{
+    // Clear the configuration first, so that aborted transfers are not restarted.
+    uint8_t previous = m_configuration;
+    m_configuration = 0;
+    if (previous != 0)
+    {
+        data_interface_stop();
+    }
+
+    if (m_line_state != 0)
+    {
+        m_line_state = 0;
+        line_state_event_send();
+    }
+
+    m_configuration = configuration;
+    if (configuration != 0)
+    {
+        data_interface_start();
+    }
+}
+
+static void ep0_in_respond(nrfx_usbd_setup_t const * p_setup, void const * p_data, size_t length)
+{
+    size_t size = NRFX_MIN(length, (size_t)p_setup->wLength);
+    // A response shorter than requested must be terminated with a short packet.
+    uint32_t flags = ((size < p_setup->wLength) && ((size % NRFX_USBD_EPSIZE) == 0)) ?
+                     NRFX_USBD_TRANSFER_ZLP_FLAG : 0;
+
+    NRFX_USBD_TRANSFER_IN(transfer, p_data, size, flags);
+    if (nrfx_usbd_ep_transfer(NRFX_USBD_EPIN0, &transfer) != NRFX_SUCCESS)
+    {
+        nrfx_usbd_setup_stall();
+    }
+}
+
+static bool string_desc_get(uint8_t index, void const ** pp_desc, size_t * p_length)
+{
+    if (index == 0)
+    {
+        *pp_desc  = m_langid_desc;
+        *p_length = sizeof(m_langid_desc);
+        return true;
+    }
+    if ((index > NRFX_ARRAY_SIZE(m_strings)) || (m_strings[index - 1] == NULL))
+    {
+        return false;
+    }
+
+    char const * p_string = m_strings[index - 1];
+    size_t       length   = strlen(p_string);
+
+    m_string_desc[0] = (uint8_t)(2 + 2 * length);
+    m_string_desc[1] = USB_DESC_STRING;
+    for (size_t i = 0; i < length; i++)
+    {
+        m_string_desc[2 + 2 * i]     = (uint8_t)p_string[i];
+        m_string_desc[2 + 2 * i + 1] = 0;
+    }
+    *pp_desc  = m_string_desc;
+    *p_length = m_string_desc[0];
+    return true;
+}
+
+static bool descriptor_get(nrfx_usbd_setup_t const * p_setup)
+{
+    uint8_t      type  = CDC_ACM_MSB(p_setup->wValue);
+    uint8_t      index = CDC_ACM_LSB(p_setup->wValue);
+    void const * p_desc;
+    size_t       length;
+
+    switch (type)
+    {
+        case USB_DESC_DEVICE:
+            p_desc = m_device_desc;
+            length = sizeof(m_device_desc);
+            break;
+
+        case USB_DESC_CONFIGURATION:
+            if (index != 0)
+            {
+                return false;
+            }
+            p_desc = m_config_desc;
+            length = sizeof(m_config_desc);
+            break;
+
+        case USB_DESC_STRING:
+            if (!string_desc_get(index, &p_desc, &length))
+            {
+                return false;
+            }
+            break;
+
+        default:
+            // Including the device qualifier, which a full-speed only device does not have.
+            return false;
+    }
+
+    ep0_in_respond(p_setup, p_desc, length);
+    return true;
+}
+
+static bool endpoint_valid(uint16_t index)
+{
+    switch (index)
+    {
+        case NRFX_USBD_EPOUT0:
+        case NRFX_USBD_EPIN0:
+            return true;
+        case CDC_ACM_EP_COMM:
+        case CDC_ACM_EP_DATA_IN:
+        case CDC_ACM_EP_DATA_OUT:
+            return m_configuration != 0;
+        default:
+            return false;
+    }
+}
+
+static bool feature_set(nrfx_usbd_setup_t const * p_setup, bool set)
+{
+    if (((p_setup->bmRequestType & USB_REQ_RECIPIENT_MASK) == USB_REQ_RECIPIENT_DEVICE) &&
+        !set)
+    {
+        // Remote wake-up is not supported, so there is nothing to clear.
+        nrfx_usbd_setup_clear();
+        return true;
+    }
+    if (((p_setup->bmRequestType & USB_REQ_RECIPIENT_MASK) != USB_REQ_RECIPIENT_EP) ||
+        (p_setup->wValue != USB_FEATURE_ENDPOINT_HALT) ||
+        !endpoint_valid(p_setup->wIndex) ||
+        (NRF_USBD_EP_NR_GET(p_setup->wIndex) == 0))
+    {
+        return false;
+    }
+
+    nrfx_usbd_ep_t ep = (nrfx_usbd_ep_t)p_setup->wIndex;
+    if (set)
+    {
+        nrfx_usbd_ep_stall(ep);
+    }
+    else
+    {
+        nrfx_usbd_ep_stall_clear(ep);
+        nrfx_usbd_ep_dtoggle_clear(ep);
+    }
+    nrfx_usbd_setup_clear();
+    return true;
+}
+
+static bool status_get(nrfx_usbd_setup_t const * p_setup)
+{
+    m_ep0_buffer[0] = 0;
+    m_ep0_buffer[1] = 0;
+
+    switch (p_setup->bmRequestType & USB_REQ_RECIPIENT_MASK)
+    {
+        case USB_REQ_RECIPIENT_DEVICE:
+            // Bus powered, remote wake-up disabled.
+            break;
+        case USB_REQ_RECIPIENT_IFACE:
+            if ((m_configuration == 0) || (p_setup->wIndex > CDC_ACM_INTERFACE_DATA))
+            {
+                return false;
+            }
+            break;
+        case USB_REQ_RECIPIENT_EP:
+            if (!endpoint_valid(p_setup->wIndex))
+            {
+                return false;
+            }
+            m_ep0_buffer[0] = nrfx_usbd_ep_stall_check((nrfx_usbd_ep_t)p_setup->wIndex) ? 1 : 0;
+            break;
+        default:
+            return false;
+    }
+
+    ep0_in_respond(p_setup, m_ep0_buffer, 2);
+    return true;
+}
+
+static bool standard_request_handle(nrfx_usbd_setup_t const * p_setup)
+{
+    switch (p_setup->bRequest)
+    {
+        case USB_REQ_GET_STATUS:
+            return status_get(p_setup);
+
+        case USB_REQ_CLEAR_FEATURE:
+            return feature_set(p_setup, false);
+
+        case USB_REQ_SET_FEATURE:
+            return feature_set(p_setup, true);
+
+        case USB_REQ_SET_ADDRESS:
+            // The address is set by the peripheral.
+            nrfx_usbd_setup_clear();
+            return true;
+
+        case USB_REQ_GET_DESCRIPTOR:
+            return descriptor_get(p_setup);
+
+        case USB_REQ_GET_CONFIGURATION:
+            m_ep0_buffer[0] = m_configuration;
+            ep0_in_respond(p_setup, m_ep0_buffer, 1);
+            return true;
+
+        case USB_REQ_SET_CONFIGURATION:
+            if (p_setup->wValue > CDC_ACM_CONFIGURATION)
+            {
+                return false;
+            }
+            configuration_set((uint8_t)p_setup->wValue);
+            nrfx_usbd_setup_clear();
+            return true;
+
+        case USB_REQ_GET_INTERFACE:
+            if ((m_configuration == 0) || (p_setup->wIndex > CDC_ACM_INTERFACE_DATA))
+            {
+                return false;
+            }
+            m_ep0_buffer[0] = 0;
+            ep0_in_respond(p_setup, m_ep0_buffer, 1);
+            return true;
+
+        case USB_REQ_SET_INTERFACE:
+            // Only the default alternate settings exist.
+            if ((m_configuration == 0) || (p_setup->wIndex > CDC_ACM_INTERFACE_DATA) ||
+                (p_setup->wValue != 0))
+            {
+                return false;
+            }
+            nrfx_usbd_setup_clear();
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+static bool class_request_handle(nrfx_usbd_setup_t const * p_setup)
+{
+    if (((p_setup->bmRequestType & USB_REQ_RECIPIENT_MASK) != USB_REQ_RECIPIENT_IFACE) ||
+        (p_setup->wIndex != CDC_ACM_INTERFACE_COMM))
+    {
+        return false;
+    }
+
+    switch (p_setup->bRequest)
+    {
+        case CDC_REQ_SET_LINE_CODING:
+        {
+            if (p_setup->wLength != CDC_LINE_CODING_SIZE)
+            {
+                return false;
+            }
+            NRFX_USBD_TRANSFER_OUT(transfer, m_ep0_buffer, CDC_LINE_CODING_SIZE);
+            if (nrfx_usbd_ep_transfer(NRFX_USBD_EPOUT0, &transfer) != NRFX_SUCCESS)
+            {
+                return false;
+            }
+            // The status stage is completed when the data arrives.
+            m_ep0_line_coding = true;
+            nrfx_usbd_setup_data_clear();
+            return true;
+        }
+
+        case CDC_REQ_GET_LINE_CODING:
+            m_ep0_buffer[0] = (uint8_t)(m_line_coding.baudrate);
+            m_ep0_buffer[1] = (uint8_t)(m_line_coding.baudrate >> 8);
+            m_ep0_buffer[2] = (uint8_t)(m_line_coding.baudrate >> 16);
+            m_ep0_buffer[3] = (uint8_t)(m_line_coding.baudrate >> 24);
+            m_ep0_buffer[4] = m_line_coding.stop_bits;
+            m_ep0_buffer[5] = (uint8_t)m_line_coding.parity;
+            m_ep0_buffer[6] = m_line_coding.data_bits;
+            ep0_in_respond(p_setup, m_ep0_buffer, CDC_LINE_CODING_SIZE);
+            return true;
+
+        case CDC_REQ_SET_CONTROL_LINE_STATE:
+            nrfx_usbd_setup_clear();
+            if (m_line_state != p_setup->wValue)
+            {
+                m_line_state = p_setup->wValue;
+                line_state_event_send();
+            }
+            return true;
+
+        case CDC_REQ_SEND_BREAK:
+            nrfx_usbd_setup_clear();
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+static void setup_handle(void)
+{
+    nrfx_usbd_setup_t setup;
+    bool              handled;
+
+    nrfx_usbd_setup_get(&setup);
+    m_ep0_line_coding = false;
+
+    switch (setup.bmRequestType & USB_REQ_TYPE_MASK)
+    {
+        case USB_REQ_TYPE_STANDARD:
+            handled = standard_request_handle(&setup);
+            break;
+        case USB_REQ_TYPE_CLASS:
+            handled = class_request_handle(&setup);
+            break;
+        default:
+            handled = false;
+            break;
+    }
+
+    if (!handled)
+    {
+        nrfx_usbd_setup_stall();
+    }
+}
+
+static void line_coding_received(void)
+{
+    m_ep0_line_coding = false;
+    nrfx_usbd_setup_clear();
+
+    m_line_coding.baudrate  = (uint32_t)m_ep0_buffer[0]         |
+                              ((uint32_t)m_ep0_buffer[1] << 8)  |
+                              ((uint32_t)m_ep0_buffer[2] << 16) |
+                              ((uint32_t)m_ep0_buffer[3] << 24);
+    m_line_coding.stop_bits = m_ep0_buffer[4];
+    m_line_coding.parity    = (nrfx_usbd_cdc_acm_parity_t)m_ep0_buffer[5];
+    m_line_coding.data_bits = m_ep0_buffer[6];
+
+    nrfx_usbd_cdc_acm_evt_t evt = {
+        .type = NRFX_USBD_CDC_ACM_EVT_LINE_CODING,
+        .data = { .line_coding = m_line_coding },
+    };
+    event_send(&evt);
+}
+
+static void ep_transfer_handle(nrfx_usbd_ep_t ep, nrfx_usbd_ep_status_t status)
+{
+    switch (ep)
+    {
+        case NRFX_USBD_EPIN0:
+            if (status == NRFX_USBD_EP_OK)
+            {
+                nrfx_usbd_setup_clear();
+            }
+            break;
+
+        case NRFX_USBD_EPOUT0:
+            if ((status == NRFX_USBD_EP_OK) && m_ep0_line_coding)
+            {
+                line_coding_received();
+            }
+            break;
+
+        case CDC_ACM_EP_DATA_IN:
+            if (m_configuration == 0)
+            {
+                m_tx_state = CDC_ACM_TX_IDLE;
+            }
+            else if (status == NRFX_USBD_EP_OK)
+            {
+                tx_transfer_done();
+            }
+            else
+            {
+                // The transfer was aborted. Data left in the ring is sent in a new one.
+                m_tx_state = CDC_ACM_TX_IDLE;
+                if (m_tx_ring.head != m_tx_ring.tail)
+                {
+                    tx_ring_start();
+                }
+            }
+            break;
+
+        case CDC_ACM_EP_DATA_OUT:
+            if (status == NRFX_USBD_EP_WAITING)
+            {
+                // Data is held in the endpoint until a slot is armed.
+                break;
+            }
+            if ((status == NRFX_USBD_EP_OK) || (status == NRFX_USBD_EP_OVERLOAD))
+            {
+                rx_transfer_done();
+            }
+            else
+            {
+                m_rx_armed = false;
+                rx_arm();
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+static void usbd_event_handler(nrfx_usbd_evt_t const * p_event)
+{
+    switch (p_event->type)
+    {
+        case NRFX_USBD_EVT_RESET:
+            configuration_set(0);
+            line_coding_default_set();
+            break;
+
+        case NRFX_USBD_EVT_SETUP:
+            setup_handle();
+            break;
+
+        case NRFX_USBD_EVT_EPTRANSFER:
+            ep_transfer_handle(p_event->data.eptransfer.ep, p_event->data.eptransfer.status);
+            break;
+
+        default:
+            break;
+    }
+}
+
+nrfx_err_t nrfx_usbd_cdc_acm_init(nrfx_usbd_cdc_acm_config_t const * p_config,
+                                  nrfx_usbd_cdc_acm_event_handler_t  handler,
+                                  void *                             p_context)
+{
+    NRFX_ASSERT(p_config);
+    NRFX_ASSERT(handler);
+
+    char const * strings[] = { p_config->p_manufacturer, p_config->p_product, p_config->p_serial };
+    for (size_t i = 0; i < NRFX_ARRAY_SIZE(strings); i++)
+    {
+        if ((strings[i] != NULL) && (strlen(strings[i]) > NRFX_USBD_CDC_ACM_STRING_LENGTH_MAX))
+        {
+            return NRFX_ERROR_INVALID_LENGTH;
+        }
+    }
+
+    nrfx_err_t err_code = nrfx_usbd_init(usbd_event_handler);
+    if (err_code != NRFX_SUCCESS)
+    {
+        return err_code;
+    }
+
+    m_handler   = handler;
+    m_p_context = p_context;
+    memcpy(m_strings, strings, sizeof(m_strings));
+
+    memcpy(m_device_desc, m_device_desc_template, sizeof(m_device_desc));
+    m_device_desc[8]  = CDC_ACM_LSB(p_config->vendor_id);
+    m_device_desc[9]  = CDC_ACM_MSB(p_config->vendor_id);
+    m_device_desc[10] = CDC_ACM_LSB(p_config->product_id);
+    m_device_desc[11] = CDC_ACM_MSB(p_config->product_id);
+    m_device_desc[14] = (m_strings[0] != NULL) ? USB_STRING_MANUFACTURER : 0;
+    m_device_desc[15] = (m_strings[1] != NULL) ? USB_STRING_PRODUCT : 0;
+    m_device_desc[16] = (m_strings[2] != NULL) ? USB_STRING_SERIAL : 0;
+
+    m_configuration   = 0;
+    m_line_state      = 0;
+    m_ep0_line_coding = false;
+    m_tx_state        = CDC_ACM_TX_IDLE;
+    m_rx_armed        = false;
+    line_coding_default_set();
+    nrfx_usbd_ring_init(&m_tx_ring, m_tx_buffer, sizeof(m_tx_buffer));
+
+    nrfx_usbd_ep_max_packet_size_set(CDC_ACM_EP_COMM, CDC_ACM_EP_COMM_SIZE);
+    return NRFX_SUCCESS;
+}
+
+void nrfx_usbd_cdc_acm_uninit(void)
+{
+    nrfx_usbd_uninit();
+    m_configuration = 0;
+    m_handler       = NULL;
+}
+
+size_t nrfx_usbd_cdc_acm_write(void const * p_data, size_t length)
+{
+    NRFX_ASSERT(p_data || (length == 0));
+
+    if (m_configuration == 0)
+    {
+        return 0;
+    }
+
+    uint8_t const * p_src   = (uint8_t const *)p_data;
+    size_t          written = 0;
+    while (written < length)
+    {
+        uint8_t * p_dst;
+        size_t    chunk = nrfx_usbd_ring_claim(&m_tx_ring, &p_dst);
+        if (chunk == 0)
+        {
+            break;
+        }
+        chunk = NRFX_MIN(chunk, length - written);
+        memcpy(p_dst, &p_src[written], chunk);
+        nrfx_usbd_ring_commit(&m_tx_ring, chunk);
+        written += chunk;
+    }
+
+    if (written > 0)
+    {
+        // A running transfer picks the data up by itself.
+        NRFX_CRITICAL_SECTION_ENTER();
+        if ((m_tx_state == CDC_ACM_TX_IDLE) && (m_configuration != 0))
+        {
+            tx_ring_start();
+        }
+        NRFX_CRITICAL_SECTION_EXIT();
+    }
+    return written;
+}
+
+size_t nrfx_usbd_cdc_acm_write_space_get(void)
+{
+    size_t head = m_tx_ring.head;
+    size_t tail = m_tx_ring.tail;
+    size_t used = (head >= tail) ? (head - tail) : (m_tx_ring.size - tail + head);
+
+    return m_tx_ring.size - 1 - used;
+}
+
+size_t nrfx_usbd_cdc_acm_read(void * p_data, size_t length)
+{
+    NRFX_ASSERT(p_data || (length == 0));
+
+    uint8_t * p_dst = (uint8_t *)p_data;
+    size_t    read  = 0;
+    while ((read < length) && (m_rx_filled > 0))
+    {
+        size_t chunk = NRFX_MIN(m_rx_length[m_rx_tail] - m_rx_offset, length - read);
+        memcpy(&p_dst[read], &m_rx_slots[m_rx_tail][m_rx_offset], chunk);
+        read        += chunk;
+        m_rx_offset += chunk;
+
+        if (m_rx_offset == m_rx_length[m_rx_tail])
+        {
+            m_rx_offset = 0;
+            m_rx_tail = (uint8_t)((m_rx_tail + 1) % NRFX_USBD_CDC_ACM_RX_SLOT_COUNT);
+
+            NRFX_CRITICAL_SECTION_ENTER();
+            m_rx_filled--;
+            // Reception stops only when all slots are filled, so it is resumed here.
+            rx_arm();
+            NRFX_CRITICAL_SECTION_EXIT();
+        }
+    }
+    return read;
+}
+
+void nrfx_usbd_cdc_acm_line_coding_get(nrfx_usbd_cdc_acm_line_coding_t * p_line_coding)
+{
+    NRFX_ASSERT(p_line_coding);
+
+    NRFX_CRITICAL_SECTION_ENTER();
+    *p_line_coding = m_line_coding;
+    NRFX_CRITICAL_SECTION_EXIT();
+}
+
+bool nrfx_usbd_cdc_acm_is_configured(void)
+{
+    return m_configuration != 0;
+}
+
+#endif // NRFX_CHECK(NRFX_USBD_ENABLED)
@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef NRFX_USBD_CDC_ACM_H__
+#define NRFX_USBD_CDC_ACM_H__
+
+#include <nrfx.h>
+#include <nrfx_usbd.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_usbd_cdc_acm USBD CDC ACM
+ * @{
+ * @ingroup nrfx_usbd
+ * @brief   Serial port over USB (CDC ACM class) built on the USBD driver.
+ *
+ * The module owns the USBD driver. It provides the device and configuration descriptors,
+ * handles the standard and the CDC ACM class requests on the control endpoint and moves
+ * the data over a pair of bulk endpoints.
+ *
+ * Data to be sent is copied to a ring buffer of @ref NRFX_USBD_CDC_ACM_TX_BUFFER_SIZE bytes
+ * and streamed with @ref nrfx_usbd_ep_ring_transfer. Data written while a transfer is in
+ * progress joins that transfer, so the host is served full packets back to back as long as
+ * the buffer does not run empty. A zero-length packet is sent when the data runs out
+ * exactly at a packet boundary, so that the host completes its read request immediately.
+ *
+ * Received data is stored in @ref NRFX_USBD_CDC_ACM_RX_SLOT_COUNT slots of
+ * @ref NRFX_USBD_CDC_ACM_RX_SLOT_SIZE bytes. A transfer into the next free slot is started as
+ * soon as the previous one finishes, so reception continues while the application reads
+ * the filled slots. When all slots are filled, no transfer is started and the endpoint
+ * answers the host with NAK until @ref nrfx_usbd_cdc_acm_read frees a slot, which
+ * provides the flow control without losing data.
+ *
+ * The application is responsible for the USB power events. Call @ref nrfx_usbd_enable
+ * and @ref nrfx_usbd_start when the USB power is ready, and @ref nrfx_usbd_stop
+ * and @ref nrfx_usbd_disable when it is removed. Bus suspend is not handled, so the
+ * peripheral stays active when the host suspends the bus.
+ *
+ * Functions @ref nrfx_usbd_cdc_acm_write and @ref nrfx_usbd_cdc_acm_read can be called
+ * from the event handler and from the application context, but only one context at a time
+ * may write and only one may read.
+ */
+
+#ifndef NRFX_USBD_CDC_ACM_TX_BUFFER_SIZE
+/**
+ * @brief Size of the transmit ring buffer in bytes.
+ *
+ * Must be a multiple of @ref NRFX_USBD_EPSIZE. One byte of the buffer is always left unused.
+ */
+#define NRFX_USBD_CDC_ACM_TX_BUFFER_SIZE 2048
+#endif
+
+#ifndef NRFX_USBD_CDC_ACM_RX_SLOT_SIZE
+/**
+ * @brief Size of a receive slot in bytes.
+ *
+ * Must be a multiple of @ref NRFX_USBD_EPSIZE. A slot is filled by a single transfer that
+ * ends when the slot is full or when the host sends a short packet.
+ */
+#define NRFX_USBD_CDC_ACM_RX_SLOT_SIZE 256
+#endif
+
+#ifndef NRFX_USBD_CDC_ACM_RX_SLOT_COUNT
+/** @brief Number of receive slots. At least 2, so that reception continues during reading. */
+#define NRFX_USBD_CDC_ACM_RX_SLOT_COUNT 4
+#endif
+
+#ifndef NRFX_USBD_CDC_ACM_STRING_LENGTH_MAX
+/** @brief Maximum number of characters in a string descriptor. */
+#define NRFX_USBD_CDC_ACM_STRING_LENGTH_MAX 31
+#endif
+
+/** @brief Parity settings requested by the host. */
+typedef enum
+{
+    NRFX_USBD_CDC_ACM_PARITY_NONE  = 0, ///< No parity.
+    NRFX_USBD_CDC_ACM_PARITY_ODD   = 1, ///< Odd parity.
+    NRFX_USBD_CDC_ACM_PARITY_EVEN  = 2, ///< Even parity.
+    NRFX_USBD_CDC_ACM_PARITY_MARK  = 3, ///< Mark parity.
+    NRFX_USBD_CDC_ACM_PARITY_SPACE = 4, ///< Space parity.
+} nrfx_usbd_cdc_acm_parity_t;
+
+/**
+ * @brief Line coding requested by the host.
+ *
+ * The settings do not affect the data transfer. They are reported so that the application
+ * can, for example, configure a UART that the data is bridged to.
+ */
+typedef struct
+{
+    uint32_t                   baudrate;  ///< Data terminal rate in bits per second.
+    uint8_t                    stop_bits; ///< Stop bits: 0 - 1 bit, 1 - 1.5 bits, 2 - 2 bits.
+    nrfx_usbd_cdc_acm_parity_t parity;    ///< Parity.
+    uint8_t                    data_bits; ///< Data bits: 5, 6, 7, 8, or 16.
+} nrfx_usbd_cdc_acm_line_coding_t;
+
+/** @brief Event types. */
+typedef enum
+{
+    NRFX_USBD_CDC_ACM_EVT_RX_READY,    ///< Received data is available for @ref nrfx_usbd_cdc_acm_read.
+    NRFX_USBD_CDC_ACM_EVT_TX_DONE,     ///< All written data has been sent to the host.
+    NRFX_USBD_CDC_ACM_EVT_LINE_STATE,  ///< Host changed the DTR or RTS signal, or the port was closed by a bus reset.
+    NRFX_USBD_CDC_ACM_EVT_LINE_CODING, ///< Host changed the line coding.
+} nrfx_usbd_cdc_acm_evt_type_t;
+
+/** @brief Event structure. */
+typedef struct
+{
+    nrfx_usbd_cdc_acm_evt_type_t type; ///< Event type.
+    union
+    {
+        struct
+        {
+            bool dtr; ///< Data Terminal Ready signal. Set when a terminal opens the port.
+            bool rts; ///< Request To Send signal.
+        } line_state;                                ///< Data for @ref NRFX_USBD_CDC_ACM_EVT_LINE_STATE.
+        nrfx_usbd_cdc_acm_line_coding_t line_coding; ///< Data for @ref NRFX_USBD_CDC_ACM_EVT_LINE_CODING.
+    } data; ///< Union to store event data.
+} nrfx_usbd_cdc_acm_evt_t;
+
+/**
+ * @brief CDC ACM event handler type.
+ *
+ * The handler is called from the USBD interrupt.
+ *
+ * @param[in] p_event   Pointer to the event structure.
+ * @param[in] p_context User context.
+ */
+typedef void (*nrfx_usbd_cdc_acm_event_handler_t)(nrfx_usbd_cdc_acm_evt_t const * p_event,
+                                                  void *                          p_context);
+
+/** @brief Configuration structure. */
+typedef struct
+{
+    uint16_t     vendor_id;      ///< Vendor ID reported in the device descriptor.
+    uint16_t     product_id;     ///< Product ID reported in the device descriptor.
+    char const * p_manufacturer; ///< Manufacturer string in ASCII, or NULL if not provided.
+    char const * p_product;      ///< Product string in ASCII, or NULL if not provided.
+    char const * p_serial;       ///< Serial number string in ASCII, or NULL if not provided.
+} nrfx_usbd_cdc_acm_config_t;
+
+/**
+ * @brief Function for initializing the module and the USBD driver.
+ *
+ * The strings pointed to by the configuration must stay valid until the module is uninitialized.
+ *
+ * @param[in] p_config  Pointer to the configuration structure.
+ * @param[in] handler   Event handler. Must not be NULL.
+ * @param[in] p_context User context passed to the event handler.
+ *
+ * @retval NRFX_SUCCESS                   Initialization was successful.
+ * @retval NRFX_ERROR_INVALID_LENGTH      One of the strings exceeds
+ *                                        @ref NRFX_USBD_CDC_ACM_STRING_LENGTH_MAX characters.
+ * @retval NRFX_ERROR_ALREADY_INITIALIZED The USBD driver is already initialized.
+ */
+nrfx_err_t nrfx_usbd_cdc_acm_init(nrfx_usbd_cdc_acm_config_t const * p_config,
+                                  nrfx_usbd_cdc_acm_event_handler_t  handler,
+                                  void *                             p_context);
+
+/** @brief Function for uninitializing the module and the USBD driver. */
+void nrfx_usbd_cdc_acm_uninit(void);
+
+/**
+ * @brief Function for queuing data to be sent to the host.
+ *
+ * The data is copied to the transmit buffer, so the buffer can be reused when the function
+ * returns. Only as much data as fits in the free space of the transmit buffer is accepted.
+ *
+ * @param[in] p_data Pointer to the data.
+ * @param[in] length Number of bytes to send.
+ *
+ * @return Number of bytes accepted. 0 if the host has not configured the device.
+ */
+size_t nrfx_usbd_cdc_acm_write(void const * p_data, size_t length);
+
+/**
+ * @brief Function for getting the free space in the transmit buffer.
+ *
+ * @return Number of bytes that @ref nrfx_usbd_cdc_acm_write will accept.
+ */
+size_t nrfx_usbd_cdc_acm_write_space_get(void);
+
+/**
+ * @brief Function for reading the received data.
+ *
+ * Each receive slot emptied by the call is released for the reception.
+ *
+ * @param[out] p_data Pointer to the buffer for the data.
+ * @param[in]  length Size of the buffer.
+ *
+ * @return Number of bytes read.
+ */
+size_t nrfx_usbd_cdc_acm_read(void * p_data, size_t length);
+
+/**
+ * @brief Function for getting the line coding last set by the host.
+ *
+ * Before the host sets it, 115200 baud, 8 data bits, no parity, and 1 stop bit is reported.
+ *
+ * @param[out] p_line_coding Pointer to the structure to be filled.
+ */
+void nrfx_usbd_cdc_acm_line_coding_get(nrfx_usbd_cdc_acm_line_coding_t * p_line_coding);
+
+/**
+ * @brief Function for checking if the host has configured the device.
+ *
+ * @retval true  The device is configured and the data can be transferred.
+ * @retval false The device is not configured.
+ */
+bool nrfx_usbd_cdc_acm_is_configured(void);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_USBD_CDC_ACM_H__
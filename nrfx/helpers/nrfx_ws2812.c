@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx.h>
+
+#if NRFX_CHECK(NRFX_PWM_ENABLED)
+
+#include <helpers/nrfx_ws2812.h>
+#include <string.h>
+
+#define B0 NRFX_WS2812_BIT0
+#define B1 NRFX_WS2812_BIT1
+
+/**
+ * @brief Duty cycle values of all nibbles, the most significant bit first.
+ *
+ * A table for whole bytes would take 4 kB, while one for nibbles is looked up only
+ * twice per byte.
+ */
+static const nrf_pwm_values_common_t m_nibbles[16][4] =
+{
+    { B0, B0, B0, B0 }, { B0, B0, B0, B1 }, { B0, B0, B1, B0 }, { B0, B0, B1, B1 },
+    { B0, B1, B0, B0 }, { B0, B1, B0, B1 }, { B0, B1, B1, B0 }, { B0, B1, B1, B1 },
+    { B1, B0, B0, B0 }, { B1, B0, B0, B1 }, { B1, B0, B1, B0 }, { B1, B0, B1, B1 },
+    { B1, B1, B0, B0 }, { B1, B1, B0, B1 }, { B1, B1, B1, B0 }, { B1, B1, B1, B1 },
+};
+
+#undef B0
+#undef B1
+
+void nrfx_ws2812_frame_set(nrfx_ws2812_t * p_enc, uint8_t const * p_data, size_t length)
+{
+    NRFX_ASSERT(p_enc);
+    NRFX_ASSERT(p_data || (length == 0));
+
+    p_enc->p_data     = p_data;
+    p_enc->length     = length;
+    p_enc->offset     = 0;
+    p_enc->reset_left = NRFX_WS2812_RESET_PERIODS;
+    p_enc->buffer_idx = 0;
+}
+
+bool nrfx_ws2812_producer(nrf_pwm_sequence_t * p_chunk, void * p_context)
+{
+    nrfx_ws2812_t *           p_enc    = (nrfx_ws2812_t *)p_context;
+    nrf_pwm_values_common_t * p_values = p_enc->buffers[p_enc->buffer_idx];
+    uint32_t                  count    = 0;
+
+    // Everything has been provided in the previous calls.
+    if ((p_enc->offset == p_enc->length) && (p_enc->reset_left == 0))
+    {
+        return false;
+    }
+
+    while ((p_enc->offset < p_enc->length) && (count < NRFX_ARRAY_SIZE(p_enc->buffers[0])))
+    {
+        uint8_t byte = p_enc->p_data[p_enc->offset++];
+
+        memcpy(&p_values[count],     m_nibbles[byte >> 4],   sizeof(m_nibbles[0]));
+        memcpy(&p_values[count + 4], m_nibbles[byte & 0xF], sizeof(m_nibbles[0]));
+        count += 8;
+    }
+
+    // The reset period follows the data, so the last bit is not cut off by the stop.
+    while ((p_enc->reset_left > 0) && (count < NRFX_ARRAY_SIZE(p_enc->buffers[0])))
+    {
+        p_values[count++] = NRFX_WS2812_IDLE;
+        p_enc->reset_left--;
+    }
+
+    p_chunk->values.p_common = p_values;
+    p_chunk->length          = (uint16_t)count;
+    p_enc->buffer_idx ^= 1;
+    return true;
+}
+
+#endif // NRFX_CHECK(NRFX_PWM_ENABLED)
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_WS2812_H__
+#define NRFX_WS2812_H__
+
+#include <nrfx.h>
+#include <nrfx_pwm.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrfx_ws2812 WS2812 encoder
+ * @{
+ * @ingroup nrfx
+ * @brief   Encoder of the WS2812 addressable LED protocol for the PWM streaming playback.
+ *
+ * Each bit of the LED data is sent as one PWM period, whose duty cycle encodes
+ * the bit value. Instead of keeping one duty cycle value per bit for the whole frame,
+ * the encoder expands the data on the fly into two small buffers that are played
+ * alternately with @ref nrfx_pwm_stream_playback, from the PWM interrupt handler.
+ * The data is expanded with a lookup table, a nibble at a time.
+ *
+ * The PWM driver instance must be initialized with @ref NRFX_WS2812_PWM_CONFIG
+ * and with the pointer to the encoder instance structure as the context.
+ * Each frame is set with @ref nrfx_ws2812_frame_set and then played with
+ * @ref nrfx_pwm_stream_playback and @ref NRFX_WS2812_STREAM_CONFIG. The playback stops
+ * by itself after the latch (reset) period that follows the frame.
+ */
+
+/** @brief Number of data bytes expanded into one buffer. */
+#ifndef NRFX_WS2812_CHUNK_BYTES
+#define NRFX_WS2812_CHUNK_BYTES 12
+#endif
+
+/** @brief Number of idle PWM periods played after the frame. The default gives 80 us. */
+#ifndef NRFX_WS2812_RESET_PERIODS
+#define NRFX_WS2812_RESET_PERIODS 64
+#endif
+
+/** @brief PWM counter top value, which gives the bit period of 1.25 us at 16 MHz. */
+#define NRFX_WS2812_PWM_TOP_VALUE 20
+
+/** @brief Duty cycle value of the bit 0. Bit 15 makes the output high at the period start. */
+#define NRFX_WS2812_BIT0 (0x8000 | 6)
+
+/** @brief Duty cycle value of the bit 1. */
+#define NRFX_WS2812_BIT1 (0x8000 | 13)
+
+/** @brief Duty cycle value that keeps the output low. */
+#define NRFX_WS2812_IDLE 0x8000
+
+/**
+ * @brief PWM configuration for the WS2812 protocol.
+ *
+ * @param[in] _pin Pin connected to the data input of the first LED.
+ */
+#define NRFX_WS2812_PWM_CONFIG(_pin)                       \
+{                                                          \
+    .output_pins   = { _pin,                               \
+                       NRFX_PWM_PIN_NOT_USED,              \
+                       NRFX_PWM_PIN_NOT_USED,              \
+                       NRFX_PWM_PIN_NOT_USED               \
+                     },                                    \
+    .irq_priority  = NRFX_PWM_DEFAULT_CONFIG_IRQ_PRIORITY, \
+    .base_clock    = NRF_PWM_CLK_16MHz,                    \
+    .count_mode    = NRF_PWM_MODE_UP,                      \
+    .top_value     = NRFX_WS2812_PWM_TOP_VALUE,            \
+    .load_mode     = NRF_PWM_LOAD_COMMON,                  \
+    .step_mode     = NRF_PWM_STEP_AUTO,                    \
+    .skip_gpio_cfg = false                                 \
+}
+
+/** @brief PWM streaming configuration for the WS2812 protocol. */
+#define NRFX_WS2812_STREAM_CONFIG       \
+{                                       \
+    .producer   = nrfx_ws2812_producer, \
+    .idle_value = NRFX_WS2812_IDLE,     \
+    .repeats    = 0                     \
+}
+
+/** @brief Encoder instance structure. */
+typedef struct
+{
+    uint8_t const *         p_data;     ///< Frame data. For internal use only.
+    size_t                  length;     ///< Length of the frame data. For internal use only.
+    size_t                  offset;     ///< Offset of the next byte to be expanded. For internal use only.
+    uint32_t                reset_left; ///< Number of idle periods yet to be expanded. For internal use only.
+    uint8_t                 buffer_idx; ///< Buffer to be filled next. For internal use only.
+    nrf_pwm_values_common_t buffers[2][NRFX_WS2812_CHUNK_BYTES * 8]; ///< Expanded data. For internal use only.
+} nrfx_ws2812_t;
+
+/**
+ * @brief Function for setting the frame to be played next.
+ *
+ * The data must not be modified until the playback of the frame is stopped.
+ *
+ * @param[out] p_enc  Pointer to the encoder instance structure.
+ * @param[in]  p_data Frame data, in the order of transmission. For WS2812 it is
+ *                    the green, red, and blue bytes of the first LED, and so on.
+ * @param[in]  length Length of the frame data, in bytes.
+ */
+void nrfx_ws2812_frame_set(nrfx_ws2812_t * p_enc, uint8_t const * p_data, size_t length);
+
+/**
+ * @brief Producer of the PWM streaming playback.
+ *
+ * @param[in,out] p_chunk   Chunk to be played next.
+ * @param[in]     p_context Pointer to the encoder instance structure.
+ *
+ * @retval true  Playback is to be continued.
+ * @retval false The whole frame and the reset period have been provided.
+ */
+bool nrfx_ws2812_producer(nrf_pwm_sequence_t * p_chunk, void * p_context);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRFX_WS2812_H__
@@ -104,6 +104,147 @@ NOTICE: This file has been modified by Nordic Semiconductor ASA.
     #error "A supported device macro must be defined."
 #endif
 
+/* -- Errata cache -- */
+#if NRF52_ERRATA_CACHE_ENABLE
+/* Value of the errata mask before the cache is built. No erratum uses the highest bit. */
+#define ERRATA_CACHE_INVALID 0xFFFFFFFFul
+
+/* The cache is initialized data, so it is built again on the first use if the C runtime
+   initialization overwrites the values stored by SystemInit. */
+static uint32_t errata_cache        = ERRATA_CACHE_INVALID;
+static uint32_t errata_cache_part;
+static uint32_t errata_cache_revision;
+
+    #define NRF52_ERRATA_APPLIES(n) ((errata_cache & SYSTEM_NRF52_ERRATA_##n##_Msk) != 0)
+
+/* Decodes the chip revision once and evaluates every erratum the startup has a workaround for. */
+static void errata_cache_build(void)
+{
+    uint32_t errata = 0;
+
+    /* Early nRF52832 revisions identify themselves only through the ROM table, the same way the
+       errata helpers read it. */
+    #if IS_NRF52832
+        if (*(uint32_t *)0x10000130ul == 0xFFFFFFFF)
+        {
+            errata_cache_part     = ((*(uint32_t *)0xF0000FE0ul) & 0x000000FFul);
+            errata_cache_revision = ((*(uint32_t *)0xF0000FE8ul) & 0x000000F0ul) >> 4;
+        }
+        else
+    #endif
+        {
+            errata_cache_part     = *(uint32_t *)0x10000130ul;
+            errata_cache_revision = *(uint32_t *)0x10000134ul;
+        }
+
+    #if NRF52_ERRATA_12_ENABLE_WORKAROUND
+        if (nrf52_errata_12()){
+            errata |= SYSTEM_NRF52_ERRATA_12_Msk;
+        }
+    #endif
+    #if NRF52_ERRATA_16_ENABLE_WORKAROUND
+        if (nrf52_errata_16()){
+            errata |= SYSTEM_NRF52_ERRATA_16_Msk;
+        }
+    #endif
+    #if NRF52_ERRATA_31_ENABLE_WORKAROUND
+        if (nrf52_errata_31()){
+            errata |= SYSTEM_NRF52_ERRATA_31_Msk;
+        }
+    #endif
+    #if NRF52_ERRATA_32_ENABLE_WORKAROUND
+        if (nrf52_errata_32()){
+            errata |= SYSTEM_NRF52_ERRATA_32_Msk;
+        }
+    #endif
+    #if NRF52_ERRATA_36_ENABLE_WORKAROUND
+        if (nrf52_errata_36()){
+            errata |= SYSTEM_NRF52_ERRATA_36_Msk;
+        }
+    #endif
+    #if NRF52_ERRATA_37_ENABLE_WORKAROUND
+        if (nrf52_errata_37()){
+            errata |= SYSTEM_NRF52_ERRATA_37_Msk;
+        }
+    #endif
+    #if NRF52_ERRATA_57_ENABLE_WORKAROUND
+        if (nrf52_errata_57()){
+            errata |= SYSTEM_NRF52_ERRATA_57_Msk;
+        }
+    #endif
+    #if NRF52_ERRATA_66_ENABLE_WORKAROUND
+        if (nrf52_errata_66()){
+            errata |= SYSTEM_NRF52_ERRATA_66_Msk;
+        }
+    #endif
+    #if NRF52_ERRATA_98_ENABLE_WORKAROUND
+        if (nrf52_errata_98()){
+            errata |= SYSTEM_NRF52_ERRATA_98_Msk;
+        }
+    #endif
+    #if NRF52_ERRATA_103_ENABLE_WORKAROUND
+        if (nrf52_errata_103()){
+            errata |= SYSTEM_NRF52_ERRATA_103_Msk;
+        }
+    #endif
+    #if NRF52_ERRATA_108_ENABLE_WORKAROUND
+        if (nrf52_errata_108()){
+            errata |= SYSTEM_NRF52_ERRATA_108_Msk;
+        }
+    #endif
+    #if NRF52_ERRATA_115_ENABLE_WORKAROUND
+        if (nrf52_errata_115()){
+            errata |= SYSTEM_NRF52_ERRATA_115_Msk;
+        }
+    #endif
+    #if NRF52_ERRATA_120_ENABLE_WORKAROUND
+        if (nrf52_errata_120()){
+            errata |= SYSTEM_NRF52_ERRATA_120_Msk;
+        }
+    #endif
+    #if NRF52_ERRATA_136_ENABLE_WORKAROUND
+        if (nrf52_errata_136()){
+            errata |= SYSTEM_NRF52_ERRATA_136_Msk;
+        }
+    #endif
+    #if NRF52_ERRATA_182_ENABLE_WORKAROUND
+        if (nrf52_errata_182()){
+            errata |= SYSTEM_NRF52_ERRATA_182_Msk;
+        }
+    #endif
+    #if NRF52_ERRATA_217_ENABLE_WORKAROUND
+        if (nrf52_errata_217()){
+            errata |= SYSTEM_NRF52_ERRATA_217_Msk;
+        }
+    #endif
+
+    errata_cache = errata;
+}
+
+uint32_t SystemErrataGet(void)
+{
+    if (errata_cache == ERRATA_CACHE_INVALID)
+    {
+        errata_cache_build();
+    }
+
+    return errata_cache;
+}
+
+void SystemChipRevisionGet(uint32_t * p_part, uint32_t * p_revision)
+{
+    if (errata_cache == ERRATA_CACHE_INVALID)
+    {
+        errata_cache_build();
+    }
+
+    *p_part     = errata_cache_part;
+    *p_revision = errata_cache_revision;
+}
+#else
+    #define NRF52_ERRATA_APPLIES(n) nrf52_errata_##n()
+#endif
+
 /* -- NVMC utility functions -- */
 /* Waits until NVMC is done with the current pending action */
 void nvmc_wait(void)
@@ -146,10 +287,14 @@ void SystemInit(void)
         TRACEDATA3_PIN_CNF = TRACE_PIN_CONFIG;
     #endif
 
+    #if NRF52_ERRATA_CACHE_ENABLE
+        errata_cache_build();
+    #endif
+
     #if NRF52_ERRATA_12_ENABLE_WORKAROUND
         /* Workaround for Errata 12 "COMP: Reference ladder not correctly calibrated" found at the Errata document
            for your device located at https://infocenter.nordicsemi.com/index.jsp */
-        if (nrf52_errata_12()){
+        if (NRF52_ERRATA_APPLIES(12)){
             *(volatile uint32_t *)0x40013540 = (*(uint32_t *)0x10000324 & 0x00001F00) >> 8;
         }
     #endif
@@ -157,7 +302,7 @@ void SystemInit(void)
     #if NRF52_ERRATA_16_ENABLE_WORKAROUND
         /* Workaround for Errata 16 "System: RAM may be corrupt on wakeup from CPU IDLE" found at the Errata document
            for your device located at https://infocenter.nordicsemi.com/index.jsp */
-        if (nrf52_errata_16()){
+        if (NRF52_ERRATA_APPLIES(16)){
             *(volatile uint32_t *)0x4007C074 = 3131961357ul;
         }
     #endif
@@ -165,7 +310,7 @@ void SystemInit(void)
     #if NRF52_ERRATA_31_ENABLE_WORKAROUND
         /* Workaround for Errata 31 "CLOCK: Calibration values are not correctly loaded from FICR at reset" found at the Errata document
            for your device located at https://infocenter.nordicsemi.com/index.jsp */
-        if (nrf52_errata_31()){
+        if (NRF52_ERRATA_APPLIES(31)){
             *(volatile uint32_t *)0x4000053C = ((*(volatile uint32_t *)0x10000244) & 0x0000E000) >> 13;
         }
     #endif
@@ -173,7 +318,7 @@ void SystemInit(void)
     #if NRF52_ERRATA_32_ENABLE_WORKAROUND
         /* Workaround for Errata 32 "DIF: Debug session automatically enables TracePort pins" found at the Errata document
            for your device located at https://infocenter.nordicsemi.com/index.jsp */
-        if (nrf52_errata_32()){
+        if (NRF52_ERRATA_APPLIES(32)){
             CoreDebug->DEMCR &= ~CoreDebug_DEMCR_TRCENA_Msk;
         }
     #endif
@@ -181,7 +326,7 @@ void SystemInit(void)
     #if NRF52_ERRATA_36_ENABLE_WORKAROUND
         /* Workaround for Errata 36 "CLOCK: Some registers are not reset when expected" found at the Errata document
            for your device located at https://infocenter.nordicsemi.com/index.jsp  */
-        if (nrf52_errata_36()){
+        if (NRF52_ERRATA_APPLIES(36)){
             NRF_CLOCK->EVENTS_DONE = 0;
             NRF_CLOCK->EVENTS_CTTO = 0;
             NRF_CLOCK->CTIV = 0;
@@ -191,7 +336,7 @@ void SystemInit(void)
     #if NRF52_ERRATA_37_ENABLE_WORKAROUND
         /* Workaround for Errata 37 "RADIO: Encryption engine is slow by default" found at the Errata document
            for your device located at https://infocenter.nordicsemi.com/index.jsp  */
-        if (nrf52_errata_37()){
+        if (NRF52_ERRATA_APPLIES(37)){
             *(volatile uint32_t *)0x400005A0 = 0x3;
         }
     #endif
@@ -199,7 +344,7 @@ void SystemInit(void)
     #if NRF52_ERRATA_57_ENABLE_WORKAROUND
         /* Workaround for Errata 57 "NFCT: NFC Modulation amplitude" found at the Errata document
            for your device located at https://infocenter.nordicsemi.com/index.jsp  */
-        if (nrf52_errata_57()){
+        if (NRF52_ERRATA_APPLIES(57)){
             *(volatile uint32_t *)0x40005610 = 0x00000005;
             *(volatile uint32_t *)0x40005688 = 0x00000001;
             *(volatile uint32_t *)0x40005618 = 0x00000000;
@@ -210,7 +355,7 @@ void SystemInit(void)
     #if NRF52_ERRATA_66_ENABLE_WORKAROUND
         /* Workaround for Errata 66 "TEMP: Linearity specification not met with default settings" found at the Errata document
            for your device located at https://infocenter.nordicsemi.com/index.jsp  */
-        if (nrf52_errata_66()){
+        if (NRF52_ERRATA_APPLIES(66)){
             NRF_TEMP->A0 = NRF_FICR->TEMP.A0;
             NRF_TEMP->A1 = NRF_FICR->TEMP.A1;
             NRF_TEMP->A2 = NRF_FICR->TEMP.A2;
@@ -234,7 +379,7 @@ void SystemInit(void)
     #if NRF52_ERRATA_98_ENABLE_WORKAROUND
         /* Workaround for Errata 98 "NFCT: Not able to communicate with the peer" found at the Errata document
            for your device located at https://infocenter.nordicsemi.com/index.jsp  */
-        if (nrf52_errata_98()){
+        if (NRF52_ERRATA_APPLIES(98)){
             *(volatile uint32_t *)0x4000568Cul = 0x00038148ul;
         }
     #endif
@@ -242,7 +387,7 @@ void SystemInit(void)
     #if NRF52_ERRATA_103_ENABLE_WORKAROUND && defined(CCM_MAXPACKETSIZE_MAXPACKETSIZE_Pos)
         /* Workaround for Errata 103 "CCM: Wrong reset value of CCM MAXPACKETSIZE" found at the Errata document
            for your device located at https://infocenter.nordicsemi.com/index.jsp  */
-        if (nrf52_errata_103()){
+        if (NRF52_ERRATA_APPLIES(103)){
             NRF_CCM->MAXPACKETSIZE = 0xFBul;
         }
     #endif
@@ -250,7 +395,7 @@ void SystemInit(void)
     #if NRF52_ERRATA_108_ENABLE_WORKAROUND
         /* Workaround for Errata 108 "RAM: RAM content cannot be trusted upon waking up from System ON Idle or System OFF mode" found at the Errata document
            for your device located at https://infocenter.nordicsemi.com/index.jsp  */
-        if (nrf52_errata_108()){
+        if (NRF52_ERRATA_APPLIES(108)){
             *(volatile uint32_t *)0x40000EE4ul = *(volatile uint32_t *)0x10000258ul & 0x0000004Ful;
         }
     #endif
@@ -258,7 +403,7 @@ void SystemInit(void)
     #if NRF52_ERRATA_115_ENABLE_WORKAROUND
         /* Workaround for Errata 115 "RAM: RAM content cannot be trusted upon waking up from System ON Idle or System OFF mode" found at the Errata document
            for your device located at https://infocenter.nordicsemi.com/index.jsp  */
-        if (nrf52_errata_115()){
+        if (NRF52_ERRATA_APPLIES(115)){
             *(volatile uint32_t *)0x40000EE4 = (*(volatile uint32_t *)0x40000EE4 & 0xFFFFFFF0) | (*(uint32_t *)0x10000258 & 0x0000000F);
         }
     #endif
@@ -266,7 +411,7 @@ void SystemInit(void)
     #if NRF52_ERRATA_120_ENABLE_WORKAROUND
         /* Workaround for Errata 120 "QSPI: Data read or written is corrupted" found at the Errata document
            for your device located at https://infocenter.nordicsemi.com/index.jsp  */
-        if (nrf52_errata_120()){
+        if (NRF52_ERRATA_APPLIES(120)){
             *(volatile uint32_t *)0x40029640ul = 0x200ul;
         }
     #endif
@@ -274,7 +419,7 @@ void SystemInit(void)
     #if NRF52_ERRATA_136_ENABLE_WORKAROUND
         /* Workaround for Errata 136 "System: Bits in RESETREAS are set when they should not be" found at the Errata document
            for your device located at https://infocenter.nordicsemi.com/index.jsp  */
-        if (nrf52_errata_136()){
+        if (NRF52_ERRATA_APPLIES(136)){
             if (NRF_POWER->RESETREAS & POWER_RESETREAS_RESETPIN_Msk){
                 NRF_POWER->RESETREAS =  ~POWER_RESETREAS_RESETPIN_Msk;
             }
@@ -284,7 +429,7 @@ void SystemInit(void)
     #if NRF52_ERRATA_182_ENABLE_WORKAROUND
         /* Workaround for Errata 182 "RADIO: Fixes for anomalies #102, #106, and #107 do not take effect" found at the Errata document
            for your device located at https://infocenter.nordicsemi.com/index.jsp  */
-        if (nrf52_errata_182()){
+        if (NRF52_ERRATA_APPLIES(182)){
             *(volatile uint32_t *) 0x4000173C |= (0x1 << 10);
         }
     #endif
@@ -292,7 +437,7 @@ void SystemInit(void)
     #if NRF52_ERRATA_217_ENABLE_WORKAROUND
         /* Workaround for Errata 217 "RAM: RAM content cannot be trusted upon waking up from System ON Idle or System OFF mode" found at the Errata document
            for your device located at https://infocenter.nordicsemi.com/index.jsp  */
-        if (nrf52_errata_217()){
+        if (NRF52_ERRATA_APPLIES(217)){
             *(volatile uint32_t *)0x40000EE4ul |= 0x0000000Ful;
         }
     #endif
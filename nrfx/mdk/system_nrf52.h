@@ -53,6 +53,46 @@ extern void SystemInit (void);
 extern void SystemCoreClockUpdate (void);
 
 
+#ifndef NRF52_ERRATA_CACHE_ENABLE
+    #define NRF52_ERRATA_CACHE_ENABLE 0
+#endif
+
+#if NRF52_ERRATA_CACHE_ENABLE
+
+/* Bits of the mask returned by SystemErrataGet */
+#define SYSTEM_NRF52_ERRATA_12_Msk   (1UL << 0)  /*!< Erratum 12 applies to the chip. */
+#define SYSTEM_NRF52_ERRATA_16_Msk   (1UL << 1)  /*!< Erratum 16 applies to the chip. */
+#define SYSTEM_NRF52_ERRATA_31_Msk   (1UL << 2)  /*!< Erratum 31 applies to the chip. */
+#define SYSTEM_NRF52_ERRATA_32_Msk   (1UL << 3)  /*!< Erratum 32 applies to the chip. */
+#define SYSTEM_NRF52_ERRATA_36_Msk   (1UL << 4)  /*!< Erratum 36 applies to the chip. */
+#define SYSTEM_NRF52_ERRATA_37_Msk   (1UL << 5)  /*!< Erratum 37 applies to the chip. */
+#define SYSTEM_NRF52_ERRATA_57_Msk   (1UL << 6)  /*!< Erratum 57 applies to the chip. */
+#define SYSTEM_NRF52_ERRATA_66_Msk   (1UL << 7)  /*!< Erratum 66 applies to the chip. */
+#define SYSTEM_NRF52_ERRATA_98_Msk   (1UL << 8)  /*!< Erratum 98 applies to the chip. */
+#define SYSTEM_NRF52_ERRATA_103_Msk  (1UL << 9)  /*!< Erratum 103 applies to the chip. */
+#define SYSTEM_NRF52_ERRATA_108_Msk  (1UL << 10) /*!< Erratum 108 applies to the chip. */
+#define SYSTEM_NRF52_ERRATA_115_Msk  (1UL << 11) /*!< Erratum 115 applies to the chip. */
+#define SYSTEM_NRF52_ERRATA_120_Msk  (1UL << 12) /*!< Erratum 120 applies to the chip. */
+#define SYSTEM_NRF52_ERRATA_136_Msk  (1UL << 13) /*!< Erratum 136 applies to the chip. */
+#define SYSTEM_NRF52_ERRATA_182_Msk  (1UL << 14) /*!< Erratum 182 applies to the chip. */
+#define SYSTEM_NRF52_ERRATA_217_Msk  (1UL << 15) /*!< Erratum 217 applies to the chip. */
+
+/**
+  \brief  Get the errata the startup has workarounds for that apply to the chip.
+   The chip revision is decoded once by SystemInit and the result is cached, so the errata can be
+   checked without decoding the revision again.
+ */
+extern uint32_t SystemErrataGet (void);
+
+
+/**
+  \brief  Get the part and revision codes of the chip, as used by the helpers in nrf52_erratas.h.
+ */
+extern void SystemChipRevisionGet (uint32_t * p_part, uint32_t * p_revision);
+
+#endif
+
+
 #ifdef __cplusplus
 }
 #endif
@@ -40,4 +40,11 @@
 #include <hal/nrf_common.h>
 #include <drivers/nrfx_errors.h>
 
+#if !defined(NRFX_LOCK_DECLARE)
+// Resource locks are optional in the glue layer. Without them, they are critical sections.
+#define NRFX_LOCK_DECLARE(lock) static uint8_t lock
+#define NRFX_LOCK_TAKE(lock)    NRFX_CRITICAL_SECTION_ENTER(); (void)(lock)
+#define NRFX_LOCK_GIVE(lock)    NRFX_CRITICAL_SECTION_EXIT()
+#endif
+
 #endif // NRFX_H__
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef NRFX_BENCHMARK_H__
+#define NRFX_BENCHMARK_H__
+
+#include <nrfx.h>
+
+/**
+ * @defgroup nrfx_benchmark_examples_common Common benchmark module
+ * @{
+ *
+ * @brief Module with common functionalities used in benchmark examples.
+ *
+ * @details Durations are measured with the DWT cycle counter. Interrupts are counted and timed
+ *          by a wrapper that is connected to the interrupt vector instead of the driver handler.
+ *          Results are printed as comma-separated lines starting with @p BENCHMARK, so that
+ *          output of different nrfx releases can be compared with a script.
+ */
+
+/** @brief Structure for holding statistics of interrupts handled during a benchmark run. */
+typedef struct
+{
+    volatile uint32_t isr_count;  ///< Number of handled interrupts.
+    volatile uint32_t isr_cycles; ///< CPU cycles spent in the interrupt handlers.
+} nrfx_benchmark_isr_stats_t;
+
+/**
+ * @brief Macro for defining a wrapper of the driver interrupt handler that gathers
+ *        interrupt statistics.
+ *
+ * @param[in] _name    Name of the wrapper function to be connected to the interrupt vector.
+ * @param[in] _handler Driver interrupt handler.
+ * @param[in] _p_stats Pointer to the @ref nrfx_benchmark_isr_stats_t structure to be updated.
+ */
+#define NRFX_BENCHMARK_ISR_WRAPPER_DEFINE(_name, _handler, _p_stats)   \
+    static void _name(void)                                            \
+    {                                                                  \
+        uint32_t start = nrfx_benchmark_cycles_get();                  \
+        _handler();                                                    \
+        (_p_stats)->isr_cycles += nrfx_benchmark_cycles_get() - start; \
+        (_p_stats)->isr_count++;                                       \
+    }
+
+/** @brief Macro for printing the header of the lines printed by @ref NRFX_BENCHMARK_RESULT_LOG. */
+#define NRFX_BENCHMARK_HEADER_LOG() \
+    NRFX_LOG_INFO("BENCHMARK,driver,buffer_size,bytes_per_s,cpu_load_permille,isr_count")
+
+/**
+ * @brief Macro for printing the result of a benchmark run.
+ *
+ * @param[in] _driver  Name of the benchmarked driver.
+ * @param[in] _size    Size of the buffer used in the run.
+ * @param[in] _bytes   Number of bytes transferred in the run.
+ * @param[in] _cycles  Duration of the run in CPU cycles.
+ * @param[in] _p_stats Pointer to the interrupt statistics gathered during the run.
+ */
+#define NRFX_BENCHMARK_RESULT_LOG(_driver, _size, _bytes, _cycles, _p_stats)                    \
+    NRFX_LOG_INFO("BENCHMARK,%s,%u,%u,%u,%u",                                                   \
+                  (_driver),                                                                    \
+                  (unsigned int)(_size),                                                        \
+                  (unsigned int)nrfx_benchmark_bytes_per_s_get((_bytes), (_cycles)),            \
+                  (unsigned int)nrfx_benchmark_permille_get((_p_stats)->isr_cycles, (_cycles)), \
+                  (unsigned int)(_p_stats)->isr_count)
+
+/** @brief Function for enabling the DWT cycle counter. */
+static inline void nrfx_benchmark_init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT       = 0;
+    DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/**
+ * @brief Function for getting the current value of the DWT cycle counter.
+ *
+ * @return Number of CPU cycles.
+ */
+static inline uint32_t nrfx_benchmark_cycles_get(void)
+{
+    return DWT->CYCCNT;
+}
+
+/**
+ * @brief Function for resetting interrupt statistics.
+ *
+ * @param[out] p_stats Pointer to the statistics to be reset.
+ */
+static inline void nrfx_benchmark_isr_stats_reset(nrfx_benchmark_isr_stats_t * p_stats)
+{
+    p_stats->isr_count  = 0;
+    p_stats->isr_cycles = 0;
+}
+
+/**
+ * @brief Function for calculating the throughput.
+ *
+ * @param[in] bytes  Number of transferred bytes.
+ * @param[in] cycles Duration of the transfer in CPU cycles.
+ *
+ * @return Throughput in bytes per second.
+ */
+static inline uint32_t nrfx_benchmark_bytes_per_s_get(uint32_t bytes, uint32_t cycles)
+{
+    return cycles ? (uint32_t)(((uint64_t)bytes * SystemCoreClock) / cycles) : 0;
+}
+
+/**
+ * @brief Function for calculating the share of a part in the whole duration.
+ *
+ * @param[in] part  Duration of the part in CPU cycles.
+ * @param[in] whole Whole duration in CPU cycles.
+ *
+ * @return Share of the part in permille.
+ */
+static inline uint32_t nrfx_benchmark_permille_get(uint32_t part, uint32_t whole)
+{
+    return whole ? (uint32_t)(((uint64_t)part * 1000) / whole) : 0;
+}
+
+/** @} */
+
+#endif // NRFX_BENCHMARK_H__
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx_example.h>
+#include <nrfx_benchmark.h>
+#include <helpers/nrfx_qspi_flash.h>
+
+#define NRFX_LOG_MODULE                 EXAMPLE
+#define NRFX_EXAMPLE_CONFIG_LOG_ENABLED 1
+#define NRFX_EXAMPLE_CONFIG_LOG_LEVEL   3
+#include <nrfx_log.h>
+
+/**
+ * @defgroup nrfx_qspi_flash_profile_example Flash profile QSPI example
+ * @{
+ * @ingroup nrfx_qspi_examples
+ *
+ * @brief Example measuring the read throughput of the external flash memory with the profiles
+ *        of the nrfx_qspi_flash helper.
+ *
+ * @details Application initializes nrfx_qspi driver in the blocking mode with the default
+ *          configuration and detects the external memory. Then, the memory is read with
+ *          the default configuration and with each profile from @ref m_variants, which are
+ *          derived from the profile of the detected memory and applied one after another.
+ *          The throughput of each run is printed with @p NRFX_BENCHMARK_RESULT_LOG().
+ */
+
+/** @brief Symbol specifying pin number of the QSPI SCK line. */
+#define QSPI_SCK_PIN 17
+
+/** @brief Symbol specifying pin number of the QSPI CSN line. */
+#define QSPI_CSN_PIN 18
+
+/** @brief Symbol specifying pin number of the QSPI IO0 line. */
+#define QSPI_IO0_PIN 13
+
+/** @brief Symbol specifying pin number of the QSPI IO1 line. */
+#define QSPI_IO1_PIN 14
+
+/** @brief Symbol specifying pin number of the QSPI IO2 line. */
+#define QSPI_IO2_PIN 15
+
+/** @brief Symbol specifying pin number of the QSPI IO3 line. */
+#define QSPI_IO3_PIN 16
+
+/** @brief Symbol specifying the number of bytes read in each transfer. */
+#define READ_LENGTH 4096
+
+/** @brief Symbol specifying the number of transfers performed in each run. */
+#define READ_COUNT 16
+
+/** @brief Structure describing a variant of the profile of the detected memory. */
+typedef struct
+{
+    char const *       p_name;   ///< Name printed in the results.
+    bool               override; ///< True if the opcodes of the profile are replaced.
+    nrf_qspi_readoc_t  readoc;   ///< Read opcode replacing the one of the profile.
+    nrf_qspi_writeoc_t writeoc;  ///< Write opcode replacing the one of the profile.
+} variant_t;
+
+/** @brief Variants of the profile, from the slowest to the fastest. */
+static const variant_t m_variants[] =
+{
+    { "qspi_fastread", true,  NRF_QSPI_READOC_FASTREAD, NRF_QSPI_WRITEOC_PP },
+    { "qspi_dual",     true,  NRF_QSPI_READOC_READ2IO,  NRF_QSPI_WRITEOC_PP },
+    { "qspi_quad",     false, NRF_QSPI_READOC_FASTREAD, NRF_QSPI_WRITEOC_PP },
+};
+
+/** @brief Buffer for the data read from the external memory. */
+static uint8_t m_buffer[READ_LENGTH] __attribute__((aligned(4)));
+
+/**
+ * @brief Function for reading the memory and printing the throughput.
+ *
+ * @param[in] p_name Name printed in the results.
+ */
+static void benchmark_run(char const * p_name)
+{
+    nrfx_benchmark_isr_stats_t stats;
+    nrfx_err_t                 status;
+    (void)status;
+
+    nrfx_benchmark_isr_stats_reset(&stats);
+
+    uint32_t start = nrfx_benchmark_cycles_get();
+    for (uint32_t i = 0; i < READ_COUNT; i++)
+    {
+        status = nrfx_qspi_read(m_buffer, READ_LENGTH, i * READ_LENGTH);
+        NRFX_ASSERT(status == NRFX_SUCCESS);
+    }
+    uint32_t cycles = nrfx_benchmark_cycles_get() - start;
+
+    NRFX_BENCHMARK_RESULT_LOG(p_name, READ_LENGTH, READ_COUNT * READ_LENGTH, cycles, &stats);
+    NRFX_EXAMPLE_LOG_PROCESS();
+}
+
+/**
+ * @brief Function for application main entry.
+ *
+ * @return Nothing.
+ */
+int main(void)
+{
+    nrfx_err_t status;
+    (void)status;
+
+    NRFX_EXAMPLE_LOG_INIT();
+
+    NRFX_LOG_INFO("Starting nrfx_qspi flash profile example");
+    NRFX_EXAMPLE_LOG_PROCESS();
+
+    nrfx_benchmark_init();
+
+    nrfx_qspi_config_t qspi_config = NRFX_QSPI_DEFAULT_CONFIG(QSPI_SCK_PIN,
+                                                              QSPI_CSN_PIN,
+                                                              QSPI_IO0_PIN,
+                                                              QSPI_IO1_PIN,
+                                                              QSPI_IO2_PIN,
+                                                              QSPI_IO3_PIN);
+
+    status = nrfx_qspi_init(&qspi_config, NULL, NULL);
+    NRFX_ASSERT(status == NRFX_SUCCESS);
+
+    nrfx_qspi_flash_info_t info;
+    status = nrfx_qspi_flash_detect(&info);
+    NRFX_LOG_INFO("JEDEC ID: 0x%06x, size: %u bytes, profile: %s",
+                  (unsigned int)info.jedec_id,
+                  (unsigned int)info.size,
+                  info.p_profile ? info.p_profile->p_name : "none");
+    NRFX_EXAMPLE_LOG_PROCESS();
+
+    NRFX_BENCHMARK_HEADER_LOG();
+    benchmark_run("qspi_default");
+
+    if (info.p_profile)
+    {
+        nrfx_qspi_flash_profile_t profile      = *info.p_profile;
+        nrfx_qspi_flash_info_t    variant_info = info;
+
+        variant_info.p_profile = &profile;
+        for (uint32_t i = 0; i < NRFX_ARRAY_SIZE(m_variants); i++)
+        {
+            profile = *info.p_profile;
+            if (m_variants[i].override)
+            {
+                profile.readoc  = m_variants[i].readoc;
+                profile.writeoc = m_variants[i].writeoc;
+            }
+
+            status = nrfx_qspi_flash_profile_apply(&variant_info, &qspi_config, NULL, NULL);
+            NRFX_ASSERT(status == NRFX_SUCCESS);
+            benchmark_run(m_variants[i].p_name);
+        }
+    }
+
+    NRFX_LOG_INFO("Benchmark finished.");
+
+    while (1)
+    {
+        NRFX_EXAMPLE_LOG_PROCESS();
+    }
+}
+
+/** @} */
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2022 - 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx_example.h>
+#include <nrfx_qspi.h>
+#include <string.h>
+
+#define NRFX_LOG_MODULE                 EXAMPLE
+#define NRFX_EXAMPLE_CONFIG_LOG_ENABLED 1
+#define NRFX_EXAMPLE_CONFIG_LOG_LEVEL   3
+#include <nrfx_log.h>
+
+/**
+ * @defgroup nrfx_qspi_xip_example XIP QSPI example
+ * @{
+ * @ingroup nrfx_qspi_examples
+ *
+ * @brief Example comparing XIP and DMA read throughput of nrfx_qspi driver.
+ *
+ * @details Application initializes nrfx_qspi driver in the blocking mode and reads
+ *          the same area of the external memory three times: using the DMA transfer,
+ *          using XIP with a cold cache, and using XIP after the area was read ahead
+ *          into the cache with @ref nrfx_qspi_xip_prefetch(). The number of CPU cycles
+ *          spent on each read and the XIP cache statistics are logged.
+ */
+
+/** @brief Symbol specifying pin number of the QSPI SCK line. */
+#define QSPI_SCK_PIN 17
+
+/** @brief Symbol specifying pin number of the QSPI CSN line. */
+#define QSPI_CSN_PIN 18
+
+/** @brief Symbol specifying pin number of the QSPI IO0 line. */
+#define QSPI_IO0_PIN 13
+
+/** @brief Symbol specifying pin number of the QSPI IO1 line. */
+#define QSPI_IO1_PIN 14
+
+/** @brief Symbol specifying pin number of the QSPI IO2 line. */
+#define QSPI_IO2_PIN 15
+
+/** @brief Symbol specifying pin number of the QSPI IO3 line. */
+#define QSPI_IO3_PIN 16
+
+/** @brief Symbol specifying the start address of the XIP region. */
+#define XIP_START_ADDR 0x10000000uL
+
+/**
+ * @brief Symbol specifying the number of bytes read in each measurement.
+ *
+ * The value is smaller than the cache size, so that the whole area fits in the cache
+ * after it is read ahead.
+ */
+#define READ_LENGTH 4096
+
+/** @brief Buffer for the data read from the external memory. */
+static uint8_t m_buffer[READ_LENGTH] __attribute__((aligned(4)));
+
+/**
+ * @brief Function for starting the CPU cycle counter.
+ *
+ * @return Current value of the cycle counter.
+ */
+static uint32_t cycles_start(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+    return DWT->CYCCNT;
+}
+
+/**
+ * @brief Function for getting the number of CPU cycles elapsed since the given start value.
+ *
+ * @param[in] start Value returned by @ref cycles_start().
+ *
+ * @return Number of elapsed cycles.
+ */
+static uint32_t cycles_elapsed(uint32_t start)
+{
+    return DWT->CYCCNT - start;
+}
+
+/**
+ * @brief Function for application main entry.
+ *
+ * @return Nothing.
+ */
+int main(void)
+{
+    nrfx_err_t status;
+    (void)status;
+
+    uint32_t start;
+    uint32_t cycles;
+
+#if defined(__ZEPHYR__)
+    IRQ_CONNECT(NRFX_IRQ_NUMBER_GET(NRF_QSPI), IRQ_PRIO_LOWEST, nrfx_qspi_irq_handler, 0, 0);
+#endif
+
+    NRFX_EXAMPLE_LOG_INIT();
+
+    NRFX_LOG_INFO("Starting nrfx_qspi XIP example");
+    NRFX_EXAMPLE_LOG_PROCESS();
+
+    nrfx_qspi_config_t qspi_config = NRFX_QSPI_DEFAULT_CONFIG(QSPI_SCK_PIN,
+                                                              QSPI_CSN_PIN,
+                                                              QSPI_IO0_PIN,
+                                                              QSPI_IO1_PIN,
+                                                              QSPI_IO2_PIN,
+                                                              QSPI_IO3_PIN);
+    qspi_config.phy_if.sck_freq = NRF_QSPI_FREQ_DIV1;
+
+    status = nrfx_qspi_init(&qspi_config, NULL, NULL);
+    NRFX_ASSERT(status == NRFX_SUCCESS);
+
+    start = cycles_start();
+    status = nrfx_qspi_read(m_buffer, READ_LENGTH, 0);
+    cycles = cycles_elapsed(start);
+    NRFX_ASSERT(status == NRFX_SUCCESS);
+    NRFX_LOG_INFO("DMA read: %d bytes in %u cycles", READ_LENGTH, cycles);
+
+    nrfx_qspi_xip_cache_configure(true, true);
+    nrfx_qspi_xip_cache_stats_clear();
+
+    start = cycles_start();
+    memcpy(m_buffer, (void const *)XIP_START_ADDR, READ_LENGTH);
+    cycles = cycles_elapsed(start);
+    NRFX_LOG_INFO("XIP read, cold cache: %d bytes in %u cycles", READ_LENGTH, cycles);
+
+    /* Invalidate the cache, so that the read-ahead starts from a cold cache as well. */
+    nrfx_qspi_xip_cache_configure(true, true);
+    nrfx_qspi_xip_prefetch(0, READ_LENGTH);
+
+    start = cycles_start();
+    memcpy(m_buffer, (void const *)XIP_START_ADDR, READ_LENGTH);
+    cycles = cycles_elapsed(start);
+    NRFX_LOG_INFO("XIP read, after prefetch: %d bytes in %u cycles", READ_LENGTH, cycles);
+
+    nrfx_qspi_xip_cache_stats_t stats;
+    nrfx_qspi_xip_cache_stats_get(&stats);
+    NRFX_LOG_INFO("XIP cache: %u data hits, %u data misses", stats.data_hits, stats.data_misses);
+
+    while (1)
+    {
+        NRFX_EXAMPLE_LOG_PROCESS();
+    }
+}
+
+/** @} */
@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx_example.h>
+#include <nrfx_benchmark.h>
+#include <saadc_examples_common.h>
+#include <nrfx_saadc.h>
+
+#define NRFX_LOG_MODULE                 EXAMPLE
+#define NRFX_EXAMPLE_CONFIG_LOG_ENABLED 1
+#define NRFX_EXAMPLE_CONFIG_LOG_LEVEL   3
+#include <nrfx_log.h>
+
+/**
+ * @defgroup nrfx_saadc_benchmark_example Benchmark SAADC example
+ * @{
+ * @ingroup nrfx_saadc_examples
+ *
+ * @brief Example measuring the performance of nrfx_saadc driver operating in the advanced
+ *        non-blocking continuous sampling mode with internal timer.
+ *
+ * @details Application initializes nrfx_saadc driver with @ref m_single_channel sampled
+ *          by the internal timer at the maximum sample rate ( @ref SAADC_SAMPLE_FREQUENCY ).
+ *          For every size from @ref m_buffer_sizes, @ref BUFFER_FILL_COUNT buffers are filled
+ *          with double-buffering, then the driver finishes the conversion. The following values
+ *          are printed with @p NRFX_BENCHMARK_RESULT_LOG():
+ *          - the achieved throughput of the samples,
+ *          - the share of CPU time spent in the SAADC interrupt handler,
+ *          - the number of handled SAADC interrupts.
+ */
+
+/** @brief Symbol specifying analog input to be observed by SAADC channel 0. */
+#define CH0_AIN ANALOG_INPUT_TO_SAADC_AIN(ANALOG_INPUT_A0)
+
+/** @brief Internal timer frequency [Hz] is derived from PCLK16M (see SAMPLERATE register in SAADC). */
+#define INTERNAL_TIMER_FREQ 16000000UL
+
+/** @brief SAADC sample frequency for the continuous sampling. */
+#define SAADC_SAMPLE_FREQUENCY 200000UL
+
+/** @brief Internal timer capture and compare value. */
+#define INTERNAL_TIMER_CC (INTERNAL_TIMER_FREQ / SAADC_SAMPLE_FREQUENCY)
+
+/**
+ * @brief Symbol specifying the number of sample buffers ( @ref m_sample_buffers ).
+ * Two buffers are required for performing double-buffered conversions.
+ */
+#define BUFFER_COUNT 2UL
+
+/** @brief Symbol specifying the number of buffers filled for every buffer size. */
+#define BUFFER_FILL_COUNT 16UL
+
+/** @brief Symbol specifying the maximum size of a buffer. */
+#define BUFFER_SIZE_MAX 512UL
+
+/** @brief Buffer sizes used in consecutive benchmark runs. */
+static const uint16_t m_buffer_sizes[] = {8, 32, 128, BUFFER_SIZE_MAX};
+
+/** @brief SAADC channel configuration structure for single channel use. */
+static const nrfx_saadc_channel_t m_single_channel = SAADC_CHANNEL_SE_ACQ_3US(CH0_AIN, 0);
+
+/** @brief Samples buffers. */
+static nrf_saadc_value_t m_sample_buffers[BUFFER_COUNT][BUFFER_SIZE_MAX];
+
+/** @brief Size of the buffers used in the current benchmark run. */
+static uint16_t m_size;
+
+/** @brief Number of buffers passed to the driver in the current benchmark run. */
+static uint32_t m_buffers_set;
+
+/** @brief Flag indicating that all buffers are filled. */
+static volatile bool m_saadc_finished;
+
+/** @brief Statistics of interrupts handled during a benchmark run. */
+static nrfx_benchmark_isr_stats_t m_isr_stats;
+
+NRFX_BENCHMARK_ISR_WRAPPER_DEFINE(saadc_irq_wrapper, nrfx_saadc_irq_handler, &m_isr_stats)
+
+/** Possible range value of a CC field in the SAMPLERATE register (SAADC) is 80-2047. */
+NRFX_STATIC_ASSERT((INTERNAL_TIMER_CC >= 80UL ) && (INTERNAL_TIMER_CC <= 2047UL));
+
+/**
+ * @brief Function for handling SAADC driver events.
+ *
+ * @param[in] p_event Pointer to an SAADC driver event.
+ */
+static void saadc_handler(nrfx_saadc_evt_t const * p_event)
+{
+    nrfx_err_t status;
+    (void)status;
+
+    switch (p_event->type)
+    {
+        case NRFX_SAADC_EVT_BUF_REQ:
+            if (m_buffers_set < BUFFER_FILL_COUNT)
+            {
+                status = nrfx_saadc_buffer_set(m_sample_buffers[m_buffers_set % BUFFER_COUNT],
+                                               m_size);
+                NRFX_ASSERT(status == NRFX_SUCCESS);
+                m_buffers_set++;
+            }
+            break;
+
+        case NRFX_SAADC_EVT_FINISHED:
+            m_saadc_finished = true;
+            break;
+
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief Function for performing a benchmark run with the specified buffer size.
+ *
+ * @param[in] size Size of the buffers used in the run.
+ */
+static void benchmark_run(uint16_t size)
+{
+    nrfx_err_t status;
+    (void)status;
+
+    m_size           = size;
+    m_buffers_set    = 1;
+    m_saadc_finished = false;
+    nrfx_benchmark_isr_stats_reset(&m_isr_stats);
+
+    status = nrfx_saadc_buffer_set(m_sample_buffers[0], size);
+    NRFX_ASSERT(status == NRFX_SUCCESS);
+
+    uint32_t start = nrfx_benchmark_cycles_get();
+    status = nrfx_saadc_mode_trigger();
+    NRFX_ASSERT(status == NRFX_SUCCESS);
+
+    while (!m_saadc_finished)
+    {}
+    uint32_t cycles = nrfx_benchmark_cycles_get() - start;
+
+    NRFX_BENCHMARK_RESULT_LOG("saadc",
+                              size,
+                              size * BUFFER_FILL_COUNT * sizeof(nrf_saadc_value_t),
+                              cycles,
+                              &m_isr_stats);
+    NRFX_EXAMPLE_LOG_PROCESS();
+}
+
+/**
+ * @brief Function for application main entry.
+ *
+ * @return Nothing.
+ */
+int main(void)
+{
+    nrfx_err_t status;
+    (void)status;
+
+    NRFX_EXAMPLE_LOG_INIT();
+    NRFX_LOG_INFO("Starting nrfx_saadc benchmark example.");
+    NRFX_EXAMPLE_LOG_PROCESS();
+
+    nrfx_benchmark_init();
+
+    status = nrfx_saadc_init(NRFX_SAADC_DEFAULT_CONFIG_IRQ_PRIORITY);
+    NRFX_ASSERT(status == NRFX_SUCCESS);
+
+#if defined(__ZEPHYR__)
+    IRQ_DIRECT_CONNECT(NRFX_IRQ_NUMBER_GET(NRF_SAADC), IRQ_PRIO_LOWEST, saadc_irq_wrapper, 0);
+#endif
+
+    status = nrfx_saadc_channel_config(&m_single_channel);
+    NRFX_ASSERT(status == NRFX_SUCCESS);
+
+    nrfx_saadc_adv_config_t adv_config = NRFX_SAADC_DEFAULT_ADV_CONFIG;
+    adv_config.internal_timer_cc = INTERNAL_TIMER_CC;
+    adv_config.start_on_end = true;
+
+    uint32_t channel_mask = nrfx_saadc_channels_configured_get();
+    status = nrfx_saadc_advanced_mode_set(channel_mask,
+                                          NRF_SAADC_RESOLUTION_12BIT,
+                                          &adv_config,
+                                          saadc_handler);
+    NRFX_ASSERT(status == NRFX_SUCCESS);
+
+    NRFX_BENCHMARK_HEADER_LOG();
+    for (uint32_t i = 0; i < NRFX_ARRAY_SIZE(m_buffer_sizes); i++)
+    {
+        benchmark_run(m_buffer_sizes[i]);
+    }
+
+    NRFX_LOG_INFO("Benchmark finished.");
+
+    while (1)
+    {
+        NRFX_EXAMPLE_LOG_PROCESS();
+    }
+}
+
+/** @} */
@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx_example.h>
+#include <nrfx_benchmark.h>
+#include <nrfx_spim.h>
+#include <string.h>
+
+#define NRFX_LOG_MODULE                 EXAMPLE
+#define NRFX_EXAMPLE_CONFIG_LOG_ENABLED 1
+#define NRFX_EXAMPLE_CONFIG_LOG_LEVEL   3
+#include <nrfx_log.h>
+
+/**
+ * @defgroup nrfx_spim_benchmark_example Benchmark SPIM example
+ * @{
+ * @ingroup nrfx_spim_examples
+ *
+ * @brief Example measuring the performance of nrfx_spim driver operating in the non-blocking mode.
+ *
+ * @details Application initializes nrfx_spim driver with MOSI pin looped back to MISO pin.
+ *          For every size from @ref m_buffer_sizes, @ref TRANSFER_COUNT transfers are performed
+ *          one after another and the following values are printed with
+ *          @p NRFX_BENCHMARK_RESULT_LOG():
+ *          - the achieved throughput, including the software overhead between transfers,
+ *          - the share of CPU time spent in the SPIM interrupt handler,
+ *          - the number of handled SPIM interrupts.
+ *          The received data is compared with the transmitted one after every run.
+ */
+
+/** @brief Symbol specifying SPIM instance to be used. */
+#define SPIM_INST_IDX 1
+
+/** @brief Symbol specifying pin number for MOSI. */
+#define MOSI_PIN LOOPBACK_PIN_1A
+
+/** @brief Symbol specifying pin number for MISO. */
+#define MISO_PIN LOOPBACK_PIN_1B
+
+/** @brief Symbol specifying pin number for SCK. */
+#define SCK_PIN LOOPBACK_PIN_2A
+
+/** @brief Symbol specifying the number of transfers performed for every buffer size. */
+#define TRANSFER_COUNT 64UL
+
+/** @brief Symbol specifying the maximum size of a buffer. */
+#define BUFFER_SIZE_MAX 255UL
+
+/** @brief Buffer sizes used in consecutive benchmark runs. */
+static const uint16_t m_buffer_sizes[] = {1, 4, 16, 64, BUFFER_SIZE_MAX};
+
+/** @brief Transmit buffer. */
+static uint8_t m_tx_buffer[BUFFER_SIZE_MAX];
+
+/** @brief Receive buffer. */
+static uint8_t m_rx_buffer[BUFFER_SIZE_MAX];
+
+/** @brief Flag indicating that the transfer is finished. */
+static volatile bool m_xfer_done;
+
+/** @brief Statistics of interrupts handled during a benchmark run. */
+static nrfx_benchmark_isr_stats_t m_isr_stats;
+
+NRFX_BENCHMARK_ISR_WRAPPER_DEFINE(spim_irq_wrapper,
+                                  NRFX_SPIM_INST_HANDLER_GET(SPIM_INST_IDX),
+                                  &m_isr_stats)
+
+/**
+ * @brief Function for handling SPIM driver events.
+ *
+ * @param[in] p_event   Pointer to the SPIM driver event.
+ * @param[in] p_context Pointer to the context passed from the driver.
+ */
+static void spim_handler(nrfx_spim_evt_t const * p_event, void * p_context)
+{
+    if (p_event->type == NRFX_SPIM_EVENT_DONE)
+    {
+        m_xfer_done = true;
+    }
+}
+
+/**
+ * @brief Function for performing a benchmark run with the specified buffer size.
+ *
+ * @param[in] p_spim Pointer to the SPIM driver instance.
+ * @param[in] size   Size of the buffers used in the run.
+ */
+static void benchmark_run(nrfx_spim_t const * p_spim, uint16_t size)
+{
+    nrfx_err_t status;
+    (void)status;
+
+    nrfx_spim_xfer_desc_t spim_xfer_desc = NRFX_SPIM_XFER_TRX(m_tx_buffer, size,
+                                                              m_rx_buffer, size);
+
+    memset(m_rx_buffer, 0, sizeof(m_rx_buffer));
+    nrfx_benchmark_isr_stats_reset(&m_isr_stats);
+
+    uint32_t start = nrfx_benchmark_cycles_get();
+    for (uint32_t i = 0; i < TRANSFER_COUNT; i++)
+    {
+        m_xfer_done = false;
+        status = nrfx_spim_xfer(p_spim, &spim_xfer_desc, 0);
+        NRFX_ASSERT(status == NRFX_SUCCESS);
+
+        while (!m_xfer_done)
+        {}
+    }
+    uint32_t cycles = nrfx_benchmark_cycles_get() - start;
+
+    if (memcmp(m_tx_buffer, m_rx_buffer, size) != 0)
+    {
+        NRFX_LOG_ERROR("Received data does not match transmitted data.");
+    }
+
+    NRFX_BENCHMARK_RESULT_LOG("spim", size, size * TRANSFER_COUNT, cycles, &m_isr_stats);
+    NRFX_EXAMPLE_LOG_PROCESS();
+}
+
+/**
+ * @brief Function for application main entry.
+ *
+ * @return Nothing.
+ */
+int main(void)
+{
+    nrfx_err_t status;
+    (void)status;
+
+    NRFX_EXAMPLE_LOG_INIT();
+
+    NRFX_LOG_INFO("Starting nrfx_spim benchmark example.");
+    NRFX_EXAMPLE_LOG_PROCESS();
+
+    nrfx_benchmark_init();
+
+    for (uint32_t i = 0; i < sizeof(m_tx_buffer); i++)
+    {
+        m_tx_buffer[i] = (uint8_t)i;
+    }
+
+    nrfx_spim_t spim_inst = NRFX_SPIM_INSTANCE(SPIM_INST_IDX);
+
+    nrfx_spim_config_t spim_config = NRFX_SPIM_DEFAULT_CONFIG(SCK_PIN,
+                                                              MOSI_PIN,
+                                                              MISO_PIN,
+                                                              NRFX_SPIM_PIN_NOT_USED);
+    spim_config.frequency = NRF_SPIM_FREQ_8M;
+
+    status = nrfx_spim_init(&spim_inst, &spim_config, spim_handler, NULL);
+    NRFX_ASSERT(status == NRFX_SUCCESS);
+
+#if defined(__ZEPHYR__)
+    IRQ_DIRECT_CONNECT(NRFX_IRQ_NUMBER_GET(NRF_SPIM_INST_GET(SPIM_INST_IDX)), IRQ_PRIO_LOWEST,
+                       spim_irq_wrapper, 0);
+#endif
+
+    NRFX_BENCHMARK_HEADER_LOG();
+    for (uint32_t i = 0; i < NRFX_ARRAY_SIZE(m_buffer_sizes); i++)
+    {
+        benchmark_run(&spim_inst, m_buffer_sizes[i]);
+    }
+
+    NRFX_LOG_INFO("Benchmark finished.");
+
+    while (1)
+    {
+        NRFX_EXAMPLE_LOG_PROCESS();
+    }
+}
+
+/** @} */
@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx_example.h>
+#include <nrfx_benchmark.h>
+#include <nrfx_twim.h>
+#include <nrfx_twis.h>
+#include <string.h>
+
+#define NRFX_LOG_MODULE                 EXAMPLE
+#define NRFX_EXAMPLE_CONFIG_LOG_ENABLED 1
+#define NRFX_EXAMPLE_CONFIG_LOG_LEVEL   3
+#include <nrfx_log.h>
+
+/**
+ * @defgroup nrfx_twim_twis_benchmark_example Benchmark TWIM with TWIS example
+ * @{
+ * @ingroup nrfx_twim_twis_examples
+ *
+ * @brief Example measuring the performance of nrfx_twim and nrfx_twis drivers.
+ *
+ * @details Application initializes nrfx_twim and nrfx_twis drivers connected with each other.
+ *          For every size from @ref m_buffer_sizes, @ref TRANSFER_COUNT write transfers are
+ *          performed one after another by the master. @ref twis_handler() prepares the slave
+ *          receive buffer for each transfer. The following values are printed with
+ *          @p NRFX_BENCHMARK_RESULT_LOG():
+ *          - the achieved throughput, including the software overhead between transfers,
+ *          - the share of CPU time spent in the TWIM and TWIS interrupt handlers,
+ *          - the number of handled TWIM and TWIS interrupts.
+ *          The data received by the slave is compared with the transmitted one after every run.
+ */
+
+/** @brief Symbol specifying pin number of master SCL. */
+#define MASTER_SCL_PIN LOOPBACK_PIN_1A
+
+/** @brief Symbol specifying pin number of master SDA. */
+#define MASTER_SDA_PIN LOOPBACK_PIN_2A
+
+/** @brief Symbol specifying pin number of slave SCL. */
+#define SLAVE_SCL_PIN LOOPBACK_PIN_1B
+
+/** @brief Symbol specifying pin number of slave SDA. */
+#define SLAVE_SDA_PIN LOOPBACK_PIN_2B
+
+#if defined(NRF52_SERIES) || defined(__NRFX_DOXYGEN__)
+/** @brief Symbol specifying TWIM instance to be used. */
+#define TWIM_INST_IDX 0
+
+/** @brief Symbol specifying TWIS instance to be used. */
+#define TWIS_INST_IDX 1
+#else
+#define TWIM_INST_IDX 1
+#define TWIS_INST_IDX 2
+#endif
+
+/** @brief Symbol specifying slave address on TWI bus. */
+#define SLAVE_ADDR 0x01U
+
+/** @brief Symbol specifying the number of transfers performed for every buffer size. */
+#define TRANSFER_COUNT 16UL
+
+/** @brief Symbol specifying the maximum size of a buffer. */
+#define BUFFER_SIZE_MAX 255UL
+
+/** @brief Buffer sizes used in consecutive benchmark runs. */
+static const uint16_t m_buffer_sizes[] = {1, 4, 16, 64, BUFFER_SIZE_MAX};
+
+/** @brief Master transmit buffer. */
+static uint8_t m_tx_buffer[BUFFER_SIZE_MAX];
+
+/** @brief Slave receive buffer. */
+static uint8_t m_rx_buffer[BUFFER_SIZE_MAX];
+
+/** @brief Size of the buffers used in the current benchmark run. */
+static uint16_t m_size;
+
+/** @brief Flag indicating that the master finished the transfer. */
+static volatile bool m_twim_done;
+
+/** @brief Flag indicating that the slave finished the transfer. */
+static volatile bool m_twis_done;
+
+/** @brief Structure containing TWIS driver instance. */
+static nrfx_twis_t m_twis_inst = NRFX_TWIS_INSTANCE(TWIS_INST_IDX);
+
+/** @brief Structure containing TWIM driver instance. */
+static nrfx_twim_t m_twim_inst = NRFX_TWIM_INSTANCE(TWIM_INST_IDX);
+
+/** @brief Statistics of interrupts handled during a benchmark run. */
+static nrfx_benchmark_isr_stats_t m_isr_stats;
+
+NRFX_BENCHMARK_ISR_WRAPPER_DEFINE(twim_irq_wrapper,
+                                  NRFX_TWIM_INST_HANDLER_GET(TWIM_INST_IDX),
+                                  &m_isr_stats)
+
+NRFX_BENCHMARK_ISR_WRAPPER_DEFINE(twis_irq_wrapper,
+                                  NRFX_TWIS_INST_HANDLER_GET(TWIS_INST_IDX),
+                                  &m_isr_stats)
+
+/**
+ * @brief Function for handling TWIM driver events.
+ *
+ * @param[in] p_event   Event information structure.
+ * @param[in] p_context General purpose parameter set during initialization of the TWIM.
+ */
+static void twim_handler(nrfx_twim_evt_t const * p_event, void * p_context)
+{
+    if (p_event->type == NRFX_TWIM_EVT_DONE)
+    {
+        m_twim_done = true;
+    }
+    else
+    {
+        NRFX_LOG_ERROR("--> Master event: %d.", p_event->type);
+        m_twim_done = true;
+    }
+}
+
+/**
+ * @brief Function for handling TWIS driver events.
+ *
+ * @param[in] p_event Event information structure.
+ */
+static void twis_handler(nrfx_twis_evt_t const * p_event)
+{
+    nrfx_err_t status;
+    (void)status;
+
+    switch (p_event->type)
+    {
+        case NRFX_TWIS_EVT_WRITE_REQ:
+            status = nrfx_twis_rx_prepare(&m_twis_inst, m_rx_buffer, m_size);
+            NRFX_ASSERT(status == NRFX_SUCCESS);
+            break;
+
+        case NRFX_TWIS_EVT_WRITE_DONE:
+            m_twis_done = true;
+            break;
+
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief Function for performing a benchmark run with the specified buffer size.
+ *
+ * @param[in] size Size of the buffers used in the run.
+ */
+static void benchmark_run(uint16_t size)
+{
+    nrfx_err_t status;
+    (void)status;
+
+    nrfx_twim_xfer_desc_t twim_xfer_desc = NRFX_TWIM_XFER_DESC_TX(SLAVE_ADDR, m_tx_buffer, size);
+
+    m_size = size;
+    memset(m_rx_buffer, 0, sizeof(m_rx_buffer));
+    nrfx_benchmark_isr_stats_reset(&m_isr_stats);
+
+    uint32_t start = nrfx_benchmark_cycles_get();
+    for (uint32_t i = 0; i < TRANSFER_COUNT; i++)
+    {
+        m_twim_done = false;
+        m_twis_done = false;
+        status = nrfx_twim_xfer(&m_twim_inst, &twim_xfer_desc, 0);
+        NRFX_ASSERT(status == NRFX_SUCCESS);
+
+        while (!m_twim_done || !m_twis_done)
+        {}
+    }
+    uint32_t cycles = nrfx_benchmark_cycles_get() - start;
+
+    if (memcmp(m_tx_buffer, m_rx_buffer, size) != 0)
+    {
+        NRFX_LOG_ERROR("Received data does not match transmitted data.");
+    }
+
+    NRFX_BENCHMARK_RESULT_LOG("twim", size, size * TRANSFER_COUNT, cycles, &m_isr_stats);
+    NRFX_EXAMPLE_LOG_PROCESS();
+}
+
+/**
+ * @brief Function for application main entry.
+ *
+ * @return Nothing.
+ */
+int main(void)
+{
+    nrfx_err_t status;
+    (void)status;
+
+    NRFX_EXAMPLE_LOG_INIT();
+
+    NRFX_LOG_INFO("Starting nrfx_twim_twis benchmark example.");
+    NRFX_EXAMPLE_LOG_PROCESS();
+
+    nrfx_benchmark_init();
+
+    for (uint32_t i = 0; i < sizeof(m_tx_buffer); i++)
+    {
+        m_tx_buffer[i] = (uint8_t)i;
+    }
+
+    nrfx_twim_config_t twim_config = NRFX_TWIM_DEFAULT_CONFIG(MASTER_SCL_PIN, MASTER_SDA_PIN);
+    twim_config.frequency = NRF_TWIM_FREQ_400K;
+    status = nrfx_twim_init(&m_twim_inst, &twim_config, twim_handler, NULL);
+    NRFX_ASSERT(status == NRFX_SUCCESS);
+
+    nrfx_twis_config_t twis_config = NRFX_TWIS_DEFAULT_CONFIG(SLAVE_SCL_PIN,
+                                                              SLAVE_SDA_PIN,
+                                                              SLAVE_ADDR);
+    status = nrfx_twis_init(&m_twis_inst, &twis_config, twis_handler);
+    NRFX_ASSERT(status == NRFX_SUCCESS);
+
+#if defined(__ZEPHYR__)
+    IRQ_DIRECT_CONNECT(NRFX_IRQ_NUMBER_GET(NRF_TWIM_INST_GET(TWIM_INST_IDX)), IRQ_PRIO_LOWEST,
+                       twim_irq_wrapper, 0);
+
+    IRQ_DIRECT_CONNECT(NRFX_IRQ_NUMBER_GET(NRF_TWIS_INST_GET(TWIS_INST_IDX)), IRQ_PRIO_LOWEST,
+                       twis_irq_wrapper, 0);
+#endif
+
+    nrfx_twim_enable(&m_twim_inst);
+    nrfx_twis_enable(&m_twis_inst);
+
+    NRFX_BENCHMARK_HEADER_LOG();
+    for (uint32_t i = 0; i < NRFX_ARRAY_SIZE(m_buffer_sizes); i++)
+    {
+        benchmark_run(m_buffer_sizes[i]);
+    }
+
+    NRFX_LOG_INFO("Benchmark finished.");
+
+    while (1)
+    {
+        NRFX_EXAMPLE_LOG_PROCESS();
+    }
+}
+
+/** @} */
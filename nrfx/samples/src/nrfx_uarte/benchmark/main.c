@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <nrfx_example.h>
+#include <nrfx_benchmark.h>
+#include <nrfx_uarte.h>
+#include <string.h>
+
+#define NRFX_LOG_MODULE                 EXAMPLE
+#define NRFX_EXAMPLE_CONFIG_LOG_ENABLED 1
+#define NRFX_EXAMPLE_CONFIG_LOG_LEVEL   3
+#include <nrfx_log.h>
+
+/**
+ * @defgroup nrfx_uarte_benchmark_example Benchmark UARTE example
+ * @{
+ * @ingroup nrfx_uarte_examples
+ *
+ * @brief Example measuring the performance of nrfx_uarte driver operating in the non-blocking mode.
+ *
+ * @details Application initializes nrfx_uarte driver with TX pin looped back to RX pin.
+ *          For every size from @ref m_buffer_sizes, @ref TRANSFER_COUNT transfers are performed
+ *          one after another. In each transfer the reception is started first and then the same
+ *          number of bytes is transmitted. The transfer is finished when the reception is done.
+ *          The following values are printed with @p NRFX_BENCHMARK_RESULT_LOG():
+ *          - the achieved throughput, including the software overhead between transfers,
+ *          - the share of CPU time spent in the UARTE interrupt handler,
+ *          - the number of handled UARTE interrupts.
+ *          The received data is compared with the transmitted one after every run.
+ */
+
+/** @brief Symbol specifying UARTE instance to be used. */
+#define UARTE_INST_IDX 1
+
+/** @brief Symbol specifying TX pin number of UARTE. */
+#define UARTE_TX_PIN LOOPBACK_PIN_1A
+
+/** @brief Symbol specifying RX pin number of UARTE. */
+#define UARTE_RX_PIN LOOPBACK_PIN_1B
+
+/** @brief Symbol specifying the number of transfers performed for every buffer size. */
+#define TRANSFER_COUNT 16UL
+
+/** @brief Symbol specifying the maximum size of a buffer. */
+#define BUFFER_SIZE_MAX 255UL
+
+/** @brief Buffer sizes used in consecutive benchmark runs. */
+static const uint16_t m_buffer_sizes[] = {1, 4, 16, 64, BUFFER_SIZE_MAX};
+
+/** @brief UARTE transmit buffer. */
+static uint8_t m_tx_buffer[BUFFER_SIZE_MAX];
+
+/** @brief UARTE receive buffer. */
+static uint8_t m_rx_buffer[BUFFER_SIZE_MAX];
+
+/** @brief Flag indicating that the reception is finished. */
+static volatile bool m_rx_done;
+
+/** @brief Statistics of interrupts handled during a benchmark run. */
+static nrfx_benchmark_isr_stats_t m_isr_stats;
+
+NRFX_BENCHMARK_ISR_WRAPPER_DEFINE(uarte_irq_wrapper,
+                                  NRFX_UARTE_INST_HANDLER_GET(UARTE_INST_IDX),
+                                  &m_isr_stats)
+
+/**
+ * @brief Function for handling UARTE driver events.
+ *
+ * @param[in] p_event   Pointer to event structure. Event is allocated on the stack so it is available
+ *                      only within the context of the event handler.
+ * @param[in] p_context Context passed to the interrupt handler, set on initialization.
+ */
+static void uarte_handler(nrfx_uarte_event_t const * p_event, void * p_context)
+{
+    if (p_event->type == NRFX_UARTE_EVT_RX_DONE)
+    {
+        m_rx_done = true;
+    }
+    else if (p_event->type == NRFX_UARTE_EVT_ERROR)
+    {
+        NRFX_LOG_ERROR("UARTE error: 0x%X", p_event->data.error.error_mask);
+    }
+}
+
+/**
+ * @brief Function for performing a benchmark run with the specified buffer size.
+ *
+ * @param[in] p_uarte Pointer to the UARTE driver instance.
+ * @param[in] size    Size of the buffers used in the run.
+ */
+static void benchmark_run(nrfx_uarte_t const * p_uarte, uint16_t size)
+{
+    nrfx_err_t status;
+    (void)status;
+
+    memset(m_rx_buffer, 0, sizeof(m_rx_buffer));
+    nrfx_benchmark_isr_stats_reset(&m_isr_stats);
+
+    uint32_t start = nrfx_benchmark_cycles_get();
+    for (uint32_t i = 0; i < TRANSFER_COUNT; i++)
+    {
+        m_rx_done = false;
+        status = nrfx_uarte_rx(p_uarte, m_rx_buffer, size);
+        NRFX_ASSERT(status == NRFX_SUCCESS);
+
+        status = nrfx_uarte_tx(p_uarte, m_tx_buffer, size);
+        NRFX_ASSERT(status == NRFX_SUCCESS);
+
+        while (!m_rx_done)
+        {}
+    }
+    uint32_t cycles = nrfx_benchmark_cycles_get() - start;
+
+    if (memcmp(m_tx_buffer, m_rx_buffer, size) != 0)
+    {
+        NRFX_LOG_ERROR("Received data does not match transmitted data.");
+    }
+
+    NRFX_BENCHMARK_RESULT_LOG("uarte", size, size * TRANSFER_COUNT, cycles, &m_isr_stats);
+    NRFX_EXAMPLE_LOG_PROCESS();
+}
+
+/**
+ * @brief Function for application main entry.
+ *
+ * @return Nothing.
+ */
+int main(void)
+{
+    nrfx_err_t status;
+    (void)status;
+
+    NRFX_EXAMPLE_LOG_INIT();
+
+    NRFX_LOG_INFO("Starting nrfx_uarte benchmark example.");
+    NRFX_EXAMPLE_LOG_PROCESS();
+
+    nrfx_benchmark_init();
+
+    for (uint32_t i = 0; i < sizeof(m_tx_buffer); i++)
+    {
+        m_tx_buffer[i] = (uint8_t)i;
+    }
+
+    nrfx_uarte_t uarte_inst = NRFX_UARTE_INSTANCE(UARTE_INST_IDX);
+    nrfx_uarte_config_t uarte_config = NRFX_UARTE_DEFAULT_CONFIG(UARTE_TX_PIN, UARTE_RX_PIN);
+    uarte_config.baudrate = NRF_UARTE_BAUDRATE_1000000;
+    status = nrfx_uarte_init(&uarte_inst, &uarte_config, uarte_handler);
+    NRFX_ASSERT(status == NRFX_SUCCESS);
+
+#if defined(__ZEPHYR__)
+    IRQ_DIRECT_CONNECT(NRFX_IRQ_NUMBER_GET(NRF_UARTE_INST_GET(UARTE_INST_IDX)), IRQ_PRIO_LOWEST,
+                       uarte_irq_wrapper, 0);
+#endif
+
+    NRFX_BENCHMARK_HEADER_LOG();
+    for (uint32_t i = 0; i < NRFX_ARRAY_SIZE(m_buffer_sizes); i++)
+    {
+        benchmark_run(&uarte_inst, m_buffer_sizes[i]);
+    }
+
+    NRFX_LOG_INFO("Benchmark finished.");
+
+    while (1)
+    {
+        NRFX_EXAMPLE_LOG_PROCESS();
+    }
+}
+
+/** @} */
@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2023, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <nrfx_example.h>
+#include <nrfx_benchmark.h>
+#include <nrfx_clock.h>
+#include <helpers/nrfx_usbd_cdc_acm.h>
+#include <hal/nrf_power.h>
+#if !NRF_POWER_HAS_USBREG
+#include <hal/nrf_usbreg.h>
+#endif
+
+#define NRFX_LOG_MODULE                 EXAMPLE
+#define NRFX_EXAMPLE_CONFIG_LOG_ENABLED 1
+#define NRFX_EXAMPLE_CONFIG_LOG_LEVEL   3
+#include <nrfx_log.h>
+
+/**
+ * @defgroup nrfx_usbd_cdc_acm_example CDC ACM USBD example
+ * @{
+ * @ingroup nrfx_usbd_examples
+ *
+ * @brief Example measuring the throughput of the serial port over USB provided by
+ *        the nrfx_usbd_cdc_acm helper.
+ *
+ * @details Application initializes the nrfx_usbd_cdc_acm helper, starts the high-frequency
+ *          crystal oscillator and waits for the USB power. When the host opens the port,
+ *          @ref TX_LENGTH bytes are written to the port as fast as the host reads them and
+ *          the throughput is printed with @p NRFX_BENCHMARK_RESULT_LOG(). Then, the same
+ *          is done for @ref RX_LENGTH bytes sent by the host.
+ */
+
+/** @brief Symbol specifying the USB vendor ID reported by the device. */
+#define USB_VENDOR_ID 0x1915
+
+/** @brief Symbol specifying the USB product ID reported by the device. */
+#define USB_PRODUCT_ID 0x520F
+
+/** @brief Symbol specifying the number of bytes passed to the helper in each call. */
+#define CHUNK_LENGTH 512
+
+/** @brief Symbol specifying the number of bytes sent to the host. */
+#define TX_LENGTH (1024 * 1024)
+
+/** @brief Symbol specifying the number of bytes received from the host. */
+#define RX_LENGTH (1024 * 1024)
+
+/** @brief Buffer for the data written to and read from the port. */
+static uint8_t m_buffer[CHUNK_LENGTH];
+
+/** @brief Interrupt statistics of the current run. */
+static nrfx_benchmark_isr_stats_t m_isr_stats;
+
+/** @brief Flag set when the host opens the port, that is when it asserts the DTR signal. */
+static volatile bool m_port_open;
+
+/** @brief Flag set when all written data has been sent to the host. */
+static volatile bool m_tx_done;
+
+NRFX_BENCHMARK_ISR_WRAPPER_DEFINE(usbd_isr, nrfx_usbd_irq_handler, &m_isr_stats)
+
+/**
+ * @brief Function for handling the nrfx_usbd_cdc_acm helper events.
+ *
+ * @param[in] p_event   Pointer to the event structure.
+ * @param[in] p_context User context.
+ */
+static void cdc_acm_handler(nrfx_usbd_cdc_acm_evt_t const * p_event, void * p_context)
+{
+    switch (p_event->type)
+    {
+        case NRFX_USBD_CDC_ACM_EVT_LINE_STATE:
+            m_port_open = p_event->data.line_state.dtr;
+            break;
+        case NRFX_USBD_CDC_ACM_EVT_TX_DONE:
+            m_tx_done = true;
+            break;
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief Function for checking if the USB supply is ready.
+ *
+ * @retval true  The USB voltage regulator output is ready.
+ * @retval false No USB power or the regulator is starting.
+ */
+static bool usb_power_ready(void)
+{
+#if NRF_POWER_HAS_USBREG
+    return nrf_power_usbregstatus_outrdy_get(NRF_POWER);
+#else
+    return (nrf_usbreg_status_get(NRF_USBREGULATOR) & NRF_USBREG_STATUS_OUTPUTRDY_MASK) != 0;
+#endif
+}
+
+/** @brief Function for sending @ref TX_LENGTH bytes to the host and printing the throughput. */
+static void tx_benchmark_run(void)
+{
+    for (size_t i = 0; i < sizeof(m_buffer); i++)
+    {
+        m_buffer[i] = (uint8_t)i;
+    }
+    nrfx_benchmark_isr_stats_reset(&m_isr_stats);
+
+    uint32_t sent  = 0;
+    uint32_t start = nrfx_benchmark_cycles_get();
+    while (sent < TX_LENGTH)
+    {
+        size_t offset = sent % sizeof(m_buffer);
+        size_t chunk  = NRFX_MIN(sizeof(m_buffer) - offset, TX_LENGTH - sent);
+        m_tx_done = false;
+        sent += nrfx_usbd_cdc_acm_write(&m_buffer[offset], chunk);
+    }
+    while (!m_tx_done ||
+           (nrfx_usbd_cdc_acm_write_space_get() != NRFX_USBD_CDC_ACM_TX_BUFFER_SIZE - 1))
+    {}
+    uint32_t cycles = nrfx_benchmark_cycles_get() - start;
+
+    NRFX_BENCHMARK_RESULT_LOG("usbd_cdc_acm_tx", CHUNK_LENGTH, TX_LENGTH, cycles, &m_isr_stats);
+    NRFX_EXAMPLE_LOG_PROCESS();
+}
+
+/**
+ * @brief Function for receiving @ref RX_LENGTH bytes from the host and printing the throughput.
+ *
+ * The measurement starts when the first byte is received.
+ */
+static void rx_benchmark_run(void)
+{
+    uint32_t received = 0;
+    uint32_t start    = 0;
+
+    nrfx_benchmark_isr_stats_reset(&m_isr_stats);
+    while (received < RX_LENGTH)
+    {
+        size_t chunk = nrfx_usbd_cdc_acm_read(m_buffer, sizeof(m_buffer));
+        if ((received == 0) && (chunk > 0))
+        {
+            start = nrfx_benchmark_cycles_get();
+            nrfx_benchmark_isr_stats_reset(&m_isr_stats);
+        }
+        received += chunk;
+    }
+    uint32_t cycles = nrfx_benchmark_cycles_get() - start;
+
+    NRFX_BENCHMARK_RESULT_LOG("usbd_cdc_acm_rx", CHUNK_LENGTH, received, cycles, &m_isr_stats);
+    NRFX_EXAMPLE_LOG_PROCESS();
+}
+
+/**
+ * @brief Function for application main entry.
+ *
+ * @return Nothing.
+ */
+int main(void)
+{
+    nrfx_err_t status;
+    (void)status;
+
+    NRFX_EXAMPLE_LOG_INIT();
+
+    NRFX_LOG_INFO("Starting nrfx_usbd CDC ACM example");
+    NRFX_EXAMPLE_LOG_PROCESS();
+
+    nrfx_benchmark_init();
+
+    IRQ_CONNECT(NRFX_IRQ_NUMBER_GET(NRF_USBD), IRQ_PRIO_LOWEST, usbd_isr, 0, 0);
+
+    nrfx_usbd_cdc_acm_config_t config = {
+        .vendor_id      = USB_VENDOR_ID,
+        .product_id     = USB_PRODUCT_ID,
+        .p_manufacturer = "Nordic Semiconductor",
+        .p_product      = "nrfx CDC ACM example",
+        .p_serial       = NULL,
+    };
+    status = nrfx_usbd_cdc_acm_init(&config, cdc_acm_handler, NULL);
+    NRFX_ASSERT(status == NRFX_SUCCESS);
+
+    /* USBD requires HFCLK sourced from the crystal oscillator. */
+    nrfx_clock_hfclk_request();
+    while (!nrfx_clock_is_running(NRF_CLOCK_DOMAIN_HFCLK, NULL))
+    {}
+
+    while (!usb_power_ready())
+    {}
+    nrfx_usbd_enable();
+    nrfx_usbd_start(false);
+
+    NRFX_LOG_INFO("Waiting for the port to be opened");
+    NRFX_EXAMPLE_LOG_PROCESS();
+    while (!m_port_open)
+    {}
+
+    NRFX_BENCHMARK_HEADER_LOG();
+    tx_benchmark_run();
+
+    NRFX_LOG_INFO("Waiting for %u bytes from the host", RX_LENGTH);
+    NRFX_EXAMPLE_LOG_PROCESS();
+    rx_benchmark_run();
+
+    NRFX_LOG_INFO("Benchmark finished.");
+
+    while (1)
+    {
+        NRFX_EXAMPLE_LOG_PROCESS();
+    }
+}
+
+/** @} */
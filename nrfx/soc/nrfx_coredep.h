@@ -89,44 +89,178 @@
  */
 NRF_STATIC_INLINE void nrfx_coredep_delay_us(uint32_t time_us);
 
+/**
+ * @brief Timeout structure.
+ *
+ * When the DWT unit is present, the timeout is measured with the cycle counter at the CPU
+ * frequency read at the start, otherwise it is counted down in steps of
+ * @ref nrfx_coredep_delay_us of one microsecond.
+ */
+typedef struct
+{
+#if NRFX_DELAY_DWT_PRESENT || defined(__NRFX_DOXYGEN__)
+    uint32_t core_debug; ///< Preserved value of the DEMCR register. For internal use only.
+    uint32_t dwt_ctrl;   ///< Preserved value of the DWT CTRL register. For internal use only.
+    uint32_t start;      ///< Cycle counter value at the start. For internal use only.
+    uint32_t cycles;     ///< Duration of the timeout in cycles. For internal use only.
+#else
+    uint32_t remaining;  ///< Remaining time in microseconds. For internal use only.
+#endif
+} nrfx_coredep_timeout_t;
+
+/**
+ * @brief Function for starting a timeout.
+ *
+ * Every timeout that is started must be ended with @ref nrfx_coredep_timeout_end.
+ *
+ * @note The duration is limited to the maximum value of the uint32_t type divided by
+ *       the CPU frequency in MHz.
+ *
+ * @param[out] p_timeout Pointer to the timeout structure.
+ * @param[in]  time_us   Duration of the timeout in microseconds.
+ */
+NRF_STATIC_INLINE void nrfx_coredep_timeout_start(nrfx_coredep_timeout_t * p_timeout,
+                                                  uint32_t                 time_us);
+
+/**
+ * @brief Function for checking whether a timeout has expired.
+ *
+ * @param[in,out] p_timeout Pointer to the timeout structure.
+ *
+ * @retval true  The timeout has expired.
+ * @retval false The timeout has not expired yet.
+ */
+NRF_STATIC_INLINE bool nrfx_coredep_timeout_check(nrfx_coredep_timeout_t * p_timeout);
+
+/**
+ * @brief Function for ending a timeout.
+ *
+ * @param[in] p_timeout Pointer to the timeout structure.
+ */
+NRF_STATIC_INLINE void nrfx_coredep_timeout_end(nrfx_coredep_timeout_t const * p_timeout);
+
+/**
+ * @brief Macro for waiting until a condition is met or a timeout expires.
+ *
+ * Unlike @ref NRFX_WAIT_FOR, the condition is checked continuously, so the wait ends
+ * as soon as it is met, and the timeout does not depend on the time spent checking it.
+ *
+ * @param[in]  condition  Condition to meet.
+ * @param[in]  timeout_us Timeout in microseconds.
+ * @param[out] result     Boolean variable to store the result of the wait process.
+ *                        Set to true if the condition is met or false otherwise.
+ */
+#define NRFX_COREDEP_WAIT_FOR_US(condition, timeout_us, result) \
+do {                                                            \
+    nrfx_coredep_timeout_t timeout;                             \
+    nrfx_coredep_timeout_start(&timeout, (timeout_us));         \
+    do {                                                        \
+        result = (condition);                                   \
+    } while (!(result) && !nrfx_coredep_timeout_check(&timeout)); \
+    nrfx_coredep_timeout_end(&timeout);                         \
+} while (0)
+
+#if NRFX_DELAY_DWT_PRESENT || defined(__NRFX_DOXYGEN__)
+/**
+ * @brief Function for delaying execution for a number of microseconds using the DWT cycle counter.
+ *
+ * The delay does not depend on the memory wait states or the cache, and the CPU frequency
+ * is read at runtime where it can be changed. This function is available regardless
+ * of the @c NRFX_DELAY_DWT_BASED setting.
+ *
+ * @param time_us Number of microseconds to wait.
+ */
+NRF_STATIC_INLINE void nrfx_coredep_dwt_delay_us(uint32_t time_us);
+#endif
+
 /** @} */
 
 #ifndef NRF_DECLARE_ONLY
 
-#if NRFX_CHECK(NRFX_DELAY_DWT_BASED)
+#if NRFX_DELAY_DWT_PRESENT
 
-#if !NRFX_DELAY_DWT_PRESENT
-#error "DWT unit not present in the SoC that is used."
-#endif
+NRF_STATIC_INLINE void nrfx_coredep_timeout_start(nrfx_coredep_timeout_t * p_timeout,
+                                                  uint32_t                 time_us)
+{
+    p_timeout->cycles = time_us * NRFX_DELAY_CPU_FREQ_MHZ;
 
-NRF_STATIC_INLINE void nrfx_coredep_delay_us(uint32_t time_us)
+    // Save the current state of the DEMCR register to be able to restore it at the end.
+    // Enable the trace and debug blocks (including DWT).
+    p_timeout->core_debug = CoreDebug->DEMCR;
+    CoreDebug->DEMCR = p_timeout->core_debug | CoreDebug_DEMCR_TRCENA_Msk;
+
+    // Save the current state of the CTRL register in the DWT block. Make sure
+    // that the cycle counter is enabled.
+    p_timeout->dwt_ctrl = DWT->CTRL;
+    DWT->CTRL = p_timeout->dwt_ctrl | DWT_CTRL_CYCCNTENA_Msk;
+
+    // Store start value of the cycle counter.
+    p_timeout->start = DWT->CYCCNT;
+}
+
+NRF_STATIC_INLINE bool nrfx_coredep_timeout_check(nrfx_coredep_timeout_t * p_timeout)
+{
+    return (DWT->CYCCNT - p_timeout->start) >= p_timeout->cycles;
+}
+
+NRF_STATIC_INLINE void nrfx_coredep_timeout_end(nrfx_coredep_timeout_t const * p_timeout)
+{
+    // Restore preserved registers.
+    DWT->CTRL = p_timeout->dwt_ctrl;
+    CoreDebug->DEMCR = p_timeout->core_debug;
+}
+
+NRF_STATIC_INLINE void nrfx_coredep_dwt_delay_us(uint32_t time_us)
 {
     if (time_us == 0)
     {
         return;
     }
-    uint32_t time_cycles = time_us * NRFX_DELAY_CPU_FREQ_MHZ;
 
-    // Save the current state of the DEMCR register to be able to restore it before exiting
-    // this function. Enable the trace and debug blocks (including DWT).
-    uint32_t core_debug = CoreDebug->DEMCR;
-    CoreDebug->DEMCR = core_debug | CoreDebug_DEMCR_TRCENA_Msk;
+    nrfx_coredep_timeout_t timeout;
 
-    // Save the current state of the CTRL register in the DWT block. Make sure
-    // that the cycle counter is enabled.
-    uint32_t dwt_ctrl = DWT->CTRL;
-    DWT->CTRL = dwt_ctrl | DWT_CTRL_CYCCNTENA_Msk;
+    nrfx_coredep_timeout_start(&timeout, time_us);
+    while (!nrfx_coredep_timeout_check(&timeout))
+    {}
+    nrfx_coredep_timeout_end(&timeout);
+}
 
-    // Store start value of the cycle counter.
-    uint32_t cyccnt_initial = DWT->CYCCNT;
+#else // NRFX_DELAY_DWT_PRESENT
 
-    // Delay required time.
-    while ((DWT->CYCCNT - cyccnt_initial) < time_cycles)
-    {}
+NRF_STATIC_INLINE void nrfx_coredep_timeout_start(nrfx_coredep_timeout_t * p_timeout,
+                                                  uint32_t                 time_us)
+{
+    p_timeout->remaining = time_us;
+}
 
-    // Restore preserved registers.
-    DWT->CTRL = dwt_ctrl;
-    CoreDebug->DEMCR = core_debug;
+NRF_STATIC_INLINE bool nrfx_coredep_timeout_check(nrfx_coredep_timeout_t * p_timeout)
+{
+    if (p_timeout->remaining == 0)
+    {
+        return true;
+    }
+
+    nrfx_coredep_delay_us(1);
+    p_timeout->remaining--;
+    return false;
+}
+
+NRF_STATIC_INLINE void nrfx_coredep_timeout_end(nrfx_coredep_timeout_t const * p_timeout)
+{
+    (void)p_timeout;
+}
+
+#endif // NRFX_DELAY_DWT_PRESENT
+
+#if NRFX_CHECK(NRFX_DELAY_DWT_BASED)
+
+#if !NRFX_DELAY_DWT_PRESENT
+#error "DWT unit not present in the SoC that is used."
+#endif
+
+NRF_STATIC_INLINE void nrfx_coredep_delay_us(uint32_t time_us)
+{
+    nrfx_coredep_dwt_delay_us(time_us);
 }
 
 #else // NRFX_CHECK(NRFX_DELAY_DWT_BASED)
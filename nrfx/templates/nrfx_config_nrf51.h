@@ -111,6 +111,76 @@
 
 // </e>
 
+// <e> NRFX_AAR_ENABLED - nrfx_aar - AAR peripheral driver
+//==========================================================
+#ifndef NRFX_AAR_ENABLED
+#define NRFX_AAR_ENABLED 0
+#endif
+
+// <o> NRFX_AAR_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
+
+// <0=> 0 (highest)
+// <1=> 1
+// <2=> 2
+// <3=> 3
+
+#ifndef NRFX_AAR_DEFAULT_CONFIG_IRQ_PRIORITY
+#define NRFX_AAR_DEFAULT_CONFIG_IRQ_PRIORITY 3
+#endif
+
+// <e> NRFX_AAR_CONFIG_LOG_ENABLED - Enables logging in the module.
+//==========================================================
+#ifndef NRFX_AAR_CONFIG_LOG_ENABLED
+#define NRFX_AAR_CONFIG_LOG_ENABLED 0
+#endif
+// <o> NRFX_AAR_CONFIG_LOG_LEVEL  - Default Severity level
+
+// <0=> Off
+// <1=> Error
+// <2=> Warning
+// <3=> Info
+// <4=> Debug
+
+#ifndef NRFX_AAR_CONFIG_LOG_LEVEL
+#define NRFX_AAR_CONFIG_LOG_LEVEL 3
+#endif
+
+// <o> NRFX_AAR_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+
+// <0=> Default
+// <1=> Black
+// <2=> Red
+// <3=> Green
+// <4=> Yellow
+// <5=> Blue
+// <6=> Magenta
+// <7=> Cyan
+// <8=> White
+
+#ifndef NRFX_AAR_CONFIG_INFO_COLOR
+#define NRFX_AAR_CONFIG_INFO_COLOR 0
+#endif
+
+// <o> NRFX_AAR_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+
+// <0=> Default
+// <1=> Black
+// <2=> Red
+// <3=> Green
+// <4=> Yellow
+// <5=> Blue
+// <6=> Magenta
+// <7=> Cyan
+// <8=> White
+
+#ifndef NRFX_AAR_CONFIG_DEBUG_COLOR
+#define NRFX_AAR_CONFIG_DEBUG_COLOR 0
+#endif
+
+// </e>
+
+// </e>
+
 // <e> NRFX_CLOCK_ENABLED - nrfx_clock - CLOCK peripheral driver
 //==========================================================
 #ifndef NRFX_CLOCK_ENABLED
@@ -213,6 +283,76 @@
 
 // </e>
 
+// <e> NRFX_ECB_ENABLED - nrfx_ecb - ECB peripheral driver
+//==========================================================
+#ifndef NRFX_ECB_ENABLED
+#define NRFX_ECB_ENABLED 0
+#endif
+
+// <o> NRFX_ECB_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
+
+// <0=> 0 (highest)
+// <1=> 1
+// <2=> 2
+// <3=> 3
+
+#ifndef NRFX_ECB_DEFAULT_CONFIG_IRQ_PRIORITY
+#define NRFX_ECB_DEFAULT_CONFIG_IRQ_PRIORITY 3
+#endif
+
+// <e> NRFX_ECB_CONFIG_LOG_ENABLED - Enables logging in the module.
+//==========================================================
+#ifndef NRFX_ECB_CONFIG_LOG_ENABLED
+#define NRFX_ECB_CONFIG_LOG_ENABLED 0
+#endif
+// <o> NRFX_ECB_CONFIG_LOG_LEVEL  - Default Severity level
+
+// <0=> Off
+// <1=> Error
+// <2=> Warning
+// <3=> Info
+// <4=> Debug
+
+#ifndef NRFX_ECB_CONFIG_LOG_LEVEL
+#define NRFX_ECB_CONFIG_LOG_LEVEL 3
+#endif
+
+// <o> NRFX_ECB_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+
+// <0=> Default
+// <1=> Black
+// <2=> Red
+// <3=> Green
+// <4=> Yellow
+// <5=> Blue
+// <6=> Magenta
+// <7=> Cyan
+// <8=> White
+
+#ifndef NRFX_ECB_CONFIG_INFO_COLOR
+#define NRFX_ECB_CONFIG_INFO_COLOR 0
+#endif
+
+// <o> NRFX_ECB_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+
+// <0=> Default
+// <1=> Black
+// <2=> Red
+// <3=> Green
+// <4=> Yellow
+// <5=> Blue
+// <6=> Magenta
+// <7=> Cyan
+// <8=> White
+
+#ifndef NRFX_ECB_CONFIG_DEBUG_COLOR
+#define NRFX_ECB_CONFIG_DEBUG_COLOR 0
+#endif
+
+// </e>
+
+// </e>
+
 // <e> NRFX_GPIOTE_ENABLED - nrfx_gpiote - GPIOTE peripheral driver
 //==========================================================
 #ifndef NRFX_GPIOTE_ENABLED
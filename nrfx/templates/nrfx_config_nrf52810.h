@@ -42,6 +42,80 @@
 
 // <h> nRF_Drivers
 
+// <e> NRFX_AAR_ENABLED - nrfx_aar - AAR peripheral driver
+//==========================================================
+#ifndef NRFX_AAR_ENABLED
+#define NRFX_AAR_ENABLED 0
+#endif
+
+// <o> NRFX_AAR_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
+
+// <0=> 0 (highest)
+// <1=> 1
+// <2=> 2
+// <3=> 3
+// <4=> 4
+// <5=> 5
+// <6=> 6
+// <7=> 7
+
+#ifndef NRFX_AAR_DEFAULT_CONFIG_IRQ_PRIORITY
+#define NRFX_AAR_DEFAULT_CONFIG_IRQ_PRIORITY 7
+#endif
+
+// <e> NRFX_AAR_CONFIG_LOG_ENABLED - Enables logging in the module.
+//==========================================================
+#ifndef NRFX_AAR_CONFIG_LOG_ENABLED
+#define NRFX_AAR_CONFIG_LOG_ENABLED 0
+#endif
+// <o> NRFX_AAR_CONFIG_LOG_LEVEL  - Default Severity level
+
+// <0=> Off
+// <1=> Error
+// <2=> Warning
+// <3=> Info
+// <4=> Debug
+
+#ifndef NRFX_AAR_CONFIG_LOG_LEVEL
+#define NRFX_AAR_CONFIG_LOG_LEVEL 3
+#endif
+
+// <o> NRFX_AAR_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+
+// <0=> Default
+// <1=> Black
+// <2=> Red
+// <3=> Green
+// <4=> Yellow
+// <5=> Blue
+// <6=> Magenta
+// <7=> Cyan
+// <8=> White
+
+#ifndef NRFX_AAR_CONFIG_INFO_COLOR
+#define NRFX_AAR_CONFIG_INFO_COLOR 0
+#endif
+
+// <o> NRFX_AAR_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+
+// <0=> Default
+// <1=> Black
+// <2=> Red
+// <3=> Green
+// <4=> Yellow
+// <5=> Blue
+// <6=> Magenta
+// <7=> Cyan
+// <8=> White
+
+#ifndef NRFX_AAR_CONFIG_DEBUG_COLOR
+#define NRFX_AAR_CONFIG_DEBUG_COLOR 0
+#endif
+
+// </e>
+
+// </e>
+
 // <e> NRFX_CLOCK_ENABLED - nrfx_clock - CLOCK peripheral driver
 //==========================================================
 #ifndef NRFX_CLOCK_ENABLED
@@ -224,6 +298,80 @@
 
 // </e>
 
+// <e> NRFX_ECB_ENABLED - nrfx_ecb - ECB peripheral driver
+//==========================================================
+#ifndef NRFX_ECB_ENABLED
+#define NRFX_ECB_ENABLED 0
+#endif
+
+// <o> NRFX_ECB_DEFAULT_CONFIG_IRQ_PRIORITY  - Interrupt priority
+
+// <0=> 0 (highest)
+// <1=> 1
+// <2=> 2
+// <3=> 3
+// <4=> 4
+// <5=> 5
+// <6=> 6
+// <7=> 7
+
+#ifndef NRFX_ECB_DEFAULT_CONFIG_IRQ_PRIORITY
+#define NRFX_ECB_DEFAULT_CONFIG_IRQ_PRIORITY 7
+#endif
+
+// <e> NRFX_ECB_CONFIG_LOG_ENABLED - Enables logging in the module.
+//==========================================================
+#ifndef NRFX_ECB_CONFIG_LOG_ENABLED
+#define NRFX_ECB_CONFIG_LOG_ENABLED 0
+#endif
+// <o> NRFX_ECB_CONFIG_LOG_LEVEL  - Default Severity level
+
+// <0=> Off
+// <1=> Error
+// <2=> Warning
+// <3=> Info
+// <4=> Debug
+
+#ifndef NRFX_ECB_CONFIG_LOG_LEVEL
+#define NRFX_ECB_CONFIG_LOG_LEVEL 3
+#endif
+
+// <o> NRFX_ECB_CONFIG_INFO_COLOR  - ANSI escape code prefix.
+
+// <0=> Default
+// <1=> Black
+// <2=> Red
+// <3=> Green
+// <4=> Yellow
+// <5=> Blue
+// <6=> Magenta
+// <7=> Cyan
+// <8=> White
+
+#ifndef NRFX_ECB_CONFIG_INFO_COLOR
+#define NRFX_ECB_CONFIG_INFO_COLOR 0
+#endif
+
+// <o> NRFX_ECB_CONFIG_DEBUG_COLOR  - ANSI escape code prefix.
+
+// <0=> Default
+// <1=> Black
+// <2=> Red
+// <3=> Green
+// <4=> Yellow
+// <5=> Blue
+// <6=> Magenta
+// <7=> Cyan
+// <8=> White
+
+#ifndef NRFX_ECB_CONFIG_DEBUG_COLOR
+#define NRFX_ECB_CONFIG_DEBUG_COLOR 0
+#endif
+
+// </e>
+
+// </e>
+
 // <e> NRFX_EGU_ENABLED - nrfx_egu - EGU peripheral driver.
 //==========================================================
 #ifndef NRFX_EGU_ENABLED
@@ -1155,6 +1303,17 @@
 #define NRFX_SPI_DEFAULT_CONFIG_IRQ_PRIORITY 7
 #endif
 
+// <q> NRFX_SPI_EASYDMA_BRIDGE_ENABLED  - Enables running SPI transfers on SPIM with EasyDMA.
+
+
+// <i> Transfers with buffers in RAM are executed by the SPIM peripheral
+// <i> that shares the base address with SPI. Such transfers generate
+// <i> a single interrupt instead of one interrupt per byte.
+
+#ifndef NRFX_SPI_EASYDMA_BRIDGE_ENABLED
+#define NRFX_SPI_EASYDMA_BRIDGE_ENABLED 0
+#endif
+
 // <e> NRFX_SPI_CONFIG_LOG_ENABLED - Enables logging in the module.
 //==========================================================
 #ifndef NRFX_SPI_CONFIG_LOG_ENABLED
@@ -1533,6 +1692,18 @@
 #define NRFX_TWI_DEFAULT_CONFIG_IRQ_PRIORITY 7
 #endif
 
+// <q> NRFX_TWI_EASYDMA_BRIDGE_ENABLED  - Enables running TWI transfers on TWIM with EasyDMA.
+
+
+// <i> Transfers with buffers in RAM, except TXTX transfers and transfers
+// <i> that leave the bus suspended, are executed by the TWIM peripheral
+// <i> that shares the base address with TWI. Such transfers generate
+// <i> a single interrupt instead of one interrupt per byte.
+
+#ifndef NRFX_TWI_EASYDMA_BRIDGE_ENABLED
+#define NRFX_TWI_EASYDMA_BRIDGE_ENABLED 0
+#endif
+
 // <e> NRFX_TWI_CONFIG_LOG_ENABLED - Enables logging in the module.
 //==========================================================
 #ifndef NRFX_TWI_CONFIG_LOG_ENABLED
@@ -1693,6 +1864,18 @@
 #define NRFX_UART_DEFAULT_CONFIG_IRQ_PRIORITY 7
 #endif
 
+// <q> NRFX_UART_EASYDMA_BRIDGE_ENABLED  - Enables running UART transmissions on UARTE with EasyDMA.
+
+
+// <i> Transmissions from RAM started while the receiver is not in use
+// <i> are executed by the UARTE peripheral that shares the base address
+// <i> with UART. Starting a reception switches a transmission in progress
+// <i> back to one interrupt per byte.
+
+#ifndef NRFX_UART_EASYDMA_BRIDGE_ENABLED
+#define NRFX_UART_EASYDMA_BRIDGE_ENABLED 0
+#endif
+
 // <e> NRFX_UART_CONFIG_LOG_ENABLED - Enables logging in the module.
 //==========================================================
 #ifndef NRFX_UART_CONFIG_LOG_ENABLED
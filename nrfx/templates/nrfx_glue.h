@@ -135,6 +135,49 @@ extern "C" {
 /** @brief Macro for exiting from a critical section. */
 #define NRFX_CRITICAL_SECTION_EXIT()
 
+/**
+ * @brief Macro for declaring a lock that protects a single driver resource.
+ *
+ * The drivers use the locks instead of @ref NRFX_CRITICAL_SECTION_ENTER for short
+ * updates of state that is private to them, so that an integration can map them to
+ * something less intrusive than the global interrupt disable, for example a BASEPRI
+ * ceiling or a spinlock. The lock must exclude every context that accesses the resource,
+ * including the interrupt handler of the driver, on the current core.
+ *
+ * This macro and @ref NRFX_LOCK_TAKE and @ref NRFX_LOCK_GIVE are optional. If they are not
+ * defined, the locks fall back to the critical section.
+ *
+ * @param lock Name of the lock. It is used at file scope as a static definition.
+ */
+#define NRFX_LOCK_DECLARE(lock)
+
+/**
+ * @brief Macro for taking a lock declared with @ref NRFX_LOCK_DECLARE.
+ *
+ * The lock is given back with @ref NRFX_LOCK_GIVE in the same scope.
+ *
+ * @param lock Name of the lock.
+ */
+#define NRFX_LOCK_TAKE(lock)
+
+/**
+ * @brief Macro for giving back a lock taken with @ref NRFX_LOCK_TAKE.
+ *
+ * @param lock Name of the lock.
+ */
+#define NRFX_LOCK_GIVE(lock)
+
+/**
+ * @brief Attribute of the IRQ handlers of the drivers and of the internal
+ *        handlers they call.
+ *
+ * It can be defined as a section attribute, for example
+ * @c __attribute__((section(".ramfunc"))), to let the linker place the IRQ
+ * handlers in RAM, so that they are not stalled by ongoing flash operations.
+ * Functions called from the handlers that are not inlined remain in flash.
+ */
+#define NRFX_IRQ_HANDLER_ATTR
+
 //------------------------------------------------------------------------------
 
 /**
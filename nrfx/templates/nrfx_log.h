@@ -51,6 +51,9 @@ extern "C" {
  *
  * @brief This file contains macros that should be implemented according to
  *        the needs of the host environment into which @em nrfx is integrated.
+ *
+ * The message macros can be mapped to @ref NRFX_BINLOG to record the messages
+ * without formatting them, see @ref nrfx_binlog.
  */
 
 /**